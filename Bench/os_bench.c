@@ -0,0 +1,1528 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        KERNEL MICRO-BENCHMARKS
+*
+* File    : os_bench.c
+* Version : V3.08.00
+************************************************************************************************************************
+* Note(s) : (1) The benchmarks are run by the task that calls OSBenchRun(), called the bench task below.  The helper
+*               tasks are created one priority level above or below it, depending on the benchmark, and deleted
+*               once the benchmark is done.
+*
+*           (2) Each measurement includes the cost of two OS_TS_GET() calls, reported on the 'ts_get' line.
+************************************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "../Source/os.h"
+#include "os_bench.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_bench__c = "$Id: $";
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                  CONFIGURATION ERRORS
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TS_EN == 0u)
+#error  "OS_CFG.H, OS_CFG_TS_EN must be Enabled (1) to run the benchmarks"
+#endif
+
+#if (OS_CFG_TASK_DEL_EN == 0u)
+#error  "OS_CFG.H, OS_CFG_TASK_DEL_EN must be Enabled (1) to run the benchmarks"
+#endif
+
+#if (OS_BENCH_CFG_TASK_MAX < 1u)
+#error  "OS_CFG.H, OS_BENCH_CFG_TASK_MAX must be at least 1"
+#endif
+
+#if (OS_BENCH_CFG_TMR_MAX < 1u)
+#error  "OS_CFG.H, OS_BENCH_CFG_TMR_MAX must be at least 1"
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                    LOCAL DEFINES
+************************************************************************************************************************
+*/
+
+#define  OS_BENCH_LINE_SIZE                   96u               /* Size of an output line, including the NUL            */
+
+#define  OS_BENCH_Q_SIZE                       8u               /* Messages posted in a row by the 'q_post' benchmark   */
+
+#define  OS_BENCH_MEM_NBR_BLKS                 4u
+
+#define  OS_BENCH_FLAG                 ((OS_FLAGS)1u)
+
+                                                                /* Helper delays outlast the 'tick' benchmark           */
+#define  OS_BENCH_DLY_TICKS            ((OS_TICK)((OS_BENCH_CFG_TICK_ITER * 2u) + 10u))
+
+                                                                /* Timeouts that don't expire during a benchmark        */
+#define  OS_BENCH_TMO_TICKS            ((OS_TICK)60000u)
+
+
+/*
+************************************************************************************************************************
+*                                                  LOCAL DATA TYPES
+************************************************************************************************************************
+*/
+
+typedef  struct  os_bench_acc {                                 /* Statistics of one benchmark                          */
+    CPU_TS      Min;
+    CPU_TS      Max;
+    CPU_INT64U  Sum;
+    CPU_INT32U  Ctr;
+} OS_BENCH_ACC;
+
+
+/*
+************************************************************************************************************************
+*                                                   LOCAL VARIABLES
+************************************************************************************************************************
+*/
+
+static  OS_TCB                OS_BenchTaskTCB[OS_BENCH_CFG_TASK_MAX];                     /* Helper tasks               */
+static  CPU_STK               OS_BenchTaskStk[OS_BENCH_CFG_TASK_MAX][OS_BENCH_CFG_STK_SIZE];
+
+static  OS_TCB               *OS_BenchTCBPtr;                                             /* Bench task                 */
+static  OS_BENCH_OUT_FNCT     OS_BenchOutFnct;
+static  OS_BENCH_ACC          OS_BenchAcc;                                                /* Filled by the helper tasks */
+static  CPU_TS      volatile  OS_BenchTsStart;
+static  CPU_BOOLEAN           OS_BenchObjCreated;
+
+#if (OS_CFG_SEM_EN > 0u)
+static  OS_SEM                OS_BenchSem[2];
+#endif
+
+#if (OS_CFG_MUTEX_EN > 0u)
+static  OS_MUTEX              OS_BenchMutex;
+#endif
+
+#if (OS_CFG_FLAG_EN > 0u)
+static  OS_FLAG_GRP           OS_BenchFlagGrp;
+#endif
+
+#if (OS_CFG_Q_EN > 0u)
+static  OS_Q                  OS_BenchQ;
+#endif
+
+#if (OS_CFG_TMR_EN > 0u)
+static  OS_TMR                OS_BenchTmr[OS_BENCH_CFG_TMR_MAX + 1u];                     /* Last one is the probe      */
+#endif
+
+#if (OS_CFG_MEM_EN > 0u)
+static  OS_MEM                OS_BenchMem;
+static  void                 *OS_BenchMemStorage[OS_BENCH_MEM_NBR_BLKS][2];
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                              LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  void         OS_BenchStart        (OS_BENCH_OUT_FNCT   out_fnct,
+                                           OS_ERR             *p_err);
+static  void         OS_BenchObjCreate    (OS_ERR             *p_err);
+
+static  void         OS_BenchTsGet        (void);
+static  void         OS_BenchCtxSw        (OS_ERR             *p_err);
+static  void         OS_BenchInt          (OS_BENCH_INT_FNCT   int_fnct,
+                                           OS_ERR             *p_err);
+#if (OS_CFG_SEM_EN > 0u)
+static  void         OS_BenchSemPingPong  (OS_ERR             *p_err);
+#endif
+#if (OS_CFG_Q_EN > 0u)
+static  void         OS_BenchQPostPend    (OS_ERR             *p_err);
+#endif
+#if (OS_CFG_MUTEX_EN > 0u)
+static  void         OS_BenchMutexPend    (OS_ERR             *p_err);
+#endif
+#if (OS_CFG_FLAG_EN > 0u)
+static  void         OS_BenchFlag         (OS_OBJ_QTY          nbr_tasks,
+                                           OS_ERR             *p_err);
+#endif
+#if (OS_CFG_MEM_EN > 0u)
+static  void         OS_BenchMemGetPut    (OS_ERR             *p_err);
+#endif
+#if (OS_CFG_TICK_EN > 0u)
+static  void         OS_BenchTick         (OS_OBJ_QTY          nbr_tasks,
+                                           OS_ERR             *p_err);
+#endif
+
+#if (OS_CFG_TICK_EN > 0u)
+static  void         OS_BenchStressTick   (OS_OBJ_QTY          nbr_tasks,
+                                           OS_ERR             *p_err);
+#endif
+#if (OS_CFG_SEM_EN > 0u)
+static  void         OS_BenchStressPend   (OS_OBJ_QTY          nbr_tasks,
+                                           OS_ERR             *p_err);
+#endif
+#if (OS_CFG_TMR_EN > 0u)
+static  void         OS_BenchStressTmr    (OS_OBJ_QTY          nbr_tmrs,
+                                           OS_ERR             *p_err);
+#endif
+#if (OS_CFG_STAT_TASK_EN > 0u) && (OS_CFG_TICK_EN > 0u)
+static  void         OS_BenchStressStat   (OS_OBJ_QTY          nbr_tasks,
+                                           OS_ERR             *p_err);
+#endif
+
+static  void         OS_BenchSwTask       (void               *p_arg);
+#if (OS_CFG_TICK_EN > 0u)
+static  void         OS_BenchTmoTask      (void               *p_arg);
+#endif
+#if (OS_CFG_SEM_EN > 0u)
+static  void         OS_BenchSemTask      (void               *p_arg);
+static  void         OS_BenchSemWaitTask  (void               *p_arg);
+#endif
+#if (OS_CFG_MUTEX_EN > 0u)
+static  void         OS_BenchMutexTask    (void               *p_arg);
+#endif
+#if (OS_CFG_FLAG_EN > 0u)
+static  void         OS_BenchFlagTask     (void               *p_arg);
+#endif
+#if (OS_CFG_TICK_EN > 0u)
+static  void         OS_BenchDlyTask      (void               *p_arg);
+#endif
+
+static  void         OS_BenchTaskCreate   (OS_OBJ_QTY          ix,
+                                           OS_TASK_PTR         p_task,
+                                           OS_PRIO             prio,
+                                           OS_ERR             *p_err);
+static  void         OS_BenchTasksCreate  (OS_OBJ_QTY          nbr_tasks,
+                                           OS_TASK_PTR         p_task,
+                                           OS_PRIO             prio,
+                                           OS_ERR             *p_err);
+static  void         OS_BenchTaskDel      (OS_OBJ_QTY          nbr_tasks);
+static  OS_OBJ_QTY   OS_BenchSweepNext    (OS_OBJ_QTY          nbr,
+                                           OS_OBJ_QTY          nbr_max);
+
+static  void         OS_BenchAccReset     (OS_BENCH_ACC       *p_acc);
+static  void         OS_BenchAccAdd       (OS_BENCH_ACC       *p_acc,
+                                           CPU_TS              ts);
+static  void         OS_BenchReport       (CPU_CHAR           *p_name,
+                                           OS_OBJ_QTY          param,
+                                           OS_BENCH_ACC       *p_acc);
+static  CPU_CHAR    *OS_BenchFmtStr       (CPU_CHAR           *p_dest,
+                                           CPU_CHAR           *p_str);
+static  CPU_CHAR    *OS_BenchFmtNbr       (CPU_CHAR           *p_dest,
+                                           CPU_INT64U          nbr);
+
+
+/*
+************************************************************************************************************************
+*                                                 RUN THE BENCHMARKS
+*
+* Description: This function runs every benchmark supported by the configuration and passes one line per benchmark to
+*              'out_fnct' (see os_bench.h).
+*
+* Arguments  : out_fnct    is the function that receives the output lines.  It is called from the bench task.
+*
+*              int_fnct    is a function that triggers an interrupt whose handler calls OSBenchIntHandler() (see
+*                          Note #2).  The 'isr_task' benchmark is skipped if you pass a NULL pointer.
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE              All the benchmarks were run
+*                              OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*                              OS_ERR_PRIO_INVALID      If the priority of the calling task leaves no room for the
+*                                                       helper tasks (see Note #1)
+*                              OS_ERR_xxx               Any error code returned by the kernel services used
+*
+* Returns    : none
+*
+* Note(s)    : 1) The helper tasks run one priority level above and one level below the calling task.  The neighboring
+*                 levels should not be used by other tasks that are ready while the benchmarks run.
+*
+*              2) 'int_fnct' must not return before the interrupt was serviced, e.g. it can set the interrupt pending
+*                 in the interrupt controller.  The interrupt handler must be kernel aware and call
+*                 OSBenchIntHandler() between OSIntEnter() and OSIntExit().
+*
+*              3) This function MUST be called from a task, the tick being initialized.
+************************************************************************************************************************
+*/
+
+void  OSBenchRun (OS_BENCH_OUT_FNCT   out_fnct,
+                  OS_BENCH_INT_FNCT   int_fnct,
+                  OS_ERR             *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    OS_BenchStart(out_fnct, p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+    OS_BenchTsGet();
+
+    OS_BenchCtxSw(p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+    if (int_fnct != (OS_BENCH_INT_FNCT)0) {
+        OS_BenchInt(int_fnct, p_err);
+        if (*p_err != OS_ERR_NONE) {
+            return;
+        }
+    }
+
+#if (OS_CFG_SEM_EN > 0u)
+    OS_BenchSemPingPong(p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+#endif
+
+#if (OS_CFG_Q_EN > 0u)
+    OS_BenchQPostPend(p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+#endif
+
+#if (OS_CFG_MUTEX_EN > 0u)
+    OS_BenchMutexPend(p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+#endif
+
+#if (OS_CFG_FLAG_EN > 0u)
+    OS_BenchFlag(1u, p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+    if (OS_BENCH_CFG_TASK_MAX > 1u) {
+        OS_BenchFlag(OS_BENCH_CFG_TASK_MAX, p_err);
+        if (*p_err != OS_ERR_NONE) {
+            return;
+        }
+    }
+#endif
+
+#if (OS_CFG_MEM_EN > 0u)
+    OS_BenchMemGetPut(p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+#endif
+
+#if (OS_CFG_TICK_EN > 0u)
+    OS_BenchTick(1u, p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+    if (OS_BENCH_CFG_TASK_MAX > 1u) {
+        OS_BenchTick(OS_BENCH_CFG_TASK_MAX, p_err);
+        if (*p_err != OS_ERR_NONE) {
+            return;
+        }
+    }
+#endif
+
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              RUN THE STRESS BENCHMARKS
+*
+* Description: This function measures how the kernel paths that walk a list scale with the length of that list.  Each
+*              benchmark is run for 1, 2, 4, ... objects, up to OS_BENCH_CFG_TASK_MAX tasks or OS_BENCH_CFG_TMR_MAX
+*              timers, and passes one line per run to 'out_fnct' with the number of objects in <param>:
+*
+*                  tick_insert        OSTaskSemPost() to a task pending with a timeout, until that task is back in
+*                                     the tick list behind the other <param>-1 tasks (OS_TickListInsert()).
+*
+*                  sem_pend_prio      OSSemPost() to a semaphore with <param> waiters of the same priority, until
+*                                     the readied task is back in the pend list behind the others
+*                                     (OS_PendListInsertPrio()).
+*
+*                  tmr_start          OSTmrStart() of a timer expiring after the <param> running timers
+*                                     (OS_TmrLink()).
+*
+*                  flag_post          OSFlagPost() readying <param> tasks, without scheduling.
+*
+*                  stat_task          Run time of the statistic task (OSStatTaskTime) with <param> more tasks.
+*
+* Arguments  : out_fnct    is the function that receives the output lines.  It is called from the bench task.
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE              All the benchmarks were run
+*                              OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*                              OS_ERR_PRIO_INVALID      If the priority of the calling task leaves no room for the
+*                                                       helper tasks (see OSBenchRun() Note #1)
+*                              OS_ERR_xxx               Any error code returned by the kernel services used
+*
+* Returns    : none
+*
+* Note(s)    : 1) The worst-case interrupt disable time of each run is reported in <int_dis> (see os_bench.h).  It
+*                 is the figure to watch for the paths that walk a list with interrupts disabled.
+*
+*              2) This function MUST be called from a task, the tick being initialized.
+************************************************************************************************************************
+*/
+
+void  OSBenchStressRun (OS_BENCH_OUT_FNCT   out_fnct,
+                        OS_ERR             *p_err)
+{
+    OS_OBJ_QTY  nbr;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    OS_BenchStart(out_fnct, p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+#if (OS_CFG_TICK_EN > 0u)
+    for (nbr = 1u; nbr != 0u; nbr = OS_BenchSweepNext(nbr, OS_BENCH_CFG_TASK_MAX)) {
+        OS_BenchStressTick(nbr, p_err);
+        if (*p_err != OS_ERR_NONE) {
+            return;
+        }
+    }
+#endif
+
+#if (OS_CFG_SEM_EN > 0u)
+    for (nbr = 1u; nbr != 0u; nbr = OS_BenchSweepNext(nbr, OS_BENCH_CFG_TASK_MAX)) {
+        OS_BenchStressPend(nbr, p_err);
+        if (*p_err != OS_ERR_NONE) {
+            return;
+        }
+    }
+#endif
+
+#if (OS_CFG_TMR_EN > 0u)
+    for (nbr = 1u; nbr != 0u; nbr = OS_BenchSweepNext(nbr, OS_BENCH_CFG_TMR_MAX)) {
+        OS_BenchStressTmr(nbr, p_err);
+        if (*p_err != OS_ERR_NONE) {
+            return;
+        }
+    }
+#endif
+
+#if (OS_CFG_FLAG_EN > 0u)
+    for (nbr = 1u; nbr != 0u; nbr = OS_BenchSweepNext(nbr, OS_BENCH_CFG_TASK_MAX)) {
+        OS_BenchFlag(nbr, p_err);
+        if (*p_err != OS_ERR_NONE) {
+            return;
+        }
+    }
+#endif
+
+#if (OS_CFG_STAT_TASK_EN > 0u) && (OS_CFG_TICK_EN > 0u)
+    for (nbr = 1u; nbr != 0u; nbr = OS_BenchSweepNext(nbr, OS_BENCH_CFG_TASK_MAX)) {
+        OS_BenchStressStat(nbr, p_err);
+        if (*p_err != OS_ERR_NONE) {
+            return;
+        }
+    }
+#endif
+
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                           POST FROM THE BENCHMARK INTERRUPT
+*
+* Description: This function must be called by the handler of the interrupt triggered by the 'int_fnct' function
+*              passed to OSBenchRun().  It readies the helper task that measures the ISR to task latency.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function MUST be called from a kernel aware ISR, between OSIntEnter() and OSIntExit().
+************************************************************************************************************************
+*/
+
+void  OSBenchIntHandler (void)
+{
+    OS_ERR  err;
+
+
+    (void)OSTaskSemPost(&OS_BenchTaskTCB[0], OS_OPT_POST_NONE, &err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                               START A BENCHMARK SUITE
+*
+* Description: This function checks that the benchmarks can be run from the calling task, creates the kernel objects
+*              the first time it is called and outputs the header line.
+*
+* Arguments  : out_fnct    is the function that receives the output lines.
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE
+*                              OS_ERR_OS_NOT_RUNNING
+*                              OS_ERR_PRIO_INVALID
+*                              OS_ERR_xxx               Any error code returned while creating the kernel objects
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+static  void  OS_BenchStart (OS_BENCH_OUT_FNCT   out_fnct,
+                             OS_ERR             *p_err)
+{
+    CPU_CHAR   line[OS_BENCH_LINE_SIZE];
+    CPU_CHAR  *p_char;
+    OS_PRIO    prio;
+
+
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+
+    prio = OSTCBCurPtr->Prio;                                   /* Make room for the helper tasks                       */
+    if ((prio < 1u) ||
+        (prio >= (OS_CFG_PRIO_MAX - 2u))) {
+       *p_err = OS_ERR_PRIO_INVALID;
+        return;
+    }
+
+    OS_BenchTCBPtr  = OSTCBCurPtr;
+    OS_BenchOutFnct = out_fnct;
+
+    OS_BenchObjCreate(p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+    do {                                                        /* Clear the task semaphore of the bench task           */
+        (void)OSTaskSemPend(0u, OS_OPT_PEND_NON_BLOCKING, (CPU_TS *)0, p_err);
+    } while (*p_err == OS_ERR_NONE);
+
+    p_char = OS_BenchFmtStr(line, (CPU_CHAR *)"bench,name,param,iter,min,avg,max,int_dis");
+   *p_char = (CPU_CHAR)'\0';
+    OS_BenchOutFnct(line);
+
+   *p_err  = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              CREATE THE KERNEL OBJECTS
+*
+* Description: This function creates the kernel objects used by the benchmarks the first time OSBenchRun() is called.
+*
+* Arguments  : p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+static  void  OS_BenchObjCreate (OS_ERR  *p_err)
+{
+#if (OS_CFG_TMR_EN > 0u)
+    OS_OBJ_QTY  ix;
+
+
+#endif
+   *p_err = OS_ERR_NONE;
+
+    if (OS_BenchObjCreated == OS_TRUE) {
+        return;
+    }
+
+#if (OS_CFG_SEM_EN > 0u)
+    OSSemCreate(&OS_BenchSem[0], (CPU_CHAR *)"Bench Sem 0", 0u, p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+    OSSemCreate(&OS_BenchSem[1], (CPU_CHAR *)"Bench Sem 1", 0u, p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+#endif
+
+#if (OS_CFG_MUTEX_EN > 0u)
+    OSMutexCreate(&OS_BenchMutex, (CPU_CHAR *)"Bench Mutex", p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+#endif
+
+#if (OS_CFG_FLAG_EN > 0u)
+    OSFlagCreate(&OS_BenchFlagGrp, (CPU_CHAR *)"Bench Flags", (OS_FLAGS)0, p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+#endif
+
+#if (OS_CFG_Q_EN > 0u)
+    OSQCreate(&OS_BenchQ, (CPU_CHAR *)"Bench Q", OS_BENCH_Q_SIZE, p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+#endif
+
+#if (OS_CFG_MEM_EN > 0u)
+    OSMemCreate(&OS_BenchMem,
+                (CPU_CHAR *)"Bench Mem",
+                &OS_BenchMemStorage[0][0],
+                OS_BENCH_MEM_NBR_BLKS,
+                sizeof(OS_BenchMemStorage[0]),
+                p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+#endif
+
+#if (OS_CFG_TMR_EN > 0u)
+    for (ix = 0u; ix <= OS_BENCH_CFG_TMR_MAX; ix++) {          /* Each timer expires after the previous ones           */
+        OSTmrCreate(&OS_BenchTmr[ix],
+                    (CPU_CHAR *)"Bench Tmr",
+                    OS_BENCH_TMO_TICKS + (OS_TICK)ix,
+                    0u,
+                    OS_OPT_TMR_ONE_SHOT,
+                    (OS_TMR_CALLBACK_PTR)0,
+                    (void *)0,
+                    p_err);
+        if (*p_err != OS_ERR_NONE) {
+            return;
+        }
+    }
+#endif
+
+    OS_BenchObjCreated = OS_TRUE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                    BENCHMARKS
+*
+* Description: Each of these functions runs one benchmark and reports its result.
+*
+*                  ts_get             Two back-to-back OS_TS_GET() calls.
+*
+*                  ctx_sw             OSTaskSemPost() to a higher priority task, until that task runs.
+*
+*                  isr_task           From the interrupt trigger until the task readied by the ISR runs.
+*
+*                  sem_pingpong       Round trip between two tasks through two semaphores (two context switches).
+*
+*                  q_post, q_pend     OSQPost() to and OSQPend() from a queue without waiters.
+*
+*                  mutex_free         OSMutexPend() and OSMutexPost() of a free mutex.
+*
+*                  mutex_contended    OSMutexPend() of a mutex held by a lower priority task, until it is obtained.
+*
+*                  flag_post          OSFlagPost() readying 'param' tasks, without scheduling.
+*
+*                  mem_get, mem_put   OSMemGet() and OSMemPut().
+*
+*                  tick               Tick list processing (OSTickTime) with 'param' tasks delayed, plus the bench
+*                                     task.
+*
+* Arguments  : int_fnct    is the function that triggers the benchmark interrupt ('isr_task' only).
+*
+*              nbr_tasks   is the number of helper tasks ('flag_post' and 'tick' only).
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+static  void  OS_BenchTsGet (void)
+{
+    CPU_TS      ts;
+    CPU_INT32U  i;
+
+
+    OS_BenchAccReset(&OS_BenchAcc);
+    for (i = 0u; i < OS_BENCH_CFG_ITER; i++) {
+        ts = OS_TS_GET();
+        OS_BenchAccAdd(&OS_BenchAcc, OS_TS_GET() - ts);
+    }
+    OS_BenchReport((CPU_CHAR *)"ts_get", 0u, &OS_BenchAcc);
+}
+
+
+
+static  void  OS_BenchCtxSw (OS_ERR  *p_err)
+{
+    CPU_INT32U  i;
+
+
+    OS_BenchTaskCreate(0u, OS_BenchSwTask, OS_BenchTCBPtr->Prio - 1u, p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+    OS_BenchAccReset(&OS_BenchAcc);
+    for (i = 0u; i < OS_BENCH_CFG_ITER; i++) {
+        OS_BenchTsStart = OS_TS_GET();
+        (void)OSTaskSemPost(&OS_BenchTaskTCB[0], OS_OPT_POST_NONE, p_err);
+        if (*p_err != OS_ERR_NONE) {
+            break;
+        }
+    }
+
+    OS_BenchTaskDel(1u);
+    if (*p_err == OS_ERR_NONE) {
+        OS_BenchReport((CPU_CHAR *)"ctx_sw", 0u, &OS_BenchAcc);
+    }
+}
+
+
+
+static  void  OS_BenchInt (OS_BENCH_INT_FNCT   int_fnct,
+                           OS_ERR             *p_err)
+{
+    CPU_INT32U  i;
+
+
+    OS_BenchTaskCreate(0u, OS_BenchSwTask, OS_BenchTCBPtr->Prio - 1u, p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+    OS_BenchAccReset(&OS_BenchAcc);
+    for (i = 0u; i < OS_BENCH_CFG_ITER; i++) {
+        OS_BenchTsStart = OS_TS_GET();
+        int_fnct();                                             /* The ISR readies OS_BenchSwTask()                     */
+    }
+
+    OS_BenchTaskDel(1u);
+    OS_BenchReport((CPU_CHAR *)"isr_task", 0u, &OS_BenchAcc);
+}
+
+
+#if (OS_CFG_SEM_EN > 0u)
+static  void  OS_BenchSemPingPong (OS_ERR  *p_err)
+{
+    CPU_TS      ts;
+    CPU_INT32U  i;
+
+
+    OS_BenchTaskCreate(0u, OS_BenchSemTask, OS_BenchTCBPtr->Prio - 1u, p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+    OS_BenchAccReset(&OS_BenchAcc);
+    for (i = 0u; i < OS_BENCH_CFG_ITER; i++) {
+        ts = OS_TS_GET();
+        (void)OSSemPost(&OS_BenchSem[0], OS_OPT_POST_1, p_err); /* The helper runs and posts back                       */
+        if (*p_err != OS_ERR_NONE) {
+            break;
+        }
+        (void)OSSemPend(&OS_BenchSem[1], 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, p_err);
+        if (*p_err != OS_ERR_NONE) {
+            break;
+        }
+        OS_BenchAccAdd(&OS_BenchAcc, OS_TS_GET() - ts);
+    }
+
+    OS_BenchTaskDel(1u);
+    if (*p_err == OS_ERR_NONE) {
+        OS_BenchReport((CPU_CHAR *)"sem_pingpong", 0u, &OS_BenchAcc);
+    }
+}
+#endif
+
+
+#if (OS_CFG_Q_EN > 0u)
+static  void  OS_BenchQPostPend (OS_ERR  *p_err)
+{
+    OS_BENCH_ACC  acc_pend;
+    OS_MSG_SIZE   msg_size;
+    CPU_TS        ts;
+    CPU_INT32U    i;
+    CPU_INT32U    j;
+
+
+    OS_BenchAccReset(&OS_BenchAcc);
+    OS_BenchAccReset(&acc_pend);
+    for (i = 0u; i < OS_BENCH_CFG_ITER; i += OS_BENCH_Q_SIZE) {
+        for (j = 0u; j < OS_BENCH_Q_SIZE; j++) {                /* Fill the queue ...                                   */
+            ts = OS_TS_GET();
+            OSQPost(&OS_BenchQ, (void *)&OS_BenchQ, sizeof(OS_BenchQ), OS_OPT_POST_FIFO, p_err);
+            OS_BenchAccAdd(&OS_BenchAcc, OS_TS_GET() - ts);
+            if (*p_err != OS_ERR_NONE) {
+                return;
+            }
+        }
+        for (j = 0u; j < OS_BENCH_Q_SIZE; j++) {                /* ... then empty it                                    */
+            ts = OS_TS_GET();
+            (void)OSQPend(&OS_BenchQ, 0u, OS_OPT_PEND_NON_BLOCKING, &msg_size, (CPU_TS *)0, p_err);
+            OS_BenchAccAdd(&acc_pend, OS_TS_GET() - ts);
+            if (*p_err != OS_ERR_NONE) {
+                return;
+            }
+        }
+    }
+
+    OS_BenchReport((CPU_CHAR *)"q_post", 0u, &OS_BenchAcc);
+    OS_BenchReport((CPU_CHAR *)"q_pend", 0u, &acc_pend);
+}
+#endif
+
+
+#if (OS_CFG_MUTEX_EN > 0u)
+static  void  OS_BenchMutexPend (OS_ERR  *p_err)
+{
+    CPU_TS      ts;
+    CPU_INT32U  i;
+
+
+    OS_BenchAccReset(&OS_BenchAcc);                             /* ------------------ FREE MUTEX ---------------------- */
+    for (i = 0u; i < OS_BENCH_CFG_ITER; i++) {
+        ts = OS_TS_GET();
+        OSMutexPend(&OS_BenchMutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, p_err);
+        if (*p_err != OS_ERR_NONE) {
+            return;
+        }
+        OSMutexPost(&OS_BenchMutex, OS_OPT_POST_NONE, p_err);
+        OS_BenchAccAdd(&OS_BenchAcc, OS_TS_GET() - ts);
+        if (*p_err != OS_ERR_NONE) {
+            return;
+        }
+    }
+    OS_BenchReport((CPU_CHAR *)"mutex_free", 0u, &OS_BenchAcc);
+
+                                                                /* ---------------- CONTENDED MUTEX ------------------- */
+    OS_BenchTaskCreate(0u, OS_BenchMutexTask, OS_BenchTCBPtr->Prio + 1u, p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+    OS_BenchAccReset(&OS_BenchAcc);
+    for (i = 0u; i < OS_BENCH_CFG_ITER; i++) {
+        (void)OSTaskSemPost(&OS_BenchTaskTCB[0], OS_OPT_POST_NONE, p_err);
+        if (*p_err != OS_ERR_NONE) {
+            break;
+        }
+        (void)OSTaskSemPend(0u,                                 /* Wait for the helper to own the mutex                 */
+                            OS_OPT_PEND_BLOCKING,
+                            (CPU_TS *)0,
+                            p_err);
+        if (*p_err != OS_ERR_NONE) {
+            break;
+        }
+        ts = OS_TS_GET();
+        OSMutexPend(&OS_BenchMutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, p_err);
+        OS_BenchAccAdd(&OS_BenchAcc, OS_TS_GET() - ts);
+        if (*p_err != OS_ERR_NONE) {
+            break;
+        }
+        OSMutexPost(&OS_BenchMutex, OS_OPT_POST_NONE, p_err);
+        if (*p_err != OS_ERR_NONE) {
+            break;
+        }
+    }
+
+    OS_BenchTaskDel(1u);
+    if (*p_err == OS_ERR_NONE) {
+        OS_BenchReport((CPU_CHAR *)"mutex_contended", 0u, &OS_BenchAcc);
+    }
+}
+#endif
+
+
+#if (OS_CFG_FLAG_EN > 0u)
+static  void  OS_BenchFlag (OS_OBJ_QTY   nbr_tasks,
+                            OS_ERR      *p_err)
+{
+    CPU_TS      ts;
+    CPU_INT32U  i;
+
+
+    OS_BenchTasksCreate(nbr_tasks,                              /* The waiters run and pend right away                  */
+                        OS_BenchFlagTask,
+                        OS_BenchTCBPtr->Prio - 1u,
+                        p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+    OS_BenchAccReset(&OS_BenchAcc);
+    for (i = 0u; i < OS_BENCH_CFG_ITER; i++) {
+        ts = OS_TS_GET();
+        (void)OSFlagPost(&OS_BenchFlagGrp,
+                         OS_BENCH_FLAG,
+                         (OS_OPT)(OS_OPT_POST_FLAG_SET | OS_OPT_POST_NO_SCHED),
+                         p_err);
+        OS_BenchAccAdd(&OS_BenchAcc, OS_TS_GET() - ts);
+        if (*p_err != OS_ERR_NONE) {
+            break;
+        }
+        (void)OSFlagPost(&OS_BenchFlagGrp,                      /* Let the waiters run and pend again                   */
+                         OS_BENCH_FLAG,
+                         (OS_OPT)(OS_OPT_POST_FLAG_CLR | OS_OPT_POST_NO_SCHED),
+                         p_err);
+        if (*p_err != OS_ERR_NONE) {
+            break;
+        }
+        OSSched();
+    }
+
+    OS_BenchTaskDel(nbr_tasks);
+    if (*p_err == OS_ERR_NONE) {
+        OS_BenchReport((CPU_CHAR *)"flag_post", nbr_tasks, &OS_BenchAcc);
+    }
+}
+#endif
+
+
+#if (OS_CFG_MEM_EN > 0u)
+static  void  OS_BenchMemGetPut (OS_ERR  *p_err)
+{
+    OS_BENCH_ACC   acc_put;
+    void          *p_blk;
+    CPU_TS         ts;
+    CPU_INT32U     i;
+
+
+    OS_BenchAccReset(&OS_BenchAcc);
+    OS_BenchAccReset(&acc_put);
+    for (i = 0u; i < OS_BENCH_CFG_ITER; i++) {
+        ts    = OS_TS_GET();
+        p_blk = OSMemGet(&OS_BenchMem, p_err);
+        OS_BenchAccAdd(&OS_BenchAcc, OS_TS_GET() - ts);
+        if (*p_err != OS_ERR_NONE) {
+            return;
+        }
+        ts    = OS_TS_GET();
+        OSMemPut(&OS_BenchMem, p_blk, p_err);
+        OS_BenchAccAdd(&acc_put, OS_TS_GET() - ts);
+        if (*p_err != OS_ERR_NONE) {
+            return;
+        }
+    }
+
+    OS_BenchReport((CPU_CHAR *)"mem_get", 0u, &OS_BenchAcc);
+    OS_BenchReport((CPU_CHAR *)"mem_put", 0u, &acc_put);
+}
+#endif
+
+
+#if (OS_CFG_TICK_EN > 0u)
+static  void  OS_BenchTick (OS_OBJ_QTY   nbr_tasks,
+                            OS_ERR      *p_err)
+{
+    CPU_INT32U  i;
+
+
+    OS_BenchTasksCreate(nbr_tasks, OS_BenchDlyTask, OS_BenchTCBPtr->Prio + 1u, p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+    OSTimeDly(1u, OS_OPT_TIME_DLY, p_err);                      /* Let the helpers delay themselves                     */
+
+    OS_BenchAccReset(&OS_BenchAcc);
+    for (i = 0u; (i < OS_BENCH_CFG_TICK_ITER) && (*p_err == OS_ERR_NONE); i++) {
+        OSTimeDly(1u, OS_OPT_TIME_DLY, p_err);
+        OS_BenchAccAdd(&OS_BenchAcc, OSTickTime);               /* Time of the tick that readied the bench task         */
+    }
+
+    OS_BenchTaskDel(nbr_tasks);
+    if (*p_err == OS_ERR_NONE) {
+        OS_BenchReport((CPU_CHAR *)"tick", nbr_tasks, &OS_BenchAcc);
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                 STRESS BENCHMARKS
+*
+* Description: Each of these functions runs one of the benchmarks of OSBenchStressRun() for a given number of objects.
+*
+* Arguments  : nbr_tasks   is the number of helper tasks.
+*
+*              nbr_tmrs    is the number of running timers, the probe timer excluded.
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+* Returns    : none
+*
+* Note(s)    : 1) The helper tasks of 'tick_insert' and 'sem_pend_prio' all pend at the same priority, so the task that
+*                 pends again is placed behind all the others.  This is the worst case of a list sorted by expiry or by
+*                 priority.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TICK_EN > 0u)
+static  void  OS_BenchStressTick (OS_OBJ_QTY   nbr_tasks,
+                                  OS_ERR      *p_err)
+{
+    CPU_TS      ts;
+    CPU_INT32U  i;
+
+
+    OS_BenchTasksCreate(nbr_tasks, OS_BenchTmoTask, OS_BenchTCBPtr->Prio - 1u, p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+    OS_BenchAccReset(&OS_BenchAcc);
+    for (i = 0u; i < OS_BENCH_CFG_ITER; i++) {
+        ts = OS_TS_GET();
+        (void)OSTaskSemPost(&OS_BenchTaskTCB[0],                /* The oldest timeout is now last (See Note #1)         */
+                            OS_OPT_POST_NONE,
+                            p_err);
+        OS_BenchAccAdd(&OS_BenchAcc, OS_TS_GET() - ts);
+        if (*p_err != OS_ERR_NONE) {
+            break;
+        }
+    }
+
+    OS_BenchTaskDel(nbr_tasks);
+    if (*p_err == OS_ERR_NONE) {
+        OS_BenchReport((CPU_CHAR *)"tick_insert", nbr_tasks, &OS_BenchAcc);
+    }
+}
+#endif
+
+
+#if (OS_CFG_SEM_EN > 0u)
+static  void  OS_BenchStressPend (OS_OBJ_QTY   nbr_tasks,
+                                  OS_ERR      *p_err)
+{
+    CPU_TS      ts;
+    CPU_INT32U  i;
+
+
+    OS_BenchTasksCreate(nbr_tasks, OS_BenchSemWaitTask, OS_BenchTCBPtr->Prio - 1u, p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+    OS_BenchAccReset(&OS_BenchAcc);
+    for (i = 0u; i < OS_BENCH_CFG_ITER; i++) {
+        ts = OS_TS_GET();
+        (void)OSSemPost(&OS_BenchSem[0], OS_OPT_POST_1, p_err); /* The first waiter pends again last (See Note #1)     */
+        OS_BenchAccAdd(&OS_BenchAcc, OS_TS_GET() - ts);
+        if (*p_err != OS_ERR_NONE) {
+            break;
+        }
+    }
+
+    OS_BenchTaskDel(nbr_tasks);
+    if (*p_err == OS_ERR_NONE) {
+        OS_BenchReport((CPU_CHAR *)"sem_pend_prio", nbr_tasks, &OS_BenchAcc);
+    }
+}
+#endif
+
+
+#if (OS_CFG_TMR_EN > 0u)
+static  void  OS_BenchStressTmr (OS_OBJ_QTY   nbr_tmrs,
+                                 OS_ERR      *p_err)
+{
+    OS_TMR      *p_probe;
+    OS_OBJ_QTY   ix;
+    CPU_TS       ts;
+    CPU_INT32U   i;
+    OS_ERR       err;
+
+
+    for (ix = 0u; ix < nbr_tmrs; ix++) {
+        (void)OSTmrStart(&OS_BenchTmr[ix], p_err);
+        if (*p_err != OS_ERR_NONE) {
+            break;
+        }
+    }
+
+    p_probe = &OS_BenchTmr[OS_BENCH_CFG_TMR_MAX];               /* Expires after all the running timers                 */
+    OS_BenchAccReset(&OS_BenchAcc);
+    for (i = 0u; (i < OS_BENCH_CFG_ITER) && (*p_err == OS_ERR_NONE); i++) {
+        ts = OS_TS_GET();
+        (void)OSTmrStart(p_probe, p_err);
+        OS_BenchAccAdd(&OS_BenchAcc, OS_TS_GET() - ts);
+        if (*p_err == OS_ERR_NONE) {
+            (void)OSTmrStop(p_probe, OS_OPT_TMR_NONE, (void *)0, p_err);
+        }
+    }
+
+    while (ix > 0u) {
+        ix--;
+        (void)OSTmrStop(&OS_BenchTmr[ix], OS_OPT_TMR_NONE, (void *)0, &err);
+    }
+
+    if (*p_err == OS_ERR_NONE) {
+        OS_BenchReport((CPU_CHAR *)"tmr_start", nbr_tmrs, &OS_BenchAcc);
+    }
+}
+#endif
+
+
+#if (OS_CFG_STAT_TASK_EN > 0u) && (OS_CFG_TICK_EN > 0u)
+static  void  OS_BenchStressStat (OS_OBJ_QTY   nbr_tasks,
+                                  OS_ERR      *p_err)
+{
+    OS_TICK     dly;
+    CPU_INT32U  i;
+
+
+    OS_BenchTasksCreate(nbr_tasks, OS_BenchDlyTask, OS_BenchTCBPtr->Prio + 1u, p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+    dly = (OS_TICK)(OSCfg_TickRate_Hz / OSCfg_StatTaskRate_Hz); /* One run of the statistic task                        */
+    if (dly == 0u) {
+        dly = 1u;
+    }
+
+    OSTimeDly(dly, OS_OPT_TIME_DLY, p_err);                     /* Skip the run that started without the helpers        */
+
+    OS_BenchAccReset(&OS_BenchAcc);
+    for (i = 0u; (i < OS_BENCH_CFG_STAT_ITER) && (*p_err == OS_ERR_NONE); i++) {
+        OSTimeDly(dly, OS_OPT_TIME_DLY, p_err);
+        OS_BenchAccAdd(&OS_BenchAcc, OSStatTaskTime);
+    }
+
+    OS_BenchTaskDel(nbr_tasks);
+    if (*p_err == OS_ERR_NONE) {
+        OS_BenchReport((CPU_CHAR *)"stat_task", nbr_tasks, &OS_BenchAcc);
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                    HELPER TASKS
+*
+* Description: These tasks are created by the benchmarks that need more than the bench task.
+*
+*                  OS_BenchSwTask()      Records the time elapsed since OS_BenchTsStart each time it is signaled.
+*
+*                  OS_BenchTmoTask()     Waits for its task semaphore with a timeout, over and over.
+*
+*                  OS_BenchSemTask()     Posts OS_BenchSem[1] each time OS_BenchSem[0] is posted.
+*
+*                  OS_BenchSemWaitTask() Waits for OS_BenchSem[0], over and over.
+*
+*                  OS_BenchMutexTask()   Takes the mutex each time it is signaled and gives it back once the bench task
+*                                        waits for it.
+*
+*                  OS_BenchFlagTask()    Waits for OS_BENCH_FLAG to be set, over and over.
+*
+*                  OS_BenchDlyTask()     Stays delayed for longer than the 'tick' benchmark.
+*
+* Arguments  : p_arg       is the index of the task ('OS_BenchDlyTask()' only).
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+static  void  OS_BenchSwTask (void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        OS_BenchAccAdd(&OS_BenchAcc, OS_TS_GET() - OS_BenchTsStart);
+    }
+}
+
+
+#if (OS_CFG_TICK_EN > 0u)
+static  void  OS_BenchTmoTask (void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSTaskSemPend(OS_BENCH_TMO_TICKS, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+    }
+}
+#endif
+
+
+#if (OS_CFG_SEM_EN > 0u)
+static  void  OS_BenchSemTask (void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSSemPend(&OS_BenchSem[0], 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        (void)OSSemPost(&OS_BenchSem[1], OS_OPT_POST_1, &err);
+    }
+}
+
+
+
+static  void  OS_BenchSemWaitTask (void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSSemPend(&OS_BenchSem[0], 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+    }
+}
+#endif
+
+
+#if (OS_CFG_MUTEX_EN > 0u)
+static  void  OS_BenchMutexTask (void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        OSMutexPend(&OS_BenchMutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        (void)OSTaskSemPost(OS_BenchTCBPtr, OS_OPT_POST_NONE, &err);  /* Runs again once the bench task waits ...      */
+        OSMutexPost(&OS_BenchMutex, OS_OPT_POST_NONE, &err);          /* ... and hands the mutex over                  */
+    }
+}
+#endif
+
+
+#if (OS_CFG_FLAG_EN > 0u)
+static  void  OS_BenchFlagTask (void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSFlagPend(&OS_BenchFlagGrp,
+                         OS_BENCH_FLAG,
+                         0u,
+                         (OS_OPT)(OS_OPT_PEND_FLAG_SET_ALL | OS_OPT_PEND_BLOCKING),
+                         (CPU_TS *)0,
+                         &err);                                 /* The flag is cleared again before this task runs      */
+    }
+}
+#endif
+
+
+#if (OS_CFG_TICK_EN > 0u)
+static  void  OS_BenchDlyTask (void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    for (;;) {
+        OSTimeDly(OS_BENCH_DLY_TICKS + (OS_TICK)(CPU_ADDR)p_arg, OS_OPT_TIME_DLY, &err);
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                          CREATE AND DELETE THE HELPER TASKS
+*
+* Description: OS_BenchTaskCreate() creates the helper task 'ix'.  OS_BenchTasksCreate() creates the first
+*              'nbr_tasks' helper tasks and OS_BenchTaskDel() deletes them.
+*
+* Arguments  : ix          is the index of the helper task in OS_BenchTaskTCB[]
+*
+*              p_task      is the code of the task
+*
+*              prio        is the priority of the task
+*
+*              nbr_tasks   is the number of helper tasks
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+* Returns    : none
+*
+* Note(s)    : 1) OS_BenchTasksCreate() deletes the tasks it created if one of them can't be created.
+************************************************************************************************************************
+*/
+
+static  void  OS_BenchTaskCreate (OS_OBJ_QTY    ix,
+                                  OS_TASK_PTR   p_task,
+                                  OS_PRIO       prio,
+                                  OS_ERR       *p_err)
+{
+    OSTaskCreate(&OS_BenchTaskTCB[ix],
+                 (CPU_CHAR *)"Bench Helper",
+                  p_task,
+                 (void     *)(CPU_ADDR)ix,
+                  prio,
+                 &OS_BenchTaskStk[ix][0],
+                  OS_BENCH_CFG_STK_SIZE / 10u,
+                  OS_BENCH_CFG_STK_SIZE,
+                  0u,
+                  0u,
+                 (void     *)0,
+                 (OS_OPT)(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                  p_err);
+}
+
+
+
+static  void  OS_BenchTasksCreate (OS_OBJ_QTY    nbr_tasks,
+                                   OS_TASK_PTR   p_task,
+                                   OS_PRIO       prio,
+                                   OS_ERR       *p_err)
+{
+    OS_OBJ_QTY  ix;
+
+
+    for (ix = 0u; ix < nbr_tasks; ix++) {
+        OS_BenchTaskCreate(ix, p_task, prio, p_err);
+        if (*p_err != OS_ERR_NONE) {
+            OS_BenchTaskDel(ix);                                /* See Note #1                                          */
+            return;
+        }
+    }
+}
+
+
+
+static  void  OS_BenchTaskDel (OS_OBJ_QTY  nbr_tasks)
+{
+    OS_OBJ_QTY  ix;
+    OS_ERR      err;
+
+
+    for (ix = 0u; ix < nbr_tasks; ix++) {
+        OSTaskDel(&OS_BenchTaskTCB[ix], &err);
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                              NEXT STEP OF A STRESS SWEEP
+*
+* Description: This function returns the number of objects for the next run of a stress benchmark: the double of the
+*              current one, capped at the maximum.
+*
+* Arguments  : nbr         is the number of objects of the current run
+*
+*              nbr_max     is the number of objects of the last run
+*
+* Returns    : The number of objects of the next run, 0 if the current run was the last one.
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+static  OS_OBJ_QTY  OS_BenchSweepNext (OS_OBJ_QTY  nbr,
+                                       OS_OBJ_QTY  nbr_max)
+{
+    if (nbr >= nbr_max) {
+        return (0u);
+    }
+
+    nbr *= 2u;
+    if (nbr > nbr_max) {
+        nbr = nbr_max;
+    }
+
+    return (nbr);
+}
+
+
+/*
+************************************************************************************************************************
+*                                               ACCUMULATE THE SAMPLES
+*
+* Description: OS_BenchAccReset() clears the statistics, and the interrupt disable time measured by uC/CPU.
+*              OS_BenchAccAdd() adds one sample to the statistics.
+*
+* Arguments  : p_acc       is a pointer to the statistics
+*
+*              ts          is the sample, in OS_TS_GET() units
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+static  void  OS_BenchAccReset (OS_BENCH_ACC  *p_acc)
+{
+    p_acc->Min = (CPU_TS)-1;
+    p_acc->Max =  0u;
+    p_acc->Sum =  0u;
+    p_acc->Ctr =  0u;
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN
+    (void)CPU_IntDisMeasMaxCurReset();
+#endif
+}
+
+
+
+static  void  OS_BenchAccAdd (OS_BENCH_ACC  *p_acc,
+                              CPU_TS         ts)
+{
+    if (p_acc->Min > ts) {
+        p_acc->Min = ts;
+    }
+    if (p_acc->Max < ts) {
+        p_acc->Max = ts;
+    }
+    p_acc->Sum += ts;
+    p_acc->Ctr++;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 REPORT A BENCHMARK
+*
+* Description: This function formats the result of a benchmark and passes it to the output function.
+*
+* Arguments  : p_name      is the name of the benchmark
+*
+*              param       is the number of tasks involved, 0 if not applicable
+*
+*              p_acc       is a pointer to the statistics of the benchmark
+*
+* Returns    : none
+*
+* Note(s)    : 1) The line is formatted without the C library, which might not be available on the target.
+*
+*              2) The interrupt disable time is the longest one since the statistics were reset.  It is 0 unless
+*                 uC/CPU measures it (CPU_CFG_INT_DIS_MEAS_EN).
+************************************************************************************************************************
+*/
+
+static  void  OS_BenchReport (CPU_CHAR      *p_name,
+                              OS_OBJ_QTY     param,
+                              OS_BENCH_ACC  *p_acc)
+{
+    CPU_CHAR    line[OS_BENCH_LINE_SIZE];
+    CPU_CHAR   *p_char;
+    CPU_INT64U  avg;
+    CPU_TS_TMR  int_dis;
+
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN
+    int_dis = CPU_IntDisMeasMaxCurGet();                        /* See Note #2                                          */
+#else
+    int_dis = 0u;
+#endif
+
+    if (p_acc->Ctr == 0u) {                                     /* No sample: report zeros                              */
+        p_acc->Min = 0u;
+        avg        = 0u;
+    } else {
+        avg        = p_acc->Sum / p_acc->Ctr;
+    }
+
+    p_char  = OS_BenchFmtStr(line,   (CPU_CHAR *)"bench,");
+    p_char  = OS_BenchFmtStr(p_char, p_name);
+   *p_char++ = (CPU_CHAR)',';
+    p_char  = OS_BenchFmtNbr(p_char, param);
+   *p_char++ = (CPU_CHAR)',';
+    p_char  = OS_BenchFmtNbr(p_char, p_acc->Ctr);
+   *p_char++ = (CPU_CHAR)',';
+    p_char  = OS_BenchFmtNbr(p_char, p_acc->Min);
+   *p_char++ = (CPU_CHAR)',';
+    p_char  = OS_BenchFmtNbr(p_char, avg);
+   *p_char++ = (CPU_CHAR)',';
+    p_char  = OS_BenchFmtNbr(p_char, p_acc->Max);
+   *p_char++ = (CPU_CHAR)',';
+    p_char  = OS_BenchFmtNbr(p_char, int_dis);
+   *p_char   = (CPU_CHAR)'\0';
+
+    OS_BenchOutFnct(line);
+}
+
+
+
+static  CPU_CHAR  *OS_BenchFmtStr (CPU_CHAR  *p_dest,
+                                   CPU_CHAR  *p_str)
+{
+    while (*p_str != (CPU_CHAR)'\0') {
+       *p_dest++ = *p_str++;
+    }
+
+    return (p_dest);
+}
+
+
+
+static  CPU_CHAR  *OS_BenchFmtNbr (CPU_CHAR    *p_dest,
+                                   CPU_INT64U   nbr)
+{
+    CPU_CHAR    digits[20];
+    CPU_INT08U  nbr_digits;
+
+
+    nbr_digits = 0u;
+    do {                                                        /* Least significant digit first                        */
+        digits[nbr_digits++] = (CPU_CHAR)('0' + (nbr % 10u));
+        nbr                 /= 10u;
+    } while (nbr > 0u);
+
+    while (nbr_digits > 0u) {
+       *p_dest++ = digits[--nbr_digits];
+    }
+
+    return (p_dest);
+}
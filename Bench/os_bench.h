@@ -0,0 +1,141 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        KERNEL MICRO-BENCHMARKS
+*
+* File    : os_bench.h
+* Version : V3.08.00
+*********************************************************************************************************
+* Note(s) : (1) This module measures the cost of the main kernel paths with OS_TS_GET().  To use it,
+*               add this folder to the include path, add os_bench.c to the build and call OSBenchRun()
+*               from a task once the tick is running.  It runs on any port that provides OS_TS_GET(),
+*               the simulator ports included.
+*
+*           (2) Every benchmark produces one line of comma separated values, passed to the output
+*               function given to OSBenchRun() or OSBenchStressRun():
+*
+*                   bench,<name>,<param>,<iter>,<min>,<avg>,<max>,<int_dis>
+*
+*               where <param> is the number of tasks or timers involved (0 if not applicable), <min>,
+*               <avg> and <max> are in OS_TS_GET() units and <int_dis> is the longest interrupt
+*               disable time seen during the benchmark, 0 if uC/CPU doesn't measure it
+*               (CPU_CFG_INT_DIS_MEAS_EN).  The first line is the header:
+*
+*                   bench,name,param,iter,min,avg,max,int_dis
+*
+*               The 'ts_get' line gives the cost of two back-to-back OS_TS_GET() calls, which is
+*               included in every other measurement.
+*
+*           (3) The module can be configured by defining the following in os_cfg.h:
+*
+*                   OS_BENCH_CFG_ITER       Number of samples per benchmark.
+*
+*                   OS_BENCH_CFG_TICK_ITER  Number of ticks sampled by the 'tick' benchmark.
+*
+*                   OS_BENCH_CFG_TASK_MAX   Number of helper tasks.  The 'flag_post' and 'tick'
+*                                           benchmarks are run with 1 and with this number of tasks.
+*                                           It is also the end of the task sweeps of
+*                                           OSBenchStressRun().
+*
+*                   OS_BENCH_CFG_TMR_MAX    End of the timer sweep of OSBenchStressRun().
+*
+*                   OS_BENCH_CFG_STAT_ITER  Number of runs of the statistic task sampled by the
+*                                           'stat_task' stress benchmark.
+*
+*                   OS_BENCH_CFG_STK_SIZE   Stack size of the helper tasks, in CPU_STK elements.
+*
+*           (4) OSBenchStressRun() runs the benchmarks whose cost depends on the length of a kernel
+*               list (tick list, pend list, timer list, task list) for an increasing number of
+*               tasks or timers.  Set OS_BENCH_CFG_TASK_MAX and OS_BENCH_CFG_TMR_MAX to the sizes of
+*               your application to see how far the worst case goes.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_BENCH_H
+#define  OS_BENCH_H
+
+
+#include  <os.h>
+
+
+/*
+*********************************************************************************************************
+*                                            CONFIGURATION
+*********************************************************************************************************
+*/
+
+#ifndef  OS_BENCH_CFG_ITER
+#define  OS_BENCH_CFG_ITER                                      1000u
+#endif
+
+#ifndef  OS_BENCH_CFG_TICK_ITER
+#define  OS_BENCH_CFG_TICK_ITER                                  100u
+#endif
+
+#ifndef  OS_BENCH_CFG_TASK_MAX
+#define  OS_BENCH_CFG_TASK_MAX                                     8u
+#endif
+
+#ifndef  OS_BENCH_CFG_TMR_MAX
+#define  OS_BENCH_CFG_TMR_MAX                                     64u
+#endif
+
+#ifndef  OS_BENCH_CFG_STAT_ITER
+#define  OS_BENCH_CFG_STAT_ITER                                   10u
+#endif
+
+#ifndef  OS_BENCH_CFG_STK_SIZE
+#define  OS_BENCH_CFG_STK_SIZE                                   256u
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                              DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  void  (*OS_BENCH_OUT_FNCT)(CPU_CHAR  *p_line);         /* Receives one NUL-terminated line, without new line   */
+
+typedef  void  (*OS_BENCH_INT_FNCT)(void);                      /* Triggers the interrupt calling OSBenchIntHandler()   */
+
+
+/*
+*********************************************************************************************************
+*                                          FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+#ifdef __cplusplus
+extern  "C" {
+#endif
+
+void  OSBenchRun          (OS_BENCH_OUT_FNCT   out_fnct,
+                           OS_BENCH_INT_FNCT   int_fnct,
+                           OS_ERR             *p_err);
+
+void  OSBenchStressRun    (OS_BENCH_OUT_FNCT   out_fnct,
+                           OS_ERR             *p_err);
+
+void  OSBenchIntHandler   (void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
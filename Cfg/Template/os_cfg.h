@@ -31,18 +31,43 @@
 #define OS_CFG_APP_HOOKS_EN                        1u           /* Enable (1) or Disable (0) application specific hooks                  */
 #define OS_CFG_ARG_CHK_EN                          1u           /* Enable (1) or Disable (0) argument checking                           */
 #define OS_CFG_CALLED_FROM_ISR_CHK_EN              1u           /* Enable (1) or Disable (0) check for called from ISR                   */
+#define OS_CFG_INT_KA_CHK_EN                       0u           /* Trap OSIntEnter() calls from zero-latency (non kernel aware) ISRs     */
+#define OS_CFG_ISR_STK_SP_EN                       0u           /* Record the deepest ISR stack pointer in OSIntEnter() (OS_CPU_SP_GET)  */
 #define OS_CFG_DBG_EN                              0u           /* Enable (1) or Disable (0) debug code/variables                        */
+#define OS_CFG_DBG_PEND_NAME_EN                    1u           /*     Update the pend names on each pend/post (0: derived on request)   */
 #define OS_CFG_TICK_EN                             1u           /* Enable (1) or Disable (0) the kernel tick                             */
 #define OS_CFG_DYN_TICK_EN                         0u           /* Enable (1) or Disable (0) the Dynamic Tick                            */
+#define OS_CFG_TICK_WHEEL_EN                       0u           /* Use a tick wheel (1) or a delta list (0) for delayed tasks            */
+#define OS_CFG_TICK_TASK_EN                        0u           /* Process expired delays in a task (1) or in the tick ISR (0)           */
+#define OS_CFG_SLACK_EN                            0u           /* Enable (1) or Disable (0) wake-up coalescing of delays and timers     */
 #define OS_CFG_INVALID_OS_CALLS_CHK_EN             1u           /* Enable (1) or Disable (0) checks for invalid kernel calls             */
 #define OS_CFG_OBJ_TYPE_CHK_EN                     1u           /* Enable (1) or Disable (0) object type checking                        */
 #define OS_CFG_OBJ_CREATED_CHK_EN                  1u           /* Enable (1) or Disable (0) object created checks                       */
 #define OS_CFG_TS_EN                               0u           /* Enable (1) or Disable (0) time stamping                               */
 
 #define OS_CFG_PRIO_MAX                           64u           /* Defines the maximum number of task priorities (see OS_PRIO data type) */
+#define OS_CFG_PRIO_TBL_2LVL_EN                    0u           /* Two-level priority bitmap when OS_CFG_PRIO_MAX > 2x the word size     */
+#define OS_CFG_PRIO_MAP_EN                         0u           /* Size ready list to the priorities in OS_CFG_PRIO_MAP_TBL (app cfg)    */
+#define OS_CFG_PEND_LIST_BITMAP_EN                 0u           /* O(1) pend list insert (adds OS_CFG_PRIO_MAX ptrs to each kernel obj)  */
+#define OS_CFG_OBJ_STAT_EN                         0u           /* Per-object post/pend/timeout counters (needs OS_CFG_DBG_EN)           */
+#define OS_CFG_OBJ_REG_EN                          0u           /* Hash registry to find objects by name or ID (needs OS_CFG_DBG_EN)     */
+#define OS_CFG_OBJ_REG_SIZE                       64u           /*     Registry slots, power of 2, about twice the number of objects     */
+#define OS_CFG_SMALL_MEM_EN                        0u           /* 16-bit ticks, singly linked pend lists (for 8..16 KB RAM parts)       */
+#define OS_CFG_POST_ALL_INT_EN                     0u           /* Re-enable interrupts between the tasks readied by OS_OPT_POST_ALL     */
+#define OS_CFG_ISR_POST_DEFERRED_EN                0u           /* Defer ISR posts to the ISR handler task (see OS_CFG_INT_Q_xxx)        */
+#define OS_CFG_POST_FROM_ISR_EN                    0u           /* Include the xxxPostFromISR() services (no scheduling, fewer checks)   */
+#define OS_CFG_ATOMIC_EN                           1u           /* Include OSAtomicxxx(): load/store, CAS, fetch-add/or and exchange     */
 
 #define OS_CFG_SCHED_LOCK_TIME_MEAS_EN             0u           /* Include code to measure scheduler lock time                           */
+#define OS_CFG_LOCK_SITE_EN                        0u           /* Record critical section and scheduler lock times per call site        */
+#define OS_CFG_LOCK_SITE_TBL_SIZE                  8u           /*     Number of OSSchedLock() callers tracked (OSSchedLockSiteTbl[])    */
+#define OS_CFG_CRIT_SECTION_PROFILE_EN             0u           /* Time every kernel critical section, per module (OSCritSiteTbl[])      */
+#define OS_CFG_PROF_SAMPLE_EN                      0u           /* Sample the code and task interrupted by each tick (OSProfSamplexxx()) */
+#define OS_CFG_PROF_SAMPLE_SIZE                   64u           /*     Number of samples in the ring (OSProfSampleTbl[])                 */
 #define OS_CFG_SCHED_ROUND_ROBIN_EN                1u           /* Include code for Round-Robin scheduling                               */
+#define OS_CFG_SCHED_ROUND_ROBIN_TS_EN             0u           /*     Measure time slices with OS_TS_GET() (needs OS_CFG_TIME_HR_EN)    */
+#define OS_CFG_SCHED_WINDOW_EN                     0u           /* Time-partitioned scheduling windows (OSSchedWindowxxx())              */
+#define OS_CFG_SCHED_WINDOW_CRIT_PRIO              0u           /*     Priorities below this value run in every window                   */
 
 #define OS_CFG_STK_SIZE_MIN                       64u           /* Minimum allowable task stack size                                     */
 
@@ -52,16 +77,39 @@
 #define OS_CFG_FLAG_DEL_EN                         1u           /*     Include code for OSFlagDel()                                      */
 #define OS_CFG_FLAG_MODE_CLR_EN                    1u           /*     Include code for Wait on Clear EVENT FLAGS                        */
 #define OS_CFG_FLAG_PEND_ABORT_EN                  1u           /*     Include code for OSFlagPendAbort()                                */
+#define OS_CFG_FLAG_WAIT_IDX_EN                    0u           /*     Index waiters by flag so OSFlagPost() skips unrelated waiters     */
+#define OS_CFG_FLAG_WIDTH                         32u           /*     Number of flags in a group: 8, 16, 32 or 64                       */
 
 
                                                                 /* ------------------------ MEMORY MANAGEMENT -------------------------  */
 #define OS_CFG_MEM_EN                              1u           /* Enable (1) or Disable (0) code generation for the MEMORY MANAGER      */
+#define OS_CFG_MEM_BUF_EN                          1u           /*     Include code for reference-counted buffers (OSMemBufxxx())        */
+#define OS_CFG_MEM_CACHE_EN                        1u           /*     Include code for cache aligned partitions (OSMemCreateAligned())  */
+#define OS_CFG_MEM_LOCK_FREE_EN                    0u           /*     Use lock-free OSMemGet()/OSMemPut() if the port supports it       */
+#define OS_CFG_MEM_MAG_EN                          1u           /*     Include code for per-task magazines (OSMemMagxxx())               */
+#define OS_CFG_MEM_PEND_EN                         1u           /*     Include code for OSMemPend()                                      */
+#define OS_CFG_MEM_QUOTA_EN                        0u           /*     Include code for per-task block quotas (OSMemQuotaxxx())          */
+#define OS_CFG_SLAB_EN                             1u           /*     Include code for the multi-size slab allocator (OSSlabxxx())      */
+#define OS_CFG_OBJ_POOL_EN                         0u           /*     Kernel pools of sems, queues and timers (OSSemAlloc()...)         */
+
+
+                                                                /* ------------------ TWO-LEVEL SEGREGATED FIT HEAP -------------------  */
+#define OS_CFG_HEAP_EN                             0u           /* Enable (1) or Disable (0) code generation for the TLSF HEAP           */
+#define OS_CFG_HEAP_FL_NBR                        16u           /*     Number of first level size classes (<= bits in a CPU_DATA)        */
+#define OS_CFG_HEAP_SL_LOG2                        3u           /*     Log2 of the number of second level size classes per first level   */
 
 
                                                                 /* ------------------- MUTUAL EXCLUSION SEMAPHORES --------------------  */
 #define OS_CFG_MUTEX_EN                            1u           /* Enable (1) or Disable (0) code generation for MUTEX                   */
 #define OS_CFG_MUTEX_DEL_EN                        1u           /*     Include code for OSMutexDel()                                     */
 #define OS_CFG_MUTEX_PEND_ABORT_EN                 1u           /*     Include code for OSMutexPendAbort()                               */
+#define OS_CFG_MUTEX_GRP_SORT_EN                   0u           /*     Sort owned mutexes by waiter prio for O(1) priority disinherit    */
+#define OS_CFG_MUTEX_CEILING_EN                    0u           /*     Include code for OSMutexCeilingSet() (priority ceiling protocol)  */
+#define OS_CFG_MUTEX_SPIN_CNT                      0u           /*     Spin count on a running mutex owner before blocking (0 = off)     */
+#define OS_CFG_MUTEX_FAST_EN                       0u           /*     Lock-free OSMutexPend()/OSMutexPost() if the port supports it     */
+#define OS_CFG_MUTEX_THROUGHPUT_EN                 0u           /*     Include code for OSMutexThroughputSet() (no ownership handoff)    */
+#define OS_CFG_MUTEX_BLOCK_STAT_EN                 0u           /*     Record blocking times and chains of owners (needs OS_CFG_TS_EN)   */
+#define OS_CFG_MUTEX_CHAIN_MAX                     4u           /*     Number of owners kept per blocking chain                          */
 
 
                                                                 /* -------------------------- MESSAGE QUEUES --------------------------  */
@@ -69,46 +117,181 @@
 #define OS_CFG_Q_DEL_EN                            1u           /*     Include code for OSQDel()                                         */
 #define OS_CFG_Q_FLUSH_EN                          1u           /*     Include code for OSQFlush()                                       */
 #define OS_CFG_Q_PEND_ABORT_EN                     1u           /*     Include code for OSQPendAbort()                                   */
+#define OS_CFG_Q_PEND_MATCH_EN                     0u           /*     Include code for OSQPendMatch()                                   */
+#define OS_CFG_Q_PEND_N_EN                         1u           /*     Include code for OSQPendN()                                       */
+#define OS_CFG_Q_POST_N_EN                         1u           /*     Include code for OSQPostN()                                       */
+#define OS_CFG_Q_POST_WAIT_EN                      0u           /*     Include code for OSQPostWait()                                    */
+#define OS_CFG_Q_PRIV_POOL_EN                      1u           /*     Include code for OSQCreateWithPool()                              */
+#define OS_CFG_Q_PRIO_EN                           0u           /*     Order queued messages by OS_OPT_POST_PRIO() level                 */
+#define OS_CFG_Q_PRIO_LVL_NBR                      8u           /*     Number of message priority levels (2..16)                         */
+#define OS_CFG_MSG_Q_STAT_EN                       0u           /*     Record message residency and queue depth (needs OS_CFG_TS_EN)     */
+#define OS_CFG_MSG_Q_STAT_HIST_SIZE               16u           /*     Number of log2 residency buckets (>= 2)                           */
+
+
+                                                                /* ----------------------------- MAILBOXES ----------------------------- */
+#define OS_CFG_MBOX_EN                             1u           /* Enable (1) or Disable (0) code generation for MAILBOXES               */
+#define OS_CFG_MBOX_DEL_EN                         1u           /*     Include code for OSMboxDel()                                      */
+#define OS_CFG_MBOX_PEND_ABORT_EN                  1u           /*     Include code for OSMboxPendAbort()                                */
+
+
+                                                                /* ------------------------ INTER-CORE CHANNELS ------------------------ */
+#define OS_CFG_ICC_EN                              0u           /* Enable (1) or Disable (0) code generation for INTER-CORE CHANNELS     */
+#define OS_CFG_ICC_SYNC_EN                         0u           /* Enable (1) or Disable (0) inter-core locks and events (HW semaphore)  */
+
+
+                                                                /* ------------------------ ISR TO TASK QUEUES ------------------------- */
+#define OS_CFG_ISR_Q_EN                            1u           /* Enable (1) or Disable (0) code generation for ISR TO TASK QUEUES      */
+
+
+                                                                /* --------------------- PEND ON MULTIPLE OBJECTS ---------------------- */
+#define OS_CFG_PEND_MULTI_EN                       0u           /* Enable (1) or Disable (0) code for OSPendMulti()                      */
+
+
+                                                                /* ------------------------------- PIPES ------------------------------- */
+#define OS_CFG_PIPE_EN                             1u           /* Enable (1) or Disable (0) code generation for PIPES                   */
+#define OS_CFG_PIPE_DEL_EN                         1u           /*     Include code for OSPipeDel()                                      */
+
+
+                                                                /* --------------------------- RING BUFFERS ---------------------------- */
+#define OS_CFG_RING_EN                             1u           /* Enable (1) or Disable (0) code generation for RING BUFFERS            */
+#define OS_CFG_RING_DEL_EN                         1u           /*     Include code for OSRingDel()                                      */
+
+
+                                                                /* ------------------------ READER/WRITER LOCKS ------------------------ */
+#define OS_CFG_RWLOCK_EN                           1u           /* Enable (1) or Disable (0) code generation for READER/WRITER LOCKS     */
+#define OS_CFG_RWLOCK_DEL_EN                       1u           /*     Include code for OSRwLockDel()                                    */
+#define OS_CFG_RWLOCK_PEND_ABORT_EN                1u           /*     Include code for OSRwLockPendAbort()                              */
+#define OS_CFG_RWLOCK_HOLD_MAX                     2u           /*     Max. nbr of reader/writer locks held at once by a task            */
 
 
                                                                 /* ---------------------------- SEMAPHORES ----------------------------- */
 #define OS_CFG_SEM_EN                              1u           /* Enable (1) or Disable (0) code generation for SEMAPHORES              */
 #define OS_CFG_SEM_DEL_EN                          1u           /*     Include code for OSSemDel()                                       */
 #define OS_CFG_SEM_PEND_ABORT_EN                   1u           /*     Include code for OSSemPendAbort()                                 */
+#define OS_CFG_SEM_PEND_N_EN                       1u           /*     Include code for OSSemPendN()                                     */
+#define OS_CFG_SEM_POST_N_EN                       1u           /*     Include code for OSSemPostN()                                     */
 #define OS_CFG_SEM_SET_EN                          1u           /*     Include code for OSSemSet()                                       */
+#define OS_CFG_SEM_FAST_EN                         0u           /*     Lock-free OSSemPend()/OSSemPost() without waiters if supported    */
+
+
+                                                                /* ------------------------- READ-COPY-UPDATE -------------------------- */
+#define OS_CFG_RCU_EN                              1u           /* Enable (1) or Disable (0) code generation for READ-COPY-UPDATE        */
+#define OS_CFG_RCU_DEL_EN                          1u           /*     Include code for OSRcuDel()                                       */
+
+
+                                                                /* -------------------------- SEQUENCE LOCKS --------------------------- */
+#define OS_CFG_SEQLOCK_EN                          1u           /* Enable (1) or Disable (0) code generation for SEQUENCE LOCKS          */
+#define OS_CFG_SEQLOCK_DEL_EN                      1u           /*     Include code for OSSeqLockDel()                                   */
+
+
+                                                                /* ------------------------------ SIGNALS ------------------------------ */
+#define OS_CFG_SIGNAL_EN                           1u           /* Enable (1) or Disable (0) code generation for SIGNALS                 */
+#define OS_CFG_SIGNAL_DEL_EN                       1u           /*     Include code for OSSignalDel()                                    */
+#define OS_CFG_SIGNAL_PEND_ABORT_EN                1u           /*     Include code for OSSignalPendAbort()                              */
+#define OS_CFG_SIGNAL_COALESCE_EN                  0u           /*     Include OSSignalCoalesceSet() (needs OS_CFG_TIME_HR_EN)           */
+
+
+                                                                /* ---------------------------- COMPLETIONS ---------------------------- */
+#define OS_CFG_COMPLETION_EN                       0u           /* Enable (1) or Disable (0) code generation for COMPLETIONS             */
+#define OS_CFG_COMPLETION_DEL_EN                   1u           /*     Include code for OSCompletionDel()                                */
+
+
+                                                                /* ----------------------------- REACTORS ------------------------------ */
+#define OS_CFG_REACTOR_EN                          0u           /* Enable (1) or Disable (0) code generation for REACTORS                */
+#define OS_CFG_REACTOR_DEL_EN                      1u           /*     Include code for OSReactorDel()                                   */
+
+
+                                                                /*------------------------------- TOPICS ------------------------------ */
+#define OS_CFG_TOPIC_EN                            0u           /* Enable (1) or Disable (0) code generation for TOPICS                  */
+#define OS_CFG_TOPIC_DEL_EN                        1u           /*     Include code for OSTopicDel()                                     */
+
+
+                                                                /*------------------------------- CALLS ------------------------------- */
+#define OS_CFG_CALL_EN                             0u           /* Enable (1) or Disable (0) code generation for CALL/REPLY              */
+#define OS_CFG_CALL_DEL_EN                         1u           /*     Include code for OSCallEpDel()                                    */
 
 
                                                                 /* -------------------------- TASK MANAGEMENT -------------------------- */
 #define OS_CFG_STAT_TASK_EN                        1u           /* Enable (1) or Disable (0) the statistics task                         */
+#define OS_CFG_STAT_TASK_BUDGET                    0u           /*     Max. nbr of tasks processed per statistic task run (0 = all)      */
+#define OS_CFG_STAT_TASK_IDLE_CYCLES_EN            0u           /*     CPU usage from idle task cycles, no calibration (needs profiling) */
 #define OS_CFG_STAT_TASK_STK_CHK_EN                1u           /*     Check task stacks from the statistic task                         */
+#define OS_CFG_STAT_TASK_STK_CHK_INCR_EN           0u           /*     Scan stacks incrementally from the previous high-water mark       */
+#define OS_CFG_STAT_TASK_STK_CHK_CHUNK            64u           /*     Max. number of stack entries scanned per OSTaskStkChk() call      */
+#define OS_CFG_STAT_SNAP_EN                        0u           /*     Maintain a statistics snapshot for debug probes (OSStatSnap)      */
+#define OS_CFG_STAT_SNAP_TASK_NBR                 16u           /*     Max. number of tasks in the snapshot                              */
+#define OS_CFG_STAT_SNAP_Q_NBR                     8u           /*     Max. number of message queues in the snapshot                     */
+#define OS_CFG_STAT_GOV_EN                         0u           /*     Frequency governor driven by the CPU usage (OSStatGovSet())       */
+#define OS_CFG_STAT_SCHED_EN                       0u           /*     Response-time analysis of periodic tasks from measured exec times */
+#define OS_CFG_STAT_SCHED_ITER_MAX                32u           /*     Max. number of iterations of the analysis per task                */
 
+#define OS_CFG_TASK_BUDGET_EN                      0u           /* Include per-task CPU budgets (OSTaskBudgetSet())                      */
+#define OS_CFG_TASK_BUDGET_PRIO                   62u           /*     Background priority of tasks that exhausted their budget          */
 #define OS_CFG_TASK_CHANGE_PRIO_EN                 1u           /* Include code for OSTaskChangePrio()                                   */
+#define OS_CFG_TASK_CREATE_TBL_EN                  0u           /* Include code for OSTaskCreateTbl()                                    */
 #define OS_CFG_TASK_DEL_EN                         1u           /* Include code for OSTaskDel()                                          */
+#define OS_CFG_TASK_EDF_EN                         0u           /* Schedule one priority level by earliest deadline (OSTaskPeriodxxx())  */
+#define OS_CFG_TASK_EDF_PRIO                      32u           /*     Priority level scheduled by deadline                              */
+#define OS_CFG_TASK_EDF_PEND_EN                    0u           /*     Order same-priority pend list waiters by deadline                 */
+#define OS_CFG_TASK_EDF_PEND_TIE_EN                0u           /*     Equal deadlines: shorter period first (1) or FIFO (0)             */
+#define OS_CFG_TASK_FAIR_EN                        0u           /* Share one priority level by weight (OSTaskFairSet())                  */
+#define OS_CFG_TASK_FAIR_PRIO                     60u           /*     Priority level scheduled by virtual runtime                       */
+#define OS_CFG_TASK_GRP_EN                         0u           /* Include task groups (OSTaskGrpxxx())                                  */
+#define OS_CFG_TASK_HIST_EN                        0u           /* Include per-task wake and pend latency histograms (OSTaskHistGet())   */
+#define OS_CFG_TASK_HIST_SIZE                     16u           /*     Number of log2 buckets in each histogram                          */
+#define OS_CFG_TASK_HIST_PRIO_EN                   0u           /*     Include wake to run latency per priority (OSTaskHistPrioGet())    */
 #define OS_CFG_TASK_IDLE_EN                        1u           /* Include the idle task                                                 */
+#define OS_CFG_TASK_IDLE_PM_EN                     0u           /*     Sleep states picked from the next deadline (needs DYN_TICK, TS)   */
+#define OS_CFG_TASK_NOTIFY_EN                      1u           /* Include code for OSTaskNotify() and OSTaskNotifyWait()                */
+#define OS_CFG_TASK_NOTIFY_SLOTS                   2u           /*     Number of notification slots per task                             */
+#define OS_CFG_TASK_PERF_CTR_EN                    0u           /* Include per-task hardware event counters (port must support them)     */
+#define OS_CFG_TASK_PERIOD_EN                      0u           /* Include periodic releases with overrun detection (OSTaskPeriodxxx())  */
+#define OS_CFG_TASK_POOL_EN                        0u           /* Include code for task pools (OSTaskPoolxxx())                         */
+#define OS_CFG_TASK_STK_GRP_EN                     0u           /* Include code for task stack groups (OSTaskStkGrpxxx())                */
 #define OS_CFG_TASK_PROFILE_EN                     1u           /* Include variables in OS_TCB for profiling                             */
 #define OS_CFG_TASK_Q_EN                           1u           /* Include code for OSTaskQXXXX()                                        */
 #define OS_CFG_TASK_Q_PEND_ABORT_EN                1u           /* Include code for OSTaskQPendAbort()                                   */
+#define OS_CFG_TASK_Q_POST_N_EN                    1u           /* Include code for OSTaskQPostN()                                       */
 #define OS_CFG_TASK_REG_TBL_SIZE                   1u           /* Number of task specific registers                                     */
 
 #define OS_CFG_TASK_STK_REDZONE_EN                 0u           /* Enable (1) or Disable (0) stack redzone                               */
 #define OS_CFG_TASK_STK_REDZONE_DEPTH              8u           /* Depth of the stack redzone                                            */
 
+#define OS_CFG_TASK_STK_CLR_DEFER_EN               0u           /* Let the idle task clear stacks created with OS_OPT_TASK_STK_CLR_DEFER */
+#define OS_CFG_TASK_STK_CLR_CHUNK                 32u           /*     Max. number of stack entries cleared at once by the idle task     */
+
+#define OS_CFG_TASK_STK_PROFILE_EN                 0u           /* Record the peak stack usage per entry point (OSTaskStkProfileInit())  */
+#define OS_CFG_TASK_STK_PROFILE_SIZE              16u           /*     Number of entries of the stack profile table                      */
+#define OS_CFG_TASK_STK_PROFILE_MARGIN            25u           /*     Margin added to the peak usage for the recommended size, in %     */
+#define OS_CFG_TASK_STK_FIT_EN                     0u           /*     Allocate stacks of the recommended size (OS_OPT_TASK_STK_FIT)     */
+
 #define OS_CFG_TASK_SEM_PEND_ABORT_EN              1u           /* Include code for OSTaskSemPendAbort()                                 */
 #define OS_CFG_TASK_SUSPEND_EN                     1u           /* Include code for OSTaskSuspend() and OSTaskResume()                   */
+#define OS_CFG_TASK_TCB_HOT_FIRST_EN               0u           /* Put the scheduling fields first in OS_TCB and cache align it          */
 
 
                                                                 /* ------------------ TASK LOCAL STORAGE MANAGEMENT -------------------  */
 #define OS_CFG_TLS_TBL_SIZE                        0u           /* Include code for Task Local Storage (TLS) registers                   */
+#define OS_CFG_TLS_LAZY_SW_EN                      0u           /*     Skip OS_TLS_TaskSw() for tasks created with OS_OPT_TASK_NO_TLS    */
+#define OS_CFG_TLS_MALLOC_ARENA_EN                 0u           /*     Serve small malloc() calls from per-task slab magazines           */
 
 
                                                                 /* ------------------------- TIME MANAGEMENT --------------------------  */
 #define OS_CFG_TIME_DLY_HMSM_EN                    1u           /* Include code for OSTimeDlyHMSM()                                      */
 #define OS_CFG_TIME_DLY_RESUME_EN                  1u           /* Include code for OSTimeDlyResume()                                    */
+#define OS_CFG_TIME_PERIODIC_EN                    1u           /* Include OS_OPT_TIME_PERIODIC delays (adds '.TickCtrPrev' to TCBs)     */
+#define OS_CFG_TIME_HR_EN                          0u           /* Include code for OSTimeDlyUs() and the xxxPendUs() calls              */
+#define OS_CFG_TIME_ABS_EN                         0u           /* Include code for OSTimeDlyUntil() and OS_OPT_PEND_ABS deadlines       */
+#define OS_CFG_TICK_RATE_SET_EN                    0u           /* Include code for OSTickRateSet() (needs port support, no DYN_TICK)    */
 
 
                                                                 /* ------------------------- TIMER MANAGEMENT -------------------------- */
 #define OS_CFG_TMR_EN                              1u           /* Enable (1) or Disable (0) code generation for TIMERS                  */
+#define OS_CFG_TMR_CMD_Q_EN                        0u           /* Queue OSTmrStart()/Stop()/Set() to the timer task instead of locking  */
 #define OS_CFG_TMR_DEL_EN                          1u           /* Enable (1) or Disable (0) code generation for OSTmrDel()              */
+#define OS_CFG_TMR_ISR_EN                          0u           /* Include code for OS_OPT_TMR_ISR timers (needs OS_CFG_TIME_HR_EN)      */
+#define OS_CFG_TMR_SVC_EN                          1u           /* Enable (1) or Disable (0) code for OSTmrSvcCreate()/OSTmrSvcSet()     */
+#define OS_CFG_TMR_WHEEL_EN                        0u           /* Use a timer wheel (1) or a delta list (0) for running timers          */
 
 
                                                                 /* ------------------------- TRACE RECORDER ---------------------------- */
@@ -116,4 +299,19 @@
 #define OS_CFG_TRACE_API_ENTER_EN                  0u           /* Enable (1) or Disable (0) uC/OS-III Trace API enter instrumentation   */
 #define OS_CFG_TRACE_API_EXIT_EN                   0u           /* Enable (1) or Disable (0) uC/OS-III Trace API exit  instrumentation   */
 
+
+                                                                /* --------------------------- WORK QUEUES ----------------------------- */
+#define OS_CFG_WORKQ_EN                            0u           /* Enable (1) or Disable (0) code generation for WORK QUEUES             */
+#define OS_CFG_WORKQ_PRIO_NBR                      4u           /*     Number of job priorities of a work queue (1..255)                 */
+
+
+                                                                /* ------------------------ SOFTWARE WATCHDOG -------------------------- */
+#define OS_CFG_WDOG_EN                             0u           /* Supervise task check-ins (needs OS_CFG_TMR_EN and OS_CFG_ATOMIC_EN)   */
+#define OS_CFG_WDOG_NBR_MAX                       32u           /*     Number of tasks that can be supervised (1..65535)                 */
+
+
+                                                                /* ------------------------ THREADED INTERRUPTS ------------------------ */
+#define OS_CFG_INT_THREAD_EN                       0u           /* Enable (1) or Disable (0) threaded interrupt handlers                 */
+#define OS_CFG_INT_THREAD_IRQ_NBR                 64u           /*     Number of interrupts that can have a handler task (1..65535)      */
+
 #endif
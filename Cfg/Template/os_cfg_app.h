@@ -41,6 +41,15 @@
 #define  OS_CFG_TASK_STK_LIMIT_PCT_EMPTY                  10u
 
 
+                                                                /* ----------------- ISR HANDLER TASK ----------------- */
+                                                                /* Size of the deferred ISR post queue (entries)        */
+#define  OS_CFG_INT_Q_SIZE                                10u
+                                                                /* Priority (above any task readied from an ISR)        */
+#define  OS_CFG_INT_Q_TASK_PRIO                            0u
+                                                                /* Stack size (number of CPU_STK elements)              */
+#define  OS_CFG_INT_Q_TASK_STK_SIZE                      128u
+
+
                                                                 /* -------------------- IDLE TASK --------------------- */
                                                                 /* Stack size (number of CPU_STK elements)              */
 #define  OS_CFG_IDLE_TASK_STK_SIZE                        64u
@@ -58,6 +67,12 @@
                                                                 /* ---------------------- TICKS ----------------------- */
                                                                 /* Tick rate in Hertz (10 to 1000 Hz)                   */
 #define  OS_CFG_TICK_RATE_HZ                            1000u
+                                                                /* Number of spokes in the tick wheel (power of 2)      */
+#define  OS_CFG_TICK_WHEEL_SIZE                           64u
+                                                                /* Priority of 'Tick Task' (when OS_CFG_TICK_TASK_EN)   */
+#define  OS_CFG_TICK_TASK_PRIO                             1u
+                                                                /* Stack size (number of CPU_STK elements)              */
+#define  OS_CFG_TICK_TASK_STK_SIZE                       128u
 
 
                                                                 /* --------------------- TIMERS ----------------------- */
@@ -65,6 +80,10 @@
 #define  OS_CFG_TMR_TASK_PRIO   ((OS_PRIO)(OS_CFG_PRIO_MAX-3u))
                                                                 /* Stack size (number of CPU_STK elements)              */
 #define  OS_CFG_TMR_TASK_STK_SIZE                        128u
+                                                                /* Number of spokes in the timer wheel (power of 2)     */
+#define  OS_CFG_TMR_WHEEL_SIZE                           256u
+                                                                /* Commands queued to a timer task (power of 2)         */
+#define  OS_CFG_TMR_CMD_Q_SIZE                            16u
 
                                                                 /* DEPRECATED - Rate for timers (10 Hz Typ.)            */
                                                                 /* The timer task now calculates its timeouts based     */
@@ -77,4 +96,21 @@
 #define  OS_CFG_TMR_TASK_RATE_HZ                          10u
 
 
+                                                                /* ------------------- OBJECT POOLS ------------------- */
+                                                                /* Semaphores for OSSemAlloc() (0 or >= 2)              */
+#define  OS_CFG_SEM_POOL_SIZE                              8u
+                                                                /* Message queues for OSQAlloc() (0 or >= 2)            */
+#define  OS_CFG_Q_POOL_SIZE                                4u
+                                                                /* Timers for OSTmrAlloc() (0 or >= 2)                  */
+#define  OS_CFG_TMR_POOL_SIZE                              8u
+
+                                                                /* ------------------- PRIORITY MAP ------------------- */
+                                                                /* Number of priorities used (OS_CFG_PRIO_MAP_EN)       */
+#define  OS_CFG_PRIO_MAP_NBR                              16u
+                                                                /* Priorities used, in increasing order, including the  */
+                                                                /* kernel tasks and ending with the idle task priority  */
+#define  OS_CFG_PRIO_MAP_TBL    0u,  1u,  2u,  3u,  4u,  5u,  6u,  7u, \
+                                8u,  9u, 10u, 32u, 60u, 61u, 62u, 63u
+
+
 #endif
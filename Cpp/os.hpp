@@ -0,0 +1,342 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            C++ WRAPPER LAYER
+*
+* File    : os.hpp
+* Version : V3.08.00
+*********************************************************************************************************
+* Note(s) : (1) This header-only layer gives C++ applications typed access to the kernel.  To use it, add
+*               this folder to the include path and include os.hpp instead of os.h.  It requires C++11
+*               or later and needs neither exceptions, RTTI, the heap nor the standard library.
+*
+*           (2) Every member function is inline and forwards to one kernel call with the same arguments
+*               the application would have written in C.  The classes have no virtual functions and
+*               no base classes, and hold nothing but the kernel object (and its stack or message pool)
+*               so that an instance has the size of the C objects it replaces.
+*
+*           (3) The template parameters are checked at compile time:
+*
+*                   os::Task<PRIO, STK_SIZE>    'PRIO' below the idle task priority (OS_CFG_PRIO_MAX - 1)
+*                                               'STK_SIZE' at least OS_CFG_STK_SIZE_MIN
+*
+*                   os::Queue<T, N>             'N' from 1 to the size of the message pool, unless the
+*                                               queue has its own pool (OS_CFG_Q_PRIV_POOL_EN)
+*
+*               os::PrioIsValid() can be used in the application's own static_assert()s.
+*
+*           (4) os::Queue<T, N> carries pointers to 'T', like OSQPost() and OSQPend() carry 'void *'.
+*               Post() only accepts a 'T *' and Pend() returns a 'T *', so the casts and the size checks
+*               on the receiving side go away.  The object pointed to MUST remain valid until the
+*               receiver is done with it, as with the C API.
+*
+*           (5) os::SchedLock and os::MutexLock are scope guards.  The destructor undoes what the
+*               constructor did, and only if it succeeded; Err() returns the error of the constructor.
+*
+*           (6) The objects are normally given static storage duration.  They MUST NOT be copied, and a
+*               kernel object MUST be deleted (see the C API) before its wrapper goes out of scope.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_HPP
+#define  OS_HPP
+
+
+#include  <os.h>
+
+
+#if (__cplusplus < 201103L) && (!defined(_MSVC_LANG) || (_MSVC_LANG < 201103L))
+#error  "os.hpp requires C++11 or later"
+#endif
+
+
+namespace os {
+
+/*
+*********************************************************************************************************
+*                                     COMPILE-TIME CONFIGURATION CHECKS
+*********************************************************************************************************
+*/
+
+constexpr  bool  PrioIsValid (OS_PRIO  prio)                    /* Priorities available to application tasks            */
+{
+    return (prio < (OS_PRIO)(OS_CFG_PRIO_MAX - 1u));
+}
+
+
+/*
+*********************************************************************************************************
+*                                                 TASKS
+*
+* Note(s) : (1) 'STK_LIMIT' is the number of CPU_STK elements left when the stack is considered full, the
+*               same default as the kernel tasks (10% of the stack).
+*********************************************************************************************************
+*/
+
+template <OS_PRIO  PRIO, CPU_STK_SIZE  STK_SIZE, CPU_STK_SIZE  STK_LIMIT = (STK_SIZE / 10u)>
+class Task {
+    static_assert(PrioIsValid(PRIO),          "os::Task, PRIO MUST be < OS_CFG_PRIO_MAX - 1 (idle task)");
+    static_assert(STK_SIZE >= OS_CFG_STK_SIZE_MIN, "os::Task, STK_SIZE MUST be >= OS_CFG_STK_SIZE_MIN");
+    static_assert(STK_LIMIT < STK_SIZE,       "os::Task, STK_LIMIT MUST be < STK_SIZE");
+
+public:
+    static constexpr  OS_PRIO       Prio    = PRIO;
+    static constexpr  CPU_STK_SIZE  StkSize = STK_SIZE;
+
+    Task            ()              = default;
+    Task            (const Task &)  = delete;
+    Task &operator= (const Task &)  = delete;
+
+    void  Create (const CPU_CHAR  *p_name,
+                  OS_TASK_PTR      p_task,
+                  void            *p_arg,
+                  OS_ERR          *p_err,
+                  OS_MSG_QTY       q_size      = 0u,
+                  OS_TICK          time_quanta = 0u,
+                  OS_OPT           opt         = (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR))
+    {
+        OSTaskCreate(&TCB,
+                      const_cast<CPU_CHAR *>(p_name),           /* The kernel only keeps the pointer to the name        */
+                      p_task,
+                      p_arg,
+                      PRIO,
+                     &Stk[0],
+                      STK_LIMIT,
+                      STK_SIZE,
+                      q_size,
+                      time_quanta,
+                      nullptr,
+                      opt,
+                      p_err);
+    }
+
+    OS_TCB  *TCBPtr (void)
+    {
+        return (&TCB);
+    }
+
+private:
+    OS_TCB   TCB;
+    CPU_STK  Stk[STK_SIZE];
+};
+
+
+/*
+*********************************************************************************************************
+*                                             MESSAGE QUEUES
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_Q_EN > 0u)
+template <typename  T, OS_MSG_QTY  N>
+class Queue {
+    static_assert(N > 0u,                     "os::Queue, N MUST be > 0");
+#if (OS_CFG_Q_PRIV_POOL_EN == 0u)
+    static_assert(N <= OS_CFG_MSG_POOL_SIZE,  "os::Queue, N MUST be <= OS_CFG_MSG_POOL_SIZE");
+#endif
+    static_assert(sizeof(T) <= (OS_MSG_SIZE)~(OS_MSG_SIZE)0, "os::Queue, sizeof(T) doesn't fit in OS_MSG_SIZE");
+
+public:
+    static constexpr  OS_MSG_QTY  Size = N;
+
+    Queue            ()               = default;
+    Queue            (const Queue &)  = delete;
+    Queue &operator= (const Queue &)  = delete;
+
+    void  Create (const CPU_CHAR  *p_name,
+                  OS_ERR          *p_err)
+    {
+#if (OS_CFG_Q_PRIV_POOL_EN > 0u)
+        OSQCreateWithPool(&Q, const_cast<CPU_CHAR *>(p_name), &Pool[0], N, p_err);
+#else
+        OSQCreate(&Q, const_cast<CPU_CHAR *>(p_name), N, p_err);
+#endif
+    }
+
+    void  Post (T       *p_msg,
+                OS_ERR  *p_err,
+                OS_OPT   opt = OS_OPT_POST_FIFO)
+    {
+        OSQPost(&Q,
+                 const_cast<void *>(static_cast<const void *>(p_msg)),
+                (OS_MSG_SIZE)sizeof(T),
+                 opt,
+                 p_err);
+    }
+
+#if (OS_CFG_POST_FROM_ISR_EN > 0u)
+    void  PostFromISR (T       *p_msg,
+                       OS_ERR  *p_err,
+                       OS_OPT   opt = OS_OPT_POST_FIFO)
+    {
+        OSQPostFromISR(&Q,
+                        const_cast<void *>(static_cast<const void *>(p_msg)),
+                       (OS_MSG_SIZE)sizeof(T),
+                        opt,
+                        p_err);
+    }
+#endif
+
+    T  *Pend (OS_TICK   timeout,
+              OS_ERR   *p_err,
+              OS_OPT    opt  = OS_OPT_PEND_BLOCKING,
+              CPU_TS   *p_ts = nullptr)
+    {
+        OS_MSG_SIZE  msg_size;
+
+
+        return (static_cast<T *>(OSQPend(&Q, timeout, opt, &msg_size, p_ts, p_err)));
+    }
+
+    OS_Q  *QPtr (void)
+    {
+        return (&Q);
+    }
+
+private:
+    OS_Q     Q;
+#if (OS_CFG_Q_PRIV_POOL_EN > 0u)
+    OS_MSG   Pool[N];                                           /* The queue doesn't draw from the shared pool          */
+#endif
+};
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                                MUTEXES
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_MUTEX_EN > 0u)
+class Mutex {
+public:
+    Mutex            ()               = default;
+    Mutex            (const Mutex &)  = delete;
+    Mutex &operator= (const Mutex &)  = delete;
+
+    void  Create (const CPU_CHAR  *p_name,
+                  OS_ERR          *p_err)
+    {
+        OSMutexCreate(&M, const_cast<CPU_CHAR *>(p_name), p_err);
+    }
+
+    void  Pend (OS_TICK   timeout,
+                OS_ERR   *p_err,
+                OS_OPT    opt  = OS_OPT_PEND_BLOCKING,
+                CPU_TS   *p_ts = nullptr)
+    {
+        OSMutexPend(&M, timeout, opt, p_ts, p_err);
+    }
+
+    void  Post (OS_ERR  *p_err,
+                OS_OPT   opt = OS_OPT_POST_NONE)
+    {
+        OSMutexPost(&M, opt, p_err);
+    }
+
+    OS_MUTEX  *MutexPtr (void)
+    {
+        return (&M);
+    }
+
+private:
+    OS_MUTEX  M;
+};
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                              SCOPE GUARDS
+*
+* Note(s) : (1) OSMutexPend() returns OS_ERR_MUTEX_OWNER when the task already owns the mutex and nests its
+*               use of it.  The nesting counter was incremented, so the guard posts the mutex in that case
+*               too.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_MUTEX_EN > 0u)
+class MutexLock {
+public:
+    explicit  MutexLock (Mutex    &mutex,
+                         OS_TICK   timeout = 0u,
+                         OS_OPT    opt     = OS_OPT_PEND_BLOCKING)
+        : MutexRef(mutex)
+    {
+        MutexRef.Pend(timeout, &PendErr, opt);
+    }
+
+    ~MutexLock ()
+    {
+        OS_ERR  err;
+
+
+        if ((PendErr == OS_ERR_NONE) ||
+            (PendErr == OS_ERR_MUTEX_OWNER)) {                  /* See Note #1                                          */
+            MutexRef.Post(&err);
+        }
+    }
+
+    MutexLock            (const MutexLock &)  = delete;
+    MutexLock &operator= (const MutexLock &)  = delete;
+
+    OS_ERR  Err (void) const
+    {
+        return (PendErr);
+    }
+
+private:
+    Mutex   &MutexRef;
+    OS_ERR   PendErr;
+};
+#endif
+
+
+class SchedLock {
+public:
+    SchedLock ()
+    {
+        OSSchedLock(&LockErr);
+    }
+
+    ~SchedLock ()
+    {
+        OS_ERR  err;
+
+
+        if (LockErr == OS_ERR_NONE) {
+            OSSchedUnlock(&err);
+        }
+    }
+
+    SchedLock            (const SchedLock &)  = delete;
+    SchedLock &operator= (const SchedLock &)  = delete;
+
+    OS_ERR  Err (void) const
+    {
+        return (LockErr);
+    }
+
+private:
+    OS_ERR  LockErr;
+};
+
+}                                                               /* namespace os                                         */
+
+#endif
@@ -44,6 +44,11 @@
 *                   Suitable for cpus with VFP-only support and 16 double word registers.
 *                   Must also be used when the CPACR.D32DIS bit is set and access to registers
 *                   D16-D31 would cause an exception.
+*
+*             (3) Assembling os_cpu_a_vfp-*.S with OS_CPU_INT_NEST_EN defined to 1 (and OS_CPU_GICC_BASE
+*                 to the address of the GIC CPU interface) lets IRQs of higher GIC priority preempt an
+*                 IRQ handler.  The port then acknowledges the GIC itself and dispatches IRQs to
+*                 OS_CPU_IntHndlr(), see Note #1 of OS_CPU_ARM_ExceptIrqNest in os_cpu_a_vfp-*.S.
 *********************************************************************************************************
 */
 
@@ -87,6 +92,38 @@ extern  "C" {
 
 #define  OS_TASK_SW()               OSCtxSw()
 
+                                                            /* Return address of the current function (OSSchedLock()) */
+#define  OS_CPU_RET_ADDR_GET()     ((CPU_ADDR)__builtin_return_address(0))
+
+                                                            /* Spin-wait hint, see OS_CFG_MUTEX_SPIN_CNT              */
+#define  OS_CPU_SPIN_PAUSE()        __asm__ __volatile__ ("yield" : : : "memory")
+
+                                                            /* Data memory barrier, see os_icc.c                    */
+#define  OS_CPU_MEM_BARRIER()       __asm__ __volatile__ ("dmb" : : : "memory")
+
+                                                            /* Data cache maintenance, see os_cpu_a_vfp-xxx.S       */
+#define  OS_CPU_CACHE_LINE_SIZE     64u                     /* Largest line of the ARMv7-A cores (Cortex-A7/A15)      */
+#define  OS_CPU_CACHE_ALIGN         __attribute__((aligned(OS_CPU_CACHE_LINE_SIZE)))
+#define  OS_CPU_DCACHE_CLEAN(p_addr, size)  OS_CPU_DCacheClean((void *)(p_addr), (CPU_SIZE_T)(size))
+#define  OS_CPU_DCACHE_INV(p_addr, size)    OS_CPU_DCacheInv((void *)(p_addr), (CPU_SIZE_T)(size))
+
+/*
+*********************************************************************************************************
+*                                          ATOMIC OPERATIONS
+*
+* Note(s) : (1) Used by the OSAtomicxxx() services (see os_atomic.c).  GCC expands the builtins to
+*               LDREX/STREX loops surrounded by DMB.
+*********************************************************************************************************
+*/
+
+#define  OS_CPU_ATOMIC_OPS_EN                             1u
+#define  OS_CPU_ATOMIC_CAS(p_addr, val_old, val_new)    __sync_val_compare_and_swap((p_addr), (val_old), (val_new))
+#define  OS_CPU_ATOMIC_FETCH_ADD(p_addr, val)           __atomic_fetch_add((p_addr), (val), __ATOMIC_SEQ_CST)
+#define  OS_CPU_ATOMIC_LOAD(p_addr)                     __atomic_load_n((p_addr), __ATOMIC_ACQUIRE)
+#define  OS_CPU_ATOMIC_STORE(p_addr, val)               __atomic_store_n((p_addr), (val), __ATOMIC_RELEASE)
+#define  OS_CPU_ATOMIC_XCHG(p_addr, val)                __atomic_exchange_n((p_addr), (val), __ATOMIC_SEQ_CST)
+
+
 /*
 *********************************************************************************************************
 *                                       TIMESTAMP CONFIGURATION
@@ -141,9 +178,15 @@ void        OS_CPU_ARM_ExceptIrqHndlr           (void);
 void        OS_CPU_ARM_ExceptFiqHndlr           (void);
 
 void        OS_CPU_ExceptHndlr                  (CPU_INT32U  src_id);
+void        OS_CPU_IntHndlr                     (CPU_INT32U  int_id);
 
 CPU_INT32U  OS_CPU_ARM_DRegCntGet               (void);
 
+void        OS_CPU_DCacheClean                  (void        *p_addr,
+                                                 CPU_SIZE_T   size);
+void        OS_CPU_DCacheInv                    (void        *p_addr,
+                                                 CPU_SIZE_T   size);
+
 
 #ifdef __cplusplus
 }
@@ -50,6 +50,60 @@ extern  "C" {
 
 #define  OS_TASK_SW()                              OSCtxSw()
 
+                                                            /* Return address of the current function (OSSchedLock()) */
+#define  OS_CPU_RET_ADDR_GET()     ((CPU_ADDR)__builtin_return_address(0))
+
+                                                            /* Spin-wait hint, see OS_CFG_MUTEX_SPIN_CNT              */
+#define  OS_CPU_SPIN_PAUSE()        __asm__ __volatile__ ("yield" : : : "memory")
+
+                                                            /* Data memory barrier, see os_icc.c                    */
+#define  OS_CPU_MEM_BARRIER()       __asm__ __volatile__ ("dmb sy" : : : "memory")
+
+                                                            /* Stack fill with DC ZVA, see os_cpu_a.S               */
+#define  OS_CPU_STK_CLR(p_stk, size)  OS_CPU_StkClr((void *)(p_stk), (CPU_SIZE_T)(size) * sizeof(CPU_STK))
+
+                                                            /* Data cache maintenance, see os_cpu_a.S               */
+#define  OS_CPU_CACHE_LINE_SIZE     64u
+#define  OS_CPU_CACHE_ALIGN         __attribute__((aligned(OS_CPU_CACHE_LINE_SIZE)))
+#define  OS_CPU_DCACHE_CLEAN(p_addr, size)  OS_CPU_DCacheClean((void *)(p_addr), (CPU_SIZE_T)(size))
+#define  OS_CPU_DCACHE_INV(p_addr, size)    OS_CPU_DCacheInv((void *)(p_addr), (CPU_SIZE_T)(size))
+
+
+/*
+*********************************************************************************************************
+*                                          SIMD CONFIGURATION
+*
+* Note(s) : (1) OS_CPU_SIMDGet() returns how the FP/SIMD registers are handled by os_cpu_a.S:
+*
+*               OS_CPU_SIMD_NONE    The registers are not part of the task context  (OS_CPU_SIMD == 0)
+*               OS_CPU_SIMD_ALL     Every task context includes them                (OS_CPU_SIMD == 1)
+*               OS_CPU_SIMD_LAZY    Only the context of the tasks using them do     (OS_CPU_SIMD_LAZY_EN == 1)
+*********************************************************************************************************
+*/
+
+#define  OS_CPU_SIMD_NONE                                0u
+#define  OS_CPU_SIMD_ALL                                 1u
+#define  OS_CPU_SIMD_LAZY                                2u
+
+
+/*
+*********************************************************************************************************
+*                                          ATOMIC OPERATIONS
+*
+* Note(s) : (1) Used by the OSAtomicxxx() services (see os_atomic.c).  GCC expands the builtins to
+*               LDAXR/STLXR loops, or to the LSE instructions (CAS, LDADD, LDSET, SWP) when
+*               the compiler targets ARMv8.1-A.
+*********************************************************************************************************
+*/
+
+#define  OS_CPU_ATOMIC_OPS_EN                             1u
+#define  OS_CPU_ATOMIC_CAS(p_addr, val_old, val_new)    __sync_val_compare_and_swap((p_addr), (val_old), (val_new))
+#define  OS_CPU_ATOMIC_FETCH_ADD(p_addr, val)           __atomic_fetch_add((p_addr), (val), __ATOMIC_SEQ_CST)
+#define  OS_CPU_ATOMIC_FETCH_OR(p_addr, val)            __atomic_fetch_or((p_addr), (val), __ATOMIC_SEQ_CST)
+#define  OS_CPU_ATOMIC_LOAD(p_addr)                     __atomic_load_n((p_addr), __ATOMIC_ACQUIRE)
+#define  OS_CPU_ATOMIC_STORE(p_addr, val)               __atomic_store_n((p_addr), (val), __ATOMIC_RELEASE)
+#define  OS_CPU_ATOMIC_XCHG(p_addr, val)                __atomic_exchange_n((p_addr), (val), __ATOMIC_SEQ_CST)
+
 
 /*
 *********************************************************************************************************
@@ -76,6 +130,35 @@ extern  "C" {
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                    PERFORMANCE COUNTER CONFIGURATION
+*
+* Note(s) : (1) When OS_CFG_TASK_PERF_CTR_EN is enabled, OSTaskSwHook() credits the PMU event counters
+*               0 to OS_CPU_PERF_CTR_NBR - 1 to the task being switched out, in '.PerfCtrTotal[]'.  The
+*               event counted by each of them is selected at run-time with OS_CPU_PerfCtrCfg(), which
+*               takes the PMXEVTYPER_EL0 value (event number and, optionally, the exception level
+*               filters).  OS_CPU_PMU_EVT_SW_INCR only counts writes to PMSWINC_EL0 and so stops a counter.
+*
+*           (2) OS_CPU_PERF_CTR_NBR MUST NOT exceed the number of counters implemented (PMCR_EL0.N).
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_PERF_CTR_EN > 0u)
+#ifndef  OS_CPU_PERF_CTR_NBR                                /* See Note #2.                                           */
+#define  OS_CPU_PERF_CTR_NBR                             4u
+#endif
+
+#define  OS_CPU_PMU_EVT_SW_INCR                       0x00u
+#define  OS_CPU_PMU_EVT_L1I_CACHE_REFILL              0x01u
+#define  OS_CPU_PMU_EVT_L1D_CACHE_REFILL              0x03u
+#define  OS_CPU_PMU_EVT_INST_RETIRED                  0x08u
+#define  OS_CPU_PMU_EVT_BR_MIS_PRED                   0x10u
+#define  OS_CPU_PMU_EVT_CPU_CYCLES                    0x11u
+#define  OS_CPU_PMU_EVT_L2D_CACHE_REFILL              0x17u
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                          GLOBAL VARIABLES
@@ -97,12 +180,32 @@ void        OSStartHighRdy           (void);
 
 void        OS_CPU_ARM_ExceptIrqHndlr(void);
 void        OS_CPU_ARM_ExceptFiqHndlr(void);
+void        OS_CPU_ARM_ExceptSIMDHndlr(void);
 
 void        OS_CPU_ExceptHndlr       (CPU_INT32U  src_id);
+void        OS_CPU_IntHndlr          (CPU_INT32U  int_id);
 
 CPU_INT64U  OS_CPU_SPSRGet           (void);
 CPU_INT64U  OS_CPU_SIMDGet           (void);
 
+void        OS_CPU_StkClr            (void       *p_mem,
+                                      CPU_SIZE_T  size);
+
+void        OS_CPU_DCacheClean       (void       *p_addr,
+                                      CPU_SIZE_T  size);
+void        OS_CPU_DCacheInv         (void       *p_addr,
+                                      CPU_SIZE_T  size);
+
+#if (OS_CFG_TASK_PERF_CTR_EN > 0u)
+CPU_BOOLEAN OS_CPU_PerfCtrCfg        (CPU_INT08U  ix,
+                                      CPU_INT32U  event);
+
+CPU_INT32U  OS_CPU_PMUCtrNbrGet      (void);
+void        OS_CPU_PMUCtrEvtSet      (CPU_INT32U  ix,
+                                      CPU_INT32U  event);
+CPU_INT32U  OS_CPU_PMUCtrRd          (CPU_INT32U  ix);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -222,8 +222,15 @@ void  OSTaskReturnHook (OS_TCB  *p_tcb)
 * Note(s)     : (1) The full stack frame is shown below. If SIMD is disabled, (OS_CPU_SIMD == 0),
 *                   the stack frame will only contain the core registers.
 *
+*               (2) With OS_CPU_SIMD_LAZY_EN, the frame starts with a frame type double word and only the
+*                   tasks created with OS_OPT_TASK_SAVE_FP start with the SIMD registers.  Other tasks get
+*                   them the first time they access an FP/SIMD register (see os_cpu_a.S).
+*
 *                                            [LOW MEMORY]
 *                                   ******************************
+*                                   -0x330              [  TYPE  ]  See Note #2
+*                                   -0x328              [PADDING ]
+*                                   ******************************
 *                                   -0x320              [  FPSR  ]
 *                                   -0x318              [  FPCR  ]
 *                                   ******************************
@@ -311,10 +318,10 @@ CPU_STK  *OSTaskStkInit (OS_TASK_PTR    p_task,
     CPU_STK    *p_stk;
     CPU_STK     task_addr;
     CPU_INT32U  i;
+    CPU_INT64U  simd;
 
 
-    (void)opt;                                                  /* Prevent compiler warning                             */
-    (void)p_stk_limit;
+    (void)p_stk_limit;                                          /* Prevent compiler warning                             */
 
                                                                 /* Align stack pointer to 16 bytes                      */
     p_stk = &p_stk_base[stk_size];
@@ -334,13 +341,23 @@ CPU_STK  *OSTaskStkInit (OS_TASK_PTR    p_task,
     *--p_stk = (CPU_STK)OS_CPU_SPSRGet();
     *--p_stk = (CPU_STK)OS_CPU_SPSRGet();
 
-    if (OS_CPU_SIMDGet() == 1u) {
+    simd = OS_CPU_SIMDGet();
+    if ((simd == OS_CPU_SIMD_ALL) ||
+       ((simd == OS_CPU_SIMD_LAZY) && ((opt & OS_OPT_TASK_SAVE_FP) != 0u))) {
         for (i = 64; i > 0; i--) {
             *--p_stk = (CPU_INT64U)i;                           /* Reg Q0-Q31                                           */
         }
 
         *--p_stk = 0x0000000000000000;                          /* FPCR                                                 */
         *--p_stk = 0x0000000000000000;                          /* FPSR                                                 */
+
+        if (simd == OS_CPU_SIMD_LAZY) {
+            *--p_stk = 0x0000000000000000;                      /* Padding                                              */
+            *--p_stk = 0x0000000000000001;                      /* Frame type: SIMD registers saved (See Note #2)       */
+        }
+    } else if (simd == OS_CPU_SIMD_LAZY) {
+        *--p_stk = 0x0000000000000000;                          /* Padding                                              */
+        *--p_stk = 0x0000000000000000;                          /* Frame type: core registers only                      */
     }
 
     return (p_stk);
@@ -361,6 +378,10 @@ CPU_STK  *OSTaskStkInit (OS_TASK_PTR    p_task,
 *               2) It is assumed that the global pointer 'OSTCBHighRdyPtr' points to the TCB of the task
 *                  that will be 'switched in' (i.e. the highest priority task) and, 'OSTCBCurPtr' points
 *                  to the task being switched out (i.e. the preempted task).
+*
+*               3) When OS_CFG_TASK_PERF_CTR_EN is enabled, the events counted by the PMU since the task
+*                  was switched in are added to its '.PerfCtrTotal[]'.  The 32-bit counters may wrap
+*                  once between two switches without losing counts.
 *********************************************************************************************************
 */
 
@@ -372,6 +393,10 @@ void  OSTaskSwHook (void)
 #ifdef  CPU_CFG_INT_DIS_MEAS_EN
     CPU_TS  int_dis_time;
 #endif
+#if (OS_CFG_TASK_PERF_CTR_EN > 0u)
+    CPU_INT08U  ix;
+    CPU_INT32U  ctr;
+#endif
 
 
 
@@ -391,6 +416,16 @@ void  OSTaskSwHook (void)
     OSTCBHighRdyPtr->CyclesStart = ts;
 #endif
 
+#if (OS_CFG_TASK_PERF_CTR_EN > 0u)
+    for (ix = 0u; ix < OS_CPU_PERF_CTR_NBR; ix++) {               /* See Note #3.                                     */
+        ctr = OS_CPU_PMUCtrRd(ix);
+        if (OSTCBCurPtr != OSTCBHighRdyPtr) {
+            OSTCBCurPtr->PerfCtrTotal[ix] += (CPU_INT32U)(ctr - OSTCBCurPtr->PerfCtrStart[ix]);
+        }
+        OSTCBHighRdyPtr->PerfCtrStart[ix] = ctr;
+    }
+#endif
+
 #ifdef  CPU_CFG_INT_DIS_MEAS_EN
     int_dis_time = CPU_IntDisMeasMaxCurReset();                   /* Keep track of per-task interrupt disable time    */
     if (OSTCBCurPtr->IntDisTimeMax < int_dis_time) {
@@ -407,6 +442,49 @@ void  OSTaskSwHook (void)
 }
 
 
+/*
+*********************************************************************************************************
+*                                   CONFIGURE A PERFORMANCE COUNTER
+*
+* Description : Select the event counted by one of the PMU counters credited to the tasks by
+*               OSTaskSwHook().
+*
+* Argument(s) : ix          Counter to configure, from 0 to OS_CPU_PERF_CTR_NBR - 1.
+*
+*               event       Value written to PMXEVTYPER_EL0, e.g. OS_CPU_PMU_EVT_L1D_CACHE_REFILL.
+*
+* Return(s)   : OS_TRUE     if the counter is configured.
+*
+*               OS_FALSE    if 'ix' is out of range or the counter is not implemented.
+*
+* Note(s)     : 1) The counter keeps running across the reconfiguration, the tasks are only credited the
+*                  events counted while they run.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_PERF_CTR_EN > 0u)
+CPU_BOOLEAN  OS_CPU_PerfCtrCfg (CPU_INT08U  ix,
+                                CPU_INT32U  event)
+{
+    CPU_SR_ALLOC();
+
+
+    if (ix >= OS_CPU_PERF_CTR_NBR) {
+        return (OS_FALSE);
+    }
+    if (ix >= OS_CPU_PMUCtrNbrGet()) {
+        return (OS_FALSE);
+    }
+
+    CPU_CRITICAL_ENTER();
+    OS_CPU_PMUCtrEvtSet(ix, event);
+    CPU_CRITICAL_EXIT();
+
+    return (OS_TRUE);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                              TICK HOOK
@@ -57,9 +57,17 @@ extern  "C" {                                    /* See Note #1.
 /*
 *********************************************************************************************************
 *                                               DEFINES
+*
+* Note(s) : (1) When OS_CPU_IDLE_WFI_EN is enabled, OSIdleTaskHook() puts the core to sleep until the
+*               next interrupt, see os_cpu_c.c.
 *********************************************************************************************************
 */
 
+#ifndef  OS_CPU_IDLE_WFI_EN                                     /* See Note #1.                                         */
+#define  OS_CPU_IDLE_WFI_EN            0u
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                               MACROS
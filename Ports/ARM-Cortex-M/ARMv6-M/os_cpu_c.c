@@ -50,6 +50,46 @@ extern  "C" {
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                         DYNAMIC TICK DEFINES
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+#define  OS_CPU_REG_SYST_CVR           (*((CPU_REG32 *)0xE000E018uL))   /* SysTick Current Value Reg.                  */
+#define  OS_CPU_REG_SCB_ICSR           (*((CPU_REG32 *)0xE000ED04uL))   /* Interrupt Control and State Reg.            */
+
+#define  OS_CPU_SCB_ICSR_PENDSTSET                     0x04000000uL
+#define  OS_CPU_SCB_ICSR_PENDSTCLR                     0x02000000uL
+
+#define  OS_CPU_SYST_RVR_MAX                           0x00FFFFFFuL     /* SysTick is a 24-bit down counter.           */
+
+
+/*
+*********************************************************************************************************
+*                                        DYNAMIC TICK VARIABLES
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  OS_CPU_DynTickCnts;                         /* Nbr of SysTick counts per OS tick.                   */
+static  CPU_INT32U  OS_CPU_DynTickPhase;                        /* Cnts from the last tick boundary to the period start */
+static  OS_TICK     OS_CPU_DynTickDelta;                        /* Nbr of ticks programmed for the current period.      */
+
+
+/*
+*********************************************************************************************************
+*                                      DYNAMIC TICK LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  OS_CPU_DynTickCntsGet (void);
+
+static  OS_TICK     OS_CPU_DynTickArm     (OS_TICK     ticks,
+                                           CPU_INT32U  phase);
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                           IDLE TASK HOOK
@@ -59,7 +99,10 @@ extern  "C" {
 *
 * Arguments  : None.
 *
-* Note(s)    : None.
+* Note(s)    : 1) With OS_CPU_IDLE_WFI_EN, the core sleeps (WFI) until the next interrupt.  In Dynamic Tick
+*                 Mode the idle system then only wakes up for device interrupts and for the tick programmed
+*                 for the next timeout.  SysTick stops in deep sleep modes; those need a low-power timer
+*                 driven by the BSP (see Template/bsp_os_dt.c).
 *********************************************************************************************************
 */
 
@@ -70,6 +113,9 @@ void  OSIdleTaskHook (void)
         (*OS_AppIdleTaskHookPtr)();
     }
 #endif
+#if (OS_CPU_IDLE_WFI_EN > 0u)
+    CPU_WaitForInt();                                           /* See Note #1.                                         */
+#endif
 }
 
 
@@ -455,19 +501,33 @@ void  OSTimeTickHook (void)
 * Arguments  : None.
 *
 * Note(s)    : 1) This function MUST be placed on entry 15 of the Cortex-M0 vector table.
+*
+*              2) In Dynamic Tick Mode, the interrupt ends the period programmed by OS_DynTickSet(), on a
+*                 tick boundary.
 *********************************************************************************************************
 */
 
 void  OS_CPU_SysTickHandler (void)
 {
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    OS_TICK  ticks;
+#endif
     CPU_SR_ALLOC();
 
 
     CPU_CRITICAL_ENTER();
     OSIntEnter();                                               /* Tell uC/OS-III that we are starting an ISR           */
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    ticks               = OS_CPU_DynTickDelta;                  /* See Note #2.                                         */
+    OS_CPU_DynTickPhase = 0u;
+#endif
     CPU_CRITICAL_EXIT();
 
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    OSTimeDynTick(ticks);                                       /* The kernel programs the next period                  */
+#else
     OSTimeTick();                                               /* Call uC/OS-III's OSTimeTick()                        */
+#endif
 
     OSIntExit();                                                /* Tell uC/OS-III that we are leaving the ISR           */
 }
@@ -482,15 +542,28 @@ void  OS_CPU_SysTickHandler (void)
 * Arguments  : cnts         Number of SysTick counts between two OS tick interrupts.
 *
 * Note(s)    : 1) This function MUST be called after OSStart() & after processor initialization.
+*
+*              2) In Dynamic Tick Mode, 'cnts' is the number of SysTick counts per OS tick.  The first
+*                 period is programmed from the tick step the kernel already requested (OSTickCtrStep).
 *********************************************************************************************************
 */
 
 void  OS_CPU_SysTickInit (CPU_INT32U  cnts)
 {
     CPU_INT32U  prio;
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    CPU_SR_ALLOC();
+#endif
 
 
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    CPU_CRITICAL_ENTER();
+    OS_CPU_DynTickCnts  = cnts;                                 /* See Note #2.                                         */
+    (void)OS_CPU_DynTickArm(OSTickCtrStep, 0u);
+    CPU_CRITICAL_EXIT();
+#else
     CPU_REG_SYST_RVR    = cnts - 1u;                            /* Set Reload Register                                  */
+#endif
 
                                                                 /* Set SysTick handler prio.                            */
     prio                = CPU_REG_SCB_SHPRI3;
@@ -506,6 +579,169 @@ void  OS_CPU_SysTickInit (CPU_INT32U  cnts)
     CPU_REG_SYST_CSR   |= CPU_REG_SYST_CSR_TICKINT;             /* Enable timer interrupt.                              */
 }
 
+
+/*
+*********************************************************************************************************
+*                                          GET DYNAMIC TICK
+*
+* Description: Return the number of OS ticks that elapsed since the kernel last programmed the tick.
+*
+* Arguments  : None.
+*
+* Returns    : The number of elapsed ticks, between 0 and the number of ticks programmed, inclusive.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and is called with kernel-aware interrupts
+*                 disabled.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+OS_TICK  OS_DynTickGet (void)
+{
+    CPU_INT32U  ticks;
+
+
+    if (OS_CPU_DynTickCnts == 0u) {                             /* SysTick not initialized yet.                         */
+        return (0u);
+    }
+
+    ticks = OS_CPU_DynTickCntsGet() / OS_CPU_DynTickCnts;
+    if (ticks > OS_CPU_DynTickDelta) {
+        ticks = OS_CPU_DynTickDelta;
+    }
+
+    return ((OS_TICK)ticks);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SET DYNAMIC TICK
+*
+* Description: Program the SysTick to interrupt once the given number of OS ticks have elapsed.
+*
+* Arguments  : ticks        Number of ticks to the next tick interrupt, 0 for an indefinite delay.
+*
+* Returns    : The number of ticks that will actually elapse before the next tick interrupt.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and is called with kernel-aware interrupts
+*                 disabled, after the ticks returned by OS_DynTickGet() were added to OSTickCtr.
+*
+*              2) The new period is measured from the last tick boundary, not from the time of the
+*                 call.  The counts of the partial tick in progress are carried over, so reprogramming
+*                 the SysTick, however often, does not make OSTickCtr drift.
+*
+*              3) SysTick is a 24-bit counter.  A longer delay, or an indefinite one, is cut to the
+*                 longest period it can count and the kernel programs the rest on the next interrupt.
+*
+*              4) Until OS_CPU_SysTickInit() is called there is nothing to program.  The pending step
+*                 (OSTickCtrStep) is programmed by OS_CPU_SysTickInit() itself.
+*********************************************************************************************************
+*/
+
+OS_TICK  OS_DynTickSet (OS_TICK  ticks)
+{
+    CPU_INT32U  phase;
+
+
+    if (OS_CPU_DynTickCnts == 0u) {                             /* See Note #4.                                         */
+        return (ticks);
+    }
+
+    phase = OS_CPU_DynTickCntsGet() % OS_CPU_DynTickCnts;       /* See Note #2.                                         */
+
+    return (OS_CPU_DynTickArm(ticks, phase));
+}
+
+
+/*
+*********************************************************************************************************
+*                                     DYNAMIC TICK ELAPSED COUNTS
+*
+* Description: Return the number of SysTick counts since the tick boundary the current period is
+*              measured from.
+*
+* Arguments  : None.
+*
+* Returns    : The number of elapsed SysTick counts.
+*
+* Note(s)    : 1) If the period expired while interrupts were disabled, the SysTick interrupt is still
+*                 pending: the whole period is added to the counts read after the expiry.
+*
+*              2) The counter reads 0 right after it is restarted and when it expires.  It is reloaded
+*                 on the following count.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  OS_CPU_DynTickCntsGet (void)
+{
+    CPU_INT32U  reload;
+    CPU_INT32U  cur;
+    CPU_INT32U  cnts;
+
+
+    reload = CPU_REG_SYST_RVR;
+    cur    = OS_CPU_REG_SYST_CVR;
+    cnts   = 0u;
+    if ((OS_CPU_REG_SCB_ICSR & OS_CPU_SCB_ICSR_PENDSTSET) != 0u) {
+        cur  = OS_CPU_REG_SYST_CVR;                             /* See Note #1.                                         */
+        cnts = reload + 1u;
+    }
+    if (cur != 0u) {                                            /* See Note #2.                                         */
+        cnts += (reload + 1u) - cur;
+    }
+
+    return (OS_CPU_DynTickPhase + cnts);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          ARM DYNAMIC TICK
+*
+* Description: Start a new SysTick period ending 'ticks' OS ticks after the last tick boundary.
+*
+* Arguments  : ticks        Number of ticks in the period, 0 for the longest period.
+*
+*              phase        Number of SysTick counts already elapsed since the last tick boundary.
+*
+* Returns    : The number of ticks programmed.
+*
+* Note(s)    : 1) A SysTick interrupt pending for the previous period is cleared: the kernel already
+*                 accounted for it through OS_DynTickGet().
+*********************************************************************************************************
+*/
+
+static  OS_TICK  OS_CPU_DynTickArm (OS_TICK     ticks,
+                                    CPU_INT32U  phase)
+{
+    OS_TICK     ticks_max;
+    CPU_INT32U  cnts;
+
+
+    ticks_max = (OS_TICK)(OS_CPU_SYST_RVR_MAX / OS_CPU_DynTickCnts);
+    if ((ticks == 0u) ||                                        /* Indefinite delay, or ...                             */
+        (ticks >  ticks_max)) {                                 /* ... longer than SysTick can count.                   */
+        ticks = ticks_max;
+    }
+
+    cnts = ((CPU_INT32U)ticks * OS_CPU_DynTickCnts) - phase;
+    if (cnts < 2u) {                                            /* The reload value must be at least 1.                 */
+        ticks++;
+        cnts += OS_CPU_DynTickCnts;
+    }
+
+    OS_CPU_DynTickPhase = phase;
+    OS_CPU_DynTickDelta = ticks;
+
+    CPU_REG_SYST_RVR    = cnts - 1u;                            /* Set the new period ...                               */
+    OS_CPU_REG_SYST_CVR = 0u;                                   /* ... and restart the count from it.                   */
+    OS_CPU_REG_SCB_ICSR = OS_CPU_SCB_ICSR_PENDSTCLR;            /* See Note #1.                                         */
+
+    return (ticks);
+}
+#endif
+
 #ifdef __cplusplus
 }
 #endif
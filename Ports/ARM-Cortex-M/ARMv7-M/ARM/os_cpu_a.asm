@@ -49,6 +49,7 @@
     EXPORT  OSCtxSw
     EXPORT  OSIntCtxSw
     EXPORT  OS_CPU_PendSVHandler
+    EXPORT  OS_CPU_PSP_Get
 
 
 ;********************************************************************************************************
@@ -259,6 +260,19 @@ OS_CPU_PendSVHandler
     CPSIE   I
     BX      LR                                                  ; Exception return will restore remaining context
 
+;********************************************************************************************************
+;                                     GET THE PROCESS STACK POINTER
+;             CPU_STK  *OS_CPU_PSP_Get(void)
+;
+; Note(s) : 1) Returns PSP.  In an exception handler that interrupted a task, PSP points to the exception
+;              frame stacked on the task stack; the tick ISR reads the interrupted PC from it.
+;********************************************************************************************************
+
+OS_CPU_PSP_Get
+    MRS     R0, PSP                                             ; R0 = PSP
+    BX      LR
+
+
     ALIGN                                                       ; Removes warning[A1581W]: added <no_padbytes> of padding at <address>
 
     END
@@ -62,6 +62,34 @@ extern  "C" {                                    /* See Note #1.
 *                                               DEFINES
 * Note(s) : (1) Determines the interrupt programmable priority levels. This is normally specified in the
 *               Microcontroller reference manual. 4-bits gives us 16 programmable priority levels.
+*
+*           (2) When OS_CPU_MPU_STK_GUARD_EN is enabled, the MPU region OS_CPU_MPU_STK_GUARD_RGN is moved
+*               over the stack redzone of the task being switched in, replacing the software redzone check
+*               done on every context switch (see os_cpu_c.c).
+*
+*           (3) When OS_CPU_IDLE_WFI_EN is enabled, OSIdleTaskHook() puts the core to sleep until the
+*               next interrupt, see os_cpu_c.c.
+*
+*           (4) Interrupts are split in two tiers by CPU_CFG_KA_IPL_BOUNDARY.  Kernel aware interrupts
+*               (priority numerically >= the boundary) are masked by the kernel through BASEPRI and may
+*               call uC/OS-III services.  Zero-latency interrupts (priority numerically < the boundary)
+*               are never masked, not even during a context switch, and MUST NOT call any uC/OS-III
+*               service.  They may hand data over with OSIsrQPost(..., OS_OPT_POST_NO_SIGNAL, ...) and
+*               pend a kernel aware interrupt that calls OSIsrQSignal().  OS_CFG_INT_KA_CHK_EN traps
+*               the zero-latency ISRs that call OSIntEnter() anyway.
+*
+*           (5) When OS_CFG_TASK_PERF_CTR_EN is enabled, OSTaskSwHook() credits the DWT event counters
+*               (CPI, EXC, SLEEP, LSU and FOLD, see OS_CPU_PERF_CTR_xxx) to the task being switched out,
+*               in '.PerfCtrTotal[]'.  They are started and stopped at run-time with OS_CPU_PerfCtrCfg().
+*               These counters are only 8 bits wide: a task that counts more than 255 events of a kind
+*               before being switched out loses the excess.
+*
+*           (6) When OS_CPU_VAR_HOT_SECTION is defined, as a string, the kernel variables read or written on
+*               every context switch, interrupt exit and tick (OSTCBCurPtr, OSTCBHighRdyPtr, OSPrioCur,
+*               OSPrioHighRdy, OSPrioTbl[], OSRdyList[], OSIntNestingCtr, OSSchedLockNestingCtr, OSRunning
+*               and OSTickCtr) are placed together in that section.  The linker script can then locate it
+*               in DTCM, or at least align it on a cache line.  Like .bss, the section MUST be zeroed by
+*               the startup code.
 *********************************************************************************************************
 */
 
@@ -87,6 +115,35 @@ extern  "C" {                                    /* See Note #1.
 #endif
 #endif
 
+#ifndef  OS_CPU_MPU_STK_GUARD_EN                                /* See Note #2.                                         */
+#define  OS_CPU_MPU_STK_GUARD_EN       0u
+#endif
+
+#ifndef  OS_CPU_MPU_STK_GUARD_RGN
+#define  OS_CPU_MPU_STK_GUARD_RGN      7u
+#endif
+
+#ifndef  OS_CPU_IDLE_WFI_EN                                     /* See Note #3.                                         */
+#define  OS_CPU_IDLE_WFI_EN            0u
+#endif
+
+#if (OS_CFG_TASK_PERF_CTR_EN > 0u)                              /* See Note #5.                                         */
+#define  OS_CPU_PERF_CTR_NBR           5u
+#define  OS_CPU_PERF_CTR_CPI           0u                       /* Extra cycles per instruction                         */
+#define  OS_CPU_PERF_CTR_EXC           1u                       /* Cycles spent on exception entry and exit             */
+#define  OS_CPU_PERF_CTR_SLEEP         2u                       /* Cycles spent sleeping                                */
+#define  OS_CPU_PERF_CTR_LSU           3u                       /* Extra cycles of load/store instructions              */
+#define  OS_CPU_PERF_CTR_FOLD          4u                       /* Folded (zero cycle) instructions                     */
+#endif
+
+#ifdef   OS_CPU_VAR_HOT_SECTION                                 /* See Note #6.                                         */
+#define  OS_CPU_VAR_HOT                __attribute__((section(OS_CPU_VAR_HOT_SECTION)))
+#endif
+
+#if (OS_CPU_MPU_STK_GUARD_EN > 0u) && (OS_CFG_TASK_STK_REDZONE_EN == 0u)
+#error  "OS_CFG_TASK_STK_REDZONE_EN     must be Enabled (1) to use the MPU stack guard "
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -98,6 +155,8 @@ extern  "C" {                                    /* See Note #1.
 
 #define  OS_TASK_SW_SYNC()          __asm("    isb")
 
+#define  OS_CPU_INT_IS_KA()         OS_CPU_IntIsKA()        /* See Note #4.                                           */
+
 
 /*
 *********************************************************************************************************
@@ -114,22 +173,49 @@ extern  "C" {                                    /* See Note #1.
 *
 *               (b) CPU_TS_TmrRd() MUST be configured to be greater or equal to 32-bits to avoid
 *                   truncation of TS.
+*
+*           (3) When OS_CPU_TS_DWT_EN is enabled, OS_TS_GET() reads the DWT cycle counter (CYCCNT) that
+*               OSInitHook() starts, and CPU_TS_TmrRd() is not used by the kernel.  OS_CPU_TS64Get()
+*               extends the counter to 64 bits.  OSTimeTickHook() calls it so that no wrap is missed,
+*               which requires ticks to be less than 2^32 CPU cycles apart.
 *********************************************************************************************************
 */
 
+#ifndef  OS_CPU_TS_DWT_EN                                   /* See Note #3.                                           */
+#define  OS_CPU_TS_DWT_EN               0u
+#endif
+
+#define  OS_CPU_REG_DWT_CYCCNT     (*((CPU_REG32 *)0xE0001004uL))
+
 #if      OS_CFG_TS_EN == 1u
+#if     (OS_CPU_TS_DWT_EN > 0u)
+#define  OS_TS_GET()               (CPU_TS)OS_CPU_REG_DWT_CYCCNT
+#else
 #define  OS_TS_GET()               (CPU_TS)CPU_TS_TmrRd()   /* See Note #2a.                                          */
+#endif
 #else
 #define  OS_TS_GET()               (CPU_TS)0u
 #endif
 
 #if (CPU_CFG_TS_32_EN    > 0u) && \
-    (CPU_CFG_TS_TMR_SIZE < CPU_WORD_SIZE_32)
+    (CPU_CFG_TS_TMR_SIZE < CPU_WORD_SIZE_32) && \
+    (OS_CPU_TS_DWT_EN   == 0u)
                                                             /* CPU_CFG_TS_TMR_SIZE MUST be >= 32-bit (see Note #2b).  */
 #error  "cpu_cfg.h, CPU_CFG_TS_TMR_SIZE MUST be >= CPU_WORD_SIZE_32"
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                              TICK RATE
+*
+* Note(s) : (1) OSTickRateSet() reprograms the SysTick through OS_CPU_TICK_RATE_SET() (see os_cpu_c.c).
+*********************************************************************************************************
+*/
+
+#define  OS_CPU_TICK_RATE_SET(rate_hz_prev, rate_hz)    OS_CPU_SysTickRateSet((CPU_INT32U)(rate_hz_prev), (CPU_INT32U)(rate_hz))
+
+
 /*
 *********************************************************************************************************
 *                                          GLOBAL VARIABLES
@@ -150,13 +236,40 @@ void  OSCtxSw               (void);
 void  OSIntCtxSw            (void);
 void  OSStartHighRdy        (void);
 
+CPU_STK  *OS_CPU_PSP_Get      (void);
+
                                                   /* See OS_CPU_C.C                                    */
 void  OS_CPU_SysTickInit    (CPU_INT32U   cnts);
 void  OS_CPU_SysTickInitFreq(CPU_INT32U   cpu_freq);
+#if (OS_CFG_TICK_RATE_SET_EN > 0u)
+void  OS_CPU_SysTickRateSet (CPU_INT32U   rate_hz_prev,
+                             CPU_INT32U   rate_hz);
+#endif
 
 void  OS_CPU_SysTickHandler (void);
 void  OS_CPU_PendSVHandler  (void);
 
+#if (OS_CPU_MPU_STK_GUARD_EN > 0u)
+void  OS_CPU_MemManageHandler(void);
+#endif
+
+#if (OS_CFG_INT_KA_CHK_EN > 0u)
+CPU_BOOLEAN  OS_CPU_IntIsKA(void);
+#endif
+
+#if (OS_CFG_INT_THREAD_EN > 0u)
+void  OS_CPU_IntThreadHandler(void);
+#endif
+
+#if (OS_CFG_TASK_PERF_CTR_EN > 0u)
+CPU_BOOLEAN  OS_CPU_PerfCtrCfg(CPU_INT08U  ix,
+                               CPU_INT32U  event);
+#endif
+
+#if (OS_CPU_TS_DWT_EN > 0u)
+CPU_INT64U   OS_CPU_TS64Get   (void);
+#endif
+
 
 /*
 *********************************************************************************************************
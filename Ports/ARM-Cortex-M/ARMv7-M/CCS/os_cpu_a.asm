@@ -58,6 +58,7 @@ OS_KA_BASEPRI_BoundaryAddr:  .word  OS_KA_BASEPRI_Boundary
     .global  OSCtxSw
     .global  OSIntCtxSw
     .global  OS_CPU_PendSVHandler
+    .global  OS_CPU_PSP_Get
 
 
 ;********************************************************************************************************
@@ -272,4 +273,19 @@ OS_CPU_PendSVHandler:
     BX      LR                                                  ; Exception return will restore remaining context
     .endasmfunc
 
+
+;********************************************************************************************************
+;                                     GET THE PROCESS STACK POINTER
+;             CPU_STK  *OS_CPU_PSP_Get(void)
+;
+; Note(s) : 1) Returns PSP.  In an exception handler that interrupted a task, PSP points to the exception
+;              frame stacked on the task stack; the tick ISR reads the interrupted PC from it.
+;********************************************************************************************************
+
+    .asmfunc
+OS_CPU_PSP_Get:
+    MRS     R0, PSP                                             ; R0 = PSP
+    BX      LR
+    .endasmfunc
+
 .end
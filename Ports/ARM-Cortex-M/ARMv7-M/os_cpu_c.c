@@ -74,6 +74,146 @@ CPU_INT32U  OS_KA_BASEPRI_Boundary;                             /* Base Priority
 #define  CPU_REG_FPCCR_LAZY_STK                        0xC0000000uL
 
 
+/*
+*********************************************************************************************************
+*                                      LAZY FP CONTEXT SWITCH
+*********************************************************************************************************
+*/
+
+#if (OS_CPU_ARM_FP_EN > 0u) && (OS_CPU_ARM_FP_LAZY_EN > 0u)
+#define  CPU_REG_FP_FPCAR              (*((CPU_REG32 *)0xE000EF38uL))   /* Floating-Point Context Address Reg.         */
+
+#define  CPU_REG_FPCCR_LSPACT                          0x00000001uL     /* Lazy state preservation pending.            */
+
+#define  OS_CPU_EXC_RETURN_STD_FRAME                   0x00000010uL     /* EXC_RETURN bit 4: no FP context.            */
+
+#define  OS_CPU_FP_STK_EXC_RETURN_IX                   8u               /* Saved context: R4-R11, EXC_RETURN, ..       */
+#define  OS_CPU_FP_STK_REGS_IX                         9u               /* .. then room for s16-s31.                   */
+
+OS_TCB   *OS_CPU_FP_OwnerPtr;                                   /* Task whose s16-s31 are held by the FPU.              */
+CPU_STK  *OS_CPU_FP_SavePtr;                                    /* Where PendSV saves s16-s31, if needed.               */
+CPU_STK  *OS_CPU_FP_LoadPtr;                                    /* Where PendSV loads s16-s31 from, if needed.          */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        MPU STACK GUARD DEFINES
+*********************************************************************************************************
+*/
+
+#if (OS_CPU_MPU_STK_GUARD_EN > 0u)
+#define  OS_CPU_REG_SCB_SHCSR          (*((CPU_REG32 *)0xE000ED24uL))   /* System Handler Control and State Reg.       */
+#define  OS_CPU_REG_SCB_CFSR           (*((CPU_REG32 *)0xE000ED28uL))   /* Configurable Fault Status Reg.              */
+#define  OS_CPU_REG_SCB_MMFAR          (*((CPU_REG32 *)0xE000ED34uL))   /* MemManage Fault Address Reg.                */
+
+#define  OS_CPU_REG_MPU_TYPE           (*((CPU_REG32 *)0xE000ED90uL))   /* MPU Type Reg.                               */
+#define  OS_CPU_REG_MPU_CTRL           (*((CPU_REG32 *)0xE000ED94uL))   /* MPU Control Reg.                            */
+#define  OS_CPU_REG_MPU_RNR            (*((CPU_REG32 *)0xE000ED98uL))   /* MPU Region Number Reg.                      */
+#define  OS_CPU_REG_MPU_RBAR           (*((CPU_REG32 *)0xE000ED9CuL))   /* MPU Region Base Address Reg.                */
+#define  OS_CPU_REG_MPU_RASR           (*((CPU_REG32 *)0xE000EDA0uL))   /* MPU Region Attribute and Size Reg.          */
+
+#define  OS_CPU_SCB_SHCSR_MEMFAULTENA                  0x00010000uL
+#define  OS_CPU_SCB_CFSR_MMFSR_MSK                     0x000000FFuL
+#define  OS_CPU_SCB_CFSR_MSTKERR                       0x00000010uL
+#define  OS_CPU_SCB_CFSR_MMARVALID                     0x00000080uL
+
+#define  OS_CPU_MPU_TYPE_DREGION_MSK                   0x0000FF00uL
+#define  OS_CPU_MPU_CTRL_ENABLE                        0x00000001uL
+#define  OS_CPU_MPU_CTRL_PRIVDEFENA                    0x00000004uL
+#define  OS_CPU_MPU_RBAR_VALID                         0x00000010uL
+                                                                        /* No access, execute never, 32 bytes, enabled */
+#define  OS_CPU_MPU_RASR_GUARD                         0x10000009uL
+
+#define  OS_CPU_MPU_STK_GUARD_SIZE                     32u              /* Smallest ARMv7-M MPU region (in bytes).     */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  DATA WATCHPOINT AND TRACE DEFINES
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_PERF_CTR_EN > 0u) || (OS_CPU_TS_DWT_EN > 0u)
+#define  OS_CPU_REG_DEM_CR             (*((CPU_REG32 *)0xE000EDFCuL))   /* Debug Exception and Monitor Control Reg.    */
+#define  OS_CPU_REG_DWT_CTRL           (*((CPU_REG32 *)0xE0001000uL))   /* DWT Control Reg.                            */
+
+#define  OS_CPU_DEM_CR_TRCENA                          0x01000000uL
+#endif
+
+#if (OS_CFG_TASK_PERF_CTR_EN > 0u)
+#define  OS_CPU_REG_DWT_CNT_BASE         ((CPU_REG32 *)0xE0001008uL)    /* DWT CPI, EXC, SLEEP, LSU & FOLD Count Regs. */
+
+#define  OS_CPU_DWT_CTRL_NOPRFCNT                      0x01000000uL     /* No profiling counters implemented.          */
+#define  OS_CPU_DWT_CTRL_CPIEVTENA                     0x00020000uL     /* .. EXC, SLEEP, LSU & FOLD follow in order.  */
+
+#define  OS_CPU_DWT_CNT_MSK                            0x000000FFuL     /* The event counters are 8 bits wide.         */
+#endif
+
+#if (OS_CPU_TS_DWT_EN > 0u)
+#define  OS_CPU_DWT_CTRL_NOCYCCNT                      0x02000000uL     /* No cycle counter implemented.               */
+#define  OS_CPU_DWT_CTRL_CYCCNTENA                     0x00000001uL
+
+static  CPU_INT32U  OS_CPU_TS_Hi;                               /* Nbr of CYCCNT wraps.                                 */
+static  CPU_INT32U  OS_CPU_TS_LoPrev;                           /* CYCCNT at the last OS_CPU_TS64Get().                 */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      INTERRUPT CONTROL DEFINES
+*********************************************************************************************************
+*/
+
+#define  OS_CPU_REG_SCB_ICSR           (*((CPU_REG32 *)0xE000ED04uL))   /* Interrupt Control and State Reg.            */
+#define  OS_CPU_REG_SCB_SHPR_BASE        ((CPU_REG08 *)0xE000ED18uL)    /* System Handler Priority Reg. (exception 4)  */
+#define  OS_CPU_REG_NVIC_IPR_BASE        ((CPU_REG08 *)0xE000E400uL)    /* Interrupt Priority Reg. (exception 16)      */
+
+#define  OS_CPU_SCB_ICSR_VECTACTIVE_MSK                0x000001FFuL     /* Nbr of the exception being serviced.        */
+#define  OS_CPU_SCB_ICSR_RETTOBASE                     0x00000800uL     /* No other exception is active.               */
+
+
+/*
+*********************************************************************************************************
+*                                         DYNAMIC TICK DEFINES
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u) || (OS_CFG_TICK_RATE_SET_EN > 0u)
+#define  OS_CPU_REG_SYST_CVR           (*((CPU_REG32 *)0xE000E018uL))   /* SysTick Current Value Reg.                  */
+#define  OS_CPU_SYST_RVR_MAX                           0x00FFFFFFuL     /* SysTick is a 24-bit down counter.           */
+#endif
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+#define  OS_CPU_SCB_ICSR_PENDSTSET                     0x04000000uL
+#define  OS_CPU_SCB_ICSR_PENDSTCLR                     0x02000000uL
+
+
+/*
+*********************************************************************************************************
+*                                        DYNAMIC TICK VARIABLES
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  OS_CPU_DynTickCnts;                         /* Nbr of SysTick counts per OS tick.                   */
+static  CPU_INT32U  OS_CPU_DynTickPhase;                        /* Cnts from the last tick boundary to the period start */
+static  OS_TICK     OS_CPU_DynTickDelta;                        /* Nbr of ticks programmed for the current period.      */
+
+
+/*
+*********************************************************************************************************
+*                                      DYNAMIC TICK LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  OS_CPU_DynTickCntsGet (void);
+
+static  OS_TICK     OS_CPU_DynTickArm     (OS_TICK     ticks,
+                                           CPU_INT32U  phase);
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                           IDLE TASK HOOK
@@ -83,7 +223,10 @@ CPU_INT32U  OS_KA_BASEPRI_Boundary;                             /* Base Priority
 *
 * Arguments  : None.
 *
-* Note(s)    : None.
+* Note(s)    : 1) With OS_CPU_IDLE_WFI_EN, the core sleeps (WFI) until the next interrupt.  In Dynamic Tick
+*                 Mode that is either a device interrupt or the tick programmed for the next timeout, so
+*                 an idle system is not woken up on every tick.  SysTick stops in deep sleep modes; those
+*                 need a low-power timer driven by the BSP (see Template/bsp_os_dt.c).
 *********************************************************************************************************
 */
 
@@ -94,6 +237,9 @@ void  OSIdleTaskHook (void)
         (*OS_AppIdleTaskHookPtr)();
     }
 #endif
+#if (OS_CPU_IDLE_WFI_EN > 0u)
+    CPU_WaitForInt();                                           /* See Note #1.                                         */
+#endif
 }
 
 
@@ -108,6 +254,13 @@ void  OSIdleTaskHook (void)
 * Note(s)    : 1) When using hardware floating point please do the following during the reset handler:
 *                 a) Set full access for CP10 & CP11 bits in CPACR register.
 *                 b) Set bits ASPEN and LSPEN in FPCCR register.
+*
+*              2) When OS_CPU_MPU_STK_GUARD_EN is enabled, the processor MUST implement an MPU.  The
+*                 MPU is enabled with the default memory map as background region for privileged
+*                 accesses, so only the stack guard region restricts accesses.
+*
+*              3) When OS_CPU_TS_DWT_EN is enabled, the DWT MUST implement the cycle counter.  It is
+*                 started from 0 and OS_TS_GET() reads it from then on (see os_cpu.h).
 *********************************************************************************************************
 */
 
@@ -130,6 +283,32 @@ void  OSInitHook (void)
 #endif
                                                                 /* Set BASEPRI boundary from the configuration.         */
     OS_KA_BASEPRI_Boundary = (CPU_INT32U)(CPU_CFG_KA_IPL_BOUNDARY << (8u - CPU_CFG_NVIC_PRIO_BITS));
+
+#if (OS_CPU_MPU_STK_GUARD_EN > 0u)
+    if ((OS_CPU_REG_MPU_TYPE & OS_CPU_MPU_TYPE_DREGION_MSK) == 0u) {
+        while (1u) {                                            /* See Note (2).                                        */
+            ;
+        }
+    }
+    OS_CPU_REG_MPU_RNR    = OS_CPU_MPU_STK_GUARD_RGN;           /* Guard region stays disabled until the first switch   */
+    OS_CPU_REG_MPU_RASR   = 0u;
+    OS_CPU_REG_SCB_SHCSR |= OS_CPU_SCB_SHCSR_MEMFAULTENA;       /* Report guard hits as MemManage faults                */
+    OS_CPU_REG_MPU_CTRL  |= OS_CPU_MPU_CTRL_ENABLE |            /* Keep the default memory map for privileged code      */
+                            OS_CPU_MPU_CTRL_PRIVDEFENA;
+#endif
+
+#if (OS_CPU_TS_DWT_EN > 0u)
+    OS_CPU_REG_DEM_CR    |= OS_CPU_DEM_CR_TRCENA;               /* The DWT only counts with the trace enabled           */
+    if ((OS_CPU_REG_DWT_CTRL & OS_CPU_DWT_CTRL_NOCYCCNT) != 0u) {
+        while (1u) {                                            /* See Note (3).                                        */
+            ;
+        }
+    }
+    OS_CPU_TS_Hi          = 0u;
+    OS_CPU_TS_LoPrev      = 0u;
+    OS_CPU_REG_DWT_CYCCNT = 0u;
+    OS_CPU_REG_DWT_CTRL  |= OS_CPU_DWT_CTRL_CYCCNTENA;
+#endif
 }
 
 
@@ -216,17 +395,34 @@ void  OSTaskCreateHook (OS_TCB  *p_tcb)
 *
 * Arguments  : p_tcb        Pointer to the task control block of the task being deleted.
 *
-* Note(s)    : None.
+* Note(s)    : 1) With OS_CPU_ARM_FP_LAZY_EN, a deleted task can't keep the ownership of the FP registers:
+*                 its stack would receive them when the next FP task is switched in.  The same goes for
+*                 a lazy FP state preservation still pending on its stack.
 *********************************************************************************************************
 */
 
 void  OSTaskDelHook (OS_TCB  *p_tcb)
 {
+#if (OS_CPU_ARM_FP_EN > 0u) && (OS_CPU_ARM_FP_LAZY_EN > 0u)
+    CPU_INT32U  stk_base;
+
+
+    if (p_tcb == OS_CPU_FP_OwnerPtr) {                          /* See Note #1.                                         */
+        OS_CPU_FP_OwnerPtr = (OS_TCB *)0;
+        stk_base           = (CPU_INT32U)p_tcb->StkBasePtr;
+        if (((CPU_REG_FP_FPCCR & CPU_REG_FPCCR_LSPACT) != 0u) &&
+             (CPU_REG_FP_FPCAR >= stk_base) &&
+             (CPU_REG_FP_FPCAR <  stk_base + (p_tcb->StkSize * sizeof(CPU_STK)))) {
+            CPU_REG_FP_FPCCR &= ~CPU_REG_FPCCR_LSPACT;
+        }
+    }
+#endif
+
 #if OS_CFG_APP_HOOKS_EN > 0u
     if (OS_AppTaskDelHookPtr != (OS_APP_HOOK_TCB)0) {
         (*OS_AppTaskDelHookPtr)(p_tcb);
     }
-#else
+#elif (OS_CPU_ARM_FP_EN == 0u) || (OS_CPU_ARM_FP_LAZY_EN == 0u)
     (void)p_tcb;                                                /* Prevent compiler warning                             */
 #endif
 }
@@ -487,6 +683,19 @@ CPU_STK  *OSTaskStkInit (OS_TASK_PTR    p_task,
 *              2) It is assumed that the global pointer 'OSTCBHighRdyPtr' points to the TCB of the task
 *                 that will be 'switched in' (i.e. the highest priority task) and, 'OSTCBCurPtr' points
 *                 to the task being switched out (i.e. the preempted task).
+*              3) When OS_CPU_MPU_STK_GUARD_EN is enabled, the stack guard is a 32-byte MPU region that
+*                 must fit, aligned on its size, inside the task's redzone.  Either align task stacks on
+*                 32 bytes or use an OS_CFG_TASK_STK_REDZONE_DEPTH of at least 16 entries, otherwise the
+*                 task runs unguarded.  The MPU update takes effect on the exception return that ends
+*                 the context switch.
+*              4) When OS_CPU_ARM_FP_LAZY_EN is enabled, the FP registers are handed over to the task being
+*                 switched in only if it was created with OS_OPT_TASK_SAVE_FP or already has an FP context
+*                 and it doesn't own them yet.  The s16-s31 of the previous owner are then saved in the
+*                 room reserved for them on its stack and those of the new owner are loaded from its own
+*                 stack, if it has an FP context.  PendSV performs both transfers (see os_cpu_a.S).
+*              5) When OS_CFG_TASK_PERF_CTR_EN is enabled, the events counted by the DWT since the task was
+*                 switched in are added to its '.PerfCtrTotal[]', modulo 256 (see os_cpu.h).  Counters
+*                 that were not started with OS_CPU_PerfCtrCfg() don't move and add nothing.
 *********************************************************************************************************
 */
 
@@ -498,9 +707,20 @@ void  OSTaskSwHook (void)
 #ifdef  CPU_CFG_INT_DIS_MEAS_EN
     CPU_TS  int_dis_time;
 #endif
-#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+#if (OS_CPU_MPU_STK_GUARD_EN > 0u)
+    CPU_INT32U   guard_base;
+    CPU_INT32U   guard_end;
+#elif (OS_CFG_TASK_STK_REDZONE_EN > 0u)
     CPU_BOOLEAN  stk_status;
 #endif
+#if (OS_CPU_ARM_FP_EN > 0u) && (OS_CPU_ARM_FP_LAZY_EN > 0u)
+    OS_TCB      *p_owner;
+    OS_TCB      *p_next;
+#endif
+#if (OS_CFG_TASK_PERF_CTR_EN > 0u)
+    CPU_INT08U   ix;
+    CPU_INT32U   ctr;
+#endif
 
 #if OS_CFG_APP_HOOKS_EN > 0u
     if (OS_AppTaskSwHookPtr != (OS_APP_HOOK_VOID)0) {
@@ -520,6 +740,16 @@ void  OSTaskSwHook (void)
     OSTCBHighRdyPtr->CyclesStart = ts;
 #endif
 
+#if (OS_CFG_TASK_PERF_CTR_EN > 0u)
+    for (ix = 0u; ix < OS_CPU_PERF_CTR_NBR; ix++) {             /* See Note #5.                                         */
+        ctr = OS_CPU_REG_DWT_CNT_BASE[ix];
+        if (OSTCBCurPtr != OSTCBHighRdyPtr) {
+            OSTCBCurPtr->PerfCtrTotal[ix] += (ctr - OSTCBCurPtr->PerfCtrStart[ix]) & OS_CPU_DWT_CNT_MSK;
+        }
+        OSTCBHighRdyPtr->PerfCtrStart[ix] = ctr;
+    }
+#endif
+
 #ifdef  CPU_CFG_INT_DIS_MEAS_EN
     int_dis_time = CPU_IntDisMeasMaxCurReset();                 /* Keep track of per-task interrupt disable time        */
     if (OSTCBCurPtr->IntDisTimeMax < int_dis_time) {
@@ -535,13 +765,45 @@ void  OSTaskSwHook (void)
     OSSchedLockTimeMaxCur = (CPU_TS)0;                          /* Reset the per-task value                             */
 #endif
 
-#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+#if (OS_CPU_MPU_STK_GUARD_EN > 0u)
+                                                                /* Move the guard over the new task's redzone.          */
+    guard_base = ((CPU_INT32U)OSTCBHighRdyPtr->StkBasePtr + (OS_CPU_MPU_STK_GUARD_SIZE - 1u))
+               & ~(CPU_INT32U)(OS_CPU_MPU_STK_GUARD_SIZE - 1u);
+    guard_end  =  (CPU_INT32U)(OSTCBHighRdyPtr->StkBasePtr + OS_CFG_TASK_STK_REDZONE_DEPTH);
+    OS_CPU_REG_MPU_RNR = OS_CPU_MPU_STK_GUARD_RGN;
+    if ((guard_base + OS_CPU_MPU_STK_GUARD_SIZE) <= guard_end) {
+        OS_CPU_REG_MPU_RBAR = guard_base;
+        OS_CPU_REG_MPU_RASR = OS_CPU_MPU_RASR_GUARD;
+    } else {
+        OS_CPU_REG_MPU_RASR = 0u;                               /* Redzone can't hold an aligned region, see Note #3    */
+    }
+#elif (OS_CFG_TASK_STK_REDZONE_EN > 0u)
                                                                 /* Check if stack overflowed.                           */
     stk_status = OSTaskStkRedzoneChk((OS_TCB *)0u);
     if (stk_status != OS_TRUE) {
         OSRedzoneHitHook(OSTCBCurPtr);
     }
 #endif
+
+#if (OS_CPU_ARM_FP_EN > 0u) && (OS_CPU_ARM_FP_LAZY_EN > 0u)
+    OS_CPU_FP_SavePtr = (CPU_STK *)0;                           /* Hand the FP registers over, see Note #4.             */
+    OS_CPU_FP_LoadPtr = (CPU_STK *)0;
+    p_owner           = OS_CPU_FP_OwnerPtr;
+    p_next            = OSTCBHighRdyPtr;
+    if (p_next != p_owner) {
+        if ((p_next->StkPtr[OS_CPU_FP_STK_EXC_RETURN_IX] & OS_CPU_EXC_RETURN_STD_FRAME) == 0u) {
+            OS_CPU_FP_LoadPtr = &p_next->StkPtr[OS_CPU_FP_STK_REGS_IX];
+        }
+        if ((OS_CPU_FP_LoadPtr != (CPU_STK *)0) ||
+            ((p_next->Opt & OS_OPT_TASK_SAVE_FP) != 0u)) {
+            if ((p_owner != (OS_TCB *)0) &&                     /* Only an FP context has room for s16-s31              */
+                ((p_owner->StkPtr[OS_CPU_FP_STK_EXC_RETURN_IX] & OS_CPU_EXC_RETURN_STD_FRAME) == 0u)) {
+                OS_CPU_FP_SavePtr = &p_owner->StkPtr[OS_CPU_FP_STK_REGS_IX];
+            }
+            OS_CPU_FP_OwnerPtr = p_next;
+        }
+    }
+#endif
 }
 
 
@@ -554,6 +816,9 @@ void  OSTaskSwHook (void)
 * Arguments  : None.
 *
 * Note(s)    : 1) This function is assumed to be called from the Tick ISR.
+*
+*              2) With OS_CPU_TS_DWT_EN, the 64-bit timestamp is read on every tick so that each wrap of
+*                 the cycle counter is seen.
 *********************************************************************************************************
 */
 
@@ -564,6 +829,9 @@ void  OSTimeTickHook (void)
         (*OS_AppTimeTickHookPtr)();
     }
 #endif
+#if (OS_CPU_TS_DWT_EN > 0u)
+    (void)OS_CPU_TS64Get();                                     /* See Note #2.                                         */
+#endif
 }
 
 
@@ -577,24 +845,269 @@ void  OSTimeTickHook (void)
 * Arguments  : None.
 *
 * Note(s)    : 1) This function MUST be placed on entry 15 of the Cortex-M vector table.
+*
+*              2) In Dynamic Tick Mode, the interrupt marks the end of the period programmed by
+*                 OS_DynTickSet(), which falls on a tick boundary.
+*
+*              3) When the tick interrupted a task, the interrupted PC is word 6 of the exception frame
+*                 stacked on the task stack (R0-R3, R12, LR, PC, xPSR).  When it interrupted another
+*                 exception, the frame is on the main stack and the sample is recorded without a PC.
 *********************************************************************************************************
 */
 
 void  OS_CPU_SysTickHandler  (void)
 {
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    OS_TICK   ticks;
+#endif
+#if (OS_CFG_PROF_SAMPLE_EN > 0u)
+    CPU_ADDR  pc;
+#endif
     CPU_SR_ALLOC();
 
 
     CPU_CRITICAL_ENTER();
     OSIntEnter();                                               /* Tell uC/OS-III that we are starting an ISR           */
+#if (OS_CFG_PROF_SAMPLE_EN > 0u)
+    if ((OS_CPU_REG_SCB_ICSR & OS_CPU_SCB_ICSR_RETTOBASE) != 0u) {
+        pc = (CPU_ADDR)OS_CPU_PSP_Get()[6];                     /* See Note #3.                                         */
+    } else {
+        pc = (CPU_ADDR)0;
+    }
+    OS_ProfSample(pc);
+#endif
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    ticks               = OS_CPU_DynTickDelta;                  /* See Note #2.                                         */
+    OS_CPU_DynTickPhase = 0u;
+#endif
     CPU_CRITICAL_EXIT();
 
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    OSTimeDynTick(ticks);                                       /* The kernel programs the next period                  */
+#else
     OSTimeTick();                                               /* Call uC/OS-III's OSTimeTick()                        */
+#endif
 
     OSIntExit();                                                /* Tell uC/OS-III that we are leaving the ISR           */
 }
 
 
+/*
+*********************************************************************************************************
+*                                       MEMORY MANAGEMENT FAULT HANDLER
+*
+* Description: Handle the MemManage fault raised when a task accesses its stack guard region.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) This function MUST be placed on entry 4 of the Cortex-M vector table.
+*
+*              2) A task that hit its stack guard can't be resumed: the fault is reported through
+*                 OSRedzoneHitHook() and, if the hook returns, a software exception is raised.
+*
+*              3) A stacking error (MSTKERR) means the processor could not push the exception frame on
+*                 the task stack, which, with the guard placed below the stack, means it overflowed.
+*********************************************************************************************************
+*/
+
+#if (OS_CPU_MPU_STK_GUARD_EN > 0u)
+void  OS_CPU_MemManageHandler (void)
+{
+    CPU_INT32U   mmfsr;
+    CPU_INT32U   addr;
+    CPU_INT32U   stk_base;
+    OS_TCB      *p_tcb;
+
+
+    mmfsr    = OS_CPU_REG_SCB_CFSR & OS_CPU_SCB_CFSR_MMFSR_MSK;
+    addr     = OS_CPU_REG_SCB_MMFAR;
+    p_tcb    = OSTCBCurPtr;
+    stk_base = (CPU_INT32U)p_tcb->StkBasePtr;
+
+    if (((mmfsr & OS_CPU_SCB_CFSR_MSTKERR) != 0u) ||            /* See Note #3.                                         */
+       (((mmfsr & OS_CPU_SCB_CFSR_MMARVALID) != 0u) &&
+         (addr >= stk_base) &&
+         (addr <  stk_base + (OS_CFG_TASK_STK_REDZONE_DEPTH * sizeof(CPU_STK))))) {
+        OS_CPU_REG_SCB_CFSR = mmfsr;                            /* Clear the MemManage fault status bits                */
+        OSRedzoneHitHook(p_tcb);
+    }
+
+    CPU_SW_EXCEPTION(;);                                        /* See Note #2.                                         */
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                   IS THE CURRENT CONTEXT KERNEL AWARE?
+*
+* Description: Determine whether the exception being serviced is allowed to call uC/OS-III services.
+*
+* Arguments  : None.
+*
+* Returns    : OS_TRUE   if the processor is in Thread mode or services an exception whose priority is at
+*                        or below the kernel aware boundary (CPU_CFG_KA_IPL_BOUNDARY).
+*
+*              OS_FALSE  if the exception is a zero-latency one, i.e. it is never masked by the kernel.
+*
+* Note(s)    : 1) Reset, NMI and HardFault have fixed negative priorities and are never kernel aware.
+*
+*              2) A numerically lower value is a higher priority; the kernel masks every priority that
+*                 is numerically greater than or equal to OS_KA_BASEPRI_Boundary.
+*
+*              3) This function is called by OSIntEnter() when OS_CFG_INT_KA_CHK_EN is set to 1.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_INT_KA_CHK_EN > 0u)
+CPU_BOOLEAN  OS_CPU_IntIsKA (void)
+{
+    CPU_INT32U  exc;
+    CPU_INT32U  prio;
+
+
+    exc = OS_CPU_REG_SCB_ICSR & OS_CPU_SCB_ICSR_VECTACTIVE_MSK;
+    if (exc == 0u) {                                            /* Thread mode                                          */
+        return (OS_TRUE);
+    }
+    if (exc < 4u) {                                             /* See Note #1.                                         */
+        return (OS_FALSE);
+    }
+
+    if (exc < 16u) {                                            /* System handler (MemManage .. SysTick)                */
+        prio = OS_CPU_REG_SCB_SHPR_BASE[exc - 4u];
+    } else {                                                    /* External interrupt                                   */
+        prio = OS_CPU_REG_NVIC_IPR_BASE[exc - 16u];
+    }
+
+    if (prio < OS_KA_BASEPRI_Boundary) {                        /* See Note #2.                                         */
+        return (OS_FALSE);
+    }
+    return (OS_TRUE);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     THREADED INTERRUPT HANDLER
+*
+* Description: Handle an external interrupt that has a handler task attached by OSIntThreadRegister().
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) This function can be placed on the vector table entry of any kernel aware external
+*                 interrupt.  The interrupt number is read from ICSR, external interrupt 0 being
+*                 exception 16.
+*
+*              2) OSIntThreadISR() calls OSIntEnter() and OSIntExit() itself.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_INT_THREAD_EN > 0u)
+void  OS_CPU_IntThreadHandler (void)
+{
+    CPU_INT32U  exc;
+
+
+    exc = OS_CPU_REG_SCB_ICSR & OS_CPU_SCB_ICSR_VECTACTIVE_MSK;
+    if (exc >= 16u) {                                           /* See Note #1.                                         */
+        OSIntThreadISR((CPU_INT16U)(exc - 16u));
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         GET 64-BIT TIMESTAMP
+*
+* Description: Read the DWT cycle counter, extended to 64 bits with the number of times it wrapped.
+*
+* Arguments  : None.
+*
+* Returns    : The number of CPU cycles since OSInitHook().
+*
+* Note(s)    : 1) A wrap is detected when the counter reads lower than at the previous call, so this
+*                 function MUST be called at least once every 2^32 cycles (see OSTimeTickHook()).
+*
+*              2) This function MUST NOT be called from zero-latency interrupts.
+*********************************************************************************************************
+*/
+
+#if (OS_CPU_TS_DWT_EN > 0u)
+CPU_INT64U  OS_CPU_TS64Get (void)
+{
+    CPU_INT32U  lo;
+    CPU_INT64U  ts;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    lo = OS_CPU_REG_DWT_CYCCNT;
+    if (lo < OS_CPU_TS_LoPrev) {                                /* See Note #1.                                         */
+        OS_CPU_TS_Hi++;
+    }
+    OS_CPU_TS_LoPrev = lo;
+    ts = ((CPU_INT64U)OS_CPU_TS_Hi << 32u) | (CPU_INT64U)lo;
+    CPU_CRITICAL_EXIT();
+
+    return (ts);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                   CONFIGURE A PERFORMANCE COUNTER
+*
+* Description: Start or stop one of the DWT event counters credited to the tasks by OSTaskSwHook().
+*
+* Arguments  : ix           Counter to configure (see OS_CPU_PERF_CTR_xxx in os_cpu.h).
+*
+*              event        Non-zero to start the counter, 0 to stop it.  The DWT counters count fixed
+*                           events, there is nothing else to select.
+*
+* Returns    : OS_TRUE      if the counter is configured.
+*
+*              OS_FALSE     if 'ix' is out of range or the DWT doesn't implement the profiling counters.
+*
+* Note(s)    : 1) The trace subsystem is enabled (DEMCR.TRCENA) if it isn't already, as it is needed for
+*                 the DWT to count.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_PERF_CTR_EN > 0u)
+CPU_BOOLEAN  OS_CPU_PerfCtrCfg (CPU_INT08U  ix,
+                                CPU_INT32U  event)
+{
+    CPU_INT32U  bit;
+    CPU_SR_ALLOC();
+
+
+    if (ix >= OS_CPU_PERF_CTR_NBR) {
+        return (OS_FALSE);
+    }
+
+    CPU_CRITICAL_ENTER();
+    OS_CPU_REG_DEM_CR |= OS_CPU_DEM_CR_TRCENA;                  /* See Note #1.                                         */
+    if ((OS_CPU_REG_DWT_CTRL & OS_CPU_DWT_CTRL_NOPRFCNT) != 0u) {
+        CPU_CRITICAL_EXIT();
+        return (OS_FALSE);
+    }
+    bit = OS_CPU_DWT_CTRL_CPIEVTENA << ix;
+    if (event != 0u) {
+        OS_CPU_REG_DWT_CTRL |=  bit;
+    } else {
+        OS_CPU_REG_DWT_CTRL &= ~bit;
+    }
+    CPU_CRITICAL_EXIT();
+
+    return (OS_TRUE);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                         INITIALIZE SYS TICK
@@ -615,7 +1128,7 @@ void  OS_CPU_SysTickInitFreq (CPU_INT32U  cpu_freq)
     CPU_INT32U  cnts;
 
 
-    cnts = (cpu_freq / (CPU_INT32U)OSCfg_TickRate_Hz);          /* Determine nbr SysTick cnts between two OS tick intr. */
+    cnts = (cpu_freq / (CPU_INT32U)OS_TICK_RATE_HZ);            /* Determine nbr SysTick cnts between two OS tick intr. */
 
     OS_CPU_SysTickInit(cnts);
 #else
@@ -635,6 +1148,9 @@ void  OS_CPU_SysTickInitFreq (CPU_INT32U  cpu_freq)
 * Note(s)    : 1) This function MUST be called after OSStart() & after processor initialization.
 *
 *              2) Either OS_CPU_SysTickInitFreq or OS_CPU_SysTickInit() can be called.
+*
+*              3) In Dynamic Tick Mode, 'cnts' is the number of SysTick counts per OS tick and the first
+*                 period is programmed from the tick step the kernel already requested (OSTickCtrStep).
 *********************************************************************************************************
 */
 
@@ -643,11 +1159,21 @@ void  OS_CPU_SysTickInit (CPU_INT32U  cnts)
 #if (OS_CFG_TICK_EN > 0u)
     CPU_INT32U  prio;
     CPU_INT32U  basepri;
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    CPU_SR_ALLOC();
+#endif
 
 
                                                                 /* Set BASEPRI boundary from the configuration.         */
     basepri             = (CPU_INT32U)(CPU_CFG_KA_IPL_BOUNDARY << (8u - CPU_CFG_NVIC_PRIO_BITS));
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    CPU_CRITICAL_ENTER();
+    OS_CPU_DynTickCnts  = cnts;                                 /* See Note #3.                                         */
+    (void)OS_CPU_DynTickArm(OSTickCtrStep, 0u);
+    CPU_CRITICAL_EXIT();
+#else
     CPU_REG_SYST_RVR    = cnts - 1u;                            /* Set Reload Register                                  */
+#endif
 
                                                                 /* Set SysTick handler prio.                            */
     prio                = CPU_REG_SCB_SHPRI3;
@@ -666,6 +1192,208 @@ void  OS_CPU_SysTickInit (CPU_INT32U  cnts)
 #endif
 }
 
+
+/*
+*********************************************************************************************************
+*                                        CHANGE SYS TICK RATE
+*
+* Description: Reprogram the SysTick for a new OS tick rate.  Called by OSTickRateSet() through
+*              OS_CPU_TICK_RATE_SET() with interrupts disabled.
+*
+* Arguments  : rate_hz_prev   OS tick rate the SysTick is currently programmed for.
+*
+*              rate_hz        New OS tick rate.
+*
+* Note(s)    : 1) The SysTick clock is derived from the current reload value, so the CPU frequency doesn't
+*                 have to be known here.  The reload value is clamped to the 24-bit range of the SysTick.
+*
+*              2) The current count is cleared so the first period at the new rate is a full one.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_TICK_RATE_SET_EN > 0u)
+void  OS_CPU_SysTickRateSet (CPU_INT32U  rate_hz_prev,
+                             CPU_INT32U  rate_hz)
+{
+    CPU_INT64U  cnts;
+
+
+    cnts = (((CPU_INT64U)CPU_REG_SYST_RVR + 1u) * rate_hz_prev) / rate_hz;
+    if (cnts > ((CPU_INT64U)OS_CPU_SYST_RVR_MAX + 1u)) {        /* See Note #1.                                         */
+        cnts = (CPU_INT64U)OS_CPU_SYST_RVR_MAX + 1u;
+    }
+    if (cnts < 2u) {
+        cnts = 2u;
+    }
+
+    CPU_REG_SYST_RVR    = (CPU_INT32U)(cnts - 1u);              /* Set Reload Register                                  */
+    OS_CPU_REG_SYST_CVR = 0u;                                   /* See Note #2.                                         */
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          GET DYNAMIC TICK
+*
+* Description: Return the number of OS ticks that elapsed since the kernel last programmed the tick.
+*
+* Arguments  : None.
+*
+* Returns    : The number of elapsed ticks, between 0 and the number of ticks programmed, inclusive.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and is called with kernel-aware interrupts
+*                 disabled.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+OS_TICK  OS_DynTickGet (void)
+{
+    CPU_INT32U  ticks;
+
+
+    if (OS_CPU_DynTickCnts == 0u) {                             /* SysTick not initialized yet.                         */
+        return (0u);
+    }
+
+    ticks = OS_CPU_DynTickCntsGet() / OS_CPU_DynTickCnts;
+    if (ticks > OS_CPU_DynTickDelta) {
+        ticks = OS_CPU_DynTickDelta;
+    }
+
+    return ((OS_TICK)ticks);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SET DYNAMIC TICK
+*
+* Description: Program the SysTick to interrupt once the given number of OS ticks have elapsed.
+*
+* Arguments  : ticks        Number of ticks to the next tick interrupt, 0 for an indefinite delay.
+*
+* Returns    : The number of ticks that will actually elapse before the next tick interrupt.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and is called with kernel-aware interrupts
+*                 disabled, after the ticks returned by OS_DynTickGet() were added to OSTickCtr.
+*
+*              2) The new period is measured from the last tick boundary, not from the time of the
+*                 call.  The counts of the partial tick in progress are carried over, so reprogramming
+*                 the SysTick, however often, does not make OSTickCtr drift.
+*
+*              3) SysTick is a 24-bit counter.  A longer delay, or an indefinite one, is cut to the
+*                 longest period it can count and the kernel programs the rest on the next interrupt.
+*
+*              4) Until OS_CPU_SysTickInit() is called there is nothing to program.  The pending step
+*                 (OSTickCtrStep) is programmed by OS_CPU_SysTickInit() itself.
+*********************************************************************************************************
+*/
+
+OS_TICK  OS_DynTickSet (OS_TICK  ticks)
+{
+    CPU_INT32U  phase;
+
+
+    if (OS_CPU_DynTickCnts == 0u) {                             /* See Note #4.                                         */
+        return (ticks);
+    }
+
+    phase = OS_CPU_DynTickCntsGet() % OS_CPU_DynTickCnts;       /* See Note #2.                                         */
+
+    return (OS_CPU_DynTickArm(ticks, phase));
+}
+
+
+/*
+*********************************************************************************************************
+*                                     DYNAMIC TICK ELAPSED COUNTS
+*
+* Description: Return the number of SysTick counts since the tick boundary the current period is
+*              measured from.
+*
+* Arguments  : None.
+*
+* Returns    : The number of elapsed SysTick counts.
+*
+* Note(s)    : 1) If the period expired while interrupts were disabled, the SysTick interrupt is still
+*                 pending: the whole period is added to the counts read after the expiry.
+*
+*              2) The counter reads 0 right after it is restarted and when it expires.  It is reloaded
+*                 on the following count.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  OS_CPU_DynTickCntsGet (void)
+{
+    CPU_INT32U  reload;
+    CPU_INT32U  cur;
+    CPU_INT32U  cnts;
+
+
+    reload = CPU_REG_SYST_RVR;
+    cur    = OS_CPU_REG_SYST_CVR;
+    cnts   = 0u;
+    if ((OS_CPU_REG_SCB_ICSR & OS_CPU_SCB_ICSR_PENDSTSET) != 0u) {
+        cur  = OS_CPU_REG_SYST_CVR;                             /* See Note #1.                                         */
+        cnts = reload + 1u;
+    }
+    if (cur != 0u) {                                            /* See Note #2.                                         */
+        cnts += (reload + 1u) - cur;
+    }
+
+    return (OS_CPU_DynTickPhase + cnts);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          ARM DYNAMIC TICK
+*
+* Description: Start a new SysTick period ending 'ticks' OS ticks after the last tick boundary.
+*
+* Arguments  : ticks        Number of ticks in the period, 0 for the longest period.
+*
+*              phase        Number of SysTick counts already elapsed since the last tick boundary.
+*
+* Returns    : The number of ticks programmed.
+*
+* Note(s)    : 1) A SysTick interrupt pending for the previous period is cleared: the kernel already
+*                 accounted for it through OS_DynTickGet().
+*********************************************************************************************************
+*/
+
+static  OS_TICK  OS_CPU_DynTickArm (OS_TICK     ticks,
+                                    CPU_INT32U  phase)
+{
+    OS_TICK     ticks_max;
+    CPU_INT32U  cnts;
+
+
+    ticks_max = (OS_TICK)(OS_CPU_SYST_RVR_MAX / OS_CPU_DynTickCnts);
+    if ((ticks == 0u) ||                                        /* Indefinite delay, or ...                             */
+        (ticks >  ticks_max)) {                                 /* ... longer than SysTick can count.                   */
+        ticks = ticks_max;
+    }
+
+    cnts = ((CPU_INT32U)ticks * OS_CPU_DynTickCnts) - phase;
+    if (cnts < 2u) {                                            /* The reload value must be at least 1.                 */
+        ticks++;
+        cnts += OS_CPU_DynTickCnts;
+    }
+
+    OS_CPU_DynTickPhase = phase;
+    OS_CPU_DynTickDelta = ticks;
+
+    CPU_REG_SYST_RVR    = cnts - 1u;                            /* Set the new period ...                               */
+    OS_CPU_REG_SYST_CVR = 0u;                                   /* ... and restart the count from it.                   */
+    OS_CPU_REG_SCB_ICSR = OS_CPU_SCB_ICSR_PENDSTCLR;            /* See Note #1.                                         */
+
+    return (ticks);
+}
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,1474 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                             ARMv8-M Port
+*
+* File    : os_cpu_c.c
+* Version : V3.08.00
+*********************************************************************************************************
+* For     : ARMv8-M Mainline Cortex-M
+* Mode    : Thumb-2 ISA
+*********************************************************************************************************
+* Note(s) : (1) This port supports the ARM Cortex-M33, Cortex-M35P, Cortex-M55 and Cortex-M85
+*               architectures, with or without FPU, MVE (Helium) and TrustZone.
+*********************************************************************************************************
+*/
+
+#define   OS_CPU_GLOBALS
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_cpu_c__c = "$Id: $";
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                             INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "../../../Source/os.h"
+
+
+#ifdef __cplusplus
+extern  "C" {
+#endif
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+CPU_INT32U  OS_KA_BASEPRI_Boundary;                             /* Base Priority boundary.                              */
+
+
+/*
+*********************************************************************************************************
+*                                         FLOATING POINT DEFINES
+*********************************************************************************************************
+*/
+
+#define  CPU_REG_FP_FPCCR              (*((CPU_REG32 *)0xE000EF34uL))   /* Floating-Point Context Control Reg.         */
+
+                                                                        /* Enabled FP lazy stacking and enable ..      */
+                                                                        /* ..automatic state saving.                   */
+#define  CPU_REG_FPCCR_LAZY_STK                        0xC0000000uL
+
+
+/*
+*********************************************************************************************************
+*                                         TRUSTZONE DEFINES
+*********************************************************************************************************
+*/
+
+#if (OS_CPU_TZ_EN > 0u)
+#define  OS_CPU_TZ_STK_CTX_NBR                         1u               /* Saved context starts with the Secure ctx .. */
+#define  OS_CPU_TZ_STK_CTX_IX                          0u               /* .. see os_cpu_a.S.                          */
+#else
+#define  OS_CPU_TZ_STK_CTX_NBR                         0u
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      LAZY FP CONTEXT SWITCH
+*********************************************************************************************************
+*/
+
+#if (OS_CPU_ARM_FP_EN > 0u) && (OS_CPU_ARM_FP_LAZY_EN > 0u)
+#define  CPU_REG_FP_FPCAR              (*((CPU_REG32 *)0xE000EF38uL))   /* Floating-Point Context Address Reg.         */
+
+#define  CPU_REG_FPCCR_LSPACT                          0x00000001uL     /* Lazy state preservation pending.            */
+
+#define  OS_CPU_EXC_RETURN_STD_FRAME                   0x00000010uL     /* EXC_RETURN bit 4: no FP context.            */
+
+#define  OS_CPU_FP_STK_EXC_RETURN_IX  (OS_CPU_TZ_STK_CTX_NBR + 8u)     /* Saved context: R4-R11, EXC_RETURN, ..       */
+#define  OS_CPU_FP_STK_REGS_IX        (OS_CPU_TZ_STK_CTX_NBR + 9u)     /* .. then room for s16-s31.                   */
+
+OS_TCB   *OS_CPU_FP_OwnerPtr;                                   /* Task whose s16-s31 are held by the FPU.              */
+CPU_STK  *OS_CPU_FP_SavePtr;                                    /* Where PendSV saves s16-s31, if needed.               */
+CPU_STK  *OS_CPU_FP_LoadPtr;                                    /* Where PendSV loads s16-s31 from, if needed.          */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         STACK LIMIT DEFINES
+*********************************************************************************************************
+*/
+
+#if (OS_CPU_STK_LIMIT_EN > 0u)
+#define  OS_CPU_REG_SCB_SHCSR          (*((CPU_REG32 *)0xE000ED24uL))   /* System Handler Control and State Reg.       */
+#define  OS_CPU_REG_SCB_CFSR           (*((CPU_REG32 *)0xE000ED28uL))   /* Configurable Fault Status Reg.              */
+
+#define  OS_CPU_SCB_SHCSR_USGFAULTENA                  0x00040000uL
+#define  OS_CPU_SCB_CFSR_STKOF                         0x00100000uL     /* UsageFault: stack limit violation.          */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                  DATA WATCHPOINT AND TRACE DEFINES
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_PERF_CTR_EN > 0u) || (OS_CPU_TS_DWT_EN > 0u)
+#define  OS_CPU_REG_DEM_CR             (*((CPU_REG32 *)0xE000EDFCuL))   /* Debug Exception and Monitor Control Reg.    */
+#define  OS_CPU_REG_DWT_CTRL           (*((CPU_REG32 *)0xE0001000uL))   /* DWT Control Reg.                            */
+
+#define  OS_CPU_DEM_CR_TRCENA                          0x01000000uL
+#endif
+
+#if (OS_CFG_TASK_PERF_CTR_EN > 0u)
+#define  OS_CPU_REG_DWT_CNT_BASE         ((CPU_REG32 *)0xE0001008uL)    /* DWT CPI, EXC, SLEEP, LSU & FOLD Count Regs. */
+
+#define  OS_CPU_DWT_CTRL_NOPRFCNT                      0x01000000uL     /* No profiling counters implemented.          */
+#define  OS_CPU_DWT_CTRL_CPIEVTENA                     0x00020000uL     /* .. EXC, SLEEP, LSU & FOLD follow in order.  */
+
+#define  OS_CPU_DWT_CNT_MSK                            0x000000FFuL     /* The event counters are 8 bits wide.         */
+#endif
+
+#if (OS_CPU_TS_DWT_EN > 0u)
+#define  OS_CPU_DWT_CTRL_NOCYCCNT                      0x02000000uL     /* No cycle counter implemented.               */
+#define  OS_CPU_DWT_CTRL_CYCCNTENA                     0x00000001uL
+
+static  CPU_INT32U  OS_CPU_TS_Hi;                               /* Nbr of CYCCNT wraps.                                 */
+static  CPU_INT32U  OS_CPU_TS_LoPrev;                           /* CYCCNT at the last OS_CPU_TS64Get().                 */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      INTERRUPT CONTROL DEFINES
+*********************************************************************************************************
+*/
+
+#define  OS_CPU_REG_SCB_ICSR           (*((CPU_REG32 *)0xE000ED04uL))   /* Interrupt Control and State Reg.            */
+#define  OS_CPU_REG_SCB_SHPR_BASE        ((CPU_REG08 *)0xE000ED18uL)    /* System Handler Priority Reg. (exception 4)  */
+#define  OS_CPU_REG_NVIC_IPR_BASE        ((CPU_REG08 *)0xE000E400uL)    /* Interrupt Priority Reg. (exception 16)      */
+
+#define  OS_CPU_SCB_ICSR_VECTACTIVE_MSK                0x000001FFuL     /* Nbr of the exception being serviced.        */
+#define  OS_CPU_SCB_ICSR_RETTOBASE                     0x00000800uL     /* No other exception is active.               */
+
+
+/*
+*********************************************************************************************************
+*                                         DYNAMIC TICK DEFINES
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u) || (OS_CFG_TICK_RATE_SET_EN > 0u)
+#define  OS_CPU_REG_SYST_CVR           (*((CPU_REG32 *)0xE000E018uL))   /* SysTick Current Value Reg.                  */
+#define  OS_CPU_SYST_RVR_MAX                           0x00FFFFFFuL     /* SysTick is a 24-bit down counter.           */
+#endif
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+#define  OS_CPU_SCB_ICSR_PENDSTSET                     0x04000000uL
+#define  OS_CPU_SCB_ICSR_PENDSTCLR                     0x02000000uL
+
+
+/*
+*********************************************************************************************************
+*                                        DYNAMIC TICK VARIABLES
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  OS_CPU_DynTickCnts;                         /* Nbr of SysTick counts per OS tick.                   */
+static  CPU_INT32U  OS_CPU_DynTickPhase;                        /* Cnts from the last tick boundary to the period start */
+static  OS_TICK     OS_CPU_DynTickDelta;                        /* Nbr of ticks programmed for the current period.      */
+
+
+/*
+*********************************************************************************************************
+*                                      DYNAMIC TICK LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  OS_CPU_DynTickCntsGet (void);
+
+static  OS_TICK     OS_CPU_DynTickArm     (OS_TICK     ticks,
+                                           CPU_INT32U  phase);
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           IDLE TASK HOOK
+*
+* Description: This function is called by the idle task.  This hook has been added to allow you to do
+*              such things as STOP the CPU to conserve power.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) With OS_CPU_IDLE_WFI_EN, the core sleeps (WFI) until the next interrupt.  In Dynamic Tick
+*                 Mode that is either a device interrupt or the tick programmed for the next timeout, so
+*                 an idle system is not woken up on every tick.  SysTick stops in deep sleep modes; those
+*                 need a low-power timer driven by the BSP (see Template/bsp_os_dt.c).
+*********************************************************************************************************
+*/
+
+void  OSIdleTaskHook (void)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppIdleTaskHookPtr != (OS_APP_HOOK_VOID)0) {
+        (*OS_AppIdleTaskHookPtr)();
+    }
+#endif
+#if (OS_CPU_IDLE_WFI_EN > 0u)
+    CPU_WaitForInt();                                           /* See Note #1.                                         */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                       OS INITIALIZATION HOOK
+*
+* Description: This function is called by OSInit() at the beginning of OSInit().
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) When using hardware floating point please do the following during the reset handler:
+*                 a) Set full access for CP10 & CP11 bits in CPACR register.
+*                 b) Set bits ASPEN and LSPEN in FPCCR register.
+*
+*              2) When OS_CPU_STK_LIMIT_EN is enabled, the UsageFault exception is enabled so that a
+*                 violation of PSPLIM is reported by OS_CPU_UsageFaultHandler() and not as a HardFault.
+*
+*              3) When OS_CPU_TS_DWT_EN is enabled, the DWT MUST implement the cycle counter.  It is
+*                 started from 0 and OS_TS_GET() reads it from then on (see os_cpu.h).
+*********************************************************************************************************
+*/
+
+void  OSInitHook (void)
+{
+#if (OS_CPU_ARM_FP_EN > 0u)
+    CPU_INT32U   reg_val;
+#endif
+                                                                /* 8-byte align the ISR stack.                          */
+    OS_CPU_ExceptStkBase = (CPU_STK *)(OSCfg_ISRStkBasePtr + OSCfg_ISRStkSize);
+    OS_CPU_ExceptStkBase = (CPU_STK *)((CPU_STK)(OS_CPU_ExceptStkBase) & 0xFFFFFFF8);
+
+#if (OS_CPU_ARM_FP_EN > 0u)
+    reg_val = CPU_REG_FP_FPCCR;                                 /* Check the floating point mode.                       */
+    if ((reg_val & CPU_REG_FPCCR_LAZY_STK) != CPU_REG_FPCCR_LAZY_STK) {
+        while (1u) {                                            /* See Note (1).                                        */
+            ;
+        }
+    }
+#endif
+                                                                /* Set BASEPRI boundary from the configuration.         */
+    OS_KA_BASEPRI_Boundary = (CPU_INT32U)(CPU_CFG_KA_IPL_BOUNDARY << (8u - CPU_CFG_NVIC_PRIO_BITS));
+
+#if (OS_CPU_STK_LIMIT_EN > 0u)
+    OS_CPU_REG_SCB_SHCSR |= OS_CPU_SCB_SHCSR_USGFAULTENA;       /* See Note (2).                                        */
+#endif
+
+#if (OS_CPU_TZ_EN > 0u)
+    OS_CPU_TZ_SecureCtxCur = 0u;                                /* main() has no Secure context of its own              */
+#endif
+
+#if (OS_CPU_TS_DWT_EN > 0u)
+    OS_CPU_REG_DEM_CR    |= OS_CPU_DEM_CR_TRCENA;               /* The DWT only counts with the trace enabled           */
+    if ((OS_CPU_REG_DWT_CTRL & OS_CPU_DWT_CTRL_NOCYCCNT) != 0u) {
+        while (1u) {                                            /* See Note (3).                                        */
+            ;
+        }
+    }
+    OS_CPU_TS_Hi          = 0u;
+    OS_CPU_TS_LoPrev      = 0u;
+    OS_CPU_REG_DWT_CYCCNT = 0u;
+    OS_CPU_REG_DWT_CTRL  |= OS_CPU_DWT_CTRL_CYCCNTENA;
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                           REDZONE HIT HOOK
+*
+* Description: This function is called when a task's stack overflowed.
+*
+* Arguments  : p_tcb        Pointer to the task control block of the offending task. NULL if ISR.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+void  OSRedzoneHitHook (OS_TCB  *p_tcb)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppRedzoneHitHookPtr != (OS_APP_HOOK_TCB)0) {
+        (*OS_AppRedzoneHitHookPtr)(p_tcb);
+    } else {
+        CPU_SW_EXCEPTION(;);
+    }
+#else
+    (void)p_tcb;                                                /* Prevent compiler warning                             */
+    CPU_SW_EXCEPTION(;);
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         STATISTIC TASK HOOK
+*
+* Description: This function is called every second by uC/OS-III's statistics task.  This allows your
+*              application to add functionality to the statistics task.
+*
+* Arguments  : None.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+void  OSStatTaskHook (void)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppStatTaskHookPtr != (OS_APP_HOOK_VOID)0) {
+        (*OS_AppStatTaskHookPtr)();
+    }
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                          TASK CREATION HOOK
+*
+* Description: This function is called when a task is created.
+*
+* Arguments  : p_tcb        Pointer to the task control block of the task being created.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+void  OSTaskCreateHook (OS_TCB  *p_tcb)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTaskCreateHookPtr != (OS_APP_HOOK_TCB)0) {
+        (*OS_AppTaskCreateHookPtr)(p_tcb);
+    }
+#else
+    (void)p_tcb;                                                /* Prevent compiler warning                             */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                           TASK DELETION HOOK
+*
+* Description: This function is called when a task is deleted.
+*
+* Arguments  : p_tcb        Pointer to the task control block of the task being deleted.
+*
+* Note(s)    : 1) With OS_CPU_ARM_FP_LAZY_EN, a deleted task can't keep the ownership of the FP registers:
+*                 its stack would receive them when the next FP task is switched in.  The same goes for
+*                 a lazy FP state preservation still pending on its stack.
+*
+*              2) With OS_CPU_TZ_EN, the Secure context of the task is freed.  A task that deletes itself
+*                 is still running on it: it is dropped from OS_CPU_TZ_SecureCtxCur as well, so that it
+*                 isn't saved when the task is switched out for the last time.
+*********************************************************************************************************
+*/
+
+void  OSTaskDelHook (OS_TCB  *p_tcb)
+{
+#if (OS_CPU_ARM_FP_EN > 0u) && (OS_CPU_ARM_FP_LAZY_EN > 0u)
+    CPU_INT32U  stk_base;
+#endif
+#if (OS_CPU_TZ_EN > 0u)
+    CPU_INT32U  ctx;
+#endif
+
+
+#if (OS_CPU_TZ_EN > 0u)
+    if (p_tcb == OSTCBCurPtr) {                                 /* See Note #2.                                         */
+        ctx                    = OS_CPU_TZ_SecureCtxCur;
+        OS_CPU_TZ_SecureCtxCur = 0u;
+    } else {
+        ctx                    = p_tcb->StkPtr[OS_CPU_TZ_STK_CTX_IX];
+    }
+    if (ctx != 0u) {
+        OS_CPU_TZ_SecureCtxFree(ctx);
+    }
+#endif
+
+#if (OS_CPU_ARM_FP_EN > 0u) && (OS_CPU_ARM_FP_LAZY_EN > 0u)
+
+    if (p_tcb == OS_CPU_FP_OwnerPtr) {                          /* See Note #1.                                         */
+        OS_CPU_FP_OwnerPtr = (OS_TCB *)0;
+        stk_base           = (CPU_INT32U)p_tcb->StkBasePtr;
+        if (((CPU_REG_FP_FPCCR & CPU_REG_FPCCR_LSPACT) != 0u) &&
+             (CPU_REG_FP_FPCAR >= stk_base) &&
+             (CPU_REG_FP_FPCAR <  stk_base + (p_tcb->StkSize * sizeof(CPU_STK)))) {
+            CPU_REG_FP_FPCCR &= ~CPU_REG_FPCCR_LSPACT;
+        }
+    }
+#endif
+
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTaskDelHookPtr != (OS_APP_HOOK_TCB)0) {
+        (*OS_AppTaskDelHookPtr)(p_tcb);
+    }
+#elif ((OS_CPU_ARM_FP_EN == 0u) || (OS_CPU_ARM_FP_LAZY_EN == 0u)) && (OS_CPU_TZ_EN == 0u)
+    (void)p_tcb;                                                /* Prevent compiler warning                             */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                            TASK RETURN HOOK
+*
+* Description: This function is called if a task accidentally returns.  In other words, a task should
+*              either be an infinite loop or delete itself when done.
+*
+* Arguments  : p_tcb        Pointer to the task control block of the task that is returning.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+void  OSTaskReturnHook (OS_TCB  *p_tcb)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTaskReturnHookPtr != (OS_APP_HOOK_TCB)0) {
+        (*OS_AppTaskReturnHookPtr)(p_tcb);
+    }
+#else
+    (void)p_tcb;                                                /* Prevent compiler warning                             */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                        INITIALIZE A TASK'S STACK
+*
+* Description: This function is called by either OSTaskCreate() or OSTaskCreateExt() to initialize the
+*              stack frame of the task being created.  This function is highly processor specific.
+*
+* Arguments  : p_task       Pointer to the task entry point address.
+*
+*              p_arg        Pointer to a user supplied data area that will be passed to the task
+*                               when the task first executes.
+*
+*              p_stk_base   Pointer to the base address of the stack.
+*
+*              stk_size     Size of the stack, in number of CPU_STK elements.
+*
+*              opt          Options used to alter the behavior of OS_Task_StkInit().
+*                            (see OS.H for OS_TASK_OPT_xxx).
+*
+* Returns    : Always returns the location of the new top-of-stack once the processor registers have
+*              been placed on the stack in the proper order.
+*
+* Note(s)    : (1) Interrupts are enabled when task starts executing.
+*
+*              (2) All tasks run in Thread mode, using process stack.
+*
+*              (3) There are two different stack frames depending on whether the Floating-Point(FP)
+*                  co-processor is enabled or not.
+*
+*                  (a) The stack frame shown in the diagram is used when the Co-processor Access Control
+*                      Register(CPACR) is disabling the Floating Point Unit. In this case, the FP
+*                      registers(S0- S31) & FP Status Control(FPSCR) register are not saved in the stack frame.
+*
+*                  (b) The stack frame shown in the diagram is used when the Floating Point Unit is enabled,
+*                      that is, CP10 and CP11 field in CPACR are ones and FPCCR sets bits ASPEN and LSPEN to 1.
+*
+*                      (1) When enabling the FPU through CPACR, make sure to set bits ASPEN and LSPEN in the
+*                          Floating-Point Context Control Register (FPCCR).
+*
+*                                          +-------------+
+*                                          |             |
+*                                          +-------------+
+*                                          |             |
+*                                          +-------------+
+*                                          |    FPSCR    |
+*                                          +-------------+
+*                                          |     S15     |
+*                                          +-------------+
+*                                          |     S14     |
+*                                          +-------------+
+*                                          |     S13     |
+*                                          +-------------+
+*                                                .
+*                                                .
+*                                                .
+*                                          +-------------+
+*                                          |     S2      |
+*                                          +-------------+
+*                                          |     S1      |
+*                    +-------------+       +-------------+
+*                    |             |       |     S0      |
+*                    +-------------+       +-------------+
+*                    |    xPSR     |       |    xPSR     |
+*                    +-------------+       +-------------+
+*                    | Return Addr |       | Return Addr |
+*                    +-------------+       +-------------+
+*                    |  LR(R14)    |       |   LR(R14)   |
+*                    +-------------+       +-------------+
+*                    |    R12      |       |     R12     |
+*                    +-------------+       +-------------+
+*                    |    R3       |       |     R3      |
+*                    +-------------+       +-------------+
+*                    |    R2       |       |     R0      |
+*                    +-------------+       +-------------+
+*                    |    R1       |       |     R1      |
+*                    +-------------+       +-------------+
+*                    |    R0       |       |     R0      |
+*                    +-------------+       +-------------+
+*                    | EXEC_RETURN |       | EXEC_RETURN |
+*                    +-------------+       +-------------+
+*                    |    R11      |       |     R11     |
+*                    +-------------+       +-------------+
+*                    |    R10      |       |     R10     |
+*                    +-------------+       +-------------+
+*                    |    R9       |       |     R9      |
+*                    +-------------+       +-------------+
+*                    |    R8       |       |     R8      |
+*                    +-------------+       +-------------+
+*                    |    R7       |       |     R7      |
+*                    +-------------+       +-------------+
+*                    |    R6       |       |     R6      |
+*                    +-------------+       +-------------+
+*                    |    R5       |       |     R5      |
+*                    +-------------+       +-------------+
+*                    |    R4       |       |     R4      |
+*                    +-------------+       +-------------+
+*                          (a)             |     S31     |
+*                                          +-------------+
+*                                          |     S30     |
+*                                          +-------------+
+*                                          |     S29     |
+                                           +-------------+
+*                                                .
+*                                                .
+*                                                .
+*                                          +-------------+
+*                                          |     S17     |
+                                           +-------------+
+*                                          |     S16     |
+*                                          +-------------+
+*                                               (b)
+*
+*             (4) The SP must be 8-byte aligned in conforming to the Procedure Call Standard for the ARM architecture
+*
+*                    (a) Section 2.1 of the  ABI for the ARM Architecture Advisory Note. SP must be 8-byte aligned
+*                        on entry to AAPCS-Conforming functions states :
+*
+*                        The Procedure Call Standard for the ARM Architecture [AAPCS] requires primitive
+*                        data types to be naturally aligned according to their sizes (for size = 1, 2, 4, 8 bytes).
+*                        Doing otherwise creates more problems than it solves.
+*
+*                        In return for preserving the natural alignment of data, conforming code is permitted
+*                        to rely on that alignment. To support aligning data allocated on the stack, the stack
+*                        pointer (SP) is required to be 8-byte aligned on entry to a conforming function. In
+*                        practice this requirement is met if:
+*
+*                           (1) At each call site, the current size of the calling function's stack frame is a multiple of 8 bytes.
+*                               This places an obligation on compilers and assembly language programmers.
+*
+*                           (2) SP is a multiple of 8 when control first enters a program.
+*                               This places an obligation on authors of low level OS, RTOS, and runtime library
+*                               code to align SP at all points at which control first enters
+*                               a body of (AAPCS-conforming) code.
+*
+*                       In turn, this requires the value of SP to be aligned to 0 modulo 8:
+*
+*                           (3) By exception handlers, before calling AAPCS-conforming code.
+*
+*                           (4) By OS/RTOS/run-time system code, before giving control to an application.
+*
+*                 (b) Section 2.3.1 corrective steps from the the SP must be 8-byte aligned on entry
+*                     to AAPCS-conforming functions advisory note also states.
+*
+*                     " This requirement extends to operating systems and run-time code for all architecture versions
+*                       prior to ARMV7 and to the A, R and M architecture profiles thereafter. Special considerations
+*                       associated with ARMV7M are discussed in section 2.3.3"
+*
+*                     (1) Even if the SP 8-byte aligment is not a requirement for the ARMv7M profile, the stack is aligned
+*                         to 8-byte boundaries to support legacy execution enviroments.
+*
+*                 (c) Section 5.2.1.2 from the Procedure Call Standard for the ARM
+*                     architecture states :  "The stack must also conform to the following
+*                     constraint at a public interface:
+*
+*                     (1) SP mod 8 = 0. The stack must be double-word aligned"
+*
+*                 (d) From the ARM Technical Support Knowledge Base. 8 Byte stack aligment.
+*
+*                     "8 byte stack alignment is a requirement of the ARM Architecture Procedure
+*                      Call Standard [AAPCS]. This specifies that functions must maintain an 8 byte
+*                      aligned stack address (e.g. 0x00, 0x08, 0x10, 0x18, 0x20) on all external
+*                      interfaces. In practice this requirement is met if:
+*
+*                      (1) At each external interface, the current stack pointer
+*                          is a multiple of 8 bytes.
+*
+*                      (2) Your OS maintains 8 byte stack alignment on its external interfaces
+*                          e.g. on task switches"
+*
+*              (5) Exception Return Behavior(EXEC_RETURN), see OS_CPU_EXC_RETURN_TASK in os_cpu.h
+*                  0xFFFFFFFD      Return to Secure Thread mode, exception return uses non-floating point
+*                                  state from the PSP and execution uses PSP after return.
+*
+*                  0xFFFFFFBC      Return to Non-secure Thread mode, exception return uses non-floating
+*                                  point state from the PSP and execution uses PSP after return.
+*
+*                  Bit 4 is cleared once the task uses the FP (or MVE) registers, bit 6 is set while a
+*                  Non-secure task is preempted in the Secure state.
+*
+*              (6) With OS_CPU_TZ_EN, the context starts with the Secure context of the task (see
+*                  os_cpu_a.S), 0 until the task calls OS_CPU_TZ_TaskCtxAlloc().
+**********************************************************************************************************
+*/
+
+CPU_STK  *OSTaskStkInit (OS_TASK_PTR    p_task,
+                         void          *p_arg,
+                         CPU_STK       *p_stk_base,
+                         CPU_STK       *p_stk_limit,
+                         CPU_STK_SIZE   stk_size,
+                         OS_OPT         opt)
+{
+    CPU_STK    *p_stk;
+
+
+    (void)opt;                                                  /* 'opt' is not used, prevent warning                   */
+
+    p_stk = &p_stk_base[stk_size];                              /* Load stack pointer                                   */
+                                                                /* Align the stack to 8-bytes.                          */
+    p_stk = (CPU_STK *)((CPU_STK)(p_stk) & 0xFFFFFFF8u);
+                                                                /* Registers stacked as if auto-saved on exception      */
+    *(--p_stk) = (CPU_STK)0x01000000u;                          /* xPSR                                                 */
+    *(--p_stk) = (CPU_STK)p_task;                               /* Entry Point                                          */
+    *(--p_stk) = (CPU_STK)OS_TaskReturn;                        /* R14 (LR)                                             */
+    *(--p_stk) = (CPU_STK)0x12121212u;                          /* R12                                                  */
+    *(--p_stk) = (CPU_STK)0x03030303u;                          /* R3                                                   */
+    *(--p_stk) = (CPU_STK)0x02020202u;                          /* R2                                                   */
+    *(--p_stk) = (CPU_STK)p_stk_limit;                          /* R1                                                   */
+    *(--p_stk) = (CPU_STK)p_arg;                                /* R0 : argument                                        */
+    *(--p_stk) = (CPU_STK)OS_CPU_EXC_RETURN_TASK;               /* R14: EXEC_RETURN; See Note 5                         */
+                                                                /* Remaining registers saved on process stack           */
+    *(--p_stk) = (CPU_STK)0x11111111uL;                         /* R11                                                  */
+    *(--p_stk) = (CPU_STK)0x10101010uL;                         /* R10                                                  */
+    *(--p_stk) = (CPU_STK)0x09090909uL;                         /* R9                                                   */
+    *(--p_stk) = (CPU_STK)0x08080808uL;                         /* R8                                                   */
+    *(--p_stk) = (CPU_STK)0x07070707uL;                         /* R7                                                   */
+    *(--p_stk) = (CPU_STK)0x06060606uL;                         /* R6                                                   */
+    *(--p_stk) = (CPU_STK)0x05050505uL;                         /* R5                                                   */
+    *(--p_stk) = (CPU_STK)0x04040404uL;                         /* R4                                                   */
+#if (OS_CPU_TZ_EN > 0u)
+    *(--p_stk) = (CPU_STK)0u;                                   /* Secure context; See Note 6                           */
+#endif
+
+    return (p_stk);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           TASK SWITCH HOOK
+*
+* Description: This function is called when a task switch is performed.  This allows you to perform other
+*              operations during a context switch.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) Interrupts are disabled during this call.
+*              2) It is assumed that the global pointer 'OSTCBHighRdyPtr' points to the TCB of the task
+*                 that will be 'switched in' (i.e. the highest priority task) and, 'OSTCBCurPtr' points
+*                 to the task being switched out (i.e. the preempted task).
+*              3) When OS_CPU_STK_LIMIT_EN is enabled, PSPLIM is loaded with the bottom of the stack of the
+*                 task being switched in, or the top of its redzone with OS_CFG_TASK_STK_REDZONE_EN.  It
+*                 is rounded up to 8 bytes, the granularity of PSPLIM.  The processor checks every push
+*                 against it, so the redzone isn't scanned on context switches.
+*              4) When OS_CPU_ARM_FP_LAZY_EN is enabled, the FP registers are handed over to the task being
+*                 switched in only if it was created with OS_OPT_TASK_SAVE_FP or already has an FP context
+*                 and it doesn't own them yet.  The s16-s31 of the previous owner are then saved in the
+*                 room reserved for them on its stack and those of the new owner are loaded from its own
+*                 stack, if it has an FP context.  PendSV performs both transfers (see os_cpu_a.S).
+*              5) When OS_CFG_TASK_PERF_CTR_EN is enabled, the events counted by the DWT since the task was
+*                 switched in are added to its '.PerfCtrTotal[]', modulo 256 (see os_cpu.h).  Counters
+*                 that were not started with OS_CPU_PerfCtrCfg() don't move and add nothing.
+*              6) When OS_CPU_TZ_EN is enabled, the Secure context of the task being switched out is
+*                 recorded in the slot PendSV reserved for it, and the Secure side saves its Secure stack.
+*                 The Secure stack of the task being switched in is then loaded.  Tasks without a Secure
+*                 context (0) make no call to the Secure state.  OSStartHighRdy() also calls this hook:
+*                 OSTCBCurPtr is then the first task, whose slot already holds 0.
+*********************************************************************************************************
+*/
+
+void  OSTaskSwHook (void)
+{
+#if OS_CFG_TASK_PROFILE_EN > 0u
+    CPU_TS  ts;
+#endif
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN
+    CPU_TS  int_dis_time;
+#endif
+#if (OS_CPU_STK_LIMIT_EN > 0u)
+    CPU_STK     *p_limit;
+#elif (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+    CPU_BOOLEAN  stk_status;
+#endif
+#if (OS_CPU_TZ_EN > 0u)
+    CPU_INT32U   ctx_cur;
+    CPU_INT32U   ctx_next;
+#endif
+#if (OS_CPU_ARM_FP_EN > 0u) && (OS_CPU_ARM_FP_LAZY_EN > 0u)
+    OS_TCB      *p_owner;
+    OS_TCB      *p_next;
+#endif
+#if (OS_CFG_TASK_PERF_CTR_EN > 0u)
+    CPU_INT08U   ix;
+    CPU_INT32U   ctr;
+#endif
+
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTaskSwHookPtr != (OS_APP_HOOK_VOID)0) {
+        (*OS_AppTaskSwHookPtr)();
+    }
+#endif
+
+    OS_TRACE_TASK_SWITCHED_IN(OSTCBHighRdyPtr);
+
+#if OS_CFG_TASK_PROFILE_EN > 0u
+    ts = OS_TS_GET();
+    if (OSTCBCurPtr != OSTCBHighRdyPtr) {
+        OSTCBCurPtr->CyclesDelta  = ts - OSTCBCurPtr->CyclesStart;
+        OSTCBCurPtr->CyclesTotal += (OS_CYCLES)OSTCBCurPtr->CyclesDelta;
+    }
+
+    OSTCBHighRdyPtr->CyclesStart = ts;
+#endif
+
+#if (OS_CFG_TASK_PERF_CTR_EN > 0u)
+    for (ix = 0u; ix < OS_CPU_PERF_CTR_NBR; ix++) {             /* See Note #5.                                         */
+        ctr = OS_CPU_REG_DWT_CNT_BASE[ix];
+        if (OSTCBCurPtr != OSTCBHighRdyPtr) {
+            OSTCBCurPtr->PerfCtrTotal[ix] += (ctr - OSTCBCurPtr->PerfCtrStart[ix]) & OS_CPU_DWT_CNT_MSK;
+        }
+        OSTCBHighRdyPtr->PerfCtrStart[ix] = ctr;
+    }
+#endif
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN
+    int_dis_time = CPU_IntDisMeasMaxCurReset();                 /* Keep track of per-task interrupt disable time        */
+    if (OSTCBCurPtr->IntDisTimeMax < int_dis_time) {
+        OSTCBCurPtr->IntDisTimeMax = int_dis_time;
+    }
+#endif
+
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
+                                                                /* Keep track of per-task scheduler lock time           */
+    if (OSTCBCurPtr->SchedLockTimeMax < OSSchedLockTimeMaxCur) {
+        OSTCBCurPtr->SchedLockTimeMax = OSSchedLockTimeMaxCur;
+    }
+    OSSchedLockTimeMaxCur = (CPU_TS)0;                          /* Reset the per-task value                             */
+#endif
+
+#if (OS_CPU_STK_LIMIT_EN > 0u)
+                                                                /* Stack limit of the new task, see Note #3.            */
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+    p_limit = OSTCBHighRdyPtr->StkBasePtr + OS_CFG_TASK_STK_REDZONE_DEPTH;
+#else
+    p_limit = OSTCBHighRdyPtr->StkBasePtr;
+#endif
+    OS_CPU_PSPLIM_Set((CPU_STK *)(((CPU_INT32U)p_limit + 7u) & ~(CPU_INT32U)7u));
+#elif (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+                                                                /* Check if stack overflowed.                           */
+    stk_status = OSTaskStkRedzoneChk((OS_TCB *)0u);
+    if (stk_status != OS_TRUE) {
+        OSRedzoneHitHook(OSTCBCurPtr);
+    }
+#endif
+
+#if (OS_CPU_ARM_FP_EN > 0u) && (OS_CPU_ARM_FP_LAZY_EN > 0u)
+    OS_CPU_FP_SavePtr = (CPU_STK *)0;                           /* Hand the FP registers over, see Note #4.             */
+    OS_CPU_FP_LoadPtr = (CPU_STK *)0;
+    p_owner           = OS_CPU_FP_OwnerPtr;
+    p_next            = OSTCBHighRdyPtr;
+    if (p_next != p_owner) {
+        if ((p_next->StkPtr[OS_CPU_FP_STK_EXC_RETURN_IX] & OS_CPU_EXC_RETURN_STD_FRAME) == 0u) {
+            OS_CPU_FP_LoadPtr = &p_next->StkPtr[OS_CPU_FP_STK_REGS_IX];
+        }
+        if ((OS_CPU_FP_LoadPtr != (CPU_STK *)0) ||
+            ((p_next->Opt & OS_OPT_TASK_SAVE_FP) != 0u)) {
+            if ((p_owner != (OS_TCB *)0) &&                     /* Only an FP context has room for s16-s31              */
+                ((p_owner->StkPtr[OS_CPU_FP_STK_EXC_RETURN_IX] & OS_CPU_EXC_RETURN_STD_FRAME) == 0u)) {
+                OS_CPU_FP_SavePtr = &p_owner->StkPtr[OS_CPU_FP_STK_REGS_IX];
+            }
+            OS_CPU_FP_OwnerPtr = p_next;
+        }
+    }
+#endif
+
+#if (OS_CPU_TZ_EN > 0u)
+    ctx_cur  = OS_CPU_TZ_SecureCtxCur;                          /* Switch the Secure stacks, see Note #6.               */
+    OSTCBCurPtr->StkPtr[OS_CPU_TZ_STK_CTX_IX] = ctx_cur;
+    ctx_next = OSTCBHighRdyPtr->StkPtr[OS_CPU_TZ_STK_CTX_IX];
+    if (ctx_next != ctx_cur) {
+        if (ctx_cur != 0u) {
+            OS_CPU_TZ_SecureCtxSave(ctx_cur);
+        }
+        if (ctx_next != 0u) {
+            OS_CPU_TZ_SecureCtxLoad(ctx_next);
+        }
+        OS_CPU_TZ_SecureCtxCur = ctx_next;
+    }
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                              TICK HOOK
+*
+* Description: This function is called every tick.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) This function is assumed to be called from the Tick ISR.
+*
+*              2) With OS_CPU_TS_DWT_EN, the 64-bit timestamp is read on every tick so that each wrap of
+*                 the cycle counter is seen.
+*********************************************************************************************************
+*/
+
+void  OSTimeTickHook (void)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTimeTickHookPtr != (OS_APP_HOOK_VOID)0) {
+        (*OS_AppTimeTickHookPtr)();
+    }
+#endif
+#if (OS_CPU_TS_DWT_EN > 0u)
+    (void)OS_CPU_TS64Get();                                     /* See Note #2.                                         */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SYS TICK HANDLER
+*
+* Description: Handle the system tick (SysTick) interrupt, which is used to generate the uC/OS-III tick
+*              interrupt.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) This function MUST be placed on entry 15 of the Cortex-M vector table.
+*
+*              2) In Dynamic Tick Mode, the interrupt marks the end of the period programmed by
+*                 OS_DynTickSet(), which falls on a tick boundary.
+*
+*              3) When the tick interrupted a task, the interrupted PC is word 6 of the exception frame
+*                 stacked on the task stack (R0-R3, R12, LR, PC, xPSR).  When it interrupted another
+*                 exception, the frame is on the main stack and the sample is recorded without a PC.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_SysTickHandler  (void)
+{
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    OS_TICK   ticks;
+#endif
+#if (OS_CFG_PROF_SAMPLE_EN > 0u)
+    CPU_ADDR  pc;
+#endif
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    OSIntEnter();                                               /* Tell uC/OS-III that we are starting an ISR           */
+#if (OS_CFG_PROF_SAMPLE_EN > 0u)
+    if ((OS_CPU_REG_SCB_ICSR & OS_CPU_SCB_ICSR_RETTOBASE) != 0u) {
+        pc = (CPU_ADDR)OS_CPU_PSP_Get()[6];                     /* See Note #3.                                         */
+    } else {
+        pc = (CPU_ADDR)0;
+    }
+    OS_ProfSample(pc);
+#endif
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    ticks               = OS_CPU_DynTickDelta;                  /* See Note #2.                                         */
+    OS_CPU_DynTickPhase = 0u;
+#endif
+    CPU_CRITICAL_EXIT();
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    OSTimeDynTick(ticks);                                       /* The kernel programs the next period                  */
+#else
+    OSTimeTick();                                               /* Call uC/OS-III's OSTimeTick()                        */
+#endif
+
+    OSIntExit();                                                /* Tell uC/OS-III that we are leaving the ISR           */
+}
+
+
+/*
+*********************************************************************************************************
+*                                         USAGE FAULT HANDLER
+*
+* Description: Handle the UsageFault raised when a push on the process stack crosses PSPLIM.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) This function MUST be placed on entry 6 of the Cortex-M vector table.
+*
+*              2) The kernel doesn't set MSPLIM: a stack limit violation is always caused by the process
+*                 stack of the running task, be it a push by the task or the stacking of an exception
+*                 frame on its behalf.
+*
+*              3) The task can't be resumed: the overflow is reported through OSRedzoneHitHook(), if
+*                 OS_CFG_TASK_STK_REDZONE_EN is enabled, and a software exception is then raised.  Other
+*                 usage faults raise the software exception directly.
+*********************************************************************************************************
+*/
+
+#if (OS_CPU_STK_LIMIT_EN > 0u)
+void  OS_CPU_UsageFaultHandler (void)
+{
+    if ((OS_CPU_REG_SCB_CFSR & OS_CPU_SCB_CFSR_STKOF) != 0u) {  /* See Note #2.                                         */
+        OS_CPU_REG_SCB_CFSR = OS_CPU_SCB_CFSR_STKOF;            /* Clear the stack overflow status bit                  */
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+        OSRedzoneHitHook(OSTCBCurPtr);
+#endif
+    }
+
+    CPU_SW_EXCEPTION(;);                                        /* See Note #3.                                         */
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                   ALLOCATE A TASK'S SECURE CONTEXT
+*
+* Description: Give the calling task its own Secure stack, so that it can call Secure functions.
+*
+* Arguments  : stk_size     Size of the Secure stack, in bytes.
+*
+* Returns    : OS_TRUE      if the task has a Secure context.
+*
+*              OS_FALSE     if the Secure side could not allocate one.
+*
+* Note(s)    : 1) This function MUST be called by the task itself, before its first call to the Secure
+*                 state.  The context is freed by OSTaskDelHook().
+*
+*              2) The context is allocated and loaded with interrupts disabled: until it is loaded, the
+*                 Secure side still runs on the Secure stack of the task that used it last, which may
+*                 be switched back in at any time.
+*********************************************************************************************************
+*/
+
+#if (OS_CPU_TZ_EN > 0u)
+CPU_BOOLEAN  OS_CPU_TZ_TaskCtxAlloc (CPU_INT32U  stk_size)
+{
+    CPU_INT32U  ctx;
+    CPU_SR_ALLOC();
+
+
+    if (OS_CPU_TZ_SecureCtxCur != 0u) {                         /* The task already has one                             */
+        return (OS_TRUE);
+    }
+
+    CPU_CRITICAL_ENTER();                                       /* See Note #2.                                         */
+    ctx = OS_CPU_TZ_SecureCtxAlloc(stk_size);
+    if (ctx != 0u) {
+        OS_CPU_TZ_SecureCtxLoad(ctx);
+        OS_CPU_TZ_SecureCtxCur = ctx;
+    }
+    CPU_CRITICAL_EXIT();
+
+    if (ctx == 0u) {
+        return (OS_FALSE);
+    }
+    return (OS_TRUE);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                   IS THE CURRENT CONTEXT KERNEL AWARE?
+*
+* Description: Determine whether the exception being serviced is allowed to call uC/OS-III services.
+*
+* Arguments  : None.
+*
+* Returns    : OS_TRUE   if the processor is in Thread mode or services an exception whose priority is at
+*                        or below the kernel aware boundary (CPU_CFG_KA_IPL_BOUNDARY).
+*
+*              OS_FALSE  if the exception is a zero-latency one, i.e. it is never masked by the kernel.
+*
+* Note(s)    : 1) Reset, NMI and HardFault have fixed negative priorities and are never kernel aware.
+*
+*              2) A numerically lower value is a higher priority; the kernel masks every priority that
+*                 is numerically greater than or equal to OS_KA_BASEPRI_Boundary.
+*
+*              3) This function is called by OSIntEnter() when OS_CFG_INT_KA_CHK_EN is set to 1.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_INT_KA_CHK_EN > 0u)
+CPU_BOOLEAN  OS_CPU_IntIsKA (void)
+{
+    CPU_INT32U  exc;
+    CPU_INT32U  prio;
+
+
+    exc = OS_CPU_REG_SCB_ICSR & OS_CPU_SCB_ICSR_VECTACTIVE_MSK;
+    if (exc == 0u) {                                            /* Thread mode                                          */
+        return (OS_TRUE);
+    }
+    if (exc < 4u) {                                             /* See Note #1.                                         */
+        return (OS_FALSE);
+    }
+
+    if (exc < 16u) {                                            /* System handler (MemManage .. SysTick)                */
+        prio = OS_CPU_REG_SCB_SHPR_BASE[exc - 4u];
+    } else {                                                    /* External interrupt                                   */
+        prio = OS_CPU_REG_NVIC_IPR_BASE[exc - 16u];
+    }
+
+    if (prio < OS_KA_BASEPRI_Boundary) {                        /* See Note #2.                                         */
+        return (OS_FALSE);
+    }
+    return (OS_TRUE);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     THREADED INTERRUPT HANDLER
+*
+* Description: Handle an external interrupt that has a handler task attached by OSIntThreadRegister().
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) This function can be placed on the vector table entry of any kernel aware external
+*                 interrupt.  The interrupt number is read from ICSR, external interrupt 0 being
+*                 exception 16.
+*
+*              2) OSIntThreadISR() calls OSIntEnter() and OSIntExit() itself.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_INT_THREAD_EN > 0u)
+void  OS_CPU_IntThreadHandler (void)
+{
+    CPU_INT32U  exc;
+
+
+    exc = OS_CPU_REG_SCB_ICSR & OS_CPU_SCB_ICSR_VECTACTIVE_MSK;
+    if (exc >= 16u) {                                           /* See Note #1.                                         */
+        OSIntThreadISR((CPU_INT16U)(exc - 16u));
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         GET 64-BIT TIMESTAMP
+*
+* Description: Read the DWT cycle counter, extended to 64 bits with the number of times it wrapped.
+*
+* Arguments  : None.
+*
+* Returns    : The number of CPU cycles since OSInitHook().
+*
+* Note(s)    : 1) A wrap is detected when the counter reads lower than at the previous call, so this
+*                 function MUST be called at least once every 2^32 cycles (see OSTimeTickHook()).
+*
+*              2) This function MUST NOT be called from zero-latency interrupts.
+*********************************************************************************************************
+*/
+
+#if (OS_CPU_TS_DWT_EN > 0u)
+CPU_INT64U  OS_CPU_TS64Get (void)
+{
+    CPU_INT32U  lo;
+    CPU_INT64U  ts;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    lo = OS_CPU_REG_DWT_CYCCNT;
+    if (lo < OS_CPU_TS_LoPrev) {                                /* See Note #1.                                         */
+        OS_CPU_TS_Hi++;
+    }
+    OS_CPU_TS_LoPrev = lo;
+    ts = ((CPU_INT64U)OS_CPU_TS_Hi << 32u) | (CPU_INT64U)lo;
+    CPU_CRITICAL_EXIT();
+
+    return (ts);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                   CONFIGURE A PERFORMANCE COUNTER
+*
+* Description: Start or stop one of the DWT event counters credited to the tasks by OSTaskSwHook().
+*
+* Arguments  : ix           Counter to configure (see OS_CPU_PERF_CTR_xxx in os_cpu.h).
+*
+*              event        Non-zero to start the counter, 0 to stop it.  The DWT counters count fixed
+*                           events, there is nothing else to select.
+*
+* Returns    : OS_TRUE      if the counter is configured.
+*
+*              OS_FALSE     if 'ix' is out of range or the DWT doesn't implement the profiling counters.
+*
+* Note(s)    : 1) The trace subsystem is enabled (DEMCR.TRCENA) if it isn't already, as it is needed for
+*                 the DWT to count.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_PERF_CTR_EN > 0u)
+CPU_BOOLEAN  OS_CPU_PerfCtrCfg (CPU_INT08U  ix,
+                                CPU_INT32U  event)
+{
+    CPU_INT32U  bit;
+    CPU_SR_ALLOC();
+
+
+    if (ix >= OS_CPU_PERF_CTR_NBR) {
+        return (OS_FALSE);
+    }
+
+    CPU_CRITICAL_ENTER();
+    OS_CPU_REG_DEM_CR |= OS_CPU_DEM_CR_TRCENA;                  /* See Note #1.                                         */
+    if ((OS_CPU_REG_DWT_CTRL & OS_CPU_DWT_CTRL_NOPRFCNT) != 0u) {
+        CPU_CRITICAL_EXIT();
+        return (OS_FALSE);
+    }
+    bit = OS_CPU_DWT_CTRL_CPIEVTENA << ix;
+    if (event != 0u) {
+        OS_CPU_REG_DWT_CTRL |=  bit;
+    } else {
+        OS_CPU_REG_DWT_CTRL &= ~bit;
+    }
+    CPU_CRITICAL_EXIT();
+
+    return (OS_TRUE);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         INITIALIZE SYS TICK
+*
+* Description: Initialize the SysTick using the CPU clock frequency.
+*
+* Arguments  : cpu_freq         CPU clock frequency.
+*
+* Note(s)    : 1) This function MUST be called after OSStart() & after processor initialization.
+*
+*              2) Either OS_CPU_SysTickInitFreq or OS_CPU_SysTickInit() can be called.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_SysTickInitFreq (CPU_INT32U  cpu_freq)
+{
+#if (OS_CFG_TICK_EN > 0u)
+    CPU_INT32U  cnts;
+
+
+    cnts = (cpu_freq / (CPU_INT32U)OS_TICK_RATE_HZ);            /* Determine nbr SysTick cnts between two OS tick intr. */
+
+    OS_CPU_SysTickInit(cnts);
+#else
+    (void)cpu_freq;
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                         INITIALIZE SYS TICK
+*
+* Description: Initialize the SysTick using the number of countes between two ticks.
+*
+* Arguments  : cnts         Number of SysTick counts between two OS tick interrupts.
+*
+* Note(s)    : 1) This function MUST be called after OSStart() & after processor initialization.
+*
+*              2) Either OS_CPU_SysTickInitFreq or OS_CPU_SysTickInit() can be called.
+*
+*              3) In Dynamic Tick Mode, 'cnts' is the number of SysTick counts per OS tick and the first
+*                 period is programmed from the tick step the kernel already requested (OSTickCtrStep).
+*********************************************************************************************************
+*/
+
+void  OS_CPU_SysTickInit (CPU_INT32U  cnts)
+{
+#if (OS_CFG_TICK_EN > 0u)
+    CPU_INT32U  prio;
+    CPU_INT32U  basepri;
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    CPU_SR_ALLOC();
+#endif
+
+
+                                                                /* Set BASEPRI boundary from the configuration.         */
+    basepri             = (CPU_INT32U)(CPU_CFG_KA_IPL_BOUNDARY << (8u - CPU_CFG_NVIC_PRIO_BITS));
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    CPU_CRITICAL_ENTER();
+    OS_CPU_DynTickCnts  = cnts;                                 /* See Note #3.                                         */
+    (void)OS_CPU_DynTickArm(OSTickCtrStep, 0u);
+    CPU_CRITICAL_EXIT();
+#else
+    CPU_REG_SYST_RVR    = cnts - 1u;                            /* Set Reload Register                                  */
+#endif
+
+                                                                /* Set SysTick handler prio.                            */
+    prio                = CPU_REG_SCB_SHPRI3;
+    prio               &= 0x00FFFFFFu;
+    prio               |= (basepri << 24u);
+
+    CPU_REG_SCB_SHPRI3  = prio;
+
+                                                                /* Enable timer.                                        */
+    CPU_REG_SYST_CSR   |= CPU_REG_SYST_CSR_CLKSOURCE |
+                          CPU_REG_SYST_CSR_ENABLE;
+
+    CPU_REG_SYST_CSR   |= CPU_REG_SYST_CSR_TICKINT;             /* Enable timer interrupt.                              */
+#else
+    (void)cnts;
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                        CHANGE SYS TICK RATE
+*
+* Description: Reprogram the SysTick for a new OS tick rate.  Called by OSTickRateSet() through
+*              OS_CPU_TICK_RATE_SET() with interrupts disabled.
+*
+* Arguments  : rate_hz_prev   OS tick rate the SysTick is currently programmed for.
+*
+*              rate_hz        New OS tick rate.
+*
+* Note(s)    : 1) The SysTick clock is derived from the current reload value, so the CPU frequency doesn't
+*                 have to be known here.  The reload value is clamped to the 24-bit range of the SysTick.
+*
+*              2) The current count is cleared so the first period at the new rate is a full one.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_TICK_RATE_SET_EN > 0u)
+void  OS_CPU_SysTickRateSet (CPU_INT32U  rate_hz_prev,
+                             CPU_INT32U  rate_hz)
+{
+    CPU_INT64U  cnts;
+
+
+    cnts = (((CPU_INT64U)CPU_REG_SYST_RVR + 1u) * rate_hz_prev) / rate_hz;
+    if (cnts > ((CPU_INT64U)OS_CPU_SYST_RVR_MAX + 1u)) {        /* See Note #1.                                         */
+        cnts = (CPU_INT64U)OS_CPU_SYST_RVR_MAX + 1u;
+    }
+    if (cnts < 2u) {
+        cnts = 2u;
+    }
+
+    CPU_REG_SYST_RVR    = (CPU_INT32U)(cnts - 1u);              /* Set Reload Register                                  */
+    OS_CPU_REG_SYST_CVR = 0u;                                   /* See Note #2.                                         */
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          GET DYNAMIC TICK
+*
+* Description: Return the number of OS ticks that elapsed since the kernel last programmed the tick.
+*
+* Arguments  : None.
+*
+* Returns    : The number of elapsed ticks, between 0 and the number of ticks programmed, inclusive.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and is called with kernel-aware interrupts
+*                 disabled.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+OS_TICK  OS_DynTickGet (void)
+{
+    CPU_INT32U  ticks;
+
+
+    if (OS_CPU_DynTickCnts == 0u) {                             /* SysTick not initialized yet.                         */
+        return (0u);
+    }
+
+    ticks = OS_CPU_DynTickCntsGet() / OS_CPU_DynTickCnts;
+    if (ticks > OS_CPU_DynTickDelta) {
+        ticks = OS_CPU_DynTickDelta;
+    }
+
+    return ((OS_TICK)ticks);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SET DYNAMIC TICK
+*
+* Description: Program the SysTick to interrupt once the given number of OS ticks have elapsed.
+*
+* Arguments  : ticks        Number of ticks to the next tick interrupt, 0 for an indefinite delay.
+*
+* Returns    : The number of ticks that will actually elapse before the next tick interrupt.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and is called with kernel-aware interrupts
+*                 disabled, after the ticks returned by OS_DynTickGet() were added to OSTickCtr.
+*
+*              2) The new period is measured from the last tick boundary, not from the time of the
+*                 call.  The counts of the partial tick in progress are carried over, so reprogramming
+*                 the SysTick, however often, does not make OSTickCtr drift.
+*
+*              3) SysTick is a 24-bit counter.  A longer delay, or an indefinite one, is cut to the
+*                 longest period it can count and the kernel programs the rest on the next interrupt.
+*
+*              4) Until OS_CPU_SysTickInit() is called there is nothing to program.  The pending step
+*                 (OSTickCtrStep) is programmed by OS_CPU_SysTickInit() itself.
+*********************************************************************************************************
+*/
+
+OS_TICK  OS_DynTickSet (OS_TICK  ticks)
+{
+    CPU_INT32U  phase;
+
+
+    if (OS_CPU_DynTickCnts == 0u) {                             /* See Note #4.                                         */
+        return (ticks);
+    }
+
+    phase = OS_CPU_DynTickCntsGet() % OS_CPU_DynTickCnts;       /* See Note #2.                                         */
+
+    return (OS_CPU_DynTickArm(ticks, phase));
+}
+
+
+/*
+*********************************************************************************************************
+*                                     DYNAMIC TICK ELAPSED COUNTS
+*
+* Description: Return the number of SysTick counts since the tick boundary the current period is
+*              measured from.
+*
+* Arguments  : None.
+*
+* Returns    : The number of elapsed SysTick counts.
+*
+* Note(s)    : 1) If the period expired while interrupts were disabled, the SysTick interrupt is still
+*                 pending: the whole period is added to the counts read after the expiry.
+*
+*              2) The counter reads 0 right after it is restarted and when it expires.  It is reloaded
+*                 on the following count.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  OS_CPU_DynTickCntsGet (void)
+{
+    CPU_INT32U  reload;
+    CPU_INT32U  cur;
+    CPU_INT32U  cnts;
+
+
+    reload = CPU_REG_SYST_RVR;
+    cur    = OS_CPU_REG_SYST_CVR;
+    cnts   = 0u;
+    if ((OS_CPU_REG_SCB_ICSR & OS_CPU_SCB_ICSR_PENDSTSET) != 0u) {
+        cur  = OS_CPU_REG_SYST_CVR;                             /* See Note #1.                                         */
+        cnts = reload + 1u;
+    }
+    if (cur != 0u) {                                            /* See Note #2.                                         */
+        cnts += (reload + 1u) - cur;
+    }
+
+    return (OS_CPU_DynTickPhase + cnts);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          ARM DYNAMIC TICK
+*
+* Description: Start a new SysTick period ending 'ticks' OS ticks after the last tick boundary.
+*
+* Arguments  : ticks        Number of ticks in the period, 0 for the longest period.
+*
+*              phase        Number of SysTick counts already elapsed since the last tick boundary.
+*
+* Returns    : The number of ticks programmed.
+*
+* Note(s)    : 1) A SysTick interrupt pending for the previous period is cleared: the kernel already
+*                 accounted for it through OS_DynTickGet().
+*********************************************************************************************************
+*/
+
+static  OS_TICK  OS_CPU_DynTickArm (OS_TICK     ticks,
+                                    CPU_INT32U  phase)
+{
+    OS_TICK     ticks_max;
+    CPU_INT32U  cnts;
+
+
+    ticks_max = (OS_TICK)(OS_CPU_SYST_RVR_MAX / OS_CPU_DynTickCnts);
+    if ((ticks == 0u) ||                                        /* Indefinite delay, or ...                             */
+        (ticks >  ticks_max)) {                                 /* ... longer than SysTick can count.                   */
+        ticks = ticks_max;
+    }
+
+    cnts = ((CPU_INT32U)ticks * OS_CPU_DynTickCnts) - phase;
+    if (cnts < 2u) {                                            /* The reload value must be at least 1.                 */
+        ticks++;
+        cnts += OS_CPU_DynTickCnts;
+    }
+
+    OS_CPU_DynTickPhase = phase;
+    OS_CPU_DynTickDelta = ticks;
+
+    CPU_REG_SYST_RVR    = cnts - 1u;                            /* Set the new period ...                               */
+    OS_CPU_REG_SYST_CVR = 0u;                                   /* ... and restart the count from it.                   */
+    OS_CPU_REG_SCB_ICSR = OS_CPU_SCB_ICSR_PENDSTCLR;            /* See Note #1.                                         */
+
+    return (ticks);
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
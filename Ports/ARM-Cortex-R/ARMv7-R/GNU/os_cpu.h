@@ -38,6 +38,26 @@
 *
 *                 os_cpu_a_vfp-d16.S
 *                   Suitable for cpus with VFP support and 16 double word registers.
+*
+*             (3) OS_CPU_CODE_HOT_SECTION and OS_CPU_VAR_HOT_SECTION can be defined, as strings, to place
+*                 the kernel hot path in Tightly Coupled Memory:
+*
+*                 OS_CPU_CODE_HOT_SECTION
+*                   Receives OSIntEnter(), OSIntExit(), OSSched(), OS_Post(), OS_RdyListInsert...() and
+*                   OS_PrioInsert()/OS_PrioGetHighest().  os_cpu_a_vfp-*.S assembled with the same
+*                   definition puts the context switch and exception code there too.
+*
+*                 OS_CPU_VAR_HOT_SECTION
+*                   Receives the variables read or written on every context switch, interrupt exit and
+*                   tick.  Like .bss, this section MUST be zeroed by the startup code.
+*
+*                 The linker script can then locate them in ATCM and BTCM: their access time no longer
+*                 depends on the caches.
+*
+*             (4) When os_cpu_a_vfp-*.S is assembled with OS_CPU_VECT_IRQ_EN defined to 1, IRQs vectored by
+*                 a VIC port (SCTLR.VE set) enter the kernel through OS_CPU_ARM_ExceptIrqVectHndlr()
+*                 without any software dispatch.  See Note #1 of OS_CPU_ARM_ExceptIrqVectHndlr in
+*                 os_cpu_a_vfp-*.S.
 *********************************************************************************************************
 */
 
@@ -81,6 +101,34 @@ extern  "C" {
 
 #define  OS_TASK_SW()               OSCtxSw()
 
+                                                            /* Data memory barrier, see os_icc.c                    */
+#define  OS_CPU_MEM_BARRIER()       __asm__ __volatile__ ("dmb" : : : "memory")
+
+#ifdef   OS_CPU_CODE_HOT_SECTION                            /* See Note #3.                                           */
+#define  OS_CPU_CODE_HOT            __attribute__((section(OS_CPU_CODE_HOT_SECTION)))
+#endif
+
+#ifdef   OS_CPU_VAR_HOT_SECTION
+#define  OS_CPU_VAR_HOT             __attribute__((section(OS_CPU_VAR_HOT_SECTION)))
+#endif
+
+/*
+*********************************************************************************************************
+*                                          ATOMIC OPERATIONS
+*
+* Note(s) : (1) Used by the OSAtomicxxx() services (see os_atomic.c).  GCC expands the builtins to
+*               LDREX/STREX loops surrounded by DMB.
+*********************************************************************************************************
+*/
+
+#define  OS_CPU_ATOMIC_OPS_EN                             1u
+#define  OS_CPU_ATOMIC_CAS(p_addr, val_old, val_new)    __sync_val_compare_and_swap((p_addr), (val_old), (val_new))
+#define  OS_CPU_ATOMIC_FETCH_ADD(p_addr, val)           __atomic_fetch_add((p_addr), (val), __ATOMIC_SEQ_CST)
+#define  OS_CPU_ATOMIC_LOAD(p_addr)                     __atomic_load_n((p_addr), __ATOMIC_ACQUIRE)
+#define  OS_CPU_ATOMIC_STORE(p_addr, val)               __atomic_store_n((p_addr), (val), __ATOMIC_RELEASE)
+#define  OS_CPU_ATOMIC_XCHG(p_addr, val)                __atomic_exchange_n((p_addr), (val), __ATOMIC_SEQ_CST)
+
+
 /*
 *********************************************************************************************************
 *                                       TIMESTAMP CONFIGURATION
@@ -132,6 +180,7 @@ void        OS_CPU_ARM_ExceptPrefetchAbortHndlr (void);
 void        OS_CPU_ARM_ExceptDataAbortHndlr     (void);
 
 void        OS_CPU_ARM_ExceptIrqHndlr           (void);
+void        OS_CPU_ARM_ExceptIrqVectHndlr       (void);
 void        OS_CPU_ARM_ExceptFiqHndlr           (void);
 
 void        OS_CPU_ExceptHndlr                  (CPU_INT32U  src_id);
@@ -47,6 +47,115 @@ extern  "C" {
 
 #define  OS_TASK_SW()               OSCtxSw()
 
+
+/*
+*********************************************************************************************************
+*                                        CONTEXT SWITCH BACKEND
+*
+* Note(s) : (1) By default, every task is a host thread and a context switch hands a semaphore over from
+*               one thread to the other.
+*
+*           (2) When OS_CPU_POSIX_UCONTEXT_EN is set to 1, all the tasks run on the thread that called
+*               OSStart(), each one on its own uC/OS-III stack, and a context switch is a swapcontext().
+*               The tick is read from a timerfd by the idle task, so the simulated time only advances
+*               while the CPU is idle, and no other simulated interrupt may call uC/OS-III services.
+*               Task stacks must be large enough for the host C library (see os_cpu_c.c).
+*********************************************************************************************************
+*/
+
+#ifndef  OS_CPU_POSIX_UCONTEXT_EN
+#define  OS_CPU_POSIX_UCONTEXT_EN         0u
+#endif
+
+/*
+*********************************************************************************************************
+*                                            VIRTUAL TIME
+*
+* Note(s) : (1) When OS_CPU_VIRTUAL_TIME_EN is set to 1, the tick is not generated from a host timer.
+*               Whenever every task is blocked, the idle task advances OSTickCtr to the next deadline of
+*               the tick list, which includes the timer task's wake-up.  A simulation then runs as fast
+*               as the host allows and is repeatable from one run to the next.
+*
+*           (2) The deadline is only known in Dynamic Tick Mode (OS_CFG_DYN_TICK_EN), in which case this
+*               port provides OS_DynTickGet() and OS_DynTickSet().  In Periodic Tick Mode, the idle task
+*               processes one tick each time it runs instead.
+*
+*           (3) Time does not advance while a task is running: a task that never blocks stops the clock.
+*               High-resolution delays (OS_CFG_TIME_HR_EN) still follow the host timestamp.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_CPU_VIRTUAL_TIME_EN
+#define  OS_CPU_VIRTUAL_TIME_EN           0u
+#endif
+
+/*
+*********************************************************************************************************
+*                                            DYNAMIC TICK
+*
+* Note(s) : (1) In Dynamic Tick Mode (OS_CFG_DYN_TICK_EN) with host time, this port provides
+*               OS_DynTickGet() and OS_DynTickSet().  The tick is a one-shot host timer armed for the
+*               next deadline of the tick list, so a simulation whose tasks are all blocked does not wake
+*               the host up at OS_CFG_TICK_RATE_HZ.
+*
+*           (2) By default, the timer is a POSIX timer (timer_create()) that triggers the simulated tick
+*               interrupt with CPU_InterruptTrigger().  With OS_CPU_POSIX_UCONTEXT_EN, it is the timerfd
+*               read by the idle task.  Linking may require '-lrt' with older C libraries.
+*
+*           (3) Ticks are counted on CLOCK_MONOTONIC from the last tick boundary.  A timer that expires
+*               late reports all the ticks that elapsed, so OSTickCtr does not fall behind the host.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                         TICK RECORD/REPLAY
+*
+* Note(s) : (1) With OS_CPU_POSIX_UCONTEXT_EN, ticks are only processed by the idle task.  The only
+*               thing the host decides is how many ticks the idle task finds pending each time it runs.
+*               When OS_CPU_TICK_REPLAY_EN is set to 1, those numbers can be recorded with
+*               OS_CPU_TickRecStart() and fed back with OS_CPU_TickReplayStart(), which makes a run
+*               repeatable.
+*
+*           (2) Each record holds the value of OSTaskCtxSwCtr when the ticks were processed.  A replay
+*               that does not reach the same count is diverging from the recorded run: the port then
+*               stops the simulation.
+*
+*           (3) Record/replay requires Periodic Tick Mode.  Timestamps (OS_TS_GET()) still follow the
+*               host, so features that depend on them are not replayed.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_CPU_TICK_REPLAY_EN
+#define  OS_CPU_TICK_REPLAY_EN            0u
+#endif
+
+#if (OS_CPU_TICK_REPLAY_EN > 0u)
+typedef  struct  os_cpu_tick_rec {
+    OS_CTX_SW_CTR  CtxSwCtr;                                /* OSTaskCtxSwCtr when the ticks were processed           */
+    OS_TICK        Ticks;                                   /* Number of ticks processed                              */
+} OS_CPU_TICK_REC;
+#endif
+
+/*
+*********************************************************************************************************
+*                                          ATOMIC OPERATIONS
+*
+* Note(s) : (1) Used by the OSAtomicxxx() services (see os_atomic.c).  The builtins are the host
+*               atomics, which also order the accesses between the host threads that run the tasks and
+*               the simulated interrupts.
+*********************************************************************************************************
+*/
+
+#define  OS_CPU_ATOMIC_OPS_EN                             1u
+#define  OS_CPU_ATOMIC_CAS(p_addr, val_old, val_new)    __sync_val_compare_and_swap((p_addr), (val_old), (val_new))
+#define  OS_CPU_ATOMIC_FETCH_ADD(p_addr, val)           __atomic_fetch_add((p_addr), (val), __ATOMIC_SEQ_CST)
+#define  OS_CPU_ATOMIC_FETCH_OR(p_addr, val)            __atomic_fetch_or((p_addr), (val), __ATOMIC_SEQ_CST)
+#define  OS_CPU_ATOMIC_LOAD(p_addr)                     __atomic_load_n((p_addr), __ATOMIC_ACQUIRE)
+#define  OS_CPU_ATOMIC_STORE(p_addr, val)               __atomic_store_n((p_addr), (val), __ATOMIC_RELEASE)
+#define  OS_CPU_ATOMIC_XCHG(p_addr, val)                __atomic_exchange_n((p_addr), (val), __ATOMIC_SEQ_CST)
+
+
 /*
 *********************************************************************************************************
 *                                       TIMESTAMP CONFIGURATION
@@ -85,6 +194,16 @@ void         OSStartHighRdy     (void);
 
 void         OS_CPU_SysTickInit (void);
 
+#if (OS_CPU_TICK_REPLAY_EN > 0u)
+void         OS_CPU_TickRecStart    (OS_CPU_TICK_REC        *p_tbl,
+                                     CPU_SIZE_T              size);
+
+CPU_SIZE_T   OS_CPU_TickRecStop     (void);
+
+void         OS_CPU_TickReplayStart (OS_CPU_TICK_REC  const *p_tbl,
+                                     CPU_SIZE_T              nbr);
+#endif
+
 
 
 #ifdef __cplusplus
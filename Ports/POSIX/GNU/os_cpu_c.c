@@ -57,6 +57,10 @@ const  CPU_CHAR  *os_cpu_c__c = "$Id: $";
 #include  <sys/syscall.h>
 #include  <sys/resource.h>
 #include  <errno.h>
+#if (OS_CPU_POSIX_UCONTEXT_EN > 0u)
+#include  <ucontext.h>
+#include  <sys/timerfd.h>
+#endif
 
 
 #ifdef __cplusplus
@@ -72,6 +76,14 @@ extern  "C" {
 
 #define  THREAD_CREATE_PRIO       50u                           /* Tasks underlying posix threads prio.                 */
 
+#if (OS_CFG_DYN_TICK_EN > 0u) && (OS_CPU_VIRTUAL_TIME_EN == 0u)
+#define  DYN_TICK_HOST_EN          1u                           /* Dynamic tick on host time, see os_cpu.h.             */
+#else
+#define  DYN_TICK_HOST_EN          0u
+#endif
+
+#define  TICK_PERIOD_NS           (1000000000uLL / OS_CFG_TICK_RATE_HZ)
+
                                                                 /* Err handling convenience macro.                      */
 #define  ERR_CHK(func)            do {int res = func; \
                                       if (res != 0u) { \
@@ -88,10 +100,14 @@ extern  "C" {
 */
 
 typedef  struct  os_tcb_ext_posix {
-    pthread_t  Thread;
-    pid_t      ProcessId;
-    sem_t      InitSem;
-    sem_t      Sem;
+#if (OS_CPU_POSIX_UCONTEXT_EN > 0u)
+    ucontext_t  Ctx;                                            /* Task context, see OSCtxSw()                          */
+#else
+    pthread_t   Thread;
+    pid_t       ProcessId;
+    sem_t       InitSem;
+    sem_t       Sem;
+#endif
 } OS_TCB_EXT_POSIX;
 
 
@@ -101,16 +117,44 @@ typedef  struct  os_tcb_ext_posix {
 *********************************************************************************************************
 */
 
+#if (OS_CPU_POSIX_UCONTEXT_EN > 0u)
+static  void        OSTaskUcontext        (void);
+#else
 static  void       *OSTaskPosix           (void       *p_arg);
 
-static  void        OSTaskTerminate       (OS_TCB     *p_tcb);
-
 static  void        OSThreadCreate        (pthread_t  *p_thread,
                                            void       *p_task,
                                            void       *p_arg,
                                            int         prio);
+#endif
 
+#if (OS_CPU_POSIX_UCONTEXT_EN == 0u) && (OS_CPU_VIRTUAL_TIME_EN == 0u)
 static  void        OSTimeTickHandler     (void);
+#endif
+
+#if (DYN_TICK_HOST_EN > 0u)
+static  CPU_INT64U  OSTickDynNow          (void);
+
+static  CPU_INT64U  OSTickDynElapsed      (void);
+
+static  OS_TICK     OSTickDynExpire       (void);
+
+static  void        OSTickDynArm          (void);
+
+#if (OS_CPU_POSIX_UCONTEXT_EN == 0u)
+static  void        OSTickDynTmrHandler   (union sigval  val);
+#endif
+#endif
+
+static  void        OSTaskTerminate       (OS_TCB     *p_tcb);
+
+#if (OS_CPU_POSIX_UCONTEXT_EN > 0u) && (OS_CPU_VIRTUAL_TIME_EN == 0u)
+static  CPU_INT64U  OSTickTmrWait         (void);
+#endif
+
+#if (OS_CPU_TICK_REPLAY_EN > 0u)
+static  CPU_INT64U  OSTickRecReplay       (void);
+#endif
 
 
 /*
@@ -119,6 +163,27 @@ static  void        OSTimeTickHandler     (void);
 *********************************************************************************************************
 */
 
+#if (OS_CPU_POSIX_UCONTEXT_EN > 0u)
+static  ucontext_t         OSMainCtx;                           /* Context of the thread that called OSStart()          */
+#endif
+
+#if (OS_CPU_VIRTUAL_TIME_EN > 0u)
+static  CPU_BOOLEAN        OSTickVirtRun  = 0u;                 /* Set by OS_CPU_SysTickInit()                          */
+#if (OS_CFG_DYN_TICK_EN > 0u)
+static  OS_TICK            OSTickVirtStep = 0u;                 /* Ticks to the next deadline, 0 if there is none       */
+#endif
+#elif (OS_CPU_POSIX_UCONTEXT_EN > 0u)
+static  int                OSTickTmrFd = -1;                    /* Tick timer, read by the idle task                    */
+#elif (OS_CFG_DYN_TICK_EN > 0u)
+static  timer_t            OSTickDynTmr;                        /* One-shot tick timer, see OS_DynTickSet()             */
+                                                                                            /* Tick interrupt cfg.      */
+static  CPU_INTERRUPT      OSTickDynInterrupt = { .NamePtr  = "Tick tmr interrupt",
+                                                  .Prio     =  10u,
+                                                  .TraceEn  =  0u,
+                                                  .ISR_Fnct =  OSTimeTickHandler,
+                                                  .En       =  1u
+                                                };
+#else
                                                                                             /* Tick timer cfg.          */
 static  CPU_TMR_INTERRUPT  OSTickTmrInterrupt = { .Interrupt.NamePtr  = "Tick tmr interrupt",
                                                   .Interrupt.Prio     =  10u,
@@ -129,6 +194,22 @@ static  CPU_TMR_INTERRUPT  OSTickTmrInterrupt = { .Interrupt.NamePtr  = "Tick tm
                                                   .PeriodSec          =  0u,
                                                   .PeriodMuSec        = (1000000u / OS_CFG_TICK_RATE_HZ)
                                                 };
+#endif
+
+#if (DYN_TICK_HOST_EN > 0u)
+static  CPU_BOOLEAN        OSTickDynRun  = 0u;                  /* Set by OS_CPU_SysTickInit()                          */
+static  CPU_INT64U         OSTickDynBase = 0u;                  /* CLOCK_MONOTONIC time of the last tick boundary (ns)  */
+static  OS_TICK            OSTickDynStep = 0u;                  /* Ticks programmed by OS_DynTickSet(), 0 if none       */
+#endif
+
+#if (OS_CPU_TICK_REPLAY_EN > 0u)                                /* Tick record/replay, see os_cpu.h                     */
+static  OS_CPU_TICK_REC        *OSTickRecTbl    = (OS_CPU_TICK_REC *)0;
+static  CPU_SIZE_T              OSTickRecSize   = 0u;
+static  CPU_SIZE_T              OSTickRecNbr    = 0u;
+static  OS_CPU_TICK_REC  const *OSTickReplayTbl = (OS_CPU_TICK_REC *)0;
+static  CPU_SIZE_T              OSTickReplayNbr = 0u;
+static  CPU_SIZE_T              OSTickReplayIx  = 0u;
+#endif
 
 
 /*
@@ -137,10 +218,23 @@ static  CPU_TMR_INTERRUPT  OSTickTmrInterrupt = { .Interrupt.NamePtr  = "Tick tm
 *********************************************************************************************************
 */
 
-#if (OS_CFG_TICK_RATE_HZ > 100u)
+#if (OS_CFG_TICK_RATE_HZ > 100u) && (OS_CPU_POSIX_UCONTEXT_EN == 0u) && (OS_CPU_VIRTUAL_TIME_EN == 0u) && \
+    (OS_CFG_DYN_TICK_EN  == 0u)
 #warning "Time accuracy cannot be maintained with OS_CFG_TICK_RATE_HZ > 100u.\n\n",
 #endif
 
+#if (OS_CPU_TICK_REPLAY_EN > 0u)
+#if (OS_CPU_POSIX_UCONTEXT_EN == 0u) || (OS_CPU_VIRTUAL_TIME_EN > 0u)
+#error  "OS_CPU_TICK_REPLAY_EN requires OS_CPU_POSIX_UCONTEXT_EN, with host time (OS_CPU_VIRTUAL_TIME_EN == 0)"
+#endif
+#if (OS_CFG_DYN_TICK_EN > 0u)
+#error  "OS_CPU_TICK_REPLAY_EN requires Periodic Tick Mode (OS_CFG_DYN_TICK_EN == 0)"
+#endif
+#if (OS_CFG_TASK_PROFILE_EN == 0u) && (OS_CFG_DBG_EN == 0u)
+#error  "OS_CPU_TICK_REPLAY_EN requires OSTaskCtxSwCtr (OS_CFG_TASK_PROFILE_EN or OS_CFG_DBG_EN)"
+#endif
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -151,19 +245,91 @@ static  CPU_TMR_INTERRUPT  OSTickTmrInterrupt = { .Interrupt.NamePtr  = "Tick tm
 *
 * Arguments  : None.
 *
-* Note(s)    : None.
+* Note(s)    : 1) With OS_CPU_POSIX_UCONTEXT_EN, the idle task waits for the tick timer and runs the
+*                 tick interrupt itself.  Ticks missed while the tasks were busy are all processed at once.
+*
+*              2) With OS_CPU_VIRTUAL_TIME_EN, the idle task running means that every task is blocked, so
+*                 nothing can happen before the next deadline.  In Dynamic Tick Mode, the ticks are advanced
+*                 straight to that deadline, the one programmed by OS_DynTickSet().  In Periodic Tick Mode, a
+*                 single tick is processed each time the idle task runs.
+*
+*              3) With OS_CPU_POSIX_UCONTEXT_EN in Dynamic Tick Mode, the timerfd is a one-shot armed by
+*                 OS_DynTickSet().  The idle task sleeps until the next deadline, then processes every tick
+*                 elapsed since the last tick boundary at once.
+*
+*              4) With OS_CPU_TICK_REPLAY_EN, the number of ticks processed is recorded or, during a
+*                 replay, taken from the log instead of the tick timer (see OS_CPU_TickReplayStart()).
 *********************************************************************************************************
 */
 
 void  OSIdleTaskHook (void)
 {
+#if (OS_CPU_VIRTUAL_TIME_EN > 0u) && (OS_CFG_DYN_TICK_EN > 0u)
+    OS_TICK     ticks;
+#elif (OS_CPU_VIRTUAL_TIME_EN == 0u) && (OS_CPU_POSIX_UCONTEXT_EN > 0u)
+    CPU_INT64U  ticks;
+#endif
+
+
 #if OS_CFG_APP_HOOKS_EN > 0u
     if (OS_AppIdleTaskHookPtr != (OS_APP_HOOK_VOID)0) {
         (*OS_AppIdleTaskHookPtr)();
     }
 #endif
 
+#if (OS_CPU_VIRTUAL_TIME_EN > 0u)
+    if (OSTickVirtRun == 0u) {                                  /* Tick not started yet.                                */
+        sleep(1u);
+        return;
+    }
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    ticks = OSTickVirtStep;
+    if (ticks == 0u) {                                          /* Nothing to wait for but a simulated interrupt.       */
+        sleep(1u);
+        return;
+    }
+
+    OSIntEnter();
+    OSTimeDynTick(ticks);                                       /* See Note #2.                                         */
+    OSIntExit();
+#else
+    OSIntEnter();
+    OSTimeTick();                                               /* See Note #2.                                         */
+    OSIntExit();
+#endif
+#elif (OS_CPU_POSIX_UCONTEXT_EN > 0u)
+    if (OSTickTmrFd < 0) {                                      /* Tick not started yet.                                */
+        sleep(1u);
+        return;
+    }
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    (void)OSTickTmrWait();
+    ticks = OSTickDynExpire();                                  /* See Note #3.                                         */
+    if (ticks == 0u) {
+        return;
+    }
+
+    OSIntEnter();
+    OSTimeDynTick((OS_TICK)ticks);
+    OSIntExit();
+#else
+#if (OS_CPU_TICK_REPLAY_EN > 0u)
+    ticks = OSTickRecReplay();                                  /* See Note #4.                                         */
+#else
+    ticks = OSTickTmrWait();
+#endif
+    OSIntEnter();
+    while (ticks > 0u) {                                        /* See Note #1.                                         */
+        OSTimeTick();
+        ticks--;
+    }
+    OSIntExit();
+#endif
+#else
     sleep(1u);                                                  /* Reduce CPU utilization.                              */
+#endif
 }
 
 
@@ -182,14 +348,16 @@ void  OSIdleTaskHook (void)
 
 void  OSInitHook (void)
 {
+#if (OS_CPU_POSIX_UCONTEXT_EN == 0u)
     struct  rlimit  rtprio_limits;
 
 
-    ERR_CHK(getrlimit(RLIMIT_RTPRIO, &rtprio_limits));
+    ERR_CHK(getrlimit(RLIMIT_RTPRIO, &rtprio_limits));          /* Host threads are only needed without ucontext.       */
     if (rtprio_limits.rlim_cur != RLIM_INFINITY) {
         printf("Error: RTPRIO limit is too low. Set to 'unlimited' via 'ulimit -r' or /etc/security/limits.conf\r\n");
         exit(-1);
     }
+#endif
 
     CPU_IntInit();                                              /* Initialize critical section objects.                 */
 }
@@ -233,7 +401,9 @@ void  OSStatTaskHook (void)
 void  OSTaskCreateHook (OS_TCB  *p_tcb)
 {
     OS_TCB_EXT_POSIX  *p_tcb_ext;
+#if (OS_CPU_POSIX_UCONTEXT_EN == 0u)
     int                ret;
+#endif
 
 
 #if OS_CFG_APP_HOOKS_EN > 0u
@@ -245,6 +415,13 @@ void  OSTaskCreateHook (OS_TCB  *p_tcb)
     p_tcb_ext = malloc(sizeof(OS_TCB_EXT_POSIX));
     p_tcb->ExtPtr = p_tcb_ext;
 
+#if (OS_CPU_POSIX_UCONTEXT_EN > 0u)
+    ERR_CHK(getcontext(&p_tcb_ext->Ctx));                       /* The task runs on its own uC/OS-III stack.            */
+    p_tcb_ext->Ctx.uc_stack.ss_sp   = p_tcb->StkBasePtr;
+    p_tcb_ext->Ctx.uc_stack.ss_size = (size_t)p_tcb->StkSize * sizeof(CPU_STK);
+    p_tcb_ext->Ctx.uc_link          = (ucontext_t *)0;
+    makecontext(&p_tcb_ext->Ctx, OSTaskUcontext, 0);
+#else
     ERR_CHK(sem_init(&p_tcb_ext->InitSem, 0u, 0u));
     ERR_CHK(sem_init(&p_tcb_ext->Sem, 0u, 0u));
 
@@ -256,6 +433,7 @@ void  OSTaskCreateHook (OS_TCB  *p_tcb)
             raise(SIGABRT);
         }
     } while (ret != 0);
+#endif
 }
 
 
@@ -273,9 +451,11 @@ void  OSTaskCreateHook (OS_TCB  *p_tcb)
 
 void  OSTaskDelHook (OS_TCB  *p_tcb)
 {
+#if (OS_CPU_POSIX_UCONTEXT_EN == 0u)
     OS_TCB_EXT_POSIX  *p_tcb_ext = (OS_TCB_EXT_POSIX *)p_tcb->ExtPtr;
     pthread_t          self;
     CPU_BOOLEAN        same;
+#endif
 
 
 #if OS_CFG_APP_HOOKS_EN > 0u
@@ -284,11 +464,13 @@ void  OSTaskDelHook (OS_TCB  *p_tcb)
     }
 #endif
 
+#if (OS_CPU_POSIX_UCONTEXT_EN == 0u)
      self = pthread_self();
      same = (pthread_equal(self, p_tcb_ext->Thread) != 0u);
      if (same != 1u) {
          ERR_CHK(pthread_cancel(p_tcb_ext->Thread));
      }
+#endif
 
      OSTaskTerminate(p_tcb);
 }
@@ -447,14 +629,19 @@ void  OSTimeTickHook (void)
 * Note(s)    : 1) OSStartHighRdy() MUST:
 *                      a) Call OSTaskSwHook() then,
 *                      b) Switch to the highest priority task.
+*
+*              2) With OS_CPU_POSIX_UCONTEXT_EN, the thread that called OSStart() becomes the first task and
+*                 is never resumed.
 *********************************************************************************************************
 */
 
 void  OSStartHighRdy (void)
 {
     OS_TCB_EXT_POSIX  *p_tcb_ext;
+#if (OS_CPU_POSIX_UCONTEXT_EN == 0u)
     sigset_t           sig_set;
     int                signo;
+#endif
 
 
     OSTaskSwHook();
@@ -463,11 +650,15 @@ void  OSStartHighRdy (void)
 
     CPU_INT_DIS();
 
+#if (OS_CPU_POSIX_UCONTEXT_EN > 0u)
+    ERR_CHK(swapcontext(&OSMainCtx, &p_tcb_ext->Ctx));          /* Never returns.                                       */
+#else
     ERR_CHK(sem_post(&p_tcb_ext->Sem));
 
     ERR_CHK(sigemptyset(&sig_set));
     ERR_CHK(sigaddset(&sig_set, SIGTERM));
     ERR_CHK(sigwait(&sig_set, &signo));
+#endif
 }
 
 
@@ -505,6 +696,10 @@ void  OSStartHighRdy (void)
 *
 *                               Restore processor registers from (OSTCBHighRdy->OSTCBStkPtr);
 *                           }
+*
+*              3) With OS_CPU_POSIX_UCONTEXT_EN, the switch is a swapcontext() between the two tasks, without
+*                 involving the host scheduler.  A task that deleted itself is abandoned with setcontext(),
+*                 its context is never resumed.
 *********************************************************************************************************
 */
 
@@ -512,7 +707,9 @@ void  OSCtxSw (void)
 {
     OS_TCB_EXT_POSIX  *p_tcb_ext_old;
     OS_TCB_EXT_POSIX  *p_tcb_ext_new;
+#if (OS_CPU_POSIX_UCONTEXT_EN == 0u)
     int                ret;
+#endif
     CPU_BOOLEAN        detach = 0u;
 
 
@@ -528,6 +725,13 @@ void  OSCtxSw (void)
     OSTCBCurPtr = OSTCBHighRdyPtr;
     OSPrioCur   = OSPrioHighRdy;
 
+#if (OS_CPU_POSIX_UCONTEXT_EN > 0u)
+    if (detach == 0u) {
+        ERR_CHK(swapcontext(&p_tcb_ext_old->Ctx, &p_tcb_ext_new->Ctx));
+    } else {
+        ERR_CHK(setcontext(&p_tcb_ext_new->Ctx));               /* See Note #3.                                         */
+    }
+#else
     ERR_CHK(sem_post(&p_tcb_ext_new->Sem));
 
     if (detach == 0u) {
@@ -538,6 +742,7 @@ void  OSCtxSw (void)
             }
         } while (ret != 0);
     }
+#endif
 }
 
 
@@ -578,13 +783,222 @@ void  OSIntCtxSw (void)
 * Arguments  : none.
 *
 * Note(s)    : 1) This function MUST be called after OSStart() & after processor initialization.
+*
+*              2) With OS_CPU_POSIX_UCONTEXT_EN, the tick timer is a timerfd that is read by the idle task
+*                 (see OSIdleTaskHook()) instead of a host thread raising a simulated interrupt.
+*
+*              3) With OS_CPU_VIRTUAL_TIME_EN, no host timer is used.  The idle task generates the ticks
+*                 from then on.
+*
+*              4) In Dynamic Tick Mode, the host timer is a one-shot.  It is first armed here, for the
+*                 step the kernel programmed before the tick was started (OSTickCtrStep).
 *********************************************************************************************************
 */
 
 void  OS_CPU_SysTickInit (void)
 {
+#if (OS_CPU_VIRTUAL_TIME_EN > 0u)
+    OSTickVirtRun = 1u;                                         /* See Note #3.                                         */
+#else
+#if (OS_CFG_DYN_TICK_EN > 0u)
+#if (OS_CPU_POSIX_UCONTEXT_EN == 0u)
+    struct  sigevent    sig_evt;
+#endif
+    CPU_SR_ALLOC();
+#elif (OS_CPU_POSIX_UCONTEXT_EN > 0u)
+    struct  itimerspec  period;
+#endif
+
+
+#if (OS_CPU_POSIX_UCONTEXT_EN > 0u)
+    OSTickTmrFd = timerfd_create(CLOCK_MONOTONIC, 0);           /* See Note #2.                                         */
+    if (OSTickTmrFd < 0) {
+        perror("timerfd_create()");
+        raise(SIGABRT);
+    }
+#elif (OS_CFG_DYN_TICK_EN > 0u)
+    memset(&sig_evt, 0, sizeof(sig_evt));
+    sig_evt.sigev_notify          = SIGEV_THREAD;
+    sig_evt.sigev_notify_function = OSTickDynTmrHandler;
+    if (timer_create(CLOCK_MONOTONIC, &sig_evt, &OSTickDynTmr) != 0) {
+        perror("timer_create()");
+        raise(SIGABRT);
+    }
+#endif
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    CPU_CRITICAL_ENTER();
+    OSTickDynBase = OSTickDynNow();                             /* Count the ticks from now on                          */
+    OSTickDynStep = OSTickCtrStep;                              /* See Note #4.                                         */
+    OSTickDynRun  = 1u;
+    OSTickDynArm();
+    CPU_CRITICAL_EXIT();
+#elif (OS_CPU_POSIX_UCONTEXT_EN > 0u)
+    period.it_interval.tv_sec  = 0;
+    period.it_interval.tv_nsec = 1000000000L / OS_CFG_TICK_RATE_HZ;
+    period.it_value            = period.it_interval;
+    ERR_CHK(timerfd_settime(OSTickTmrFd, 0, &period, (struct itimerspec *)0));
+#else
     CPU_TmrInterruptCreate(&OSTickTmrInterrupt);
+#endif
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                          GET DYNAMIC TICK
+*
+* Description: Return the number of OS ticks that elapsed since the kernel last programmed the tick.
+*
+* Arguments  : None.
+*
+* Returns    : With OS_CPU_VIRTUAL_TIME_EN, always 0: virtual time does not advance while a task is
+*              running.  Otherwise, the number of elapsed ticks, between 0 and the number of ticks
+*              programmed, inclusive.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and is called with interrupts disabled.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+OS_TICK  OS_DynTickGet (void)
+{
+#if (OS_CPU_VIRTUAL_TIME_EN > 0u)
+    return (0u);
+#else
+    CPU_INT64U  ticks;
+
+
+    if (OSTickDynRun == 0u) {                                   /* Tick not started yet.                                */
+        return (0u);
+    }
+
+    ticks = OSTickDynElapsed();
+    if ((OSTickDynStep != 0u) && (ticks > OSTickDynStep)) {     /* The tick interrupt is pending.                       */
+        ticks = OSTickDynStep;
+    }
+
+    return ((OS_TICK)ticks);
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SET DYNAMIC TICK
+*
+* Description: Program the tick to occur once the given number of OS ticks have elapsed.
+*
+* Arguments  : ticks        Number of ticks to the next deadline, 0 for an indefinite delay.
+*
+* Returns    : The number of ticks that will elapse before the next tick, always 'ticks'.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and is called with interrupts disabled, after
+*                 the ticks returned by OS_DynTickGet() were added to OSTickCtr.
+*
+*              2) With OS_CPU_VIRTUAL_TIME_EN, the idle task advances the time by that amount when every
+*                 task is blocked (see OSIdleTaskHook()).
+*
+*              3) Otherwise, the new period is measured from the last tick boundary, not from the time
+*                 of the call, and the one-shot host timer is armed for its end.  An indefinite delay
+*                 disarms the timer.  Until OS_CPU_SysTickInit() is called there is nothing to arm.
+*********************************************************************************************************
+*/
+
+OS_TICK  OS_DynTickSet (OS_TICK  ticks)
+{
+#if (OS_CPU_VIRTUAL_TIME_EN > 0u)
+    OSTickVirtStep = ticks;                                     /* See Note #2.                                         */
+#else
+    CPU_INT64U  elapsed;
+
+
+    if (OSTickDynRun == 0u) {                                   /* See Note #3.                                         */
+        return (ticks);
+    }
+
+    elapsed = OSTickDynElapsed();
+    if ((OSTickDynStep != 0u) && (elapsed > OSTickDynStep)) {
+        elapsed = OSTickDynStep;
+    }
+    OSTickDynBase += elapsed * TICK_PERIOD_NS;                  /* Move to the last tick boundary.                      */
+    OSTickDynStep  = ticks;
+    OSTickDynArm();
+#endif
+
+    return (ticks);
+}
+#endif
+
+
+#if (OS_CPU_TICK_REPLAY_EN > 0u)
+/*
+*********************************************************************************************************
+*                                          START/STOP TICK RECORDING
+*
+* Description: OS_CPU_TickRecStart() records, from then on, the number of ticks the idle task processes
+*              each time it finds some pending, along with OSTaskCtxSwCtr.  OS_CPU_TickRecStop() stops
+*              the recording.
+*
+* Arguments  : p_tbl        is a pointer to the table the records are written to.
+*
+*              size         is the number of entries in 'p_tbl'.
+*
+* Returns    : OS_CPU_TickRecStop() returns the number of records written to 'p_tbl'.
+*
+* Note(s)    : 1) The recording stops by itself when 'p_tbl' is full.  Saving the table, to a file for
+*                 instance, is up to your application.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_TickRecStart (OS_CPU_TICK_REC  *p_tbl,
+                           CPU_SIZE_T        size)
+{
+    OSTickRecTbl  = p_tbl;
+    OSTickRecSize = size;
+    OSTickRecNbr  = 0u;
+}
+
+
+CPU_SIZE_T  OS_CPU_TickRecStop (void)
+{
+    OSTickRecTbl  = (OS_CPU_TICK_REC *)0;
+    OSTickRecSize = 0u;
+
+    return (OSTickRecNbr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            START TICK REPLAY
+*
+* Description: Replay the ticks recorded by OS_CPU_TickRecStart().  From then on, the idle task processes
+*              the ticks of the next record instead of waiting for the tick timer.
+*
+* Arguments  : p_tbl        is a pointer to the records to replay.
+*
+*              nbr          is the number of records in 'p_tbl'.
+*
+* Returns    : None.
+*
+* Note(s)    : 1) The replay must be started from the same point of the application as the recording,
+*                 usually before OSStart().  The simulation is stopped (SIGABRT) if OSTaskCtxSwCtr does
+*                 not match the record when the idle task reaches it.
+*
+*              2) Once every record was replayed, the ticks come from the tick timer again.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_TickReplayStart (OS_CPU_TICK_REC  const  *p_tbl,
+                              CPU_SIZE_T               nbr)
+{
+    OSTickReplayTbl = p_tbl;
+    OSTickReplayNbr = nbr;
+    OSTickReplayIx  = 0u;
 }
+#endif
 
 
 /*
@@ -595,15 +1009,280 @@ void  OS_CPU_SysTickInit (void)
 *********************************************************************************************************
 */
 
+#if (OS_CPU_POSIX_UCONTEXT_EN == 0u) && (OS_CPU_VIRTUAL_TIME_EN == 0u)
 static  void  OSTimeTickHandler (void)
 {
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    OS_TICK  ticks;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    ticks = OSTickDynExpire();
+    CPU_CRITICAL_EXIT();
+    if (ticks == 0u) {
+        CPU_ISR_End();
+        return;
+    }
+
+    OSIntEnter();
+    OSTimeDynTick(ticks);                                       /* The kernel programs the next period.                 */
+#else
     OSIntEnter();
     OSTimeTick();
+#endif
     CPU_ISR_End();
     OSIntExit();
 }
+#endif
+
+
+#if (DYN_TICK_HOST_EN > 0u)
+/*
+*********************************************************************************************************
+*                                           OSTickDynNow()
+*
+* Description: Return the host time, in nanoseconds.
+*
+* Arguments  : None.
+*********************************************************************************************************
+*/
+
+static  CPU_INT64U  OSTickDynNow (void)
+{
+    struct  timespec  ts;
+
+
+    ERR_CHK(clock_gettime(CLOCK_MONOTONIC, &ts));
+
+    return (((CPU_INT64U)ts.tv_sec * 1000000000uLL) + (CPU_INT64U)ts.tv_nsec);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         OSTickDynElapsed()
+*
+* Description: Return the number of whole OS ticks elapsed since the last tick boundary.
+*
+* Arguments  : None.
+*********************************************************************************************************
+*/
+
+static  CPU_INT64U  OSTickDynElapsed (void)
+{
+    return ((OSTickDynNow() - OSTickDynBase) / TICK_PERIOD_NS);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          OSTickDynExpire()
+*
+* Description: Account for the expiry of the one-shot host timer.
+*
+* Arguments  : None.
+*
+* Returns    : The number of ticks to process, 0 if the period programmed by OS_DynTickSet() has not
+*              ended yet.
+*
+* Note(s)    : 1) The timer may have expired for a period that OS_DynTickSet() replaced since.  Its
+*                 expiry is then ignored, the timer is already armed for the new period.
+*
+*              2) All the ticks elapsed are returned, not just the ones programmed, so a late expiry
+*                 does not make OSTickCtr fall behind.
+*********************************************************************************************************
+*/
+
+static  OS_TICK  OSTickDynExpire (void)
+{
+    CPU_INT64U  ticks;
+
+
+    ticks = OSTickDynElapsed();
+    if ((OSTickDynStep == 0u) ||                                /* See Note #1.                                         */
+        (ticks < OSTickDynStep)) {
+        return (0u);
+    }
+
+    OSTickDynBase += ticks * TICK_PERIOD_NS;                    /* See Note #2.                                         */
+
+    return ((OS_TICK)ticks);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           OSTickDynArm()
+*
+* Description: Arm the one-shot host timer for the end of the period programmed by OS_DynTickSet(), or
+*              disarm it for an indefinite delay.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) The expiry is an absolute time.  One that already passed makes the timer expire at once.
+*********************************************************************************************************
+*/
+
+static  void  OSTickDynArm (void)
+{
+    struct  itimerspec  expiry;
+    CPU_INT64U          ns;
+
+
+    expiry.it_interval.tv_sec  = 0;
+    expiry.it_interval.tv_nsec = 0;
+    if (OSTickDynStep == 0u) {
+        ns = 0u;                                                /* A zero expiry disarms the timer.                     */
+    } else {
+        ns = OSTickDynBase + ((CPU_INT64U)OSTickDynStep * TICK_PERIOD_NS);
+    }
+    expiry.it_value.tv_sec     = (time_t)(ns / 1000000000uLL);
+    expiry.it_value.tv_nsec    = (long)  (ns % 1000000000uLL);
+
+#if (OS_CPU_POSIX_UCONTEXT_EN > 0u)
+    ERR_CHK(timerfd_settime(OSTickTmrFd, TFD_TIMER_ABSTIME, &expiry, (struct itimerspec *)0));
+#else
+    ERR_CHK(timer_settime(OSTickDynTmr, TIMER_ABSTIME, &expiry, (struct itimerspec *)0));
+#endif
+}
+
+
+#if (OS_CPU_POSIX_UCONTEXT_EN == 0u)
+/*
+*********************************************************************************************************
+*                                       OSTickDynTmrHandler()
+*
+* Description: Raise the simulated tick interrupt when the one-shot host timer expires.
+*
+* Arguments  : val          Unused.
+*
+* Note(s)    : 1) This function runs on a host thread created by the C library (SIGEV_THREAD).
+*********************************************************************************************************
+*/
+
+static  void  OSTickDynTmrHandler (union sigval  val)
+{
+    (void)val;
+
+    CPU_InterruptTrigger(&OSTickDynInterrupt);
+}
+#endif
+#endif
+
+
+#if (OS_CPU_POSIX_UCONTEXT_EN > 0u) && (OS_CPU_VIRTUAL_TIME_EN == 0u)
+/*
+*********************************************************************************************************
+*                                          OSTickTmrWait()
+*
+* Description: Wait for the tick timer of the ucontext backend to expire.
+*
+* Arguments  : None.
+*
+* Returns    : The number of expirations since the timer was last read.
+*********************************************************************************************************
+*/
+
+static  CPU_INT64U  OSTickTmrWait (void)
+{
+    CPU_INT64U  ticks;
+    ssize_t     ret;
+
+
+    do {
+        ret = read(OSTickTmrFd, &ticks, sizeof(ticks));         /* Wait for the next tick.                              */
+        if ((ret < 0) && (errno != EINTR)) {
+            raise(SIGABRT);
+        }
+    } while (ret != (ssize_t)sizeof(ticks));
+
+    return (ticks);
+}
+#endif
+
+
+#if (OS_CPU_TICK_REPLAY_EN > 0u)
+/*
+*********************************************************************************************************
+*                                         OSTickRecReplay()
+*
+* Description: Obtain the number of ticks the idle task must process, from the replay log or from the
+*              tick timer, and record it.
+*
+* Arguments  : None.
+*
+* Returns    : The number of ticks to process.
+*********************************************************************************************************
+*/
+
+static  CPU_INT64U  OSTickRecReplay (void)
+{
+    OS_CPU_TICK_REC  const  *p_rec;
+    CPU_INT64U               ticks;
+
+
+    if (OSTickReplayIx < OSTickReplayNbr) {
+        p_rec = &OSTickReplayTbl[OSTickReplayIx];
+        if (p_rec->CtxSwCtr != OSTaskCtxSwCtr) {                /* The run diverged from the recorded one.              */
+            printf("Error: tick replay diverged at record %lu (OSTaskCtxSwCtr %lu, expected %lu)\r\n",
+                   (unsigned long)OSTickReplayIx,
+                   (unsigned long)OSTaskCtxSwCtr,
+                   (unsigned long)p_rec->CtxSwCtr);
+            raise(SIGABRT);
+        }
+        OSTickReplayIx++;
+        ticks = p_rec->Ticks;
+    } else {
+        ticks = OSTickTmrWait();
+    }
+
+    if (OSTickRecNbr < OSTickRecSize) {
+        OSTickRecTbl[OSTickRecNbr].CtxSwCtr = OSTaskCtxSwCtr;
+        OSTickRecTbl[OSTickRecNbr].Ticks    = (OS_TICK)ticks;
+        OSTickRecNbr++;
+    }
+
+    return (ticks);
+}
+#endif
 
 
+#if (OS_CPU_POSIX_UCONTEXT_EN > 0u)
+/*
+*********************************************************************************************************
+*                                      OSTaskUcontext()
+*
+* Description: This function is the entry point of every task context created by OSTaskCreateHook().
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) The task is entered from OSCtxSw() or OSStartHighRdy(), inside the critical section of
+*                 the task that switched to it.  That critical section is left here.
+*********************************************************************************************************
+*/
+
+static  void  OSTaskUcontext (void)
+{
+    OS_TCB  *p_tcb;
+    OS_ERR   err;
+
+
+    p_tcb = OSTCBCurPtr;
+
+#ifdef OS_CFG_MSG_TRACE_EN
+    if (p_tcb->NamePtr != (CPU_CHAR *)0) {
+        printf("Task[%3.1d] '%-32s' running\n", p_tcb->Prio, p_tcb->NamePtr);
+    }
+#endif
+
+    CPU_INT_EN();                                               /* See Note #1.                                         */
+
+    ((void (*)(void *))p_tcb->TaskEntryAddr)(p_tcb->TaskEntryArg);
+
+    OSTaskDel(p_tcb, &err);                                     /* Never returns, see OSCtxSw().                        */
+}
+#else
 /*
 *********************************************************************************************************
 *                                      OSTaskPosix()
@@ -653,6 +1332,7 @@ static void  *OSTaskPosix (void  *p_arg)
 
     return (0u);
 }
+#endif
 
 
 /*
@@ -678,6 +1358,7 @@ static  void  OSTaskTerminate (OS_TCB  *p_tcb)
 }
 
 
+#if (OS_CPU_POSIX_UCONTEXT_EN == 0u)
 /*
 *********************************************************************************************************
 *                                          OSThreadCreate()
@@ -723,6 +1404,7 @@ static  void  OSThreadCreate (pthread_t  *p_thread,
     ERR_CHK(pthread_attr_setschedparam(&attr, &param));
     ERR_CHK(pthread_create(p_thread, &attr, p_task, p_arg));
 }
+#endif
 
 
 #ifdef __cplusplus
@@ -25,7 +25,7 @@
 * For       : RISC-V RV32
 * Toolchain : GNU C Compiler
 *********************************************************************************************************
-* Note(s)   : Hardware FP is not supported.
+* Note(s)   : The FP registers of the F and D extensions are switched lazily (see os_cpu_a.S).
 *********************************************************************************************************
 */
 
@@ -53,6 +53,55 @@ extern  "C" {                                    /* See Note #1.
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*
+* Note(s) : (1) When OS_CPU_IDLE_WFI_EN is enabled, OSIdleTaskHook() stalls the hart until the next
+*               interrupt, see os_cpu_c.c.
+*
+*           (2) Addresses of the machine timer registers used in Dynamic Tick Mode.  The defaults match
+*               the PRCI block at RISCV_PRCI_BASE_ADDR (see os_cpu_a.S).
+*
+*           (3) OS_CPU_CLIC_EN selects the CLIC interrupt entry of os_cpu_a.S and MUST be given the same
+*               value when building os_cpu_a.S (e.g. -DOS_CPU_CLIC_EN=1).  In CLIC mode, the BSP:
+*
+*               (a) Sets mtvec to OS_CPU_CLIC_IntHandler() in CLIC mode and mtvt to the table of the
+*                   interrupt handlers (plain C functions, e.g. SysTick_Handler()).
+*
+*               (b) Makes the machine software interrupt vectored, at the lowest level, with
+*                   OS_CPU_CLIC_SwIntHandler() as its handler, and enables it in the CLIC: the 'mie'
+*                   bits set by OSCtxSw() and OS_CPU_DynTickInit() have no effect in CLIC mode.
+*
+*               (c) Gives the other interrupts a higher level for them to preempt each other.
+*
+*           (4) When the compiler targets the F or D extension, each task stack starts with an FP
+*               context area of OS_CPU_FP_CTX_SIZE CPU_STK elements: f0-f31, fcsr and a word that
+*               tells whether the area holds a context.  It is rounded up to 16 bytes.
+*********************************************************************************************************
+*/
+
+#if defined(__riscv_flen)                         /* See Note #4.                                       */
+#define  OS_CPU_FP_CTX_SIZE           ((((32u * (__riscv_flen / 8u)) + 8u + 15u) / 16u) * (16u / sizeof(CPU_STK)))
+#endif
+
+#ifndef  OS_CPU_IDLE_WFI_EN                       /* See Note #1.                                       */
+#define  OS_CPU_IDLE_WFI_EN             0u
+#endif
+
+#ifndef  OS_CPU_CLIC_EN                           /* See Note #3.                                       */
+#define  OS_CPU_CLIC_EN                 0u
+#endif
+
+#ifndef  OS_CPU_MTIMECMP_ADDR                     /* See Note #2.                                       */
+#define  OS_CPU_MTIMECMP_ADDR           0x44004000u
+#endif
+
+#ifndef  OS_CPU_MTIME_ADDR
+#define  OS_CPU_MTIME_ADDR              0x4400BFF8u
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                               MACROS
@@ -70,6 +119,27 @@ extern  "C" {                                    /* See Note #1.
 #define  OS_TASK_SW()         OSCtxSw()
 
 
+/*
+*********************************************************************************************************
+*                                          ATOMIC OPERATIONS
+*
+* Note(s) : (1) Used by the OSAtomicxxx() services (see os_atomic.c).  With the A extension, GCC expands
+*               the builtins to AMO and LR/SC instructions.  Without it, os_atomic.c falls back to
+*               critical sections.
+*********************************************************************************************************
+*/
+
+#if defined(__riscv_atomic)
+#define  OS_CPU_ATOMIC_OPS_EN                             1u
+#define  OS_CPU_ATOMIC_CAS(p_addr, val_old, val_new)    __sync_val_compare_and_swap((p_addr), (val_old), (val_new))
+#define  OS_CPU_ATOMIC_FETCH_ADD(p_addr, val)           __atomic_fetch_add((p_addr), (val), __ATOMIC_SEQ_CST)
+#define  OS_CPU_ATOMIC_FETCH_OR(p_addr, val)            __atomic_fetch_or((p_addr), (val), __ATOMIC_SEQ_CST)
+#define  OS_CPU_ATOMIC_LOAD(p_addr)                     __atomic_load_n((p_addr), __ATOMIC_ACQUIRE)
+#define  OS_CPU_ATOMIC_STORE(p_addr, val)               __atomic_store_n((p_addr), (val), __ATOMIC_RELEASE)
+#define  OS_CPU_ATOMIC_XCHG(p_addr, val)                __atomic_exchange_n((p_addr), (val), __ATOMIC_SEQ_CST)
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                       TIMESTAMP CONFIGURATION
@@ -104,6 +174,17 @@ extern  "C" {                                    /* See Note #1.
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                          GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+#if defined(__riscv_flen)
+OS_CPU_EXT  CPU_STK  *OS_CPU_FP_CtxCurPtr;      /* FP context area of the running task                */
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                         FUNCTION PROTOTYPES
@@ -114,6 +195,15 @@ void  OSCtxSw       (void);
 void  OSIntCtxSw    (void);
 void  OSStartHighRdy(void);
 
+#if (OS_CPU_CLIC_EN > 0u)
+void  OS_CPU_CLIC_IntHandler  (void);
+void  OS_CPU_CLIC_SwIntHandler(void);
+#endif
+
+#if (OS_CFG_DYN_TICK_EN > 0u)                     /* See OS_CPU_C.C                                    */
+void  OS_CPU_DynTickInit (CPU_INT32U  cnts);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -25,7 +25,7 @@
 * For       : RISC-V RV32
 * Toolchain : GNU C Compiler
 *********************************************************************************************************
-* Note(s)   : Hardware FP is not supported.
+* Note(s)   : The FP registers of the F and D extensions are switched lazily (see os_cpu_a.S).
 *********************************************************************************************************
 */
 
@@ -45,12 +45,47 @@ const  CPU_CHAR  *os_cpu_c__c = "$Id: $";
 #include  "../../../../Source/os.h"
 
 
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+#define  OS_CPU_REG_MTIME_LO           (*((CPU_REG32 *)(OS_CPU_MTIME_ADDR)))
+#define  OS_CPU_REG_MTIME_HI           (*((CPU_REG32 *)(OS_CPU_MTIME_ADDR    + 4u)))
+#define  OS_CPU_REG_MTIMECMP_LO        (*((CPU_REG32 *)(OS_CPU_MTIMECMP_ADDR)))
+#define  OS_CPU_REG_MTIMECMP_HI        (*((CPU_REG32 *)(OS_CPU_MTIMECMP_ADDR + 4u)))
+
+#define  OS_CPU_MIE_MTIE                0x80u                   /* M Timer Interrupt enable bit                         */
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                           LOCAL VARIABLES
 *********************************************************************************************************
 */
 
+#if (OS_CFG_DYN_TICK_EN > 0u)
+static  CPU_INT64U  OS_CPU_DynTickBase;                         /* mtime at the last tick counted by the kernel.        */
+static  CPU_INT32U  OS_CPU_DynTickCnts;                         /* Nbr of mtime counts per OS tick.                     */
+static  OS_TICK     OS_CPU_DynTickDelta;                        /* Nbr of ticks programmed for the current period.      */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+static  CPU_INT64U  OS_CPU_MtimeGet   (void);
+
+static  OS_TICK     OS_CPU_DynTickArm (OS_TICK  ticks);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -75,7 +110,9 @@ extern  "C" {                                    /* See Note #1.
 *
 * Arguments  : None.
 *
-* Note(s)    : None.
+* Note(s)    : 1) With OS_CPU_IDLE_WFI_EN, the hart stalls (WFI) until an interrupt is pending.  In Dynamic
+*                 Tick Mode the machine timer is only programmed for the next timeout, so an idle system
+*                 sleeps until then or until a device interrupt.
 *********************************************************************************************************
 */
 
@@ -86,6 +123,9 @@ void  OSIdleTaskHook (void)
         (*OS_AppIdleTaskHookPtr)();
     }
 #endif
+#if (OS_CPU_IDLE_WFI_EN > 0u)
+    __asm__ __volatile__ ("wfi" : : : "memory");                /* See Note #1.                                         */
+#endif
 }
 
 
@@ -287,6 +327,9 @@ void  OSTaskReturnHook (OS_TCB  *p_tcb)
 *                    |     x0      |    zero     | Hard-wired zero                  |
 *                    +-------------+-------------+----------------------------------+
 *
+*              4) When the compiler targets the F or D extension, the FP context area of the task is
+*                 reserved at the top of the stack and its address is stored in the 'sp' slot of the
+*                 frame (see os_cpu_a.S).  The task has no FP context until it uses the FP unit.
 *********************************************************************************************************
 */
 
@@ -298,6 +341,9 @@ CPU_STK  *OSTaskStkInit (OS_TASK_PTR    p_task,
                          OS_OPT         opt)
 {
     CPU_STK  *p_stk;
+#if defined(__riscv_flen)
+    CPU_STK  *p_fp_ctx;
+#endif
 
 
     (void)p_stk_limit;                         /* Prevent compiler warning                             */
@@ -306,6 +352,12 @@ CPU_STK  *OSTaskStkInit (OS_TASK_PTR    p_task,
     p_stk = &p_stk_base[stk_size];             /* Load stack pointer and align it to 16-bytes          */
     p_stk = (CPU_STK *)((CPU_STK)(p_stk) & 0xFFFFFFF0u);
 
+#if defined(__riscv_flen)                      /* See Note #4.                                         */
+    p_stk    -= OS_CPU_FP_CTX_SIZE;
+    p_fp_ctx  = p_stk;
+    p_fp_ctx[(32u * (__riscv_flen / 8u) + 4u) / sizeof(CPU_STK)] = 0u;
+#endif
+
     *(--p_stk) = (CPU_STK) p_task;             /* Entry Point                                          */
 
     *(--p_stk) = (CPU_STK) 0x31313131uL;       /* t6                                                   */
@@ -342,7 +394,11 @@ CPU_STK  *OSTaskStkInit (OS_TASK_PTR    p_task,
 
     *(--p_stk) = (CPU_STK) 0x04040404uL;       /* tp: Thread pointer                                   */
     *(--p_stk) = (CPU_STK) 0x03030303uL;       /* gp: Global pointer                                   */
+#if defined(__riscv_flen)
+    *(--p_stk) = (CPU_STK) p_fp_ctx;           /* sp: FP context area (see Note #4)                    */
+#else
     *(--p_stk) = (CPU_STK) 0x02020202uL;       /* sp: Stack  pointer                                   */
+#endif
     *(--p_stk) = (CPU_STK) OS_TaskReturn;      /* ra: return address                                   */
 
     return (p_stk);
@@ -453,26 +509,223 @@ void  OSTimeTickHook (void)
 *
 * Arguments  : None.
 *
-* Note(s)    : This function is defined with weak linking in 'riscv_hal_stubs.c' so that it can be
-*              overridden by the kernel port with same prototype
+* Note(s)    : 1) This function is defined with weak linking in 'riscv_hal_stubs.c' so that it can be
+*                 overridden by the kernel port with same prototype
+*
+*              2) In Dynamic Tick Mode, the interrupt ends the period programmed by OS_DynTickSet().  The
+*                 period ends on a tick boundary, which becomes the new base of the tick count.
+*
+*              3) 'mepc' holds the address of the instruction the machine timer interrupt was taken on.
 *********************************************************************************************************
 */
 
 void  SysTick_Handler (void)
 {
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    OS_TICK   ticks;
+#endif
+#if (OS_CFG_PROF_SAMPLE_EN > 0u)
+    CPU_ADDR  pc;
+#endif
     CPU_SR_ALLOC();                            /* Allocate storage for CPU status register             */
 
 
     CPU_CRITICAL_ENTER();
     OSIntEnter();                              /* Tell uC/OS-III that we are starting an ISR           */
+#if (OS_CFG_PROF_SAMPLE_EN > 0u)
+    __asm__ __volatile__ ("csrr %0, mepc" : "=r" (pc));          /* See Note #3.                                         */
+    OS_ProfSample(pc);
+#endif
+#if (OS_CFG_DYN_TICK_EN > 0u)
+                                               /* See Note #2.                                         */
+    ticks               = OS_CPU_DynTickDelta;
+    OS_CPU_DynTickBase += (CPU_INT64U)ticks * OS_CPU_DynTickCnts;
+#endif
     CPU_CRITICAL_EXIT();
 
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    OSTimeDynTick(ticks);                      /* The kernel programs the next period                  */
+#else
     OSTimeTick();                              /* Call uC/OS-III's OSTimeTick()                        */
+#endif
 
     OSIntExit();                               /* Tell uC/OS-III that we are leaving the ISR           */
 }
 
 
+/*
+*********************************************************************************************************
+*                                       INITIALIZE DYNAMIC TICK
+*
+* Description: Initialize the machine timer (mtime/mtimecmp) for Dynamic Tick Mode.
+*
+* Arguments  : cnts         Number of mtime counts per OS tick.
+*
+* Note(s)    : 1) This function MUST be called after OSStart() & after processor initialization, in
+*                 place of the HAL's periodic tick setup (SysTick_Config()).
+*
+*              2) The HAL's machine timer handler MUST NOT reload mtimecmp after calling
+*                 SysTick_Handler(): the next expiry is programmed by the kernel.
+*
+*              3) The first period is programmed from the tick step the kernel already requested
+*                 (OSTickCtrStep).
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+void  OS_CPU_DynTickInit (CPU_INT32U  cnts)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    OS_CPU_DynTickCnts = cnts;
+    OS_CPU_DynTickBase = OS_CPU_MtimeGet();
+    (void)OS_CPU_DynTickArm(OSTickCtrStep);                     /* See Note #3.                                         */
+    CPU_CRITICAL_EXIT();
+
+                                                                /* Enable the machine timer interrupt.                  */
+    __asm__ __volatile__ ("csrs mie, %0" : : "r" (OS_CPU_MIE_MTIE));
+}
+
+
+/*
+*********************************************************************************************************
+*                                          GET DYNAMIC TICK
+*
+* Description: Return the number of OS ticks that elapsed since the kernel last programmed the tick.
+*
+* Arguments  : None.
+*
+* Returns    : The number of elapsed ticks, between 0 and the number of ticks programmed, inclusive.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and is called with kernel-aware interrupts
+*                 disabled.
+*********************************************************************************************************
+*/
+
+OS_TICK  OS_DynTickGet (void)
+{
+    CPU_INT64U  ticks;
+
+
+    if (OS_CPU_DynTickCnts == 0u) {                             /* Timer not initialized yet.                           */
+        return (0u);
+    }
+
+    ticks = (OS_CPU_MtimeGet() - OS_CPU_DynTickBase) / OS_CPU_DynTickCnts;
+    if (ticks > OS_CPU_DynTickDelta) {
+        ticks = OS_CPU_DynTickDelta;
+    }
+
+    return ((OS_TICK)ticks);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SET DYNAMIC TICK
+*
+* Description: Program mtimecmp to interrupt once the given number of OS ticks have elapsed.
+*
+* Arguments  : ticks        Number of ticks to the next tick interrupt, 0 for an indefinite delay.
+*
+* Returns    : The number of ticks that will actually elapse before the next tick interrupt.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and is called with kernel-aware interrupts
+*                 disabled, after the ticks returned by OS_DynTickGet() were added to OSTickCtr.
+*
+*              2) The base only moves by whole ticks, the ones the kernel just counted.  The new period
+*                 is thus measured from a tick boundary and not from the time of the call, so
+*                 reprogramming the timer, however often, does not make OSTickCtr drift.
+*
+*              3) Until OS_CPU_DynTickInit() is called there is nothing to program.  The pending step
+*                 (OSTickCtrStep) is programmed by OS_CPU_DynTickInit() itself.
+*********************************************************************************************************
+*/
+
+OS_TICK  OS_DynTickSet (OS_TICK  ticks)
+{
+    if (OS_CPU_DynTickCnts == 0u) {                             /* See Note #3.                                         */
+        return (ticks);
+    }
+
+                                                                /* See Note #2.                                         */
+    OS_CPU_DynTickBase += (CPU_INT64U)OS_DynTickGet() * OS_CPU_DynTickCnts;
+
+    return (OS_CPU_DynTickArm(ticks));
+}
+
+
+/*
+*********************************************************************************************************
+*                                            READ MTIME
+*
+* Description: Read the 64-bit machine timer on a 32-bit hart.
+*
+* Arguments  : None.
+*
+* Returns    : The current mtime value.
+*
+* Note(s)    : 1) The high word is read again to detect a carry from the low word between the two reads.
+*********************************************************************************************************
+*/
+
+static  CPU_INT64U  OS_CPU_MtimeGet (void)
+{
+    CPU_INT32U  hi;
+    CPU_INT32U  lo;
+
+
+    do {
+        hi = OS_CPU_REG_MTIME_HI;
+        lo = OS_CPU_REG_MTIME_LO;
+    } while (hi != OS_CPU_REG_MTIME_HI);                        /* See Note #1.                                         */
+
+    return (((CPU_INT64U)hi << 32u) | lo);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          ARM DYNAMIC TICK
+*
+* Description: Program mtimecmp to expire 'ticks' OS ticks after the current base.
+*
+* Arguments  : ticks        Number of ticks in the period, 0 for an indefinite delay.
+*
+* Returns    : The number of ticks programmed.
+*
+* Note(s)    : 1) An indefinite delay is programmed as the longest period an OS_TICK can express.
+*
+*              2) mtimecmp is written one word at a time.  The low word is first set to its maximum so the
+*                 intermediate value can't be lower than the old and new values, which would trigger a
+*                 spurious interrupt.  Writing a value past mtime also clears a pending timer interrupt
+*                 the kernel already accounted for through OS_DynTickGet().
+*********************************************************************************************************
+*/
+
+static  OS_TICK  OS_CPU_DynTickArm (OS_TICK  ticks)
+{
+    CPU_INT64U  match;
+
+
+    if (ticks == 0u) {                                          /* See Note #1.                                         */
+        ticks = (OS_TICK)DEF_INT_32U_MAX_VAL;
+    }
+
+    OS_CPU_DynTickDelta    = ticks;
+    match                  = OS_CPU_DynTickBase + ((CPU_INT64U)ticks * OS_CPU_DynTickCnts);
+
+    OS_CPU_REG_MTIMECMP_LO = DEF_INT_32U_MAX_VAL;               /* See Note #2.                                         */
+    OS_CPU_REG_MTIMECMP_HI = (CPU_INT32U)(match >> 32u);
+    OS_CPU_REG_MTIMECMP_LO = (CPU_INT32U) match;
+
+    return (ticks);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                   EXTERNAL C LANGUAGE LINKAGE END
@@ -0,0 +1,221 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                              RISC-V PORT
+*
+* File      : os_cpu.h
+* Version   : V3.08.00
+*********************************************************************************************************
+* For       : RISC-V RV64
+* Toolchain : GNU C Compiler
+*********************************************************************************************************
+* Note(s)   : 1) The FP registers of the F and D extensions are switched lazily (see os_cpu_a.S).
+*
+*             2) CPU_STK, CPU_ADDR & CPU_DATA are 64-bit (see the RV64 'cpu.h' of uC/CPU).
+*********************************************************************************************************
+*/
+
+#ifndef _OS_CPU_H
+#define _OS_CPU_H
+
+#ifdef  OS_CPU_GLOBALS
+#define OS_CPU_EXT
+#else
+#define OS_CPU_EXT  extern
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     EXTERNAL C LANGUAGE LINKAGE
+*
+* Note(s) : (1) C++ compilers MUST 'extern'ally declare ALL C function prototypes & variable/object
+*               declarations for correct C language linkage.
+*********************************************************************************************************
+*/
+
+#ifdef __cplusplus
+extern  "C" {                                    /* See Note #1.                                       */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*
+* Note(s) : (1) When OS_CPU_IDLE_WFI_EN is enabled, OSIdleTaskHook() stalls the hart until the next
+*               interrupt, see os_cpu_c.c.
+*
+*           (2) Addresses of the machine timer registers, read by OS_TS_GET() and programmed in Dynamic
+*               Tick Mode.  The defaults match the PRCI block at RISCV_PRCI_BASE_ADDR (see os_cpu_a.S).
+*
+*           (3) OS_CPU_CLIC_EN selects the CLIC interrupt entry of os_cpu_a.S and MUST be given the same
+*               value when building os_cpu_a.S (e.g. -DOS_CPU_CLIC_EN=1).  In CLIC mode, the BSP:
+*
+*               (a) Sets mtvec to OS_CPU_CLIC_IntHandler() in CLIC mode and mtvt to the table of the
+*                   interrupt handlers (plain C functions, e.g. SysTick_Handler()).
+*
+*               (b) Makes the machine software interrupt vectored, at the lowest level, with
+*                   OS_CPU_CLIC_SwIntHandler() as its handler, and enables it in the CLIC: the 'mie'
+*                   bits set by OSCtxSw() and OS_CPU_DynTickInit() have no effect in CLIC mode.
+*
+*               (c) Gives the other interrupts a higher level for them to preempt each other.
+*
+*           (4) When the compiler targets the F or D extension, each task stack starts with an FP
+*               context area of OS_CPU_FP_CTX_SIZE CPU_STK elements: f0-f31, then fcsr and a word that
+*               tells whether the area holds a context in the same doubleword.  It is rounded up to 16
+*               bytes.
+*********************************************************************************************************
+*/
+
+#if defined(__riscv_flen)                         /* See Note #4.                                       */
+#define  OS_CPU_FP_CTX_SIZE           ((((32u * (__riscv_flen / 8u)) + 8u + 15u) / 16u) * (16u / sizeof(CPU_STK)))
+#endif
+
+#ifndef  OS_CPU_IDLE_WFI_EN                       /* See Note #1.                                       */
+#define  OS_CPU_IDLE_WFI_EN             0u
+#endif
+
+#ifndef  OS_CPU_CLIC_EN                           /* See Note #3.                                       */
+#define  OS_CPU_CLIC_EN                 0u
+#endif
+
+#ifndef  OS_CPU_MTIMECMP_ADDR                     /* See Note #2.                                       */
+#define  OS_CPU_MTIMECMP_ADDR           0x44004000u
+#endif
+
+#ifndef  OS_CPU_MTIME_ADDR
+#define  OS_CPU_MTIME_ADDR              0x4400BFF8u
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                               MACROS
+*
+* Note(s): OS_TASK_SW()  invokes the task level context switch.
+*
+*          (1) On some processors, this corresponds to a call to OSCtxSw() which is an assembly language
+*              function that performs the context switch.
+*
+*          (2) On some processors, you need to simulate an interrupt using a 'software interrupt' or a
+*              TRAP instruction.  Some compilers allow you to add in-line assembly language.
+*********************************************************************************************************
+*/
+
+#define  OS_TASK_SW()         OSCtxSw()
+
+
+/*
+*********************************************************************************************************
+*                                          ATOMIC OPERATIONS
+*
+* Note(s) : (1) Used by the OSAtomicxxx() services (see os_atomic.c).  With the A extension, GCC expands
+*               the builtins to AMO and LR/SC instructions.  Without it, os_atomic.c falls back to
+*               critical sections.
+*********************************************************************************************************
+*/
+
+#if defined(__riscv_atomic)
+#define  OS_CPU_ATOMIC_OPS_EN                             1u
+#define  OS_CPU_ATOMIC_CAS(p_addr, val_old, val_new)    __sync_val_compare_and_swap((p_addr), (val_old), (val_new))
+#define  OS_CPU_ATOMIC_FETCH_ADD(p_addr, val)           __atomic_fetch_add((p_addr), (val), __ATOMIC_SEQ_CST)
+#define  OS_CPU_ATOMIC_FETCH_OR(p_addr, val)            __atomic_fetch_or((p_addr), (val), __ATOMIC_SEQ_CST)
+#define  OS_CPU_ATOMIC_LOAD(p_addr)                     __atomic_load_n((p_addr), __ATOMIC_ACQUIRE)
+#define  OS_CPU_ATOMIC_STORE(p_addr, val)               __atomic_store_n((p_addr), (val), __ATOMIC_RELEASE)
+#define  OS_CPU_ATOMIC_XCHG(p_addr, val)                __atomic_exchange_n((p_addr), (val), __ATOMIC_SEQ_CST)
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       TIMESTAMP CONFIGURATION
+*
+* Note(s) : (1) mtime is a free running 64-bit up counter, which an RV64 hart reads in a single access.
+*               OS_TS_GET() reads it directly instead of going through CPU_TS_TmrRd() :
+*
+*               (a) With CPU_CFG_TS_64_EN, CPU_TS is 64-bit and the timestamps don't wrap around for
+*                   the life of the product, so differences of timestamps are always exact.
+*
+*               (b) With a 32-bit CPU_TS, the low word of mtime is used and the timestamps wrap around
+*                   like those of any 32-bit free running timer.
+*
+*           (2) mtime counts at the frequency of the machine timer, which is usually not the CPU clock.
+*               That frequency MUST be given to CPU_TS_TmrFreqSet() for timestamps to be converted to
+*               time correctly.
+*********************************************************************************************************
+*/
+
+#if      OS_CFG_TS_EN == 1u
+                                                  /* See Note #1.                                      */
+#define  OS_TS_GET()               (CPU_TS)(*((CPU_REG64 *)(OS_CPU_MTIME_ADDR)))
+#else
+#define  OS_TS_GET()               (CPU_TS)0u
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+#if defined(__riscv_flen)
+OS_CPU_EXT  CPU_STK  *OS_CPU_FP_CtxCurPtr;      /* FP context area of the running task                */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+                                                  /* See OS_CPU_A.S                                    */
+void  OSCtxSw       (void);
+void  OSIntCtxSw    (void);
+void  OSStartHighRdy(void);
+
+#if (OS_CPU_CLIC_EN > 0u)
+void  OS_CPU_CLIC_IntHandler  (void);
+void  OS_CPU_CLIC_SwIntHandler(void);
+#endif
+
+#if (OS_CFG_DYN_TICK_EN > 0u)                     /* See OS_CPU_C.C                                    */
+void  OS_CPU_DynTickInit (CPU_INT32U  cnts);
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                   EXTERNAL C LANGUAGE LINKAGE END
+*********************************************************************************************************
+*/
+
+#ifdef __cplusplus
+}                                                 /* End of 'extern'al C lang linkage.                 */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif
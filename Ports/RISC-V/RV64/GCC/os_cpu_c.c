@@ -0,0 +1,704 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                              RISC-V PORT
+*
+* File      : os_cpu_c.c
+* Version   : V3.08.00
+*********************************************************************************************************
+* For       : RISC-V RV64
+* Toolchain : GNU C Compiler
+*********************************************************************************************************
+* Note(s)   : 1) The FP registers of the F and D extensions are switched lazily (see os_cpu_a.S).
+*
+*             2) mtime & mtimecmp are read and written in a single 64-bit access.
+*********************************************************************************************************
+*/
+
+#define   OS_CPU_GLOBALS
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_cpu_c__c = "$Id: $";
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "../../../../Source/os.h"
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+#define  OS_CPU_REG_MTIME              (*((CPU_REG64 *)(OS_CPU_MTIME_ADDR)))
+#define  OS_CPU_REG_MTIMECMP           (*((CPU_REG64 *)(OS_CPU_MTIMECMP_ADDR)))
+
+#define  OS_CPU_MIE_MTIE                0x80u                   /* M Timer Interrupt enable bit                         */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+static  CPU_INT64U  OS_CPU_DynTickBase;                         /* mtime at the last tick counted by the kernel.        */
+static  CPU_INT32U  OS_CPU_DynTickCnts;                         /* Nbr of mtime counts per OS tick.                     */
+static  OS_TICK     OS_CPU_DynTickDelta;                        /* Nbr of ticks programmed for the current period.      */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+static  OS_TICK     OS_CPU_DynTickArm (OS_TICK  ticks);
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     EXTERNAL C LANGUAGE LINKAGE
+*
+* Note(s) : (1) C++ compilers MUST 'extern'ally declare ALL C function prototypes & variable/object
+*               declarations for correct C language linkage.
+*********************************************************************************************************
+*/
+
+#ifdef __cplusplus
+extern  "C" {                                    /* See Note #1.                                       */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                             IDLE TASK HOOK
+*
+* Description: This function is called by the idle task.  This hook has been added to allow you to do
+*              such things as STOP the CPU to conserve power.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) With OS_CPU_IDLE_WFI_EN, the hart stalls (WFI) until an interrupt is pending.  In Dynamic
+*                 Tick Mode the machine timer is only programmed for the next timeout, so an idle system
+*                 sleeps until then or until a device interrupt.
+*********************************************************************************************************
+*/
+
+void  OSIdleTaskHook (void)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppIdleTaskHookPtr != (OS_APP_HOOK_VOID)0) {
+        (*OS_AppIdleTaskHookPtr)();
+    }
+#endif
+#if (OS_CPU_IDLE_WFI_EN > 0u)
+    __asm__ __volatile__ ("wfi" : : : "memory");                /* See Note #1.                                         */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                       OS INITIALIZATION HOOK
+*
+* Description: This function is called by OSInit() at the beginning of OSInit().
+*
+* Arguments  : None.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+void  OSInitHook (void)
+{
+
+}
+
+
+/*
+*********************************************************************************************************
+*                                           REDZONE HIT HOOK
+*
+* Description: This function is called when a task's stack overflowed.
+*
+* Arguments  : p_tcb        Pointer to the task control block of the offending task. NULL if ISR.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+void  OSRedzoneHitHook (OS_TCB  *p_tcb)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppRedzoneHitHookPtr != (OS_APP_HOOK_TCB)0) {
+        (*OS_AppRedzoneHitHookPtr)(p_tcb);
+    } else {
+        CPU_SW_EXCEPTION(;);
+    }
+#else
+    (void)p_tcb;                                                /* Prevent compiler warning                             */
+    CPU_SW_EXCEPTION(;);
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         STATISTIC TASK HOOK
+*
+* Description: This function is called every second by uC/OS-III's statistics task.  This allows your
+*              application to add functionality to the statistics task.
+*
+* Arguments  : None.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+void  OSStatTaskHook (void)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppStatTaskHookPtr != (OS_APP_HOOK_VOID)0) {
+        (*OS_AppStatTaskHookPtr)();
+    }
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                          TASK CREATION HOOK
+*
+* Description: This function is called when a task is created.
+*
+* Arguments  : p_tcb        Pointer to the task control block of the task being created.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+void  OSTaskCreateHook (OS_TCB  *p_tcb)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTaskCreateHookPtr != (OS_APP_HOOK_TCB)0) {
+        (*OS_AppTaskCreateHookPtr)(p_tcb);
+    }
+#else
+    (void)p_tcb;                                                /* Prevent compiler warning                             */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                          TASK DELETION HOOK
+*
+* Description: This function is called when a task is deleted.
+*
+* Arguments  : p_tcb        Pointer to the task control block of the task being deleted.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+void  OSTaskDelHook (OS_TCB  *p_tcb)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTaskDelHookPtr != (OS_APP_HOOK_TCB)0) {
+        (*OS_AppTaskDelHookPtr)(p_tcb);
+    }
+#else
+    (void)p_tcb;                                                /* Prevent compiler warning                             */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                           TASK RETURN HOOK
+*
+* Description: This function is called if a task accidentally returns.  In other words, a task should
+*              either be an infinite loop or delete itself when done.
+*
+* Arguments  : p_tcb        Pointer to the task control block of the task that is returning.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+void  OSTaskReturnHook (OS_TCB  *p_tcb)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTaskReturnHookPtr != (OS_APP_HOOK_TCB)0) {
+        (*OS_AppTaskReturnHookPtr)(p_tcb);
+    }
+#else
+    (void)p_tcb;                                                /* Prevent compiler warning                             */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                        INITIALIZE A TASK'S STACK
+*
+* Description: This function is called by OSTaskCreate() to initialize the stack frame of the task being
+*              created. This function is highly processor specific.
+*
+* Arguments  : p_task       Pointer to the task entry point address.
+*
+*              p_arg        Pointer to a user supplied data area that will be passed to the task
+*                               when the task first executes.
+*
+*              p_stk_base   Pointer to the base address of the stack.
+*
+*              stk_size     Size of the stack, in number of CPU_STK elements.
+*
+*              opt          Options used to alter the behavior of OS_Task_StkInit().
+*                            (see OS.H for OS_TASK_OPT_xxx).
+*
+* Returns    : Always returns the location of the new top-of-stack once the processor registers have
+*              been placed on the stack in the proper order.
+*
+* Note(s)    : 1) Interrupts are enabled when task starts executing.
+*
+*              2) There is no need to save register x0 since it is a hard-wired zero.
+*
+*              3) RISC-V calling convention register usage:
+*
+*                    +-------------+-------------+----------------------------------+
+*                    |  Register   |   ABI Name  | Description                      |
+*                    +-------------+-------------+----------------------------------+
+*                    |  x31 - x28  |   t6 - t3   | Temporaries                      |
+*                    +-------------+-------------+----------------------------------+
+*                    |  x27 - x18  |  s11 - s2   | Saved registers                  |
+*                    +-------------+-------------+----------------------------------+
+*                    |  x17 - x12  |   a7 - a2   | Function arguments               |
+*                    +-------------+-------------+----------------------------------+
+*                    |  x11 - x10  |   a1 - a0   | Function arguments/return values |
+*                    +-------------+-------------+----------------------------------+
+*                    |     x9      |     s1      | Saved register                   |
+*                    +-------------+-------------+----------------------------------+
+*                    |     x8      |    s0/fp    | Saved register/frame pointer     |
+*                    +-------------+-------------+----------------------------------+
+*                    |   x7 - x5   |   t2 - t0   | Temporaries                      |
+*                    +-------------+-------------+----------------------------------+
+*                    |     x4      |     tp      | Thread pointer                   |
+*                    +-------------+-------------+----------------------------------+
+*                    |     x3      |     gp      | Global pointer                   |
+*                    +-------------+-------------+----------------------------------+
+*                    |     x2      |     sp      | Stack pointer                    |
+*                    +-------------+-------------+----------------------------------+
+*                    |     x1      |     ra      | return address                   |
+*                    +-------------+-------------+----------------------------------+
+*                    |     x0      |    zero     | Hard-wired zero                  |
+*                    +-------------+-------------+----------------------------------+
+*
+*              4) When the compiler targets the F or D extension, the FP context area of the task is
+*                 reserved at the top of the stack and its address is stored in the 'sp' slot of the
+*                 frame (see os_cpu_a.S).  The task has no FP context until it uses the FP unit: the
+*                 doubleword that holds fcsr and the valid word is cleared.
+*********************************************************************************************************
+*/
+
+CPU_STK  *OSTaskStkInit (OS_TASK_PTR    p_task,
+                         void          *p_arg,
+                         CPU_STK       *p_stk_base,
+                         CPU_STK       *p_stk_limit,
+                         CPU_STK_SIZE   stk_size,
+                         OS_OPT         opt)
+{
+    CPU_STK  *p_stk;
+#if defined(__riscv_flen)
+    CPU_STK  *p_fp_ctx;
+#endif
+
+
+    (void)p_stk_limit;                              /* Prevent compiler warning                        */
+    (void)opt;
+
+    p_stk = &p_stk_base[stk_size];                  /* Load stack pointer and align it to 16-bytes     */
+    p_stk = (CPU_STK *)((CPU_STK)(p_stk) & ~(CPU_STK)0xFu);
+
+#if defined(__riscv_flen)                           /* See Note #4.                                    */
+    p_stk    -= OS_CPU_FP_CTX_SIZE;
+    p_fp_ctx  = p_stk;
+    p_fp_ctx[(32u * (__riscv_flen / 8u)) / sizeof(CPU_STK)] = 0u;
+#endif
+
+    *(--p_stk) = (CPU_STK) p_task;                  /* Entry Point                                     */
+
+    *(--p_stk) = (CPU_STK) 0x3131313131313131uLL;   /* t6                                              */
+    *(--p_stk) = (CPU_STK) 0x3030303030303030uLL;   /* t5                                              */
+    *(--p_stk) = (CPU_STK) 0x2929292929292929uLL;   /* t4                                              */
+    *(--p_stk) = (CPU_STK) 0x2828282828282828uLL;   /* t3                                              */
+                                                    /* Saved Registers                                 */
+    *(--p_stk) = (CPU_STK) 0x2727272727272727uLL;   /* s11                                             */
+    *(--p_stk) = (CPU_STK) 0x2626262626262626uLL;   /* s10                                             */
+    *(--p_stk) = (CPU_STK) 0x2525252525252525uLL;   /* s9                                              */
+    *(--p_stk) = (CPU_STK) 0x2424242424242424uLL;   /* s8                                              */
+    *(--p_stk) = (CPU_STK) 0x2323232323232323uLL;   /* s7                                              */
+    *(--p_stk) = (CPU_STK) 0x2222222222222222uLL;   /* s6                                              */
+    *(--p_stk) = (CPU_STK) 0x2121212121212121uLL;   /* s5                                              */
+    *(--p_stk) = (CPU_STK) 0x2020202020202020uLL;   /* s4                                              */
+    *(--p_stk) = (CPU_STK) 0x1919191919191919uLL;   /* s3                                              */
+    *(--p_stk) = (CPU_STK) 0x1818181818181818uLL;   /* s2                                              */
+                                                    /* Function Arguments                              */
+    *(--p_stk) = (CPU_STK) 0x1717171717171717uLL;   /* a7                                              */
+    *(--p_stk) = (CPU_STK) 0x1616161616161616uLL;   /* a6                                              */
+    *(--p_stk) = (CPU_STK) 0x1515151515151515uLL;   /* a5                                              */
+    *(--p_stk) = (CPU_STK) 0x1414141414141414uLL;   /* a4                                              */
+    *(--p_stk) = (CPU_STK) 0x1313131313131313uLL;   /* a3                                              */
+    *(--p_stk) = (CPU_STK) 0x1212121212121212uLL;   /* a2                                              */
+                                                    /* Function Arguments/return values                */
+    *(--p_stk) = (CPU_STK) 0x1111111111111111uLL;   /* a1                                              */
+    *(--p_stk) = (CPU_STK) p_arg;                   /* a0                                              */
+    *(--p_stk) = (CPU_STK) 0x0909090909090909uLL;   /* s1   : Saved register                           */
+    *(--p_stk) = (CPU_STK) 0x0808080808080808uLL;   /* s0/fp: Saved register/Frame pointer             */
+                                                    /* Temporary registers                             */
+    *(--p_stk) = (CPU_STK) 0x0707070707070707uLL;   /* t2                                              */
+    *(--p_stk) = (CPU_STK) 0x0606060606060606uLL;   /* t1                                              */
+    *(--p_stk) = (CPU_STK) 0x0505050505050505uLL;   /* t0                                              */
+
+    *(--p_stk) = (CPU_STK) 0x0404040404040404uLL;   /* tp: Thread pointer                              */
+    *(--p_stk) = (CPU_STK) 0x0303030303030303uLL;   /* gp: Global pointer                              */
+#if defined(__riscv_flen)
+    *(--p_stk) = (CPU_STK) p_fp_ctx;                /* sp: FP context area (see Note #4)               */
+#else
+    *(--p_stk) = (CPU_STK) 0x0202020202020202uLL;   /* sp: Stack  pointer                              */
+#endif
+    *(--p_stk) = (CPU_STK) OS_TaskReturn;           /* ra: return address                              */
+
+    return (p_stk);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          TASK SWITCH HOOK
+*
+* Description: This function is called when a task switch is performed.  This allows you to perform other
+*              operations during a context switch.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) Interrupts are disabled during this call.
+*              2) It is assumed that the global pointer 'OSTCBHighRdyPtr' points to the TCB of the task
+*                 that will be 'switched in' (i.e. the highest priority task) and, 'OSTCBCurPtr' points
+*                 to the task being switched out (i.e. the preempted task).
+*********************************************************************************************************
+*/
+
+void  OSTaskSwHook (void)
+{
+#if OS_CFG_TASK_PROFILE_EN > 0u
+    CPU_TS  ts;
+#endif
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN
+    CPU_TS  int_dis_time;
+#endif
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+    CPU_BOOLEAN  stk_status;
+#endif
+
+
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTaskSwHookPtr != (OS_APP_HOOK_VOID)0) {
+        (*OS_AppTaskSwHookPtr)();
+    }
+#endif
+
+#if OS_CFG_TASK_PROFILE_EN > 0u
+    ts = OS_TS_GET();
+    if (OSTCBCurPtr != OSTCBHighRdyPtr) {
+        OSTCBCurPtr->CyclesDelta  = ts - OSTCBCurPtr->CyclesStart;
+        OSTCBCurPtr->CyclesTotal += (OS_CYCLES)OSTCBCurPtr->CyclesDelta;
+    }
+
+    OSTCBHighRdyPtr->CyclesStart = ts;
+#endif
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN
+    int_dis_time = CPU_IntDisMeasMaxCurReset();                 /* Keep track of per-task interrupt disable time        */
+    if (OSTCBCurPtr->IntDisTimeMax < int_dis_time) {
+        OSTCBCurPtr->IntDisTimeMax = int_dis_time;
+    }
+#endif
+
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
+                                                                /* Keep track of per-task scheduler lock time           */
+    if (OSTCBCurPtr->SchedLockTimeMax < OSSchedLockTimeMaxCur) {
+        OSTCBCurPtr->SchedLockTimeMax = OSSchedLockTimeMaxCur;
+    }
+    OSSchedLockTimeMaxCur = (CPU_TS)0;                          /* Reset the per-task value                             */
+#endif
+
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+                                                                /* Check if stack overflowed.                           */
+    stk_status = OSTaskStkRedzoneChk((OS_TCB *)0u);
+    if (stk_status != OS_TRUE) {
+        OSRedzoneHitHook(OSTCBCurPtr);
+    }
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                               TICK HOOK
+*
+* Description: This function is called every tick.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) This function is assumed to be called from the Tick ISR.
+*********************************************************************************************************
+*/
+
+void  OSTimeTickHook (void)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTimeTickHookPtr != (OS_APP_HOOK_VOID)0) {
+        (*OS_AppTimeTickHookPtr)();
+    }
+#endif
+#if (CPU_CFG_TS_EN > 0u)
+    CPU_TS_Update();
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SYS TICK HANDLER
+*
+* Description: Handle the system tick (SysTick) interrupt, which is used to generate the uC/OS-III tick
+*              interrupt.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) This function is defined with weak linking in 'riscv_hal_stubs.c' so that it can be
+*                 overridden by the kernel port with same prototype
+*
+*              2) In Dynamic Tick Mode, the interrupt ends the period programmed by OS_DynTickSet().  The
+*                 period ends on a tick boundary, which becomes the new base of the tick count.
+*
+*              3) 'mepc' holds the address of the instruction the machine timer interrupt was taken on.
+*********************************************************************************************************
+*/
+
+void  SysTick_Handler (void)
+{
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    OS_TICK   ticks;
+#endif
+#if (OS_CFG_PROF_SAMPLE_EN > 0u)
+    CPU_ADDR  pc;
+#endif
+    CPU_SR_ALLOC();                            /* Allocate storage for CPU status register             */
+
+
+    CPU_CRITICAL_ENTER();
+    OSIntEnter();                              /* Tell uC/OS-III that we are starting an ISR           */
+#if (OS_CFG_PROF_SAMPLE_EN > 0u)
+    __asm__ __volatile__ ("csrr %0, mepc" : "=r" (pc));          /* See Note #3.                                         */
+    OS_ProfSample(pc);
+#endif
+#if (OS_CFG_DYN_TICK_EN > 0u)
+                                               /* See Note #2.                                         */
+    ticks               = OS_CPU_DynTickDelta;
+    OS_CPU_DynTickBase += (CPU_INT64U)ticks * OS_CPU_DynTickCnts;
+#endif
+    CPU_CRITICAL_EXIT();
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    OSTimeDynTick(ticks);                      /* The kernel programs the next period                  */
+#else
+    OSTimeTick();                              /* Call uC/OS-III's OSTimeTick()                        */
+#endif
+
+    OSIntExit();                               /* Tell uC/OS-III that we are leaving the ISR           */
+}
+
+
+/*
+*********************************************************************************************************
+*                                       INITIALIZE DYNAMIC TICK
+*
+* Description: Initialize the machine timer (mtime/mtimecmp) for Dynamic Tick Mode.
+*
+* Arguments  : cnts         Number of mtime counts per OS tick.
+*
+* Note(s)    : 1) This function MUST be called after OSStart() & after processor initialization, in
+*                 place of the HAL's periodic tick setup (SysTick_Config()).
+*
+*              2) The HAL's machine timer handler MUST NOT reload mtimecmp after calling
+*                 SysTick_Handler(): the next expiry is programmed by the kernel.
+*
+*              3) The first period is programmed from the tick step the kernel already requested
+*                 (OSTickCtrStep).
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+void  OS_CPU_DynTickInit (CPU_INT32U  cnts)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    OS_CPU_DynTickCnts = cnts;
+    OS_CPU_DynTickBase = OS_CPU_REG_MTIME;
+    (void)OS_CPU_DynTickArm(OSTickCtrStep);                     /* See Note #3.                                         */
+    CPU_CRITICAL_EXIT();
+
+                                                                /* Enable the machine timer interrupt.                  */
+    __asm__ __volatile__ ("csrs mie, %0" : : "r" (OS_CPU_MIE_MTIE));
+}
+
+
+/*
+*********************************************************************************************************
+*                                          GET DYNAMIC TICK
+*
+* Description: Return the number of OS ticks that elapsed since the kernel last programmed the tick.
+*
+* Arguments  : None.
+*
+* Returns    : The number of elapsed ticks, between 0 and the number of ticks programmed, inclusive.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and is called with kernel-aware interrupts
+*                 disabled.
+*********************************************************************************************************
+*/
+
+OS_TICK  OS_DynTickGet (void)
+{
+    CPU_INT64U  ticks;
+
+
+    if (OS_CPU_DynTickCnts == 0u) {                             /* Timer not initialized yet.                           */
+        return (0u);
+    }
+
+    ticks = (OS_CPU_REG_MTIME - OS_CPU_DynTickBase) / OS_CPU_DynTickCnts;
+    if (ticks > OS_CPU_DynTickDelta) {
+        ticks = OS_CPU_DynTickDelta;
+    }
+
+    return ((OS_TICK)ticks);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SET DYNAMIC TICK
+*
+* Description: Program mtimecmp to interrupt once the given number of OS ticks have elapsed.
+*
+* Arguments  : ticks        Number of ticks to the next tick interrupt, 0 for an indefinite delay.
+*
+* Returns    : The number of ticks that will actually elapse before the next tick interrupt.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and is called with kernel-aware interrupts
+*                 disabled, after the ticks returned by OS_DynTickGet() were added to OSTickCtr.
+*
+*              2) The base only moves by whole ticks, the ones the kernel just counted.  The new period
+*                 is thus measured from a tick boundary and not from the time of the call, so
+*                 reprogramming the timer, however often, does not make OSTickCtr drift.
+*
+*              3) Until OS_CPU_DynTickInit() is called there is nothing to program.  The pending step
+*                 (OSTickCtrStep) is programmed by OS_CPU_DynTickInit() itself.
+*********************************************************************************************************
+*/
+
+OS_TICK  OS_DynTickSet (OS_TICK  ticks)
+{
+    if (OS_CPU_DynTickCnts == 0u) {                             /* See Note #3.                                         */
+        return (ticks);
+    }
+
+                                                                /* See Note #2.                                         */
+    OS_CPU_DynTickBase += (CPU_INT64U)OS_DynTickGet() * OS_CPU_DynTickCnts;
+
+    return (OS_CPU_DynTickArm(ticks));
+}
+
+
+/*
+*********************************************************************************************************
+*                                          ARM DYNAMIC TICK
+*
+* Description: Program mtimecmp to expire 'ticks' OS ticks after the current base.
+*
+* Arguments  : ticks        Number of ticks in the period, 0 for an indefinite delay.
+*
+* Returns    : The number of ticks programmed.
+*
+* Note(s)    : 1) An indefinite delay is programmed as the longest period an OS_TICK can express.
+*
+*              2) mtimecmp is written in a single access, so there is no intermediate value to guard
+*                 against.  Writing a value past mtime also clears a pending timer interrupt the kernel
+*                 already accounted for through OS_DynTickGet().
+*********************************************************************************************************
+*/
+
+static  OS_TICK  OS_CPU_DynTickArm (OS_TICK  ticks)
+{
+    CPU_INT64U  match;
+
+
+    if (ticks == 0u) {                                          /* See Note #1.                                         */
+        ticks = (OS_TICK)DEF_INT_32U_MAX_VAL;
+    }
+
+    OS_CPU_DynTickDelta    = ticks;
+    match                  = OS_CPU_DynTickBase + ((CPU_INT64U)ticks * OS_CPU_DynTickCnts);
+
+    OS_CPU_REG_MTIMECMP    = match;                             /* See Note #2.                                         */
+
+    return (ticks);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                   EXTERNAL C LANGUAGE LINKAGE END
+*********************************************************************************************************
+*/
+
+#ifdef __cplusplus
+}                                                 /* End of 'extern'al C lang linkage.                 */
+#endif
@@ -48,6 +48,26 @@ extern  "C" {
 
 #define  OS_TASK_SW()               OSCtxSw()
 
+/*
+*********************************************************************************************************
+*                                        CONTEXT SWITCH BACKEND
+*
+* Note(s) : (1) By default, every task is a Win32 thread.  A context switch suspends one thread and
+*               resumes the other, and OSTickW32() suspends the running thread to process the tick.
+*
+*           (2) When OS_CPU_WIN32_FIBER_EN is set to 1, every task is a fiber of the thread that called
+*               OSInit() and a context switch is a SwitchToFiber().  OSTickW32() only counts the ticks;
+*               they are processed by the idle task, which is the only point where no task is in the
+*               middle of kernel code.  The simulated time therefore only advances while the CPU is idle.
+*               OSIntCurTaskSuspend() and OSIntCurTaskResume() are not available: no other simulated
+*               interrupt may call uC/OS-III services.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_CPU_WIN32_FIBER_EN
+#define  OS_CPU_WIN32_FIBER_EN             0u               /* See Note #2.                                           */
+#endif
+
 /*
 *********************************************************************************************************
 *                                       TIMESTAMP CONFIGURATION
@@ -63,11 +83,23 @@ extern  "C" {
 *
 *               (b) CPU_TS_TmrRd() MUST be configured to be greater or equal to 32-bits to avoid
 *                   truncation of TS.
+*
+*           (3) When OS_CPU_WIN32_TS_QPC_EN is set to 1, OS_TS_GET() reads the host's performance
+*               counter (QueryPerformanceCounter()) and OSInitHook() gives its frequency to
+*               CPU_TS_TmrFreqSet().  The timestamps then have the same time base as WIN32_HR_TMR.
 *********************************************************************************************************
 */
 
+#ifndef  OS_CPU_WIN32_TS_QPC_EN
+#define  OS_CPU_WIN32_TS_QPC_EN            1u               /* See Note #3.                                           */
+#endif
+
 #if      OS_CFG_TS_EN == 1u
+#if     (OS_CPU_WIN32_TS_QPC_EN > 0u)
+#define  OS_TS_GET()               (CPU_TS)OSTsGetW32()     /* See Note #3.                                           */
+#else
 #define  OS_TS_GET()               (CPU_TS)CPU_TS_TmrRd()   /* See Note #2a.                                          */
+#endif
 #else
 #define  OS_TS_GET()               (CPU_TS)0u
 #endif
@@ -76,14 +108,50 @@ extern  "C" {
 /*
 *********************************************************************************************************
 *                                  WIN32 TIMER METHOD CONFIGURATION
+*
+* Note(s) : (1) WIN32_VIRTUAL does not use a host timer.  Whenever every task is blocked, the idle task
+*               has OSTickW32() advance OSTickCtr to the next deadline of the tick list, which includes
+*               the timer task's wake-up.  A simulation then runs as fast as the host allows and is
+*               repeatable from one run to the next.
+*
+*           (2) The deadline is only known in Dynamic Tick Mode (OS_CFG_DYN_TICK_EN), in which case this
+*               port provides OS_DynTickGet() and OS_DynTickSet().  In Periodic Tick Mode, one tick is
+*               processed each time the idle task runs instead.
+*
+*           (3) Virtual time does not advance while a task is running: a task that never blocks stops the
+*               clock.
+*
+*           (4) WIN32_HR_TMR wakes OSTickW32() with a high resolution waitable timer, armed for the due
+*               time of the next tick.  The due times are computed from the performance counter on a fixed
+*               schedule, so the tick doesn't drift and tick rates up to 10 kHz stay accurate.  Windows
+*               versions without high resolution timers fall back to a standard waitable timer.
+*
+*           (5) When OSTickW32() wakes up late, it processes every tick that is due and adds the ticks
+*               that were late to OSTickW32OverrunCtr.  More than a second late (the process was stopped
+*               in a debugger, ...), it gives up catching up, the skipped ticks are added to
+*               OSTickW32LostCtr.
 *********************************************************************************************************
 */
 
 #define  WIN32_SLEEP                       1u
 #define  WIN32_MM_TMR                      2u               /* Use the high resolution Multimedia timer.              */
+#define  WIN32_VIRTUAL                     3u               /* Advance the time when all tasks block (See Note #1).   */
+#define  WIN32_HR_TMR                      4u               /* Use a high resolution waitable timer (See Note #4).    */
 
 #ifndef  OS_CFG_TIMER_METHOD_WIN32
-#define  OS_CFG_TIMER_METHOD_WIN32          WIN32_MM_TMR
+#define  OS_CFG_TIMER_METHOD_WIN32          WIN32_HR_TMR
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_TIMER_METHOD_WIN32 == WIN32_HR_TMR)
+OS_CPU_EXT  CPU_INT32U  OSTickW32OverrunCtr;                /* Ticks processed late (See Note #5).                    */
+OS_CPU_EXT  CPU_INT32U  OSTickW32LostCtr;                   /* Ticks skipped (See Note #5).                           */
 #endif
 
 
@@ -98,11 +166,17 @@ void         OSIntCtxSw         (void);
 
 void         OSStartHighRdy     (void);
 
+#if (OS_CPU_WIN32_FIBER_EN == 0u)
 CPU_BOOLEAN  OSIntCurTaskSuspend(void);
 CPU_BOOLEAN  OSIntCurTaskResume (void);
+#endif
 
 void         OSDebuggerBreak    (void);
 
+#if (OS_CFG_TS_EN == 1u) && (OS_CPU_WIN32_TS_QPC_EN > 0u)
+CPU_TS       OSTsGetW32         (void);
+#endif
+
 
 #ifdef __cplusplus
 }
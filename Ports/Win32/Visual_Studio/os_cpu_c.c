@@ -78,6 +78,13 @@ extern  "C" {
 
 #define  WIN_MM_MIN_RES                             1u      /* Minimum timer resolution.                              */
 
+                                                            /* Windows 10 1803 and later, missing from older SDKs.    */
+#ifndef  CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define  CREATE_WAITABLE_TIMER_HIGH_RESOLUTION      0x00000002u
+#endif
+
+#define  WIN_FILETIME_HZ                     10000000u      /* Waitable timers count in 100 ns units.                 */
+
 
 /*
 *********************************************************************************************************
@@ -112,6 +119,9 @@ typedef  struct  os_task {
     HANDLE                    ThreadHandle;
     HANDLE                    InitSignalPtr;                /* Task created         signal.                           */
     HANDLE                    SignalPtr;                    /* Task synchronization signal.                           */
+#if (OS_CPU_WIN32_FIBER_EN > 0u)
+    LPVOID                    FiberPtr;                     /* Task fiber, replaces the thread.                       */
+#endif
 } OS_TASK;
 
 
@@ -145,10 +155,28 @@ static  HANDLE     OSTerminate_SignalPtr;
 
 static  HANDLE     OSTick_Thread;
 static  DWORD      OSTick_ThreadId;
+#if (OS_CPU_WIN32_FIBER_EN > 0u)
+static  LPVOID     OSMain_FiberPtr;                         /* Fiber of the thread that called OSInit().              */
+static  OS_TASK   *OSTaskFiberDelPtr;                       /* Task that deleted itself, see OSCtxSw().               */
+static  HANDLE     OSTick_FiberSignalPtr;                   /* Set by OSTickW32() for the idle task.                  */
+static  LONG       OSTick_FiberCtr;                         /* Ticks not processed yet.                               */
+#endif
 #if (OS_CFG_TIMER_METHOD_WIN32 == WIN32_MM_TMR)
 static  HANDLE     OSTick_SignalPtr;
 static  TIMECAPS   OSTick_TimerCap;
 static  MMRESULT   OSTick_TimerId;
+#elif (OS_CFG_TIMER_METHOD_WIN32 == WIN32_VIRTUAL)
+static  HANDLE     OSTick_SignalPtr;                        /* Set by the idle task.                                  */
+#if (OS_CFG_DYN_TICK_EN > 0u)
+static  OS_TICK    OSTick_VirtStep;                         /* Ticks to the next deadline, 0 if there is none.        */
+#endif
+#elif (OS_CFG_TIMER_METHOD_WIN32 == WIN32_HR_TMR)
+static  HANDLE     OSTick_SignalPtr;                        /* Waitable timer, signaled at the next due time.         */
+static  LONGLONG   OSTick_QpcNext;                          /* Due time of the next tick, in counts.                  */
+static  LONGLONG   OSTick_QpcPeriod;                        /* Counts per tick, rounded down.                         */
+static  LONGLONG   OSTick_QpcRem;                           /* Counts left over per tick by the rounding.             */
+static  LONGLONG   OSTick_QpcAcc;                           /* Left-over counts accumulated.                          */
+static  LONGLONG   OSTick_QpcFreq;                          /* Frequency of the performance counter.                  */
 #endif
 
 
@@ -159,7 +187,16 @@ static  MMRESULT   OSTick_TimerId;
 */
 
 static  DWORD  WINAPI   OSTickW32         (LPVOID     p_arg);
+#if (OS_CFG_TIMER_METHOD_WIN32 == WIN32_HR_TMR)
+static  void            OSTickW32Arm      (LONGLONG   now);
+static  OS_TICK         OSTickW32Due      (void);
+#endif
+#if (OS_CPU_WIN32_FIBER_EN > 0u)
+static  VOID   WINAPI   OSTaskFiber       (LPVOID     p_arg);
+static  void            OSTaskFiberReap   (void);
+#else
 static  DWORD  WINAPI   OSTaskW32         (LPVOID     p_arg);
+#endif
 
 static  OS_TASK        *OSTaskGet         (OS_TCB    *p_tcb);
 static  void            OSTaskTerminate   (OS_TASK   *p_task);
@@ -183,19 +220,77 @@ static  int             OS_Printf         (char      *p_str, ...);
 *
 * Arguments  : None.
 *
-* Note(s)    : None.
+* Note(s)    : 1) With WIN32_VIRTUAL, the idle task running means that every task is blocked.  It has
+*                 OSTickW32() advance the time, by one tick or to the next deadline in Dynamic Tick Mode.
+*                 OSTickW32() has a higher priority and preempts the idle task right away.
+*
+*              2) With OS_CPU_WIN32_FIBER_EN, the idle task processes the ticks counted by OSTickW32(),
+*                 or advances the virtual time itself.  On termination, it switches back to the fiber
+*                 of OSStartHighRdy(), which deletes the tasks.
 *********************************************************************************************************
 */
 
 void  OSIdleTaskHook (void)
 {
+#if (OS_CPU_WIN32_FIBER_EN > 0u)
+    OS_TICK  ticks;
+#if (OS_CFG_TIMER_METHOD_WIN32 != WIN32_VIRTUAL)
+    HANDLE   wait_signal[2];
+#endif
+#endif
+
+
 #if OS_CFG_APP_HOOKS_EN > 0u
     if (OS_AppIdleTaskHookPtr != (OS_APP_HOOK_VOID)0) {
         (*OS_AppIdleTaskHookPtr)();
     }
 #endif
 
+#if (OS_CPU_WIN32_FIBER_EN > 0u)
+    if (WaitForSingleObject(OSTerminate_SignalPtr, 0u) == WAIT_OBJECT_0) {
+        SwitchToFiber(OSMain_FiberPtr);                     /* See Note #2.                                           */
+    }
+
+#if (OS_CFG_TIMER_METHOD_WIN32 == WIN32_VIRTUAL)
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    ticks = OSTick_VirtStep;
+    if (ticks == 0u) {                                      /* Nothing to wait for.                                   */
+        Sleep(1u);
+        return;
+    }
+#else
+    ticks = 1u;
+#endif
+#else
+    wait_signal[0] = OSTerminate_SignalPtr;
+    wait_signal[1] = OSTick_FiberSignalPtr;
+    if (WaitForMultipleObjects(2, wait_signal, FALSE, INFINITE) != (WAIT_OBJECT_0 + 1u)) {
+        return;
+    }
+    ticks = (OS_TICK)InterlockedExchange(&OSTick_FiberCtr, 0);
+#endif
+
+    OSIntEnter();
+#if (OS_CFG_TIMER_METHOD_WIN32 == WIN32_VIRTUAL) && (OS_CFG_DYN_TICK_EN > 0u)
+    OSTimeDynTick(ticks);
+#else
+    while (ticks > 0u) {
+        OSTimeTick();
+        ticks--;
+    }
+#endif
+    OSIntExit();
+#elif (OS_CFG_TIMER_METHOD_WIN32 == WIN32_VIRTUAL)
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    if (OSTick_VirtStep == 0u) {                            /* Nothing to wait for but a simulated interrupt.         */
+        Sleep(1u);
+        return;
+    }
+#endif
+    SetEvent(OSTick_SignalPtr);                             /* See Note #1.                                           */
+#else
     Sleep(1u);                                              /* Reduce CPU utilization.                                */
+#endif
 }
 
 
@@ -217,13 +312,16 @@ void  OSIdleTaskHook (void)
 
 void  OSInitHook (void)
 {
-    HANDLE  hProc;
+    HANDLE         hProc;
+#if (OS_CFG_TIMER_METHOD_WIN32 == WIN32_HR_TMR) || ((OS_CFG_TS_EN == 1u) && (OS_CPU_WIN32_TS_QPC_EN > 0u))
+    LARGE_INTEGER  freq;
+#endif
 
 
 #ifdef OS_CFG_MSG_TRACE_EN
 #if (OS_CFG_TIMER_METHOD_WIN32 == WIN32_SLEEP)
     if (OSCfg_TickRate_Hz > 100u) {
-        OS_Printf("OS_CFG_TIMER_METHOD_WIN32 Warning: Sleep timer method cannot maintain time accuracy with the current setting of OSCfg_TickRate_Hz (%du). Consider using Multimedia timer method.\n\n",
+        OS_Printf("OS_CFG_TIMER_METHOD_WIN32 Warning: Sleep timer method cannot maintain time accuracy with the current setting of OSCfg_TickRate_Hz (%du). Consider using the high resolution timer method.\n\n",
                   OSCfg_TickRate_Hz);
     }
 #endif
@@ -232,13 +330,20 @@ void  OSInitHook (void)
     OSTaskListPtr         = NULL;
     OSTerminate_SignalPtr = NULL;
     OSTick_Thread         = NULL;
-#if (OS_CFG_TIMER_METHOD_WIN32 == WIN32_MM_TMR)
+#if (OS_CFG_TIMER_METHOD_WIN32 != WIN32_SLEEP)
     OSTick_SignalPtr      = NULL;
 #endif
 
 
     CPU_IntInit();                                          /* Initialize Critical Section objects.                   */
 
+#if (OS_CFG_TIMER_METHOD_WIN32 == WIN32_HR_TMR) || ((OS_CFG_TS_EN == 1u) && (OS_CPU_WIN32_TS_QPC_EN > 0u))
+    QueryPerformanceFrequency(&freq);                       /* Fixed at boot, never fails since Windows XP.           */
+#endif
+#if (OS_CFG_TS_EN == 1u) && (OS_CPU_WIN32_TS_QPC_EN > 0u) && (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+    CPU_TS_TmrFreqSet((CPU_TS_TMR_FREQ)freq.QuadPart);      /* Time base of OS_TS_GET(), see os_cpu.h.                */
+#endif
+
 
     hProc = GetCurrentProcess();
     SetPriorityClass(hProc, HIGH_PRIORITY_CLASS);
@@ -246,6 +351,26 @@ void  OSInitHook (void)
 
     OSSetThreadName(GetCurrentThreadId(), "main()");
 
+#if (OS_CPU_WIN32_FIBER_EN > 0u)
+    OSTaskFiberDelPtr = NULL;
+    OSTick_FiberCtr   = 0;
+    OSMain_FiberPtr   = ConvertThreadToFiber(NULL);         /* Tasks are fibers of this thread.                       */
+    if (OSMain_FiberPtr == NULL) {
+#ifdef OS_CFG_MSG_TRACE_EN
+        OS_Printf("Error: ConvertThreadToFiber failed.\n");
+#endif
+        return;
+    }
+
+    OSTick_FiberSignalPtr = CreateEvent(NULL, FALSE, FALSE, NULL);
+    if (OSTick_FiberSignalPtr == NULL) {
+#ifdef OS_CFG_MSG_TRACE_EN
+        OS_Printf("Error: CreateEvent [OSTickFiber] failed.\n");
+#endif
+        return;
+    }
+#endif
+
                                                             /* Manual reset enabled to broadcast terminate signal.    */
     OSTerminate_SignalPtr = CreateEvent(NULL, TRUE, FALSE, NULL);
     if (OSTerminate_SignalPtr == NULL) {
@@ -339,6 +464,47 @@ void  OSInitHook (void)
         CloseHandle(OSTerminate_SignalPtr);
 
         OSTick_SignalPtr      = NULL;
+        OSTick_Thread         = NULL;
+        OSTerminate_SignalPtr = NULL;
+        return;
+    }
+#elif (OS_CFG_TIMER_METHOD_WIN32 == WIN32_VIRTUAL)
+                                                            /* Auto reset: one advance per request.                   */
+    OSTick_SignalPtr = CreateEvent(NULL, FALSE, FALSE, NULL);
+    if (OSTick_SignalPtr == NULL) {
+#ifdef OS_CFG_MSG_TRACE_EN
+        OS_Printf("Error: CreateEvent [OSTick] failed.\n");
+#endif
+        CloseHandle(OSTick_Thread);
+        CloseHandle(OSTerminate_SignalPtr);
+
+        OSTick_Thread         = NULL;
+        OSTerminate_SignalPtr = NULL;
+        return;
+    }
+#elif (OS_CFG_TIMER_METHOD_WIN32 == WIN32_HR_TMR)
+    OSTickW32OverrunCtr = 0u;
+    OSTickW32LostCtr    = 0u;
+    OSTick_QpcFreq      = freq.QuadPart;
+    OSTick_QpcPeriod    = OSTick_QpcFreq / (LONGLONG)OSCfg_TickRate_Hz;
+    OSTick_QpcRem       = OSTick_QpcFreq % (LONGLONG)OSCfg_TickRate_Hz;
+    OSTick_QpcAcc       = 0;
+    OSTick_QpcNext      = 0;
+                                                            /* Auto reset: one wake-up per due time.                  */
+    OSTick_SignalPtr = CreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+    if (OSTick_SignalPtr == NULL) {                         /* No high resolution timer on this version of Windows.   */
+#ifdef OS_CFG_MSG_TRACE_EN
+        OS_Printf("OS_CFG_TIMER_METHOD_WIN32 Warning: High resolution timers not available, the tick will be less accurate.\n\n");
+#endif
+        OSTick_SignalPtr = CreateWaitableTimerExW(NULL, NULL, 0u, TIMER_ALL_ACCESS);
+    }
+    if (OSTick_SignalPtr == NULL) {
+#ifdef OS_CFG_MSG_TRACE_EN
+        OS_Printf("Error: CreateWaitableTimer [OSTick] failed.\n");
+#endif
+        CloseHandle(OSTick_Thread);
+        CloseHandle(OSTerminate_SignalPtr);
+
         OSTick_Thread         = NULL;
         OSTerminate_SignalPtr = NULL;
         return;
@@ -404,6 +570,7 @@ void  OSTaskCreateHook (OS_TCB  *p_tcb)
 #else
 	p_task->OSTaskName = "";
 #endif
+#if (OS_CPU_WIN32_FIBER_EN == 0u)
                                                             /* See Note #2.                                           */
     p_task->SignalPtr = CreateEvent(NULL, FALSE, FALSE, NULL);
     if (p_task->SignalPtr == NULL) {
@@ -427,7 +594,19 @@ void  OSTaskCreateHook (OS_TCB  *p_tcb)
 #endif
         return;
     }
+#endif
 
+#if (OS_CPU_WIN32_FIBER_EN > 0u)
+    p_task->FiberPtr = CreateFiber(0u, OSTaskFiber, p_tcb); /* Default stack size of the executable.                  */
+    if (p_task->FiberPtr == NULL) {
+#ifdef OS_CFG_MSG_TRACE_EN
+        OS_Printf("Task[%3.1d] '%s' failed to be created.\n",
+                  p_tcb->Prio,
+                  p_task->OSTaskName);
+#endif
+        return;
+    }
+#else
     p_task->ThreadHandle = CreateThread(NULL, 0, OSTaskW32, p_tcb, CREATE_SUSPENDED, &p_task->ThreadID);
     if (p_task->ThreadHandle == NULL) {
         CloseHandle(p_task->InitSignalPtr);
@@ -448,6 +627,7 @@ void  OSTaskCreateHook (OS_TCB  *p_tcb)
               p_tcb->Prio,
               p_task->OSTaskName,
               p_task->ThreadID);
+#endif
 #endif
 
     p_task->TaskState = STATE_CREATED;
@@ -475,6 +655,9 @@ void  OSTaskCreateHook (OS_TCB  *p_tcb)
 * Arguments  : p_tcb        Pointer to the task control block of the task being deleted.
 *
 * Note(s)    : 1) Interrupts are disabled during this call.
+*
+*              2) With OS_CPU_WIN32_FIBER_EN, a fiber cannot delete itself.  A task deleting itself is
+*                 only marked and its fiber is deleted by the next task to run (see OSCtxSw()).
 *********************************************************************************************************
 */
 
@@ -495,6 +678,18 @@ void  OSTaskDelHook (OS_TCB  *p_tcb)
         return;
     }
 
+#if (OS_CPU_WIN32_FIBER_EN > 0u)
+    if (p_task->FiberPtr == NULL) {                         /* Fiber not created or already deleted.                  */
+        return;
+    }
+
+    if (p_task->FiberPtr == GetCurrentFiber()) {            /* See Note #2.                                           */
+        p_task->TaskState = STATE_TERMINATING;
+    } else {
+        DeleteFiber(p_task->FiberPtr);
+        OSTaskTerminate(p_task);
+    }
+#else
     switch (p_task->TaskState) {
         case STATE_RUNNING:
              if (GetCurrentThreadId() == p_task->ThreadID) {
@@ -523,6 +718,7 @@ void  OSTaskDelHook (OS_TCB  *p_tcb)
         default:
              break;
     }
+#endif
 }
 
 
@@ -605,6 +801,9 @@ CPU_STK  *OSTaskStkInit (OS_TASK_PTR    p_task,
     p_task_info->ThreadHandle  =  NULL;
     p_task_info->InitSignalPtr =  NULL;
     p_task_info->SignalPtr     =  NULL;
+#if (OS_CPU_WIN32_FIBER_EN > 0u)
+    p_task_info->FiberPtr      =  NULL;
+#endif
 
 	return ((CPU_STK*)p_task_info);
 }
@@ -704,6 +903,10 @@ void  OSTimeTickHook (void)
 * Note(s)    : 1) OSStartHighRdy() MUST:
 *                      a) Call OSTaskSwHook() then,
 *                      b) Switch to the highest priority task.
+*
+*              2) With OS_CPU_WIN32_FIBER_EN, a task always starts inside the critical section of the task
+*                 that switched to it, see OSTaskFiber().  OSStartHighRdy() enters one for the first task.
+*                 The idle task switches back here on termination.
 *********************************************************************************************************
 */
 
@@ -718,10 +921,18 @@ void  OSStartHighRdy (void)
     OSTaskSwHook();
 
     p_task = OSTaskGet(OSTCBHighRdyPtr);
+#if (OS_CPU_WIN32_FIBER_EN > 0u)
+    ResumeThread(OSTick_Thread);                            /* Start OSTick Thread.                                   */
+
+    CPU_CRITICAL_ENTER();                                   /* See Note #2.                                           */
+    p_task->TaskState = STATE_RUNNING;
+    SwitchToFiber(p_task->FiberPtr);
+#else
     ResumeThread(p_task->ThreadHandle);
                                                             /* Wait while task is created and ready to run.           */
     SignalObjectAndWait(p_task->SignalPtr, p_task->InitSignalPtr, INFINITE, FALSE);
     ResumeThread(OSTick_Thread);                            /* Start OSTick Thread.                                   */
+#endif
     WaitForSingleObject(OSTick_Thread, INFINITE);           /* Wait until OSTick Thread has terminated.               */
 
 
@@ -729,10 +940,18 @@ void  OSStartHighRdy (void)
     timeKillEvent(OSTick_TimerId);
     timeEndPeriod(OSTick_TimerCap.wPeriodMin);
     CloseHandle(OSTick_SignalPtr);
+#elif (OS_CFG_TIMER_METHOD_WIN32 == WIN32_VIRTUAL)
+    CloseHandle(OSTick_SignalPtr);
+#elif (OS_CFG_TIMER_METHOD_WIN32 == WIN32_HR_TMR)
+    CancelWaitableTimer(OSTick_SignalPtr);
+    CloseHandle(OSTick_SignalPtr);
 #endif
 
     CloseHandle(OSTick_Thread);
     CloseHandle(OSTerminate_SignalPtr);
+#if (OS_CPU_WIN32_FIBER_EN > 0u)
+    CloseHandle(OSTick_FiberSignalPtr);
+#endif
 
 
 #ifdef OS_CFG_MSG_TRACE_EN
@@ -799,9 +1018,40 @@ void  OSStartHighRdy (void)
 *
 *                               Restore processor registers from (OSTCBHighRdy->OSTCBStkPtr);
 *                           }
+*
+*              3) With OS_CPU_WIN32_FIBER_EN, the switch is a SwitchToFiber() within the same thread.  A fiber
+*                 cannot delete itself: a task that deleted itself is recorded in OSTaskFiberDelPtr and its
+*                 fiber is deleted by the task switched to, once it runs (see OSTaskFiberReap()).
 *********************************************************************************************************
 */
 
+#if (OS_CPU_WIN32_FIBER_EN > 0u)
+void  OSCtxSw (void)
+{
+    OS_TASK  *p_task_cur;
+    OS_TASK  *p_task_new;
+
+
+    p_task_cur = OSTaskGet(OSTCBCurPtr);
+
+    OSTaskSwHook();
+
+    OSTCBCurPtr = OSTCBHighRdyPtr;
+    OSPrioCur   = OSPrioHighRdy;
+
+    if (p_task_cur->TaskState == STATE_TERMINATING) {
+        OSTaskFiberDelPtr     = p_task_cur;                 /* See Note #3.                                           */
+    } else {
+        p_task_cur->TaskState = STATE_SUSPENDED;
+    }
+
+    p_task_new            = OSTaskGet(OSTCBHighRdyPtr);
+    p_task_new->TaskState = STATE_RUNNING;
+    SwitchToFiber(p_task_new->FiberPtr);
+
+    OSTaskFiberReap();                                      /* Resumed by another task.                               */
+}
+#else
 void  OSCtxSw (void)
 {
     OS_TASK  *p_task_cur;
@@ -918,6 +1168,7 @@ void  OSCtxSw (void)
     WaitForSingleObject(p_task_cur->SignalPtr, INFINITE);
     CPU_CRITICAL_ENTER();
 }
+#endif
 
 
 /*
@@ -938,18 +1189,28 @@ void  OSCtxSw (void)
 *
 *              3) OSIntCurTaskResume()  MUST be called after    OSIntExit() to switch to the highest
 *                 priority task.
+*
+*              4) With OS_CPU_WIN32_FIBER_EN, the ticks are processed by the idle task itself, so the
+*                 switch is the same as a task level one.
 *********************************************************************************************************
 */
 
 void  OSIntCtxSw (void)
 {
+#if (OS_CPU_WIN32_FIBER_EN > 0u)
+    if (OSTCBCurPtr != OSTCBHighRdyPtr) {                   /* See Note #4.                                           */
+        OSCtxSw();
+    }
+#else
     OSTaskSwHook();
 
     OSTCBCurPtr = OSTCBHighRdyPtr;
     OSPrioCur   = OSPrioHighRdy;
+#endif
 }
 
 
+#if (OS_CPU_WIN32_FIBER_EN == 0u)
 /*
 *********************************************************************************************************
 *                                        OSIntCurTaskSuspend()
@@ -1154,6 +1415,52 @@ CPU_BOOLEAN  OSIntCurTaskResume (void)
 
     return (ret);
 }
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          GET DYNAMIC TICK
+*
+* Description: Return the number of OS ticks that elapsed since the kernel last programmed the tick.
+*
+* Arguments  : None.
+*
+* Returns    : Always 0, virtual time does not advance while a task is running.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and is only provided with WIN32_VIRTUAL.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_TIMER_METHOD_WIN32 == WIN32_VIRTUAL) && (OS_CFG_DYN_TICK_EN > 0u)
+OS_TICK  OS_DynTickGet (void)
+{
+    return (0u);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SET DYNAMIC TICK
+*
+* Description: Record the number of OS ticks to the next deadline.
+*
+* Arguments  : ticks        Number of ticks to the next deadline, 0 for an indefinite delay.
+*
+* Returns    : The number of ticks that will elapse before the next tick, always 'ticks'.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and is only provided with WIN32_VIRTUAL.
+*                 OSTickW32() advances the time by that amount once every task is blocked.
+*********************************************************************************************************
+*/
+
+OS_TICK  OS_DynTickSet (OS_TICK  ticks)
+{
+    OSTick_VirtStep = ticks;
+
+    return (ticks);
+}
+#endif
 
 
 /*
@@ -1165,24 +1472,46 @@ CPU_BOOLEAN  OSIntCurTaskResume (void)
 * Arguments  : p_arg        Pointer to argument of the task.
 *
 * Note(s)    : 1) Priorities of these tasks are very important.
+*
+*              2) With WIN32_VIRTUAL, the time is only advanced if the idle task is still the one that was
+*                 interrupted.  A simulated interrupt may have readied a task since the request was made.
+*
+*              3) With OS_CPU_WIN32_FIBER_EN, the tasks cannot be interrupted from this thread.  The tick is
+*                 counted and the idle task is signaled to process it (see OSIdleTaskHook()).
+*
+*              4) With WIN32_HR_TMR, every tick that is due is processed, see OSTickW32Due().
 *********************************************************************************************************
 */
 
 static  DWORD  WINAPI  OSTickW32 (LPVOID  p_arg)
 {
-    CPU_BOOLEAN  terminate;
-    CPU_BOOLEAN  suspended;
-#if (OS_CFG_TIMER_METHOD_WIN32 == WIN32_MM_TMR)
-    HANDLE       wait_signal[2];
+    CPU_BOOLEAN    terminate;
+#if (OS_CPU_WIN32_FIBER_EN == 0u)
+    CPU_BOOLEAN    suspended;
+#endif
+#if (OS_CFG_TIMER_METHOD_WIN32 != WIN32_SLEEP)
+    HANDLE         wait_signal[2];
 #endif
+#if (OS_CFG_TIMER_METHOD_WIN32 == WIN32_HR_TMR)
+    OS_TICK        ticks;
+    LARGE_INTEGER  now;
+#endif
+#if (OS_CPU_WIN32_FIBER_EN == 0u)
     CPU_SR_ALLOC();
+#endif
 
 
-#if (OS_CFG_TIMER_METHOD_WIN32 == WIN32_MM_TMR)
+#if (OS_CFG_TIMER_METHOD_WIN32 != WIN32_SLEEP)
     wait_signal[0] = OSTerminate_SignalPtr;
     wait_signal[1] = OSTick_SignalPtr;
 #endif
 
+#if (OS_CFG_TIMER_METHOD_WIN32 == WIN32_HR_TMR)
+    QueryPerformanceCounter(&now);                          /* The schedule of the ticks starts now.                  */
+    OSTick_QpcNext = now.QuadPart + OSTick_QpcPeriod;
+    OSTickW32Arm(now.QuadPart);
+#endif
+
 
     (void)p_arg;                                            /* Prevent compiler warning                               */
 
@@ -1195,18 +1524,54 @@ static  DWORD  WINAPI  OSTickW32 (LPVOID  p_arg)
 #elif (OS_CFG_TIMER_METHOD_WIN32 == WIN32_SLEEP)
         switch (WaitForSingleObject(OSTerminate_SignalPtr, 1000u / OSCfg_TickRate_Hz)) {
             case WAIT_TIMEOUT:
+#elif (OS_CFG_TIMER_METHOD_WIN32 == WIN32_VIRTUAL)
+        switch (WaitForMultipleObjects(2, wait_signal, FALSE, INFINITE)) {
+            case WAIT_OBJECT_0 + 1u:
+#elif (OS_CFG_TIMER_METHOD_WIN32 == WIN32_HR_TMR)
+        switch (WaitForMultipleObjects(2, wait_signal, FALSE, INFINITE)) {
+            case WAIT_OBJECT_0 + 1u:
+                 ticks = OSTickW32Due();                    /* See Note #4.                                           */
+                 if (ticks == 0u) {                         /* Woken up before the due time, wait again.              */
+                     break;
+                 }
 #endif
+#if (OS_CPU_WIN32_FIBER_EN > 0u)
+#if (OS_CFG_TIMER_METHOD_WIN32 == WIN32_HR_TMR)
+                 InterlockedExchangeAdd(&OSTick_FiberCtr, (LONG)ticks);
+#else
+                 InterlockedIncrement(&OSTick_FiberCtr);    /* See Note #3.                                           */
+#endif
+                 SetEvent(OSTick_FiberSignalPtr);
+#else
                  CPU_CRITICAL_ENTER();
 
                  suspended = OSIntCurTaskSuspend();
                  if (suspended == OS_TRUE) {
                      OSIntEnter();
+#if (OS_CFG_TIMER_METHOD_WIN32 == WIN32_VIRTUAL)
+                     if (OSTCBCurPtr == &OSIdleTaskTCB) {   /* See Note #2.                                           */
+#if (OS_CFG_DYN_TICK_EN > 0u)
+                         if (OSTick_VirtStep != 0u) {
+                             OSTimeDynTick(OSTick_VirtStep);
+                         }
+#else
+                         OSTimeTick();
+#endif
+                     }
+#elif (OS_CFG_TIMER_METHOD_WIN32 == WIN32_HR_TMR)
+                     while (ticks > 0u) {
+                         OSTimeTick();
+                         ticks--;
+                     }
+#else
                      OSTimeTick();
+#endif
                      OSIntExit();
                      OSIntCurTaskResume();
                  }
 
                  CPU_CRITICAL_EXIT();
+#endif
                  break;
 
 
@@ -1232,6 +1597,183 @@ static  DWORD  WINAPI  OSTickW32 (LPVOID  p_arg)
 }
 
 
+/*
+*********************************************************************************************************
+*                                     HIGH RESOLUTION TICK SCHEDULE
+*
+* Description: OSTickW32Due() counts the ticks that are due and arms the waitable timer for the next
+*              one.  OSTickW32Arm() arms the waitable timer for OSTick_QpcNext.
+*
+* Arguments  : now          Value of the performance counter.
+*
+* Returns    : The number of ticks to process, 0 if the timer expired before the due time.
+*
+* Note(s)    : 1) The due times are multiples of the tick period from the start, in counts of the
+*                 performance counter.  The remainder of the division of the frequency by the tick rate is
+*                 accumulated so that exactly OSCfg_TickRate_Hz ticks are due per second.
+*
+*              2) When more than a second of ticks is due, the schedule restarts from now instead of
+*                 processing them in a burst (See os_cpu.h, Note #5 of the timer method).
+*
+*              3) The timer is armed for the delay left to the due time, rounded up to 100 ns, so that it
+*                 never expires early.  The delay is relative, but the due time it is computed from is not,
+*                 so the lateness of one wake-up doesn't add up over the next ticks.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_TIMER_METHOD_WIN32 == WIN32_HR_TMR)
+static  OS_TICK  OSTickW32Due (void)
+{
+    LARGE_INTEGER  now;
+    LONGLONG       late;
+    OS_TICK        ticks;
+
+
+    QueryPerformanceCounter(&now);
+    ticks = 0u;
+    while (now.QuadPart >= OSTick_QpcNext) {                /* Every tick due by now, see Note #1.                    */
+        if (ticks >= OSCfg_TickRate_Hz) {                   /* See Note #2.                                           */
+            late              = (now.QuadPart - OSTick_QpcNext) / OSTick_QpcPeriod + 1;
+            OSTickW32LostCtr += (CPU_INT32U)late;
+            OSTick_QpcNext    =  now.QuadPart + OSTick_QpcPeriod;
+            OSTick_QpcAcc     =  0;
+#ifdef OS_CFG_MSG_TRACE_EN
+            OS_Printf("Thread    '%-32s' Warning: %u ticks lost.\n", "OSTickW32", (unsigned)late);
+#endif
+            break;
+        }
+        OSTick_QpcNext += OSTick_QpcPeriod;
+        OSTick_QpcAcc  += OSTick_QpcRem;
+        if (OSTick_QpcAcc >= (LONGLONG)OSCfg_TickRate_Hz) {
+            OSTick_QpcAcc  -= (LONGLONG)OSCfg_TickRate_Hz;
+            OSTick_QpcNext += 1;
+        }
+        ticks++;
+    }
+    if (ticks > 1u) {                                       /* Woken up after the due time of the next tick.          */
+        OSTickW32OverrunCtr += (CPU_INT32U)(ticks - 1u);
+    }
+
+    OSTickW32Arm(now.QuadPart);
+
+    return (ticks);
+}
+
+
+static  void  OSTickW32Arm (LONGLONG  now)
+{
+    LARGE_INTEGER  due;
+    LONGLONG       dly;
+
+
+    dly = ((OSTick_QpcNext - now) * WIN_FILETIME_HZ + OSTick_QpcFreq - 1) / OSTick_QpcFreq;
+    if (dly < 1) {
+        dly = 1;
+    }
+    due.QuadPart = -dly;                                    /* Negative: relative to now (See Note #3).               */
+    SetWaitableTimer(OSTick_SignalPtr, &due, 0, NULL, NULL, FALSE);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     TIMESTAMP - OSTsGetW32()
+*
+* Description: This function reads the performance counter of the host for OS_TS_GET().
+*
+* Arguments  : None.
+*
+* Returns    : The lower 32 bits of the performance counter.
+*
+* Note(s)    : 1) The counter runs at the frequency given to CPU_TS_TmrFreqSet() by OSInitHook(), usually
+*                 10 MHz, so the timestamps wrap around after a few minutes like a 32-bit cycle counter.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_TS_EN == 1u) && (OS_CPU_WIN32_TS_QPC_EN > 0u)
+CPU_TS  OSTsGetW32 (void)
+{
+    LARGE_INTEGER  cnt;
+
+
+    QueryPerformanceCounter(&cnt);
+
+    return ((CPU_TS)cnt.QuadPart);
+}
+#endif
+
+
+#if (OS_CPU_WIN32_FIBER_EN > 0u)
+/*
+*********************************************************************************************************
+*                                      WIN32 FIBER - OSTaskFiber()
+*
+* Description: This function is a generic Win32 fiber wrapper for uC/OS-III tasks.
+*
+* Arguments  : p_arg        Pointer to the task's TCB.
+*
+* Note(s)    : 1) The fiber is entered from OSCtxSw() or OSStartHighRdy(), inside the critical section of
+*                 the task that switched to it.  That critical section is left here.
+*********************************************************************************************************
+*/
+
+static  VOID  WINAPI  OSTaskFiber (LPVOID  p_arg)
+{
+    OS_TASK  *p_task;
+    OS_TCB   *p_tcb;
+    OS_ERR    err;
+    CPU_SR_ALLOC();
+
+
+#if (CPU_CFG_CRITICAL_METHOD == CPU_CRITICAL_METHOD_STATUS_LOCAL)
+    cpu_sr = 0;
+#endif
+
+    p_tcb  = (OS_TCB *)p_arg;
+    p_task =  OSTaskGet(p_tcb);
+
+    OSTaskFiberReap();
+
+#ifdef OS_CFG_MSG_TRACE_EN
+    OS_Printf("Task[%3.1d] '%-32s' Running\n",
+              p_tcb->Prio,
+              p_task->OSTaskName);
+#endif
+
+    CPU_CRITICAL_EXIT();                                    /* See Note #1.                                           */
+
+    p_task->TaskPtr(p_task->TaskArgPtr);
+
+    OSTaskDel(p_tcb, &err);                                 /* Never returns, see OSCtxSw().                          */
+}
+
+
+/*
+*********************************************************************************************************
+*                                          OSTaskFiberReap()
+*
+* Description: This function deletes the fiber of the task that deleted itself, if any.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) It is called by every task right after it was switched to, in the critical section.
+*********************************************************************************************************
+*/
+
+static  void  OSTaskFiberReap (void)
+{
+    OS_TASK  *p_task;
+
+
+    p_task = OSTaskFiberDelPtr;
+    if (p_task != NULL) {
+        OSTaskFiberDelPtr = NULL;
+        DeleteFiber(p_task->FiberPtr);
+        OSTaskTerminate(p_task);
+    }
+}
+#else
 /*
 *********************************************************************************************************
 *                                      WIN32 TASK - OSTaskW32()
@@ -1274,6 +1816,7 @@ static  DWORD  WINAPI  OSTaskW32 (LPVOID  p_arg)
 
     return (0u);
 }
+#endif
 
 
 /*
@@ -1340,8 +1883,12 @@ static  void  OSTaskTerminate (OS_TASK  *p_task)
                   p_task->OSTaskName);
     }
 #endif
+#if (OS_CPU_WIN32_FIBER_EN == 0u)
     CloseHandle(p_task->InitSignalPtr);
     CloseHandle(p_task->SignalPtr);
+#else
+    p_task->FiberPtr      = NULL;
+#endif
 
     p_task->OSTCBPtr      = NULL;
     p_task->OSTaskName    = NULL;
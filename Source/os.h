@@ -65,6 +65,10 @@ extern "C" {
 #define  OS_CFG_TASK_IDLE_EN             1u
 #endif
 
+#ifndef OS_CFG_TASK_IDLE_PM_EN
+#define  OS_CFG_TASK_IDLE_PM_EN          0u
+#endif
+
 #ifndef OS_CFG_TASK_STK_REDZONE_EN
 #define  OS_CFG_TASK_STK_REDZONE_EN      0u
 #endif
@@ -73,1723 +77,6706 @@ extern "C" {
 #define  OS_CFG_INVALID_OS_CALLS_CHK_EN  0u
 #endif
 
+#ifndef OS_CFG_INT_KA_CHK_EN
+#define  OS_CFG_INT_KA_CHK_EN            0u
+#endif
 
-/*
-************************************************************************************************************************
-*                                               CRITICAL SECTION HANDLING
-************************************************************************************************************************
-*/
+#ifndef OS_CFG_ISR_STK_SP_EN
+#define  OS_CFG_ISR_STK_SP_EN            0u
+#endif
 
+#ifndef OS_CFG_PRIO_TBL_2LVL_EN
+#define  OS_CFG_PRIO_TBL_2LVL_EN         0u
+#endif
 
-#if      (OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u) && defined(CPU_CFG_INT_DIS_MEAS_EN)
-#define  OS_SCHED_LOCK_TIME_MEAS_START()    OS_SchedLockTimeMeasStart()
-#else
-#define  OS_SCHED_LOCK_TIME_MEAS_START()
+#ifndef OS_CFG_PRIO_MAP_EN
+#define  OS_CFG_PRIO_MAP_EN              0u
 #endif
 
+#ifndef OS_CFG_PEND_LIST_BITMAP_EN
+#define  OS_CFG_PEND_LIST_BITMAP_EN      0u
+#endif
 
-#if      (OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u) && defined(CPU_CFG_INT_DIS_MEAS_EN)
-#define  OS_SCHED_LOCK_TIME_MEAS_STOP()     OS_SchedLockTimeMeasStop()
-#else
-#define  OS_SCHED_LOCK_TIME_MEAS_STOP()
+#ifndef OS_CFG_DBG_PEND_NAME_EN
+#define  OS_CFG_DBG_PEND_NAME_EN         1u
 #endif
 
+#ifndef OS_CFG_OBJ_STAT_EN
+#define  OS_CFG_OBJ_STAT_EN              0u
+#endif
 
-/*
-************************************************************************************************************************
-*                                                     MISCELLANEOUS
-************************************************************************************************************************
-*/
+#ifndef OS_CFG_OBJ_REG_EN
+#define  OS_CFG_OBJ_REG_EN               0u
+#endif
 
-#ifdef   OS_GLOBALS
-#define  OS_EXT
-#else
-#define  OS_EXT  extern
+#ifndef OS_CFG_OBJ_REG_SIZE
+#define  OS_CFG_OBJ_REG_SIZE            64u
 #endif
 
-#ifndef  OS_FALSE
-#define  OS_FALSE                       0u
+#ifndef OS_CFG_SMALL_MEM_EN
+#define  OS_CFG_SMALL_MEM_EN             0u
 #endif
 
-#ifndef  OS_TRUE
-#define  OS_TRUE                        1u
+#ifndef OS_CFG_POST_ALL_INT_EN
+#define  OS_CFG_POST_ALL_INT_EN          0u
 #endif
 
-#define  OS_PRIO_TBL_SIZE          (((OS_CFG_PRIO_MAX - 1u) / ((CPU_CFG_DATA_SIZE * 8u))) + 1u)
+#ifndef OS_CFG_ISR_POST_DEFERRED_EN
+#define  OS_CFG_ISR_POST_DEFERRED_EN     0u
+#endif
 
-#define  OS_MSG_EN                 (((OS_CFG_TASK_Q_EN > 0u) || (OS_CFG_Q_EN > 0u)) ? 1u : 0u)
+#ifndef OS_CFG_ATOMIC_EN
+#define  OS_CFG_ATOMIC_EN                0u
+#endif
 
-#define  OS_OBJ_TYPE_REQ           (((OS_CFG_DBG_EN > 0u) || (OS_CFG_OBJ_TYPE_CHK_EN > 0u)) ? 1u : 0u)
+#ifndef OS_CFG_POST_FROM_ISR_EN
+#define  OS_CFG_POST_FROM_ISR_EN         0u
+#endif
 
+#ifndef OS_CFG_Q_PEND_N_EN
+#define  OS_CFG_Q_PEND_N_EN              0u
+#endif
 
-/*
-************************************************************************************************************************
-************************************************************************************************************************
-*                                                   # D E F I N E S
-************************************************************************************************************************
-************************************************************************************************************************
-*/
+#ifndef OS_CFG_Q_POST_N_EN
+#define  OS_CFG_Q_POST_N_EN              0u
+#endif
 
-/*
-========================================================================================================================
-*                                                      TASK STATUS
-========================================================================================================================
-*/
+#ifndef OS_CFG_Q_PRIV_POOL_EN
+#define  OS_CFG_Q_PRIV_POOL_EN           0u
+#endif
 
-#define  OS_STATE_OS_STOPPED                    (OS_STATE)(0u)
-#define  OS_STATE_OS_RUNNING                    (OS_STATE)(1u)
+#ifndef OS_CFG_Q_PEND_MATCH_EN
+#define  OS_CFG_Q_PEND_MATCH_EN          0u
+#endif
 
-#define  OS_STATE_NOT_RDY                    (CPU_BOOLEAN)(0u)
-#define  OS_STATE_RDY                        (CPU_BOOLEAN)(1u)
+#ifndef OS_CFG_Q_POST_WAIT_EN
+#define  OS_CFG_Q_POST_WAIT_EN           0u
+#endif
 
+#ifndef OS_CFG_Q_PRIO_EN
+#define  OS_CFG_Q_PRIO_EN                0u
+#endif
 
-                                                                /* ------------------- TASK STATES ------------------ */
-#define  OS_TASK_STATE_BIT_DLY               (OS_STATE)(0x01u)  /*   /-------- SUSPENDED bit                          */
-                                                                /*   |                                                */
-#define  OS_TASK_STATE_BIT_PEND              (OS_STATE)(0x02u)  /*   | /-----  PEND      bit                          */
-                                                                /*   | |                                              */
-#define  OS_TASK_STATE_BIT_SUSPENDED         (OS_STATE)(0x04u)  /*   | | /---  Delayed/Timeout bit                    */
-                                                                /*   | | |                                            */
-                                                                /*   V V V                                            */
+#ifndef OS_CFG_Q_PRIO_LVL_NBR
+#define  OS_CFG_Q_PRIO_LVL_NBR           8u
+#endif
 
-#define  OS_TASK_STATE_RDY                    (OS_STATE)(  0u)  /*   0 0 0     Ready                                  */
-#define  OS_TASK_STATE_DLY                    (OS_STATE)(  1u)  /*   0 0 1     Delayed or Timeout                     */
-#define  OS_TASK_STATE_PEND                   (OS_STATE)(  2u)  /*   0 1 0     Pend                                   */
-#define  OS_TASK_STATE_PEND_TIMEOUT           (OS_STATE)(  3u)  /*   0 1 1     Pend + Timeout                         */
-#define  OS_TASK_STATE_SUSPENDED              (OS_STATE)(  4u)  /*   1 0 0     Suspended                              */
-#define  OS_TASK_STATE_DLY_SUSPENDED          (OS_STATE)(  5u)  /*   1 0 1     Suspended + Delayed or Timeout         */
-#define  OS_TASK_STATE_PEND_SUSPENDED         (OS_STATE)(  6u)  /*   1 1 0     Suspended + Pend                       */
-#define  OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED (OS_STATE)(  7u)  /*   1 1 1     Suspended + Pend + Timeout             */
-#define  OS_TASK_STATE_DEL                    (OS_STATE)(255u)
+#ifndef OS_CFG_MSG_Q_STAT_EN
+#define  OS_CFG_MSG_Q_STAT_EN            0u
+#endif
 
-                                                                /* ----------------- PENDING ON ... ----------------- */
-#define  OS_TASK_PEND_ON_NOTHING              (OS_STATE)(  0u)  /* Pending on nothing                                 */
-#define  OS_TASK_PEND_ON_FLAG                 (OS_STATE)(  1u)  /* Pending on event flag group                        */
-#define  OS_TASK_PEND_ON_TASK_Q               (OS_STATE)(  2u)  /* Pending on message to be sent to task              */
-#define  OS_TASK_PEND_ON_COND                 (OS_STATE)(  3u)  /* Pending on condition variable                      */
-#define  OS_TASK_PEND_ON_MUTEX                (OS_STATE)(  4u)  /* Pending on mutual exclusion semaphore              */
-#define  OS_TASK_PEND_ON_Q                    (OS_STATE)(  5u)  /* Pending on queue                                   */
-#define  OS_TASK_PEND_ON_SEM                  (OS_STATE)(  6u)  /* Pending on semaphore                               */
-#define  OS_TASK_PEND_ON_TASK_SEM             (OS_STATE)(  7u)  /* Pending on signal  to be sent to task              */
+#ifndef OS_CFG_MSG_Q_STAT_HIST_SIZE
+#define  OS_CFG_MSG_Q_STAT_HIST_SIZE    16u
+#endif
 
-/*
-------------------------------------------------------------------------------------------------------------------------
-*                                                    TASK PEND STATUS
-*                                      (Status codes for OS_TCBs field .PendStatus)
-------------------------------------------------------------------------------------------------------------------------
-*/
+#ifndef OS_CFG_TASK_Q_POST_N_EN
+#define  OS_CFG_TASK_Q_POST_N_EN         0u
+#endif
 
-#define  OS_STATUS_PEND_OK                   (OS_STATUS)(  0u)  /* Pending status OK, !pending, or pending complete   */
-#define  OS_STATUS_PEND_ABORT                (OS_STATUS)(  1u)  /* Pending aborted                                    */
-#define  OS_STATUS_PEND_DEL                  (OS_STATUS)(  2u)  /* Pending object deleted                             */
-#define  OS_STATUS_PEND_TIMEOUT              (OS_STATUS)(  3u)  /* Pending timed out                                  */
+#ifndef OS_CFG_SEM_PEND_N_EN
+#define  OS_CFG_SEM_PEND_N_EN            0u
+#endif
 
-/*
-========================================================================================================================
-*                                                   OS OBJECT TYPES
-*
-* Note(s) : (1) OS_OBJ_TYPE_&&& #define values specifically chosen as ASCII representations of the kernel
-*               object types.  Memory displays of kernel objects will display the kernel object TYPEs with
-*               their chosen ASCII names.
-========================================================================================================================
-*/
+#ifndef OS_CFG_SEM_POST_N_EN
+#define  OS_CFG_SEM_POST_N_EN            0u
+#endif
 
-#define  OS_OBJ_TYPE_NONE                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('N', 'O', 'N', 'E')
-#define  OS_OBJ_TYPE_FLAG                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('F', 'L', 'A', 'G')
-#define  OS_OBJ_TYPE_MEM                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('M', 'E', 'M', ' ')
-#define  OS_OBJ_TYPE_MUTEX                   (OS_OBJ_TYPE)CPU_TYPE_CREATE('M', 'U', 'T', 'X')
-#define  OS_OBJ_TYPE_COND                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('C', 'O', 'N', 'D')
-#define  OS_OBJ_TYPE_Q                       (OS_OBJ_TYPE)CPU_TYPE_CREATE('Q', 'U', 'E', 'U')
-#define  OS_OBJ_TYPE_SEM                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('S', 'E', 'M', 'A')
-#define  OS_OBJ_TYPE_TMR                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'M', 'R', ' ')
+#ifndef OS_CFG_SEM_FAST_EN
+#define  OS_CFG_SEM_FAST_EN              0u
+#endif
 
-/*
-========================================================================================================================
-*                                           Possible values for 'opt' argument
-========================================================================================================================
-*/
+#ifndef OS_CFG_MBOX_EN
+#define  OS_CFG_MBOX_EN                  0u
+#endif
 
-#define  OS_OPT_NONE                         (OS_OPT)(0x0000u)
+#ifndef OS_CFG_MBOX_DEL_EN
+#define  OS_CFG_MBOX_DEL_EN              0u
+#endif
 
-/*
-------------------------------------------------------------------------------------------------------------------------
-*                                                    DELETE OPTIONS
-------------------------------------------------------------------------------------------------------------------------
-*/
+#ifndef OS_CFG_MBOX_PEND_ABORT_EN
+#define  OS_CFG_MBOX_PEND_ABORT_EN       0u
+#endif
 
-#define  OS_OPT_DEL_NO_PEND                  (OS_OPT)(0x0000u)
-#define  OS_OPT_DEL_ALWAYS                   (OS_OPT)(0x0001u)
+#ifndef OS_CFG_PEND_MULTI_EN
+#define  OS_CFG_PEND_MULTI_EN            0u
+#endif
 
-/*
-------------------------------------------------------------------------------------------------------------------------
-*                                                     PEND OPTIONS
-------------------------------------------------------------------------------------------------------------------------
-*/
+#ifndef OS_CFG_PIPE_EN
+#define  OS_CFG_PIPE_EN                  0u
+#endif
 
-#define  OS_OPT_PEND_FLAG_MASK               (OS_OPT)(0x000Fu)
-#define  OS_OPT_PEND_FLAG_CLR_ALL            (OS_OPT)(0x0001u)  /* Wait for ALL    the bits specified to be CLR       */
-#define  OS_OPT_PEND_FLAG_CLR_AND            (OS_OPT)(0x0001u)
+#ifndef OS_CFG_PIPE_DEL_EN
+#define  OS_CFG_PIPE_DEL_EN              0u
+#endif
 
-#define  OS_OPT_PEND_FLAG_CLR_ANY            (OS_OPT)(0x0002u)  /* Wait for ANY of the bits specified to be CLR       */
-#define  OS_OPT_PEND_FLAG_CLR_OR             (OS_OPT)(0x0002u)
+#ifndef OS_CFG_RING_EN
+#define  OS_CFG_RING_EN                  0u
+#endif
 
-#define  OS_OPT_PEND_FLAG_SET_ALL            (OS_OPT)(0x0004u)  /* Wait for ALL    the bits specified to be SET       */
-#define  OS_OPT_PEND_FLAG_SET_AND            (OS_OPT)(0x0004u)
+#ifndef OS_CFG_RING_DEL_EN
+#define  OS_CFG_RING_DEL_EN              0u
+#endif
 
-#define  OS_OPT_PEND_FLAG_SET_ANY            (OS_OPT)(0x0008u)  /* Wait for ANY of the bits specified to be SET       */
-#define  OS_OPT_PEND_FLAG_SET_OR             (OS_OPT)(0x0008u)
+#ifndef OS_CFG_RWLOCK_EN
+#define  OS_CFG_RWLOCK_EN                0u
+#endif
 
-#define  OS_OPT_PEND_FLAG_CONSUME            (OS_OPT)(0x0100u)  /* Consume the flags if condition(s) satisfied        */
+#ifndef OS_CFG_RWLOCK_DEL_EN
+#define  OS_CFG_RWLOCK_DEL_EN            0u
+#endif
 
+#ifndef OS_CFG_RWLOCK_PEND_ABORT_EN
+#define  OS_CFG_RWLOCK_PEND_ABORT_EN     0u
+#endif
 
-#define  OS_OPT_PEND_BLOCKING                (OS_OPT)(0x0000u)
-#define  OS_OPT_PEND_NON_BLOCKING            (OS_OPT)(0x8000u)
+#ifndef OS_CFG_RWLOCK_HOLD_MAX
+#define  OS_CFG_RWLOCK_HOLD_MAX          2u
+#endif
 
-/*
-------------------------------------------------------------------------------------------------------------------------
-*                                                  PEND ABORT OPTIONS
-------------------------------------------------------------------------------------------------------------------------
-*/
+#ifndef OS_CFG_RCU_EN
+#define  OS_CFG_RCU_EN                   0u
+#endif
 
-#define  OS_OPT_PEND_ABORT_1                 (OS_OPT)(0x0000u)  /* Pend abort a single waiting task                   */
-#define  OS_OPT_PEND_ABORT_ALL               (OS_OPT)(0x0100u)  /* Pend abort ALL tasks waiting                       */
+#ifndef OS_CFG_RCU_DEL_EN
+#define  OS_CFG_RCU_DEL_EN               0u
+#endif
 
-/*
-------------------------------------------------------------------------------------------------------------------------
-*                                                     POST OPTIONS
-------------------------------------------------------------------------------------------------------------------------
-*/
+#ifndef OS_CFG_SEQLOCK_EN
+#define  OS_CFG_SEQLOCK_EN               0u
+#endif
 
+#ifndef OS_CFG_SEQLOCK_DEL_EN
+#define  OS_CFG_SEQLOCK_DEL_EN           0u
+#endif
 
-#define  OS_OPT_POST_NONE                    (OS_OPT)(0x0000u)
+#ifndef OS_CFG_TOPIC_EN
+#define  OS_CFG_TOPIC_EN                 0u
+#endif
 
-#define  OS_OPT_POST_FLAG_SET                (OS_OPT)(0x0000u)
-#define  OS_OPT_POST_FLAG_CLR                (OS_OPT)(0x0001u)
+#ifndef OS_CFG_TOPIC_DEL_EN
+#define  OS_CFG_TOPIC_DEL_EN             0u
+#endif
 
-#define  OS_OPT_POST_FIFO                    (OS_OPT)(0x0000u)  /* Default is to post FIFO                            */
-#define  OS_OPT_POST_LIFO                    (OS_OPT)(0x0010u)  /* Post to highest priority task waiting              */
-#define  OS_OPT_POST_1                       (OS_OPT)(0x0000u)  /* Post message to highest priority task waiting      */
-#define  OS_OPT_POST_ALL                     (OS_OPT)(0x0200u)  /* Broadcast message to ALL tasks waiting             */
+#ifndef OS_CFG_CALL_EN
+#define  OS_CFG_CALL_EN                  0u
+#endif
 
-#define  OS_OPT_POST_NO_SCHED                (OS_OPT)(0x8000u)  /* Do not call the scheduler if this is selected      */
+#ifndef OS_CFG_CALL_DEL_EN
+#define  OS_CFG_CALL_DEL_EN              0u
+#endif
 
-/*
-------------------------------------------------------------------------------------------------------------------------
-*                                                     TASK OPTIONS
-------------------------------------------------------------------------------------------------------------------------
-*/
+#ifndef OS_CFG_SIGNAL_EN
+#define  OS_CFG_SIGNAL_EN                0u
+#endif
 
-#define  OS_OPT_TASK_NONE                    (OS_OPT)(0x0000u)  /* No option selected                                 */
-#define  OS_OPT_TASK_STK_CHK                 (OS_OPT)(0x0001u)  /* Enable stack checking for the task                 */
-#define  OS_OPT_TASK_STK_CLR                 (OS_OPT)(0x0002u)  /* Clear the stack when the task is create            */
-#define  OS_OPT_TASK_SAVE_FP                 (OS_OPT)(0x0004u)  /* Save the contents of any floating-point registers  */
-#define  OS_OPT_TASK_NO_TLS                  (OS_OPT)(0x0008u)  /* Specifies the task DOES NOT require TLS support    */
+#ifndef OS_CFG_SIGNAL_DEL_EN
+#define  OS_CFG_SIGNAL_DEL_EN            0u
+#endif
 
-/*
-------------------------------------------------------------------------------------------------------------------------
-*                                                     TIME OPTIONS
-------------------------------------------------------------------------------------------------------------------------
-*/
+#ifndef OS_CFG_SIGNAL_PEND_ABORT_EN
+#define  OS_CFG_SIGNAL_PEND_ABORT_EN     0u
+#endif
 
-#define  OS_OPT_TIME_DLY                             0x00u
-#define  OS_OPT_TIME_TIMEOUT                ((OS_OPT)0x02u)
-#define  OS_OPT_TIME_MATCH                  ((OS_OPT)0x04u)
-#define  OS_OPT_TIME_PERIODIC               ((OS_OPT)0x08u)
+#ifndef OS_CFG_SIGNAL_COALESCE_EN
+#define  OS_CFG_SIGNAL_COALESCE_EN       0u
+#endif
 
-#define  OS_OPT_TIME_HMSM_STRICT            ((OS_OPT)0x00u)
-#define  OS_OPT_TIME_HMSM_NON_STRICT        ((OS_OPT)0x10u)
+#ifndef OS_CFG_COMPLETION_EN
+#define  OS_CFG_COMPLETION_EN            0u
+#endif
 
-#define  OS_OPT_TIME_MASK                   ((OS_OPT)(OS_OPT_TIME_DLY      | \
-                                                      OS_OPT_TIME_TIMEOUT  | \
-                                                      OS_OPT_TIME_PERIODIC | \
-                                                      OS_OPT_TIME_MATCH))
+#ifndef OS_CFG_COMPLETION_DEL_EN
+#define  OS_CFG_COMPLETION_DEL_EN        0u
+#endif
 
-#define  OS_OPT_TIME_OPTS_MASK              ((OS_OPT)(OS_OPT_TIME_DLY            | \
-                                                      OS_OPT_TIME_TIMEOUT        | \
-                                                      OS_OPT_TIME_PERIODIC       | \
-                                                      OS_OPT_TIME_MATCH          | \
-                                                      OS_OPT_TIME_HMSM_NON_STRICT))
+#ifndef OS_CFG_REACTOR_EN
+#define  OS_CFG_REACTOR_EN               0u
+#endif
 
-/*
-------------------------------------------------------------------------------------------------------------------------
-*                                                    TIMER OPTIONS
-------------------------------------------------------------------------------------------------------------------------
-*/
+#ifndef OS_CFG_REACTOR_DEL_EN
+#define  OS_CFG_REACTOR_DEL_EN           0u
+#endif
 
-#define  OS_OPT_TMR_NONE                          (OS_OPT)(0u)  /* No option selected                                 */
+#ifndef OS_CFG_PROF_SAMPLE_EN
+#define  OS_CFG_PROF_SAMPLE_EN           0u
+#endif
 
-#define  OS_OPT_TMR_ONE_SHOT                      (OS_OPT)(1u)  /* Timer will not auto restart when it expires        */
-#define  OS_OPT_TMR_PERIODIC                      (OS_OPT)(2u)  /* Timer will     auto restart when it expires        */
+#ifndef OS_CFG_PROF_SAMPLE_SIZE
+#define  OS_CFG_PROF_SAMPLE_SIZE        64u
+#endif
 
-#define  OS_OPT_TMR_CALLBACK                      (OS_OPT)(3u)  /* OSTmrStop() option to call 'callback' w/ timer arg */
-#define  OS_OPT_TMR_CALLBACK_ARG                  (OS_OPT)(4u)  /* OSTmrStop() option to call 'callback' w/ new   arg */
+#ifndef OS_CFG_ISR_Q_EN
+#define  OS_CFG_ISR_Q_EN                 0u
+#endif
 
-/*
-------------------------------------------------------------------------------------------------------------------------
-*                                                     TIMER STATES
-------------------------------------------------------------------------------------------------------------------------
-*/
+#ifndef OS_CFG_ICC_EN
+#define  OS_CFG_ICC_EN                   0u
+#endif
 
-#define  OS_TMR_STATE_UNUSED                    (OS_STATE)(0u)
-#define  OS_TMR_STATE_STOPPED                   (OS_STATE)(1u)
-#define  OS_TMR_STATE_RUNNING                   (OS_STATE)(2u)
-#define  OS_TMR_STATE_COMPLETED                 (OS_STATE)(3u)
-#define  OS_TMR_STATE_TIMEOUT                   (OS_STATE)(4u)
+#ifndef OS_CFG_ICC_SYNC_EN
+#define  OS_CFG_ICC_SYNC_EN              0u
+#endif
 
-/*
-------------------------------------------------------------------------------------------------------------------------
-*                                                       PRIORITY
-------------------------------------------------------------------------------------------------------------------------
-*/
-                                                                    /* Dflt prio to init task TCB                     */
-#define  OS_PRIO_INIT                       (OS_PRIO)(OS_CFG_PRIO_MAX)
+#ifndef OS_CFG_SLAB_EN
+#define  OS_CFG_SLAB_EN                  0u
+#endif
 
-/*
-------------------------------------------------------------------------------------------------------------------------
-*                                                     STACK REDZONE
-------------------------------------------------------------------------------------------------------------------------
-*/
+#ifndef OS_CFG_OBJ_POOL_EN
+#define  OS_CFG_OBJ_POOL_EN              0u
+#endif
 
-#define  OS_STACK_CHECK_VAL                 0x5432DCBAABCD2345UL
-#define  OS_STACK_CHECK_DEPTH               8u
+#ifndef OS_CFG_SEM_POOL_SIZE
+#define  OS_CFG_SEM_POOL_SIZE            0u
+#endif
 
+#ifndef OS_CFG_Q_POOL_SIZE
+#define  OS_CFG_Q_POOL_SIZE              0u
+#endif
 
-/*
-************************************************************************************************************************
-************************************************************************************************************************
-*                                                E N U M E R A T I O N S
-************************************************************************************************************************
-************************************************************************************************************************
-*/
+#ifndef OS_CFG_TMR_POOL_SIZE
+#define  OS_CFG_TMR_POOL_SIZE            0u
+#endif
 
-/*
-------------------------------------------------------------------------------------------------------------------------
-*                                                      ERROR CODES
-------------------------------------------------------------------------------------------------------------------------
-*/
+#ifndef OS_CFG_HEAP_EN
+#define  OS_CFG_HEAP_EN                  0u
+#endif
 
-typedef  enum  os_err {
-    OS_ERR_NONE                      =     0u,
+#ifndef OS_CFG_HEAP_FL_NBR
+#define  OS_CFG_HEAP_FL_NBR             16u
+#endif
 
-    OS_ERR_A                         = 10000u,
-    OS_ERR_ACCEPT_ISR                = 10001u,
+#ifndef OS_CFG_HEAP_SL_LOG2
+#define  OS_CFG_HEAP_SL_LOG2             3u
+#endif
 
-    OS_ERR_B                         = 11000u,
+#ifndef OS_CFG_MEM_PEND_EN
+#define  OS_CFG_MEM_PEND_EN              0u
+#endif
 
-    OS_ERR_C                         = 12000u,
-    OS_ERR_CREATE_ISR                = 12001u,
+#ifndef OS_CFG_MEM_MAG_EN
+#define  OS_CFG_MEM_MAG_EN               0u
+#endif
 
-    OS_ERR_D                         = 13000u,
-    OS_ERR_DEL_ISR                   = 13001u,
+#ifndef OS_CFG_MEM_BUF_EN
+#define  OS_CFG_MEM_BUF_EN               0u
+#endif
 
-    OS_ERR_E                         = 14000u,
+#ifndef OS_CFG_MEM_CACHE_EN
+#define  OS_CFG_MEM_CACHE_EN             0u
+#endif
 
-    OS_ERR_F                         = 15000u,
-    OS_ERR_FATAL_RETURN              = 15001u,
+#ifndef OS_CFG_MEM_LOCK_FREE_EN
+#define  OS_CFG_MEM_LOCK_FREE_EN         0u
+#endif
 
-    OS_ERR_FLAG_GRP_DEPLETED         = 15101u,
-    OS_ERR_FLAG_NOT_RDY              = 15102u,
-    OS_ERR_FLAG_PEND_OPT             = 15103u,
-    OS_ERR_FLUSH_ISR                 = 15104u,
+#ifndef OS_CFG_MEM_QUOTA_EN
+#define  OS_CFG_MEM_QUOTA_EN             0u
+#endif
 
-    OS_ERR_G                         = 16000u,
+#ifndef OS_CFG_TASK_GRP_EN
+#define  OS_CFG_TASK_GRP_EN                    0u
+#endif
 
-    OS_ERR_H                         = 17000u,
+#ifndef OS_CFG_TASK_POOL_EN
+#define  OS_CFG_TASK_POOL_EN                   0u
+#endif
 
-    OS_ERR_I                         = 18000u,
-    OS_ERR_ILLEGAL_CREATE_RUN_TIME   = 18001u,
+#ifndef OS_CFG_TASK_STK_GRP_EN
+#define  OS_CFG_TASK_STK_GRP_EN                0u
+#endif
 
-    OS_ERR_ILLEGAL_DEL_RUN_TIME      = 18007u,
+#ifndef OS_CFG_TASK_CREATE_TBL_EN
+#define  OS_CFG_TASK_CREATE_TBL_EN             0u
+#endif
 
-    OS_ERR_J                         = 19000u,
+#ifndef OS_CFG_TASK_BUDGET_EN
+#define  OS_CFG_TASK_BUDGET_EN                 0u
+#endif
 
-    OS_ERR_K                         = 20000u,
+#ifndef OS_CFG_TASK_BUDGET_PRIO
+#define  OS_CFG_TASK_BUDGET_PRIO              (OS_CFG_PRIO_MAX - 2u)
+#endif
 
-    OS_ERR_L                         = 21000u,
-    OS_ERR_LOCK_NESTING_OVF          = 21001u,
+#ifndef OS_CFG_TASK_EDF_EN
+#define  OS_CFG_TASK_EDF_EN                    0u
+#endif
 
-    OS_ERR_M                         = 22000u,
+#ifndef OS_CFG_TASK_EDF_PRIO
+#define  OS_CFG_TASK_EDF_PRIO                 (OS_CFG_PRIO_MAX / 2u)
+#endif
 
-    OS_ERR_MEM_CREATE_ISR            = 22201u,
-    OS_ERR_MEM_FULL                  = 22202u,
-    OS_ERR_MEM_INVALID_P_ADDR        = 22203u,
-    OS_ERR_MEM_INVALID_BLKS          = 22204u,
-    OS_ERR_MEM_INVALID_PART          = 22205u,
-    OS_ERR_MEM_INVALID_P_BLK         = 22206u,
-    OS_ERR_MEM_INVALID_P_MEM         = 22207u,
-    OS_ERR_MEM_INVALID_P_DATA        = 22208u,
-    OS_ERR_MEM_INVALID_SIZE          = 22209u,
-    OS_ERR_MEM_NO_FREE_BLKS          = 22210u,
+#ifndef OS_CFG_TASK_EDF_PEND_EN
+#define  OS_CFG_TASK_EDF_PEND_EN               0u
+#endif
 
-    OS_ERR_MSG_POOL_EMPTY            = 22301u,
-    OS_ERR_MSG_POOL_NULL_PTR         = 22302u,
+#ifndef OS_CFG_TASK_EDF_PEND_TIE_EN
+#define  OS_CFG_TASK_EDF_PEND_TIE_EN           0u
+#endif
 
-    OS_ERR_MUTEX_NOT_OWNER           = 22401u,
-    OS_ERR_MUTEX_OWNER               = 22402u,
-    OS_ERR_MUTEX_NESTING             = 22403u,
-    OS_ERR_MUTEX_OVF                 = 22404u,
+#ifndef OS_CFG_TASK_FAIR_EN
+#define  OS_CFG_TASK_FAIR_EN                   0u
+#endif
 
-    OS_ERR_N                         = 23000u,
-    OS_ERR_NAME                      = 23001u,
-    OS_ERR_NO_MORE_ID_AVAIL          = 23002u,
+#ifndef OS_CFG_TASK_FAIR_PRIO
+#define  OS_CFG_TASK_FAIR_PRIO                (OS_CFG_PRIO_MAX - 4u)
+#endif
 
-    OS_ERR_O                         = 24000u,
-    OS_ERR_OBJ_CREATED               = 24001u,
-    OS_ERR_OBJ_DEL                   = 24002u,
-    OS_ERR_OBJ_PTR_NULL              = 24003u,
-    OS_ERR_OBJ_TYPE                  = 24004u,
+#ifndef OS_CFG_TASK_PERF_CTR_EN
+#define  OS_CFG_TASK_PERF_CTR_EN               0u
+#endif
 
-    OS_ERR_OPT_INVALID               = 24101u,
+#ifndef OS_CFG_TASK_TCB_HOT_FIRST_EN
+#define  OS_CFG_TASK_TCB_HOT_FIRST_EN          0u
+#endif
 
-    OS_ERR_OS_NOT_RUNNING            = 24201u,
-    OS_ERR_OS_RUNNING                = 24202u,
-    OS_ERR_OS_NOT_INIT               = 24203u,
-    OS_ERR_OS_NO_APP_TASK            = 24204u,
+#ifndef OS_CFG_TASK_PERIOD_EN
+#define  OS_CFG_TASK_PERIOD_EN                 0u
+#endif
 
-    OS_ERR_P                         = 25000u,
-    OS_ERR_PEND_ABORT                = 25001u,
-    OS_ERR_PEND_ABORT_ISR            = 25002u,
-    OS_ERR_PEND_ABORT_NONE           = 25003u,
-    OS_ERR_PEND_ABORT_SELF           = 25004u,
-    OS_ERR_PEND_DEL                  = 25005u,
-    OS_ERR_PEND_ISR                  = 25006u,
-    OS_ERR_PEND_LOCKED               = 25007u,
-    OS_ERR_PEND_WOULD_BLOCK          = 25008u,
+#ifndef OS_CFG_TASK_HIST_EN
+#define  OS_CFG_TASK_HIST_EN                   0u
+#endif
 
-    OS_ERR_POST_NULL_PTR             = 25101u,
-    OS_ERR_POST_ISR                  = 25102u,
+#ifndef OS_CFG_TASK_HIST_SIZE
+#define  OS_CFG_TASK_HIST_SIZE                16u
+#endif
 
-    OS_ERR_PRIO_EXIST                = 25201u,
-    OS_ERR_PRIO                      = 25202u,
-    OS_ERR_PRIO_INVALID              = 25203u,
+#ifndef OS_CFG_TASK_HIST_PRIO_EN
+#define  OS_CFG_TASK_HIST_PRIO_EN              0u
+#endif
 
-    OS_ERR_PTR_INVALID               = 25301u,
+#ifndef OS_CFG_TASK_NOTIFY_EN
+#define  OS_CFG_TASK_NOTIFY_EN                 0u
+#endif
 
-    OS_ERR_Q                         = 26000u,
-    OS_ERR_Q_FULL                    = 26001u,
-    OS_ERR_Q_EMPTY                   = 26002u,
-    OS_ERR_Q_MAX                     = 26003u,
-    OS_ERR_Q_SIZE                    = 26004u,
+#ifndef OS_CFG_TASK_NOTIFY_SLOTS
+#define  OS_CFG_TASK_NOTIFY_SLOTS              1u
+#endif
 
-    OS_ERR_R                         = 27000u,
-    OS_ERR_REG_ID_INVALID            = 27001u,
-    OS_ERR_ROUND_ROBIN_1             = 27002u,
-    OS_ERR_ROUND_ROBIN_DISABLED      = 27003u,
+#ifndef OS_CFG_STAT_TASK_BUDGET
+#define  OS_CFG_STAT_TASK_BUDGET               0u
+#endif
 
-    OS_ERR_S                         = 28000u,
-    OS_ERR_SCHED_INVALID_TIME_SLICE  = 28001u,
-    OS_ERR_SCHED_LOCK_ISR            = 28002u,
-    OS_ERR_SCHED_LOCKED              = 28003u,
-    OS_ERR_SCHED_NOT_LOCKED          = 28004u,
-    OS_ERR_SCHED_UNLOCK_ISR          = 28005u,
+#ifndef OS_CFG_STAT_TASK_IDLE_CYCLES_EN
+#define  OS_CFG_STAT_TASK_IDLE_CYCLES_EN      0u
+#endif
 
-    OS_ERR_SEM_OVF                   = 28101u,
-    OS_ERR_SET_ISR                   = 28102u,
+#ifndef OS_CFG_STAT_TASK_STK_CHK_INCR_EN
+#define  OS_CFG_STAT_TASK_STK_CHK_INCR_EN     0u
+#endif
 
-    OS_ERR_STAT_RESET_ISR            = 28201u,
-    OS_ERR_STAT_PRIO_INVALID         = 28202u,
-    OS_ERR_STAT_STK_INVALID          = 28203u,
-    OS_ERR_STAT_STK_SIZE_INVALID     = 28204u,
-    OS_ERR_STATE_INVALID             = 28205u,
-    OS_ERR_STATUS_INVALID            = 28206u,
-    OS_ERR_STK_INVALID               = 28207u,
-    OS_ERR_STK_SIZE_INVALID          = 28208u,
-    OS_ERR_STK_LIMIT_INVALID         = 28209u,
-    OS_ERR_STK_OVF                   = 28210u,
+#ifndef OS_CFG_STAT_TASK_STK_CHK_CHUNK
+#define  OS_CFG_STAT_TASK_STK_CHK_CHUNK      64u
+#endif
 
-    OS_ERR_T                         = 29000u,
-    OS_ERR_TASK_CHANGE_PRIO_ISR      = 29001u,
-    OS_ERR_TASK_CREATE_ISR           = 29002u,
-    OS_ERR_TASK_DEL                  = 29003u,
-    OS_ERR_TASK_DEL_IDLE             = 29004u,
-    OS_ERR_TASK_DEL_INVALID          = 29005u,
-    OS_ERR_TASK_DEL_ISR              = 29006u,
-    OS_ERR_TASK_INVALID              = 29007u,
-    OS_ERR_TASK_NO_MORE_TCB          = 29008u,
-    OS_ERR_TASK_NOT_DLY              = 29009u,
-    OS_ERR_TASK_NOT_EXIST            = 29010u,
-    OS_ERR_TASK_NOT_SUSPENDED        = 29011u,
-    OS_ERR_TASK_OPT                  = 29012u,
-    OS_ERR_TASK_RESUME_ISR           = 29013u,
-    OS_ERR_TASK_RESUME_PRIO          = 29014u,
-    OS_ERR_TASK_RESUME_SELF          = 29015u,
-    OS_ERR_TASK_RUNNING              = 29016u,
-    OS_ERR_TASK_STK_CHK_ISR          = 29017u,
-    OS_ERR_TASK_SUSPENDED            = 29018u,
-    OS_ERR_TASK_SUSPEND_IDLE         = 29019u,
-    OS_ERR_TASK_SUSPEND_INT_HANDLER  = 29020u,
-    OS_ERR_TASK_SUSPEND_ISR          = 29021u,
-    OS_ERR_TASK_SUSPEND_PRIO         = 29022u,
-    OS_ERR_TASK_WAITING              = 29023u,
-    OS_ERR_TASK_SUSPEND_CTR_OVF      = 29024u,
+#ifndef OS_CFG_STAT_SNAP_EN
+#define  OS_CFG_STAT_SNAP_EN                   0u
+#endif
 
-    OS_ERR_TCB_INVALID               = 29101u,
+#ifndef OS_CFG_STAT_SNAP_TASK_NBR
+#define  OS_CFG_STAT_SNAP_TASK_NBR            16u
+#endif
 
-    OS_ERR_TLS_ID_INVALID            = 29120u,
-    OS_ERR_TLS_ISR                   = 29121u,
-    OS_ERR_TLS_NO_MORE_AVAIL         = 29122u,
-    OS_ERR_TLS_NOT_EN                = 29123u,
-    OS_ERR_TLS_DESTRUCT_ASSIGNED     = 29124u,
+#ifndef OS_CFG_STAT_SNAP_Q_NBR
+#define  OS_CFG_STAT_SNAP_Q_NBR                8u
+#endif
 
-    OS_ERR_TICK_PRIO_INVALID         = 29201u,
-    OS_ERR_TICK_STK_INVALID          = 29202u,
-    OS_ERR_TICK_STK_SIZE_INVALID     = 29203u,
-    OS_ERR_TICK_WHEEL_SIZE           = 29204u,
-    OS_ERR_TICK_DISABLED             = 29205u,
+#ifndef OS_CFG_STAT_GOV_EN
+#define  OS_CFG_STAT_GOV_EN                    0u
+#endif
 
-    OS_ERR_TIME_DLY_ISR              = 29301u,
-    OS_ERR_TIME_DLY_RESUME_ISR       = 29302u,
-    OS_ERR_TIME_GET_ISR              = 29303u,
-    OS_ERR_TIME_INVALID_HOURS        = 29304u,
-    OS_ERR_TIME_INVALID_MINUTES      = 29305u,
-    OS_ERR_TIME_INVALID_SECONDS      = 29306u,
-    OS_ERR_TIME_INVALID_MILLISECONDS = 29307u,
-    OS_ERR_TIME_NOT_DLY              = 29308u,
-    OS_ERR_TIME_SET_ISR              = 29309u,
-    OS_ERR_TIME_ZERO_DLY             = 29310u,
+#ifndef OS_CFG_STAT_SCHED_EN
+#define  OS_CFG_STAT_SCHED_EN                  0u
+#endif
 
-    OS_ERR_TIMEOUT                   = 29401u,
+#ifndef OS_CFG_STAT_SCHED_ITER_MAX
+#define  OS_CFG_STAT_SCHED_ITER_MAX           32u
+#endif
 
-    OS_ERR_TMR_INACTIVE              = 29501u,
-    OS_ERR_TMR_INVALID_DEST          = 29502u,
-    OS_ERR_TMR_INVALID_DLY           = 29503u,
-    OS_ERR_TMR_INVALID_PERIOD        = 29504u,
-    OS_ERR_TMR_INVALID_STATE         = 29505u,
-    OS_ERR_TMR_INVALID               = 29506u,
-    OS_ERR_TMR_ISR                   = 29507u,
-    OS_ERR_TMR_NO_CALLBACK           = 29508u,
-    OS_ERR_TMR_NON_AVAIL             = 29509u,
-    OS_ERR_TMR_PRIO_INVALID          = 29510u,
-    OS_ERR_TMR_STK_INVALID           = 29511u,
-    OS_ERR_TMR_STK_SIZE_INVALID      = 29512u,
-    OS_ERR_TMR_STOPPED               = 29513u,
-    OS_ERR_TMR_INVALID_CALLBACK      = 29514u,
+#ifndef OS_CFG_TASK_STK_CLR_DEFER_EN
+#define  OS_CFG_TASK_STK_CLR_DEFER_EN          0u
+#endif
 
-    OS_ERR_U                         = 30000u,
+#ifndef OS_CFG_TASK_STK_CLR_CHUNK
+#define  OS_CFG_TASK_STK_CLR_CHUNK            32u
+#endif
 
-    OS_ERR_V                         = 31000u,
+#ifndef OS_CFG_TASK_STK_PROFILE_EN
+#define  OS_CFG_TASK_STK_PROFILE_EN            0u
+#endif
 
-    OS_ERR_W                         = 32000u,
+#ifndef OS_CFG_TASK_STK_PROFILE_SIZE
+#define  OS_CFG_TASK_STK_PROFILE_SIZE         16u
+#endif
 
-    OS_ERR_X                         = 33000u,
+#ifndef OS_CFG_TASK_STK_PROFILE_MARGIN
+#define  OS_CFG_TASK_STK_PROFILE_MARGIN       25u
+#endif
 
-    OS_ERR_Y                         = 34000u,
-    OS_ERR_YIELD_ISR                 = 34001u,
+#ifndef OS_CFG_TASK_STK_FIT_EN
+#define  OS_CFG_TASK_STK_FIT_EN                0u
+#endif
 
-    OS_ERR_Z                         = 35000u
-} OS_ERR;
+#ifndef OS_CFG_WORKQ_EN
+#define  OS_CFG_WORKQ_EN                       0u
+#endif
 
+#ifndef OS_CFG_WORKQ_PRIO_NBR
+#define  OS_CFG_WORKQ_PRIO_NBR                 4u
+#endif
 
-/*
-************************************************************************************************************************
-************************************************************************************************************************
-*                                                  D A T A   T Y P E S
-************************************************************************************************************************
-************************************************************************************************************************
-*/
+#ifndef OS_CFG_WDOG_EN
+#define  OS_CFG_WDOG_EN                        0u
+#endif
 
-typedef  struct  os_flag_grp         OS_FLAG_GRP;
+#ifndef OS_CFG_WDOG_NBR_MAX
+#define  OS_CFG_WDOG_NBR_MAX                  32u
+#endif
 
-typedef  struct  os_mem              OS_MEM;
+#ifndef OS_CFG_INT_THREAD_EN
+#define  OS_CFG_INT_THREAD_EN                  0u
+#endif
 
-typedef  struct  os_msg              OS_MSG;
-typedef  struct  os_msg_pool         OS_MSG_POOL;
-typedef  struct  os_msg_q            OS_MSG_Q;
+#ifndef OS_CFG_INT_THREAD_IRQ_NBR
+#define  OS_CFG_INT_THREAD_IRQ_NBR            64u
+#endif
 
-typedef  struct  os_mutex            OS_MUTEX;
+#ifndef OS_CFG_TLS_LAZY_SW_EN
+#define  OS_CFG_TLS_LAZY_SW_EN           0u
+#endif
 
-typedef  struct  os_cond             OS_COND;
+#ifndef OS_CFG_TLS_MALLOC_ARENA_EN
+#define  OS_CFG_TLS_MALLOC_ARENA_EN      0u
+#endif
 
-typedef  struct  os_q                OS_Q;
+#ifndef OS_CFG_TICK_TASK_EN
+#define  OS_CFG_TICK_TASK_EN             0u
+#endif
 
-typedef  struct  os_sem              OS_SEM;
+#ifndef OS_CFG_TICK_TASK_PRIO
+#define  OS_CFG_TICK_TASK_PRIO           1u
+#endif
 
-typedef  void                      (*OS_TASK_PTR)(void *p_arg);
+#ifndef OS_CFG_TICK_TASK_STK_SIZE
+#define  OS_CFG_TICK_TASK_STK_SIZE     128u
+#endif
 
-typedef  struct  os_tcb              OS_TCB;
+#ifndef OS_CFG_TICK_WHEEL_EN
+#define  OS_CFG_TICK_WHEEL_EN            0u
+#endif
 
-#if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
-typedef  void                       *OS_TLS;
+#ifndef OS_CFG_TICK_WHEEL_SIZE
+#define  OS_CFG_TICK_WHEEL_SIZE         64u
+#endif
 
-typedef  CPU_DATA                    OS_TLS_ID;
+#ifndef OS_CFG_TMR_CMD_Q_EN
+#define  OS_CFG_TMR_CMD_Q_EN             0u
+#endif
 
-typedef  void                      (*OS_TLS_DESTRUCT_PTR)(OS_TCB    *p_tcb,
-                                                          OS_TLS_ID  id,
-                                                          OS_TLS     value);
+#ifndef OS_CFG_TMR_CMD_Q_SIZE
+#define  OS_CFG_TMR_CMD_Q_SIZE          16u
 #endif
 
-typedef  struct  os_rdy_list         OS_RDY_LIST;
+#ifndef OS_CFG_TMR_ISR_EN
+#define  OS_CFG_TMR_ISR_EN               0u
+#endif
 
-typedef  struct  os_tick_list        OS_TICK_LIST;
+#ifndef OS_CFG_TMR_SVC_EN
+#define  OS_CFG_TMR_SVC_EN               0u
+#endif
 
-typedef  void                      (*OS_TMR_CALLBACK_PTR)(void *p_tmr, void *p_arg);
-typedef  struct  os_tmr              OS_TMR;
+#ifndef OS_CFG_TMR_WHEEL_EN
+#define  OS_CFG_TMR_WHEEL_EN             0u
+#endif
 
-typedef  struct  os_pend_list        OS_PEND_LIST;
-typedef  struct  os_pend_obj         OS_PEND_OBJ;
+#ifndef OS_CFG_TMR_WHEEL_SIZE
+#define  OS_CFG_TMR_WHEEL_SIZE         256u
+#endif
 
-#if (OS_CFG_APP_HOOKS_EN > 0u)
-typedef  void                      (*OS_APP_HOOK_VOID)(void);
-typedef  void                      (*OS_APP_HOOK_TCB)(OS_TCB *p_tcb);
+#ifndef OS_CFG_INT_Q_SIZE
+#define  OS_CFG_INT_Q_SIZE              10u
 #endif
 
+#ifndef OS_CFG_INT_Q_TASK_PRIO
+#define  OS_CFG_INT_Q_TASK_PRIO          0u
+#endif
 
-/*
-************************************************************************************************************************
-************************************************************************************************************************
-*                                          D A T A   S T R U C T U R E S
-************************************************************************************************************************
-************************************************************************************************************************
-*/
+#ifndef OS_CFG_INT_Q_TASK_STK_SIZE
+#define  OS_CFG_INT_Q_TASK_STK_SIZE    128u
+#endif
 
-/*
-------------------------------------------------------------------------------------------------------------------------
-*                                                      READY LIST
-------------------------------------------------------------------------------------------------------------------------
-*/
+#ifndef OS_CFG_SLACK_EN
+#define  OS_CFG_SLACK_EN                 0u
+#endif
 
-struct  os_rdy_list {
-    OS_TCB              *HeadPtr;                           /* Pointer to task that will run at selected priority     */
-    OS_TCB              *TailPtr;                           /* Pointer to last task          at selected priority     */
-#if (OS_CFG_DBG_EN > 0u)
-    OS_OBJ_QTY           NbrEntries;                        /* Number of entries             at selected priority     */
+#ifndef OS_CFG_TIME_HR_EN
+#define  OS_CFG_TIME_HR_EN               0u
 #endif
-};
 
+#ifndef OS_CFG_TIME_ABS_EN
+#define  OS_CFG_TIME_ABS_EN              0u
+#endif
 
-/*
-------------------------------------------------------------------------------------------------------------------------
-*                                                      PEND LIST
-------------------------------------------------------------------------------------------------------------------------
-*/
+#ifndef OS_CFG_TICK_RATE_SET_EN
+#define  OS_CFG_TICK_RATE_SET_EN         0u
+#endif
 
-struct  os_pend_list {
-    OS_TCB              *HeadPtr;
-    OS_TCB              *TailPtr;
-#if (OS_CFG_DBG_EN > 0u)
-    OS_OBJ_QTY           NbrEntries;
+#ifndef OS_CFG_TIME_PERIODIC_EN
+#define  OS_CFG_TIME_PERIODIC_EN         1u
 #endif
-};
 
+#ifndef OS_CFG_SCHED_ROUND_ROBIN_TS_EN
+#define  OS_CFG_SCHED_ROUND_ROBIN_TS_EN  0u
+#endif
 
-/*
-------------------------------------------------------------------------------------------------------------------------
-*                                                       PEND OBJ
-*
-* Note(s) : (1) The 'os_pend_obj' structure data type is a template/subset for specific kernel objects' data types:
-*               'os_flag_grp', 'os_mutex', 'os_q', and 'os_sem'.  Each specific kernel object data type MUST define
-*               ALL generic OS pend object parameters, synchronized in both the sequential order & data type of each
-*               parameter.
-*
-*               Thus, ANY modification to the sequential order or data types of OS pend object parameters MUST be
-*               appropriately synchronized between the generic OS pend object data type & ALL specific kernel objects'
-*               data types.
-------------------------------------------------------------------------------------------------------------------------
-*/
+#ifndef OS_CFG_SCHED_WINDOW_EN
+#define  OS_CFG_SCHED_WINDOW_EN          0u
+#endif
 
-struct  os_pend_obj {
-#if (OS_OBJ_TYPE_REQ > 0u)
-    OS_OBJ_TYPE          Type;
+#ifndef OS_CFG_SCHED_WINDOW_CRIT_PRIO
+#define  OS_CFG_SCHED_WINDOW_CRIT_PRIO   0u
 #endif
-#if (OS_CFG_DBG_EN > 0u)
-    CPU_CHAR            *NamePtr;
+
+#ifndef OS_CFG_MUTEX_GRP_SORT_EN
+#define  OS_CFG_MUTEX_GRP_SORT_EN        0u
 #endif
-    OS_PEND_LIST         PendList;                          /* List of tasks pending on object                        */
-#if (OS_CFG_DBG_EN > 0u)
-    void                *DbgPrevPtr;
-    void                *DbgNextPtr;
-    CPU_CHAR            *DbgNamePtr;
+
+#ifndef OS_CFG_MUTEX_CEILING_EN
+#define  OS_CFG_MUTEX_CEILING_EN         0u
 #endif
-};
 
+#ifndef OS_CFG_MUTEX_SPIN_CNT
+#define  OS_CFG_MUTEX_SPIN_CNT           0u
+#endif
 
-/*
-------------------------------------------------------------------------------------------------------------------------
-*                                                     EVENT FLAGS
-*
-* Note(s) : See  PEND OBJ  Note #1'.
-------------------------------------------------------------------------------------------------------------------------
-*/
+#ifndef OS_CFG_MUTEX_FAST_EN
+#define  OS_CFG_MUTEX_FAST_EN            0u
+#endif
 
+#ifndef OS_CFG_MUTEX_THROUGHPUT_EN
+#define  OS_CFG_MUTEX_THROUGHPUT_EN      0u
+#endif
 
-struct  os_flag_grp {                                       /* Event Flag Group                                       */
-                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
-#if (OS_OBJ_TYPE_REQ > 0u)
-    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_FLAG                      */
+#ifndef OS_CFG_MUTEX_BLOCK_STAT_EN
+#define  OS_CFG_MUTEX_BLOCK_STAT_EN      0u
 #endif
-#if (OS_CFG_DBG_EN > 0u)
-    CPU_CHAR            *NamePtr;                           /* Pointer to Event Flag Name (NUL terminated ASCII)      */
+
+#ifndef OS_CFG_MUTEX_CHAIN_MAX
+#define  OS_CFG_MUTEX_CHAIN_MAX          4u
 #endif
-    OS_PEND_LIST         PendList;                          /* List of tasks waiting on event flag group              */
-#if (OS_CFG_DBG_EN > 0u)
-    OS_FLAG_GRP         *DbgPrevPtr;
-    OS_FLAG_GRP         *DbgNextPtr;
-    CPU_CHAR            *DbgNamePtr;
+
+#ifndef OS_CFG_FLAG_WAIT_IDX_EN
+#define  OS_CFG_FLAG_WAIT_IDX_EN         0u
 #endif
-                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
-    OS_FLAGS             Flags;                             /* 8, 16 or 32 bit flags                                  */
-#if (OS_CFG_TS_EN > 0u)
-    CPU_TS               TS;                                /* Timestamp of when last post occurred                   */
+
+#ifndef OS_CFG_FLAG_WIDTH
+#define  OS_CFG_FLAG_WIDTH              32u
 #endif
-#if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN > 0u))
-    CPU_INT16U           FlagID;                            /* Unique ID for third-party debuggers and tracers.       */
+
+#ifndef OS_CFG_LOCK_SITE_EN
+#define  OS_CFG_LOCK_SITE_EN             0u
+#endif
+
+#ifndef OS_CFG_LOCK_SITE_TBL_SIZE
+#define  OS_CFG_LOCK_SITE_TBL_SIZE       8u
+#endif
+
+#ifndef OS_CFG_CRIT_SECTION_PROFILE_EN
+#define  OS_CFG_CRIT_SECTION_PROFILE_EN  0u
 #endif
-};
 
 
 /*
-------------------------------------------------------------------------------------------------------------------------
-*                                                   MEMORY PARTITIONS
-------------------------------------------------------------------------------------------------------------------------
+************************************************************************************************************************
+*                                               CRITICAL SECTION HANDLING
+************************************************************************************************************************
 */
 
 
-struct os_mem {                                             /* MEMORY CONTROL BLOCK                                   */
-#if (OS_OBJ_TYPE_REQ > 0u)
-    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_MEM                       */
-#endif
-#if (OS_CFG_DBG_EN > 0u)
-    CPU_CHAR            *NamePtr;
-#endif
-    void                *AddrPtr;                           /* Pointer to beginning of memory partition               */
-    void                *FreeListPtr;                       /* Pointer to list of free memory blocks                  */
-    OS_MEM_SIZE          BlkSize;                           /* Size (in bytes) of each block of memory                */
-    OS_MEM_QTY           NbrMax;                            /* Total number of blocks in this partition               */
-    OS_MEM_QTY           NbrFree;                           /* Number of memory blocks remaining in this partition    */
-#if (OS_CFG_DBG_EN > 0u)
-    OS_MEM              *DbgPrevPtr;
-    OS_MEM              *DbgNextPtr;
+#if      (OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u) && defined(CPU_CFG_INT_DIS_MEAS_EN)
+#define  OS_SCHED_LOCK_TIME_MEAS_START()    OS_SchedLockTimeMeasStart()
+#else
+#define  OS_SCHED_LOCK_TIME_MEAS_START()
 #endif
-#if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN > 0u))
-    CPU_INT16U           MemID;                             /* Unique ID for third-party debuggers and tracers.       */
+
+
+#if      (OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u) && defined(CPU_CFG_INT_DIS_MEAS_EN)
+#define  OS_SCHED_LOCK_TIME_MEAS_STOP()     OS_SchedLockTimeMeasStop()
+#else
+#define  OS_SCHED_LOCK_TIME_MEAS_STOP()
 #endif
-};
 
 
-/*
-------------------------------------------------------------------------------------------------------------------------
-*                                                       MESSAGES
-------------------------------------------------------------------------------------------------------------------------
-*/
+#ifndef  OS_CPU_RET_ADDR_GET                                        /* Port can't return the caller's address         */
+#define  OS_CPU_RET_ADDR_GET()              ((CPU_ADDR)0)
+#endif
 
-struct  os_msg {                                            /* MESSAGE CONTROL BLOCK                                  */
-    OS_MSG              *NextPtr;                           /* Pointer to next message                                */
-    void                *MsgPtr;                            /* Actual message                                         */
-    OS_MSG_SIZE          MsgSize;                           /* Size of the message (in # bytes)                       */
-#if (OS_CFG_TS_EN > 0u)
-    CPU_TS               MsgTS;                             /* Time stamp of when message was sent                    */
+#ifndef  OS_CPU_TASK_IS_RUNNING                                     /* Only one task runs at a time on this port      */
+#define  OS_CPU_TASK_IS_RUNNING(p_tcb)      ((void)(p_tcb), OS_FALSE)
 #endif
-};
 
+#ifndef  OS_CPU_SPIN_PAUSE                                          /* Port has no spin-wait hint instruction         */
+#define  OS_CPU_SPIN_PAUSE()
+#endif
 
+#ifndef  OS_CPU_INT_IS_KA                                           /* Every interrupt is kernel aware on this port   */
+#define  OS_CPU_INT_IS_KA()                 (OS_TRUE)
+#endif
 
+#ifndef  OS_CPU_STK_CLR                                             /* Port has no optimized stack fill               */
+#define  OS_CPU_STK_CLR(p_stk, size)        OS_TaskStkClr((p_stk), (size))
+#endif
 
-struct  os_msg_pool {                                       /* OS_MSG POOL                                            */
-    OS_MSG              *NextPtr;                           /* Pointer to next message                                */
-    OS_MSG_QTY           NbrFree;                           /* Number of messages available from this pool            */
-    OS_MSG_QTY           NbrUsed;                           /* Current number of messages used                        */
-#if (OS_CFG_DBG_EN > 0u)
-    OS_MSG_QTY           NbrUsedMax;                        /* Peak number of messages used                           */
+#ifndef  OS_CPU_CACHE_LINE_SIZE                                     /* Port doesn't know its data cache line size     */
+#define  OS_CPU_CACHE_LINE_SIZE             64u
 #endif
-};
 
+#ifndef  OS_CPU_CACHE_ALIGN                                         /* Port can't align a type on a cache line        */
+#define  OS_CPU_CACHE_ALIGN
+#endif
 
+#ifndef  OS_CPU_VAR_HOT                                             /* Port can't place the hot variables in a section*/
+#define  OS_CPU_VAR_HOT
+#endif
 
-struct  os_msg_q {                                          /* OS_MSG_Q                                               */
-    OS_MSG              *InPtr;                             /* Pointer to next OS_MSG to be inserted  in   the queue  */
-    OS_MSG              *OutPtr;                            /* Pointer to next OS_MSG to be extracted from the queue  */
-    OS_MSG_QTY           NbrEntriesSize;                    /* Maximum allowable number of entries in the queue       */
-    OS_MSG_QTY           NbrEntries;                        /* Current number of entries in the queue                 */
-#if (OS_CFG_DBG_EN > 0u)
-    OS_MSG_QTY           NbrEntriesMax;                     /* Peak number of entries in the queue                    */
+#ifndef  OS_CPU_CODE_HOT                                            /* Port can't place the hot functions in a section*/
+#define  OS_CPU_CODE_HOT
 #endif
-#if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN > 0u))
-    CPU_INT16U           MsgQID;                            /* Unique ID for third-party debuggers and tracers.       */
+
+#ifndef  OS_CPU_DCACHE_CLEAN                                        /* Port has no data cache or it is coherent       */
+#define  OS_CPU_DCACHE_CLEAN(p_addr, size)
 #endif
-};
 
+#ifndef  OS_CPU_DCACHE_INV
+#define  OS_CPU_DCACHE_INV(p_addr, size)
+#endif
 
-/*
-------------------------------------------------------------------------------------------------------------------------
-*                                              MUTUAL EXCLUSION SEMAPHORES
-*
-* Note(s) : See  PEND OBJ  Note #1'.
-------------------------------------------------------------------------------------------------------------------------
-*/
 
-struct  os_mutex {                                          /* Mutual Exclusion Semaphore                             */
-                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
-#if (OS_OBJ_TYPE_REQ > 0u)
-    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_MUTEX                     */
+#if      (OS_CFG_LOCK_SITE_EN > 0u)                                 /* Time kernel critical sections                  */
+#define  OS_LOCK_SITE_ALLOC()               CPU_TS_TMR  lock_site_ts = 0u
+#define  OS_LOCK_SITE_BEGIN()               lock_site_ts = OS_TS_GET()
+#define  OS_LOCK_SITE_END(site)             OS_LockSiteEnd((site), lock_site_ts)
+#else
+#define  OS_LOCK_SITE_ALLOC()
+#define  OS_LOCK_SITE_BEGIN()
+#define  OS_LOCK_SITE_END(site)
 #endif
-#if (OS_CFG_DBG_EN > 0u)
-    CPU_CHAR            *NamePtr;                           /* Pointer to Mutex Name (NUL terminated ASCII)           */
+
+#if      (OS_CFG_TIME_ABS_EN > 0u)                                  /* OS_TaskBlock() takes 'timeout' as a deadline   */
+#define  OS_PEND_ABS_SET(p_tcb, opt)        (p_tcb)->TickAbs = ((((opt) & OS_OPT_PEND_ABS) != 0u) ? OS_TRUE : OS_FALSE)
+#else
+#define  OS_PEND_ABS_SET(p_tcb, opt)
 #endif
-    OS_PEND_LIST         PendList;                          /* List of tasks waiting on mutex                         */
-#if (OS_CFG_DBG_EN > 0u)
-    OS_MUTEX            *DbgPrevPtr;
-    OS_MUTEX            *DbgNextPtr;
-    CPU_CHAR            *DbgNamePtr;
+
+#if      (OS_CFG_TASK_FAIR_EN > 0u)                                 /* Virtual runtime 'a' is smaller than 'b'        */
+#define  OS_TASK_FAIR_BEFORE(a, b)          ((((CPU_TS)((a) - (b))) > ((CPU_TS)~(CPU_TS)0u >> 1u)) ? OS_TRUE : OS_FALSE)
 #endif
-                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
-    OS_MUTEX            *MutexGrpNextPtr;
-    OS_TCB              *OwnerTCBPtr;
-    OS_NESTING_CTR       OwnerNestingCtr;                   /* Mutex is available when the counter is 0               */
-#if (OS_CFG_TS_EN > 0u)
-    CPU_TS               TS;
+
+#if      (OS_CFG_TICK_RATE_SET_EN > 0u)                             /* Tick rate last given to OSTickRateSet()        */
+#define  OS_TICK_RATE_HZ                    OSTickRateHz
+#else
+#define  OS_TICK_RATE_HZ                    OSCfg_TickRate_Hz
+#endif
+
+                                                                    /* Time every critical section of a kernel module */
+#if      (OS_CFG_CRIT_SECTION_PROFILE_EN > 0u) && defined(OS_CRIT_SITE_ID)
+#undef   CPU_CRITICAL_ENTER
+#undef   CPU_CRITICAL_EXIT
+#ifdef   CPU_CFG_INT_DIS_MEAS_EN
+#define  CPU_CRITICAL_ENTER()               do { CPU_INT_DIS(); CPU_IntDisMeasStart(); OSCritSiteTsBegin = (CPU_TS_TMR)OS_TS_GET(); } while (0)
+#define  CPU_CRITICAL_EXIT()                do { OS_CritSiteEnd(OS_CRIT_SITE_ID); CPU_IntDisMeasStop(); CPU_INT_EN(); } while (0)
+#else
+#define  CPU_CRITICAL_ENTER()               do { CPU_INT_DIS(); OSCritSiteTsBegin = (CPU_TS_TMR)OS_TS_GET(); } while (0)
+#define  CPU_CRITICAL_EXIT()                do { OS_CritSiteEnd(OS_CRIT_SITE_ID); CPU_INT_EN(); } while (0)
 #endif
-#if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN > 0u))
-    CPU_INT16U           MutexID;                           /* Unique ID for third-party debuggers and tracers.       */
 #endif
-};
 
 
 /*
-------------------------------------------------------------------------------------------------------------------------
-*                                                  CONDITION VARIABLES
-*
-* Note(s) : See  PEND OBJ  Note #1'.
-------------------------------------------------------------------------------------------------------------------------
+************************************************************************************************************************
+*                                                     MISCELLANEOUS
+************************************************************************************************************************
 */
 
-struct  os_cond {                                           /* Condition Variable                                     */
-                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
-#if (OS_OBJ_TYPE_REQ > 0u)
-    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_COND                      */
+#ifdef   OS_GLOBALS
+#define  OS_EXT
+#else
+#define  OS_EXT  extern
 #endif
-#if (OS_CFG_DBG_EN > 0u)
-    CPU_CHAR            *NamePtr;                           /* Pointer to Mutex Name (NUL terminated ASCII)           */
+
+#define  OS_VAR_HOT  OS_CPU_VAR_HOT                         /* Variables used on every context switch and tick        */
+#define  OS_CODE_HOT OS_CPU_CODE_HOT                        /* Functions on the post, interrupt exit and switch path  */
+
+#ifndef  OS_FALSE
+#define  OS_FALSE                       0u
+#endif
+
+#ifndef  OS_TRUE
+#define  OS_TRUE                        1u
+#endif
+
+#define  OS_PRIO_TBL_SIZE          (((OS_CFG_PRIO_MAX - 1u) / ((CPU_CFG_DATA_SIZE * 8u))) + 1u)
+
+#if (OS_CFG_PRIO_MAP_EN > 0u)                                       /* Ready list and OSPrioTbl[] use a dense index   */
+#define  OS_PRIO_RDY_NBR            OS_CFG_PRIO_MAP_NBR
+#define  OS_PRIO_MAP_NONE          ((OS_PRIO)OS_CFG_PRIO_MAP_NBR)   /* OSPrioMapIxTbl[] of a priority not in the map  */
+#define  OS_PRIO_IX(prio)           OSPrioMapIxTbl[(prio)]
+#define  OS_PRIO_FROM_IX(ix)        OSCfg_PrioMapTbl[(ix)]
+#else
+#define  OS_PRIO_RDY_NBR            OS_CFG_PRIO_MAX
+#define  OS_PRIO_IX(prio)          (prio)
+#define  OS_PRIO_FROM_IX(ix)       (ix)
+#endif
+
+#define  OS_PRIO_RDY_TBL_SIZE      (((OS_PRIO_RDY_NBR - 1u) / ((CPU_CFG_DATA_SIZE * 8u))) + 1u)
+
+#define  OS_PRIO_TBL_2LVL_EN       (((OS_CFG_PRIO_TBL_2LVL_EN > 0u) && (OS_PRIO_RDY_NBR > (2u * (CPU_CFG_DATA_SIZE * 8u)))) ? 1u : 0u)
+
+#define  OS_TICK_WHEEL_MAP_SIZE    (((OS_CFG_TICK_WHEEL_SIZE - 1u) / ((CPU_CFG_DATA_SIZE * 8u))) + 1u)
+
+#define  OS_WDOG_MAP_SIZE          (((OS_CFG_WDOG_NBR_MAX - 1u) / ((CPU_CFG_DATA_SIZE * 8u))) + 1u)
+
+#define  OS_REACTOR_SRC_NBR_MAX     (CPU_CFG_DATA_SIZE * 8u)        /* One bit of a CPU_DATA per source of a reactor  */
+
+#define  OS_HEAP_SL_NBR            (1u << OS_CFG_HEAP_SL_LOG2)      /* Second level size classes of a heap            */
+
+#define  OS_TASK_FAIR_WEIGHT_DFLT   1024u                           /* Weight of a task at the fair-share level       */
+
+#define  OS_STK_PROFILE_MAGIC       0x53544B50u                     /* Valid OS_STK_PROFILE_TBL ('STKP')              */
+
+#define  OS_TMR_WHEEL_MAP_SIZE     (((OS_CFG_TMR_WHEEL_SIZE  - 1u) / ((CPU_CFG_DATA_SIZE * 8u))) + 1u)
+
+#define  OS_MSG_EN                 (((OS_CFG_TASK_Q_EN > 0u) || (OS_CFG_Q_EN > 0u)) ? 1u : 0u)
+
+#define  OS_TCB_MSG_EN             (((OS_MSG_EN > 0u) || (OS_CFG_MBOX_EN > 0u) || (OS_CFG_PIPE_EN > 0u) || (OS_CFG_RING_EN > 0u) || (OS_CFG_MEM_PEND_EN > 0u) || (OS_CFG_CALL_EN > 0u)) ? 1u : 0u)
+
+#define  OS_TASK_PERIOD_EN         (((OS_CFG_TASK_PERIOD_EN > 0u) || (OS_CFG_TASK_EDF_EN > 0u)) ? 1u : 0u)
+
+#define  OS_SEM_POOL_EN            (((OS_CFG_OBJ_POOL_EN > 0u) && (OS_CFG_SEM_EN > 0u) && (OS_CFG_SEM_DEL_EN > 0u) && (OS_CFG_SEM_POOL_SIZE > 0u)) ? 1u : 0u)
+
+#define  OS_Q_POOL_EN              (((OS_CFG_OBJ_POOL_EN > 0u) && (OS_CFG_Q_EN > 0u) && (OS_CFG_Q_DEL_EN > 0u) && (OS_CFG_Q_POOL_SIZE > 0u)) ? 1u : 0u)
+
+#define  OS_TMR_POOL_EN            (((OS_CFG_OBJ_POOL_EN > 0u) && (OS_CFG_TMR_EN > 0u) && (OS_CFG_TMR_DEL_EN > 0u) && (OS_CFG_TMR_POOL_SIZE > 0u)) ? 1u : 0u)
+
+                                                                    /* Bytes of an object rounded up to cache lines   */
+#define  OS_OBJ_POOL_BLK_SIZE(size)          ((((size) + (OS_CPU_CACHE_LINE_SIZE - 1u)) / OS_CPU_CACHE_LINE_SIZE) * OS_CPU_CACHE_LINE_SIZE)
+                                                                    /* Storage of a pool, plus room to align it       */
+#define  OS_OBJ_POOL_STORAGE_SIZE(size, nbr) ((OS_OBJ_POOL_BLK_SIZE(size) * (nbr)) + (OS_CPU_CACHE_LINE_SIZE - 1u))
+
+#if      defined(OS_CPU_ATOMIC_EN)
+#define  OS_MEM_LOCK_FREE_EN       (((OS_CFG_MEM_LOCK_FREE_EN > 0u) && (OS_CPU_ATOMIC_EN > 0u) && (OS_CFG_MEM_QUOTA_EN == 0u)) ? 1u : 0u)
+#else
+#define  OS_MEM_LOCK_FREE_EN       0u
+#endif
+
+#if      defined(OS_CPU_ATOMIC_EN)
+#define  OS_MEM_BUF_ATOMIC_EN      (((OS_CFG_MEM_BUF_EN > 0u) && (OS_CPU_ATOMIC_EN > 0u)) ? 1u : 0u)
+#else
+#define  OS_MEM_BUF_ATOMIC_EN      0u
+#endif
+
+#if      defined(OS_CPU_ATOMIC_EN)
+#define  OS_MUTEX_FAST_EN          (((OS_CFG_MUTEX_EN > 0u) && (OS_CFG_MUTEX_FAST_EN > 0u) && (OS_CPU_ATOMIC_EN > 0u) && \
+                                    (OS_CFG_OBJ_STAT_EN == 0u)) ? 1u : 0u)
+#else
+#define  OS_MUTEX_FAST_EN          0u
+#endif
+
+#if      defined(OS_CPU_ATOMIC_EN)
+#define  OS_SEM_FAST_EN            (((OS_CFG_SEM_EN > 0u) && (OS_CFG_SEM_FAST_EN > 0u) && (OS_CPU_ATOMIC_EN > 0u) && \
+                                    (OS_CFG_OBJ_STAT_EN == 0u)) ? 1u : 0u)
+#else
+#define  OS_SEM_FAST_EN            0u
+#endif
+
+#if      defined(OS_CPU_ATOMIC_EN)
+#define  OS_TMR_CMD_LOCK_FREE_EN   (((OS_CFG_TMR_CMD_Q_EN > 0u) && (OS_CPU_ATOMIC_EN > 0u)) ? 1u : 0u)
+#else
+#define  OS_TMR_CMD_LOCK_FREE_EN   0u
+#endif
+
+#if      defined(OS_CPU_ATOMIC_OPS_EN)
+#define  OS_ATOMIC_PORT_EN         (((OS_CFG_ATOMIC_EN > 0u) && (OS_CPU_ATOMIC_OPS_EN > 0u)) ? 1u : 0u)
+#else
+#define  OS_ATOMIC_PORT_EN         0u
+#endif
+
+#if      defined(OS_CPU_ATOMIC_EN)
+#define  OS_ATOMIC_EXCL_EN         (((OS_CFG_ATOMIC_EN > 0u) && (OS_ATOMIC_PORT_EN == 0u) && (OS_CPU_ATOMIC_EN > 0u)) ? 1u : 0u)
+#else
+#define  OS_ATOMIC_EXCL_EN         0u
+#endif
+
+#define  OS_DBG_PEND_NAME_EN       (((OS_CFG_DBG_EN > 0u) && (OS_CFG_DBG_PEND_NAME_EN > 0u)) ? 1u : 0u)
+
+#define  OS_OBJ_TYPE_REQ           (((OS_CFG_DBG_EN        > 0u) || \
+                                    (OS_CFG_OBJ_TYPE_CHK_EN > 0u) || \
+                                    (OS_CFG_PEND_MULTI_EN   > 0u) || \
+                                    (OS_CFG_REACTOR_EN      > 0u)) ? 1u : 0u)
+
+                                                            /* Highest priority task waiting on a pend list           */
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+#define  OS_PEND_LIST_HEAD(p_pend_list)      OS_PendMultiHead(p_pend_list)
+#else
+#define  OS_PEND_LIST_HEAD(p_pend_list)    ((p_pend_list)->HeadPtr)
+#endif
+
+                                                            /* Count an operation on the object of a pend list        */
+#if (OS_CFG_OBJ_STAT_EN > 0u)
+#define  OS_OBJ_STAT_INC(p_pend_list, ctr)   ((p_pend_list)->Stat.ctr++)
+#else
+#define  OS_OBJ_STAT_INC(p_pend_list, ctr)
+#endif
+
+                                                            /* '.PendObjPtr' is an object with a pend list, signals,  */
+                                                            /* ... completions and reactors keep their own waiter     */
+#if (OS_CFG_OBJ_STAT_EN > 0u)
+#define  OS_PEND_OBJ_HAS_LIST(p_tcb)       ((((p_tcb)->PendObjPtr != (OS_PEND_OBJ *)0)          && \
+                                             ((p_tcb)->PendOn     != OS_TASK_PEND_ON_SIGNAL)     && \
+                                             ((p_tcb)->PendOn     != OS_TASK_PEND_ON_COMPLETION) && \
+                                             ((p_tcb)->PendOn     != OS_TASK_PEND_ON_REACTOR)) ? OS_TRUE : OS_FALSE)
+#endif
+
+
+/*
+************************************************************************************************************************
+************************************************************************************************************************
+*                                                   # D E F I N E S
+************************************************************************************************************************
+************************************************************************************************************************
+*/
+
+/*
+========================================================================================================================
+*                                                      TASK STATUS
+========================================================================================================================
+*/
+
+#define  OS_STATE_OS_STOPPED                    (OS_STATE)(0u)
+#define  OS_STATE_OS_RUNNING                    (OS_STATE)(1u)
+
+#define  OS_STATE_NOT_RDY                    (CPU_BOOLEAN)(0u)
+#define  OS_STATE_RDY                        (CPU_BOOLEAN)(1u)
+
+
+                                                                /* ------------------- TASK STATES ------------------ */
+#define  OS_TASK_STATE_BIT_DLY               (OS_STATE)(0x01u)  /*   /-------- SUSPENDED bit                          */
+                                                                /*   |                                                */
+#define  OS_TASK_STATE_BIT_PEND              (OS_STATE)(0x02u)  /*   | /-----  PEND      bit                          */
+                                                                /*   | |                                              */
+#define  OS_TASK_STATE_BIT_SUSPENDED         (OS_STATE)(0x04u)  /*   | | /---  Delayed/Timeout bit                    */
+                                                                /*   | | |                                            */
+                                                                /*   V V V                                            */
+
+#define  OS_TASK_STATE_RDY                    (OS_STATE)(  0u)  /*   0 0 0     Ready                                  */
+#define  OS_TASK_STATE_DLY                    (OS_STATE)(  1u)  /*   0 0 1     Delayed or Timeout                     */
+#define  OS_TASK_STATE_PEND                   (OS_STATE)(  2u)  /*   0 1 0     Pend                                   */
+#define  OS_TASK_STATE_PEND_TIMEOUT           (OS_STATE)(  3u)  /*   0 1 1     Pend + Timeout                         */
+#define  OS_TASK_STATE_SUSPENDED              (OS_STATE)(  4u)  /*   1 0 0     Suspended                              */
+#define  OS_TASK_STATE_DLY_SUSPENDED          (OS_STATE)(  5u)  /*   1 0 1     Suspended + Delayed or Timeout         */
+#define  OS_TASK_STATE_PEND_SUSPENDED         (OS_STATE)(  6u)  /*   1 1 0     Suspended + Pend                       */
+#define  OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED (OS_STATE)(  7u)  /*   1 1 1     Suspended + Pend + Timeout             */
+#define  OS_TASK_STATE_DEL                    (OS_STATE)(255u)
+
+                                                                /* ----------------- PENDING ON ... ----------------- */
+#define  OS_TASK_PEND_ON_NOTHING              (OS_STATE)(  0u)  /* Pending on nothing                                 */
+#define  OS_TASK_PEND_ON_FLAG                 (OS_STATE)(  1u)  /* Pending on event flag group                        */
+#define  OS_TASK_PEND_ON_TASK_Q               (OS_STATE)(  2u)  /* Pending on message to be sent to task              */
+#define  OS_TASK_PEND_ON_COND                 (OS_STATE)(  3u)  /* Pending on condition variable                      */
+#define  OS_TASK_PEND_ON_MUTEX                (OS_STATE)(  4u)  /* Pending on mutual exclusion semaphore              */
+#define  OS_TASK_PEND_ON_Q                    (OS_STATE)(  5u)  /* Pending on queue                                   */
+#define  OS_TASK_PEND_ON_SEM                  (OS_STATE)(  6u)  /* Pending on semaphore                               */
+#define  OS_TASK_PEND_ON_TASK_SEM             (OS_STATE)(  7u)  /* Pending on signal  to be sent to task              */
+#define  OS_TASK_PEND_ON_RING_DATA            (OS_STATE)(  8u)  /* Pending on element to be committed to ring buffer  */
+#define  OS_TASK_PEND_ON_RING_SPACE           (OS_STATE)(  9u)  /* Pending on element to be released to ring buffer   */
+#define  OS_TASK_PEND_ON_MEM                  (OS_STATE)( 10u)  /* Pending on block to be returned to mem. partition  */
+#define  OS_TASK_PEND_ON_RWLOCK_RD            (OS_STATE)( 11u)  /* Pending on reader/writer lock to read              */
+#define  OS_TASK_PEND_ON_RWLOCK_WR            (OS_STATE)( 12u)  /* Pending on reader/writer lock to write             */
+#define  OS_TASK_PEND_ON_MULTI                (OS_STATE)( 13u)  /* Pending on multiple semaphores and/or queues       */
+#define  OS_TASK_PEND_ON_SIGNAL               (OS_STATE)( 14u)  /* Pending on a signal object                         */
+#define  OS_TASK_PEND_ON_TASK_NOTIFY          (OS_STATE)( 15u)  /* Pending on a notification slot of the task         */
+#define  OS_TASK_PEND_ON_PIPE_DATA            (OS_STATE)( 16u)  /* Pending on bytes to be written to pipe             */
+#define  OS_TASK_PEND_ON_PIPE_SPACE           (OS_STATE)( 17u)  /* Pending on bytes to be read from pipe              */
+#define  OS_TASK_PEND_ON_COMPLETION           (OS_STATE)( 18u)  /* Pending on a completion object                     */
+#define  OS_TASK_PEND_ON_REACTOR              (OS_STATE)( 19u)  /* Pending in OSReactorRun() for a source to be ready */
+#define  OS_TASK_PEND_ON_MBOX                 (OS_STATE)( 20u)  /* Pending on a value to be posted to a mailbox       */
+#define  OS_TASK_PEND_ON_SEQLOCK              (OS_STATE)( 21u)  /* Pending on the end of a write to a sequence lock   */
+#define  OS_TASK_PEND_ON_RCU                  (OS_STATE)( 22u)  /* Pending on the end of a grace period (RCU)         */
+#define  OS_TASK_PEND_ON_CALL                 (OS_STATE)( 23u)  /* Pending on a server to accept a call               */
+#define  OS_TASK_PEND_ON_CALL_RECV            (OS_STATE)( 24u)  /* Pending on a call to be made to the server         */
+#define  OS_TASK_PEND_ON_CALL_REPLY           (OS_STATE)( 25u)  /* Pending on the reply to a call                     */
+#define  OS_TASK_PEND_ON_Q_SPACE              (OS_STATE)( 26u)  /* Pending on room in a message queue                 */
+
+                                                                /* ------------- HISTOGRAM MEASUREMENTS ------------- */
+#define  OS_TASK_HIST_FLAG_PEND                          0x01u  /* A pend duration is being measured                  */
+#define  OS_TASK_HIST_FLAG_RDY                           0x02u  /* A wake to run latency is being measured            */
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                    TASK PEND STATUS
+*                                      (Status codes for OS_TCBs field .PendStatus)
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_STATUS_PEND_OK                   (OS_STATUS)(  0u)  /* Pending status OK, !pending, or pending complete   */
+#define  OS_STATUS_PEND_ABORT                (OS_STATUS)(  1u)  /* Pending aborted                                    */
+#define  OS_STATUS_PEND_DEL                  (OS_STATUS)(  2u)  /* Pending object deleted                             */
+#define  OS_STATUS_PEND_TIMEOUT              (OS_STATUS)(  3u)  /* Pending timed out                                  */
+
+/*
+========================================================================================================================
+*                                                   OS OBJECT TYPES
+*
+* Note(s) : (1) OS_OBJ_TYPE_&&& #define values specifically chosen as ASCII representations of the kernel
+*               object types.  Memory displays of kernel objects will display the kernel object TYPEs with
+*               their chosen ASCII names.
+========================================================================================================================
+*/
+
+#define  OS_OBJ_TYPE_NONE                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('N', 'O', 'N', 'E')
+#define  OS_OBJ_TYPE_CALL_EP                 (OS_OBJ_TYPE)CPU_TYPE_CREATE('C', 'A', 'L', 'L')
+#define  OS_OBJ_TYPE_COMPLETION              (OS_OBJ_TYPE)CPU_TYPE_CREATE('C', 'M', 'P', 'L')
+#define  OS_OBJ_TYPE_FLAG                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('F', 'L', 'A', 'G')
+#define  OS_OBJ_TYPE_HEAP                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('H', 'E', 'A', 'P')
+#define  OS_OBJ_TYPE_ISR_Q                   (OS_OBJ_TYPE)CPU_TYPE_CREATE('I', 'S', 'R', 'Q')
+#define  OS_OBJ_TYPE_ICC_EVT                 (OS_OBJ_TYPE)CPU_TYPE_CREATE('I', 'C', 'C', 'E')
+#define  OS_OBJ_TYPE_ICC_LOCK                (OS_OBJ_TYPE)CPU_TYPE_CREATE('I', 'C', 'C', 'L')
+#define  OS_OBJ_TYPE_ICC_RX                  (OS_OBJ_TYPE)CPU_TYPE_CREATE('I', 'C', 'C', 'R')
+#define  OS_OBJ_TYPE_ICC_TX                  (OS_OBJ_TYPE)CPU_TYPE_CREATE('I', 'C', 'C', 'T')
+#define  OS_OBJ_TYPE_INT_THREAD              (OS_OBJ_TYPE)CPU_TYPE_CREATE('I', 'T', 'H', 'R')
+#define  OS_OBJ_TYPE_MBOX                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('M', 'B', 'O', 'X')
+#define  OS_OBJ_TYPE_MEM                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('M', 'E', 'M', ' ')
+#define  OS_OBJ_TYPE_MUTEX                   (OS_OBJ_TYPE)CPU_TYPE_CREATE('M', 'U', 'T', 'X')
+#define  OS_OBJ_TYPE_COND                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('C', 'O', 'N', 'D')
+#define  OS_OBJ_TYPE_PIPE                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('P', 'I', 'P', 'E')
+#define  OS_OBJ_TYPE_Q                       (OS_OBJ_TYPE)CPU_TYPE_CREATE('Q', 'U', 'E', 'U')
+#define  OS_OBJ_TYPE_REACTOR                 (OS_OBJ_TYPE)CPU_TYPE_CREATE('R', 'E', 'A', 'C')
+#define  OS_OBJ_TYPE_RCU                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('R', 'C', 'U', ' ')
+#define  OS_OBJ_TYPE_RING                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('R', 'I', 'N', 'G')
+#define  OS_OBJ_TYPE_RWLOCK                  (OS_OBJ_TYPE)CPU_TYPE_CREATE('R', 'W', 'L', 'K')
+#define  OS_OBJ_TYPE_SEM                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('S', 'E', 'M', 'A')
+#define  OS_OBJ_TYPE_SEQLOCK                 (OS_OBJ_TYPE)CPU_TYPE_CREATE('S', 'E', 'Q', 'L')
+#define  OS_OBJ_TYPE_SIGNAL                  (OS_OBJ_TYPE)CPU_TYPE_CREATE('S', 'I', 'G', 'N')
+#define  OS_OBJ_TYPE_SLAB                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('S', 'L', 'A', 'B')
+#define  OS_OBJ_TYPE_TASK                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'A', 'S', 'K')
+#define  OS_OBJ_TYPE_TASK_GRP                (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'G', 'R', 'P')
+#define  OS_OBJ_TYPE_TASK_MSG                (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'M', 'S', 'G')
+#define  OS_OBJ_TYPE_TASK_POOL               (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'P', 'O', 'L')
+#define  OS_OBJ_TYPE_TASK_SIGNAL             (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'S', 'I', 'G')
+#define  OS_OBJ_TYPE_TASK_STK_GRP            (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'S', 'T', 'K')
+#define  OS_OBJ_TYPE_TMR                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'M', 'R', ' ')
+#define  OS_OBJ_TYPE_TOPIC                   (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'O', 'P', 'C')
+#define  OS_OBJ_TYPE_WORKQ                   (OS_OBJ_TYPE)CPU_TYPE_CREATE('W', 'R', 'K', 'Q')
+
+/*
+========================================================================================================================
+*                                           Possible values for 'opt' argument
+========================================================================================================================
+*/
+
+#define  OS_OPT_NONE                         (OS_OPT)(0x0000u)
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                    DELETE OPTIONS
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_OPT_DEL_NO_PEND                  (OS_OPT)(0x0000u)
+#define  OS_OPT_DEL_ALWAYS                   (OS_OPT)(0x0001u)
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                     PEND OPTIONS
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_OPT_PEND_FLAG_MASK               (OS_OPT)(0x000Fu)
+#define  OS_OPT_PEND_FLAG_CLR_ALL            (OS_OPT)(0x0001u)  /* Wait for ALL    the bits specified to be CLR       */
+#define  OS_OPT_PEND_FLAG_CLR_AND            (OS_OPT)(0x0001u)
+
+#define  OS_OPT_PEND_FLAG_CLR_ANY            (OS_OPT)(0x0002u)  /* Wait for ANY of the bits specified to be CLR       */
+#define  OS_OPT_PEND_FLAG_CLR_OR             (OS_OPT)(0x0002u)
+
+#define  OS_OPT_PEND_FLAG_SET_ALL            (OS_OPT)(0x0004u)  /* Wait for ALL    the bits specified to be SET       */
+#define  OS_OPT_PEND_FLAG_SET_AND            (OS_OPT)(0x0004u)
+
+#define  OS_OPT_PEND_FLAG_SET_ANY            (OS_OPT)(0x0008u)  /* Wait for ANY of the bits specified to be SET       */
+#define  OS_OPT_PEND_FLAG_SET_OR             (OS_OPT)(0x0008u)
+
+#define  OS_OPT_PEND_FLAG_CONSUME            (OS_OPT)(0x0100u)  /* Consume the flags if condition(s) satisfied        */
+
+
+#define  OS_OPT_PEND_BLOCKING                (OS_OPT)(0x0000u)
+#define  OS_OPT_PEND_NON_BLOCKING            (OS_OPT)(0x8000u)
+
+#if (OS_CFG_TIME_ABS_EN > 0u)
+#define  OS_OPT_PEND_ABS                     (OS_OPT)(0x2000u)  /* 'timeout' is the value of OSTickCtr to give up at  */
+#else
+#define  OS_OPT_PEND_ABS                     (OS_OPT)(0x0000u)
+#endif
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                  PEND ABORT OPTIONS
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_OPT_PEND_ABORT_1                 (OS_OPT)(0x0000u)  /* Pend abort a single waiting task                   */
+#define  OS_OPT_PEND_ABORT_ALL               (OS_OPT)(0x0100u)  /* Pend abort ALL tasks waiting                       */
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                    MEMORY OPTIONS
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_OPT_MEM_NONE                     (OS_OPT)(0x0000u)  /* No cache maintenance on the blocks                 */
+#define  OS_OPT_MEM_CACHE_INV                (OS_OPT)(0x0001u)  /* Invalidate a block's cache lines when allocated    */
+#define  OS_OPT_MEM_CACHE_CLEAN              (OS_OPT)(0x0002u)  /* Clean a block's cache lines when released          */
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                     POST OPTIONS
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+
+#define  OS_OPT_POST_NONE                    (OS_OPT)(0x0000u)
+
+#define  OS_OPT_POST_FLAG_SET                (OS_OPT)(0x0000u)
+#define  OS_OPT_POST_FLAG_CLR                (OS_OPT)(0x0001u)
+
+#define  OS_OPT_POST_FIFO                    (OS_OPT)(0x0000u)  /* Default is to post FIFO                            */
+#define  OS_OPT_POST_LIFO                    (OS_OPT)(0x0010u)  /* Post to highest priority task waiting              */
+#define  OS_OPT_POST_1                       (OS_OPT)(0x0000u)  /* Post message to highest priority task waiting      */
+#define  OS_OPT_POST_ALL                     (OS_OPT)(0x0200u)  /* Broadcast message to ALL tasks waiting             */
+
+#if (OS_CFG_Q_PRIO_EN > 0u)
+#define  OS_OPT_POST_PRIO_MASK               (OS_OPT)(0x3C00u)  /* Message priority level, 0 is the least urgent      */
+#else
+#define  OS_OPT_POST_PRIO_MASK               (OS_OPT)(0x0000u)
+#endif
+#define  OS_OPT_POST_PRIO(lvl)               ((OS_OPT)(((OS_OPT)(lvl) << 10u) & OS_OPT_POST_PRIO_MASK))
+#define  OS_OPT_POST_PRIO_GET(opt)           ((CPU_DATA)(((opt) & OS_OPT_POST_PRIO_MASK) >> 10u))
+
+#if (OS_CFG_MEM_BUF_EN > 0u)
+#define  OS_OPT_POST_MEM_BUF_REF             (OS_OPT)(0x0020u)  /* Add a reference to the buffer for each receiver    */
+#else
+#define  OS_OPT_POST_MEM_BUF_REF             (OS_OPT)(0x0000u)
+#endif
+
+#define  OS_OPT_POST_NO_SIGNAL               (OS_OPT)(0x4000u)  /* Do not signal the consumer (ISR queues only)       */
+#define  OS_OPT_POST_NO_SCHED                (OS_OPT)(0x8000u)  /* Do not call the scheduler if this is selected      */
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                     SLAB OPTIONS
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_OPT_SLAB_NONE                    (OS_OPT)(0x0000u)  /* Only allocate from the smallest class that fits    */
+#define  OS_OPT_SLAB_FALLBACK                (OS_OPT)(0x0001u)  /* Use a larger class if that class is exhausted      */
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                     TASK OPTIONS
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_OPT_TASK_NONE                    (OS_OPT)(0x0000u)  /* No option selected                                 */
+#define  OS_OPT_TASK_STK_CHK                 (OS_OPT)(0x0001u)  /* Enable stack checking for the task                 */
+#define  OS_OPT_TASK_STK_CLR                 (OS_OPT)(0x0002u)  /* Clear the stack when the task is create            */
+#define  OS_OPT_TASK_SAVE_FP                 (OS_OPT)(0x0004u)  /* Save the contents of any floating-point registers  */
+#define  OS_OPT_TASK_NO_TLS                  (OS_OPT)(0x0008u)  /* Specifies the task DOES NOT require TLS support    */
+#define  OS_OPT_TASK_STK_CLR_DEFER           (OS_OPT)(0x0010u)  /* Let the idle task clear the stack (with STK_CLR)   */
+#define  OS_OPT_TASK_STK_FIT                 (OS_OPT)(0x0020u)  /* Allocate a stack sized from the stack profile      */
+
+#define  OS_OPT_TASK_HIST_NONE               (OS_OPT)(0x0000u)  /* Only read the task's histograms                    */
+#define  OS_OPT_TASK_HIST_RESET              (OS_OPT)(0x0001u)  /* Clear the task's histograms after reading them     */
+
+#define  OS_OPT_MSG_Q_STAT_NONE              (OS_OPT)(0x0000u)  /* Only read the queue's statistics                   */
+#define  OS_OPT_MSG_Q_STAT_RESET             (OS_OPT)(0x0001u)  /* Clear the queue's statistics after reading them    */
+
+#define  OS_OPT_OBJ_STAT_NONE                (OS_OPT)(0x0000u)  /* Only read the object's counters                    */
+#define  OS_OPT_OBJ_STAT_RESET               (OS_OPT)(0x0001u)  /* Clear the object's counters after reading them     */
+
+#define  OS_OPT_TASK_BUDGET_DEMOTE           (OS_OPT)(0x0000u)  /* Exhausted budget: run at OS_CFG_TASK_BUDGET_PRIO   */
+#define  OS_OPT_TASK_BUDGET_SUSPEND          (OS_OPT)(0x0001u)  /* Exhausted budget: suspend until replenished        */
+
+#define  OS_OPT_TASK_PERIOD_SKIP             (OS_OPT)(0x0000u)  /* Overrun: skip the missed releases                  */
+#define  OS_OPT_TASK_PERIOD_CATCH_UP         (OS_OPT)(0x0001u)  /* Overrun: run the missed releases back to back      */
+
+#define  OS_OPT_TASK_NOTIFY_INCR             (OS_OPT)(0x0001u)  /* Increment the slot value (counter)                 */
+#define  OS_OPT_TASK_NOTIFY_SET_BITS         (OS_OPT)(0x0002u)  /* OR the bits specified into the slot value          */
+#define  OS_OPT_TASK_NOTIFY_OVERWRITE        (OS_OPT)(0x0004u)  /* Replace the slot value                             */
+#define  OS_OPT_TASK_NOTIFY_DECR             (OS_OPT)(0x0010u)  /* Wait: decrement the slot value instead of clearing */
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                     TIME OPTIONS
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_OPT_TIME_DLY                             0x00u
+#define  OS_OPT_TIME_TIMEOUT                ((OS_OPT)0x02u)
+#define  OS_OPT_TIME_MATCH                  ((OS_OPT)0x04u)
+#define  OS_OPT_TIME_PERIODIC               ((OS_OPT)0x08u)
+
+#define  OS_OPT_TIME_HMSM_STRICT            ((OS_OPT)0x00u)
+#define  OS_OPT_TIME_HMSM_NON_STRICT        ((OS_OPT)0x10u)
+
+#define  OS_OPT_TIME_MASK                   ((OS_OPT)(OS_OPT_TIME_DLY      | \
+                                                      OS_OPT_TIME_TIMEOUT  | \
+                                                      OS_OPT_TIME_PERIODIC | \
+                                                      OS_OPT_TIME_MATCH))
+
+#define  OS_OPT_TIME_OPTS_MASK              ((OS_OPT)(OS_OPT_TIME_DLY            | \
+                                                      OS_OPT_TIME_TIMEOUT        | \
+                                                      OS_OPT_TIME_PERIODIC       | \
+                                                      OS_OPT_TIME_MATCH          | \
+                                                      OS_OPT_TIME_HMSM_NON_STRICT))
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                    TIMER OPTIONS
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_OPT_TMR_NONE                          (OS_OPT)(0u)  /* No option selected                                 */
+
+#define  OS_OPT_TMR_ONE_SHOT                      (OS_OPT)(1u)  /* Timer will not auto restart when it expires        */
+#define  OS_OPT_TMR_PERIODIC                      (OS_OPT)(2u)  /* Timer will     auto restart when it expires        */
+
+#define  OS_OPT_TMR_CALLBACK                      (OS_OPT)(3u)  /* OSTmrStop() option to call 'callback' w/ timer arg */
+#define  OS_OPT_TMR_CALLBACK_ARG                  (OS_OPT)(4u)  /* OSTmrStop() option to call 'callback' w/ new   arg */
+
+#define  OS_OPT_TMR_ISR                      (OS_OPT)(0x0100u)  /* OSTmrCreate() option to expire in the compare ISR  */
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                     TIMER STATES
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_TMR_STATE_UNUSED                    (OS_STATE)(0u)
+#define  OS_TMR_STATE_STOPPED                   (OS_STATE)(1u)
+#define  OS_TMR_STATE_RUNNING                   (OS_STATE)(2u)
+#define  OS_TMR_STATE_COMPLETED                 (OS_STATE)(3u)
+#define  OS_TMR_STATE_TIMEOUT                   (OS_STATE)(4u)
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                      JOB STATES
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_WORK_STATE_IDLE                     (OS_STATE)(0u)  /* Not submitted, or already taken by a worker        */
+#define  OS_WORK_STATE_PEND                     (OS_STATE)(1u)  /* Waiting for a worker                               */
+#define  OS_WORK_STATE_DLY                      (OS_STATE)(2u)  /* Waiting for the delay of OSWorkSubmitDly()         */
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                       PRIORITY
+------------------------------------------------------------------------------------------------------------------------
+*/
+                                                                    /* Dflt prio to init task TCB                     */
+#define  OS_PRIO_INIT                       (OS_PRIO)(OS_CFG_PRIO_MAX)
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                     STACK REDZONE
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_STACK_CHECK_VAL                 0x5432DCBAABCD2345UL
+#define  OS_STACK_CHECK_DEPTH               8u
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                 EVENT FLAG WAITER INDEX
+------------------------------------------------------------------------------------------------------------------------
+*/
+                                                                    /* Entry of the waiters not indexed by a flag bit */
+#define  OS_FLAG_IDX_NBR                    ((CPU_INT08U)(sizeof(OS_FLAGS) * 8u))
+#define  OS_FLAG_IDX_NONE                   0xFFu                   /* Task not in the index of an event flag group   */
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                               HIGH-RESOLUTION TIMEOUTS
+------------------------------------------------------------------------------------------------------------------------
+*/
+                                                                    /* Longest timeout in OS_TS_GET() units           */
+#define  OS_TICK_HR_DLY_MAX                 ((CPU_TS)((CPU_TS)~(CPU_TS)0u >> 1u))
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                      LOCK SITES
+------------------------------------------------------------------------------------------------------------------------
+*/
+                                                                    /* Indexes into OSLockSiteTbl[]                   */
+#define  OS_LOCK_SITE_TICK_UPDATE           0u                      /* OS_TickUpdate() and OS_TickHrUpdate()          */
+#define  OS_LOCK_SITE_TICK_LIST_INSERT      1u                      /* OS_TickListInsert() for delays and timeouts    */
+#define  OS_LOCK_SITE_FLAG_POST             2u                      /* OSFlagPost()                                   */
+#define  OS_LOCK_SITE_NBR                   3u
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                             CRITICAL SECTION PROFILE SITES
+*
+* Note(s) : (1) Each kernel module defines OS_CRIT_SITE_ID to its index into OSCritSiteTbl[] before including os.h.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_CRIT_SITE_CORE                  0u                      /* os_core.c                                      */
+#define  OS_CRIT_SITE_FLAG                  1u                      /* os_flag.c                                      */
+#define  OS_CRIT_SITE_ICC                   2u                      /* os_icc.c                                       */
+#define  OS_CRIT_SITE_INT                   3u                      /* os_int.c                                       */
+#define  OS_CRIT_SITE_ISR_Q                 4u                      /* os_isr_q.c                                     */
+#define  OS_CRIT_SITE_MEM                   5u                      /* os_mem.c                                       */
+#define  OS_CRIT_SITE_MUTEX                 6u                      /* os_mutex.c                                     */
+#define  OS_CRIT_SITE_PEND_MULTI            7u                      /* os_pend_multi.c                                */
+#define  OS_CRIT_SITE_PIPE                  8u                      /* os_pipe.c                                      */
+#define  OS_CRIT_SITE_Q                     9u                      /* os_q.c                                         */
+#define  OS_CRIT_SITE_RING                 10u                      /* os_ring.c                                      */
+#define  OS_CRIT_SITE_RWLOCK               11u                      /* os_rwlock.c                                    */
+#define  OS_CRIT_SITE_SCHED_WINDOW         12u                      /* os_sched_window.c                              */
+#define  OS_CRIT_SITE_SEM                  13u                      /* os_sem.c                                       */
+#define  OS_CRIT_SITE_SIGNAL               14u                      /* os_signal.c                                    */
+#define  OS_CRIT_SITE_SLAB                 15u                      /* os_slab.c                                      */
+#define  OS_CRIT_SITE_STAT                 16u                      /* os_stat.c                                      */
+#define  OS_CRIT_SITE_TASK                 17u                      /* os_task.c                                      */
+#define  OS_CRIT_SITE_TASK_POOL            18u                      /* os_task_pool.c                                 */
+#define  OS_CRIT_SITE_TICK                 19u                      /* os_tick.c                                      */
+#define  OS_CRIT_SITE_TIME                 20u                      /* os_time.c                                      */
+#define  OS_CRIT_SITE_TMR                  21u                      /* os_tmr.c                                       */
+#define  OS_CRIT_SITE_WORKQ                22u                      /* os_workq.c                                     */
+#define  OS_CRIT_SITE_COMPLETION           23u                      /* os_completion.c                                */
+#define  OS_CRIT_SITE_REACTOR              24u                      /* os_reactor.c                                   */
+#define  OS_CRIT_SITE_PROF                 25u                      /* os_prof.c                                      */
+#define  OS_CRIT_SITE_MBOX                 26u                      /* os_mbox.c                                      */
+#define  OS_CRIT_SITE_SEQLOCK              27u                      /* os_seqlock.c                                   */
+#define  OS_CRIT_SITE_RCU                  28u                      /* os_rcu.c                                       */
+#define  OS_CRIT_SITE_TASK_GRP             29u                      /* os_task_grp.c                                  */
+#define  OS_CRIT_SITE_TOPIC                30u                      /* os_topic.c                                     */
+#define  OS_CRIT_SITE_CALL                 31u                      /* os_call.c                                      */
+#define  OS_CRIT_SITE_IDLE_PM              32u                      /* os_idle_pm.c                                   */
+#define  OS_CRIT_SITE_INT_THREAD           33u                      /* os_int_thread.c                                */
+#define  OS_CRIT_SITE_HEAP                 34u                      /* os_heap.c                                      */
+#define  OS_CRIT_SITE_TASK_STK_GRP         35u                      /* os_task_stk_grp.c                              */
+#define  OS_CRIT_SITE_OBJ_STAT             36u                      /* os_obj_stat.c                                  */
+#define  OS_CRIT_SITE_OBJ_REG              37u                      /* os_obj_reg.c                                   */
+#define  OS_CRIT_SITE_WDOG                 38u                      /* os_wdog.c                                      */
+#define  OS_CRIT_SITE_ICC_SYNC             39u                      /* os_icc_sync.c                                  */
+#define  OS_CRIT_SITE_OBJ_POOL             40u                      /* os_obj_pool.c                                  */
+#define  OS_CRIT_SITE_NBR                  41u
+
+
+/*
+************************************************************************************************************************
+************************************************************************************************************************
+*                                                E N U M E R A T I O N S
+************************************************************************************************************************
+************************************************************************************************************************
+*/
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                      ERROR CODES
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+typedef  enum  os_err {
+    OS_ERR_NONE                      =     0u,
+
+    OS_ERR_A                         = 10000u,
+    OS_ERR_ACCEPT_ISR                = 10001u,
+
+    OS_ERR_B                         = 11000u,
+
+    OS_ERR_C                         = 12000u,
+    OS_ERR_CREATE_ISR                = 12001u,
+
+    OS_ERR_COMPLETION_DONE           = 12101u,
+    OS_ERR_COMPLETION_WAITER         = 12102u,
+
+    OS_ERR_CALL_ACTIVE               = 12201u,
+    OS_ERR_CALL_NONE                 = 12202u,
+
+    OS_ERR_D                         = 13000u,
+    OS_ERR_DEL_ISR                   = 13001u,
+
+    OS_ERR_E                         = 14000u,
+
+    OS_ERR_F                         = 15000u,
+    OS_ERR_FATAL_RETURN              = 15001u,
+
+    OS_ERR_FLAG_GRP_DEPLETED         = 15101u,
+    OS_ERR_FLAG_NOT_RDY              = 15102u,
+    OS_ERR_FLAG_PEND_OPT             = 15103u,
+    OS_ERR_FLUSH_ISR                 = 15104u,
+
+    OS_ERR_G                         = 16000u,
+
+    OS_ERR_H                         = 17000u,
+
+    OS_ERR_I                         = 18000u,
+    OS_ERR_ILLEGAL_CREATE_RUN_TIME   = 18001u,
+
+    OS_ERR_INT_Q_FULL                = 18003u,
+    OS_ERR_INT_Q_SIZE                = 18004u,
+    OS_ERR_INT_Q_STK_INVALID         = 18005u,
+    OS_ERR_INT_Q_STK_SIZE_INVALID    = 18006u,
+
+    OS_ERR_ILLEGAL_DEL_RUN_TIME      = 18007u,
+
+    OS_ERR_INT_Q_PRIO_INVALID        = 18008u,
+
+    OS_ERR_IDLE_PM_STATE_DUP         = 18009u,
+
+    OS_ERR_INT_THREAD_IRQ_INVALID    = 18010u,
+    OS_ERR_INT_THREAD_IRQ_USED       = 18011u,
+
+    OS_ERR_J                         = 19000u,
+
+    OS_ERR_K                         = 20000u,
+
+    OS_ERR_L                         = 21000u,
+    OS_ERR_LOCK_NESTING_OVF          = 21001u,
+
+    OS_ERR_M                         = 22000u,
+
+    OS_ERR_MBOX_EMPTY                = 22101u,
+
+    OS_ERR_MEM_CREATE_ISR            = 22201u,
+    OS_ERR_MEM_FULL                  = 22202u,
+    OS_ERR_MEM_INVALID_P_ADDR        = 22203u,
+    OS_ERR_MEM_INVALID_BLKS          = 22204u,
+    OS_ERR_MEM_INVALID_PART          = 22205u,
+    OS_ERR_MEM_INVALID_P_BLK         = 22206u,
+    OS_ERR_MEM_INVALID_P_MEM         = 22207u,
+    OS_ERR_MEM_INVALID_P_DATA        = 22208u,
+    OS_ERR_MEM_INVALID_SIZE          = 22209u,
+    OS_ERR_MEM_NO_FREE_BLKS          = 22210u,
+    OS_ERR_MEM_BUF_REF_NONE          = 22211u,
+    OS_ERR_MEM_QUOTA_EXCEEDED        = 22212u,
+    OS_ERR_MEM_QUOTA_EXISTS          = 22213u,
+    OS_ERR_MEM_QUOTA_NOT_EN          = 22214u,
+
+    OS_ERR_MSG_POOL_EMPTY            = 22301u,
+    OS_ERR_MSG_POOL_NULL_PTR         = 22302u,
+
+    OS_ERR_MUTEX_NOT_OWNER           = 22401u,
+    OS_ERR_MUTEX_OWNER               = 22402u,
+    OS_ERR_MUTEX_NESTING             = 22403u,
+    OS_ERR_MUTEX_OVF                 = 22404u,
+
+    OS_ERR_N                         = 23000u,
+    OS_ERR_NAME                      = 23001u,
+    OS_ERR_NO_MORE_ID_AVAIL          = 23002u,
+
+    OS_ERR_O                         = 24000u,
+    OS_ERR_OBJ_CREATED               = 24001u,
+    OS_ERR_OBJ_DEL                   = 24002u,
+    OS_ERR_OBJ_PTR_NULL              = 24003u,
+    OS_ERR_OBJ_TYPE                  = 24004u,
+    OS_ERR_OBJ_NOT_FOUND             = 24005u,
+    OS_ERR_OBJ_ID_INVALID            = 24006u,
+
+    OS_ERR_OPT_INVALID               = 24101u,
+
+    OS_ERR_OS_NOT_RUNNING            = 24201u,
+    OS_ERR_OS_RUNNING                = 24202u,
+    OS_ERR_OS_NOT_INIT               = 24203u,
+    OS_ERR_OS_NO_APP_TASK            = 24204u,
+
+    OS_ERR_P                         = 25000u,
+    OS_ERR_PEND_ABORT                = 25001u,
+    OS_ERR_PEND_ABORT_ISR            = 25002u,
+    OS_ERR_PEND_ABORT_NONE           = 25003u,
+    OS_ERR_PEND_ABORT_SELF           = 25004u,
+    OS_ERR_PEND_DEL                  = 25005u,
+    OS_ERR_PEND_ISR                  = 25006u,
+    OS_ERR_PEND_LOCKED               = 25007u,
+    OS_ERR_PEND_WOULD_BLOCK          = 25008u,
+
+    OS_ERR_POST_NULL_PTR             = 25101u,
+    OS_ERR_POST_ISR                  = 25102u,
+
+    OS_ERR_PRIO_EXIST                = 25201u,
+    OS_ERR_PRIO                      = 25202u,
+    OS_ERR_PRIO_INVALID              = 25203u,
+
+    OS_ERR_PTR_INVALID               = 25301u,
+
+    OS_ERR_PIPE_SIZE                 = 25401u,
+    OS_ERR_PIPE_WATERMARK            = 25402u,
+
+    OS_ERR_Q                         = 26000u,
+    OS_ERR_Q_FULL                    = 26001u,
+    OS_ERR_Q_EMPTY                   = 26002u,
+    OS_ERR_Q_MAX                     = 26003u,
+    OS_ERR_Q_SIZE                    = 26004u,
+
+    OS_ERR_R                         = 27000u,
+    OS_ERR_REG_ID_INVALID            = 27001u,
+    OS_ERR_ROUND_ROBIN_1             = 27002u,
+    OS_ERR_ROUND_ROBIN_DISABLED      = 27003u,
+
+    OS_ERR_RING_COMMIT_NONE          = 27101u,
+    OS_ERR_RING_RELEASE_NONE         = 27102u,
+    OS_ERR_RING_SIZE                 = 27103u,
+
+    OS_ERR_RWLOCK_HOLD_MAX           = 27201u,
+    OS_ERR_RWLOCK_MODE               = 27202u,
+    OS_ERR_RWLOCK_NESTING            = 27203u,
+    OS_ERR_RWLOCK_NOT_OWNER          = 27204u,
+    OS_ERR_RWLOCK_OVF                = 27205u,
+    OS_ERR_RWLOCK_OWNER              = 27206u,
+
+    OS_ERR_REACTOR_ID_INVALID        = 27301u,
+    OS_ERR_REACTOR_ID_USED           = 27302u,
+    OS_ERR_REACTOR_SRC_ATTACHED      = 27303u,
+    OS_ERR_REACTOR_SRC_NOT_ADDED     = 27304u,
+    OS_ERR_REACTOR_WAITER            = 27305u,
+
+    OS_ERR_RCU_IDX_INVALID           = 27401u,
+    OS_ERR_RCU_RD_ACTIVE             = 27402u,
+
+    OS_ERR_S                         = 28000u,
+    OS_ERR_SCHED_INVALID_TIME_SLICE  = 28001u,
+    OS_ERR_SCHED_LOCK_ISR            = 28002u,
+    OS_ERR_SCHED_LOCKED              = 28003u,
+    OS_ERR_SCHED_NOT_LOCKED          = 28004u,
+    OS_ERR_SCHED_UNLOCK_ISR          = 28005u,
+    OS_ERR_SCHED_WINDOW_DURATION     = 28006u,
+    OS_ERR_SCHED_WINDOW_ISR          = 28007u,
+    OS_ERR_SCHED_WINDOW_NBR          = 28008u,
+
+    OS_ERR_SEM_OVF                   = 28101u,
+    OS_ERR_SET_ISR                   = 28102u,
+    OS_ERR_SEM_CNT_INVALID           = 28103u,
+
+    OS_ERR_SEQLOCK_WR_ACTIVE         = 28121u,
+    OS_ERR_SEQLOCK_WR_NONE           = 28122u,
+
+    OS_ERR_SIGNAL_WAITER             = 28151u,
+    OS_ERR_SIGNAL_THRESHOLD_INVALID  = 28152u,
+
+    OS_ERR_STAT_RESET_ISR            = 28201u,
+    OS_ERR_STAT_PRIO_INVALID         = 28202u,
+    OS_ERR_STAT_STK_INVALID          = 28203u,
+    OS_ERR_STAT_STK_SIZE_INVALID     = 28204u,
+    OS_ERR_STATE_INVALID             = 28205u,
+    OS_ERR_STATUS_INVALID            = 28206u,
+    OS_ERR_STK_INVALID               = 28207u,
+    OS_ERR_STK_SIZE_INVALID          = 28208u,
+    OS_ERR_STK_LIMIT_INVALID         = 28209u,
+    OS_ERR_STK_OVF                   = 28210u,
+    OS_ERR_STAT_GOV_INVALID          = 28211u,
+
+    OS_ERR_T                         = 29000u,
+    OS_ERR_TASK_CHANGE_PRIO_ISR      = 29001u,
+    OS_ERR_TASK_CREATE_ISR           = 29002u,
+    OS_ERR_TASK_DEL                  = 29003u,
+    OS_ERR_TASK_DEL_IDLE             = 29004u,
+    OS_ERR_TASK_DEL_INVALID          = 29005u,
+    OS_ERR_TASK_DEL_ISR              = 29006u,
+    OS_ERR_TASK_INVALID              = 29007u,
+    OS_ERR_TASK_NO_MORE_TCB          = 29008u,
+    OS_ERR_TASK_NOT_DLY              = 29009u,
+    OS_ERR_TASK_NOT_EXIST            = 29010u,
+    OS_ERR_TASK_NOT_SUSPENDED        = 29011u,
+    OS_ERR_TASK_OPT                  = 29012u,
+    OS_ERR_TASK_RESUME_ISR           = 29013u,
+    OS_ERR_TASK_RESUME_PRIO          = 29014u,
+    OS_ERR_TASK_RESUME_SELF          = 29015u,
+    OS_ERR_TASK_RUNNING              = 29016u,
+    OS_ERR_TASK_STK_CHK_ISR          = 29017u,
+    OS_ERR_TASK_SUSPENDED            = 29018u,
+    OS_ERR_TASK_SUSPEND_IDLE         = 29019u,
+    OS_ERR_TASK_SUSPEND_INT_HANDLER  = 29020u,
+    OS_ERR_TASK_SUSPEND_ISR          = 29021u,
+    OS_ERR_TASK_SUSPEND_PRIO         = 29022u,
+    OS_ERR_TASK_WAITING              = 29023u,
+    OS_ERR_TASK_SUSPEND_CTR_OVF      = 29024u,
+    OS_ERR_TASK_NOTIFY_ID_INVALID    = 29025u,
+    OS_ERR_TASK_NOTIFY_OVF           = 29026u,
+    OS_ERR_TASK_STK_CLR_PEND         = 29027u,
+    OS_ERR_TASK_BUDGET_PERIOD        = 29028u,
+    OS_ERR_TASK_GRP_MEMBER           = 29029u,
+    OS_ERR_TASK_GRP_NOT_MEMBER       = 29030u,
+    OS_ERR_TASK_FAIR_WEIGHT          = 29031u,
+    OS_ERR_TASK_STK_PROFILE_NONE     = 29032u,
+    OS_ERR_TASK_STK_GRP_BUSY         = 29033u,
+    OS_ERR_TASK_STK_GRP_NOT_MEMBER   = 29034u,
+
+    OS_ERR_TCB_INVALID               = 29101u,
+
+    OS_ERR_TLS_ID_INVALID            = 29120u,
+    OS_ERR_TLS_ISR                   = 29121u,
+    OS_ERR_TLS_NO_MORE_AVAIL         = 29122u,
+    OS_ERR_TLS_NOT_EN                = 29123u,
+    OS_ERR_TLS_DESTRUCT_ASSIGNED     = 29124u,
+
+    OS_ERR_TICK_PRIO_INVALID         = 29201u,
+    OS_ERR_TICK_STK_INVALID          = 29202u,
+    OS_ERR_TICK_STK_SIZE_INVALID     = 29203u,
+    OS_ERR_TICK_WHEEL_SIZE           = 29204u,
+    OS_ERR_TICK_DISABLED             = 29205u,
+    OS_ERR_TICK_RATE_INVALID         = 29206u,
+    OS_ERR_TICK_RATE_SET_ISR         = 29207u,
+
+    OS_ERR_TIME_DLY_ISR              = 29301u,
+    OS_ERR_TIME_DLY_RESUME_ISR       = 29302u,
+    OS_ERR_TIME_GET_ISR              = 29303u,
+    OS_ERR_TIME_INVALID_HOURS        = 29304u,
+    OS_ERR_TIME_INVALID_MINUTES      = 29305u,
+    OS_ERR_TIME_INVALID_SECONDS      = 29306u,
+    OS_ERR_TIME_INVALID_MILLISECONDS = 29307u,
+    OS_ERR_TIME_NOT_DLY              = 29308u,
+    OS_ERR_TIME_SET_ISR              = 29309u,
+    OS_ERR_TIME_ZERO_DLY             = 29310u,
+    OS_ERR_TIME_INVALID_MICROSECONDS = 29311u,
+
+    OS_ERR_TIMEOUT                   = 29401u,
+
+    OS_ERR_TMR_INACTIVE              = 29501u,
+    OS_ERR_TMR_INVALID_DEST          = 29502u,
+    OS_ERR_TMR_INVALID_DLY           = 29503u,
+    OS_ERR_TMR_INVALID_PERIOD        = 29504u,
+    OS_ERR_TMR_INVALID_STATE         = 29505u,
+    OS_ERR_TMR_INVALID               = 29506u,
+    OS_ERR_TMR_ISR                   = 29507u,
+    OS_ERR_TMR_NO_CALLBACK           = 29508u,
+    OS_ERR_TMR_NON_AVAIL             = 29509u,
+    OS_ERR_TMR_PRIO_INVALID          = 29510u,
+    OS_ERR_TMR_STK_INVALID           = 29511u,
+    OS_ERR_TMR_STK_SIZE_INVALID      = 29512u,
+    OS_ERR_TMR_STOPPED               = 29513u,
+    OS_ERR_TMR_INVALID_CALLBACK      = 29514u,
+    OS_ERR_TMR_CMD_Q_FULL            = 29515u,
+
+    OS_ERR_TOPIC_NOT_SUB             = 29601u,
+    OS_ERR_TOPIC_SUB_INVALID         = 29602u,
+    OS_ERR_TOPIC_SUB_ISR             = 29603u,
+
+    OS_ERR_U                         = 30000u,
+
+    OS_ERR_V                         = 31000u,
+
+    OS_ERR_W                         = 32000u,
+    OS_ERR_WORK_PEND                 = 32001u,
+    OS_ERR_WORK_NOT_PEND             = 32002u,
+    OS_ERR_WORK_PRIO_INVALID         = 32003u,
+    OS_ERR_WORK_OVF                  = 32004u,
+
+    OS_ERR_WDOG_FULL                 = 32101u,
+    OS_ERR_WDOG_ID_INVALID           = 32102u,
+    OS_ERR_WDOG_DEADLINE_INVALID     = 32103u,
+
+    OS_ERR_X                         = 33000u,
+
+    OS_ERR_Y                         = 34000u,
+    OS_ERR_YIELD_ISR                 = 34001u,
+
+    OS_ERR_Z                         = 35000u
+} OS_ERR;
+
+
+/*
+************************************************************************************************************************
+************************************************************************************************************************
+*                                                  D A T A   T Y P E S
+************************************************************************************************************************
+************************************************************************************************************************
+*/
+
+typedef  struct  os_flag_grp         OS_FLAG_GRP;
+
+typedef  struct  os_mem              OS_MEM;
+
+typedef  struct  os_mem_mag          OS_MEM_MAG;
+
+typedef  struct  os_mem_buf          OS_MEM_BUF;
+typedef  void                      (*OS_MEM_BUF_RELEASE_PTR)(void *p_data);
+
+typedef  struct  os_mem_quota        OS_MEM_QUOTA;
+
+typedef  struct  os_msg              OS_MSG;
+typedef  struct  os_msg_entry        OS_MSG_ENTRY;
+typedef  struct  os_msg_pool         OS_MSG_POOL;
+typedef  struct  os_msg_q            OS_MSG_Q;
+typedef  struct  os_msg_q_stat       OS_MSG_Q_STAT;
+
+typedef  struct  os_mutex            OS_MUTEX;
+typedef  struct  os_mutex_chain      OS_MUTEX_CHAIN;
+
+typedef  struct  os_cond             OS_COND;
+
+typedef  struct  os_isr_q            OS_ISR_Q;
+
+typedef  struct  os_int_q            OS_INT_Q;
+
+typedef  void                      (*OS_ICC_DOORBELL_PTR)(void *p_arg);
+typedef  struct  os_icc              OS_ICC;
+typedef  struct  os_icc_msg          OS_ICC_MSG;
+typedef  struct  os_icc_shm          OS_ICC_SHM;
+
+typedef  CPU_BOOLEAN               (*OS_ICC_HW_TRY_LOCK_PTR)(void *p_arg);
+typedef  void                      (*OS_ICC_HW_UNLOCK_PTR)(void *p_arg);
+typedef  void                      (*OS_ICC_HW_NOTIFY_EN_PTR)(void *p_arg);
+typedef  struct  os_icc_hw           OS_ICC_HW;
+typedef  struct  os_icc_lock         OS_ICC_LOCK;
+typedef  struct  os_icc_evt          OS_ICC_EVT;
+typedef  struct  os_icc_evt_shm      OS_ICC_EVT_SHM;
+
+typedef  struct  os_lock_site        OS_LOCK_SITE;
+
+typedef  struct  os_crit_site        OS_CRIT_SITE;
+
+typedef  struct  os_pipe             OS_PIPE;
+
+typedef  struct  os_q                OS_Q;
+typedef  CPU_BOOLEAN               (*OS_Q_MATCH_FNCT)(void *p_msg, OS_MSG_SIZE msg_size, void *p_arg);
+
+typedef  struct  os_mbox             OS_MBOX;
+
+typedef  struct  os_ring             OS_RING;
+
+typedef  struct  os_rwlock           OS_RWLOCK;
+
+typedef  struct  os_rwlock_hold      OS_RWLOCK_HOLD;
+
+typedef  struct  os_sem              OS_SEM;
+
+typedef  struct  os_rcu              OS_RCU;
+
+typedef  struct  os_seqlock          OS_SEQLOCK;
+
+typedef  struct  os_signal           OS_SIGNAL;
+
+typedef  struct  os_topic            OS_TOPIC;
+
+typedef  struct  os_topic_sub        OS_TOPIC_SUB;
+
+typedef  struct  os_call_ep          OS_CALL_EP;
+
+typedef  struct  os_completion       OS_COMPLETION;
+
+typedef  struct  os_slab             OS_SLAB;
+
+typedef  struct  os_slab_cfg         OS_SLAB_CFG;
+
+typedef  struct  os_slab_class       OS_SLAB_CLASS;
+
+typedef  struct  os_obj_pool         OS_OBJ_POOL;
+
+typedef  struct  os_heap             OS_HEAP;
+
+typedef  struct  os_heap_blk         OS_HEAP_BLK;
+
+typedef  struct  os_stat_snap        OS_STAT_SNAP;
+
+typedef  struct  os_stat_snap_task   OS_STAT_SNAP_TASK;
+
+typedef  struct  os_stat_snap_q      OS_STAT_SNAP_Q;
+
+typedef  struct  os_stat_gov         OS_STAT_GOV;
+typedef  void                      (*OS_STAT_GOV_FNCT)(OS_PERF_LVL lvl_prev, OS_PERF_LVL lvl);
+
+typedef  void                      (*OS_TASK_PTR)(void *p_arg);
+
+typedef  struct  os_tcb              OS_TCB;
+
+typedef  struct  os_task_cfg         OS_TASK_CFG;
+
+typedef  struct  os_task_grp         OS_TASK_GRP;
+
+typedef  struct  os_task_pool        OS_TASK_POOL;
+
+typedef  struct  os_task_stk_grp     OS_TASK_STK_GRP;
+
+typedef  struct  os_stk_profile      OS_STK_PROFILE;
+typedef  struct  os_stk_profile_tbl  OS_STK_PROFILE_TBL;
+
+typedef  struct  os_task_hist        OS_TASK_HIST;
+typedef  struct  os_task_hist_prio   OS_TASK_HIST_PRIO;
+
+#if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
+typedef  void                       *OS_TLS;
+
+typedef  CPU_DATA                    OS_TLS_ID;
+
+typedef  void                      (*OS_TLS_DESTRUCT_PTR)(OS_TCB    *p_tcb,
+                                                          OS_TLS_ID  id,
+                                                          OS_TLS     value);
+#endif
+
+typedef  struct  os_prof_sample      OS_PROF_SAMPLE;
+
+typedef  struct  os_idle_pm_state    OS_IDLE_PM_STATE;
+typedef  void                      (*OS_IDLE_PM_FNCT)(OS_IDLE_PM_STATE *p_state, CPU_TS dly);
+
+typedef  struct  os_int_thread       OS_INT_THREAD;
+typedef  CPU_BOOLEAN               (*OS_INT_THREAD_TOP_FNCT)(void *p_arg);
+typedef  void                      (*OS_INT_THREAD_FNCT)(void *p_arg, OS_CTR nbr);
+
+typedef  struct  os_rdy_list         OS_RDY_LIST;
+
+typedef  struct  os_reactor          OS_REACTOR;
+typedef  struct  os_reactor_src      OS_REACTOR_SRC;
+typedef  void                      (*OS_REACTOR_FNCT)(void *p_obj, OS_OBJ_QTY nbr_rdy, void *p_arg);
+
+typedef  struct  os_sched_window     OS_SCHED_WINDOW;
+
+typedef  struct  os_tick_list        OS_TICK_LIST;
+
+typedef  void                      (*OS_TMR_CALLBACK_PTR)(void *p_tmr, void *p_arg);
+typedef  struct  os_tmr              OS_TMR;
+typedef  struct  os_tmr_cmd          OS_TMR_CMD;
+typedef  struct  os_tmr_svc          OS_TMR_SVC;
+
+typedef  struct  os_work             OS_WORK;
+typedef  struct  os_workq            OS_WORKQ;
+typedef  void                      (*OS_WORK_FNCT)(void *p_arg);
+
+typedef  struct  os_wdog             OS_WDOG;
+typedef  void                      (*OS_WDOG_HOOK)(OS_TCB *p_tcb, OS_OBJ_QTY id);
+
+typedef  struct  os_pend_data        OS_PEND_DATA;
+typedef  struct  os_pend_list        OS_PEND_LIST;
+typedef  struct  os_pend_obj         OS_PEND_OBJ;
+
+typedef  struct  os_obj_stat         OS_OBJ_STAT;
+
+typedef  struct  os_obj_reg_entry    OS_OBJ_REG_ENTRY;
+
+#if (OS_CFG_APP_HOOKS_EN > 0u)
+typedef  void                      (*OS_APP_HOOK_VOID)(void);
+typedef  void                      (*OS_APP_HOOK_TCB)(OS_TCB *p_tcb);
+#endif
+
+
+/*
+************************************************************************************************************************
+************************************************************************************************************************
+*                                          D A T A   S T R U C T U R E S
+************************************************************************************************************************
+************************************************************************************************************************
+*/
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                      READY LIST
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_rdy_list {
+    OS_TCB              *HeadPtr;                           /* Pointer to task that will run at selected priority     */
+    OS_TCB              *TailPtr;                           /* Pointer to last task          at selected priority     */
+#if (OS_CFG_DBG_EN > 0u)
+    OS_OBJ_QTY           NbrEntries;                        /* Number of entries             at selected priority     */
+#endif
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                  SCHEDULING WINDOWS
+*
+* Note(s) : (1) A schedule is a table of windows run one after the other, the table being repeated forever (the major
+*               frame).  While a window is active, the scheduler only considers the ready tasks whose priority is set in
+*               the window's 'PrioTbl[]'.
+*
+*           (2) 'PrioTbl[]' has the same layout as OSPrioTbl[].  OSSchedWindowInit() always sets the priorities below
+*               OS_CFG_SCHED_WINDOW_CRIT_PRIO and the idle task priority.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_SCHED_WINDOW_EN > 0u)
+struct  os_sched_window {
+    CPU_DATA             PrioTbl[OS_PRIO_TBL_SIZE];         /* Priorities that may run during the window              */
+    CPU_INT32U           Duration;                          /* Length of the window, in microseconds                  */
+};
+#endif
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                  OBJECT STATISTICS
+*
+* Note(s) : (1) When OS_CFG_OBJ_STAT_EN is enabled, the pend list of every kernel object counts the activity on the
+*               object.  The counters are updated in the critical sections that already update the object and wrap
+*               around.  OSObjStatNext() walks the debug lists to read them.
+*
+*           (2) '.PostCtr' counts the calls to OSFlagPost(), OSMutexPost(), OSQPost(), OSQPostN(), OSSemPost() and
+*               OSSemPostN().  '.PendCtr' counts the pends that obtained the event flags, the mutex, a message or the
+*               semaphore, without waiting or when readied by a post.  For the other objects only the tasks readied by
+*               a post are counted, the posts and the pends that do not block are not.
+*
+*           (3) '.WaitersMax' is the largest number of tasks waiting in the pend list at once.  The tasks waiting in
+*               OSPendMulti() are not included.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_OBJ_STAT_EN > 0u)
+struct  os_obj_stat {
+    CPU_INT32U           PostCtr;                           /* Number of posts (see Note #2)                          */
+    CPU_INT32U           PendCtr;                           /* Number of successful pends (see Note #2)               */
+    CPU_INT32U           PendBlockCtr;                      /* Number of pends that had to wait                       */
+    CPU_INT32U           PendTimeoutCtr;                    /* Number of pends that timed out                         */
+    CPU_INT32U           PendAbortCtr;                      /* Number of pends aborted by OSxxxPendAbort()            */
+    OS_OBJ_QTY           WaitersMax;                        /* Most tasks waiting at once (see Note #3)               */
+};
+#endif
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                   OBJECT REGISTRY
+*
+* Note(s) : (1) When OS_CFG_OBJ_REG_EN is enabled, the tasks, event flag groups, memory partitions, mutexes, message
+*               queues and semaphores are entered in OSObjRegTbl[] when they are created, at the slot given by the hash
+*               of their name.  Collisions go to the next slot (linear probing).  The ID of an object is its slot
+*               number plus 1, it is compact (1 to OS_CFG_OBJ_REG_SIZE) and doesn't change while the object exists.
+*
+*           (2) A deleted object leaves its slot marked as deleted rather than empty, so that the objects placed after
+*               it stay reachable and keep their ID.  The slot is reused by a later registration.
+*
+*           (3) '.Hash' is kept so that a lookup only compares the names of the entries whose hash matches.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_OBJ_REG_EN > 0u)
+struct  os_obj_reg_entry {
+    void                *ObjPtr;                            /* Object, NULL if the slot is free                       */
+    CPU_CHAR            *NamePtr;                           /* Name of the object when registered                     */
+    OS_OBJ_TYPE          Type;                              /* OS_OBJ_TYPE_xxx, or free/deleted (see Note #2)         */
+    CPU_INT32U           Hash;                              /* Hash of the name (see Note #3)                         */
+};
+#endif
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                      PEND LIST
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_pend_list {
+    OS_TCB              *HeadPtr;
+#if (OS_CFG_SMALL_MEM_EN == 0u)                             /* See Note #3 of os_tcb                                  */
+    OS_TCB              *TailPtr;
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    OS_OBJ_QTY           NbrEntries;
+#endif
+#if (OS_CFG_PEND_LIST_BITMAP_EN > 0u)
+    CPU_DATA             PrioTbl[OS_PRIO_TBL_SIZE];         /* Bitmap of the priorities with at least one waiter      */
+    OS_TCB              *PrioTailPtr[OS_CFG_PRIO_MAX];      /* Last waiter at each priority                           */
+#endif
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+    OS_PEND_DATA        *MultiHeadPtr;                      /* Tasks waiting in OSPendMulti(), in priority order      */
+#endif
+#if (OS_CFG_REACTOR_EN > 0u)
+    OS_REACTOR_SRC      *ReactorSrcPtr;                     /* Reactor source notified of the posts, NULL if none     */
+#endif
+#if (OS_CFG_OBJ_STAT_EN > 0u)
+    OS_OBJ_STAT          Stat;                              /* Activity on the object (see OBJECT STATISTICS)         */
+#endif
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                       PEND OBJ
+*
+* Note(s) : (1) The 'os_pend_obj' structure data type is a template/subset for specific kernel objects' data types:
+*               'os_flag_grp', 'os_mem', 'os_mutex', 'os_q', and 'os_sem'.  Each specific kernel object data type MUST define
+*               ALL generic OS pend object parameters, synchronized in both the sequential order & data type of each
+*               parameter.
+*
+*               Thus, ANY modification to the sequential order or data types of OS pend object parameters MUST be
+*               appropriately synchronized between the generic OS pend object data type & ALL specific kernel objects'
+*               data types.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_pend_obj {
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;
+#endif
+    OS_PEND_LIST         PendList;                          /* List of tasks pending on object                        */
+#if (OS_CFG_DBG_EN > 0u)
+    void                *DbgPrevPtr;
+    void                *DbgNextPtr;
+    CPU_CHAR            *DbgNamePtr;
+#endif
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                 PEND ON MULTIPLE OBJECTS
+*
+* Note(s) : (1) OSPendMulti() is given a table of OS_PEND_DATA, one entry per semaphore or message queue to wait on.
+*               The application sets '.PendObjPtr' of each entry and the kernel fills in the other members.
+*
+*           (2) While the task waits, each entry is linked in the '.MultiHeadPtr' list of the pend list of its object,
+*               in the priority order of the task.  The posts to the object serve the highest priority task of either
+*               list (see OS_PEND_LIST_HEAD()).
+*
+*           (3) The entries of the objects that readied the task have '.RdyObjPtr' set to the object, and the message
+*               and the timestamp delivered in '.RdyMsgPtr', '.RdyMsgSize' and '.RdyTS'.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_pend_data {
+    OS_PEND_DATA        *PrevPtr;                           /* Links in the '.MultiHeadPtr' list of the object        */
+    OS_PEND_DATA        *NextPtr;
+    OS_TCB              *TCBPtr;                            /* Task waiting                                           */
+    OS_PEND_OBJ         *PendObjPtr;                        /* Object waited on, set by the application               */
+    OS_PEND_OBJ         *RdyObjPtr;                         /* Object that readied the task or NULL                   */
+    void                *RdyMsgPtr;                         /* Message received from a message queue                  */
+    OS_MSG_SIZE          RdyMsgSize;
+    CPU_TS               RdyTS;                             /* Timestamp of the post                                  */
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                     EVENT FLAGS
+*
+* Note(s) : (1) See  PEND OBJ  Note #1'.
+*
+*           (2) When OS_CFG_FLAG_WAIT_IDX_EN is enabled, each waiter is also linked in one entry of '.IdxTbl[]'.  A
+*               task waiting for ALL of its flags, or for a single flag, is linked to one of the flags it is still
+*               waiting for.  The other waiters are linked in the last entry, '.IdxTbl[OS_FLAG_IDX_NBR]'.  OSFlagPost()
+*               then only checks the waiters linked to the posted flags and to the last entry instead of the whole
+*               pend list.
+*
+*           (3) OS_CFG_FLAG_WIDTH sets the number of flags per group, up to 64 so that related events fit in one group
+*               and a single OSFlagPend() waits for all of them.  Each waiter is still checked with one AND and one
+*               compare of the whole OS_FLAGS, which takes two words on a 32-bit CPU.  With OS_CFG_FLAG_WAIT_IDX_EN,
+*               '.IdxTbl[]' has one entry per flag plus one.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+
+struct  os_flag_grp {                                       /* Event Flag Group                                       */
+                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_FLAG                      */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Pointer to Event Flag Name (NUL terminated ASCII)      */
+#endif
+    OS_PEND_LIST         PendList;                          /* List of tasks waiting on event flag group              */
+#if (OS_CFG_DBG_EN > 0u)
+    OS_FLAG_GRP         *DbgPrevPtr;
+    OS_FLAG_GRP         *DbgNextPtr;
+    CPU_CHAR            *DbgNamePtr;
+#endif
+                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
+    OS_FLAGS             Flags;                             /* 8, 16, 32 or 64 bit flags (see OS_CFG_FLAG_WIDTH)      */
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS               TS;                                /* Timestamp of when last post occurred                   */
+#endif
+#if (OS_CFG_FLAG_WAIT_IDX_EN > 0u)
+    OS_TCB              *IdxTbl[OS_FLAG_IDX_NBR + 1u];      /* Waiters by flag they wait for (see Note #2)            */
+#endif
+#if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN > 0u))
+    CPU_INT16U           FlagID;                            /* Unique ID for third-party debuggers and tracers.       */
+#endif
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                      LOCK SITES
+*
+* Note(s) : (1) '.Site' identifies where the time was spent.  In OSLockSiteTbl[] it is one of the OS_LOCK_SITE_xxx
+*               indexes.  In OSSchedLockSiteTbl[] it is the return address of the OSSchedLock() call that locked the
+*               scheduler, as returned by the port's OS_CPU_RET_ADDR_GET().  Ports that don't define it record all
+*               callers under address 0.
+*
+*           (2) When OSSchedLockSiteTbl[] is full, the last entry accumulates the callers that have no entry of their
+*               own and its '.Site' is set to 0.
+*
+*           (3) Times are in OS_TS_GET() units.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_LOCK_SITE_EN > 0u)
+struct  os_lock_site {
+    CPU_ADDR             Site;                              /* Call site (see Note #1)                                */
+    CPU_INT32U           Ctr;                               /* Number of measurements, 0 if the entry is free         */
+    CPU_TS_TMR           TimeMax;                           /* Longest time measured at this site                     */
+};
+#endif
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                              CRITICAL SECTION PROFILE
+*
+* Note(s) : (1) OSCritSiteTbl[] has one entry per OS_CRIT_SITE_xxx.  The mean time spent with interrupts disabled is
+*               '.TimeTotal / .Ctr'.
+*
+*           (2) Times are in OS_TS_GET() units.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_CRIT_SECTION_PROFILE_EN > 0u)
+struct  os_crit_site {
+    CPU_INT32U           Ctr;                               /* Number of critical sections measured                   */
+    CPU_TS_TMR           TimeMax;                           /* Longest critical section                               */
+    CPU_INT64U           TimeTotal;                         /* Sum of the measured times (see Note #1)                */
+};
+#endif
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                   MEMORY PARTITIONS
+*
+* Note(s) : (1) When OS_CFG_MEM_PEND_EN is enabled, see  PEND OBJ  Note #1'.
+*
+*           (2) When OS_MEM_LOCK_FREE_EN is enabled, OSMemGet() and OSMemPut() update '.FreeListPtr' and '.NbrFree'
+*               with the port's exclusive load/store primitives instead of disabling interrupts.  '.NbrFree' is
+*               then a CPU_DATA so that it can be accessed with the same primitives.
+*
+*           (3) A block obtained with OSMemBufGet() starts with an OS_MEM_BUF.  The application is given a pointer to
+*               the data that follows it, which holds at most '.BlkSize - sizeof(OS_MEM_BUF)' bytes.
+*
+*           (4) '.Opt' holds the OS_OPT_MEM_CACHE_xxx options given to OSMemCreateAligned().  The port's
+*               OS_CPU_DCACHE_INV()/OS_CPU_DCACHE_CLEAN() are then applied to the block being allocated or released,
+*               which only touches the block's own cache lines since the blocks of such a partition are line aligned.
+*
+*           (5) '.QuotaTbl' has one entry per block, set by OSMemQuotaTblSet().  An entry points to the quota of the
+*               task the block was given to, so that the block is credited to that quota whichever task returns it.
+*               OSMemGet()/OSMemPut() then always disable interrupts since OS_MEM_LOCK_FREE_EN is forced to 0.
+*               Blocks taken or returned through a magazine are not counted in any quota.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+
+struct os_mem {                                             /* MEMORY CONTROL BLOCK                                   */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_MEM                       */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;
+#endif
+#if (OS_CFG_MEM_PEND_EN > 0u)
+    OS_PEND_LIST         PendList;                          /* List of tasks waiting for a free block (see Note #1)   */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    OS_MEM              *DbgPrevPtr;
+    OS_MEM              *DbgNextPtr;
+#if (OS_CFG_MEM_PEND_EN > 0u)
+    CPU_CHAR            *DbgNamePtr;
+#endif
+#endif
+    void                *AddrPtr;                           /* Pointer to beginning of memory partition               */
+#if (OS_MEM_LOCK_FREE_EN > 0u)
+    void       *volatile FreeListPtr;                       /* Pointer to list of free memory blocks (see Note #2)    */
+#else
+    void                *FreeListPtr;                       /* Pointer to list of free memory blocks                  */
+#endif
+    OS_MEM_SIZE          BlkSize;                           /* Size (in bytes) of each block of memory                */
+    OS_MEM_QTY           NbrMax;                            /* Total number of blocks in this partition               */
+#if (OS_CFG_MEM_CACHE_EN > 0u)
+    OS_OPT               Opt;                               /* Cache maintenance done on the blocks (see Note #4)     */
+#endif
+#if (OS_MEM_LOCK_FREE_EN > 0u)
+    CPU_DATA    volatile NbrFree;                           /* Number of memory blocks remaining in this partition    */
+#else
+    OS_MEM_QTY           NbrFree;                           /* Number of memory blocks remaining in this partition    */
+#endif
+#if (OS_CFG_MEM_MAG_EN > 0u) && (OS_CFG_DBG_EN > 0u)
+    OS_MEM_MAG          *MagDbgListPtr;                     /* List of magazines caching blocks of this partition     */
+#endif
+#if (OS_CFG_MEM_QUOTA_EN > 0u)
+    OS_MEM_QUOTA       **QuotaTbl;                          /* Quota each block is charged to (see Note #5)           */
+#endif
+#if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN > 0u))
+    CPU_INT16U           MemID;                             /* Unique ID for third-party debuggers and tracers.       */
+#endif
+};
+
+
+struct os_mem_mag {                                         /* MEMORY MAGAZINE (per task cache of a partition)        */
+    OS_MEM              *MemPtr;                            /* Pointer to partition the blocks belong to              */
+    void                *FreeListPtr;                       /* Pointer to list of blocks held by the magazine         */
+    OS_MEM_QTY           NbrFree;                           /* Number of blocks held by the magazine                  */
+    OS_MEM_QTY           NbrMax;                            /* Maximum number of blocks held by the magazine          */
+#if (OS_CFG_DBG_EN > 0u)
+    OS_MEM_MAG          *DbgNextPtr;                        /* Next magazine of the same partition                    */
+#endif
+};
+
+
+struct os_mem_buf {                                         /* REFERENCE-COUNTED BUFFER (header of a memory block)    */
+    OS_MEM              *MemPtr;                            /* Pointer to partition the block belongs to              */
+    OS_MEM_BUF_RELEASE_PTR  ReleasePtr;                     /* Called when the last reference is released             */
+#if (OS_MEM_BUF_ATOMIC_EN > 0u)
+    CPU_DATA    volatile RefCtr;                            /* Number of references to the buffer                     */
+#else
+    CPU_DATA             RefCtr;                            /* Number of references to the buffer                     */
+#endif
+};
+
+
+struct os_mem_quota {                                       /* PER-TASK QUOTA OF A MEMORY PARTITION                   */
+    OS_MEM              *MemPtr;                            /* Pointer to partition the quota applies to              */
+    OS_TCB              *TCBPtr;                            /* Task the quota belongs to, NULL once deleted           */
+    OS_MEM_QUOTA        *NextPtr;                           /* Next quota of the same task                            */
+    OS_MEM_QTY           NbrMax;                            /* Maximum number of blocks the task can hold             */
+    OS_MEM_QTY           NbrUsed;                           /* Number of blocks charged to the task                   */
+    OS_MEM_QTY           NbrUsedMax;                        /* Peak number of blocks charged to the task              */
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                        SLABS
+*
+* Note(s) : (1) A slab is a set of memory partitions, one per size class, sorted by increasing block size.  The size
+*               classes are described by a table of OS_SLAB_CFG that is usually a compile-time constant.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_slab_cfg {                                       /* SLAB SIZE CLASS CONFIGURATION                          */
+    void                *AddrPtr;                           /* Pointer to storage of the blocks of the class          */
+    OS_MEM_QTY           NbrBlks;                           /* Number of blocks in the class                          */
+    OS_MEM_SIZE          BlkSize;                           /* Size (in bytes) of each block of the class             */
+};
+
+
+struct  os_slab_class {                                     /* SLAB SIZE CLASS                                        */
+    OS_MEM               Mem;                               /* Memory partition of the class                          */
+    OS_MEM_QTY           NbrUsedMax;                        /* Peak number of blocks used in the class                */
+};
+
+
+struct  os_slab {                                           /* SLAB CONTROL BLOCK                                     */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_SLAB                      */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;
+#endif
+    OS_SLAB_CLASS       *ClassTbl;                          /* Size classes, sorted by increasing block size          */
+    OS_OBJ_QTY           NbrClasses;                        /* Number of entries in 'ClassTbl[]'                      */
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                     OBJECT POOLS
+*
+* Note(s) : (1) The kernel keeps one pool per object type (OSSemPool, OSQPool and OSTmrPool).  Each is a memory
+*               partition created by OSInit() over the storage reserved in os_cfg_app.c, with one control block per
+*               cache line aligned block so that two objects never share a line.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_obj_pool {                                       /* KERNEL OBJECT POOL                                     */
+    OS_MEM               Mem;                               /* Memory partition holding the control blocks            */
+    OS_MEM_QTY           NbrUsedMax;                        /* Peak number of objects allocated from the pool         */
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                        HEAPS
+*
+* Note(s) : (1) A heap is a two-level segregated fit (TLSF) allocator.  Its free blocks are kept in one list per size
+*               class: the first level splits the sizes by powers of two and the second level splits each power of
+*               two in OS_HEAP_SL_NBR ranges.  A bit of '.FLBitmap' and of '.SLBitmap[]' is set for each list that is
+*               not empty, so that a block large enough for a request is found with two bit scans.
+*
+*           (2) Each block starts with an OS_HEAP_BLK header.  A used block is linked in the list of blocks owned by a
+*               task through the same '.NextPtr' and '.PrevPtr' as a free block in the list of its size class.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_heap_blk {                                       /* HEAP BLOCK HEADER                                      */
+    OS_HEAP_BLK         *PhysPrevPtr;                       /* Block just below in memory, NULL for the first one     */
+    OS_HEAP_BLK         *NextPtr;                           /* Links in a free list or in the list of the owner       */
+    OS_HEAP_BLK         *PrevPtr;
+    OS_HEAP             *HeapPtr;                           /* Heap the block belongs to                              */
+    OS_TCB              *OwnerTCBPtr;                       /* Task owning the block, NULL if none or free            */
+    CPU_SIZE_T           Size;                              /* Size (in bytes) of the memory after the header         */
+    CPU_BOOLEAN          Used;                              /* OS_TRUE while the block is allocated                   */
+};
+
+
+struct  os_heap {                                           /* HEAP CONTROL BLOCK                                     */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_HEAP                      */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Pointer to Heap Name (NUL terminated ASCII)            */
+    OS_HEAP             *DbgPrevPtr;
+    OS_HEAP             *DbgNextPtr;
+    CPU_CHAR            *DbgNamePtr;
+#endif
+    CPU_DATA             FLBitmap;                          /* First levels with a free block (see Note #1)           */
+    CPU_DATA             SLBitmap[OS_CFG_HEAP_FL_NBR];      /* Second levels with a free block                        */
+                                                            /* Free list of each size class                           */
+    OS_HEAP_BLK         *FreeTbl[OS_CFG_HEAP_FL_NBR][OS_HEAP_SL_NBR];
+    void                *AddrPtr;                           /* Start of the memory managed by the heap                */
+    CPU_SIZE_T           SizeTotal;                         /* Size (in bytes) of the memory managed by the heap      */
+    CPU_SIZE_T           SizeFree;                          /* Bytes in free blocks                                   */
+    CPU_SIZE_T           SizeUsed;                          /* Bytes in used blocks                                   */
+    CPU_SIZE_T           SizeUsedMax;                       /* Peak number of bytes in used blocks                    */
+    OS_OBJ_QTY           NbrBlksFree;                       /* Number of free blocks                                  */
+    OS_OBJ_QTY           NbrBlksUsed;                       /* Number of used blocks                                  */
+    OS_CTR               NbrAllocFail;                      /* Number of allocations that found no free block         */
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                       MESSAGES
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_msg {                                            /* MESSAGE CONTROL BLOCK                                  */
+    OS_MSG              *NextPtr;                           /* Pointer to next message                                */
+    void                *MsgPtr;                            /* Actual message                                         */
+    OS_MSG_SIZE          MsgSize;                           /* Size of the message (in # bytes)                       */
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS               MsgTS;                             /* Time stamp of when message was sent                    */
+#endif
+};
+
+
+
+
+struct  os_msg_entry {                                      /* MESSAGE DESCRIPTOR FOR BATCH POSTS                     */
+    void                *MsgPtr;                            /* Actual message                                         */
+    OS_MSG_SIZE          MsgSize;                           /* Size of the message (in # bytes)                       */
+};
+
+
+
+struct  os_msg_pool {                                       /* OS_MSG POOL                                            */
+    OS_MSG              *NextPtr;                           /* Pointer to next message                                */
+    OS_MSG_QTY           NbrFree;                           /* Number of messages available from this pool            */
+    OS_MSG_QTY           NbrUsed;                           /* Current number of messages used                        */
+#if (OS_CFG_DBG_EN > 0u)
+    OS_MSG_QTY           NbrUsedMax;                        /* Peak number of messages used                           */
+#endif
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                              MESSAGE QUEUE STATISTICS
+*
+* Note(s) : (1) The residency of a message is the time from its OS_MsgQPut() to its OS_MsgQGet(), in OS_TS_GET()
+*               units.  The timestamp of a post deferred to the ISR handler task is the one of the original post, so
+*               the deferral is included.  A message handed directly to a waiting task never enters the queue and
+*               is not measured.
+*
+*           (2) 'ResTbl[]' has log2 buckets: entry 0 counts the residencies equal to 0 and entry 'n' the residencies
+*               'v' such that 2^(n-1) <= v < 2^n.  The last entry also counts all the larger residencies.  The mean
+*               residency is 'ResTotal / ResNbr'.
+*
+*           (3) 'DepthArea' is the sum, over time, of the number of entries multiplied by the time they stayed at
+*               that number.  The mean depth is 'DepthArea / (DepthTS - StartTS)'.  The statistics must be read and
+*               reset more often than the timestamp wraps around.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_MSG_Q_STAT_EN > 0u)
+struct  os_msg_q_stat {                                     /* MESSAGE QUEUE STATISTICS                               */
+    OS_HIST_CTR          ResTbl[OS_CFG_MSG_Q_STAT_HIST_SIZE]; /* Residency histogram (see Note #2)                    */
+    CPU_TS               ResMax;                            /* Longest residency                                      */
+    CPU_INT64U           ResTotal;                          /* Sum of the residencies                                 */
+    CPU_INT32U           ResNbr;                            /* Number of residencies measured                         */
+    CPU_TS               ResThreshold;                      /* Residency traced when exceeded, 0 if none              */
+    CPU_INT32U           ResOvrNbr;                         /* Number of residencies above 'ResThreshold'             */
+    CPU_INT64U           DepthArea;                         /* Number of entries integrated over time (Note #3)       */
+    CPU_TS               DepthTS;                           /* Timestamp of the last change of the depth              */
+    CPU_TS               StartTS;                           /* Timestamp of the start of the measurements             */
+};
+#endif
+
+
+
+struct  os_msg_q {                                          /* OS_MSG_Q                                               */
+    OS_MSG              *InPtr;                             /* Pointer to next OS_MSG to be inserted  in   the queue  */
+    OS_MSG              *OutPtr;                            /* Pointer to next OS_MSG to be extracted from the queue  */
+    OS_MSG_QTY           NbrEntriesSize;                    /* Maximum allowable number of entries in the queue       */
+    OS_MSG_QTY           NbrEntries;                        /* Current number of entries in the queue                 */
+#if (OS_CFG_DBG_EN > 0u)
+    OS_MSG_QTY           NbrEntriesMax;                     /* Peak number of entries in the queue                    */
+#endif
+#if (OS_CFG_Q_PRIV_POOL_EN > 0u)
+    OS_MSG_POOL         *PoolPtr;                           /* Pointer to pool the OS_MSGs are taken from             */
+#endif
+#if (OS_CFG_Q_PRIO_EN > 0u)
+    CPU_DATA             LvlMap;                            /* Bitmap of the priority levels holding messages         */
+    OS_MSG              *LvlTailPtr[OS_CFG_Q_PRIO_LVL_NBR]; /* Last message queued at each priority level             */
+#endif
+#if (OS_CFG_MSG_Q_STAT_EN > 0u)
+    OS_MSG_Q_STAT        Stat;                              /* Residency and depth statistics                         */
+#endif
+#if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN > 0u))
+    CPU_INT16U           MsgQID;                            /* Unique ID for third-party debuggers and tracers.       */
+#endif
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                              MUTUAL EXCLUSION SEMAPHORES
+*
+* Note(s) : (1) See  PEND OBJ  Note #1'.
+*
+*           (2) The mutexes owned by a task are linked from its '.MutexGrpHeadPtr'.  When OS_CFG_MUTEX_GRP_SORT_EN is
+*               enabled, the group is kept sorted by the priority of the first waiter of each mutex, highest first, so
+*               that OS_MutexGrpPrioFindHighest() only looks at the first mutex of the group.
+*
+*           (3) When OS_CFG_MUTEX_CEILING_EN is enabled, OSMutexCeilingSet() may assign a ceiling priority to a mutex.
+*               The owner of such a mutex runs at the ceiling for as long as it holds it, and a mutex counts as having
+*               a waiter at its ceiling priority wherever the kernel looks for the highest waiter of a group.  A task
+*               with a higher priority than the ceiling that pends on the mutex still passes its priority on.
+*
+*           (4) When OS_CFG_MUTEX_SPIN_CNT is not 0, OSMutexPend() polls an owned mutex up to that many times before
+*               blocking, but only while the port's OS_CPU_TASK_IS_RUNNING() reports that the owner is executing, on
+*               another core or host thread.  Ports that run a single task at a time leave OS_CPU_TASK_IS_RUNNING()
+*               undefined and the caller blocks right away.
+*
+*           (5) When OS_MUTEX_FAST_EN is enabled, OSMutexPend() claims a free mutex by storing OSTCBCurPtr in
+*               '.OwnerTCBPtr' with the port's exclusive load/store primitives, and OSMutexPost() releases it the same
+*               way, without a critical section.  Such a mutex is not in the group of its owner ('.GrpLinked' is
+*               OS_FALSE) until another task pends on it, in which case the kernel adds it to the group before the
+*               owner inherits a priority, and the owner releases it through the regular path.  Mutexes with a
+*               ceiling always take the regular path.  A mutex claimed this way and never contended is not released
+*               by OSTaskDel().
+*
+*           (6) When OS_CFG_MUTEX_THROUGHPUT_EN is enabled, OSMutexThroughputSet() may put a mutex in throughput mode.
+*               OSMutexPost() then leaves such a mutex available and only readies its first waiter, instead of making
+*               that waiter the owner, so that a task releasing and taking the mutex again in a loop does not switch
+*               to the waiter each time.  The waiter tries again when it runs and pends anew, with the same timeout,
+*               if another task took the mutex first.  A mutex can thus be available with tasks still waiting on it,
+*               and the task that takes it inherits the priority of the first of them.
+*
+*           (7) When OS_CFG_MUTEX_BLOCK_STAT_EN is enabled, OSMutexPend() measures how long each task stays blocked on
+*               the mutex and walks the chain of owners that blocks it: the owner of the mutex, the owner of the mutex
+*               that owner waits for, and so on.  The longest wait on any mutex is kept, with its chain as it was when
+*               the task blocked, in OSMutexChainWorst (see OSMutexChainWorstGet()).  OSStatReset() clears them.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_mutex {                                          /* Mutual Exclusion Semaphore                             */
+                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_MUTEX                     */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Pointer to Mutex Name (NUL terminated ASCII)           */
+#endif
+    OS_PEND_LIST         PendList;                          /* List of tasks waiting on mutex                         */
+#if (OS_CFG_DBG_EN > 0u)
+    OS_MUTEX            *DbgPrevPtr;
+    OS_MUTEX            *DbgNextPtr;
+    CPU_CHAR            *DbgNamePtr;
+#endif
+                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
+    OS_MUTEX            *MutexGrpNextPtr;                   /* Next mutex owned by the same task (see Note #2)        */
+#if (OS_MUTEX_FAST_EN > 0u)
+    OS_TCB     *volatile OwnerTCBPtr;                       /* Mutex is available when (OS_TCB *)0 (see Note #5)      */
+    CPU_BOOLEAN          GrpLinked;                         /* Mutex is in the group of its owner                     */
+#else
+    OS_TCB              *OwnerTCBPtr;
+#endif
+    OS_NESTING_CTR       OwnerNestingCtr;                   /* Mutex is available when the counter is 0               */
+#if (OS_CFG_MUTEX_CEILING_EN > 0u)
+    OS_PRIO              CeilingPrio;                       /* Ceiling priority, OS_PRIO_INIT if none (see Note #3)   */
+#endif
+#if (OS_CFG_MUTEX_THROUGHPUT_EN > 0u)
+    CPU_BOOLEAN          Throughput;                        /* Release without handoff (see Note #6)                  */
+#endif
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS               TS;
+#endif
+#if (OS_CFG_MUTEX_BLOCK_STAT_EN > 0u)
+    CPU_TS               OwnerTS;                           /* OS_TS_GET() when the owner got the mutex               */
+    OS_CTR               BlockCtr;                          /* Number of times a task blocked on it (see Note #7)     */
+    OS_CYCLES            BlockTimeTotal;                    /* Total time tasks were blocked on it                    */
+    CPU_TS               BlockTimeMax;                      /* Longest time a task was blocked on it                  */
+    CPU_INT08U           BlockDepthMax;                     /* Longest chain of owners that blocked a task            */
+#endif
+#if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN > 0u))
+    CPU_INT16U           MutexID;                           /* Unique ID for third-party debuggers and tracers.       */
+#endif
+};
+
+
+struct  os_mutex_chain {                                    /* CHAIN OF OWNERS THAT BLOCKED A TASK                    */
+    OS_TCB              *TaskPtr;                           /* Task that was blocked                                  */
+    OS_MUTEX            *MutexPtr;                          /* Mutex the task pended on                               */
+    CPU_TS               BlockTime;                         /* Time the task stayed blocked                           */
+    CPU_INT08U           Depth;                             /* Number of owners in the chain                          */
+    OS_TCB              *OwnerTbl[OS_CFG_MUTEX_CHAIN_MAX];  /* Owners, the owner of .MutexPtr first                   */
+    CPU_TS               HoldTbl[OS_CFG_MUTEX_CHAIN_MAX];   /* How long each owner had held its mutex                 */
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                  CONDITION VARIABLES
+*
+* Note(s) : See  PEND OBJ  Note #1'.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_cond {                                           /* Condition Variable                                     */
+                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_COND                      */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Pointer to Mutex Name (NUL terminated ASCII)           */
+#endif
+    OS_PEND_LIST         PendList;                          /* List of tasks waiting on condition variable            */
+#if (OS_CFG_DBG_EN > 0u)
+    void                *DbgPrevPtr;
+    void                *DbgNextPtr;
+    CPU_CHAR            *DbgNamePtr;
+#endif
+                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
+    OS_MUTEX            *Mutex;                             /* Mutex bound to the condition variable.                 */
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                    MESSAGE QUEUES
+*
+* Note(s) : (1) See  PEND OBJ  Note #1'.
+*
+*           (2) When OS_CFG_Q_POST_WAIT_EN is enabled, the tasks blocked in OSQPostWait() because the queue is full wait
+*               on '.SpacePendObj', a pend object of their own, so that '.PendList' only ever holds receivers.  The
+*               message of such a task is kept in '.MsgPtr', '.MsgSize' and '.QPostOpt' of its OS_TCB, and the task
+*               that makes room in the queue places it there on its behalf.
+*
+*           (3) When OS_CFG_Q_PEND_MATCH_EN is enabled, a task blocked in OSQPendMatch() only accepts the messages for
+*               which the function in '.QMatchFnct' of its OS_TCB returns OS_TRUE.  A message is handed to the highest
+*               priority waiting task that accepts it, and is queued only if none does.  The waiting tasks may thus
+*               be blocked while the queue holds messages that they did not accept.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_q {                                              /* Message Queue                                          */
+                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_Q                         */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Pointer to Message Queue Name (NUL terminated ASCII)   */
+#endif
+    OS_PEND_LIST         PendList;                          /* List of tasks waiting on message queue                 */
+#if (OS_CFG_DBG_EN > 0u)
+    OS_Q                *DbgPrevPtr;
+    OS_Q                *DbgNextPtr;
+    CPU_CHAR            *DbgNamePtr;
+#endif
+                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
+    OS_MSG_Q             MsgQ;                              /* List of messages                                       */
+#if (OS_CFG_Q_PRIV_POOL_EN > 0u)
+    OS_MSG_POOL          MsgPool;                           /* Private pool of OS_MSGs (see OSQCreateWithPool())      */
+#endif
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+    OS_PEND_OBJ          SpacePendObj;                      /* Tasks waiting for room (see Note #2)                   */
+#endif
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                      MAILBOXES
+*
+* Note(s) : (1) See  PEND OBJ  Note #1'.
+*
+*           (2) A mailbox holds a single value, without using OS_MSGs.  A post overwrites the value kept in the
+*               mailbox, '.Fresh' telling whether it was taken by OSMboxPend() yet.
+*
+*           (3) '.Seq' is odd while a post updates '.MsgPtr', '.MsgSize' and '.TS', and is 0 until the first post.
+*               OSMboxPeek() reads the value without a critical section and retries when '.Seq' changed meanwhile.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_mbox {                                           /* Mailbox                                                */
+                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_MBOX                      */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Pointer to Mailbox Name (NUL terminated ASCII)         */
+#endif
+    OS_PEND_LIST         PendList;                          /* List of tasks waiting on mailbox                       */
+#if (OS_CFG_DBG_EN > 0u)
+    OS_MBOX             *DbgPrevPtr;
+    OS_MBOX             *DbgNextPtr;
+    CPU_CHAR            *DbgNamePtr;
+#endif
+                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
+    void       *volatile MsgPtr;                            /* Latest value posted                                    */
+    OS_MSG_SIZE volatile MsgSize;
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS      volatile TS;                                /* Timestamp of the latest post                           */
+#endif
+    CPU_DATA    volatile Seq;                               /* Sequence count of the posts (see Note #3)              */
+    CPU_BOOLEAN          Fresh;                             /* OS_TRUE if the value was not taken by a pend yet       */
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                        PIPES
+*
+* Note(s) : (1) See  PEND OBJ  Note #1'.
+*
+*           (2) 'NbrUsed' bytes are stored starting at 'OutIx' and wrapping around at 'BufSize'.  The next byte written
+*               goes to 'InIx'.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_pipe {                                           /* Pipe                                                   */
+                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_PIPE                      */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Pointer to Pipe Name (NUL terminated ASCII)            */
+#endif
+    OS_PEND_LIST         PendList;                          /* List of tasks waiting on pipe                          */
+#if (OS_CFG_DBG_EN > 0u)
+    OS_PIPE             *DbgPrevPtr;
+    OS_PIPE             *DbgNextPtr;
+    CPU_CHAR            *DbgNamePtr;
+#endif
+                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
+    CPU_INT08U          *BufPtr;                            /* Pointer to storage of the bytes                        */
+    OS_MSG_SIZE          BufSize;                           /* Capacity of the pipe (in # bytes)                      */
+    OS_MSG_SIZE          InIx;                              /* Index of next byte to write                            */
+    OS_MSG_SIZE          OutIx;                             /* Index of next byte to read                             */
+    OS_MSG_SIZE          NbrUsed;                           /* Number of bytes in the pipe                            */
+    OS_MSG_SIZE          WatermarkLo;                       /* Writers are woken at or below this level               */
+    OS_MSG_SIZE          WatermarkHi;                       /* Readers are woken at or above this level               */
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                     RING BUFFERS
+*
+* Note(s) : (1) See  PEND OBJ  Note #1'.
+*
+*           (2) The elements of a ring buffer are always in the following order, starting at 'OutIx' and wrapping
+*               around at 'NbrElem':
+*
+*                   'NbrPeeked' elements being read, 'NbrRdy' elements committed, 'NbrReserved' elements being
+*                   written and 'NbrFree' unused elements, the first of which is at 'InIx'.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_ring {                                           /* Ring Buffer                                            */
+                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_RING                      */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Pointer to Ring Buffer Name (NUL terminated ASCII)     */
+#endif
+    OS_PEND_LIST         PendList;                          /* List of tasks waiting on ring buffer                   */
+#if (OS_CFG_DBG_EN > 0u)
+    OS_RING             *DbgPrevPtr;
+    OS_RING             *DbgNextPtr;
+    CPU_CHAR            *DbgNamePtr;
+#endif
+                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
+    CPU_INT08U          *BufPtr;                            /* Pointer to storage of the elements                     */
+    OS_MSG_SIZE          ElemSize;                          /* Size of each element (in # bytes)                      */
+    OS_MSG_QTY           NbrElem;                           /* Total number of elements                               */
+    OS_MSG_QTY           InIx;                              /* Index of next element to reserve                       */
+    OS_MSG_QTY           OutIx;                             /* Index of next element to peek                          */
+    OS_MSG_QTY           NbrFree;                           /* Number of elements available to OSRingReserve()        */
+    OS_MSG_QTY           NbrReserved;                       /* Number of elements reserved but not committed yet      */
+    OS_MSG_QTY           NbrRdy;                            /* Number of elements available to OSRingPeek()           */
+    OS_MSG_QTY           NbrPeeked;                         /* Number of elements peeked but not released yet         */
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                 READER/WRITER LOCKS
+*
+* Note(s) : (1) See  PEND OBJ  Note #1'.
+*
+*           (2) Each owner of a reader/writer lock, the writer or any of the readers, uses one of the OS_RWLOCK_HOLD
+*               entries of its OS_TCB.  The entries of all the owners of a lock are linked from '.HoldHeadPtr', so a
+*               task can hold up to OS_CFG_RWLOCK_HOLD_MAX locks at a time.
+*
+*           (3) Readers and writers wait in the same pend list, in priority order.  A reader is only let in while no
+*               writer waits at the same or a higher priority, and the lock is handed to the waiters at the head of
+*               the list: either one writer or all the readers ahead of the first writer.
+*
+*           (4) The owners of a lock inherit the priority of the highest priority task waiting on it.  The waiters
+*               of the locks a task holds are taken into account by OS_MutexGrpPrioFindHighest(), so reader/writer
+*               locks and mutexes held by the same task are disinherited together.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_rwlock_hold {                                    /* Reader/Writer Lock Hold                                */
+    OS_RWLOCK           *RwLockPtr;                         /* Lock held, (OS_RWLOCK *)0 if the entry is free         */
+    OS_TCB              *TCBPtr;                            /* Task holding the lock                                  */
+    OS_RWLOCK_HOLD      *NextPtr;                           /* Next owner of the same lock                            */
+    OS_NESTING_CTR       NestingCtr;
+};
+
+
+struct  os_rwlock {                                         /* Reader/Writer Lock                                     */
+                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_RWLOCK                    */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Pointer to Reader/Writer Lock Name (NUL terminated)    */
+#endif
+    OS_PEND_LIST         PendList;                          /* List of tasks waiting on reader/writer lock            */
+#if (OS_CFG_DBG_EN > 0u)
+    OS_RWLOCK           *DbgPrevPtr;
+    OS_RWLOCK           *DbgNextPtr;
+    CPU_CHAR            *DbgNamePtr;
+#endif
+                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
+    OS_RWLOCK_HOLD      *HoldHeadPtr;                       /* Owners of the lock (see Note #2)                       */
+    OS_TCB              *WrOwnerTCBPtr;                     /* Writer owning the lock, (OS_TCB *)0 if none            */
+    OS_OBJ_QTY           RdCtr;                             /* Number of readers owning the lock                      */
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS               TS;
+#endif
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                 DEFERRED ISR POST
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_int_q {                                          /* Post issued by an ISR, performed by OS_IntQTask()      */
+    OS_OBJ_TYPE          Type;                              /* Type of object posted to                               */
+    void                *ObjPtr;                            /* Pointer to object (or OS_TCB) posted to                */
+    void                *MsgPtr;                            /* Message posted (queues only)                           */
+    OS_MSG_SIZE          MsgSize;                           /* Size of the message (in # bytes)                       */
+    OS_FLAGS             Flags;                             /* Flags to set or clear (event flags only)               */
+    OS_OPT               Opt;                               /* Option passed to OSxxxPost()                           */
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                ISR TO TASK QUEUE
+*
+* Note(s) : (1) 'InIx' is only written by the producer (ISR) and 'OutIx' only by the consumer (task).  Both run from 0
+*               to (2 * NbrElem) - 1 so that a full queue can be told apart from an empty one.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_isr_q {                                          /* ISR to Task Queue                                      */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_ISR_Q                     */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Pointer to ISR Queue Name (NUL terminated ASCII)       */
+#endif
+    OS_TCB              *TCBPtr;                            /* Pointer to TCB of consumer task                        */
+    CPU_INT08U volatile *BufPtr;                            /* Pointer to storage of the elements                     */
+    OS_MSG_SIZE          ElemSize;                          /* Size of each element (in # bytes)                      */
+    OS_MSG_QTY           NbrElem;                           /* Total number of elements                               */
+    OS_MSG_QTY volatile  InIx;                              /* Index of next element to fill   (producer only)        */
+    OS_MSG_QTY volatile  OutIx;                             /* Index of next element to empty  (consumer only)        */
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                 INTER-CORE CHANNELS
+*
+* Note(s) : (1) 'OS_ICC_SHM' and the 'OS_ICC_MSG' slots it points to are placed in memory shared by two cores, each
+*               running its own kernel.  'OS_ICC' is the private end of the channel on each core.
+*
+*           (2) 'InIx' is only written by the sending core and 'OutIx' only by the receiving core.  Both run from 0 to
+*               (2 * NbrMsgs) - 1, as in an OS_ISR_Q.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_icc_msg {                                        /* Message slot of an Inter-Core Channel                  */
+    void                *MsgPtr;                            /* Pointer to the message (not copied)                    */
+    OS_MSG_SIZE          MsgSize;                           /* Size of the message (in # bytes)                       */
+};
+
+
+struct  os_icc_shm {                                        /* Shared part of an Inter-Core Channel                   */
+    OS_ICC_MSG volatile *MsgTbl;                            /* Pointer to the message slots                           */
+    OS_MSG_QTY           NbrMsgs;                           /* Total number of message slots                          */
+    OS_MSG_QTY volatile  InIx;                              /* Index of next slot to fill   (sending core only)       */
+    OS_MSG_QTY volatile  OutIx;                             /* Index of next slot to empty  (receiving core only)     */
+};
+
+
+struct  os_icc {                                            /* Local end of an Inter-Core Channel                     */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* OS_OBJ_TYPE_ICC_TX or OS_OBJ_TYPE_ICC_RX               */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Pointer to Channel Name (NUL terminated ASCII)         */
+#endif
+    OS_ICC_SHM          *ShmPtr;                            /* Pointer to the shared part of the channel              */
+    OS_ICC_DOORBELL_PTR  DoorbellPtr;                       /* Sending end: interrupts the receiving core             */
+    void                *DoorbellArg;
+    OS_Q                *QPtr;                              /* Receiving end: queue the messages are posted to ...    */
+    OS_TCB              *TCBPtr;                            /* ... or task whose message queue they are posted to     */
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                      SEMAPHORES
+*
+* Note(s) : (1) See  PEND OBJ  Note #1'.
+*
+*           (2) When OS_SEM_FAST_EN is enabled, OSSemPost() increments '.Ctr' and OSSemPend() decrements it with the
+*               port's exclusive load/store primitives, without a critical section, as long as no task waits on the
+*               semaphore and no reactor watches it.  '.Ctr' is then a CPU_DATA, which must be at least as wide as
+*               OS_SEM_CTR.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_sem {                                            /* Semaphore                                              */
+                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_SEM                       */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Pointer to Semaphore Name (NUL terminated ASCII)       */
+#endif
+    OS_PEND_LIST         PendList;                          /* List of tasks waiting on semaphore                     */
+#if (OS_CFG_DBG_EN > 0u)
+    OS_SEM              *DbgPrevPtr;
+    OS_SEM              *DbgNextPtr;
+    CPU_CHAR            *DbgNamePtr;
+#endif
+                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
+#if (OS_SEM_FAST_EN > 0u)
+    CPU_DATA    volatile Ctr;                               /* See Note #2                                            */
+#else
+    OS_SEM_CTR           Ctr;
+#endif
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS               TS;
+#endif
+#if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN > 0u))
+    CPU_INT16U           SemID;                             /* Unique ID for third-party debuggers and tracers.       */
+#endif
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                         INTER-CORE LOCKS AND EVENTS
+*
+* Note(s) : (1) An 'OS_ICC_HW' describes one gate of a hardware semaphore or spinlock peripheral shared by the cores.
+*               'TryLock' makes a single attempt and returns OS_TRUE if the gate was taken, 'Unlock' frees it and
+*               'NotifyEn', if not NULL, enables the interrupt raised on this core when the other core frees it.
+*
+*           (2) 'OS_ICC_EVT_SHM' is placed in memory shared by the two cores.  'Flags' is only modified with the
+*               hardware gate of the event held.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_icc_hw {                                         /* Hardware gate (see Note #1)                            */
+    OS_ICC_HW_TRY_LOCK_PTR   TryLock;                       /* Take the gate if free, never waits                     */
+    OS_ICC_HW_UNLOCK_PTR     Unlock;                        /* Free the gate                                          */
+    OS_ICC_HW_NOTIFY_EN_PTR  NotifyEn;                      /* Interrupt when freed, NULL to poll every tick          */
+    void                    *Arg;                           /* Argument of the three functions (gate number, ...)     */
+};
+
+
+struct  os_icc_lock {                                       /* Inter-Core Lock                                        */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE              Type;                          /* Should be set to OS_OBJ_TYPE_ICC_LOCK                  */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR                *NamePtr;                       /* Pointer to Lock Name (NUL terminated ASCII)            */
+#endif
+    const  OS_ICC_HW        *HwPtr;                         /* Gate shared with the other core                        */
+    OS_MUTEX                 Mutex;                         /* Serializes the local tasks                             */
+    OS_SEM                   Sem;                           /* Posted when the other core frees the gate              */
+};
+
+
+struct  os_icc_evt_shm {                                    /* Shared part of an Inter-Core Event (see Note #2)       */
+    OS_FLAGS       volatile  Flags;                         /* Flags posted and not yet received                      */
+};
+
+
+struct  os_icc_evt {                                        /* Local end of an Inter-Core Event                       */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE              Type;                          /* Should be set to OS_OBJ_TYPE_ICC_EVT                   */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR                *NamePtr;                       /* Pointer to Event Name (NUL terminated ASCII)           */
+#endif
+    OS_ICC_EVT_SHM          *ShmPtr;                        /* Pointer to the shared part of the event                */
+    const  OS_ICC_HW        *HwPtr;                         /* Gate protecting 'ShmPtr->Flags'                        */
+    OS_ICC_DOORBELL_PTR      DoorbellPtr;                   /* Posting core: interrupts the receiving core            */
+    void                    *DoorbellArg;
+    OS_FLAG_GRP             *GrpPtr;                        /* Receiving core: local group the flags are posted to    */
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                    SEQUENCE LOCKS
+*
+* Note(s) : (1) See  PEND OBJ  Note #1'.
+*
+*           (2) A sequence lock protects data written by one writer at a time, a task or an ISR, and read by any number
+*               of tasks and ISRs.  '.Seq' is odd while a write is in progress.  A reader copies the data and starts
+*               over if '.Seq' was odd or changed meanwhile, it never disables interrupts nor blocks a writer.
+*
+*           (3) The pend list holds the tasks waiting in OSSeqLockPend() for the end of the next write.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_seqlock {                                        /* Sequence Lock                                          */
+                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_SEQLOCK                   */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Pointer to Sequence Lock Name (NUL terminated ASCII)   */
+#endif
+    OS_PEND_LIST         PendList;                          /* List of tasks waiting for the end of a write           */
+#if (OS_CFG_DBG_EN > 0u)
+    OS_SEQLOCK          *DbgPrevPtr;
+    OS_SEQLOCK          *DbgNextPtr;
+    CPU_CHAR            *DbgNamePtr;
+#endif
+                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
+    CPU_DATA    volatile Seq;                               /* Sequence count of the writes (see Note #2)             */
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                  READ-COPY-UPDATE
+*
+* Note(s) : (1) See  PEND OBJ  Note #1'.
+*
+*           (2) An RCU domain tells a writer when the readers that may still use the old version of some data are done
+*               with it.  A reader registers in '.RdCtrTbl[.Phase]'.  A grace period switches '.Phase' and ends when the
+*               counter of the previous phase drops to 0, readers that came after the switch are not waited for.
+*
+*           (3) '.GpSeq' is incremented when a grace period starts, making it odd, and again when it ends.  '.GpReq'
+*               asks for another grace period to start as soon as the current one ends.
+*
+*           (4) The pend list holds the tasks waiting in OSRcuSync(), each one for the value of '.GpSeq' saved in the
+*               '.RcuGp' member of its OS_TCB.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_rcu {                                            /* Read-Copy-Update Domain                                */
+                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_RCU                       */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Pointer to RCU Domain Name (NUL terminated ASCII)      */
+#endif
+    OS_PEND_LIST         PendList;                          /* List of tasks waiting for a grace period               */
+#if (OS_CFG_DBG_EN > 0u)
+    OS_RCU              *DbgPrevPtr;
+    OS_RCU              *DbgNextPtr;
+    CPU_CHAR            *DbgNamePtr;
+#endif
+                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
+    OS_CTR               RdCtrTbl[2];                       /* Number of readers registered in each phase             */
+    CPU_INT08U           Phase;                             /* Phase new readers register in (see Note #2)            */
+    OS_RCU_GP            GpSeq;                             /* Grace period sequence count (see Note #3)              */
+    CPU_BOOLEAN          GpReq;                             /* Another grace period was requested                     */
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                       TOPICS
+*
+* Note(s) : (1) A topic is not a pend object, tasks wait on the queues of its subscribers.  It only keeps the list of
+*               the subscribers, in no particular order.
+*
+*           (2) A subscriber delivers the messages either to the queue of the task '.TCBPtr' or to the message queue
+*               '.QPtr', the other pointer is NULL.  '.DropCtr' counts the messages it missed because its queue was full.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_topic {                                          /* Topic                                                  */
+                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_TOPIC                     */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Pointer to Topic Name (NUL terminated ASCII)           */
+    OS_TOPIC            *DbgPrevPtr;
+    OS_TOPIC            *DbgNextPtr;
+    CPU_CHAR            *DbgNamePtr;
+#endif
+                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
+    OS_TOPIC_SUB        *SubListPtr;                        /* List of subscribers (see Note #1)                      */
+    OS_OBJ_QTY           NbrSubs;                           /* Number of subscribers                                  */
+};
+
+
+struct  os_topic_sub {                                      /* Topic Subscriber                                       */
+    OS_TOPIC_SUB        *NextPtr;                           /* Next subscriber of the same topic                      */
+    OS_TOPIC            *TopicPtr;                          /* Topic subscribed to, NULL if none                      */
+    OS_TCB              *TCBPtr;                            /* Task whose queue receives the messages (see Note #2)   */
+    OS_Q                *QPtr;                              /* Message queue receiving the messages                   */
+    OS_CTR               DropCtr;                           /* Number of messages missed                              */
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                   CALL ENDPOINTS
+*
+* Note(s) : (1) The tasks waiting on a call endpoint are either clients calling it with OSCall() or servers waiting for
+*               a call in OSCallRecv(), never both: a call is handed over as soon as both sides are there.  The state
+*               of the task at the head of '.PendList' tells which side is waiting.
+*
+*           (2) A call in progress is not kept in the endpoint but in the OS_TCBs of the two tasks: '.CallClientPtr' of
+*               the server points to the client and '.CallSrvPtr' of the client points to the server.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_call_ep {                                        /* Call Endpoint                                          */
+                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_CALL_EP                   */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Pointer to Call Endpoint Name (NUL terminated ASCII)   */
+#endif
+    OS_PEND_LIST         PendList;                          /* List of clients or of servers waiting (see Note #1)    */
+#if (OS_CFG_DBG_EN > 0u)
+    OS_CALL_EP          *DbgPrevPtr;
+    OS_CALL_EP          *DbgNextPtr;
+    CPU_CHAR            *DbgNamePtr;
+#endif
+                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
+    OS_CTR               CallCtr;                           /* Number of calls handed to a server                     */
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                       SIGNALS
+*
+* Note(s) : (1) A signal is a binary event that at most one task waits on.  It has no pend list: the waiter is kept in
+*               '.TCBPtr' and a post made while no task waits is remembered in '.Pending'.
+*
+*           (2) The generic members are laid out as in an OS_PEND_OBJ, except for '.PendList', so that kernel aware
+*               tools can still read the type and the name of the object.
+*
+*           (3) With OS_CFG_SIGNAL_COALESCE_EN, '.PostCtr' counts the posts held back since the waiter was last readied.
+*               They are delivered once there are '.Threshold' of them or '.WindowTs' after the first one, at
+*               '.PostTs'.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_signal {                                         /* Signal                                                 */
+                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_SIGNAL                    */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Pointer to Signal Name (NUL terminated ASCII)          */
+    OS_SIGNAL           *DbgPrevPtr;
+    OS_SIGNAL           *DbgNextPtr;
+#endif
+                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
+    OS_TCB              *TCBPtr;                            /* Task waiting on the signal, (OS_TCB *)0 if none        */
+    CPU_BOOLEAN          Pending;                           /* OS_TRUE if posted while no task was waiting            */
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS               TS;
+#endif
+#if (OS_CFG_SIGNAL_COALESCE_EN > 0u)
+    OS_CTR               PostCtr;                           /* Posts held back (see Note #3)                          */
+    OS_CTR               Threshold;                         /* Number of posts that readies the waiter                */
+    CPU_TS               WindowTs;                          /* Longest time posts are held back, 0 if no limit        */
+    CPU_TS               PostTs;                            /* Time of the first post held back                       */
+#endif
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                     COMPLETIONS
+*
+* Note(s) : (1) A completion reports the end of an asynchronous operation, typically a driver transfer started by a
+*               task and finished by an ISR.  It is done once, by OSCompletionDone(), and stays done, with the result
+*               and the data given by the completer, until OSCompletionReinit() arms it for the next operation.
+*
+*           (2) At most one task waits on a completion and, like a signal, it has no pend list.  A job of a work queue
+*               can also be registered with OSCompletionCallbackSet(), it is then submitted when the completion is done.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_completion {                                     /* Completion                                             */
+                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_COMPLETION                */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Pointer to Completion Name (NUL terminated ASCII)      */
+    OS_COMPLETION       *DbgPrevPtr;
+    OS_COMPLETION       *DbgNextPtr;
+#endif
+                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
+    OS_TCB              *TCBPtr;                            /* Task waiting on the completion, (OS_TCB *)0 if none    */
+    CPU_BOOLEAN          Done;                              /* OS_TRUE once OSCompletionDone() was called             */
+    CPU_INT32S           Result;                            /* Result code given by the completer                     */
+    void                *DataPtr;                           /* Data given by the completer                            */
+#if (OS_CFG_WORKQ_EN > 0u)
+    OS_WORKQ            *WorkQPtr;                          /* Work queue of the callback job, (OS_WORKQ *)0 if none  */
+    OS_WORK             *WorkPtr;                           /* Callback job, submitted when done (see Note #2)        */
+    CPU_INT08U           WorkPrio;                          /* Priority of the callback job                           */
+#endif
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS               TS;                                /* Timestamp of when the completion was done              */
+#endif
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                  SAMPLING PROFILER
+*
+* Note(s) : (1) While sampling is on, the tick ISR of the port records the address it interrupted and the task that was
+*               running in OSProfSampleTbl[].  The table is a ring: OSProfSampleRead() takes the samples out, and a
+*               sample taken while the ring is full is dropped and counted in OSProfSampleOvfCtr.
+*
+*           (2) 'TCBPtr' is (OS_TCB *)0 when the tick interrupted another ISR, and 'PC' is 0 when the port could not
+*               find the interrupted address.  The addresses are turned into function names on the host, with the symbol
+*               table of the application.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_PROF_SAMPLE_EN > 0u)
+struct  os_prof_sample {
+    OS_TCB              *TCBPtr;                            /* Task interrupted by the tick                           */
+    CPU_ADDR             PC;                                /* Address of the interrupted instruction                 */
+};
+#endif
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                               IDLE POWER MANAGEMENT
+*
+* Note(s) : (1) The sleep states of the platform are registered with OSIdlePMStateAdd(), from the lightest to the
+*               deepest.  When the idle task runs, it enters the deepest state whose entry and exit latencies fit in
+*               the time left before the next kernel deadline.
+*
+*           (2) The latencies are in OS_TS_GET() units.  'ExitLatMeas' starts at 'ExitLat' and follows the wake-up
+*               times measured each time the state ends on its own wake-up deadline, 1/2^OS_IDLE_PM_LAT_SHIFT of the
+*               way per wake-up.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_TASK_IDLE_PM_EN > 0u)
+#define  OS_IDLE_PM_LAT_SHIFT                 3u
+
+struct  os_idle_pm_state {
+    OS_IDLE_PM_STATE    *NextPtr;                           /* Next deeper state                                      */
+    CPU_CHAR            *NamePtr;
+    OS_IDLE_PM_FNCT      EnterFnct;                         /* Enters the state, returns once woken up                */
+    CPU_TS               EntryLat;                          /* Time to enter the state                                */
+    CPU_TS               ExitLat;                           /* Time to wake up, as registered                         */
+    CPU_TS               ExitLatMeas;                       /* Time to wake up, as measured (see Note #2)             */
+    OS_CTR               EntryCtr;                          /* Number of times the state was entered                  */
+};
+#endif
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                      REACTORS
+*
+* Note(s) : (1) A reactor lets a single task serve many event sources.  Each OS_REACTOR_SRC is given an ID, from 0 to
+*               OS_REACTOR_SRC_NBR_MAX - 1, and a handler.  The task calls OSReactorRun(), which blocks until a source
+*               is ready and then calls the handlers of the ready sources.
+*
+*           (2) A source can watch a semaphore, a message queue or an event flag group: the object records the source
+*               in '.ReactorSrcPtr' of its pend list and each post that no task takes makes the source ready.  Other
+*               sources, timers among them, are made ready by OSReactorSrcSignal() or by OSReactorTmrCallback().
+*
+*           (3) '.RdyTbl' has the bit of each ready source set, the bit of ID 0 being the most significant one.  The
+*               next source to dispatch is found with CPU_CntLeadZeros(), sources of lower ID first, whatever the
+*               number of sources registered.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_reactor {                                        /* Reactor                                                */
+                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_REACTOR                   */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Pointer to Reactor Name (NUL terminated ASCII)         */
+    OS_REACTOR          *DbgPrevPtr;
+    OS_REACTOR          *DbgNextPtr;
+#endif
+                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
+    OS_TCB              *TCBPtr;                            /* Task waiting in OSReactorRun(), (OS_TCB *)0 if none    */
+    CPU_DATA             RdyTbl;                            /* Bitmap of the ready sources (see Note #3)              */
+    OS_REACTOR_SRC      *SrcTbl[OS_REACTOR_SRC_NBR_MAX];    /* Sources registered, indexed by ID                      */
+};
+
+
+struct  os_reactor_src {
+    OS_REACTOR          *ReactorPtr;                        /* Reactor the source is registered with                  */
+    OS_PEND_OBJ         *ObjPtr;                            /* Object watched, NULL if made ready by the application  */
+    OS_REACTOR_FNCT      FnctPtr;                           /* Handler called when the source is ready                */
+    void                *FnctArg;                           /* Argument passed to the handler                         */
+    OS_OBJ_QTY           RdyCtr;                            /* Number of events since the last dispatch               */
+    CPU_INT08U           Id;                                /* Bit of the source in '.RdyTbl' of the reactor          */
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS               TS;                                /* Timestamp of the last event                            */
+#endif
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                TASK LATENCY HISTOGRAMS
+*
+* Note(s) : (1) Entry 0 of each table counts the measurements equal to 0 and entry 'n' counts the measurements 'v'
+*               such that 2^(n-1) <= v < 2^n.  The last entry also counts all the larger measurements.  Measurements
+*               are in OS_TS_GET() units.
+*
+*           (2) The mean wake to run latency is 'WakeTotal / WakeNbr'.
+*
+*           (3) OSTaskHistPrioTbl[] holds one OS_TASK_HIST_PRIO per priority level.  A wake to run latency is charged
+*               to the priority the task had when it was switched in.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_TASK_HIST_EN > 0u)
+struct os_task_hist {
+    OS_HIST_CTR          WakeTbl[OS_CFG_TASK_HIST_SIZE];    /* Time from being made ready to being switched in        */
+    OS_HIST_CTR          PendTbl[OS_CFG_TASK_HIST_SIZE];    /* Time spent pending on any kernel object                */
+    CPU_TS               WakeMax;                           /* Longest wake to run latency                            */
+    CPU_INT64U           WakeTotal;                         /* Sum of the wake to run latencies (see Note #2)         */
+    CPU_INT32U           WakeNbr;                           /* Number of wake to run latencies measured               */
+};
+
+#if (OS_CFG_TASK_HIST_PRIO_EN > 0u)
+struct os_task_hist_prio {                                  /* See Note #3                                            */
+    OS_HIST_CTR          WakeTbl[OS_CFG_TASK_HIST_SIZE];    /* Time from being made ready to being switched in        */
+    CPU_TS               WakeMax;                           /* Longest wake to run latency                            */
+    CPU_INT64U           WakeTotal;                         /* Sum of the wake to run latencies (see Note #2)         */
+    CPU_INT32U           WakeNbr;                           /* Number of wake to run latencies measured               */
+};
+#endif
+#endif
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                 STATISTICS SNAPSHOT
+*
+* Note(s) : (1) OSStatSnap is refreshed by the statistic task at the end of each run, so that a debug probe can read the
+*               statistics in a single burst instead of walking the kernel lists.  'SeqCtr' is odd while the snapshot
+*               is being written.  A reader reads 'SeqCtr', the snapshot and 'SeqCtr' again, and starts over if the
+*               two values differ or are odd.
+*
+*           (2) 'Version' changes whenever the layout changes.  The layout also depends on the configuration: 'Size'
+*               and the OSDbg_StatSnapxxx constants give the size of the structures.
+*
+*           (3) Only the first OS_CFG_STAT_SNAP_TASK_NBR tasks and OS_CFG_STAT_SNAP_Q_NBR queues of the debug lists
+*               are recorded.  'TaskQty' and 'QQty' give the number of objects that exist.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_STAT_SNAP_EN > 0u)
+#define  OS_STAT_SNAP_VERSION                 1u
+
+struct os_stat_snap_task {
+    OS_TCB              *TCBPtr;
+    CPU_CHAR            *NamePtr;
+    OS_PRIO              Prio;
+    OS_STATE             TaskState;
+    OS_STATE             PendOn;
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+    OS_CPU_USAGE         CPUUsage;                          /* CPU Usage of task (0.00-100.00%)                       */
+    OS_CPU_USAGE         CPUUsageMax;
+    OS_CTX_SW_CTR        CtxSwCtr;
+#endif
+#if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u)
+    CPU_STK_SIZE         StkFree;                           /* Number of stack elements never used                    */
+    CPU_STK_SIZE         StkUsed;
+#endif
+#if (OS_CFG_TASK_Q_EN > 0u)
+    OS_MSG_QTY           MsgQNbrEntries;                    /* Depth of the task's message queue                      */
+    OS_MSG_QTY           MsgQNbrEntriesMax;
+#endif
+};
+
+#if (OS_CFG_Q_EN > 0u)
+struct os_stat_snap_q {
+    OS_Q                *QPtr;
+    CPU_CHAR            *NamePtr;
+    OS_MSG_QTY           NbrEntriesSize;
+    OS_MSG_QTY           NbrEntries;                        /* Depth of the queue                                     */
+    OS_MSG_QTY           NbrEntriesMax;
+};
+#endif
+
+struct os_stat_snap {
+    CPU_INT16U           Version;                           /* OS_STAT_SNAP_VERSION, see Note #2                      */
+    CPU_INT16U           Size;                              /* sizeof(OS_STAT_SNAP)                                   */
+    CPU_INT32U           SeqCtr;                            /* Odd while being written (see Note #1)                  */
+#if (OS_CFG_TICK_EN > 0u)
+    OS_TICK              TickCtr;                           /* Tick counter when the snapshot was taken               */
+#endif
+    OS_CPU_USAGE         CPUUsage;                          /* CPU Usage in %                                         */
+    OS_CPU_USAGE         CPUUsageMax;
+#if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u) && (OS_CFG_ISR_STK_SIZE > 0u)
+    CPU_INT32U           ISRStkFree;
+#endif
+    OS_OBJ_QTY           TaskQty;                           /* Number of tasks created, see Note #3                   */
+    OS_OBJ_QTY           TaskNbr;                           /* Number of entries of 'TaskTbl[]' in use                */
+    OS_STAT_SNAP_TASK    TaskTbl[OS_CFG_STAT_SNAP_TASK_NBR];
+#if (OS_CFG_Q_EN > 0u)
+    OS_OBJ_QTY           QQty;                              /* Number of queues created                               */
+    OS_OBJ_QTY           QNbr;                              /* Number of entries of 'QTbl[]' in use                   */
+    OS_STAT_SNAP_Q       QTbl[OS_CFG_STAT_SNAP_Q_NBR];
+#endif
+};
+#endif
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                 FREQUENCY GOVERNOR
+*
+* Note(s) : (1) Performance levels go from 0 (slowest, lowest power) to 'LvlMax' (fastest).  The statistic task moves
+*               the level one step up when the CPU usage stays above 'UpThreshold' for 'UpHyst' consecutive runs, and
+*               one step down when it stays below 'DnThreshold' for 'DnHyst' consecutive runs.  The thresholds are in
+*               hundredths of a percent, like OSStatTaskCPUUsage.
+*
+*           (2) 'SetFnct' is called with interrupts disabled to move the CPU to another level.  See OSStatGovSet().
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_STAT_GOV_EN > 0u)
+struct os_stat_gov {
+    OS_STAT_GOV_FNCT     SetFnct;                           /* Switches the CPU to a performance level                */
+    OS_PERF_LVL          LvlMax;                            /* Highest performance level                              */
+    OS_CPU_USAGE         UpThreshold;                       /* CPU usage above which to step up (see Note #1)         */
+    OS_CPU_USAGE         DnThreshold;                       /* CPU usage below which to step down                     */
+    CPU_INT08U           UpHyst;                            /* Consecutive runs above 'UpThreshold' to step up        */
+    CPU_INT08U           DnHyst;                            /* Consecutive runs below 'DnThreshold' to step down      */
+};
+#endif
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                 TASK CONFIGURATION
+*
+* Note(s) : (1) One entry of the table given to OSTaskCreateTbl().  The members are the arguments of OSTaskCreate(),
+*               so the table can be 'const' and live in ROM.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_TASK_CREATE_TBL_EN > 0u)
+struct os_task_cfg {
+    OS_TCB              *TCBPtr;                            /* Pointer to the task's TCB                              */
+    CPU_CHAR            *NamePtr;                           /* Pointer to the task's name                             */
+    OS_TASK_PTR          TaskPtr;                           /* Task entry point                                       */
+    void                *ArgPtr;                            /* Argument passed to the task                            */
+    OS_PRIO              Prio;                              /* Task priority                                          */
+    CPU_STK             *StkBasePtr;                        /* Pointer to the base address of the stack               */
+    CPU_STK_SIZE         StkLimit;                          /* Stack limit, in CPU_STK elements                       */
+    CPU_STK_SIZE         StkSize;                           /* Stack size,  in CPU_STK elements                       */
+    OS_MSG_QTY           QSize;                             /* Size of the task's message queue                       */
+    OS_TICK              TimeQuanta;                        /* Round-robin time slice (0 for the default)             */
+    void                *ExtPtr;                            /* Pointer to the TCB extension                           */
+    OS_OPT               Opt;                               /* Task options (see OS_OPT_TASK_xxx)                     */
+};
+#endif
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                      TASK GROUPS
+*
+* Note(s) : (1) A task group is a set of tasks that are suspended and resumed together by OSTaskGrpSuspend() and
+*               OSTaskGrpResume().  The members are linked through '.GrpNextPtr' and '.GrpPrevPtr' of their OS_TCB.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_TASK_GRP_EN > 0u)
+struct  os_task_grp {                                       /* TASK GROUP                                             */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_TASK_GRP                  */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;
+#endif
+    OS_TCB              *MemberListPtr;                     /* Members, linked through '.GrpNextPtr'                  */
+    OS_OBJ_QTY           NbrMembers;                        /* Number of members                                      */
+};
+#endif
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                      TASK POOLS
+*
+* Note(s) : (1) A task pool is a set of slots, each made of a TCB and a stack, on which short-lived tasks of the same
+*               priority and stack size are run by OSTaskPoolRun().  A slot goes back to the pool when its task is
+*               deleted or returns.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_TASK_POOL_EN > 0u)
+struct  os_task_pool {                                      /* TASK POOL                                              */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_TASK_POOL                 */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;
+#endif
+    OS_TCB              *TCBTbl;                            /* TCBs of the slots                                      */
+    CPU_STK             *StkTbl;                            /* Stacks of the slots, 'StkSize' elements each           */
+    CPU_STK_SIZE         StkSize;                           /* Stack size of the tasks,  in CPU_STK elements          */
+    CPU_STK_SIZE         StkLimit;                          /* Stack limit of the tasks, in CPU_STK elements          */
+    OS_PRIO              Prio;                              /* Priority of the tasks                                  */
+    OS_MSG_QTY           QSize;                             /* Size of the message queue of the tasks                 */
+    OS_OPT               Opt;                               /* Options of the tasks (see OS_OPT_TASK_xxx)             */
+    OS_TCB              *FreeListPtr;                       /* Free slots, linked through 'PoolNextPtr'               */
+    OS_OBJ_QTY           NbrSlots;                          /* Number of slots                                        */
+    OS_OBJ_QTY           NbrFree;                           /* Number of free slots                                   */
+    OS_OBJ_QTY           NbrUsedMax;                        /* Peak number of slots used                              */
+};
+#endif
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                  TASK STACK GROUPS
+*
+* Note(s) : (1) The members of a task stack group run one at a time on a single stack.  A member is dormant when it has
+*               no context on the stack: it is suspended and starts again from its entry point when resumed.  Only one
+*               member of the group may be out of the dormant state at a time.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_TASK_STK_GRP_EN > 0u)
+struct  os_task_stk_grp {                                   /* TASK STACK GROUP                                       */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_TASK_STK_GRP              */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;
+#endif
+    CPU_STK             *StkBasePtr;                        /* Stack shared by the members                            */
+    CPU_STK_SIZE         StkSize;                           /* Size of the stack, in CPU_STK elements                 */
+    CPU_STK_SIZE         StkLimit;                          /* Stack limit of the members, in CPU_STK elements        */
+    OS_TCB              *ActivePtr;                         /* Member owning the stack, NULL if all are dormant       */
+    OS_TCB              *MemberListPtr;                     /* Members, linked through 'StkGrpNextPtr'                */
+    OS_OBJ_QTY           NbrMembers;                        /* Number of members                                      */
+    OS_CTR               NbrStarts;                         /* Number of times a member left the dormant state        */
+};
+#endif
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                 TASK STACK PROFILES
+*
+* Note(s) : (1) The statistic task records, per task entry point, the peak stack usage seen by OSTaskStkChk() and a
+*               recommended stack size: the peak plus OS_CFG_TASK_STK_PROFILE_MARGIN percent (and the red-zone).
+*
+*           (2) The application places the OS_STK_PROFILE_TBL in RAM that is not cleared at reset, so that the peaks
+*               accumulate over resets, and gives it to OSTaskStkProfileInit().  '.Magic' and '.Chksum' tell if the
+*               contents survived.  The table can also be read out (or copied to flash) to size the stacks of the next
+*               build.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_TASK_STK_PROFILE_EN > 0u)
+struct  os_stk_profile {                                    /* STACK PROFILE OF A TASK ENTRY POINT                    */
+    OS_TASK_PTR          TaskEntryAddr;                     /* Entry point of the tasks profiled                      */
+    CPU_STK_SIZE         StkSize;                           /* Stack size of the task when last measured              */
+    CPU_STK_SIZE         StkUsedMax;                        /* Peak number of stack elements used                     */
+    CPU_STK_SIZE         StkSizeRec;                        /* Recommended stack size, in CPU_STK elements            */
+};
+
+struct  os_stk_profile_tbl {                                /* TABLE OF STACK PROFILES (see Note #2)                  */
+    CPU_INT32U           Magic;                             /* OS_STK_PROFILE_MAGIC when the contents are valid       */
+    CPU_INT32U           Chksum;                            /* Checksum of '.Nbr' and of the entries                  */
+    OS_OBJ_QTY           Nbr;                               /* Number of entries used                                 */
+    OS_STK_PROFILE       Tbl[OS_CFG_TASK_STK_PROFILE_SIZE]; /* Entries, in the order the tasks were first seen        */
+};
+#endif
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                  TASK CONTROL BLOCK
+*
+* Note(s) : (1) '.TickMatch' is the value of OSTickWheelCtr (tick wheel) or of OSTickCtr (delta list) at which the delay
+*               or timeout expires, while '.TickRemain' is, with the delta list, relative to the previous task of
+*               the list.
+*
+*           (2) With OS_CFG_TASK_TCB_HOT_FIRST_EN, the fields read and written by the scheduler, the tick processing and
+*               the post/pend paths are grouped right after '.StkPtr': they fit in the first 64-byte cache line of the
+*               TCB on a 32-bit CPU and in the first two on a 64-bit one.  Every OS_TCB is also aligned on
+*               OS_CPU_CACHE_LINE_SIZE when the port defines OS_CPU_CACHE_ALIGN.
+*               The other fields, statistics included, follow in their usual order.  '.StkPtr' stays at offset 0
+*               since the ports' context switch code relies on it.
+*
+*           (3) With OS_CFG_SMALL_MEM_EN, pend lists are only linked forward: '.PendPrevPtr' and the '.TailPtr' of
+*               OS_PEND_LIST are left out and removing a waiter walks the list from its head.  The profile also makes
+*               OS_TICK 16-bit, which limits delays and timeouts to 65535 ticks.  '.TickCtrPrev' is only included when
+*               OS_CFG_TIME_PERIODIC_EN is enabled.  The byte-sized state and priority fields are kept next to each
+*               other so they don't need padding.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_TASK_TCB_HOT_FIRST_EN > 0u)
+#define  OS_TCB_ALIGN               OS_CPU_CACHE_ALIGN
+#else
+#define  OS_TCB_ALIGN
+#endif
+
+struct os_tcb {
+    CPU_STK             *StkPtr;                            /* Pointer to current top of stack                        */
+
+#if (OS_CFG_TASK_TCB_HOT_FIRST_EN == 0u)
+    void                *ExtPtr;                            /* Pointer to user definable data for TCB extension       */
+
+    CPU_STK             *StkLimitPtr;                       /* Pointer used to set stack 'watermark' limit            */
+
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Pointer to task name                                   */
+#endif
+#endif
+
+    OS_TCB              *NextPtr;                           /* Pointer to next     TCB in the TCB list                */
+    OS_TCB              *PrevPtr;                           /* Pointer to previous TCB in the TCB list                */
+
+#if (OS_CFG_TICK_EN > 0u)
+    OS_TCB              *TickNextPtr;
+    OS_TCB              *TickPrevPtr;
+#endif
+
+#if (OS_CFG_TASK_TCB_HOT_FIRST_EN > 0u)                     /* SCHEDULING FIELDS (see Note #2)                        */
+    OS_TCB              *PendNextPtr;                       /* Pointer to next     TCB in pend list.                  */
+#if (OS_CFG_SMALL_MEM_EN == 0u)                             /* See Note #3                                            */
+    OS_TCB              *PendPrevPtr;                       /* Pointer to previous TCB in pend list.                  */
+#endif
+    OS_PEND_OBJ         *PendObjPtr;                        /* Pointer to object pended on.                           */
+    OS_STATE             PendOn;                            /* Indicates what task is pending on                      */
+    OS_STATUS            PendStatus;                        /* Pend status                                            */
+    OS_STATE             TaskState;                         /* See OS_TASK_STATE_xxx                                  */
+    OS_PRIO              Prio;                              /* Task priority (0 == highest)                           */
+#if (OS_CFG_TICK_EN > 0u)
+    OS_TICK              TickRemain;                        /* Number of ticks remaining                              */
+    OS_TICK              TickMatch;                         /* Tick at which the delay expires (see Note #1)          */
+#endif
+    OS_SEM_CTR           SemCtr;                            /* Task specific semaphore counter                        */
+#if (OS_TCB_MSG_EN > 0u)
+    void                *MsgPtr;                            /* Message received                                       */
+    OS_MSG_SIZE          MsgSize;
+#endif
+                                                            /* END OF THE SCHEDULING FIELDS                           */
+    void                *ExtPtr;                            /* Pointer to user definable data for TCB extension       */
+
+    CPU_STK             *StkLimitPtr;                       /* Pointer used to set stack 'watermark' limit            */
+
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Pointer to task name                                   */
+#endif
+#endif
+
+#if ((OS_CFG_DBG_EN > 0u) || (OS_CFG_STAT_TASK_STK_CHK_EN > 0u) || (OS_CFG_TASK_STK_REDZONE_EN > 0u))
+    CPU_STK             *StkBasePtr;                        /* Pointer to base address of stack                       */
+#endif
+
+#if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
+    OS_TLS               TLS_Tbl[OS_CFG_TLS_TBL_SIZE];
+#endif
+
+#if (OS_CFG_DBG_EN > 0u)
+    OS_TASK_PTR          TaskEntryAddr;                     /* Pointer to task entry point address                    */
+    void                *TaskEntryArg;                      /* Argument passed to task when it was created            */
+#endif
+
+#if (OS_CFG_TASK_TCB_HOT_FIRST_EN == 0u)
+    OS_TCB              *PendNextPtr;                       /* Pointer to next     TCB in pend list.                  */
+#if (OS_CFG_SMALL_MEM_EN == 0u)                             /* See Note #3                                            */
+    OS_TCB              *PendPrevPtr;                       /* Pointer to previous TCB in pend list.                  */
+#endif
+    OS_PEND_OBJ         *PendObjPtr;                        /* Pointer to object pended on.                           */
+#endif
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+    OS_PEND_DATA        *PendDataTblPtr;                    /* Objects waited on by OSPendMulti()                     */
+    OS_OBJ_QTY           PendDataTblEntries;
+#endif
+#if (OS_CFG_PEND_LIST_BITMAP_EN > 0u)
+    OS_PRIO              PendPrio;                          /* Priority under which the task was placed in pend list  */
+#endif
+#if (OS_CFG_TASK_TCB_HOT_FIRST_EN == 0u)
+    OS_STATE             PendOn;                            /* Indicates what task is pending on                      */
+    OS_STATUS            PendStatus;                        /* Pend status                                            */
+
+    OS_STATE             TaskState;                         /* See OS_TASK_STATE_xxx                                  */
+    OS_PRIO              Prio;                              /* Task priority (0 == highest)                           */
+#endif
+#if (OS_CFG_MUTEX_EN > 0u)
+    OS_PRIO              BasePrio;                          /* Base priority (Not inherited)                          */
+#endif
+#if (OS_CFG_TASK_SUSPEND_EN > 0u)
+    OS_NESTING_CTR       SuspendCtr;                        /* Nesting counter for OSTaskSuspend()                    */
+#endif
+#if (OS_CFG_MUTEX_EN > 0u)
+    OS_MUTEX            *MutexGrpHeadPtr;                   /* Owned mutex group head pointer                         */
+#endif
+#if (OS_CFG_RWLOCK_EN > 0u)
+    OS_RWLOCK_HOLD       RwLockHoldTbl[OS_CFG_RWLOCK_HOLD_MAX];
+    CPU_INT08U           RwLockHoldCtr;                     /* Number of reader/writer locks held by the task         */
+#endif
+
+#if ((OS_CFG_DBG_EN > 0u) || (OS_CFG_STAT_TASK_STK_CHK_EN > 0u) || (OS_CFG_TASK_STK_REDZONE_EN > 0u))
+    CPU_STK_SIZE         StkSize;                           /* Size of task stack (in number of stack elements)       */
+#endif
+    OS_OPT               Opt;                               /* Task options as passed by OSTaskCreate()               */
+
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS               TS;                                /* Timestamp                                              */
+#endif
+#if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN > 0u))
+    CPU_INT16U           SemID;                             /* Unique ID for third-party debuggers and tracers.       */
+#endif
+#if (OS_CFG_TASK_TCB_HOT_FIRST_EN == 0u)
+    OS_SEM_CTR           SemCtr;                            /* Task specific semaphore counter                        */
+#endif
+#if (OS_CFG_SEM_EN > 0u) && (OS_CFG_SEM_PEND_N_EN > 0u)
+    OS_SEM_CTR           SemPendCnt;                        /* Number of units waited for in OSSemPendN()             */
+#endif
+
+                                                            /* DELAY / TIMEOUT                                        */
+#if (OS_CFG_TICK_EN > 0u)
+#if (OS_CFG_TASK_TCB_HOT_FIRST_EN == 0u)
+    OS_TICK              TickRemain;                        /* Number of ticks remaining                              */
+#endif
+#if (OS_CFG_TIME_PERIODIC_EN > 0u)
+    OS_TICK              TickCtrPrev;                       /* Used by OSTimeDlyXX() in PERIODIC mode                 */
+#endif
+#if (OS_CFG_TASK_TCB_HOT_FIRST_EN == 0u)
+    OS_TICK              TickMatch;                         /* Tick at which the delay expires (see Note #1)          */
+#endif
+#if (OS_CFG_SLACK_EN > 0u)
+    OS_TICK              TickSlack;                         /* Ticks a delay may be postponed to share a wake-up      */
+#endif
+#if (OS_CFG_TIME_HR_EN > 0u)
+    CPU_TS               TickHrDly;                         /* High-resolution timeout in OS_TS_GET() units, 0 if none*/
+    CPU_TS               TickHrMatch;                       /* Value of OS_TS_GET() at which the timeout expires      */
+#endif
+#if (OS_CFG_TIME_ABS_EN > 0u)
+    CPU_BOOLEAN          TickAbs;                           /* OS_TaskBlock() takes the timeout as a deadline         */
+#endif
+#endif
+
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
+    OS_TICK              TimeQuanta;
+    OS_TICK              TimeQuantaCtr;
+#if (OS_CFG_SCHED_ROUND_ROBIN_TS_EN > 0u)
+    CPU_TS               TimeQuantaTS;                      /* Time slice left in OS_TS_GET() units, 0 for a full one */
+#endif
+#endif
+
+#if (OS_TCB_MSG_EN > 0u) && (OS_CFG_TASK_TCB_HOT_FIRST_EN == 0u)
+    void                *MsgPtr;                            /* Message received                                       */
+    OS_MSG_SIZE          MsgSize;
+#endif
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+    OS_OPT               QPostOpt;                          /* Options of the message OSQPostWait() waits to queue    */
+#endif
+#if (OS_CFG_Q_PEND_MATCH_EN > 0u)
+    OS_Q_MATCH_FNCT      QMatchFnct;                        /* Messages accepted by OSQPendMatch() (see OS_Q Note #3) */
+    void                *QMatchArg;
+#endif
+
+#if (OS_CFG_TASK_Q_EN > 0u)
+    OS_MSG_Q             MsgQ;                              /* Message queue associated with task                     */
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+    CPU_TS               MsgQPendTime;                      /* Time it took for signal to be received                 */
+    CPU_TS               MsgQPendTimeMax;                   /* Max amount of time it took for signal to be received   */
+#endif
+#endif
+
+#if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
+    OS_REG               RegTbl[OS_CFG_TASK_REG_TBL_SIZE];  /* Task specific registers                                */
+#endif
+
+#if (OS_CFG_TASK_NOTIFY_EN > 0u)
+    OS_NOTIFY            NotifyValTbl[OS_CFG_TASK_NOTIFY_SLOTS];  /* Value of each notification slot                  */
+    CPU_BOOLEAN          NotifyPendTbl[OS_CFG_TASK_NOTIFY_SLOTS]; /* Slot notified since it was last consumed         */
+    OS_NOTIFY_ID         NotifyWaitId;                      /* Slot waited for by OSTaskNotifyWait()                  */
+#endif
+
+#if (OS_CFG_RCU_EN > 0u)
+    OS_RCU_GP            RcuGp;                             /* Grace period end waited for in OSRcuSync()             */
+#endif
+
+#if (OS_CFG_CALL_EN > 0u)
+    OS_TCB              *CallClientPtr;                     /* Client whose call the task is serving, NULL if none    */
+    OS_TCB              *CallSrvPtr;                        /* Server handling the call of the task, NULL if none     */
+#endif
+
+#if (OS_CFG_FLAG_EN > 0u)
+    OS_FLAGS             FlagsPend;                         /* Event flag(s) to wait on                               */
+    OS_FLAGS             FlagsRdy;                          /* Event flags that made task ready to run                */
+    OS_OPT               FlagsOpt;                          /* Options (See OS_OPT_FLAG_xxx)                          */
+#if (OS_CFG_FLAG_WAIT_IDX_EN > 0u)
+    OS_TCB              *FlagIdxNextPtr;                    /* Links in the waiter index of the event flag group      */
+    OS_TCB              *FlagIdxPrevPtr;
+    CPU_INT08U           FlagIdx;                           /* Entry in '.IdxTbl[]' or OS_FLAG_IDX_NONE               */
+#endif
+#endif
+
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+    OS_CPU_USAGE         CPUUsage;                          /* CPU Usage of task (0.00-100.00%)                       */
+    OS_CPU_USAGE         CPUUsageMax;                       /* CPU Usage of task (0.00-100.00%) - Peak                */
+    OS_CTX_SW_CTR        CtxSwCtr;                          /* Number of time the task was switched in                */
+    CPU_TS               CyclesDelta;                       /* value of OS_TS_GET() - .CyclesStart                    */
+    CPU_TS               CyclesStart;                       /* Snapshot of cycle counter at start of task resumption  */
+    OS_CYCLES            CyclesTotal;                       /* Total number of # of cycles the task has been running  */
+    OS_CYCLES            CyclesTotalPrev;                   /* Snapshot of previous # of cycles                       */
+
+    CPU_TS               SemPendTime;                       /* Time it took for signal to be received                 */
+    CPU_TS               SemPendTimeMax;                    /* Max amount of time it took for signal to be received   */
+#if (OS_CFG_STAT_TASK_BUDGET > 0u)
+    CPU_TS               CyclesStatStart;                   /* Timestamp of the last CPU usage computation            */
+#endif
+#endif
+
+#if (OS_CFG_TASK_PERF_CTR_EN > 0u)
+    CPU_INT32U           PerfCtrStart[OS_CPU_PERF_CTR_NBR]; /* Snapshot of the port's event counters at resumption    */
+    CPU_INT64U           PerfCtrTotal[OS_CPU_PERF_CTR_NBR]; /* Events counted while the task was running              */
+#endif
+
+#if (OS_CFG_TASK_HIST_EN > 0u)
+    CPU_TS               HistPendStart;                     /* Timestamp of the start of the current pend             */
+    CPU_TS               HistRdyStart;                      /* Timestamp of when the task was made ready              */
+    CPU_INT08U           HistFlags;                         /* Measurements in progress, see OS_TASK_HIST_FLAG_xxx    */
+    OS_TASK_HIST         Hist;                              /* Wake to run latency and pend duration histograms       */
+#endif
+
+#if (OS_CFG_TASK_GRP_EN > 0u)
+    OS_TASK_GRP         *GrpPtr;                            /* Task group of the task, NULL if none                   */
+    OS_TCB              *GrpNextPtr;                        /* Links in the member list of the group                  */
+    OS_TCB              *GrpPrevPtr;
+#endif
+
+#if (OS_CFG_TASK_POOL_EN > 0u)
+    OS_TASK_POOL        *PoolPtr;                           /* Pool the task runs from, NULL if none                  */
+    OS_TCB              *PoolNextPtr;                       /* Next free slot of the pool                             */
+#endif
+
+#if (OS_CFG_TASK_STK_GRP_EN > 0u)
+    OS_TASK_STK_GRP     *StkGrpPtr;                         /* Stack group of the task, NULL if none                  */
+    OS_TCB              *StkGrpNextPtr;                     /* Next member of the stack group                         */
+    OS_TASK_PTR          StkGrpTask;                        /* Entry point the member starts from                     */
+    void                *StkGrpArg;                         /* Argument passed to the entry point                     */
+    CPU_BOOLEAN          StkGrpDormant;                     /* The member has no context on the stack                 */
+#endif
+
+#if (OS_CFG_TASK_STK_FIT_EN > 0u)
+    CPU_STK             *StkFitPtr;                         /* Stack allocated by OSTaskCreate(), NULL if none        */
+#endif
+
+#if (OS_CFG_HEAP_EN > 0u)
+    OS_HEAP_BLK         *HeapBlkListPtr;                    /* Heap blocks owned by the task                          */
+    CPU_SIZE_T           HeapSizeUsed;                      /* Bytes of heap owned by the task                        */
+    CPU_SIZE_T           HeapSizeUsedMax;                   /* Peak number of bytes of heap owned by the task         */
+#endif
+
+#if (OS_CFG_MEM_QUOTA_EN > 0u)
+    OS_MEM_QUOTA        *MemQuotaListPtr;                   /* Quotas of the task on memory partitions                */
+#endif
+
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+    CPU_TS               BudgetCycles;                      /* CPU time allowed per period, 0 if no budget            */
+    CPU_TS               BudgetUsed;                        /* CPU time used in the current period                    */
+    CPU_TS               BudgetStart;                       /* Timestamp of when the task was switched in             */
+    OS_TICK              BudgetPeriod;                      /* Replenishment period, in ticks                         */
+    OS_TICK              BudgetReplenish;                   /* Value of OSTickCtr at the next replenishment           */
+    OS_OPT               BudgetOpt;                         /* What to do when exhausted (OS_OPT_TASK_BUDGET_xxx)     */
+    OS_PRIO              BudgetPrio;                        /* Base priority to restore after a demotion              */
+    CPU_BOOLEAN          BudgetExhausted;                   /* Budget exhausted until the next replenishment          */
+    OS_TCB              *BudgetNextPtr;                     /* Links in the list of tasks with a budget               */
+    OS_TCB              *BudgetPrevPtr;
+#endif
+
+#if (OS_CFG_STAT_GOV_EN > 0u)
+    OS_PERF_LVL          PerfLvlMin;                        /* Performance level requested while the task runs        */
+#endif
+
+#if (OS_TASK_PERIOD_EN > 0u)
+    OS_TICK              Period;                            /* Period set by OSTaskPeriodSet(), 0 if none             */
+    OS_TICK              PeriodRelease;                     /* Tick of the current release                            */
+    OS_OPT               PeriodOpt;                         /* Overrun policy (OS_OPT_TASK_PERIOD_xxx)                */
+    OS_CTR               PeriodOvrCtr;                      /* Number of releases skipped or started late             */
+    OS_TICK              PeriodJitter;                      /* Ticks between the last release and the task running    */
+    OS_TICK              PeriodJitterMax;                   /* Peak release jitter                                    */
+#if (OS_CFG_STAT_TASK_EN > 0u)
+    OS_CTR               PeriodOvrCtrStat;                  /* '.PeriodOvrCtr' when seen last by the statistic task   */
+#endif
+#if (OS_CFG_STAT_SCHED_EN > 0u)
+    OS_CYCLES            SchedJobStart;                     /* '.CyclesTotal' when the current job started            */
+    OS_CYCLES            SchedWCET;                         /* Longest job measured, in OS_TS_GET() units             */
+    OS_CYCLES            SchedResp;                         /* Worst-case response time from the analysis             */
+#endif
+#endif
+
+#if (OS_CFG_TASK_EDF_EN > 0u)
+    OS_TICK              EDFDeadline;                       /* Absolute deadline, in OSTickCtr units                  */
+#endif
+
+#if (OS_CFG_TASK_FAIR_EN > 0u)
+    CPU_TS               FairVRuntime;                      /* CPU time used, scaled by the weight of the task        */
+    CPU_TS               FairStart;                         /* OS_TS_GET() when the time was last charged             */
+    CPU_INT16U           FairWeight;                        /* Share of the fair-share level, see OSTaskFairSet()     */
+#endif
+
+#if (OS_CFG_TASK_STK_CLR_DEFER_EN > 0u)
+    CPU_STK             *StkClrPtr;                         /* Next stack element to clear, NULL when cleared         */
+    OS_TCB              *StkClrNextPtr;                     /* Next task in the list of stacks to clear               */
+#endif
+
+#if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u)
+    CPU_STK_SIZE         StkUsed;                           /* Number of stack elements used from the stack           */
+    CPU_STK_SIZE         StkFree;                           /* Number of stack elements free on   the stack           */
+#if (OS_CFG_STAT_TASK_STK_CHK_INCR_EN > 0u)
+    CPU_STK_SIZE         StkChkFree;                        /* Free elements found by the last completed scan         */
+    CPU_STK_SIZE         StkChkIx;                          /* Elements verified free so far by the current scan      */
+#endif
+#endif
+
+#ifdef CPU_CFG_INT_DIS_MEAS_EN
+    CPU_TS               IntDisTimeMax;                     /* Maximum interrupt disable time                         */
+#endif
+#if (OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u)
+    CPU_TS               SchedLockTimeMax;                  /* Maximum scheduler lock time                            */
+#endif
+
+#if (OS_CFG_DBG_EN > 0u)
+    OS_TCB              *DbgPrevPtr;
+    OS_TCB              *DbgNextPtr;
+    CPU_CHAR            *DbgNamePtr;
+#endif
+#if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN > 0u))
+    CPU_INT16U           TaskID;                            /* Unique ID for third-party debuggers and tracers.       */
+#endif
+} OS_TCB_ALIGN;
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                    TICK DATA TYPE
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_tick_list {
+    OS_TCB              *TCB_Ptr;                           /* Pointer to list of tasks in tick list                 */
+#if (OS_CFG_DBG_EN > 0u)
+    OS_OBJ_QTY           NbrEntries;                        /* Current number of entries in the tick list            */
+    OS_OBJ_QTY           NbrUpdated;                        /* Number of entries updated                             */
+#endif
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                   TIMER DATA TYPES
+*
+* Note(s) : (1) With OS_CFG_TMR_CMD_Q_EN, OSTmrStart(), OSTmrStop() and OSTmrSet() called by anything but the timer
+*               task of the timer's service record an OS_TMR_CMD in '.CmdQ' of the service instead of locking its
+*               mutex.  The timer task replays the commands in order each time it wakes up.
+*
+*           (2) '.CmdQ' is a multiple producer, single consumer ring.  A producer reserves slot 'CmdQInIx' by advancing
+*               the index (with the port's exclusive load/store primitives when OS_TMR_CMD_LOCK_FREE_EN is enabled,
+*               with interrupts disabled otherwise), fills it and publishes it by setting '.Seq' to 'CmdQInIx + 1'.
+*               The timer task hands the slot back by setting '.Seq' to 'CmdQOutIx + OS_CFG_TMR_CMD_Q_SIZE'.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_tmr {
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Name to give the timer                                 */
+#endif
+    OS_TMR_CALLBACK_PTR  CallbackPtr;                       /* Function to call when timer expires                    */
+    void                *CallbackPtrArg;                    /* Argument to pass to function when timer expires        */
+    OS_TMR              *NextPtr;                           /* Double link list pointers                              */
+    OS_TMR              *PrevPtr;
+    OS_TICK              Remain;                            /* Amount of time remaining before timer expires          */
+    OS_TICK              Match;                             /* Value of the tick counter at which the timer expires   */
+#if (OS_CFG_SLACK_EN > 0u)
+    OS_TICK              Slack;                             /* Ticks expiry may be postponed to share a wake-up       */
+#endif
+    OS_TICK              Dly;                               /* Delay before start of repeat                           */
+    OS_TICK              Period;                            /* Period to repeat timer                                 */
+    OS_OPT               Opt;                               /* Options (see OS_OPT_TMR_xxx)                           */
+    OS_STATE             State;
+#if (OS_CFG_TMR_SVC_EN > 0u)
+    OS_TMR_SVC          *SvcPtr;                            /* Timer service running the callback                     */
+#endif
+#if (OS_CFG_TICK_RATE_SET_EN > 0u)
+    OS_TICK              Mult;                              /* OSTmrToTicksMult '.Dly', '.Period', '.Slack' are at    */
+#endif
+#if (OS_CFG_TMR_ISR_EN > 0u)
+    CPU_BOOLEAN          IsrMode;                           /* Expires in the compare ISR (see OS_OPT_TMR_ISR)        */
+    CPU_TS               TsDly;                             /* ISR timer delay  in OS_TS_GET() units                  */
+    CPU_TS               TsPeriod;                          /* ISR timer period in OS_TS_GET() units                  */
+    CPU_TS               TsMatch;                           /* Value of OS_TS_GET() at which the ISR timer expires    */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    OS_TMR              *DbgPrevPtr;
+    OS_TMR              *DbgNextPtr;
+#endif
+};
+
+
+struct  os_tmr_cmd {                                        /* Command queued to a timer task (see Note #1)           */
+    CPU_DATA             Seq;                               /* Slot state (see Note #2)                               */
+    OS_TMR              *TmrPtr;                            /* Timer the command applies to                           */
+    CPU_INT08U           Cmd;                               /* Start, stop or set                                     */
+    OS_OPT               Opt;                               /* Option given to OSTmrStop()                            */
+    OS_TICK              Dly;                               /* Arguments given to OSTmrSet()                          */
+    OS_TICK              Period;
+    OS_TMR_CALLBACK_PTR  CallbackPtr;
+    void                *CallbackPtrArg;                    /* Callback argument of OSTmrSet() or OSTmrStop()         */
+};
+
+
+struct  os_tmr_svc {                                        /* Timer task with its own timer list and lock            */
+    OS_TCB              *TaskTCBPtr;                        /* TCB of the task running the callbacks                  */
+#if (OS_CFG_TICK_RATE_SET_EN > 0u)
+    OS_TMR_SVC          *NextPtr;                           /* Next service created, see OSTmrSvcListPtr              */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;
+    OS_OBJ_QTY           ListEntries;                       /* Number of timers linked to the list or wheel           */
+#endif
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+    OS_TMR              *Wheel[OS_CFG_TMR_WHEEL_SIZE];      /* Spokes of the timer wheel                              */
+    CPU_DATA             WheelMap[OS_TMR_WHEEL_MAP_SIZE];   /* Bitmap of non-empty spokes                             */
+    OS_TICK              TaskTimeout;                       /* Ticks from tick base to timer task wake-up             */
+#else
+    OS_TMR              *ListPtr;                           /* Delta list of running timers                           */
+#endif
+    OS_TICK              TaskTickBase;                      /* Tick to which timer delays are relative                */
+    OS_COND              Cond;                              /* Signaled when the timer task must reload its timeout   */
+    OS_MUTEX             Mutex;                             /* Protects the timers of the service                     */
+#if (OS_CFG_TMR_CMD_Q_EN > 0u)
+    OS_TMR_CMD  volatile CmdQ[OS_CFG_TMR_CMD_Q_SIZE];       /* Commands waiting for the timer task (see Note #2)      */
+    CPU_DATA    volatile CmdQInIx;                          /* Next slot to reserve                                   */
+    CPU_DATA             CmdQOutIx;                         /* Next slot to replay                                    */
+#endif
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS               TaskTime;
+    CPU_TS               TaskTimeMax;
+#endif
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                      WORK QUEUES
+*
+* Note(s) : (1) A work queue runs jobs on a fixed set of worker tasks.  Waiting jobs are kept on one list per job
+*               priority (0 is the highest) and are run in submission order within a priority.
+*
+*           (2) An OS_WORK is meant to be embedded in the caller's structures, so no memory is allocated to submit it.
+*
+*           (3) A job posted with OSWorkPost() while it is waiting is run once more per post, after the other jobs of
+*               its priority.  With a single worker, the jobs of a work queue behave as run-to-completion tasks that
+*               share the worker's stack and never preempt one another.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_WORKQ_EN > 0u)
+struct  os_work {                                           /* JOB                                                    */
+    OS_WORK             *NextPtr;                           /* Doubly linked list of the jobs of a priority           */
+    OS_WORK             *PrevPtr;
+    OS_WORKQ            *WorkQPtr;                          /* Work queue the job was submitted to                    */
+    OS_WORK_FNCT         FnctPtr;                           /* Function run by the worker                             */
+    void                *ArgPtr;                            /* Argument passed to 'FnctPtr'                           */
+    CPU_INT08U           Prio;                              /* Job priority, 0 is the highest                         */
+    OS_STATE             State;                             /* See OS_WORK_STATE_xxx                                  */
+    OS_OBJ_QTY           ActCtr;                            /* Runs owed to the job while waiting (see Note #3)       */
+#if (OS_CFG_TMR_EN > 0u)
+    OS_TMR               Tmr;                               /* Timer of OSWorkSubmitDly()                             */
+#endif
+};
+
+
+struct  os_workq {                                          /* WORK QUEUE                                             */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_WORKQ                     */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;
+#endif
+    OS_SEM               Sem;                               /* Wakes up one worker per submitted job                  */
+    OS_WORK             *HeadPtr[OS_CFG_WORKQ_PRIO_NBR];    /* Waiting jobs, per job priority                         */
+    OS_WORK             *TailPtr[OS_CFG_WORKQ_PRIO_NBR];
+    OS_TCB              *TCBTbl;                            /* TCBs of the workers                                    */
+    OS_OBJ_QTY           NbrWorkers;                        /* Number of workers                                      */
+    OS_OBJ_QTY           NbrPend;                           /* Number of waiting jobs                                 */
+    OS_OBJ_QTY           NbrPendMax;                        /* Peak number of waiting jobs                            */
+};
+#endif
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                  SOFTWARE WATCHDOG
+*
+* Note(s) : (1) A task registers with a deadline and gets an ID, the bit ID - 1 of OSWdogMap[].  To check in, the task
+*               sets its bit with a single atomic OR, without a lock or a critical section.
+*
+*           (2) Once per period, the watchdog timer takes the whole of OSWdogMap[] with one exchange per CPU_DATA.  The
+*               entries whose bit was set start a new interval, the others add the period to '.Elapsed' and the hook
+*               names the task once '.Elapsed' reaches '.Deadline'.  The hook is called once per missed deadline.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_WDOG_EN > 0u)
+struct  os_wdog {
+    OS_TCB              *TCBPtr;                            /* Supervised task, NULL if the entry is free             */
+    OS_TICK              Deadline;                          /* Longest interval between check-ins (timer ticks)       */
+    OS_TICK              Elapsed;                           /* Time since the last check-in seen (timer ticks)        */
+    CPU_BOOLEAN          Expired;                           /* Hook called, cleared by the next check-in              */
+};
+#endif
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                             THREADED INTERRUPT HANDLERS
+*
+* Note(s) : (1) OSIntThreadTbl[] gives the handler attached to each interrupt number.  OSIntThreadISR() runs the top
+*               half in interrupt context and counts the interrupt in 'PendCtr'.  The handler task is posted only when
+*               the count leaves 0 and passes the whole count to the handler when it runs.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_INT_THREAD_EN > 0u)
+struct  os_int_thread {                                     /* THREADED INTERRUPT HANDLER                             */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_INT_THREAD                */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;
+#endif
+    OS_TCB               TCB;                               /* Handler task                                           */
+    OS_INT_THREAD_TOP_FNCT TopFnct;                         /* Top half, (OS_INT_THREAD_TOP_FNCT)0 if none            */
+    OS_INT_THREAD_FNCT   HandlerFnct;                       /* Run by the handler task                                */
+    void                *ArgPtr;                            /* Argument passed to 'TopFnct' and 'HandlerFnct'         */
+    OS_CTR      volatile PendCtr;                           /* Interrupts not yet handled (see Note #1)               */
+    CPU_INT16U           Irq;                               /* Interrupt number                                       */
+};
+#endif
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                           STATICALLY DEFINED KERNEL OBJECTS
+*
+* Note(s) : (1) OS_SEM_DEFINE(), OS_MUTEX_DEFINE(), OS_FLAG_GRP_DEFINE() and OS_Q_DEFINE() define a kernel object that
+*               is initialized at compile time.  The object sits in initialized data and can be used without calling
+*               OSxxxCreate(), e.g.:
+*
+*                   static  OS_SEM_DEFINE(AppSem, "App Sem", 0u);
+*
+*           (2) A statically defined object is not on the debug list of its type and is not counted in OSxxxQty.  It
+*               MUST NOT be deleted.  When OS_CFG_OBJ_CREATED_CHK_EN is enabled, OSxxxCreate() returns
+*               OS_ERR_OBJ_CREATED for such an object.
+*
+*           (3) '.Type' is valid from reset, so an application whose objects are all statically defined can disable
+*               OS_CFG_OBJ_TYPE_CHK_EN and OS_CFG_OBJ_CREATED_CHK_EN to remove those checks from every service call.
+*
+*           (4) The initializers are positional so that they also compile as C89.  The OS_OBJ_INIT_xxx() macros
+*               expand to nothing for the members that the configuration leaves out.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_OBJ_TYPE_REQ > 0u)
+#define  OS_OBJ_INIT_TYPE(type)             (type),
+#else
+#define  OS_OBJ_INIT_TYPE(type)
+#endif
+
+#if (OS_CFG_DBG_EN > 0u)
+#define  OS_OBJ_INIT_NAME(p_name)           (CPU_CHAR *)(p_name),
+#define  OS_OBJ_INIT_DBG_LIST()             0, 0, (CPU_CHAR *)" ",
+#define  OS_OBJ_INIT_NBR_MAX()              0u,
+#else
+#define  OS_OBJ_INIT_NAME(p_name)
+#define  OS_OBJ_INIT_DBG_LIST()
+#define  OS_OBJ_INIT_NBR_MAX()
+#endif
+
+#if (OS_CFG_TS_EN > 0u)
+#define  OS_OBJ_INIT_TS()                   0u,
+#else
+#define  OS_OBJ_INIT_TS()
+#endif
+
+#if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN > 0u))
+#define  OS_OBJ_INIT_TRACE_ID()             0u,
+#else
+#define  OS_OBJ_INIT_TRACE_ID()
+#endif
+
+#if (OS_CFG_FLAG_WAIT_IDX_EN > 0u)
+#define  OS_OBJ_INIT_FLAG_IDX_TBL()         { 0 },
+#else
+#define  OS_OBJ_INIT_FLAG_IDX_TBL()
+#endif
+
+#if (OS_MUTEX_FAST_EN > 0u)
+#define  OS_OBJ_INIT_MUTEX_GRP_LINKED()     OS_FALSE,
+#else
+#define  OS_OBJ_INIT_MUTEX_GRP_LINKED()
+#endif
+
+#if (OS_CFG_MUTEX_CEILING_EN > 0u)
+#define  OS_OBJ_INIT_MUTEX_CEILING()        OS_PRIO_INIT,
+#else
+#define  OS_OBJ_INIT_MUTEX_CEILING()
+#endif
+
+#if (OS_CFG_MUTEX_THROUGHPUT_EN > 0u)
+#define  OS_OBJ_INIT_MUTEX_THROUGHPUT()     OS_FALSE,
+#else
+#define  OS_OBJ_INIT_MUTEX_THROUGHPUT()
+#endif
+
+#if (OS_CFG_MUTEX_BLOCK_STAT_EN > 0u)
+#define  OS_OBJ_INIT_MUTEX_BLOCK_STAT()     0u, 0u, 0u, 0u, 0u,
+#else
+#define  OS_OBJ_INIT_MUTEX_BLOCK_STAT()
+#endif
+
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+#define  OS_OBJ_INIT_Q_SPACE(p_name)        { OS_OBJ_INIT_TYPE(OS_OBJ_TYPE_Q) OS_OBJ_INIT_NAME(p_name) { 0 }, OS_OBJ_INIT_DBG_LIST() },
+#else
+#define  OS_OBJ_INIT_Q_SPACE(p_name)
+#endif
+
+#if (OS_CFG_Q_PRIV_POOL_EN > 0u)
+#define  OS_OBJ_INIT_MSG_POOL_PTR()         &OSMsgPool,
+#define  OS_OBJ_INIT_MSG_POOL()             { 0 },
+#else
+#define  OS_OBJ_INIT_MSG_POOL_PTR()
+#define  OS_OBJ_INIT_MSG_POOL()
+#endif
+
+
+#if (OS_CFG_FLAG_EN > 0u)
+#define  OS_FLAG_GRP_DEFINE(grp, p_name, flags)                                                       \
+         OS_FLAG_GRP  grp = { OS_OBJ_INIT_TYPE(OS_OBJ_TYPE_FLAG)                                      \
+                              OS_OBJ_INIT_NAME(p_name)                                                \
+                              { 0 },                                                                  \
+                              OS_OBJ_INIT_DBG_LIST()                                                  \
+                              (OS_FLAGS)(flags),                                                      \
+                              OS_OBJ_INIT_TS()                                                        \
+                              OS_OBJ_INIT_FLAG_IDX_TBL()                                              \
+                              OS_OBJ_INIT_TRACE_ID() }
+#endif
+
+#if (OS_CFG_MUTEX_EN > 0u)
+#define  OS_MUTEX_DEFINE(mutex, p_name)                                                               \
+         OS_MUTEX  mutex = { OS_OBJ_INIT_TYPE(OS_OBJ_TYPE_MUTEX)                                      \
+                             OS_OBJ_INIT_NAME(p_name)                                                 \
+                             { 0 },                                                                   \
+                             OS_OBJ_INIT_DBG_LIST()                                                   \
+                             (OS_MUTEX *)0,                                                           \
+                             (OS_TCB   *)0,                                                           \
+                             OS_OBJ_INIT_MUTEX_GRP_LINKED()                                           \
+                             0u,                                                                      \
+                             OS_OBJ_INIT_MUTEX_CEILING()                                              \
+                             OS_OBJ_INIT_MUTEX_THROUGHPUT()                                           \
+                             OS_OBJ_INIT_TS()                                                         \
+                             OS_OBJ_INIT_MUTEX_BLOCK_STAT()                                           \
+                             OS_OBJ_INIT_TRACE_ID() }
+#endif
+
+#if (OS_CFG_Q_EN > 0u)
+#define  OS_Q_DEFINE(q, p_name, max_qty)                                                              \
+         OS_Q  q = { OS_OBJ_INIT_TYPE(OS_OBJ_TYPE_Q)                                                  \
+                     OS_OBJ_INIT_NAME(p_name)                                                         \
+                     { 0 },                                                                           \
+                     OS_OBJ_INIT_DBG_LIST()                                                           \
+                     { (OS_MSG *)0,                                                                   \
+                       (OS_MSG *)0,                                                                   \
+                       (OS_MSG_QTY)(max_qty),                                                         \
+                       0u,                                                                            \
+                       OS_OBJ_INIT_NBR_MAX()                                                          \
+                       OS_OBJ_INIT_MSG_POOL_PTR()                                                     \
+                       OS_OBJ_INIT_TRACE_ID() },                                                      \
+                     OS_OBJ_INIT_MSG_POOL()                                                           \
+                     OS_OBJ_INIT_Q_SPACE(p_name) }
+#endif
+
+#if (OS_CFG_SEM_EN > 0u)
+#define  OS_SEM_DEFINE(sem, p_name, cnt)                                                              \
+         OS_SEM  sem = { OS_OBJ_INIT_TYPE(OS_OBJ_TYPE_SEM)                                            \
+                         OS_OBJ_INIT_NAME(p_name)                                                     \
+                         { 0 },                                                                       \
+                         OS_OBJ_INIT_DBG_LIST()                                                       \
+                         (OS_SEM_CTR)(cnt),                                                           \
+                         OS_OBJ_INIT_TS()                                                             \
+                         OS_OBJ_INIT_TRACE_ID() }
+#endif
+
+
+/*
+************************************************************************************************************************
+************************************************************************************************************************
+*                                           G L O B A L   V A R I A B L E S
+************************************************************************************************************************
+************************************************************************************************************************
+*/
+                                                                        /* APPLICATION HOOKS ------------------------ */
+#if (OS_CFG_APP_HOOKS_EN > 0u)
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+OS_EXT           OS_APP_HOOK_TCB            OS_AppRedzoneHitHookPtr;
+#endif
+OS_EXT           OS_APP_HOOK_TCB            OS_AppTaskCreateHookPtr;
+OS_EXT           OS_APP_HOOK_TCB            OS_AppTaskDelHookPtr;
+OS_EXT           OS_APP_HOOK_TCB            OS_AppTaskReturnHookPtr;
+
+OS_EXT           OS_APP_HOOK_VOID           OS_AppIdleTaskHookPtr;
+OS_EXT           OS_APP_HOOK_VOID           OS_AppStatTaskHookPtr;
+OS_EXT           OS_APP_HOOK_VOID           OS_AppTaskSwHookPtr;
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+OS_EXT           OS_APP_HOOK_TCB            OS_AppTaskBudgetHookPtr;
+#endif
+#if (OS_CFG_STAT_SCHED_EN > 0u)
+OS_EXT           OS_APP_HOOK_TCB            OS_AppStatSchedHookPtr;
+#endif
+OS_EXT           OS_APP_HOOK_VOID           OS_AppTimeTickHookPtr;
+#endif
+
+                                                                        /* IDLE TASK -------------------------------- */
+#if (OS_CFG_DBG_EN > 0u)
+OS_EXT            OS_IDLE_CTR               OSIdleTaskCtr;
+#endif
+#if (OS_CFG_TASK_IDLE_EN > 0u)
+OS_EXT            OS_TCB                    OSIdleTaskTCB;
+#endif
+#if (OS_CFG_TASK_IDLE_PM_EN > 0u)
+OS_EXT            OS_IDLE_PM_STATE         *OSIdlePMStateListPtr;       /* Sleep states, from the lightest            */
+#endif
+
+                                                                        /* DEFERRED ISR POSTS ----------------------- */
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+OS_EXT            OS_OBJ_QTY                OSIntQInIx;                 /* Next entry of OSCfg_IntQ[] to fill         */
+OS_EXT            OS_OBJ_QTY                OSIntQOutIx;                /* Next entry of OSCfg_IntQ[] to post         */
+OS_EXT            OS_OBJ_QTY                OSIntQNbrEntries;           /* Number of posts waiting                    */
+OS_EXT            OS_OBJ_QTY                OSIntQNbrEntriesMax;        /* Peak number of posts waiting               */
+OS_EXT            OS_OBJ_QTY                OSIntQOvfCtr;               /* Number of posts lost, queue was full       */
+OS_EXT            OS_TCB                    OSIntQTaskTCB;              /* TCB of ISR handler task                    */
+#endif
+
+                                                                        /* THREADED INTERRUPTS ---------------------- */
+#if (OS_CFG_INT_THREAD_EN > 0u)
+OS_EXT            OS_INT_THREAD            *OSIntThreadTbl[OS_CFG_INT_THREAD_IRQ_NBR]; /* Handler of each interrupt   */
+#endif
+
+                                                                        /* MISCELLANEOUS ---------------------------- */
+OS_EXT OS_VAR_HOT OS_NESTING_CTR            OSIntNestingCtr;            /* Interrupt nesting level                    */
+#ifdef CPU_CFG_INT_DIS_MEAS_EN
+#if (OS_CFG_TS_EN > 0u)
+OS_EXT            CPU_TS                    OSIntDisTimeMax;            /* Overall interrupt disable time             */
+#endif
+#endif
+#if (OS_CFG_LOCK_SITE_EN > 0u)
+OS_EXT            OS_LOCK_SITE              OSLockSiteTbl[OS_LOCK_SITE_NBR]; /* Kernel critical sections              */
+#endif
+#if (OS_CFG_CRIT_SECTION_PROFILE_EN > 0u)
+OS_EXT            OS_CRIT_SITE              OSCritSiteTbl[OS_CRIT_SITE_NBR]; /* Critical sections per kernel module   */
+OS_EXT            CPU_TS_TMR                OSCritSiteTsBegin;          /* When the current critical section began    */
+#endif
+
+OS_EXT OS_VAR_HOT OS_STATE                  OSRunning;                  /* Flag indicating the kernel is running      */
+OS_EXT            OS_STATE                  OSInitialized;              /* Flag indicating the kernel is initialized  */
+
+#if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u) && (OS_CFG_ISR_STK_SIZE > 0u)
+OS_EXT            CPU_INT32U                OSISRStkFree;               /* Number of free ISR stack entries           */
+OS_EXT            CPU_INT32U                OSISRStkUsed;               /* Number of used ISR stack entries           */
+#if (OS_CFG_STAT_TASK_STK_CHK_INCR_EN > 0u)
+OS_EXT            CPU_INT32U                OSISRStkChkFree;            /* Free entries found by the last full scan   */
+OS_EXT            CPU_INT32U                OSISRStkChkIx;              /* Entries verified free by the current scan  */
+#endif
+#endif
+
+#if (OS_CFG_ISR_STK_SP_EN > 0u)
+OS_EXT            CPU_STK                  *OSISRStkSPPtr;              /* Deepest ISR stack SP seen by OSIntEnter()  */
+OS_EXT            OS_NESTING_CTR            OSIntNestingCtrMax;         /* Peak interrupt nesting level               */
+#endif
+
+                                                                        /* FLAGS ------------------------------------ */
+#if (OS_CFG_FLAG_EN > 0u)
+#if (OS_CFG_DBG_EN  > 0u)
+OS_EXT            OS_FLAG_GRP              *OSFlagDbgListPtr;
+OS_EXT            OS_OBJ_QTY                OSFlagQty;
+#endif
+#endif
+
+                                                                        /* MEMORY MANAGEMENT ------------------------ */
+#if (OS_CFG_MEM_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+OS_EXT            OS_MEM                   *OSMemDbgListPtr;
+OS_EXT            OS_OBJ_QTY                OSMemQty;                   /* Number of memory partitions created        */
+#endif
+#endif
+
+                                                                        /* HEAPS ------------------------------------ */
+#if (OS_CFG_HEAP_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+OS_EXT            OS_HEAP                   *OSHeapDbgListPtr;
+OS_EXT            OS_OBJ_QTY                OSHeapQty;                  /* Number of heaps created                    */
+#endif
+#endif
+
+                                                                        /* OS_MSG POOL ------------------------------ */
+#if (OS_MSG_EN > 0u)
+OS_EXT            OS_MSG_POOL               OSMsgPool;                  /* Pool of OS_MSG                             */
+#endif
+
+                                                                        /* OBJECT POOLS ----------------------------- */
+#if (OS_SEM_POOL_EN > 0u)
+OS_EXT            OS_OBJ_POOL               OSSemPool;                  /* Semaphores given out by OSSemAlloc()       */
+#endif
+#if (OS_Q_POOL_EN > 0u)
+OS_EXT            OS_OBJ_POOL               OSQPool;                    /* Queues given out by OSQAlloc()             */
+#endif
+#if (OS_TMR_POOL_EN > 0u)
+OS_EXT            OS_OBJ_POOL               OSTmrPool;                  /* Timers given out by OSTmrAlloc()           */
+#endif
+
+                                                                        /* MUTEX MANAGEMENT ------------------------- */
+#if (OS_CFG_MUTEX_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+OS_EXT            OS_MUTEX                 *OSMutexDbgListPtr;
+OS_EXT            OS_OBJ_QTY                OSMutexQty;                 /* Number of mutexes created                  */
+#endif
+#if (OS_CFG_MUTEX_BLOCK_STAT_EN > 0u)
+OS_EXT            OS_MUTEX_CHAIN            OSMutexChainWorst;          /* Longest wait on a mutex and its chain      */
+#endif
+#endif
+
+                                                                        /* PRIORITIES ------------------------------- */
+OS_EXT OS_VAR_HOT OS_PRIO                   OSPrioCur;                  /* Priority of current task                   */
+OS_EXT OS_VAR_HOT OS_PRIO                   OSPrioHighRdy;              /* Priority of highest priority task          */
+OS_EXT OS_VAR_HOT CPU_DATA                  OSPrioTbl[OS_PRIO_RDY_TBL_SIZE];
+#if (OS_PRIO_TBL_2LVL_EN > 0u)
+OS_EXT OS_VAR_HOT CPU_DATA                  OSPrioGrp;                  /* One bit per non-empty OSPrioTbl[] entry    */
+#endif
+#if (OS_CFG_PRIO_MAP_EN > 0u)
+OS_EXT OS_VAR_HOT OS_PRIO                   OSPrioMapIxTbl[OS_CFG_PRIO_MAX]; /* Dense index of each priority          */
+#endif
+
+                                                                        /* QUEUES ----------------------------------- */
+#if (OS_CFG_Q_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+OS_EXT            OS_Q                     *OSQDbgListPtr;
+OS_EXT            OS_OBJ_QTY                OSQQty;                     /* Number of message queues created           */
+#endif
+#endif
+                                                                        /* MAILBOXES -------------------------------- */
+#if (OS_CFG_MBOX_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+OS_EXT            OS_MBOX                  *OSMboxDbgListPtr;
+OS_EXT            OS_OBJ_QTY                OSMboxQty;                  /* Number of mailboxes created                */
+#endif
+#endif
+
+
+
+                                                                        /* READY LIST ------------------------------- */
+OS_EXT OS_VAR_HOT OS_RDY_LIST               OSRdyList[OS_PRIO_RDY_NBR]; /* Table of tasks ready to run                */
+
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+OS_EXT            CPU_BOOLEAN               OSSafetyCriticalStartFlag;  /* Flag indicating that all init. done        */
+#endif
+                                                                        /* SCHEDULER -------------------------------- */
+#if (OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u)
+OS_EXT            CPU_TS_TMR                OSSchedLockTimeBegin;       /* Scheduler lock time measurement            */
+OS_EXT            CPU_TS_TMR                OSSchedLockTimeMax;
+OS_EXT            CPU_TS_TMR                OSSchedLockTimeMaxCur;
+#if (OS_CFG_LOCK_SITE_EN > 0u)
+OS_EXT            OS_LOCK_SITE              OSSchedLockSiteTbl[OS_CFG_LOCK_SITE_TBL_SIZE];
+OS_EXT            CPU_ADDR                  OSSchedLockSiteCur;         /* Caller that locked the scheduler           */
+#endif
+#endif
+
+OS_EXT OS_VAR_HOT OS_NESTING_CTR            OSSchedLockNestingCtr;      /* Lock nesting level                         */
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
+OS_EXT            OS_TICK                   OSSchedRoundRobinDfltTimeQuanta;
+OS_EXT            CPU_BOOLEAN               OSSchedRoundRobinEn;        /* Enable/Disable round-robin scheduling      */
+#if (OS_CFG_SCHED_ROUND_ROBIN_TS_EN > 0u)
+OS_EXT            CPU_TS                    OSSchedRoundRobinSliceEnd;  /* OS_TS_GET() value at the end of the slice  */
+OS_EXT            CPU_BOOLEAN               OSSchedRoundRobinSliceArmed; /* A time slice is running                   */
+#endif
+#endif
+#if (OS_CFG_SCHED_WINDOW_EN > 0u)
+OS_EXT            OS_SCHED_WINDOW          *OSSchedWindowCurPtr;        /* Active window                              */
+OS_EXT            OS_SCHED_WINDOW           OSSchedWindowAll;           /* All priorities, when no schedule runs      */
+OS_EXT            OS_SCHED_WINDOW          *OSSchedWindowTbl;           /* Schedule given to OSSchedWindowStart()     */
+OS_EXT            OS_OBJ_QTY                OSSchedWindowNbr;           /* Number of windows in the schedule          */
+OS_EXT            OS_OBJ_QTY                OSSchedWindowIx;            /* Index of the active window                 */
+#endif
+                                                                        /* PIPES ------------------------------------ */
+#if (OS_CFG_PIPE_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+OS_EXT            OS_PIPE                  *OSPipeDbgListPtr;
+OS_EXT            OS_OBJ_QTY                OSPipeQty;                  /* Number of pipes created                    */
+#endif
+#endif
+                                                                        /* RING BUFFERS ----------------------------- */
+#if (OS_CFG_RING_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+OS_EXT            OS_RING                  *OSRingDbgListPtr;
+OS_EXT            OS_OBJ_QTY                OSRingQty;                  /* Number of ring buffers created             */
+#endif
+#endif
+                                                                        /* READER/WRITER LOCKS ---------------------- */
+#if (OS_CFG_RWLOCK_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+OS_EXT            OS_RWLOCK                *OSRwLockDbgListPtr;
+OS_EXT            OS_OBJ_QTY                OSRwLockQty;                /* Number of reader/writer locks created      */
+#endif
+#endif
+
+                                                                        /* SEMAPHORES ------------------------------- */
+#if (OS_CFG_SEM_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+OS_EXT            OS_SEM                   *OSSemDbgListPtr;
+OS_EXT            OS_OBJ_QTY                OSSemQty;                   /* Number of semaphores created               */
+#endif
+#endif
+
+                                                                        /* SEQUENCE LOCKS --------------------------- */
+#if (OS_CFG_SEQLOCK_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+OS_EXT            OS_SEQLOCK               *OSSeqLockDbgListPtr;
+OS_EXT            OS_OBJ_QTY                OSSeqLockQty;               /* Number of sequence locks created           */
+#endif
+#endif
+
+                                                                        /* READ-COPY-UPDATE ------------------------- */
+#if (OS_CFG_RCU_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+OS_EXT            OS_RCU                   *OSRcuDbgListPtr;
+OS_EXT            OS_OBJ_QTY                OSRcuQty;                   /* Number of RCU domains created              */
+#endif
+#endif
+
+                                                                        /* TOPICS ----------------------------------- */
+#if (OS_CFG_TOPIC_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+OS_EXT            OS_TOPIC                 *OSTopicDbgListPtr;
+OS_EXT            OS_OBJ_QTY                OSTopicQty;                 /* Number of topics created                   */
+#endif
+#endif
+
+                                                                        /* CALLS ------------------------------------ */
+#if (OS_CFG_CALL_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+OS_EXT            OS_CALL_EP               *OSCallEpDbgListPtr;
+OS_EXT            OS_OBJ_QTY                OSCallEpQty;                /* Number of call endpoints created           */
+#endif
+#endif
+
+                                                                        /* SIGNALS ---------------------------------- */
+#if (OS_CFG_SIGNAL_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+OS_EXT            OS_SIGNAL                *OSSignalDbgListPtr;
+OS_EXT            OS_OBJ_QTY                OSSignalQty;                /* Number of signals created                  */
+#endif
+#endif
+
+                                                                        /* COMPLETIONS ------------------------------ */
+#if (OS_CFG_COMPLETION_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+OS_EXT            OS_COMPLETION            *OSCompletionDbgListPtr;
+OS_EXT            OS_OBJ_QTY                OSCompletionQty;            /* Number of completions created              */
+#endif
+#endif
+
+                                                                        /* SAMPLING PROFILER ------------------------ */
+#if (OS_CFG_PROF_SAMPLE_EN > 0u)
+OS_EXT            OS_PROF_SAMPLE            OSProfSampleTbl[OS_CFG_PROF_SAMPLE_SIZE];
+OS_EXT            OS_OBJ_QTY                OSProfSampleIn;             /* Index of the next sample to write          */
+OS_EXT            OS_OBJ_QTY                OSProfSampleOut;            /* Index of the oldest sample                 */
+OS_EXT            OS_OBJ_QTY                OSProfSampleNbr;            /* Number of samples in the ring              */
+OS_EXT            OS_OBJ_QTY                OSProfSampleOvfCtr;         /* Samples dropped because the ring was full  */
+OS_EXT            CPU_BOOLEAN               OSProfSampleEn;             /* The tick records samples                   */
+#endif
+
+                                                                        /* OBJECT REGISTRY -------------------------- */
+#if (OS_CFG_OBJ_REG_EN > 0u)
+OS_EXT            OS_OBJ_REG_ENTRY          OSObjRegTbl[OS_CFG_OBJ_REG_SIZE]; /* Registered objects, by name hash     */
+OS_EXT            OS_OBJ_QTY                OSObjRegQty;                /* Number of objects registered               */
+OS_EXT            OS_OBJ_QTY                OSObjRegFullCtr;            /* Objects not registered, table full         */
+#endif
+
+                                                                        /* REACTORS --------------------------------- */
+#if (OS_CFG_REACTOR_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+OS_EXT            OS_REACTOR               *OSReactorDbgListPtr;
+OS_EXT            OS_OBJ_QTY                OSReactorQty;               /* Number of reactors created                 */
+#endif
+#endif
+
+                                                                        /* STATISTICS ------------------------------- */
+#if (OS_CFG_STAT_TASK_EN > 0u)
+OS_EXT            CPU_BOOLEAN               OSStatResetFlag;            /* Force the reset of the computed statistics */
+OS_EXT            OS_CPU_USAGE              OSStatTaskCPUUsage;         /* CPU Usage in %                             */
+OS_EXT            OS_CPU_USAGE              OSStatTaskCPUUsageMax;      /* CPU Usage in % (Peak)                      */
+OS_EXT            OS_IDLE_CTR               OSStatTaskCtr;
+OS_EXT            OS_IDLE_CTR               OSStatTaskCtrMax;
+OS_EXT            OS_IDLE_CTR               OSStatTaskCtrRun;
+OS_EXT            CPU_BOOLEAN               OSStatTaskRdy;
+OS_EXT            OS_TCB                    OSStatTaskTCB;
+#if (OS_CFG_STAT_TASK_BUDGET > 0u) && (OS_CFG_DBG_EN > 0u)
+OS_EXT            OS_TCB                   *OSStatTaskTCBNextPtr;       /* Next task processed by the statistic task  */
+OS_EXT            CPU_INT32U       volatile OSStatTaskSeqCtr;           /* Incremented on every per-task update       */
+#endif
+#if (OS_CFG_STAT_TASK_IDLE_CYCLES_EN > 0u)
+OS_EXT            OS_CYCLES                 OSStatTaskIdleCycles;       /* Idle task cycles when the last run ended   */
+OS_EXT            CPU_TS                    OSStatTaskCyclesStart;      /* OS_TS_GET() at the start of the last run   */
+#endif
+#if (OS_CFG_TS_EN > 0u)
+OS_EXT            CPU_TS                    OSStatTaskTime;
+OS_EXT            CPU_TS                    OSStatTaskTimeMax;
+#endif
+#if (OS_TASK_PERIOD_EN > 0u) && (OS_CFG_DBG_EN > 0u)
+OS_EXT            OS_CTR                    OSStatTaskPeriodOvrCtr;     /* Overruns of all the periodic tasks         */
+OS_EXT            OS_TICK                   OSStatTaskPeriodJitterMax;  /* Peak release jitter of all the tasks       */
+#endif
+#if (OS_CFG_STAT_SNAP_EN > 0u)
+OS_EXT            OS_STAT_SNAP     volatile OSStatSnap;                 /* Statistics for debug probes                */
+#endif
+#if (OS_CFG_STAT_GOV_EN > 0u)
+OS_EXT            OS_STAT_GOV              *OSStatGovPtr;               /* Frequency governor, NULL if none           */
+OS_EXT            OS_PERF_LVL               OSStatGovLvl;               /* Level chosen from the CPU usage            */
+OS_EXT            OS_PERF_LVL               OSStatGovLvlCur;            /* Level the CPU runs at                      */
+OS_EXT            CPU_INT08U                OSStatGovUpCtr;             /* Consecutive runs above 'UpThreshold'       */
+OS_EXT            CPU_INT08U                OSStatGovDnCtr;             /* Consecutive runs below 'DnThreshold'       */
+#endif
+#if (OS_CFG_STAT_SCHED_EN > 0u)
+OS_EXT            CPU_INT32U                OSStatSchedUtil;            /* Sum of WCET/period of periodic tasks       */
+OS_EXT            OS_TCB                   *OSStatSchedFailTCBPtr;      /* First task found unschedulable, or NULL    */
+#endif
+#endif
+
+                                                                        /* TASKS ------------------------------------ */
+#if ((OS_CFG_TASK_PROFILE_EN > 0u) || (OS_CFG_DBG_EN > 0u))
+OS_EXT            OS_CTX_SW_CTR             OSTaskCtxSwCtr;             /* Number of context switches                 */
+#if (OS_CFG_DBG_EN > 0u)
+OS_EXT            OS_TCB                   *OSTaskDbgListPtr;
+#endif
+#endif
+
+OS_EXT            OS_OBJ_QTY                OSTaskQty;                  /* Number of tasks created                    */
+
+#if (OS_CFG_TASK_STK_CLR_DEFER_EN > 0u)
+OS_EXT            OS_TCB                   *OSTaskStkClrListPtr;        /* Tasks whose stack the idle task clears     */
+#endif
+
+#if (OS_CFG_TASK_STK_PROFILE_EN > 0u)
+OS_EXT            OS_STK_PROFILE_TBL       *OSTaskStkProfileTblPtr;     /* Table given to OSTaskStkProfileInit()      */
+#endif
+
+#if (OS_CFG_TASK_STK_FIT_EN > 0u)
+OS_EXT            OS_HEAP                  *OSTaskStkFitHeapPtr;        /* Heap the fitted stacks come from           */
+OS_EXT            CPU_STK                  *OSTaskStkFitZombiePtr;      /* Stack of a task that deleted itself        */
+#endif
+
+#if (OS_CFG_TASK_HIST_EN > 0u) && (OS_CFG_TASK_HIST_PRIO_EN > 0u)
+OS_EXT            OS_TASK_HIST_PRIO         OSTaskHistPrioTbl[OS_CFG_PRIO_MAX]; /* Wake to run latency per priority   */
+#endif
+
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+OS_EXT            OS_TCB                   *OSTaskBudgetListPtr;        /* Tasks with a CPU budget                    */
+OS_EXT            OS_TICK                   OSTaskBudgetReplenishTick;  /* Earliest replenishment in the list         */
+#endif
+
+#if (OS_CFG_TASK_FAIR_EN > 0u)
+OS_EXT            CPU_TS                    OSTaskFairVRuntimeMin;      /* Virtual runtime of the fair-share level    */
+#endif
+
+#if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
+OS_EXT            OS_REG_ID                 OSTaskRegNextAvailID;       /* Next available Task Register ID            */
+#endif
+
+                                                                        /* TICK ------------------------------------- */
+#if (OS_CFG_TICK_EN > 0u)
+OS_EXT OS_VAR_HOT OS_TICK                   OSTickCtr;                  /* Cnts the #ticks since startup or last set  */
+#if (OS_CFG_TICK_RATE_SET_EN > 0u)
+OS_EXT            OS_RATE_HZ                OSTickRateHz;               /* Current tick rate, see OSTickRateSet()     */
+#endif
+#if (OS_CFG_DYN_TICK_EN > 0u)
+OS_EXT            OS_TICK                   OSTickCtrStep;              /* Number of ticks to the next tick task call.*/
+#endif
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+OS_EXT            OS_TICK_LIST              OSTickWheel[OS_CFG_TICK_WHEEL_SIZE];   /* Spokes of the tick wheel        */
+OS_EXT            OS_TICK                   OSTickWheelCtr;             /* Last tick processed by the tick wheel      */
+#if (OS_CFG_DYN_TICK_EN > 0u)
+OS_EXT            CPU_DATA                  OSTickWheelMap[OS_TICK_WHEEL_MAP_SIZE]; /* Bitmap of non-empty spokes     */
+#endif
+#else
+OS_EXT            OS_TICK_LIST              OSTickList;
+#endif
+#if (OS_CFG_TICK_TASK_EN > 0u)
+OS_EXT            OS_TICK                   OSTickCtrPend;              /* Ticks not yet processed by the tick task   */
+OS_EXT            OS_TCB                    OSTickTaskTCB;              /* TCB of the tick task                       */
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+OS_EXT            OS_TCB                   *OSTickWheelCursor;          /* Next task of the spoke being processed     */
+#endif
+#endif
+#if (OS_CFG_TIME_HR_EN > 0u)
+OS_EXT            OS_TICK_LIST              OSTickHrList;               /* Tasks sorted by OS_TS_GET() deadline       */
+#endif
+#if (OS_CFG_TS_EN > 0u)
+OS_EXT            CPU_TS                    OSTickTime;
+OS_EXT            CPU_TS                    OSTickTimeMax;
+#endif
+#endif
+
+
+
+#if (OS_CFG_TMR_EN > 0u)                                                /* TIMERS ----------------------------------- */
+#if (OS_CFG_DBG_EN > 0u)
+OS_EXT            OS_TMR                   *OSTmrDbgListPtr;            /* Doubly-linked list of timers               */
+#endif
+OS_EXT            OS_TMR_SVC                OSTmrSvc;                   /* Default timer service, run by OSTmrTaskTCB */
+#if (OS_CFG_TICK_RATE_SET_EN > 0u)
+OS_EXT            OS_TMR_SVC               *OSTmrSvcListPtr;            /* Timer services rescaled by OSTickRateSet() */
+#endif
+#if (OS_CFG_TMR_ISR_EN > 0u)
+OS_EXT            OS_TMR                   *OSTmrIsrListPtr;            /* ISR timers sorted by OS_TS_GET() deadline  */
+#endif
+
+#if (OS_CFG_DBG_EN > 0u)
+OS_EXT            OS_OBJ_QTY                OSTmrQty;                   /* Number of timers created                   */
+#endif
+OS_EXT            OS_TCB                    OSTmrTaskTCB;               /* TCB of timer task                          */
+OS_EXT            OS_TICK                   OSTmrToTicksMult;           /* Converts Timer time to Ticks Multiplier    */
+#endif
+
+
+
+
+                                                                        /* SOFTWARE WATCHDOG ------------------------ */
+#if (OS_CFG_WDOG_EN > 0u)
+OS_EXT            OS_WDOG                   OSWdogTbl[OS_CFG_WDOG_NBR_MAX]; /* Registered tasks, by ID - 1            */
+OS_EXT            CPU_DATA volatile         OSWdogMap[OS_WDOG_MAP_SIZE]; /* Check-ins since the last period           */
+OS_EXT            OS_OBJ_QTY                OSWdogQty;                  /* Number of registered tasks                 */
+OS_EXT            OS_WDOG_HOOK              OSWdogHookPtr;              /* Called with the task that missed           */
+OS_EXT            OS_TICK                   OSWdogPeriod;               /* Supervision period (timer ticks)           */
+OS_EXT            OS_TMR                    OSWdogTmr;                  /* Runs the supervision in OS_TmrTask()       */
+#endif
+
+                                                                        /* TCBs ------------------------------------- */
+OS_EXT OS_VAR_HOT OS_TCB                   *OSTCBCurPtr;                /* Pointer to currently running TCB           */
+OS_EXT OS_VAR_HOT OS_TCB                   *OSTCBHighRdyPtr;            /* Pointer to highest priority  TCB           */
+
+
+/*
+************************************************************************************************************************
+************************************************************************************************************************
+*                                                   E X T E R N A L S
+************************************************************************************************************************
+************************************************************************************************************************
+*/
+
+extern  CPU_STK     * const OSCfg_IdleTaskStkBasePtr;
+extern  CPU_STK_SIZE  const OSCfg_IdleTaskStkLimit;
+extern  CPU_STK_SIZE  const OSCfg_IdleTaskStkSize;
+extern  CPU_INT32U    const OSCfg_IdleTaskStkSizeRAM;
+
+extern  CPU_STK     * const OSCfg_ISRStkBasePtr;
+extern  CPU_STK_SIZE  const OSCfg_ISRStkSize;
+extern  CPU_INT32U    const OSCfg_ISRStkSizeRAM;
+
+extern  OS_MSG_SIZE   const OSCfg_MsgPoolSize;
+extern  CPU_INT32U    const OSCfg_MsgPoolSizeRAM;
+extern  OS_MSG      * const OSCfg_MsgPoolBasePtr;
+
+extern  OS_INT_Q    * const OSCfg_IntQBasePtr;
+extern  OS_OBJ_QTY    const OSCfg_IntQSize;
+extern  CPU_INT32U    const OSCfg_IntQSizeRAM;
+extern  OS_PRIO       const OSCfg_IntQTaskPrio;
+extern  CPU_STK     * const OSCfg_IntQTaskStkBasePtr;
+extern  CPU_STK_SIZE  const OSCfg_IntQTaskStkLimit;
+extern  CPU_STK_SIZE  const OSCfg_IntQTaskStkSize;
+extern  CPU_INT32U    const OSCfg_IntQTaskStkSizeRAM;
+
+extern  OS_PRIO       const OSCfg_StatTaskPrio;
+extern  OS_RATE_HZ    const OSCfg_StatTaskRate_Hz;
+extern  CPU_STK     * const OSCfg_StatTaskStkBasePtr;
+extern  CPU_STK_SIZE  const OSCfg_StatTaskStkLimit;
+extern  CPU_STK_SIZE  const OSCfg_StatTaskStkSize;
+extern  CPU_INT32U    const OSCfg_StatTaskStkSizeRAM;
+
+extern  CPU_STK_SIZE  const OSCfg_StkSizeMin;
+
+extern  OS_RATE_HZ    const OSCfg_TickRate_Hz;
+extern  OS_PRIO       const OSCfg_TickTaskPrio;
+extern  CPU_STK     * const OSCfg_TickTaskStkBasePtr;
+extern  CPU_STK_SIZE  const OSCfg_TickTaskStkLimit;
+extern  CPU_STK_SIZE  const OSCfg_TickTaskStkSize;
+extern  CPU_INT32U    const OSCfg_TickTaskStkSizeRAM;
+
+extern  OS_PRIO       const OSCfg_TmrTaskPrio;
+extern  OS_RATE_HZ    const OSCfg_TmrTaskRate_Hz;
+extern  CPU_STK     * const OSCfg_TmrTaskStkBasePtr;
+extern  CPU_STK_SIZE  const OSCfg_TmrTaskStkLimit;
+extern  CPU_STK_SIZE  const OSCfg_TmrTaskStkSize;
+extern  CPU_INT32U    const OSCfg_TmrTaskStkSizeRAM;
+
+#if (OS_CFG_PRIO_MAP_EN > 0u)
+extern  OS_PRIO       const OSCfg_PrioMapTbl[];
+#endif
+
+#if (OS_SEM_POOL_EN > 0u)
+extern  OS_MEM_QTY    const OSCfg_SemPoolSize;
+extern  CPU_INT32U    const OSCfg_SemPoolSizeRAM;
+#endif
+#if (OS_Q_POOL_EN > 0u)
+extern  OS_MEM_QTY    const OSCfg_QPoolSize;
+extern  CPU_INT32U    const OSCfg_QPoolSizeRAM;
+#endif
+#if (OS_TMR_POOL_EN > 0u)
+extern  OS_MEM_QTY    const OSCfg_TmrPoolSize;
+extern  CPU_INT32U    const OSCfg_TmrPoolSizeRAM;
+#endif
+
+extern  CPU_INT32U    const OSCfg_DataSizeRAM;
+
+#if (OS_CFG_TASK_IDLE_EN > 0u)
+extern  CPU_STK        OSCfg_IdleTaskStk[OS_CFG_IDLE_TASK_STK_SIZE];
+#endif
+
+#if (OS_CFG_ISR_STK_SIZE > 0u)
+extern  CPU_STK        OSCfg_ISRStk[OS_CFG_ISR_STK_SIZE];
+#endif
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+extern  OS_INT_Q       OSCfg_IntQ[OS_CFG_INT_Q_SIZE];
+extern  CPU_STK        OSCfg_IntQTaskStk[OS_CFG_INT_Q_TASK_STK_SIZE];
+#endif
+
+#if (OS_MSG_EN > 0u)
+extern  OS_MSG         OSCfg_MsgPool[OS_CFG_MSG_POOL_SIZE];
+#endif
+
+#if (OS_CFG_STAT_TASK_EN > 0u)
+extern  CPU_STK        OSCfg_StatTaskStk[OS_CFG_STAT_TASK_STK_SIZE];
+#endif
+
+#if (OS_CFG_TICK_TASK_EN > 0u)
+extern  CPU_STK        OSCfg_TickTaskStk[OS_CFG_TICK_TASK_STK_SIZE];
+#endif
+
+#if (OS_CFG_TMR_EN > 0u)
+extern  CPU_STK        OSCfg_TmrTaskStk[OS_CFG_TMR_TASK_STK_SIZE];
+#endif
+
+#if (OS_SEM_POOL_EN > 0u)
+extern  CPU_INT08U     OSCfg_SemPool[OS_OBJ_POOL_STORAGE_SIZE(sizeof(OS_SEM), OS_CFG_SEM_POOL_SIZE)];
+#endif
+
+#if (OS_Q_POOL_EN > 0u)
+extern  CPU_INT08U     OSCfg_QPool[OS_OBJ_POOL_STORAGE_SIZE(sizeof(OS_Q), OS_CFG_Q_POOL_SIZE)];
+#endif
+
+#if (OS_TMR_POOL_EN > 0u)
+extern  CPU_INT08U     OSCfg_TmrPool[OS_OBJ_POOL_STORAGE_SIZE(sizeof(OS_TMR), OS_CFG_TMR_POOL_SIZE)];
+#endif
+
+/*
+************************************************************************************************************************
+************************************************************************************************************************
+*                                        F U N C T I O N   P R O T O T Y P E S
+************************************************************************************************************************
+************************************************************************************************************************
+*/
+
+/* ================================================================================================================== */
+/*                                                 ATOMIC OPERATIONS                                                  */
+/* ================================================================================================================== */
+
+#if (OS_CFG_ATOMIC_EN > 0u)
+
+CPU_DATA      OSAtomicCAS               (CPU_DATA     volatile *p_addr,
+                                         CPU_DATA               val_old,
+                                         CPU_DATA               val_new);
+
+CPU_DATA      OSAtomicFetchAdd          (CPU_DATA     volatile *p_addr,
+                                         CPU_DATA               val);
+
+CPU_DATA      OSAtomicFetchOr           (CPU_DATA     volatile *p_addr,
+                                         CPU_DATA               val);
+
+CPU_DATA      OSAtomicLoad              (CPU_DATA     volatile *p_addr);
+
+void          OSAtomicStore             (CPU_DATA     volatile *p_addr,
+                                         CPU_DATA               val);
+
+CPU_DATA      OSAtomicXchg              (CPU_DATA     volatile *p_addr,
+                                         CPU_DATA               val);
+
+void         *OSAtomicPtrCAS            (void       * volatile *p_addr,
+                                         void                  *p_old,
+                                         void                  *p_new);
+
+void         *OSAtomicPtrLoad           (void       * volatile *p_addr);
+
+void          OSAtomicPtrStore          (void       * volatile *p_addr,
+                                         void                  *p_val);
+
+void         *OSAtomicPtrXchg           (void       * volatile *p_addr,
+                                         void                  *p_val);
+
+#endif
+
+
+/* ================================================================================================================== */
+/*                                                    EVENT FLAGS                                                     */
+/* ================================================================================================================== */
+
+#if (OS_CFG_FLAG_EN > 0u)
+
+void          OSFlagCreate              (OS_FLAG_GRP           *p_grp,
+                                         CPU_CHAR             *p_name,
+                                         OS_FLAGS               flags,
+                                         OS_ERR               *p_err);
+
+#if (OS_CFG_FLAG_DEL_EN > 0u)
+OS_OBJ_QTY    OSFlagDel                 (OS_FLAG_GRP           *p_grp,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+#endif
+
+OS_FLAGS      OSFlagPend                (OS_FLAG_GRP           *p_grp,
+                                         OS_FLAGS               flags,
+                                         OS_TICK               timeout,
+                                         OS_OPT                opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR               *p_err);
+
+#if (OS_CFG_FLAG_PEND_ABORT_EN > 0u)
+OS_OBJ_QTY    OSFlagPendAbort           (OS_FLAG_GRP           *p_grp,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+#endif
+
+OS_FLAGS      OSFlagPendGetFlagsRdy     (OS_ERR               *p_err);
+
+OS_FLAGS      OSFlagPost                (OS_FLAG_GRP           *p_grp,
+                                         OS_FLAGS               flags,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+
+#if (OS_CFG_POST_FROM_ISR_EN > 0u)
+OS_FLAGS      OSFlagPostFromISR         (OS_FLAG_GRP           *p_grp,
+                                         OS_FLAGS               flags,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+#endif
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_FlagClr                (OS_FLAG_GRP           *p_grp);
+
+void          OS_FlagBlock              (OS_FLAG_GRP           *p_grp,
+                                         OS_FLAGS               flags,
+                                         OS_OPT                opt,
+                                         OS_TICK               timeout);
+
+#if (OS_CFG_DBG_EN > 0u)
+void          OS_FlagDbgListAdd         (OS_FLAG_GRP           *p_grp);
+
+void          OS_FlagDbgListRemove      (OS_FLAG_GRP           *p_grp);
+#endif
+
+#if (OS_CFG_FLAG_WAIT_IDX_EN > 0u)
+void          OS_FlagIdxInsert          (OS_FLAG_GRP           *p_grp,
+                                         OS_TCB                *p_tcb);
+
+void          OS_FlagIdxRemove          (OS_FLAG_GRP           *p_grp,
+                                         OS_TCB                *p_tcb);
+
+void          OS_FlagIdxUpdate          (OS_FLAG_GRP           *p_grp,
+                                         OS_FLAGS               flags);
+
+void          OS_FlagIdxPost            (OS_FLAG_GRP           *p_grp,
+                                         OS_FLAGS               flags,
+                                         CPU_TS                 ts);
+#endif
+
+void          OS_FlagTaskRdy            (OS_TCB                *p_tcb,
+                                         OS_FLAGS               flags_rdy,
+                                         CPU_TS                 ts);
+#endif
+
+
+/* ================================================================================================================== */
+/*                                          FIXED SIZE MEMORY BLOCK MANAGEMENT                                        */
+/* ================================================================================================================== */
+
+#if (OS_CFG_MEM_EN > 0u)
+
+void          OSMemCreate               (OS_MEM                *p_mem,
+                                         CPU_CHAR             *p_name,
+                                         void                  *p_addr,
+                                         OS_MEM_QTY             n_blks,
+                                         OS_MEM_SIZE            blk_size,
+                                         OS_ERR               *p_err);
+
+#if (OS_CFG_MEM_CACHE_EN > 0u)
+void          OSMemCreateAligned        (OS_MEM                *p_mem,
+                                         CPU_CHAR              *p_name,
+                                         void                  *p_addr,
+                                         CPU_SIZE_T             size,
+                                         OS_MEM_SIZE            blk_size,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
+void         *OSMemGet                  (OS_MEM                *p_mem,
+                                         OS_ERR               *p_err);
+
+#if (OS_CFG_MEM_PEND_EN > 0u)
+void         *OSMemPend                 (OS_MEM                *p_mem,
+                                         OS_TICK               timeout,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+#endif
+
+void          OSMemPut                  (OS_MEM                *p_mem,
+                                         void                  *p_blk,
+                                         OS_ERR               *p_err);
+
+#if (OS_CFG_MEM_MAG_EN > 0u)
+void          OSMemMagInit              (OS_MEM_MAG            *p_mag,
+                                         OS_MEM                *p_mem,
+                                         OS_MEM_QTY             size,
+                                         OS_ERR               *p_err);
+
+void         *OSMemMagGet               (OS_MEM_MAG            *p_mag,
+                                         OS_ERR               *p_err);
+
+void          OSMemMagPut               (OS_MEM_MAG            *p_mag,
+                                         void                  *p_blk,
+                                         OS_ERR               *p_err);
+
+void          OSMemMagFlush             (OS_MEM_MAG            *p_mag,
+                                         OS_ERR               *p_err);
+#endif
+
+#if (OS_CFG_MEM_BUF_EN > 0u)
+void         *OSMemBufGet               (OS_MEM                *p_mem,
+                                         OS_MEM_BUF_RELEASE_PTR p_release,
+                                         OS_ERR                *p_err);
+
+void          OSMemBufRef               (void                  *p_data,
+                                         OS_ERR                *p_err);
+
+void          OSMemBufRelease           (void                  *p_data,
+                                         OS_ERR                *p_err);
+#endif
+
+#if (OS_CFG_MEM_QUOTA_EN > 0u)
+void          OSMemQuotaSet             (OS_MEM                *p_mem,
+                                         OS_TCB                *p_tcb,
+                                         OS_MEM_QUOTA          *p_quota,
+                                         OS_MEM_QTY             nbr_max,
+                                         OS_ERR                *p_err);
+
+void          OSMemQuotaTblSet          (OS_MEM                *p_mem,
+                                         OS_MEM_QUOTA          **p_tbl,
+                                         OS_ERR                *p_err);
+#endif
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+#if (OS_CFG_MEM_BUF_EN > 0u)
+CPU_BOOLEAN   OS_MemBufRefAdd           (void                  *p_data);
+#endif
+
+#if (OS_CFG_MEM_QUOTA_EN > 0u)
+void          OS_MemQuotaTaskDel        (OS_TCB                *p_tcb);
+#endif
+
+#if (OS_CFG_DBG_EN > 0u)
+void          OS_MemDbgListAdd          (OS_MEM                *p_mem);
+#endif
+
+void          OS_MemInit                (OS_ERR               *p_err);
+
+#endif
+
+
+/* ================================================================================================================== */
+/*                                               MULTI-SIZE SLAB ALLOCATOR                                            */
+/* ================================================================================================================== */
+
+#if (OS_CFG_SLAB_EN > 0u)
+
+void          OSSlabCreate              (OS_SLAB               *p_slab,
+                                         CPU_CHAR             *p_name,
+                                         const  OS_SLAB_CFG    *p_cfg_tbl,
+                                         OS_SLAB_CLASS         *p_class_tbl,
+                                         OS_OBJ_QTY             nbr_classes,
+                                         OS_ERR               *p_err);
+
+void         *OSSlabAlloc               (OS_SLAB               *p_slab,
+                                         OS_MEM_SIZE            size,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+
+void          OSSlabFree                (OS_SLAB               *p_slab,
+                                         void                  *p_blk,
+                                         OS_ERR               *p_err);
+
+OS_MEM_QTY    OSSlabUsedMaxGet          (OS_SLAB               *p_slab,
+                                         OS_OBJ_QTY             class_ix,
+                                         OS_ERR               *p_err);
+
+#endif
+
+
+/* ================================================================================================================== */
+/*                                                 KERNEL OBJECT POOLS                                                */
+/* ================================================================================================================== */
+
+#if (OS_CFG_OBJ_POOL_EN > 0u)
+
+#if (OS_SEM_POOL_EN > 0u)
+OS_SEM       *OSSemAlloc                (CPU_CHAR             *p_name,
+                                         OS_SEM_CTR             cnt,
+                                         OS_ERR               *p_err);
+
+OS_OBJ_QTY    OSSemFree                 (OS_SEM                *p_sem,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+#endif
+
+#if (OS_Q_POOL_EN > 0u)
+OS_Q         *OSQAlloc                  (CPU_CHAR             *p_name,
+                                         OS_MSG_QTY             max_qty,
+                                         OS_ERR               *p_err);
+
+OS_OBJ_QTY    OSQFree                   (OS_Q                  *p_q,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+#endif
+
+#if (OS_TMR_POOL_EN > 0u)
+OS_TMR       *OSTmrAlloc                (CPU_CHAR             *p_name,
+                                         OS_TICK                dly,
+                                         OS_TICK                period,
+                                         OS_OPT                opt,
+                                         OS_TMR_CALLBACK_PTR    p_callback,
+                                         void                  *p_callback_arg,
+                                         OS_ERR               *p_err);
+
+CPU_BOOLEAN   OSTmrFree                 (OS_TMR                *p_tmr,
+                                         OS_ERR               *p_err);
+#endif
+
+OS_MEM_QTY    OSObjPoolUsedGet          (OS_OBJ_TYPE            type,
+                                         OS_ERR               *p_err);
+
+OS_MEM_QTY    OSObjPoolUsedMaxGet       (OS_OBJ_TYPE            type,
+                                         OS_ERR               *p_err);
+
+void          OS_ObjPoolInit            (OS_ERR               *p_err);
+
+#endif
+
+
+/* ================================================================================================================== */
+/*                                             TWO-LEVEL SEGREGATED FIT HEAP                                          */
+/* ================================================================================================================== */
+
+#if (OS_CFG_HEAP_EN > 0u)
+
+void          OSHeapCreate              (OS_HEAP               *p_heap,
+                                         CPU_CHAR              *p_name,
+                                         void                  *p_addr,
+                                         CPU_SIZE_T             size,
+                                         OS_ERR                *p_err);
+
+void         *OSHeapAlloc               (OS_HEAP               *p_heap,
+                                         CPU_SIZE_T             size,
+                                         OS_ERR                *p_err);
+
+void          OSHeapFree                (OS_HEAP               *p_heap,
+                                         void                  *p_mem,
+                                         OS_ERR                *p_err);
+
+CPU_INT08U    OSHeapFragGet             (OS_HEAP               *p_heap,
+                                         OS_ERR                *p_err);
+
+void          OSHeapOwnerSet            (OS_HEAP               *p_heap,
+                                         void                  *p_mem,
+                                         OS_TCB                *p_tcb,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_HeapTaskDel            (OS_TCB                *p_tcb);
+
+#if (OS_CFG_DBG_EN > 0u)
+void          OS_HeapDbgListAdd         (OS_HEAP               *p_heap);
+#endif
+
+#endif
+
+
+/* ================================================================================================================== */
+/*                                             MUTUAL EXCLUSION SEMAPHORES                                            */
+/* ================================================================================================================== */
+
+#if (OS_CFG_MUTEX_EN > 0u)
+
+#if (OS_CFG_MUTEX_CEILING_EN > 0u)
+void          OSMutexCeilingSet         (OS_MUTEX              *p_mutex,
+                                         OS_PRIO                prio,
+                                         OS_ERR               *p_err);
+#endif
+
+#if (OS_CFG_MUTEX_BLOCK_STAT_EN > 0u)
+void          OSMutexChainWorstGet      (OS_MUTEX_CHAIN        *p_chain,
+                                         OS_ERR                *p_err);
+#endif
+
+void          OSMutexCreate             (OS_MUTEX              *p_mutex,
+                                         CPU_CHAR             *p_name,
+                                         OS_ERR               *p_err);
+
+#if (OS_CFG_MUTEX_DEL_EN > 0u)
+OS_OBJ_QTY    OSMutexDel                (OS_MUTEX              *p_mutex,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+#endif
+
+void          OSMutexPend               (OS_MUTEX              *p_mutex,
+                                         OS_TICK               timeout,
+                                         OS_OPT                opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR               *p_err);
+
+#if (OS_CFG_MUTEX_PEND_ABORT_EN > 0u)
+OS_OBJ_QTY    OSMutexPendAbort          (OS_MUTEX              *p_mutex,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+#endif
+
+void          OSMutexPost               (OS_MUTEX              *p_mutex,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+
+#if (OS_CFG_MUTEX_THROUGHPUT_EN > 0u)
+void          OSMutexThroughputSet      (OS_MUTEX              *p_mutex,
+                                         CPU_BOOLEAN           en,
+                                         OS_ERR               *p_err);
+#endif
+
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_MutexClr               (OS_MUTEX              *p_mutex);
+
+#if (OS_CFG_DBG_EN > 0u)
+void          OS_MutexDbgListAdd        (OS_MUTEX              *p_mutex);
+
+void          OS_MutexDbgListRemove     (OS_MUTEX              *p_mutex);
+#endif
+
+void          OS_MutexGrpAdd            (OS_TCB                *p_tcb,
+                                         OS_MUTEX              *p_mutex);
+
+void          OS_MutexGrpRemove         (OS_TCB                *p_tcb,
+                                         OS_MUTEX              *p_mutex);
+
+OS_PRIO       OS_MutexGrpPrioFindHighest(OS_TCB                *p_tcb);
+
+#if (OS_CFG_MUTEX_GRP_SORT_EN > 0u)
+void          OS_MutexGrpPrioUpdate     (OS_MUTEX              *p_mutex);
 #endif
-    OS_PEND_LIST         PendList;                          /* List of tasks waiting on condition variable            */
-#if (OS_CFG_DBG_EN > 0u)
-    void                *DbgPrevPtr;
-    void                *DbgNextPtr;
-    CPU_CHAR            *DbgNamePtr;
+
+void          OS_MutexGrpPostAll        (OS_TCB                *p_tcb);
 #endif
-                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
-    OS_MUTEX            *Mutex;                             /* Mutex bound to the condition variable.                 */
-};
 
 
-/*
-------------------------------------------------------------------------------------------------------------------------
-*                                                    MESSAGE QUEUES
-*
-* Note(s) : See  PEND OBJ  Note #1'.
-------------------------------------------------------------------------------------------------------------------------
-*/
+/* ================================================================================================================== */
+/*                                                   MESSAGE QUEUES                                                   */
+/* ================================================================================================================== */
 
-struct  os_q {                                              /* Message Queue                                          */
-                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
-#if (OS_OBJ_TYPE_REQ > 0u)
-    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_Q                         */
+#if (OS_CFG_Q_EN > 0u)
+
+void          OSQCreate                 (OS_Q                  *p_q,
+                                         CPU_CHAR             *p_name,
+                                         OS_MSG_QTY             max_qty,
+                                         OS_ERR               *p_err);
+
+#if (OS_CFG_Q_PRIV_POOL_EN > 0u)
+void          OSQCreateWithPool         (OS_Q                  *p_q,
+                                         CPU_CHAR             *p_name,
+                                         OS_MSG                *p_msg_tbl,
+                                         OS_MSG_QTY             max_qty,
+                                         OS_ERR               *p_err);
 #endif
-#if (OS_CFG_DBG_EN > 0u)
-    CPU_CHAR            *NamePtr;                           /* Pointer to Message Queue Name (NUL terminated ASCII)   */
+
+#if (OS_CFG_Q_DEL_EN > 0u)
+OS_OBJ_QTY    OSQDel                    (OS_Q                  *p_q,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
 #endif
-    OS_PEND_LIST         PendList;                          /* List of tasks waiting on message queue                 */
-#if (OS_CFG_DBG_EN > 0u)
-    OS_Q                *DbgPrevPtr;
-    OS_Q                *DbgNextPtr;
-    CPU_CHAR            *DbgNamePtr;
+
+#if (OS_CFG_Q_FLUSH_EN > 0u)
+OS_MSG_QTY    OSQFlush                  (OS_Q                  *p_q,
+                                         OS_ERR               *p_err);
 #endif
-                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
-    OS_MSG_Q             MsgQ;                              /* List of messages                                       */
-};
 
+void         *OSQPend                   (OS_Q                  *p_q,
+                                         OS_TICK               timeout,
+                                         OS_OPT                opt,
+                                         OS_MSG_SIZE           *p_msg_size,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR               *p_err);
 
-/*
-------------------------------------------------------------------------------------------------------------------------
-*                                                      SEMAPHORES
-*
-* Note(s) : See  PEND OBJ  Note #1'.
-------------------------------------------------------------------------------------------------------------------------
-*/
+#if (OS_CFG_TIME_HR_EN > 0u)
+void         *OSQPendUs                 (OS_Q                  *p_q,
+                                         CPU_INT32U             timeout_us,
+                                         OS_OPT                opt,
+                                         OS_MSG_SIZE           *p_msg_size,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR               *p_err);
+#endif
 
-struct  os_sem {                                            /* Semaphore                                              */
-                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
-#if (OS_OBJ_TYPE_REQ > 0u)
-    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_SEM                       */
+#if (OS_CFG_Q_PEND_N_EN > 0u)
+OS_MSG_QTY    OSQPendN                  (OS_Q                  *p_q,
+                                         OS_TICK               timeout,
+                                         OS_OPT                opt,
+                                         OS_MSG_ENTRY          *p_msg_tbl,
+                                         OS_MSG_QTY             nbr_max,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR               *p_err);
 #endif
-#if (OS_CFG_DBG_EN > 0u)
-    CPU_CHAR            *NamePtr;                           /* Pointer to Semaphore Name (NUL terminated ASCII)       */
+
+#if (OS_CFG_Q_PEND_ABORT_EN > 0u)
+OS_OBJ_QTY    OSQPendAbort              (OS_Q                  *p_q,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
 #endif
-    OS_PEND_LIST         PendList;                          /* List of tasks waiting on semaphore                     */
-#if (OS_CFG_DBG_EN > 0u)
-    OS_SEM              *DbgPrevPtr;
-    OS_SEM              *DbgNextPtr;
-    CPU_CHAR            *DbgNamePtr;
+
+#if (OS_CFG_Q_PEND_MATCH_EN > 0u)
+void         *OSQPendMatch              (OS_Q                  *p_q,
+                                         OS_Q_MATCH_FNCT        p_fnct,
+                                         void                  *p_arg,
+                                         OS_TICK               timeout,
+                                         OS_OPT                opt,
+                                         OS_MSG_SIZE           *p_msg_size,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR               *p_err);
 #endif
-                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
-    OS_SEM_CTR           Ctr;
-#if (OS_CFG_TS_EN > 0u)
-    CPU_TS               TS;
+
+void          OSQPost                   (OS_Q                  *p_q,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+
+#if (OS_CFG_POST_FROM_ISR_EN > 0u)
+void          OSQPostFromISR            (OS_Q                  *p_q,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
 #endif
-#if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN > 0u))
-    CPU_INT16U           SemID;                             /* Unique ID for third-party debuggers and tracers.       */
+
+#if (OS_CFG_Q_POST_N_EN > 0u)
+void          OSQPostN                  (OS_Q                  *p_q,
+                                         OS_MSG_ENTRY          *p_msg_tbl,
+                                         OS_MSG_QTY             nbr_msgs,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
 #endif
-};
 
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+void          OSQPostWait               (OS_Q                  *p_q,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_TICK               timeout,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+#endif
 
-/*
-------------------------------------------------------------------------------------------------------------------------
-*                                                  TASK CONTROL BLOCK
-------------------------------------------------------------------------------------------------------------------------
-*/
+#if (OS_CFG_MSG_Q_STAT_EN > 0u)
+void          OSQStatGet                (OS_Q                  *p_q,
+                                         OS_MSG_Q_STAT         *p_stat,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
 
-struct os_tcb {
-    CPU_STK             *StkPtr;                            /* Pointer to current top of stack                        */
+void          OSQStatThresholdSet       (OS_Q                  *p_q,
+                                         CPU_TS                 threshold,
+                                         OS_ERR               *p_err);
+#endif
 
-    void                *ExtPtr;                            /* Pointer to user definable data for TCB extension       */
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
-    CPU_STK             *StkLimitPtr;                       /* Pointer used to set stack 'watermark' limit            */
+void          OS_QClr                   (OS_Q                  *p_q);
 
 #if (OS_CFG_DBG_EN > 0u)
-    CPU_CHAR            *NamePtr;                           /* Pointer to task name                                   */
+void          OS_QDbgListAdd            (OS_Q                  *p_q);
+
+void          OS_QDbgListRemove         (OS_Q                  *p_q);
 #endif
 
-    OS_TCB              *NextPtr;                           /* Pointer to next     TCB in the TCB list                */
-    OS_TCB              *PrevPtr;                           /* Pointer to previous TCB in the TCB list                */
+#if (OS_CFG_Q_PEND_MATCH_EN > 0u)
+OS_OBJ_QTY    OS_QMatchRdy              (OS_Q                  *p_q);
+#endif
 
-#if (OS_CFG_TICK_EN > 0u)
-    OS_TCB              *TickNextPtr;
-    OS_TCB              *TickPrevPtr;
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+OS_OBJ_QTY    OS_QSpaceWake             (OS_Q                  *p_q);
 #endif
 
-#if ((OS_CFG_DBG_EN > 0u) || (OS_CFG_STAT_TASK_STK_CHK_EN > 0u) || (OS_CFG_TASK_STK_REDZONE_EN > 0u))
-    CPU_STK             *StkBasePtr;                        /* Pointer to base address of stack                       */
 #endif
 
-#if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
-    OS_TLS               TLS_Tbl[OS_CFG_TLS_TBL_SIZE];
+
+/* ================================================================================================================== */
+/*                                                      MAILBOXES                                                     */
+/* ================================================================================================================== */
+
+#if (OS_CFG_MBOX_EN > 0u)
+
+void          OSMboxCreate              (OS_MBOX               *p_mbox,
+                                         CPU_CHAR              *p_name,
+                                         OS_ERR                *p_err);
+
+#if (OS_CFG_MBOX_DEL_EN > 0u)
+OS_OBJ_QTY    OSMboxDel                 (OS_MBOX               *p_mbox,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
+void         *OSMboxPeek                (OS_MBOX               *p_mbox,
+                                         OS_MSG_SIZE           *p_msg_size,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+
+void         *OSMboxPend                (OS_MBOX               *p_mbox,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         OS_MSG_SIZE           *p_msg_size,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+
+#if (OS_CFG_MBOX_PEND_ABORT_EN > 0u)
+OS_OBJ_QTY    OSMboxPendAbort           (OS_MBOX               *p_mbox,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
 #endif
 
+void          OSMboxPost                (OS_MBOX               *p_mbox,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_MboxClr                (OS_MBOX               *p_mbox);
+
 #if (OS_CFG_DBG_EN > 0u)
-    OS_TASK_PTR          TaskEntryAddr;                     /* Pointer to task entry point address                    */
-    void                *TaskEntryArg;                      /* Argument passed to task when it was created            */
+void          OS_MboxDbgListAdd         (OS_MBOX               *p_mbox);
+
+void          OS_MboxDbgListRemove      (OS_MBOX               *p_mbox);
 #endif
 
-    OS_TCB              *PendNextPtr;                       /* Pointer to next     TCB in pend list.                  */
-    OS_TCB              *PendPrevPtr;                       /* Pointer to previous TCB in pend list.                  */
-    OS_PEND_OBJ         *PendObjPtr;                        /* Pointer to object pended on.                           */
-    OS_STATE             PendOn;                            /* Indicates what task is pending on                      */
-    OS_STATUS            PendStatus;                        /* Pend status                                            */
+#endif
+
+
+/* ================================================================================================================== */
+/*                                                 OBJECT STATISTICS                                                  */
+/* ================================================================================================================== */
+
+#if (OS_CFG_OBJ_STAT_EN > 0u)
+
+void         *OSObjStatNext             (void                  *p_obj,
+                                         OS_OBJ_STAT           *p_stat,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_ObjStatReset           (OS_OBJ_STAT           *p_stat);
+
+#endif
+
+
+/* ================================================================================================================== */
+/*                                                  OBJECT REGISTRY                                                   */
+/* ================================================================================================================== */
+
+#if (OS_CFG_OBJ_REG_EN > 0u)
+
+void         *OSObjRegFind              (CPU_CHAR              *p_name,
+                                         OS_OBJ_TYPE            type,
+                                         OS_OBJ_QTY            *p_id,
+                                         OS_ERR                *p_err);
+
+void         *OSObjRegGet               (OS_OBJ_QTY             id,
+                                         OS_OBJ_TYPE           *p_type,
+                                         OS_ERR                *p_err);
+
+OS_OBJ_QTY    OSObjRegIdGet             (void                  *p_obj,
+                                         OS_OBJ_TYPE            type);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_ObjRegAdd              (void                  *p_obj,
+                                         OS_OBJ_TYPE            type,
+                                         CPU_CHAR              *p_name);
+
+void          OS_ObjRegInit             (void);
+
+void          OS_ObjRegRemove           (void                  *p_obj,
+                                         OS_OBJ_TYPE            type,
+                                         CPU_CHAR              *p_name);
+
+#endif
+
+
+/* ================================================================================================================== */
+/*                                              PEND ON MULTIPLE OBJECTS                                              */
+/* ================================================================================================================== */
+
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+
+OS_OBJ_QTY    OSPendMulti               (OS_PEND_DATA          *p_pend_data_tbl,
+                                         OS_OBJ_QTY             tbl_size,
+                                         OS_TICK               timeout,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_PendMultiChangePrio    (OS_TCB                *p_tcb);
+
+OS_TCB       *OS_PendMultiHead          (OS_PEND_LIST          *p_pend_list);
+
+void          OS_PendMultiRdy           (OS_PEND_OBJ           *p_obj,
+                                         OS_TCB                *p_tcb,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         CPU_TS                 ts);
+
+void          OS_PendMultiRemove        (OS_TCB                *p_tcb);
+
+#endif
+
+
+/* ================================================================================================================== */
+/*                                                INTER-CORE CHANNELS                                                 */
+/* ================================================================================================================== */
+
+#if (OS_CFG_ICC_EN > 0u)
+
+void          OSIccPost                 (OS_ICC                *p_icc,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+
+OS_MSG_QTY    OSIccRx                   (OS_ICC                *p_icc,
+                                         OS_ERR               *p_err);
+
+void          OSIccRxCreate             (OS_ICC                *p_icc,
+                                         CPU_CHAR             *p_name,
+                                         OS_ICC_SHM            *p_shm,
+                                         OS_Q                  *p_q,
+                                         OS_TCB                *p_tcb,
+                                         OS_ERR               *p_err);
+
+void          OSIccShmInit              (OS_ICC_SHM            *p_shm,
+                                         OS_ICC_MSG            *p_msg_tbl,
+                                         OS_MSG_QTY             nbr_msgs,
+                                         OS_ERR               *p_err);
+
+void          OSIccTxCreate             (OS_ICC                *p_icc,
+                                         CPU_CHAR             *p_name,
+                                         OS_ICC_SHM            *p_shm,
+                                         OS_ICC_DOORBELL_PTR    p_doorbell,
+                                         void                  *p_arg,
+                                         OS_ERR               *p_err);
+
+#endif
+
+
+/* ================================================================================================================== */
+/*                                             INTER-CORE LOCKS AND EVENTS                                            */
+/* ================================================================================================================== */
+
+#if (OS_CFG_ICC_SYNC_EN > 0u)
+
+#if (OS_CFG_FLAG_EN > 0u)
+void          OSIccEvtCreate            (OS_ICC_EVT            *p_evt,
+                                         CPU_CHAR             *p_name,
+                                         OS_ICC_EVT_SHM        *p_shm,
+                                         const  OS_ICC_HW      *p_hw,
+                                         OS_FLAG_GRP           *p_grp,
+                                         OS_ICC_DOORBELL_PTR    p_doorbell,
+                                         void                  *p_arg,
+                                         OS_ERR               *p_err);
+
+void          OSIccEvtPost              (OS_ICC_EVT            *p_evt,
+                                         OS_FLAGS               flags,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+
+OS_FLAGS      OSIccEvtRx                (OS_ICC_EVT            *p_evt,
+                                         OS_ERR               *p_err);
+
+void          OSIccEvtShmInit           (OS_ICC_EVT_SHM        *p_shm,
+                                         OS_ERR               *p_err);
+#endif
+
+void          OSIccLockCreate           (OS_ICC_LOCK           *p_lock,
+                                         CPU_CHAR             *p_name,
+                                         const  OS_ICC_HW      *p_hw,
+                                         OS_ERR               *p_err);
+
+void          OSIccLockNotify           (OS_ICC_LOCK           *p_lock,
+                                         OS_ERR               *p_err);
+
+void          OSIccLockPend             (OS_ICC_LOCK           *p_lock,
+                                         OS_TICK               timeout,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+
+void          OSIccLockPost             (OS_ICC_LOCK           *p_lock,
+                                         OS_ERR               *p_err);
 
-    OS_STATE             TaskState;                         /* See OS_TASK_STATE_xxx                                  */
-    OS_PRIO              Prio;                              /* Task priority (0 == highest)                           */
-#if (OS_CFG_MUTEX_EN > 0u)
-    OS_PRIO              BasePrio;                          /* Base priority (Not inherited)                          */
-    OS_MUTEX            *MutexGrpHeadPtr;                   /* Owned mutex group head pointer                         */
 #endif
 
-#if ((OS_CFG_DBG_EN > 0u) || (OS_CFG_STAT_TASK_STK_CHK_EN > 0u) || (OS_CFG_TASK_STK_REDZONE_EN > 0u))
-    CPU_STK_SIZE         StkSize;                           /* Size of task stack (in number of stack elements)       */
-#endif
-    OS_OPT               Opt;                               /* Task options as passed by OSTaskCreate()               */
 
-#if (OS_CFG_TS_EN > 0u)
-    CPU_TS               TS;                                /* Timestamp                                              */
-#endif
-#if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN > 0u))
-    CPU_INT16U           SemID;                             /* Unique ID for third-party debuggers and tracers.       */
-#endif
-    OS_SEM_CTR           SemCtr;                            /* Task specific semaphore counter                        */
+/* ================================================================================================================== */
+/*                                                 ISR TO TASK QUEUES                                                 */
+/* ================================================================================================================== */
+
+#if (OS_CFG_ISR_Q_EN > 0u)
+
+void          OSIsrQCreate              (OS_ISR_Q              *p_isr_q,
+                                         CPU_CHAR             *p_name,
+                                         OS_TCB                *p_tcb,
+                                         void                 *p_buf,
+                                         OS_MSG_SIZE            elem_size,
+                                         OS_MSG_QTY             nbr_elem,
+                                         OS_ERR               *p_err);
+
+void          OSIsrQPend                (OS_ISR_Q              *p_isr_q,
+                                         void                  *p_data,
+                                         OS_TICK               timeout,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+
+void          OSIsrQPost                (OS_ISR_Q              *p_isr_q,
+                                         void                  *p_data,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
 
-                                                            /* DELAY / TIMEOUT                                        */
-#if (OS_CFG_TICK_EN > 0u)
-    OS_TICK              TickRemain;                        /* Number of ticks remaining                              */
-    OS_TICK              TickCtrPrev;                       /* Used by OSTimeDlyXX() in PERIODIC mode                 */
-#endif
+void          OSIsrQSignal              (OS_ISR_Q              *p_isr_q,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
 
-#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
-    OS_TICK              TimeQuanta;
-    OS_TICK              TimeQuantaCtr;
 #endif
 
-#if (OS_MSG_EN > 0u)
-    void                *MsgPtr;                            /* Message received                                       */
-    OS_MSG_SIZE          MsgSize;
-#endif
 
-#if (OS_CFG_TASK_Q_EN > 0u)
-    OS_MSG_Q             MsgQ;                              /* Message queue associated with task                     */
-#if (OS_CFG_TASK_PROFILE_EN > 0u)
-    CPU_TS               MsgQPendTime;                      /* Time it took for signal to be received                 */
-    CPU_TS               MsgQPendTimeMax;                   /* Max amount of time it took for signal to be received   */
-#endif
-#endif
+/* ================================================================================================================== */
+/*                                                        PIPES                                                       */
+/* ================================================================================================================== */
 
-#if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
-    OS_REG               RegTbl[OS_CFG_TASK_REG_TBL_SIZE];  /* Task specific registers                                */
-#endif
+#if (OS_CFG_PIPE_EN > 0u)
 
-#if (OS_CFG_FLAG_EN > 0u)
-    OS_FLAGS             FlagsPend;                         /* Event flag(s) to wait on                               */
-    OS_FLAGS             FlagsRdy;                          /* Event flags that made task ready to run                */
-    OS_OPT               FlagsOpt;                          /* Options (See OS_OPT_FLAG_xxx)                          */
-#endif
+void          OSPipeCreate              (OS_PIPE               *p_pipe,
+                                         CPU_CHAR              *p_name,
+                                         void                  *p_buf,
+                                         OS_MSG_SIZE            size,
+                                         OS_ERR                *p_err);
 
-#if (OS_CFG_TASK_SUSPEND_EN > 0u)
-    OS_NESTING_CTR       SuspendCtr;                        /* Nesting counter for OSTaskSuspend()                    */
+#if (OS_CFG_PIPE_DEL_EN > 0u)
+OS_OBJ_QTY    OSPipeDel                 (OS_PIPE               *p_pipe,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
 #endif
 
-#if (OS_CFG_TASK_PROFILE_EN > 0u)
-    OS_CPU_USAGE         CPUUsage;                          /* CPU Usage of task (0.00-100.00%)                       */
-    OS_CPU_USAGE         CPUUsageMax;                       /* CPU Usage of task (0.00-100.00%) - Peak                */
-    OS_CTX_SW_CTR        CtxSwCtr;                          /* Number of time the task was switched in                */
-    CPU_TS               CyclesDelta;                       /* value of OS_TS_GET() - .CyclesStart                    */
-    CPU_TS               CyclesStart;                       /* Snapshot of cycle counter at start of task resumption  */
-    OS_CYCLES            CyclesTotal;                       /* Total number of # of cycles the task has been running  */
-    OS_CYCLES            CyclesTotalPrev;                   /* Snapshot of previous # of cycles                       */
+OS_MSG_SIZE   OSPipeRead                (OS_PIPE               *p_pipe,
+                                         void                  *p_buf,
+                                         OS_MSG_SIZE            size,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
 
-    CPU_TS               SemPendTime;                       /* Time it took for signal to be received                 */
-    CPU_TS               SemPendTimeMax;                    /* Max amount of time it took for signal to be received   */
-#endif
+void          OSPipeWatermarkSet        (OS_PIPE               *p_pipe,
+                                         OS_MSG_SIZE            lo,
+                                         OS_MSG_SIZE            hi,
+                                         OS_ERR                *p_err);
 
-#if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u)
-    CPU_STK_SIZE         StkUsed;                           /* Number of stack elements used from the stack           */
-    CPU_STK_SIZE         StkFree;                           /* Number of stack elements free on   the stack           */
-#endif
+OS_MSG_SIZE   OSPipeWrite               (OS_PIPE               *p_pipe,
+                                         void                  *p_buf,
+                                         OS_MSG_SIZE            size,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
 
-#ifdef CPU_CFG_INT_DIS_MEAS_EN
-    CPU_TS               IntDisTimeMax;                     /* Maximum interrupt disable time                         */
-#endif
-#if (OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u)
-    CPU_TS               SchedLockTimeMax;                  /* Maximum scheduler lock time                            */
-#endif
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_PipeClr                (OS_PIPE               *p_pipe);
 
 #if (OS_CFG_DBG_EN > 0u)
-    OS_TCB              *DbgPrevPtr;
-    OS_TCB              *DbgNextPtr;
-    CPU_CHAR            *DbgNamePtr;
+void          OS_PipeDbgListAdd         (OS_PIPE               *p_pipe);
+
+void          OS_PipeDbgListRemove      (OS_PIPE               *p_pipe);
 #endif
-#if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN > 0u))
-    CPU_INT16U           TaskID;                            /* Unique ID for third-party debuggers and tracers.       */
+
 #endif
-};
 
 
-/*
-------------------------------------------------------------------------------------------------------------------------
-*                                                    TICK DATA TYPE
-------------------------------------------------------------------------------------------------------------------------
-*/
+/* ================================================================================================================== */
+/*                                                    RING BUFFERS                                                    */
+/* ================================================================================================================== */
 
-struct  os_tick_list {
-    OS_TCB              *TCB_Ptr;                           /* Pointer to list of tasks in tick list                 */
-#if (OS_CFG_DBG_EN > 0u)
-    OS_OBJ_QTY           NbrEntries;                        /* Current number of entries in the tick list            */
-    OS_OBJ_QTY           NbrUpdated;                        /* Number of entries updated                             */
+#if (OS_CFG_RING_EN > 0u)
+
+void          OSRingCreate              (OS_RING               *p_ring,
+                                         CPU_CHAR             *p_name,
+                                         void                 *p_buf,
+                                         OS_MSG_SIZE            elem_size,
+                                         OS_MSG_QTY             nbr_elem,
+                                         OS_ERR               *p_err);
+
+#if (OS_CFG_RING_DEL_EN > 0u)
+OS_OBJ_QTY    OSRingDel                 (OS_RING               *p_ring,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
 #endif
-};
 
+void         *OSRingReserve             (OS_RING               *p_ring,
+                                         OS_TICK               timeout,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
 
-/*
-------------------------------------------------------------------------------------------------------------------------
-*                                                   TIMER DATA TYPES
-------------------------------------------------------------------------------------------------------------------------
-*/
+void          OSRingCommit              (OS_RING               *p_ring,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
 
-struct  os_tmr {
-#if (OS_OBJ_TYPE_REQ > 0u)
-    OS_OBJ_TYPE          Type;
-#endif
-#if (OS_CFG_DBG_EN > 0u)
-    CPU_CHAR            *NamePtr;                           /* Name to give the timer                                 */
-#endif
-    OS_TMR_CALLBACK_PTR  CallbackPtr;                       /* Function to call when timer expires                    */
-    void                *CallbackPtrArg;                    /* Argument to pass to function when timer expires        */
-    OS_TMR              *NextPtr;                           /* Double link list pointers                              */
-    OS_TMR              *PrevPtr;
-    OS_TICK              Remain;                            /* Amount of time remaining before timer expires          */
-    OS_TICK              Dly;                               /* Delay before start of repeat                           */
-    OS_TICK              Period;                            /* Period to repeat timer                                 */
-    OS_OPT               Opt;                               /* Options (see OS_OPT_TMR_xxx)                           */
-    OS_STATE             State;
-#if (OS_CFG_DBG_EN > 0u)
-    OS_TMR              *DbgPrevPtr;
-    OS_TMR              *DbgNextPtr;
-#endif
-};
+void         *OSRingPeek                (OS_RING               *p_ring,
+                                         OS_TICK               timeout,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
 
+void          OSRingRelease             (OS_RING               *p_ring,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
 
-/*
-************************************************************************************************************************
-************************************************************************************************************************
-*                                           G L O B A L   V A R I A B L E S
-************************************************************************************************************************
-************************************************************************************************************************
-*/
-                                                                        /* APPLICATION HOOKS ------------------------ */
-#if (OS_CFG_APP_HOOKS_EN > 0u)
-#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
-OS_EXT           OS_APP_HOOK_TCB            OS_AppRedzoneHitHookPtr;
-#endif
-OS_EXT           OS_APP_HOOK_TCB            OS_AppTaskCreateHookPtr;
-OS_EXT           OS_APP_HOOK_TCB            OS_AppTaskDelHookPtr;
-OS_EXT           OS_APP_HOOK_TCB            OS_AppTaskReturnHookPtr;
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
-OS_EXT           OS_APP_HOOK_VOID           OS_AppIdleTaskHookPtr;
-OS_EXT           OS_APP_HOOK_VOID           OS_AppStatTaskHookPtr;
-OS_EXT           OS_APP_HOOK_VOID           OS_AppTaskSwHookPtr;
-OS_EXT           OS_APP_HOOK_VOID           OS_AppTimeTickHookPtr;
-#endif
+void          OS_RingClr                (OS_RING               *p_ring);
 
-                                                                        /* IDLE TASK -------------------------------- */
 #if (OS_CFG_DBG_EN > 0u)
-OS_EXT            OS_IDLE_CTR               OSIdleTaskCtr;
-#endif
-#if (OS_CFG_TASK_IDLE_EN > 0u)
-OS_EXT            OS_TCB                    OSIdleTaskTCB;
-#endif
+void          OS_RingDbgListAdd         (OS_RING               *p_ring);
 
-                                                                        /* MISCELLANEOUS ---------------------------- */
-OS_EXT            OS_NESTING_CTR            OSIntNestingCtr;            /* Interrupt nesting level                    */
-#ifdef CPU_CFG_INT_DIS_MEAS_EN
-#if (OS_CFG_TS_EN > 0u)
-OS_EXT            CPU_TS                    OSIntDisTimeMax;            /* Overall interrupt disable time             */
+void          OS_RingDbgListRemove      (OS_RING               *p_ring);
 #endif
+
 #endif
 
-OS_EXT            OS_STATE                  OSRunning;                  /* Flag indicating the kernel is running      */
-OS_EXT            OS_STATE                  OSInitialized;              /* Flag indicating the kernel is initialized  */
 
-#if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u) && (OS_CFG_ISR_STK_SIZE > 0u)
-OS_EXT            CPU_INT32U                OSISRStkFree;               /* Number of free ISR stack entries           */
-OS_EXT            CPU_INT32U                OSISRStkUsed;               /* Number of used ISR stack entries           */
-#endif
+/* ================================================================================================================== */
+/*                                                 READER/WRITER LOCKS                                                */
+/* ================================================================================================================== */
 
-                                                                        /* FLAGS ------------------------------------ */
-#if (OS_CFG_FLAG_EN > 0u)
-#if (OS_CFG_DBG_EN  > 0u)
-OS_EXT            OS_FLAG_GRP              *OSFlagDbgListPtr;
-OS_EXT            OS_OBJ_QTY                OSFlagQty;
-#endif
-#endif
+#if (OS_CFG_RWLOCK_EN > 0u)
 
-                                                                        /* MEMORY MANAGEMENT ------------------------ */
-#if (OS_CFG_MEM_EN > 0u)
-#if (OS_CFG_DBG_EN > 0u)
-OS_EXT            OS_MEM                   *OSMemDbgListPtr;
-OS_EXT            OS_OBJ_QTY                OSMemQty;                   /* Number of memory partitions created        */
-#endif
-#endif
+void          OSRwLockCreate            (OS_RWLOCK             *p_rwlock,
+                                         CPU_CHAR             *p_name,
+                                         OS_ERR               *p_err);
 
-                                                                        /* OS_MSG POOL ------------------------------ */
-#if (OS_MSG_EN > 0u)
-OS_EXT            OS_MSG_POOL               OSMsgPool;                  /* Pool of OS_MSG                             */
+#if (OS_CFG_RWLOCK_DEL_EN > 0u)
+OS_OBJ_QTY    OSRwLockDel               (OS_RWLOCK             *p_rwlock,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
 #endif
 
-                                                                        /* MUTEX MANAGEMENT ------------------------- */
-#if (OS_CFG_MUTEX_EN > 0u)
-#if (OS_CFG_DBG_EN > 0u)
-OS_EXT            OS_MUTEX                 *OSMutexDbgListPtr;
-OS_EXT            OS_OBJ_QTY                OSMutexQty;                 /* Number of mutexes created                  */
-#endif
+#if (OS_CFG_RWLOCK_PEND_ABORT_EN > 0u)
+OS_OBJ_QTY    OSRwLockPendAbort         (OS_RWLOCK             *p_rwlock,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
 #endif
 
-                                                                        /* PRIORITIES ------------------------------- */
-OS_EXT            OS_PRIO                   OSPrioCur;                  /* Priority of current task                   */
-OS_EXT            OS_PRIO                   OSPrioHighRdy;              /* Priority of highest priority task          */
-OS_EXT            CPU_DATA                  OSPrioTbl[OS_PRIO_TBL_SIZE];
+void          OSRwLockPendRd            (OS_RWLOCK             *p_rwlock,
+                                         OS_TICK               timeout,
+                                         OS_OPT                opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR               *p_err);
 
-                                                                        /* QUEUES ----------------------------------- */
-#if (OS_CFG_Q_EN > 0u)
-#if (OS_CFG_DBG_EN > 0u)
-OS_EXT            OS_Q                     *OSQDbgListPtr;
-OS_EXT            OS_OBJ_QTY                OSQQty;                     /* Number of message queues created           */
-#endif
-#endif
+void          OSRwLockPendWr            (OS_RWLOCK             *p_rwlock,
+                                         OS_TICK               timeout,
+                                         OS_OPT                opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR               *p_err);
 
+void          OSRwLockPost              (OS_RWLOCK             *p_rwlock,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
 
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
-                                                                        /* READY LIST ------------------------------- */
-OS_EXT            OS_RDY_LIST               OSRdyList[OS_CFG_PRIO_MAX]; /* Table of tasks ready to run                */
+void          OS_RwLockClr              (OS_RWLOCK             *p_rwlock);
 
+#if (OS_CFG_DBG_EN > 0u)
+void          OS_RwLockDbgListAdd       (OS_RWLOCK             *p_rwlock);
 
-#ifdef OS_SAFETY_CRITICAL_IEC61508
-OS_EXT            CPU_BOOLEAN               OSSafetyCriticalStartFlag;  /* Flag indicating that all init. done        */
-#endif
-                                                                        /* SCHEDULER -------------------------------- */
-#if (OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u)
-OS_EXT            CPU_TS_TMR                OSSchedLockTimeBegin;       /* Scheduler lock time measurement            */
-OS_EXT            CPU_TS_TMR                OSSchedLockTimeMax;
-OS_EXT            CPU_TS_TMR                OSSchedLockTimeMaxCur;
+void          OS_RwLockDbgListRemove    (OS_RWLOCK             *p_rwlock);
 #endif
 
-OS_EXT            OS_NESTING_CTR            OSSchedLockNestingCtr;      /* Lock nesting level                         */
-#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
-OS_EXT            OS_TICK                   OSSchedRoundRobinDfltTimeQuanta;
-OS_EXT            CPU_BOOLEAN               OSSchedRoundRobinEn;        /* Enable/Disable round-robin scheduling      */
+OS_PRIO       OS_RwLockPrioFindHighest  (OS_TCB                *p_tcb);
+
+void          OS_RwLockPrioUpdate       (OS_RWLOCK             *p_rwlock);
+
+void          OS_RwLockPostAll          (OS_TCB                *p_tcb);
+
 #endif
-                                                                        /* SEMAPHORES ------------------------------- */
+
+
+/* ================================================================================================================== */
+/*                                                     SEMAPHORES                                                     */
+/* ================================================================================================================== */
+
 #if (OS_CFG_SEM_EN > 0u)
-#if (OS_CFG_DBG_EN > 0u)
-OS_EXT            OS_SEM                   *OSSemDbgListPtr;
-OS_EXT            OS_OBJ_QTY                OSSemQty;                   /* Number of semaphores created               */
-#endif
-#endif
 
-                                                                        /* STATISTICS ------------------------------- */
-#if (OS_CFG_STAT_TASK_EN > 0u)
-OS_EXT            CPU_BOOLEAN               OSStatResetFlag;            /* Force the reset of the computed statistics */
-OS_EXT            OS_CPU_USAGE              OSStatTaskCPUUsage;         /* CPU Usage in %                             */
-OS_EXT            OS_CPU_USAGE              OSStatTaskCPUUsageMax;      /* CPU Usage in % (Peak)                      */
-OS_EXT            OS_TICK                   OSStatTaskCtr;
-OS_EXT            OS_TICK                   OSStatTaskCtrMax;
-OS_EXT            OS_TICK                   OSStatTaskCtrRun;
-OS_EXT            CPU_BOOLEAN               OSStatTaskRdy;
-OS_EXT            OS_TCB                    OSStatTaskTCB;
-#if (OS_CFG_TS_EN > 0u)
-OS_EXT            CPU_TS                    OSStatTaskTime;
-OS_EXT            CPU_TS                    OSStatTaskTimeMax;
+void          OSSemCreate               (OS_SEM                *p_sem,
+                                         CPU_CHAR             *p_name,
+                                         OS_SEM_CTR             cnt,
+                                         OS_ERR               *p_err);
+
+#if (OS_CFG_SEM_DEL_EN > 0u)
+OS_OBJ_QTY    OSSemDel                  (OS_SEM                *p_sem,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
 #endif
+
+OS_SEM_CTR    OSSemPend                 (OS_SEM                *p_sem,
+                                         OS_TICK               timeout,
+                                         OS_OPT                opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR               *p_err);
+
+#if (OS_CFG_TIME_HR_EN > 0u)
+OS_SEM_CTR    OSSemPendUs               (OS_SEM                *p_sem,
+                                         CPU_INT32U             timeout_us,
+                                         OS_OPT                opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR               *p_err);
 #endif
 
-                                                                        /* TASKS ------------------------------------ */
-#if ((OS_CFG_TASK_PROFILE_EN > 0u) || (OS_CFG_DBG_EN > 0u))
-OS_EXT            OS_CTX_SW_CTR             OSTaskCtxSwCtr;             /* Number of context switches                 */
-#if (OS_CFG_DBG_EN > 0u)
-OS_EXT            OS_TCB                   *OSTaskDbgListPtr;
+#if (OS_CFG_SEM_PEND_N_EN > 0u)
+OS_SEM_CTR    OSSemPendN                (OS_SEM                *p_sem,
+                                         OS_SEM_CTR             cnt,
+                                         OS_TICK               timeout,
+                                         OS_OPT                opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR               *p_err);
 #endif
+
+#if (OS_CFG_SEM_PEND_ABORT_EN > 0u)
+OS_OBJ_QTY    OSSemPendAbort            (OS_SEM                *p_sem,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
 #endif
 
-OS_EXT            OS_OBJ_QTY                OSTaskQty;                  /* Number of tasks created                    */
+OS_SEM_CTR    OSSemPost                 (OS_SEM                *p_sem,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
 
-#if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
-OS_EXT            OS_REG_ID                 OSTaskRegNextAvailID;       /* Next available Task Register ID            */
+#if (OS_CFG_POST_FROM_ISR_EN > 0u)
+OS_SEM_CTR    OSSemPostFromISR          (OS_SEM                *p_sem,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
 #endif
 
-                                                                        /* TICK ------------------------------------- */
-#if (OS_CFG_TICK_EN > 0u)
-OS_EXT            OS_TICK                   OSTickCtr;                  /* Cnts the #ticks since startup or last set  */
-#if (OS_CFG_DYN_TICK_EN > 0u)
-OS_EXT            OS_TICK                   OSTickCtrStep;              /* Number of ticks to the next tick task call.*/
-#endif
-OS_EXT            OS_TICK_LIST              OSTickList;
-#if (OS_CFG_TS_EN > 0u)
-OS_EXT            CPU_TS                    OSTickTime;
-OS_EXT            CPU_TS                    OSTickTimeMax;
+#if (OS_CFG_SEM_POST_N_EN > 0u)
+OS_SEM_CTR    OSSemPostN                (OS_SEM                *p_sem,
+                                         OS_SEM_CTR             cnt,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
 #endif
+
+#if (OS_CFG_SEM_SET_EN > 0u)
+void          OSSemSet                  (OS_SEM                *p_sem,
+                                         OS_SEM_CTR             cnt,
+                                         OS_ERR               *p_err);
 #endif
 
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
+void          OS_SemClr                 (OS_SEM                *p_sem);
 
-#if (OS_CFG_TMR_EN > 0u)                                                /* TIMERS ----------------------------------- */
 #if (OS_CFG_DBG_EN > 0u)
-OS_EXT            OS_TMR                   *OSTmrDbgListPtr;
-OS_EXT            OS_OBJ_QTY                OSTmrListEntries;           /* Doubly-linked list of timers               */
+void          OS_SemDbgListAdd          (OS_SEM                *p_sem);
+
+void          OS_SemDbgListRemove       (OS_SEM                *p_sem);
 #endif
-OS_EXT            OS_TMR                   *OSTmrListPtr;
-OS_EXT            OS_COND                   OSTmrCond;
-OS_EXT            OS_MUTEX                  OSTmrMutex;
 
-#if (OS_CFG_DBG_EN > 0u)
-OS_EXT            OS_OBJ_QTY                OSTmrQty;                   /* Number of timers created                   */
 #endif
-OS_EXT            OS_TCB                    OSTmrTaskTCB;               /* TCB of timer task                          */
-#if (OS_CFG_TS_EN > 0u)
-OS_EXT            CPU_TS                    OSTmrTaskTime;
-OS_EXT            CPU_TS                    OSTmrTaskTimeMax;
+
+
+/* ================================================================================================================== */
+/*                                                   SEQUENCE LOCKS                                                   */
+/* ================================================================================================================== */
+
+#if (OS_CFG_SEQLOCK_EN > 0u)
+
+void          OSSeqLockCreate           (OS_SEQLOCK            *p_lock,
+                                         CPU_CHAR              *p_name,
+                                         OS_ERR                *p_err);
+
+#if (OS_CFG_SEQLOCK_DEL_EN > 0u)
+OS_OBJ_QTY    OSSeqLockDel              (OS_SEQLOCK            *p_lock,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
 #endif
-OS_EXT            OS_TICK                   OSTmrTaskTickBase;          /* Tick to which timer delays are relative    */
-OS_EXT            OS_TICK                   OSTmrToTicksMult;           /* Converts Timer time to Ticks Multiplier    */
+
+void          OSSeqLockPend             (OS_SEQLOCK            *p_lock,
+                                         CPU_DATA               seq,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+CPU_DATA      OSSeqLockRdBegin          (OS_SEQLOCK            *p_lock,
+                                         OS_ERR                *p_err);
+
+CPU_BOOLEAN   OSSeqLockRdRetry          (OS_SEQLOCK            *p_lock,
+                                         CPU_DATA               seq,
+                                         OS_ERR                *p_err);
+
+void          OSSeqLockWrBegin          (OS_SEQLOCK            *p_lock,
+                                         OS_ERR                *p_err);
+
+void          OSSeqLockWrEnd            (OS_SEQLOCK            *p_lock,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_SeqLockClr             (OS_SEQLOCK            *p_lock);
+
+#if (OS_CFG_DBG_EN > 0u)
+void          OS_SeqLockDbgListAdd      (OS_SEQLOCK            *p_lock);
+
+void          OS_SeqLockDbgListRemove   (OS_SEQLOCK            *p_lock);
 #endif
 
+#endif
 
 
+/* ================================================================================================================== */
+/*                                                  READ-COPY-UPDATE                                                  */
+/* ================================================================================================================== */
 
-                                                                        /* TCBs ------------------------------------- */
-OS_EXT            OS_TCB                   *OSTCBCurPtr;                /* Pointer to currently running TCB           */
-OS_EXT            OS_TCB                   *OSTCBHighRdyPtr;            /* Pointer to highest priority  TCB           */
+#if (OS_CFG_RCU_EN > 0u)
 
+void          OSRcuCreate               (OS_RCU                *p_rcu,
+                                         CPU_CHAR              *p_name,
+                                         OS_ERR                *p_err);
 
-/*
-************************************************************************************************************************
-************************************************************************************************************************
-*                                                   E X T E R N A L S
-************************************************************************************************************************
-************************************************************************************************************************
-*/
+#if (OS_CFG_RCU_DEL_EN > 0u)
+OS_OBJ_QTY    OSRcuDel                  (OS_RCU                *p_rcu,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
 
-extern  CPU_STK     * const OSCfg_IdleTaskStkBasePtr;
-extern  CPU_STK_SIZE  const OSCfg_IdleTaskStkLimit;
-extern  CPU_STK_SIZE  const OSCfg_IdleTaskStkSize;
-extern  CPU_INT32U    const OSCfg_IdleTaskStkSizeRAM;
+CPU_BOOLEAN   OSRcuGpDone               (OS_RCU                *p_rcu,
+                                         OS_RCU_GP              gp,
+                                         OS_ERR                *p_err);
 
-extern  CPU_STK     * const OSCfg_ISRStkBasePtr;
-extern  CPU_STK_SIZE  const OSCfg_ISRStkSize;
-extern  CPU_INT32U    const OSCfg_ISRStkSizeRAM;
+OS_RCU_GP     OSRcuGpStart              (OS_RCU                *p_rcu,
+                                         OS_ERR                *p_err);
 
-extern  OS_MSG_SIZE   const OSCfg_MsgPoolSize;
-extern  CPU_INT32U    const OSCfg_MsgPoolSizeRAM;
-extern  OS_MSG      * const OSCfg_MsgPoolBasePtr;
+CPU_INT08U    OSRcuRdLock               (OS_RCU                *p_rcu,
+                                         OS_ERR                *p_err);
 
-extern  OS_PRIO       const OSCfg_StatTaskPrio;
-extern  OS_RATE_HZ    const OSCfg_StatTaskRate_Hz;
-extern  CPU_STK     * const OSCfg_StatTaskStkBasePtr;
-extern  CPU_STK_SIZE  const OSCfg_StatTaskStkLimit;
-extern  CPU_STK_SIZE  const OSCfg_StatTaskStkSize;
-extern  CPU_INT32U    const OSCfg_StatTaskStkSizeRAM;
+void          OSRcuRdUnlock             (OS_RCU                *p_rcu,
+                                         CPU_INT08U             idx,
+                                         OS_ERR                *p_err);
 
-extern  CPU_STK_SIZE  const OSCfg_StkSizeMin;
+void          OSRcuSync                 (OS_RCU                *p_rcu,
+                                         OS_TICK                timeout,
+                                         OS_ERR                *p_err);
 
-extern  OS_RATE_HZ    const OSCfg_TickRate_Hz;
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
-extern  OS_PRIO       const OSCfg_TmrTaskPrio;
-extern  OS_RATE_HZ    const OSCfg_TmrTaskRate_Hz;
-extern  CPU_STK     * const OSCfg_TmrTaskStkBasePtr;
-extern  CPU_STK_SIZE  const OSCfg_TmrTaskStkLimit;
-extern  CPU_STK_SIZE  const OSCfg_TmrTaskStkSize;
-extern  CPU_INT32U    const OSCfg_TmrTaskStkSizeRAM;
+void          OS_RcuClr                 (OS_RCU                *p_rcu);
 
-extern  CPU_INT32U    const OSCfg_DataSizeRAM;
+#if (OS_CFG_DBG_EN > 0u)
+void          OS_RcuDbgListAdd          (OS_RCU                *p_rcu);
 
-#if (OS_CFG_TASK_IDLE_EN > 0u)
-extern  CPU_STK        OSCfg_IdleTaskStk[OS_CFG_IDLE_TASK_STK_SIZE];
+void          OS_RcuDbgListRemove       (OS_RCU                *p_rcu);
 #endif
 
-#if (OS_CFG_ISR_STK_SIZE > 0u)
-extern  CPU_STK        OSCfg_ISRStk[OS_CFG_ISR_STK_SIZE];
 #endif
 
-#if (OS_MSG_EN > 0u)
-extern  OS_MSG         OSCfg_MsgPool[OS_CFG_MSG_POOL_SIZE];
+
+/* ================================================================================================================== */
+/*                                                      TOPICS                                                      */
+/* ================================================================================================================== */
+
+#if (OS_CFG_TOPIC_EN > 0u)
+
+void          OSTopicCreate             (OS_TOPIC              *p_topic,
+                                         CPU_CHAR              *p_name,
+                                         OS_ERR                *p_err);
+
+#if (OS_CFG_TOPIC_DEL_EN > 0u)
+OS_OBJ_QTY    OSTopicDel                (OS_TOPIC              *p_topic,
+                                         OS_ERR                *p_err);
 #endif
 
-#if (OS_CFG_STAT_TASK_EN > 0u)
-extern  CPU_STK        OSCfg_StatTaskStk[OS_CFG_STAT_TASK_STK_SIZE];
+OS_OBJ_QTY    OSTopicPublish            (OS_TOPIC              *p_topic,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+void          OSTopicSubscribe          (OS_TOPIC              *p_topic,
+                                         OS_TOPIC_SUB          *p_sub,
+                                         OS_TCB                *p_tcb,
+                                         OS_Q                  *p_q,
+                                         OS_ERR                *p_err);
+
+void          OSTopicUnsubscribe        (OS_TOPIC              *p_topic,
+                                         OS_TOPIC_SUB          *p_sub,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_TopicClr               (OS_TOPIC              *p_topic);
+
+#if (OS_CFG_DBG_EN > 0u)
+void          OS_TopicDbgListAdd        (OS_TOPIC              *p_topic);
+
+void          OS_TopicDbgListRemove     (OS_TOPIC              *p_topic);
 #endif
 
-#if (OS_CFG_TMR_EN > 0u)
-extern  CPU_STK        OSCfg_TmrTaskStk[OS_CFG_TMR_TASK_STK_SIZE];
 #endif
 
-/*
-************************************************************************************************************************
-************************************************************************************************************************
-*                                        F U N C T I O N   P R O T O T Y P E S
-************************************************************************************************************************
-************************************************************************************************************************
-*/
 
 /* ================================================================================================================== */
-/*                                                    EVENT FLAGS                                                     */
+/*                                                       CALLS                                                        */
 /* ================================================================================================================== */
 
-#if (OS_CFG_FLAG_EN > 0u)
+#if (OS_CFG_CALL_EN > 0u)
 
-void          OSFlagCreate              (OS_FLAG_GRP           *p_grp,
+void         *OSCall                    (OS_CALL_EP            *p_ep,
+                                         void                  *p_msg,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         OS_MSG_SIZE           *p_reply_size,
+                                         OS_ERR                *p_err);
+
+void          OSCallEpCreate            (OS_CALL_EP            *p_ep,
                                          CPU_CHAR              *p_name,
-                                         OS_FLAGS               flags,
                                          OS_ERR                *p_err);
 
-#if (OS_CFG_FLAG_DEL_EN > 0u)
-OS_OBJ_QTY    OSFlagDel                 (OS_FLAG_GRP           *p_grp,
+#if (OS_CFG_CALL_DEL_EN > 0u)
+OS_OBJ_QTY    OSCallEpDel               (OS_CALL_EP            *p_ep,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 #endif
 
-OS_FLAGS      OSFlagPend                (OS_FLAG_GRP           *p_grp,
-                                         OS_FLAGS               flags,
+void         *OSCallRecv                (OS_CALL_EP            *p_ep,
                                          OS_TICK                timeout,
                                          OS_OPT                 opt,
-                                         CPU_TS                *p_ts,
+                                         OS_MSG_SIZE           *p_msg_size,
                                          OS_ERR                *p_err);
 
-#if (OS_CFG_FLAG_PEND_ABORT_EN > 0u)
-OS_OBJ_QTY    OSFlagPendAbort           (OS_FLAG_GRP           *p_grp,
-                                         OS_OPT                 opt,
+void          OSReply                   (void                  *p_reply,
+                                         OS_MSG_SIZE            reply_size,
                                          OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_CallEpClr              (OS_CALL_EP            *p_ep);
+
+#if (OS_CFG_DBG_EN > 0u)
+void          OS_CallEpDbgListAdd       (OS_CALL_EP            *p_ep);
+
+void          OS_CallEpDbgListRemove    (OS_CALL_EP            *p_ep);
 #endif
 
-OS_FLAGS      OSFlagPendGetFlagsRdy     (OS_ERR                *p_err);
+OS_PRIO       OS_CallSrvPrioGet         (OS_TCB                *p_tcb);
 
-OS_FLAGS      OSFlagPost                (OS_FLAG_GRP           *p_grp,
-                                         OS_FLAGS               flags,
-                                         OS_OPT                 opt,
+void          OS_CallTaskDel            (OS_TCB                *p_tcb);
+
+#endif
+
+
+/* ================================================================================================================== */
+/*                                                      SIGNALS                                                       */
+/* ================================================================================================================== */
+
+#if (OS_CFG_SIGNAL_EN > 0u)
+
+#if (OS_CFG_SIGNAL_COALESCE_EN > 0u)
+void          OSSignalCoalesceSet       (OS_SIGNAL             *p_signal,
+                                         OS_CTR                 threshold,
+                                         CPU_INT32U             window_us,
                                          OS_ERR                *p_err);
+#endif
+
+void          OSSignalCreate            (OS_SIGNAL             *p_signal,
+                                         CPU_CHAR             *p_name,
+                                         OS_ERR               *p_err);
+
+#if (OS_CFG_SIGNAL_DEL_EN > 0u)
+OS_OBJ_QTY    OSSignalDel               (OS_SIGNAL             *p_signal,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+#endif
+
+void          OSSignalPend              (OS_SIGNAL             *p_signal,
+                                         OS_TICK               timeout,
+                                         OS_OPT                opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR               *p_err);
+
+#if (OS_CFG_SIGNAL_PEND_ABORT_EN > 0u)
+OS_OBJ_QTY    OSSignalPendAbort         (OS_SIGNAL             *p_signal,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+#endif
+
+void          OSSignalPost              (OS_SIGNAL             *p_signal,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
 
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
-void          OS_FlagClr                (OS_FLAG_GRP           *p_grp);
+void          OS_SignalClr              (OS_SIGNAL             *p_signal);
 
-void          OS_FlagBlock              (OS_FLAG_GRP           *p_grp,
-                                         OS_FLAGS               flags,
-                                         OS_OPT                 opt,
-                                         OS_TICK                timeout);
+#if (OS_CFG_DBG_EN > 0u)
+void          OS_SignalDbgListAdd       (OS_SIGNAL             *p_signal);
+
+void          OS_SignalDbgListRemove    (OS_SIGNAL             *p_signal);
+#endif
+
+void          OS_SignalPendRemove       (OS_TCB                *p_tcb);
+
+#endif
+
+/* ================================================================================================================== */
+/*                                                     COMPLETIONS                                                    */
+/* ================================================================================================================== */
+
+#if (OS_CFG_COMPLETION_EN > 0u)
+
+#if (OS_CFG_WORKQ_EN > 0u)
+void          OSCompletionCallbackSet   (OS_COMPLETION         *p_comp,
+                                         OS_WORKQ              *p_workq,
+                                         OS_WORK               *p_work,
+                                         CPU_INT08U             prio,
+                                         OS_ERR               *p_err);
+#endif
+
+void          OSCompletionCreate        (OS_COMPLETION         *p_comp,
+                                         CPU_CHAR             *p_name,
+                                         OS_ERR               *p_err);
+
+#if (OS_CFG_COMPLETION_DEL_EN > 0u)
+OS_OBJ_QTY    OSCompletionDel           (OS_COMPLETION         *p_comp,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+#endif
+
+void          OSCompletionDone          (OS_COMPLETION         *p_comp,
+                                         CPU_INT32S             result,
+                                         void                  *p_data,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+
+void          OSCompletionReinit        (OS_COMPLETION         *p_comp,
+                                         OS_ERR               *p_err);
+
+CPU_INT32S    OSCompletionWait          (OS_COMPLETION         *p_comp,
+                                         OS_TICK               timeout,
+                                         OS_OPT                opt,
+                                         void                 **p_data,
+                                         OS_ERR               *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_CompletionClr          (OS_COMPLETION         *p_comp);
 
 #if (OS_CFG_DBG_EN > 0u)
-void          OS_FlagDbgListAdd         (OS_FLAG_GRP           *p_grp);
+void          OS_CompletionDbgListAdd   (OS_COMPLETION         *p_comp);
 
-void          OS_FlagDbgListRemove      (OS_FLAG_GRP           *p_grp);
+void          OS_CompletionDbgListRemove(OS_COMPLETION         *p_comp);
 #endif
 
-void          OS_FlagTaskRdy            (OS_TCB                *p_tcb,
-                                         OS_FLAGS               flags_rdy,
-                                         CPU_TS                 ts);
+void          OS_CompletionPendRemove   (OS_TCB                *p_tcb);
+
 #endif
 
 
 /* ================================================================================================================== */
-/*                                          FIXED SIZE MEMORY BLOCK MANAGEMENT                                        */
+/*                                                  SAMPLING PROFILER                                                 */
 /* ================================================================================================================== */
 
-#if (OS_CFG_MEM_EN > 0u)
+#if (OS_CFG_PROF_SAMPLE_EN > 0u)
 
-void          OSMemCreate               (OS_MEM                *p_mem,
-                                         CPU_CHAR              *p_name,
-                                         void                  *p_addr,
-                                         OS_MEM_QTY             n_blks,
-                                         OS_MEM_SIZE            blk_size,
+OS_OBJ_QTY    OSProfSampleRead          (OS_PROF_SAMPLE        *p_tbl,
+                                         OS_OBJ_QTY             nbr_max,
                                          OS_ERR                *p_err);
 
-void         *OSMemGet                  (OS_MEM                *p_mem,
+void          OSProfSampleStart         (OS_ERR                *p_err);
+
+void          OSProfSampleStop          (OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_ProfInit               (void);
+                                                                /* Called by the tick ISR of the port.                  */
+void          OS_ProfSample             (CPU_ADDR               pc);
+
+#endif
+
+
+/* ================================================================================================================== */
+/*                                               IDLE POWER MANAGEMENT                                                */
+/* ================================================================================================================== */
+
+#if (OS_CFG_TASK_IDLE_PM_EN > 0u)
+
+void          OSIdlePMStateAdd          (OS_IDLE_PM_STATE      *p_state,
+                                         CPU_CHAR              *p_name,
+                                         OS_IDLE_PM_FNCT        p_fnct,
+                                         CPU_TS                 entry_lat,
+                                         CPU_TS                 exit_lat,
                                          OS_ERR                *p_err);
 
-void          OSMemPut                  (OS_MEM                *p_mem,
-                                         void                  *p_blk,
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_IdlePMInit             (void);
+
+void          OS_IdlePMSleep            (void);
+
+#endif
+
+
+/* ================================================================================================================== */
+/*                                             THREADED INTERRUPT HANDLERS                                            */
+/* ================================================================================================================== */
+
+#if (OS_CFG_INT_THREAD_EN > 0u)
+
+void          OSIntThreadISR            (CPU_INT16U             irq);
+
+void          OSIntThreadRegister       (OS_INT_THREAD         *p_thread,
+                                         CPU_CHAR              *p_name,
+                                         CPU_INT16U             irq,
+                                         OS_INT_THREAD_TOP_FNCT p_top_fnct,
+                                         OS_INT_THREAD_FNCT     p_fnct,
+                                         void                  *p_arg,
+                                         OS_PRIO                prio,
+                                         CPU_STK               *p_stk_base,
+                                         CPU_STK_SIZE           stk_limit,
+                                         CPU_STK_SIZE           stk_size,
                                          OS_ERR                *p_err);
 
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
-#if (OS_CFG_DBG_EN > 0u)
-void          OS_MemDbgListAdd          (OS_MEM                *p_mem);
-#endif
-
-void          OS_MemInit                (OS_ERR                *p_err);
+void          OS_IntThreadInit          (void);
 
 #endif
 
 
+
 /* ================================================================================================================== */
-/*                                             MUTUAL EXCLUSION SEMAPHORES                                            */
+/*                                                      REACTORS                                                      */
 /* ================================================================================================================== */
 
-#if (OS_CFG_MUTEX_EN > 0u)
+#if (OS_CFG_REACTOR_EN > 0u)
 
-void          OSMutexCreate             (OS_MUTEX              *p_mutex,
+void          OSReactorCreate           (OS_REACTOR            *p_reactor,
                                          CPU_CHAR              *p_name,
                                          OS_ERR                *p_err);
 
-#if (OS_CFG_MUTEX_DEL_EN > 0u)
-OS_OBJ_QTY    OSMutexDel                (OS_MUTEX              *p_mutex,
+#if (OS_CFG_REACTOR_DEL_EN > 0u)
+OS_OBJ_QTY    OSReactorDel              (OS_REACTOR            *p_reactor,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 #endif
 
-void          OSMutexPend               (OS_MUTEX              *p_mutex,
+OS_OBJ_QTY    OSReactorRun              (OS_REACTOR            *p_reactor,
                                          OS_TICK                timeout,
-                                         OS_OPT                 opt,
-                                         CPU_TS                *p_ts,
                                          OS_ERR                *p_err);
 
-#if (OS_CFG_MUTEX_PEND_ABORT_EN > 0u)
-OS_OBJ_QTY    OSMutexPendAbort          (OS_MUTEX              *p_mutex,
-                                         OS_OPT                 opt,
+void          OSReactorSrcAdd           (OS_REACTOR            *p_reactor,
+                                         OS_REACTOR_SRC        *p_src,
+                                         CPU_INT08U             id,
+                                         OS_PEND_OBJ           *p_obj,
+                                         OS_REACTOR_FNCT        p_fnct,
+                                         void                  *p_arg,
                                          OS_ERR                *p_err);
-#endif
 
-void          OSMutexPost               (OS_MUTEX              *p_mutex,
+void          OSReactorSrcRemove        (OS_REACTOR_SRC        *p_src,
+                                         OS_ERR                *p_err);
+
+void          OSReactorSrcSignal        (OS_REACTOR_SRC        *p_src,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_TMR_EN > 0u)
+void          OSReactorTmrCallback      (void                  *p_tmr,
+                                         void                  *p_arg);
+#endif
 
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
-void          OS_MutexClr               (OS_MUTEX              *p_mutex);
+void          OS_ReactorClr             (OS_REACTOR            *p_reactor);
 
 #if (OS_CFG_DBG_EN > 0u)
-void          OS_MutexDbgListAdd        (OS_MUTEX              *p_mutex);
+void          OS_ReactorDbgListAdd      (OS_REACTOR            *p_reactor);
 
-void          OS_MutexDbgListRemove     (OS_MUTEX              *p_mutex);
+void          OS_ReactorDbgListRemove   (OS_REACTOR            *p_reactor);
 #endif
 
-void          OS_MutexGrpAdd            (OS_TCB                *p_tcb,
-                                         OS_MUTEX              *p_mutex);
-
-void          OS_MutexGrpRemove         (OS_TCB                *p_tcb,
-                                         OS_MUTEX              *p_mutex);
+void          OS_ReactorPendRemove      (OS_TCB                *p_tcb);
 
-OS_PRIO       OS_MutexGrpPrioFindHighest(OS_TCB                *p_tcb);
+CPU_BOOLEAN   OS_ReactorSrcRdy          (OS_REACTOR_SRC        *p_src,
+                                         CPU_TS                 ts);
 
-void          OS_MutexGrpPostAll        (OS_TCB                *p_tcb);
 #endif
 
 
 /* ================================================================================================================== */
-/*                                                   MESSAGE QUEUES                                                   */
+/*                                                 TASK MANAGEMENT                                                    */
 /* ================================================================================================================== */
 
-#if (OS_CFG_Q_EN > 0u)
+#if (OS_CFG_TASK_CHANGE_PRIO_EN > 0u)
+void          OSTaskChangePrio          (OS_TCB                *p_tcb,
+                                         OS_PRIO                prio_new,
+                                         OS_ERR               *p_err);
+#endif
 
-void          OSQCreate                 (OS_Q                  *p_q,
-                                         CPU_CHAR              *p_name,
-                                         OS_MSG_QTY             max_qty,
-                                         OS_ERR                *p_err);
+void          OSTaskCreate              (OS_TCB                *p_tcb,
+                                         CPU_CHAR             *p_name,
+                                         OS_TASK_PTR            p_task,
+                                         void                  *p_arg,
+                                         OS_PRIO                prio,
+                                         CPU_STK               *p_stk_base,
+                                         CPU_STK_SIZE           stk_limit,
+                                         CPU_STK_SIZE           stk_size,
+                                         OS_MSG_QTY             q_size,
+                                         OS_TICK                time_quanta,
+                                         void                  *p_ext,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
 
-#if (OS_CFG_Q_DEL_EN > 0u)
-OS_OBJ_QTY    OSQDel                    (OS_Q                  *p_q,
-                                         OS_OPT                 opt,
-                                         OS_ERR                *p_err);
+#if (OS_CFG_TASK_CREATE_TBL_EN > 0u)
+void          OSTaskCreateTbl           (const  OS_TASK_CFG    *p_cfg_tbl,
+                                         OS_OBJ_QTY             nbr_tasks,
+                                         OS_ERR               *p_err);
 #endif
 
-#if (OS_CFG_Q_FLUSH_EN > 0u)
-OS_MSG_QTY    OSQFlush                  (OS_Q                  *p_q,
-                                         OS_ERR                *p_err);
+#if (OS_CFG_TASK_DEL_EN > 0u)
+void          OSTaskDel                 (OS_TCB                *p_tcb,
+                                         OS_ERR               *p_err);
 #endif
 
-void         *OSQPend                   (OS_Q                  *p_q,
-                                         OS_TICK                timeout,
-                                         OS_OPT                 opt,
+#if (OS_CFG_TASK_HIST_EN > 0u)
+void          OSTaskHistGet             (OS_TCB                *p_tcb,
+                                         OS_TASK_HIST          *p_hist,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+
+#if (OS_CFG_TASK_HIST_PRIO_EN > 0u)
+void          OSTaskHistPrioGet         (OS_PRIO                prio,
+                                         OS_TASK_HIST_PRIO     *p_hist,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+#endif
+#endif
+
+#if (OS_CFG_TASK_NOTIFY_EN > 0u)
+void          OSTaskNotify              (OS_TCB                *p_tcb,
+                                         OS_NOTIFY_ID           id,
+                                         OS_NOTIFY              val,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+
+OS_NOTIFY     OSTaskNotifyWait          (OS_NOTIFY_ID           id,
+                                         OS_NOTIFY              clr_mask,
+                                         OS_TICK               timeout,
+                                         OS_OPT                opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR               *p_err);
+#endif
+
+#if (OS_CFG_TASK_Q_EN > 0u)
+OS_MSG_QTY    OSTaskQFlush              (OS_TCB                *p_tcb,
+                                         OS_ERR               *p_err);
+
+void         *OSTaskQPend               (OS_TICK               timeout,
+                                         OS_OPT                opt,
                                          OS_MSG_SIZE           *p_msg_size,
                                          CPU_TS                *p_ts,
-                                         OS_ERR                *p_err);
+                                         OS_ERR               *p_err);
 
-#if (OS_CFG_Q_PEND_ABORT_EN > 0u)
-OS_OBJ_QTY    OSQPendAbort              (OS_Q                  *p_q,
-                                         OS_OPT                 opt,
-                                         OS_ERR                *p_err);
+#if (OS_CFG_TIME_HR_EN > 0u)
+void         *OSTaskQPendUs             (CPU_INT32U             timeout_us,
+                                         OS_OPT                opt,
+                                         OS_MSG_SIZE           *p_msg_size,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR               *p_err);
 #endif
 
-void          OSQPost                   (OS_Q                  *p_q,
+CPU_BOOLEAN   OSTaskQPendAbort          (OS_TCB                *p_tcb,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+
+void          OSTaskQPost               (OS_TCB                *p_tcb,
                                          void                  *p_void,
                                          OS_MSG_SIZE            msg_size,
-                                         OS_OPT                 opt,
-                                         OS_ERR                *p_err);
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
 
-/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+#if (OS_CFG_TASK_Q_POST_N_EN > 0u)
+void          OSTaskQPostN              (OS_TCB                *p_tcb,
+                                         OS_MSG_ENTRY          *p_msg_tbl,
+                                         OS_MSG_QTY             nbr_msgs,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+#endif
 
-void          OS_QClr                   (OS_Q                  *p_q);
+#if (OS_CFG_MSG_Q_STAT_EN > 0u)
+void          OSTaskQStatGet            (OS_TCB                *p_tcb,
+                                         OS_MSG_Q_STAT         *p_stat,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
 
-#if (OS_CFG_DBG_EN > 0u)
-void          OS_QDbgListAdd            (OS_Q                  *p_q);
+void          OSTaskQStatThresholdSet   (OS_TCB                *p_tcb,
+                                         CPU_TS                 threshold,
+                                         OS_ERR               *p_err);
+#endif
 
-void          OS_QDbgListRemove         (OS_Q                  *p_q);
 #endif
 
+#if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
+OS_REG        OSTaskRegGet              (OS_TCB                *p_tcb,
+                                         OS_REG_ID              id,
+                                         OS_ERR               *p_err);
+
+OS_REG_ID     OSTaskRegGetID            (OS_ERR               *p_err);
+
+void          OSTaskRegSet              (OS_TCB                *p_tcb,
+                                         OS_REG_ID              id,
+                                         OS_REG                 value,
+                                         OS_ERR               *p_err);
 #endif
 
+#if (OS_CFG_TASK_SUSPEND_EN > 0u)
+void          OSTaskResume              (OS_TCB                *p_tcb,
+                                         OS_ERR               *p_err);
 
-/* ================================================================================================================== */
-/*                                                     SEMAPHORES                                                     */
-/* ================================================================================================================== */
+void          OSTaskSuspend             (OS_TCB                *p_tcb,
+                                         OS_ERR               *p_err);
+#endif
 
-#if (OS_CFG_SEM_EN > 0u)
+OS_SEM_CTR    OSTaskSemPend             (OS_TICK               timeout,
+                                         OS_OPT                opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR               *p_err);
 
-void          OSSemCreate               (OS_SEM                *p_sem,
-                                         CPU_CHAR              *p_name,
+#if (OS_CFG_TIME_HR_EN > 0u)
+OS_SEM_CTR    OSTaskSemPendUs           (CPU_INT32U             timeout_us,
+                                         OS_OPT                opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR               *p_err);
+#endif
+
+#if (OS_CFG_TASK_SEM_PEND_ABORT_EN > 0u)
+CPU_BOOLEAN   OSTaskSemPendAbort        (OS_TCB                *p_tcb,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+#endif
+
+OS_SEM_CTR    OSTaskSemPost             (OS_TCB                *p_tcb,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+
+#if (OS_CFG_POST_FROM_ISR_EN > 0u)
+OS_SEM_CTR    OSTaskSemPostFromISR      (OS_TCB                *p_tcb,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+#endif
+
+OS_SEM_CTR    OSTaskSemSet              (OS_TCB                *p_tcb,
                                          OS_SEM_CTR             cnt,
-                                         OS_ERR                *p_err);
+                                         OS_ERR               *p_err);
 
-#if (OS_CFG_SEM_DEL_EN > 0u)
-OS_OBJ_QTY    OSSemDel                  (OS_SEM                *p_sem,
-                                         OS_OPT                 opt,
-                                         OS_ERR                *p_err);
+#if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u)
+void          OSTaskStkChk              (OS_TCB                *p_tcb,
+                                         CPU_STK_SIZE          *p_free,
+                                         CPU_STK_SIZE          *p_used,
+                                         OS_ERR               *p_err);
 #endif
 
-OS_SEM_CTR    OSSemPend                 (OS_SEM                *p_sem,
-                                         OS_TICK                timeout,
-                                         OS_OPT                 opt,
-                                         CPU_TS                *p_ts,
-                                         OS_ERR                *p_err);
+#if (OS_CFG_TASK_STK_FIT_EN > 0u)
+void          OSTaskStkFitHeapSet       (OS_HEAP               *p_heap,
+                                         OS_ERR               *p_err);
+#endif
 
-#if (OS_CFG_SEM_PEND_ABORT_EN > 0u)
-OS_OBJ_QTY    OSSemPendAbort            (OS_SEM                *p_sem,
-                                         OS_OPT                 opt,
+#if (OS_CFG_TASK_STK_PROFILE_EN > 0u)
+OS_OBJ_QTY    OSTaskStkProfileInit      (OS_STK_PROFILE_TBL    *p_tbl,
+                                         OS_ERR               *p_err);
+
+CPU_STK_SIZE  OSTaskStkProfileSizeGet   (OS_TASK_PTR            p_task,
+                                         OS_ERR               *p_err);
+#endif
+
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+CPU_BOOLEAN   OSTaskStkRedzoneChk       (OS_TCB                *p_tcb);
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+void          OSSafetyCriticalStart     (void);
+#endif
+
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
+void          OSTaskTimeQuantaSet       (OS_TCB                *p_tcb,
+                                         OS_TICK                time_quanta,
+                                         OS_ERR               *p_err);
+#endif
+
+#if (OS_CFG_SLACK_EN > 0u) && (OS_CFG_TICK_EN > 0u)
+void          OSTaskSlackSet            (OS_TCB                *p_tcb,
+                                         OS_TICK                slack,
+                                         OS_ERR               *p_err);
+#endif
+
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+void          OSTaskBudgetSet           (OS_TCB                *p_tcb,
+                                         CPU_TS                 budget,
+                                         OS_TICK                period,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+#endif
+
+#if (OS_CFG_STAT_GOV_EN > 0u)
+void          OSTaskPerfLvlSet          (OS_TCB                *p_tcb,
+                                         OS_PERF_LVL            lvl,
+                                         OS_ERR               *p_err);
+#endif
+
+#if (OS_CFG_TASK_FAIR_EN > 0u)
+void          OSTaskFairSet             (OS_TCB                *p_tcb,
+                                         CPU_INT16U             weight,
                                          OS_ERR                *p_err);
 #endif
 
-OS_SEM_CTR    OSSemPost                 (OS_SEM                *p_sem,
+#if (OS_TASK_PERIOD_EN > 0u)
+void          OSTaskPeriodSet           (OS_TCB                *p_tcb,
+                                         OS_TICK                period,
                                          OS_OPT                 opt,
-                                         OS_ERR                *p_err);
+                                         OS_ERR               *p_err);
 
-#if (OS_CFG_SEM_SET_EN > 0u)
-void          OSSemSet                  (OS_SEM                *p_sem,
-                                         OS_SEM_CTR             cnt,
-                                         OS_ERR                *p_err);
+OS_CTR        OSTaskPeriodWait          (OS_ERR               *p_err);
 #endif
 
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
-void          OS_SemClr                 (OS_SEM                *p_sem);
+void          OS_TaskBlock              (OS_TCB                *p_tcb,
+                                         OS_TICK               timeout);
+
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+void          OS_TaskBudgetRemove       (OS_TCB                *p_tcb);
+
+void          OS_TaskBudgetSw           (OS_TCB                *p_tcb);
+
+void          OS_TaskBudgetTick         (void);
+#endif
+
+#if (OS_CFG_TASK_FAIR_EN > 0u)
+void          OS_TaskFairSw             (OS_TCB                *p_tcb);
+
+void          OS_TaskFairTick           (void);
+#endif
 
 #if (OS_CFG_DBG_EN > 0u)
-void          OS_SemDbgListAdd          (OS_SEM                *p_sem);
+void          OS_TaskDbgListAdd         (OS_TCB                *p_tcb);
 
-void          OS_SemDbgListRemove       (OS_SEM                *p_sem);
+void          OS_TaskDbgListRemove      (OS_TCB                *p_tcb);
+#endif
+
+#if (OS_CFG_TASK_HIST_EN > 0u)
+void          OS_TaskHistRdy            (OS_TCB                *p_tcb);
+
+void          OS_TaskHistSwIn           (OS_TCB                *p_tcb);
+#endif
+
+void          OS_TaskInit               (OS_ERR               *p_err);
+
+void          OS_TaskInitTCB            (OS_TCB                *p_tcb);
+
+#if (OS_CFG_TASK_SUSPEND_EN > 0u)
+void          OS_TaskResume             (OS_TCB                *p_tcb,
+                                         OS_ERR               *p_err);
+#endif
+
+void          OS_TaskReturn             (void);
+
+void          OS_TaskStkClr             (CPU_STK               *p_stk,
+                                         CPU_STK_SIZE           size);
+
+#if (OS_CFG_TASK_STK_CLR_DEFER_EN > 0u)
+void          OS_TaskStkClrDefer        (void);
+
+void          OS_TaskStkClrRemove       (OS_TCB                *p_tcb);
+#endif
+
+#if (OS_CFG_TASK_STK_PROFILE_EN > 0u)
+void          OS_TaskStkProfileUpdate   (OS_TCB                *p_tcb);
+#endif
+
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+CPU_BOOLEAN   OS_TaskStkRedzoneChk      (CPU_STK               *p_base,
+                                         CPU_STK_SIZE           stk_size);
+
+void          OS_TaskStkRedzoneInit     (CPU_STK               *p_base,
+                                         CPU_STK_SIZE           stk_size);
 #endif
 
+#if (OS_CFG_TASK_SUSPEND_EN > 0u)
+void          OS_TaskSuspend            (OS_TCB                *p_tcb,
+                                         OS_ERR               *p_err);
 #endif
 
+void          OS_TaskChangePrio(         OS_TCB                *p_tcb,
+                                         OS_PRIO                prio_new);
+
 
 /* ================================================================================================================== */
-/*                                                 TASK MANAGEMENT                                                    */
+/*                                                     TASK GROUPS                                                    */
 /* ================================================================================================================== */
 
-#if (OS_CFG_TASK_CHANGE_PRIO_EN > 0u)
-void          OSTaskChangePrio          (OS_TCB                *p_tcb,
-                                         OS_PRIO                prio_new,
-                                         OS_ERR                *p_err);
+#if (OS_CFG_TASK_GRP_EN > 0u)
+
+void          OSTaskGrpAdd              (OS_TASK_GRP           *p_grp,
+                                         OS_TCB                *p_tcb,
+                                         OS_ERR               *p_err);
+
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+OS_CPU_USAGE  OSTaskGrpCPUUsageGet      (OS_TASK_GRP           *p_grp,
+                                         OS_ERR               *p_err);
 #endif
 
-void          OSTaskCreate              (OS_TCB                *p_tcb,
+void          OSTaskGrpCreate           (OS_TASK_GRP           *p_grp,
                                          CPU_CHAR              *p_name,
-                                         OS_TASK_PTR            p_task,
-                                         void                  *p_arg,
-                                         OS_PRIO                prio,
-                                         CPU_STK               *p_stk_base,
-                                         CPU_STK_SIZE           stk_limit,
-                                         CPU_STK_SIZE           stk_size,
-                                         OS_MSG_QTY             q_size,
-                                         OS_TICK                time_quanta,
-                                         void                  *p_ext,
-                                         OS_OPT                 opt,
-                                         OS_ERR                *p_err);
+                                         OS_ERR               *p_err);
 
-#if (OS_CFG_TASK_DEL_EN > 0u)
-void          OSTaskDel                 (OS_TCB                *p_tcb,
-                                         OS_ERR                *p_err);
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+OS_CYCLES     OSTaskGrpCyclesGet        (OS_TASK_GRP           *p_grp,
+                                         OS_ERR               *p_err);
 #endif
 
-#if (OS_CFG_TASK_Q_EN > 0u)
-OS_MSG_QTY    OSTaskQFlush              (OS_TCB                *p_tcb,
-                                         OS_ERR                *p_err);
-
-void         *OSTaskQPend               (OS_TICK                timeout,
-                                         OS_OPT                 opt,
-                                         OS_MSG_SIZE           *p_msg_size,
-                                         CPU_TS                *p_ts,
-                                         OS_ERR                *p_err);
+void          OSTaskGrpDel              (OS_TASK_GRP           *p_grp,
+                                         OS_ERR               *p_err);
 
-CPU_BOOLEAN   OSTaskQPendAbort          (OS_TCB                *p_tcb,
-                                         OS_OPT                 opt,
-                                         OS_ERR                *p_err);
+void          OSTaskGrpRemove           (OS_TASK_GRP           *p_grp,
+                                         OS_TCB                *p_tcb,
+                                         OS_ERR               *p_err);
 
-void          OSTaskQPost               (OS_TCB                *p_tcb,
-                                         void                  *p_void,
-                                         OS_MSG_SIZE            msg_size,
-                                         OS_OPT                 opt,
-                                         OS_ERR                *p_err);
+#if (OS_CFG_TASK_SUSPEND_EN > 0u)
+void          OSTaskGrpResume           (OS_TASK_GRP           *p_grp,
+                                         OS_ERR               *p_err);
 
+void          OSTaskGrpSuspend          (OS_TASK_GRP           *p_grp,
+                                         OS_ERR               *p_err);
 #endif
 
-#if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
-OS_REG        OSTaskRegGet              (OS_TCB                *p_tcb,
-                                         OS_REG_ID              id,
-                                         OS_ERR                *p_err);
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
-OS_REG_ID     OSTaskRegGetID            (OS_ERR                *p_err);
+void          OS_TaskGrpRemove          (OS_TCB                *p_tcb);
 
-void          OSTaskRegSet              (OS_TCB                *p_tcb,
-                                         OS_REG_ID              id,
-                                         OS_REG                 value,
-                                         OS_ERR                *p_err);
 #endif
 
-#if (OS_CFG_TASK_SUSPEND_EN > 0u)
-void          OSTaskResume              (OS_TCB                *p_tcb,
-                                         OS_ERR                *p_err);
 
-void          OSTaskSuspend             (OS_TCB                *p_tcb,
-                                         OS_ERR                *p_err);
-#endif
+/* ================================================================================================================== */
+/*                                                     TASK POOLS                                                     */
+/* ================================================================================================================== */
 
-OS_SEM_CTR    OSTaskSemPend             (OS_TICK                timeout,
-                                         OS_OPT                 opt,
-                                         CPU_TS                *p_ts,
-                                         OS_ERR                *p_err);
+#if (OS_CFG_TASK_POOL_EN > 0u)
 
-#if (OS_CFG_TASK_SEM_PEND_ABORT_EN > 0u)
-CPU_BOOLEAN   OSTaskSemPendAbort        (OS_TCB                *p_tcb,
-                                         OS_OPT                 opt,
-                                         OS_ERR                *p_err);
-#endif
+void          OSTaskPoolCreate          (OS_TASK_POOL          *p_pool,
+                                         CPU_CHAR             *p_name,
+                                         OS_TCB                *p_tcb_tbl,
+                                         CPU_STK               *p_stk_tbl,
+                                         OS_OBJ_QTY             nbr_slots,
+                                         CPU_STK_SIZE           stk_size,
+                                         CPU_STK_SIZE           stk_limit,
+                                         OS_PRIO                prio,
+                                         OS_MSG_QTY             q_size,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
 
-OS_SEM_CTR    OSTaskSemPost             (OS_TCB                *p_tcb,
-                                         OS_OPT                 opt,
-                                         OS_ERR                *p_err);
+OS_TCB       *OSTaskPoolRun             (OS_TASK_POOL          *p_pool,
+                                         CPU_CHAR             *p_name,
+                                         OS_TASK_PTR            p_task,
+                                         void                  *p_arg,
+                                         OS_ERR               *p_err);
 
-OS_SEM_CTR    OSTaskSemSet              (OS_TCB                *p_tcb,
-                                         OS_SEM_CTR             cnt,
-                                         OS_ERR                *p_err);
+OS_OBJ_QTY    OSTaskPoolUsedGet         (OS_TASK_POOL          *p_pool,
+                                         OS_OBJ_QTY            *p_used_max,
+                                         OS_ERR               *p_err);
 
-#if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u)
-void          OSTaskStkChk              (OS_TCB                *p_tcb,
-                                         CPU_STK_SIZE          *p_free,
-                                         CPU_STK_SIZE          *p_used,
-                                         OS_ERR                *p_err);
-#endif
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
-#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
-CPU_BOOLEAN   OSTaskStkRedzoneChk       (OS_TCB                *p_tcb);
-#endif
+void          OS_TaskPoolSlotFree       (OS_TCB                *p_tcb);
 
-#ifdef OS_SAFETY_CRITICAL_IEC61508
-void          OSSafetyCriticalStart     (void);
 #endif
 
-#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
-void          OSTaskTimeQuantaSet       (OS_TCB                *p_tcb,
-                                         OS_TICK                time_quanta,
-                                         OS_ERR                *p_err);
-#endif
 
-/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+/* ================================================================================================================== */
+/*                                                  TASK STACK GROUPS                                                 */
+/* ================================================================================================================== */
 
-void          OS_TaskBlock              (OS_TCB                *p_tcb,
-                                         OS_TICK                timeout);
+#if (OS_CFG_TASK_STK_GRP_EN > 0u)
 
-#if (OS_CFG_DBG_EN > 0u)
-void          OS_TaskDbgListAdd         (OS_TCB                *p_tcb);
+void          OSTaskStkGrpCreate        (OS_TASK_STK_GRP       *p_grp,
+                                         CPU_CHAR              *p_name,
+                                         CPU_STK               *p_stk_base,
+                                         CPU_STK_SIZE           stk_limit,
+                                         CPU_STK_SIZE           stk_size,
+                                         OS_ERR               *p_err);
 
-void          OS_TaskDbgListRemove      (OS_TCB                *p_tcb);
-#endif
+void          OSTaskStkGrpDormant       (OS_ERR               *p_err);
 
-void          OS_TaskInit               (OS_ERR                *p_err);
+void          OSTaskStkGrpTaskCreate    (OS_TASK_STK_GRP       *p_grp,
+                                         OS_TCB                *p_tcb,
+                                         CPU_CHAR              *p_name,
+                                         OS_TASK_PTR            p_task,
+                                         void                  *p_arg,
+                                         OS_PRIO                prio,
+                                         OS_MSG_QTY             q_size,
+                                         OS_TICK                time_quanta,
+                                         void                  *p_ext,
+                                         OS_OPT                 opt,
+                                         OS_ERR               *p_err);
 
-void          OS_TaskInitTCB            (OS_TCB                *p_tcb);
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
-void          OS_TaskReturn             (void);
+void          OS_TaskStkGrpRemove       (OS_TCB                *p_tcb);
 
-#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
-CPU_BOOLEAN   OS_TaskStkRedzoneChk      (CPU_STK               *p_base,
-                                         CPU_STK_SIZE           stk_size);
+void          OS_TaskStkGrpStart        (OS_TCB                *p_tcb,
+                                         OS_ERR               *p_err);
 
-void          OS_TaskStkRedzoneInit     (CPU_STK               *p_base,
-                                         CPU_STK_SIZE           stk_size);
 #endif
 
-void          OS_TaskChangePrio(         OS_TCB                *p_tcb,
-                                         OS_PRIO                prio_new);
-
 
 /* ================================================================================================================== */
 /*                                                 TIME MANAGEMENT                                                    */
 /* ================================================================================================================== */
 
 void          OSTimeDly                 (OS_TICK                dly,
-                                         OS_OPT                 opt,
-                                         OS_ERR                *p_err);
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
 
 #if (OS_CFG_TIME_DLY_HMSM_EN > 0u)
 void          OSTimeDlyHMSM             (CPU_INT16U             hours,
                                          CPU_INT16U             minutes,
                                          CPU_INT16U             seconds,
                                          CPU_INT32U             milli,
-                                         OS_OPT                 opt,
-                                         OS_ERR                *p_err);
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
 #endif
 
 #if (OS_CFG_TIME_DLY_RESUME_EN > 0u)
 void          OSTimeDlyResume           (OS_TCB                *p_tcb,
-                                         OS_ERR                *p_err);
+                                         OS_ERR               *p_err);
+#endif
+
+#if (OS_CFG_TIME_ABS_EN > 0u)
+void          OSTimeDlyUntil            (OS_TICK                tick,
+                                         OS_ERR               *p_err);
+#endif
+
+#if (OS_CFG_TIME_HR_EN > 0u)
+void          OSTimeDlyUs               (CPU_INT32U             us,
+                                         OS_ERR               *p_err);
 #endif
 
-OS_TICK       OSTimeGet                 (OS_ERR                *p_err);
+OS_TICK       OSTimeGet                 (OS_ERR               *p_err);
 
 void          OSTimeSet                 (OS_TICK                ticks,
-                                         OS_ERR                *p_err);
+                                         OS_ERR               *p_err);
 
 void          OSTimeTick                (void);
 
@@ -1797,6 +6784,15 @@ void          OSTimeTick                (void);
 void          OSTimeDynTick             (OS_TICK                ticks);
 #endif
 
+#if (OS_CFG_TIME_HR_EN > 0u)
+void          OSTimeTickHr              (void);
+#endif
+
+#if (OS_CFG_TICK_RATE_SET_EN > 0u)
+void          OSTickRateSet             (OS_RATE_HZ             rate_hz,
+                                         OS_ERR               *p_err);
+#endif
+
 
 /* ================================================================================================================== */
 /*                                                 TIMER MANAGEMENT                                                   */
@@ -1804,38 +6800,59 @@ void          OSTimeDynTick             (OS_TICK                ticks);
 
 #if (OS_CFG_TMR_EN > 0u)
 void          OSTmrCreate               (OS_TMR                *p_tmr,
-                                         CPU_CHAR              *p_name,
+                                         CPU_CHAR             *p_name,
                                          OS_TICK                dly,
                                          OS_TICK                period,
-                                         OS_OPT                 opt,
+                                         OS_OPT                opt,
                                          OS_TMR_CALLBACK_PTR    p_callback,
                                          void                  *p_callback_arg,
-                                         OS_ERR                *p_err);
+                                         OS_ERR               *p_err);
 
 CPU_BOOLEAN   OSTmrDel                  (OS_TMR                *p_tmr,
-                                         OS_ERR                *p_err);
+                                         OS_ERR               *p_err);
 
 void          OSTmrSet                  (OS_TMR                *p_tmr,
                                          OS_TICK                dly,
                                          OS_TICK                period,
                                          OS_TMR_CALLBACK_PTR    p_callback,
                                          void                  *p_callback_arg,
-                                         OS_ERR                *p_err);
+                                         OS_ERR               *p_err);
 
 OS_TICK       OSTmrRemainGet            (OS_TMR                *p_tmr,
-                                         OS_ERR                *p_err);
+                                         OS_ERR               *p_err);
+
+#if (OS_CFG_SLACK_EN > 0u)
+void          OSTmrSlackSet             (OS_TMR                *p_tmr,
+                                         OS_TICK                slack,
+                                         OS_ERR               *p_err);
+#endif
 
 CPU_BOOLEAN   OSTmrStart                (OS_TMR                *p_tmr,
-                                         OS_ERR                *p_err);
+                                         OS_ERR               *p_err);
 
 OS_STATE      OSTmrStateGet             (OS_TMR                *p_tmr,
-                                         OS_ERR                *p_err);
+                                         OS_ERR               *p_err);
 
 CPU_BOOLEAN   OSTmrStop                 (OS_TMR                *p_tmr,
-                                         OS_OPT                 opt,
+                                         OS_OPT                opt,
                                          void                  *p_callback_arg,
+                                         OS_ERR               *p_err);
+
+#if (OS_CFG_TMR_SVC_EN > 0u)
+void          OSTmrSvcCreate            (OS_TMR_SVC            *p_svc,
+                                         CPU_CHAR              *p_name,
+                                         OS_TCB                *p_tcb,
+                                         OS_PRIO                prio,
+                                         CPU_STK               *p_stk_base,
+                                         CPU_STK_SIZE           stk_limit,
+                                         CPU_STK_SIZE           stk_size,
                                          OS_ERR                *p_err);
 
+void          OSTmrSvcSet               (OS_TMR                *p_tmr,
+                                         OS_TMR_SVC            *p_svc,
+                                         OS_ERR                *p_err);
+#endif
+
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
 void          OS_TmrClr                 (OS_TMR                *p_tmr);
@@ -1846,7 +6863,11 @@ void          OS_TmrDbgListAdd          (OS_TMR                *p_tmr);
 void          OS_TmrDbgListRemove       (OS_TMR                *p_tmr);
 #endif
 
-void          OS_TmrInit                (OS_ERR                *p_err);
+void          OS_TmrInit                (OS_ERR               *p_err);
+
+#if (OS_CFG_TMR_ISR_EN > 0u)
+void          OS_TmrIsrUpdate           (void);
+#endif
 
 void          OS_TmrLink                (OS_TMR                *p_tmr,
                                          OS_TICK                time);
@@ -1854,38 +6875,132 @@ void          OS_TmrLink                (OS_TMR                *p_tmr,
 void          OS_TmrUnlink              (OS_TMR                *p_tmr,
                                          OS_TICK                time);
 
+#if (OS_CFG_TICK_RATE_SET_EN > 0u)
+void          OS_TmrLockAll             (void);
+
+void          OS_TmrRescale             (OS_RATE_HZ             rate_hz_prev,
+                                         OS_RATE_HZ             rate_hz);
+#endif
+
 void          OS_TmrTask                (void                  *p_arg);
 
 #endif
 
 
+/* ================================================================================================================== */
+/*                                                    WORK QUEUES                                                     */
+/* ================================================================================================================== */
+
+#if (OS_CFG_WORKQ_EN > 0u)
+
+void          OSWorkQCreate             (OS_WORKQ              *p_workq,
+                                         CPU_CHAR             *p_name,
+                                         OS_TCB                *p_tcb_tbl,
+                                         CPU_STK               *p_stk_tbl,
+                                         OS_OBJ_QTY             nbr_workers,
+                                         CPU_STK_SIZE           stk_size,
+                                         CPU_STK_SIZE           stk_limit,
+                                         OS_PRIO                prio,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+
+void          OSWorkCreate              (OS_WORK               *p_work,
+                                         CPU_CHAR             *p_name,
+                                         OS_WORK_FNCT           p_fnct,
+                                         void                  *p_arg,
+                                         OS_ERR               *p_err);
+
+void          OSWorkPost                (OS_WORKQ              *p_workq,
+                                         OS_WORK               *p_work,
+                                         CPU_INT08U             prio,
+                                         OS_ERR               *p_err);
+
+void          OSWorkSubmit              (OS_WORKQ              *p_workq,
+                                         OS_WORK               *p_work,
+                                         CPU_INT08U             prio,
+                                         OS_ERR               *p_err);
+
+#if (OS_CFG_TMR_EN > 0u)
+void          OSWorkSubmitDly           (OS_WORKQ              *p_workq,
+                                         OS_WORK               *p_work,
+                                         CPU_INT08U             prio,
+                                         OS_TICK                dly,
+                                         OS_ERR               *p_err);
+#endif
+
+void          OSWorkCancel              (OS_WORK               *p_work,
+                                         OS_ERR               *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_WorkQTask              (void                  *p_arg);
+
+#endif
+
+
+/* ================================================================================================================== */
+/*                                                 SOFTWARE WATCHDOG                                                  */
+/* ================================================================================================================== */
+
+#if (OS_CFG_WDOG_EN > 0u)
+
+void          OSWdogCheckIn             (OS_OBJ_QTY             id);
+
+OS_OBJ_QTY    OSWdogReg                 (OS_TCB                *p_tcb,
+                                         OS_TICK                deadline,
+                                         OS_ERR                *p_err);
+
+void          OSWdogStart               (OS_WDOG_HOOK           p_hook,
+                                         OS_TICK                period,
+                                         OS_ERR                *p_err);
+
+void          OSWdogUnreg               (OS_OBJ_QTY             id,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_WdogInit               (void);
+
+#endif
+
+
 /* ================================================================================================================== */
 /*                                          TASK LOCAL STORAGE (TLS) SUPPORT                                          */
 /* ================================================================================================================== */
 
 #if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
-OS_TLS_ID  OS_TLS_GetID       (OS_ERR              *p_err);
+OS_TLS_ID  OS_TLS_GetID       (OS_ERR             *p_err);
 
 OS_TLS     OS_TLS_GetValue    (OS_TCB              *p_tcb,
                                OS_TLS_ID            id,
-                               OS_ERR              *p_err);
+                               OS_ERR             *p_err);
 
-void       OS_TLS_Init        (OS_ERR              *p_err);
+void       OS_TLS_Init        (OS_ERR             *p_err);
 
 void       OS_TLS_SetValue    (OS_TCB              *p_tcb,
                                OS_TLS_ID            id,
                                OS_TLS               value,
-                               OS_ERR              *p_err);
+                               OS_ERR             *p_err);
 
 void       OS_TLS_SetDestruct (OS_TLS_ID            id,
                                OS_TLS_DESTRUCT_PTR  p_destruct,
-                               OS_ERR              *p_err);
+                               OS_ERR             *p_err);
 
 void       OS_TLS_TaskCreate  (OS_TCB              *p_tcb);
 
 void       OS_TLS_TaskDel     (OS_TCB              *p_tcb);
 
 void       OS_TLS_TaskSw      (void);
+
+#if (OS_CFG_TLS_MALLOC_ARENA_EN > 0u)                           /* Only provided by the NewLib implementation         */
+void       OS_TLS_ArenaCfg    (OS_SLAB             *p_slab,
+                               OS_ERR             *p_err);
+
+void       OS_TLS_ArenaSet    (OS_TCB              *p_tcb,
+                               OS_MEM_MAG          *p_mag_tbl,
+                               OS_MEM_QTY           mag_size,
+                               OS_ERR             *p_err);
+#endif
 #endif
 
 
@@ -1893,50 +7008,113 @@ void       OS_TLS_TaskSw      (void);
 /*                                                    MISCELLANEOUS                                                   */
 /* ================================================================================================================== */
 
-void          OSInit                    (OS_ERR                *p_err);
+#if (OS_CFG_DBG_EN > 0u)
+CPU_CHAR     *OSDbgPendNameGet          (OS_TCB                *p_tcb);
+
+CPU_CHAR     *OSDbgWaiterNameGet        (void                  *p_obj);
+#endif
+
+void          OSInit                    (OS_ERR               *p_err);
 
-void          OSIntEnter                (void);
-void          OSIntExit                 (void);
+void          OSIntEnter                (void) OS_CODE_HOT;
+void          OSIntExit                 (void) OS_CODE_HOT;
 
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
 void          OSSchedRoundRobinCfg      (CPU_BOOLEAN            en,
                                          OS_TICK                dflt_time_quanta,
-                                         OS_ERR                *p_err);
+                                         OS_ERR               *p_err);
+
+void          OSSchedRoundRobinYield    (OS_ERR               *p_err);
+
+#endif
 
-void          OSSchedRoundRobinYield    (OS_ERR                *p_err);
+#if (OS_CFG_SCHED_WINDOW_EN > 0u)
+void          OSSchedWindowInit         (OS_SCHED_WINDOW       *p_window,
+                                         CPU_INT32U             duration,
+                                         OS_ERR               *p_err);
 
+void          OSSchedWindowPrioAdd      (OS_SCHED_WINDOW       *p_window,
+                                         OS_PRIO                prio,
+                                         OS_ERR               *p_err);
+
+void          OSSchedWindowStart        (OS_SCHED_WINDOW       *p_tbl,
+                                         OS_OBJ_QTY             nbr,
+                                         OS_ERR               *p_err);
+
+void          OSSchedWindowStop         (OS_ERR               *p_err);
+
+void          OSSchedWindowNext         (void);
 #endif
 
-void          OSSched                   (void);
+void          OSSched                   (void) OS_CODE_HOT;
 
-void          OSSchedLock               (OS_ERR                *p_err);
-void          OSSchedUnlock             (OS_ERR                *p_err);
+void          OSSchedLock               (OS_ERR               *p_err);
+void          OSSchedUnlock             (OS_ERR               *p_err);
 
-void          OSStart                   (OS_ERR                *p_err);
+void          OSStart                   (OS_ERR               *p_err);
 
 #if (OS_CFG_STAT_TASK_EN > 0u)
-void          OSStatReset               (OS_ERR                *p_err);
+void          OSStatReset               (OS_ERR               *p_err);
 
-void          OSStatTaskCPUUsageInit    (OS_ERR                *p_err);
+void          OSStatTaskCPUUsageInit    (OS_ERR               *p_err);
 #endif
 
-CPU_INT16U    OSVersion                 (OS_ERR                *p_err);
+#if (OS_CFG_STAT_GOV_EN > 0u)
+OS_PERF_LVL   OSStatGovLvlGet           (OS_ERR               *p_err);
+
+void          OSStatGovSet              (OS_STAT_GOV           *p_gov,
+                                         OS_ERR               *p_err);
+#endif
+
+CPU_INT16U    OSVersion                 (OS_ERR               *p_err);
 
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
 void          OS_IdleTask               (void                  *p_arg);
 
-void          OS_IdleTaskInit           (OS_ERR                *p_err);
+void          OS_IdleTaskInit           (OS_ERR               *p_err);
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+void          OS_IntQInit               (OS_ERR               *p_err);
+
+void          OS_IntQPost               (OS_OBJ_TYPE            type,
+                                         void                  *p_obj,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_FLAGS               flags,
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
+
+void          OS_IntQTask               (void                  *p_arg);
+#endif
 
 #if (OS_CFG_STAT_TASK_EN > 0u)
 void          OS_StatTask               (void                  *p_arg);
+
+#if ((OS_CFG_STAT_TASK_BUDGET > 0u) && (OS_CFG_DBG_EN > 0u) && (OS_CFG_TASK_PROFILE_EN > 0u)) || \
+     (OS_CFG_STAT_TASK_IDLE_CYCLES_EN > 0u)
+OS_CPU_USAGE  OS_StatTaskCPUUsageCalc   (OS_CYCLES              cycles,
+                                         OS_CYCLES              cycles_total);
+#endif
 #endif
 
-void          OS_StatTaskInit           (OS_ERR                *p_err);
+#if (OS_CFG_STAT_GOV_EN > 0u)
+void          OS_StatGovSw              (OS_TCB                *p_tcb);
+#endif
+
+#if (OS_CFG_STAT_SCHED_EN > 0u)
+OS_CYCLES     OS_StatSchedCyclesGet     (OS_TCB                *p_tcb);
+#endif
+
+void          OS_StatTaskInit           (OS_ERR               *p_err);
 
-void          OS_TickInit               (OS_ERR                *p_err);
+void          OS_TickInit               (OS_ERR               *p_err);
 void          OS_TickUpdate             (OS_TICK                ticks);
 
+#if (OS_CFG_TICK_TASK_EN > 0u)
+void          OS_TickTask               (void                  *p_arg);
+#endif
+
 /*
 ************************************************************************************************************************
 ************************************************************************************************************************
@@ -1966,7 +7144,7 @@ CPU_STK      *OSTaskStkInit             (OS_TASK_PTR            p_task,
                                          CPU_STK               *p_stk_base,
                                          CPU_STK               *p_stk_limit,
                                          CPU_STK_SIZE           stk_size,
-                                         OS_OPT                 opt);
+                                         OS_OPT                opt);
 
 void          OSTaskSwHook              (void);
 
@@ -1990,14 +7168,34 @@ void          OS_Dbg_Init               (void);
 
 /* ----------------------------------------------- MESSAGE MANAGEMENT ----------------------------------------------- */
 
-void          OS_MsgPoolInit            (OS_ERR                *p_err);
+void          OS_MsgPoolInit            (OS_ERR               *p_err);
+
+void          OS_MsgPoolCreate          (OS_MSG_POOL           *p_pool,
+                                         OS_MSG                *p_msg_tbl,
+                                         OS_MSG_QTY             size);
 
 OS_MSG_QTY    OS_MsgQFreeAll            (OS_MSG_Q              *p_msg_q);
 
 void         *OS_MsgQGet                (OS_MSG_Q              *p_msg_q,
                                          OS_MSG_SIZE           *p_msg_size,
                                          CPU_TS                *p_ts,
-                                         OS_ERR                *p_err);
+                                         OS_ERR               *p_err);
+
+#if (OS_CFG_Q_EN > 0u) && (OS_CFG_Q_PEND_MATCH_EN > 0u)
+void         *OS_MsgQGetMatch           (OS_MSG_Q              *p_msg_q,
+                                         OS_Q_MATCH_FNCT        p_fnct,
+                                         void                  *p_arg,
+                                         OS_MSG_SIZE           *p_msg_size,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR               *p_err);
+#endif
+
+#if (OS_CFG_Q_EN > 0u) && (OS_CFG_Q_PEND_N_EN > 0u)
+OS_MSG_QTY    OS_MsgQGetN               (OS_MSG_Q              *p_msg_q,
+                                         OS_MSG_ENTRY          *p_msg_tbl,
+                                         OS_MSG_QTY             nbr_max,
+                                         CPU_TS                *p_ts);
+#endif
 
 void          OS_MsgQInit               (OS_MSG_Q              *p_msg_q,
                                          OS_MSG_QTY             size);
@@ -2005,16 +7203,33 @@ void          OS_MsgQInit               (OS_MSG_Q              *p_msg_q,
 void          OS_MsgQPut                (OS_MSG_Q              *p_msg_q,
                                          void                  *p_void,
                                          OS_MSG_SIZE            msg_size,
-                                         OS_OPT                 opt,
+                                         OS_OPT                opt,
                                          CPU_TS                 ts,
-                                         OS_ERR                *p_err);
+                                         OS_ERR               *p_err);
+
+#if ((OS_CFG_Q_EN > 0u) && (OS_CFG_Q_POST_N_EN > 0u)) || ((OS_CFG_TASK_Q_EN > 0u) && (OS_CFG_TASK_Q_POST_N_EN > 0u))
+void          OS_MsgQPutN               (OS_MSG_Q              *p_msg_q,
+                                         OS_MSG_ENTRY          *p_msg_tbl,
+                                         OS_MSG_QTY             nbr_msgs,
+                                         OS_OPT                opt,
+                                         CPU_TS                 ts,
+                                         OS_ERR               *p_err);
+#endif
+
+#if (OS_CFG_MSG_Q_STAT_EN > 0u)
+void          OS_MsgQStatGet            (OS_MSG_Q              *p_msg_q,
+                                         OS_MSG_Q_STAT         *p_stat,
+                                         OS_OPT                opt);
+
+void          OS_MsgQStatReset          (OS_MSG_Q              *p_msg_q);
+#endif
 
 /* ---------------------------------------------- PEND/POST MANAGEMENT ---------------------------------------------- */
 
 void          OS_Pend                   (OS_PEND_OBJ           *p_obj,
                                          OS_TCB                *p_tcb,
                                          OS_STATE               pending_on,
-                                         OS_TICK                timeout);
+                                         OS_TICK               timeout);
 
 void          OS_PendAbort              (OS_TCB                *p_tcb,
                                          CPU_TS                 ts,
@@ -2022,40 +7237,89 @@ void          OS_PendAbort              (OS_TCB                *p_tcb,
 
 void          OS_Post                   (OS_PEND_OBJ           *p_obj,
                                          OS_TCB                *p_tcb,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         CPU_TS                 ts) OS_CODE_HOT;
+
+#if (OS_CFG_POST_ALL_INT_EN > 0u)
+void          OS_PostAll                (OS_PEND_OBJ           *p_obj,
                                          void                  *p_void,
                                          OS_MSG_SIZE            msg_size,
                                          CPU_TS                 ts);
+#endif
 
 /* ----------------------------------------------- PRIORITY MANAGEMENT ---------------------------------------------- */
 
 void          OS_PrioInit               (void);
 
-void          OS_PrioInsert             (OS_PRIO                prio);
+#if (OS_CFG_PRIO_MAP_EN > 0u)
+void          OS_PrioMapInit            (OS_ERR                *p_err);
+#endif
+
+void          OS_PrioInsert             (OS_PRIO                prio) OS_CODE_HOT;
 
 void          OS_PrioRemove             (OS_PRIO                prio);
 
-OS_PRIO       OS_PrioGetHighest         (void);
+OS_PRIO       OS_PrioGetHighest         (void) OS_CODE_HOT;
 
 /* --------------------------------------------------- SCHEDULING --------------------------------------------------- */
 
+void          OS_SchedHandoff           (OS_TCB                *p_tcb);
+
 #if (OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u)
 void          OS_SchedLockTimeMeasStart (void);
 void          OS_SchedLockTimeMeasStop  (void);
 #endif
 
+#if (OS_CFG_LOCK_SITE_EN > 0u)
+void          OS_LockSiteClr            (void);
+
+void          OS_LockSiteEnd            (CPU_INT08U             site,
+                                         CPU_TS_TMR             ts_begin);
+#endif
+
+#if (OS_CFG_CRIT_SECTION_PROFILE_EN > 0u)
+void          OS_CritSiteClr            (void);
+
+void          OS_CritSiteEnd            (CPU_INT08U             site);
+#endif
+
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
 void          OS_SchedRoundRobin        (OS_RDY_LIST           *p_rdy_list);
+
+#if (OS_CFG_SCHED_ROUND_ROBIN_TS_EN > 0u)
+void          OS_SchedRoundRobinSliceStart(OS_TCB              *p_tcb,
+                                         CPU_TS                 ts);
+
+void          OS_SchedRoundRobinSw      (OS_TCB                *p_tcb);
 #endif
+#endif
+
+#if (OS_CFG_SCHED_WINDOW_EN > 0u)
+void          OS_SchedWindowInit        (void);
+                                                                /* OS_SchedWindowTmrSet() must be in the BSP.           */
+void          OS_SchedWindowTmrSet      (CPU_INT32U             duration);
+#endif
+
+/* --------------------------------------------- READY LIST MANAGEMENT ---------------------------------------------- */
+
+void          OS_RdyListInit            (void);
+
+void          OS_RdyListInsert          (OS_TCB                *p_tcb) OS_CODE_HOT;
 
-/* --------------------------------------------- READY LIST MANAGEMENT ---------------------------------------------- */
+void          OS_RdyListInsertHead      (OS_TCB                *p_tcb) OS_CODE_HOT;
 
-void          OS_RdyListInit            (void);
+void          OS_RdyListInsertTail      (OS_TCB                *p_tcb) OS_CODE_HOT;
 
-void          OS_RdyListInsert          (OS_TCB                *p_tcb);
+#if (OS_CFG_TASK_EDF_EN > 0u)
+void          OS_RdyListInsertEDF       (OS_TCB                *p_tcb);
+#endif
 
-void          OS_RdyListInsertHead      (OS_TCB                *p_tcb);
+#if (OS_CFG_TASK_FAIR_EN > 0u)
+void          OS_RdyListInsertFair      (OS_TCB                *p_tcb);
 
-void          OS_RdyListInsertTail      (OS_TCB                *p_tcb);
+void          OS_RdyListMoveFair        (OS_TCB                *p_tcb);
+#endif
 
 void          OS_RdyListMoveHeadToTail  (OS_RDY_LIST           *p_rdy_list);
 
@@ -2063,7 +7327,7 @@ void          OS_RdyListRemove          (OS_TCB                *p_tcb);
 
 /* ---------------------------------------------- PEND LIST MANAGEMENT ---------------------------------------------- */
 
-#if (OS_CFG_DBG_EN > 0u)
+#if (OS_DBG_PEND_NAME_EN > 0u)
 void          OS_PendDbgNameAdd         (OS_PEND_OBJ           *p_obj,
                                          OS_TCB                *p_tcb);
 
@@ -2071,6 +7335,10 @@ void          OS_PendDbgNameRemove      (OS_PEND_OBJ           *p_obj,
                                          OS_TCB                *p_tcb);
 #endif
 
+#if (OS_CFG_DBG_EN > 0u)
+CPU_CHAR     *OS_PendDbgNameOn          (OS_STATE               pend_on);
+#endif
+
 void          OS_PendListInit           (OS_PEND_LIST          *p_pend_list);
 
 void          OS_PendListInsertPrio     (OS_PEND_LIST          *p_pend_list,
@@ -2089,15 +7357,40 @@ CPU_BOOLEAN   OS_TickListInsert         (OS_TCB                *p_tcb,
 
 void          OS_TickListInsertDly      (OS_TCB                *p_tcb,
                                          OS_TICK                time,
-                                         OS_OPT                 opt,
-                                         OS_ERR                *p_err);
+                                         OS_OPT                opt,
+                                         OS_ERR               *p_err);
 
 void          OS_TickListRemove         (OS_TCB                *p_tcb);
 
+#if (OS_CFG_TICK_RATE_SET_EN > 0u)
+OS_TICK       OS_TickRescale            (OS_TICK                ticks,
+                                         OS_RATE_HZ             rate_hz_prev,
+                                         OS_RATE_HZ             rate_hz);
+
+void          OS_TickListRescale        (OS_RATE_HZ             rate_hz_prev,
+                                         OS_RATE_HZ             rate_hz);
+#endif
+
 #if (OS_CFG_DYN_TICK_EN > 0u)                                   /* OS_DynTick functions must be implemented in the BSP. */
 OS_TICK       OS_DynTickGet             (void);
 OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
 #endif
+
+#if (OS_CFG_TIME_HR_EN > 0u)
+void          OS_TickHrListInsert       (OS_TCB                *p_tcb);
+
+void          OS_TickHrListRemove       (OS_TCB                *p_tcb);
+
+CPU_TS        OS_TickHrUsToTS           (CPU_INT32U             us);
+
+CPU_BOOLEAN   OS_TickHrNextGet          (CPU_TS                *p_match);
+
+void          OS_TickHrSetNext          (void);
+
+void          OS_TickHrUpdate           (void);
+                                                                /* OS_TickHrSet() must be implemented in the BSP.       */
+void          OS_TickHrSet              (CPU_TS                 ts);
+#endif
 #endif
 
 
@@ -2157,6 +7450,35 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
 #error  "OS_CFG.H, OS_CFG_PRIO_MAX must be >= 8"
 #endif
 
+#if    (OS_PRIO_TBL_2LVL_EN  > 0u) && \
+       (OS_PRIO_RDY_TBL_SIZE > (CPU_CFG_DATA_SIZE * 8u))
+#error  "OS_CFG.H, OS_CFG_PRIO_MAX must be <= (CPU_CFG_DATA_SIZE * 8)^2 to use the two-level priority bitmap"
+#endif
+
+#if (OS_CFG_PRIO_MAP_EN > 0u)
+    #if !defined(OS_CFG_PRIO_MAP_NBR) || !defined(OS_CFG_PRIO_MAP_TBL)
+    #error  "OS_CFG_APP.H, OS_CFG_PRIO_MAP_NBR and OS_CFG_PRIO_MAP_TBL must be defined to use the priority map"
+    #endif
+
+    #if (OS_CFG_PRIO_MAP_NBR < 2u) || (OS_CFG_PRIO_MAP_NBR >= OS_CFG_PRIO_MAX)
+    #error  "OS_CFG_APP.H, OS_CFG_PRIO_MAP_NBR must be >= 2 and < OS_CFG_PRIO_MAX"
+    #endif
+
+    #if (OS_CFG_SCHED_WINDOW_EN > 0u)
+    #error  "OS_CFG.H, OS_CFG_SCHED_WINDOW_EN must be Disabled (0) to use the priority map"
+    #endif
+#endif
+
+#if    (OS_CFG_SMALL_MEM_EN        > 0u) && \
+       (OS_CFG_PEND_LIST_BITMAP_EN > 0u)
+#error  "OS_CFG.H, OS_CFG_PEND_LIST_BITMAP_EN must be Disabled (0) with the small-memory profile (OS_CFG_SMALL_MEM_EN)"
+#endif
+
+#if    (OS_CFG_SMALL_MEM_EN            > 0u) && \
+       (OS_CFG_SCHED_ROUND_ROBIN_TS_EN > 0u)
+#error  "OS_CFG.H, OS_CFG_SCHED_ROUND_ROBIN_TS_EN must be Disabled (0) with 16-bit ticks (quanta are in microseconds)"
+#endif
+
 
 #ifndef OS_CFG_SCHED_LOCK_TIME_MEAS_EN
 #error  "OS_CFG.H, Missing OS_CFG_SCHED_LOCK_TIME_MEAS_EN: Include code to measure scheduler lock time"
@@ -2168,11 +7490,39 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
 #endif
 
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    #if (OS_CFG_INT_Q_SIZE < 2u)
+    #error  "OS_CFG_APP.h, OS_CFG_INT_Q_SIZE must be >= 2"
+    #endif
+#endif
+
+
+#if (OS_CFG_LOCK_SITE_EN > 0u)
+    #if (OS_CFG_TS_EN == 0u)
+    #error  "OS_CFG.H, OS_CFG_TS_EN must be Enabled (1) to record lock times per call site"
+    #endif
+
+    #if (OS_CFG_LOCK_SITE_TBL_SIZE < 1u)
+    #error  "OS_CFG.H, OS_CFG_LOCK_SITE_TBL_SIZE must be >= 1"
+    #endif
+#endif
+
+
+#if (OS_CFG_CRIT_SECTION_PROFILE_EN > 0u)
+    #if (OS_CFG_TS_EN == 0u)
+    #error  "OS_CFG.H, OS_CFG_TS_EN must be Enabled (1) to profile the kernel critical sections"
+    #endif
+#endif
+
+
 #ifndef OS_CFG_SCHED_ROUND_ROBIN_EN
 #error  "OS_CFG.H, Missing OS_CFG_SCHED_ROUND_ROBIN_EN: Include code for Round Robin Scheduling"
 #else
-    #if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u) && (OS_CFG_DYN_TICK_EN > 0u)
-    #error "OS_CFG.H, OS_CFG_DYN_TICK_EN must be Disabled (0) to use Round Robin scheduling."
+    #if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u) && (OS_CFG_DYN_TICK_EN > 0u) && (OS_CFG_SCHED_ROUND_ROBIN_TS_EN == 0u)
+    #error "OS_CFG.H, OS_CFG_DYN_TICK_EN must be Disabled (0) to use tick based Round Robin scheduling."
+    #endif
+    #if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u) && (OS_CFG_SCHED_ROUND_ROBIN_TS_EN > 0u) && (OS_CFG_TIME_HR_EN == 0u)
+    #error "OS_CFG.H, OS_CFG_TIME_HR_EN must be Enabled (1) to measure the time slices (OS_CFG_SCHED_ROUND_ROBIN_TS_EN)"
     #endif
 #endif
 
@@ -2210,6 +7560,52 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
     #ifndef OS_CFG_FLAG_PEND_ABORT_EN
     #error  "OS_CFG.H, Missing OS_CFG_FLAG_PEND_ABORT_EN: Include code for aborting pends from another task"
     #endif
+
+    #if (OS_CFG_FLAG_WIDTH != 8u) && (OS_CFG_FLAG_WIDTH != 16u) && (OS_CFG_FLAG_WIDTH != 32u) && (OS_CFG_FLAG_WIDTH != 64u)
+    #error  "OS_CFG.H, OS_CFG_FLAG_WIDTH must be 8, 16, 32 or 64"
+    #endif
+#endif
+
+/*
+************************************************************************************************************************
+*                                                 INTER-CORE CHANNELS
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_ICC_EN > 0u)
+    #if (OS_MSG_EN == 0u)
+    #error  "OS_CFG.H, OS_CFG_Q_EN or OS_CFG_TASK_Q_EN must be Enabled (1) to use inter-core channels"
+    #endif
+
+    #ifndef OS_CPU_MEM_BARRIER
+    #error  "OS_CPU.H, The port must define OS_CPU_MEM_BARRIER() to use inter-core channels"
+    #endif
+#endif
+
+#if (OS_CFG_ICC_SYNC_EN > 0u)
+    #if (OS_CFG_MUTEX_EN == 0u) || (OS_CFG_SEM_EN == 0u)
+    #error  "OS_CFG.H, OS_CFG_MUTEX_EN and OS_CFG_SEM_EN must be Enabled (1) to use inter-core locks"
+    #endif
+
+    #if (OS_CFG_TICK_EN == 0u)
+    #error  "OS_CFG.H, OS_CFG_TICK_EN must be Enabled (1) to use inter-core locks"
+    #endif
+
+    #ifndef OS_CPU_MEM_BARRIER
+    #error  "OS_CPU.H, The port must define OS_CPU_MEM_BARRIER() to use inter-core events"
+    #endif
+#endif
+
+/*
+************************************************************************************************************************
+*                                                       TOPICS
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TOPIC_EN > 0u)
+    #if (OS_MSG_EN == 0u)
+    #error  "OS_CFG.H, OS_CFG_Q_EN or OS_CFG_TASK_Q_EN must be Enabled (1) to use topics"
+    #endif
 #endif
 
 /*
@@ -2220,6 +7616,60 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
 
 #ifndef OS_CFG_MEM_EN
 #error  "OS_CFG.H, Missing OS_CFG_MEM_EN: Enable (1) or Disable (0) code generation for MEMORY MANAGER"
+#else
+    #if (OS_CFG_SLAB_EN > 0u) && (OS_CFG_MEM_EN == 0u)
+    #error  "OS_CFG.H, OS_CFG_MEM_EN must be Enabled (1) to use the slab allocator"
+    #endif
+
+    #if (OS_CFG_MEM_PEND_EN > 0u) && (OS_CFG_MEM_EN == 0u)
+    #error  "OS_CFG.H, OS_CFG_MEM_EN must be Enabled (1) to use OSMemPend()"
+    #endif
+
+    #if (OS_CFG_MEM_MAG_EN > 0u) && (OS_CFG_MEM_EN == 0u)
+    #error  "OS_CFG.H, OS_CFG_MEM_EN must be Enabled (1) to use memory magazines"
+    #endif
+
+    #if (OS_CFG_MEM_QUOTA_EN > 0u) && (OS_CFG_MEM_EN == 0u)
+    #error  "OS_CFG.H, OS_CFG_MEM_EN must be Enabled (1) to use memory quotas"
+    #endif
+
+    #if (OS_CFG_MEM_BUF_EN > 0u) && (OS_CFG_MEM_EN == 0u)
+    #error  "OS_CFG.H, OS_CFG_MEM_EN must be Enabled (1) to use reference-counted buffers"
+    #endif
+
+    #if (OS_CFG_MEM_CACHE_EN > 0u) && (OS_CFG_MEM_EN == 0u)
+    #error  "OS_CFG.H, OS_CFG_MEM_EN must be Enabled (1) to use cache-line aligned partitions"
+    #endif
+#endif
+
+#if (OS_CFG_OBJ_POOL_EN > 0u)
+    #if (OS_CFG_MEM_EN == 0u) || (OS_CFG_MEM_CACHE_EN == 0u)
+    #error  "OS_CFG.H, OS_CFG_MEM_EN and OS_CFG_MEM_CACHE_EN must be Enabled (1) to use kernel object pools"
+    #endif
+
+    #if (OS_CFG_SEM_POOL_SIZE == 1u) || (OS_CFG_Q_POOL_SIZE == 1u) || (OS_CFG_TMR_POOL_SIZE == 1u)
+    #error  "OS_CFG_APP.H, OS_CFG_SEM_POOL_SIZE, OS_CFG_Q_POOL_SIZE and OS_CFG_TMR_POOL_SIZE must be 0 or >= 2"
+    #endif
+#endif
+
+#if (OS_CFG_HEAP_EN > 0u)
+    #if (OS_CFG_HEAP_FL_NBR < 1u) || (OS_CFG_HEAP_FL_NBR > (CPU_CFG_DATA_SIZE * 8u))
+    #error  "OS_CFG.H, OS_CFG_HEAP_FL_NBR must be between 1 and the number of bits in a CPU_DATA"
+    #endif
+
+    #if (OS_HEAP_SL_NBR > (CPU_CFG_DATA_SIZE * 8u))
+    #error  "OS_CFG.H, (1 << OS_CFG_HEAP_SL_LOG2) must not exceed the number of bits in a CPU_DATA"
+    #endif
+#endif
+
+#if (OS_CFG_TLS_MALLOC_ARENA_EN > 0u)
+    #if (OS_CFG_SLAB_EN == 0u) || (OS_CFG_MEM_MAG_EN == 0u)
+    #error  "OS_CFG.H, OS_CFG_SLAB_EN and OS_CFG_MEM_MAG_EN must be Enabled (1) to use malloc arenas"
+    #endif
+
+    #if !defined(OS_CFG_TLS_TBL_SIZE) || (OS_CFG_TLS_TBL_SIZE < 2u)
+    #error  "OS_CFG.H, OS_CFG_TLS_TBL_SIZE must be >= 2 to use malloc arenas"
+    #endif
 #endif
 
 /*
@@ -2240,6 +7690,16 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
     #endif
 #endif
 
+#if (OS_CFG_MUTEX_BLOCK_STAT_EN > 0u)
+    #if (OS_CFG_MUTEX_EN == 0u) || (OS_CFG_TS_EN == 0u)
+    #error  "OS_CFG.H, OS_CFG_MUTEX_BLOCK_STAT_EN requires OS_CFG_MUTEX_EN and OS_CFG_TS_EN"
+    #endif
+
+    #if (OS_CFG_MUTEX_CHAIN_MAX < 1u) || (OS_CFG_MUTEX_CHAIN_MAX > 255u)
+    #error  "OS_CFG.H, OS_CFG_MUTEX_CHAIN_MAX must be between 1 and 255"
+    #endif
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                    MESSAGE QUEUES
@@ -2262,6 +7722,77 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
     #endif
 #endif
 
+#if (OS_CFG_Q_PRIO_EN > 0u)
+    #if (OS_CFG_Q_PRIO_LVL_NBR < 2u) || (OS_CFG_Q_PRIO_LVL_NBR > 16u)
+    #error  "OS_CFG.H, OS_CFG_Q_PRIO_LVL_NBR must be between 2 and 16"
+    #endif
+#endif
+
+#if (OS_CFG_MSG_Q_STAT_EN > 0u)
+    #if (OS_CFG_TS_EN == 0u)
+    #error  "OS_CFG.H, OS_CFG_TS_EN must be Enabled (1) to use the message queue statistics"
+    #endif
+    #if (OS_CFG_MSG_Q_STAT_HIST_SIZE < 2u)
+    #error  "OS_CFG.H, OS_CFG_MSG_Q_STAT_HIST_SIZE must be >= 2"
+    #endif
+#endif
+
+/*
+************************************************************************************************************************
+*                                                  OBJECT STATISTICS
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_OBJ_STAT_EN > 0u) && (OS_CFG_DBG_EN == 0u)
+#error  "OS_CFG.H, OS_CFG_DBG_EN must be Enabled (1) to use OS_CFG_OBJ_STAT_EN"
+#endif
+
+/*
+************************************************************************************************************************
+*                                                   OBJECT REGISTRY
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_OBJ_REG_EN > 0u)
+#if (OS_CFG_DBG_EN == 0u)
+#error  "OS_CFG.H, OS_CFG_DBG_EN must be Enabled (1) to use OS_CFG_OBJ_REG_EN"
+#endif
+
+#if ((OS_CFG_OBJ_REG_SIZE & (OS_CFG_OBJ_REG_SIZE - 1u)) != 0u) || (OS_CFG_OBJ_REG_SIZE < 2u)
+#error  "OS_CFG.H, OS_CFG_OBJ_REG_SIZE must be a power of 2, >= 2"
+#endif
+
+#if (OS_CFG_OBJ_REG_SIZE > 32768u)
+#error  "OS_CFG.H, OS_CFG_OBJ_REG_SIZE must be <= 32768"
+#endif
+#endif
+
+/*
+************************************************************************************************************************
+*                                               PEND ON MULTIPLE OBJECTS
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_PEND_MULTI_EN > 0u) && (OS_CFG_SEM_EN == 0u) && (OS_CFG_Q_EN == 0u)
+#error  "OS_CFG.H, OS_CFG_PEND_MULTI_EN requires OS_CFG_SEM_EN and/or OS_CFG_Q_EN"
+#endif
+
+/*
+************************************************************************************************************************
+*                                                 READER/WRITER LOCKS
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_RWLOCK_EN > 0u)
+    #if (OS_CFG_MUTEX_EN == 0u)
+    #error "OS_CFG.H, OS_CFG_MUTEX_EN must be Enabled (1) to use the reader/writer locks"
+    #endif
+
+    #if (OS_CFG_RWLOCK_HOLD_MAX == 0u) || (OS_CFG_RWLOCK_HOLD_MAX > 255u)
+    #error "OS_CFG.H, OS_CFG_RWLOCK_HOLD_MAX must be >= 1 and <= 255"
+    #endif
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                      SEMAPHORES
@@ -2298,6 +7829,41 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
 #error  "OS_CFG.H, Missing OS_CFG_STAT_TASK_STK_CHK_EN: Check task stacks from statistics task"
 #endif
 
+#if (OS_CFG_STAT_TASK_IDLE_CYCLES_EN > 0u) && ((OS_CFG_TASK_PROFILE_EN == 0u) || (OS_CFG_TS_EN == 0u))
+#error  "OS_CFG.H, OS_CFG_TASK_PROFILE_EN and OS_CFG_TS_EN must be Enabled (1) to use OS_CFG_STAT_TASK_IDLE_CYCLES_EN"
+#endif
+
+#if (OS_CFG_STAT_TASK_STK_CHK_INCR_EN > 0u) && (OS_CFG_STAT_TASK_STK_CHK_CHUNK == 0u)
+#error  "OS_CFG.H, OS_CFG_STAT_TASK_STK_CHK_CHUNK must be > 0 when OS_CFG_STAT_TASK_STK_CHK_INCR_EN is Enabled (1)"
+#endif
+
+#if (OS_CFG_TASK_IDLE_PM_EN > 0u)
+#if (OS_CFG_TASK_IDLE_EN == 0u) || (OS_CFG_DYN_TICK_EN == 0u) || (OS_CFG_TS_EN == 0u)
+#error  "OS_CFG.H, OS_CFG_TASK_IDLE_EN, OS_CFG_DYN_TICK_EN and OS_CFG_TS_EN must be Enabled (1) to use OS_CFG_TASK_IDLE_PM_EN"
+#endif
+#endif
+
+#if (OS_CFG_SIGNAL_COALESCE_EN > 0u)
+#if (OS_CFG_SIGNAL_EN == 0u) || (OS_CFG_TIME_HR_EN == 0u)
+#error  "OS_CFG.H, OS_CFG_SIGNAL_EN and OS_CFG_TIME_HR_EN must be Enabled (1) to use OS_CFG_SIGNAL_COALESCE_EN"
+#endif
+#endif
+
+#if (OS_CFG_INT_THREAD_EN > 0u)
+#if (OS_CFG_INT_THREAD_IRQ_NBR == 0u) || (OS_CFG_INT_THREAD_IRQ_NBR > 65535u)
+#error  "OS_CFG.H, OS_CFG_INT_THREAD_IRQ_NBR must be between 1 and 65535"
+#endif
+#endif
+
+#if (OS_CFG_TASK_STK_CLR_DEFER_EN > 0u)
+#if (OS_CFG_TASK_IDLE_EN == 0u)
+#error  "OS_CFG.H, OS_CFG_TASK_IDLE_EN must be Enabled (1) to defer stack clearing (OS_CFG_TASK_STK_CLR_DEFER_EN)"
+#endif
+#if (OS_CFG_TASK_STK_CLR_CHUNK == 0u)
+#error  "OS_CFG.H, OS_CFG_TASK_STK_CLR_CHUNK must be > 0 when OS_CFG_TASK_STK_CLR_DEFER_EN is Enabled (1)"
+#endif
+#endif
+
 #ifndef OS_CFG_TASK_CHANGE_PRIO_EN
 #error  "OS_CFG.H, Missing OS_CFG_TASK_CHANGE_PRIO_EN: Include code for OSTaskChangePrio()"
 #endif
@@ -2306,6 +7872,155 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
 #error  "OS_CFG.H, Missing OS_CFG_TASK_DEL_EN: Include code for OSTaskDel()"
 #endif
 
+#if (OS_CFG_WORKQ_EN > 0u)
+#if (OS_CFG_SEM_EN == 0u)
+#error  "OS_CFG.H, OS_CFG_SEM_EN must be Enabled (1) to use work queues (OS_CFG_WORKQ_EN)"
+#endif
+#if (OS_CFG_WORKQ_PRIO_NBR == 0u) || (OS_CFG_WORKQ_PRIO_NBR > 255u)
+#error  "OS_CFG.H, OS_CFG_WORKQ_PRIO_NBR must be between 1 and 255"
+#endif
+#endif
+
+#if (OS_CFG_WDOG_EN > 0u)
+#if (OS_CFG_TMR_EN == 0u)
+#error  "OS_CFG.H, OS_CFG_TMR_EN must be Enabled (1) to use the software watchdog (OS_CFG_WDOG_EN)"
+#endif
+#if (OS_CFG_ATOMIC_EN == 0u)
+#error  "OS_CFG.H, OS_CFG_ATOMIC_EN must be Enabled (1) to use the software watchdog (OS_CFG_WDOG_EN)"
+#endif
+#if (OS_CFG_WDOG_NBR_MAX == 0u) || (OS_CFG_WDOG_NBR_MAX > 65535u)
+#error  "OS_CFG.H, OS_CFG_WDOG_NBR_MAX must be between 1 and 65535"
+#endif
+#endif
+
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+#if (OS_CFG_TICK_EN == 0u) || (OS_CFG_TS_EN == 0u)
+#error  "OS_CFG.H, OS_CFG_TICK_EN and OS_CFG_TS_EN must be Enabled (1) to use CPU budgets (OS_CFG_TASK_BUDGET_EN)"
+#endif
+#if (OS_CFG_TASK_BUDGET_PRIO == 0u) || (OS_CFG_TASK_BUDGET_PRIO >= (OS_CFG_PRIO_MAX - 1u))
+#error  "OS_CFG.H, OS_CFG_TASK_BUDGET_PRIO must be between 1 and OS_CFG_PRIO_MAX - 2"
+#endif
+#endif
+
+#if (OS_CFG_TASK_EDF_EN > 0u)
+#if (OS_CFG_TICK_EN == 0u)
+#error  "OS_CFG.H, OS_CFG_TICK_EN must be Enabled (1) to use EDF scheduling (OS_CFG_TASK_EDF_EN)"
+#endif
+#if (OS_CFG_TASK_EDF_PRIO == 0u) || (OS_CFG_TASK_EDF_PRIO >= (OS_CFG_PRIO_MAX - 1u))
+#error  "OS_CFG.H, OS_CFG_TASK_EDF_PRIO must be between 1 and OS_CFG_PRIO_MAX - 2"
+#endif
+#endif
+
+#if (OS_CFG_TASK_EDF_PEND_EN > 0u) && (OS_CFG_TASK_EDF_EN == 0u)
+#error  "OS_CFG.H, OS_CFG_TASK_EDF_EN must be Enabled (1) to order pend lists by deadline (OS_CFG_TASK_EDF_PEND_EN)"
+#endif
+
+#if (OS_CFG_TASK_FAIR_EN > 0u)
+#if (OS_CFG_TICK_EN == 0u) || (OS_CFG_TS_EN == 0u)
+#error  "OS_CFG.H, OS_CFG_TICK_EN and OS_CFG_TS_EN must be Enabled (1) to use fair-share scheduling (OS_CFG_TASK_FAIR_EN)"
+#endif
+#if (OS_CFG_TASK_FAIR_PRIO == 0u) || (OS_CFG_TASK_FAIR_PRIO >= (OS_CFG_PRIO_MAX - 1u))
+#error  "OS_CFG.H, OS_CFG_TASK_FAIR_PRIO must be between 1 and OS_CFG_PRIO_MAX - 2"
+#endif
+#if (OS_CFG_TASK_EDF_EN > 0u) && (OS_CFG_TASK_FAIR_PRIO == OS_CFG_TASK_EDF_PRIO)
+#error  "OS_CFG.H, OS_CFG_TASK_FAIR_PRIO must be different from OS_CFG_TASK_EDF_PRIO"
+#endif
+#endif
+
+#if (OS_CFG_TASK_PERIOD_EN > 0u) && (OS_CFG_TICK_EN == 0u)
+#error  "OS_CFG.H, OS_CFG_TICK_EN must be Enabled (1) to use periodic releases (OS_CFG_TASK_PERIOD_EN)"
+#endif
+
+#if (OS_CFG_STAT_SNAP_EN > 0u)
+    #if (OS_CFG_STAT_TASK_EN == 0u) || (OS_CFG_DBG_EN == 0u)
+    #error  "OS_CFG.H, OS_CFG_STAT_TASK_EN and OS_CFG_DBG_EN must be Enabled (1) to use OS_CFG_STAT_SNAP_EN"
+    #endif
+
+    #if (OS_CFG_STAT_SNAP_TASK_NBR < 1u) || ((OS_CFG_Q_EN > 0u) && (OS_CFG_STAT_SNAP_Q_NBR < 1u))
+    #error  "OS_CFG.H, OS_CFG_STAT_SNAP_TASK_NBR and OS_CFG_STAT_SNAP_Q_NBR must be >= 1"
+    #endif
+#endif
+
+#if (OS_CFG_STAT_GOV_EN > 0u) && (OS_CFG_STAT_TASK_EN == 0u)
+#error  "OS_CFG.H, OS_CFG_STAT_TASK_EN must be Enabled (1) to use the frequency governor (OS_CFG_STAT_GOV_EN)"
+#endif
+
+#if (OS_CFG_STAT_SCHED_EN > 0u)
+    #if (OS_CFG_STAT_TASK_EN == 0u) || (OS_CFG_DBG_EN == 0u) || (OS_CFG_TASK_PROFILE_EN == 0u)
+    #error  "OS_CFG.H, OS_CFG_STAT_SCHED_EN requires OS_CFG_STAT_TASK_EN, OS_CFG_DBG_EN and OS_CFG_TASK_PROFILE_EN"
+    #endif
+
+    #if (OS_TASK_PERIOD_EN == 0u)
+    #error  "OS_CFG.H, OS_CFG_STAT_SCHED_EN requires periodic releases (OS_CFG_TASK_PERIOD_EN or OS_CFG_TASK_EDF_EN)"
+    #endif
+
+    #if (OS_CFG_STAT_SCHED_ITER_MAX < 1u)
+    #error  "OS_CFG.H, OS_CFG_STAT_SCHED_ITER_MAX must be >= 1"
+    #endif
+#endif
+
+#if (OS_CFG_TASK_STK_PROFILE_EN > 0u)
+    #if (OS_CFG_STAT_TASK_EN == 0u) || (OS_CFG_STAT_TASK_STK_CHK_EN == 0u) || (OS_CFG_DBG_EN == 0u)
+    #error  "OS_CFG.H, OS_CFG_TASK_STK_PROFILE_EN requires OS_CFG_STAT_TASK_EN, OS_CFG_STAT_TASK_STK_CHK_EN and OS_CFG_DBG_EN"
+    #endif
+
+    #if (OS_CFG_TASK_STK_PROFILE_SIZE < 1u) || (OS_CFG_TASK_STK_PROFILE_SIZE > 65535u)
+    #error  "OS_CFG.H, OS_CFG_TASK_STK_PROFILE_SIZE must be between 1 and 65535"
+    #endif
+#endif
+
+#if (OS_CFG_TASK_STK_FIT_EN > 0u) && ((OS_CFG_TASK_STK_PROFILE_EN == 0u) || (OS_CFG_HEAP_EN == 0u))
+#error  "OS_CFG.H, OS_CFG_TASK_STK_FIT_EN requires OS_CFG_TASK_STK_PROFILE_EN and OS_CFG_HEAP_EN"
+#endif
+
+#if (OS_CFG_ISR_STK_SP_EN > 0u)
+    #ifndef OS_CPU_SP_GET
+    #error  "OS_CPU.H, The port must define OS_CPU_SP_GET() to record the ISR stack pointer (OS_CFG_ISR_STK_SP_EN)"
+    #endif
+
+    #if (OS_CFG_ISR_STK_SIZE == 0u)
+    #error  "OS_CFG_APP.H, OS_CFG_ISR_STK_SIZE must be > 0 when OS_CFG_ISR_STK_SP_EN is Enabled (1)"
+    #endif
+#endif
+
+#if (OS_CFG_TASK_PERF_CTR_EN > 0u)
+    #ifndef OS_CPU_PERF_CTR_NBR
+    #error  "OS_CPU.H, The port must define OS_CPU_PERF_CTR_NBR to use per-task performance counters"
+    #endif
+#endif
+
+#if (OS_CFG_PROF_SAMPLE_EN > 0u) && (OS_CFG_PROF_SAMPLE_SIZE < 1u)
+#error  "OS_CFG.H, OS_CFG_PROF_SAMPLE_SIZE must be >= 1"
+#endif
+
+#if (OS_CFG_SCHED_WINDOW_EN > 0u) && (OS_CFG_SCHED_WINDOW_CRIT_PRIO >= (OS_CFG_PRIO_MAX - 1u))
+#error  "OS_CFG.H, OS_CFG_SCHED_WINDOW_CRIT_PRIO must be less than OS_CFG_PRIO_MAX - 1"
+#endif
+
+#if (OS_CFG_TASK_POOL_EN > 0u) && (OS_CFG_TASK_DEL_EN == 0u)
+#error  "OS_CFG.H, OS_CFG_TASK_DEL_EN must be Enabled (1) to use task pools (OS_CFG_TASK_POOL_EN)"
+#endif
+
+#if (OS_CFG_TASK_STK_GRP_EN > 0u) && (OS_CFG_TASK_SUSPEND_EN == 0u)
+#error  "OS_CFG.H, OS_CFG_TASK_SUSPEND_EN must be Enabled (1) to use task stack groups (OS_CFG_TASK_STK_GRP_EN)"
+#endif
+
+#if (OS_CFG_TASK_HIST_EN > 0u)
+    #if (OS_CFG_TS_EN == 0u)
+    #error  "OS_CFG.H, OS_CFG_TS_EN must be Enabled (1) to use the task histograms"
+    #endif
+
+    #if (OS_CFG_TASK_HIST_SIZE < 2u)
+    #error  "OS_CFG.H, OS_CFG_TASK_HIST_SIZE must be >= 2"
+    #endif
+#endif
+
+#if (OS_CFG_TASK_NOTIFY_EN > 0u)
+    #if (OS_CFG_TASK_NOTIFY_SLOTS < 1u) || (OS_CFG_TASK_NOTIFY_SLOTS > 255u)
+    #error  "OS_CFG.H, OS_CFG_TASK_NOTIFY_SLOTS must be between 1 and 255"
+    #endif
+#endif
+
 #ifndef OS_CFG_TASK_Q_EN
 #error  "OS_CFG.H, Missing OS_CFG_TASK_Q_EN: Include code for OSTaskQxxx()"
 #endif
@@ -2351,6 +8066,35 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
     #if ((OS_CFG_TICK_EN == 0u) && (OS_CFG_DYN_TICK_EN > 0u))
     #error "OS_CFG.H, OS_CFG_TICK_EN must be Enabled (1) to use the dynamic tick feature"
     #endif
+
+    #if (OS_CFG_TICK_WHEEL_EN > 0u)
+        #if ((OS_CFG_TICK_WHEEL_SIZE < 2u) || ((OS_CFG_TICK_WHEEL_SIZE & (OS_CFG_TICK_WHEEL_SIZE - 1u)) != 0u))
+        #error "OS_CFG_APP.h, OS_CFG_TICK_WHEEL_SIZE must be a power of 2 and >= 2"
+        #endif
+    #endif
+
+    #if (OS_CFG_TICK_TASK_EN > 0u)
+        #if ((OS_CFG_TICK_EN == 0u) || (OS_CFG_DYN_TICK_EN > 0u))
+        #error "OS_CFG.H, OS_CFG_TICK_TASK_EN requires OS_CFG_TICK_EN Enabled (1) and OS_CFG_DYN_TICK_EN Disabled (0)"
+        #endif
+    #endif
+
+    #if ((OS_CFG_TIME_HR_EN > 0u) && ((OS_CFG_TICK_EN == 0u) || (OS_CFG_TS_EN == 0u)))
+    #error "OS_CFG.H, OS_CFG_TICK_EN and OS_CFG_TS_EN must be Enabled (1) to use high-resolution timeouts"
+    #endif
+
+    #if ((OS_CFG_TIME_ABS_EN > 0u) && (OS_CFG_TICK_EN == 0u))
+    #error "OS_CFG.H, OS_CFG_TICK_EN must be Enabled (1) to use absolute deadlines (OS_CFG_TIME_ABS_EN)"
+    #endif
+
+    #if (OS_CFG_TICK_RATE_SET_EN > 0u)
+        #if ((OS_CFG_TICK_EN == 0u) || (OS_CFG_DYN_TICK_EN > 0u))
+        #error "OS_CFG.H, OS_CFG_TICK_RATE_SET_EN requires OS_CFG_TICK_EN Enabled (1) and OS_CFG_DYN_TICK_EN Disabled (0)"
+        #endif
+        #ifndef OS_CPU_TICK_RATE_SET
+        #error "OS_CPU.H, OS_CFG_TICK_RATE_SET_EN requires the port to define OS_CPU_TICK_RATE_SET()"
+        #endif
+    #endif
 #endif
 
 /*
@@ -2396,6 +8140,22 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
     #ifndef OS_CFG_TMR_DEL_EN
     #error  "OS_CFG.H, Missing OS_CFG_TMR_DEL_EN: Enables (1) or Disables (0) code for OSTmrDel()"
     #endif
+
+    #if (OS_CFG_TMR_ISR_EN > 0u) && (OS_CFG_TIME_HR_EN == 0u)
+    #error "OS_CFG.H, OS_CFG_TIME_HR_EN must be Enabled (1) to use ISR timers (OS_CFG_TMR_ISR_EN)"
+    #endif
+
+    #if (OS_CFG_TMR_CMD_Q_EN > 0u)
+        #if ((OS_CFG_TMR_CMD_Q_SIZE < 2u) || ((OS_CFG_TMR_CMD_Q_SIZE & (OS_CFG_TMR_CMD_Q_SIZE - 1u)) != 0u))
+        #error "OS_CFG_APP.h, OS_CFG_TMR_CMD_Q_SIZE must be a power of 2 and >= 2"
+        #endif
+    #endif
+
+    #if (OS_CFG_TMR_WHEEL_EN > 0u)
+        #if ((OS_CFG_TMR_WHEEL_SIZE < 2u) || ((OS_CFG_TMR_WHEEL_SIZE & (OS_CFG_TMR_WHEEL_SIZE - 1u)) != 0u))
+        #error "OS_CFG_APP.h, OS_CFG_TMR_WHEEL_SIZE must be a power of 2 and >= 2"
+        #endif
+    #endif
 #endif
 #endif
 
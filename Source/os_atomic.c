@@ -0,0 +1,404 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          ATOMIC OPERATIONS
+*
+* File    : os_atomic.c
+* Version : V3.08.00
+*********************************************************************************************************
+* Note(s) : (1) These functions give the application and the kernel the same atomic operations on CPU_DATA
+*               and on pointers, whatever the port.  Each one is implemented with, in order of preference:
+*
+*               (a) The OS_CPU_ATOMIC_xxx() macros of the port, when os_cpu.h sets OS_CPU_ATOMIC_OPS_EN to
+*                   1.  They map to the instructions of the architecture (AMO or LR/SC, LDAXR/STLXR, ...).
+*
+*               (b) A loop on the OS_CPU_xxxLoadExcl() and OS_CPU_xxxStoreExcl() functions, when the port
+*                   sets OS_CPU_ATOMIC_EN to 1 (LDREX/STREX).
+*
+*               (c) A critical section otherwise.
+*
+*           (2) A load has acquire semantics: the accesses that follow it are not done before it.  A store
+*               has release semantics.  The other operations are full barriers.  On a single core, the call
+*               itself keeps the compiler from moving accesses across; OS_CPU_MEM_BARRIER() does the same
+*               for the processor when the port provides it.
+*
+*           (3) These functions can be called from tasks and ISRs, before and after OSStart().  They don't
+*               check their arguments.
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_atomic__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_ATOMIC_EN > 0u)
+/*
+************************************************************************************************************************
+*                                                    LOCAL DEFINES
+************************************************************************************************************************
+*/
+
+#ifdef   OS_CPU_MEM_BARRIER
+#define  OS_ATOMIC_MEM_BARRIER()           OS_CPU_MEM_BARRIER()
+#else
+#define  OS_ATOMIC_MEM_BARRIER()
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                  COMPARE AND SWAP
+*
+* Description: These functions write a new value ('val_new' or 'p_new') to '*p_addr' only if it holds the expected
+*              value ('val_old' or 'p_old').
+*
+* Arguments  : p_addr        is a pointer to the variable to update
+*
+*              val_old       is the value the variable is expected to hold
+*              p_old
+*
+*              val_new       is the value to write to the variable
+*              p_new
+*
+* Returns    : The value the variable held.  The new value was written if, and only if, it is the expected value.
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+CPU_DATA  OSAtomicCAS (CPU_DATA volatile  *p_addr,
+                       CPU_DATA            val_old,
+                       CPU_DATA            val_new)
+{
+    CPU_DATA  val;
+#if (OS_ATOMIC_PORT_EN == 0u) && (OS_ATOMIC_EXCL_EN == 0u)
+    CPU_SR_ALLOC();
+#endif
+
+
+#if   (OS_ATOMIC_PORT_EN > 0u)
+    val = OS_CPU_ATOMIC_CAS(p_addr, val_old, val_new);
+#elif (OS_ATOMIC_EXCL_EN > 0u)
+    OS_ATOMIC_MEM_BARRIER();
+    do {
+        val = OS_CPU_DataLoadExcl(p_addr);
+        if (val != val_old) {                                   /* Not the expected value, don't write                  */
+            break;
+        }
+    } while (OS_CPU_DataStoreExcl(p_addr, val_new) == OS_FALSE);
+    OS_ATOMIC_MEM_BARRIER();
+#else
+    CPU_CRITICAL_ENTER();
+    val = *p_addr;
+    if (val == val_old) {
+       *p_addr = val_new;
+    }
+    CPU_CRITICAL_EXIT();
+#endif
+    return (val);
+}
+
+
+void  *OSAtomicPtrCAS (void * volatile  *p_addr,
+                       void             *p_old,
+                       void             *p_new)
+{
+    void  *p_val;
+#if (OS_ATOMIC_PORT_EN == 0u) && (OS_ATOMIC_EXCL_EN == 0u)
+    CPU_SR_ALLOC();
+#endif
+
+
+#if   (OS_ATOMIC_PORT_EN > 0u)
+    p_val = OS_CPU_ATOMIC_CAS(p_addr, p_old, p_new);
+#elif (OS_ATOMIC_EXCL_EN > 0u)
+    OS_ATOMIC_MEM_BARRIER();
+    do {
+        p_val = OS_CPU_PtrLoadExcl(p_addr);
+        if (p_val != p_old) {                                   /* Not the expected value, don't write                  */
+            break;
+        }
+    } while (OS_CPU_PtrStoreExcl(p_addr, p_new) == OS_FALSE);
+    OS_ATOMIC_MEM_BARRIER();
+#else
+    CPU_CRITICAL_ENTER();
+    p_val = *p_addr;
+    if (p_val == p_old) {
+       *p_addr = p_new;
+    }
+    CPU_CRITICAL_EXIT();
+#endif
+    return (p_val);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                      FETCH AND ADD
+*
+* Description: This function adds 'val' to '*p_addr'.
+*
+* Arguments  : p_addr        is a pointer to the variable to update
+*
+*              val           is the value to add.  Adding ((CPU_DATA)0 - n) subtracts n.
+*
+* Returns    : The value the variable held before the addition.
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+CPU_DATA  OSAtomicFetchAdd (CPU_DATA volatile  *p_addr,
+                            CPU_DATA            val)
+{
+    CPU_DATA  val_old;
+#if (OS_ATOMIC_PORT_EN == 0u) && (OS_ATOMIC_EXCL_EN == 0u)
+    CPU_SR_ALLOC();
+#endif
+
+
+#if   (OS_ATOMIC_PORT_EN > 0u)
+    val_old = OS_CPU_ATOMIC_FETCH_ADD(p_addr, val);
+#elif (OS_ATOMIC_EXCL_EN > 0u)
+    OS_ATOMIC_MEM_BARRIER();
+    do {
+        val_old = OS_CPU_DataLoadExcl(p_addr);
+    } while (OS_CPU_DataStoreExcl(p_addr, val_old + val) == OS_FALSE);
+    OS_ATOMIC_MEM_BARRIER();
+#else
+    CPU_CRITICAL_ENTER();
+    val_old = *p_addr;
+   *p_addr  =  val_old + val;
+    CPU_CRITICAL_EXIT();
+#endif
+    return (val_old);
+}
+
+/*
+************************************************************************************************************************
+*                                                       FETCH AND OR
+*
+* Description: This function sets the bits of 'val' in '*p_addr'.
+*
+* Arguments  : p_addr        is a pointer to the variable to update
+*
+*              val           is the mask of the bits to set
+*
+* Returns    : The value the variable held before the bits were set.
+*
+* Note(s)    : 1) A port without OS_CPU_ATOMIC_FETCH_OR() uses a loop on OS_CPU_ATOMIC_CAS() instead.
+************************************************************************************************************************
+*/
+
+CPU_DATA  OSAtomicFetchOr (CPU_DATA volatile  *p_addr,
+                           CPU_DATA            val)
+{
+    CPU_DATA  val_old;
+#if (OS_ATOMIC_PORT_EN > 0u) && !defined(OS_CPU_ATOMIC_FETCH_OR)
+    CPU_DATA  val_cur;
+#endif
+#if (OS_ATOMIC_PORT_EN == 0u) && (OS_ATOMIC_EXCL_EN == 0u)
+    CPU_SR_ALLOC();
+#endif
+
+
+#if   (OS_ATOMIC_PORT_EN > 0u) && defined(OS_CPU_ATOMIC_FETCH_OR)
+    val_old = OS_CPU_ATOMIC_FETCH_OR(p_addr, val);
+#elif (OS_ATOMIC_PORT_EN > 0u)
+    val_cur = *p_addr;
+    do {
+        val_old = val_cur;
+        val_cur = OS_CPU_ATOMIC_CAS(p_addr, val_old, val_old | val);
+    } while (val_cur != val_old);                               /* Changed in between, retry with the new value         */
+#elif (OS_ATOMIC_EXCL_EN > 0u)
+    OS_ATOMIC_MEM_BARRIER();
+    do {
+        val_old = OS_CPU_DataLoadExcl(p_addr);
+    } while (OS_CPU_DataStoreExcl(p_addr, val_old | val) == OS_FALSE);
+    OS_ATOMIC_MEM_BARRIER();
+#else
+    CPU_CRITICAL_ENTER();
+    val_old = *p_addr;
+   *p_addr  =  val_old | val;
+    CPU_CRITICAL_EXIT();
+#endif
+    return (val_old);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                    LOAD WITH ACQUIRE
+*
+* Description: These functions read '*p_addr'.  The accesses that follow are not done before the read.
+*
+* Arguments  : p_addr        is a pointer to the variable to read
+*
+* Returns    : The value of the variable.
+*
+* Note(s)    : 1) A CPU_DATA or a pointer is read in one access on every supported architecture, so only the order
+*                 of the accesses has to be enforced.
+************************************************************************************************************************
+*/
+
+CPU_DATA  OSAtomicLoad (CPU_DATA volatile  *p_addr)
+{
+    CPU_DATA  val;
+
+
+#if (OS_ATOMIC_PORT_EN > 0u)
+    val = OS_CPU_ATOMIC_LOAD(p_addr);
+#else
+    val = *p_addr;
+    OS_ATOMIC_MEM_BARRIER();
+#endif
+    return (val);
+}
+
+
+void  *OSAtomicPtrLoad (void * volatile  *p_addr)
+{
+    void  *p_val;
+
+
+#if (OS_ATOMIC_PORT_EN > 0u)
+    p_val = OS_CPU_ATOMIC_LOAD(p_addr);
+#else
+    p_val = *p_addr;
+    OS_ATOMIC_MEM_BARRIER();
+#endif
+    return (p_val);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                   STORE WITH RELEASE
+*
+* Description: These functions write '*p_addr'.  The accesses that precede are done before the write.
+*
+* Arguments  : p_addr        is a pointer to the variable to write
+*
+*              val           is the value to write
+*              p_val
+*
+* Returns    : none
+*
+* Note(s)    : 1) A CPU_DATA or a pointer is written in one access on every supported architecture, so only the order
+*                 of the accesses has to be enforced.
+************************************************************************************************************************
+*/
+
+void  OSAtomicStore (CPU_DATA volatile  *p_addr,
+                     CPU_DATA            val)
+{
+#if (OS_ATOMIC_PORT_EN > 0u)
+    OS_CPU_ATOMIC_STORE(p_addr, val);
+#else
+    OS_ATOMIC_MEM_BARRIER();
+   *p_addr = val;
+#endif
+}
+
+
+void  OSAtomicPtrStore (void * volatile  *p_addr,
+                        void             *p_val)
+{
+#if (OS_ATOMIC_PORT_EN > 0u)
+    OS_CPU_ATOMIC_STORE(p_addr, p_val);
+#else
+    OS_ATOMIC_MEM_BARRIER();
+   *p_addr = p_val;
+#endif
+}
+
+
+/*
+************************************************************************************************************************
+*                                                        EXCHANGE
+*
+* Description: These functions write a new value to '*p_addr' and return the value it replaced.
+*
+* Arguments  : p_addr        is a pointer to the variable to update
+*
+*              val           is the value to write
+*              p_val
+*
+* Returns    : The value the variable held.
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+CPU_DATA  OSAtomicXchg (CPU_DATA volatile  *p_addr,
+                        CPU_DATA            val)
+{
+    CPU_DATA  val_old;
+#if (OS_ATOMIC_PORT_EN == 0u) && (OS_ATOMIC_EXCL_EN == 0u)
+    CPU_SR_ALLOC();
+#endif
+
+
+#if   (OS_ATOMIC_PORT_EN > 0u)
+    val_old = OS_CPU_ATOMIC_XCHG(p_addr, val);
+#elif (OS_ATOMIC_EXCL_EN > 0u)
+    OS_ATOMIC_MEM_BARRIER();
+    do {
+        val_old = OS_CPU_DataLoadExcl(p_addr);
+    } while (OS_CPU_DataStoreExcl(p_addr, val) == OS_FALSE);
+    OS_ATOMIC_MEM_BARRIER();
+#else
+    CPU_CRITICAL_ENTER();
+    val_old = *p_addr;
+   *p_addr  =  val;
+    CPU_CRITICAL_EXIT();
+#endif
+    return (val_old);
+}
+
+
+void  *OSAtomicPtrXchg (void * volatile  *p_addr,
+                        void             *p_val)
+{
+    void  *p_old;
+#if (OS_ATOMIC_PORT_EN == 0u) && (OS_ATOMIC_EXCL_EN == 0u)
+    CPU_SR_ALLOC();
+#endif
+
+
+#if   (OS_ATOMIC_PORT_EN > 0u)
+    p_old = OS_CPU_ATOMIC_XCHG(p_addr, p_val);
+#elif (OS_ATOMIC_EXCL_EN > 0u)
+    OS_ATOMIC_MEM_BARRIER();
+    do {
+        p_old = OS_CPU_PtrLoadExcl(p_addr);
+    } while (OS_CPU_PtrStoreExcl(p_addr, p_val) == OS_FALSE);
+    OS_ATOMIC_MEM_BARRIER();
+#else
+    CPU_CRITICAL_ENTER();
+    p_old  = *p_addr;
+   *p_addr =  p_val;
+    CPU_CRITICAL_EXIT();
+#endif
+    return (p_old);
+}
+#endif
@@ -0,0 +1,1007 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                     SYNCHRONOUS CALL/REPLY MESSAGING
+*
+* File    : os_call.c
+* Version : V3.08.00
+*********************************************************************************************************
+* Note(s) : (1) A client task sends a request to a call endpoint with OSCall() and blocks until a server task, which
+*               receives the requests made to the endpoint with OSCallRecv(), answers it with OSReply():
+*
+*                   Client                                  Server
+*                   ------                                  ------
+*                   p_rsp = OSCall(&Ep, p_req, ...);        for (;;) {
+*                                                               p_req = OSCallRecv(&Ep, ...);
+*                                                               ...
+*                                                               OSReply(p_rsp, ...);
+*                                                           }
+*
+*           (2) When a server already waits, OSCall() hands the CPU to it directly, without going through
+*               OS_PrioGetHighest(), and OSReply() does the same to give it back to the client (see
+*               OS_SchedHandoff()).  Only the pointer and the size of the request and of the reply are exchanged.
+*
+*           (3) While it serves a call, the server runs at the priority of the client if that is higher than its
+*               own.  The priority is lent through the same path as mutex priority inheritance, so a server that
+*               is itself the client of another endpoint passes it on.
+*
+*           (4) The timeout given to OSCall() only applies while the client waits for a server.  Once a server
+*               accepted the call, the client waits for the reply with no timeout.
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#define  OS_CRIT_SITE_ID                    OS_CRIT_SITE_CALL
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_call__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_CALL_EN > 0u)
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  void  OS_CallStart (OS_CALL_EP  *p_ep,
+                            OS_TCB      *p_srv,
+                            OS_TCB      *p_client);
+
+
+/*
+************************************************************************************************************************
+*                                                    CALL A SERVER
+*
+* Description: This function sends a request to the servers of a call endpoint and waits for the reply.
+*
+* Arguments  : p_ep          is a pointer to the call endpoint
+*
+*              p_msg         is a pointer to the request to send to the server
+*
+*              msg_size      specifies the size of the request (in bytes)
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for a
+*                            server to accept the call up to the amount of time specified by this argument.  If you
+*                            specify 0, however, your task will wait forever (see Note #4 at the top of this file).
+*
+*              opt           determines whether the user wants to block if no server is waiting:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*                            Add OS_OPT_PEND_ABS to make 'timeout' the value of OSTickCtr at which to give up.
+*
+*              p_reply_size  is a pointer to a variable that will receive the size of the reply
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and your task received the reply
+*                                OS_ERR_OBJ_DEL            If 'p_ep' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_ep' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_ep' is not pointing at a call endpoint
+*                                OS_ERR_OPT_INVALID        If you specified an invalid value for 'opt'
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         If the server was deleted before it replied
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but no server was waiting
+*                                OS_ERR_PTR_INVALID        If you passed a NULL pointer for 'p_reply_size'
+*                                OS_ERR_SCHED_LOCKED       If you called this function when the scheduler is locked
+*                                OS_ERR_STATUS_INVALID     Pend status is invalid
+*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*                                OS_ERR_TIMEOUT            No server accepted the call within the specified timeout
+*
+* Returns    : A pointer to the reply, or a NULL pointer upon error.
+*
+* Note(s)    : 1) Non-blocking only refers to waiting for a server, the task always waits for the reply.
+************************************************************************************************************************
+*/
+
+void  *OSCall (OS_CALL_EP   *p_ep,
+               void         *p_msg,
+               OS_MSG_SIZE   msg_size,
+               OS_TICK       timeout,
+               OS_OPT        opt,
+               OS_MSG_SIZE  *p_reply_size,
+               OS_ERR       *p_err)
+{
+    OS_TCB  *p_srv;
+    void    *p_reply;
+    CPU_TS   ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_PEND_ISR;
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_ep == (OS_CALL_EP *)0) {                              /* Validate 'p_ep'                                      */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return ((void *)0);
+    }
+    if (p_reply_size == (OS_MSG_SIZE *)0) {                     /* Validate 'p_reply_size'                              */
+       *p_err = OS_ERR_PTR_INVALID;
+        return ((void *)0);
+    }
+    switch (opt & (OS_OPT)~OS_OPT_PEND_ABS) {                   /* Validate 'opt'                                       */
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_ep->Type != OS_OBJ_TYPE_CALL_EP) {                    /* Make sure call endpoint was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return ((void *)0);
+    }
+#endif
+
+   *p_reply_size = 0u;
+    CPU_CRITICAL_ENTER();
+    if (OSSchedLockNestingCtr > 0u) {                           /* Can't wait for the reply when the sched. is locked   */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_SCHED_LOCKED;
+        return ((void *)0);
+    }
+
+    p_srv = OS_PEND_LIST_HEAD(&p_ep->PendList);
+    if ((p_srv         != (OS_TCB *)0) &&                       /* Is a server waiting for a call?                      */
+        (p_srv->PendOn == OS_TASK_PEND_ON_CALL_RECV)) {
+#if (OS_CFG_TS_EN > 0u)
+        ts = OS_TS_GET();
+#else
+        ts = 0u;
+#endif
+        OS_Post((OS_PEND_OBJ *)((void *)p_ep),                  /* Yes, hand the request to the server                  */
+                p_srv,
+                p_msg,
+                msg_size,
+                ts);
+        OS_Pend((OS_PEND_OBJ *)0,                               /* Wait for the reply                                   */
+                OSTCBCurPtr,
+                OS_TASK_PEND_ON_CALL_REPLY,
+                0u);
+        OS_CallStart(p_ep, p_srv, OSTCBCurPtr);
+        CPU_CRITICAL_EXIT();
+        OS_SchedHandoff(p_srv);                                 /* Switch to the server (see Note #2 of this file)      */
+    } else {
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {           /* No,  caller wants to block for a server?             */
+            CPU_CRITICAL_EXIT();                                /* No                                                   */
+           *p_err = OS_ERR_PEND_WOULD_BLOCK;
+            return ((void *)0);
+        }
+        OSTCBCurPtr->MsgPtr  = p_msg;                           /* Keep the request until a server accepts it           */
+        OSTCBCurPtr->MsgSize = msg_size;
+        OS_PEND_ABS_SET(OSTCBCurPtr, opt);
+        OS_Pend((OS_PEND_OBJ *)((void *)p_ep),                  /* Block task until a server accepts the call           */
+                OSTCBCurPtr,
+                OS_TASK_PEND_ON_CALL,
+                timeout);
+        CPU_CRITICAL_EXIT();
+        OSSched();                                              /* Find the next highest priority task ready to run     */
+    }
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* The server replied                                   */
+             p_reply       = OSTCBCurPtr->MsgPtr;
+            *p_reply_size  = OSTCBCurPtr->MsgSize;
+            *p_err         = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that the server was deleted                 */
+             p_reply       = (void *)0;
+            *p_err         = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that no server accepted the call within TO  */
+             p_reply       = (void *)0;
+            *p_err         = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+             p_reply       = (void *)0;
+            *p_err         = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+             p_reply       = (void *)0;
+            *p_err         = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+    return (p_reply);
+}
+
+
+/*
+************************************************************************************************************************
+*                                               CREATE A CALL ENDPOINT
+*
+* Description: This function is called by your application to create a call endpoint.
+*
+* Arguments  : p_ep          is a pointer to the call endpoint to initialize.  Your application is responsible for
+*                            allocating storage for the call endpoint.
+*
+*              p_name        is a pointer to the name you would like to give the call endpoint.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_CREATE_ISR              If you called this function from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the endpoint after you called
+*                                                                 OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_ep' is a NULL pointer
+*                                OS_ERR_OBJ_CREATED             If the call endpoint was already created
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSCallEpCreate (OS_CALL_EP  *p_ep,
+                      CPU_CHAR    *p_name,
+                      OS_ERR      *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_ep == (OS_CALL_EP *)0) {                              /* Validate 'p_ep'                                      */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
+    if (p_ep->Type == OS_OBJ_TYPE_CALL_EP) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+    p_ep->Type    = OS_OBJ_TYPE_CALL_EP;                        /* Mark the data structure as a call endpoint           */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_ep->NamePtr = p_name;                                     /* Save the name of the call endpoint                   */
+#else
+    (void)p_name;
+#endif
+    p_ep->CallCtr = 0u;
+    OS_PendListInit(&p_ep->PendList);                           /* Initialize the waiting list                          */
+
+#if (OS_CFG_DBG_EN > 0u)
+    OS_CallEpDbgListAdd(p_ep);
+    OSCallEpQty++;                                              /* One more call endpoint created                       */
+#endif
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                               DELETE A CALL ENDPOINT
+*
+* Description: This function deletes a call endpoint and readies all the clients and servers waiting on it.
+*
+* Arguments  : p_ep          is a pointer to the call endpoint to delete
+*
+*              opt           determines delete options as follows:
+*
+*                                OS_OPT_DEL_NO_PEND          Delete the call endpoint ONLY if no task pending
+*                                OS_OPT_DEL_ALWAYS           Deletes the call endpoint even if tasks are waiting.
+*                                                            In this case, all the tasks pending will be readied.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    The call was successful and the endpoint was deleted
+*                                OS_ERR_DEL_ISR                 If you attempted to delete the endpoint from an ISR
+*                                OS_ERR_ILLEGAL_DEL_RUN_TIME    If you are trying to delete the endpoint after you
+*                                                                 called OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_ep' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE                If 'p_ep' is not pointing at a call endpoint
+*                                OS_ERR_OPT_INVALID             An invalid option was specified
+*                                OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                                OS_ERR_TASK_WAITING            One or more tasks were waiting on the endpoint
+*
+* Returns    : == 0          if no tasks were waiting on the call endpoint, or upon error.
+*              >  0          if one or more tasks waiting on the call endpoint are now readied and informed.
+*
+* Note(s)    : 1) Calls already accepted by a server are not affected, they are replied to as usual.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_CALL_DEL_EN > 0u)
+OS_OBJ_QTY  OSCallEpDel (OS_CALL_EP  *p_ep,
+                         OS_OPT       opt,
+                         OS_ERR      *p_err)
+{
+    OS_OBJ_QTY     nbr_tasks;
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't delete a call endpoint from an ISR             */
+       *p_err = OS_ERR_DEL_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_ep == (OS_CALL_EP *)0) {                              /* Validate 'p_ep'                                      */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_ep->Type != OS_OBJ_TYPE_CALL_EP) {                    /* Make sure call endpoint was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_ep->PendList;
+    nbr_tasks   = 0u;
+    switch (opt) {
+        case OS_OPT_DEL_NO_PEND:                                /* Delete call endpoint only if no task waiting         */
+             if (OS_PEND_LIST_HEAD(p_pend_list) == (OS_TCB *)0) {
+#if (OS_CFG_DBG_EN > 0u)
+                 OS_CallEpDbgListRemove(p_ep);
+                 OSCallEpQty--;
+#endif
+                 OS_CallEpClr(p_ep);
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_NONE;
+             } else {
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_TASK_WAITING;
+             }
+             break;
+
+        case OS_OPT_DEL_ALWAYS:                                 /* Always delete the call endpoint                      */
+#if (OS_CFG_TS_EN > 0u)
+             ts = OS_TS_GET();                                  /* Get local time stamp so all tasks get the same time  */
+#else
+             ts = 0u;
+#endif
+             p_tcb = OS_PEND_LIST_HEAD(p_pend_list);            /* Remove all tasks from the pend list                  */
+             while (p_tcb != (OS_TCB *)0) {
+                 OS_PendAbort(p_tcb,
+                              ts,
+                              OS_STATUS_PEND_DEL);
+                 nbr_tasks++;
+                 p_tcb = OS_PEND_LIST_HEAD(p_pend_list);
+             }
+#if (OS_CFG_DBG_EN > 0u)
+             OS_CallEpDbgListRemove(p_ep);
+             OSCallEpQty--;
+#endif
+             OS_CallEpClr(p_ep);
+             CPU_CRITICAL_EXIT();
+             OSSched();                                         /* Find highest priority task ready to run              */
+            *p_err = OS_ERR_NONE;
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_OPT_INVALID;
+             break;
+    }
+    return (nbr_tasks);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                 RECEIVE A CALL
+*
+* Description: This function is called by a server task to receive the next request made to a call endpoint.  The
+*              call must be answered with OSReply() before the server can receive another one.
+*
+* Arguments  : p_ep          is a pointer to the call endpoint
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for a
+*                            call up to the amount of time specified by this argument.  If you specify 0, however,
+*                            your task will wait forever.
+*
+*              opt           determines whether the user wants to block if no client is waiting:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*                            Add OS_OPT_PEND_ABS to make 'timeout' the value of OSTickCtr at which to give up.
+*
+*              p_msg_size    is a pointer to a variable that will receive the size of the request
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and your task received a request
+*                                OS_ERR_CALL_ACTIVE        If your task did not reply to the call it received last
+*                                OS_ERR_OBJ_DEL            If 'p_ep' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_ep' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_ep' is not pointing at a call endpoint
+*                                OS_ERR_OPT_INVALID        If you specified an invalid value for 'opt'
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but no client was waiting
+*                                OS_ERR_PTR_INVALID        If you passed a NULL pointer for 'p_msg_size'
+*                                OS_ERR_SCHED_LOCKED       If you called this function when the scheduler is locked
+*                                OS_ERR_STATUS_INVALID     Pend status is invalid
+*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*                                OS_ERR_TIMEOUT            No call was made within the specified timeout
+*
+* Returns    : A pointer to the request, or a NULL pointer upon error.
+*
+* Note(s)    : 1) The client with the highest priority is served first.
+************************************************************************************************************************
+*/
+
+void  *OSCallRecv (OS_CALL_EP   *p_ep,
+                   OS_TICK       timeout,
+                   OS_OPT        opt,
+                   OS_MSG_SIZE  *p_msg_size,
+                   OS_ERR       *p_err)
+{
+    OS_TCB  *p_client;
+    void    *p_msg;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_PEND_ISR;
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_ep == (OS_CALL_EP *)0) {                              /* Validate 'p_ep'                                      */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return ((void *)0);
+    }
+    if (p_msg_size == (OS_MSG_SIZE *)0) {                       /* Validate 'p_msg_size'                                */
+       *p_err = OS_ERR_PTR_INVALID;
+        return ((void *)0);
+    }
+    switch (opt & (OS_OPT)~OS_OPT_PEND_ABS) {                   /* Validate 'opt'                                       */
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_ep->Type != OS_OBJ_TYPE_CALL_EP) {                    /* Make sure call endpoint was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return ((void *)0);
+    }
+#endif
+
+   *p_msg_size = 0u;
+    CPU_CRITICAL_ENTER();
+    if (OSTCBCurPtr->CallClientPtr != (OS_TCB *)0) {            /* The previous call must be replied to first           */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_CALL_ACTIVE;
+        return ((void *)0);
+    }
+
+    p_client = OS_PEND_LIST_HEAD(&p_ep->PendList);
+    if ((p_client         != (OS_TCB *)0) &&                    /* Is a client waiting for a server?                    */
+        (p_client->PendOn == OS_TASK_PEND_ON_CALL)) {
+        OS_PendListRemove(p_client);                            /* Yes, accept its call                                 */
+#if (OS_DBG_PEND_NAME_EN > 0u)
+        OS_PendDbgNameRemove((OS_PEND_OBJ *)((void *)p_ep),
+                             p_client);
+#endif
+#if (OS_CFG_TICK_EN > 0u)
+        switch (p_client->TaskState) {                          /* The reply is waited for without a timeout            */
+            case OS_TASK_STATE_PEND_TIMEOUT:
+                 OS_TickListRemove(p_client);
+                 p_client->TaskState = OS_TASK_STATE_PEND;
+                 break;
+
+            case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
+                 OS_TickListRemove(p_client);
+                 p_client->TaskState = OS_TASK_STATE_PEND_SUSPENDED;
+                 break;
+
+            default:
+                 break;
+        }
+#endif
+        p_client->PendOn = OS_TASK_PEND_ON_CALL_REPLY;
+#if (OS_DBG_PEND_NAME_EN > 0u)
+        OS_PendDbgNameAdd((OS_PEND_OBJ *)0,
+                          p_client);
+#endif
+        OS_CallStart(p_ep, OSTCBCurPtr, p_client);
+        p_msg       = p_client->MsgPtr;
+       *p_msg_size  = p_client->MsgSize;
+        CPU_CRITICAL_EXIT();
+       *p_err       = OS_ERR_NONE;
+        return (p_msg);
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* No,  caller wants to block for a call?               */
+        CPU_CRITICAL_EXIT();                                    /* No                                                   */
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;
+        return ((void *)0);
+    } else {                                                    /* Yes                                                  */
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return ((void *)0);
+        }
+    }
+
+    OS_PEND_ABS_SET(OSTCBCurPtr, opt);
+    OS_Pend((OS_PEND_OBJ *)((void *)p_ep),                      /* Block task until a client calls                      */
+            OSTCBCurPtr,
+            OS_TASK_PEND_ON_CALL_RECV,
+            timeout);
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* A client handed its request over                     */
+             p_msg       = OSTCBCurPtr->MsgPtr;
+            *p_msg_size  = OSTCBCurPtr->MsgSize;
+            *p_err       = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that no call was made within TO             */
+             p_msg       = (void *)0;
+            *p_err       = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+             p_msg       = (void *)0;
+            *p_err       = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+             p_msg       = (void *)0;
+            *p_err       = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+    return (p_msg);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 REPLY TO A CALL
+*
+* Description: This function is called by a server task to answer the call it received last with OSCallRecv().  The
+*              client is readied and the server gets its own priority back.
+*
+* Arguments  : p_reply       is a pointer to the reply to send to the client
+*
+*              reply_size    specifies the size of the reply (in bytes)
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and the client was readied
+*                                OS_ERR_CALL_NONE          If your task is not serving a call
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_POST_ISR           If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) The CPU is handed back to the client directly if it has a higher priority than the server (see Note #2
+*                 at the top of this file).
+************************************************************************************************************************
+*/
+
+void  OSReply (void         *p_reply,
+               OS_MSG_SIZE   reply_size,
+               OS_ERR       *p_err)
+{
+    OS_TCB   *p_client;
+    OS_PRIO   prio_new;
+    CPU_TS    ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_POST_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_client = OSTCBCurPtr->CallClientPtr;
+    if (p_client == (OS_TCB *)0) {                              /* Is the task serving a call?                          */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_CALL_NONE;
+        return;
+    }
+    OSTCBCurPtr->CallClientPtr = (OS_TCB *)0;                   /* Yes, the call is over                                */
+    p_client->CallSrvPtr       = (OS_TCB *)0;
+
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();
+#else
+    ts = 0u;
+#endif
+    OS_Post((OS_PEND_OBJ *)0,                                   /* Hand the reply to the client                         */
+            p_client,
+            p_reply,
+            reply_size,
+            ts);
+
+    prio_new = OS_CallSrvPrioGet(OSTCBCurPtr);                  /* Give back the priority lent by the client            */
+    if (prio_new != OSTCBCurPtr->Prio) {
+        OS_TaskChangePrio(OSTCBCurPtr, prio_new);
+        OS_TRACE_TASK_PRIO_CHANGE(OSTCBCurPtr, prio_new);
+        OSPrioCur = prio_new;
+    }
+    CPU_CRITICAL_EXIT();
+    OS_SchedHandoff(p_client);                                  /* Switch back to the client if it has a higher prio    */
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              CLEAR THE CONTENTS OF A CALL ENDPOINT
+*
+* Description: This function is called by OSCallEpDel() to clear the contents of a call endpoint
+*
+* Argument(s): p_ep          is a pointer to the call endpoint to clear
+*              ----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_CallEpClr (OS_CALL_EP  *p_ep)
+{
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_ep->Type    =  OS_OBJ_TYPE_NONE;                          /* Mark the data structure as a NONE                    */
+#endif
+    p_ep->CallCtr =  0u;
+#if (OS_CFG_DBG_EN > 0u)
+    p_ep->NamePtr = (CPU_CHAR *)((void *)"?CALL");
+#endif
+    OS_PendListInit(&p_ep->PendList);                           /* Initialize the waiting list                          */
+}
+
+
+/*
+************************************************************************************************************************
+*                                      ADD/REMOVE CALL ENDPOINT TO/FROM DEBUG LIST
+*
+* Description: These functions are called by uC/OS-III to add or remove a call endpoint to/from the debug list.
+*
+* Arguments  : p_ep         is a pointer to the call endpoint to add/remove
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN > 0u)
+void  OS_CallEpDbgListAdd (OS_CALL_EP  *p_ep)
+{
+    p_ep->DbgNamePtr                   = (CPU_CHAR *)((void *)" ");
+    p_ep->DbgPrevPtr                   = (OS_CALL_EP *)0;
+    if (OSCallEpDbgListPtr == (OS_CALL_EP *)0) {
+        p_ep->DbgNextPtr               = (OS_CALL_EP *)0;
+    } else {
+        p_ep->DbgNextPtr               =  OSCallEpDbgListPtr;
+        OSCallEpDbgListPtr->DbgPrevPtr =  p_ep;
+    }
+    OSCallEpDbgListPtr                 =  p_ep;
+}
+
+
+void  OS_CallEpDbgListRemove (OS_CALL_EP  *p_ep)
+{
+    OS_CALL_EP  *p_ep_next;
+    OS_CALL_EP  *p_ep_prev;
+
+
+    p_ep_prev = p_ep->DbgPrevPtr;
+    p_ep_next = p_ep->DbgNextPtr;
+
+    if (p_ep_prev == (OS_CALL_EP *)0) {
+        OSCallEpDbgListPtr = p_ep_next;
+        if (p_ep_next != (OS_CALL_EP *)0) {
+            p_ep_next->DbgPrevPtr = (OS_CALL_EP *)0;
+        }
+        p_ep->DbgNextPtr = (OS_CALL_EP *)0;
+
+    } else if (p_ep_next == (OS_CALL_EP *)0) {
+        p_ep_prev->DbgNextPtr = (OS_CALL_EP *)0;
+        p_ep->DbgPrevPtr      = (OS_CALL_EP *)0;
+
+    } else {
+        p_ep_prev->DbgNextPtr =  p_ep_next;
+        p_ep_next->DbgPrevPtr =  p_ep_prev;
+        p_ep->DbgNextPtr      = (OS_CALL_EP *)0;
+        p_ep->DbgPrevPtr      = (OS_CALL_EP *)0;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                             START SERVING A CALL
+*
+* Description: This function links a client to the server that accepted its call and lends the priority of the client
+*              to the server.
+*
+* Arguments  : p_ep          is a pointer to the call endpoint
+*
+*              p_srv         is a pointer to the OS_TCB of the server
+*
+*              p_client      is a pointer to the OS_TCB of the client
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+static  void  OS_CallStart (OS_CALL_EP  *p_ep,
+                            OS_TCB      *p_srv,
+                            OS_TCB      *p_client)
+{
+    OS_PRIO  prio_new;
+
+
+    p_srv->CallClientPtr = p_client;
+    p_client->CallSrvPtr = p_srv;
+    p_ep->CallCtr++;                                            /* One more call handed to a server                     */
+
+    prio_new = OS_CallSrvPrioGet(p_srv);
+    if (prio_new != p_srv->Prio) {                              /* Lend the priority of the client to the server        */
+        OS_TaskChangePrio(p_srv, prio_new);
+        OS_TRACE_TASK_PRIO_CHANGE(p_srv, prio_new);
+        if (p_srv == OSTCBCurPtr) {
+            OSPrioCur = prio_new;
+        }
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                          GET THE PRIORITY OF A SERVER TASK
+*
+* Description: This function returns the priority a task should run at: the highest of its base priority, of the
+*              client whose call it serves and, when mutexes are enabled, of the tasks waiting on the locks it holds.
+*
+* Arguments  : p_tcb         is a pointer to the OS_TCB of the task
+*
+* Returns    : The priority of the task.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+OS_PRIO  OS_CallSrvPrioGet (OS_TCB  *p_tcb)
+{
+    OS_PRIO  prio;
+
+
+#if (OS_CFG_MUTEX_EN > 0u)
+    prio = OS_MutexGrpPrioFindHighest(p_tcb);                   /* Also covers the client served                        */
+#else
+    if (p_tcb->CallClientPtr != (OS_TCB *)0) {
+        prio = p_tcb->CallClientPtr->Prio;
+    } else {
+        prio = (OS_PRIO)(OS_CFG_PRIO_MAX - 1u);
+    }
+#endif
+    if (prio > p_tcb->BasePrio) {
+        prio = p_tcb->BasePrio;
+    }
+    return (prio);
+}
+
+
+/*
+************************************************************************************************************************
+*                                       END THE CALLS OF A TASK BEING DELETED
+*
+* Description: This function is called by OSTaskDel() when the task being deleted serves a call or waits for a reply.
+*
+*                  - The client of a server being deleted is readied with OS_ERR_PEND_ABORT.
+*                  - The server of a client being deleted gets its own priority back.  Its OSReply() then returns
+*                    OS_ERR_CALL_NONE.
+*
+* Arguments  : p_tcb         is a pointer to the OS_TCB of the task being deleted
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+void  OS_CallTaskDel (OS_TCB  *p_tcb)
+{
+    OS_TCB   *p_client;
+    OS_TCB   *p_srv;
+    OS_PRIO   prio_new;
+    CPU_TS    ts;
+
+
+    p_client = p_tcb->CallClientPtr;
+    if (p_client != (OS_TCB *)0) {                              /* Serving a call?                                      */
+        p_tcb->CallClientPtr = (OS_TCB *)0;                     /* Yes, the client will get no reply                    */
+        p_client->CallSrvPtr = (OS_TCB *)0;
+#if (OS_CFG_TS_EN > 0u)
+        ts = OS_TS_GET();
+#else
+        ts = 0u;
+#endif
+        OS_PendAbort(p_client,
+                     ts,
+                     OS_STATUS_PEND_ABORT);
+    }
+
+    p_srv = p_tcb->CallSrvPtr;
+    if (p_srv != (OS_TCB *)0) {                                 /* Waiting for a reply?                                 */
+        p_tcb->CallSrvPtr    = (OS_TCB *)0;                     /* Yes, the server no longer serves the task            */
+        p_srv->CallClientPtr = (OS_TCB *)0;
+        p_tcb->PendOn        = OS_TASK_PEND_ON_NOTHING;
+        prio_new             = OS_CallSrvPrioGet(p_srv);
+        if (prio_new != p_srv->Prio) {
+            OS_TaskChangePrio(p_srv, prio_new);
+            OS_TRACE_TASK_PRIO_CHANGE(p_srv, prio_new);
+            if (p_srv == OSTCBCurPtr) {
+                OSPrioCur = prio_new;
+            }
+        }
+    }
+}
+#endif
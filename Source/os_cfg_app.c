@@ -37,10 +37,18 @@ const  CPU_CHAR  *os_cfg_app__c = "$Id: $";
 #define  OS_CFG_IDLE_TASK_STK_LIMIT      ((OS_CFG_IDLE_TASK_STK_SIZE  * OS_CFG_TASK_STK_LIMIT_PCT_EMPTY) / 100u)
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+#define  OS_CFG_INT_Q_TASK_STK_LIMIT     ((OS_CFG_INT_Q_TASK_STK_SIZE * OS_CFG_TASK_STK_LIMIT_PCT_EMPTY) / 100u)
+#endif
+
 #if (OS_CFG_STAT_TASK_EN > 0u)
 #define  OS_CFG_STAT_TASK_STK_LIMIT      ((OS_CFG_STAT_TASK_STK_SIZE  * OS_CFG_TASK_STK_LIMIT_PCT_EMPTY) / 100u)
 #endif
 
+#if (OS_CFG_TICK_TASK_EN > 0u)
+#define  OS_CFG_TICK_TASK_STK_LIMIT      ((OS_CFG_TICK_TASK_STK_SIZE  * OS_CFG_TASK_STK_LIMIT_PCT_EMPTY) / 100u)
+#endif
+
 #if (OS_CFG_TMR_EN > 0u)
 #define  OS_CFG_TMR_TASK_STK_LIMIT       ((OS_CFG_TMR_TASK_STK_SIZE   * OS_CFG_TASK_STK_LIMIT_PCT_EMPTY) / 100u)
 #endif
@@ -59,6 +67,11 @@ CPU_STK        OSCfg_IdleTaskStk   [OS_CFG_IDLE_TASK_STK_SIZE];
 CPU_STK        OSCfg_ISRStk        [OS_CFG_ISR_STK_SIZE];
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+OS_INT_Q       OSCfg_IntQ          [OS_CFG_INT_Q_SIZE];
+CPU_STK        OSCfg_IntQTaskStk   [OS_CFG_INT_Q_TASK_STK_SIZE];
+#endif
+
 #if (OS_MSG_EN > 0u)
 OS_MSG         OSCfg_MsgPool       [OS_CFG_MSG_POOL_SIZE];
 #endif
@@ -67,10 +80,26 @@ OS_MSG         OSCfg_MsgPool       [OS_CFG_MSG_POOL_SIZE];
 CPU_STK        OSCfg_StatTaskStk   [OS_CFG_STAT_TASK_STK_SIZE];
 #endif
 
+#if (OS_CFG_TICK_TASK_EN > 0u)
+CPU_STK        OSCfg_TickTaskStk   [OS_CFG_TICK_TASK_STK_SIZE];
+#endif
+
 #if (OS_CFG_TMR_EN > 0u)
 CPU_STK        OSCfg_TmrTaskStk    [OS_CFG_TMR_TASK_STK_SIZE];
 #endif
 
+#if (OS_SEM_POOL_EN > 0u)
+CPU_INT08U     OSCfg_SemPool       [OS_OBJ_POOL_STORAGE_SIZE(sizeof(OS_SEM), OS_CFG_SEM_POOL_SIZE)];
+#endif
+
+#if (OS_Q_POOL_EN > 0u)
+CPU_INT08U     OSCfg_QPool         [OS_OBJ_POOL_STORAGE_SIZE(sizeof(OS_Q),   OS_CFG_Q_POOL_SIZE)];
+#endif
+
+#if (OS_TMR_POOL_EN > 0u)
+CPU_INT08U     OSCfg_TmrPool       [OS_OBJ_POOL_STORAGE_SIZE(sizeof(OS_TMR), OS_CFG_TMR_POOL_SIZE)];
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                      CONSTANTS
@@ -100,6 +129,27 @@ CPU_INT32U     const  OSCfg_ISRStkSizeRAM        =             0u;
 #endif
 
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+OS_INT_Q     * const  OSCfg_IntQBasePtr          = &OSCfg_IntQ[0];
+OS_OBJ_QTY     const  OSCfg_IntQSize             =  OS_CFG_INT_Q_SIZE;
+CPU_INT32U     const  OSCfg_IntQSizeRAM          =  sizeof(OSCfg_IntQ);
+OS_PRIO        const  OSCfg_IntQTaskPrio         =  OS_CFG_INT_Q_TASK_PRIO;
+CPU_STK      * const  OSCfg_IntQTaskStkBasePtr   = &OSCfg_IntQTaskStk[0];
+CPU_STK_SIZE   const  OSCfg_IntQTaskStkLimit     =  OS_CFG_INT_Q_TASK_STK_LIMIT;
+CPU_STK_SIZE   const  OSCfg_IntQTaskStkSize      =  OS_CFG_INT_Q_TASK_STK_SIZE;
+CPU_INT32U     const  OSCfg_IntQTaskStkSizeRAM   =  sizeof(OSCfg_IntQTaskStk);
+#else
+OS_INT_Q     * const  OSCfg_IntQBasePtr          = (OS_INT_Q *)0;
+OS_OBJ_QTY     const  OSCfg_IntQSize             =             0u;
+CPU_INT32U     const  OSCfg_IntQSizeRAM          =             0u;
+OS_PRIO        const  OSCfg_IntQTaskPrio         =             0u;
+CPU_STK      * const  OSCfg_IntQTaskStkBasePtr   =  (CPU_STK *)0;
+CPU_STK_SIZE   const  OSCfg_IntQTaskStkLimit     =             0u;
+CPU_STK_SIZE   const  OSCfg_IntQTaskStkSize      =             0u;
+CPU_INT32U     const  OSCfg_IntQTaskStkSizeRAM   =             0u;
+#endif
+
+
 #if (OS_MSG_EN > 0u)
 OS_MSG_SIZE    const  OSCfg_MsgPoolSize          =  OS_CFG_MSG_POOL_SIZE;
 CPU_INT32U     const  OSCfg_MsgPoolSizeRAM       =  sizeof(OSCfg_MsgPool);
@@ -137,6 +187,20 @@ OS_RATE_HZ     const  OSCfg_TickRate_Hz          =  OS_CFG_TICK_RATE_HZ;
 OS_RATE_HZ     const  OSCfg_TickRate_Hz          =  0u;
 #endif
 
+#if (OS_CFG_TICK_TASK_EN > 0u)
+OS_PRIO        const  OSCfg_TickTaskPrio         =  OS_CFG_TICK_TASK_PRIO;
+CPU_STK      * const  OSCfg_TickTaskStkBasePtr   = &OSCfg_TickTaskStk[0];
+CPU_STK_SIZE   const  OSCfg_TickTaskStkLimit     =  OS_CFG_TICK_TASK_STK_LIMIT;
+CPU_STK_SIZE   const  OSCfg_TickTaskStkSize      =  OS_CFG_TICK_TASK_STK_SIZE;
+CPU_INT32U     const  OSCfg_TickTaskStkSizeRAM   =  sizeof(OSCfg_TickTaskStk);
+#else
+OS_PRIO        const  OSCfg_TickTaskPrio         =             0u;
+CPU_STK      * const  OSCfg_TickTaskStkBasePtr   =  (CPU_STK *)0;
+CPU_STK_SIZE   const  OSCfg_TickTaskStkLimit     =             0u;
+CPU_STK_SIZE   const  OSCfg_TickTaskStkSize      =             0u;
+CPU_INT32U     const  OSCfg_TickTaskStkSizeRAM   =             0u;
+#endif
+
 
 #if (OS_CFG_TMR_EN > 0u)
 OS_PRIO        const  OSCfg_TmrTaskPrio          =  OS_CFG_TMR_TASK_PRIO;
@@ -155,6 +219,27 @@ CPU_INT32U     const  OSCfg_TmrTaskStkSizeRAM    =             0u;
 #endif
 
 
+#if (OS_CFG_PRIO_MAP_EN > 0u)                                   /* Priorities used by the application, in order         */
+OS_PRIO        const  OSCfg_PrioMapTbl[OS_CFG_PRIO_MAP_NBR] = { OS_CFG_PRIO_MAP_TBL };
+#endif
+
+
+#if (OS_SEM_POOL_EN > 0u)
+OS_MEM_QTY     const  OSCfg_SemPoolSize          =  OS_CFG_SEM_POOL_SIZE;
+CPU_INT32U     const  OSCfg_SemPoolSizeRAM       =  sizeof(OSCfg_SemPool);
+#endif
+
+#if (OS_Q_POOL_EN > 0u)
+OS_MEM_QTY     const  OSCfg_QPoolSize            =  OS_CFG_Q_POOL_SIZE;
+CPU_INT32U     const  OSCfg_QPoolSizeRAM         =  sizeof(OSCfg_QPool);
+#endif
+
+#if (OS_TMR_POOL_EN > 0u)
+OS_MEM_QTY     const  OSCfg_TmrPoolSize          =  OS_CFG_TMR_POOL_SIZE;
+CPU_INT32U     const  OSCfg_TmrPoolSizeRAM       =  sizeof(OSCfg_TmrPool);
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                         TOTAL SIZE OF APPLICATION CONFIGURATION
@@ -167,6 +252,11 @@ CPU_INT32U     const  OSCfg_DataSizeRAM          = 0u
                                                  + sizeof(OSCfg_IdleTaskStk)
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+                                                 + sizeof(OSCfg_IntQ)
+                                                 + sizeof(OSCfg_IntQTaskStk)
+#endif
+
 #if (OS_MSG_EN > 0u)
                                                  + sizeof(OSCfg_MsgPool)
 #endif
@@ -175,6 +265,10 @@ CPU_INT32U     const  OSCfg_DataSizeRAM          = 0u
                                                  + sizeof(OSCfg_StatTaskStk)
 #endif
 
+#if (OS_CFG_TICK_TASK_EN > 0u)
+                                                 + sizeof(OSCfg_TickTaskStk)
+#endif
+
 #if (OS_CFG_TMR_EN > 0u)
                                                  + sizeof(OSCfg_TmrTaskStk)
 #endif
@@ -183,6 +277,18 @@ CPU_INT32U     const  OSCfg_DataSizeRAM          = 0u
                                                  + sizeof(OSCfg_ISRStk)
 #endif
 
+#if (OS_SEM_POOL_EN > 0u)
+                                                 + sizeof(OSCfg_SemPool)
+#endif
+
+#if (OS_Q_POOL_EN > 0u)
+                                                 + sizeof(OSCfg_QPool)
+#endif
+
+#if (OS_TMR_POOL_EN > 0u)
+                                                 + sizeof(OSCfg_TmrPool)
+#endif
+
                                                  + 0u;
 
 
@@ -221,12 +327,42 @@ void  OSCfg_Init (void)
     (void)OSCfg_ISRStkSize;
     (void)OSCfg_ISRStkSizeRAM;
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    (void)OSCfg_IntQBasePtr;
+    (void)OSCfg_IntQSize;
+    (void)OSCfg_IntQSizeRAM;
+    (void)OSCfg_IntQTaskPrio;
+    (void)OSCfg_IntQTaskStkBasePtr;
+    (void)OSCfg_IntQTaskStkLimit;
+    (void)OSCfg_IntQTaskStkSize;
+    (void)OSCfg_IntQTaskStkSizeRAM;
+#endif
+
 #if (OS_MSG_EN > 0u)
     (void)OSCfg_MsgPoolSize;
     (void)OSCfg_MsgPoolSizeRAM;
     (void)OSCfg_MsgPoolBasePtr;
 #endif
 
+#if (OS_CFG_PRIO_MAP_EN > 0u)
+    (void)OSCfg_PrioMapTbl;
+#endif
+
+#if (OS_SEM_POOL_EN > 0u)
+    (void)OSCfg_SemPoolSize;
+    (void)OSCfg_SemPoolSizeRAM;
+#endif
+
+#if (OS_Q_POOL_EN > 0u)
+    (void)OSCfg_QPoolSize;
+    (void)OSCfg_QPoolSizeRAM;
+#endif
+
+#if (OS_TMR_POOL_EN > 0u)
+    (void)OSCfg_TmrPoolSize;
+    (void)OSCfg_TmrPoolSizeRAM;
+#endif
+
 #if (OS_CFG_STAT_TASK_EN > 0u)
     (void)OSCfg_StatTaskPrio;
     (void)OSCfg_StatTaskRate_Hz;
@@ -242,6 +378,14 @@ void  OSCfg_Init (void)
     (void)OSCfg_TickRate_Hz;
 #endif
 
+#if (OS_CFG_TICK_TASK_EN > 0u)
+    (void)OSCfg_TickTaskPrio;
+    (void)OSCfg_TickTaskStkBasePtr;
+    (void)OSCfg_TickTaskStkLimit;
+    (void)OSCfg_TickTaskStkSize;
+    (void)OSCfg_TickTaskStkSizeRAM;
+#endif
+
 #if (OS_CFG_TMR_EN > 0u)
     (void)OSCfg_TmrTaskPrio;
     (void)OSCfg_TmrTaskRate_Hz;
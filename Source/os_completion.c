@@ -0,0 +1,888 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        COMPLETION MANAGEMENT
+*
+* File    : os_completion.c
+* Version : V3.08.00
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#define  OS_CRIT_SITE_ID                    OS_CRIT_SITE_COMPLETION
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_completion__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_COMPLETION_EN > 0u)
+/*
+************************************************************************************************************************
+*                                           REGISTER THE CALLBACK OF A COMPLETION
+*
+* Description: This function registers a job that is submitted to a work queue when the completion is done, so that
+*              the result is processed by a worker instead of by a task blocked in OSCompletionWait().
+*
+* Arguments  : p_comp        is a pointer to the completion
+*
+*              p_workq       is a pointer to the work queue the job is submitted to.  (OS_WORKQ *)0 removes the
+*                            callback.
+*
+*              p_work        is a pointer to the job.  Its function typically reads the result with a non-blocking
+*                            OSCompletionWait().
+*
+*              prio          is the priority of the job, from 0 (highest) to OS_CFG_WORKQ_PRIO_NBR - 1.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_comp' is a NULL pointer, or 'p_work' is a NULL
+*                                                                 pointer while 'p_workq' is not
+*                                OS_ERR_OBJ_TYPE                If 'p_comp' is not pointing at a completion
+*                                OS_ERR_WORK_PRIO_INVALID       If 'prio' is not a valid job priority
+*
+*                            or any of the errors returned by OSWorkSubmit().
+*
+* Returns    : none
+*
+* Note(s)    : 1) The callback stays registered across OSCompletionReinit().
+*
+*              2) A completion already done when the callback is registered submits the job at once.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_WORKQ_EN > 0u)
+void  OSCompletionCallbackSet (OS_COMPLETION  *p_comp,
+                               OS_WORKQ       *p_workq,
+                               OS_WORK        *p_work,
+                               CPU_INT08U      prio,
+                               OS_ERR         *p_err)
+{
+    CPU_BOOLEAN  done;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_comp == (OS_COMPLETION *)0) {                         /* Validate 'p_comp'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_workq != (OS_WORKQ *)0) {
+        if (p_work == (OS_WORK *)0) {                           /* Must provide the job to submit                       */
+           *p_err = OS_ERR_OBJ_PTR_NULL;
+            return;
+        }
+        if (prio >= OS_CFG_WORKQ_PRIO_NBR) {                    /* Must be a valid job priority                         */
+           *p_err = OS_ERR_WORK_PRIO_INVALID;
+            return;
+        }
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_comp->Type != OS_OBJ_TYPE_COMPLETION) {               /* Make sure completion was created                     */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_workq == (OS_WORKQ *)0) {                             /* Remove the callback                                  */
+        p_comp->WorkPtr = (OS_WORK *)0;
+    } else {
+        p_comp->WorkPtr = p_work;
+    }
+    p_comp->WorkQPtr    = p_workq;
+    p_comp->WorkPrio    = prio;
+    done                = p_comp->Done;
+    CPU_CRITICAL_EXIT();
+
+    if ((done    == OS_TRUE) &&                                 /* See Note #2                                          */
+        (p_workq != (OS_WORKQ *)0)) {
+        OSWorkSubmit(p_workq, p_work, prio, p_err);
+        return;
+    }
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                 CREATE A COMPLETION
+*
+* Description: This function creates a completion, not done yet and with no callback.
+*
+* Arguments  : p_comp        is a pointer to the completion to initialize.  Your application is responsible for
+*                            allocating storage for the completion, typically in the structure of the request it
+*                            reports the end of.
+*
+*              p_name        is a pointer to the name you would like to give the completion.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_CREATE_ISR              If you called this function from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the completion after you
+*                                                                 called OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_comp' is a NULL pointer
+*                                OS_ERR_OBJ_CREATED             If the completion was already created
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSCompletionCreate (OS_COMPLETION  *p_comp,
+                          CPU_CHAR       *p_name,
+                          OS_ERR         *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_comp == (OS_COMPLETION *)0) {                         /* Validate 'p_comp'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
+    if (p_comp->Type == OS_OBJ_TYPE_COMPLETION) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+    p_comp->Type     = OS_OBJ_TYPE_COMPLETION;                  /* Mark the data structure as a completion              */
+#endif
+    p_comp->TCBPtr   = (OS_TCB *)0;                             /* No task is waiting and the operation is in progress  */
+    p_comp->Done     =  OS_FALSE;
+    p_comp->Result   =  0;
+    p_comp->DataPtr  = (void *)0;
+#if (OS_CFG_WORKQ_EN > 0u)
+    p_comp->WorkQPtr = (OS_WORKQ *)0;
+    p_comp->WorkPtr  = (OS_WORK  *)0;
+    p_comp->WorkPrio =  0u;
+#endif
+#if (OS_CFG_TS_EN > 0u)
+    p_comp->TS       =  0u;
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_comp->NamePtr  =  p_name;                                 /* Save the name of the completion                      */
+#else
+    (void)p_name;
+#endif
+
+#if (OS_CFG_DBG_EN > 0u)
+    OS_CompletionDbgListAdd(p_comp);
+    OSCompletionQty++;
+#endif
+
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 DELETE A COMPLETION
+*
+* Description: This function deletes a completion.
+*
+* Arguments  : p_comp        is a pointer to the completion to delete
+*
+*              opt           determines delete options as follows:
+*
+*                                OS_OPT_DEL_NO_PEND          Delete the completion ONLY if no task is waiting
+*                                OS_OPT_DEL_ALWAYS           Deletes the completion even if a task is waiting.
+*                                                            In this case, the waiting task will be readied.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    The call was successful and the completion was deleted
+*                                OS_ERR_DEL_ISR                 If you attempted to delete the completion from an ISR
+*                                OS_ERR_ILLEGAL_DEL_RUN_TIME    If you are trying to delete the completion after you
+*                                                                 called OSStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_comp' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE                If 'p_comp' is not pointing at a completion
+*                                OS_ERR_OPT_INVALID             An invalid option was specified
+*                                OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                                OS_ERR_TASK_WAITING            A task was waiting on the completion
+*
+* Returns    : == 0          if no task was waiting on the completion, or upon error.
+*              == 1          if the task waiting on the completion is now readied and informed.
+*
+* Note(s)    : 1) The operation the completion reports the end of MUST be over, or cancelled, before the completion is
+*                 deleted: OSCompletionDone() must not be called on a deleted completion.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_COMPLETION_DEL_EN > 0u)
+OS_OBJ_QTY  OSCompletionDel (OS_COMPLETION  *p_comp,
+                             OS_OPT          opt,
+                             OS_ERR         *p_err)
+{
+    OS_OBJ_QTY  nbr_tasks;
+    CPU_TS      ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to delete a completion from an ISR       */
+       *p_err = OS_ERR_DEL_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_comp == (OS_COMPLETION *)0) {                         /* Validate 'p_comp'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_comp->Type != OS_OBJ_TYPE_COMPLETION) {               /* Make sure completion was created                     */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    nbr_tasks = 0u;
+    switch (opt) {
+        case OS_OPT_DEL_NO_PEND:                                /* Delete completion only if no task waiting            */
+             if (p_comp->TCBPtr == (OS_TCB *)0) {
+#if (OS_CFG_DBG_EN > 0u)
+                 OS_CompletionDbgListRemove(p_comp);
+                 OSCompletionQty--;
+#endif
+                 OS_CompletionClr(p_comp);
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_NONE;
+             } else {
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_TASK_WAITING;
+             }
+             break;
+
+        case OS_OPT_DEL_ALWAYS:                                 /* Always delete the completion                         */
+             if (p_comp->TCBPtr != (OS_TCB *)0) {               /* Ready the task waiting on the completion             */
+#if (OS_CFG_TS_EN > 0u)
+                 ts = OS_TS_GET();
+#else
+                 ts = 0u;
+#endif
+                 OS_PendAbort(p_comp->TCBPtr,
+                              ts,
+                              OS_STATUS_PEND_DEL);
+                 nbr_tasks = 1u;
+             }
+#if (OS_CFG_DBG_EN > 0u)
+             OS_CompletionDbgListRemove(p_comp);
+             OSCompletionQty--;
+#endif
+             OS_CompletionClr(p_comp);
+             CPU_CRITICAL_EXIT();
+             OSSched();                                         /* Find highest priority task ready to run              */
+            *p_err = OS_ERR_NONE;
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_OPT_INVALID;
+             break;
+    }
+    return (nbr_tasks);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                              SIGNAL THE END OF AN OPERATION
+*
+* Description: This function marks a completion as done, with the result of the operation.  The task waiting on the
+*              completion, if any, is readied and the callback job, if any, is submitted.
+*
+* Arguments  : p_comp        is a pointer to the completion
+*
+*              result        is the result code of the operation, its meaning is up to the driver.
+*
+*              p_data        is a pointer to the data to hand over with the result (received buffer, ...).
+*
+*              opt           determines the type of POST performed:
+*
+*                                OS_OPT_POST_NONE        No option
+*                                OS_OPT_POST_NO_SCHED    Do not call the scheduler
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and the completion is done
+*                                OS_ERR_COMPLETION_DONE    If the completion was already done (see Note #2)
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_comp' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_comp' is not pointing at a completion
+*                                OS_ERR_OPT_INVALID        If you specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*
+*                            or any of the errors returned by OSWorkSubmit() for the callback job.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is meant to be called from the ISR that ends the operation.  It only holds the critical
+*                 section for the update of the completion and the readying of its waiter.
+*
+*              2) A completion is done once per operation.  Calls made before OSCompletionReinit() are rejected and
+*                 leave the first result in place.
+************************************************************************************************************************
+*/
+
+void  OSCompletionDone (OS_COMPLETION  *p_comp,
+                        CPU_INT32S      result,
+                        void           *p_data,
+                        OS_OPT          opt,
+                        OS_ERR         *p_err)
+{
+    OS_TCB      *p_tcb;
+#if (OS_CFG_WORKQ_EN > 0u)
+    OS_WORKQ    *p_workq;
+    OS_WORK     *p_work;
+    CPU_INT08U   prio;
+#endif
+    CPU_TS       ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_comp == (OS_COMPLETION *)0) {                         /* Validate 'p_comp'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_comp->Type != OS_OBJ_TYPE_COMPLETION) {               /* Make sure completion was created                     */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_comp->Done == OS_TRUE) {                              /* See Note #2                                          */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_COMPLETION_DONE;
+        return;
+    }
+    p_comp->Done    = OS_TRUE;
+    p_comp->Result  = result;
+    p_comp->DataPtr = p_data;
+#if (OS_CFG_TS_EN > 0u)
+    p_comp->TS      = ts;
+#endif
+#if (OS_CFG_WORKQ_EN > 0u)
+    p_workq         = p_comp->WorkQPtr;                         /* Submit the callback once out of the critical section */
+    p_work          = p_comp->WorkPtr;
+    prio            = p_comp->WorkPrio;
+#endif
+
+    p_tcb = p_comp->TCBPtr;
+    if (p_tcb != (OS_TCB *)0) {                                 /* Ready the task waiting on the completion             */
+        p_comp->TCBPtr    = (OS_TCB      *)0;
+        p_tcb->PendObjPtr = (OS_PEND_OBJ *)0;
+        OS_Post((OS_PEND_OBJ *)0,
+                p_tcb,
+                (void *)0,
+                0u,
+                ts);
+    }
+    CPU_CRITICAL_EXIT();
+
+#if (OS_CFG_WORKQ_EN > 0u)
+    if (p_workq != (OS_WORKQ *)0) {
+        OSWorkSubmit(p_workq, p_work, prio, p_err);
+    } else {
+       *p_err = OS_ERR_NONE;
+    }
+#else
+   *p_err = OS_ERR_NONE;
+#endif
+
+    if ((p_tcb                       != (OS_TCB *)0) &&
+        ((opt & OS_OPT_POST_NO_SCHED) ==          0u)) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                           ARM A COMPLETION FOR A NEW OPERATION
+*
+* Description: This function brings a completion back to the not done state, before the operation it reports the end
+*              of is started again.
+*
+* Arguments  : p_comp        is a pointer to the completion
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_comp' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_comp' is not pointing at a completion
+*                                OS_ERR_TASK_WAITING       If a task is waiting on the completion
+*
+* Returns    : none
+*
+* Note(s)    : 1) The result and the data of the previous operation are lost, the callback stays registered.
+************************************************************************************************************************
+*/
+
+void  OSCompletionReinit (OS_COMPLETION  *p_comp,
+                          OS_ERR         *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_comp == (OS_COMPLETION *)0) {                         /* Validate 'p_comp'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_comp->Type != OS_OBJ_TYPE_COMPLETION) {               /* Make sure completion was created                     */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_comp->TCBPtr != (OS_TCB *)0) {                        /* The waiter expects the current operation to end      */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_TASK_WAITING;
+        return;
+    }
+    p_comp->Done    =  OS_FALSE;
+    p_comp->Result  =  0;
+    p_comp->DataPtr = (void *)0;
+#if (OS_CFG_TS_EN > 0u)
+    p_comp->TS      =  0u;
+#endif
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                          WAIT FOR THE END OF AN OPERATION
+*
+* Description: This function waits for a completion to be done and returns the result of the operation.
+*
+* Arguments  : p_comp        is a pointer to the completion
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for the
+*                            completion up to the amount of time (in 'ticks') specified by this argument.  If you
+*                            specify 0, however, your task will wait forever or until the completion is done.
+*
+*              opt           determines whether the user wants to block if the completion is not done:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING    Poll the completion (see Note #2)
+*
+*                            Add OS_OPT_PEND_ABS to make 'timeout' the value of OSTickCtr at which to give up.
+*
+*              p_data        is a pointer to a variable that will receive the data given to OSCompletionDone().  If
+*                            you pass a NULL pointer (i.e. (void **)0) then you will not get the data.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and the completion is done
+*                                OS_ERR_COMPLETION_WAITER  If another task is already waiting on the completion
+*                                OS_ERR_OBJ_DEL            If 'p_comp' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_comp' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_comp' is not pointing at a completion
+*                                OS_ERR_OPT_INVALID        If you specified an invalid value for 'opt'
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         If the wait was aborted
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR and the result
+*                                                          would lead to a suspension
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the completion is not done
+*                                OS_ERR_SCHED_LOCKED       If you called this function when the scheduler is locked
+*                                OS_ERR_STATUS_INVALID     Pend status is invalid
+*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*                                OS_ERR_TIMEOUT            The completion was not done within the specified timeout.
+*
+* Returns    : The result code given to OSCompletionDone(), or 0 upon error.
+*
+* Note(s)    : 1) Waiting does not consume the completion: it stays done until OSCompletionReinit() is called.
+*
+*              2) A non-blocking wait can be made from an ISR or from the function of the callback job.
+*
+*              3) While the task waits, its '.PendObjPtr' points to the OS_COMPLETION, which is not an OS_PEND_OBJ.
+************************************************************************************************************************
+*/
+
+CPU_INT32S  OSCompletionWait (OS_COMPLETION   *p_comp,
+                              OS_TICK          timeout,
+                              OS_OPT           opt,
+                              void           **p_data,
+                              OS_ERR          *p_err)
+{
+    CPU_INT32S  result;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0);
+    }
+#endif
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return (0);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to block from an ISR                     */
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != OS_OPT_PEND_NON_BLOCKING) {
+           *p_err = OS_ERR_PEND_ISR;
+            return (0);
+        }
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_comp == (OS_COMPLETION *)0) {                         /* Validate 'p_comp'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0);
+    }
+    switch (opt & (OS_OPT)~OS_OPT_PEND_ABS) {                   /* Validate 'opt'                                       */
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_comp->Type != OS_OBJ_TYPE_COMPLETION) {               /* Make sure completion was created                     */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_comp->Done == OS_TRUE) {                              /* Is the operation over? (see Note #1)                 */
+        result = p_comp->Result;
+        if (p_data != (void **)0) {
+           *p_data = p_comp->DataPtr;
+        }
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return (result);
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not done?                   */
+        CPU_CRITICAL_EXIT();                                    /* No                                                   */
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;
+        return (0);
+    } else {                                                    /* Yes                                                  */
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return (0);
+        }
+    }
+
+    if (p_comp->TCBPtr != (OS_TCB *)0) {                        /* Only one task may wait on a completion               */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_COMPLETION_WAITER;
+        return (0);
+    }
+
+    OS_PEND_ABS_SET(OSTCBCurPtr, opt);
+    OS_Pend((OS_PEND_OBJ *)0,                                   /* Block task, there is no pend list to insert it in    */
+            OSTCBCurPtr,
+            OS_TASK_PEND_ON_COMPLETION,
+            timeout);
+                                                                /* See Note #3                                          */
+    OSTCBCurPtr->PendObjPtr = (OS_PEND_OBJ *)((void *)p_comp);
+    p_comp->TCBPtr          =  OSTCBCurPtr;
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    result = 0;
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* The completion is done                               */
+             result = p_comp->Result;
+             if (p_data != (void **)0) {
+                *p_data = p_comp->DataPtr;
+             }
+            *p_err  = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+            *p_err = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that the operation did not end in time      */
+            *p_err = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that the completion has been deleted        */
+            *p_err = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+            *p_err = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+    return (result);
+}
+
+
+/*
+************************************************************************************************************************
+*                                         CLEAR THE CONTENTS OF A COMPLETION
+*
+* Description: This function is called by OSCompletionDel() to clear the contents of a completion
+*
+* Argument(s): p_comp        is a pointer to the completion to clear
+*              ------
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_CompletionClr (OS_COMPLETION  *p_comp)
+{
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_comp->Type     =  OS_OBJ_TYPE_NONE;                       /* Mark the data structure as a NONE                    */
+#endif
+    p_comp->TCBPtr   = (OS_TCB *)0;
+    p_comp->Done     =  OS_FALSE;
+    p_comp->Result   =  0;
+    p_comp->DataPtr  = (void *)0;
+#if (OS_CFG_WORKQ_EN > 0u)
+    p_comp->WorkQPtr = (OS_WORKQ *)0;
+    p_comp->WorkPtr  = (OS_WORK  *)0;
+    p_comp->WorkPrio =  0u;
+#endif
+#if (OS_CFG_TS_EN > 0u)
+    p_comp->TS       =  0u;                                     /* Clear the time stamp                                 */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_comp->NamePtr  = (CPU_CHAR *)((void *)"?COMPLETION");
+#endif
+}
+
+
+/*
+************************************************************************************************************************
+*                                        ADD/REMOVE COMPLETION TO/FROM DEBUG LIST
+*
+* Description: These functions are called by uC/OS-III to add or remove a completion to/from the debug list.
+*
+* Arguments  : p_comp       is a pointer to the completion to add/remove
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN > 0u)
+void  OS_CompletionDbgListAdd (OS_COMPLETION  *p_comp)
+{
+    p_comp->DbgPrevPtr                     = (OS_COMPLETION *)0;
+    if (OSCompletionDbgListPtr == (OS_COMPLETION *)0) {
+        p_comp->DbgNextPtr                 = (OS_COMPLETION *)0;
+    } else {
+        p_comp->DbgNextPtr                 =  OSCompletionDbgListPtr;
+        OSCompletionDbgListPtr->DbgPrevPtr =  p_comp;
+    }
+    OSCompletionDbgListPtr                 =  p_comp;
+}
+
+
+void  OS_CompletionDbgListRemove (OS_COMPLETION  *p_comp)
+{
+    OS_COMPLETION  *p_comp_next;
+    OS_COMPLETION  *p_comp_prev;
+
+
+    p_comp_prev = p_comp->DbgPrevPtr;
+    p_comp_next = p_comp->DbgNextPtr;
+
+    if (p_comp_prev == (OS_COMPLETION *)0) {
+        OSCompletionDbgListPtr = p_comp_next;
+        if (p_comp_next != (OS_COMPLETION *)0) {
+            p_comp_next->DbgPrevPtr = (OS_COMPLETION *)0;
+        }
+        p_comp->DbgNextPtr = (OS_COMPLETION *)0;
+
+    } else if (p_comp_next == (OS_COMPLETION *)0) {
+        p_comp_prev->DbgNextPtr = (OS_COMPLETION *)0;
+        p_comp->DbgPrevPtr      = (OS_COMPLETION *)0;
+
+    } else {
+        p_comp_prev->DbgNextPtr =  p_comp_next;
+        p_comp_next->DbgPrevPtr =  p_comp_prev;
+        p_comp->DbgNextPtr      = (OS_COMPLETION *)0;
+        p_comp->DbgPrevPtr      = (OS_COMPLETION *)0;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                     RELEASE THE COMPLETION A TASK IS WAITING ON
+*
+* Description: This function is called by OS_PendListRemove() when a task waiting on a completion stops waiting because
+*              of a timeout, an abort, the deletion of the completion or the deletion of the task.
+*
+* Argument(s): p_tcb         is a pointer to the TCB of the task
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_CompletionPendRemove (OS_TCB  *p_tcb)
+{
+    OS_COMPLETION  *p_comp;
+
+
+    p_comp            = (OS_COMPLETION *)((void *)p_tcb->PendObjPtr);
+    p_comp->TCBPtr    = (OS_TCB        *)0;
+    p_tcb->PendObjPtr = (OS_PEND_OBJ   *)0;                     /* There is no pend list to remove the task from        */
+}
+#endif
@@ -24,12 +24,36 @@
 */
 
 #define  MICRIUM_SOURCE
+#define  OS_CRIT_SITE_ID                    OS_CRIT_SITE_CORE
 #include "os.h"
 
 #ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
 const  CPU_CHAR  *os_core__c = "$Id: $";
 #endif
 
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_PEND_LIST_BITMAP_EN > 0u)
+static  OS_TCB  *OS_PendListPrioPrevGet (OS_PEND_LIST  *p_pend_list,
+                                         OS_PRIO        prio);
+#endif
+
+#if (OS_CFG_TASK_EDF_PEND_EN > 0u)
+static  CPU_BOOLEAN  OS_PendListDeadlineFirst (OS_TCB  *p_tcb,
+                                               OS_TCB  *p_tcb2);
+#endif
+
+#if (OS_CFG_LOCK_SITE_EN > 0u) && (OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u)
+static  void  OS_LockSiteAdd (OS_LOCK_SITE  *p_tbl,
+                              CPU_INT16U     size,
+                              CPU_ADDR       site,
+                              CPU_TS_TMR     delta);
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                    INITIALIZATION
@@ -64,6 +88,10 @@ void  OSInit (OS_ERR  *p_err)
     OSInitHook();                                               /* Call port specific initialization code               */
 
     OSIntNestingCtr       =           0u;                       /* Clear the interrupt nesting counter                  */
+#if (OS_CFG_ISR_STK_SP_EN > 0u)
+    OSIntNestingCtrMax    =           0u;
+    OSISRStkSPPtr         = (CPU_STK *)0;                       /* No ISR stack pointer recorded yet                    */
+#endif
 
     OSRunning             =  OS_STATE_OS_STOPPED;               /* Indicate that multitasking has not started           */
 
@@ -81,14 +109,28 @@ void  OSInit (OS_ERR  *p_err)
     OSSchedLockTimeMaxCur =           0u;
 #endif
 
+#if (OS_CFG_LOCK_SITE_EN > 0u)
+    OS_LockSiteClr();                                           /* Clear the lock time tables                           */
+#endif
+
+#if (OS_CFG_CRIT_SECTION_PROFILE_EN > 0u)
+    OS_CritSiteClr();                                           /* Clear the critical section profile                   */
+#endif
+
 #ifdef OS_SAFETY_CRITICAL_IEC61508
     OSSafetyCriticalStartFlag = OS_FALSE;
 #endif
 
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
     OSSchedRoundRobinEn             = OS_FALSE;
+#if (OS_CFG_SCHED_ROUND_ROBIN_TS_EN > 0u)
+    OSSchedRoundRobinDfltTimeQuanta = 1000000u / 10u;           /* Time quanta are in microseconds                      */
+    OSSchedRoundRobinSliceEnd       = 0u;
+    OSSchedRoundRobinSliceArmed     = OS_FALSE;
+#else
     OSSchedRoundRobinDfltTimeQuanta = OSCfg_TickRate_Hz / 10u;
 #endif
+#endif
 
 #if (OS_CFG_ISR_STK_SIZE > 0u)
     p_stk = OSCfg_ISRStkBasePtr;                                /* Clear exception stack for stack checking.            */
@@ -116,6 +158,12 @@ void  OSInit (OS_ERR  *p_err)
     OS_AppIdleTaskHookPtr   = (OS_APP_HOOK_VOID)0;
     OS_AppStatTaskHookPtr   = (OS_APP_HOOK_VOID)0;
     OS_AppTaskSwHookPtr     = (OS_APP_HOOK_VOID)0;
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+    OS_AppTaskBudgetHookPtr = (OS_APP_HOOK_TCB )0;
+#endif
+#if (OS_CFG_STAT_SCHED_EN > 0u)
+    OS_AppStatSchedHookPtr  = (OS_APP_HOOK_TCB )0;
+#endif
     OS_AppTimeTickHookPtr   = (OS_APP_HOOK_VOID)0;
 #endif
 
@@ -123,8 +171,39 @@ void  OSInit (OS_ERR  *p_err)
     OSTaskRegNextAvailID = 0u;
 #endif
 
+#if (OS_CFG_PRIO_MAP_EN > 0u)
+    OS_PrioMapInit(p_err);                                      /* Build the dense index of the mapped priorities       */
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+#endif
+
     OS_PrioInit();                                              /* Initialize the priority bitmap table                 */
 
+#if (OS_CFG_SCHED_WINDOW_EN > 0u)
+    OS_SchedWindowInit();                                       /* No scheduling window restricts the priorities yet    */
+#endif
+
+#if (OS_CFG_PROF_SAMPLE_EN > 0u)
+    OS_ProfInit();                                              /* Sampling is off until OSProfSampleStart()            */
+#endif
+
+#if (OS_CFG_TASK_IDLE_PM_EN > 0u)
+    OS_IdlePMInit();                                            /* No sleep state until OSIdlePMStateAdd()              */
+#endif
+
+#if (OS_CFG_INT_THREAD_EN > 0u)
+    OS_IntThreadInit();                                         /* No interrupt has a handler task yet                  */
+#endif
+
+#if (OS_CFG_OBJ_REG_EN > 0u)
+    OS_ObjRegInit();                                            /* Empty the registry before any object is created      */
+#endif
+
+#if (OS_CFG_WDOG_EN > 0u)
+    OS_WdogInit();                                              /* No task is supervised yet                            */
+#endif
+
     OS_RdyListInit();                                           /* Initialize the Ready List                            */
 
 
@@ -142,6 +221,20 @@ void  OSInit (OS_ERR  *p_err)
     }
 #endif
 
+#if (OS_CFG_OBJ_POOL_EN > 0u)                                   /* Create the pools of semaphores, queues and timers    */
+    OS_ObjPoolInit(p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+#endif
+
+#if (OS_CFG_HEAP_EN > 0u)                                       /* Initialize the Heap module                           */
+#if (OS_CFG_DBG_EN > 0u)
+    OSHeapDbgListPtr = (OS_HEAP *)0;
+    OSHeapQty        =            0u;
+#endif
+#endif
+
 
 #if (OS_MSG_EN > 0u)                                            /* Initialize the free list of OS_MSGs                  */
     OS_MsgPoolInit(p_err);
@@ -156,6 +249,10 @@ void  OSInit (OS_ERR  *p_err)
     OSMutexDbgListPtr = (OS_MUTEX *)0;
     OSMutexQty        =             0u;
 #endif
+#if (OS_CFG_MUTEX_BLOCK_STAT_EN > 0u)
+    OSMutexChainWorst.TaskPtr   = (OS_TCB *)0;                  /* No task has blocked on a mutex yet                   */
+    OSMutexChainWorst.BlockTime =           0u;
+#endif
 #endif
 
 
@@ -167,6 +264,38 @@ void  OSInit (OS_ERR  *p_err)
 #endif
 
 
+#if (OS_CFG_MBOX_EN > 0u)                                       /* Initialize the Mailbox Manager module                */
+#if (OS_CFG_DBG_EN > 0u)
+    OSMboxDbgListPtr = (OS_MBOX *)0;
+    OSMboxQty        =            0u;
+#endif
+#endif
+
+
+#if (OS_CFG_PIPE_EN > 0u)                                       /* Initialize the Pipe Manager module                   */
+#if (OS_CFG_DBG_EN > 0u)
+    OSPipeDbgListPtr = (OS_PIPE *)0;
+    OSPipeQty        =            0u;
+#endif
+#endif
+
+
+#if (OS_CFG_RING_EN > 0u)                                       /* Initialize the Ring Buffer Manager module            */
+#if (OS_CFG_DBG_EN > 0u)
+    OSRingDbgListPtr = (OS_RING *)0;
+    OSRingQty        =            0u;
+#endif
+#endif
+
+
+#if (OS_CFG_RWLOCK_EN > 0u)                                     /* Initialize the Reader/Writer Lock Manager module     */
+#if (OS_CFG_DBG_EN > 0u)
+    OSRwLockDbgListPtr = (OS_RWLOCK *)0;
+    OSRwLockQty        =              0u;
+#endif
+#endif
+
+
 #if (OS_CFG_SEM_EN > 0u)                                        /* Initialize the Semaphore Manager module              */
 #if (OS_CFG_DBG_EN > 0u)
     OSSemDbgListPtr = (OS_SEM *)0;
@@ -175,6 +304,59 @@ void  OSInit (OS_ERR  *p_err)
 #endif
 
 
+#if (OS_CFG_SEQLOCK_EN > 0u)                                    /* Initialize the Sequence Lock Manager module          */
+#if (OS_CFG_DBG_EN > 0u)
+    OSSeqLockDbgListPtr = (OS_SEQLOCK *)0;
+    OSSeqLockQty        =               0u;
+#endif
+#endif
+
+#if (OS_CFG_RCU_EN > 0u)                                        /* Initialize the Read-Copy-Update Manager module       */
+#if (OS_CFG_DBG_EN > 0u)
+    OSRcuDbgListPtr = (OS_RCU *)0;
+    OSRcuQty        =           0u;
+#endif
+#endif
+
+#if (OS_CFG_TOPIC_EN > 0u)                                      /* Initialize the Topic Manager module                  */
+#if (OS_CFG_DBG_EN > 0u)
+    OSTopicDbgListPtr = (OS_TOPIC *)0;
+    OSTopicQty        =             0u;
+#endif
+#endif
+
+#if (OS_CFG_CALL_EN > 0u)                                       /* Initialize the Call Manager module                   */
+#if (OS_CFG_DBG_EN > 0u)
+    OSCallEpDbgListPtr = (OS_CALL_EP *)0;
+    OSCallEpQty        =               0u;
+#endif
+#endif
+
+
+#if (OS_CFG_SIGNAL_EN > 0u)                                     /* Initialize the Signal Manager module                 */
+#if (OS_CFG_DBG_EN > 0u)
+    OSSignalDbgListPtr = (OS_SIGNAL *)0;
+    OSSignalQty        =              0u;
+#endif
+#endif
+
+
+#if (OS_CFG_COMPLETION_EN > 0u)                                 /* Initialize the Completion Manager module             */
+#if (OS_CFG_DBG_EN > 0u)
+    OSCompletionDbgListPtr = (OS_COMPLETION *)0;
+    OSCompletionQty        =                  0u;
+#endif
+#endif
+
+
+#if (OS_CFG_REACTOR_EN > 0u)                                    /* Initialize the Reactor Manager module                */
+#if (OS_CFG_DBG_EN > 0u)
+    OSReactorDbgListPtr = (OS_REACTOR *)0;
+    OSReactorQty        =               0u;
+#endif
+#endif
+
+
 #if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
     OS_TLS_Init(p_err);                                         /* Initialize Task Local Storage, before creating tasks */
     if (*p_err != OS_ERR_NONE) {
@@ -197,6 +379,14 @@ void  OSInit (OS_ERR  *p_err)
 #endif
 
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    OS_IntQInit(p_err);                                         /* Initialize the ISR queue and its handler task        */
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+#endif
+
+
 #if (OS_CFG_TICK_EN > 0u)
     OS_TickInit(p_err);
     if (*p_err != OS_ERR_NONE) {
@@ -257,22 +447,63 @@ void  OSInit (OS_ERR  *p_err)
 *                 at the end of the ISR.
 *
 *              5) You are allowed to nest interrupts up to 250 levels deep.
+*
+*              6) Zero-latency ISRs (i.e. ISRs running above the kernel aware priority boundary of the port) are never
+*                 masked by the kernel and thus MUST NOT call this function or any other uC/OS-III service.  When
+*                 OS_CFG_INT_KA_CHK_EN is set to 1, a call made from such an ISR is trapped with CPU_SW_EXCEPTION().
+*
+*              7) When OS_CFG_ISR_STK_SP_EN is set to 1, the stack pointer returned by the port's OS_CPU_SP_GET() is
+*                 recorded in OSISRStkSPPtr if it is on the ISR stack and deeper than any seen before, and the peak
+*                 nesting level in OSIntNestingCtrMax.  An ISR that increments 'OSIntNestingCtr' directly (see Note #2)
+*                 is not seen.  The statistic task counts the ISR stack above OSISRStkSPPtr as used.
 ************************************************************************************************************************
 */
 
 void  OSIntEnter (void)
 {
+#if (OS_CFG_ISR_STK_SP_EN > 0u)
+    CPU_STK  *p_sp;
+#endif
+
+
     OS_TRACE_ISR_ENTER();
 
     if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is OS running?                                       */
         return;                                                 /* No                                                   */
     }
 
+#if (OS_CFG_INT_KA_CHK_EN > 0u)
+    if (OS_CPU_INT_IS_KA() == OS_FALSE) {                       /* Called from a zero-latency ISR? (See Note #6)        */
+        CPU_SW_EXCEPTION(;);                                    /* Yes, the kernel can't protect itself from this ISR   */
+    }
+#endif
+
     if (OSIntNestingCtr >= 250u) {                              /* Have we nested past 250 levels?                      */
         return;                                                 /* Yes                                                  */
     }
 
     OSIntNestingCtr++;                                          /* Increment ISR nesting level                          */
+
+#if (OS_CFG_ISR_STK_SP_EN > 0u)
+    if (OSIntNestingCtrMax < OSIntNestingCtr) {                 /* See Note #7                                          */
+        OSIntNestingCtrMax = OSIntNestingCtr;
+    }
+    p_sp = OS_CPU_SP_GET();
+    if ((p_sp >= OSCfg_ISRStkBasePtr) &&                        /* Only the ISR stack is of interest                    */
+        (p_sp <  (OSCfg_ISRStkBasePtr + OSCfg_ISRStkSize))) {
+#if (CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO)
+        if ((OSISRStkSPPtr == (CPU_STK *)0) ||
+            (OSISRStkSPPtr >  p_sp)) {
+            OSISRStkSPPtr = p_sp;
+        }
+#else
+        if ((OSISRStkSPPtr == (CPU_STK *)0) ||
+            (OSISRStkSPPtr <  p_sp)) {
+            OSISRStkSPPtr = p_sp;
+        }
+#endif
+    }
+#endif
 }
 
 
@@ -341,7 +572,8 @@ void  OSIntExit (void)
 
     OSPrioHighRdy   = OS_PrioGetHighest();                      /* Find highest priority                                */
 #if (OS_CFG_TASK_IDLE_EN > 0u)
-    OSTCBHighRdyPtr = OSRdyList[OSPrioHighRdy].HeadPtr;         /* Get highest priority task ready-to-run               */
+                                                                /* Get highest priority task ready-to-run               */
+    OSTCBHighRdyPtr = OSRdyList[OS_PRIO_IX(OSPrioHighRdy)].HeadPtr;
     if (OSTCBHighRdyPtr == OSTCBCurPtr) {                       /* Current task still the highest priority?             */
                                                                 /* Yes                                                  */
 #if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
@@ -357,7 +589,8 @@ void  OSIntExit (void)
     }
 #else
     if (OSPrioHighRdy != (OS_CFG_PRIO_MAX - 1u)) {              /* Are we returning to idle?                            */
-        OSTCBHighRdyPtr = OSRdyList[OSPrioHighRdy].HeadPtr;     /* No ... get highest priority task ready-to-run        */
+                                                                /* No ... get highest priority task ready-to-run        */
+        OSTCBHighRdyPtr = OSRdyList[OS_PRIO_IX(OSPrioHighRdy)].HeadPtr;
         if (OSTCBHighRdyPtr == OSTCBCurPtr) {                   /* Current task still the highest priority?             */
                                                                 /* Yes                                                  */
             OS_TRACE_ISR_EXIT();
@@ -368,6 +601,21 @@ void  OSIntExit (void)
     }
 #endif
 
+#if (OS_CFG_TASK_HIST_EN > 0u)
+    OS_TaskHistSwIn(OSTCBHighRdyPtr);
+#endif
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+    OS_TaskBudgetSw(OSTCBHighRdyPtr);                           /* Charge the CPU time of the task being switched out   */
+#endif
+#if (OS_CFG_TASK_FAIR_EN > 0u)
+    OS_TaskFairSw(OSTCBHighRdyPtr);                             /* Advance the virtual runtime of the task switched out */
+#endif
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u) && (OS_CFG_SCHED_ROUND_ROBIN_TS_EN > 0u)
+    OS_SchedRoundRobinSw(OSTCBHighRdyPtr);                      /* Save the slice left, start the slice of the new task */
+#endif
+#if (OS_CFG_STAT_GOV_EN > 0u)
+    OS_StatGovSw(OSTCBHighRdyPtr);                              /* Run at the performance level the new task needs      */
+#endif
 #if (OS_CFG_TASK_PROFILE_EN > 0u)
     OSTCBHighRdyPtr->CtxSwCtr++;                                /* Inc. # of context switches for this new task         */
 #endif
@@ -376,7 +624,13 @@ void  OSIntExit (void)
 #endif
 
 #if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
+#if (OS_CFG_TLS_LAZY_SW_EN > 0u)
+    if ((OSTCBHighRdyPtr->Opt & OS_OPT_TASK_NO_TLS) == OS_OPT_NONE) {
+        OS_TLS_TaskSw();                                        /* Only switch the TLS of tasks that use it             */
+    }
+#else
     OS_TLS_TaskSw();
+#endif
 #endif
 
     OS_TRACE_ISR_EXIT_TO_SCHEDULER();
@@ -449,14 +703,16 @@ void  OSSched (void)
     CPU_INT_DIS();
     OSPrioHighRdy   = OS_PrioGetHighest();                      /* Find the highest priority ready                      */
 #if (OS_CFG_TASK_IDLE_EN > 0u)
-    OSTCBHighRdyPtr = OSRdyList[OSPrioHighRdy].HeadPtr;         /* Get highest priority task ready-to-run               */
+                                                                /* Get highest priority task ready-to-run               */
+    OSTCBHighRdyPtr = OSRdyList[OS_PRIO_IX(OSPrioHighRdy)].HeadPtr;
     if (OSTCBHighRdyPtr == OSTCBCurPtr) {                       /* Current task still the highest priority?             */
         CPU_INT_EN();                                           /* Yes                                                  */
         return;
     }
 #else
     if (OSPrioHighRdy != (OS_CFG_PRIO_MAX - 1u)) {              /* Are we returning to idle?                              */
-        OSTCBHighRdyPtr = OSRdyList[OSPrioHighRdy].HeadPtr;     /* No ... get highest priority task ready-to-run          */
+                                                                /* No ... get highest priority task ready-to-run        */
+        OSTCBHighRdyPtr = OSRdyList[OS_PRIO_IX(OSPrioHighRdy)].HeadPtr;
         if (OSTCBHighRdyPtr == OSTCBCurPtr) {                   /* Current task still the highest priority?               */
             CPU_INT_EN();                                       /* Yes                                                    */
             return;
@@ -466,6 +722,22 @@ void  OSSched (void)
 
     OS_TRACE_TASK_PREEMPT(OSTCBCurPtr);
 
+#if (OS_CFG_TASK_HIST_EN > 0u)
+    OS_TaskHistSwIn(OSTCBHighRdyPtr);
+#endif
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+    OS_TaskBudgetSw(OSTCBHighRdyPtr);                           /* Charge the CPU time of the task being switched out   */
+#endif
+#if (OS_CFG_TASK_FAIR_EN > 0u)
+    OS_TaskFairSw(OSTCBHighRdyPtr);                             /* Advance the virtual runtime of the task switched out */
+#endif
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u) && (OS_CFG_SCHED_ROUND_ROBIN_TS_EN > 0u)
+    OS_SchedRoundRobinSw(OSTCBHighRdyPtr);                      /* Save the slice left, start the slice of the new task */
+#endif
+#if (OS_CFG_STAT_GOV_EN > 0u)
+    OS_StatGovSw(OSTCBHighRdyPtr);                              /* Run at the performance level the new task needs      */
+#endif
+
 #if (OS_CFG_TASK_PROFILE_EN > 0u)
     OSTCBHighRdyPtr->CtxSwCtr++;                                /* Inc. # of context switches to this task              */
 #endif
@@ -475,8 +747,14 @@ void  OSSched (void)
 #endif
 
 #if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
+#if (OS_CFG_TLS_LAZY_SW_EN > 0u)
+    if ((OSTCBHighRdyPtr->Opt & OS_OPT_TASK_NO_TLS) == OS_OPT_NONE) {
+        OS_TLS_TaskSw();                                        /* Only switch the TLS of tasks that use it             */
+    }
+#else
     OS_TLS_TaskSw();
 #endif
+#endif
 
 #if (OS_CFG_TASK_IDLE_EN > 0u)
     OS_TASK_SW();                                               /* Perform a task level context switch                  */
@@ -571,6 +849,11 @@ void  OSSchedLock (OS_ERR  *p_err)
     OSSchedLockNestingCtr++;                                    /* Increment lock nesting level                         */
 #if (OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u)
     OS_SchedLockTimeMeasStart();
+#if (OS_CFG_LOCK_SITE_EN > 0u)
+    if (OSSchedLockNestingCtr == 1u) {                          /* Remember who locked the scheduler                    */
+        OSSchedLockSiteCur = OS_CPU_RET_ADDR_GET();
+    }
+#endif
 #endif
     CPU_CRITICAL_EXIT();
    *p_err = OS_ERR_NONE;
@@ -662,7 +945,8 @@ void  OSSchedUnlock (OS_ERR  *p_err)
 *
 * Returns    : none
 *
-* Note(s)    : none
+* Note(s)    : 1) When OS_CFG_SCHED_ROUND_ROBIN_TS_EN is enabled, 'dflt_time_quanta' and the time quanta of the tasks
+*                 are in microseconds, and 0 means 100000 (1/10 second).
 ************************************************************************************************************************
 */
 
@@ -692,7 +976,11 @@ void  OSSchedRoundRobinCfg (CPU_BOOLEAN   en,
     if (dflt_time_quanta > 0u) {
         OSSchedRoundRobinDfltTimeQuanta = dflt_time_quanta;
     } else {
-        OSSchedRoundRobinDfltTimeQuanta = (OS_TICK)(OSCfg_TickRate_Hz / 10u);
+#if (OS_CFG_SCHED_ROUND_ROBIN_TS_EN > 0u)
+        OSSchedRoundRobinDfltTimeQuanta = (OS_TICK)(1000000u / 10u);    /* See Note #1                                  */
+#else
+        OSSchedRoundRobinDfltTimeQuanta = (OS_TICK)(OS_TICK_RATE_HZ / 10u);
+#endif
     }
     CPU_CRITICAL_EXIT();
    *p_err = OS_ERR_NONE;
@@ -754,7 +1042,7 @@ void  OSSchedRoundRobinYield (OS_ERR  *p_err)
     }
 
     CPU_CRITICAL_ENTER();
-    p_rdy_list = &OSRdyList[OSPrioCur];                         /* Can't yield if it's the only task at that priority   */
+    p_rdy_list = &OSRdyList[OS_PRIO_IX(OSPrioCur)];             /* Can't yield if it's the only task at that priority   */
     if (p_rdy_list->HeadPtr == p_rdy_list->TailPtr) {
         CPU_CRITICAL_EXIT();
        *p_err = OS_ERR_ROUND_ROBIN_1;
@@ -763,11 +1051,15 @@ void  OSSchedRoundRobinYield (OS_ERR  *p_err)
 
     OS_RdyListMoveHeadToTail(p_rdy_list);                       /* Move current OS_TCB to the end of the list           */
     p_tcb = p_rdy_list->HeadPtr;                                /* Point to new OS_TCB at head of the list              */
+#if (OS_CFG_SCHED_ROUND_ROBIN_TS_EN > 0u)
+    p_tcb->TimeQuantaTS = 0u;                                   /* Full slice, loaded when it is switched in            */
+#else
     if (p_tcb->TimeQuanta == 0u) {                              /* See if we need to use the default time slice         */
         p_tcb->TimeQuantaCtr = OSSchedRoundRobinDfltTimeQuanta;
     } else {
         p_tcb->TimeQuantaCtr = p_tcb->TimeQuanta;               /* Load time slice counter with new time                */
     }
+#endif
 
     CPU_CRITICAL_EXIT();
 
@@ -839,8 +1131,17 @@ void  OSStart (OS_ERR  *p_err)
     if (OSRunning == OS_STATE_OS_STOPPED) {
         OSPrioHighRdy   = OS_PrioGetHighest();                  /* Find the highest priority                            */
         OSPrioCur       = OSPrioHighRdy;
-        OSTCBHighRdyPtr = OSRdyList[OSPrioHighRdy].HeadPtr;
+        OSTCBHighRdyPtr = OSRdyList[OS_PRIO_IX(OSPrioHighRdy)].HeadPtr;
         OSTCBCurPtr     = OSTCBHighRdyPtr;
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+        OSTCBCurPtr->BudgetStart = OS_TS_GET();                 /* The first task starts using its budget now           */
+#endif
+#if (OS_CFG_TASK_FAIR_EN > 0u)
+        OSTCBCurPtr->FairStart   = OS_TS_GET();
+#endif
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u) && (OS_CFG_SCHED_ROUND_ROBIN_TS_EN > 0u)
+        OS_SchedRoundRobinSw(OSTCBCurPtr);                      /* Start the time slice of the first task               */
+#endif
         OSRunning       = OS_STATE_OS_RUNNING;
         OSStartHighRdy();                                       /* Execute target specific code to start task           */
        *p_err           = OS_ERR_FATAL_RETURN;                  /* OSStart() is not supposed to return                  */
@@ -901,12 +1202,20 @@ CPU_INT16U  OSVersion (OS_ERR  *p_err)
 *                 uC/OS-III would thus never recognize interrupts.
 *
 *              3) This hook has been added to allow you to do such things as STOP the CPU to conserve power.
+*
+*              4) With OS_CFG_STAT_TASK_IDLE_CYCLES_EN, the statistic task measures the idle time from the timestamps
+*                 taken by OSTaskSwHook(), so the loop keeps no counter and never disables interrupts.  OSIdleTaskCtr
+*                 then stays at 0.
+*
+*              5) With OS_CFG_TASK_IDLE_PM_EN, the idle task enters the sleep states registered by OSIdlePMStateAdd()
+*                 and OSIdleTaskHook() should not stop the CPU itself.  The idle counter advances less while the CPU
+*                 sleeps, so OS_CFG_STAT_TASK_IDLE_CYCLES_EN gives a more accurate CPU usage.
 ************************************************************************************************************************
 */
 #if (OS_CFG_TASK_IDLE_EN > 0u)
 void  OS_IdleTask (void  *p_arg)
 {
-#if ((OS_CFG_DBG_EN > 0u) || (OS_CFG_STAT_TASK_EN > 0u))
+#if ((OS_CFG_DBG_EN > 0u) || (OS_CFG_STAT_TASK_EN > 0u)) && (OS_CFG_STAT_TASK_IDLE_CYCLES_EN == 0u)
     CPU_SR_ALLOC();
 #endif
 
@@ -914,8 +1223,8 @@ void  OS_IdleTask (void  *p_arg)
     (void)p_arg;                                                /* Prevent compiler warning for not using 'p_arg'       */
 
     for (;;) {
-#if ((OS_CFG_DBG_EN > 0u) || (OS_CFG_STAT_TASK_EN > 0u))
-        CPU_CRITICAL_ENTER();
+#if ((OS_CFG_DBG_EN > 0u) || (OS_CFG_STAT_TASK_EN > 0u)) && (OS_CFG_STAT_TASK_IDLE_CYCLES_EN == 0u)
+        CPU_CRITICAL_ENTER();                                   /* See Note #4                                          */
 #if (OS_CFG_DBG_EN > 0u)
         OSIdleTaskCtr++;
 #endif
@@ -925,6 +1234,14 @@ void  OS_IdleTask (void  *p_arg)
         CPU_CRITICAL_EXIT();
 #endif
 
+#if (OS_CFG_TASK_STK_CLR_DEFER_EN > 0u)
+        OS_TaskStkClrDefer();                                   /* Clear the stacks of the new tasks, if any            */
+#endif
+
+#if (OS_CFG_TASK_IDLE_PM_EN > 0u)
+        OS_IdlePMSleep();                                       /* Sleep until the next kernel deadline (see Note #5)   */
+#endif
+
 #if (OS_CFG_APP_HOOKS_EN > 0u)
         OSIdleTaskHook();                                       /* Call user definable HOOK                             */
 #endif
@@ -986,12 +1303,31 @@ void  OS_IdleTaskInit (OS_ERR  *p_err)
 *
 *              pending_on     Specifies what the task will be pending on:
 *
+*                                 OS_TASK_PEND_ON_CALL
+*                                 OS_TASK_PEND_ON_CALL_RECV
+*                                 OS_TASK_PEND_ON_CALL_REPLY <- No object (the server is kept in the OS_TCB)
 *                                 OS_TASK_PEND_ON_FLAG
+*                                 OS_TASK_PEND_ON_MBOX
+*                                 OS_TASK_PEND_ON_MEM
+*                                 OS_TASK_PEND_ON_MULTI      <- No object (pending in OSPendMulti())
 *                                 OS_TASK_PEND_ON_TASK_Q     <- No object (pending for a message sent to the task)
 *                                 OS_TASK_PEND_ON_MUTEX
 *                                 OS_TASK_PEND_ON_COND
+*                                 OS_TASK_PEND_ON_COMPLETION <- No object (the task is kept in the OS_COMPLETION)
+*                                 OS_TASK_PEND_ON_PIPE_DATA
+*                                 OS_TASK_PEND_ON_PIPE_SPACE
 *                                 OS_TASK_PEND_ON_Q
+*                                 OS_TASK_PEND_ON_Q_SPACE
+*                                 OS_TASK_PEND_ON_RCU
+*                                 OS_TASK_PEND_ON_REACTOR    <- No object (the task is kept in the OS_REACTOR)
+*                                 OS_TASK_PEND_ON_RING_DATA
+*                                 OS_TASK_PEND_ON_RING_SPACE
+*                                 OS_TASK_PEND_ON_RWLOCK_RD
+*                                 OS_TASK_PEND_ON_RWLOCK_WR
 *                                 OS_TASK_PEND_ON_SEM
+*                                 OS_TASK_PEND_ON_SEQLOCK
+*                                 OS_TASK_PEND_ON_SIGNAL     <- No object (the task is kept in the OS_SIGNAL)
+*                                 OS_TASK_PEND_ON_TASK_NOTIFY <- No object (pending on a notification slot of the task)
 *                                 OS_TASK_PEND_ON_TASK_SEM   <- No object (pending on a signal sent to the task)
 *
 *              timeout        Is the amount of time the task will wait for the event to occur.
@@ -1012,6 +1348,10 @@ void  OS_Pend (OS_PEND_OBJ  *p_obj,
 
     p_tcb->PendOn     = pending_on;                             /* Resource not available, wait until it is             */
     p_tcb->PendStatus = OS_STATUS_PEND_OK;
+#if (OS_CFG_TASK_HIST_EN > 0u)
+    p_tcb->HistPendStart  = OS_TS_GET();                        /* Start measuring the pend duration                    */
+    p_tcb->HistFlags     |= OS_TASK_HIST_FLAG_PEND;
+#endif
 
     OS_TaskBlock(p_tcb,                                         /* Block the task and add it to the tick list if needed */
                  timeout);
@@ -1021,11 +1361,23 @@ void  OS_Pend (OS_PEND_OBJ  *p_obj,
         p_tcb->PendObjPtr =  p_obj;                             /* Save the pointer to the object pending on            */
         OS_PendListInsertPrio(p_pend_list,                      /* Insert in the pend list in priority order            */
                               p_tcb);
+#if (OS_CFG_OBJ_STAT_EN > 0u)
+        p_pend_list->Stat.PendBlockCtr++;
+        if (p_pend_list->Stat.WaitersMax < p_pend_list->NbrEntries) {
+            p_pend_list->Stat.WaitersMax = p_pend_list->NbrEntries;
+        }
+#endif
+#if (OS_CFG_MUTEX_EN > 0u) && (OS_CFG_MUTEX_GRP_SORT_EN > 0u)
+        if ((pending_on           == OS_TASK_PEND_ON_MUTEX) &&  /* New first waiter of a mutex?                         */
+            (p_pend_list->HeadPtr == p_tcb)) {
+            OS_MutexGrpPrioUpdate((OS_MUTEX *)((void *)p_obj));
+        }
+#endif
 
     } else {
         p_tcb->PendObjPtr = (OS_PEND_OBJ *)0;                   /* If no object being pended on, clear the pend object  */
     }
-#if (OS_CFG_DBG_EN > 0u)
+#if (OS_DBG_PEND_NAME_EN > 0u)
     OS_PendDbgNameAdd(p_obj,
                       p_tcb);
 #endif
@@ -1065,12 +1417,18 @@ void  OS_PendAbort (OS_TCB     *p_tcb,
     switch (p_tcb->TaskState) {
         case OS_TASK_STATE_PEND:
         case OS_TASK_STATE_PEND_TIMEOUT:
-#if (OS_MSG_EN > 0u)
+#if (OS_TCB_MSG_EN > 0u)
              p_tcb->MsgPtr     = (void *)0;
              p_tcb->MsgSize    =         0u;
 #endif
 #if (OS_CFG_TS_EN > 0u)
              p_tcb->TS         = ts;
+#endif
+#if (OS_CFG_OBJ_STAT_EN > 0u)
+             if ((reason                      == OS_STATUS_PEND_ABORT) &&
+                 (OS_PEND_OBJ_HAS_LIST(p_tcb) == OS_TRUE)) {
+                 p_tcb->PendObjPtr->PendList.Stat.PendAbortCtr++;
+             }
 #endif
              OS_PendListRemove(p_tcb);                          /* Remove task from the pend list                       */
 
@@ -1087,12 +1445,18 @@ void  OS_PendAbort (OS_TCB     *p_tcb,
 
         case OS_TASK_STATE_PEND_SUSPENDED:
         case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
-#if (OS_MSG_EN > 0u)
+#if (OS_TCB_MSG_EN > 0u)
              p_tcb->MsgPtr     = (void *)0;
              p_tcb->MsgSize    =         0u;
 #endif
 #if (OS_CFG_TS_EN > 0u)
              p_tcb->TS         = ts;
+#endif
+#if (OS_CFG_OBJ_STAT_EN > 0u)
+             if ((reason                      == OS_STATUS_PEND_ABORT) &&
+                 (OS_PEND_OBJ_HAS_LIST(p_tcb) == OS_TRUE)) {
+                 p_tcb->PendObjPtr->PendList.Stat.PendAbortCtr++;
+             }
 #endif
              OS_PendListRemove(p_tcb);                          /* Remove task from the pend list                       */
 
@@ -1131,10 +1495,14 @@ void  OS_PendAbort (OS_TCB     *p_tcb,
 * Returns    : none
 *
 * Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application must not call it.
+*
+*              2) They are only called when OS_CFG_DBG_PEND_NAME_EN is enabled.  Otherwise the '.DbgNamePtr' members
+*                 are left as they were set when the task or object was created, and the names are obtained on
+*                 request with OSDbgPendNameGet() and OSDbgWaiterNameGet().
 ************************************************************************************************************************
 */
 
-#if (OS_CFG_DBG_EN > 0u)
+#if (OS_DBG_PEND_NAME_EN > 0u)
 void  OS_PendDbgNameAdd (OS_PEND_OBJ  *p_obj,
                          OS_TCB       *p_tcb)
 {
@@ -1148,18 +1516,9 @@ void  OS_PendDbgNameAdd (OS_PEND_OBJ  *p_obj,
         p_tcb1            =  p_pend_list->HeadPtr;
         p_obj->DbgNamePtr =  p_tcb1->NamePtr;                   /* ... Save in object                                   */
     } else {
-        switch (p_tcb->PendOn) {
-            case OS_TASK_PEND_ON_TASK_Q:
-                 p_tcb->DbgNamePtr = (CPU_CHAR *)((void *)"Task Q");
-                 break;
-
-            case OS_TASK_PEND_ON_TASK_SEM:
-                 p_tcb->DbgNamePtr = (CPU_CHAR *)((void *)"Task Sem");
-                 break;
-
-            default:
-                 p_tcb->DbgNamePtr = (CPU_CHAR *)((void *)" ");
-                 break;
+        p_tcb->DbgNamePtr =  OS_PendDbgNameOn(p_tcb->PendOn);
+        if (p_tcb->DbgNamePtr == (CPU_CHAR *)0) {
+            p_tcb->DbgNamePtr = (CPU_CHAR *)((void *)" ");
         }
     }
 }
@@ -1189,107 +1548,311 @@ void  OS_PendDbgNameRemove (OS_PEND_OBJ  *p_obj,
 
 /*
 ************************************************************************************************************************
-*                                 CHANGE THE PRIORITY OF A TASK WAITING IN A PEND LIST
-*
-* Description: This function is called to change the position of a task waiting in a pend list. The strategy used is to
-*              remove the task from the pend list and add it again using its changed priority.
+*                                        GET THE NAME OF WHAT A TASK IS PENDING ON
 *
-* Arguments  : p_tcb       is a pointer to the TCB of the task to move
-*              -----
+* Description: This function returns the name of the object, or of the kind of wait, a task is pending on.  It gives
+*              kernel aware tools the name that '.DbgNamePtr' of the OS_TCB holds when OS_CFG_DBG_PEND_NAME_EN is
+*              enabled, without keeping it up to date at each pend and post.
 *
-* Returns    : none
+* Arguments  : p_tcb     is a pointer to the OS_TCB of the task
 *
-* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+* Returns    : The name, " " if the task isn't pending.
 *
-*              2) It's assumed that the TCB contains the NEW priority in its .Prio field.
+* Note(s)    : 1) The name is read from the object pointed to by '.PendObjPtr' (see also OSObjRegGet()).
 ************************************************************************************************************************
 */
 
-void  OS_PendListChangePrio (OS_TCB  *p_tcb)
+#if (OS_CFG_DBG_EN > 0u)
+CPU_CHAR  *OSDbgPendNameGet (OS_TCB  *p_tcb)
 {
-    OS_PEND_LIST  *p_pend_list;
-    OS_PEND_OBJ   *p_obj;
+    CPU_CHAR  *p_name;
+    CPU_SR_ALLOC();
 
-    p_obj       =  p_tcb->PendObjPtr;                           /* Get pointer to pend list                             */
-    p_pend_list = &p_obj->PendList;
 
-    if (p_pend_list->HeadPtr->PendNextPtr != (OS_TCB *)0) {     /* Only move if multiple entries in the list            */
-            OS_PendListRemove(p_tcb);                           /* Remove entry from current position                   */
-            p_tcb->PendObjPtr = p_obj;
-            OS_PendListInsertPrio(p_pend_list,                  /* INSERT it back in the list                           */
-                                  p_tcb);
+    if (p_tcb == (OS_TCB *)0) {
+        return ((CPU_CHAR *)((void *)" "));
+    }
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb->PendOn == OS_TASK_PEND_ON_NOTHING) {
+        p_name = (CPU_CHAR *)0;
+    } else {
+        p_name = OS_PendDbgNameOn(p_tcb->PendOn);               /* Pends that don't have an object                      */
+        if ((p_name            == (CPU_CHAR    *)0) &&
+            (p_tcb->PendObjPtr != (OS_PEND_OBJ *)0)) {
+            p_name = p_tcb->PendObjPtr->NamePtr;                /* Named after the object                               */
+        }
+    }
+    CPU_CRITICAL_EXIT();
+
+    if (p_name == (CPU_CHAR *)0) {
+        p_name = (CPU_CHAR *)((void *)" ");
     }
+    return (p_name);
 }
 
 
 /*
 ************************************************************************************************************************
-*                                                INITIALIZE A WAIT LIST
+*                                  GET THE NAME OF THE TASK WAITING FIRST ON AN OBJECT
 *
-* Description: This function is called to initialize the fields of an OS_PEND_LIST.
+* Description: This function returns the name of the highest priority task waiting on an object, i.e. the name that
+*              '.DbgNamePtr' of the object holds when OS_CFG_DBG_PEND_NAME_EN is enabled.
 *
-* Arguments  : p_pend_list   is a pointer to an OS_PEND_LIST
-*              -----------
+* Arguments  : p_obj     is a pointer to a kernel object that starts like OS_PEND_OBJ (event flag group, mutex, message
+*                        queue, semaphore, ...)
 *
-* Returns    : none
+* Returns    : The name, " " if no task is waiting.
 *
-* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application must not call it.
+* Note(s)    : none
 ************************************************************************************************************************
 */
 
-void  OS_PendListInit (OS_PEND_LIST  *p_pend_list)
+CPU_CHAR  *OSDbgWaiterNameGet (void  *p_obj)
 {
-    p_pend_list->HeadPtr    = (OS_TCB *)0;
-    p_pend_list->TailPtr    = (OS_TCB *)0;
-#if (OS_CFG_DBG_EN > 0u)
-    p_pend_list->NbrEntries =           0u;
-#endif
+    OS_TCB    *p_tcb;
+    CPU_CHAR  *p_name;
+    CPU_SR_ALLOC();
+
+
+    p_name = (CPU_CHAR *)((void *)" ");
+    if (p_obj == (void *)0) {
+        return (p_name);
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_tcb = OS_PEND_LIST_HEAD(&((OS_PEND_OBJ *)p_obj)->PendList);
+    if (p_tcb != (OS_TCB *)0) {
+        p_name = p_tcb->NamePtr;
+    }
+    CPU_CRITICAL_EXIT();
+    return (p_name);
 }
 
 
 /*
 ************************************************************************************************************************
-*                                  INSERT A TASK BASED ON IT'S PRIORITY IN A PEND LIST
-*
-* Description: This function is called to place an OS_TCB entry in a linked list based on its priority.  The
-*              highest priority being placed at the head of the list. The TCB is assumed to contain the priority
-*              of the task in its .Prio field.
-*
-*              CASE 0: Insert in an empty list.
-*
-*                     OS_PEND_LIST
-*                     +---------------+
-*                     | TailPtr       |-> 0
-*                     +---------------+
-*                     | HeadPtr       |-> 0
-*                     +---------------+
-*                     | NbrEntries=0  |
-*                     +---------------+
-*
+*                                     GET THE NAME OF A PEND WITHOUT AN OBJECT
 *
+* Description: This function returns the name shown for the pends that are not on a kernel object (task queue, task
+*              semaphore, multiple objects, ...).
 *
-*              CASE 1: Insert BEFORE or AFTER an OS_TCB
-*
-*                     OS_PEND_LIST
-*                     +--------------+         OS_TCB
-*                     | TailPtr      |--+---> +--------------+
-*                     +--------------+  |     | PendNextPtr  |->0
-*                     | HeadPtr      |--/     +--------------+
-*                     +--------------+     0<-| PendPrevPtr  |
-*                     | NbrEntries=1 |        +--------------+
-*                     +--------------+        |              |
-*                                             +--------------+
-*                                             |              |
-*                                             +--------------+
+* Arguments  : pend_on   is what the task is pending on (OS_TASK_PEND_ON_xxx)
 *
+* Returns    : The name, a NULL pointer if 'pend_on' is a pend on an object.
 *
-*                     OS_PEND_LIST
-*                     +--------------+
-*                     | TailPtr      |---------------------------------------------------+
-*                     +--------------+         OS_TCB                 OS_TCB             |    OS_TCB
-*                     | HeadPtr      |------> +--------------+       +--------------+    +-> +--------------+
-*                     +--------------+        | PendNextPtr  |<------| PendNextPtr  | ...... | PendNextPtr  |->0
-*                     | NbrEntries=N |        +--------------+       +--------------+        +--------------+
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application must not call it.
+************************************************************************************************************************
+*/
+
+CPU_CHAR  *OS_PendDbgNameOn (OS_STATE  pend_on)
+{
+    CPU_CHAR  *p_name;
+
+
+    switch (pend_on) {
+        case OS_TASK_PEND_ON_TASK_Q:
+             p_name = (CPU_CHAR *)((void *)"Task Q");
+             break;
+
+        case OS_TASK_PEND_ON_TASK_SEM:
+             p_name = (CPU_CHAR *)((void *)"Task Sem");
+             break;
+
+#if (OS_CFG_TASK_NOTIFY_EN > 0u)
+        case OS_TASK_PEND_ON_TASK_NOTIFY:
+             p_name = (CPU_CHAR *)((void *)"Task Notify");
+             break;
+#endif
+
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+        case OS_TASK_PEND_ON_MULTI:
+             p_name = (CPU_CHAR *)((void *)"Multi");
+             break;
+#endif
+
+#if (OS_CFG_SIGNAL_EN > 0u)
+        case OS_TASK_PEND_ON_SIGNAL:
+             p_name = (CPU_CHAR *)((void *)"Signal");
+             break;
+#endif
+
+#if (OS_CFG_COMPLETION_EN > 0u)
+        case OS_TASK_PEND_ON_COMPLETION:
+             p_name = (CPU_CHAR *)((void *)"Completion");
+             break;
+#endif
+
+#if (OS_CFG_REACTOR_EN > 0u)
+        case OS_TASK_PEND_ON_REACTOR:
+             p_name = (CPU_CHAR *)((void *)"Reactor");
+             break;
+#endif
+
+#if (OS_CFG_CALL_EN > 0u)
+        case OS_TASK_PEND_ON_CALL_REPLY:
+             p_name = (CPU_CHAR *)((void *)"Call");
+             break;
+#endif
+
+        default:
+             p_name = (CPU_CHAR *)0;
+             break;
+    }
+    return (p_name);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                 CHANGE THE PRIORITY OF A TASK WAITING IN A PEND LIST
+*
+* Description: This function is called to change the position of a task waiting in a pend list. The strategy used is to
+*              remove the task from the pend list and add it again using its changed priority.
+*
+* Arguments  : p_tcb       is a pointer to the TCB of the task to move
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) It's assumed that the TCB contains the NEW priority in its .Prio field.
+************************************************************************************************************************
+*/
+
+void  OS_PendListChangePrio (OS_TCB  *p_tcb)
+{
+    OS_PEND_LIST  *p_pend_list;
+    OS_PEND_OBJ   *p_obj;
+
+    p_obj       =  p_tcb->PendObjPtr;                           /* Get pointer to pend list                             */
+    p_pend_list = &p_obj->PendList;
+
+#if (OS_CFG_PEND_LIST_BITMAP_EN > 0u)
+    OS_PendListRemove(p_tcb);                                   /* Always move, the bitmap must follow the new priority */
+    p_tcb->PendObjPtr = p_obj;
+    OS_PendListInsertPrio(p_pend_list,
+                          p_tcb);
+#if (OS_CFG_FLAG_EN > 0u) && (OS_CFG_FLAG_WAIT_IDX_EN > 0u)
+    if (p_tcb->PendOn == OS_TASK_PEND_ON_FLAG) {                /* OS_PendListRemove() also unlinked the flag waiter    */
+        OS_FlagIdxInsert((OS_FLAG_GRP *)((void *)p_obj), p_tcb);
+    }
+#endif
+#else
+    if (p_pend_list->HeadPtr->PendNextPtr != (OS_TCB *)0) {     /* Only move if multiple entries in the list            */
+            OS_PendListRemove(p_tcb);                           /* Remove entry from current position                   */
+            p_tcb->PendObjPtr = p_obj;
+            OS_PendListInsertPrio(p_pend_list,                  /* INSERT it back in the list                           */
+                                  p_tcb);
+#if (OS_CFG_FLAG_EN > 0u) && (OS_CFG_FLAG_WAIT_IDX_EN > 0u)
+            if (p_tcb->PendOn == OS_TASK_PEND_ON_FLAG) {        /* OS_PendListRemove() also unlinked the flag waiter    */
+                OS_FlagIdxInsert((OS_FLAG_GRP *)((void *)p_obj), p_tcb);
+            }
+#endif
+    }
+#endif
+#if (OS_CFG_MUTEX_EN > 0u) && (OS_CFG_MUTEX_GRP_SORT_EN > 0u)
+    if (p_tcb->PendOn == OS_TASK_PEND_ON_MUTEX) {               /* The priority of the first waiter may have changed    */
+        OS_MutexGrpPrioUpdate((OS_MUTEX *)((void *)p_obj));
+    }
+#endif
+}
+
+
+/*
+************************************************************************************************************************
+*                                                INITIALIZE A WAIT LIST
+*
+* Description: This function is called to initialize the fields of an OS_PEND_LIST.
+*
+* Arguments  : p_pend_list   is a pointer to an OS_PEND_LIST
+*              -----------
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application must not call it.
+************************************************************************************************************************
+*/
+
+void  OS_PendListInit (OS_PEND_LIST  *p_pend_list)
+{
+#if (OS_CFG_PEND_LIST_BITMAP_EN > 0u)
+    CPU_DATA  i;
+#endif
+
+
+    p_pend_list->HeadPtr    = (OS_TCB *)0;
+#if (OS_CFG_SMALL_MEM_EN == 0u)
+    p_pend_list->TailPtr    = (OS_TCB *)0;
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_pend_list->NbrEntries =           0u;
+#endif
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+    p_pend_list->MultiHeadPtr = (OS_PEND_DATA *)0;
+#endif
+#if (OS_CFG_REACTOR_EN > 0u)
+    p_pend_list->ReactorSrcPtr = (OS_REACTOR_SRC *)0;
+#endif
+#if (OS_CFG_OBJ_STAT_EN > 0u)
+    OS_ObjStatReset(&p_pend_list->Stat);
+#endif
+#if (OS_CFG_PEND_LIST_BITMAP_EN > 0u)
+    for (i = 0u; i < OS_PRIO_TBL_SIZE; i++) {                   /* No priority has a waiter yet                         */
+        p_pend_list->PrioTbl[i]     =           0u;
+    }
+    for (i = 0u; i < OS_CFG_PRIO_MAX; i++) {
+        p_pend_list->PrioTailPtr[i] = (OS_TCB *)0;
+    }
+#endif
+}
+
+
+/*
+************************************************************************************************************************
+*                                  INSERT A TASK BASED ON IT'S PRIORITY IN A PEND LIST
+*
+* Description: This function is called to place an OS_TCB entry in a linked list based on its priority.  The
+*              highest priority being placed at the head of the list. The TCB is assumed to contain the priority
+*              of the task in its .Prio field.
+*
+*              CASE 0: Insert in an empty list.
+*
+*                     OS_PEND_LIST
+*                     +---------------+
+*                     | TailPtr       |-> 0
+*                     +---------------+
+*                     | HeadPtr       |-> 0
+*                     +---------------+
+*                     | NbrEntries=0  |
+*                     +---------------+
+*
+*
+*
+*              CASE 1: Insert BEFORE or AFTER an OS_TCB
+*
+*                     OS_PEND_LIST
+*                     +--------------+         OS_TCB
+*                     | TailPtr      |--+---> +--------------+
+*                     +--------------+  |     | PendNextPtr  |->0
+*                     | HeadPtr      |--/     +--------------+
+*                     +--------------+     0<-| PendPrevPtr  |
+*                     | NbrEntries=1 |        +--------------+
+*                     +--------------+        |              |
+*                                             +--------------+
+*                                             |              |
+*                                             +--------------+
+*
+*
+*                     OS_PEND_LIST
+*                     +--------------+
+*                     | TailPtr      |---------------------------------------------------+
+*                     +--------------+         OS_TCB                 OS_TCB             |    OS_TCB
+*                     | HeadPtr      |------> +--------------+       +--------------+    +-> +--------------+
+*                     +--------------+        | PendNextPtr  |<------| PendNextPtr  | ...... | PendNextPtr  |->0
+*                     | NbrEntries=N |        +--------------+       +--------------+        +--------------+
 *                     +--------------+     0<-| PendPrevPtr  |<------| PendPrevPtr  | ...... | PendPrevPtr  |
 *                                             +--------------+       +--------------+        +--------------+
 *                                             |              |       |              |        |              |
@@ -1307,9 +1870,106 @@ void  OS_PendListInit (OS_PEND_LIST  *p_pend_list)
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) When OS_CFG_PEND_LIST_BITMAP_EN is enabled, the pend list keeps a bitmap of the priorities that have
+*                 waiters and a pointer to the last waiter at each priority.  The TCB is then linked right after the
+*                 last waiter of the same or the closest higher priority without walking the list.
+*
+*              3) When OS_CFG_SMALL_MEM_EN is enabled, the pend list is only linked forward (there is no '.PendPrevPtr'
+*                 nor '.TailPtr').
+*
+*              4) When OS_CFG_TASK_EDF_PEND_EN is enabled, waiters of the same priority are ordered by deadline instead
+*                 of FIFO, see OS_PendListDeadlineFirst().  With the bitmap, a waiter due after the last one of its
+*                 priority is still linked in constant time, the others walk the waiters of their priority.
 ************************************************************************************************************************
 */
 
+#if (OS_CFG_PEND_LIST_BITMAP_EN > 0u)
+void  OS_PendListInsertPrio (OS_PEND_LIST  *p_pend_list,
+                             OS_TCB        *p_tcb)
+{
+    OS_PRIO   prio;
+    OS_TCB   *p_tcb_prev;
+    OS_TCB   *p_tcb_next;
+
+
+    prio            = p_tcb->Prio;                              /* Obtain the priority of the task to insert            */
+    p_tcb->PendPrio = prio;
+
+    p_tcb_prev      = p_pend_list->PrioTailPtr[prio];           /* Insert after the last waiter at the same priority    */
+    if (p_tcb_prev == (OS_TCB *)0) {                            /* ... or after the closest higher priority waiter      */
+        p_tcb_prev  = OS_PendListPrioPrevGet(p_pend_list, prio);
+        p_pend_list->PrioTbl[prio / (CPU_CFG_DATA_SIZE * 8u)] |= (CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - (prio % (CPU_CFG_DATA_SIZE * 8u)));
+        p_pend_list->PrioTailPtr[prio] = p_tcb;
+#if (OS_CFG_TASK_EDF_PEND_EN > 0u)
+    } else if (OS_PendListDeadlineFirst(p_tcb, p_tcb_prev) == OS_TRUE) {
+                                                                /* Due before the last waiter, see Note #4              */
+        p_tcb_prev  = OS_PendListPrioPrevGet(p_pend_list, prio);
+        p_tcb_next  = (p_tcb_prev == (OS_TCB *)0) ? p_pend_list->HeadPtr : p_tcb_prev->PendNextPtr;
+        while (OS_PendListDeadlineFirst(p_tcb, p_tcb_next) == OS_FALSE) {
+            p_tcb_prev = p_tcb_next;                            /* Stops at the last waiter of the priority at worst    */
+            p_tcb_next = p_tcb_next->PendNextPtr;
+        }
+#endif
+    } else {
+        p_pend_list->PrioTailPtr[prio] = p_tcb;
+    }
+
+    if (p_tcb_prev == (OS_TCB *)0) {                            /* New TCB is the highest priority waiter               */
+        p_tcb_next           = p_pend_list->HeadPtr;
+        p_pend_list->HeadPtr = p_tcb;
+    } else {
+        p_tcb_next              = p_tcb_prev->PendNextPtr;
+        p_tcb_prev->PendNextPtr = p_tcb;
+    }
+    p_tcb->PendPrevPtr = p_tcb_prev;
+    p_tcb->PendNextPtr = p_tcb_next;
+    if (p_tcb_next == (OS_TCB *)0) {                            /* New TCB is the lowest priority waiter                */
+        p_pend_list->TailPtr    = p_tcb;
+    } else {
+        p_tcb_next->PendPrevPtr = p_tcb;
+    }
+#if (OS_CFG_DBG_EN > 0u)
+    p_pend_list->NbrEntries++;                                  /* One more OS_TCB in the list                          */
+#endif
+}
+
+#elif (OS_CFG_SMALL_MEM_EN > 0u)
+void  OS_PendListInsertPrio (OS_PEND_LIST  *p_pend_list,
+                             OS_TCB        *p_tcb)
+{
+    OS_PRIO   prio;
+    OS_TCB   *p_tcb_prev;
+    OS_TCB   *p_tcb_next;
+
+
+    prio       = p_tcb->Prio;                                   /* Obtain the priority of the task to insert            */
+    p_tcb_prev = (OS_TCB *)0;
+    p_tcb_next = p_pend_list->HeadPtr;
+    while ((p_tcb_next != (OS_TCB *)0) &&                       /* Find the first waiter of lower priority              */
+           (prio       >= p_tcb_next->Prio)) {
+#if (OS_CFG_TASK_EDF_PEND_EN > 0u)
+        if ((prio == p_tcb_next->Prio) &&                       /* ... or of the same priority due later (Note #4)      */
+            (OS_PendListDeadlineFirst(p_tcb, p_tcb_next) == OS_TRUE)) {
+            break;
+        }
+#endif
+        p_tcb_prev = p_tcb_next;
+        p_tcb_next = p_tcb_next->PendNextPtr;
+    }
+
+    p_tcb->PendNextPtr = p_tcb_next;                            /* ... and insert the TCB before it                     */
+    if (p_tcb_prev == (OS_TCB *)0) {
+        p_pend_list->HeadPtr    = p_tcb;                        /* New TCB is the highest priority waiter               */
+    } else {
+        p_tcb_prev->PendNextPtr = p_tcb;
+    }
+#if (OS_CFG_DBG_EN > 0u)
+    p_pend_list->NbrEntries++;                                  /* One more OS_TCB in the list                          */
+#endif
+}
+
+#else
 void  OS_PendListInsertPrio (OS_PEND_LIST  *p_pend_list,
                              OS_TCB        *p_tcb)
 {
@@ -1335,6 +1995,11 @@ void  OS_PendListInsertPrio (OS_PEND_LIST  *p_pend_list,
         while (p_tcb_next != (OS_TCB *)0) {                     /* Find the position where to insert                    */
             if (prio < p_tcb_next->Prio) {
                 break;                                          /* Found! ... insert BEFORE current                     */
+#if (OS_CFG_TASK_EDF_PEND_EN > 0u)
+            } else if ((prio == p_tcb_next->Prio) &&            /* Same priority but due later, see Note #4             */
+                       (OS_PendListDeadlineFirst(p_tcb, p_tcb_next) == OS_TRUE)) {
+                break;
+#endif
             } else {
                 p_tcb_next = p_tcb_next->PendNextPtr;           /* Not Found, follow the list                           */
             }
@@ -1359,6 +2024,118 @@ void  OS_PendListInsertPrio (OS_PEND_LIST  *p_pend_list,
         }
     }
 }
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                  FIND THE LAST WAITER OF THE CLOSEST HIGHER PRIORITY
+*
+* Description: This function looks in the priority bitmap of a pend list for the closest priority above 'prio' that
+*              has waiters and returns the last of them.
+*
+* Arguments  : p_pend_list    is a pointer to the OS_PEND_LIST to search
+*              -----------
+*
+*              prio           is the priority of the task about to be inserted
+*
+* Returns    : A pointer to the last waiter at the closest higher priority, or a NULL pointer if no waiter has a higher
+*              priority than 'prio'.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The bitmap uses the same layout as OSPrioTbl[], priority 0 being the MSB of the first entry.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_PEND_LIST_BITMAP_EN > 0u)
+static  OS_TCB  *OS_PendListPrioPrevGet (OS_PEND_LIST  *p_pend_list,
+                                         OS_PRIO        prio)
+{
+    CPU_DATA  ix;
+    CPU_DATA  map;
+
+
+    ix  = prio / (CPU_CFG_DATA_SIZE * 8u);                      /* Keep only the higher priorities of the first entry   */
+    map = p_pend_list->PrioTbl[ix] & (CPU_DATA)~((CPU_DATA)~(CPU_DATA)0u >> (prio % (CPU_CFG_DATA_SIZE * 8u)));
+
+    for (;;) {
+        if (map != 0u) {                                        /* Lowest bit set is the closest higher priority        */
+            return (p_pend_list->PrioTailPtr[(ix * (CPU_CFG_DATA_SIZE * 8u)) + (((CPU_CFG_DATA_SIZE * 8u) - 1u) - (CPU_DATA)CPU_CntTrailZeros(map))]);
+        }
+        if (ix == 0u) {
+            return ((OS_TCB *)0);
+        }
+        ix--;
+        map = p_pend_list->PrioTbl[ix];
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                    COMPARE THE DEADLINES OF TWO WAITERS OF A PEND LIST
+*
+* Description: This function tells whether a task about to be inserted in a pend list must be placed ahead of a waiter
+*              of the same priority, so that the waiter with the earliest deadline ('.EDFDeadline') gets the resource
+*              first.
+*
+* Arguments  : p_tcb          is the OS_TCB of the task to insert
+*              -----
+*
+*              p_tcb2         is the OS_TCB of a waiter of the same priority already in the list
+*              ------
+*
+* Returns    : OS_TRUE        if 'p_tcb' must be placed before 'p_tcb2'
+*              OS_FALSE       otherwise
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Only the tasks with a period (see OSTaskPeriodSet()) have a deadline.  They are placed ahead of the
+*                 waiters of the same priority without a period, which stay in FIFO order behind them.
+*
+*              3) Waiters with the same deadline are kept in FIFO order or, when OS_CFG_TASK_EDF_PEND_TIE_EN is
+*                 enabled, the one with the shorter period goes first.
+*
+*              4) Deadlines are compared relative to each other to survive the wrap of OSTickCtr, as in
+*                 OS_RdyListInsertEDF().
+*
+*              5) The deadline is the one of the task when it starts to wait.  A priority change (e.g. through priority
+*                 inheritance) moves the task with OS_PendListChangePrio() and sorts it again among the waiters of its
+*                 new priority.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_EDF_PEND_EN > 0u)
+static  CPU_BOOLEAN  OS_PendListDeadlineFirst (OS_TCB  *p_tcb,
+                                               OS_TCB  *p_tcb2)
+{
+    OS_TICK  diff;
+
+
+    if (p_tcb->Period == 0u) {                                  /* See Note #2                                          */
+        return (OS_FALSE);
+    }
+    if (p_tcb2->Period == 0u) {
+        return (OS_TRUE);
+    }
+
+    diff = p_tcb->EDFDeadline - p_tcb2->EDFDeadline;
+    if (diff == 0u) {                                           /* See Note #3                                          */
+#if (OS_CFG_TASK_EDF_PEND_TIE_EN > 0u)
+        if (p_tcb->Period < p_tcb2->Period) {
+            return (OS_TRUE);
+        }
+#endif
+        return (OS_FALSE);
+    }
+    if (diff > ((OS_TICK)~(OS_TICK)0u >> 1u)) {                 /* Due before 'p_tcb2' (see Note #4)                    */
+        return (OS_TRUE);
+    }
+    return (OS_FALSE);
+}
+#endif
 
 
 /*
@@ -1406,20 +2183,90 @@ void  OS_PendListInsertPrio (OS_PEND_LIST  *p_pend_list,
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) With OS_CFG_SMALL_MEM_EN, the TCB before the one removed is found by walking the list from its head.
 ************************************************************************************************************************
 */
 
 void  OS_PendListRemove (OS_TCB  *p_tcb)
 {
     OS_PEND_LIST  *p_pend_list;
+#if (OS_CFG_SMALL_MEM_EN == 0u)
     OS_TCB        *p_next;
+#endif
     OS_TCB        *p_prev;
+#if (OS_CFG_PEND_LIST_BITMAP_EN > 0u)
+    OS_PRIO        prio;
+#endif
+#if (OS_CFG_MUTEX_EN > 0u) && (OS_CFG_MUTEX_GRP_SORT_EN > 0u)
+    OS_MUTEX      *p_mutex;
+#endif
 
 
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+    if (p_tcb->PendOn == OS_TASK_PEND_ON_MULTI) {               /* Waiting in OSPendMulti(), unlink from all objects    */
+        OS_PendMultiRemove(p_tcb);
+    }
+#endif
+#if (OS_CFG_SIGNAL_EN > 0u)
+    if (p_tcb->PendOn == OS_TASK_PEND_ON_SIGNAL) {              /* Waiting on a signal, release the signal              */
+        OS_SignalPendRemove(p_tcb);
+    }
+#endif
+#if (OS_CFG_COMPLETION_EN > 0u)
+    if (p_tcb->PendOn == OS_TASK_PEND_ON_COMPLETION) {          /* Waiting on a completion, release the completion      */
+        OS_CompletionPendRemove(p_tcb);
+    }
+#endif
+#if (OS_CFG_REACTOR_EN > 0u)
+    if (p_tcb->PendOn == OS_TASK_PEND_ON_REACTOR) {             /* Waiting in OSReactorRun(), release the reactor       */
+        OS_ReactorPendRemove(p_tcb);
+    }
+#endif
+
     if (p_tcb->PendObjPtr != (OS_PEND_OBJ *)0) {                /* Only remove if object has a pend list.               */
         p_pend_list = &p_tcb->PendObjPtr->PendList;             /* Get pointer to pend list                             */
 
+#if (OS_CFG_FLAG_EN > 0u) && (OS_CFG_FLAG_WAIT_IDX_EN > 0u)
+        if (p_tcb->FlagIdx != OS_FLAG_IDX_NONE) {               /* Also remove from the event flag waiter index         */
+            OS_FlagIdxRemove((OS_FLAG_GRP *)((void *)p_tcb->PendObjPtr), p_tcb);
+        }
+#endif
+#if (OS_CFG_MUTEX_EN > 0u) && (OS_CFG_MUTEX_GRP_SORT_EN > 0u)
+        if ((p_tcb->PendOn        == OS_TASK_PEND_ON_MUTEX) &&  /* Removing the first waiter of a mutex?                */
+            (p_pend_list->HeadPtr == p_tcb)) {
+            p_mutex = (OS_MUTEX *)((void *)p_tcb->PendObjPtr);
+        } else {
+            p_mutex = (OS_MUTEX *)0;
+        }
+#endif
+
+#if (OS_CFG_PEND_LIST_BITMAP_EN > 0u)
+        prio = p_tcb->PendPrio;
+        if (p_pend_list->PrioTailPtr[prio] == p_tcb) {          /* Was this the last waiter at its priority?            */
+            p_prev = p_tcb->PendPrevPtr;
+            if ((p_prev         != (OS_TCB *)0) &&
+                (p_prev->PendPrio == prio)) {
+                p_pend_list->PrioTailPtr[prio] = p_prev;
+            } else {                                            /* No more waiters at this priority                     */
+                p_pend_list->PrioTailPtr[prio] = (OS_TCB *)0;
+                p_pend_list->PrioTbl[prio / (CPU_CFG_DATA_SIZE * 8u)] &= ~((CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - (prio % (CPU_CFG_DATA_SIZE * 8u))));
+            }
+        }
+#endif
+
                                                                 /* Remove TCB from the pend list.                       */
+#if (OS_CFG_SMALL_MEM_EN > 0u)
+        if (p_pend_list->HeadPtr == p_tcb) {                    /* See Note #2                                          */
+            p_pend_list->HeadPtr = p_tcb->PendNextPtr;
+        } else {
+            p_prev = p_pend_list->HeadPtr;                      /* Find the TCB linked before ours                      */
+            while (p_prev->PendNextPtr != p_tcb) {
+                p_prev = p_prev->PendNextPtr;
+            }
+            p_prev->PendNextPtr = p_tcb->PendNextPtr;
+        }
+#else
         if (p_pend_list->HeadPtr->PendNextPtr == (OS_TCB *)0) {
             p_pend_list->HeadPtr = (OS_TCB *)0;                 /* Only one entry in the pend list                      */
             p_pend_list->TailPtr = (OS_TCB *)0;
@@ -1439,12 +2286,20 @@ void  OS_PendListRemove (OS_TCB  *p_tcb)
             p_prev->PendNextPtr  = p_next;
             p_next->PendPrevPtr  = p_prev;
         }
+#endif
 #if (OS_CFG_DBG_EN > 0u)
         p_pend_list->NbrEntries--;                              /* One less entry in the list                           */
 #endif
         p_tcb->PendNextPtr = (OS_TCB      *)0;
+#if (OS_CFG_SMALL_MEM_EN == 0u)
         p_tcb->PendPrevPtr = (OS_TCB      *)0;
+#endif
         p_tcb->PendObjPtr  = (OS_PEND_OBJ *)0;
+#if (OS_CFG_MUTEX_EN > 0u) && (OS_CFG_MUTEX_GRP_SORT_EN > 0u)
+        if (p_mutex != (OS_MUTEX *)0) {                         /* Reposition the mutex in its owner's group            */
+            OS_MutexGrpPrioUpdate(p_mutex);
+        }
+#endif
     }
 }
 
@@ -1483,11 +2338,19 @@ void  OS_Post (OS_PEND_OBJ  *p_obj,
 #if (OS_CFG_TS_EN == 0u)
     (void)ts;                                                   /* Prevent compiler warning for not using 'ts'          */
 #endif
-#if (OS_MSG_EN == 0u)
+#if (OS_TCB_MSG_EN == 0u)
     (void)p_void;
     (void)msg_size;
 #endif
 
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+    OS_PendMultiRdy(p_obj,                                      /* Tell OSPendMulti() which object readied the task     */
+                    p_tcb,
+                    p_void,
+                    msg_size,
+                    ts);
+#endif
+
     switch (p_tcb->TaskState) {
         case OS_TASK_STATE_RDY:                                 /* Cannot Post a task that is ready                     */
         case OS_TASK_STATE_DLY:                                 /* Cannot Post a task that is delayed                   */
@@ -1497,7 +2360,7 @@ void  OS_Post (OS_PEND_OBJ  *p_obj,
 
         case OS_TASK_STATE_PEND:
         case OS_TASK_STATE_PEND_TIMEOUT:
-#if (OS_MSG_EN > 0u)
+#if (OS_TCB_MSG_EN > 0u)
              p_tcb->MsgPtr  = p_void;                           /* Deposit message in OS_TCB of task waiting            */
              p_tcb->MsgSize = msg_size;                         /* ... assuming posting a message                       */
 #endif
@@ -1505,9 +2368,10 @@ void  OS_Post (OS_PEND_OBJ  *p_obj,
                  p_tcb->TS      = ts;
 #endif
              if (p_obj != (OS_PEND_OBJ *)0) {
+                 OS_OBJ_STAT_INC(&p_obj->PendList, PendCtr);    /* The pend of the task succeeded                       */
                  OS_PendListRemove(p_tcb);                      /* Remove task from pend list                           */
              }
-#if (OS_CFG_DBG_EN > 0u)
+#if (OS_DBG_PEND_NAME_EN > 0u)
              OS_PendDbgNameRemove(p_obj,
                                   p_tcb);
 #endif
@@ -1524,7 +2388,7 @@ void  OS_Post (OS_PEND_OBJ  *p_obj,
 
         case OS_TASK_STATE_PEND_SUSPENDED:
         case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
-#if (OS_MSG_EN > 0u)
+#if (OS_TCB_MSG_EN > 0u)
              p_tcb->MsgPtr  = p_void;                           /* Deposit message in OS_TCB of task waiting            */
              p_tcb->MsgSize = msg_size;                         /* ... assuming posting a message                       */
 #endif
@@ -1532,9 +2396,10 @@ void  OS_Post (OS_PEND_OBJ  *p_obj,
              p_tcb->TS      = ts;
 #endif
              if (p_obj != (OS_PEND_OBJ *)0) {
+                 OS_OBJ_STAT_INC(&p_obj->PendList, PendCtr);    /* The pend of the task succeeded                       */
                  OS_PendListRemove(p_tcb);                      /* Remove from pend list                                */
              }
-#if (OS_CFG_DBG_EN > 0u)
+#if (OS_DBG_PEND_NAME_EN > 0u)
              OS_PendDbgNameRemove(p_obj,
                                   p_tcb);
 #endif
@@ -1555,6 +2420,67 @@ void  OS_Post (OS_PEND_OBJ  *p_obj,
 }
 
 
+/*
+************************************************************************************************************************
+*                                         POST TO ALL THE TASKS WAITING ON AN OBJECT
+*
+* Description: This function readies every task waiting on a semaphore or a message queue for OS_OPT_POST_ALL.  Each
+*              task is readied in its own critical section so that interrupts are only disabled for the time it takes
+*              to post to a single task, whatever the number of waiters.
+*
+* Arguments  : p_obj          Is a pointer to the object being posted to
+*              -----
+*
+*              p_void         If we are posting a message, this is the message that the tasks will receive
+*
+*              msg_size       If we are posting a message, this is the size of the message
+*
+*              ts             The timestamp as to when the post occurred
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) The caller must have locked the scheduler (unless called from an ISR) in the same critical section
+*                 in which it found waiters on 'p_obj', and must have left that critical section.  This function
+*                 unlocks the scheduler but does not call it.
+*
+*              3) With the scheduler locked no task can start pending on 'p_obj' while interrupts are enabled, so the
+*                 tasks readied are the ones that were waiting when the post was issued.  A waiter may still time out
+*                 or be readied by an ISR in between, in which case it is simply no longer in the pend list.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_POST_ALL_INT_EN > 0u)
+void  OS_PostAll (OS_PEND_OBJ  *p_obj,
+                  void         *p_void,
+                  OS_MSG_SIZE   msg_size,
+                  CPU_TS        ts)
+{
+    OS_TCB  *p_tcb;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    p_tcb = OS_PEND_LIST_HEAD(&p_obj->PendList);
+    while (p_tcb != (OS_TCB *)0) {
+        OS_Post(p_obj,                                          /* Ready the highest priority task still waiting        */
+                p_tcb,
+                p_void,
+                msg_size,
+                ts);
+        CPU_CRITICAL_EXIT();                                    /* Let interrupts in between two waiters                */
+        CPU_CRITICAL_ENTER();
+        p_tcb = OS_PEND_LIST_HEAD(&p_obj->PendList);
+    }
+    if (OSIntNestingCtr == 0u) {                                /* See Note #2                                          */
+        OSSchedLockNestingCtr--;
+    }
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                    INITIALIZATION
@@ -1604,7 +2530,7 @@ void  OS_RdyListInit (void)
 
 
 
-    for (i = 0u; i < OS_CFG_PRIO_MAX; i++) {                    /* Initialize the array of OS_RDY_LIST at each priority */
+    for (i = 0u; i < OS_PRIO_RDY_NBR; i++) {                    /* Initialize the array of OS_RDY_LIST at each priority */
         p_rdy_list = &OSRdyList[i];
 #if (OS_CFG_DBG_EN > 0u)
         p_rdy_list->NbrEntries =           0u;
@@ -1642,6 +2568,10 @@ void  OS_RdyListInsert (OS_TCB  *p_tcb)
         OS_RdyListInsertHead(p_tcb);                            /* No,  insert readied task at the beginning of the list*/
     }
 
+#if (OS_CFG_TASK_HIST_EN > 0u)
+    OS_TaskHistRdy(p_tcb);
+#endif
+
     OS_TRACE_TASK_READY(p_tcb);
 }
 
@@ -1699,6 +2629,11 @@ void  OS_RdyListInsert (OS_TCB  *p_tcb)
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The list of the EDF priority level is kept sorted by deadline, see OS_RdyListInsertEDF().
+*
+*              3) The list of the fair-share priority level is kept sorted by virtual runtime, see
+*                 OS_RdyListInsertFair().
 ************************************************************************************************************************
 */
 
@@ -1709,7 +2644,20 @@ void  OS_RdyListInsertHead (OS_TCB  *p_tcb)
 
 
 
-    p_rdy_list = &OSRdyList[p_tcb->Prio];
+#if (OS_CFG_TASK_EDF_EN > 0u)
+    if (p_tcb->Prio == OS_CFG_TASK_EDF_PRIO) {                  /* See Note #2                                          */
+        OS_RdyListInsertEDF(p_tcb);
+        return;
+    }
+#endif
+#if (OS_CFG_TASK_FAIR_EN > 0u)
+    if (p_tcb->Prio == OS_CFG_TASK_FAIR_PRIO) {                 /* See Note #3                                          */
+        OS_RdyListInsertFair(p_tcb);
+        return;
+    }
+#endif
+
+    p_rdy_list = &OSRdyList[OS_PRIO_IX(p_tcb->Prio)];
     if (p_rdy_list->HeadPtr == (OS_TCB *)0) {                   /* CASE 0: Insert when there are no entries             */
 #if (OS_CFG_DBG_EN > 0u)
         p_rdy_list->NbrEntries =           1u;                  /* This is the first entry                              */
@@ -1784,6 +2732,11 @@ void  OS_RdyListInsertHead (OS_TCB  *p_tcb)
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The list of the EDF priority level is kept sorted by deadline, see OS_RdyListInsertEDF().
+*
+*              3) The list of the fair-share priority level is kept sorted by virtual runtime, see
+*                 OS_RdyListInsertFair().
 ************************************************************************************************************************
 */
 
@@ -1794,7 +2747,20 @@ void  OS_RdyListInsertTail (OS_TCB  *p_tcb)
 
 
 
-    p_rdy_list = &OSRdyList[p_tcb->Prio];
+#if (OS_CFG_TASK_EDF_EN > 0u)
+    if (p_tcb->Prio == OS_CFG_TASK_EDF_PRIO) {                  /* See Note #2                                          */
+        OS_RdyListInsertEDF(p_tcb);
+        return;
+    }
+#endif
+#if (OS_CFG_TASK_FAIR_EN > 0u)
+    if (p_tcb->Prio == OS_CFG_TASK_FAIR_PRIO) {                 /* See Note #3                                          */
+        OS_RdyListInsertFair(p_tcb);
+        return;
+    }
+#endif
+
+    p_rdy_list = &OSRdyList[OS_PRIO_IX(p_tcb->Prio)];
     if (p_rdy_list->HeadPtr == (OS_TCB *)0) {                   /* CASE 0: Insert when there are no entries             */
 #if (OS_CFG_DBG_EN > 0u)
         p_rdy_list->NbrEntries  =           1u;                 /* This is the first entry                              */
@@ -1816,6 +2782,187 @@ void  OS_RdyListInsertTail (OS_TCB  *p_tcb)
 }
 
 
+/*
+************************************************************************************************************************
+*                                       INSERT TCB IN THE EDF LIST BY DEADLINE
+*
+* Description: This function is called to insert an OS_TCB in the ready list of the EDF priority level
+*              (OS_CFG_TASK_EDF_PRIO).  The list is kept sorted by absolute deadline, earliest first, so that the
+*              scheduler runs the task with the earliest deadline.  Tasks with the same deadline run in FIFO order.
+*
+* Arguments  : p_tcb     is the OS_TCB to insert in the list
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) A task without a period (e.g. a task whose priority was raised to the EDF level by a mutex) is given
+*                 the current tick as its deadline, which places it ahead of every task whose deadline is still to come.
+*
+*              3) Deadlines are compared relative to each other so that the comparison survives the wrap of OSTickCtr,
+*                 as long as all the deadlines are within half the range of OS_TICK.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_EDF_EN > 0u)
+void  OS_RdyListInsertEDF (OS_TCB  *p_tcb)
+{
+    OS_RDY_LIST  *p_rdy_list;
+    OS_TCB       *p_tcb2;
+    OS_TICK       diff;
+
+
+
+    if (p_tcb->Period == 0u) {                                  /* See Note #2                                          */
+        p_tcb->EDFDeadline = OSTickCtr;
+    }
+
+    p_rdy_list = &OSRdyList[OS_PRIO_IX(OS_CFG_TASK_EDF_PRIO)];
+    p_tcb2     =  p_rdy_list->HeadPtr;
+    while (p_tcb2 != (OS_TCB *)0) {                             /* Find the first task due after this one (Note #3)     */
+        diff = p_tcb->EDFDeadline - p_tcb2->EDFDeadline;
+        if (diff > ((OS_TICK)~(OS_TICK)0u >> 1u)) {
+            break;
+        }
+        p_tcb2 = p_tcb2->NextPtr;
+    }
+
+#if (OS_CFG_DBG_EN > 0u)
+    p_rdy_list->NbrEntries++;                                   /* One more OS_TCB in the list                          */
+#endif
+    p_tcb->NextPtr = p_tcb2;
+    if (p_tcb2 == (OS_TCB *)0) {                                /* Insert at the tail                                   */
+        p_tcb->PrevPtr = p_rdy_list->TailPtr;
+        if (p_rdy_list->TailPtr == (OS_TCB *)0) {
+            p_rdy_list->HeadPtr = p_tcb;
+        } else {
+            p_rdy_list->TailPtr->NextPtr = p_tcb;
+        }
+        p_rdy_list->TailPtr = p_tcb;
+    } else {                                                    /* Insert before 'p_tcb2'                               */
+        p_tcb->PrevPtr = p_tcb2->PrevPtr;
+        if (p_tcb2->PrevPtr == (OS_TCB *)0) {
+            p_rdy_list->HeadPtr = p_tcb;
+        } else {
+            p_tcb2->PrevPtr->NextPtr = p_tcb;
+        }
+        p_tcb2->PrevPtr = p_tcb;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                   INSERT TCB IN THE FAIR-SHARE LIST BY VIRTUAL RUNTIME
+*
+* Description: OS_RdyListInsertFair() is called to insert an OS_TCB in the ready list of the fair-share priority level
+*              (OS_CFG_TASK_FAIR_PRIO).  The list is kept sorted by virtual runtime, smallest first, so that the
+*              scheduler runs the task that received the least CPU time for its weight.  Tasks with the same virtual
+*              runtime run in FIFO order.
+*
+*              OS_RdyListMoveFair() is called when the virtual runtime of a task of the list increased, to move it
+*              after the tasks that now have a smaller virtual runtime.
+*
+* Arguments  : p_tcb     is the OS_TCB to insert or move
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application MUST NOT call them.
+*
+*              2) A task that joins the list (it was made ready, created or moved to the level) gets at least the virtual
+*                 runtime of the level, OSTaskFairVRuntimeMin.  A task that was waiting for a long time thus doesn't
+*                 take the CPU away from the other tasks of the level until it catches up.
+*
+*              3) Virtual runtimes are compared relative to each other so that the comparison survives their wrap, as
+*                 long as all the tasks of the level are within half the range of CPU_TS.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_FAIR_EN > 0u)
+void  OS_RdyListInsertFair (OS_TCB  *p_tcb)
+{
+    OS_RDY_LIST  *p_rdy_list;
+    OS_TCB       *p_tcb2;
+
+
+
+    if (OS_TASK_FAIR_BEFORE(p_tcb->FairVRuntime, OSTaskFairVRuntimeMin) == OS_TRUE) {
+        p_tcb->FairVRuntime = OSTaskFairVRuntimeMin;            /* See Note #2                                          */
+    }
+
+    p_rdy_list = &OSRdyList[OS_PRIO_IX(OS_CFG_TASK_FAIR_PRIO)];
+    p_tcb2     =  p_rdy_list->HeadPtr;
+    while (p_tcb2 != (OS_TCB *)0) {                             /* Find the first task ahead of this one (Note #3)      */
+        if (OS_TASK_FAIR_BEFORE(p_tcb->FairVRuntime, p_tcb2->FairVRuntime) == OS_TRUE) {
+            break;
+        }
+        p_tcb2 = p_tcb2->NextPtr;
+    }
+
+#if (OS_CFG_DBG_EN > 0u)
+    p_rdy_list->NbrEntries++;                                   /* One more OS_TCB in the list                          */
+#endif
+    p_tcb->NextPtr = p_tcb2;
+    if (p_tcb2 == (OS_TCB *)0) {                                /* Insert at the tail                                   */
+        p_tcb->PrevPtr = p_rdy_list->TailPtr;
+        if (p_rdy_list->TailPtr == (OS_TCB *)0) {
+            p_rdy_list->HeadPtr = p_tcb;
+        } else {
+            p_rdy_list->TailPtr->NextPtr = p_tcb;
+        }
+        p_rdy_list->TailPtr = p_tcb;
+    } else {                                                    /* Insert before 'p_tcb2'                               */
+        p_tcb->PrevPtr = p_tcb2->PrevPtr;
+        if (p_tcb2->PrevPtr == (OS_TCB *)0) {
+            p_rdy_list->HeadPtr = p_tcb;
+        } else {
+            p_tcb2->PrevPtr->NextPtr = p_tcb;
+        }
+        p_tcb2->PrevPtr = p_tcb;
+    }
+}
+
+
+void  OS_RdyListMoveFair (OS_TCB  *p_tcb)
+{
+    OS_RDY_LIST  *p_rdy_list;
+    OS_TCB       *p_tcb2;
+
+
+
+    p_tcb2 = p_tcb->NextPtr;                                    /* Only the tasks after it can be ahead of it now       */
+    if ((p_tcb2 == (OS_TCB *)0) ||
+        (OS_TASK_FAIR_BEFORE(p_tcb->FairVRuntime, p_tcb2->FairVRuntime) == OS_TRUE)) {
+        return;                                                 /* Already at its place                                 */
+    }
+    while ((p_tcb2->NextPtr != (OS_TCB *)0) &&
+           (OS_TASK_FAIR_BEFORE(p_tcb->FairVRuntime, p_tcb2->NextPtr->FairVRuntime) == OS_FALSE)) {
+        p_tcb2 = p_tcb2->NextPtr;
+    }
+
+    p_rdy_list = &OSRdyList[OS_PRIO_IX(OS_CFG_TASK_FAIR_PRIO)];
+    if (p_tcb->PrevPtr == (OS_TCB *)0) {                        /* Unlink the task, it has a successor                  */
+        p_rdy_list->HeadPtr = p_tcb->NextPtr;
+    } else {
+        p_tcb->PrevPtr->NextPtr = p_tcb->NextPtr;
+    }
+    p_tcb->NextPtr->PrevPtr = p_tcb->PrevPtr;
+
+    p_tcb->PrevPtr = p_tcb2;                                    /* Link it after 'p_tcb2'                               */
+    p_tcb->NextPtr = p_tcb2->NextPtr;
+    if (p_tcb2->NextPtr == (OS_TCB *)0) {
+        p_rdy_list->TailPtr = p_tcb;
+    } else {
+        p_tcb2->NextPtr->PrevPtr = p_tcb;
+    }
+    p_tcb2->NextPtr = p_tcb;
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                MOVE TCB AT HEAD TO TAIL
@@ -1865,6 +3012,9 @@ void  OS_RdyListInsertTail (OS_TCB  *p_tcb)
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The order of the EDF priority level is set by the deadlines, so round-robin doesn't rotate it.  The
+*                 same goes for the fair-share priority level and the virtual runtimes.
 ************************************************************************************************************************
 */
 
@@ -1875,6 +3025,17 @@ void  OS_RdyListMoveHeadToTail (OS_RDY_LIST  *p_rdy_list)
     OS_TCB  *p_tcb3;
 
 
+#if (OS_CFG_TASK_EDF_EN > 0u)
+                                                                /* See Note #2                                          */
+     if (p_rdy_list == &OSRdyList[OS_PRIO_IX(OS_CFG_TASK_EDF_PRIO)]) {
+         return;
+     }
+#endif
+#if (OS_CFG_TASK_FAIR_EN > 0u)
+     if (p_rdy_list == &OSRdyList[OS_PRIO_IX(OS_CFG_TASK_FAIR_PRIO)]) {
+         return;
+     }
+#endif
      if (p_rdy_list->HeadPtr != p_rdy_list->TailPtr) {
          if (p_rdy_list->HeadPtr->NextPtr == p_rdy_list->TailPtr) { /* SWAP the TCBs                                    */
              p_tcb1              =  p_rdy_list->HeadPtr;        /* Point to current head                                */
@@ -1956,39 +3117,147 @@ void  OS_RdyListRemove (OS_TCB  *p_tcb)
 
 
 
-    p_rdy_list = &OSRdyList[p_tcb->Prio];
-    p_tcb1     = p_tcb->PrevPtr;                                /* Point to next and previous OS_TCB in the list        */
-    p_tcb2     = p_tcb->NextPtr;
-    if (p_tcb1 == (OS_TCB *)0) {                                /* Was the OS_TCB to remove at the head?                */
-        if (p_tcb2 == (OS_TCB *)0) {                            /* Yes, was it the only OS_TCB?                         */
-#if (OS_CFG_DBG_EN > 0u)
-            p_rdy_list->NbrEntries =           0u;              /* Yes, no more entries                                 */
+    p_rdy_list = &OSRdyList[OS_PRIO_IX(p_tcb->Prio)];
+    p_tcb1     = p_tcb->PrevPtr;                                /* Point to next and previous OS_TCB in the list        */
+    p_tcb2     = p_tcb->NextPtr;
+    if (p_tcb1 == (OS_TCB *)0) {                                /* Was the OS_TCB to remove at the head?                */
+        if (p_tcb2 == (OS_TCB *)0) {                            /* Yes, was it the only OS_TCB?                         */
+#if (OS_CFG_DBG_EN > 0u)
+            p_rdy_list->NbrEntries =           0u;              /* Yes, no more entries                                 */
+#endif
+            p_rdy_list->HeadPtr    = (OS_TCB *)0;
+            p_rdy_list->TailPtr    = (OS_TCB *)0;
+            OS_PrioRemove(p_tcb->Prio);
+        } else {
+#if (OS_CFG_DBG_EN > 0u)
+            p_rdy_list->NbrEntries--;                           /* No,  one less entry                                  */
+#endif
+            p_tcb2->PrevPtr     = (OS_TCB *)0;                  /* adjust back link of new list head                    */
+            p_rdy_list->HeadPtr =  p_tcb2;                      /* adjust OS_RDY_LIST's new head                        */
+        }
+    } else {
+#if (OS_CFG_DBG_EN > 0u)
+        p_rdy_list->NbrEntries--;                               /* No,  one less entry                                  */
+#endif
+        p_tcb1->NextPtr = p_tcb2;
+        if (p_tcb2 == (OS_TCB *)0) {
+            p_rdy_list->TailPtr = p_tcb1;                       /* Removing the TCB at the tail, adj the tail ptr       */
+        } else {
+            p_tcb2->PrevPtr     = p_tcb1;
+        }
+    }
+    p_tcb->PrevPtr = (OS_TCB *)0;
+    p_tcb->NextPtr = (OS_TCB *)0;
+
+    OS_TRACE_TASK_SUSPENDED(p_tcb);
+}
+
+
+/*
+************************************************************************************************************************
+*                                               HAND THE CPU OVER TO A TASK
+*
+* Description: This function is called by a service that just made a task ready for the current task to wait on it,
+*              such as OSCall() and OSReply().  It switches to that task without looking for the highest priority
+*              ready task when it can, or calls OSSched() otherwise.
+*
+* Arguments  : p_tcb    is a pointer to the OS_TCB of the task to switch to
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The task is switched to directly when it is the first ready task of its priority, and either has a
+*                 higher priority than the current task or has the same priority and the current task is no longer
+*                 ready.  The current task was the highest priority task ready to run so, except for tasks it readied
+*                 itself with OS_OPT_POST_NO_SCHED, which then run at the next scheduling point, that is the task
+*                 OSSched() would select.
+*
+*              3) With OS_CFG_SCHED_WINDOW_EN, the task may be outside the active scheduling window and OSSched() is
+*                 always called.
+************************************************************************************************************************
+*/
+
+void  OS_SchedHandoff (OS_TCB  *p_tcb)
+{
+#if (OS_CFG_SCHED_WINDOW_EN > 0u)
+    (void)p_tcb;
+
+    OSSched();                                                  /* See Note #3                                          */
+#else
+    CPU_SR_ALLOC();
+
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)                       /* Can't schedule when the kernel is stopped.           */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+        return;
+    }
+#endif
+
+    if (OSIntNestingCtr > 0u) {                                 /* ISRs still nested?                                   */
+        return;                                                 /* Yes ... only schedule when no nested ISRs            */
+    }
+
+    if (OSSchedLockNestingCtr > 0u) {                           /* Scheduler locked?                                    */
+        return;                                                 /* Yes                                                  */
+    }
+
+    CPU_INT_DIS();
+                                                                /* Can we switch to the task directly (see Note #2)?    */
+    if ((OSRdyList[OS_PRIO_IX(p_tcb->Prio)].HeadPtr != p_tcb) ||
+        (p_tcb->Prio > OSTCBCurPtr->Prio) ||
+        ((p_tcb->Prio == OSTCBCurPtr->Prio) && (OSTCBCurPtr->TaskState == OS_TASK_STATE_RDY))) {
+        CPU_INT_EN();                                           /* No, let the scheduler decide                         */
+        OSSched();
+        return;
+    }
+    OSPrioHighRdy   = p_tcb->Prio;                              /* Yes, no need to find the highest priority ready      */
+    OSTCBHighRdyPtr = p_tcb;
+
+    OS_TRACE_TASK_PREEMPT(OSTCBCurPtr);
+
+#if (OS_CFG_TASK_HIST_EN > 0u)
+    OS_TaskHistSwIn(OSTCBHighRdyPtr);
 #endif
-            p_rdy_list->HeadPtr    = (OS_TCB *)0;
-            p_rdy_list->TailPtr    = (OS_TCB *)0;
-            OS_PrioRemove(p_tcb->Prio);
-        } else {
-#if (OS_CFG_DBG_EN > 0u)
-            p_rdy_list->NbrEntries--;                           /* No,  one less entry                                  */
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+    OS_TaskBudgetSw(OSTCBHighRdyPtr);                           /* Charge the CPU time of the task being switched out   */
 #endif
-            p_tcb2->PrevPtr     = (OS_TCB *)0;                  /* adjust back link of new list head                    */
-            p_rdy_list->HeadPtr =  p_tcb2;                      /* adjust OS_RDY_LIST's new head                        */
-        }
-    } else {
-#if (OS_CFG_DBG_EN > 0u)
-        p_rdy_list->NbrEntries--;                               /* No,  one less entry                                  */
+#if (OS_CFG_TASK_FAIR_EN > 0u)
+    OS_TaskFairSw(OSTCBHighRdyPtr);                             /* Advance the virtual runtime of the task switched out */
 #endif
-        p_tcb1->NextPtr = p_tcb2;
-        if (p_tcb2 == (OS_TCB *)0) {
-            p_rdy_list->TailPtr = p_tcb1;                       /* Removing the TCB at the tail, adj the tail ptr       */
-        } else {
-            p_tcb2->PrevPtr     = p_tcb1;
-        }
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u) && (OS_CFG_SCHED_ROUND_ROBIN_TS_EN > 0u)
+    OS_SchedRoundRobinSw(OSTCBHighRdyPtr);                      /* Save the slice left, start the slice of the new task */
+#endif
+#if (OS_CFG_STAT_GOV_EN > 0u)
+    OS_StatGovSw(OSTCBHighRdyPtr);                              /* Run at the performance level the new task needs      */
+#endif
+
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+    OSTCBHighRdyPtr->CtxSwCtr++;                                /* Inc. # of context switches to this task              */
+#endif
+
+#if ((OS_CFG_TASK_PROFILE_EN > 0u) || (OS_CFG_DBG_EN > 0u))
+    OSTaskCtxSwCtr++;                                           /* Increment context switch counter                     */
+#endif
+
+#if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
+#if (OS_CFG_TLS_LAZY_SW_EN > 0u)
+    if ((OSTCBHighRdyPtr->Opt & OS_OPT_TASK_NO_TLS) == OS_OPT_NONE) {
+        OS_TLS_TaskSw();                                        /* Only switch the TLS of tasks that use it             */
     }
-    p_tcb->PrevPtr = (OS_TCB *)0;
-    p_tcb->NextPtr = (OS_TCB *)0;
+#else
+    OS_TLS_TaskSw();
+#endif
+#endif
 
-    OS_TRACE_TASK_SUSPENDED(p_tcb);
+    OS_TASK_SW();                                               /* Perform a task level context switch                  */
+    CPU_INT_EN();
+
+#ifdef OS_TASK_SW_SYNC
+    OS_TASK_SW_SYNC();
+#endif
+#endif
 }
 
 
@@ -2038,9 +3307,190 @@ void  OS_SchedLockTimeMeasStop (void)
         if (OSSchedLockTimeMaxCur < delta) {                    /* Detect peak value (for resettable value)             */
             OSSchedLockTimeMaxCur = delta;
         }
+#if (OS_CFG_LOCK_SITE_EN > 0u)
+        OS_LockSiteAdd(&OSSchedLockSiteTbl[0],                  /* Charge the time to the caller of OSSchedLock()       */
+                       OS_CFG_LOCK_SITE_TBL_SIZE,
+                       OSSchedLockSiteCur,
+                       delta);
+        OSSchedLockSiteCur = (CPU_ADDR)0;
+#endif
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                            LOCK TIME PER CALL SITE
+*
+* Description: OS_LockSiteClr() clears OSLockSiteTbl[] and OSSchedLockSiteTbl[].
+*
+*              OS_LockSiteEnd() records the time spent in a kernel critical section.
+*
+* Arguments  : site          is the OS_LOCK_SITE_xxx index of the critical section in OSLockSiteTbl[].
+*
+*              ts_begin      is the value of OS_TS_GET() when the critical section was entered.
+*
+* Returns    : none
+*
+* Note(s)    : 1) These are internal functions to uC/OS-III and MUST not be called by your application code.
+*
+*              2) OS_LockSiteEnd() is called through OS_LOCK_SITE_END() with interrupts disabled.  As with the
+*                 scheduler lock time, the delta is computed in CPU_TS_TMR units.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_LOCK_SITE_EN > 0u)
+void  OS_LockSiteClr (void)
+{
+    CPU_INT16U  ix;
+
+
+    for (ix = 0u; ix < OS_LOCK_SITE_NBR; ix++) {
+        OSLockSiteTbl[ix].Site    = (CPU_ADDR)ix;
+        OSLockSiteTbl[ix].Ctr     = 0u;
+        OSLockSiteTbl[ix].TimeMax = 0u;
+    }
+#if (OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u)
+    for (ix = 0u; ix < OS_CFG_LOCK_SITE_TBL_SIZE; ix++) {
+        OSSchedLockSiteTbl[ix].Site    = (CPU_ADDR)0;
+        OSSchedLockSiteTbl[ix].Ctr     = 0u;
+        OSSchedLockSiteTbl[ix].TimeMax = 0u;
+    }
+    OSSchedLockSiteCur = (CPU_ADDR)0;
+#endif
+}
+
+
+
+
+void  OS_LockSiteEnd (CPU_INT08U  site,
+                      CPU_TS_TMR  ts_begin)
+{
+    OS_LOCK_SITE  *p_site;
+    CPU_TS_TMR     delta;
+
+
+    delta  = (CPU_TS_TMR)OS_TS_GET() - ts_begin;
+    p_site = &OSLockSiteTbl[site];
+    if (p_site->Ctr < (CPU_INT32U)~(CPU_INT32U)0) {             /* Saturate instead of wrapping around                  */
+        p_site->Ctr++;
+    }
+    if (p_site->TimeMax < delta) {                              /* Detect peak value                                    */
+        p_site->TimeMax = delta;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                          ADD A MEASUREMENT TO A CALL SITE TABLE
+*
+* Description: This function charges a measurement to the entry of 'site' in a table, allocating a free entry the
+*              first time 'site' is seen.
+*
+* Arguments  : p_tbl         is a pointer to the first entry of the table
+*
+*              size          is the number of entries in the table
+*
+*              site          is the call site
+*
+*              delta         is the measurement
+*
+* Returns    : none
+*
+* Note(s)    : 1) When the table is full, the last entry accumulates the sites that don't have an entry and its '.Site'
+*                 is set to 0.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u)
+static  void  OS_LockSiteAdd (OS_LOCK_SITE  *p_tbl,
+                              CPU_INT16U     size,
+                              CPU_ADDR       site,
+                              CPU_TS_TMR     delta)
+{
+    OS_LOCK_SITE  *p_site;
+    CPU_INT16U     ix;
+
+
+    p_site = &p_tbl[size - 1u];                                 /* Default to the last entry (see Note #1)              */
+    for (ix = 0u; ix < (size - 1u); ix++) {
+        if ((p_tbl[ix].Ctr  == 0u) ||                           /* Free entry or entry of this site?                    */
+            (p_tbl[ix].Site == site)) {
+            p_site = &p_tbl[ix];
+            break;
+        }
+    }
+    if ((p_site->Ctr  != 0u) &&
+        (p_site->Site != site)) {
+        site = (CPU_ADDR)0;                                     /* Entry shared by several sites                        */
+    }
+    p_site->Site = site;
+    if (p_site->Ctr < (CPU_INT32U)~(CPU_INT32U)0) {
+        p_site->Ctr++;
+    }
+    if (p_site->TimeMax < delta) {
+        p_site->TimeMax = delta;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                            CRITICAL SECTION PROFILE
+*
+* Description: OS_CritSiteClr() clears OSCritSiteTbl[].
+*
+*              OS_CritSiteEnd() charges the critical section that is about to end to a kernel module.
+*
+* Arguments  : site          is the OS_CRIT_SITE_xxx index of the module in OSCritSiteTbl[].
+*
+* Returns    : none
+*
+* Note(s)    : 1) These are internal functions to uC/OS-III and MUST not be called by your application code.
+*
+*              2) OS_CritSiteEnd() is called by CPU_CRITICAL_EXIT() in the kernel modules, with interrupts disabled.
+*                 The critical section began when OSCritSiteTsBegin was set by CPU_CRITICAL_ENTER(), interrupts
+*                 being disabled in between.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_CRIT_SECTION_PROFILE_EN > 0u)
+void  OS_CritSiteClr (void)
+{
+    CPU_INT16U  ix;
+
+
+    for (ix = 0u; ix < OS_CRIT_SITE_NBR; ix++) {
+        OSCritSiteTbl[ix].Ctr       = 0u;
+        OSCritSiteTbl[ix].TimeMax   = 0u;
+        OSCritSiteTbl[ix].TimeTotal = 0u;
+    }
+}
+
+
+
+
+void  OS_CritSiteEnd (CPU_INT08U  site)
+{
+    OS_CRIT_SITE  *p_site;
+    CPU_TS_TMR     delta;
+
+
+    delta  = (CPU_TS_TMR)OS_TS_GET() - OSCritSiteTsBegin;       /* See Note #2                                          */
+    p_site = &OSCritSiteTbl[site];
+    if (p_site->Ctr < (CPU_INT32U)~(CPU_INT32U)0) {             /* Stop accumulating instead of wrapping around         */
+        p_site->Ctr++;
+        p_site->TimeTotal += delta;
+    }
+    if (p_site->TimeMax < delta) {                              /* Detect peak value                                    */
+        p_site->TimeMax = delta;
     }
 }
 #endif
+#endif
 
 
 /*
@@ -2056,10 +3506,15 @@ void  OS_SchedLockTimeMeasStop (void)
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) When OS_CFG_SCHED_ROUND_ROBIN_TS_EN is enabled, the time slices are measured with OS_TS_GET() and
+*                 their end is programmed through OS_TickHrSet().  This function is then also called by OSTimeTickHr()
+*                 and it rotates the ready list once the slice of the current task is over.  The call from the tick
+*                 only catches up with a slice that ended while the scheduler was locked.
 ************************************************************************************************************************
 */
 
-#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u) && (OS_CFG_SCHED_ROUND_ROBIN_TS_EN == 0u)
 void  OS_SchedRoundRobin (OS_RDY_LIST  *p_rdy_list)
 {
     OS_TCB  *p_tcb;
@@ -2116,6 +3571,147 @@ void  OS_SchedRoundRobin (OS_RDY_LIST  *p_rdy_list)
 #endif
 
 
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u) && (OS_CFG_SCHED_ROUND_ROBIN_TS_EN > 0u)
+void  OS_SchedRoundRobin (OS_RDY_LIST  *p_rdy_list)
+{
+    OS_TCB  *p_tcb;
+    CPU_TS   ts;
+    CPU_SR_ALLOC();
+
+
+    if (OSSchedRoundRobinEn != OS_TRUE) {                       /* Make sure round-robin has been enabled               */
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_tcb = p_rdy_list->HeadPtr;
+
+    if (p_tcb == (OS_TCB *)0) {
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+
+#if (OS_CFG_TASK_IDLE_EN > 0u)
+    if (p_tcb == &OSIdleTaskTCB) {
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+#endif
+
+    ts = OS_TS_GET();
+    if (OSSchedRoundRobinSliceArmed == OS_FALSE) {              /* No slice yet (e.g. round-robin was just enabled)     */
+        OS_SchedRoundRobinSliceStart(p_tcb, ts);
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+
+    if ((CPU_TS)(ts - OSSchedRoundRobinSliceEnd) > OS_TICK_HR_DLY_MAX) {
+        CPU_CRITICAL_EXIT();                                    /* Task not done with its time slice                    */
+        return;
+    }
+
+    if (p_rdy_list->HeadPtr == p_rdy_list->TailPtr) {           /* Only task at this priority, give it a new slice      */
+        p_tcb->TimeQuantaTS = 0u;
+        OS_SchedRoundRobinSliceStart(p_tcb, ts);
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+
+    if (OSSchedLockNestingCtr > 0u) {                           /* Can't round-robin if the scheduler is locked         */
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+
+    OS_RdyListMoveHeadToTail(p_rdy_list);                       /* Move current OS_TCB to the end of the list           */
+    p_rdy_list->HeadPtr->TimeQuantaTS = 0u;                     /* Full slice, loaded when it is switched in            */
+    OSSchedRoundRobinSliceArmed       = OS_FALSE;
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                         MEASURE THE TIME SLICES IN CYCLES
+*
+* Description: OS_SchedRoundRobinSw() is called by the scheduler when it switches to 'p_tcb'.  It saves what is left of
+*              the time slice of the current task and starts the time slice of 'p_tcb'.
+*
+*              OS_SchedRoundRobinSliceStart() starts the time slice of 'p_tcb' at 'ts'.  A task that was preempted
+*              resumes the slice it had left, else a full time quanta is loaded.  The end of the slice is programmed
+*              through OS_TickHrSet().
+*
+* Arguments  : p_tcb    is a pointer to the OS_TCB of the task switched in
+*              -----
+*
+*              ts       is the current timestamp
+*
+* Returns    : none
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application MUST NOT call them.
+*
+*              2) These functions are called with interrupts disabled.
+*
+*              3) No slice is started if the timestamp frequency is not known yet (CPU_TS_TmrFreqGet() fails).
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u) && (OS_CFG_SCHED_ROUND_ROBIN_TS_EN > 0u)
+void  OS_SchedRoundRobinSw (OS_TCB  *p_tcb)
+{
+    CPU_TS  ts;
+    CPU_TS  remain;
+
+
+    ts = OS_TS_GET();
+    if (OSSchedRoundRobinSliceArmed == OS_TRUE) {               /* Save what is left of the current slice               */
+        remain = OSSchedRoundRobinSliceEnd - ts;
+        if (remain > OS_TICK_HR_DLY_MAX) {                      /* Slice already over                                   */
+            remain = 0u;
+        }
+        OSTCBCurPtr->TimeQuantaTS   = remain;
+        OSSchedRoundRobinSliceArmed = OS_FALSE;
+    }
+
+    if (OSSchedRoundRobinEn != OS_TRUE) {
+        return;
+    }
+#if (OS_CFG_TASK_IDLE_EN > 0u)
+    if (p_tcb == &OSIdleTaskTCB) {                              /* The idle task is not time sliced                     */
+        return;
+    }
+#endif
+    OS_SchedRoundRobinSliceStart(p_tcb, ts);
+}
+
+
+void  OS_SchedRoundRobinSliceStart (OS_TCB  *p_tcb,
+                                    CPU_TS   ts)
+{
+    OS_TICK  quanta;
+
+
+    if (p_tcb->TimeQuantaTS == 0u) {                            /* Load a full time slice                               */
+        quanta = p_tcb->TimeQuanta;
+        if (quanta == 0u) {
+            quanta = OSSchedRoundRobinDfltTimeQuanta;
+        }
+        p_tcb->TimeQuantaTS = OS_TickHrUsToTS((CPU_INT32U)quanta);
+        if (p_tcb->TimeQuantaTS > OS_TICK_HR_DLY_MAX) {
+            p_tcb->TimeQuantaTS = OS_TICK_HR_DLY_MAX;
+        }
+        if (p_tcb->TimeQuantaTS == 0u) {                        /* See Note #3                                          */
+            return;
+        }
+    }
+
+    OSSchedRoundRobinSliceEnd   = ts + p_tcb->TimeQuantaTS;
+    OSSchedRoundRobinSliceArmed = OS_TRUE;
+    OS_TickHrSetNext();                                         /* Interrupt at the end of the slice                    */
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                     BLOCK A TASK
@@ -2131,6 +3727,14 @@ void  OS_SchedRoundRobin (OS_RDY_LIST  *p_rdy_list)
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) When 'p_tcb->TickHrDly' is non-zero, the task is placed in the high-resolution timeout list instead
+*                 and 'timeout' only indicates that the pend is timed.
+*
+*              3) When 'p_tcb->TickAbs' is set (the pend was called with OS_OPT_PEND_ABS), 'timeout' is the value of
+*                 OSTickCtr at which the pend times out and is passed to OS_TickListInsert() with a 'tick_base' of 0.
+*                 A deadline that is reached or already passed times out at the next tick.  A deadline of 0 still
+*                 means waiting forever.
 ************************************************************************************************************************
 */
 
@@ -2139,22 +3743,55 @@ void  OS_TaskBlock (OS_TCB   *p_tcb,
 {
 #if (OS_CFG_DYN_TICK_EN > 0u)
     OS_TICK  elapsed;
+#endif
+#if (OS_CFG_TICK_EN > 0u)
+    OS_TICK  tick_base;
+    OS_LOCK_SITE_ALLOC();
+#endif
 
 
+#if (OS_CFG_DYN_TICK_EN > 0u)
     elapsed = OS_DynTickGet();
 #endif
 
 #if (OS_CFG_TICK_EN > 0u)
     if (timeout > 0u) {                                         /* Add task to tick list if timeout non zero            */
+        OS_LOCK_SITE_BEGIN();
+#if (OS_CFG_TIME_HR_EN > 0u)
+        if (p_tcb->TickHrDly != 0u) {                           /* A ...PendUs() call asked for a timeout in TS units   */
+            OS_TickHrListInsert(p_tcb);
+        } else {
+#endif
+#if (OS_CFG_DYN_TICK_EN > 0u)
+        tick_base = OSTickCtr + elapsed;
+#else
+        tick_base = OSTickCtr;
+#endif
+#if (OS_CFG_TIME_ABS_EN > 0u)
+        if (p_tcb->TickAbs == OS_TRUE) {                        /* Is 'timeout' a deadline (see Note #3)?               */
+            if ((OS_TICK)(timeout - tick_base - 1u) < ((OS_TICK)~(OS_TICK)0u >> 1u)) {
+                tick_base = 0u;                                 /* Still ahead, tick_base + timeout == deadline         */
+            } else {
+                timeout   = 1u;                                 /* Reached or passed, time out at the next tick         */
+            }
+        }
+#endif
 #if (OS_CFG_DYN_TICK_EN > 0u)
-        (void)OS_TickListInsert(p_tcb, elapsed, (OSTickCtr + elapsed), timeout);
+        (void)OS_TickListInsert(p_tcb, elapsed, tick_base, timeout);
 #else
-        (void)OS_TickListInsert(p_tcb,      0u,             OSTickCtr, timeout);
+        (void)OS_TickListInsert(p_tcb,      0u, tick_base, timeout);
+#endif
+#if (OS_CFG_TIME_HR_EN > 0u)
+        }
 #endif
+        OS_LOCK_SITE_END(OS_LOCK_SITE_TICK_LIST_INSERT);
         p_tcb->TaskState = OS_TASK_STATE_PEND_TIMEOUT;
     } else {
         p_tcb->TaskState = OS_TASK_STATE_PEND;
     }
+#if (OS_CFG_TIME_ABS_EN > 0u)
+    p_tcb->TickAbs = OS_FALSE;                                  /* The next pend is relative unless it says otherwise   */
+#endif
 #else
     (void)timeout;
     p_tcb->TaskState = OS_TASK_STATE_PEND;
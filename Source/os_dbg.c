@@ -55,6 +55,9 @@ CPU_INT32U  const  OSDbg_EndiannessTest        = 0x12345678LU;                 /
 
 CPU_INT08U  const  OSDbg_CalledFromISRChkEn    = OS_CFG_CALLED_FROM_ISR_CHK_EN;
 
+CPU_INT08U  const  OSDbg_CritSectionProfileEn  = OS_CFG_CRIT_SECTION_PROFILE_EN;
+CPU_INT16U  const  OSDbg_CritSiteNbr           = OS_CRIT_SITE_NBR;             /* Number of entries in OSCritSiteTbl[] */
+
 CPU_INT08U  const  OSDbg_FlagEn                = OS_CFG_FLAG_EN;
 OS_FLAG_GRP const  OSDbg_FlagGrp               = { 0u };
 #if (OS_CFG_FLAG_EN > 0u)
@@ -74,22 +77,61 @@ CPU_INT16U  const  OSDbg_FlagWidth             = 0u;
 OS_MEM      const  OSDbg_Mem                   = { 0u };
 CPU_INT08U  const  OSDbg_MemEn                 = OS_CFG_MEM_EN;
 #if OS_CFG_MEM_EN > 0u
+CPU_INT08U  const  OSDbg_MemBufEn              = OS_CFG_MEM_BUF_EN;
+CPU_INT08U  const  OSDbg_MemCacheEn            = OS_CFG_MEM_CACHE_EN;
+CPU_INT08U  const  OSDbg_MemLockFreeEn         = OS_MEM_LOCK_FREE_EN;
+CPU_INT08U  const  OSDbg_MemMagEn              = OS_CFG_MEM_MAG_EN;
+CPU_INT08U  const  OSDbg_MemPendEn             = OS_CFG_MEM_PEND_EN;
+CPU_INT08U  const  OSDbg_MemQuotaEn            = OS_CFG_MEM_QUOTA_EN;
 CPU_INT16U  const  OSDbg_MemSize               = sizeof(OS_MEM);               /* Mem. Partition header size (bytes)  */
 #else
+CPU_INT08U  const  OSDbg_MemBufEn              = 0u;
+CPU_INT08U  const  OSDbg_MemCacheEn            = 0u;
+CPU_INT08U  const  OSDbg_MemLockFreeEn         = 0u;
+CPU_INT08U  const  OSDbg_MemMagEn              = 0u;
+CPU_INT08U  const  OSDbg_MemPendEn             = 0u;
+CPU_INT08U  const  OSDbg_MemQuotaEn            = 0u;
 CPU_INT16U  const  OSDbg_MemSize               = 0u;
 #endif
 
+CPU_INT08U  const  OSDbg_SlabEn                = OS_CFG_SLAB_EN;
+#if (OS_CFG_SLAB_EN > 0u)
+CPU_INT16U  const  OSDbg_SlabSize              = sizeof(OS_SLAB);              /* Size in bytes of OS_SLAB structure  */
+CPU_INT16U  const  OSDbg_SlabClassSize         = sizeof(OS_SLAB_CLASS);        /* Size in bytes of a slab size class  */
+#else
+CPU_INT16U  const  OSDbg_SlabSize              = 0u;
+CPU_INT16U  const  OSDbg_SlabClassSize         = 0u;
+#endif
+
+CPU_INT08U  const  OSDbg_ObjPoolEn             = OS_CFG_OBJ_POOL_EN;
+#if (OS_CFG_OBJ_POOL_EN > 0u)
+CPU_INT16U  const  OSDbg_ObjPoolSize           = sizeof(OS_OBJ_POOL);          /* Size in bytes of an object pool     */
+#else
+CPU_INT16U  const  OSDbg_ObjPoolSize           = 0u;
+#endif
+
+CPU_INT08U  const  OSDbg_HeapEn                = OS_CFG_HEAP_EN;
+#if (OS_CFG_HEAP_EN > 0u)
+CPU_INT16U  const  OSDbg_HeapSize              = sizeof(OS_HEAP);              /* Size in bytes of OS_HEAP structure  */
+CPU_INT16U  const  OSDbg_HeapBlkSize           = sizeof(OS_HEAP_BLK);          /* Size in bytes of a heap blk header  */
+#else
+CPU_INT16U  const  OSDbg_HeapSize              = 0u;
+CPU_INT16U  const  OSDbg_HeapBlkSize           = 0u;
+#endif
+
 
 #if (OS_MSG_EN > 0u)
 CPU_INT08U  const  OSDbg_MsgEn                 = 1u;
 CPU_INT16U  const  OSDbg_MsgSize               = sizeof(OS_MSG);               /* OS_MSG size                         */
 CPU_INT16U  const  OSDbg_MsgPoolSize           = sizeof(OS_MSG_POOL);
 CPU_INT16U  const  OSDbg_MsgQSize              = sizeof(OS_MSG_Q);
+CPU_INT08U  const  OSDbg_MsgQStatEn            = OS_CFG_MSG_Q_STAT_EN;
 #else
 CPU_INT08U  const  OSDbg_MsgEn                 = 0u;
 CPU_INT16U  const  OSDbg_MsgSize               = 0u;
 CPU_INT16U  const  OSDbg_MsgPoolSize           = 0u;
 CPU_INT16U  const  OSDbg_MsgQSize              = 0u;
+CPU_INT08U  const  OSDbg_MsgQStatEn            = 0u;
 #endif
 
 
@@ -98,23 +140,37 @@ CPU_INT08U  const  OSDbg_MutexEn               = OS_CFG_MUTEX_EN;
 #if (OS_CFG_MUTEX_EN > 0u)
 CPU_INT08U  const  OSDbg_MutexDelEn            = OS_CFG_MUTEX_DEL_EN;
 CPU_INT08U  const  OSDbg_MutexPendAbortEn      = OS_CFG_MUTEX_PEND_ABORT_EN;
+CPU_INT08U  const  OSDbg_MutexBlockStatEn      = OS_CFG_MUTEX_BLOCK_STAT_EN;
 CPU_INT16U  const  OSDbg_MutexSize             = sizeof(OS_MUTEX);             /* Size in bytes of OS_MUTEX           */
 #else
 CPU_INT08U  const  OSDbg_MutexDelEn            = 0u;
 CPU_INT08U  const  OSDbg_MutexPendAbortEn      = 0u;
+CPU_INT08U  const  OSDbg_MutexBlockStatEn      = 0u;
 CPU_INT16U  const  OSDbg_MutexSize             = 0u;
 #endif
 
 CPU_INT08U  const  OSDbg_ObjTypeChkEn          = OS_CFG_OBJ_TYPE_CHK_EN;
 CPU_INT08U  const  OSDbg_ObjCreatedChkEn       = OS_CFG_OBJ_CREATED_CHK_EN;
+CPU_INT08U  const  OSDbg_ObjStatEn             = OS_CFG_OBJ_STAT_EN;
+CPU_INT08U  const  OSDbg_ObjRegEn              = OS_CFG_OBJ_REG_EN;
+CPU_INT08U  const  OSDbg_DbgPendNameEn         = OS_CFG_DBG_PEND_NAME_EN;
 
 
 CPU_INT16U  const  OSDbg_PendListSize          = sizeof(OS_PEND_LIST);
 CPU_INT16U  const  OSDbg_PendObjSize           = sizeof(OS_PEND_OBJ);
+CPU_INT08U  const  OSDbg_PendMultiEn           = OS_CFG_PEND_MULTI_EN;
 
 
 CPU_INT16U  const  OSDbg_PrioMax               = OS_CFG_PRIO_MAX;              /* Maximum number of priorities        */
 CPU_INT16U  const  OSDbg_PrioTblSize           = sizeof(OSPrioTbl);
+CPU_INT08U  const  OSDbg_PrioMapEn             = OS_CFG_PRIO_MAP_EN;
+
+CPU_INT08U  const  OSDbg_ProfSampleEn          = OS_CFG_PROF_SAMPLE_EN;
+#if (OS_CFG_PROF_SAMPLE_EN > 0u)
+CPU_INT16U  const  OSDbg_ProfSampleSize        = OS_CFG_PROF_SAMPLE_SIZE;      /* Number of samples in the ring       */
+#else
+CPU_INT16U  const  OSDbg_ProfSampleSize        = 0u;
+#endif
 
 CPU_INT16U  const  OSDbg_PtrSize               = sizeof(void *);               /* Size in Bytes of a pointer          */
 
@@ -125,16 +181,45 @@ CPU_INT08U  const  OSDbg_QEn                   = OS_CFG_Q_EN;
 CPU_INT08U  const  OSDbg_QDelEn                = OS_CFG_Q_DEL_EN;
 CPU_INT08U  const  OSDbg_QFlushEn              = OS_CFG_Q_FLUSH_EN;
 CPU_INT08U  const  OSDbg_QPendAbortEn          = OS_CFG_Q_PEND_ABORT_EN;
+CPU_INT08U  const  OSDbg_QPendNEn              = OS_CFG_Q_PEND_N_EN;
+CPU_INT08U  const  OSDbg_QPostNEn              = OS_CFG_Q_POST_N_EN;
+CPU_INT08U  const  OSDbg_QPrivPoolEn           = OS_CFG_Q_PRIV_POOL_EN;
+CPU_INT08U  const  OSDbg_QPrioEn               = OS_CFG_Q_PRIO_EN;
 CPU_INT16U  const  OSDbg_QSize                 = sizeof(OS_Q);                 /* Size in bytes of OS_Q structure     */
 #else
 CPU_INT08U  const  OSDbg_QDelEn                = 0u;
 CPU_INT08U  const  OSDbg_QFlushEn              = 0u;
 CPU_INT08U  const  OSDbg_QPendAbortEn          = 0u;
+CPU_INT08U  const  OSDbg_QPendNEn              = 0u;
+CPU_INT08U  const  OSDbg_QPostNEn              = 0u;
+CPU_INT08U  const  OSDbg_QPrivPoolEn           = 0u;
+CPU_INT08U  const  OSDbg_QPrioEn               = 0u;
 CPU_INT16U  const  OSDbg_QSize                 = 0u;
 #endif
 
+OS_MBOX     const  OSDbg_Mbox                  = { 0u };
+CPU_INT08U  const  OSDbg_MboxEn                = OS_CFG_MBOX_EN;
+#if (OS_CFG_MBOX_EN > 0u)
+CPU_INT08U  const  OSDbg_MboxDelEn             = OS_CFG_MBOX_DEL_EN;
+CPU_INT08U  const  OSDbg_MboxPendAbortEn       = OS_CFG_MBOX_PEND_ABORT_EN;
+CPU_INT16U  const  OSDbg_MboxSize              = sizeof(OS_MBOX);              /* Size in bytes of OS_MBOX structure  */
+#else
+CPU_INT08U  const  OSDbg_MboxDelEn             = 0u;
+CPU_INT08U  const  OSDbg_MboxPendAbortEn       = 0u;
+CPU_INT16U  const  OSDbg_MboxSize              = 0u;
+#endif
+
 
 CPU_INT08U  const  OSDbg_SchedRoundRobinEn     = OS_CFG_SCHED_ROUND_ROBIN_EN;
+CPU_INT08U  const  OSDbg_SchedRoundRobinTSEn   = OS_CFG_SCHED_ROUND_ROBIN_TS_EN;
+CPU_INT08U  const  OSDbg_SchedWindowEn         = OS_CFG_SCHED_WINDOW_EN;
+#if (OS_CFG_SCHED_WINDOW_EN > 0u)
+CPU_INT16U  const  OSDbg_SchedWindowSize       = sizeof(OS_SCHED_WINDOW);      /* Size in bytes of OS_SCHED_WINDOW    */
+#else
+CPU_INT16U  const  OSDbg_SchedWindowSize       = 0u;
+#endif
+
+CPU_INT08U  const  OSDbg_SlackEn               = OS_CFG_SLACK_EN;
 
 
 OS_SEM      const  OSDbg_Sem                   = { 0u };
@@ -142,40 +227,245 @@ CPU_INT08U  const  OSDbg_SemEn                 = OS_CFG_SEM_EN;
 #if (OS_CFG_SEM_EN > 0u)
 CPU_INT08U  const  OSDbg_SemDelEn              = OS_CFG_SEM_DEL_EN;
 CPU_INT08U  const  OSDbg_SemPendAbortEn        = OS_CFG_SEM_PEND_ABORT_EN;
+CPU_INT08U  const  OSDbg_SemPendNEn            = OS_CFG_SEM_PEND_N_EN;
+CPU_INT08U  const  OSDbg_SemPostNEn            = OS_CFG_SEM_POST_N_EN;
 CPU_INT08U  const  OSDbg_SemSetEn              = OS_CFG_SEM_SET_EN;
 CPU_INT16U  const  OSDbg_SemSize               = sizeof(OS_SEM);               /* Size in bytes of OS_SEM             */
 #else
 CPU_INT08U  const  OSDbg_SemDelEn              = 0u;
 CPU_INT08U  const  OSDbg_SemPendAbortEn        = 0u;
+CPU_INT08U  const  OSDbg_SemPendNEn            = 0u;
+CPU_INT08U  const  OSDbg_SemPostNEn            = 0u;
 CPU_INT08U  const  OSDbg_SemSetEn              = 0u;
 CPU_INT16U  const  OSDbg_SemSize               = 0u;
 #endif
 
+OS_SEQLOCK  const  OSDbg_SeqLock               = { 0u };
+CPU_INT08U  const  OSDbg_SeqLockEn             = OS_CFG_SEQLOCK_EN;
+#if (OS_CFG_SEQLOCK_EN > 0u)
+CPU_INT08U  const  OSDbg_SeqLockDelEn          = OS_CFG_SEQLOCK_DEL_EN;
+CPU_INT16U  const  OSDbg_SeqLockSize           = sizeof(OS_SEQLOCK);           /* Size in bytes of OS_SEQLOCK         */
+#else
+CPU_INT08U  const  OSDbg_SeqLockDelEn          = 0u;
+CPU_INT16U  const  OSDbg_SeqLockSize           = 0u;
+#endif
+
+OS_RCU      const  OSDbg_Rcu                   = { 0u };
+CPU_INT08U  const  OSDbg_RcuEn                 = OS_CFG_RCU_EN;
+#if (OS_CFG_RCU_EN > 0u)
+CPU_INT08U  const  OSDbg_RcuDelEn              = OS_CFG_RCU_DEL_EN;
+CPU_INT16U  const  OSDbg_RcuSize               = sizeof(OS_RCU);               /* Size in bytes of OS_RCU             */
+#else
+CPU_INT08U  const  OSDbg_RcuDelEn              = 0u;
+CPU_INT16U  const  OSDbg_RcuSize               = 0u;
+#endif
+
+OS_TOPIC    const  OSDbg_Topic                 = { 0u };
+CPU_INT08U  const  OSDbg_TopicEn               = OS_CFG_TOPIC_EN;
+#if (OS_CFG_TOPIC_EN > 0u)
+CPU_INT08U  const  OSDbg_TopicDelEn            = OS_CFG_TOPIC_DEL_EN;
+CPU_INT16U  const  OSDbg_TopicSize             = sizeof(OS_TOPIC);             /* Size in bytes of OS_TOPIC           */
+CPU_INT16U  const  OSDbg_TopicSubSize          = sizeof(OS_TOPIC_SUB);         /* Size in bytes of OS_TOPIC_SUB       */
+#else
+CPU_INT08U  const  OSDbg_TopicDelEn            = 0u;
+CPU_INT16U  const  OSDbg_TopicSize             = 0u;
+CPU_INT16U  const  OSDbg_TopicSubSize          = 0u;
+#endif
+
+OS_CALL_EP  const  OSDbg_CallEp                = { 0u };
+CPU_INT08U  const  OSDbg_CallEn                = OS_CFG_CALL_EN;
+#if (OS_CFG_CALL_EN > 0u)
+CPU_INT08U  const  OSDbg_CallDelEn             = OS_CFG_CALL_DEL_EN;
+CPU_INT16U  const  OSDbg_CallEpSize            = sizeof(OS_CALL_EP);           /* Size in bytes of OS_CALL_EP         */
+#else
+CPU_INT08U  const  OSDbg_CallDelEn             = 0u;
+CPU_INT16U  const  OSDbg_CallEpSize            = 0u;
+#endif
+
+OS_SIGNAL   const  OSDbg_Signal                = { 0u };
+CPU_INT08U  const  OSDbg_SignalEn              = OS_CFG_SIGNAL_EN;
+#if (OS_CFG_SIGNAL_EN > 0u)
+CPU_INT08U  const  OSDbg_SignalDelEn           = OS_CFG_SIGNAL_DEL_EN;
+CPU_INT08U  const  OSDbg_SignalPendAbortEn     = OS_CFG_SIGNAL_PEND_ABORT_EN;
+CPU_INT16U  const  OSDbg_SignalSize            = sizeof(OS_SIGNAL);            /* Size in bytes of OS_SIGNAL          */
+#else
+CPU_INT08U  const  OSDbg_SignalDelEn           = 0u;
+CPU_INT08U  const  OSDbg_SignalPendAbortEn     = 0u;
+CPU_INT16U  const  OSDbg_SignalSize            = 0u;
+#endif
+
+OS_COMPLETION const  OSDbg_Completion          = { 0u };
+CPU_INT08U  const  OSDbg_CompletionEn          = OS_CFG_COMPLETION_EN;
+#if (OS_CFG_COMPLETION_EN > 0u)
+CPU_INT08U  const  OSDbg_CompletionDelEn       = OS_CFG_COMPLETION_DEL_EN;
+CPU_INT16U  const  OSDbg_CompletionSize        = sizeof(OS_COMPLETION);        /* Size in bytes of OS_COMPLETION      */
+#else
+CPU_INT08U  const  OSDbg_CompletionDelEn       = 0u;
+CPU_INT16U  const  OSDbg_CompletionSize        = 0u;
+#endif
+
+OS_REACTOR  const  OSDbg_Reactor               = { 0u };
+CPU_INT08U  const  OSDbg_ReactorEn             = OS_CFG_REACTOR_EN;
+#if (OS_CFG_REACTOR_EN > 0u)
+CPU_INT08U  const  OSDbg_ReactorDelEn          = OS_CFG_REACTOR_DEL_EN;
+CPU_INT16U  const  OSDbg_ReactorSize           = sizeof(OS_REACTOR);           /* Size in bytes of OS_REACTOR         */
+CPU_INT16U  const  OSDbg_ReactorSrcSize        = sizeof(OS_REACTOR_SRC);       /* Size in bytes of OS_REACTOR_SRC     */
+#else
+CPU_INT08U  const  OSDbg_ReactorDelEn          = 0u;
+CPU_INT16U  const  OSDbg_ReactorSize           = 0u;
+CPU_INT16U  const  OSDbg_ReactorSrcSize        = 0u;
+#endif
+
 
 CPU_INT16U  const  OSDbg_RdyList               = sizeof(OS_RDY_LIST);
 CPU_INT32U  const  OSDbg_RdyListSize           = sizeof(OSRdyList);            /* Number of bytes in the ready table  */
 
 CPU_INT08U  const  OSDbg_StkWidth              = sizeof(CPU_STK);
 
+CPU_INT08U  const  OSDbg_IccEn                 = OS_CFG_ICC_EN;
+#if (OS_CFG_ICC_EN > 0u)
+CPU_INT16U  const  OSDbg_IccSize               = sizeof(OS_ICC);               /* Size in bytes of OS_ICC structure   */
+#else
+CPU_INT16U  const  OSDbg_IccSize               = 0u;
+#endif
+
+CPU_INT08U  const  OSDbg_IccSyncEn             = OS_CFG_ICC_SYNC_EN;
+#if (OS_CFG_ICC_SYNC_EN > 0u)
+CPU_INT16U  const  OSDbg_IccLockSize           = sizeof(OS_ICC_LOCK);          /* Size in bytes of OS_ICC_LOCK        */
+#else
+CPU_INT16U  const  OSDbg_IccLockSize           = 0u;
+#endif
+
+CPU_INT08U  const  OSDbg_IntQEn                = OS_CFG_ISR_POST_DEFERRED_EN;
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+CPU_INT16U  const  OSDbg_IntQSize              = sizeof(OS_INT_Q);             /* Size in bytes of OS_INT_Q structure */
+#else
+CPU_INT16U  const  OSDbg_IntQSize              = 0u;
+#endif
+
+CPU_INT08U  const  OSDbg_IsrQEn                = OS_CFG_ISR_Q_EN;
+CPU_INT08U  const  OSDbg_ISRStkSPEn            = OS_CFG_ISR_STK_SP_EN;
+#if (OS_CFG_ISR_Q_EN > 0u)
+CPU_INT16U  const  OSDbg_IsrQSize              = sizeof(OS_ISR_Q);             /* Size in bytes of OS_ISR_Q structure */
+#else
+CPU_INT16U  const  OSDbg_IsrQSize              = 0u;
+#endif
+
+OS_PIPE     const  OSDbg_Pipe                  = { 0u };
+CPU_INT08U  const  OSDbg_PipeEn                = OS_CFG_PIPE_EN;
+#if (OS_CFG_PIPE_EN > 0u)
+CPU_INT08U  const  OSDbg_PipeDelEn             = OS_CFG_PIPE_DEL_EN;
+CPU_INT16U  const  OSDbg_PipeSize              = sizeof(OS_PIPE);              /* Size in bytes of OS_PIPE structure  */
+#else
+CPU_INT08U  const  OSDbg_PipeDelEn             = 0u;
+CPU_INT16U  const  OSDbg_PipeSize              = 0u;
+#endif
+
+OS_RING     const  OSDbg_Ring                  = { 0u };
+CPU_INT08U  const  OSDbg_RingEn                = OS_CFG_RING_EN;
+#if (OS_CFG_RING_EN > 0u)
+CPU_INT08U  const  OSDbg_RingDelEn             = OS_CFG_RING_DEL_EN;
+CPU_INT16U  const  OSDbg_RingSize              = sizeof(OS_RING);              /* Size in bytes of OS_RING structure  */
+#else
+CPU_INT08U  const  OSDbg_RingDelEn             = 0u;
+CPU_INT16U  const  OSDbg_RingSize              = 0u;
+#endif
+
+OS_RWLOCK   const  OSDbg_RwLock                = { 0u };
+CPU_INT08U  const  OSDbg_RwLockEn              = OS_CFG_RWLOCK_EN;
+#if (OS_CFG_RWLOCK_EN > 0u)
+CPU_INT08U  const  OSDbg_RwLockDelEn           = OS_CFG_RWLOCK_DEL_EN;
+CPU_INT08U  const  OSDbg_RwLockPendAbortEn     = OS_CFG_RWLOCK_PEND_ABORT_EN;
+CPU_INT08U  const  OSDbg_RwLockHoldMax         = OS_CFG_RWLOCK_HOLD_MAX;
+CPU_INT16U  const  OSDbg_RwLockSize            = sizeof(OS_RWLOCK);            /* Size in bytes of OS_RWLOCK struct   */
+#else
+CPU_INT08U  const  OSDbg_RwLockDelEn           = 0u;
+CPU_INT08U  const  OSDbg_RwLockPendAbortEn     = 0u;
+CPU_INT08U  const  OSDbg_RwLockHoldMax         = 0u;
+CPU_INT16U  const  OSDbg_RwLockSize            = 0u;
+#endif
+
 CPU_INT08U  const  OSDbg_StatTaskEn            = OS_CFG_STAT_TASK_EN;
 CPU_INT08U  const  OSDbg_StatTaskStkChkEn      = OS_CFG_STAT_TASK_STK_CHK_EN;
+CPU_INT08U  const  OSDbg_StatTaskIdleCyclesEn  = OS_CFG_STAT_TASK_IDLE_CYCLES_EN;
+CPU_INT08U  const  OSDbg_StatSchedEn           = OS_CFG_STAT_SCHED_EN;
+CPU_INT08U  const  OSDbg_StatSnapEn            = OS_CFG_STAT_SNAP_EN;
+#if (OS_CFG_STAT_SNAP_EN > 0u)
+CPU_INT16U  const  OSDbg_StatSnapSize          = sizeof(OS_STAT_SNAP);         /* Size in bytes of OS_STAT_SNAP       */
+CPU_INT16U  const  OSDbg_StatSnapTaskSize      = sizeof(OS_STAT_SNAP_TASK);    /* Size in bytes of OS_STAT_SNAP_TASK  */
+#if (OS_CFG_Q_EN > 0u)
+CPU_INT16U  const  OSDbg_StatSnapQSize         = sizeof(OS_STAT_SNAP_Q);       /* Size in bytes of OS_STAT_SNAP_Q     */
+#else
+CPU_INT16U  const  OSDbg_StatSnapQSize         = 0u;
+#endif
+#else
+CPU_INT16U  const  OSDbg_StatSnapSize          = 0u;
+CPU_INT16U  const  OSDbg_StatSnapTaskSize      = 0u;
+CPU_INT16U  const  OSDbg_StatSnapQSize         = 0u;
+#endif
 
+CPU_INT08U  const  OSDbg_TaskBudgetEn          = OS_CFG_TASK_BUDGET_EN;
 CPU_INT08U  const  OSDbg_TaskChangePrioEn      = OS_CFG_TASK_CHANGE_PRIO_EN;
+CPU_INT08U  const  OSDbg_TaskCreateTblEn       = OS_CFG_TASK_CREATE_TBL_EN;
 CPU_INT08U  const  OSDbg_TaskDelEn             = OS_CFG_TASK_DEL_EN;
+CPU_INT08U  const  OSDbg_TaskEDFEn             = OS_CFG_TASK_EDF_EN;
+#if (OS_CFG_TASK_EDF_EN > 0u)
+CPU_INT16U  const  OSDbg_TaskEDFPrio           = OS_CFG_TASK_EDF_PRIO;
+#else
+CPU_INT16U  const  OSDbg_TaskEDFPrio           = 0u;
+#endif
+CPU_INT08U  const  OSDbg_TaskEDFPendEn         = OS_CFG_TASK_EDF_PEND_EN;
+CPU_INT08U  const  OSDbg_TaskFairEn            = OS_CFG_TASK_FAIR_EN;
+#if (OS_CFG_TASK_FAIR_EN > 0u)
+CPU_INT16U  const  OSDbg_TaskFairPrio          = OS_CFG_TASK_FAIR_PRIO;
+#else
+CPU_INT16U  const  OSDbg_TaskFairPrio          = 0u;
+#endif
+CPU_INT08U  const  OSDbg_TaskGrpEn             = OS_CFG_TASK_GRP_EN;
+#if (OS_CFG_TASK_GRP_EN > 0u)
+CPU_INT16U  const  OSDbg_TaskGrpSize           = sizeof(OS_TASK_GRP);          /* Size in bytes of OS_TASK_GRP        */
+#else
+CPU_INT16U  const  OSDbg_TaskGrpSize           = 0u;
+#endif
+CPU_INT08U  const  OSDbg_TaskNotifyEn          = OS_CFG_TASK_NOTIFY_EN;
+CPU_INT08U  const  OSDbg_TaskPerfCtrEn         = OS_CFG_TASK_PERF_CTR_EN;
+CPU_INT08U  const  OSDbg_TaskPeriodEn          = OS_CFG_TASK_PERIOD_EN;
+CPU_INT08U  const  OSDbg_TaskPoolEn            = OS_CFG_TASK_POOL_EN;
+#if (OS_CFG_TASK_POOL_EN > 0u)
+CPU_INT16U  const  OSDbg_TaskPoolSize          = sizeof(OS_TASK_POOL);         /* Size in bytes of OS_TASK_POOL       */
+#else
+CPU_INT16U  const  OSDbg_TaskPoolSize          = 0u;
+#endif
+CPU_INT08U  const  OSDbg_TaskNotifySlots       = OS_CFG_TASK_NOTIFY_SLOTS;
 CPU_INT08U  const  OSDbg_TaskQEn               = OS_CFG_TASK_Q_EN;
 CPU_INT08U  const  OSDbg_TaskQPendAbortEn      = OS_CFG_TASK_Q_PEND_ABORT_EN;
+CPU_INT08U  const  OSDbg_TaskQPostNEn          = OS_CFG_TASK_Q_POST_N_EN;
 CPU_INT08U  const  OSDbg_TaskProfileEn         = OS_CFG_TASK_PROFILE_EN;
 CPU_INT16U  const  OSDbg_TaskRegTblSize        = OS_CFG_TASK_REG_TBL_SIZE;
 CPU_INT08U  const  OSDbg_TaskSemPendAbortEn    = OS_CFG_TASK_SEM_PEND_ABORT_EN;
+CPU_INT08U  const  OSDbg_TaskStkClrDeferEn     = OS_CFG_TASK_STK_CLR_DEFER_EN;
+CPU_INT08U  const  OSDbg_TaskStkFitEn          = OS_CFG_TASK_STK_FIT_EN;
+CPU_INT08U  const  OSDbg_TaskStkGrpEn          = OS_CFG_TASK_STK_GRP_EN;
+#if (OS_CFG_TASK_STK_GRP_EN > 0u)
+CPU_INT16U  const  OSDbg_TaskStkGrpSize        = sizeof(OS_TASK_STK_GRP);       /* Size in bytes of OS_TASK_STK_GRP   */
+#else
+CPU_INT16U  const  OSDbg_TaskStkGrpSize        = 0u;
+#endif
+CPU_INT08U  const  OSDbg_TaskStkProfileEn      = OS_CFG_TASK_STK_PROFILE_EN;
 CPU_INT08U  const  OSDbg_TaskSuspendEn         = OS_CFG_TASK_SUSPEND_EN;
+CPU_INT08U  const  OSDbg_TaskTCBHotFirstEn     = OS_CFG_TASK_TCB_HOT_FIRST_EN;
 
 
 CPU_INT16U  const  OSDbg_TCBSize               = sizeof(OS_TCB);               /* Size in Bytes of OS_TCB             */
 
 CPU_INT16U  const  OSDbg_TickListSize          = sizeof(OS_TICK_LIST);
+CPU_INT08U  const  OSDbg_TickTaskEn            = OS_CFG_TICK_TASK_EN;
+CPU_INT08U  const  OSDbg_TickWheelEn           = OS_CFG_TICK_WHEEL_EN;
+CPU_INT16U  const  OSDbg_TickWheelSize         = OS_CFG_TICK_WHEEL_SIZE;
 
 CPU_INT08U  const  OSDbg_TimeDlyHMSMEn         = OS_CFG_TIME_DLY_HMSM_EN;
 CPU_INT08U  const  OSDbg_TimeDlyResumeEn       = OS_CFG_TIME_DLY_RESUME_EN;
+CPU_INT08U  const  OSDbg_TimeHrEn              = OS_CFG_TIME_HR_EN;
 
 #if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
 CPU_INT16U  const  OSDbg_TLS_TblSize           = OS_CFG_TLS_TBL_SIZE * sizeof(OS_TLS);
@@ -187,15 +477,39 @@ CPU_INT16U  const  OSDbg_TLS_TblSize           = 0u;
 OS_TMR      const  OSDbg_Tmr                   = { 0u };
 CPU_INT08U  const  OSDbg_TmrEn                 = OS_CFG_TMR_EN;
 #if (OS_CFG_TMR_EN > 0u)
+CPU_INT08U  const  OSDbg_TmrCmdQEn             = OS_CFG_TMR_CMD_Q_EN;
 CPU_INT08U  const  OSDbg_TmrDelEn              = OS_CFG_TMR_DEL_EN;
 CPU_INT16U  const  OSDbg_TmrSize               = sizeof(OS_TMR);
+CPU_INT08U  const  OSDbg_TmrIsrEn              = OS_CFG_TMR_ISR_EN;
+CPU_INT08U  const  OSDbg_TmrSvcEn              = OS_CFG_TMR_SVC_EN;
+CPU_INT16U  const  OSDbg_TmrSvcSize            = sizeof(OS_TMR_SVC);
 #else
+CPU_INT08U  const  OSDbg_TmrCmdQEn             = 0u;
 CPU_INT08U  const  OSDbg_TmrDelEn              = 0u;
 CPU_INT16U  const  OSDbg_TmrSize               = 0u;
+CPU_INT08U  const  OSDbg_TmrIsrEn              = 0u;
+CPU_INT08U  const  OSDbg_TmrSvcEn              = 0u;
+CPU_INT16U  const  OSDbg_TmrSvcSize            = 0u;
 #endif
 
 CPU_INT16U  const  OSDbg_VersionNbr            = OS_VERSION;
 
+CPU_INT08U  const  OSDbg_WdogEn                = OS_CFG_WDOG_EN;
+#if (OS_CFG_WDOG_EN > 0u)
+CPU_INT16U  const  OSDbg_WdogSize              = sizeof(OS_WDOG);              /* Size in bytes of OS_WDOG            */
+#else
+CPU_INT16U  const  OSDbg_WdogSize              = 0u;
+#endif
+
+CPU_INT08U  const  OSDbg_WorkQEn               = OS_CFG_WORKQ_EN;
+#if (OS_CFG_WORKQ_EN > 0u)
+CPU_INT16U  const  OSDbg_WorkQSize             = sizeof(OS_WORKQ);             /* Size in bytes of OS_WORKQ           */
+CPU_INT16U  const  OSDbg_WorkSize              = sizeof(OS_WORK);              /* Size in bytes of OS_WORK            */
+#else
+CPU_INT16U  const  OSDbg_WorkQSize             = 0u;
+CPU_INT16U  const  OSDbg_WorkSize              = 0u;
+#endif
+
 
 /*
 ************************************************************************************************************************
@@ -217,6 +531,12 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
                                   + sizeof(OS_AppIdleTaskHookPtr)
                                   + sizeof(OS_AppStatTaskHookPtr)
                                   + sizeof(OS_AppTaskSwHookPtr)
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+                                  + sizeof(OS_AppTaskBudgetHookPtr)
+#endif
+#if (OS_CFG_STAT_SCHED_EN > 0u)
+                                  + sizeof(OS_AppStatSchedHookPtr)
+#endif
                                   + sizeof(OS_AppTimeTickHookPtr)
 #endif
 
@@ -236,6 +556,15 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
 #if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u) && (OS_CFG_ISR_STK_SIZE > 0)
                                   + sizeof(OSISRStkFree)
                                   + sizeof(OSISRStkUsed)
+#if (OS_CFG_STAT_TASK_STK_CHK_INCR_EN > 0u)
+                                  + sizeof(OSISRStkChkFree)
+                                  + sizeof(OSISRStkChkIx)
+#endif
+#endif
+
+#if (OS_CFG_ISR_STK_SP_EN > 0u)
+                                  + sizeof(OSISRStkSPPtr)
+                                  + sizeof(OSIntNestingCtrMax)
 #endif
 
 #if (OS_CFG_ISR_STK_SIZE > 0)
@@ -275,26 +604,89 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
 #endif
 #endif
 
+#if (OS_CFG_HEAP_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+                                  + sizeof(OSHeapDbgListPtr)
+                                  + sizeof(OSHeapQty)
+#endif
+#endif
+
 #if (OS_MSG_EN > 0u)
                                   + sizeof(OSMsgPool)
 #endif
 
+#if (OS_SEM_POOL_EN > 0u)
+                                  + sizeof(OSSemPool)
+#endif
+#if (OS_Q_POOL_EN > 0u)
+                                  + sizeof(OSQPool)
+#endif
+#if (OS_TMR_POOL_EN > 0u)
+                                  + sizeof(OSTmrPool)
+#endif
+
 #if (OS_CFG_MUTEX_EN > 0u)
 #if (OS_CFG_DBG_EN > 0u)
                                   + sizeof(OSMutexDbgListPtr)
                                   + sizeof(OSMutexQty)
 #endif
+#if (OS_CFG_MUTEX_BLOCK_STAT_EN > 0u)
+                                  + sizeof(OSMutexChainWorst)
+#endif
 #endif
 
                                   + sizeof(OSPrioCur)
                                   + sizeof(OSPrioHighRdy)
                                   + sizeof(OSPrioTbl)
+#if (OS_PRIO_TBL_2LVL_EN > 0u)
+                                  + sizeof(OSPrioGrp)
+#endif
+#if (OS_CFG_PRIO_MAP_EN > 0u)
+                                  + sizeof(OSPrioMapIxTbl)
+#endif
 
 #if (OS_CFG_Q_EN > 0u)
 #if (OS_CFG_DBG_EN > 0u)
                                   + sizeof(OSQDbgListPtr)
                                   + sizeof(OSQQty)
 #endif
+#endif
+
+#if (OS_CFG_MBOX_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+                                  + sizeof(OSMboxDbgListPtr)
+                                  + sizeof(OSMboxQty)
+#endif
+#endif
+
+#if (OS_CFG_PIPE_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+                                  + sizeof(OSPipeDbgListPtr)
+                                  + sizeof(OSPipeQty)
+#endif
+#endif
+
+#if (OS_CFG_PROF_SAMPLE_EN > 0u)
+                                  + sizeof(OSProfSampleTbl)
+                                  + sizeof(OSProfSampleIn)
+                                  + sizeof(OSProfSampleOut)
+                                  + sizeof(OSProfSampleNbr)
+                                  + sizeof(OSProfSampleOvfCtr)
+                                  + sizeof(OSProfSampleEn)
+#endif
+
+#if (OS_CFG_RING_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+                                  + sizeof(OSRingDbgListPtr)
+                                  + sizeof(OSRingQty)
+#endif
+#endif
+
+#if (OS_CFG_RWLOCK_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+                                  + sizeof(OSRwLockDbgListPtr)
+                                  + sizeof(OSRwLockQty)
+#endif
 #endif
 
                                   + sizeof(OSRdyList)
@@ -305,11 +697,36 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
                                   + sizeof(OSSchedLockTimeBegin)
                                   + sizeof(OSSchedLockTimeMax)
                                   + sizeof(OSSchedLockTimeMaxCur)
+#if (OS_CFG_LOCK_SITE_EN > 0u)
+                                  + sizeof(OSSchedLockSiteTbl)
+                                  + sizeof(OSSchedLockSiteCur)
+#endif
+#endif
+
+#if (OS_CFG_LOCK_SITE_EN > 0u)
+                                  + sizeof(OSLockSiteTbl)
+#endif
+
+#if (OS_CFG_CRIT_SECTION_PROFILE_EN > 0u)
+                                  + sizeof(OSCritSiteTbl)
+                                  + sizeof(OSCritSiteTsBegin)
 #endif
 
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
                                   + sizeof(OSSchedRoundRobinDfltTimeQuanta)
                                   + sizeof(OSSchedRoundRobinEn)
+#if (OS_CFG_SCHED_ROUND_ROBIN_TS_EN > 0u)
+                                  + sizeof(OSSchedRoundRobinSliceEnd)
+                                  + sizeof(OSSchedRoundRobinSliceArmed)
+#endif
+#endif
+
+#if (OS_CFG_SCHED_WINDOW_EN > 0u)
+                                  + sizeof(OSSchedWindowCurPtr)
+                                  + sizeof(OSSchedWindowAll)
+                                  + sizeof(OSSchedWindowTbl)
+                                  + sizeof(OSSchedWindowNbr)
+                                  + sizeof(OSSchedWindowIx)
 #endif
 
 #if (OS_CFG_SEM_EN > 0u)
@@ -318,6 +735,55 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
 #endif
                                   + sizeof(OSSemQty)
 #endif
+
+#if (OS_CFG_SEQLOCK_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+                                  + sizeof(OSSeqLockDbgListPtr)
+                                  + sizeof(OSSeqLockQty)
+#endif
+#endif
+
+#if (OS_CFG_RCU_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+                                  + sizeof(OSRcuDbgListPtr)
+                                  + sizeof(OSRcuQty)
+#endif
+#endif
+
+#if (OS_CFG_TOPIC_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+                                  + sizeof(OSTopicDbgListPtr)
+                                  + sizeof(OSTopicQty)
+#endif
+#endif
+
+#if (OS_CFG_CALL_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+                                  + sizeof(OSCallEpDbgListPtr)
+                                  + sizeof(OSCallEpQty)
+#endif
+#endif
+
+#if (OS_CFG_SIGNAL_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+                                  + sizeof(OSSignalDbgListPtr)
+                                  + sizeof(OSSignalQty)
+#endif
+#endif
+
+#if (OS_CFG_COMPLETION_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+                                  + sizeof(OSCompletionDbgListPtr)
+                                  + sizeof(OSCompletionQty)
+#endif
+#endif
+
+#if (OS_CFG_REACTOR_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+                                  + sizeof(OSReactorDbgListPtr)
+                                  + sizeof(OSReactorQty)
+#endif
+#endif
 #if ((OS_CFG_TASK_PROFILE_EN > 0u) || (OS_CFG_DBG_EN > 0u))
                                   + sizeof(OSTaskCtxSwCtr)
 #if (OS_CFG_DBG_EN > 0u)
@@ -326,6 +792,26 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
 #endif
 
                                   + sizeof(OSTaskQty)
+#if (OS_CFG_TASK_STK_CLR_DEFER_EN > 0u)
+                                  + sizeof(OSTaskStkClrListPtr)
+#endif
+#if (OS_CFG_TASK_STK_PROFILE_EN > 0u)
+                                  + sizeof(OSTaskStkProfileTblPtr)
+#endif
+#if (OS_CFG_TASK_STK_FIT_EN > 0u)
+                                  + sizeof(OSTaskStkFitHeapPtr)
+                                  + sizeof(OSTaskStkFitZombiePtr)
+#endif
+#if (OS_CFG_TASK_HIST_EN > 0u) && (OS_CFG_TASK_HIST_PRIO_EN > 0u)
+                                  + sizeof(OSTaskHistPrioTbl)
+#endif
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+                                  + sizeof(OSTaskBudgetListPtr)
+                                  + sizeof(OSTaskBudgetReplenishTick)
+#endif
+#if (OS_CFG_TASK_FAIR_EN > 0u)
+                                  + sizeof(OSTaskFairVRuntimeMin)
+#endif
 
 
 #if (OS_CFG_STAT_TASK_EN > 0u)
@@ -341,11 +827,41 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
                                   + sizeof(OSStatTaskTime)
                                   + sizeof(OSStatTaskTimeMax)
 #endif
+#if (OS_CFG_STAT_TASK_IDLE_CYCLES_EN > 0u)
+                                  + sizeof(OSStatTaskIdleCycles)
+                                  + sizeof(OSStatTaskCyclesStart)
+#endif
+#if (OS_TASK_PERIOD_EN > 0u) && (OS_CFG_DBG_EN > 0u)
+                                  + sizeof(OSStatTaskPeriodOvrCtr)
+                                  + sizeof(OSStatTaskPeriodJitterMax)
+#endif
+#if (OS_CFG_STAT_SCHED_EN > 0u)
+                                  + sizeof(OSStatSchedUtil)
+                                  + sizeof(OSStatSchedFailTCBPtr)
+#endif
+#if (OS_CFG_STAT_SNAP_EN > 0u)
+                                  + sizeof(OSStatSnap)
+#endif
 #endif
 
 #if (OS_CFG_TICK_EN > 0u)
                                   + sizeof(OSTickCtr)
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+                                  + sizeof(OSTickWheel)
+                                  + sizeof(OSTickWheelCtr)
+#if (OS_CFG_DYN_TICK_EN > 0u)
+                                  + sizeof(OSTickWheelMap)
+#endif
+#else
                                   + sizeof(OSTickList)
+#endif
+#if (OS_CFG_TICK_TASK_EN > 0u)
+                                  + sizeof(OSTickCtrPend)
+                                  + sizeof(OSTickTaskTCB)
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+                                  + sizeof(OSTickWheelCursor)
+#endif
+#endif
 #if (OS_CFG_TS_EN > 0u)
                                   + sizeof(OSTickTime)
                                   + sizeof(OSTickTimeMax)
@@ -356,21 +872,16 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
 #if (OS_CFG_TMR_EN > 0u)
 #if (OS_CFG_DBG_EN > 0u)
                                   + sizeof(OSTmrDbgListPtr)
-                                  + sizeof(OSTmrListEntries)
 #endif
-                                  + sizeof(OSTmrListPtr)
-                                  + sizeof(OSTmrMutex)
-                                  + sizeof(OSTmrCond)
+                                  + sizeof(OSTmrSvc)
+#if (OS_CFG_TMR_ISR_EN > 0u)
+                                  + sizeof(OSTmrIsrListPtr)
+#endif
 #if (OS_CFG_DBG_EN > 0u)
                                   + sizeof(OSTmrQty)
 #endif
                                   + sizeof(OSTmrTaskTCB)
-                                  + sizeof(OSTmrTaskTickBase)
                                   + sizeof(OSTmrToTicksMult)
-#if (OS_CFG_TS_EN > 0u)
-                                  + sizeof(OSTmrTaskTime)
-                                  + sizeof(OSTmrTaskTimeMax)
-#endif
 #endif
 
 #if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
@@ -418,6 +929,9 @@ void  OS_Dbg_Init (void)
 
     p_temp08 = (CPU_INT08U const *)&OSDbg_CalledFromISRChkEn;
 
+    p_temp08 = (CPU_INT08U const *)&OSDbg_CritSectionProfileEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_CritSiteNbr;
+
     p_temp16 = (CPU_INT16U const *)&OSDbg_FlagGrp;
     p_temp08 = (CPU_INT08U const *)&OSDbg_FlagEn;
 #if (OS_CFG_FLAG_EN > 0u)
@@ -431,14 +945,36 @@ void  OS_Dbg_Init (void)
     p_temp16 = (CPU_INT16U const *)&OSDbg_Mem;
     p_temp08 = (CPU_INT08U const *)&OSDbg_MemEn;
 #if (OS_CFG_MEM_EN > 0u)
+    p_temp08 = (CPU_INT08U const *)&OSDbg_MemBufEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_MemCacheEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_MemLockFreeEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_MemMagEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_MemPendEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_MemQuotaEn;
     p_temp16 = (CPU_INT16U const *)&OSDbg_MemSize;
 #endif
 
+    p_temp08 = (CPU_INT08U const *)&OSDbg_SlabEn;
+#if (OS_CFG_SLAB_EN > 0u)
+    p_temp16 = (CPU_INT16U const *)&OSDbg_SlabSize;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_SlabClassSize;
+#endif
+
+    p_temp08 = (CPU_INT08U const *)&OSDbg_ObjPoolEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_ObjPoolSize;
+
+    p_temp08 = (CPU_INT08U const *)&OSDbg_HeapEn;
+#if (OS_CFG_HEAP_EN > 0u)
+    p_temp16 = (CPU_INT16U const *)&OSDbg_HeapSize;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_HeapBlkSize;
+#endif
+
     p_temp08 = (CPU_INT08U const *)&OSDbg_MsgEn;
 #if (OS_MSG_EN > 0u)
     p_temp16 = (CPU_INT16U const *)&OSDbg_MsgSize;
     p_temp16 = (CPU_INT16U const *)&OSDbg_MsgPoolSize;
     p_temp16 = (CPU_INT16U const *)&OSDbg_MsgQSize;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_MsgQStatEn;
 #endif
 
     p_temp16 = (CPU_INT16U const *)&OSDbg_Mutex;
@@ -446,17 +982,26 @@ void  OS_Dbg_Init (void)
 #if (OS_CFG_MUTEX_EN > 0u)
     p_temp08 = (CPU_INT08U const *)&OSDbg_MutexDelEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_MutexPendAbortEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_MutexBlockStatEn;
     p_temp16 = (CPU_INT16U const *)&OSDbg_MutexSize;
 #endif
 
     p_temp08 = (CPU_INT08U const *)&OSDbg_ObjTypeChkEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_ObjCreatedChkEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_ObjStatEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_ObjRegEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_DbgPendNameEn;
 
     p_temp16 = (CPU_INT16U const *)&OSDbg_PendListSize;
     p_temp16 = (CPU_INT16U const *)&OSDbg_PendObjSize;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_PendMultiEn;
 
     p_temp16 = (CPU_INT16U const *)&OSDbg_PrioMax;
     p_temp16 = (CPU_INT16U const *)&OSDbg_PrioTblSize;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_PrioMapEn;
+
+    p_temp08 = (CPU_INT08U const *)&OSDbg_ProfSampleEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_ProfSampleSize;
 
     p_temp16 = (CPU_INT16U const *)&OSDbg_PtrSize;
 
@@ -466,20 +1011,127 @@ void  OS_Dbg_Init (void)
     p_temp08 = (CPU_INT08U const *)&OSDbg_QDelEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_QFlushEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_QPendAbortEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_QPendNEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_QPostNEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_QPrivPoolEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_QPrioEn;
     p_temp16 = (CPU_INT16U const *)&OSDbg_QSize;
 #endif
 
+    p_temp16 = (CPU_INT16U const *)&OSDbg_Mbox;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_MboxEn;
+#if (OS_CFG_MBOX_EN > 0u)
+    p_temp08 = (CPU_INT08U const *)&OSDbg_MboxDelEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_MboxPendAbortEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_MboxSize;
+#endif
+
+    p_temp08 = (CPU_INT08U const *)&OSDbg_IccEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_IccSize;
+
+    p_temp08 = (CPU_INT08U const *)&OSDbg_IccSyncEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_IccLockSize;
+
+    p_temp08 = (CPU_INT08U const *)&OSDbg_IntQEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_IntQSize;
+
+    p_temp08 = (CPU_INT08U const *)&OSDbg_IsrQEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_ISRStkSPEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_IsrQSize;
+
+    p_temp16 = (CPU_INT16U const *)&OSDbg_Pipe;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_PipeEn;
+#if (OS_CFG_PIPE_EN > 0u)
+    p_temp08 = (CPU_INT08U const *)&OSDbg_PipeDelEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_PipeSize;
+#endif
+
+    p_temp16 = (CPU_INT16U const *)&OSDbg_Ring;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_RingEn;
+#if (OS_CFG_RING_EN > 0u)
+    p_temp08 = (CPU_INT08U const *)&OSDbg_RingDelEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_RingSize;
+#endif
+
+    p_temp16 = (CPU_INT16U const *)&OSDbg_RwLock;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_RwLockEn;
+#if (OS_CFG_RWLOCK_EN > 0u)
+    p_temp08 = (CPU_INT08U const *)&OSDbg_RwLockDelEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_RwLockPendAbortEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_RwLockHoldMax;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_RwLockSize;
+#endif
+
     p_temp16 = (CPU_INT16U const *)&OSDbg_SchedRoundRobinEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_SchedRoundRobinTSEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_SchedWindowEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_SchedWindowSize;
+
+    p_temp08 = (CPU_INT08U const *)&OSDbg_SlackEn;
 
     p_temp16 = (CPU_INT16U const *)&OSDbg_Sem;
     p_temp08 = (CPU_INT08U const *)&OSDbg_SemEn;
 #if (OS_CFG_SEM_EN > 0u)
     p_temp08 = (CPU_INT08U const *)&OSDbg_SemDelEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_SemPendAbortEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_SemPendNEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_SemPostNEn;
     p_temp16 = (CPU_INT16U const *)&OSDbg_SemSetEn;
     p_temp16 = (CPU_INT16U const *)&OSDbg_SemSize;
 #endif
 
+    p_temp16 = (CPU_INT16U const *)&OSDbg_SeqLock;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_SeqLockEn;
+#if (OS_CFG_SEQLOCK_EN > 0u)
+    p_temp08 = (CPU_INT08U const *)&OSDbg_SeqLockDelEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_SeqLockSize;
+#endif
+
+    p_temp16 = (CPU_INT16U const *)&OSDbg_Rcu;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_RcuEn;
+#if (OS_CFG_RCU_EN > 0u)
+    p_temp08 = (CPU_INT08U const *)&OSDbg_RcuDelEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_RcuSize;
+#endif
+
+    p_temp16 = (CPU_INT16U const *)&OSDbg_Topic;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TopicEn;
+#if (OS_CFG_TOPIC_EN > 0u)
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TopicDelEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_TopicSize;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_TopicSubSize;
+#endif
+
+    p_temp16 = (CPU_INT16U const *)&OSDbg_CallEp;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_CallEn;
+#if (OS_CFG_CALL_EN > 0u)
+    p_temp08 = (CPU_INT08U const *)&OSDbg_CallDelEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_CallEpSize;
+#endif
+
+    p_temp16 = (CPU_INT16U const *)&OSDbg_Signal;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_SignalEn;
+#if (OS_CFG_SIGNAL_EN > 0u)
+    p_temp08 = (CPU_INT08U const *)&OSDbg_SignalDelEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_SignalPendAbortEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_SignalSize;
+#endif
+
+    p_temp16 = (CPU_INT16U const *)&OSDbg_Completion;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_CompletionEn;
+#if (OS_CFG_COMPLETION_EN > 0u)
+    p_temp08 = (CPU_INT08U const *)&OSDbg_CompletionDelEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_CompletionSize;
+#endif
+
+    p_temp16 = (CPU_INT16U const *)&OSDbg_Reactor;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_ReactorEn;
+#if (OS_CFG_REACTOR_EN > 0u)
+    p_temp08 = (CPU_INT08U const *)&OSDbg_ReactorDelEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_ReactorSize;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_ReactorSrcSize;
+#endif
+
     p_temp16 = (CPU_INT16U const *)&OSDbg_RdyList;
     p_temp32 = (CPU_INT32U const *)&OSDbg_RdyListSize;
 
@@ -487,34 +1139,77 @@ void  OS_Dbg_Init (void)
 
     p_temp08 = (CPU_INT08U const *)&OSDbg_StatTaskEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_StatTaskStkChkEn;
-
+    p_temp08 = (CPU_INT08U const *)&OSDbg_StatTaskIdleCyclesEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_StatSchedEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_StatSnapEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_StatSnapSize;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_StatSnapTaskSize;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_StatSnapQSize;
+
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TaskBudgetEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_TaskChangePrioEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TaskCreateTblEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_TaskDelEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TaskEDFEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_TaskEDFPrio;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TaskEDFPendEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TaskFairEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_TaskFairPrio;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TaskGrpEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_TaskGrpSize;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TaskNotifyEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TaskPerfCtrEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TaskPeriodEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TaskPoolEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_TaskPoolSize;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TaskNotifySlots;
     p_temp08 = (CPU_INT08U const *)&OSDbg_TaskQEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_TaskQPendAbortEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TaskQPostNEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_TaskProfileEn;
     p_temp16 = (CPU_INT16U const *)&OSDbg_TaskRegTblSize;
     p_temp08 = (CPU_INT08U const *)&OSDbg_TaskSemPendAbortEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TaskStkClrDeferEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TaskStkFitEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TaskStkGrpEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_TaskStkGrpSize;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TaskStkProfileEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_TaskSuspendEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TaskTCBHotFirstEn;
 
     p_temp16 = (CPU_INT16U const *)&OSDbg_TCBSize;
 
     p_temp16 = (CPU_INT16U const *)&OSDbg_TickListSize;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TickTaskEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TickWheelEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_TickWheelSize;
 
     p_temp08 = (CPU_INT08U const *)&OSDbg_TimeDlyHMSMEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_TimeDlyResumeEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TimeHrEn;
 
     p_temp16 = (CPU_INT16U const *)&OSDbg_TLS_TblSize;
 
     p_temp16 = (CPU_INT16U const *)&OSDbg_Tmr;
     p_temp08 = (CPU_INT08U const *)&OSDbg_TmrEn;
 #if (OS_CFG_TMR_EN > 0u)
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TmrCmdQEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_TmrDelEn;
     p_temp16 = (CPU_INT16U const *)&OSDbg_TmrSize;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TmrIsrEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TmrSvcEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_TmrSvcSize;
 #endif
 
     p_temp16 = (CPU_INT16U const *)&OSDbg_VersionNbr;
 
+    p_temp08 = (CPU_INT08U const *)&OSDbg_WdogEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_WdogSize;
+
+    p_temp08 = (CPU_INT08U const *)&OSDbg_WorkQEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_WorkQSize;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_WorkSize;
+
     p_temp08 = p_temp08;                                     /* Prevent compiler warning for not using 'p_temp'        */
     p_temp16 = p_temp16;
     p_temp32 = p_temp32;
@@ -24,6 +24,7 @@
 */
 
 #define  MICRIUM_SOURCE
+#define  OS_CRIT_SITE_ID                    OS_CRIT_SITE_FLAG
 #include "os.h"
 
 #ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
@@ -33,6 +34,31 @@ const  CPU_CHAR  *os_flag__c = "$Id: $";
 
 #if (OS_CFG_FLAG_EN > 0u)
 
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_FLAG_WAIT_IDX_EN > 0u)
+static  CPU_INT08U  OS_FlagIdxGet  (OS_FLAG_GRP  *p_grp,
+                                    OS_TCB       *p_tcb);
+
+static  void        OS_FlagIdxLink (OS_FLAG_GRP  *p_grp,
+                                    OS_TCB       *p_tcb,
+                                    CPU_INT08U    ix);
+
+static  void        OS_FlagIdxMove (OS_FLAG_GRP  *p_grp,
+                                    OS_TCB       *p_tcb);
+#endif
+
+static  OS_FLAGS    OS_FlagPost    (OS_FLAG_GRP  *p_grp,
+                                    OS_FLAGS      flags,
+                                    OS_OPT        opt,
+                                    CPU_TS        ts,
+                                    OS_ERR       *p_err);
+
+
 /*
 ************************************************************************************************************************
 *                                                 CREATE AN EVENT FLAG
@@ -63,6 +89,9 @@ void  OSFlagCreate (OS_FLAG_GRP  *p_grp,
                     OS_FLAGS      flags,
                     OS_ERR       *p_err)
 {
+#if (OS_CFG_FLAG_WAIT_IDX_EN > 0u)
+    CPU_INT08U  ix;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -115,6 +144,11 @@ void  OSFlagCreate (OS_FLAG_GRP  *p_grp,
     p_grp->TS      = 0u;
 #endif
     OS_PendListInit(&p_grp->PendList);
+#if (OS_CFG_FLAG_WAIT_IDX_EN > 0u)
+    for (ix = 0u; ix <= OS_FLAG_IDX_NBR; ix++) {                /* No waiters in the index                              */
+        p_grp->IdxTbl[ix] = (OS_TCB *)0;
+    }
+#endif
 
 #if (OS_CFG_DBG_EN > 0u)
     OS_FlagDbgListAdd(p_grp);
@@ -319,6 +353,8 @@ OS_OBJ_QTY  OSFlagDel (OS_FLAG_GRP  *p_grp,
 *                                OS_OPT_PEND_NON_BLOCKING   Task will NOT block if flags are not available
 *                                OS_OPT_PEND_BLOCKING       Task will     block if flags are not available
 *
+*                            Add OS_OPT_PEND_ABS to make 'timeout' the value of OSTickCtr at which to give up.
+*
 *              p_ts          is a pointer to a variable that will receive the timestamp of when the event flag group was
 *                            posted, aborted or the event flag group deleted.  If you pass a NULL pointer (i.e. (CPU_TS *)0)
 *                            then you will not get the timestamp.  In other words, passing a NULL pointer is valid and
@@ -405,7 +441,7 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,
        *p_err = OS_ERR_OBJ_PTR_NULL;
         return (0u);
     }
-    switch (opt) {                                              /* Validate 'opt'                                       */
+    switch (opt & (OS_OPT)~OS_OPT_PEND_ABS) {                   /* Validate 'opt'                                       */
         case OS_OPT_PEND_FLAG_CLR_ALL:
         case OS_OPT_PEND_FLAG_CLR_ANY:
         case OS_OPT_PEND_FLAG_SET_ALL:
@@ -459,6 +495,9 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,
              if (flags_rdy == flags) {                          /* Must match ALL the bits that we want                 */
                  if (consume == OS_TRUE) {                      /* See if we need to consume the flags                  */
                      p_grp->Flags &= ~flags_rdy;                /* Clear ONLY the flags that we wanted                  */
+#if (OS_CFG_FLAG_WAIT_IDX_EN > 0u)
+                     OS_FlagIdxUpdate(p_grp, flags_rdy);        /* Waiters linked to the consumed flags must move       */
+#endif
                  }
                  OSTCBCurPtr->FlagsRdy = flags_rdy;             /* Save flags that were ready                           */
 #if (OS_CFG_TS_EN > 0u)
@@ -466,6 +505,7 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,
                     *p_ts = p_grp->TS;
                  }
 #endif
+                 OS_OBJ_STAT_INC(&p_grp->PendList, PendCtr);
                  CPU_CRITICAL_EXIT();                           /* Yes, condition met, return to caller                 */
                  OS_TRACE_FLAG_PEND(p_grp);
                  OS_TRACE_FLAG_PEND_EXIT(OS_ERR_NONE);
@@ -501,6 +541,9 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,
              if (flags_rdy != 0u) {                             /* See if any flag set                                  */
                  if (consume == OS_TRUE) {                      /* See if we need to consume the flags                  */
                      p_grp->Flags &= ~flags_rdy;                /* Clear ONLY the flags that we got                     */
+#if (OS_CFG_FLAG_WAIT_IDX_EN > 0u)
+                     OS_FlagIdxUpdate(p_grp, flags_rdy);        /* Waiters linked to the consumed flags must move       */
+#endif
                  }
                  OSTCBCurPtr->FlagsRdy = flags_rdy;             /* Save flags that were ready                           */
 #if (OS_CFG_TS_EN > 0u)
@@ -508,6 +551,7 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,
                     *p_ts  = p_grp->TS;
                  }
 #endif
+                 OS_OBJ_STAT_INC(&p_grp->PendList, PendCtr);
                  CPU_CRITICAL_EXIT();                           /* Yes, condition met, return to caller                 */
                  OS_TRACE_FLAG_PEND(p_grp);
                  OS_TRACE_FLAG_PEND_EXIT(OS_ERR_NONE);
@@ -542,6 +586,9 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,
              if (flags_rdy == flags) {                          /* Must match ALL the bits that we want                 */
                  if (consume == OS_TRUE) {                      /* See if we need to consume the flags                  */
                      p_grp->Flags |= flags_rdy;                 /* Set ONLY the flags that we wanted                    */
+#if (OS_CFG_FLAG_WAIT_IDX_EN > 0u)
+                     OS_FlagIdxUpdate(p_grp, flags_rdy);        /* Waiters linked to the consumed flags must move       */
+#endif
                  }
                  OSTCBCurPtr->FlagsRdy = flags_rdy;             /* Save flags that were ready                           */
 #if (OS_CFG_TS_EN > 0u)
@@ -549,6 +596,7 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,
                     *p_ts  = p_grp->TS;
                  }
 #endif
+                 OS_OBJ_STAT_INC(&p_grp->PendList, PendCtr);
                  CPU_CRITICAL_EXIT();                           /* Yes, condition met, return to caller                 */
                  OS_TRACE_FLAG_PEND(p_grp);
                  OS_TRACE_FLAG_PEND_EXIT(OS_ERR_NONE);
@@ -582,6 +630,9 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,
              if (flags_rdy != 0u) {                             /* See if any flag cleared                              */
                  if (consume == OS_TRUE) {                      /* See if we need to consume the flags                  */
                      p_grp->Flags |= flags_rdy;                 /* Set ONLY the flags that we got                       */
+#if (OS_CFG_FLAG_WAIT_IDX_EN > 0u)
+                     OS_FlagIdxUpdate(p_grp, flags_rdy);        /* Waiters linked to the consumed flags must move       */
+#endif
                  }
                  OSTCBCurPtr->FlagsRdy = flags_rdy;             /* Save flags that were ready                           */
 #if (OS_CFG_TS_EN > 0u)
@@ -589,6 +640,7 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,
                     *p_ts  = p_grp->TS;
                  }
 #endif
+                 OS_OBJ_STAT_INC(&p_grp->PendList, PendCtr);
                  CPU_CRITICAL_EXIT();                           /* Yes, condition met, return to caller                 */
                  OS_TRACE_FLAG_PEND(p_grp);
                  OS_TRACE_FLAG_PEND_EXIT(OS_ERR_NONE);
@@ -704,6 +756,9 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,
                 *p_err = OS_ERR_OPT_INVALID;
                  return (0u);
         }
+#if (OS_CFG_FLAG_WAIT_IDX_EN > 0u)
+        OS_FlagIdxUpdate(p_grp, flags_rdy);                     /* Waiters linked to the consumed flags must move       */
+#endif
     }
     CPU_CRITICAL_EXIT();
     OS_TRACE_FLAG_PEND_EXIT(OS_ERR_NONE);
@@ -932,10 +987,17 @@ OS_FLAGS  OSFlagPendGetFlagsRdy (OS_ERR  *p_err)
 *                                OS_ERR_OBJ_TYPE            You are not pointing to an event flag group
 *                                OS_ERR_OPT_INVALID         You specified an invalid option
 *                                OS_ERR_OS_NOT_RUNNING      If uC/OS-III is not running yet
+*                                OS_ERR_INT_Q_FULL          If the post was deferred and the ISR queue is full
 *
 * Returns    : the new value of the event flags bits that are still set.
 *
 * Note(s)    : 1) The execution time of this function depends on the number of tasks waiting on the event flag group.
+*
+*              2) When OS_CFG_FLAG_WAIT_IDX_EN is enabled, it only depends on the number of tasks waiting for the flags
+*                 specified in 'flags' (see EVENT FLAGS Note #2 in os.h).
+*
+*              3) When OS_CFG_ISR_POST_DEFERRED_EN is enabled, a call from an ISR only queues the flags for the ISR
+*                 handler task, so it takes a fixed time and returns 0.
 ************************************************************************************************************************
 */
 
@@ -944,15 +1006,7 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
                       OS_OPT        opt,
                       OS_ERR       *p_err)
 {
-
-    OS_FLAGS       flags_cur;
-    OS_FLAGS       flags_rdy;
-    OS_OPT         mode;
-    OS_PEND_LIST  *p_pend_list;
-    OS_TCB        *p_tcb;
-    OS_TCB        *p_tcb_next;
-    CPU_TS         ts;
-    CPU_SR_ALLOC();
+    CPU_TS  ts;
 
 
 #ifdef OS_SAFETY_CRITICAL
@@ -990,108 +1044,116 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
     }
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Defer the post when called from an ISR               */
+        OS_IntQPost(OS_OBJ_TYPE_FLAG,
+                    (void *)p_grp,
+                    (void *)0,
+                    0u,
+                    flags,
+                    opt,
+                    p_err);
+        OS_TRACE_FLAG_POST_EXIT(*p_err);
+        return (0u);
+    }
+#endif
+
 #if (OS_CFG_TS_EN > 0u)
     ts = OS_TS_GET();                                           /* Get timestamp                                        */
 #else
     ts = 0u;
 #endif
 
-    OS_TRACE_FLAG_POST(p_grp);
+    return (OS_FlagPost(p_grp, flags, opt, ts, p_err));
+}
 
-    switch (opt) {
-        case OS_OPT_POST_FLAG_SET:
-        case OS_OPT_POST_FLAG_SET | OS_OPT_POST_NO_SCHED:
-             CPU_CRITICAL_ENTER();
-             p_grp->Flags |=  flags;                            /* Set   the flags specified in the group               */
-             break;
 
-        case OS_OPT_POST_FLAG_CLR:
-        case OS_OPT_POST_FLAG_CLR | OS_OPT_POST_NO_SCHED:
-             CPU_CRITICAL_ENTER();
-             p_grp->Flags &= ~flags;                            /* Clear the flags specified in the group               */
-             break;
+/*
+************************************************************************************************************************
+*                                          POST EVENT FLAG BIT(S) FROM AN ISR
+*
+* Description: This function is the same as OSFlagPost() but is only called from an ISR.  It does not check whether
+*              the kernel is running and never calls the scheduler: the context switch, if any, is left to OSIntExit().
+*
+* Arguments  : p_grp         is a pointer to the desired event flag group.
+*
+*              flags         are the bits to set or clear (see OSFlagPost())
+*
+*              opt           indicates whether the flags will be set or cleared (see OSFlagPost()).
+*                            OS_OPT_POST_NO_SCHED is implied.
+*
+*              p_err         is a pointer to an error code (see OSFlagPost())
+*
+* Returns    : the new value of the event flags bits that are still set.
+*
+* Note(s)    : 1) This function MUST only be called from an ISR, between OSIntEnter() and OSIntExit().
+*
+*              2) When OS_CFG_ISR_POST_DEFERRED_EN is enabled, the flags are queued for the ISR handler task and 0 is
+*                 returned.
+************************************************************************************************************************
+*/
 
-        default:
-            *p_err = OS_ERR_OPT_INVALID;                        /* INVALID option                                       */
-             OS_TRACE_FLAG_POST_EXIT(*p_err);
-             return (0u);
-    }
-#if (OS_CFG_TS_EN > 0u)
-    p_grp->TS   = ts;
+#if (OS_CFG_POST_FROM_ISR_EN > 0u)
+OS_FLAGS  OSFlagPostFromISR (OS_FLAG_GRP  *p_grp,
+                             OS_FLAGS      flags,
+                             OS_OPT        opt,
+                             OS_ERR       *p_err)
+{
+#if (OS_CFG_ISR_POST_DEFERRED_EN == 0u)
+    CPU_TS  ts;
 #endif
-    p_pend_list = &p_grp->PendList;
-    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on event flag group?                */
-        CPU_CRITICAL_EXIT();                                    /* No                                                   */
-       *p_err = OS_ERR_NONE;
-        OS_TRACE_FLAG_POST_EXIT(*p_err);
-        return (p_grp->Flags);
-    }
 
-    p_tcb = p_pend_list->HeadPtr;
-    while (p_tcb != (OS_TCB *)0) {                              /* Go through all tasks waiting on event flag(s)        */
-        p_tcb_next = p_tcb->PendNextPtr;
-        mode       = p_tcb->FlagsOpt & OS_OPT_PEND_FLAG_MASK;
-        switch (mode) {
-            case OS_OPT_PEND_FLAG_SET_ALL:                      /* See if all req. flags are set for current node       */
-                 flags_rdy = (p_grp->Flags & p_tcb->FlagsPend);
-                 if (flags_rdy == p_tcb->FlagsPend) {
-                     OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                         */
-                                    flags_rdy,
-                                    ts);
-                 }
-                 break;
 
-            case OS_OPT_PEND_FLAG_SET_ANY:                      /* See if any flag set                                  */
-                 flags_rdy = (p_grp->Flags & p_tcb->FlagsPend);
-                 if (flags_rdy != 0u) {
-                     OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                         */
-                                    flags_rdy,
-                                    ts);
-                 }
-                 break;
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
 
-#if (OS_CFG_FLAG_MODE_CLR_EN > 0u)
-            case OS_OPT_PEND_FLAG_CLR_ALL:                      /* See if all req. flags are set for current node       */
-                 flags_rdy = (OS_FLAGS)(~p_grp->Flags & p_tcb->FlagsPend);
-                 if (flags_rdy == p_tcb->FlagsPend) {
-                     OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                         */
-                                    flags_rdy,
-                                    ts);
-                 }
-                 break;
+    OS_TRACE_FLAG_POST_ENTER(p_grp, flags, opt);
 
-            case OS_OPT_PEND_FLAG_CLR_ANY:                      /* See if any flag set                                  */
-                 flags_rdy = (OS_FLAGS)(~p_grp->Flags & p_tcb->FlagsPend);
-                 if (flags_rdy != 0u) {
-                     OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                         */
-                                    flags_rdy,
-                                    ts);
-                 }
-                 break;
-#endif
-            default:
-                 CPU_CRITICAL_EXIT();
-                *p_err = OS_ERR_FLAG_PEND_OPT;
-                 OS_TRACE_FLAG_POST_EXIT(*p_err);
-                 return (0u);
-        }
-                                                                /* Point to next task waiting for event flag(s)         */
-        p_tcb = p_tcb_next;
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_grp == (OS_FLAG_GRP *)0) {                            /* Validate 'p_grp'                                     */
+        OS_TRACE_FLAG_POST_FAILED(p_grp);
+        OS_TRACE_FLAG_POST_EXIT(OS_ERR_OBJ_PTR_NULL);
+       *p_err  = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
     }
-    CPU_CRITICAL_EXIT();
+#endif
 
-    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
-        OSSched();
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_grp->Type != OS_OBJ_TYPE_FLAG) {                      /* Make sure we are pointing to an event flag grp       */
+        OS_TRACE_FLAG_POST_FAILED(p_grp);
+        OS_TRACE_FLAG_POST_EXIT(OS_ERR_OBJ_TYPE);
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
     }
+#endif
 
-    CPU_CRITICAL_ENTER();
-    flags_cur = p_grp->Flags;
-    CPU_CRITICAL_EXIT();
-   *p_err     = OS_ERR_NONE;
-
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    OS_IntQPost(OS_OBJ_TYPE_FLAG,                               /* See Note #2                                          */
+                (void *)p_grp,
+                (void *)0,
+                0u,
+                flags,
+                opt,
+                p_err);
     OS_TRACE_FLAG_POST_EXIT(*p_err);
-    return (flags_cur);
+    return (0u);
+#else
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    return (OS_FlagPost(p_grp, flags, (OS_OPT)(opt | OS_OPT_POST_NO_SCHED), ts, p_err));
+#endif
 }
+#endif
+
+
 
 
 /*
@@ -1136,10 +1198,14 @@ void  OS_FlagBlock (OS_FLAG_GRP  *p_grp,
     OSTCBCurPtr->FlagsOpt  = opt;                               /* Save the type of wait we are doing                   */
     OSTCBCurPtr->FlagsRdy  = 0u;
 
+    OS_PEND_ABS_SET(OSTCBCurPtr, opt);
     OS_Pend((OS_PEND_OBJ *)((void *)p_grp),
              OSTCBCurPtr,
              OS_TASK_PEND_ON_FLAG,
              timeout);
+#if (OS_CFG_FLAG_WAIT_IDX_EN > 0u)
+    OS_FlagIdxInsert(p_grp, OSTCBCurPtr);                       /* Link the task to the flags it waits for              */
+#endif
 }
 
 
@@ -1162,6 +1228,9 @@ void  OS_FlagBlock (OS_FLAG_GRP  *p_grp,
 void  OS_FlagClr (OS_FLAG_GRP  *p_grp)
 {
     OS_PEND_LIST  *p_pend_list;
+#if (OS_CFG_FLAG_WAIT_IDX_EN > 0u)
+    CPU_INT08U     ix;
+#endif
 
 
 #if (OS_OBJ_TYPE_REQ > 0u)
@@ -1173,6 +1242,11 @@ void  OS_FlagClr (OS_FLAG_GRP  *p_grp)
     p_grp->Flags            =  0u;
     p_pend_list             = &p_grp->PendList;
     OS_PendListInit(p_pend_list);
+#if (OS_CFG_FLAG_WAIT_IDX_EN > 0u)
+    for (ix = 0u; ix <= OS_FLAG_IDX_NBR; ix++) {
+        p_grp->IdxTbl[ix]   = (OS_TCB *)0;
+    }
+#endif
 }
 
 
@@ -1203,6 +1277,10 @@ void  OS_FlagDbgListAdd (OS_FLAG_GRP  *p_grp)
         OSFlagDbgListPtr->DbgPrevPtr = p_grp;
     }
     OSFlagDbgListPtr                 = p_grp;
+
+#if (OS_CFG_OBJ_REG_EN > 0u)
+    OS_ObjRegAdd((void *)p_grp, OS_OBJ_TYPE_FLAG, p_grp->NamePtr);
+#endif
 }
 
 
@@ -1232,6 +1310,10 @@ void  OS_FlagDbgListRemove (OS_FLAG_GRP  *p_grp)
         p_grp->DbgNextPtr      = (OS_FLAG_GRP *)0;
         p_grp->DbgPrevPtr      = (OS_FLAG_GRP *)0;
     }
+
+#if (OS_CFG_OBJ_REG_EN > 0u)
+    OS_ObjRegRemove((void *)p_grp, OS_OBJ_TYPE_FLAG, p_grp->NamePtr);
+#endif
 }
 #endif
 
@@ -1295,6 +1377,398 @@ void   OS_FlagTaskRdy (OS_TCB    *p_tcb,
                                                                 /* Default case.                                        */
              break;
     }
+    OS_OBJ_STAT_INC(&p_tcb->PendObjPtr->PendList, PendCtr);
     OS_PendListRemove(p_tcb);
 }
+
+
+/*
+************************************************************************************************************************
+*                                           EVENT FLAG GROUP WAITER INDEX
+*
+* Description: These functions maintain the index of the tasks waiting on an event flag group by the flag they wait for
+*              (see EVENT FLAGS Note #2 in os.h).
+*
+*              OS_FlagIdxInsert()  links a waiter to the entry matching its flags and the current value of the group.
+*              OS_FlagIdxRemove()  unlinks a waiter, it is called by OS_PendListRemove().
+*              OS_FlagIdxUpdate()  moves the waiters linked to flags that changed without a post (see Note #2).
+*              OS_FlagIdxPost()    makes ready the waiters linked to the posted flags whose condition is met and moves
+*                                  the others.
+*
+* Arguments  : p_grp         is a pointer to the event flag group
+*              -----
+*
+*              p_tcb         is a pointer to the OS_TCB of the waiter
+*              -----
+*
+*              flags         are the flags that changed or that were posted
+*
+*              ts            is a timestamp associated with the post
+*
+* Returns    : none
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application should not call them.  They are called
+*                 with interrupts disabled.
+*
+*              2) A waiter is always linked to a flag it is still waiting for, so a waiter can only become ready when one
+*                 of the flags it is linked to is posted.  The flags consumed by OSFlagPend() change the group without
+*                 a post and the waiters linked to them are moved by OS_FlagIdxUpdate().
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_FLAG_WAIT_IDX_EN > 0u)
+static  CPU_INT08U  OS_FlagIdxGet (OS_FLAG_GRP  *p_grp,
+                                   OS_TCB       *p_tcb)
+{
+    OS_FLAGS    flags;
+    CPU_INT08U  ix;
+
+
+    flags = p_tcb->FlagsPend;
+    switch (p_tcb->FlagsOpt & OS_OPT_PEND_FLAG_MASK) {
+        case OS_OPT_PEND_FLAG_SET_ANY:
+             if ((flags & (flags - 1u)) != 0u) {                /* More than one flag, any of them can make it ready    */
+                 flags = 0u;
+             }
+             flags &= ~p_grp->Flags;                            /* Flags still clear                                    */
+             break;
+
+        case OS_OPT_PEND_FLAG_SET_ALL:
+             flags &= ~p_grp->Flags;
+             break;
+
+#if (OS_CFG_FLAG_MODE_CLR_EN > 0u)
+        case OS_OPT_PEND_FLAG_CLR_ANY:
+             if ((flags & (flags - 1u)) != 0u) {
+                 flags = 0u;
+             }
+             flags &=  p_grp->Flags;                            /* Flags still set                                      */
+             break;
+
+        case OS_OPT_PEND_FLAG_CLR_ALL:
+             flags &=  p_grp->Flags;
+             break;
+#endif
+
+        default:
+             flags = 0u;
+             break;
+    }
+
+    if (flags == 0u) {
+        return (OS_FLAG_IDX_NBR);                               /* Checked on every post                                */
+    }
+
+    ix = 0u;
+    while ((flags & 1u) == 0u) {                                /* Link to the lowest flag                              */
+        flags >>= 1u;
+        ix++;
+    }
+    return (ix);
+}
+
+
+static  void  OS_FlagIdxLink (OS_FLAG_GRP  *p_grp,
+                              OS_TCB       *p_tcb,
+                              CPU_INT08U    ix)
+{
+    OS_TCB  *p_head;
+
+
+    p_head                = p_grp->IdxTbl[ix];
+    p_tcb->FlagIdxPrevPtr = (OS_TCB *)0;
+    p_tcb->FlagIdxNextPtr = p_head;
+    if (p_head != (OS_TCB *)0) {
+        p_head->FlagIdxPrevPtr = p_tcb;
+    }
+    p_grp->IdxTbl[ix]     = p_tcb;
+    p_tcb->FlagIdx        = ix;
+}
+
+
+static  void  OS_FlagIdxMove (OS_FLAG_GRP  *p_grp,
+                              OS_TCB       *p_tcb)
+{
+    CPU_INT08U  ix;
+
+
+    ix = OS_FlagIdxGet(p_grp, p_tcb);
+    if (ix != p_tcb->FlagIdx) {                                 /* Only relink if the entry changed                     */
+        OS_FlagIdxRemove(p_grp, p_tcb);
+        OS_FlagIdxLink(p_grp, p_tcb, ix);
+    }
+}
+
+
+void  OS_FlagIdxInsert (OS_FLAG_GRP  *p_grp,
+                        OS_TCB       *p_tcb)
+{
+    OS_FlagIdxLink(p_grp, p_tcb, OS_FlagIdxGet(p_grp, p_tcb));
+}
+
+
+void  OS_FlagIdxRemove (OS_FLAG_GRP  *p_grp,
+                        OS_TCB       *p_tcb)
+{
+    OS_TCB  *p_next;
+    OS_TCB  *p_prev;
+
+
+    p_next = p_tcb->FlagIdxNextPtr;
+    p_prev = p_tcb->FlagIdxPrevPtr;
+    if (p_prev == (OS_TCB *)0) {                                /* Head of the entry?                                   */
+        p_grp->IdxTbl[p_tcb->FlagIdx] = p_next;
+    } else {
+        p_prev->FlagIdxNextPtr        = p_next;
+    }
+    if (p_next != (OS_TCB *)0) {
+        p_next->FlagIdxPrevPtr        = p_prev;
+    }
+    p_tcb->FlagIdxNextPtr = (OS_TCB *)0;
+    p_tcb->FlagIdxPrevPtr = (OS_TCB *)0;
+    p_tcb->FlagIdx        = OS_FLAG_IDX_NONE;
+}
+
+
+void  OS_FlagIdxUpdate (OS_FLAG_GRP  *p_grp,
+                        OS_FLAGS      flags)
+{
+    OS_TCB      *p_tcb;
+    OS_TCB      *p_tcb_next;
+    CPU_INT08U   ix;
+
+
+    ix = 0u;
+    while (flags != 0u) {
+        if ((flags & 1u) != 0u) {
+            p_tcb = p_grp->IdxTbl[ix];
+            while (p_tcb != (OS_TCB *)0) {
+                p_tcb_next = p_tcb->FlagIdxNextPtr;
+                OS_FlagIdxMove(p_grp, p_tcb);
+                p_tcb      = p_tcb_next;
+            }
+        }
+        flags >>= 1u;
+        ix++;
+    }
+}
+
+
+void  OS_FlagIdxPost (OS_FLAG_GRP  *p_grp,
+                      OS_FLAGS      flags,
+                      CPU_TS        ts)
+{
+    OS_FLAGS     flags_rdy;
+    OS_TCB      *p_tcb;
+    OS_TCB      *p_tcb_next;
+    CPU_INT08U   ix;
+
+
+    ix = 0u;
+    while (ix <= OS_FLAG_IDX_NBR) {
+        if ((ix == OS_FLAG_IDX_NBR) ||                          /* Posted flag or waiters checked on every post?        */
+            (((flags >> ix) & 1u) != 0u)) {
+            p_tcb = p_grp->IdxTbl[ix];
+            while (p_tcb != (OS_TCB *)0) {
+                p_tcb_next = p_tcb->FlagIdxNextPtr;
+                switch (p_tcb->FlagsOpt & OS_OPT_PEND_FLAG_MASK) {
+                    case OS_OPT_PEND_FLAG_SET_ALL:
+                         flags_rdy = (p_grp->Flags & p_tcb->FlagsPend);
+                         if (flags_rdy != p_tcb->FlagsPend) {
+                             flags_rdy = 0u;
+                         }
+                         break;
+
+                    case OS_OPT_PEND_FLAG_SET_ANY:
+                         flags_rdy = (p_grp->Flags & p_tcb->FlagsPend);
+                         break;
+
+#if (OS_CFG_FLAG_MODE_CLR_EN > 0u)
+                    case OS_OPT_PEND_FLAG_CLR_ALL:
+                         flags_rdy = (OS_FLAGS)(~p_grp->Flags & p_tcb->FlagsPend);
+                         if (flags_rdy != p_tcb->FlagsPend) {
+                             flags_rdy = 0u;
+                         }
+                         break;
+
+                    case OS_OPT_PEND_FLAG_CLR_ANY:
+                         flags_rdy = (OS_FLAGS)(~p_grp->Flags & p_tcb->FlagsPend);
+                         break;
+#endif
+                    default:
+                         flags_rdy = 0u;
+                         break;
+                }
+                if (flags_rdy != 0u) {
+                    OS_FlagTaskRdy(p_tcb,                       /* Make task RTR, event(s) Rx'd                         */
+                                   flags_rdy,
+                                   ts);
+                } else {
+                    OS_FlagIdxMove(p_grp, p_tcb);               /* Link to a flag it is still waiting for               */
+                }
+                p_tcb = p_tcb_next;
+            }
+        }
+        ix++;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                POST EVENT FLAG BIT(S)
+*
+* Description: This function sets or clears bits in an event flag group once OSFlagPost() or OSFlagPostFromISR()
+*              checked the arguments.
+*
+* Arguments  : p_grp         is a pointer to the desired event flag group.
+*
+*              flags         are the bits to set or clear (see OSFlagPost())
+*
+*              opt           indicates whether the flags will be set or cleared (see OSFlagPost())
+*
+*              ts            is the timestamp of the post
+*
+*              p_err         is a pointer to an error code (see OSFlagPost())
+*
+* Returns    : the new value of the event flags bits that are still set.
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+static  OS_FLAGS  OS_FlagPost (OS_FLAG_GRP  *p_grp,
+                               OS_FLAGS      flags,
+                               OS_OPT        opt,
+                               CPU_TS        ts,
+                               OS_ERR       *p_err)
+{
+    OS_FLAGS       flags_cur;
+    OS_PEND_LIST  *p_pend_list;
+#if (OS_CFG_FLAG_WAIT_IDX_EN == 0u)
+    OS_FLAGS       flags_rdy;
+    OS_OPT         mode;
+    OS_TCB        *p_tcb;
+    OS_TCB        *p_tcb_next;
+#endif
+#if (OS_CFG_REACTOR_EN > 0u)
+    CPU_BOOLEAN    rdy;
+#endif
+    CPU_SR_ALLOC();
+    OS_LOCK_SITE_ALLOC();
+
+    OS_TRACE_FLAG_POST(p_grp);
+
+    switch (opt) {
+        case OS_OPT_POST_FLAG_SET:
+        case OS_OPT_POST_FLAG_SET | OS_OPT_POST_NO_SCHED:
+             CPU_CRITICAL_ENTER();
+             p_grp->Flags |=  flags;                            /* Set   the flags specified in the group               */
+             break;
+
+        case OS_OPT_POST_FLAG_CLR:
+        case OS_OPT_POST_FLAG_CLR | OS_OPT_POST_NO_SCHED:
+             CPU_CRITICAL_ENTER();
+             p_grp->Flags &= ~flags;                            /* Clear the flags specified in the group               */
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;                        /* INVALID option                                       */
+             OS_TRACE_FLAG_POST_EXIT(*p_err);
+             return (0u);
+    }
+    OS_LOCK_SITE_BEGIN();
+#if (OS_CFG_TS_EN > 0u)
+    p_grp->TS   = ts;
+#endif
+    p_pend_list = &p_grp->PendList;
+    OS_OBJ_STAT_INC(p_pend_list, PostCtr);
+#if (OS_CFG_REACTOR_EN > 0u)
+    rdy         = OS_ReactorSrcRdy(p_pend_list->ReactorSrcPtr, ts);
+#endif
+    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on event flag group?                */
+        OS_LOCK_SITE_END(OS_LOCK_SITE_FLAG_POST);
+        CPU_CRITICAL_EXIT();                                    /* No                                                   */
+#if (OS_CFG_REACTOR_EN > 0u)
+        if ((rdy                          == OS_TRUE) &&        /* Run the task of the reactor watching the group       */
+            ((opt & OS_OPT_POST_NO_SCHED) ==      0u)) {
+            OSSched();
+        }
+#endif
+       *p_err = OS_ERR_NONE;
+        OS_TRACE_FLAG_POST_EXIT(*p_err);
+        return (p_grp->Flags);
+    }
+
+#if (OS_CFG_FLAG_WAIT_IDX_EN > 0u)
+    OS_FlagIdxPost(p_grp, flags, ts);                           /* Only check the waiters of the posted flags           */
+#else
+    p_tcb = p_pend_list->HeadPtr;
+    while (p_tcb != (OS_TCB *)0) {                              /* Go through all tasks waiting on event flag(s)        */
+        p_tcb_next = p_tcb->PendNextPtr;
+        mode       = p_tcb->FlagsOpt & OS_OPT_PEND_FLAG_MASK;
+        switch (mode) {
+            case OS_OPT_PEND_FLAG_SET_ALL:                      /* See if all req. flags are set for current node       */
+                 flags_rdy = (p_grp->Flags & p_tcb->FlagsPend);
+                 if (flags_rdy == p_tcb->FlagsPend) {
+                     OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                         */
+                                    flags_rdy,
+                                    ts);
+                 }
+                 break;
+
+            case OS_OPT_PEND_FLAG_SET_ANY:                      /* See if any flag set                                  */
+                 flags_rdy = (p_grp->Flags & p_tcb->FlagsPend);
+                 if (flags_rdy != 0u) {
+                     OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                         */
+                                    flags_rdy,
+                                    ts);
+                 }
+                 break;
+
+#if (OS_CFG_FLAG_MODE_CLR_EN > 0u)
+            case OS_OPT_PEND_FLAG_CLR_ALL:                      /* See if all req. flags are set for current node       */
+                 flags_rdy = (OS_FLAGS)(~p_grp->Flags & p_tcb->FlagsPend);
+                 if (flags_rdy == p_tcb->FlagsPend) {
+                     OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                         */
+                                    flags_rdy,
+                                    ts);
+                 }
+                 break;
+
+            case OS_OPT_PEND_FLAG_CLR_ANY:                      /* See if any flag set                                  */
+                 flags_rdy = (OS_FLAGS)(~p_grp->Flags & p_tcb->FlagsPend);
+                 if (flags_rdy != 0u) {
+                     OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                         */
+                                    flags_rdy,
+                                    ts);
+                 }
+                 break;
+#endif
+            default:
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_FLAG_PEND_OPT;
+                 OS_TRACE_FLAG_POST_EXIT(*p_err);
+                 return (0u);
+        }
+                                                                /* Point to next task waiting for event flag(s)         */
+        p_tcb = p_tcb_next;
+    }
+#endif
+    OS_LOCK_SITE_END(OS_LOCK_SITE_FLAG_POST);
+    CPU_CRITICAL_EXIT();
+
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();
+    }
+
+    CPU_CRITICAL_ENTER();
+    flags_cur = p_grp->Flags;
+    CPU_CRITICAL_EXIT();
+   *p_err     = OS_ERR_NONE;
+
+    OS_TRACE_FLAG_POST_EXIT(*p_err);
+    return (flags_cur);
+}
 #endif
@@ -0,0 +1,960 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                    TWO-LEVEL SEGREGATED FIT HEAP
+*
+* File    : os_heap.c
+* Version : V3.08.00
+*********************************************************************************************************
+*/
+
+#define   MICRIUM_SOURCE
+#define   OS_CRIT_SITE_ID                   OS_CRIT_SITE_HEAP
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_heap__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_HEAP_EN > 0u)
+/*
+************************************************************************************************************************
+*                                                    LOCAL DEFINES
+************************************************************************************************************************
+*/
+
+#define  OS_HEAP_ALIGN_LOG2                3u                   /* Blocks and sizes are multiples of 8 bytes            */
+#define  OS_HEAP_ALIGN                    (1u << OS_HEAP_ALIGN_LOG2)
+
+#define  OS_HEAP_BLK_HDR_SIZE            ((CPU_SIZE_T)((sizeof(OS_HEAP_BLK) + (OS_HEAP_ALIGN - 1u)) & ~(OS_HEAP_ALIGN - 1u)))
+
+#define  OS_HEAP_FL_SHIFT                 (OS_CFG_HEAP_SL_LOG2 + OS_HEAP_ALIGN_LOG2)
+#define  OS_HEAP_SMALL_SIZE               ((CPU_SIZE_T)1u << OS_HEAP_FL_SHIFT)
+
+#define  OS_HEAP_BLK_NEXT(p_blk)          ((OS_HEAP_BLK *)((CPU_INT08U *)(p_blk) + OS_HEAP_BLK_HDR_SIZE + (p_blk)->Size))
+
+
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  CPU_DATA      OS_HeapFls       (CPU_SIZE_T    size);
+
+static  void          OS_HeapMap       (CPU_SIZE_T    size,
+                                        CPU_DATA     *p_fl,
+                                        CPU_DATA     *p_sl);
+
+static  OS_HEAP_BLK  *OS_HeapFreeFind  (OS_HEAP      *p_heap,
+                                        CPU_SIZE_T    size);
+
+static  void          OS_HeapFreeInsert(OS_HEAP      *p_heap,
+                                        OS_HEAP_BLK  *p_blk);
+
+static  void          OS_HeapFreeRemove(OS_HEAP      *p_heap,
+                                        OS_HEAP_BLK  *p_blk);
+
+static  void          OS_HeapOwnerLink (OS_HEAP_BLK  *p_blk,
+                                        OS_TCB       *p_tcb);
+
+static  void          OS_HeapOwnerUnlink(OS_HEAP_BLK *p_blk);
+
+static  OS_HEAP_BLK  *OS_HeapBlkGet    (OS_HEAP      *p_heap,
+                                        void         *p_mem);
+
+static  void          OS_HeapBlkRelease(OS_HEAP      *p_heap,
+                                        OS_HEAP_BLK  *p_blk);
+
+
+/*
+************************************************************************************************************************
+*                                                    CREATE A HEAP
+*
+* Description : Create a two-level segregated fit heap in a block of contiguous memory.
+*
+* Arguments   : p_heap    is a pointer to the heap control block which is allocated in user memory space.
+*
+*               p_name    is a pointer to an ASCII string to provide a name to the heap.
+*
+*               p_addr    is the starting address of the memory managed by the heap.
+*
+*               size      is the size in bytes of the memory managed by the heap.
+*
+*               p_err     is a pointer to a variable containing an error message which will be set by this function to
+*                         either:
+*
+*                             OS_ERR_NONE                    If the heap has been created correctly
+*                             OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the heap after you called
+*                                                              OSSafetyCriticalStart()
+*                             OS_ERR_MEM_CREATE_ISR          If you called this function from an ISR
+*                             OS_ERR_MEM_INVALID_P_ADDR      If you passed a NULL pointer for 'p_addr'
+*                             OS_ERR_MEM_INVALID_P_MEM       If you passed a NULL pointer for 'p_heap'
+*                             OS_ERR_MEM_INVALID_SIZE        If 'size' is too small to hold a block, or too large for
+*                                                              the size classes set by OS_CFG_HEAP_FL_NBR
+*                             OS_ERR_OBJ_CREATED             If the heap was already created
+*
+* Returns     : none
+*
+* Note(s)     : 1) 'p_addr' does not need to be aligned.  The heap starts at the first 8-byte boundary and ends at the
+*                  last one, and keeps a header of OS_HEAP_BLK at the end of the memory to stop the merging of blocks.
+*
+*               2) The largest block a heap can manage is a little under 2^(OS_CFG_HEAP_FL_NBR + OS_CFG_HEAP_SL_LOG2 + 2)
+*                  bytes.
+************************************************************************************************************************
+*/
+
+void  OSHeapCreate (OS_HEAP     *p_heap,
+                    CPU_CHAR    *p_name,
+                    void        *p_addr,
+                    CPU_SIZE_T   size,
+                    OS_ERR      *p_err)
+{
+    CPU_ADDR      addr;
+    CPU_ADDR      addr_end;
+    OS_HEAP_BLK  *p_blk;
+    OS_HEAP_BLK  *p_blk_end;
+    CPU_DATA      fl;
+    CPU_DATA      sl;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_MEM_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_heap == (OS_HEAP *)0) {                               /* Must point to a valid heap                           */
+       *p_err = OS_ERR_MEM_INVALID_P_MEM;
+        return;
+    }
+    if (p_addr == (void *)0) {                                  /* Must pass a valid address for the memory             */
+       *p_err = OS_ERR_MEM_INVALID_P_ADDR;
+        return;
+    }
+#endif
+
+#if (OS_OBJ_TYPE_REQ > 0u)
+#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
+    if (p_heap->Type == OS_OBJ_TYPE_HEAP) {
+       *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+#endif
+
+    addr     = ((CPU_ADDR)p_addr + (OS_HEAP_ALIGN - 1u)) & ~(CPU_ADDR)(OS_HEAP_ALIGN - 1u);
+    addr_end = ((CPU_ADDR)p_addr + size) & ~(CPU_ADDR)(OS_HEAP_ALIGN - 1u);
+    if ((addr_end <    addr) ||                                 /* Must hold one block and the end header (see Note #1) */
+        ((addr_end - addr) < ((2u * OS_HEAP_BLK_HDR_SIZE) + OS_HEAP_ALIGN)) ||
+        ((CPU_SIZE_T)(CPU_DATA)(addr_end - addr) != (CPU_SIZE_T)(addr_end - addr))) {
+       *p_err = OS_ERR_MEM_INVALID_SIZE;
+        return;
+    }
+    size = (CPU_SIZE_T)(addr_end - addr);
+    OS_HeapMap(size - (2u * OS_HEAP_BLK_HDR_SIZE), &fl, &sl);
+    if (fl >= OS_CFG_HEAP_FL_NBR) {                             /* Must fit in the size classes (see Note #2)           */
+       *p_err = OS_ERR_MEM_INVALID_SIZE;
+        return;
+    }
+
+    for (fl = 0u; fl < OS_CFG_HEAP_FL_NBR; fl++) {              /* All the free lists are empty                         */
+        p_heap->SLBitmap[fl] = 0u;
+        for (sl = 0u; sl < OS_HEAP_SL_NBR; sl++) {
+            p_heap->FreeTbl[fl][sl] = (OS_HEAP_BLK *)0;
+        }
+    }
+    p_heap->FLBitmap                 = 0u;
+    p_heap->AddrPtr                  = (void *)addr;
+    p_heap->SizeTotal                = size;
+    p_heap->SizeFree                 = 0u;
+    p_heap->SizeUsed                 = 0u;
+    p_heap->SizeUsedMax              = 0u;
+    p_heap->NbrBlksFree              = 0u;
+    p_heap->NbrBlksUsed              = 0u;
+    p_heap->NbrAllocFail             = 0u;
+
+    p_blk                            = (OS_HEAP_BLK *)addr;     /* A single free block spans the heap                   */
+    p_blk->PhysPrevPtr               = (OS_HEAP_BLK *)0;
+    p_blk->HeapPtr                   = p_heap;
+    p_blk->Size                      = size - (2u * OS_HEAP_BLK_HDR_SIZE);
+
+    p_blk_end                        = OS_HEAP_BLK_NEXT(p_blk); /* Followed by a used block of size 0                   */
+    p_blk_end->PhysPrevPtr           = p_blk;
+    p_blk_end->NextPtr               = (OS_HEAP_BLK *)0;
+    p_blk_end->PrevPtr               = (OS_HEAP_BLK *)0;
+    p_blk_end->HeapPtr               = p_heap;
+    p_blk_end->OwnerTCBPtr           = (OS_TCB *)0;
+    p_blk_end->Size                  = 0u;
+    p_blk_end->Used                  = OS_TRUE;
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_heap->Type                     = OS_OBJ_TYPE_HEAP;        /* Set the type of object                               */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_heap->NamePtr                  = p_name;                  /* Save name of heap                                    */
+#else
+    (void)p_name;
+#endif
+    OS_HeapFreeInsert(p_heap, p_blk);
+
+#if (OS_CFG_DBG_EN > 0u)
+    OS_HeapDbgListAdd(p_heap);
+    OSHeapQty++;                                                /* One more heap created                                */
+#endif
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              ALLOCATE A BLOCK FROM A HEAP
+*
+* Description : Get a memory block of at least 'size' bytes from a heap.  The block is owned by the calling task.
+*
+* Arguments   : p_heap   is a pointer to the heap control block
+*
+*               size     is the number of bytes needed
+*
+*               p_err    is a pointer to a variable containing an error message which will be set by this function to
+*                        either:
+*
+*                            OS_ERR_NONE               If a block was allocated
+*                            OS_ERR_MEM_INVALID_P_MEM  If you passed a NULL pointer for 'p_heap'
+*                            OS_ERR_MEM_INVALID_SIZE   If 'size' is 0 or larger than the heap
+*                            OS_ERR_MEM_NO_FREE_BLKS   If no free block is large enough
+*                            OS_ERR_OBJ_TYPE           If 'p_heap' is not pointing at a heap
+*
+* Returns     : A pointer to a memory block aligned on 8 bytes if no error is detected
+*               A pointer to NULL if an error is detected
+*
+* Note(s)     : 1) The free block is found with two bit scans of the size class bitmaps and the unused end of the block
+*                  is returned to the heap, so the time taken does not depend on the number of blocks in the heap.
+*
+*               2) The block is owned by the calling task and is freed by OSTaskDel() if the task is deleted before
+*                  releasing it (see OSHeapOwnerSet()).  A block allocated by an ISR or before OSStart() has no owner.
+*                  This function can be called from an ISR.
+************************************************************************************************************************
+*/
+
+void  *OSHeapAlloc (OS_HEAP     *p_heap,
+                    CPU_SIZE_T   size,
+                    OS_ERR      *p_err)
+{
+    OS_HEAP_BLK  *p_blk;
+    OS_HEAP_BLK  *p_blk_rem;
+    OS_TCB       *p_tcb;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_heap == (OS_HEAP *)0) {                               /* Must point to a valid heap                           */
+       *p_err = OS_ERR_MEM_INVALID_P_MEM;
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_heap->Type != OS_OBJ_TYPE_HEAP) {                     /* Make sure the heap was created                       */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return ((void *)0);
+    }
+#endif
+
+    if ((size == 0u) ||
+        (size >  p_heap->SizeTotal)) {
+       *p_err = OS_ERR_MEM_INVALID_SIZE;
+        return ((void *)0);
+    }
+    size = (size + (OS_HEAP_ALIGN - 1u)) & ~(CPU_SIZE_T)(OS_HEAP_ALIGN - 1u);
+
+    CPU_CRITICAL_ENTER();
+    p_blk = OS_HeapFreeFind(p_heap, size);                      /* See Note #1                                          */
+    if (p_blk == (OS_HEAP_BLK *)0) {
+        p_heap->NbrAllocFail++;
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_MEM_NO_FREE_BLKS;
+        return ((void *)0);
+    }
+    OS_HeapFreeRemove(p_heap, p_blk);
+
+    if (p_blk->Size >= (size + OS_HEAP_BLK_HDR_SIZE + OS_HEAP_ALIGN)) {
+        p_blk_rem              = (OS_HEAP_BLK *)((CPU_INT08U *)p_blk + OS_HEAP_BLK_HDR_SIZE + size);
+        p_blk_rem->PhysPrevPtr = p_blk;                         /* Return the end of the block to the heap              */
+        p_blk_rem->HeapPtr     = p_heap;
+        p_blk_rem->Size        = p_blk->Size - size - OS_HEAP_BLK_HDR_SIZE;
+        OS_HEAP_BLK_NEXT(p_blk_rem)->PhysPrevPtr = p_blk_rem;
+        p_blk->Size            = size;
+        OS_HeapFreeInsert(p_heap, p_blk_rem);
+    }
+
+    p_tcb = (OS_TCB *)0;                                        /* Owned by the calling task (see Note #2)              */
+    if ((OSIntNestingCtr == 0u) &&
+        (OSRunning       == OS_STATE_OS_RUNNING)) {
+        p_tcb = OSTCBCurPtr;
+    }
+    p_blk->Used = OS_TRUE;
+    OS_HeapOwnerLink(p_blk, p_tcb);
+
+    p_heap->SizeUsed += p_blk->Size;
+    if (p_heap->SizeUsedMax < p_heap->SizeUsed) {               /* Update the high-water mark of the heap               */
+        p_heap->SizeUsedMax = p_heap->SizeUsed;
+    }
+    p_heap->NbrBlksUsed++;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+    return ((void *)((CPU_INT08U *)p_blk + OS_HEAP_BLK_HDR_SIZE));
+}
+
+
+/*
+************************************************************************************************************************
+*                                              RELEASE A BLOCK TO A HEAP
+*
+* Description : Returns a memory block obtained from OSHeapAlloc() to the heap.  The block is merged with the free blocks
+*               next to it in memory.
+*
+* Arguments   : p_heap   is a pointer to the heap control block
+*
+*               p_mem    is a pointer to the memory block being released.
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               If the memory block was returned to the heap
+*                            OS_ERR_MEM_INVALID_P_BLK  If 'p_mem' is NULL, was not allocated from this heap or was
+*                                                        already released
+*                            OS_ERR_MEM_INVALID_P_MEM  If you passed a NULL pointer for 'p_heap'
+*                            OS_ERR_OBJ_TYPE           If 'p_heap' is not pointing at a heap
+*
+* Returns     : none
+*
+* Note(s)     : 1) Any task can release a block, not only the task that owns it.  This function can be called from an
+*                  ISR.
+************************************************************************************************************************
+*/
+
+void  OSHeapFree (OS_HEAP  *p_heap,
+                  void     *p_mem,
+                  OS_ERR   *p_err)
+{
+    OS_HEAP_BLK  *p_blk;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_heap == (OS_HEAP *)0) {                               /* Must point to a valid heap                           */
+       *p_err = OS_ERR_MEM_INVALID_P_MEM;
+        return;
+    }
+    if (p_mem == (void *)0) {                                   /* Must release a valid block                           */
+       *p_err = OS_ERR_MEM_INVALID_P_BLK;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_heap->Type != OS_OBJ_TYPE_HEAP) {                     /* Make sure the heap was created                       */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_blk = OS_HeapBlkGet(p_heap, p_mem);
+    if (p_blk == (OS_HEAP_BLK *)0) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_MEM_INVALID_P_BLK;
+        return;
+    }
+    OS_HeapBlkRelease(p_heap, p_blk);
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                             CHANGE THE OWNER OF A HEAP BLOCK
+*
+* Description : Gives a memory block obtained from OSHeapAlloc() to another task, or detaches it from any task.
+*
+* Arguments   : p_heap   is a pointer to the heap control block
+*
+*               p_mem    is a pointer to the memory block
+*
+*               p_tcb    is a pointer to the TCB of the task that will own the block.  A NULL pointer leaves the block
+*                        without an owner (see Note #1).
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               If the owner of the block was changed
+*                            OS_ERR_MEM_INVALID_P_BLK  If 'p_mem' is NULL, was not allocated from this heap or was
+*                                                        already released
+*                            OS_ERR_MEM_INVALID_P_MEM  If you passed a NULL pointer for 'p_heap'
+*                            OS_ERR_OBJ_TYPE           If 'p_heap' is not pointing at a heap
+*                            OS_ERR_TASK_NOT_EXIST     If 'p_tcb' is not pointing at a task that was created
+*
+* Returns     : none
+*
+* Note(s)     : 1) Unlike most services, a NULL 'p_tcb' does not specify the calling task.  A block without an owner is
+*                  never freed by OSTaskDel(), which is what a block handed over to another task through a message
+*                  usually needs: the sender can then be deleted while the receiver still uses the block.
+************************************************************************************************************************
+*/
+
+void  OSHeapOwnerSet (OS_HEAP  *p_heap,
+                      void     *p_mem,
+                      OS_TCB   *p_tcb,
+                      OS_ERR   *p_err)
+{
+    OS_HEAP_BLK  *p_blk;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_heap == (OS_HEAP *)0) {                               /* Must point to a valid heap                           */
+       *p_err = OS_ERR_MEM_INVALID_P_MEM;
+        return;
+    }
+    if (p_mem == (void *)0) {                                   /* Must point to a valid block                          */
+       *p_err = OS_ERR_MEM_INVALID_P_BLK;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_heap->Type != OS_OBJ_TYPE_HEAP) {                     /* Make sure the heap was created                       */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb != (OS_TCB *)0) {
+        if (p_tcb->TaskState == OS_TASK_STATE_DEL) {            /* The new owner must be a task that exists             */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_TASK_NOT_EXIST;
+            return;
+        }
+    }
+    p_blk = OS_HeapBlkGet(p_heap, p_mem);
+    if (p_blk == (OS_HEAP_BLK *)0) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_MEM_INVALID_P_BLK;
+        return;
+    }
+    OS_HeapOwnerUnlink(p_blk);
+    OS_HeapOwnerLink(p_blk, p_tcb);
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                             GET THE FRAGMENTATION OF A HEAP
+*
+* Description : Returns how much of the free memory of a heap is outside its largest free block.
+*
+* Arguments   : p_heap   is a pointer to the heap control block
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               If the call was successful
+*                            OS_ERR_MEM_INVALID_P_MEM  If you passed a NULL pointer for 'p_heap'
+*                            OS_ERR_OBJ_TYPE           If 'p_heap' is not pointing at a heap
+*
+* Returns     : The fragmentation of the heap, from 0 (all the free memory is in one block) to 100 percent.  0 is also
+*               returned if the heap has no free memory or if an error is detected.
+*
+* Note(s)     : 1) The largest free block is in the highest size class that is not empty, so only the blocks of that
+*                  class are looked at.
+*
+*               2) The other statistics ('.SizeFree', '.SizeUsed', '.SizeUsedMax', '.NbrBlksFree', '.NbrBlksUsed' and
+*                  '.NbrAllocFail') are kept up to date in the heap control block and can be read directly.
+************************************************************************************************************************
+*/
+
+CPU_INT08U  OSHeapFragGet (OS_HEAP  *p_heap,
+                           OS_ERR   *p_err)
+{
+    OS_HEAP_BLK  *p_blk;
+    CPU_SIZE_T    size_max;
+    CPU_SIZE_T    size_free;
+    CPU_DATA      fl;
+    CPU_DATA      sl;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_heap == (OS_HEAP *)0) {                               /* Must point to a valid heap                           */
+       *p_err = OS_ERR_MEM_INVALID_P_MEM;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_heap->Type != OS_OBJ_TYPE_HEAP) {                     /* Make sure the heap was created                       */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+   *p_err = OS_ERR_NONE;
+    CPU_CRITICAL_ENTER();
+    size_free = p_heap->SizeFree;
+    if (p_heap->FLBitmap == 0u) {                               /* No free memory                                       */
+        CPU_CRITICAL_EXIT();
+        return (0u);
+    }
+    fl       = ((CPU_CFG_DATA_SIZE * 8u) - 1u) - (CPU_DATA)CPU_CntLeadZeros(p_heap->FLBitmap);
+    sl       = ((CPU_CFG_DATA_SIZE * 8u) - 1u) - (CPU_DATA)CPU_CntLeadZeros(p_heap->SLBitmap[fl]);
+    size_max = 0u;
+    p_blk    = p_heap->FreeTbl[fl][sl];
+    while (p_blk != (OS_HEAP_BLK *)0) {                         /* Find the largest free block (see Note #1)            */
+        if (size_max < p_blk->Size) {
+            size_max = p_blk->Size;
+        }
+        p_blk = p_blk->NextPtr;
+    }
+    CPU_CRITICAL_EXIT();
+
+    return ((CPU_INT08U)(100u - (CPU_INT08U)(((CPU_INT64U)size_max * 100u) / (CPU_INT64U)size_free)));
+}
+
+
+/*
+************************************************************************************************************************
+*                                            RELEASE THE HEAP BLOCKS OF A TASK
+*
+* Description: This function is called by OSTaskDel() to return to their heaps the blocks still owned by a task.
+*
+* Arguments  : p_tcb      is a pointer to the TCB of the task being deleted
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.  It is called with
+*                 interrupts disabled.
+*
+*              2) The blocks can belong to different heaps.  Each block is released in constant time, so the time taken
+*                 only depends on the number of blocks the task still owns.
+************************************************************************************************************************
+*/
+
+void  OS_HeapTaskDel (OS_TCB  *p_tcb)
+{
+    OS_HEAP_BLK  *p_blk;
+
+
+    p_blk = p_tcb->HeapBlkListPtr;
+    while (p_blk != (OS_HEAP_BLK *)0) {                         /* See Note #2                                          */
+        OS_HeapBlkRelease(p_blk->HeapPtr, p_blk);
+        p_blk = p_tcb->HeapBlkListPtr;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                               ADD HEAP TO DEBUG LIST
+*
+* Description: This function is called by OSHeapCreate() to add the heap to the debug list.
+*
+* Arguments  : p_heap       is a pointer to the heap to add
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN > 0u)
+void  OS_HeapDbgListAdd (OS_HEAP  *p_heap)
+{
+    p_heap->DbgNamePtr               = (CPU_CHAR *)((void *)" ");
+    p_heap->DbgPrevPtr               = (OS_HEAP *)0;
+    if (OSHeapDbgListPtr == (OS_HEAP *)0) {
+        p_heap->DbgNextPtr           = (OS_HEAP *)0;
+    } else {
+        p_heap->DbgNextPtr           =  OSHeapDbgListPtr;
+        OSHeapDbgListPtr->DbgPrevPtr =  p_heap;
+    }
+    OSHeapDbgListPtr                 =  p_heap;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                    SIZE CLASSES
+*
+* Description: OS_HeapFls() returns the index of the most significant bit set in 'size'.
+*
+*              OS_HeapMap() returns the first level 'fl' and second level 'sl' of the size class of a free block of
+*              'size' bytes.  Sizes below OS_HEAP_SMALL_SIZE are split in 8-byte classes in first level 0.  Above, the
+*              first level is the power of two below 'size' and the second level splits it in OS_HEAP_SL_NBR ranges.
+*
+*              OS_HeapFreeFind() returns the first free block of a size class that can hold 'size' bytes, or NULL.
+*
+* Arguments  : p_heap     is a pointer to the heap
+*              ------
+*
+*              size       is the size in bytes of a block
+*
+*              p_fl       is a pointer to where the first level of the size class will be stored
+*
+*              p_sl       is a pointer to where the second level of the size class will be stored
+*
+* Returns    : see description
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application should not call them.
+*
+*              2) A free block is kept in the size class its size falls in, any block of that class can be smaller
+*                 than the request.  OS_HeapFreeFind() rounds the request up to the next size class first, so the
+*                 first block of any class at or above it is large enough.
+************************************************************************************************************************
+*/
+
+static  CPU_DATA  OS_HeapFls (CPU_SIZE_T  size)
+{
+    return (((CPU_CFG_DATA_SIZE * 8u) - 1u) - (CPU_DATA)CPU_CntLeadZeros((CPU_DATA)size));
+}
+
+
+static  void  OS_HeapMap (CPU_SIZE_T   size,
+                          CPU_DATA    *p_fl,
+                          CPU_DATA    *p_sl)
+{
+    CPU_DATA  bit;
+
+
+    if (size < OS_HEAP_SMALL_SIZE) {
+       *p_fl = 0u;
+       *p_sl = (CPU_DATA)size >> OS_HEAP_ALIGN_LOG2;
+    } else {
+        bit  = OS_HeapFls(size);
+       *p_fl = bit - (OS_HEAP_FL_SHIFT - 1u);
+       *p_sl = ((CPU_DATA)size >> (bit - OS_CFG_HEAP_SL_LOG2)) - OS_HEAP_SL_NBR;
+    }
+}
+
+
+static  OS_HEAP_BLK  *OS_HeapFreeFind (OS_HEAP     *p_heap,
+                                       CPU_SIZE_T   size)
+{
+    CPU_DATA  fl;
+    CPU_DATA  sl;
+    CPU_DATA  map;
+
+
+    if (size >= OS_HEAP_SMALL_SIZE) {                           /* Round up to the next size class (see Note #2)        */
+        size += ((CPU_SIZE_T)1u << (OS_HeapFls(size) - OS_CFG_HEAP_SL_LOG2)) - 1u;
+    }
+    OS_HeapMap(size, &fl, &sl);
+    if (fl >= OS_CFG_HEAP_FL_NBR) {
+        return ((OS_HEAP_BLK *)0);
+    }
+
+    map = p_heap->SLBitmap[fl] & ((CPU_DATA)~(CPU_DATA)0u << sl);
+    if (map == 0u) {                                            /* No block in this first level, try the next ones      */
+        fl++;
+        if (fl >= OS_CFG_HEAP_FL_NBR) {
+            return ((OS_HEAP_BLK *)0);
+        }
+        map = p_heap->FLBitmap & ((CPU_DATA)~(CPU_DATA)0u << fl);
+        if (map == 0u) {
+            return ((OS_HEAP_BLK *)0);
+        }
+        fl  = (CPU_DATA)CPU_CntTrailZeros(map);
+        map = p_heap->SLBitmap[fl];
+    }
+    sl = (CPU_DATA)CPU_CntTrailZeros(map);
+    return (p_heap->FreeTbl[fl][sl]);
+}
+
+
+/*
+************************************************************************************************************************
+*                                          INSERT/REMOVE A BLOCK IN/FROM A FREE LIST
+*
+* Description: These functions add a free block at the head of the list of its size class, or remove it from that list,
+*              and keep the bitmaps of the heap and its free memory statistics up to date.
+*
+* Arguments  : p_heap     is a pointer to the heap
+*              ------
+*
+*              p_blk      is a pointer to the block
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call them.
+************************************************************************************************************************
+*/
+
+static  void  OS_HeapFreeInsert (OS_HEAP      *p_heap,
+                                 OS_HEAP_BLK  *p_blk)
+{
+    OS_HEAP_BLK  *p_blk_next;
+    CPU_DATA      fl;
+    CPU_DATA      sl;
+
+
+    OS_HeapMap(p_blk->Size, &fl, &sl);
+    p_blk_next             = p_heap->FreeTbl[fl][sl];
+    p_blk->Used            = OS_FALSE;
+    p_blk->OwnerTCBPtr     = (OS_TCB *)0;
+    p_blk->PrevPtr         = (OS_HEAP_BLK *)0;
+    p_blk->NextPtr         = p_blk_next;
+    if (p_blk_next != (OS_HEAP_BLK *)0) {
+        p_blk_next->PrevPtr = p_blk;
+    }
+    p_heap->FreeTbl[fl][sl] = p_blk;
+    p_heap->FLBitmap       |= (CPU_DATA)1u << fl;
+    p_heap->SLBitmap[fl]   |= (CPU_DATA)1u << sl;
+    p_heap->SizeFree       += p_blk->Size;
+    p_heap->NbrBlksFree++;
+}
+
+
+static  void  OS_HeapFreeRemove (OS_HEAP      *p_heap,
+                                 OS_HEAP_BLK  *p_blk)
+{
+    CPU_DATA  fl;
+    CPU_DATA  sl;
+
+
+    OS_HeapMap(p_blk->Size, &fl, &sl);
+    if (p_blk->PrevPtr == (OS_HEAP_BLK *)0) {
+        p_heap->FreeTbl[fl][sl] = p_blk->NextPtr;
+        if (p_blk->NextPtr == (OS_HEAP_BLK *)0) {               /* Size class is now empty                              */
+            p_heap->SLBitmap[fl] &= ~((CPU_DATA)1u << sl);
+            if (p_heap->SLBitmap[fl] == 0u) {
+                p_heap->FLBitmap &= ~((CPU_DATA)1u << fl);
+            }
+        }
+    } else {
+        p_blk->PrevPtr->NextPtr = p_blk->NextPtr;
+    }
+    if (p_blk->NextPtr != (OS_HEAP_BLK *)0) {
+        p_blk->NextPtr->PrevPtr = p_blk->PrevPtr;
+    }
+    p_heap->SizeFree -= p_blk->Size;
+    p_heap->NbrBlksFree--;
+}
+
+
+/*
+************************************************************************************************************************
+*                                       LINK/UNLINK A BLOCK TO/FROM THE LIST OF ITS OWNER
+*
+* Description: These functions add a used block at the head of the list of blocks owned by a task, or remove it from
+*              that list, and keep the memory used by the task up to date.
+*
+* Arguments  : p_blk      is a pointer to the block
+*              -----
+*
+*              p_tcb      is a pointer to the TCB of the new owner, NULL if none
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call them.
+************************************************************************************************************************
+*/
+
+static  void  OS_HeapOwnerLink (OS_HEAP_BLK  *p_blk,
+                                OS_TCB       *p_tcb)
+{
+    p_blk->OwnerTCBPtr = p_tcb;
+    p_blk->PrevPtr     = (OS_HEAP_BLK *)0;
+    if (p_tcb == (OS_TCB *)0) {
+        p_blk->NextPtr = (OS_HEAP_BLK *)0;
+        return;
+    }
+    p_blk->NextPtr     = p_tcb->HeapBlkListPtr;
+    if (p_blk->NextPtr != (OS_HEAP_BLK *)0) {
+        p_blk->NextPtr->PrevPtr = p_blk;
+    }
+    p_tcb->HeapBlkListPtr = p_blk;
+    p_tcb->HeapSizeUsed  += p_blk->Size;
+    if (p_tcb->HeapSizeUsedMax < p_tcb->HeapSizeUsed) {         /* Update the high-water mark of the task               */
+        p_tcb->HeapSizeUsedMax = p_tcb->HeapSizeUsed;
+    }
+}
+
+
+static  void  OS_HeapOwnerUnlink (OS_HEAP_BLK  *p_blk)
+{
+    OS_TCB  *p_tcb;
+
+
+    p_tcb = p_blk->OwnerTCBPtr;
+    if (p_tcb == (OS_TCB *)0) {
+        return;
+    }
+    if (p_blk->PrevPtr == (OS_HEAP_BLK *)0) {
+        p_tcb->HeapBlkListPtr   = p_blk->NextPtr;
+    } else {
+        p_blk->PrevPtr->NextPtr = p_blk->NextPtr;
+    }
+    if (p_blk->NextPtr != (OS_HEAP_BLK *)0) {
+        p_blk->NextPtr->PrevPtr = p_blk->PrevPtr;
+    }
+    p_tcb->HeapSizeUsed -= p_blk->Size;
+    p_blk->OwnerTCBPtr   = (OS_TCB *)0;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              FIND/RELEASE A USED BLOCK
+*
+* Description: OS_HeapBlkGet() returns the header of the block 'p_mem' points to, or NULL if 'p_mem' was not returned by
+*              OSHeapAlloc() for this heap or was already released.
+*
+*              OS_HeapBlkRelease() removes a used block from the list of its owner and merges it with the free blocks
+*              just below and just above it in memory before adding it to a free list.
+*
+* Arguments  : p_heap     is a pointer to the heap
+*              ------
+*
+*              p_mem      is a pointer to the memory returned by OSHeapAlloc()
+*
+*              p_blk      is a pointer to the header of the used block
+*              -----
+*
+* Returns    : see description
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application should not call them.  They are called
+*                 with interrupts disabled.
+*
+*              2) The header of a block merged into the block below it is cleared so that releasing it again is
+*                 detected.
+************************************************************************************************************************
+*/
+
+static  OS_HEAP_BLK  *OS_HeapBlkGet (OS_HEAP  *p_heap,
+                                     void     *p_mem)
+{
+    OS_HEAP_BLK  *p_blk;
+    CPU_ADDR      addr;
+    CPU_ADDR      addr_heap;
+
+
+    addr      = (CPU_ADDR)p_mem;
+    addr_heap = (CPU_ADDR)p_heap->AddrPtr;
+    if ((addr <  (addr_heap + OS_HEAP_BLK_HDR_SIZE)) ||         /* Must be the payload of a block of this heap          */
+        (addr >= (addr_heap + p_heap->SizeTotal))    ||
+        (((addr - addr_heap) & (OS_HEAP_ALIGN - 1u)) != 0u)) {
+        return ((OS_HEAP_BLK *)0);
+    }
+    p_blk = (OS_HEAP_BLK *)(addr - OS_HEAP_BLK_HDR_SIZE);
+    if ((p_blk->HeapPtr != p_heap) ||                           /* Must be in use                                       */
+        (p_blk->Used    != OS_TRUE)) {
+        return ((OS_HEAP_BLK *)0);
+    }
+    return (p_blk);
+}
+
+
+static  void  OS_HeapBlkRelease (OS_HEAP      *p_heap,
+                                 OS_HEAP_BLK  *p_blk)
+{
+    OS_HEAP_BLK  *p_blk_next;
+    OS_HEAP_BLK  *p_blk_prev;
+
+
+    OS_HeapOwnerUnlink(p_blk);
+    p_heap->SizeUsed -= p_blk->Size;
+    p_heap->NbrBlksUsed--;
+
+    p_blk_next = OS_HEAP_BLK_NEXT(p_blk);
+    if (p_blk_next->Used == OS_FALSE) {                         /* Merge with the free block above                      */
+        OS_HeapFreeRemove(p_heap, p_blk_next);
+        p_blk->Size        += OS_HEAP_BLK_HDR_SIZE + p_blk_next->Size;
+        p_blk_next->HeapPtr = (OS_HEAP *)0;                     /* See Note #2                                          */
+        OS_HEAP_BLK_NEXT(p_blk)->PhysPrevPtr = p_blk;
+    }
+
+    p_blk_prev = p_blk->PhysPrevPtr;
+    if ((p_blk_prev       != (OS_HEAP_BLK *)0) &&               /* Merge with the free block below                      */
+        (p_blk_prev->Used == OS_FALSE)) {
+        OS_HeapFreeRemove(p_heap, p_blk_prev);
+        p_blk_prev->Size   += OS_HEAP_BLK_HDR_SIZE + p_blk->Size;
+        p_blk->HeapPtr      = (OS_HEAP *)0;
+        OS_HEAP_BLK_NEXT(p_blk_prev)->PhysPrevPtr = p_blk_prev;
+        p_blk               = p_blk_prev;
+    }
+
+    OS_HeapFreeInsert(p_heap, p_blk);
+}
+#endif
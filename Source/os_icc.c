@@ -0,0 +1,571 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                     INTER-CORE CHANNEL MANAGEMENT
+*
+* File    : os_icc.c
+* Version : V3.08.00
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+* Note(s) : (1) An inter-core channel carries message pointers from a kernel instance running on one core to a
+*               kernel instance running on another core (AMP).  Each kernel has its own OS_ICC: the sending end is
+*               created with OSIccTxCreate() and the receiving end with OSIccRxCreate().  Both ends refer to the
+*               same OS_ICC_SHM, which lives in memory shared by the two cores together with its message slots.
+*
+*           (2) Only the pointer and size of a message cross the channel.  The message itself is not copied and
+*               MUST be in memory that the receiving core can access at the same address.
+*
+*           (3) The sending core only writes 'InIx' and the receiving core only writes 'OutIx', so no lock is shared
+*               between the cores.  As with OS_ISR_Q, the indices run from 0 to (2 * NbrMsgs) - 1 so that a full
+*               and an empty channel can be told apart without sacrificing a slot.  OS_CPU_MEM_BARRIER() orders the
+*               accesses to a slot with respect to the index that hands it over to the other core.
+*
+*           (4) The shared memory must either be coherent between the two cores or be mapped non-cacheable.
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#define  OS_CRIT_SITE_ID                    OS_CRIT_SITE_ICC
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_icc__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_ICC_EN > 0u)
+/*
+************************************************************************************************************************
+*                                         INITIALIZE THE SHARED PART OF A CHANNEL
+*
+* Description: This function initializes the part of an inter-core channel that lives in shared memory.  It must be
+*              called by ONE of the two cores, before either core creates its end of the channel.
+*
+* Arguments  : p_shm       is a pointer to the shared channel control block
+*
+*              p_msg_tbl   is a pointer to an array of 'nbr_msgs' message slots, also in shared memory
+*
+*              nbr_msgs    is the number of messages the channel can hold
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                    The call was successful
+*                              OS_ERR_OBJ_PTR_NULL            If you passed a NULL pointer for 'p_shm'
+*                              OS_ERR_PTR_INVALID             If you passed a NULL pointer for 'p_msg_tbl'
+*                              OS_ERR_Q_SIZE                  If 'nbr_msgs' is 0 or more than half the range of
+*                                                               OS_MSG_QTY
+*
+* Returns    : none
+*
+* Note(s)    : 1) How the other core learns that the shared part is initialized (boot order, a flag in shared memory,
+*                 ...) is up to your application.
+************************************************************************************************************************
+*/
+
+void  OSIccShmInit (OS_ICC_SHM  *p_shm,
+                    OS_ICC_MSG  *p_msg_tbl,
+                    OS_MSG_QTY   nbr_msgs,
+                    OS_ERR      *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_shm == (OS_ICC_SHM *)0) {                             /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_msg_tbl == (OS_ICC_MSG *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    if ((nbr_msgs == 0u) ||                                     /* Indices must be able to count up to 2 * nbr_msgs     */
+        (nbr_msgs >  ((OS_MSG_QTY)~(OS_MSG_QTY)0 / 2u))) {
+       *p_err = OS_ERR_Q_SIZE;
+        return;
+    }
+#endif
+
+    p_shm->MsgTbl  = p_msg_tbl;
+    p_shm->NbrMsgs = nbr_msgs;
+    p_shm->InIx    = 0u;
+    p_shm->OutIx   = 0u;
+    OS_CPU_MEM_BARRIER();                                       /* Make the channel visible to the other core           */
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                          CREATE THE SENDING END OF A CHANNEL
+*
+* Description: This function is called on the sending core to create its end of an inter-core channel.
+*
+* Arguments  : p_icc       is a pointer to the local end of the channel
+*
+*              p_name      is a pointer to an ASCII string that will be used to name the channel
+*
+*              p_shm       is a pointer to the shared part of the channel, initialized by OSIccShmInit()
+*
+*              p_doorbell  is a pointer to a function that interrupts the receiving core (an inter-processor
+*                          interrupt, a mailbox register, ...).  It is called with 'p_arg' after messages are posted.
+*
+*              p_arg       is the argument passed to 'p_doorbell'
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                    The call was successful
+*                              OS_ERR_CREATE_ISR              Can't create from an ISR
+*                              OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the channel after you
+*                                                               called OSSafetyCriticalStart()
+*                              OS_ERR_OBJ_PTR_NULL            If you passed a NULL pointer for 'p_icc'
+*                              OS_ERR_PTR_INVALID             If you passed a NULL pointer for 'p_shm' or 'p_doorbell'
+*                              OS_ERR_OBJ_CREATED             If the channel was already created
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSIccTxCreate (OS_ICC               *p_icc,
+                     CPU_CHAR             *p_name,
+                     OS_ICC_SHM           *p_shm,
+                     OS_ICC_DOORBELL_PTR   p_doorbell,
+                     void                 *p_arg,
+                     OS_ERR               *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_icc == (OS_ICC *)0) {                                 /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if ((p_shm      == (OS_ICC_SHM *)0) ||
+        (p_doorbell == (OS_ICC_DOORBELL_PTR)0)) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
+    if ((p_icc->Type == OS_OBJ_TYPE_ICC_TX) ||
+        (p_icc->Type == OS_OBJ_TYPE_ICC_RX)) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+    p_icc->Type        = OS_OBJ_TYPE_ICC_TX;                    /* Mark the data structure as a sending end             */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_icc->NamePtr     = p_name;
+#else
+    (void)p_name;
+#endif
+    p_icc->ShmPtr      = p_shm;
+    p_icc->DoorbellPtr = p_doorbell;
+    p_icc->DoorbellArg = p_arg;
+    p_icc->QPtr        = (OS_Q   *)0;
+    p_icc->TCBPtr      = (OS_TCB *)0;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                         CREATE THE RECEIVING END OF A CHANNEL
+*
+* Description: This function is called on the receiving core to create its end of an inter-core channel.  The
+*              messages received are handed to a local message queue or to the message queue of a local task.
+*
+* Arguments  : p_icc       is a pointer to the local end of the channel
+*
+*              p_name      is a pointer to an ASCII string that will be used to name the channel
+*
+*              p_shm       is a pointer to the shared part of the channel, initialized by OSIccShmInit()
+*
+*              p_q         is a pointer to the message queue that receives the messages, or a NULL pointer to use
+*                          the task message queue of 'p_tcb'
+*
+*              p_tcb       is a pointer to the task that receives the messages when 'p_q' is a NULL pointer
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                    The call was successful
+*                              OS_ERR_CREATE_ISR              Can't create from an ISR
+*                              OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the channel after you
+*                                                               called OSSafetyCriticalStart()
+*                              OS_ERR_OBJ_PTR_NULL            If you passed a NULL pointer for 'p_icc'
+*                              OS_ERR_PTR_INVALID             If you passed a NULL pointer for 'p_shm', or if you
+*                                                               did not specify exactly one of 'p_q' and 'p_tcb'
+*                              OS_ERR_OBJ_CREATED             If the channel was already created
+*
+* Returns    : none
+*
+* Note(s)    : 1) Posting to a message queue requires OS_CFG_Q_EN and posting to a task requires OS_CFG_TASK_Q_EN.
+************************************************************************************************************************
+*/
+
+void  OSIccRxCreate (OS_ICC      *p_icc,
+                     CPU_CHAR    *p_name,
+                     OS_ICC_SHM  *p_shm,
+                     OS_Q        *p_q,
+                     OS_TCB      *p_tcb,
+                     OS_ERR      *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_icc == (OS_ICC *)0) {                                 /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_shm == (OS_ICC_SHM *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    if (p_q != (OS_Q *)0) {                                     /* Exactly one destination, see Note #1                 */
+#if (OS_CFG_Q_EN == 0u)
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+#else
+        if (p_tcb != (OS_TCB *)0) {
+           *p_err = OS_ERR_PTR_INVALID;
+            return;
+        }
+#endif
+    } else {
+#if (OS_CFG_TASK_Q_EN == 0u)
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+#else
+        if (p_tcb == (OS_TCB *)0) {
+           *p_err = OS_ERR_PTR_INVALID;
+            return;
+        }
+#endif
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
+    if ((p_icc->Type == OS_OBJ_TYPE_ICC_TX) ||
+        (p_icc->Type == OS_OBJ_TYPE_ICC_RX)) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+    p_icc->Type        = OS_OBJ_TYPE_ICC_RX;                    /* Mark the data structure as a receiving end           */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_icc->NamePtr     = p_name;
+#else
+    (void)p_name;
+#endif
+    p_icc->ShmPtr      = p_shm;
+    p_icc->DoorbellPtr = (OS_ICC_DOORBELL_PTR)0;
+    p_icc->DoorbellArg = (void *)0;
+    p_icc->QPtr        = p_q;
+    p_icc->TCBPtr      = p_tcb;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                            POST A MESSAGE TO THE OTHER CORE
+*
+* Description: This function places a message pointer in an inter-core channel and, unless told otherwise, rings the
+*              doorbell of the receiving core.
+*
+* Arguments  : p_icc         is a pointer to the sending end of the channel
+*
+*              p_void        is a pointer to the message to send.  The message itself is not copied (see Note #2 at
+*                            the top of this file).
+*
+*              msg_size      specifies the size of the message (in bytes)
+*
+*              opt           determines the type of POST performed:
+*
+*                                OS_OPT_POST_NONE         Ring the doorbell of the receiving core
+*                                OS_OPT_POST_NO_SCHED     Do not ring the doorbell; more messages will follow and the
+*                                                         last post will ring it
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              The call was successful and the message was deposited
+*                                OS_ERR_OBJ_PTR_NULL      If 'p_icc' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE          If 'p_icc' is not the sending end of a channel
+*                                OS_ERR_OPT_INVALID       You specified an invalid option
+*                                OS_ERR_Q_FULL            If the channel is full; the message was not deposited
+*
+* Returns    : None
+*
+* Note(s)    : 1) This function can be called from tasks and ISRs of the sending core.  A short local critical section
+*                 serializes them; the receiving core is never locked out.
+************************************************************************************************************************
+*/
+
+void  OSIccPost (OS_ICC       *p_icc,
+                 void         *p_void,
+                 OS_MSG_SIZE   msg_size,
+                 OS_OPT        opt,
+                 OS_ERR       *p_err)
+{
+    OS_ICC_SHM  *p_shm;
+    OS_MSG_QTY   in_ix;
+    OS_MSG_QTY   out_ix;
+    OS_MSG_QTY   nbr_entries;
+    OS_MSG_QTY   ix;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_icc == (OS_ICC *)0) {                                 /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_icc->Type != OS_OBJ_TYPE_ICC_TX) {                    /* Make sure this is the sending end of a channel       */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    p_shm = p_icc->ShmPtr;
+    CPU_CRITICAL_ENTER();                                       /* Serialize the local senders only                     */
+    in_ix  = p_shm->InIx;
+    out_ix = p_shm->OutIx;
+    if (in_ix >= out_ix) {                                      /* Compute the number of messages in the channel        */
+        nbr_entries = in_ix - out_ix;
+    } else {
+        nbr_entries = (OS_MSG_QTY)((2u * p_shm->NbrMsgs) - out_ix) + in_ix;
+    }
+    if (nbr_entries >= p_shm->NbrMsgs) {                        /* Is the channel full?                                 */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_Q_FULL;
+        return;
+    }
+    OS_CPU_MEM_BARRIER();                                       /* The receiver is done with the slot we reuse          */
+
+    ix = (in_ix < p_shm->NbrMsgs) ? in_ix : (OS_MSG_QTY)(in_ix - p_shm->NbrMsgs);
+    p_shm->MsgTbl[ix].MsgPtr  = p_void;                         /* Fill the slot                                        */
+    p_shm->MsgTbl[ix].MsgSize = msg_size;
+    OS_CPU_MEM_BARRIER();                                       /* The slot is visible before the index                 */
+
+    in_ix++;                                                    /* Publish the message to the receiving core            */
+    if (in_ix == (OS_MSG_QTY)(2u * p_shm->NbrMsgs)) {
+        in_ix = 0u;
+    }
+    p_shm->InIx = in_ix;
+    OS_CPU_MEM_BARRIER();                                       /* The index is visible before the doorbell rings       */
+    CPU_CRITICAL_EXIT();
+
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        p_icc->DoorbellPtr(p_icc->DoorbellArg);                 /* Interrupt the receiving core                         */
+    }
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                        RECEIVE THE MESSAGES SENT BY THE OTHER CORE
+*
+* Description: This function is called on the receiving core, normally from the doorbell ISR, to hand the messages in
+*              an inter-core channel to the local message queue or task selected by OSIccRxCreate().
+*
+* Arguments  : p_icc         is a pointer to the receiving end of the channel
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              The channel was emptied
+*                                OS_ERR_OBJ_PTR_NULL      If 'p_icc' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE          If 'p_icc' is not the receiving end of a channel
+*
+*                            or the error returned by OSQPost() or OSTaskQPost() (OS_ERR_Q_MAX, OS_ERR_MSG_POOL_EMPTY,
+*                            ...) for the first message that could not be delivered.
+*
+* Returns    : The number of messages delivered.
+*
+* Note(s)    : 1) A message that cannot be delivered is left in the channel, as are the ones behind it, so that the
+*                 sending core sees the channel fill up.  Call this function again once the local queue has room.
+*
+*              2) Only ONE context of the receiving core may call this function for a given channel at a time.
+*
+*              3) When called from a task, the scheduler is run once after the messages are delivered.  From an ISR,
+*                 the rescheduling is done by OSIntExit().
+************************************************************************************************************************
+*/
+
+OS_MSG_QTY  OSIccRx (OS_ICC  *p_icc,
+                     OS_ERR  *p_err)
+{
+    OS_ICC_SHM   *p_shm;
+    OS_MSG_QTY    out_ix;
+    OS_MSG_QTY    ix;
+    OS_MSG_QTY    nbr_msgs;
+    void         *p_void;
+    OS_MSG_SIZE   msg_size;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_icc == (OS_ICC *)0) {                                 /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_icc->Type != OS_OBJ_TYPE_ICC_RX) {                    /* Make sure this is the receiving end of a channel     */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    p_shm    = p_icc->ShmPtr;
+    nbr_msgs = 0u;
+   *p_err    = OS_ERR_NONE;
+    out_ix   = p_shm->OutIx;
+    while (p_shm->InIx != out_ix) {                             /* Until the channel is empty                           */
+        OS_CPU_MEM_BARRIER();                                   /* Read the slot after the index that published it      */
+        ix       = (out_ix < p_shm->NbrMsgs) ? out_ix : (OS_MSG_QTY)(out_ix - p_shm->NbrMsgs);
+        p_void   = p_shm->MsgTbl[ix].MsgPtr;
+        msg_size = p_shm->MsgTbl[ix].MsgSize;
+
+#if (OS_CFG_Q_EN > 0u)
+        if (p_icc->QPtr != (OS_Q *)0) {
+            OSQPost(p_icc->QPtr,
+                    p_void,
+                    msg_size,
+                    (OS_OPT)(OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED),
+                    p_err);
+        }
+#endif
+#if (OS_CFG_TASK_Q_EN > 0u)
+        if (p_icc->TCBPtr != (OS_TCB *)0) {
+            OSTaskQPost(p_icc->TCBPtr,
+                        p_void,
+                        msg_size,
+                        (OS_OPT)(OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED),
+                        p_err);
+        }
+#endif
+        if (*p_err != OS_ERR_NONE) {                            /* See Note #1                                          */
+            break;
+        }
+
+        OS_CPU_MEM_BARRIER();                                   /* Done with the slot before it is handed back          */
+        out_ix++;                                               /* Return the slot to the sending core                  */
+        if (out_ix == (OS_MSG_QTY)(2u * p_shm->NbrMsgs)) {
+            out_ix = 0u;
+        }
+        p_shm->OutIx = out_ix;
+        nbr_msgs++;
+    }
+
+    if ((nbr_msgs > 0u) && (OSIntNestingCtr == 0u)) {           /* See Note #3                                          */
+        OSSched();
+    }
+    return (nbr_msgs);
+}
+#endif
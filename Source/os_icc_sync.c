@@ -0,0 +1,766 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                   INTER-CORE LOCK AND EVENT MANAGEMENT
+*
+* File    : os_icc_sync.c
+* Version : V3.08.00
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+* Note(s) : (1) The objects of this file synchronize kernel instances running on different cores (AMP) through one
+*               gate of a hardware semaphore or spinlock peripheral, described by an OS_ICC_HW supplied by your
+*               application:
+*
+*                   STM32H7 HSEM    'TryLock' is a 1-step read lock of HSEM_RLRx, 'NotifyEn' sets the bit of the
+*                                   semaphore in HSEM_CnIER; the free interrupt clears it before calling
+*                                   OSIccLockNotify().
+*                   i.MX RT SEMA4   'TryLock' writes the core number to the gate and reads it back, 'NotifyEn'
+*                                   enables the unlock notification of the gate.
+*                   RP2040 SIO      'TryLock' reads the spinlock register.  There is no release interrupt: leave
+*                                   'NotifyEn' NULL to retry on every tick, or have 'Unlock' ring the other core
+*                                   through the SIO FIFO and call OSIccLockNotify() from the FIFO interrupt.
+*
+*               Every lock and every event MUST have a gate of its own, and the gate MUST NOT be used by anything
+*               else.
+*
+*           (2) An inter-core lock is a local mutex plus the gate.  The local tasks queue up on the mutex with
+*               priority inheritance as usual, and only the owner of the mutex competes with the other core for the
+*               gate.  While the other core holds it, the owner waits on a local semaphore with OS_Pend(), posted by
+*               OSIccLockNotify() when the gate is freed, instead of polling with OSTimeDly().
+*
+*           (3) An inter-core event carries event flags from one core to a local event flag group of the other core.
+*               The flags are OR'ed into an OS_ICC_EVT_SHM under the gate and the doorbell of the receiving core is
+*               rung.  The doorbell ISR calls OSIccEvtRx(), which posts the flags to the group the local tasks wait on
+*               with OSFlagPend().  The gate is only held for a few instructions, with interrupts disabled.
+*
+*           (4) The shared memory must either be coherent between the two cores or be mapped non-cacheable.
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#define  OS_CRIT_SITE_ID                    OS_CRIT_SITE_ICC_SYNC
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_icc_sync__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_ICC_SYNC_EN > 0u)
+/*
+************************************************************************************************************************
+*                                         CREATE THE LOCAL END OF AN INTER-CORE LOCK
+*
+* Description: This function is called on each core to create its end of an inter-core lock.  Both ends use the same
+*              hardware gate.
+*
+* Arguments  : p_lock      is a pointer to the local end of the lock
+*
+*              p_name      is a pointer to an ASCII string that will be used to name the lock
+*
+*              p_hw        is a pointer to the description of the hardware gate (see Note #1 at the top of this file)
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                    The call was successful
+*                              OS_ERR_CREATE_ISR              Can't create from an ISR
+*                              OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the lock after you called
+*                                                               OSSafetyCriticalStart()
+*                              OS_ERR_OBJ_PTR_NULL            If you passed a NULL pointer for 'p_lock'
+*                              OS_ERR_PTR_INVALID             If 'p_hw', 'p_hw->TryLock' or 'p_hw->Unlock' is NULL
+*                              OS_ERR_OBJ_CREATED             If the lock was already created
+*
+* Returns    : none
+*
+* Note(s)    : 1) '*p_hw' is referred to until the lock is no longer used and MUST NOT be on the stack.
+************************************************************************************************************************
+*/
+
+void  OSIccLockCreate (OS_ICC_LOCK      *p_lock,
+                       CPU_CHAR         *p_name,
+                       const  OS_ICC_HW *p_hw,
+                       OS_ERR           *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_lock == (OS_ICC_LOCK *)0) {                           /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if ((p_hw          == (const OS_ICC_HW *)0) ||
+        (p_hw->TryLock == (OS_ICC_HW_TRY_LOCK_PTR)0) ||
+        (p_hw->Unlock  == (OS_ICC_HW_UNLOCK_PTR)0)) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_OBJ_TYPE_REQ > 0u)
+#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
+    CPU_CRITICAL_ENTER();
+    if (p_lock->Type == OS_OBJ_TYPE_ICC_LOCK) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+    CPU_CRITICAL_EXIT();
+#endif
+#endif
+
+    OSMutexCreate(&p_lock->Mutex, p_name, p_err);               /* Local side of the lock (see Note #2)                 */
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+    OSSemCreate(&p_lock->Sem, p_name, 0u, p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_lock->Type    = OS_OBJ_TYPE_ICC_LOCK;                     /* Mark the data structure as an inter-core lock        */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_lock->NamePtr = p_name;
+#endif
+    p_lock->HwPtr   = p_hw;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+************************************************************************************************************************
+*                                        SIGNAL THAT THE OTHER CORE FREED THE GATE
+*
+* Description: This function is called from the interrupt raised on this core when the other core frees the gate of
+*              an inter-core lock (see 'NotifyEn').  It wakes up the local task waiting for the gate, if any.
+*
+* Arguments  : p_lock      is a pointer to the local end of the lock
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE              The call was successful
+*                              OS_ERR_OBJ_PTR_NULL      If 'p_lock' is a NULL pointer
+*                              OS_ERR_OBJ_TYPE          If 'p_lock' is not pointing at an inter-core lock
+*
+* Returns    : none
+*
+* Note(s)    : 1) The notification only makes the waiting task try the gate again, a notification that comes late or
+*                 twice costs one more attempt.  The semaphore saturating is therefore not reported.
+************************************************************************************************************************
+*/
+
+void  OSIccLockNotify (OS_ICC_LOCK  *p_lock,
+                       OS_ERR       *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_lock == (OS_ICC_LOCK *)0) {                           /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_lock->Type != OS_OBJ_TYPE_ICC_LOCK) {                 /* Make sure lock was created                           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    (void)OSSemPost(&p_lock->Sem, OS_OPT_POST_1, p_err);
+    if (*p_err == OS_ERR_SEM_OVF) {                             /* See Note #1                                          */
+       *p_err = OS_ERR_NONE;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                               ACQUIRE AN INTER-CORE LOCK
+*
+* Description: This function waits until the local end of the lock and the hardware gate are both available.
+*
+* Arguments  : p_lock      is a pointer to the local end of the lock
+*
+*              timeout     is an optional timeout period (in clock ticks), covering both waits.  If non-zero, your task
+*                          will wait for the lock up to the amount of time specified by this argument.  If you
+*                          specify 0, however, your task will wait forever for the lock.
+*
+*              opt         determines whether the user wants to block if the lock is not available or not:
+*
+*                              OS_OPT_PEND_BLOCKING
+*                              OS_OPT_PEND_NON_BLOCKING
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE              The call was successful and your task owns the lock
+*                              OS_ERR_MUTEX_OWNER       If the calling task already owns the lock (see Note #2)
+*                              OS_ERR_OBJ_PTR_NULL      If 'p_lock' is a NULL pointer
+*                              OS_ERR_OBJ_TYPE          If 'p_lock' is not pointing at an inter-core lock
+*                              OS_ERR_OPT_INVALID       If you didn't specify a valid option
+*                              OS_ERR_PEND_ISR          If you called this function from an ISR
+*                              OS_ERR_PEND_WOULD_BLOCK  If you specified non-blocking and the lock was not available
+*                              OS_ERR_TIMEOUT           The lock was not received within the specified timeout
+*
+*                          or the error returned by OSMutexPend() or OSSemPend() when the wait was aborted.
+*
+* Returns    : none
+*
+* Note(s)    : 1) The interrupt is enabled before the gate is tried a second time, so that a gate freed in between
+*                 isn't missed.  When 'NotifyEn' is NULL, the gate is tried again on every tick.
+*
+*              2) The lock doesn't nest.  The hardware gate has no owner count.
+************************************************************************************************************************
+*/
+
+void  OSIccLockPend (OS_ICC_LOCK  *p_lock,
+                     OS_TICK       timeout,
+                     OS_OPT        opt,
+                     OS_ERR       *p_err)
+{
+    const  OS_ICC_HW  *p_hw;
+    OS_TICK            tick_start;
+    OS_TICK            tick_elapsed;
+    OS_TICK            dly;
+    OS_ERR             err;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_PEND_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_lock == (OS_ICC_LOCK *)0) {                           /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_lock->Type != OS_OBJ_TYPE_ICC_LOCK) {                 /* Make sure lock was created                           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    p_hw       = p_lock->HwPtr;
+    tick_start = OSTimeGet(&err);
+    OSMutexPend(&p_lock->Mutex, timeout, opt, (CPU_TS *)0, p_err);
+    if (*p_err == OS_ERR_MUTEX_OWNER) {                         /* Undo the nesting (see Note #2)                       */
+        OSMutexPost(&p_lock->Mutex, OS_OPT_POST_NONE, &err);
+        return;
+    }
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+    for (;;) {
+        if (p_hw->TryLock(p_hw->Arg) == OS_TRUE) {
+           *p_err = OS_ERR_NONE;
+            return;
+        }
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {
+           *p_err = OS_ERR_PEND_WOULD_BLOCK;
+            break;
+        }
+        dly = 0u;
+        if (timeout > 0u) {                                     /* Wait for what is left of the timeout                 */
+            tick_elapsed = OSTimeGet(&err) - tick_start;
+            if (tick_elapsed >= timeout) {
+               *p_err = OS_ERR_TIMEOUT;
+                break;
+            }
+            dly = timeout - tick_elapsed;
+        }
+        if (p_hw->NotifyEn != (OS_ICC_HW_NOTIFY_EN_PTR)0) {     /* See Note #1                                          */
+            p_hw->NotifyEn(p_hw->Arg);
+            if (p_hw->TryLock(p_hw->Arg) == OS_TRUE) {
+               *p_err = OS_ERR_NONE;
+                return;
+            }
+        } else {
+            dly = 1u;
+        }
+        (void)OSSemPend(&p_lock->Sem, dly, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        if ((err != OS_ERR_NONE) &&
+            (err != OS_ERR_TIMEOUT)) {                          /* Wait aborted or lock deleted                         */
+           *p_err = err;
+            break;
+        }
+    }
+
+    OSMutexPost(&p_lock->Mutex, OS_OPT_POST_NONE, &err);        /* Let the next local task have a go                    */
+}
+
+
+/*
+************************************************************************************************************************
+*                                               RELEASE AN INTER-CORE LOCK
+*
+* Description: This function frees the hardware gate, then the local end of the lock.
+*
+* Arguments  : p_lock      is a pointer to the local end of the lock
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE              The call was successful
+*                              OS_ERR_MUTEX_NOT_OWNER   If the calling task doesn't own the lock
+*                              OS_ERR_OBJ_PTR_NULL      If 'p_lock' is a NULL pointer
+*                              OS_ERR_OBJ_TYPE          If 'p_lock' is not pointing at an inter-core lock
+*                              OS_ERR_POST_ISR          If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSIccLockPost (OS_ICC_LOCK  *p_lock,
+                     OS_ERR       *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_POST_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_lock == (OS_ICC_LOCK *)0) {                           /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_lock->Type != OS_OBJ_TYPE_ICC_LOCK) {                 /* Make sure lock was created                           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    if (p_lock->Mutex.OwnerTCBPtr != OSTCBCurPtr) {             /* Only the owner frees the gate                        */
+       *p_err = OS_ERR_MUTEX_NOT_OWNER;
+        return;
+    }
+
+    p_lock->HwPtr->Unlock(p_lock->HwPtr->Arg);                  /* The other core may take it from here                 */
+    OSMutexPost(&p_lock->Mutex, OS_OPT_POST_NONE, p_err);
+}
+
+
+#if (OS_CFG_FLAG_EN > 0u)
+/*
+************************************************************************************************************************
+*                                      INITIALIZE THE SHARED PART OF AN INTER-CORE EVENT
+*
+* Description: This function clears the part of an inter-core event that lives in shared memory.  It must be called by
+*              ONE of the two cores, before either core posts to the event.
+*
+* Arguments  : p_shm       is a pointer to the shared part of the event
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE              The call was successful
+*                              OS_ERR_OBJ_PTR_NULL      If you passed a NULL pointer for 'p_shm'
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSIccEvtShmInit (OS_ICC_EVT_SHM  *p_shm,
+                       OS_ERR          *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_shm == (OS_ICC_EVT_SHM *)0) {                         /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+    p_shm->Flags = 0u;
+    OS_CPU_MEM_BARRIER();                                       /* Make the event visible to the other core             */
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                        CREATE THE LOCAL END OF AN INTER-CORE EVENT
+*
+* Description: This function is called on each core to create its end of an inter-core event.  The core that posts
+*              supplies a doorbell, the core that receives supplies the event flag group its tasks wait on.  A core
+*              may do both.
+*
+* Arguments  : p_evt       is a pointer to the local end of the event
+*
+*              p_name      is a pointer to an ASCII string that will be used to name the event
+*
+*              p_shm       is a pointer to the shared part of the event, initialized by OSIccEvtShmInit()
+*
+*              p_hw        is a pointer to the description of the hardware gate protecting '*p_shm'.  Only
+*                          'TryLock' and 'Unlock' are used.
+*
+*              p_grp       is a pointer to the local event flag group, or a NULL pointer if this core doesn't receive
+*
+*              p_doorbell  is a pointer to a function that interrupts the receiving core, or a NULL pointer if this
+*                          core doesn't post.  It is called with 'p_arg' after flags are posted.
+*
+*              p_arg       is the argument passed to 'p_doorbell'
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                    The call was successful
+*                              OS_ERR_CREATE_ISR              Can't create from an ISR
+*                              OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the event after you called
+*                                                               OSSafetyCriticalStart()
+*                              OS_ERR_OBJ_PTR_NULL            If you passed a NULL pointer for 'p_evt'
+*                              OS_ERR_PTR_INVALID             If 'p_shm' or 'p_hw' is invalid, or if both 'p_grp' and
+*                                                               'p_doorbell' are NULL pointers
+*                              OS_ERR_OBJ_CREATED             If the event was already created
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSIccEvtCreate (OS_ICC_EVT           *p_evt,
+                      CPU_CHAR             *p_name,
+                      OS_ICC_EVT_SHM       *p_shm,
+                      const  OS_ICC_HW     *p_hw,
+                      OS_FLAG_GRP          *p_grp,
+                      OS_ICC_DOORBELL_PTR   p_doorbell,
+                      void                 *p_arg,
+                      OS_ERR               *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_evt == (OS_ICC_EVT *)0) {                             /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if ((p_shm         == (OS_ICC_EVT_SHM *)0) ||
+        (p_hw          == (const OS_ICC_HW *)0) ||
+        (p_hw->TryLock == (OS_ICC_HW_TRY_LOCK_PTR)0) ||
+        (p_hw->Unlock  == (OS_ICC_HW_UNLOCK_PTR)0)) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    if ((p_grp      == (OS_FLAG_GRP *)0) &&                     /* Must post, receive or both                           */
+        (p_doorbell == (OS_ICC_DOORBELL_PTR)0)) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
+    if (p_evt->Type == OS_OBJ_TYPE_ICC_EVT) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+    p_evt->Type        = OS_OBJ_TYPE_ICC_EVT;                   /* Mark the data structure as an inter-core event       */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_evt->NamePtr     = p_name;
+#else
+    (void)p_name;
+#endif
+    p_evt->ShmPtr      = p_shm;
+    p_evt->HwPtr       = p_hw;
+    p_evt->DoorbellPtr = p_doorbell;
+    p_evt->DoorbellArg = p_arg;
+    p_evt->GrpPtr      = p_grp;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                          POST EVENT FLAGS TO THE OTHER CORE
+*
+* Description: This function sets event flags in an inter-core event and, unless told otherwise, rings the doorbell
+*              of the receiving core.
+*
+* Arguments  : p_evt         is a pointer to the local end of the event
+*
+*              flags         is a bit pattern indicating which bit(s) to set in the event flag group of the other core
+*
+*              opt           determines the type of POST performed:
+*
+*                                OS_OPT_POST_NONE         Ring the doorbell of the receiving core
+*                                OS_OPT_POST_NO_SCHED     Do not ring the doorbell; more flags will follow and the
+*                                                         last post will ring it
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              The call was successful
+*                                OS_ERR_OBJ_PTR_NULL      If 'p_evt' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE          If 'p_evt' is not pointing at an inter-core event
+*                                OS_ERR_OPT_INVALID       You specified an invalid option
+*                                OS_ERR_PTR_INVALID       If this end of the event was created without a doorbell
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function can be called from tasks and ISRs.  Flags posted before the other core received them
+*                 are merged, as with OSFlagPost().
+************************************************************************************************************************
+*/
+
+void  OSIccEvtPost (OS_ICC_EVT  *p_evt,
+                    OS_FLAGS     flags,
+                    OS_OPT       opt,
+                    OS_ERR      *p_err)
+{
+    const  OS_ICC_HW  *p_hw;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_evt == (OS_ICC_EVT *)0) {                             /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_evt->Type != OS_OBJ_TYPE_ICC_EVT) {                   /* Make sure event was created                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_evt->DoorbellPtr == (OS_ICC_DOORBELL_PTR)0) {         /* This end only receives                               */
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+#endif
+
+    p_hw = p_evt->HwPtr;
+    CPU_CRITICAL_ENTER();                                       /* Hold the gate as briefly as possible                 */
+    while (p_hw->TryLock(p_hw->Arg) == OS_FALSE) {
+        OS_CPU_SPIN_PAUSE();
+    }
+    OS_CPU_MEM_BARRIER();                                       /* Read the flags after taking the gate                 */
+    p_evt->ShmPtr->Flags |= flags;
+    OS_CPU_MEM_BARRIER();                                       /* The flags are visible before the gate is freed       */
+    p_hw->Unlock(p_hw->Arg);
+    CPU_CRITICAL_EXIT();
+
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        p_evt->DoorbellPtr(p_evt->DoorbellArg);                 /* Interrupt the receiving core                         */
+    }
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                      RECEIVE THE EVENT FLAGS POSTED BY THE OTHER CORE
+*
+* Description: This function is called on the receiving core, normally from the doorbell ISR, to post the flags set
+*              by the other core to the local event flag group selected by OSIccEvtCreate().
+*
+* Arguments  : p_evt         is a pointer to the local end of the event
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              The call was successful
+*                                OS_ERR_OBJ_PTR_NULL      If 'p_evt' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE          If 'p_evt' is not pointing at an inter-core event
+*                                OS_ERR_PTR_INVALID       If this end of the event was created without a group
+*
+*                            or the error returned by OSFlagPost().
+*
+* Returns    : The flags received, 0 if none.
+*
+* Note(s)    : 1) The flags are cleared in shared memory as they are taken; they are set in the local group and stay set
+*                 until the local tasks consume them.
+************************************************************************************************************************
+*/
+
+OS_FLAGS  OSIccEvtRx (OS_ICC_EVT  *p_evt,
+                      OS_ERR      *p_err)
+{
+    const  OS_ICC_HW  *p_hw;
+    OS_FLAGS           flags;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_evt == (OS_ICC_EVT *)0) {                             /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_evt->Type != OS_OBJ_TYPE_ICC_EVT) {                   /* Make sure event was created                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_evt->GrpPtr == (OS_FLAG_GRP *)0) {                    /* This end only posts                                  */
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+#endif
+
+    p_hw = p_evt->HwPtr;
+    CPU_CRITICAL_ENTER();
+    while (p_hw->TryLock(p_hw->Arg) == OS_FALSE) {
+        OS_CPU_SPIN_PAUSE();
+    }
+    OS_CPU_MEM_BARRIER();
+    flags                = p_evt->ShmPtr->Flags;                /* Take the flags (see Note #1)                         */
+    p_evt->ShmPtr->Flags = 0u;
+    OS_CPU_MEM_BARRIER();
+    p_hw->Unlock(p_hw->Arg);
+    CPU_CRITICAL_EXIT();
+
+    if (flags == 0u) {                                          /* Spurious or already received                         */
+       *p_err = OS_ERR_NONE;
+        return (0u);
+    }
+    (void)OSFlagPost(p_evt->GrpPtr, flags, OS_OPT_POST_FLAG_SET, p_err);
+    return (flags);
+}
+#endif
+#endif
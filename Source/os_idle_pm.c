@@ -0,0 +1,341 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        IDLE POWER MANAGEMENT
+*
+* File    : os_idle_pm.c
+* Version : V3.08.00
+*********************************************************************************************************
+*/
+
+#define   MICRIUM_SOURCE
+#define   OS_CRIT_SITE_ID                   OS_CRIT_SITE_IDLE_PM
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_idle_pm__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_TASK_IDLE_PM_EN > 0u)
+
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  OS_IdlePMDlyGet (CPU_TS   ts_now,
+                                      CPU_TS  *p_dly);
+
+
+/*
+************************************************************************************************************************
+*                                                REGISTER A SLEEP STATE
+*
+* Description: This function is called by your application to register a sleep state of the platform.  The idle task
+*              enters the deepest registered state that it has time to enter and leave before the next kernel deadline.
+*
+* Arguments  : p_state     is a pointer to the sleep state.  The structure must stay valid as long as the kernel runs.
+*
+*              p_name      is a pointer to an ASCII string to provide a name to the sleep state.
+*
+*              p_fnct      is a pointer to the function that enters the state (see Note #2).
+*
+*              entry_lat   is the time it takes to enter the state, in OS_TS_GET() units.
+*
+*              exit_lat    is the time it takes, once the wake-up event occurs, until the CPU runs code again, in
+*                          OS_TS_GET() units.  The depth of the states is given by this latency.
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                     The state was registered
+*                              OS_ERR_CREATE_ISR               If you called this function from an ISR
+*                              OS_ERR_IDLE_PM_STATE_DUP        If 'p_state' is already registered
+*                              OS_ERR_ILLEGAL_CREATE_RUN_TIME  If you are trying to register the state after you called
+*                                                                OSSafetyCriticalStart()
+*                              OS_ERR_PTR_INVALID              If 'p_state' or 'p_fnct' is a NULL pointer
+*
+* Returns    : none
+*
+* Note(s)    : 1) The states are kept sorted by 'exit_lat', so they can be registered in any order.
+*
+*              2) 'p_fnct' is called by the idle task with interrupts disabled and with:
+*
+*                     p_fnct(p_state, dly);
+*
+*                 It must put the CPU in the state so that a pending interrupt wakes it up, even though interrupts are
+*                 disabled (e.g. WFI on Cortex-M), and return with interrupts still disabled; the interrupt is then
+*                 serviced when the idle task enables them again.  'dly' is the number of OS_TS_GET() counts after
+*                 which the wake-up must start, already reduced by the exit latency, or 0 if no kernel deadline is
+*                 pending.  A state that stops the timer used by OS_DynTickSet() or OS_TickHrSet() must arm a wake-up
+*                 source of its own for 'dly' and keep OS_DynTickGet() and OS_TS_GET() consistent across the sleep.
+************************************************************************************************************************
+*/
+
+void  OSIdlePMStateAdd (OS_IDLE_PM_STATE  *p_state,
+                        CPU_CHAR          *p_name,
+                        OS_IDLE_PM_FNCT    p_fnct,
+                        CPU_TS             entry_lat,
+                        CPU_TS             exit_lat,
+                        OS_ERR            *p_err)
+{
+    OS_IDLE_PM_STATE  *p_state_prev;
+    OS_IDLE_PM_STATE  *p_state_next;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to register a state from an ISR          */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if ((p_state == (OS_IDLE_PM_STATE *)0) ||                   /* Validate the state and its entry function            */
+        (p_fnct  == (OS_IDLE_PM_FNCT   )0)) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_state_prev = (OS_IDLE_PM_STATE *)0;
+    p_state_next = OSIdlePMStateListPtr;
+    while (p_state_next != (OS_IDLE_PM_STATE *)0) {             /* Find the first deeper state (see Note #1)            */
+        if (p_state_next == p_state) {
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_IDLE_PM_STATE_DUP;
+            return;
+        }
+        if (p_state_next->ExitLat > exit_lat) {
+            break;
+        }
+        p_state_prev = p_state_next;
+        p_state_next = p_state_next->NextPtr;
+    }
+
+    p_state->NamePtr     = p_name;
+    p_state->EnterFnct   = p_fnct;
+    p_state->EntryLat    = entry_lat;
+    p_state->ExitLat     = exit_lat;
+    p_state->ExitLatMeas = exit_lat;
+    p_state->EntryCtr    = 0u;
+    p_state->NextPtr     = p_state_next;
+    if (p_state_prev == (OS_IDLE_PM_STATE *)0) {
+        OSIdlePMStateListPtr  = p_state;
+    } else {
+        p_state_prev->NextPtr = p_state;
+    }
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                           INITIALIZE IDLE POWER MANAGEMENT
+*
+* Description: This function is called by OSInit() to empty the list of sleep states.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_IdlePMInit (void)
+{
+    OSIdlePMStateListPtr = (OS_IDLE_PM_STATE *)0;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              ENTER THE DEEPEST SLEEP STATE
+*
+* Description: This function is called by the idle task on every pass.  It finds the time left before the next kernel
+*              deadline, enters the deepest sleep state whose entry and exit latencies fit in it and, on wake-up, updates
+*              the measured exit latency of the state.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The exit latency is measured only when the CPU runs again after the wake-up deadline given to the
+*                 state: an earlier wake-up was caused by another interrupt and says nothing about the latency.
+*
+*              3) The CPU sleeps with interrupts disabled, so the sleep is counted as a critical section of this module
+*                 by OS_CFG_CRIT_SECTION_PROFILE_EN.
+************************************************************************************************************************
+*/
+
+void  OS_IdlePMSleep (void)
+{
+    OS_IDLE_PM_STATE  *p_state;
+    OS_IDLE_PM_STATE  *p_state_sel;
+    CPU_TS             ts_now;
+    CPU_TS             ts_wake;
+    CPU_TS             dly;
+    CPU_TS             lat;
+    CPU_BOOLEAN        dly_valid;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    if (OSPrioHighRdy != (OS_CFG_PRIO_MAX - 1u)) {              /* A task was made ready, don't sleep                   */
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+
+    ts_now      = OS_TS_GET();
+    dly_valid   = OS_IdlePMDlyGet(ts_now, &dly);
+    p_state_sel = (OS_IDLE_PM_STATE *)0;
+    p_state     = OSIdlePMStateListPtr;
+    while (p_state != (OS_IDLE_PM_STATE *)0) {                  /* Deepest state that has the time to wake up           */
+        lat = p_state->EntryLat + p_state->ExitLatMeas;
+        if ((dly_valid == OS_TRUE) &&
+            ((lat < p_state->EntryLat) || (lat >= dly))) {
+            break;
+        }
+        p_state_sel = p_state;
+        p_state     = p_state->NextPtr;
+    }
+    if (p_state_sel == (OS_IDLE_PM_STATE *)0) {                 /* Not enough time to enter any state                   */
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+
+    p_state_sel->EntryCtr++;
+    if (dly_valid == OS_TRUE) {
+        dly     = dly - p_state_sel->ExitLatMeas;               /* Start waking up early enough                         */
+        ts_wake = ts_now + dly;
+        p_state_sel->EnterFnct(p_state_sel, dly);
+        lat     = OS_TS_GET() - ts_wake;
+        if (lat <= OS_TICK_HR_DLY_MAX) {                        /* See Note #2                                          */
+            if (lat >= p_state_sel->ExitLatMeas) {
+                p_state_sel->ExitLatMeas += (lat - p_state_sel->ExitLatMeas) >> OS_IDLE_PM_LAT_SHIFT;
+            } else {
+                p_state_sel->ExitLatMeas -= (p_state_sel->ExitLatMeas - lat) >> OS_IDLE_PM_LAT_SHIFT;
+            }
+        }
+    } else {
+        p_state_sel->EnterFnct(p_state_sel, 0u);                /* Only an interrupt can wake the CPU up                */
+    }
+    CPU_CRITICAL_EXIT();                                        /* Service the interrupt that woke the CPU up           */
+}
+
+
+/*
+************************************************************************************************************************
+*                                         GET THE TIME TO THE NEXT KERNEL DEADLINE
+*
+* Description: This function finds the time left before the earliest of the next dynamic tick, which covers the tick
+*              list and the timer tasks, and of the next high-resolution deadline (OS_CFG_TIME_HR_EN).
+*
+* Arguments  : ts_now      is the current value of OS_TS_GET()
+*
+*              p_dly       is a pointer to where the time left is stored, in OS_TS_GET() units
+*
+* Returns    : OS_TRUE     if a deadline is pending,
+*              OS_FALSE    if only an interrupt can make a task ready.
+*
+* Note(s)    : 1) This function is called with interrupts disabled.
+*
+*              2) OS_DynTickGet() only counts whole ticks, so the current tick is assumed to end now.  The time left is
+*                 0 when the timestamp frequency is not known yet.
+************************************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  OS_IdlePMDlyGet (CPU_TS   ts_now,
+                                      CPU_TS  *p_dly)
+{
+    CPU_TS_TMR_FREQ  freq;
+    CPU_ERR          err;
+    CPU_INT64U       cnts;
+    OS_TICK          ticks;
+    CPU_TS           dly;
+    CPU_BOOLEAN      valid;
+#if (OS_CFG_TIME_HR_EN > 0u)
+    CPU_TS           match;
+#endif
+
+
+    dly   = 0u;
+    valid = OS_FALSE;
+    if (OSTickCtrStep > 0u) {                                   /* Next dynamic tick                                    */
+        freq = CPU_TS_TmrFreqGet(&err);
+        if (err != CPU_ERR_NONE) {
+           *p_dly = 0u;
+            return (OS_TRUE);
+        }
+        ticks = OSTickCtrStep - OS_DynTickGet();
+        if ((ticks >  0u) &&
+            (ticks <= OSTickCtrStep)) {
+            ticks--;                                            /* See Note #2                                          */
+        } else {
+            ticks = 0u;
+        }
+        cnts = ((CPU_INT64U)ticks * (CPU_INT64U)freq) / (CPU_INT64U)OSCfg_TickRate_Hz;
+        if (cnts > (CPU_INT64U)OS_TICK_HR_DLY_MAX) {
+            cnts = (CPU_INT64U)OS_TICK_HR_DLY_MAX;
+        }
+        dly   = (CPU_TS)cnts;
+        valid = OS_TRUE;
+    }
+
+#if (OS_CFG_TIME_HR_EN > 0u)
+    if (OS_TickHrNextGet(&match) == OS_TRUE) {                  /* Next high-resolution deadline, when earlier          */
+        match -= ts_now;
+        if (match > OS_TICK_HR_DLY_MAX) {                       /* Already due                                          */
+            match = 0u;
+        }
+        if ((valid == OS_FALSE) ||
+            (match <  dly)) {
+            dly   = match;
+            valid = OS_TRUE;
+        }
+    }
+#else
+    (void)ts_now;
+#endif
+
+   *p_dly = dly;
+    return (valid);
+}
+#endif
@@ -0,0 +1,332 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        DEFERRED ISR POST MANAGEMENT
+*
+* File    : os_int.c
+* Version : V3.08.00
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+* Note(s) : (1) When OS_CFG_ISR_POST_DEFERRED_EN is set to 1, OSSemPost(), OSQPost(), OSFlagPost(), OSTaskQPost()
+*               and OSTaskSemPost() do not touch the pend lists or the ready list when they are called from an
+*               ISR.  Instead, the arguments of the post are copied into the next free entry of OSCfg_IntQ[] and
+*               the 'ISR Handler Task' performs the post on behalf of the ISR.  Interrupts are disabled for the
+*               time it takes to copy one entry, whatever the number of tasks waiting on the object.
+*
+*           (2) The ISR Handler Task processes the entries in the order they were queued.  It should be given a
+*               priority higher than that of any task readied from an ISR (see OS_CFG_INT_Q_TASK_PRIO).
+*
+*           (3) The timestamp recorded by a deferred post is the time at which the ISR Handler Task performed it.
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#define  OS_CRIT_SITE_ID                    OS_CRIT_SITE_INT
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_int__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+/*
+************************************************************************************************************************
+*                                          INITIALIZE THE ISR HANDLER TASK
+*
+* Description: This function is called by OSInit() to empty the ISR queue and to create the ISR Handler Task.
+*
+* Arguments  : p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE
+*                             OS_ERR_INT_Q_SIZE              If OS_CFG_INT_Q_SIZE is less than 2
+*                             OS_ERR_INT_Q_STK_INVALID       If you didn't specify a stack for the ISR handler task
+*                             OS_ERR_INT_Q_STK_SIZE_INVALID  If you didn't allocate enough space for its stack
+*                             OS_ERR_INT_Q_PRIO_INVALID      If you specified the priority of the idle task
+*                             OS_ERR_xxx                     Any error code returned by OSTaskCreate()
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_IntQInit (OS_ERR  *p_err)
+{
+    if ((OSCfg_IntQBasePtr == (OS_INT_Q *)0) ||                 /* ------------- VALIDATE THE ISR QUEUE --------------- */
+        (OSCfg_IntQSize    <  2u)) {
+       *p_err = OS_ERR_INT_Q_SIZE;
+        return;
+    }
+
+    OSIntQInIx          = 0u;                                   /* Create an empty ISR queue                            */
+    OSIntQOutIx         = 0u;
+    OSIntQNbrEntries    = 0u;
+    OSIntQNbrEntriesMax = 0u;
+    OSIntQOvfCtr        = 0u;
+                                                                /* ----------- CREATE THE ISR HANDLER TASK ------------ */
+    if (OSCfg_IntQTaskStkBasePtr == (CPU_STK *)0) {
+       *p_err = OS_ERR_INT_Q_STK_INVALID;
+        return;
+    }
+
+    if (OSCfg_IntQTaskStkSize < OSCfg_StkSizeMin) {
+       *p_err = OS_ERR_INT_Q_STK_SIZE_INVALID;
+        return;
+    }
+
+    if (OSCfg_IntQTaskPrio >= (OS_CFG_PRIO_MAX - 1u)) {
+       *p_err = OS_ERR_INT_Q_PRIO_INVALID;
+        return;
+    }
+
+    OSTaskCreate(&OSIntQTaskTCB,
+#if  (OS_CFG_DBG_EN == 0u)
+                 (CPU_CHAR *)0,
+#else
+                 (CPU_CHAR *)"uC/OS-III ISR Queue Handler Task",
+#endif
+                  OS_IntQTask,
+                 (void     *)0,
+                  OSCfg_IntQTaskPrio,
+                  OSCfg_IntQTaskStkBasePtr,
+                  OSCfg_IntQTaskStkLimit,
+                  OSCfg_IntQTaskStkSize,
+                  0u,
+                  0u,
+                 (void     *)0,
+                 (OS_OPT_TASK_STK_CHK | (OS_OPT)(OS_OPT_TASK_STK_CLR | OS_OPT_TASK_NO_TLS)),
+                  p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                          QUEUE A POST ISSUED BY AN ISR
+*
+* Description: This function is called by the OSxxxPost() services when they are invoked from an ISR.  The post is
+*              recorded in the ISR queue and is performed later by the ISR Handler Task.
+*
+* Arguments  : type       is the type of object being posted to:
+*
+*                             OS_OBJ_TYPE_FLAG         OSFlagPost()
+*                             OS_OBJ_TYPE_Q            OSQPost()
+*                             OS_OBJ_TYPE_SEM          OSSemPost()
+*                             OS_OBJ_TYPE_TASK_MSG     OSTaskQPost()
+*                             OS_OBJ_TYPE_TASK_SIGNAL  OSTaskSemPost()
+*
+*              p_obj      is a pointer to the object (or to the OS_TCB of the task) being posted to
+*
+*              p_void     is the message being posted (message queues only)
+*
+*              msg_size   is the size of the message in bytes (message queues only)
+*
+*              flags      is the set of flags to set or clear (event flags only)
+*
+*              opt        is the option that was passed to the OSxxxPost() service
+*
+*              p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE         The post was queued
+*                             OS_ERR_INT_Q_FULL   The ISR queue is full, the post is lost
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The ISR Handler Task is only signaled when the entry is the first one in the queue.  Signaling it
+*                 never involves more than one task, so the time spent with interrupts disabled is fixed.
+************************************************************************************************************************
+*/
+
+void  OS_IntQPost (OS_OBJ_TYPE   type,
+                   void         *p_obj,
+                   void         *p_void,
+                   OS_MSG_SIZE   msg_size,
+                   OS_FLAGS      flags,
+                   OS_OPT        opt,
+                   OS_ERR       *p_err)
+{
+    OS_INT_Q  *p_entry;
+    CPU_TS     ts;
+    CPU_SR_ALLOC();
+
+
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (OSIntQNbrEntries >= OSCfg_IntQSize) {                   /* Make sure the ISR queue is not full                  */
+        OSIntQOvfCtr++;
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_INT_Q_FULL;
+        return;
+    }
+
+    p_entry          = &OSCfg_IntQBasePtr[OSIntQInIx];          /* Record the post                                      */
+    p_entry->Type    =  type;
+    p_entry->ObjPtr  =  p_obj;
+    p_entry->MsgPtr  =  p_void;
+    p_entry->MsgSize =  msg_size;
+    p_entry->Flags   =  flags;
+    p_entry->Opt     =  opt;
+
+    OSIntQInIx++;
+    if (OSIntQInIx >= OSCfg_IntQSize) {                         /* Wrap around                                          */
+        OSIntQInIx = 0u;
+    }
+    OSIntQNbrEntries++;
+    if (OSIntQNbrEntriesMax < OSIntQNbrEntries) {               /* Keep track of the peak number of entries             */
+        OSIntQNbrEntriesMax = OSIntQNbrEntries;
+    }
+
+    if (OSIntQNbrEntries == 1u) {                               /* Wake up the ISR Handler Task (See Note #2)           */
+        if (OSIntQTaskTCB.PendOn == OS_TASK_PEND_ON_TASK_SEM) {
+            OS_Post((OS_PEND_OBJ *)0,
+                    &OSIntQTaskTCB,
+                    (void *)0,
+                    0u,
+                    ts);
+        } else {
+            OSIntQTaskTCB.SemCtr++;
+        }
+    }
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                ISR HANDLER TASK
+*
+* Description: This task is created by OS_IntQInit().  It performs the posts queued by OS_IntQPost().
+*
+* Arguments  : p_arg      is an argument passed to the task when the task is created (unused).
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Every entry is posted with OS_OPT_POST_NO_SCHED and the scheduler is run once the queue has been
+*                 emptied, so a burst of interrupts results in a single pass through the scheduler.
+*
+*              3) Errors returned by the deferred posts are ignored since there is no ISR left to report them to.
+************************************************************************************************************************
+*/
+
+void  OS_IntQTask (void  *p_arg)
+{
+    OS_INT_Q  entry;
+    OS_ERR    err;
+    CPU_SR_ALLOC();
+
+
+    (void)p_arg;                                                /* Prevent compiler warning                             */
+
+    for (;;) {
+        (void)OSTaskSemPend(0u,                                 /* Wait for an ISR to queue a post                      */
+                            OS_OPT_PEND_BLOCKING,
+                            (CPU_TS *)0,
+                            &err);
+
+        for (;;) {
+            CPU_CRITICAL_ENTER();
+            if (OSIntQNbrEntries == 0u) {                       /* Stop when the queue is empty                         */
+                CPU_CRITICAL_EXIT();
+                break;
+            }
+            entry = OSCfg_IntQBasePtr[OSIntQOutIx];             /* Extract the oldest entry                             */
+            OSIntQOutIx++;
+            if (OSIntQOutIx >= OSCfg_IntQSize) {
+                OSIntQOutIx = 0u;
+            }
+            OSIntQNbrEntries--;
+            CPU_CRITICAL_EXIT();
+
+            switch (entry.Type) {                               /* Perform the post on behalf of the ISR                */
+#if (OS_CFG_FLAG_EN > 0u)
+                case OS_OBJ_TYPE_FLAG:
+                     (void)OSFlagPost((OS_FLAG_GRP *)entry.ObjPtr,
+                                      entry.Flags,
+                                      (OS_OPT)(entry.Opt | OS_OPT_POST_NO_SCHED),
+                                      &err);
+                     break;
+#endif
+
+#if (OS_CFG_Q_EN > 0u)
+                case OS_OBJ_TYPE_Q:
+                     OSQPost((OS_Q *)entry.ObjPtr,
+                             entry.MsgPtr,
+                             entry.MsgSize,
+                             (OS_OPT)(entry.Opt | OS_OPT_POST_NO_SCHED),
+                             &err);
+#if (OS_CFG_MEM_BUF_EN > 0u)
+                     if ((entry.Opt & OS_OPT_POST_MEM_BUF_REF) != 0u) {
+                         OSMemBufRelease(entry.MsgPtr,          /* Drop the reference taken by the ISR                  */
+                                         &err);
+                     }
+#endif
+                     break;
+#endif
+
+#if (OS_CFG_SEM_EN > 0u)
+                case OS_OBJ_TYPE_SEM:
+                     (void)OSSemPost((OS_SEM *)entry.ObjPtr,
+                                     (OS_OPT)(entry.Opt | OS_OPT_POST_NO_SCHED),
+                                     &err);
+                     break;
+#endif
+
+#if (OS_CFG_TASK_Q_EN > 0u)
+                case OS_OBJ_TYPE_TASK_MSG:
+                     OSTaskQPost((OS_TCB *)entry.ObjPtr,
+                                 entry.MsgPtr,
+                                 entry.MsgSize,
+                                 (OS_OPT)(entry.Opt | OS_OPT_POST_NO_SCHED),
+                                 &err);
+#if (OS_CFG_MEM_BUF_EN > 0u)
+                     if ((entry.Opt & OS_OPT_POST_MEM_BUF_REF) != 0u) {
+                         OSMemBufRelease(entry.MsgPtr,          /* Drop the reference taken by the ISR                  */
+                                         &err);
+                     }
+#endif
+                     break;
+#endif
+
+                case OS_OBJ_TYPE_TASK_SIGNAL:
+                     (void)OSTaskSemPost((OS_TCB *)entry.ObjPtr,
+                                         (OS_OPT)(entry.Opt | OS_OPT_POST_NO_SCHED),
+                                         &err);
+                     break;
+
+                default:
+                     break;
+            }
+        }
+
+        OSSched();                                              /* Run the scheduler once for the whole batch           */
+    }
+}
+#endif
@@ -0,0 +1,346 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                      THREADED INTERRUPT HANDLERS
+*
+* File    : os_int_thread.c
+* Version : V3.08.00
+*********************************************************************************************************
+*/
+
+#define   MICRIUM_SOURCE
+#define   OS_CRIT_SITE_ID                   OS_CRIT_SITE_INT_THREAD
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_int_thread__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_INT_THREAD_EN > 0u)
+
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  void  OS_IntThreadTask (void  *p_arg);
+
+
+/*
+************************************************************************************************************************
+*                                           REGISTER A THREADED INTERRUPT HANDLER
+*
+* Description: This function is called by your application to attach a handler task to an interrupt.  The interrupt
+*              itself is serviced by OSIntThreadISR(), which only runs the optional top half and wakes up the handler
+*              task.  The rest of the work is done by 'p_fnct', at the priority of the handler task.
+*
+* Arguments  : p_thread    is a pointer to the threaded interrupt handler, which holds the TCB of the handler task.
+*
+*              p_name      is a pointer to an ASCII string to provide a name to the handler task.
+*
+*              irq         is the interrupt number passed to OSIntThreadISR(), from 0 to OS_CFG_INT_THREAD_IRQ_NBR - 1.
+*
+*              p_top_fnct  is a pointer to the top half, called in interrupt context with 'p_arg' (see Note #2).  It
+*                          may be a NULL pointer.
+*
+*              p_fnct      is a pointer to the handler, called by the handler task with 'p_arg' and the number of
+*                          interrupts that occurred since its previous call (see Note #3).
+*
+*              p_arg       is the argument passed to 'p_top_fnct' and 'p_fnct'.
+*
+*              prio        is the priority of the handler task.
+*
+*              p_stk_base  is a pointer to the base of the stack of the handler task.
+*
+*              stk_limit   is the stack limit of the handler task (see OSTaskCreate()).
+*
+*              stk_size    is the size of the stack of the handler task, in number of CPU_STK elements.
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                     The handler task was created and attached to 'irq'
+*                              OS_ERR_ILLEGAL_CREATE_RUN_TIME  If you are trying to register a handler after you
+*                                                                called OSSafetyCriticalStart()
+*                              OS_ERR_INT_THREAD_IRQ_INVALID   If 'irq' is not below OS_CFG_INT_THREAD_IRQ_NBR
+*                              OS_ERR_INT_THREAD_IRQ_USED      If a handler is already attached to 'irq'
+*                              OS_ERR_OBJ_CREATED              If 'p_thread' was already registered
+*                              OS_ERR_OBJ_PTR_NULL             If you passed a NULL pointer for 'p_thread'
+*                              OS_ERR_PTR_INVALID              If you passed a NULL pointer for 'p_fnct'
+*                              OS_ERR_TASK_CREATE_ISR          If you called this function from an ISR
+*
+*                          or any of the errors returned by OSTaskCreate().
+*
+* Returns    : none
+*
+* Note(s)    : 1) Threaded interrupt handlers can't be unregistered.
+*
+*              2) The top half typically reads the status of the peripheral and acknowledges the interrupt.  It
+*                 returns OS_TRUE to wake up the handler task or OS_FALSE if there is nothing for the task to do.
+*
+*              3) Interrupts that occur while the handler task is ready or running are coalesced: the task is woken up
+*                 once and 'p_fnct' is given the number of interrupts instead.
+************************************************************************************************************************
+*/
+
+void  OSIntThreadRegister (OS_INT_THREAD           *p_thread,
+                           CPU_CHAR                *p_name,
+                           CPU_INT16U               irq,
+                           OS_INT_THREAD_TOP_FNCT   p_top_fnct,
+                           OS_INT_THREAD_FNCT       p_fnct,
+                           void                    *p_arg,
+                           OS_PRIO                  prio,
+                           CPU_STK                 *p_stk_base,
+                           CPU_STK_SIZE             stk_limit,
+                           CPU_STK_SIZE             stk_size,
+                           OS_ERR                  *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_TASK_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_thread == (OS_INT_THREAD *)0) {                       /* Must point to a valid handler                        */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_fnct == (OS_INT_THREAD_FNCT)0) {                      /* Must provide the function of the handler task        */
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+#endif
+
+    if (irq >= OS_CFG_INT_THREAD_IRQ_NBR) {                     /* Needed to index OSIntThreadTbl[]                     */
+       *p_err = OS_ERR_INT_THREAD_IRQ_INVALID;
+        return;
+    }
+
+#if (OS_OBJ_TYPE_REQ > 0u)
+#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
+    if (p_thread->Type == OS_OBJ_TYPE_INT_THREAD) {
+       *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (OSIntThreadTbl[irq] != (OS_INT_THREAD *)0) {            /* Only one handler per interrupt                       */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_INT_THREAD_IRQ_USED;
+        return;
+    }
+    p_thread->HandlerFnct = (OS_INT_THREAD_FNCT)0;              /* Interrupts are ignored until the task exists         */
+    p_thread->TopFnct     = p_top_fnct;
+    p_thread->ArgPtr      = p_arg;
+    p_thread->Irq         = irq;
+    p_thread->PendCtr     = 0u;
+    OSIntThreadTbl[irq]   = p_thread;                           /* Claim the interrupt                                  */
+    CPU_CRITICAL_EXIT();
+
+    OSTaskCreate(&p_thread->TCB,
+                  p_name,
+                  OS_IntThreadTask,
+                  p_thread,
+                  prio,
+                  p_stk_base,
+                  stk_limit,
+                  stk_size,
+                  0u,
+                  0u,
+                  (void *)0,
+                  (OS_OPT)(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                  p_err);
+
+    CPU_CRITICAL_ENTER();
+    if (*p_err != OS_ERR_NONE) {
+        OSIntThreadTbl[irq]   = (OS_INT_THREAD *)0;             /* Give the interrupt back                              */
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_thread->Type        = OS_OBJ_TYPE_INT_THREAD;             /* Set the type of object                               */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_thread->NamePtr     = p_name;                             /* Save name of handler                                 */
+#endif
+    p_thread->HandlerFnct = p_fnct;                             /* Start waking up the handler task                     */
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+************************************************************************************************************************
+*                                             THREADED INTERRUPT SERVICE ROUTINE
+*
+* Description: This function services an interrupt attached to a handler task by OSIntThreadRegister().  It runs the
+*              top half of the handler and, if the top half asks for it, counts the interrupt and wakes up the handler
+*              task.
+*
+* Arguments  : irq         is the number of the interrupt being serviced.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function calls OSIntEnter() and OSIntExit() itself and may be installed as the interrupt handler
+*                 by the port, which then only needs to pass it the number of the interrupt.  It MUST only be used
+*                 for kernel aware interrupts.
+*
+*              2) The handler task is only posted when its count of pending interrupts goes from 0 to 1, so a burst of
+*                 interrupts costs a single post (see OSIntThreadRegister(), Note #3).
+*
+*              3) Interrupts with no handler registered are ignored.
+************************************************************************************************************************
+*/
+
+void  OSIntThreadISR (CPU_INT16U  irq)
+{
+    OS_INT_THREAD  *p_thread;
+    CPU_BOOLEAN     post;
+    OS_ERR          err;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    OSIntEnter();                                               /* Tell uC/OS-III that we are starting an ISR           */
+    CPU_CRITICAL_EXIT();
+
+    if (irq < OS_CFG_INT_THREAD_IRQ_NBR) {
+        p_thread = OSIntThreadTbl[irq];
+    } else {
+        p_thread = (OS_INT_THREAD *)0;
+    }
+
+    if (p_thread != (OS_INT_THREAD *)0) {
+        if (p_thread->HandlerFnct != (OS_INT_THREAD_FNCT)0) {   /* See Note #3                                          */
+            post = OS_TRUE;
+            if (p_thread->TopFnct != (OS_INT_THREAD_TOP_FNCT)0) {
+                post = p_thread->TopFnct(p_thread->ArgPtr);     /* Top half, in interrupt context                       */
+            }
+            if (post == OS_TRUE) {
+                CPU_CRITICAL_ENTER();
+                p_thread->PendCtr++;
+                if (p_thread->PendCtr != 1u) {                  /* See Note #2                                          */
+                    post = OS_FALSE;
+                }
+                CPU_CRITICAL_EXIT();
+                if (post == OS_TRUE) {
+                    (void)OSTaskSemPost(&p_thread->TCB,
+                                         OS_OPT_POST_NONE,
+                                        &err);
+                }
+            }
+        }
+    }
+
+    OSIntExit();                                                /* Tell uC/OS-III that we are leaving the ISR           */
+}
+
+
+/*
+************************************************************************************************************************
+*                                       INITIALIZE THE THREADED INTERRUPT HANDLERS
+*
+* Description: This function is called by OSInit() to detach every interrupt from its handler task.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_IntThreadInit (void)
+{
+    CPU_INT16U  irq;
+
+
+    for (irq = 0u; irq < OS_CFG_INT_THREAD_IRQ_NBR; irq++) {
+        OSIntThreadTbl[irq] = (OS_INT_THREAD *)0;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                            THREADED INTERRUPT HANDLER TASK
+*
+* Description: Code of the handler tasks created by OSIntThreadRegister().  The task waits for OSIntThreadISR() to
+*              post it, takes the count of interrupts pending and passes it to the handler.
+*
+* Arguments  : p_arg       is a pointer to the threaded interrupt handler.
+*
+* Returns    : none
+*
+* Note(s)    : 1) The count is taken with interrupts disabled, so an interrupt that occurs while the handler runs
+*                 posts the task again and is passed to the next call of the handler.
+************************************************************************************************************************
+*/
+
+static  void  OS_IntThreadTask (void  *p_arg)
+{
+    OS_INT_THREAD  *p_thread;
+    OS_CTR          nbr;
+    OS_ERR          err;
+    CPU_SR_ALLOC();
+
+
+    p_thread = (OS_INT_THREAD *)p_arg;
+    for (;;) {
+        (void)OSTaskSemPend(0u,                                 /* Wait for an interrupt                                */
+                            OS_OPT_PEND_BLOCKING,
+                            (CPU_TS *)0,
+                            &err);
+        if (err != OS_ERR_NONE) {
+            continue;
+        }
+
+        CPU_CRITICAL_ENTER();
+        nbr               = p_thread->PendCtr;                  /* See Note #1                                          */
+        p_thread->PendCtr = 0u;
+        CPU_CRITICAL_EXIT();
+
+        if (nbr > 0u) {
+            p_thread->HandlerFnct(p_thread->ArgPtr, nbr);       /* Bottom half, at the priority of the task             */
+        }
+    }
+}
+
+#endif
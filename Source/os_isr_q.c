@@ -0,0 +1,514 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                      ISR TO TASK QUEUE MANAGEMENT
+*
+* File    : os_isr_q.c
+* Version : V3.08.00
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+* Note(s) : (1) An OS_ISR_Q carries fixed-size elements from ONE producer (normally a single ISR) to ONE consumer
+*               task.  The producer only writes 'InIx' and the consumer only writes 'OutIx', so neither side needs
+*               a critical section to move data.  The indices run from 0 to (2 * NbrElem) - 1 so that a full and
+*               an empty queue can be told apart without sacrificing an element.
+*
+*           (2) The consumer sleeps on its own task semaphore.  The producer only calls OSTaskSemPost() when the
+*               element it deposits is the only one in the queue, i.e. when the consumer may be waiting.
+*
+*           (3) The code relies on the processor completing memory accesses in program order as seen by an ISR and
+*               the task it interrupts.  This is the case for the single-core targets supported by uC/OS-III.
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#define  OS_CRIT_SITE_ID                    OS_CRIT_SITE_ISR_Q
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_isr_q__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_ISR_Q_EN > 0u)
+/*
+************************************************************************************************************************
+*                                                 CREATE AN ISR QUEUE
+*
+* Description: This function is called by your application to create a queue that transfers elements from an ISR to
+*              a task without disabling interrupts.
+*
+* Arguments  : p_isr_q     is a pointer to the ISR queue
+*
+*              p_name      is a pointer to an ASCII string that will be used to name the ISR queue
+*
+*              p_tcb       is a pointer to the TCB of the task that will receive the elements.  If you specify a NULL
+*                          pointer then the calling task will be the consumer.
+*
+*              p_buf       is a pointer to the storage for the elements.  It must be at least 'elem_size * nbr_elem'
+*                          bytes.
+*
+*              elem_size   is the size of each element (in bytes)
+*
+*              nbr_elem    is the number of elements the ISR queue can hold
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                    The call was successful
+*                              OS_ERR_CREATE_ISR              Can't create from an ISR
+*                              OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the ISR queue after you
+*                                                               called OSSafetyCriticalStart()
+*                              OS_ERR_OBJ_PTR_NULL            If you passed a NULL pointer for 'p_isr_q'
+*                              OS_ERR_PTR_INVALID             If you passed a NULL pointer for 'p_buf'
+*                              OS_ERR_Q_SIZE                  If 'elem_size' or 'nbr_elem' is 0, or if 'nbr_elem' is
+*                                                               more than half the range of OS_MSG_QTY
+*                              OS_ERR_TCB_INVALID             If 'p_tcb' is NULL and the kernel is not running
+*                              OS_ERR_OBJ_CREATED             If the ISR queue was already created
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSIsrQCreate (OS_ISR_Q     *p_isr_q,
+                    CPU_CHAR     *p_name,
+                    OS_TCB       *p_tcb,
+                    void         *p_buf,
+                    OS_MSG_SIZE   elem_size,
+                    OS_MSG_QTY    nbr_elem,
+                    OS_ERR       *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_isr_q == (OS_ISR_Q *)0) {                             /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_buf == (void *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    if ((elem_size == 0u) ||                                    /* Indices must be able to count up to 2 * nbr_elem     */
+        (nbr_elem  == 0u) ||
+        (nbr_elem  >  ((OS_MSG_QTY)~(OS_MSG_QTY)0 / 2u))) {
+       *p_err = OS_ERR_Q_SIZE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {                                 /* Consumer is the calling task?                        */
+        if (OSRunning != OS_STATE_OS_RUNNING) {
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_TCB_INVALID;
+            return;
+        }
+        p_tcb = OSTCBCurPtr;
+    }
+#if (OS_OBJ_TYPE_REQ > 0u)
+#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
+    if (p_isr_q->Type == OS_OBJ_TYPE_ISR_Q) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+    p_isr_q->Type     = OS_OBJ_TYPE_ISR_Q;                      /* Mark the data structure as an ISR queue              */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_isr_q->NamePtr  = p_name;
+#else
+    (void)p_name;
+#endif
+    p_isr_q->TCBPtr   = p_tcb;
+    p_isr_q->BufPtr   = (CPU_INT08U *)p_buf;
+    p_isr_q->ElemSize = elem_size;
+    p_isr_q->NbrElem  = nbr_elem;
+    p_isr_q->InIx     = 0u;
+    p_isr_q->OutIx    = 0u;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                            POST AN ELEMENT TO AN ISR QUEUE
+*
+* Description: This function copies an element into an ISR queue.  It does not disable interrupts; the consumer task
+*              is only signaled (through OSTaskSemPost()) when the queue goes from empty to non-empty.
+*
+* Arguments  : p_isr_q       is a pointer to the ISR queue
+*
+*              p_data        is a pointer to the 'elem_size' bytes to copy into the queue
+*
+*              opt           determines the type of POST performed when the consumer needs to be signaled:
+*
+*                                OS_OPT_POST_NONE         No option selected
+*                                OS_OPT_POST_NO_SCHED     Do not call the scheduler
+*                                OS_OPT_POST_NO_SIGNAL    Do not signal the consumer (See Note #2)
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              The call was successful and the element was deposited
+*                                OS_ERR_OBJ_PTR_NULL      If 'p_isr_q' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE          If the ISR queue was not created
+*                                OS_ERR_OPT_INVALID       You specified an invalid option
+*                                OS_ERR_PTR_INVALID       If 'p_data' is a NULL pointer
+*                                OS_ERR_Q_FULL            If the ISR queue is full; the element was not deposited
+*
+* Returns    : None
+*
+* Note(s)    : 1) Only ONE producer may post to a given ISR queue.  If more than one ISR (or an ISR and a task) need
+*                 to post to it, they must not be able to interrupt each other while doing so.
+*
+*              2) With OS_OPT_POST_NO_SIGNAL, this function does not call into the kernel at all and can thus be called
+*                 from a zero-latency ISR (i.e. an ISR that the kernel never masks).  The consumer is then only
+*                 woken up when a kernel aware ISR (or a task) calls OSIsrQSignal().
+************************************************************************************************************************
+*/
+
+void  OSIsrQPost (OS_ISR_Q  *p_isr_q,
+                  void      *p_data,
+                  OS_OPT     opt,
+                  OS_ERR    *p_err)
+{
+    OS_MSG_QTY           in_ix;
+    OS_MSG_QTY           out_ix;
+    OS_MSG_QTY           nbr_entries;
+    OS_MSG_QTY           ix;
+    OS_MSG_SIZE          i;
+    CPU_INT08U           *p_src;
+    CPU_INT08U volatile  *p_dest;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_isr_q == (OS_ISR_Q *)0) {                             /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_data == (void *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    switch (opt) {
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_NO_SIGNAL:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_isr_q->Type != OS_OBJ_TYPE_ISR_Q) {                   /* Make sure ISR queue was created                      */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    in_ix  = p_isr_q->InIx;
+    out_ix = p_isr_q->OutIx;
+    if (in_ix >= out_ix) {                                      /* Compute the number of elements in the queue          */
+        nbr_entries = in_ix - out_ix;
+    } else {
+        nbr_entries = (OS_MSG_QTY)((2u * p_isr_q->NbrElem) - out_ix) + in_ix;
+    }
+    if (nbr_entries >= p_isr_q->NbrElem) {                      /* Is the queue full?                                   */
+       *p_err = OS_ERR_Q_FULL;
+        return;
+    }
+
+    ix = (in_ix < p_isr_q->NbrElem) ? in_ix : (OS_MSG_QTY)(in_ix - p_isr_q->NbrElem);
+    p_src  = (CPU_INT08U *)p_data;                              /* Copy the element in its slot                         */
+    p_dest = p_isr_q->BufPtr + ((CPU_SIZE_T)ix * (CPU_SIZE_T)p_isr_q->ElemSize);
+    for (i = 0u; i < p_isr_q->ElemSize; i++) {
+        p_dest[i] = p_src[i];
+    }
+
+    ix = in_ix + 1u;                                            /* Publish the element to the consumer                  */
+    if (ix == (OS_MSG_QTY)(2u * p_isr_q->NbrElem)) {
+        ix = 0u;
+    }
+    p_isr_q->InIx = ix;
+
+   *p_err = OS_ERR_NONE;
+    if ((opt & OS_OPT_POST_NO_SIGNAL) != 0u) {                  /* Leave the signaling to OSIsrQSignal()                */
+        return;
+    }
+    if (p_isr_q->OutIx == in_ix) {                              /* Re-read: was the queue empty when we published?      */
+        (void)OSTaskSemPost(p_isr_q->TCBPtr,                    /* Queue was empty, consumer may be waiting             */
+                            opt,
+                            p_err);
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                          SIGNAL THE CONSUMER OF AN ISR QUEUE
+*
+* Description: This function wakes up the consumer of an ISR queue if elements are waiting in it.  It is meant to be
+*              called from a kernel aware ISR (or a task) after elements were posted with OS_OPT_POST_NO_SIGNAL, e.g.
+*              by a zero-latency ISR that pends a low priority software interrupt to hand its data over to the kernel.
+*
+* Arguments  : p_isr_q       is a pointer to the ISR queue
+*
+*              opt           determines the type of POST performed:
+*
+*                                OS_OPT_POST_NONE         No option selected
+*                                OS_OPT_POST_NO_SCHED     Do not call the scheduler
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              The call was successful
+*                                OS_ERR_OBJ_PTR_NULL      If 'p_isr_q' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE          If the ISR queue was not created
+*                                OS_ERR_OPT_INVALID       You specified an invalid option
+*
+*                            or any of the errors returned by OSTaskSemPost()
+*
+* Returns    : None
+*
+* Note(s)    : 1) The consumer is signaled whenever the queue is not empty.  OSIsrQPend() discards the signals that do
+*                 not correspond to an element, so calling this function more often than needed is harmless.
+*
+*              2) This function MUST NOT be called from a zero-latency ISR.
+************************************************************************************************************************
+*/
+
+void  OSIsrQSignal (OS_ISR_Q  *p_isr_q,
+                    OS_OPT     opt,
+                    OS_ERR    *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_isr_q == (OS_ISR_Q *)0) {                             /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_isr_q->Type != OS_OBJ_TYPE_ISR_Q) {                   /* Make sure ISR queue was created                      */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+   *p_err = OS_ERR_NONE;
+    if (p_isr_q->InIx != p_isr_q->OutIx) {                      /* Anything for the consumer? (See Note #1)             */
+        (void)OSTaskSemPost(p_isr_q->TCBPtr,
+                            opt,
+                            p_err);
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                         WAIT FOR AN ELEMENT FROM AN ISR QUEUE
+*
+* Description: This function is called by the consumer task to obtain the oldest element of an ISR queue.  If the queue
+*              is empty, the task waits on its task semaphore until the producer deposits an element.
+*
+* Arguments  : p_isr_q       is a pointer to the ISR queue
+*
+*              p_data        is a pointer to where the 'elem_size' bytes of the element will be copied
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for an
+*                            element up to the amount of time specified by this argument.  If you specify 0, however,
+*                            your task will wait forever or, until an element is posted.
+*
+*              opt           determines whether the user wants to block if the queue is empty or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*                            Add OS_OPT_PEND_ABS to make 'timeout' the value of OSTickCtr at which to give up.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and an element was copied
+*                                OS_ERR_OBJ_PTR_NULL       If you pass a NULL pointer for 'p_isr_q'
+*                                OS_ERR_OBJ_TYPE           If the ISR queue was not created
+*                                OS_ERR_OPT_INVALID        You specified an invalid option
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the queue was empty
+*                                OS_ERR_PTR_INVALID        If you passed a NULL pointer for 'p_data'
+*                                OS_ERR_TASK_INVALID       If the calling task is not the consumer of the ISR queue
+*
+*                            or any of the errors returned by OSTaskSemPend() (OS_ERR_TIMEOUT, OS_ERR_PEND_ABORT, ...)
+*
+* Returns    : None
+*
+* Note(s)    : 1) The consumer's task semaphore is used for signaling and MUST NOT be used for anything else while
+*                 the ISR queue exists.
+************************************************************************************************************************
+*/
+
+void  OSIsrQPend (OS_ISR_Q  *p_isr_q,
+                  void      *p_data,
+                  OS_TICK    timeout,
+                  OS_OPT     opt,
+                  OS_ERR    *p_err)
+{
+    OS_MSG_QTY           out_ix;
+    OS_MSG_QTY           ix;
+    OS_MSG_SIZE          i;
+    CPU_INT08U volatile  *p_src;
+    CPU_INT08U           *p_dest;
+    OS_ERR               err;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_PEND_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_isr_q == (OS_ISR_Q *)0) {                             /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_data == (void *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    switch (opt & (OS_OPT)~OS_OPT_PEND_ABS) {
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_isr_q->Type != OS_OBJ_TYPE_ISR_Q) {                   /* Make sure ISR queue was created                      */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_isr_q->TCBPtr != OSTCBCurPtr) {                       /* Only the consumer may wait on the queue              */
+       *p_err = OS_ERR_TASK_INVALID;
+        return;
+    }
+#endif
+
+    out_ix = p_isr_q->OutIx;
+    while (p_isr_q->InIx == out_ix) {                           /* Wait until the queue is not empty                    */
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {
+           *p_err = OS_ERR_PEND_WOULD_BLOCK;
+            return;
+        }
+        (void)OSTaskSemSet((OS_TCB *)0,                         /* Discard signals for elements already consumed        */
+                           0u,
+                           &err);
+        if (p_isr_q->InIx != out_ix) {                          /* Element posted before the signals were discarded?    */
+            break;
+        }
+        (void)OSTaskSemPend(timeout,
+                            (OS_OPT)(opt & OS_OPT_PEND_ABS),    /* Blocking, same deadline on every retry               */
+                            (CPU_TS *)0,
+                            p_err);
+        if (*p_err != OS_ERR_NONE) {                            /* Timeout, abort, ...                                  */
+            return;
+        }
+    }
+
+    ix = (out_ix < p_isr_q->NbrElem) ? out_ix : (OS_MSG_QTY)(out_ix - p_isr_q->NbrElem);
+    p_src  = p_isr_q->BufPtr + ((CPU_SIZE_T)ix * (CPU_SIZE_T)p_isr_q->ElemSize);
+    p_dest = (CPU_INT08U *)p_data;                              /* Copy the element out of its slot                     */
+    for (i = 0u; i < p_isr_q->ElemSize; i++) {
+        p_dest[i] = p_src[i];
+    }
+
+    out_ix++;                                                   /* Return the slot to the producer                      */
+    if (out_ix == (OS_MSG_QTY)(2u * p_isr_q->NbrElem)) {
+        out_ix = 0u;
+    }
+    p_isr_q->OutIx = out_ix;
+
+   *p_err = OS_ERR_NONE;
+}
+#endif
@@ -0,0 +1,974 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          MAILBOX MANAGEMENT
+*
+* File    : os_mbox.c
+* Version : V3.08.00
+*********************************************************************************************************
+* Note(s) : (1) A mailbox keeps the latest value posted to it, for data such as the state of a sensor where only
+*               the most recent sample matters.  A post never fails for lack of room: it overwrites the value that
+*               was there, takes no OS_MSG from OSMsgPool and costs the same whatever the rate of the producer.
+*
+*           (2) OSMboxPend() returns a value only once: after it was taken, the next OSMboxPend() waits for a new
+*               post.  OSMboxPeek() returns the latest value as many times as it is called, without consuming it
+*               and without disabling interrupts.
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#define  OS_CRIT_SITE_ID                    OS_CRIT_SITE_MBOX
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_mbox__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_MBOX_EN > 0u)
+/*
+************************************************************************************************************************
+*                                                    LOCAL DEFINES
+*
+* Note(s) : (1) The volatile members of an OS_MBOX keep the compiler from reordering the accesses of OSMboxPeek() and
+*               OSMboxPost().  A port that runs the kernel next to other cores sharing the mailbox defines
+*               OS_CPU_MEM_BARRIER() so that the processor does not reorder them either.
+************************************************************************************************************************
+*/
+
+#ifdef   OS_CPU_MEM_BARRIER
+#define  OS_MBOX_MEM_BARRIER()              OS_CPU_MEM_BARRIER()
+#else
+#define  OS_MBOX_MEM_BARRIER()
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                   CREATE A MAILBOX
+*
+* Description: This function is called by your application to create a mailbox.  A mailbox is created empty.
+*
+* Arguments  : p_mbox        is a pointer to the mailbox to initialize.  Your application is responsible for
+*                            allocating storage for the mailbox.
+*
+*              p_name        is a pointer to the name you would like to give the mailbox.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_CREATE_ISR              If you called this function from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the mailbox after you
+*                                                                 called OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_mbox' is a NULL pointer
+*                                OS_ERR_OBJ_CREATED             If the mailbox was already created
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSMboxCreate (OS_MBOX   *p_mbox,
+                    CPU_CHAR  *p_name,
+                    OS_ERR    *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_mbox == (OS_MBOX *)0) {                               /* Validate 'p_mbox'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
+    if (p_mbox->Type == OS_OBJ_TYPE_MBOX) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+    p_mbox->Type    = OS_OBJ_TYPE_MBOX;                         /* Mark the data structure as a mailbox                 */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_mbox->NamePtr = p_name;                                   /* Save the name of the mailbox                         */
+#else
+    (void)p_name;
+#endif
+    p_mbox->MsgPtr  = (void *)0;                                /* The mailbox holds no value yet                       */
+    p_mbox->MsgSize =         0u;
+#if (OS_CFG_TS_EN > 0u)
+    p_mbox->TS      =         0u;
+#endif
+    p_mbox->Seq     =         0u;
+    p_mbox->Fresh   =  OS_FALSE;
+    OS_PendListInit(&p_mbox->PendList);                         /* Initialize the waiting list                          */
+
+#if (OS_CFG_DBG_EN > 0u)
+    OS_MboxDbgListAdd(p_mbox);
+    OSMboxQty++;                                                /* One more mailbox created                             */
+#endif
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                   DELETE A MAILBOX
+*
+* Description: This function deletes a mailbox and readies all tasks pending on it.
+*
+* Arguments  : p_mbox        is a pointer to the mailbox to delete
+*
+*              opt           determines delete options as follows:
+*
+*                                OS_OPT_DEL_NO_PEND          Delete the mailbox ONLY if no task pending
+*                                OS_OPT_DEL_ALWAYS           Deletes the mailbox even if tasks are waiting.
+*                                                            In this case, all the tasks pending will be readied.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    The call was successful and the mailbox was deleted
+*                                OS_ERR_DEL_ISR                 If you attempted to delete the mailbox from an ISR
+*                                OS_ERR_ILLEGAL_DEL_RUN_TIME    If you are trying to delete the mailbox after you
+*                                                                 called OSStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_mbox' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE                If 'p_mbox' is not pointing at a mailbox
+*                                OS_ERR_OPT_INVALID             An invalid option was specified
+*                                OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                                OS_ERR_TASK_WAITING            One or more tasks were waiting on the mailbox
+*
+* Returns    : == 0          if no tasks were waiting on the mailbox, or upon error.
+*              >  0          if one or more tasks waiting on the mailbox are now readied and informed.
+*
+* Note(s)    : 1) This function must be used with care.  Tasks that would normally expect the presence of the
+*                 mailbox MUST check the return code of OSMboxPend().
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MBOX_DEL_EN > 0u)
+OS_OBJ_QTY  OSMboxDel (OS_MBOX  *p_mbox,
+                       OS_OPT    opt,
+                       OS_ERR   *p_err)
+{
+    OS_OBJ_QTY     nbr_tasks;
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't delete a mailbox from an ISR                   */
+       *p_err = OS_ERR_DEL_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_mbox == (OS_MBOX *)0) {                               /* Validate 'p_mbox'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_mbox->Type != OS_OBJ_TYPE_MBOX) {                     /* Make sure mailbox was created                        */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_mbox->PendList;
+    nbr_tasks   = 0u;
+    switch (opt) {
+        case OS_OPT_DEL_NO_PEND:                                /* Delete mailbox only if no task waiting               */
+             if (OS_PEND_LIST_HEAD(p_pend_list) == (OS_TCB *)0) {
+#if (OS_CFG_DBG_EN > 0u)
+                 OS_MboxDbgListRemove(p_mbox);
+                 OSMboxQty--;
+#endif
+                 OS_MboxClr(p_mbox);
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_NONE;
+             } else {
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_TASK_WAITING;
+             }
+             break;
+
+        case OS_OPT_DEL_ALWAYS:                                 /* Always delete the mailbox                            */
+#if (OS_CFG_TS_EN > 0u)
+             ts = OS_TS_GET();                                  /* Get local time stamp so all tasks get the same time  */
+#else
+             ts = 0u;
+#endif
+             p_tcb = OS_PEND_LIST_HEAD(p_pend_list);            /* Remove all tasks from the pend list                  */
+             while (p_tcb != (OS_TCB *)0) {
+                 OS_PendAbort(p_tcb,
+                              ts,
+                              OS_STATUS_PEND_DEL);
+                 nbr_tasks++;
+                 p_tcb = OS_PEND_LIST_HEAD(p_pend_list);
+             }
+#if (OS_CFG_DBG_EN > 0u)
+             OS_MboxDbgListRemove(p_mbox);
+             OSMboxQty--;
+#endif
+             OS_MboxClr(p_mbox);
+             CPU_CRITICAL_EXIT();
+             OSSched();                                         /* Find highest priority task ready to run              */
+            *p_err = OS_ERR_NONE;
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_OPT_INVALID;
+             break;
+    }
+    return (nbr_tasks);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                          READ THE LATEST VALUE OF A MAILBOX
+*
+* Description: This function returns the value last posted to a mailbox, whether or not it was taken by OSMboxPend().
+*              It never blocks and the value is left in the mailbox.
+*
+* Arguments  : p_mbox        is a pointer to the mailbox
+*
+*              p_msg_size    is a pointer to a variable that will receive the size of the value
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp of the post.  If you pass a
+*                            NULL pointer (i.e. (CPU_TS *)0) then you will not get the timestamp.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and the value was read
+*                                OS_ERR_MBOX_EMPTY         If nothing was posted to the mailbox yet
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_mbox' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_mbox' is not pointing at a mailbox
+*                                OS_ERR_PTR_INVALID        If you passed a NULL pointer for 'p_msg_size'
+*
+* Returns    : The latest value posted to the mailbox, (void *)0 upon error.
+*
+* Note(s)    : 1) This function may be called from a task or from an ISR.  It does not enter a critical section: the
+*                 value is read again if a post updated it meanwhile (see OS_MBOX Note #3).
+************************************************************************************************************************
+*/
+
+void  *OSMboxPeek (OS_MBOX      *p_mbox,
+                   OS_MSG_SIZE  *p_msg_size,
+                   CPU_TS       *p_ts,
+                   OS_ERR       *p_err)
+{
+    void      *p_void;
+    CPU_DATA   seq;
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS     ts;
+#endif
+
+
+#if (OS_CFG_TS_EN == 0u)
+    (void)p_ts;                                                 /* Prevent compiler warning for not using 'ts'          */
+#endif
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_mbox == (OS_MBOX *)0) {                               /* Validate 'p_mbox'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return ((void *)0);
+    }
+    if (p_msg_size == (OS_MSG_SIZE *)0) {                       /* Validate 'p_msg_size'                                */
+       *p_err = OS_ERR_PTR_INVALID;
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_mbox->Type != OS_OBJ_TYPE_MBOX) {                     /* Make sure mailbox was created                        */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return ((void *)0);
+    }
+#endif
+
+    do {
+        seq = p_mbox->Seq;
+        if (seq == 0u) {                                        /* Was anything posted yet?                             */
+           *p_msg_size = 0u;                                    /* No                                                   */
+#if (OS_CFG_TS_EN > 0u)
+            if (p_ts != (CPU_TS *)0) {
+               *p_ts = 0u;
+            }
+#endif
+           *p_err = OS_ERR_MBOX_EMPTY;
+            return ((void *)0);
+        }
+        OS_MBOX_MEM_BARRIER();                                  /* Read the value after the sequence count ...          */
+        p_void      = p_mbox->MsgPtr;
+       *p_msg_size  = p_mbox->MsgSize;
+#if (OS_CFG_TS_EN > 0u)
+        ts          = p_mbox->TS;
+#endif
+        OS_MBOX_MEM_BARRIER();                                  /* ... and before checking it again                     */
+    } while (((seq & 1u) != 0u) ||                              /* Retry if a post was under way or took place          */
+             (seq != p_mbox->Seq));
+
+#if (OS_CFG_TS_EN > 0u)
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts = ts;
+    }
+#endif
+   *p_err = OS_ERR_NONE;
+    return (p_void);
+}
+
+
+/*
+************************************************************************************************************************
+*                                            PEND ON A MAILBOX FOR A VALUE
+*
+* Description: This function waits for a value to be posted to a mailbox.  If a value was posted since the last
+*              OSMboxPend(), it is returned at once, otherwise the task waits for the next post.
+*
+* Arguments  : p_mbox        is a pointer to the mailbox
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for a
+*                            value to be posted up to the amount of time specified by this argument.  If you specify
+*                            0, however, your task will wait forever at the specified mailbox or, until a value is
+*                            posted.
+*
+*              opt           determines whether the user wants to block if no new value was posted:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*                            Add OS_OPT_PEND_ABS to make 'timeout' the value of OSTickCtr at which to give up.
+*
+*              p_msg_size    is a pointer to a variable that will receive the size of the value
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp of when the value was
+*                            posted, pend aborted or the mailbox deleted.  If you pass a NULL pointer (i.e.
+*                            (CPU_TS *)0) then you will not get the timestamp.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and your task received a value
+*                                OS_ERR_OBJ_DEL            If 'p_mbox' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_mbox' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_mbox' is not pointing at a mailbox
+*                                OS_ERR_OPT_INVALID        If you specified an invalid value for 'opt'
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         If the pend was aborted by another task
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR and the result
+*                                                          would lead to a suspension
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but no new value was posted
+*                                OS_ERR_PTR_INVALID        If you passed a NULL pointer for 'p_msg_size'
+*                                OS_ERR_SCHED_LOCKED       If you called this function when the scheduler is locked
+*                                OS_ERR_STATUS_INVALID     Pend status is invalid
+*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*                                OS_ERR_TIMEOUT            No value was posted within the specified timeout
+*
+* Returns    : The value received, (void *)0 if none was received.
+*
+* Note(s)    : 1) A value posted while no task is waiting is kept until the next OSMboxPend() or until it is
+*                 overwritten by the next post, whichever comes first.
+************************************************************************************************************************
+*/
+
+void  *OSMboxPend (OS_MBOX      *p_mbox,
+                   OS_TICK       timeout,
+                   OS_OPT        opt,
+                   OS_MSG_SIZE  *p_msg_size,
+                   CPU_TS       *p_ts,
+                   OS_ERR       *p_err)
+{
+    void  *p_void;
+    CPU_SR_ALLOC();
+
+
+#if (OS_CFG_TS_EN == 0u)
+    (void)p_ts;                                                 /* Prevent compiler warning for not using 'ts'          */
+#endif
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != OS_OPT_PEND_NON_BLOCKING) {
+           *p_err = OS_ERR_PEND_ISR;
+            return ((void *)0);
+        }
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_mbox == (OS_MBOX *)0) {                               /* Validate 'p_mbox'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return ((void *)0);
+    }
+    if (p_msg_size == (OS_MSG_SIZE *)0) {                       /* Validate 'p_msg_size'                                */
+       *p_err = OS_ERR_PTR_INVALID;
+        return ((void *)0);
+    }
+    switch (opt & (OS_OPT)~OS_OPT_PEND_ABS) {                   /* Validate 'opt'                                       */
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_mbox->Type != OS_OBJ_TYPE_MBOX) {                     /* Make sure mailbox was created                        */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return ((void *)0);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_mbox->Fresh == OS_TRUE) {                             /* Was a value posted since the last pend?              */
+        p_mbox->Fresh = OS_FALSE;                               /* Yes, take it                                         */
+        p_void        = p_mbox->MsgPtr;
+       *p_msg_size    = p_mbox->MsgSize;
+#if (OS_CFG_TS_EN > 0u)
+        if (p_ts != (CPU_TS *)0) {
+           *p_ts = p_mbox->TS;
+        }
+#endif
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return (p_void);
+    }
+
+   *p_msg_size = 0u;
+#if (OS_CFG_TS_EN > 0u)
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts = 0u;
+    }
+#endif
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if no new value?               */
+        CPU_CRITICAL_EXIT();                                    /* No                                                   */
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;
+        return ((void *)0);
+    } else {                                                    /* Yes                                                  */
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return ((void *)0);
+        }
+    }
+
+    OS_PEND_ABS_SET(OSTCBCurPtr, opt);
+    OS_Pend((OS_PEND_OBJ *)((void *)p_mbox),                    /* Block task pending on mailbox                        */
+            OSTCBCurPtr,
+            OS_TASK_PEND_ON_MBOX,
+            timeout);
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* Extract value from TCB (Put there by Post)           */
+             p_void     = OSTCBCurPtr->MsgPtr;
+            *p_msg_size = OSTCBCurPtr->MsgSize;
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts  != (CPU_TS *)0) {
+                *p_ts  =  OSTCBCurPtr->TS;
+             }
+#endif
+            *p_err      = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+             p_void     = (void *)0;
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts  != (CPU_TS *)0) {
+                *p_ts  =  OSTCBCurPtr->TS;
+             }
+#endif
+            *p_err      = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that no value was posted within TO          */
+             p_void     = (void *)0;
+            *p_err      = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+             p_void     = (void *)0;
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts  != (CPU_TS *)0) {
+                *p_ts  =  OSTCBCurPtr->TS;
+             }
+#endif
+            *p_err      = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+             p_void     = (void *)0;
+            *p_err      = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+    return (p_void);
+}
+
+
+/*
+************************************************************************************************************************
+*                                             ABORT WAITING ON A MAILBOX
+*
+* Description: This function aborts & readies any tasks currently waiting on a mailbox.  This function should be used
+*              to fault-abort the wait on the mailbox, rather than to normally post to the mailbox via OSMboxPost().
+*
+* Arguments  : p_mbox        is a pointer to the mailbox
+*
+*              opt           determines the type of ABORT performed:
+*
+*                                OS_OPT_PEND_ABORT_1     ABORT wait for a single task (HPT) waiting on the mailbox
+*                                OS_OPT_PEND_ABORT_ALL   ABORT wait for ALL tasks that are  waiting on the mailbox
+*                                OS_OPT_POST_NO_SCHED    Do not call the scheduler
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                  At least one task waiting on the mailbox was readied
+*                                                             and informed of the aborted wait; check return value
+*                                                             for the number of tasks whose wait was aborted.
+*                                OS_ERR_OBJ_PTR_NULL          If 'p_mbox' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE              If 'p_mbox' is not pointing at a mailbox
+*                                OS_ERR_OPT_INVALID           If you specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING        If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT_ISR        If you called this function from an ISR
+*                                OS_ERR_PEND_ABORT_NONE       No task were pending
+*
+* Returns    : == 0          if no tasks were waiting on the mailbox, or upon error.
+*              >  0          if one or more tasks waiting on the mailbox are now readied and informed.
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MBOX_PEND_ABORT_EN > 0u)
+OS_OBJ_QTY  OSMboxPendAbort (OS_MBOX  *p_mbox,
+                             OS_OPT    opt,
+                             OS_ERR   *p_err)
+{
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    CPU_TS         ts;
+    OS_OBJ_QTY     nbr_tasks;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to Pend Abort from an ISR                */
+       *p_err =  OS_ERR_PEND_ABORT_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_mbox == (OS_MBOX *)0) {                               /* Validate 'p_mbox'                                    */
+       *p_err =  OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_PEND_ABORT_1:
+        case OS_OPT_PEND_ABORT_ALL:
+        case OS_OPT_PEND_ABORT_1   | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_PEND_ABORT_ALL | OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err =  OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_mbox->Type != OS_OBJ_TYPE_MBOX) {                     /* Make sure mailbox was created                        */
+       *p_err =  OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_mbox->PendList;
+    if (OS_PEND_LIST_HEAD(p_pend_list) == (OS_TCB *)0) {        /* Any task waiting on mailbox?                         */
+        CPU_CRITICAL_EXIT();                                    /* No                                                   */
+       *p_err =  OS_ERR_PEND_ABORT_NONE;
+        return (0u);
+    }
+
+    nbr_tasks = 0u;
+#if (OS_CFG_TS_EN > 0u)
+    ts        = OS_TS_GET();                                    /* Get local time stamp so all tasks get the same time  */
+#else
+    ts        = 0u;
+#endif
+    p_tcb = OS_PEND_LIST_HEAD(p_pend_list);
+    while (p_tcb != (OS_TCB *)0) {
+        OS_PendAbort(p_tcb,
+                     ts,
+                     OS_STATUS_PEND_ABORT);
+        nbr_tasks++;
+        if ((opt & OS_OPT_PEND_ABORT_ALL) == 0u) {              /* Pend abort all tasks waiting?                        */
+            break;                                              /* No                                                   */
+        }
+        p_tcb = OS_PEND_LIST_HEAD(p_pend_list);
+    }
+    CPU_CRITICAL_EXIT();
+
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+
+   *p_err = OS_ERR_NONE;
+    return (nbr_tasks);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                 POST TO A MAILBOX
+*
+* Description: This function stores a value in a mailbox, replacing the value it held.  The highest priority task
+*              waiting on the mailbox, or all of them, receive the value.
+*
+* Arguments  : p_mbox        is a pointer to the mailbox
+*
+*              p_void        is a pointer to the value to post.  The mailbox only keeps the pointer, the data it points
+*                            to must remain valid until it is replaced by the next post.
+*
+*              msg_size      specifies the size of the value (in bytes)
+*
+*              opt           determines the type of POST performed:
+*
+*                                OS_OPT_POST_1           POST to the highest priority task waiting on the mailbox
+*                                OS_OPT_POST_ALL         POST to ALL tasks that are waiting on the mailbox
+*                                OS_OPT_POST_NO_SCHED    Do not call the scheduler
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and the value was stored
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_mbox' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_mbox' is not pointing at a mailbox
+*                                OS_ERR_OPT_INVALID        If you specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function may be called from an ISR.  It never fails for lack of room and does not use OS_MSGs.
+*
+*              2) The value handed to waiting tasks is not kept for the next OSMboxPend(), but OSMboxPeek() still
+*                 returns it.
+************************************************************************************************************************
+*/
+
+void  OSMboxPost (OS_MBOX      *p_mbox,
+                  void         *p_void,
+                  OS_MSG_SIZE   msg_size,
+                  OS_OPT        opt,
+                  OS_ERR       *p_err)
+{
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    CPU_DATA       seq;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_mbox == (OS_MBOX *)0) {                               /* Validate 'p_mbox'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_1:
+        case OS_OPT_POST_ALL:
+        case OS_OPT_POST_1   | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_mbox->Type != OS_OBJ_TYPE_MBOX) {                     /* Make sure mailbox was created                        */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    CPU_CRITICAL_ENTER();
+    seq             = p_mbox->Seq + 1u;                         /* Odd while the value is updated (see OS_MBOX Note #3) */
+    p_mbox->Seq     = seq;
+    OS_MBOX_MEM_BARRIER();
+    p_mbox->MsgPtr  = p_void;                                   /* Overwrite the value held by the mailbox              */
+    p_mbox->MsgSize = msg_size;
+#if (OS_CFG_TS_EN > 0u)
+    p_mbox->TS      = ts;
+#endif
+    OS_MBOX_MEM_BARRIER();
+    seq++;
+    if (seq == 0u) {                                            /* 0 is kept for a mailbox that was never posted        */
+        seq = 2u;
+    }
+    p_mbox->Seq     = seq;
+
+    p_pend_list = &p_mbox->PendList;
+    p_tcb       = OS_PEND_LIST_HEAD(p_pend_list);
+    if (p_tcb == (OS_TCB *)0) {                                 /* Any task waiting on mailbox?                         */
+        p_mbox->Fresh = OS_TRUE;                                /* No, keep the value for the next pend                 */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    p_mbox->Fresh = OS_FALSE;                                   /* The value is taken by the waiting task(s)            */
+    while (p_tcb != (OS_TCB *)0) {
+        OS_Post((OS_PEND_OBJ *)((void *)p_mbox),
+                p_tcb,
+                p_void,
+                msg_size,
+                ts);
+        if ((opt & OS_OPT_POST_ALL) == 0u) {                    /* Post value to all tasks waiting?                     */
+            break;                                              /* No                                                   */
+        }
+        p_tcb = OS_PEND_LIST_HEAD(p_pend_list);                 /* The task posted to left the pend list                */
+    }
+    CPU_CRITICAL_EXIT();
+
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                          CLEAR THE CONTENTS OF A MAILBOX
+*
+* Description: This function is called by OSMboxDel() to clear the contents of a mailbox
+*
+* Argument(s): p_mbox        is a pointer to the mailbox to clear
+*              ------
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_MboxClr (OS_MBOX  *p_mbox)
+{
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_mbox->Type    =  OS_OBJ_TYPE_NONE;                        /* Mark the data structure as a NONE                    */
+#endif
+    p_mbox->MsgPtr  = (void *)0;
+    p_mbox->MsgSize =         0u;
+#if (OS_CFG_TS_EN > 0u)
+    p_mbox->TS      =         0u;                               /* Clear the time stamp                                 */
+#endif
+    p_mbox->Seq     =         0u;
+    p_mbox->Fresh   =  OS_FALSE;
+#if (OS_CFG_DBG_EN > 0u)
+    p_mbox->NamePtr = (CPU_CHAR *)((void *)"?MBOX");
+#endif
+    OS_PendListInit(&p_mbox->PendList);                         /* Initialize the waiting list                          */
+}
+
+
+/*
+************************************************************************************************************************
+*                                         ADD/REMOVE MAILBOX TO/FROM DEBUG LIST
+*
+* Description: These functions are called by uC/OS-III to add or remove a mailbox to/from the debug list.
+*
+* Arguments  : p_mbox       is a pointer to the mailbox to add/remove
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN > 0u)
+void  OS_MboxDbgListAdd (OS_MBOX  *p_mbox)
+{
+    p_mbox->DbgNamePtr               = (CPU_CHAR *)((void *)" ");
+    p_mbox->DbgPrevPtr               = (OS_MBOX *)0;
+    if (OSMboxDbgListPtr == (OS_MBOX *)0) {
+        p_mbox->DbgNextPtr           = (OS_MBOX *)0;
+    } else {
+        p_mbox->DbgNextPtr           =  OSMboxDbgListPtr;
+        OSMboxDbgListPtr->DbgPrevPtr =  p_mbox;
+    }
+    OSMboxDbgListPtr                 =  p_mbox;
+}
+
+
+void  OS_MboxDbgListRemove (OS_MBOX  *p_mbox)
+{
+    OS_MBOX  *p_mbox_next;
+    OS_MBOX  *p_mbox_prev;
+
+
+    p_mbox_prev = p_mbox->DbgPrevPtr;
+    p_mbox_next = p_mbox->DbgNextPtr;
+
+    if (p_mbox_prev == (OS_MBOX *)0) {
+        OSMboxDbgListPtr = p_mbox_next;
+        if (p_mbox_next != (OS_MBOX *)0) {
+            p_mbox_next->DbgPrevPtr = (OS_MBOX *)0;
+        }
+        p_mbox->DbgNextPtr = (OS_MBOX *)0;
+
+    } else if (p_mbox_next == (OS_MBOX *)0) {
+        p_mbox_prev->DbgNextPtr = (OS_MBOX *)0;
+        p_mbox->DbgPrevPtr      = (OS_MBOX *)0;
+
+    } else {
+        p_mbox_prev->DbgNextPtr =  p_mbox_next;
+        p_mbox_next->DbgPrevPtr =  p_mbox_prev;
+        p_mbox->DbgNextPtr      = (OS_MBOX *)0;
+        p_mbox->DbgPrevPtr      = (OS_MBOX *)0;
+    }
+}
+#endif
+#endif
@@ -24,6 +24,7 @@
 */
 
 #define   MICRIUM_SOURCE
+#define   OS_CRIT_SITE_ID                   OS_CRIT_SITE_MEM
 #include "os.h"
 
 #ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
@@ -32,6 +33,25 @@ const  CPU_CHAR  *os_mem__c = "$Id: $";
 
 
 #if (OS_CFG_MEM_EN > 0u)
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MEM_QUOTA_EN > 0u)
+static  OS_MEM_QUOTA  *OS_MemQuotaFind   (OS_MEM        *p_mem,
+                                          OS_TCB        *p_tcb);
+
+static  void           OS_MemQuotaCharge (OS_MEM        *p_mem,
+                                          void          *p_blk,
+                                          OS_MEM_QUOTA  *p_quota);
+
+static  void           OS_MemQuotaCredit (OS_MEM        *p_mem,
+                                          void          *p_blk);
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                               CREATE A MEMORY PARTITION
@@ -165,6 +185,18 @@ void  OSMemCreate (OS_MEM       *p_mem,
     p_mem->NbrFree     = n_blks;                                /* Store number of free blocks in MCB                   */
     p_mem->NbrMax      = n_blks;
     p_mem->BlkSize     = blk_size;                              /* Store block size of each memory blocks               */
+#if (OS_CFG_MEM_CACHE_EN > 0u)
+    p_mem->Opt         = OS_OPT_MEM_NONE;                       /* No cache maintenance unless created aligned          */
+#endif
+#if (OS_CFG_MEM_MAG_EN > 0u) && (OS_CFG_DBG_EN > 0u)
+    p_mem->MagDbgListPtr = (OS_MEM_MAG *)0;                     /* No magazine caches blocks of this partition yet      */
+#endif
+#if (OS_CFG_MEM_QUOTA_EN > 0u)
+    p_mem->QuotaTbl    = (OS_MEM_QUOTA **)0;                    /* No quota until OSMemQuotaTblSet()                    */
+#endif
+#if (OS_CFG_MEM_PEND_EN > 0u)
+    OS_PendListInit(&p_mem->PendList);                          /* Initialize the waiting list                          */
+#endif
 
 #if (OS_CFG_DBG_EN > 0u)
     OS_MemDbgListAdd(p_mem);
@@ -177,6 +209,126 @@ void  OSMemCreate (OS_MEM       *p_mem,
 }
 
 
+/*
+************************************************************************************************************************
+*                                        CREATE A CACHE-LINE ALIGNED MEMORY PARTITION
+*
+* Description : Create a memory partition whose blocks start on a data cache line and span a whole number of lines, so
+*               that no two blocks share a line.  Blocks can then be given to a DMA engine and their cache lines can be
+*               maintained individually.
+*
+* Arguments   : p_mem    is a pointer to a memory partition control block which is allocated in user memory space.
+*
+*               p_name   is a pointer to an ASCII string to provide a name to the memory partition.
+*
+*               p_addr   is the starting address of the storage area.  It doesn't need to be aligned.
+*
+*               size     is the size (in bytes) of the storage area.
+*
+*               blk_size is the minimum size (in bytes) of each block.  It is rounded up to a multiple of
+*                        OS_CPU_CACHE_LINE_SIZE.
+*
+*               opt      specifies the cache maintenance applied to the blocks:
+*
+*                            OS_OPT_MEM_NONE           No maintenance, the blocks are only aligned
+*                            OS_OPT_MEM_CACHE_INV      Invalidate the lines of a block when it is allocated
+*                            OS_OPT_MEM_CACHE_CLEAN    Clean the lines of a block when it is released
+*
+*               p_err    is a pointer to a variable containing an error message which will be set by this function to
+*                        either:
+*
+*                            OS_ERR_NONE                    If the memory partition has been created correctly
+*                            OS_ERR_MEM_INVALID_BLKS        If the area can't hold at least 2 aligned blocks
+*                            OS_ERR_MEM_INVALID_P_ADDR      If you passed a NULL pointer for 'p_addr'
+*                            OS_ERR_MEM_INVALID_SIZE        If 'blk_size' is 0 or too large to be rounded up
+*                            OS_ERR_OPT_INVALID             If you specified an invalid option
+*
+*                        or any of the errors returned by OSMemCreate().
+*
+* Returns    : none
+*
+* Note(s)    : 1) The number of blocks and their size are found in 'p_mem->NbrMax' and 'p_mem->BlkSize'.  Up to
+*                 'OS_CPU_CACHE_LINE_SIZE - 1' bytes at the start of the area are skipped to align the first block.
+*
+*              2) OS_OPT_MEM_CACHE_INV suits buffers written by a DMA engine: a block is handed out with no cached
+*                 copy of its contents.  OS_OPT_MEM_CACHE_CLEAN makes sure the data written by the CPU reaches memory
+*                 before the block is given to another user.  The maintenance is done by the port's
+*                 OS_CPU_DCACHE_INV() and OS_CPU_DCACHE_CLEAN(), which do nothing on ports without a data cache.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MEM_CACHE_EN > 0u)
+void  OSMemCreateAligned (OS_MEM       *p_mem,
+                          CPU_CHAR     *p_name,
+                          void         *p_addr,
+                          CPU_SIZE_T    size,
+                          OS_MEM_SIZE   blk_size,
+                          OS_OPT        opt,
+                          OS_ERR       *p_err)
+{
+    CPU_SIZE_T   pad;
+    CPU_SIZE_T   n_blks;
+    OS_MEM_QTY   n_max;
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_addr == (void *)0) {                                  /* Must pass a valid address for the memory part.       */
+       *p_err = OS_ERR_MEM_INVALID_P_ADDR;
+        return;
+    }
+    if ((blk_size == 0u) ||                                     /* Block size must be representable once rounded up     */
+        (blk_size > ((OS_MEM_SIZE)~(OS_MEM_SIZE)0u - (OS_CPU_CACHE_LINE_SIZE - 1u)))) {
+       *p_err = OS_ERR_MEM_INVALID_SIZE;
+        return;
+    }
+    if ((opt & (OS_OPT)~(OS_OPT)(OS_OPT_MEM_CACHE_INV | OS_OPT_MEM_CACHE_CLEAN)) != 0u) {
+       *p_err = OS_ERR_OPT_INVALID;                             /* Validate 'opt'                                       */
+        return;
+    }
+#endif
+
+    pad      = (CPU_SIZE_T)((CPU_ADDR)p_addr % OS_CPU_CACHE_LINE_SIZE);
+    if (pad > 0u) {                                             /* Skip to the next cache line boundary                 */
+        pad  = OS_CPU_CACHE_LINE_SIZE - pad;
+    }
+    blk_size = (OS_MEM_SIZE)(blk_size + (OS_CPU_CACHE_LINE_SIZE - 1u));
+    blk_size = (OS_MEM_SIZE)(blk_size - (blk_size % OS_CPU_CACHE_LINE_SIZE));
+
+    if (size < pad) {                                           /* Area too small to reach the first line boundary      */
+       *p_err = OS_ERR_MEM_INVALID_BLKS;
+        return;
+    }
+    n_blks = (size - pad) / blk_size;
+    if (n_blks < 2u) {                                          /* Must have at least 2 blocks per partition            */
+       *p_err = OS_ERR_MEM_INVALID_BLKS;
+        return;
+    }
+    n_max  = (OS_MEM_QTY)~(OS_MEM_QTY)0u;
+    if (n_blks > n_max) {                                       /* Only use as many blocks as an OS_MEM_QTY can count   */
+        n_blks = n_max;
+    }
+
+    OSMemCreate(p_mem,
+                p_name,
+                (void *)((CPU_INT08U *)p_addr + pad),
+                (OS_MEM_QTY)n_blks,
+                blk_size,
+                p_err);
+    if (*p_err == OS_ERR_NONE) {
+        p_mem->Opt = opt;                                       /* Not in use yet, no need to protect the update        */
+    }
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                  GET A MEMORY BLOCK
@@ -191,20 +343,36 @@ void  OSMemCreate (OS_MEM       *p_mem,
 *                           OS_ERR_NONE               If the memory partition has been created correctly
 *                           OS_ERR_MEM_INVALID_P_MEM  If you passed a NULL pointer for 'p_mem'
 *                           OS_ERR_MEM_NO_FREE_BLKS   If there are no more free memory blocks to allocate to the caller
+*                           OS_ERR_MEM_QUOTA_EXCEEDED If the calling task already holds as many blocks of the partition
+*                                                     as its quota allows
 *                           OS_ERR_OBJ_TYPE           If 'p_mem' is not pointing at a memory partition
 *
 * Returns    : A pointer to a memory block if no error is detected
 *              A pointer to NULL if an error is detected
 *
-* Note(s)    : none
+* Note(s)    : 1) When OS_MEM_LOCK_FREE_EN is enabled, the free count is decremented before a block is unlinked and
+*                 OSMemPut() links a block before incrementing it.  A caller that reserved a block is therefore
+*                 guaranteed to find one in the free list.  Both updates use the port's exclusive load/store
+*                 primitives, which fail whenever an interrupt or a context switch occurred in between.
+*
+*              2) When the calling task has a quota on the partition (see OSMemQuotaSet()), the block is charged to
+*                 that quota.  Blocks obtained from an ISR are not charged to any task.
 ************************************************************************************************************************
 */
 
 void  *OSMemGet (OS_MEM  *p_mem,
                  OS_ERR  *p_err)
 {
-    void    *p_blk;
+    void          *p_blk;
+#if (OS_MEM_LOCK_FREE_EN > 0u)
+    void          *p_next;
+    CPU_DATA       nbr_free;
+#else
+#if (OS_CFG_MEM_QUOTA_EN > 0u)
+    OS_MEM_QUOTA  *p_quota;
+#endif
     CPU_SR_ALLOC();
+#endif
 
 
 
@@ -235,7 +403,37 @@ void  *OSMemGet (OS_MEM  *p_mem,
 #endif
 
 
+#if (OS_MEM_LOCK_FREE_EN > 0u)
+    do {                                                        /* Reserve a block by decrementing the free count       */
+        nbr_free = OS_CPU_DataLoadExcl(&p_mem->NbrFree);
+        if (nbr_free == 0u) {                                   /* See if there are any free memory blocks              */
+            OS_TRACE_MEM_GET_FAILED(p_mem);
+            OS_TRACE_MEM_GET_EXIT(OS_ERR_MEM_NO_FREE_BLKS);
+           *p_err = OS_ERR_MEM_NO_FREE_BLKS;                    /* No,  Notify caller of empty memory partition         */
+            return ((void *)0);                                 /* Return NULL pointer to caller                        */
+        }
+    } while (OS_CPU_DataStoreExcl(&p_mem->NbrFree, nbr_free - 1u) == OS_FALSE);
+
+    do {                                                        /* Unlink the head of the free list (see Note #1)       */
+        p_blk  = OS_CPU_PtrLoadExcl(&p_mem->FreeListPtr);
+        p_next = *(void **)p_blk;
+    } while (OS_CPU_PtrStoreExcl(&p_mem->FreeListPtr, p_next) == OS_FALSE);
+#else
     CPU_CRITICAL_ENTER();
+#if (OS_CFG_MEM_QUOTA_EN > 0u)
+    p_quota = (OS_MEM_QUOTA *)0;
+    if (OSIntNestingCtr == 0u) {                                /* Find the quota of the calling task (see Note #2)     */
+        p_quota = OS_MemQuotaFind(p_mem, OSTCBCurPtr);
+    }
+    if ((p_quota          != (OS_MEM_QUOTA *)0) &&
+        (p_quota->NbrUsed >= p_quota->NbrMax)) {
+        CPU_CRITICAL_EXIT();
+        OS_TRACE_MEM_GET_FAILED(p_mem);
+        OS_TRACE_MEM_GET_EXIT(OS_ERR_MEM_QUOTA_EXCEEDED);
+       *p_err = OS_ERR_MEM_QUOTA_EXCEEDED;                      /* Task already holds all the blocks it may have        */
+        return ((void *)0);
+    }
+#endif
     if (p_mem->NbrFree == 0u) {                                 /* See if there are any free memory blocks              */
         CPU_CRITICAL_EXIT();
         OS_TRACE_MEM_GET_FAILED(p_mem);
@@ -246,7 +444,16 @@ void  *OSMemGet (OS_MEM  *p_mem,
     p_blk              = p_mem->FreeListPtr;                    /* Yes, point to next free memory block                 */
     p_mem->FreeListPtr = *(void **)p_blk;                       /* Adjust pointer to new free list                      */
     p_mem->NbrFree--;                                           /* One less memory block in this partition              */
+#if (OS_CFG_MEM_QUOTA_EN > 0u)
+    OS_MemQuotaCharge(p_mem, p_blk, p_quota);
+#endif
     CPU_CRITICAL_EXIT();
+#endif
+#if (OS_CFG_MEM_CACHE_EN > 0u)
+    if ((p_mem->Opt & OS_OPT_MEM_CACHE_INV) != 0u) {            /* Discard the block's stale cache lines                */
+        OS_CPU_DCACHE_INV(p_blk, p_mem->BlkSize);
+    }
+#endif
     OS_TRACE_MEM_GET(p_mem);
     OS_TRACE_MEM_GET_EXIT(OS_ERR_NONE);
    *p_err = OS_ERR_NONE;                                        /* No error                                             */
@@ -254,6 +461,213 @@ void  *OSMemGet (OS_MEM  *p_mem,
 }
 
 
+/*
+************************************************************************************************************************
+*                                             WAIT FOR A MEMORY BLOCK
+*
+* Description : Get a memory block from a partition, waiting for one to be returned if the partition is empty.
+*
+* Arguments   : p_mem     is a pointer to the memory partition control block
+*
+*               timeout   is an optional timeout period (in clock ticks).  If non-zero, your task will wait for a block
+*                         up to the amount of time specified by this argument.  If you specify 0, however, your task
+*                         will wait forever or, until a block is returned to the partition.
+*
+*               opt       determines whether the user wants to block if the partition is empty or not:
+*
+*                             OS_OPT_PEND_BLOCKING
+*                             OS_OPT_PEND_NON_BLOCKING
+*
+*                         Add OS_OPT_PEND_ABS to make 'timeout' the value of OSTickCtr at which to give up.
+*
+*               p_err     is a pointer to a variable containing an error message which will be set by this function to
+*                         either:
+*
+*                             OS_ERR_NONE               The call was successful and your task got a memory block
+*                             OS_ERR_MEM_INVALID_P_MEM  If you passed a NULL pointer for 'p_mem'
+*                             OS_ERR_OBJ_TYPE           If 'p_mem' is not pointing at a memory partition
+*                             OS_ERR_OPT_INVALID        You specified an invalid option
+*                             OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                             OS_ERR_PEND_ABORT         The pend was aborted
+*                             OS_ERR_PEND_ISR           If you called this function from an ISR and the partition
+*                                                       is empty
+*                             OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the partition was empty or
+*                                                       your task used up its quota
+*                             OS_ERR_SCHED_LOCKED       The scheduler is locked
+*                             OS_ERR_STATUS_INVALID     If the pend status has an invalid value
+*                             OS_ERR_TIMEOUT            No block was returned within the specified timeout
+*                             OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*
+* Returns     : A pointer to a memory block if no error is detected
+*               A pointer to NULL if an error is detected
+*
+* Note(s)     : 1) This API 'MUST NOT' be called from a timer callback function.
+*
+*               2) A task that already holds as many blocks of the partition as its quota allows (see OSMemQuotaSet())
+*                  waits, even if the partition has free blocks, until one of its blocks is returned with OSMemPut().
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MEM_PEND_EN > 0u)
+void  *OSMemPend (OS_MEM   *p_mem,
+                  OS_TICK   timeout,
+                  OS_OPT    opt,
+                  OS_ERR   *p_err)
+{
+    void          *p_blk;
+#if (OS_CFG_MEM_QUOTA_EN > 0u)
+    OS_MEM_QUOTA  *p_quota;
+    OS_MEM_QTY     nbr_free;
+#endif
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to block from an ISR                     */
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != OS_OPT_PEND_NON_BLOCKING) {
+           *p_err = OS_ERR_PEND_ISR;
+            return ((void *)0);
+        }
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_mem == (OS_MEM *)0) {                                 /* Must point to a valid memory partition               */
+       *p_err = OS_ERR_MEM_INVALID_P_MEM;
+        return ((void *)0);
+    }
+    switch (opt & (OS_OPT)~OS_OPT_PEND_ABS) {                   /* Validate 'opt'                                       */
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_mem->Type != OS_OBJ_TYPE_MEM) {                       /* Make sure the memory block was created               */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return ((void *)0);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_CFG_MEM_QUOTA_EN > 0u)
+    p_quota  = (OS_MEM_QUOTA *)0;
+    if (OSIntNestingCtr == 0u) {
+        p_quota = OS_MemQuotaFind(p_mem, OSTCBCurPtr);
+    }
+    nbr_free = p_mem->NbrFree;
+    if ((p_quota          != (OS_MEM_QUOTA *)0) &&
+        (p_quota->NbrUsed >= p_quota->NbrMax)) {
+        nbr_free = 0u;                                          /* Wait for one of the task's blocks (see Note #2)      */
+    }
+    if (nbr_free > 0u) {                                        /* See if there are any free memory blocks              */
+#else
+    if (p_mem->NbrFree > 0u) {                                  /* See if there are any free memory blocks              */
+#endif
+        p_blk              = p_mem->FreeListPtr;                /* Yes, point to next free memory block                 */
+        p_mem->FreeListPtr = *(void **)p_blk;                   /* Adjust pointer to new free list                      */
+        p_mem->NbrFree--;                                       /* One less memory block in this partition              */
+#if (OS_CFG_MEM_QUOTA_EN > 0u)
+        OS_MemQuotaCharge(p_mem, p_blk, p_quota);
+#endif
+        CPU_CRITICAL_EXIT();
+#if (OS_CFG_MEM_CACHE_EN > 0u)
+        if ((p_mem->Opt & OS_OPT_MEM_CACHE_INV) != 0u) {        /* Discard the block's stale cache lines                */
+            OS_CPU_DCACHE_INV(p_blk, p_mem->BlkSize);
+        }
+#endif
+        OS_TRACE_MEM_GET(p_mem);
+       *p_err = OS_ERR_NONE;
+        return (p_blk);
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+        CPU_CRITICAL_EXIT();
+        OS_TRACE_MEM_GET_FAILED(p_mem);
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                        /* No                                                   */
+        return ((void *)0);
+    } else {
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return ((void *)0);
+        }
+    }
+
+    OS_PEND_ABS_SET(OSTCBCurPtr, opt);
+    OS_Pend((OS_PEND_OBJ *)((void *)p_mem),                     /* Block task until a block is returned                 */
+            OSTCBCurPtr,
+            OS_TASK_PEND_ON_MEM,
+            timeout);
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* Block was handed to us by OSMemPut()                 */
+             p_blk  = OSTCBCurPtr->MsgPtr;
+            *p_err  = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+             p_blk  = (void *)0;
+            *p_err  = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that we didn't get a block within TO        */
+             p_blk  = (void *)0;
+            *p_err  = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+             p_blk  = (void *)0;
+            *p_err  = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+             p_blk  = (void *)0;
+            *p_err  = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+#if (OS_CFG_MEM_CACHE_EN > 0u)
+    if ((p_blk != (void *)0) &&
+        ((p_mem->Opt & OS_OPT_MEM_CACHE_INV) != 0u)) {          /* Discard the block's stale cache lines                */
+        OS_CPU_DCACHE_INV(p_blk, p_mem->BlkSize);
+    }
+#endif
+    return (p_blk);
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                 RELEASE A MEMORY BLOCK
@@ -275,7 +689,18 @@ void  *OSMemGet (OS_MEM  *p_mem,
 *
 * Returns    : none
 *
-* Note(s)    : none
+* Note(s)    : 1) If tasks are waiting in OSMemPend(), the block is given to the highest priority one instead of being
+*                 returned to the free list, and the scheduler is called.
+*
+*              2) When OS_MEM_LOCK_FREE_EN is enabled, the block is always linked into the free list first.  Waiters are
+*                 then served from the free list with interrupts disabled, since a task may have started to pend
+*                 after seeing the partition empty but before the block was linked.
+*
+*              3) When OS_MEM_LOCK_FREE_EN is enabled, the OS_ERR_MEM_FULL check is done without disabling interrupts
+*                 and is only meant to catch gross misuse.
+*
+*              4) The block is credited to the quota it was charged to when it was allocated, whichever task releases
+*                 it.  A waiter that used up its quota is skipped unless the block belonged to it.
 ************************************************************************************************************************
 */
 
@@ -283,7 +708,20 @@ void  OSMemPut (OS_MEM  *p_mem,
                 void    *p_blk,
                 OS_ERR  *p_err)
 {
+#if (OS_CFG_MEM_PEND_EN > 0u)
+    OS_TCB        *p_tcb;
+    CPU_TS         ts;
+#if (OS_CFG_MEM_QUOTA_EN > 0u)
+    OS_MEM_QUOTA  *p_quota;
+#endif
+#endif
+#if (OS_MEM_LOCK_FREE_EN > 0u)
+    void          *p_next;
+    CPU_DATA       nbr_free;
+#endif
+#if (OS_MEM_LOCK_FREE_EN == 0u) || (OS_CFG_MEM_PEND_EN > 0u)
     CPU_SR_ALLOC();
+#endif
 
 
 
@@ -319,7 +757,61 @@ void  OSMemPut (OS_MEM  *p_mem,
     }
 #endif
 
+#if (OS_CFG_MEM_CACHE_EN > 0u)
+    if ((p_mem->Opt & OS_OPT_MEM_CACHE_CLEAN) != 0u) {          /* Write the block's dirty cache lines back to memory   */
+        OS_CPU_DCACHE_CLEAN(p_blk, p_mem->BlkSize);
+    }
+#endif
+
+#if (OS_CFG_MEM_PEND_EN > 0u)
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+#endif
+
+#if (OS_MEM_LOCK_FREE_EN > 0u)
+    if (p_mem->NbrFree >= p_mem->NbrMax) {                      /* Make sure all blocks not already returned            */
+        OS_TRACE_MEM_PUT_FAILED(p_mem);
+        OS_TRACE_MEM_PUT_EXIT(OS_ERR_MEM_FULL);
+       *p_err = OS_ERR_MEM_FULL;
+        return;
+    }
+
+    do {                                                        /* Insert released block into free block list           */
+        p_next          = OS_CPU_PtrLoadExcl(&p_mem->FreeListPtr);
+       *(void **)p_blk  = p_next;
+    } while (OS_CPU_PtrStoreExcl(&p_mem->FreeListPtr, p_blk) == OS_FALSE);
+
+    do {                                                        /* One more memory block in this partition              */
+        nbr_free = OS_CPU_DataLoadExcl(&p_mem->NbrFree);
+    } while (OS_CPU_DataStoreExcl(&p_mem->NbrFree, nbr_free + 1u) == OS_FALSE);
 
+#if (OS_CFG_MEM_PEND_EN > 0u)
+    if (p_mem->PendList.HeadPtr != (OS_TCB *)0) {               /* Any task waiting for a block? (see Note #2)          */
+        CPU_CRITICAL_ENTER();
+        p_tcb = p_mem->PendList.HeadPtr;
+        while ((p_tcb != (OS_TCB *)0) && (p_mem->NbrFree > 0u)) {
+            p_blk              = p_mem->FreeListPtr;            /* Yes, hand a free block to the highest prio. waiter   */
+            p_mem->FreeListPtr = *(void **)p_blk;
+            p_mem->NbrFree--;
+            OS_Post((OS_PEND_OBJ *)((void *)p_mem),
+                    p_tcb,
+                    p_blk,
+                    p_mem->BlkSize,
+                    ts);
+            p_tcb = p_mem->PendList.HeadPtr;
+        }
+        CPU_CRITICAL_EXIT();
+        OS_TRACE_MEM_PUT(p_mem);
+        OS_TRACE_MEM_PUT_EXIT(OS_ERR_NONE);
+        OSSched();                                              /* Run the scheduler                                    */
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+#endif
+#else
     CPU_CRITICAL_ENTER();
     if (p_mem->NbrFree >= p_mem->NbrMax) {                      /* Make sure all blocks not already returned            */
         CPU_CRITICAL_EXIT();
@@ -328,10 +820,44 @@ void  OSMemPut (OS_MEM  *p_mem,
        *p_err = OS_ERR_MEM_FULL;
         return;
     }
+#if (OS_CFG_MEM_QUOTA_EN > 0u)
+    OS_MemQuotaCredit(p_mem, p_blk);                            /* See Note #4                                          */
+#endif
+#if (OS_CFG_MEM_PEND_EN > 0u)
+    p_tcb = p_mem->PendList.HeadPtr;
+#if (OS_CFG_MEM_QUOTA_EN > 0u)
+    p_quota = (OS_MEM_QUOTA *)0;
+    while (p_tcb != (OS_TCB *)0) {                              /* Skip the waiters that used up their quota            */
+        p_quota = OS_MemQuotaFind(p_mem, p_tcb);
+        if ((p_quota          == (OS_MEM_QUOTA *)0) ||
+            (p_quota->NbrUsed <  p_quota->NbrMax)) {
+            break;
+        }
+        p_tcb = p_tcb->PendNextPtr;
+    }
+#endif
+    if (p_tcb != (OS_TCB *)0) {                                 /* Any task waiting for a block?                        */
+#if (OS_CFG_MEM_QUOTA_EN > 0u)
+        OS_MemQuotaCharge(p_mem, p_blk, p_quota);               /* Charge the block to the waiter's quota               */
+#endif
+        OS_Post((OS_PEND_OBJ *)((void *)p_mem),                 /* Yes, hand the block directly to the highest prio.    */
+                p_tcb,
+                p_blk,
+                p_mem->BlkSize,
+                ts);
+        CPU_CRITICAL_EXIT();
+        OS_TRACE_MEM_PUT(p_mem);
+        OS_TRACE_MEM_PUT_EXIT(OS_ERR_NONE);
+        OSSched();                                              /* Run the scheduler                                    */
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+#endif
     *(void **)p_blk    = p_mem->FreeListPtr;                    /* Insert released block into free block list           */
     p_mem->FreeListPtr = p_blk;
     p_mem->NbrFree++;                                           /* One more memory block in this partition              */
     CPU_CRITICAL_EXIT();
+#endif
     OS_TRACE_MEM_PUT(p_mem);
     OS_TRACE_MEM_PUT_EXIT(OS_ERR_NONE);
    *p_err              = OS_ERR_NONE;                           /* Notify caller that memory block was released         */
@@ -340,29 +866,978 @@ void  OSMemPut (OS_MEM  *p_mem,
 
 /*
 ************************************************************************************************************************
-*                                           ADD MEMORY PARTITION TO DEBUG LIST
+*                                           INITIALIZE A MEMORY MAGAZINE
 *
-* Description : This function is called by OSMemCreate() to add the memory partition to the debug table.
+* Description : Initialize a magazine, a small private cache of blocks from a memory partition used by a single task.
+*               Blocks are moved between the magazine and the partition in batches so that most calls to
+*               OSMemMagGet() and OSMemMagPut() don't need to disable interrupts.
 *
-* Arguments   : p_mem    Is a pointer to the memory partition
+* Arguments   : p_mag    is a pointer to the magazine, allocated in user memory space.  It would typically be stored in
+*                        the task's extension ('p_ext') or in a TLS entry.
+*
+*               p_mem    is a pointer to the memory partition the magazine caches blocks from
+*
+*               size     is the maximum number of blocks the magazine can hold (must be >= 2).  Refills and flushes
+*                        move 'size / 2' blocks at a time.
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               If the magazine was initialized
+*                            OS_ERR_MEM_INVALID_BLKS   If 'size' is less than 2
+*                            OS_ERR_MEM_INVALID_P_DATA If you passed a NULL pointer for 'p_mag'
+*                            OS_ERR_MEM_INVALID_P_MEM  If you passed a NULL pointer for 'p_mem'
+*                            OS_ERR_OBJ_TYPE           If 'p_mem' is not pointing at a memory partition
 *
 * Returns     : none
 *
-* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+* Note(s)     : 1) A magazine MUST only be used by one task and MUST NOT be used from an ISR.
+*
+*               2) The blocks held by a magazine are not counted in the partition's 'NbrFree'.  Call OSMemMagFlush() to
+*                  return them to the partition, e.g. before the task is deleted.  When OS_CFG_DBG_EN is enabled, the
+*                  magazines of a partition are linked from its 'MagDbgListPtr' so a debugger can account for them.
 ************************************************************************************************************************
 */
 
-#if (OS_CFG_DBG_EN > 0u)
-void  OS_MemDbgListAdd (OS_MEM  *p_mem)
+#if (OS_CFG_MEM_MAG_EN > 0u)
+void  OSMemMagInit (OS_MEM_MAG  *p_mag,
+                    OS_MEM      *p_mem,
+                    OS_MEM_QTY   size,
+                    OS_ERR      *p_err)
 {
-    p_mem->DbgPrevPtr               = (OS_MEM *)0;
-    if (OSMemDbgListPtr == (OS_MEM *)0) {
-        p_mem->DbgNextPtr           = (OS_MEM *)0;
-    } else {
-        p_mem->DbgNextPtr           =  OSMemDbgListPtr;
-        OSMemDbgListPtr->DbgPrevPtr =  p_mem;
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_SR_ALLOC();
+#endif
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
     }
-    OSMemDbgListPtr                 =  p_mem;
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_mag == (OS_MEM_MAG *)0) {                             /* Must point to a valid magazine                       */
+       *p_err = OS_ERR_MEM_INVALID_P_DATA;
+        return;
+    }
+    if (p_mem == (OS_MEM *)0) {                                 /* Must point to a valid memory partition               */
+       *p_err = OS_ERR_MEM_INVALID_P_MEM;
+        return;
+    }
+    if (size < 2u) {                                            /* Must be able to move at least one block per batch    */
+       *p_err = OS_ERR_MEM_INVALID_BLKS;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_mem->Type != OS_OBJ_TYPE_MEM) {                       /* Make sure the memory partition was created           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    p_mag->MemPtr      = p_mem;
+    p_mag->FreeListPtr = (void *)0;
+    p_mag->NbrFree     = 0u;
+    p_mag->NbrMax      = size;
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CRITICAL_ENTER();
+    p_mag->DbgNextPtr  = p_mem->MagDbgListPtr;                  /* Add the magazine to the partition's debug list       */
+    p_mem->MagDbgListPtr = p_mag;
+    CPU_CRITICAL_EXIT();
+#endif
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                          GET A MEMORY BLOCK FROM A MAGAZINE
+*
+* Description : Get a memory block from a magazine.  If the magazine is empty, it is first refilled with up to
+*               'size / 2' blocks taken from the partition in a single critical section.
+*
+* Arguments   : p_mag    is a pointer to the magazine
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               If a block was obtained
+*                            OS_ERR_MEM_INVALID_P_DATA If you passed a NULL pointer for 'p_mag'
+*                            OS_ERR_MEM_NO_FREE_BLKS   If both the magazine and the partition are empty
+*
+* Returns     : A pointer to a memory block if no error is detected
+*               A pointer to NULL if an error is detected
+*
+* Note(s)     : none
+************************************************************************************************************************
+*/
+
+void  *OSMemMagGet (OS_MEM_MAG  *p_mag,
+                    OS_ERR      *p_err)
+{
+    OS_MEM      *p_mem;
+    void        *p_blk;
+    void        *p_last;
+    OS_MEM_QTY   nbr;
+    OS_MEM_QTY   i;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_mag == (OS_MEM_MAG *)0) {                             /* Must point to a valid magazine                       */
+       *p_err = OS_ERR_MEM_INVALID_P_DATA;
+        return ((void *)0);
+    }
+#endif
+
+    if (p_mag->NbrFree == 0u) {                                 /* Magazine empty, refill it from the partition         */
+        p_mem = p_mag->MemPtr;
+        CPU_CRITICAL_ENTER();
+        nbr = p_mag->NbrMax / 2u;
+        if (nbr > p_mem->NbrFree) {
+            nbr = p_mem->NbrFree;
+        }
+        if (nbr == 0u) {
+            CPU_CRITICAL_EXIT();
+            OS_TRACE_MEM_GET_FAILED(p_mem);
+           *p_err = OS_ERR_MEM_NO_FREE_BLKS;
+            return ((void *)0);
+        }
+        p_blk  = p_mem->FreeListPtr;                            /* Detach 'nbr' blocks from the head of the free list   */
+        p_last = p_blk;
+        for (i = 1u; i < nbr; i++) {
+            p_last = *(void **)p_last;
+        }
+        p_mem->FreeListPtr  = *(void **)p_last;
+        p_mem->NbrFree     -= nbr;
+        CPU_CRITICAL_EXIT();
+       *(void **)p_last     = (void *)0;
+        p_mag->FreeListPtr  = p_blk;
+        p_mag->NbrFree      = nbr;
+    }
+
+    p_blk              = p_mag->FreeListPtr;                    /* Take a block from the magazine                       */
+    p_mag->FreeListPtr = *(void **)p_blk;
+    p_mag->NbrFree--;
+#if (OS_CFG_MEM_CACHE_EN > 0u)
+    p_mem = p_mag->MemPtr;
+    if ((p_mem->Opt & OS_OPT_MEM_CACHE_INV) != 0u) {            /* Discard the block's stale cache lines                */
+        OS_CPU_DCACHE_INV(p_blk, p_mem->BlkSize);
+    }
+#endif
+   *p_err = OS_ERR_NONE;
+    return (p_blk);
+}
+
+
+/*
+************************************************************************************************************************
+*                                          RELEASE A MEMORY BLOCK TO A MAGAZINE
+*
+* Description : Returns a memory block to a magazine.  If the magazine is full, 'size / 2' of its blocks are first
+*               returned to the partition in a single critical section.
+*
+* Arguments   : p_mag    is a pointer to the magazine
+*
+*               p_blk    is a pointer to the memory block being released.  It MUST belong to the magazine's partition.
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               If the memory block was released
+*                            OS_ERR_MEM_FULL           If the partition and the magazine already hold all the blocks
+*                            OS_ERR_MEM_INVALID_P_BLK  If you passed a NULL pointer for the block to release
+*                            OS_ERR_MEM_INVALID_P_DATA If you passed a NULL pointer for 'p_mag'
+*
+*                        or any of the errors returned by OSMemPut().
+*
+* Returns     : none
+*
+* Note(s)     : 1) When tasks are waiting in OSMemPend() for a block of the partition, the block is given to them
+*                  with OSMemPut() instead of being kept in the magazine.
+************************************************************************************************************************
+*/
+
+void  OSMemMagPut (OS_MEM_MAG  *p_mag,
+                   void        *p_blk,
+                   OS_ERR      *p_err)
+{
+    OS_MEM      *p_mem;
+    void        *p_first;
+    void        *p_last;
+    OS_MEM_QTY   nbr;
+    OS_MEM_QTY   i;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_mag == (OS_MEM_MAG *)0) {                             /* Must point to a valid magazine                       */
+       *p_err = OS_ERR_MEM_INVALID_P_DATA;
+        return;
+    }
+    if (p_blk == (void *)0) {                                   /* Must release a valid block                           */
+       *p_err = OS_ERR_MEM_INVALID_P_BLK;
+        return;
+    }
+#endif
+
+    p_mem = p_mag->MemPtr;
+    if (p_mag->NbrMax == 0u) {                                  /* Magazine was flushed, bypass it                      */
+        OSMemPut(p_mem, p_blk, p_err);
+        return;
+    }
+#if (OS_CFG_MEM_PEND_EN > 0u)
+    if (p_mem->PendList.HeadPtr != (OS_TCB *)0) {               /* Don't hold on to blocks other tasks are waiting for  */
+        OSMemPut(p_mem, p_blk, p_err);
+        return;
+    }
+#endif
+#if (OS_CFG_MEM_CACHE_EN > 0u)
+    if ((p_mem->Opt & OS_OPT_MEM_CACHE_CLEAN) != 0u) {          /* Write the block's dirty cache lines back to memory   */
+        OS_CPU_DCACHE_CLEAN(p_blk, p_mem->BlkSize);
+    }
+#endif
+
+    if (p_mag->NbrFree >= p_mag->NbrMax) {                      /* Magazine full, flush half of it to the partition     */
+        nbr     = p_mag->NbrMax / 2u;
+        p_first = p_mag->FreeListPtr;
+        p_last  = p_first;
+        for (i = 1u; i < nbr; i++) {
+            p_last = *(void **)p_last;
+        }
+        p_mag->FreeListPtr = *(void **)p_last;
+        p_mag->NbrFree    -= nbr;
+        CPU_CRITICAL_ENTER();
+       *(void **)p_last     = p_mem->FreeListPtr;               /* Splice the blocks at the head of the free list       */
+        p_mem->FreeListPtr  = p_first;
+        p_mem->NbrFree     += nbr;
+        CPU_CRITICAL_EXIT();
+    }
+
+    if ((p_mem->NbrFree + p_mag->NbrFree) >= p_mem->NbrMax) {
+       *p_err = OS_ERR_MEM_FULL;                                /* More blocks returned than were allocated             */
+        return;
+    }
+   *(void **)p_blk     = p_mag->FreeListPtr;                    /* Keep the block in the magazine                       */
+    p_mag->FreeListPtr = p_blk;
+    p_mag->NbrFree++;
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                             FLUSH A MEMORY MAGAZINE
+*
+* Description : Returns all the blocks held by a magazine to its partition.  Afterwards, OSMemMagPut() releases blocks
+*               directly to the partition and OSMemMagGet() fails until the magazine is initialized again with
+*               OSMemMagInit().
+*
+* Arguments   : p_mag    is a pointer to the magazine
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               If the blocks were returned to the partition
+*                            OS_ERR_MEM_INVALID_P_DATA If you passed a NULL pointer for 'p_mag'
+*
+* Returns     : none
+*
+* Note(s)     : 1) Tasks waiting in OSMemPend() are not readied by this function (the magazine never holds blocks
+*                  while there are waiters, see OSMemMagPut()).
+************************************************************************************************************************
+*/
+
+void  OSMemMagFlush (OS_MEM_MAG  *p_mag,
+                     OS_ERR      *p_err)
+{
+    OS_MEM       *p_mem;
+    void         *p_last;
+#if (OS_CFG_DBG_EN > 0u)
+    OS_MEM_MAG  **p_link;
+#endif
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_mag == (OS_MEM_MAG *)0) {                             /* Must point to a valid magazine                       */
+       *p_err = OS_ERR_MEM_INVALID_P_DATA;
+        return;
+    }
+#endif
+
+    p_mem  = p_mag->MemPtr;
+    p_last = p_mag->FreeListPtr;
+    if (p_last != (void *)0) {                                  /* Find the last block held by the magazine             */
+        while (*(void **)p_last != (void *)0) {
+            p_last = *(void **)p_last;
+        }
+    }
+
+    CPU_CRITICAL_ENTER();
+    if (p_last != (void *)0) {
+       *(void **)p_last     = p_mem->FreeListPtr;               /* Splice the blocks at the head of the free list       */
+        p_mem->FreeListPtr  = p_mag->FreeListPtr;
+        p_mem->NbrFree     += p_mag->NbrFree;
+    }
+#if (OS_CFG_DBG_EN > 0u)
+    p_link = &p_mem->MagDbgListPtr;                             /* Remove the magazine from the partition's debug list  */
+    while ((*p_link != (OS_MEM_MAG *)0) &&
+           (*p_link != p_mag)) {
+        p_link = &(*p_link)->DbgNextPtr;
+    }
+    if (*p_link == p_mag) {
+       *p_link = p_mag->DbgNextPtr;
+    }
+#endif
+    CPU_CRITICAL_EXIT();
+
+    p_mag->FreeListPtr = (void *)0;
+    p_mag->NbrFree     = 0u;
+    p_mag->NbrMax      = 0u;
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                         GET A REFERENCE-COUNTED BUFFER
+*
+* Description : Get a block from a partition to use as a buffer shared by several tasks without copying.  The caller
+*               holds the only reference to the buffer.  Each task given the buffer with OSMemBufRef() or through
+*               OSQPost()/OSTaskQPost() and OS_OPT_POST_MEM_BUF_REF holds another one, and the block goes back to the
+*               partition when the last of them is released with OSMemBufRelease().
+*
+* Arguments   : p_mem      is a pointer to the memory partition control block
+*
+*               p_release  is a pointer to a function called when the last reference is released, just before the
+*                          block is returned to the partition, or a NULL pointer if none is needed.  It is passed the
+*                          pointer returned by this function.
+*
+*               p_err      is a pointer to a variable containing an error message which will be set by this function to
+*                          either:
+*
+*                              OS_ERR_NONE               If a buffer is available
+*                              OS_ERR_MEM_INVALID_P_MEM  If you passed a NULL pointer for 'p_mem'
+*                              OS_ERR_MEM_INVALID_SIZE   If the blocks of 'p_mem' are too small to hold an OS_MEM_BUF
+*                              OS_ERR_MEM_NO_FREE_BLKS   If there are no more free memory blocks to allocate
+*                              OS_ERR_OBJ_TYPE           If 'p_mem' is not pointing at a memory partition
+*
+* Returns     : A pointer to the data of the buffer, which holds 'BlkSize - sizeof(OS_MEM_BUF)' bytes
+*               A pointer to NULL if an error is detected
+*
+* Note(s)     : 1) The data follows the OS_MEM_BUF header of the block (see  MEMORY PARTITIONS  Note #3 in os.h).  The
+*                  pointer returned MUST NOT be given to OSMemPut().
+*
+*               2) 'p_release' runs in the context of the task or ISR that releases the last reference.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MEM_BUF_EN > 0u)
+void  *OSMemBufGet (OS_MEM                  *p_mem,
+                    OS_MEM_BUF_RELEASE_PTR   p_release,
+                    OS_ERR                  *p_err)
+{
+    OS_MEM_BUF  *p_buf;
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_mem == (OS_MEM *)0) {                                 /* Must point to a valid memory partition               */
+       *p_err = OS_ERR_MEM_INVALID_P_MEM;
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_mem->Type != OS_OBJ_TYPE_MEM) {                       /* Make sure the memory block was created               */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return ((void *)0);
+    }
+#endif
+
+    if (p_mem->BlkSize <= sizeof(OS_MEM_BUF)) {                 /* Must leave room for data after the header            */
+       *p_err = OS_ERR_MEM_INVALID_SIZE;
+        return ((void *)0);
+    }
+
+    p_buf = (OS_MEM_BUF *)OSMemGet(p_mem, p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return ((void *)0);
+    }
+    p_buf->MemPtr     = p_mem;                                  /* The block is only seen by the caller so far          */
+    p_buf->ReleasePtr = p_release;
+    p_buf->RefCtr     = 1u;
+    return ((void *)(p_buf + 1));                               /* Give out the data that follows the header            */
+}
+
+
+/*
+************************************************************************************************************************
+*                                     ADD A REFERENCE TO A REFERENCE-COUNTED BUFFER
+*
+* Description : Add a reference to a buffer obtained with OSMemBufGet(), typically before handing it to another task.
+*
+* Arguments   : p_data   is the pointer returned by OSMemBufGet()
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               If the reference was added
+*                            OS_ERR_MEM_BUF_REF_NONE   If the buffer was already released
+*                            OS_ERR_MEM_INVALID_P_DATA If you passed a NULL pointer for 'p_data'
+*
+* Returns     : none
+*
+* Note(s)     : 1) The caller MUST hold a reference to the buffer.  OS_ERR_MEM_BUF_REF_NONE is only meant to catch gross
+*                  misuse since the block may already have been reused.
+*
+*               2) This function may be called from an ISR.
+************************************************************************************************************************
+*/
+
+void  OSMemBufRef (void    *p_data,
+                   OS_ERR  *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_data == (void *)0) {                                  /* Must point to the data of a buffer                   */
+       *p_err = OS_ERR_MEM_INVALID_P_DATA;
+        return;
+    }
+#endif
+
+    if (OS_MemBufRefAdd(p_data) == OS_FALSE) {
+       *p_err = OS_ERR_MEM_BUF_REF_NONE;
+        return;
+    }
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                      RELEASE A REFERENCE-COUNTED BUFFER
+*
+* Description : Drop a reference to a buffer obtained with OSMemBufGet().  When the last reference is dropped, the
+*               release function given to OSMemBufGet() is called and the block is returned to its partition with
+*               OSMemPut(), readying a task waiting in OSMemPend() if there is one.
+*
+* Arguments   : p_data   is the pointer returned by OSMemBufGet()
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               If the reference was released
+*                            OS_ERR_MEM_BUF_REF_NONE   If the buffer was already released
+*                            OS_ERR_MEM_INVALID_P_DATA If you passed a NULL pointer for 'p_data'
+*
+*                        or any error code returned by OSMemPut() when the last reference is released.
+*
+* Returns     : none
+*
+* Note(s)     : 1) The caller MUST NOT access the data once it has released its reference.
+*
+*               2) This function may be called from an ISR.
+************************************************************************************************************************
+*/
+
+void  OSMemBufRelease (void    *p_data,
+                       OS_ERR  *p_err)
+{
+    OS_MEM_BUF  *p_buf;
+    CPU_DATA     ref_ctr;
+#if (OS_MEM_BUF_ATOMIC_EN == 0u)
+    CPU_SR_ALLOC();
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_data == (void *)0) {                                  /* Must point to the data of a buffer                   */
+       *p_err = OS_ERR_MEM_INVALID_P_DATA;
+        return;
+    }
+#endif
+
+    p_buf = (OS_MEM_BUF *)p_data - 1;                           /* Point to the header in front of the data             */
+#if (OS_MEM_BUF_ATOMIC_EN > 0u)
+    do {                                                        /* One less reference to the buffer                     */
+        ref_ctr = OS_CPU_DataLoadExcl(&p_buf->RefCtr);
+        if (ref_ctr == 0u) {
+           *p_err = OS_ERR_MEM_BUF_REF_NONE;
+            return;
+        }
+    } while (OS_CPU_DataStoreExcl(&p_buf->RefCtr, ref_ctr - 1u) == OS_FALSE);
+#else
+    CPU_CRITICAL_ENTER();
+    ref_ctr = p_buf->RefCtr;
+    if (ref_ctr == 0u) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_MEM_BUF_REF_NONE;
+        return;
+    }
+    p_buf->RefCtr = ref_ctr - 1u;                               /* One less reference to the buffer                     */
+    CPU_CRITICAL_EXIT();
+#endif
+
+    if (ref_ctr == 1u) {                                        /* Was it the last one?                                 */
+        if (p_buf->ReleasePtr != (OS_MEM_BUF_RELEASE_PTR)0) {
+            (*p_buf->ReleasePtr)(p_data);                       /* Yes, let the application clean up the buffer ...     */
+        }
+        OSMemPut(p_buf->MemPtr,                                 /* ... and return the block to its partition            */
+                 (void *)p_buf,
+                 p_err);
+        return;
+    }
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                    ADD A REFERENCE TO A REFERENCE-COUNTED BUFFER
+*
+* Description : This function adds a reference to a buffer obtained with OSMemBufGet().  It is called by OSMemBufRef()
+*               and by the post functions for each receiver when OS_OPT_POST_MEM_BUF_REF is specified.
+*
+* Arguments   : p_data   is the pointer returned by OSMemBufGet()
+*
+* Returns     : OS_TRUE  if the reference was added
+*               OS_FALSE if the buffer had no reference left
+*
+* Note(s)     : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*               2) This function may be called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+CPU_BOOLEAN  OS_MemBufRefAdd (void  *p_data)
+{
+    OS_MEM_BUF  *p_buf;
+    CPU_DATA     ref_ctr;
+#if (OS_MEM_BUF_ATOMIC_EN == 0u)
+    CPU_SR_ALLOC();
+#endif
+
+
+    p_buf = (OS_MEM_BUF *)p_data - 1;                           /* Point to the header in front of the data             */
+#if (OS_MEM_BUF_ATOMIC_EN > 0u)
+    do {
+        ref_ctr = OS_CPU_DataLoadExcl(&p_buf->RefCtr);
+        if (ref_ctr == 0u) {                                    /* Can't revive a buffer that was released              */
+            return (OS_FALSE);
+        }
+    } while (OS_CPU_DataStoreExcl(&p_buf->RefCtr, ref_ctr + 1u) == OS_FALSE);
+#else
+    CPU_CRITICAL_ENTER();
+    ref_ctr = p_buf->RefCtr;
+    if (ref_ctr == 0u) {                                        /* Can't revive a buffer that was released              */
+        CPU_CRITICAL_EXIT();
+        return (OS_FALSE);
+    }
+    p_buf->RefCtr = ref_ctr + 1u;
+    CPU_CRITICAL_EXIT();
+#endif
+    return (OS_TRUE);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                        SET THE QUOTA TABLE OF A MEMORY PARTITION
+*
+* Description : Enable per-task quotas on a memory partition.
+*
+* Arguments   : p_mem    is a pointer to the memory partition control block
+*
+*               p_tbl    is a pointer to an array of 'p_mem->NbrMax' entries, allocated in user memory space, that will
+*                        hold the quota each block of the partition is charged to.
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               If quotas are enabled on the partition
+*                            OS_ERR_MEM_INVALID_P_DATA If you passed a NULL pointer for 'p_tbl'
+*                            OS_ERR_MEM_INVALID_P_MEM  If you passed a NULL pointer for 'p_mem'
+*                            OS_ERR_OBJ_TYPE           If 'p_mem' is not pointing at a memory partition
+*                            OS_ERR_STATE_INVALID      If the partition already has a quota table
+*
+* Returns     : none
+*
+* Note(s)     : 1) The table records which quota to credit when a block is returned, so a block can be released by
+*                  another task than the one it was charged to.  Blocks already allocated when the table is set are
+*                  not charged to any quota.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MEM_QUOTA_EN > 0u)
+void  OSMemQuotaTblSet (OS_MEM         *p_mem,
+                        OS_MEM_QUOTA  **p_tbl,
+                        OS_ERR         *p_err)
+{
+    OS_MEM_QTY  i;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_mem == (OS_MEM *)0) {                                 /* Must point to a valid memory partition               */
+       *p_err = OS_ERR_MEM_INVALID_P_MEM;
+        return;
+    }
+    if (p_tbl == (OS_MEM_QUOTA **)0) {                          /* Must point to a valid table                          */
+       *p_err = OS_ERR_MEM_INVALID_P_DATA;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_mem->Type != OS_OBJ_TYPE_MEM) {                       /* Make sure the memory partition was created           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    for (i = 0u; i < p_mem->NbrMax; i++) {                      /* No block is charged to a quota yet (see Note #1)     */
+        p_tbl[i] = (OS_MEM_QUOTA *)0;
+    }
+
+    CPU_CRITICAL_ENTER();
+    if (p_mem->QuotaTbl != (OS_MEM_QUOTA **)0) {                /* The table can only be set once                       */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_STATE_INVALID;
+        return;
+    }
+    p_mem->QuotaTbl = p_tbl;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                        SET THE QUOTA OF A TASK ON A MEMORY PARTITION
+*
+* Description : Limit the number of blocks of a memory partition a task can hold at the same time.
+*
+* Arguments   : p_mem      is a pointer to the memory partition control block
+*
+*               p_tcb      is a pointer to the TCB of the task.  A NULL pointer specifies the calling task.
+*
+*               p_quota    is a pointer to the quota, allocated in user memory space.  It holds the number of blocks of
+*                          the partition the task holds ('.NbrUsed') and the peak of that number ('.NbrUsedMax').
+*
+*               nbr_max    is the maximum number of blocks of the partition the task can hold.
+*
+*               p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE               If the quota was set
+*                              OS_ERR_MEM_INVALID_P_DATA If you passed a NULL pointer for 'p_quota'
+*                              OS_ERR_MEM_INVALID_P_MEM  If you passed a NULL pointer for 'p_mem'
+*                              OS_ERR_MEM_QUOTA_EXISTS   If the task already has another quota on the partition
+*                              OS_ERR_MEM_QUOTA_NOT_EN   If OSMemQuotaTblSet() was not called for the partition
+*                              OS_ERR_OBJ_TYPE           If 'p_mem' is not pointing at a memory partition
+*                              OS_ERR_TASK_NOT_EXIST     If the task doesn't exist
+*
+* Returns     : none
+*
+* Note(s)     : 1) Calling this function again with the same 'p_quota' only changes '.NbrMax'.  Otherwise 'p_quota' is
+*                  attached to the task with its counters cleared, and MUST NOT be attached to any other task.
+*
+*               2) When the task is deleted, its quotas are detached from it.  The blocks it still holds are
+*                  credited to them when they are returned, so a quota MUST remain allocated until then.
+*
+*               3) Lowering '.NbrMax' below '.NbrUsed' does not release any block.  Raising it does not ready a task
+*                  waiting in OSMemPend(); the next call to OSMemPut() does.
+************************************************************************************************************************
+*/
+
+void  OSMemQuotaSet (OS_MEM        *p_mem,
+                     OS_TCB        *p_tcb,
+                     OS_MEM_QUOTA  *p_quota,
+                     OS_MEM_QTY     nbr_max,
+                     OS_ERR        *p_err)
+{
+    OS_MEM_QUOTA  *p_quota_cur;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_mem == (OS_MEM *)0) {                                 /* Must point to a valid memory partition               */
+       *p_err = OS_ERR_MEM_INVALID_P_MEM;
+        return;
+    }
+    if (p_quota == (OS_MEM_QUOTA *)0) {                         /* Must point to a valid quota                          */
+       *p_err = OS_ERR_MEM_INVALID_P_DATA;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_mem->Type != OS_OBJ_TYPE_MEM) {                       /* Make sure the memory partition was created           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {                                 /* Set the quota of the calling task?                   */
+        p_tcb = OSTCBCurPtr;
+    }
+    if (p_tcb->TaskState == OS_TASK_STATE_DEL) {                /* Make sure task exist                                 */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_TASK_NOT_EXIST;
+        return;
+    }
+    if (p_mem->QuotaTbl == (OS_MEM_QUOTA **)0) {                /* Quotas must be enabled on the partition              */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_MEM_QUOTA_NOT_EN;
+        return;
+    }
+
+    p_quota_cur = OS_MemQuotaFind(p_mem, p_tcb);
+    if (p_quota_cur == p_quota) {                               /* Only change the limit (see Note #1)                  */
+        p_quota->NbrMax = nbr_max;
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+    if (p_quota_cur != (OS_MEM_QUOTA *)0) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_MEM_QUOTA_EXISTS;
+        return;
+    }
+
+    p_quota->MemPtr        = p_mem;                             /* Attach the quota to the task                         */
+    p_quota->TCBPtr        = p_tcb;
+    p_quota->NbrMax        = nbr_max;
+    p_quota->NbrUsed       = 0u;
+    p_quota->NbrUsedMax    = 0u;
+    p_quota->NextPtr       = p_tcb->MemQuotaListPtr;
+    p_tcb->MemQuotaListPtr = p_quota;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                             DETACH THE QUOTAS OF A TASK
+*
+* Description: This function is called by OSTaskDel() to detach the memory partition quotas of the task being deleted.
+*
+* Arguments  : p_tcb      is a pointer to the TCB of the task
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.  It is called with
+*                 interrupts disabled.
+*
+*              2) The quotas stay referenced by the quota tables of the partitions for the blocks the task still
+*                 holds, see OSMemQuotaSet() Note #2.
+************************************************************************************************************************
+*/
+
+void  OS_MemQuotaTaskDel (OS_TCB  *p_tcb)
+{
+    OS_MEM_QUOTA  *p_quota;
+
+
+    p_quota = p_tcb->MemQuotaListPtr;
+    while (p_quota != (OS_MEM_QUOTA *)0) {
+        p_quota->TCBPtr = (OS_TCB *)0;
+        p_quota         = p_quota->NextPtr;
+    }
+    p_tcb->MemQuotaListPtr = (OS_MEM_QUOTA *)0;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              FIND/CHARGE/CREDIT A QUOTA
+*
+* Description: OS_MemQuotaFind() returns the quota of a task on a memory partition, or NULL if it has none.
+*
+*              OS_MemQuotaCharge() records the quota a block is charged to and counts the block in that quota.
+*
+*              OS_MemQuotaCredit() removes a block from the quota it was charged to.
+*
+* Arguments  : p_mem      is a pointer to the memory partition
+*              -----
+*
+*              p_tcb      is a pointer to the TCB of the task, NULL if none
+*
+*              p_blk      is a pointer to the block
+*
+*              p_quota    is a pointer to the quota to charge, NULL if none
+*
+* Returns    : see description
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application should not call them.  They are called
+*                 with interrupts disabled.
+*
+*              2) A task usually has a quota on few partitions, so its list of quotas is searched linearly.
+************************************************************************************************************************
+*/
+
+static  OS_MEM_QUOTA  *OS_MemQuotaFind (OS_MEM  *p_mem,
+                                        OS_TCB  *p_tcb)
+{
+    OS_MEM_QUOTA  *p_quota;
+
+
+    if ((p_mem->QuotaTbl == (OS_MEM_QUOTA **)0) ||
+        (p_tcb           == (OS_TCB        *)0)) {
+        return ((OS_MEM_QUOTA *)0);
+    }
+    p_quota = p_tcb->MemQuotaListPtr;                           /* See Note #2                                          */
+    while (p_quota != (OS_MEM_QUOTA *)0) {
+        if (p_quota->MemPtr == p_mem) {
+            break;
+        }
+        p_quota = p_quota->NextPtr;
+    }
+    return (p_quota);
+}
+
+
+static  void  OS_MemQuotaCharge (OS_MEM        *p_mem,
+                                 void          *p_blk,
+                                 OS_MEM_QUOTA  *p_quota)
+{
+    OS_MEM_QTY  ix;
+
+
+    if (p_mem->QuotaTbl == (OS_MEM_QUOTA **)0) {
+        return;
+    }
+    ix                  = (OS_MEM_QTY)(((CPU_ADDR)p_blk - (CPU_ADDR)p_mem->AddrPtr) / p_mem->BlkSize);
+    p_mem->QuotaTbl[ix] = p_quota;
+    if (p_quota != (OS_MEM_QUOTA *)0) {
+        p_quota->NbrUsed++;
+        if (p_quota->NbrUsedMax < p_quota->NbrUsed) {           /* Update the high-water mark of the task               */
+            p_quota->NbrUsedMax = p_quota->NbrUsed;
+        }
+    }
+}
+
+
+static  void  OS_MemQuotaCredit (OS_MEM  *p_mem,
+                                 void    *p_blk)
+{
+    OS_MEM_QUOTA  *p_quota;
+    CPU_ADDR       offset;
+    OS_MEM_QTY     ix;
+
+
+    if (p_mem->QuotaTbl == (OS_MEM_QUOTA **)0) {
+        return;
+    }
+    offset = (CPU_ADDR)p_blk - (CPU_ADDR)p_mem->AddrPtr;
+    if (offset >= ((CPU_ADDR)p_mem->NbrMax * (CPU_ADDR)p_mem->BlkSize)) {
+        return;                                                 /* Not a block of this partition                        */
+    }
+    ix      = (OS_MEM_QTY)(offset / p_mem->BlkSize);
+    p_quota = p_mem->QuotaTbl[ix];
+    if (p_quota != (OS_MEM_QUOTA *)0) {
+        p_mem->QuotaTbl[ix] = (OS_MEM_QUOTA *)0;
+        if (p_quota->NbrUsed > 0u) {
+            p_quota->NbrUsed--;
+        }
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                           ADD MEMORY PARTITION TO DEBUG LIST
+*
+* Description : This function is called by OSMemCreate() to add the memory partition to the debug table.
+*
+* Arguments   : p_mem    Is a pointer to the memory partition
+*
+* Returns     : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN > 0u)
+void  OS_MemDbgListAdd (OS_MEM  *p_mem)
+{
+    p_mem->DbgPrevPtr               = (OS_MEM *)0;
+    if (OSMemDbgListPtr == (OS_MEM *)0) {
+        p_mem->DbgNextPtr           = (OS_MEM *)0;
+    } else {
+        p_mem->DbgNextPtr           =  OSMemDbgListPtr;
+        OSMemDbgListPtr->DbgPrevPtr =  p_mem;
+    }
+    OSMemDbgListPtr                 =  p_mem;
+
+#if (OS_CFG_OBJ_REG_EN > 0u)
+    OS_ObjRegAdd((void *)p_mem, OS_OBJ_TYPE_MEM, p_mem->NamePtr);
+#endif
 }
 #endif
 
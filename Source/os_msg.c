@@ -32,6 +32,44 @@ const  CPU_CHAR  *os_msg__c = "$Id: $";
 
 
 #if (OS_MSG_EN > 0u)
+/*
+************************************************************************************************************************
+*                                                    LOCAL DEFINES
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_PRIV_POOL_EN > 0u)
+#define  OS_MSG_Q_POOL(p_msg_q)        ((p_msg_q)->PoolPtr)     /* Pool the message queue draws its OS_MSGs from        */
+#else
+#define  OS_MSG_Q_POOL(p_msg_q)        (&OSMsgPool)
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                  LOCAL FUNCTIONS
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_PRIO_EN > 0u)
+static  void  OS_MsgQLvlLink  (OS_MSG_Q  *p_msg_q,
+                               OS_MSG    *p_head,
+                               OS_MSG    *p_tail,
+                               OS_OPT     opt);
+
+static  void  OS_MsgQLvlUnlink(OS_MSG_Q  *p_msg_q,
+                               OS_MSG    *p_msg);
+#endif
+
+#if (OS_CFG_MSG_Q_STAT_EN > 0u)
+static  void  OS_MsgQStatDepth(OS_MSG_Q  *p_msg_q,
+                               CPU_TS     ts);
+
+static  void  OS_MsgQStatRes  (OS_MSG_Q  *p_msg_q,
+                               CPU_TS     msg_ts,
+                               CPU_TS     ts);
+#endif
+
 
 /*
 ************************************************************************************************************************
@@ -53,12 +91,6 @@ const  CPU_CHAR  *os_msg__c = "$Id: $";
 
 void  OS_MsgPoolInit (OS_ERR  *p_err)
 {
-    OS_MSG      *p_msg1;
-    OS_MSG      *p_msg2;
-    OS_MSG_QTY   i;
-    OS_MSG_QTY   loops;
-
-
 #if (OS_CFG_ARG_CHK_EN > 0u)
     if (OSCfg_MsgPoolBasePtr == (OS_MSG *)0) {
        *p_err = OS_ERR_MSG_POOL_NULL_PTR;
@@ -70,10 +102,47 @@ void  OS_MsgPoolInit (OS_ERR  *p_err)
     }
 #endif
 
-    p_msg1 = OSCfg_MsgPoolBasePtr;
-    p_msg2 = OSCfg_MsgPoolBasePtr;
+    OS_MsgPoolCreate(&OSMsgPool,
+                      OSCfg_MsgPoolBasePtr,
+                      OSCfg_MsgPoolSize);
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              BUILD A POOL OF 'OS_MSG'
+*
+* Description: This function links an array of OS_MSGs into the free list of an OS_MSG pool.  It is used for the
+*              global pool as well as for the private pools of message queues created by OSQCreateWithPool().
+*
+* Argument(s): p_pool      is a pointer to the pool to initialize
+*              ------
+*
+*              p_msg_tbl   is a pointer to the array of OS_MSGs that will make up the pool
+*
+*              size        is the number of entries in 'p_msg_tbl' (must be non-zero)
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_MsgPoolCreate (OS_MSG_POOL  *p_pool,
+                        OS_MSG       *p_msg_tbl,
+                        OS_MSG_QTY    size)
+{
+    OS_MSG      *p_msg1;
+    OS_MSG      *p_msg2;
+    OS_MSG_QTY   i;
+    OS_MSG_QTY   loops;
+
+
+    p_msg1 = p_msg_tbl;
+    p_msg2 = p_msg_tbl;
     p_msg2++;
-    loops  = OSCfg_MsgPoolSize - 1u;
+    loops  = size - 1u;
     for (i = 0u; i < loops; i++) {                              /* Init. list of free OS_MSGs                           */
         p_msg1->NextPtr = p_msg2;
         p_msg1->MsgPtr  = (void *)0;
@@ -91,13 +160,12 @@ void  OS_MsgPoolInit (OS_ERR  *p_err)
     p_msg1->MsgTS   =           0u;
 #endif
 
-    OSMsgPool.NextPtr    = OSCfg_MsgPoolBasePtr;
-    OSMsgPool.NbrFree    = OSCfg_MsgPoolSize;
-    OSMsgPool.NbrUsed    = 0u;
+    p_pool->NextPtr    = p_msg_tbl;
+    p_pool->NbrFree    = size;
+    p_pool->NbrUsed    = 0u;
 #if (OS_CFG_DBG_EN > 0u)
-    OSMsgPool.NbrUsedMax = 0u;
+    p_pool->NbrUsedMax = 0u;
 #endif
-   *p_err                = OS_ERR_NONE;
 }
 
 
@@ -118,24 +186,32 @@ void  OS_MsgPoolInit (OS_ERR  *p_err)
 
 OS_MSG_QTY  OS_MsgQFreeAll (OS_MSG_Q  *p_msg_q)
 {
-    OS_MSG      *p_msg;
-    OS_MSG_QTY   qty;
+    OS_MSG       *p_msg;
+    OS_MSG_POOL  *p_pool;
+    OS_MSG_QTY    qty;
 
 
 
     qty = p_msg_q->NbrEntries;                                  /* Get the number of OS_MSGs being freed                */
     if (p_msg_q->NbrEntries > 0u) {
+#if (OS_CFG_MSG_Q_STAT_EN > 0u)
+        OS_MsgQStatDepth(p_msg_q, OS_TS_GET());
+#endif
+        p_pool                  = OS_MSG_Q_POOL(p_msg_q);       /* OS_MSGs go back to the pool they were taken from     */
         p_msg                   = p_msg_q->InPtr;               /* Point to end of message chain                        */
-        p_msg->NextPtr          = OSMsgPool.NextPtr;
-        OSMsgPool.NextPtr       = p_msg_q->OutPtr;              /* Point to beginning of message chain                  */
-        OSMsgPool.NbrUsed      -= p_msg_q->NbrEntries;          /* Update statistics for free list of messages          */
-        OSMsgPool.NbrFree      += p_msg_q->NbrEntries;
+        p_msg->NextPtr          = p_pool->NextPtr;
+        p_pool->NextPtr         = p_msg_q->OutPtr;              /* Point to beginning of message chain                  */
+        p_pool->NbrUsed        -= p_msg_q->NbrEntries;          /* Update statistics for free list of messages          */
+        p_pool->NbrFree        += p_msg_q->NbrEntries;
         p_msg_q->NbrEntries     =           0u;                 /* Flush the message queue                              */
 #if (OS_CFG_DBG_EN > 0u)
         p_msg_q->NbrEntriesMax  =           0u;
 #endif
         p_msg_q->InPtr          = (OS_MSG *)0;
         p_msg_q->OutPtr         = (OS_MSG *)0;
+#if (OS_CFG_Q_PRIO_EN > 0u)
+        p_msg_q->LvlMap         =           0u;
+#endif
     }
     return (qty);
 }
@@ -168,6 +244,16 @@ void  OS_MsgQInit (OS_MSG_Q    *p_msg_q,
 #endif
     p_msg_q->InPtr          = (OS_MSG *)0;
     p_msg_q->OutPtr         = (OS_MSG *)0;
+#if (OS_CFG_Q_PRIV_POOL_EN > 0u)
+    p_msg_q->PoolPtr        = &OSMsgPool;                       /* Draw OS_MSGs from the global pool by default         */
+#endif
+#if (OS_CFG_Q_PRIO_EN > 0u)
+    p_msg_q->LvlMap         =           0u;                     /* No priority level holds messages                     */
+#endif
+#if (OS_CFG_MSG_Q_STAT_EN > 0u)
+    p_msg_q->Stat.ResThreshold = 0u;                            /* No residency is traced                               */
+    OS_MsgQStatReset(p_msg_q);
+#endif
 }
 
 
@@ -200,8 +286,12 @@ void  *OS_MsgQGet (OS_MSG_Q     *p_msg_q,
                    CPU_TS       *p_ts,
                    OS_ERR       *p_err)
 {
-    OS_MSG  *p_msg;
-    void    *p_void;
+    OS_MSG       *p_msg;
+    OS_MSG_POOL  *p_pool;
+    void         *p_void;
+#if (OS_CFG_MSG_Q_STAT_EN > 0u)
+    CPU_TS        ts;
+#endif
 
 
 #if (OS_CFG_TS_EN == 0u)
@@ -227,7 +317,15 @@ void  *OS_MsgQGet (OS_MSG_Q     *p_msg_q,
        *p_ts = p_msg->MsgTS;
     }
 #endif
+#if (OS_CFG_MSG_Q_STAT_EN > 0u)
+    ts = OS_TS_GET();
+    OS_MsgQStatDepth(p_msg_q, ts);
+    OS_MsgQStatRes(p_msg_q, p_msg->MsgTS, ts);
+#endif
 
+#if (OS_CFG_Q_PRIO_EN > 0u)
+    OS_MsgQLvlUnlink(p_msg_q, p_msg);
+#endif
     p_msg_q->OutPtr = p_msg->NextPtr;                           /* Point to next message to extract                     */
 
     if (p_msg_q->OutPtr == (OS_MSG *)0) {                       /* Are there any more messages in the queue?            */
@@ -237,14 +335,250 @@ void  *OS_MsgQGet (OS_MSG_Q     *p_msg_q,
         p_msg_q->NbrEntries--;                                  /* Yes, One less message in the queue                   */
     }
 
-    p_msg->NextPtr    = OSMsgPool.NextPtr;                      /* Return message control block to free list            */
-    OSMsgPool.NextPtr = p_msg;
-    OSMsgPool.NbrFree++;
-    OSMsgPool.NbrUsed--;
+    p_pool            = OS_MSG_Q_POOL(p_msg_q);
+    p_msg->NextPtr    = p_pool->NextPtr;                        /* Return message control block to free list            */
+    p_pool->NextPtr   = p_msg;
+    p_pool->NbrFree++;
+    p_pool->NbrUsed--;
+
+   *p_err             = OS_ERR_NONE;
+    return (p_void);
+}
+
+
+/*
+************************************************************************************************************************
+*                                     RETRIEVE A BATCH OF MESSAGES FROM MESSAGE QUEUE
+*
+* Description: This function retrieves up to 'nbr_max' messages from a message queue.  The messages are detached from
+*              the front of the queue and their OS_MSGs are returned to the free list in a single operation.
+*
+* Arguments  : p_msg_q     is a pointer to the message queue where we want to extract the messages from
+*              -------
+*
+*              p_msg_tbl   is a pointer to an array of at least 'nbr_max' entries where the pointer and size of each
+*                          message extracted will be placed, in the order they were in the queue
+*
+*              nbr_max     is the maximum number of messages to extract
+*
+*              p_ts        is a pointer to where the time stamp of the first message extracted will be placed
+*
+* Returns    : The number of messages extracted (0 if the queue is empty)
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_EN > 0u) && (OS_CFG_Q_PEND_N_EN > 0u)
+OS_MSG_QTY  OS_MsgQGetN (OS_MSG_Q      *p_msg_q,
+                         OS_MSG_ENTRY  *p_msg_tbl,
+                         OS_MSG_QTY     nbr_max,
+                         CPU_TS        *p_ts)
+{
+    OS_MSG       *p_msg;
+    OS_MSG       *p_msg_last;
+    OS_MSG_POOL  *p_pool;
+    OS_MSG_QTY    qty;
+#if (OS_CFG_MSG_Q_STAT_EN > 0u)
+    CPU_TS        ts;
+#endif
+
+
+#if (OS_CFG_TS_EN == 0u)
+    (void)p_ts;                                                 /* Prevent compiler warning for not using 'ts'          */
+#endif
+
+    if (nbr_max > p_msg_q->NbrEntries) {                        /* Can't extract more than what's in the queue          */
+        nbr_max = p_msg_q->NbrEntries;
+    }
+    if (nbr_max == 0u) {
+        return (0u);
+    }
+
+#if (OS_CFG_TS_EN > 0u)
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts = p_msg_q->OutPtr->MsgTS;
+    }
+#endif
+
+#if (OS_CFG_MSG_Q_STAT_EN > 0u)
+    ts = OS_TS_GET();
+    OS_MsgQStatDepth(p_msg_q, ts);
+#endif
+
+    p_msg      = p_msg_q->OutPtr;                               /* Copy the messages out of the front of the queue      */
+    p_msg_last = p_msg;
+    for (qty = 0u; qty < nbr_max; qty++) {
+        p_msg_tbl[qty].MsgPtr  = p_msg->MsgPtr;
+        p_msg_tbl[qty].MsgSize = p_msg->MsgSize;
+#if (OS_CFG_MSG_Q_STAT_EN > 0u)
+        OS_MsgQStatRes(p_msg_q, p_msg->MsgTS, ts);
+#endif
+#if (OS_CFG_Q_PRIO_EN > 0u)
+        OS_MsgQLvlUnlink(p_msg_q, p_msg);
+#endif
+        p_msg_last             = p_msg;
+        p_msg                  = p_msg->NextPtr;
+    }
+
+    p_pool              = OS_MSG_Q_POOL(p_msg_q);
+    p_msg_last->NextPtr = p_pool->NextPtr;                      /* Return the detached chain to the free list           */
+    p_pool->NextPtr     = p_msg_q->OutPtr;
+    p_pool->NbrFree    += nbr_max;
+    p_pool->NbrUsed    -= nbr_max;
+
+    p_msg_q->OutPtr     = p_msg;                                /* Point to next message to extract                     */
+    if (p_msg_q->OutPtr == (OS_MSG *)0) {                       /* Are there any more messages in the queue?            */
+        p_msg_q->InPtr      = (OS_MSG *)0;                      /* No                                                   */
+        p_msg_q->NbrEntries =           0u;
+    } else {
+        p_msg_q->NbrEntries -= nbr_max;                         /* Yes, fewer messages in the queue                     */
+    }
+
+    return (qty);
+}
+#endif
+
+/*
+************************************************************************************************************************
+*                                      RETRIEVE A MATCHING MESSAGE FROM MESSAGE QUEUE
+*
+* Description: This function retrieves the first message of a message queue for which a match function returns
+*              OS_TRUE.  The messages ahead of it are left in place, in the same order.
+*
+* Arguments  : p_msg_q     is a pointer to the message queue where we want to extract the message from
+*              -------
+*
+*              p_fnct      is a pointer to the match function, called for each message in turn
+*
+*              p_arg       is the argument passed to the match function
+*
+*              p_msg_size  is a pointer to where the size (in bytes) of the message will be placed
+*
+*              p_ts        is a pointer to where the time stamp will be placed
+*
+*              p_err       is a pointer to an error code that will be returned from this call.
+*
+*                              OS_ERR_Q_EMPTY         if no message matches
+*                              OS_ERR_NONE
+*
+* Returns    : The message (a pointer)
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The priority level of a message is not kept in its OS_MSG.  It is tracked while walking the queue,
+*                 a level ending with the message recorded in 'LvlTailPtr[]', so that the level can be updated when
+*                 the message extracted is its last one.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_EN > 0u) && (OS_CFG_Q_PEND_MATCH_EN > 0u)
+void  *OS_MsgQGetMatch (OS_MSG_Q         *p_msg_q,
+                        OS_Q_MATCH_FNCT   p_fnct,
+                        void             *p_arg,
+                        OS_MSG_SIZE      *p_msg_size,
+                        CPU_TS           *p_ts,
+                        OS_ERR           *p_err)
+{
+    OS_MSG       *p_msg;
+    OS_MSG       *p_prev;
+    OS_MSG_POOL  *p_pool;
+    void         *p_void;
+#if (OS_CFG_Q_PRIO_EN > 0u)
+    CPU_DATA      map;
+    CPU_DATA      lvl;
+    CPU_BOOLEAN   same_lvl;
+#endif
+#if (OS_CFG_MSG_Q_STAT_EN > 0u)
+    CPU_TS        ts;
+#endif
+
+
+#if (OS_CFG_TS_EN == 0u)
+    (void)p_ts;                                                 /* Prevent compiler warning for not using 'ts'          */
+#endif
+
+    p_prev   = (OS_MSG *)0;
+    p_msg    = p_msg_q->OutPtr;
+#if (OS_CFG_Q_PRIO_EN > 0u)
+    map      = p_msg_q->LvlMap;
+    lvl      = 0u;
+    same_lvl = OS_FALSE;                                        /* See Note #2                                          */
+#endif
+    while (p_msg != (OS_MSG *)0) {
+#if (OS_CFG_Q_PRIO_EN > 0u)
+        if (same_lvl == OS_FALSE) {                             /* First message of a level?                            */
+            lvl  = ((CPU_CFG_DATA_SIZE * 8u) - 1u) - (CPU_DATA)CPU_CntLeadZeros(map);
+            map &= (CPU_DATA)~((CPU_DATA)1u << lvl);
+        }
+#endif
+        if ((*p_fnct)(p_msg->MsgPtr, p_msg->MsgSize, p_arg) == OS_TRUE) {
+            break;                                              /* Found the message to extract                         */
+        }
+#if (OS_CFG_Q_PRIO_EN > 0u)
+        if (p_msg_q->LvlTailPtr[lvl] == p_msg) {
+            same_lvl = OS_FALSE;
+        } else {
+            same_lvl = OS_TRUE;
+        }
+#endif
+        p_prev = p_msg;
+        p_msg  = p_msg->NextPtr;
+    }
+
+    if (p_msg == (OS_MSG *)0) {                                 /* Did any message match?                               */
+       *p_msg_size = 0u;                                        /* No                                                   */
+#if (OS_CFG_TS_EN > 0u)
+        if (p_ts != (CPU_TS *)0) {
+           *p_ts = 0u;
+        }
+#endif
+       *p_err = OS_ERR_Q_EMPTY;
+        return ((void *)0);
+    }
+
+    p_void      = p_msg->MsgPtr;                                /* Yes, extract it                                      */
+   *p_msg_size  = p_msg->MsgSize;
+#if (OS_CFG_TS_EN > 0u)
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts = p_msg->MsgTS;
+    }
+#endif
+#if (OS_CFG_MSG_Q_STAT_EN > 0u)
+    ts = OS_TS_GET();
+    OS_MsgQStatDepth(p_msg_q, ts);
+    OS_MsgQStatRes(p_msg_q, p_msg->MsgTS, ts);
+#endif
+
+#if (OS_CFG_Q_PRIO_EN > 0u)
+    if (p_msg_q->LvlTailPtr[lvl] == p_msg) {                    /* Was it the last message of its level?                */
+        if (same_lvl == OS_TRUE) {                              /* Yes, the previous one becomes the last               */
+            p_msg_q->LvlTailPtr[lvl] = p_prev;
+        } else {                                                /* Yes, and the only one, the level is now empty        */
+            p_msg_q->LvlMap &= (CPU_DATA)~((CPU_DATA)1u << lvl);
+        }
+    }
+#endif
+    if (p_prev == (OS_MSG *)0) {                                /* Unlink the message                                   */
+        p_msg_q->OutPtr  = p_msg->NextPtr;
+    } else {
+        p_prev->NextPtr  = p_msg->NextPtr;
+    }
+    if (p_msg_q->InPtr == p_msg) {                              /* Was it the last message of the queue?                */
+        p_msg_q->InPtr   = p_prev;
+    }
+    p_msg_q->NbrEntries--;                                      /* One less message in the queue                        */
+
+    p_pool            = OS_MSG_Q_POOL(p_msg_q);
+    p_msg->NextPtr    = p_pool->NextPtr;                        /* Return message control block to free list            */
+    p_pool->NextPtr   = p_msg;
+    p_pool->NbrFree++;
+    p_pool->NbrUsed--;
 
    *p_err             = OS_ERR_NONE;
     return (p_void);
 }
+#endif
 
 
 /*
@@ -286,8 +620,11 @@ void  OS_MsgQPut (OS_MSG_Q     *p_msg_q,
                   CPU_TS        ts,
                   OS_ERR       *p_err)
 {
-    OS_MSG  *p_msg;
-    OS_MSG  *p_msg_in;
+    OS_MSG       *p_msg;
+#if (OS_CFG_Q_PRIO_EN == 0u)
+    OS_MSG       *p_msg_in;
+#endif
+    OS_MSG_POOL  *p_pool;
 
 
 #if (OS_CFG_TS_EN == 0u)
@@ -299,22 +636,31 @@ void  OS_MsgQPut (OS_MSG_Q     *p_msg_q,
         return;
     }
 
-    if (OSMsgPool.NbrFree == 0u) {
+    p_pool = OS_MSG_Q_POOL(p_msg_q);
+    if (p_pool->NbrFree == 0u) {
        *p_err = OS_ERR_MSG_POOL_EMPTY;                          /* No more OS_MSG to use                                */
         return;
     }
 
-    p_msg = OSMsgPool.NextPtr;                                  /* Remove message control block from free list          */
-    OSMsgPool.NextPtr = p_msg->NextPtr;
-    OSMsgPool.NbrFree--;
-    OSMsgPool.NbrUsed++;
+#if (OS_CFG_MSG_Q_STAT_EN > 0u)
+    OS_MsgQStatDepth(p_msg_q, OS_TS_GET());
+#endif
+
+    p_msg = p_pool->NextPtr;                                    /* Remove message control block from free list          */
+    p_pool->NextPtr = p_msg->NextPtr;
+    p_pool->NbrFree--;
+    p_pool->NbrUsed++;
 
 #if (OS_CFG_DBG_EN > 0u)
-    if (OSMsgPool.NbrUsedMax < OSMsgPool.NbrUsed) {
-        OSMsgPool.NbrUsedMax = OSMsgPool.NbrUsed;
+    if (p_pool->NbrUsedMax < p_pool->NbrUsed) {
+        p_pool->NbrUsedMax = p_pool->NbrUsed;
     }
 #endif
 
+#if (OS_CFG_Q_PRIO_EN > 0u)
+    OS_MsgQLvlLink(p_msg_q, p_msg, p_msg, opt);                 /* Insert according to the message's priority level     */
+    p_msg_q->NbrEntries++;
+#else
     if (p_msg_q->NbrEntries == 0u) {                            /* Is this first message placed in the queue?           */
         p_msg_q->InPtr         = p_msg;                         /* Yes                                                  */
         p_msg_q->OutPtr        = p_msg;
@@ -332,6 +678,7 @@ void  OS_MsgQPut (OS_MSG_Q     *p_msg_q,
         }
         p_msg_q->NbrEntries++;
     }
+#endif
 
 #if (OS_CFG_DBG_EN > 0u)
     if (p_msg_q->NbrEntriesMax < p_msg_q->NbrEntries) {
@@ -346,4 +693,375 @@ void  OS_MsgQPut (OS_MSG_Q     *p_msg_q,
 #endif
    *p_err          = OS_ERR_NONE;
 }
+
+
+/*
+************************************************************************************************************************
+*                                      DEPOSIT A BATCH OF MESSAGES IN MESSAGE QUEUE
+*
+* Description: This function places 'nbr_msgs' messages in a message queue.  All the OS_MSGs needed are taken from the
+*              free list and the resulting chain is linked into the queue in a single operation.  Either all of the
+*              messages are deposited or none of them are.
+*
+* Arguments  : p_msg_q     is a pointer to the message queue where the messages will be deposited
+*              -------
+*
+*              p_msg_tbl   is a pointer to an array of 'nbr_msgs' message descriptors (pointer and size)
+*
+*              nbr_msgs    is the number of messages to deposit
+*
+*              opt         specifies whether the messages will be posted in FIFO or LIFO order
+*
+*                              OS_OPT_POST_FIFO       messages are appended in table order
+*                              OS_OPT_POST_LIFO       messages are placed at the front of the queue, the last entry
+*                                                     of the table becoming the next message extracted
+*
+*              ts          is a timestamp as to when the messages were posted
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_Q_MAX           if the queue cannot hold all the messages
+*                              OS_ERR_MSG_POOL_EMPTY  if there are not enough OS_MSGs left to hold all the messages
+*                              OS_ERR_NONE            the messages were deposited in the queue
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The result is identical to calling OS_MsgQPut() once for each entry of 'p_msg_tbl', in order.
+************************************************************************************************************************
+*/
+
+#if ((OS_CFG_Q_EN > 0u) && (OS_CFG_Q_POST_N_EN > 0u)) || ((OS_CFG_TASK_Q_EN > 0u) && (OS_CFG_TASK_Q_POST_N_EN > 0u))
+void  OS_MsgQPutN (OS_MSG_Q      *p_msg_q,
+                   OS_MSG_ENTRY  *p_msg_tbl,
+                   OS_MSG_QTY     nbr_msgs,
+                   OS_OPT         opt,
+                   CPU_TS         ts,
+                   OS_ERR        *p_err)
+{
+    OS_MSG       *p_msg;
+    OS_MSG       *p_msg_head;
+    OS_MSG       *p_msg_tail;
+    OS_MSG_POOL  *p_pool;
+    OS_MSG_QTY    i;
+
+
+#if (OS_CFG_TS_EN == 0u)
+    (void)ts;                                                   /* Prevent compiler warning for not using 'ts'          */
+#endif
+
+    if (nbr_msgs == 0u) {                                       /* Nothing to deposit                                   */
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    if (nbr_msgs > (p_msg_q->NbrEntriesSize - p_msg_q->NbrEntries)) {
+       *p_err = OS_ERR_Q_MAX;                                   /* Message queue cannot accept all the messages         */
+        return;
+    }
+
+    p_pool = OS_MSG_Q_POOL(p_msg_q);
+    if (nbr_msgs > p_pool->NbrFree) {
+       *p_err = OS_ERR_MSG_POOL_EMPTY;                          /* Not enough OS_MSG to hold all the messages           */
+        return;
+    }
+
+#if (OS_CFG_MSG_Q_STAT_EN > 0u)
+    OS_MsgQStatDepth(p_msg_q, OS_TS_GET());
+#endif
+
+    p_msg_head = (OS_MSG *)0;
+    p_msg_tail = p_pool->NextPtr;                               /* First block taken ends up at one end of the chain    */
+    for (i = 0u; i < nbr_msgs; i++) {
+        p_msg             = p_pool->NextPtr;                    /* Remove message control block from free list          */
+        p_pool->NextPtr   = p_msg->NextPtr;
+        p_msg->MsgPtr     = p_msg_tbl[i].MsgPtr;                /* Deposit message in the message queue entry           */
+        p_msg->MsgSize    = p_msg_tbl[i].MsgSize;
+#if (OS_CFG_TS_EN > 0u)
+        p_msg->MsgTS      = ts;
+#endif
+        if ((opt & OS_OPT_POST_LIFO) == OS_OPT_POST_FIFO) {     /* Is it FIFO or LIFO?                                  */
+            if (p_msg_head == (OS_MSG *)0) {                    /* FIFO, keep the entries in table order                */
+                p_msg_head     = p_msg;
+            } else {
+                p_msg_tail->NextPtr = p_msg;
+                p_msg_tail          = p_msg;
+            }
+            p_msg->NextPtr = (OS_MSG *)0;
+        } else {
+            p_msg->NextPtr = p_msg_head;                        /* LIFO, last entry of the table comes out first        */
+            p_msg_head     = p_msg;
+        }
+    }
+    p_pool->NbrFree -= nbr_msgs;
+    p_pool->NbrUsed += nbr_msgs;
+
+#if (OS_CFG_DBG_EN > 0u)
+    if (p_pool->NbrUsedMax < p_pool->NbrUsed) {
+        p_pool->NbrUsedMax = p_pool->NbrUsed;
+    }
+#endif
+
+#if (OS_CFG_Q_PRIO_EN > 0u)
+    OS_MsgQLvlLink(p_msg_q, p_msg_head, p_msg_tail, opt);       /* All the messages share the same priority level       */
+#else
+    if (p_msg_q->NbrEntries == 0u) {                            /* Is the queue empty?                                  */
+        p_msg_q->OutPtr       = p_msg_head;                     /* Yes, the chain becomes the queue                     */
+        p_msg_q->InPtr        = p_msg_tail;
+    } else if ((opt & OS_OPT_POST_LIFO) == OS_OPT_POST_FIFO) {
+        p_msg_q->InPtr->NextPtr = p_msg_head;                   /* FIFO, splice the chain after the last entry          */
+        p_msg_q->InPtr          = p_msg_tail;
+    } else {
+        p_msg_tail->NextPtr   = p_msg_q->OutPtr;                /* LIFO, splice the chain ahead of the first entry      */
+        p_msg_q->OutPtr       = p_msg_head;
+    }
+#endif
+    p_msg_q->NbrEntries += nbr_msgs;
+
+#if (OS_CFG_DBG_EN > 0u)
+    if (p_msg_q->NbrEntriesMax < p_msg_q->NbrEntries) {
+        p_msg_q->NbrEntriesMax = p_msg_q->NbrEntries;
+    }
+#endif
+
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+
+/*
+************************************************************************************************************************
+*                                        GET OR RESET THE STATISTICS OF A MESSAGE QUEUE
+*
+* Description: OS_MsgQStatGet() copies the residency and depth statistics of a message queue and optionally clears
+*              them.  OS_MsgQStatReset() clears them and starts a new measurement period.
+*
+* Arguments  : p_msg_q     is a pointer to the message queue
+*              -------
+*
+*              p_stat      is a pointer to where the statistics will be copied
+*
+*              opt         determines whether the statistics are cleared after being copied:
+*
+*                              OS_OPT_MSG_Q_STAT_NONE     Only copy the statistics
+*                              OS_OPT_MSG_Q_STAT_RESET    Copy, then clear the statistics
+*
+* Returns    : none
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application MUST NOT call them.
+*
+*              2) These functions are called with interrupts disabled.  The depth is accounted up to now before the
+*                 copy, so that 'DepthTS - StartTS' is the length of the measurement period.
+*
+*              3) The residency threshold is kept by OS_MsgQStatReset().
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MSG_Q_STAT_EN > 0u)
+void  OS_MsgQStatGet (OS_MSG_Q       *p_msg_q,
+                      OS_MSG_Q_STAT  *p_stat,
+                      OS_OPT          opt)
+{
+    OS_MsgQStatDepth(p_msg_q, OS_TS_GET());                     /* See Note #2                                          */
+   *p_stat = p_msg_q->Stat;
+    if (opt == OS_OPT_MSG_Q_STAT_RESET) {
+        OS_MsgQStatReset(p_msg_q);
+    }
+}
+
+
+void  OS_MsgQStatReset (OS_MSG_Q  *p_msg_q)
+{
+    OS_MSG_Q_STAT  *p_stat;
+    CPU_INT08U      ix;
+
+
+    p_stat = &p_msg_q->Stat;
+    for (ix = 0u; ix < OS_CFG_MSG_Q_STAT_HIST_SIZE; ix++) {
+        p_stat->ResTbl[ix] = 0u;
+    }
+    p_stat->ResMax    = 0u;
+    p_stat->ResTotal  = 0u;
+    p_stat->ResNbr    = 0u;
+    p_stat->ResOvrNbr = 0u;                                     /* See Note #3                                          */
+    p_stat->DepthArea = 0u;
+    p_stat->StartTS   = OS_TS_GET();
+    p_stat->DepthTS   = p_stat->StartTS;
+}
+#endif
+
+
+
+/*
+************************************************************************************************************************
+*                                    LINK MESSAGES IN A PRIORITY-ORDERED MESSAGE QUEUE
+*
+* Description: This function inserts a chain of messages in a message queue at the position given by the priority level
+*              encoded in 'opt' with OS_OPT_POST_PRIO().  The queue is kept sorted by decreasing level so the next
+*              message extracted is always the oldest (FIFO) or newest (LIFO) message of the most urgent level.
+*
+* Arguments  : p_msg_q     is a pointer to the message queue
+*              -------
+*
+*              p_head      is a pointer to the first OS_MSG of the chain
+*
+*              p_tail      is a pointer to the last OS_MSG of the chain
+*
+*              opt         holds the priority level of the messages and whether they are posted FIFO or LIFO within it
+*
+* Returns    : none
+*
+* Note(s)    : 1) The last message of each non-empty level is kept in 'LvlTailPtr[]' and the non-empty levels in
+*                 'LvlMap' so the insertion point is found without walking the list: after the last message of the same
+*                 level (FIFO) or after the last message of the closest more urgent level (LIFO, or FIFO into an empty
+*                 level).
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_PRIO_EN > 0u)
+static  void  OS_MsgQLvlLink (OS_MSG_Q  *p_msg_q,
+                              OS_MSG    *p_head,
+                              OS_MSG    *p_tail,
+                              OS_OPT     opt)
+{
+    OS_MSG    *p_prev;
+    CPU_DATA   lvl;
+    CPU_DATA   lvl_bit;
+    CPU_DATA   map;
+
+
+    lvl     = OS_OPT_POST_PRIO_GET(opt);
+    lvl_bit = (CPU_DATA)1u << lvl;
+    if (((opt & OS_OPT_POST_LIFO) == OS_OPT_POST_FIFO) &&
+        ((p_msg_q->LvlMap & lvl_bit) != 0u)) {
+        p_prev = p_msg_q->LvlTailPtr[lvl];                      /* FIFO, after the last message of the same level       */
+    } else {
+        map = p_msg_q->LvlMap & (CPU_DATA)~((lvl_bit << 1u) - 1u);
+        if (map == 0u) {                                        /* Any message at a more urgent level?                  */
+            p_prev = (OS_MSG *)0;                               /* No,  insert at the front of the queue                */
+        } else {                                                /* Yes, after the last one of the closest level         */
+            p_prev = p_msg_q->LvlTailPtr[(CPU_DATA)CPU_CntTrailZeros(map)];
+        }
+    }
+
+    if (p_prev == (OS_MSG *)0) {
+        p_tail->NextPtr  = p_msg_q->OutPtr;
+        p_msg_q->OutPtr  = p_head;
+    } else {
+        p_tail->NextPtr  = p_prev->NextPtr;
+        p_prev->NextPtr  = p_head;
+    }
+    if (p_tail->NextPtr == (OS_MSG *)0) {                       /* Did the chain end up at the end of the queue?        */
+        p_msg_q->InPtr   = p_tail;
+    }
+
+    if (((opt & OS_OPT_POST_LIFO) == OS_OPT_POST_FIFO) ||       /* Chain holds the new last message of its level?       */
+        ((p_msg_q->LvlMap & lvl_bit) == 0u)) {
+        p_msg_q->LvlTailPtr[lvl] = p_tail;
+    }
+    p_msg_q->LvlMap |= lvl_bit;
+}
+
+
+/*
+************************************************************************************************************************
+*                                  UNLINK THE FIRST MESSAGE OF A PRIORITY-ORDERED QUEUE
+*
+* Description: This function updates the priority levels of a message queue when its first message is extracted.
+*
+* Arguments  : p_msg_q     is a pointer to the message queue
+*              -------
+*
+*              p_msg       is a pointer to the first OS_MSG of the queue, about to be extracted
+*
+* Returns    : none
+*
+* Note(s)    : 1) The first message always belongs to the most urgent non-empty level, the highest bit set in 'LvlMap'.
+*                 The level becomes empty when that message is also its last one.
+************************************************************************************************************************
+*/
+
+static  void  OS_MsgQLvlUnlink (OS_MSG_Q  *p_msg_q,
+                                OS_MSG    *p_msg)
+{
+    CPU_DATA  lvl;
+
+
+    lvl = ((CPU_CFG_DATA_SIZE * 8u) - 1u) - (CPU_DATA)CPU_CntLeadZeros(p_msg_q->LvlMap);
+    if (p_msg_q->LvlTailPtr[lvl] == p_msg) {                    /* Was it the only message left at its level?           */
+        p_msg_q->LvlMap &= (CPU_DATA)~((CPU_DATA)1u << lvl);
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                         UPDATE THE STATISTICS OF A MESSAGE QUEUE
+*
+* Description: OS_MsgQStatDepth() accounts for the time the queue spent at its current depth.  It is called before the
+*              number of entries changes.  OS_MsgQStatRes() records the residency of a message being extracted.
+*
+* Arguments  : p_msg_q     is a pointer to the message queue
+*              -------
+*
+*              msg_ts      is the timestamp of the message, taken when it was posted
+*
+*              ts          is the current timestamp
+*
+* Returns    : none
+*
+* Note(s)    : 1) The bucket counters saturate instead of wrapping around.
+*
+*              2) OS_TRACE_MSG_Q_RES_OVR() identifies the queue, the residency itself is in the statistics.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MSG_Q_STAT_EN > 0u)
+static  void  OS_MsgQStatDepth (OS_MSG_Q  *p_msg_q,
+                                CPU_TS     ts)
+{
+    p_msg_q->Stat.DepthArea += (CPU_INT64U)p_msg_q->NbrEntries * (CPU_INT64U)(CPU_TS)(ts - p_msg_q->Stat.DepthTS);
+    p_msg_q->Stat.DepthTS    = ts;
+}
+
+
+static  void  OS_MsgQStatRes (OS_MSG_Q  *p_msg_q,
+                              CPU_TS     msg_ts,
+                              CPU_TS     ts)
+{
+    OS_MSG_Q_STAT  *p_stat;
+    CPU_TS          res;
+    CPU_TS          delta;
+    CPU_INT08U      ix;
+
+
+    p_stat = &p_msg_q->Stat;
+    res    = ts - msg_ts;
+    delta  = res;
+    ix     = 0u;
+    while ((delta != 0u) &&                                     /* Find the number of significant bits in 'res'         */
+           (ix    <  (OS_CFG_MSG_Q_STAT_HIST_SIZE - 1u))) {
+        delta >>= 1u;
+        ix++;
+    }
+    if (p_stat->ResTbl[ix] < (OS_HIST_CTR)~(OS_HIST_CTR)0) {    /* See Note #1                                          */
+        p_stat->ResTbl[ix]++;
+    }
+
+    if (p_stat->ResMax < res) {
+        p_stat->ResMax = res;
+    }
+    p_stat->ResTotal += res;
+    p_stat->ResNbr++;
+
+    if ((p_stat->ResThreshold > 0u) &&                          /* Is the residency above the threshold?                */
+        (res > p_stat->ResThreshold)) {
+        p_stat->ResOvrNbr++;
+        OS_TRACE_MSG_Q_RES_OVR(p_msg_q);                        /* See Note #2                                          */
+    }
+}
+#endif
 #endif
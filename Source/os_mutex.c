@@ -24,6 +24,7 @@
 */
 
 #define  MICRIUM_SOURCE
+#define  OS_CRIT_SITE_ID                    OS_CRIT_SITE_MUTEX
 #include "os.h"
 
 #ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
@@ -32,6 +33,189 @@ const  CPU_CHAR  *os_mutex__c = "$Id: $";
 
 
 #if (OS_CFG_MUTEX_EN > 0u)
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MUTEX_CEILING_EN > 0u)
+static  void     OS_MutexCeilingRaise(OS_TCB    *p_tcb,
+                                      OS_MUTEX  *p_mutex);
+#endif
+
+#if (OS_CFG_MUTEX_GRP_SORT_EN > 0u)
+static  OS_PRIO  OS_MutexGrpPrioGet  (OS_MUTEX  *p_mutex);
+#endif
+
+#if (OS_CFG_MUTEX_SPIN_CNT > 0u)
+static  void     OS_MutexSpin        (OS_MUTEX  *p_mutex);
+#endif
+
+#if (OS_MUTEX_FAST_EN > 0u)
+static  CPU_BOOLEAN  OS_MutexFastPend(OS_MUTEX  *p_mutex,
+                                      CPU_TS    *p_ts);
+
+static  CPU_BOOLEAN  OS_MutexFastPost(OS_MUTEX  *p_mutex);
+#endif
+
+#if (OS_CFG_MUTEX_THROUGHPUT_EN > 0u)
+static  void     OS_MutexWaiterInherit(OS_TCB    *p_tcb,
+                                       OS_MUTEX  *p_mutex);
+#endif
+
+#if (OS_CFG_MUTEX_BLOCK_STAT_EN > 0u)
+static  void     OS_MutexChainGet    (OS_MUTEX        *p_mutex,
+                                      OS_MUTEX_CHAIN  *p_chain);
+
+static  void     OS_MutexBlockStatUpdate(OS_MUTEX        *p_mutex,
+                                         OS_MUTEX_CHAIN  *p_chain);
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                             SET THE CEILING OF A MUTEX
+*
+* Description: This function assigns a ceiling priority to a mutex.  The task that owns the mutex runs at the ceiling
+*              priority, or at its own priority if that is higher, until it releases the mutex.
+*
+* Arguments  : p_mutex       is a pointer to the mutex.
+*
+*              prio          is the ceiling priority.  It must be at least as high as the priority of every task that
+*                            uses the mutex.  Specify OS_PRIO_INIT to remove the ceiling.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_MUTEX_OWNER             If the mutex is currently owned by a task
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_mutex' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE                If 'p_mutex' is not pointing to a mutex
+*                                OS_ERR_PRIO_INVALID            If 'prio' is the idle task priority or above
+*                                OS_ERR_SET_ISR                 If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) The ceiling can only be changed while the mutex is available, typically right after OSMutexCreate().
+*
+*              2) A task with a higher priority than the ceiling that pends on the mutex still raises the owner to its
+*                 own priority, as it would without a ceiling (see MUTUAL EXCLUSION SEMAPHORES Note #3 in os.h).
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MUTEX_CEILING_EN > 0u)
+void  OSMutexCeilingSet (OS_MUTEX  *p_mutex,
+                         OS_PRIO    prio,
+                         OS_ERR    *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_SET_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_mutex == (OS_MUTEX *)0) {                             /* Validate 'p_mutex'                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if ((prio >= (OS_CFG_PRIO_MAX - 1u)) &&                     /* Cannot use the Idle Task priority                    */
+        (prio != OS_PRIO_INIT)) {
+       *p_err = OS_ERR_PRIO_INVALID;
+        return;
+    }
+#if (OS_CFG_PRIO_MAP_EN > 0u)
+    if ((prio != OS_PRIO_INIT) &&                               /* A ceiling must be in OSCfg_PrioMapTbl[]              */
+        (OS_PRIO_IX(prio) == OS_PRIO_MAP_NONE)) {
+       *p_err = OS_ERR_PRIO_INVALID;
+        return;
+    }
+#endif
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_mutex->Type != OS_OBJ_TYPE_MUTEX) {                   /* Make sure mutex was created                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_mutex->OwnerTCBPtr != (OS_TCB *)0) {                  /* See Note #1                                          */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_MUTEX_OWNER;
+        return;
+    }
+    p_mutex->CeilingPrio = prio;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                        GET THE WORST BLOCKING CHAIN OBSERVED
+*
+* Description: This function returns a copy of the longest time a task stayed blocked on a mutex, along with the chain
+*              of owners that blocked it (see MUTUAL EXCLUSION SEMAPHORES Note #7 in os.h).
+*
+* Arguments  : p_chain       is a pointer to where the chain will be copied.  .TaskPtr is a NULL pointer if no task has
+*                            blocked on a mutex since startup or since the last call to OSStatReset().
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_PTR_INVALID             If 'p_chain' is a NULL pointer
+*
+* Returns    : none
+*
+* Note(s)    : 1) .OwnerTbl[] and .HoldTbl[] hold the first OS_CFG_MUTEX_CHAIN_MAX owners of the chain, the owner of
+*                 .MutexPtr first, and .Depth the number of owners in the whole chain.  The tasks are identified by
+*                 their TCB and may have been deleted since.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MUTEX_BLOCK_STAT_EN > 0u)
+void  OSMutexChainWorstGet (OS_MUTEX_CHAIN  *p_chain,
+                            OS_ERR          *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_chain == (OS_MUTEX_CHAIN *)0) {                       /* Validate 'p_chain'                                   */
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+   *p_chain = OSMutexChainWorst;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                   CREATE A MUTEX
@@ -112,8 +296,24 @@ void  OSMutexCreate (OS_MUTEX  *p_mutex,
     p_mutex->MutexGrpNextPtr   = (OS_MUTEX *)0;
     p_mutex->OwnerTCBPtr       = (OS_TCB   *)0;
     p_mutex->OwnerNestingCtr   =             0u;                /* Mutex is available                                   */
+#if (OS_MUTEX_FAST_EN > 0u)
+    p_mutex->GrpLinked         =  OS_FALSE;
+#endif
+#if (OS_CFG_MUTEX_CEILING_EN > 0u)
+    p_mutex->CeilingPrio       =  OS_PRIO_INIT;                 /* No ceiling                                           */
+#endif
+#if (OS_CFG_MUTEX_THROUGHPUT_EN > 0u)
+    p_mutex->Throughput        =  OS_FALSE;                     /* Ownership is handed over on release                  */
+#endif
 #if (OS_CFG_TS_EN > 0u)
     p_mutex->TS                =             0u;
+#endif
+#if (OS_CFG_MUTEX_BLOCK_STAT_EN > 0u)
+    p_mutex->OwnerTS           =             0u;
+    p_mutex->BlockCtr          =             0u;
+    p_mutex->BlockTimeTotal    =             0u;
+    p_mutex->BlockTimeMax      =             0u;
+    p_mutex->BlockDepthMax     =             0u;
 #endif
     OS_PendListInit(&p_mutex->PendList);                        /* Initialize the waiting list                          */
 
@@ -321,6 +521,8 @@ OS_OBJ_QTY  OSMutexDel (OS_MUTEX  *p_mutex,
 *                                OS_OPT_PEND_BLOCKING
 *                                OS_OPT_PEND_NON_BLOCKING
 *
+*                            Add OS_OPT_PEND_ABS to make 'timeout' the value of OSTickCtr at which to give up.
+*
 *              p_ts          is a pointer to a variable that will receive the timestamp of when the mutex was posted or
 *                            pend aborted or the mutex deleted.  If you pass a NULL pointer (i.e. (CPU_TS *)0) then you
 *                            will not get the timestamp.  In other words, passing a NULL pointer is valid and indicates
@@ -348,7 +550,19 @@ OS_OBJ_QTY  OSMutexDel (OS_MUTEX  *p_mutex,
 *
 * Returns    : none
 *
-* Note(s)    : This API 'MUST NOT' be called from a timer callback function.
+* Note(s)    : 1) This API 'MUST NOT' be called from a timer callback function.
+*
+*              2) When OS_MUTEX_FAST_EN is enabled, a mutex that is available and has no ceiling is claimed without a
+*                 critical section (see MUTUAL EXCLUSION SEMAPHORES Note #5 in os.h).
+*
+*              3) A task readied by the release of a mutex in throughput mode does not own it yet.  It takes the mutex
+*                 if it is still available, or waits for it again, with the full 'timeout', if another task took it
+*                 in the meantime (see MUTUAL EXCLUSION SEMAPHORES Note #6 in os.h).
+*
+*              4) When OS_CFG_MUTEX_BLOCK_STAT_EN is enabled, the chain of owners is recorded on the caller's stack just
+*                 before it blocks, which costs about (2 + 2 * OS_CFG_MUTEX_CHAIN_MAX) words of stack.  The time spent
+*                 blocked is added to the statistics of the mutex once the caller is readied, unless the mutex was
+*                 deleted (see MUTUAL EXCLUSION SEMAPHORES Note #7 in os.h).
 ************************************************************************************************************************
 */
 
@@ -358,7 +572,10 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
                    CPU_TS    *p_ts,
                    OS_ERR    *p_err)
 {
-    OS_TCB  *p_tcb;
+    OS_TCB          *p_tcb;
+#if (OS_CFG_MUTEX_BLOCK_STAT_EN > 0u)
+    OS_MUTEX_CHAIN   chain;                                     /* See Note #4                                          */
+#endif
     CPU_SR_ALLOC();
 
 
@@ -408,7 +625,7 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
        *p_err = OS_ERR_OBJ_PTR_NULL;
         return;
     }
-    switch (opt) {                                              /* Validate 'opt'                                       */
+    switch (opt & (OS_OPT)~OS_OPT_PEND_ABS) {                   /* Validate 'opt'                                       */
         case OS_OPT_PEND_BLOCKING:
         case OS_OPT_PEND_NON_BLOCKING:
              break;
@@ -430,16 +647,41 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
     }
 #endif
 
+#if (OS_CFG_MUTEX_SPIN_CNT > 0u)
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) == 0u) {
+        OS_MutexSpin(p_mutex);                                  /* Wait for a running owner before blocking             */
+    }
+#endif
+
+#if (OS_MUTEX_FAST_EN > 0u)
+    if (OS_MutexFastPend(p_mutex, p_ts) == OS_TRUE) {           /* See Note #2                                          */
+        OS_TRACE_MUTEX_PEND(p_mutex);
+        OS_TRACE_MUTEX_PEND_EXIT(OS_ERR_NONE);
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+#endif
+
     CPU_CRITICAL_ENTER();
-    if (p_mutex->OwnerNestingCtr == 0u) {                       /* Resource available?                                  */
+    if (p_mutex->OwnerTCBPtr == (OS_TCB *)0) {                  /* Resource available?                                  */
         p_mutex->OwnerTCBPtr     = OSTCBCurPtr;                 /* Yes, caller may proceed                              */
         p_mutex->OwnerNestingCtr = 1u;
+        OS_OBJ_STAT_INC(&p_mutex->PendList, PendCtr);
+#if (OS_CFG_MUTEX_BLOCK_STAT_EN > 0u)
+        p_mutex->OwnerTS         = OS_TS_GET();
+#endif
 #if (OS_CFG_TS_EN > 0u)
         if (p_ts != (CPU_TS *)0) {
            *p_ts = p_mutex->TS;
         }
 #endif
         OS_MutexGrpAdd(OSTCBCurPtr, p_mutex);                   /* Add mutex to owner's group                           */
+#if (OS_CFG_MUTEX_THROUGHPUT_EN > 0u)
+        OS_MutexWaiterInherit(OSTCBCurPtr, p_mutex);            /* Tasks may still be waiting on the mutex              */
+#endif
+#if (OS_CFG_MUTEX_CEILING_EN > 0u)
+        OS_MutexCeilingRaise(OSTCBCurPtr, p_mutex);             /* Run at the ceiling while owning the mutex            */
+#endif
         CPU_CRITICAL_EXIT();
         OS_TRACE_MUTEX_PEND(p_mutex);
         OS_TRACE_MUTEX_PEND_EXIT(OS_ERR_NONE);
@@ -495,11 +737,21 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
     }
 
     p_tcb = p_mutex->OwnerTCBPtr;                               /* Point to the TCB of the Mutex owner                  */
+#if (OS_MUTEX_FAST_EN > 0u)
+    if (p_mutex->GrpLinked == OS_FALSE) {                       /* Owner claimed it with the fast path?                 */
+        OS_MutexGrpAdd(p_tcb, p_mutex);                         /* Yes, it now needs to be in the owner's group         */
+    }
+#endif
     if (p_tcb->Prio > OSTCBCurPtr->Prio) {                      /* See if mutex owner has a lower priority than current */
         OS_TaskChangePrio(p_tcb, OSTCBCurPtr->Prio);
         OS_TRACE_MUTEX_TASK_PRIO_INHERIT(p_tcb, p_tcb->Prio);
     }
 
+#if (OS_CFG_MUTEX_BLOCK_STAT_EN > 0u)
+    OS_MutexChainGet(p_mutex, &chain);                          /* Record who blocks the caller (see Note #4)           */
+#endif
+
+    OS_PEND_ABS_SET(OSTCBCurPtr, opt);
     OS_Pend((OS_PEND_OBJ *)((void *)p_mutex),                   /* Block task pending on Mutex                          */
              OSTCBCurPtr,
              OS_TASK_PEND_ON_MUTEX,
@@ -510,6 +762,48 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
     OSSched();                                                  /* Find the next highest priority task ready to run     */
 
     CPU_CRITICAL_ENTER();
+#if (OS_CFG_MUTEX_THROUGHPUT_EN > 0u)
+    while ((OSTCBCurPtr->PendStatus == OS_STATUS_PEND_OK) &&    /* Readied without being given the mutex?               */
+           (p_mutex->OwnerTCBPtr    != OSTCBCurPtr)) {          /* See Note #3                                          */
+        p_tcb = p_mutex->OwnerTCBPtr;
+        if (p_tcb == (OS_TCB *)0) {                             /* Yes, take it if it is still available                */
+            p_mutex->OwnerTCBPtr     = OSTCBCurPtr;
+            p_mutex->OwnerNestingCtr = 1u;
+#if (OS_CFG_MUTEX_BLOCK_STAT_EN > 0u)
+            p_mutex->OwnerTS         = OS_TS_GET();
+#endif
+            OS_MutexGrpAdd(OSTCBCurPtr, p_mutex);
+            OS_MutexWaiterInherit(OSTCBCurPtr, p_mutex);
+#if (OS_CFG_MUTEX_CEILING_EN > 0u)
+            OS_MutexCeilingRaise(OSTCBCurPtr, p_mutex);
+#endif
+        } else {                                                /* Another task took it first, wait again               */
+#if (OS_MUTEX_FAST_EN > 0u)
+            if (p_mutex->GrpLinked == OS_FALSE) {
+                OS_MutexGrpAdd(p_tcb, p_mutex);
+            }
+#endif
+            if (p_tcb->Prio > OSTCBCurPtr->Prio) {
+                OS_TaskChangePrio(p_tcb, OSTCBCurPtr->Prio);
+                OS_TRACE_MUTEX_TASK_PRIO_INHERIT(p_tcb, p_tcb->Prio);
+            }
+            OS_PEND_ABS_SET(OSTCBCurPtr, opt);
+            OS_Pend((OS_PEND_OBJ *)((void *)p_mutex),
+                     OSTCBCurPtr,
+                     OS_TASK_PEND_ON_MUTEX,
+                     timeout);
+            CPU_CRITICAL_EXIT();
+            OS_TRACE_MUTEX_PEND_BLOCK(p_mutex);
+            OSSched();
+            CPU_CRITICAL_ENTER();
+        }
+    }
+#endif
+#if (OS_CFG_MUTEX_BLOCK_STAT_EN > 0u)
+    if (OSTCBCurPtr->PendStatus != OS_STATUS_PEND_DEL) {        /* The mutex is gone if it was deleted                  */
+        OS_MutexBlockStatUpdate(p_mutex, &chain);
+    }
+#endif
     switch (OSTCBCurPtr->PendStatus) {
         case OS_STATUS_PEND_OK:                                 /* We got the mutex                                     */
 #if (OS_CFG_TS_EN > 0u)
@@ -676,16 +970,18 @@ OS_OBJ_QTY  OSMutexPendAbort (OS_MUTEX  *p_mutex,
                      ts,
                      OS_STATUS_PEND_ABORT);
         p_tcb_owner = p_mutex->OwnerTCBPtr;
-        prio_new    = p_tcb_owner->Prio;
-        if ((p_tcb_owner->Prio != p_tcb_owner->BasePrio) &&
-            (p_tcb_owner->Prio == p_tcb->Prio)) {               /* Has the owner inherited a priority?                  */
-            prio_new = OS_MutexGrpPrioFindHighest(p_tcb_owner);
-            prio_new = (prio_new > p_tcb_owner->BasePrio) ? p_tcb_owner->BasePrio : prio_new;
-        }
+        if (p_tcb_owner != (OS_TCB *)0) {                       /* A mutex in throughput mode may have no owner         */
+            prio_new = p_tcb_owner->Prio;
+            if ((p_tcb_owner->Prio != p_tcb_owner->BasePrio) &&
+                (p_tcb_owner->Prio == p_tcb->Prio)) {           /* Has the owner inherited a priority?                  */
+                prio_new = OS_MutexGrpPrioFindHighest(p_tcb_owner);
+                prio_new = (prio_new > p_tcb_owner->BasePrio) ? p_tcb_owner->BasePrio : prio_new;
+            }
 
-        if(prio_new != p_tcb_owner->Prio) {
-            OS_TaskChangePrio(p_tcb_owner, prio_new);
-            OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb_owner, p_tcb_owner->Prio);
+            if(prio_new != p_tcb_owner->Prio) {
+                OS_TaskChangePrio(p_tcb_owner, prio_new);
+                OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb_owner, p_tcb_owner->Prio);
+            }
         }
 
         nbr_tasks++;
@@ -731,7 +1027,12 @@ OS_OBJ_QTY  OSMutexPendAbort (OS_MUTEX  *p_mutex,
 *
 * Returns    : none
 *
-* Note(s)    : none
+* Note(s)    : 1) When OS_MUTEX_FAST_EN is enabled, a mutex claimed by the fast path of OSMutexPend() and that no other
+*                 task pended on is released without a critical section.
+*
+*              2) A mutex in throughput mode is left available and its first waiter is only readied.  The waiter takes
+*                 the mutex when it runs unless the caller, or another task, took it first (see MUTUAL EXCLUSION
+*                 SEMAPHORES Note #6 in os.h).
 ************************************************************************************************************************
 */
 
@@ -801,6 +1102,15 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
     }
 #endif
 
+#if (OS_MUTEX_FAST_EN > 0u)
+    if (OS_MutexFastPost(p_mutex) == OS_TRUE) {                 /* See Note #1                                          */
+        OS_TRACE_MUTEX_POST(p_mutex);
+        OS_TRACE_MUTEX_POST_EXIT(OS_ERR_NONE);
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+#endif
+
     CPU_CRITICAL_ENTER();
     if (OSTCBCurPtr != p_mutex->OwnerTCBPtr) {                  /* Make sure the mutex owner is releasing the mutex     */
         CPU_CRITICAL_EXIT();
@@ -811,6 +1121,7 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
     }
 
     OS_TRACE_MUTEX_POST(p_mutex);
+    OS_OBJ_STAT_INC(&p_mutex->PendList, PostCtr);
 
 #if (OS_CFG_TS_EN > 0u)
     ts          = OS_TS_GET();                                  /* Get timestamp                                        */
@@ -828,16 +1139,6 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
 
     OS_MutexGrpRemove(OSTCBCurPtr, p_mutex);                    /* Remove mutex from owner's group                      */
 
-    p_pend_list = &p_mutex->PendList;
-    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on mutex?                           */
-        p_mutex->OwnerTCBPtr     = (OS_TCB *)0;                 /* No                                                   */
-        p_mutex->OwnerNestingCtr =           0u;
-        CPU_CRITICAL_EXIT();
-        OS_TRACE_MUTEX_POST_EXIT(OS_ERR_NONE);
-       *p_err = OS_ERR_NONE;
-        return;
-    }
-                                                                /* Yes                                                  */
     if (OSTCBCurPtr->Prio != OSTCBCurPtr->BasePrio) {           /* Has owner inherited a priority?                      */
         prio_new = OS_MutexGrpPrioFindHighest(OSTCBCurPtr);     /* Yes, find highest priority pending                   */
         prio_new = (prio_new > OSTCBCurPtr->BasePrio) ? OSTCBCurPtr->BasePrio : prio_new;
@@ -850,10 +1151,47 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
             OSPrioCur         = prio_new;
         }
     }
-                                                                /* Get TCB from head of pend list                       */
+
+    p_pend_list = &p_mutex->PendList;
+    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on mutex?                           */
+        p_mutex->OwnerTCBPtr     = (OS_TCB *)0;                 /* No                                                   */
+        p_mutex->OwnerNestingCtr =           0u;
+        CPU_CRITICAL_EXIT();
+#if (OS_CFG_MUTEX_CEILING_EN > 0u)
+        if ((p_mutex->CeilingPrio != OS_PRIO_INIT) &&           /* Owner may have dropped from the ceiling              */
+            ((opt & OS_OPT_POST_NO_SCHED) == 0u)) {
+            OSSched();
+        }
+#endif
+        OS_TRACE_MUTEX_POST_EXIT(OS_ERR_NONE);
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+                                                                /* Yes, get TCB from head of pend list                  */
     p_tcb                    = p_pend_list->HeadPtr;
+#if (OS_CFG_MUTEX_THROUGHPUT_EN > 0u)
+    if (p_mutex->Throughput == OS_TRUE) {                       /* See Note #2                                          */
+        p_mutex->OwnerTCBPtr     = (OS_TCB *)0;                 /* Leave the mutex available ...                        */
+        p_mutex->OwnerNestingCtr =           0u;
+        OS_Post((OS_PEND_OBJ *)((void *)p_mutex),               /* ... and only ready the first waiter                  */
+                               p_tcb,
+                               (void *)0,
+                               0u,
+                               ts);
+        CPU_CRITICAL_EXIT();
+        if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+            OSSched();                                          /* Run the scheduler                                    */
+        }
+        OS_TRACE_MUTEX_POST_EXIT(OS_ERR_NONE);
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+#endif
     p_mutex->OwnerTCBPtr     = p_tcb;                           /* Give mutex to new owner                              */
     p_mutex->OwnerNestingCtr = 1u;
+#if (OS_CFG_MUTEX_BLOCK_STAT_EN > 0u)
+    p_mutex->OwnerTS         = ts;
+#endif
     OS_MutexGrpAdd(p_tcb, p_mutex);
                                                                 /* Post to mutex                                        */
     OS_Post((OS_PEND_OBJ *)((void *)p_mutex),
@@ -861,6 +1199,9 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
                            (void *)0,
                            0u,
                            ts);
+#if (OS_CFG_MUTEX_CEILING_EN > 0u)
+    OS_MutexCeilingRaise(p_tcb, p_mutex);                       /* New owner runs at the ceiling                        */
+#endif
 
     CPU_CRITICAL_EXIT();
 
@@ -874,39 +1215,134 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
 
 /*
 ************************************************************************************************************************
-*                                            CLEAR THE CONTENTS OF A MUTEX
+*                                          SET THE THROUGHPUT MODE OF A MUTEX
 *
-* Description: This function is called by OSMutexDel() to clear the contents of a mutex
+* Description: This function selects whether OSMutexPost() hands a mutex over to its first waiter, which is the
+*              default, or leaves it available and only readies that waiter.
 *
-
-* Argument(s): p_mutex      is a pointer to the mutex to clear
-*              -------
+* Arguments  : p_mutex       is a pointer to the mutex.
+*
+*              en            is OS_TRUE  to release the mutex without handing it over (throughput mode)
+*                               OS_FALSE to hand it over to the first waiter
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_MUTEX_OWNER             If the mutex is owned by a task
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_mutex' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE                If 'p_mutex' is not pointing to a mutex
+*                                OS_ERR_SET_ISR                 If you called this function from an ISR
 *
 * Returns    : none
 *
-* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+* Note(s)    : 1) The mode can only be changed while the mutex is available, typically right after OSMutexCreate().
+*
+*              2) Throughput mode avoids a context switch on every release when the releasing task takes the mutex
+*                 again right away, at the cost of fairness: the first waiter may lose the mutex several times before
+*                 it gets it (see MUTUAL EXCLUSION SEMAPHORES Note #6 in os.h).
 ************************************************************************************************************************
 */
 
-void  OS_MutexClr (OS_MUTEX  *p_mutex)
+#if (OS_CFG_MUTEX_THROUGHPUT_EN > 0u)
+void  OSMutexThroughputSet (OS_MUTEX     *p_mutex,
+                            CPU_BOOLEAN   en,
+                            OS_ERR       *p_err)
 {
-#if (OS_OBJ_TYPE_REQ > 0u)
-    p_mutex->Type              =  OS_OBJ_TYPE_NONE;             /* Mark the data structure as a NONE                    */
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
 #endif
-#if (OS_CFG_DBG_EN > 0u)
-    p_mutex->NamePtr           = (CPU_CHAR *)((void *)"?MUTEX");
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_SET_ISR;
+        return;
+    }
 #endif
-    p_mutex->MutexGrpNextPtr   = (OS_MUTEX *)0;
-    p_mutex->OwnerTCBPtr       = (OS_TCB   *)0;
-    p_mutex->OwnerNestingCtr   =             0u;
-#if (OS_CFG_TS_EN > 0u)
-    p_mutex->TS                =             0u;
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_mutex == (OS_MUTEX *)0) {                             /* Validate 'p_mutex'                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
 #endif
-    OS_PendListInit(&p_mutex->PendList);                        /* Initialize the waiting list                          */
-}
 
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_mutex->Type != OS_OBJ_TYPE_MUTEX) {                   /* Make sure mutex was created                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
 
-/*
+    CPU_CRITICAL_ENTER();
+    if (p_mutex->OwnerTCBPtr != (OS_TCB *)0) {                  /* See Note #1                                          */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_MUTEX_OWNER;
+        return;
+    }
+    p_mutex->Throughput = (en == OS_FALSE) ? OS_FALSE : OS_TRUE;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                            CLEAR THE CONTENTS OF A MUTEX
+*
+* Description: This function is called by OSMutexDel() to clear the contents of a mutex
+*
+
+* Argument(s): p_mutex      is a pointer to the mutex to clear
+*              -------
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+void  OS_MutexClr (OS_MUTEX  *p_mutex)
+{
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_mutex->Type              =  OS_OBJ_TYPE_NONE;             /* Mark the data structure as a NONE                    */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_mutex->NamePtr           = (CPU_CHAR *)((void *)"?MUTEX");
+#endif
+    p_mutex->MutexGrpNextPtr   = (OS_MUTEX *)0;
+    p_mutex->OwnerTCBPtr       = (OS_TCB   *)0;
+    p_mutex->OwnerNestingCtr   =             0u;
+#if (OS_MUTEX_FAST_EN > 0u)
+    p_mutex->GrpLinked         =  OS_FALSE;
+#endif
+#if (OS_CFG_MUTEX_CEILING_EN > 0u)
+    p_mutex->CeilingPrio       =  OS_PRIO_INIT;
+#endif
+#if (OS_CFG_MUTEX_THROUGHPUT_EN > 0u)
+    p_mutex->Throughput        =  OS_FALSE;
+#endif
+#if (OS_CFG_TS_EN > 0u)
+    p_mutex->TS                =             0u;
+#endif
+#if (OS_CFG_MUTEX_BLOCK_STAT_EN > 0u)
+    p_mutex->OwnerTS           =             0u;
+    p_mutex->BlockCtr          =             0u;
+    p_mutex->BlockTimeTotal    =             0u;
+    p_mutex->BlockTimeMax      =             0u;
+    p_mutex->BlockDepthMax     =             0u;
+#endif
+    OS_PendListInit(&p_mutex->PendList);                        /* Initialize the waiting list                          */
+}
+
+
+/*
 ************************************************************************************************************************
 *                                          ADD/REMOVE MUTEX TO/FROM DEBUG LIST
 *
@@ -932,6 +1368,10 @@ void  OS_MutexDbgListAdd (OS_MUTEX  *p_mutex)
         OSMutexDbgListPtr->DbgPrevPtr =  p_mutex;
     }
     OSMutexDbgListPtr                 =  p_mutex;
+
+#if (OS_CFG_OBJ_REG_EN > 0u)
+    OS_ObjRegAdd((void *)p_mutex, OS_OBJ_TYPE_MUTEX, p_mutex->NamePtr);
+#endif
 }
 
 
@@ -961,6 +1401,10 @@ void  OS_MutexDbgListRemove (OS_MUTEX  *p_mutex)
         p_mutex->DbgNextPtr      = (OS_MUTEX *)0;
         p_mutex->DbgPrevPtr      = (OS_MUTEX *)0;
     }
+
+#if (OS_CFG_OBJ_REG_EN > 0u)
+    OS_ObjRegRemove((void *)p_mutex, OS_OBJ_TYPE_MUTEX, p_mutex->NamePtr);
+#endif
 }
 #endif
 
@@ -980,13 +1424,34 @@ void  OS_MutexDbgListRemove (OS_MUTEX  *p_mutex)
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) When OS_CFG_MUTEX_GRP_SORT_EN is enabled, the mutex is inserted after the mutexes whose first waiter
+*                 has the same or a higher priority (see MUTUAL EXCLUSION SEMAPHORES Note #2 in os.h).
 ************************************************************************************************************************
 */
 
 void  OS_MutexGrpAdd (OS_TCB  *p_tcb, OS_MUTEX  *p_mutex)
 {
+#if (OS_CFG_MUTEX_GRP_SORT_EN > 0u)
+    OS_MUTEX  **pp_mutex;
+    OS_PRIO     prio;
+
+
+    prio     = OS_MutexGrpPrioGet(p_mutex);
+    pp_mutex = &p_tcb->MutexGrpHeadPtr;
+    while ((*pp_mutex != (OS_MUTEX *)0) &&                  /* Find the first mutex with a lower priority waiter      */
+           (OS_MutexGrpPrioGet(*pp_mutex) <= prio)) {
+        pp_mutex = &(*pp_mutex)->MutexGrpNextPtr;
+    }
+    p_mutex->MutexGrpNextPtr = *pp_mutex;
+   *pp_mutex                 =  p_mutex;
+#else
     p_mutex->MutexGrpNextPtr = p_tcb->MutexGrpHeadPtr;      /* The mutex grp is not sorted add to head of list.       */
     p_tcb->MutexGrpHeadPtr   = p_mutex;
+#endif
+#if (OS_MUTEX_FAST_EN > 0u)
+    p_mutex->GrpLinked       = OS_TRUE;
+#endif
 }
 
 
@@ -1005,6 +1470,9 @@ void  OS_MutexGrpAdd (OS_TCB  *p_tcb, OS_MUTEX  *p_mutex)
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) A mutex claimed by the fast path of OSMutexPend() is not in the group of its owner unless another
+*                 task pended on it (see MUTUAL EXCLUSION SEMAPHORES Note #5 in os.h).
 ************************************************************************************************************************
 */
 
@@ -1012,6 +1480,13 @@ void  OS_MutexGrpRemove (OS_TCB  *p_tcb, OS_MUTEX  *p_mutex)
 {
     OS_MUTEX  **pp_mutex;
 
+#if (OS_MUTEX_FAST_EN > 0u)
+    if (p_mutex->GrpLinked == OS_FALSE) {                   /* See Note #2                                            */
+        return;
+    }
+    p_mutex->GrpLinked = OS_FALSE;
+#endif
+
     pp_mutex = &p_tcb->MutexGrpHeadPtr;
 
     while(*pp_mutex != p_mutex) {
@@ -1035,17 +1510,39 @@ void  OS_MutexGrpRemove (OS_TCB  *p_tcb, OS_MUTEX  *p_mutex)
 * Returns    : Highest priority pending or OS_CFG_PRIO_MAX - 1u if none found.
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) When OS_CFG_MUTEX_GRP_SORT_EN is enabled, the first mutex of the group has the highest priority
+*                 waiter and the group is not scanned.
+*
+*              3) The ceiling of a mutex counts as a waiter (see MUTUAL EXCLUSION SEMAPHORES Note #3 in os.h).
+*
+*              4) The waiters of the reader/writer locks held by the task are included, so that the priority a task
+*                 inherits is the same whichever kind of lock it gave up last.
+*
+*              5) So is the client whose call the task is serving, the server keeps the priority lent by OSCall() when
+*                 it releases a lock before it replies.
 ************************************************************************************************************************
 */
 
 OS_PRIO  OS_MutexGrpPrioFindHighest (OS_TCB  *p_tcb)
 {
-    OS_MUTEX  **pp_mutex;
     OS_PRIO     highest_prio;
-    OS_PRIO     prio;
+#if (OS_CFG_MUTEX_GRP_SORT_EN == 0u)
+    OS_MUTEX  **pp_mutex;
     OS_TCB     *p_head;
+#endif
+#if (OS_CFG_MUTEX_GRP_SORT_EN == 0u) || (OS_CFG_RWLOCK_EN > 0u) || (OS_CFG_CALL_EN > 0u)
+    OS_PRIO     prio;
+#endif
 
 
+#if (OS_CFG_MUTEX_GRP_SORT_EN > 0u)
+    if (p_tcb->MutexGrpHeadPtr == (OS_MUTEX *)0) {
+        highest_prio = (OS_PRIO)(OS_CFG_PRIO_MAX - 1u);
+    } else {
+        highest_prio = OS_MutexGrpPrioGet(p_tcb->MutexGrpHeadPtr); /* See Note #2                                       */
+    }
+#else
     highest_prio = (OS_PRIO)(OS_CFG_PRIO_MAX - 1u);
     pp_mutex = &p_tcb->MutexGrpHeadPtr;
 
@@ -1057,13 +1554,81 @@ OS_PRIO  OS_MutexGrpPrioFindHighest (OS_TCB  *p_tcb)
                 highest_prio = prio;
             }
         }
+#if (OS_CFG_MUTEX_CEILING_EN > 0u)
+        prio = (*pp_mutex)->CeilingPrio;                    /* See Note #3                                            */
+        if (prio < highest_prio) {
+            highest_prio = prio;
+        }
+#endif
         pp_mutex = &(*pp_mutex)->MutexGrpNextPtr;
     }
+#endif
+
+#if (OS_CFG_RWLOCK_EN > 0u)
+    prio = OS_RwLockPrioFindHighest(p_tcb);                 /* See Note #4                                            */
+    if (prio < highest_prio) {
+        highest_prio = prio;
+    }
+#endif
+
+#if (OS_CFG_CALL_EN > 0u)
+    if (p_tcb->CallClientPtr != (OS_TCB *)0) {              /* See Note #5                                            */
+        prio = p_tcb->CallClientPtr->Prio;
+        if (prio < highest_prio) {
+            highest_prio = prio;
+        }
+    }
+#endif
 
     return (highest_prio);
 }
 
 
+/*
+************************************************************************************************************************
+*                                        MUTEX GROUP UPDATE AFTER A WAITER CHANGE
+*
+* Description: This function is called by the kernel when the first waiter of a mutex, or its priority, changed.  It
+*              moves the mutex to its new position in the group of its owner.
+*
+* Argument(s): p_mutex      is a pointer to the mutex whose pend list changed.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) A mutex that is not in the group of its owner, while its ownership is being handed over, is left
+*                 alone.  OS_MutexGrpAdd() positions it when it is added to the group of the new owner.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MUTEX_GRP_SORT_EN > 0u)
+void  OS_MutexGrpPrioUpdate (OS_MUTEX  *p_mutex)
+{
+    OS_MUTEX  **pp_mutex;
+    OS_TCB     *p_tcb;
+
+
+    p_tcb = p_mutex->OwnerTCBPtr;
+    if (p_tcb == (OS_TCB *)0) {
+        return;
+    }
+
+    pp_mutex = &p_tcb->MutexGrpHeadPtr;
+    while ((*pp_mutex != (OS_MUTEX *)0) &&
+           (*pp_mutex != p_mutex)) {
+        pp_mutex = &(*pp_mutex)->MutexGrpNextPtr;
+    }
+    if (*pp_mutex == (OS_MUTEX *)0) {                       /* See Note #2                                            */
+        return;
+    }
+
+   *pp_mutex = p_mutex->MutexGrpNextPtr;                    /* Unlink the mutex and insert it again at its new place  */
+    OS_MutexGrpAdd(p_tcb, p_mutex);
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                               MUTEX GROUP POST ALL
@@ -1112,8 +1677,11 @@ void  OS_MutexGrpPostAll (OS_TCB  *p_tcb)
         } else {
                                                                 /* Get TCB from head of pend list                       */
             p_tcb_new                = p_pend_list->HeadPtr;
-            p_mutex->OwnerTCBPtr     = p_tcb;                   /* Give mutex to new owner                              */
+            p_mutex->OwnerTCBPtr     = p_tcb_new;               /* Give mutex to new owner                              */
             p_mutex->OwnerNestingCtr = 1u;
+#if (OS_CFG_MUTEX_BLOCK_STAT_EN > 0u)
+            p_mutex->OwnerTS         = ts;
+#endif
             OS_MutexGrpAdd(p_tcb_new, p_mutex);
                                                                 /* Post to mutex                                        */
             OS_Post((OS_PEND_OBJ *)((void *)p_mutex),
@@ -1121,6 +1689,9 @@ void  OS_MutexGrpPostAll (OS_TCB  *p_tcb)
                                    (void *)0,
                                    0u,
                                    ts);
+#if (OS_CFG_MUTEX_CEILING_EN > 0u)
+            OS_MutexCeilingRaise(p_tcb_new, p_mutex);
+#endif
         }
 
         p_mutex = p_mutex_next;
@@ -1128,4 +1699,367 @@ void  OS_MutexGrpPostAll (OS_TCB  *p_tcb)
 
 }
 
+
+/*
+************************************************************************************************************************
+*                                           PRIORITY OF A MUTEX IN A GROUP
+*
+* Description: This function returns the priority used to sort a mutex in the group of its owner.
+*
+* Argument(s): p_mutex      is a pointer to the mutex.
+*
+* Returns    : The priority of the first waiter of the mutex or OS_CFG_PRIO_MAX - 1u if no task is waiting.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The ceiling of the mutex is returned instead when it is higher.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MUTEX_GRP_SORT_EN > 0u)
+static  OS_PRIO  OS_MutexGrpPrioGet (OS_MUTEX  *p_mutex)
+{
+    OS_TCB   *p_head;
+    OS_PRIO   prio;
+
+
+    p_head = p_mutex->PendList.HeadPtr;
+    if (p_head == (OS_TCB *)0) {
+        prio = (OS_PRIO)(OS_CFG_PRIO_MAX - 1u);
+    } else {
+        prio = p_head->Prio;
+    }
+#if (OS_CFG_MUTEX_CEILING_EN > 0u)
+    if (p_mutex->CeilingPrio < prio) {                      /* See Note #2                                            */
+        prio = p_mutex->CeilingPrio;
+    }
+#endif
+    return (prio);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                           RAISE THE OWNER OF A MUTEX TO ITS CEILING
+*
+* Description: This function is called when a task becomes the owner of a mutex that has a ceiling.  The task is raised
+*              to the ceiling priority if it runs at a lower priority.
+*
+* Argument(s): p_tcb        is a pointer to the tcb of the new owner.
+*
+*              p_mutex      is a pointer to the mutex.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The owner is lowered again by the code that removes the mutex from its group, which takes the ceilings
+*                 of the mutexes it still owns into account.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MUTEX_CEILING_EN > 0u)
+static  void  OS_MutexCeilingRaise (OS_TCB    *p_tcb,
+                                    OS_MUTEX  *p_mutex)
+{
+    if (p_mutex->CeilingPrio < p_tcb->Prio) {
+        OS_TaskChangePrio(p_tcb, p_mutex->CeilingPrio);
+        OS_TRACE_MUTEX_TASK_PRIO_INHERIT(p_tcb, p_tcb->Prio);
+        if (p_tcb == OSTCBCurPtr) {
+            OSPrioCur = p_tcb->Prio;
+        }
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                       RAISE THE NEW OWNER OF A MUTEX TO ITS FIRST WAITER
+*
+* Description: This function is called when a task takes a mutex in throughput mode that is available while other
+*              tasks wait on it.  The task is raised to the priority of the first waiter if it runs at a lower priority.
+*
+* Argument(s): p_tcb        is a pointer to the tcb of the new owner.
+*
+*              p_mutex      is a pointer to the mutex, already in the group of 'p_tcb'.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The waiters did not pass their priority on to anybody while the mutex was available, so the new owner
+*                 inherits it here, as it would have if they had pended after it took the mutex.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MUTEX_THROUGHPUT_EN > 0u)
+static  void  OS_MutexWaiterInherit (OS_TCB    *p_tcb,
+                                     OS_MUTEX  *p_mutex)
+{
+    OS_TCB  *p_head;
+
+
+    p_head = p_mutex->PendList.HeadPtr;
+    if ((p_head        != (OS_TCB *)0) &&
+        (p_head->Prio  <  p_tcb->Prio)) {
+        OS_TaskChangePrio(p_tcb, p_head->Prio);
+        OS_TRACE_MUTEX_TASK_PRIO_INHERIT(p_tcb, p_tcb->Prio);
+        if (p_tcb == OSTCBCurPtr) {
+            OSPrioCur = p_tcb->Prio;
+        }
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                        SPIN ON A MUTEX OWNED BY A RUNNING TASK
+*
+* Description: This function is called by OSMutexPend() before it blocks.  It polls the mutex for as long as it is owned
+*              by a task that is executing, up to OS_CFG_MUTEX_SPIN_CNT times.
+*
+* Argument(s): p_mutex      is a pointer to the mutex.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The function returns as soon as the mutex is available or its owner stops running.  OSMutexPend()
+*                 then takes the mutex or blocks as usual (see MUTUAL EXCLUSION SEMAPHORES Note #4 in os.h).
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MUTEX_SPIN_CNT > 0u)
+static  void  OS_MutexSpin (OS_MUTEX  *p_mutex)
+{
+    CPU_INT32U   spin_ctr;
+    OS_TCB      *p_tcb;
+    CPU_BOOLEAN  spin;
+    CPU_SR_ALLOC();
+
+
+    for (spin_ctr = 0u; spin_ctr < OS_CFG_MUTEX_SPIN_CNT; spin_ctr++) {
+        CPU_CRITICAL_ENTER();
+        p_tcb = p_mutex->OwnerTCBPtr;
+        if ((p_tcb                    == (OS_TCB *)0) ||        /* See Note #2                                          */
+            (p_tcb                    == OSTCBCurPtr)) {
+            spin = OS_FALSE;
+        } else {
+            spin = OS_CPU_TASK_IS_RUNNING(p_tcb);
+        }
+        CPU_CRITICAL_EXIT();
+        if (spin == OS_FALSE) {
+            return;
+        }
+        OS_CPU_SPIN_PAUSE();
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                            CLAIM A FREE MUTEX WITHOUT LOCKING
+*
+* Description: This function is called by OSMutexPend() to claim an available mutex with the port's exclusive
+*              load/store primitives.
+*
+* Argument(s): p_mutex      is a pointer to the mutex.
+*
+*              p_ts         is a pointer to a variable that receives the timestamp of the last release, if not NULL.
+*
+* Returns    : OS_TRUE      if the caller now owns the mutex.
+*              OS_FALSE     if the mutex is owned, or has a ceiling, and the regular path must be taken.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The store fails if anything ran between the load and the store, including a task that took the mutex
+*                 or assigned it a ceiling, so the owner and the ceiling are read again before each attempt.
+*
+*              3) The nesting counter is only used by the owner, which is the caller from here on.
+*
+*              4) A mutex in throughput mode can be available with tasks waiting on it.  The caller must then inherit
+*                 the priority of the first waiter, which the regular path takes care of.
+************************************************************************************************************************
+*/
+
+#if (OS_MUTEX_FAST_EN > 0u)
+static  CPU_BOOLEAN  OS_MutexFastPend (OS_MUTEX  *p_mutex,
+                                       CPU_TS    *p_ts)
+{
+    do {                                                    /* See Note #2                                            */
+        if (OS_CPU_PtrLoadExcl((void * volatile *)&p_mutex->OwnerTCBPtr) != (void *)0) {
+            return (OS_FALSE);
+        }
+#if (OS_CFG_MUTEX_CEILING_EN > 0u)
+        if (p_mutex->CeilingPrio != OS_PRIO_INIT) {
+            return (OS_FALSE);
+        }
+#endif
+#if (OS_CFG_MUTEX_THROUGHPUT_EN > 0u)
+        if (p_mutex->PendList.HeadPtr != (OS_TCB *)0) {     /* See Note #4                                            */
+            return (OS_FALSE);
+        }
+#endif
+    } while (OS_CPU_PtrStoreExcl((void * volatile *)&p_mutex->OwnerTCBPtr, (void *)OSTCBCurPtr) == OS_FALSE);
+
+    p_mutex->OwnerNestingCtr = 1u;                          /* See Note #3                                            */
+#if (OS_CFG_MUTEX_BLOCK_STAT_EN > 0u)
+    p_mutex->OwnerTS         = OS_TS_GET();
+#endif
+#if (OS_CFG_TS_EN > 0u)
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts = p_mutex->TS;
+    }
+#else
+    (void)p_ts;
+#endif
+    return (OS_TRUE);
+}
+
+
+/*
+************************************************************************************************************************
+*                                           RELEASE A MUTEX WITHOUT LOCKING
+*
+* Description: This function is called by OSMutexPost() to release a mutex claimed by OS_MutexFastPend() with the
+*              port's exclusive load/store primitives.
+*
+* Argument(s): p_mutex      is a pointer to the mutex.
+*
+* Returns    : OS_TRUE      if the mutex was released.
+*              OS_FALSE     if the regular path must be taken.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) A task that pends on the mutex adds it to the group of the owner before blocking.  The store fails
+*                 if that happened after the load, and the next load sees '.GrpLinked' set: the mutex then has a
+*                 waiter to hand over to, and possibly a priority to give back, which the regular path takes care of.
+************************************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  OS_MutexFastPost (OS_MUTEX  *p_mutex)
+{
+    if ((p_mutex->OwnerTCBPtr     != OSTCBCurPtr) ||
+        (p_mutex->OwnerNestingCtr != 1u)          ||
+        (p_mutex->GrpLinked       == OS_TRUE)) {
+        return (OS_FALSE);
+    }
+
+#if (OS_CFG_TS_EN > 0u)
+    p_mutex->TS = OS_TS_GET();
+#endif
+    p_mutex->OwnerNestingCtr = 0u;
+    do {                                                    /* See Note #2                                            */
+        (void)OS_CPU_PtrLoadExcl((void * volatile *)&p_mutex->OwnerTCBPtr);
+        if (p_mutex->GrpLinked == OS_TRUE) {
+            p_mutex->OwnerNestingCtr = 1u;
+            return (OS_FALSE);
+        }
+    } while (OS_CPU_PtrStoreExcl((void * volatile *)&p_mutex->OwnerTCBPtr, (void *)0) == OS_FALSE);
+
+    return (OS_TRUE);
+}
+#endif
+
+/*
+************************************************************************************************************************
+*                                        RECORD THE CHAIN OF OWNERS BLOCKING A TASK
+*
+* Description: This function is called by OSMutexPend() before the current task blocks on a mutex.  It follows the
+*              owner of the mutex, the mutex that owner waits for, its owner, and so on, and records each owner with
+*              the time it had been holding its mutex.
+*
+* Argument(s): p_mutex      is a pointer to the mutex the current task is about to block on.
+*
+*              p_chain      is a pointer to the chain to fill.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is called with interrupts disabled.  The walk stops at an owner that is not waiting
+*                 for a mutex, or when it gets back to the current task, which means the tasks are deadlocked.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MUTEX_BLOCK_STAT_EN > 0u)
+static  void  OS_MutexChainGet (OS_MUTEX        *p_mutex,
+                                OS_MUTEX_CHAIN  *p_chain)
+{
+    OS_TCB      *p_tcb;
+    CPU_INT08U   depth;
+    CPU_TS       ts;
+
+
+    ts                 = OS_TS_GET();
+    p_chain->TaskPtr   = OSTCBCurPtr;
+    p_chain->MutexPtr  = p_mutex;
+    p_chain->BlockTime = ts;                                    /* Start of the wait until the task is readied          */
+    depth              = 0u;
+    p_tcb              = p_mutex->OwnerTCBPtr;
+    while ((p_tcb != (OS_TCB *)0) &&                            /* See Note #2                                          */
+           (p_tcb != OSTCBCurPtr) &&
+           (depth <  (CPU_INT08U)-1)) {
+        if (depth < OS_CFG_MUTEX_CHAIN_MAX) {
+            p_chain->OwnerTbl[depth] =       p_tcb;
+            p_chain->HoldTbl[depth]  = (CPU_TS)(ts - p_mutex->OwnerTS);
+        }
+        depth++;
+        if (p_tcb->PendOn != OS_TASK_PEND_ON_MUTEX) {           /* Is the owner itself blocked on a mutex?              */
+            break;
+        }
+        p_mutex = (OS_MUTEX *)((void *)p_tcb->PendObjPtr);      /* Yes, go on with the owner of that mutex              */
+        p_tcb   =  p_mutex->OwnerTCBPtr;
+    }
+    p_chain->Depth = depth;
+}
+
+
+/*
+************************************************************************************************************************
+*                                          UPDATE THE BLOCKING STATISTICS OF A MUTEX
+*
+* Description: This function is called by OSMutexPend() once the current task has been readied after blocking on a
+*              mutex.  It charges the time the task stayed blocked to the mutex and keeps the chain if it is the
+*              longest wait observed so far.
+*
+* Argument(s): p_mutex      is a pointer to the mutex the current task blocked on.
+*
+*              p_chain      is a pointer to the chain recorded by OS_MutexChainGet().
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+static  void  OS_MutexBlockStatUpdate (OS_MUTEX        *p_mutex,
+                                       OS_MUTEX_CHAIN  *p_chain)
+{
+    CPU_TS  elapsed;
+
+
+    elapsed                  = (CPU_TS)(OS_TS_GET() - p_chain->BlockTime);
+    p_chain->BlockTime       =  elapsed;
+    p_mutex->BlockCtr++;
+    p_mutex->BlockTimeTotal += (OS_CYCLES)elapsed;
+    if (p_mutex->BlockTimeMax < elapsed) {
+        p_mutex->BlockTimeMax = elapsed;
+    }
+    if (p_mutex->BlockDepthMax < p_chain->Depth) {
+        p_mutex->BlockDepthMax = p_chain->Depth;
+    }
+    if ((OSMutexChainWorst.TaskPtr   == (OS_TCB *)0) ||         /* Longest wait observed so far?                        */
+        (OSMutexChainWorst.BlockTime <  elapsed)) {
+        OSMutexChainWorst = *p_chain;
+    }
+}
+#endif
+
 #endif /* OS_CFG_MUTEX_EN */
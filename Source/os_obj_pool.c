@@ -0,0 +1,728 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          KERNEL OBJECT POOLS
+*
+* File    : os_obj_pool.c
+* Version : V3.08.00
+*********************************************************************************************************
+* Note(s) : (1) OSSemAlloc(), OSQAlloc() and OSTmrAlloc() take a control block from a pool sized in os_cfg_app.h
+*               and create the object in it.  OSSemFree(), OSQFree() and OSTmrFree() delete the object and return
+*               its block.  Subsystems that create and delete objects at run-time then neither keep pools of their
+*               own nor touch a heap.
+*
+*           (2) Getting and returning a block is O(1) and can be done from an ISR (see OSMemGet()/OSMemPut()).
+*               Creating and deleting the object are not allowed from an ISR, so neither are the functions in this
+*               file.
+*********************************************************************************************************
+*/
+
+#define   MICRIUM_SOURCE
+#define   OS_CRIT_SITE_ID                   OS_CRIT_SITE_OBJ_POOL
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_obj_pool__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_OBJ_POOL_EN > 0u)
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  OS_OBJ_POOL  *OS_ObjPoolGet          (OS_OBJ_TYPE   type);
+
+#if (OS_SEM_POOL_EN > 0u) || (OS_Q_POOL_EN > 0u) || (OS_TMR_POOL_EN > 0u)
+static  CPU_BOOLEAN   OS_ObjPoolOwns         (OS_OBJ_POOL  *p_pool,
+                                              void         *p_blk);
+
+static  void          OS_ObjPoolUsedMaxUpdate(OS_OBJ_POOL  *p_pool);
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                              ALLOCATE A SEMAPHORE
+*
+* Description: This function takes a semaphore from the kernel's semaphore pool and creates it.
+*
+* Arguments  : p_name    is a pointer to the name you would like to give the semaphore.
+*
+*              cnt       is the initial value for the semaphore.
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                    If the call was successful
+*                            OS_ERR_MEM_NO_FREE_BLKS        If all the semaphores of the pool are in use
+*
+*                        or any of the errors returned by OSSemCreate().
+*
+* Returns    : A pointer to the semaphore, or a NULL pointer if an error is detected.
+*
+* Note(s)    : 1) The semaphore MUST be deleted with OSSemFree(), not OSSemDel().
+************************************************************************************************************************
+*/
+
+#if (OS_SEM_POOL_EN > 0u)
+OS_SEM  *OSSemAlloc (CPU_CHAR    *p_name,
+                     OS_SEM_CTR   cnt,
+                     OS_ERR      *p_err)
+{
+    OS_SEM  *p_sem;
+    OS_ERR   err;
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_SEM *)0);
+    }
+#endif
+
+    p_sem = (OS_SEM *)OSMemGet(&OSSemPool.Mem, p_err);
+    if (p_sem == (OS_SEM *)0) {
+        return ((OS_SEM *)0);
+    }
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_sem->Type = OS_OBJ_TYPE_NONE;                             /* The free list link may have overwritten the type     */
+#endif
+
+    OSSemCreate(p_sem, p_name, cnt, p_err);
+    if (*p_err != OS_ERR_NONE) {
+        OSMemPut(&OSSemPool.Mem, (void *)p_sem, &err);          /* Give the block back, keep the error of the create    */
+        return ((OS_SEM *)0);
+    }
+
+    OS_ObjPoolUsedMaxUpdate(&OSSemPool);
+    return (p_sem);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                FREE A SEMAPHORE
+*
+* Description: This function deletes a semaphore obtained from OSSemAlloc() and returns it to the semaphore pool.
+*
+* Arguments  : p_sem     is a pointer to the semaphore.
+*
+*              opt       determines delete options as follows (see OSSemDel()):
+*
+*                            OS_OPT_DEL_NO_PEND          Delete semaphore ONLY if no task pending
+*                            OS_OPT_DEL_ALWAYS           Deletes the semaphore even if tasks are waiting.
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                    The call was successful and the semaphore was freed
+*                            OS_ERR_MEM_INVALID_P_BLK       If 'p_sem' was not obtained from OSSemAlloc()
+*                            OS_ERR_OBJ_PTR_NULL            If 'p_sem' is a NULL pointer
+*
+*                        or any of the errors returned by OSSemDel().
+*
+* Returns    : == 0          if no tasks were waiting on the semaphore, or upon error.
+*              >  0          if one or more tasks waiting on the semaphore are now readied and informed.
+*
+* Note(s)    : 1) The semaphore is only returned to the pool if OSSemDel() succeeded.
+************************************************************************************************************************
+*/
+
+OS_OBJ_QTY  OSSemFree (OS_SEM  *p_sem,
+                       OS_OPT   opt,
+                       OS_ERR  *p_err)
+{
+    OS_OBJ_QTY  nbr_tasks;
+    OS_ERR      err;
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_sem == (OS_SEM *)0) {                                 /* Validate 'p_sem'                                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+    if (OS_ObjPoolOwns(&OSSemPool, (void *)p_sem) == OS_FALSE) {
+       *p_err = OS_ERR_MEM_INVALID_P_BLK;                       /* Not from the pool, OSSemDel() is to be used          */
+        return (0u);
+    }
+
+    nbr_tasks = OSSemDel(p_sem, opt, p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return (0u);
+    }
+
+    OSMemPut(&OSSemPool.Mem, (void *)p_sem, &err);
+    return (nbr_tasks);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                             ALLOCATE A MESSAGE QUEUE
+*
+* Description: This function takes a message queue from the kernel's queue pool and creates it.
+*
+* Arguments  : p_name    is a pointer to the name you would like to give the message queue.
+*
+*              max_qty   indicates the maximum size of the message queue (must be non-zero).
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                    If the call was successful
+*                            OS_ERR_MEM_NO_FREE_BLKS        If all the queues of the pool are in use
+*
+*                        or any of the errors returned by OSQCreate().
+*
+* Returns    : A pointer to the message queue, or a NULL pointer if an error is detected.
+*
+* Note(s)    : 1) The messages are still taken from the pool of OS_MSG shared by all queues.
+*
+*              2) The queue MUST be deleted with OSQFree(), not OSQDel().
+************************************************************************************************************************
+*/
+
+#if (OS_Q_POOL_EN > 0u)
+OS_Q  *OSQAlloc (CPU_CHAR    *p_name,
+                 OS_MSG_QTY   max_qty,
+                 OS_ERR      *p_err)
+{
+    OS_Q    *p_q;
+    OS_ERR   err;
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_Q *)0);
+    }
+#endif
+
+    p_q = (OS_Q *)OSMemGet(&OSQPool.Mem, p_err);
+    if (p_q == (OS_Q *)0) {
+        return ((OS_Q *)0);
+    }
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_q->Type = OS_OBJ_TYPE_NONE;                               /* The free list link may have overwritten the type     */
+#endif
+
+    OSQCreate(p_q, p_name, max_qty, p_err);
+    if (*p_err != OS_ERR_NONE) {
+        OSMemPut(&OSQPool.Mem, (void *)p_q, &err);
+        return ((OS_Q *)0);
+    }
+
+    OS_ObjPoolUsedMaxUpdate(&OSQPool);
+    return (p_q);
+}
+
+
+/*
+************************************************************************************************************************
+*                                              FREE A MESSAGE QUEUE
+*
+* Description: This function deletes a message queue obtained from OSQAlloc() and returns it to the queue pool.
+*
+* Arguments  : p_q       is a pointer to the message queue.
+*
+*              opt       determines delete options as follows (see OSQDel()):
+*
+*                            OS_OPT_DEL_NO_PEND          Delete the queue ONLY if no task pending
+*                            OS_OPT_DEL_ALWAYS           Deletes the queue even if tasks are waiting.
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                    The call was successful and the queue was freed
+*                            OS_ERR_MEM_INVALID_P_BLK       If 'p_q' was not obtained from OSQAlloc()
+*                            OS_ERR_OBJ_PTR_NULL            If 'p_q' is a NULL pointer
+*
+*                        or any of the errors returned by OSQDel().
+*
+* Returns    : == 0          if no tasks were waiting on the queue, or upon error.
+*              >  0          if one or more tasks waiting on the queue are now readied and informed.
+*
+* Note(s)    : 1) The messages left in the queue are returned to the pool of OS_MSG by OSQDel().
+************************************************************************************************************************
+*/
+
+OS_OBJ_QTY  OSQFree (OS_Q    *p_q,
+                     OS_OPT   opt,
+                     OS_ERR  *p_err)
+{
+    OS_OBJ_QTY  nbr_tasks;
+    OS_ERR      err;
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_q == (OS_Q *)0) {                                     /* Validate 'p_q'                                       */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+    if (OS_ObjPoolOwns(&OSQPool, (void *)p_q) == OS_FALSE) {
+       *p_err = OS_ERR_MEM_INVALID_P_BLK;
+        return (0u);
+    }
+
+    nbr_tasks = OSQDel(p_q, opt, p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return (0u);
+    }
+
+    OSMemPut(&OSQPool.Mem, (void *)p_q, &err);
+    return (nbr_tasks);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                ALLOCATE A TIMER
+*
+* Description: This function takes a timer from the kernel's timer pool and creates it.
+*
+* Arguments  : p_name          is a pointer to an ASCII string used to name the timer (useful for debugging).
+*
+*              dly             Initial delay (see OSTmrCreate()).
+*
+*              period          The 'period' being repeated for the timer (see OSTmrCreate()).
+*
+*              opt             Specifies either:
+*
+*                                  OS_OPT_TMR_ONE_SHOT       The timer counts down only once
+*                                  OS_OPT_TMR_PERIODIC       The timer counts down and then reloads itself
+*
+*              p_callback      Is a pointer to a callback function that will be called when the timer expires.
+*
+*              p_callback_arg  Is an argument (a pointer) that is passed to the callback function when it is called.
+*
+*              p_err           Is a pointer to an error code.  '*p_err' will contain one of the following:
+*
+*                                  OS_ERR_NONE                    If the call was successful
+*                                  OS_ERR_MEM_NO_FREE_BLKS        If all the timers of the pool are in use
+*
+*                              or any of the errors returned by OSTmrCreate().
+*
+* Returns    : A pointer to the timer, or a NULL pointer if an error is detected.
+*
+* Note(s)    : 1) The timer is created stopped, as with OSTmrCreate().  It MUST be deleted with OSTmrFree(), not
+*                 OSTmrDel().
+************************************************************************************************************************
+*/
+
+#if (OS_TMR_POOL_EN > 0u)
+OS_TMR  *OSTmrAlloc (CPU_CHAR             *p_name,
+                     OS_TICK               dly,
+                     OS_TICK               period,
+                     OS_OPT                opt,
+                     OS_TMR_CALLBACK_PTR   p_callback,
+                     void                 *p_callback_arg,
+                     OS_ERR               *p_err)
+{
+    OS_TMR  *p_tmr;
+    OS_ERR   err;
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_TMR *)0);
+    }
+#endif
+
+    p_tmr = (OS_TMR *)OSMemGet(&OSTmrPool.Mem, p_err);
+    if (p_tmr == (OS_TMR *)0) {
+        return ((OS_TMR *)0);
+    }
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_tmr->Type = OS_OBJ_TYPE_NONE;                             /* The free list link may have overwritten the type     */
+#endif
+
+    OSTmrCreate(p_tmr, p_name, dly, period, opt, p_callback, p_callback_arg, p_err);
+    if (*p_err != OS_ERR_NONE) {
+        OSMemPut(&OSTmrPool.Mem, (void *)p_tmr, &err);
+        return ((OS_TMR *)0);
+    }
+
+    OS_ObjPoolUsedMaxUpdate(&OSTmrPool);
+    return (p_tmr);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  FREE A TIMER
+*
+* Description: This function stops and deletes a timer obtained from OSTmrAlloc() and returns it to the timer pool.
+*
+* Arguments  : p_tmr          Is a pointer to the timer.
+*
+*              p_err          Is a pointer to an error code.  '*p_err' will contain one of the following:
+*
+*                                 OS_ERR_NONE                    The timer was deleted and freed
+*                                 OS_ERR_MEM_INVALID_P_BLK       If 'p_tmr' was not obtained from OSTmrAlloc()
+*                                 OS_ERR_TMR_INVALID             If 'p_tmr' is a NULL pointer
+*
+*                             or any of the errors returned by OSTmrDel().
+*
+* Returns    : OS_TRUE   if the timer was deleted and freed
+*              OS_FALSE  if not or upon an error
+*
+* Note(s)    : 1) A timer MUST NOT free itself from its own callback if the callback uses the timer afterwards.
+************************************************************************************************************************
+*/
+
+CPU_BOOLEAN  OSTmrFree (OS_TMR  *p_tmr,
+                        OS_ERR  *p_err)
+{
+    CPU_BOOLEAN  success;
+    OS_ERR       err;
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_tmr == (OS_TMR *)0) {
+       *p_err = OS_ERR_TMR_INVALID;
+        return (OS_FALSE);
+    }
+#endif
+
+    if (OS_ObjPoolOwns(&OSTmrPool, (void *)p_tmr) == OS_FALSE) {
+       *p_err = OS_ERR_MEM_INVALID_P_BLK;
+        return (OS_FALSE);
+    }
+
+    success = OSTmrDel(p_tmr, p_err);
+    if (success == OS_FALSE) {
+        return (OS_FALSE);
+    }
+
+    OSMemPut(&OSTmrPool.Mem, (void *)p_tmr, &err);
+    return (OS_TRUE);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                         GET THE NUMBER OF OBJECTS IN USE
+*
+* Description: Returns the number of objects of a type currently allocated from the kernel's pool.
+*
+* Arguments  : type      is the type of object: OS_OBJ_TYPE_SEM, OS_OBJ_TYPE_Q or OS_OBJ_TYPE_TMR.
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                    If the call was successful
+*                            OS_ERR_OBJ_TYPE                If there is no pool for 'type'
+*
+* Returns    : The number of objects in use, 0 if an error is detected.
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+OS_MEM_QTY  OSObjPoolUsedGet (OS_OBJ_TYPE   type,
+                              OS_ERR       *p_err)
+{
+    OS_OBJ_POOL  *p_pool;
+    OS_MEM_QTY    nbr_used;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+    p_pool = OS_ObjPoolGet(type);
+    if (p_pool == (OS_OBJ_POOL *)0) {
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+
+    CPU_CRITICAL_ENTER();
+    nbr_used = (OS_MEM_QTY)(p_pool->Mem.NbrMax - p_pool->Mem.NbrFree);
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+    return (nbr_used);
+}
+
+
+/*
+************************************************************************************************************************
+*                                        GET THE HIGH-WATER MARK OF A POOL
+*
+* Description: Returns the largest number of objects of a type that were allocated at the same time from the kernel's
+*              pool.
+*
+* Arguments  : type      is the type of object: OS_OBJ_TYPE_SEM, OS_OBJ_TYPE_Q or OS_OBJ_TYPE_TMR.
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                    If the call was successful
+*                            OS_ERR_OBJ_TYPE                If there is no pool for 'type'
+*
+* Returns    : The peak number of objects in use, 0 if an error is detected.
+*
+* Note(s)    : 1) Compare it with OS_CFG_SEM_POOL_SIZE, OS_CFG_Q_POOL_SIZE or OS_CFG_TMR_POOL_SIZE to size the pools.
+************************************************************************************************************************
+*/
+
+OS_MEM_QTY  OSObjPoolUsedMaxGet (OS_OBJ_TYPE   type,
+                                 OS_ERR       *p_err)
+{
+    OS_OBJ_POOL  *p_pool;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+    p_pool = OS_ObjPoolGet(type);
+    if (p_pool == (OS_OBJ_POOL *)0) {
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+
+   *p_err = OS_ERR_NONE;
+    return (p_pool->NbrUsedMax);
+}
+
+
+/*
+************************************************************************************************************************
+*                                          INITIALIZE THE OBJECT POOLS
+*
+* Description: This function is called by OSInit() to create the memory partition of each object pool over the storage
+*              reserved in os_cfg_app.c.
+*
+* Arguments  : p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                    If the pools were created
+*
+*                        or any of the errors returned by OSMemCreateAligned().
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The storage has one extra cache line so that, once aligned, it holds exactly the configured number
+*                 of blocks (see OS_OBJ_POOL_STORAGE_SIZE()).
+************************************************************************************************************************
+*/
+
+void  OS_ObjPoolInit (OS_ERR  *p_err)
+{
+   *p_err = OS_ERR_NONE;
+
+#if (OS_SEM_POOL_EN > 0u)
+    OSMemCreateAligned(&OSSemPool.Mem,
+#if (OS_CFG_DBG_EN > 0u)
+                       (CPU_CHAR *)"OS Sem Pool",
+#else
+                       (CPU_CHAR *)0,
+#endif
+                       (void *)&OSCfg_SemPool[0],
+                       sizeof(OSCfg_SemPool),
+                       (OS_MEM_SIZE)sizeof(OS_SEM),
+                       OS_OPT_MEM_NONE,
+                       p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+    OSSemPool.NbrUsedMax = 0u;
+#endif
+
+#if (OS_Q_POOL_EN > 0u)
+    OSMemCreateAligned(&OSQPool.Mem,
+#if (OS_CFG_DBG_EN > 0u)
+                       (CPU_CHAR *)"OS Q Pool",
+#else
+                       (CPU_CHAR *)0,
+#endif
+                       (void *)&OSCfg_QPool[0],
+                       sizeof(OSCfg_QPool),
+                       (OS_MEM_SIZE)sizeof(OS_Q),
+                       OS_OPT_MEM_NONE,
+                       p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+    OSQPool.NbrUsedMax = 0u;
+#endif
+
+#if (OS_TMR_POOL_EN > 0u)
+    OSMemCreateAligned(&OSTmrPool.Mem,
+#if (OS_CFG_DBG_EN > 0u)
+                       (CPU_CHAR *)"OS Tmr Pool",
+#else
+                       (CPU_CHAR *)0,
+#endif
+                       (void *)&OSCfg_TmrPool[0],
+                       sizeof(OSCfg_TmrPool),
+                       (OS_MEM_SIZE)sizeof(OS_TMR),
+                       OS_OPT_MEM_NONE,
+                       p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+    OSTmrPool.NbrUsedMax = 0u;
+#endif
+}
+
+
+/*
+************************************************************************************************************************
+*                                          FIND THE POOL OF AN OBJECT TYPE
+*
+* Description: Returns the pool holding the objects of type 'type'.
+*
+* Arguments  : type      is the type of object.
+*
+* Returns    : A pointer to the pool, or a NULL pointer if there is no pool for 'type'.
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+static  OS_OBJ_POOL  *OS_ObjPoolGet (OS_OBJ_TYPE  type)
+{
+#if (OS_SEM_POOL_EN > 0u)
+    if (type == OS_OBJ_TYPE_SEM) {
+        return (&OSSemPool);
+    }
+#endif
+#if (OS_Q_POOL_EN > 0u)
+    if (type == OS_OBJ_TYPE_Q) {
+        return (&OSQPool);
+    }
+#endif
+#if (OS_TMR_POOL_EN > 0u)
+    if (type == OS_OBJ_TYPE_TMR) {
+        return (&OSTmrPool);
+    }
+#endif
+    (void)type;
+    return ((OS_OBJ_POOL *)0);
+}
+
+
+#if (OS_SEM_POOL_EN > 0u) || (OS_Q_POOL_EN > 0u) || (OS_TMR_POOL_EN > 0u)
+/*
+************************************************************************************************************************
+*                                       CHECK THAT A BLOCK BELONGS TO A POOL
+*
+* Description: Determines whether 'p_blk' is the start of one of the blocks of the pool.
+*
+* Arguments  : p_pool    is a pointer to the pool.
+*
+*              p_blk     is a pointer to the control block of an object.
+*
+* Returns    : OS_TRUE   if the block belongs to the pool
+*              OS_FALSE  otherwise
+*
+* Note(s)    : 1) This keeps an object the application created in its own memory from being linked into the pool.
+************************************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  OS_ObjPoolOwns (OS_OBJ_POOL  *p_pool,
+                                     void         *p_blk)
+{
+    CPU_ADDR  offset;
+
+
+    if ((CPU_ADDR)p_blk < (CPU_ADDR)p_pool->Mem.AddrPtr) {
+        return (OS_FALSE);
+    }
+    offset = (CPU_ADDR)p_blk - (CPU_ADDR)p_pool->Mem.AddrPtr;
+    if (offset >= ((CPU_ADDR)p_pool->Mem.NbrMax * (CPU_ADDR)p_pool->Mem.BlkSize)) {
+        return (OS_FALSE);
+    }
+    if ((offset % (CPU_ADDR)p_pool->Mem.BlkSize) != 0u) {       /* Must point at the start of a block                   */
+        return (OS_FALSE);
+    }
+    return (OS_TRUE);
+}
+
+
+/*
+************************************************************************************************************************
+*                                        UPDATE THE HIGH-WATER MARK OF A POOL
+*
+* Description: Records the number of objects in use if it is the highest seen so far.
+*
+* Arguments  : p_pool    is a pointer to the pool.
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+static  void  OS_ObjPoolUsedMaxUpdate (OS_OBJ_POOL  *p_pool)
+{
+    OS_MEM_QTY  nbr_used;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    nbr_used = (OS_MEM_QTY)(p_pool->Mem.NbrMax - p_pool->Mem.NbrFree);
+    if (p_pool->NbrUsedMax < nbr_used) {
+        p_pool->NbrUsedMax = nbr_used;
+    }
+    CPU_CRITICAL_EXIT();
+}
+#endif
+#endif
@@ -0,0 +1,577 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                           OBJECT REGISTRY
+*
+* File    : os_obj_reg.c
+* Version : V3.08.00
+*********************************************************************************************************
+* Note(s) : (1) The registry complements the debug lists: it finds an object by name, or by ID, without
+*               walking them.  The lookups cost a few probes as long as OS_CFG_OBJ_REG_SIZE is kept well
+*               above the number of objects (e.g. twice as large).
+*
+*           (2) An object without a name (NULL) is not registered and has no ID.
+*
+*           (3) The trace IDs of the objects ('.TaskID', '.SemID', ...) belong to the trace recorder, which may
+*               store its own information in them.  A recorder that wants the registry IDs calls
+*               OSObjRegIdGet() from its OS_TRACE_xxx_CREATE() hooks.
+*********************************************************************************************************
+*/
+
+#define   MICRIUM_SOURCE
+#define   OS_CRIT_SITE_ID                   OS_CRIT_SITE_OBJ_REG
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_obj_reg__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_OBJ_REG_EN > 0u)
+/*
+************************************************************************************************************************
+*                                                   LOCAL CONSTANTS
+************************************************************************************************************************
+*/
+
+#define  OS_OBJ_REG_IX_MASK                 ((OS_OBJ_QTY)(OS_CFG_OBJ_REG_SIZE - 1u))
+
+#define  OS_OBJ_REG_TYPE_FREE               OS_OBJ_TYPE_NONE    /* Slot never used, ends a probe sequence               */
+#define  OS_OBJ_REG_TYPE_DEL                (OS_OBJ_TYPE)CPU_TYPE_CREATE('R', 'D', 'E', 'L')
+
+
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  CPU_INT32U    OS_ObjRegHash      (CPU_CHAR     *p_name);
+
+static  CPU_BOOLEAN   OS_ObjRegNameCmp   (CPU_CHAR     *p_name1,
+                                          CPU_CHAR     *p_name2);
+
+static  CPU_CHAR     *OS_ObjRegNameGet   (void         *p_obj,
+                                          OS_OBJ_TYPE   type);
+
+static  OS_OBJ_QTY    OS_ObjRegSlotGet   (void         *p_obj,
+                                          CPU_INT32U    hash);
+
+
+/*
+************************************************************************************************************************
+*                                                FIND AN OBJECT BY NAME
+*
+* Description: This function returns the object registered under a name.
+*
+* Arguments  : p_name    is the name of the object
+*
+*              type      is the type of the object (OS_OBJ_TYPE_TASK, OS_OBJ_TYPE_SEM, ...), or OS_OBJ_TYPE_NONE to
+*                        accept any type
+*
+*              p_id      is a pointer to where the ID of the object will be stored, or a NULL pointer
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE              The object was found
+*                            OS_ERR_NAME              If 'p_name' is a NULL pointer
+*                            OS_ERR_OBJ_NOT_FOUND     No object of this type is registered under this name
+*
+* Returns    : A pointer to the object, or a NULL pointer if none is found.
+*
+* Note(s)    : 1) When several objects share the name, one of them is returned.
+*
+*              2) The object may be deleted as soon as this function returns.  The caller must know that it lives
+*                 on before using the pointer.
+************************************************************************************************************************
+*/
+
+void  *OSObjRegFind (CPU_CHAR     *p_name,
+                     OS_OBJ_TYPE   type,
+                     OS_OBJ_QTY   *p_id,
+                     OS_ERR       *p_err)
+{
+    OS_OBJ_REG_ENTRY  *p_entry;
+    void              *p_obj;
+    CPU_INT32U         hash;
+    OS_OBJ_QTY         ix;
+    OS_OBJ_QTY         nbr;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_name == (CPU_CHAR *)0) {                              /* User must specify a name                             */
+       *p_err = OS_ERR_NAME;
+        return ((void *)0);
+    }
+#endif
+
+    hash  = OS_ObjRegHash(p_name);
+    p_obj = (void *)0;
+    ix    = (OS_OBJ_QTY)hash & OS_OBJ_REG_IX_MASK;
+    CPU_CRITICAL_ENTER();
+    for (nbr = 0u; nbr < OS_CFG_OBJ_REG_SIZE; nbr++) {          /* Probe from the slot of the name                      */
+        p_entry = &OSObjRegTbl[ix];
+        if (p_entry->Type == OS_OBJ_REG_TYPE_FREE) {            /* The name would have been placed here                 */
+            break;
+        }
+        if ((p_entry->ObjPtr != (void *)0) &&
+            (p_entry->Hash   == hash)      &&
+            ((type == OS_OBJ_TYPE_NONE) || (p_entry->Type == type))) {
+            if (OS_ObjRegNameCmp(p_entry->NamePtr, p_name) == OS_TRUE) {
+                p_obj = p_entry->ObjPtr;
+                break;
+            }
+        }
+        ix = (ix + 1u) & OS_OBJ_REG_IX_MASK;
+    }
+    CPU_CRITICAL_EXIT();
+
+    if (p_obj == (void *)0) {
+       *p_err = OS_ERR_OBJ_NOT_FOUND;
+        return ((void *)0);
+    }
+    if (p_id != (OS_OBJ_QTY *)0) {
+       *p_id = ix + 1u;
+    }
+   *p_err = OS_ERR_NONE;
+    return (p_obj);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 FIND AN OBJECT BY ID
+*
+* Description: This function returns the object that has an ID, e.g. to decode the IDs sent by a trace recorder.
+*
+* Arguments  : id        is the ID of the object (1 to OS_CFG_OBJ_REG_SIZE)
+*
+*              p_type    is a pointer to where the type of the object will be stored, or a NULL pointer
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE              The object was found
+*                            OS_ERR_OBJ_ID_INVALID    No object has this ID
+*
+* Returns    : A pointer to the object, or a NULL pointer if none has the ID.
+*
+* Note(s)    : 1) The ID of a deleted object is given to a later object.
+************************************************************************************************************************
+*/
+
+void  *OSObjRegGet (OS_OBJ_QTY    id,
+                    OS_OBJ_TYPE  *p_type,
+                    OS_ERR       *p_err)
+{
+    OS_OBJ_REG_ENTRY  *p_entry;
+    void              *p_obj;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((void *)0);
+    }
+#endif
+
+    if ((id == 0u) || (id > OS_CFG_OBJ_REG_SIZE)) {
+       *p_err = OS_ERR_OBJ_ID_INVALID;
+        return ((void *)0);
+    }
+
+    p_entry = &OSObjRegTbl[id - 1u];
+    CPU_CRITICAL_ENTER();
+    p_obj   = p_entry->ObjPtr;
+    if ((p_obj  != (void *)0) &&
+        (p_type != (OS_OBJ_TYPE *)0)) {
+       *p_type = p_entry->Type;
+    }
+    CPU_CRITICAL_EXIT();
+
+    if (p_obj == (void *)0) {
+       *p_err = OS_ERR_OBJ_ID_INVALID;
+        return ((void *)0);
+    }
+   *p_err = OS_ERR_NONE;
+    return (p_obj);
+}
+
+
+/*
+************************************************************************************************************************
+*                                               GET THE ID OF AN OBJECT
+*
+* Description: This function returns the ID of a registered object.
+*
+* Arguments  : p_obj     is a pointer to the object
+*
+*              type      is the type of the object (OS_OBJ_TYPE_TASK, OS_OBJ_TYPE_SEM, ...)
+*
+* Returns    : The ID of the object (1 to OS_CFG_OBJ_REG_SIZE), 0 if it isn't registered.
+*
+* Note(s)    : 1) The object is found from the hash of its name, its name must not have changed since it was created.
+************************************************************************************************************************
+*/
+
+OS_OBJ_QTY  OSObjRegIdGet (void         *p_obj,
+                           OS_OBJ_TYPE   type)
+{
+    CPU_CHAR    *p_name;
+    CPU_INT32U   hash;
+    OS_OBJ_QTY   ix;
+    CPU_SR_ALLOC();
+
+
+    if (p_obj == (void *)0) {
+        return (0u);
+    }
+    p_name = OS_ObjRegNameGet(p_obj, type);
+    if (p_name == (CPU_CHAR *)0) {                              /* Not a registered type, or no name                    */
+        return (0u);
+    }
+
+    hash = OS_ObjRegHash(p_name);
+    CPU_CRITICAL_ENTER();
+    ix   = OS_ObjRegSlotGet(p_obj, hash);
+    CPU_CRITICAL_EXIT();
+
+    if (ix == OS_CFG_OBJ_REG_SIZE) {
+        return (0u);
+    }
+    return (ix + 1u);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 REGISTER AN OBJECT
+*
+* Description: This function is called when an object is created to enter it in the registry.
+*
+* Arguments  : p_obj     is a pointer to the object
+*
+*              type      is the type of the object
+*
+*              p_name    is the name of the object
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The creation of the object doesn't fail when the registry is full, the object is only counted in
+*                 OSObjRegFullCtr.
+************************************************************************************************************************
+*/
+
+void  OS_ObjRegAdd (void         *p_obj,
+                    OS_OBJ_TYPE   type,
+                    CPU_CHAR     *p_name)
+{
+    OS_OBJ_REG_ENTRY  *p_entry;
+    OS_OBJ_QTY         ix;
+    OS_OBJ_QTY         nbr;
+    CPU_INT32U         hash;
+    CPU_SR_ALLOC();
+
+
+    if (p_name == (CPU_CHAR *)0) {                              /* Objects without a name aren't registered             */
+        return;
+    }
+
+    hash = OS_ObjRegHash(p_name);
+    ix   = (OS_OBJ_QTY)hash & OS_OBJ_REG_IX_MASK;
+    CPU_CRITICAL_ENTER();
+    for (nbr = 0u; nbr < OS_CFG_OBJ_REG_SIZE; nbr++) {          /* Take the first free or deleted slot                  */
+        p_entry = &OSObjRegTbl[ix];
+        if (p_entry->ObjPtr == (void *)0) {
+            p_entry->ObjPtr  = p_obj;
+            p_entry->NamePtr = p_name;
+            p_entry->Type    = type;
+            p_entry->Hash    = hash;
+            OSObjRegQty++;
+            CPU_CRITICAL_EXIT();
+            return;
+        }
+        ix = (ix + 1u) & OS_OBJ_REG_IX_MASK;
+    }
+    OSObjRegFullCtr++;                                          /* See Note #2                                          */
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+************************************************************************************************************************
+*                                              INITIALIZE THE REGISTRY
+*
+* Description: This function is called by OSInit() to empty the registry.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_ObjRegInit (void)
+{
+    OS_OBJ_REG_ENTRY  *p_entry;
+    OS_OBJ_QTY         ix;
+
+
+    p_entry = &OSObjRegTbl[0];
+    for (ix = 0u; ix < OS_CFG_OBJ_REG_SIZE; ix++) {
+        p_entry->ObjPtr  = (void     *)0;
+        p_entry->NamePtr = (CPU_CHAR *)0;
+        p_entry->Type    =  OS_OBJ_REG_TYPE_FREE;
+        p_entry->Hash    =  0u;
+        p_entry++;
+    }
+    OSObjRegQty     = 0u;
+    OSObjRegFullCtr = 0u;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                UNREGISTER AN OBJECT
+*
+* Description: This function is called when an object is deleted to remove it from the registry.
+*
+* Arguments  : p_obj     is a pointer to the object
+*
+*              type      is the type of the object
+*
+*              p_name    is the name of the object
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The slot is marked as deleted, not free, see Note #2 of OBJECT REGISTRY in os.h.
+************************************************************************************************************************
+*/
+
+void  OS_ObjRegRemove (void         *p_obj,
+                       OS_OBJ_TYPE   type,
+                       CPU_CHAR     *p_name)
+{
+    OS_OBJ_REG_ENTRY  *p_entry;
+    CPU_INT32U         hash;
+    OS_OBJ_QTY         ix;
+    CPU_SR_ALLOC();
+
+
+    (void)type;
+
+    if (p_name == (CPU_CHAR *)0) {                              /* Was never registered                                 */
+        return;
+    }
+
+    hash = OS_ObjRegHash(p_name);
+    CPU_CRITICAL_ENTER();
+    ix   = OS_ObjRegSlotGet(p_obj, hash);
+    if (ix == OS_CFG_OBJ_REG_SIZE) {                            /* Name changed since it was registered?                */
+        for (ix = 0u; ix < OS_CFG_OBJ_REG_SIZE; ix++) {         /* Yes, look at every slot                              */
+            if (OSObjRegTbl[ix].ObjPtr == p_obj) {
+                break;
+            }
+        }
+    }
+    if (ix < OS_CFG_OBJ_REG_SIZE) {
+        p_entry          = &OSObjRegTbl[ix];
+        p_entry->ObjPtr  = (void     *)0;
+        p_entry->NamePtr = (CPU_CHAR *)0;
+        p_entry->Type    =  OS_OBJ_REG_TYPE_DEL;                /* See Note #2                                          */
+        OSObjRegQty--;
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  HASH OF A NAME
+*
+* Description: This function returns the 32-bit FNV-1a hash of a name.
+*
+* Arguments  : p_name    is the name
+*
+* Returns    : The hash.
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+static  CPU_INT32U  OS_ObjRegHash (CPU_CHAR  *p_name)
+{
+    CPU_INT32U  hash;
+
+
+    hash = 2166136261u;
+    while (*p_name != (CPU_CHAR)0) {
+        hash ^= (CPU_INT32U)(CPU_INT08U)*p_name;
+        hash *= 16777619u;
+        p_name++;
+    }
+    return (hash);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  COMPARE TWO NAMES
+*
+* Description: This function tells whether two names are the same.
+*
+* Arguments  : p_name1   is the first name
+*
+*              p_name2   is the second name
+*
+* Returns    : OS_TRUE if the names are the same, OS_FALSE otherwise.
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  OS_ObjRegNameCmp (CPU_CHAR  *p_name1,
+                                       CPU_CHAR  *p_name2)
+{
+    while (*p_name1 == *p_name2) {
+        if (*p_name1 == (CPU_CHAR)0) {
+            return (OS_TRUE);
+        }
+        p_name1++;
+        p_name2++;
+    }
+    return (OS_FALSE);
+}
+
+
+/*
+************************************************************************************************************************
+*                                               GET THE NAME OF AN OBJECT
+*
+* Description: This function returns the name of an object of one of the registered types.
+*
+* Arguments  : p_obj     is a pointer to the object
+*
+*              type      is the type of the object
+*
+* Returns    : The name, a NULL pointer if objects of this type aren't registered.
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+static  CPU_CHAR  *OS_ObjRegNameGet (void         *p_obj,
+                                     OS_OBJ_TYPE   type)
+{
+    CPU_CHAR  *p_name;
+
+
+    switch (type) {
+        case OS_OBJ_TYPE_TASK:
+             p_name = ((OS_TCB *)p_obj)->NamePtr;
+             break;
+
+#if (OS_CFG_FLAG_EN > 0u)
+        case OS_OBJ_TYPE_FLAG:
+             p_name = ((OS_FLAG_GRP *)p_obj)->NamePtr;
+             break;
+#endif
+
+#if (OS_CFG_MEM_EN > 0u)
+        case OS_OBJ_TYPE_MEM:
+             p_name = ((OS_MEM *)p_obj)->NamePtr;
+             break;
+#endif
+
+#if (OS_CFG_MUTEX_EN > 0u)
+        case OS_OBJ_TYPE_MUTEX:
+             p_name = ((OS_MUTEX *)p_obj)->NamePtr;
+             break;
+#endif
+
+#if (OS_CFG_Q_EN > 0u)
+        case OS_OBJ_TYPE_Q:
+             p_name = ((OS_Q *)p_obj)->NamePtr;
+             break;
+#endif
+
+#if (OS_CFG_SEM_EN > 0u)
+        case OS_OBJ_TYPE_SEM:
+             p_name = ((OS_SEM *)p_obj)->NamePtr;
+             break;
+#endif
+
+        default:
+             p_name = (CPU_CHAR *)0;
+             break;
+    }
+    return (p_name);
+}
+
+
+/*
+************************************************************************************************************************
+*                                              FIND THE SLOT OF AN OBJECT
+*
+* Description: This function probes the registry from the slot of a name for the slot holding an object.
+*
+* Arguments  : p_obj     is a pointer to the object
+*
+*              hash      is the hash of the name the object was registered under
+*
+* Returns    : The slot, OS_CFG_OBJ_REG_SIZE if the object isn't found.
+*
+* Note(s)    : 1) This function MUST be called within a critical section.
+************************************************************************************************************************
+*/
+
+static  OS_OBJ_QTY  OS_ObjRegSlotGet (void        *p_obj,
+                                      CPU_INT32U   hash)
+{
+    OS_OBJ_QTY  ix;
+    OS_OBJ_QTY  nbr;
+
+
+    ix = (OS_OBJ_QTY)hash & OS_OBJ_REG_IX_MASK;
+    for (nbr = 0u; nbr < OS_CFG_OBJ_REG_SIZE; nbr++) {
+        if (OSObjRegTbl[ix].Type == OS_OBJ_REG_TYPE_FREE) {     /* End of the probe sequence                            */
+            break;
+        }
+        if (OSObjRegTbl[ix].ObjPtr == p_obj) {
+            return (ix);
+        }
+        ix = (ix + 1u) & OS_OBJ_REG_IX_MASK;
+    }
+    return (OS_CFG_OBJ_REG_SIZE);
+}
+#endif
@@ -0,0 +1,284 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          OBJECT STATISTICS
+*
+* File    : os_obj_stat.c
+* Version : V3.08.00
+*********************************************************************************************************
+*/
+
+#define   MICRIUM_SOURCE
+#define   OS_CRIT_SITE_ID                   OS_CRIT_SITE_OBJ_STAT
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_obj_stat__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_OBJ_STAT_EN > 0u)
+/*
+************************************************************************************************************************
+*                                                   LOCAL CONSTANTS
+************************************************************************************************************************
+*/
+
+#define  OS_OBJ_STAT_LIST_FLAG                0u                /* Order in which OSObjStatNext() walks the debug lists */
+#define  OS_OBJ_STAT_LIST_MUTEX               1u
+#define  OS_OBJ_STAT_LIST_Q                   2u
+#define  OS_OBJ_STAT_LIST_SEM                 3u
+#define  OS_OBJ_STAT_LIST_NBR                 4u
+
+
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  OS_PEND_OBJ  *OS_ObjStatListHead (CPU_INT08U    list);
+
+static  CPU_INT08U    OS_ObjStatListGet  (OS_OBJ_TYPE   type);
+
+
+/*
+************************************************************************************************************************
+*                                      READ THE COUNTERS OF THE NEXT KERNEL OBJECT
+*
+* Description: This function walks the event flag groups, the mutexes, the message queues and the semaphores, in this
+*              order, and copies the activity counters of each one.  Call it first with 'p_obj' set to NULL, then with
+*              the object it returned until it returns NULL:
+*
+*                  p_obj = OSObjStatNext((void *)0, &stat, OS_OPT_OBJ_STAT_NONE, &err);
+*                  while (p_obj != (void *)0) {
+*                      ...
+*                      p_obj = OSObjStatNext(p_obj, &stat, OS_OPT_OBJ_STAT_NONE, &err);
+*                  }
+*
+* Arguments  : p_obj     is a pointer to the object returned by the previous call, or a NULL pointer to start with the
+*                        first object.
+*
+*              p_stat    is a pointer to where the counters of the next object will be copied
+*
+*              opt       determines whether the counters are cleared after being copied:
+*
+*                            OS_OPT_OBJ_STAT_NONE     Only copy the counters
+*                            OS_OPT_OBJ_STAT_RESET    Copy, then clear the counters
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE              The counters were copied, or there is no next object
+*                            OS_ERR_OBJ_TYPE          If 'p_obj' is not an event flag group, a mutex, a message queue
+*                                                       or a semaphore
+*                            OS_ERR_OPT_INVALID       You specified an invalid option
+*                            OS_ERR_PTR_INVALID       If 'p_stat' is a NULL pointer
+*
+* Returns    : A pointer to the object the counters were copied from, or a NULL pointer when all the objects were read
+*              or upon error.  The type of the object is in its first member (see OS_PEND_OBJ).
+*
+* Note(s)    : 1) The object passed in 'p_obj' must not be deleted between two calls.
+*
+*              2) Each call reads one object within its own critical section, the counters of different objects are not
+*                 taken at the same instant.
+************************************************************************************************************************
+*/
+
+void  *OSObjStatNext (void         *p_obj,
+                      OS_OBJ_STAT  *p_stat,
+                      OS_OPT        opt,
+                      OS_ERR       *p_err)
+{
+    OS_PEND_OBJ  *p_next;
+    CPU_INT08U    list;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_stat == (OS_OBJ_STAT *)0) {                           /* User must specify a valid destination                */
+       *p_err = OS_ERR_PTR_INVALID;
+        return ((void *)0);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_OBJ_STAT_NONE:
+        case OS_OPT_OBJ_STAT_RESET:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return ((void *)0);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_obj == (void *)0) {                                   /* Start with the first list                            */
+        p_next = (OS_PEND_OBJ *)0;
+        list   = 0u;
+    } else {
+        list   = OS_ObjStatListGet(((OS_PEND_OBJ *)p_obj)->Type);
+        if (list == OS_OBJ_STAT_LIST_NBR) {                     /* Not in any of the lists walked                       */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_OBJ_TYPE;
+            return ((void *)0);
+        }
+        p_next = (OS_PEND_OBJ *)((OS_PEND_OBJ *)p_obj)->DbgNextPtr;
+        list++;
+    }
+    while ((p_next == (OS_PEND_OBJ *)0) &&                      /* Move on to the next non-empty list                   */
+           (list   <  OS_OBJ_STAT_LIST_NBR)) {
+        p_next = OS_ObjStatListHead(list);
+        list++;
+    }
+
+    if (p_next != (OS_PEND_OBJ *)0) {
+       *p_stat = p_next->PendList.Stat;
+        if (opt == OS_OPT_OBJ_STAT_RESET) {
+            OS_ObjStatReset(&p_next->PendList.Stat);
+        }
+    }
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+    return ((void *)p_next);
+}
+
+
+/*
+************************************************************************************************************************
+*                                            CLEAR THE COUNTERS OF AN OBJECT
+*
+* Description: This function clears the activity counters kept in the pend list of an object.
+*
+* Arguments  : p_stat    is a pointer to the counters
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_ObjStatReset (OS_OBJ_STAT  *p_stat)
+{
+    p_stat->PostCtr        = 0u;
+    p_stat->PendCtr        = 0u;
+    p_stat->PendBlockCtr   = 0u;
+    p_stat->PendTimeoutCtr = 0u;
+    p_stat->PendAbortCtr   = 0u;
+    p_stat->WaitersMax     = 0u;
+}
+
+
+/*
+************************************************************************************************************************
+*                                       FIND THE FIRST OBJECT OR THE LIST OF AN OBJECT
+*
+* Description: OS_ObjStatListHead() returns the first object of a debug list, OS_ObjStatListGet() returns the list that
+*              holds the objects of a given type.
+*
+* Arguments  : list      is the list (OS_OBJ_STAT_LIST_xxx)
+*
+*              type      is the type of the object (OS_OBJ_TYPE_xxx)
+*
+* Returns    : The first object of the list, NULL if the list is empty or its objects are not compiled in.
+*
+*              The list, OS_OBJ_STAT_LIST_NBR if the objects of 'type' are not walked.
+************************************************************************************************************************
+*/
+
+static  OS_PEND_OBJ  *OS_ObjStatListHead (CPU_INT08U  list)
+{
+    OS_PEND_OBJ  *p_obj;
+
+
+    p_obj = (OS_PEND_OBJ *)0;
+    switch (list) {
+#if (OS_CFG_FLAG_EN > 0u)
+        case OS_OBJ_STAT_LIST_FLAG:
+             p_obj = (OS_PEND_OBJ *)((void *)OSFlagDbgListPtr);
+             break;
+#endif
+
+#if (OS_CFG_MUTEX_EN > 0u)
+        case OS_OBJ_STAT_LIST_MUTEX:
+             p_obj = (OS_PEND_OBJ *)((void *)OSMutexDbgListPtr);
+             break;
+#endif
+
+#if (OS_CFG_Q_EN > 0u)
+        case OS_OBJ_STAT_LIST_Q:
+             p_obj = (OS_PEND_OBJ *)((void *)OSQDbgListPtr);
+             break;
+#endif
+
+#if (OS_CFG_SEM_EN > 0u)
+        case OS_OBJ_STAT_LIST_SEM:
+             p_obj = (OS_PEND_OBJ *)((void *)OSSemDbgListPtr);
+             break;
+#endif
+
+        default:
+             break;
+    }
+    return (p_obj);
+}
+
+
+static  CPU_INT08U  OS_ObjStatListGet (OS_OBJ_TYPE  type)
+{
+    CPU_INT08U  list;
+
+
+    switch (type) {
+#if (OS_CFG_FLAG_EN > 0u)
+        case OS_OBJ_TYPE_FLAG:
+             list = OS_OBJ_STAT_LIST_FLAG;
+             break;
+#endif
+
+#if (OS_CFG_MUTEX_EN > 0u)
+        case OS_OBJ_TYPE_MUTEX:
+             list = OS_OBJ_STAT_LIST_MUTEX;
+             break;
+#endif
+
+#if (OS_CFG_Q_EN > 0u)
+        case OS_OBJ_TYPE_Q:
+             list = OS_OBJ_STAT_LIST_Q;
+             break;
+#endif
+
+#if (OS_CFG_SEM_EN > 0u)
+        case OS_OBJ_TYPE_SEM:
+             list = OS_OBJ_STAT_LIST_SEM;
+             break;
+#endif
+
+        default:
+             list = OS_OBJ_STAT_LIST_NBR;
+             break;
+    }
+    return (list);
+}
+#endif
@@ -0,0 +1,595 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                      PEND ON MULTIPLE OBJECTS
+*
+* File    : os_pend_multi.c
+* Version : V3.08.00
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#define  OS_CRIT_SITE_ID                    OS_CRIT_SITE_PEND_MULTI
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_pend_multi__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  OS_OBJ_QTY  OS_PendMultiGetRdy  (OS_PEND_DATA  *p_pend_data_tbl,
+                                         OS_OBJ_QTY     tbl_size);
+
+static  void        OS_PendMultiInsert  (OS_PEND_DATA  *p_pend_data);
+
+static  void        OS_PendMultiUnlink  (OS_PEND_DATA  *p_pend_data);
+
+
+/*
+************************************************************************************************************************
+*                                           PEND ON MULTIPLE OBJECTS
+*
+* Description: This function waits on several semaphores and/or message queues at once.  The calling task is readied as
+*              soon as any one of the objects is posted to.
+*
+* Arguments  : p_pend_data_tbl   is a pointer to a table of OS_PEND_DATA, one entry per object to wait on.  You MUST set
+*                                '.PendObjPtr' of each entry to the address of a semaphore or of a message queue.
+*
+*              tbl_size          is the number of entries in the table.
+*
+*              timeout           is an optional timeout period (in clock ticks).  If non-zero, your task will wait for
+*                                any of the objects up to the amount of time (in 'ticks') specified by this argument.
+*                                If you specify 0, however, your task will wait forever or, until an object is posted.
+*
+*              opt               determines whether the user wants to block if none of the objects is available or not:
+*
+*                                    OS_OPT_PEND_BLOCKING
+*                                    OS_OPT_PEND_NON_BLOCKING
+*
+*                                Add OS_OPT_PEND_ABS to make 'timeout' the value of OSTickCtr at which to give up.
+*
+*              p_err             is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                    OS_ERR_NONE               At least one object was available or posted to
+*                                    OS_ERR_OBJ_DEL            If one of the objects was deleted
+*                                    OS_ERR_OBJ_PTR_NULL       If the '.PendObjPtr' of an entry is a NULL pointer
+*                                    OS_ERR_OBJ_TYPE           If an entry is not pointing at a semaphore or a queue
+*                                    OS_ERR_OPT_INVALID        If you didn't specify a valid option
+*                                    OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                    OS_ERR_PEND_ABORT         If the pend on one of the objects was aborted
+*                                    OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                    OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking and no object was available
+*                                    OS_ERR_PTR_INVALID        If 'p_pend_data_tbl' is a NULL pointer or 'tbl_size' is 0
+*                                    OS_ERR_SCHED_LOCKED       If you called this function when the scheduler is locked
+*                                    OS_ERR_STATUS_INVALID     If the pend status has an invalid value
+*                                    OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*                                    OS_ERR_TIMEOUT            No object was posted within the specified timeout
+*
+* Returns    : The number of objects that are ready, 0 if none.
+*
+* Note(s)    : 1) The entries for which '.RdyObjPtr' is not a NULL pointer are the objects that were obtained.  The task
+*                 acquired one unit of each of these semaphores and received '.RdyMsgPtr' from each of these queues.
+*
+*              2) All the objects that are available when the function is called are obtained.  When the task has to
+*                 wait, it is readied by the first post and obtains that single object.
+*
+*              3) When the pend is aborted or the object is deleted, '.RdyObjPtr' identifies the object concerned.
+*
+*              4) An object MUST NOT appear more than once in the table.
+************************************************************************************************************************
+*/
+
+OS_OBJ_QTY  OSPendMulti (OS_PEND_DATA  *p_pend_data_tbl,
+                         OS_OBJ_QTY     tbl_size,
+                         OS_TICK        timeout,
+                         OS_OPT         opt,
+                         OS_ERR        *p_err)
+{
+    OS_PEND_DATA  *p_pend_data;
+    OS_OBJ_QTY     i;
+    OS_OBJ_QTY     nbr_rdy;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != OS_OPT_PEND_NON_BLOCKING) {
+           *p_err = OS_ERR_PEND_ISR;
+            return (0u);
+        }
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if ((p_pend_data_tbl == (OS_PEND_DATA *)0) ||               /* Validate the table                                   */
+        (tbl_size        ==                 0u)) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    switch (opt & (OS_OPT)~OS_OPT_PEND_ABS) {                   /* Validate 'opt'                                       */
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+    p_pend_data = p_pend_data_tbl;                              /* Validate the objects                                 */
+    for (i = 0u; i < tbl_size; i++) {
+#if (OS_CFG_ARG_CHK_EN > 0u)
+        if (p_pend_data->PendObjPtr == (OS_PEND_OBJ *)0) {
+           *p_err = OS_ERR_OBJ_PTR_NULL;
+            return (0u);
+        }
+#endif
+        switch (p_pend_data->PendObjPtr->Type) {                /* Only semaphores and queues can be waited on          */
+#if (OS_CFG_SEM_EN > 0u)
+            case OS_OBJ_TYPE_SEM:
+#endif
+#if (OS_CFG_Q_EN > 0u)
+            case OS_OBJ_TYPE_Q:
+#endif
+                 break;
+
+            default:
+                *p_err = OS_ERR_OBJ_TYPE;
+                 return (0u);
+        }
+        p_pend_data++;
+    }
+
+    CPU_CRITICAL_ENTER();
+    nbr_rdy = OS_PendMultiGetRdy(p_pend_data_tbl,               /* Obtain the objects that are already available        */
+                                 tbl_size);
+    if (nbr_rdy > 0u) {
+        CPU_CRITICAL_EXIT();
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+        OSSched();                                              /* Run a sender readied by OS_QSpaceWake(), if any      */
+#endif
+       *p_err = OS_ERR_NONE;
+        return (nbr_rdy);
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+        CPU_CRITICAL_EXIT();                                    /* No                                                   */
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;
+        return (0u);
+    } else {                                                    /* Yes                                                  */
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return (0u);
+        }
+    }
+
+#if (OS_CFG_SEM_EN > 0u) && (OS_CFG_SEM_PEND_N_EN > 0u)
+    OSTCBCurPtr->SemPendCnt = 1u;                               /* Wait for a single unit of a semaphore                */
+#endif
+    OS_PEND_ABS_SET(OSTCBCurPtr, opt);
+    OS_Pend((OS_PEND_OBJ *)0,                                   /* Block task, it is not in the pend list of an object  */
+            OSTCBCurPtr,
+            OS_TASK_PEND_ON_MULTI,
+            timeout);
+    OSTCBCurPtr->PendDataTblPtr     = p_pend_data_tbl;
+    OSTCBCurPtr->PendDataTblEntries = tbl_size;
+    p_pend_data = p_pend_data_tbl;
+    for (i = 0u; i < tbl_size; i++) {                           /* Wait in the multi-pend list of each object           */
+        p_pend_data->TCBPtr = OSTCBCurPtr;
+        OS_PendMultiInsert(p_pend_data);
+        p_pend_data++;
+    }
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* One of the objects was posted to                     */
+             nbr_rdy = 1u;
+            *p_err   = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+            *p_err   = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that no object was posted within timeout    */
+            *p_err   = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that an object pended on has been deleted   */
+            *p_err   = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+            *p_err   = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+    return (nbr_rdy);
+}
+
+
+/*
+************************************************************************************************************************
+*                                   CHANGE THE PRIORITY OF A TASK WAITING ON MULTIPLE OBJECTS
+*
+* Description: This function is called when the priority of a task waiting in OSPendMulti() changes.  The entries of the
+*              task are moved in the multi-pend list of each object according to the new priority.
+*
+* Arguments  : p_tcb       is a pointer to the TCB of the task
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) It's assumed that the TCB contains the NEW priority in its .Prio field.
+************************************************************************************************************************
+*/
+
+void  OS_PendMultiChangePrio (OS_TCB  *p_tcb)
+{
+    OS_PEND_DATA  *p_pend_data;
+    OS_OBJ_QTY     i;
+
+
+    p_pend_data = p_tcb->PendDataTblPtr;
+    for (i = 0u; i < p_tcb->PendDataTblEntries; i++) {
+        OS_PendMultiUnlink(p_pend_data);                        /* Remove entry from current position                   */
+        OS_PendMultiInsert(p_pend_data);                        /* INSERT it back in the list                           */
+        p_pend_data++;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                       FIND THE HIGHEST PRIORITY WAITER OF AN OBJECT
+*
+* Description: This function returns the highest priority task waiting on an object, either in its pend list or in
+*              OSPendMulti().  The tasks of the pend list go first at equal priority.
+*
+* Arguments  : p_pend_list   is a pointer to the pend list of the object
+*              -----------
+*
+* Returns    : A pointer to the TCB of the task or a NULL pointer if no task is waiting.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+OS_TCB  *OS_PendMultiHead (OS_PEND_LIST  *p_pend_list)
+{
+    OS_TCB  *p_tcb;
+    OS_TCB  *p_tcb_multi;
+
+
+    p_tcb = p_pend_list->HeadPtr;
+    if (p_pend_list->MultiHeadPtr != (OS_PEND_DATA *)0) {
+        p_tcb_multi = p_pend_list->MultiHeadPtr->TCBPtr;
+        if ((p_tcb              == (OS_TCB *)0) ||
+            (p_tcb_multi->Prio  <  p_tcb->Prio)) {
+            p_tcb = p_tcb_multi;
+        }
+    }
+    return (p_tcb);
+}
+
+
+/*
+************************************************************************************************************************
+*                                  RECORD THE OBJECT THAT READIED A TASK WAITING ON MULTIPLE OBJECTS
+*
+* Description: This function is called when an object readies a task.  If the task waits in OSPendMulti(), the entry of
+*              the object is marked as ready and receives the message and the timestamp.
+*
+* Arguments  : p_obj          is a pointer to the object being posted to, aborted or deleted
+*
+*              p_tcb          is a pointer to the TCB of the task being readied
+*              -----
+*
+*              p_void         is the message posted to a message queue
+*
+*              msg_size       is the size of the message
+*
+*              ts             is the timestamp of the post
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function MUST be called before the task is removed from the pend lists.
+************************************************************************************************************************
+*/
+
+void  OS_PendMultiRdy (OS_PEND_OBJ  *p_obj,
+                       OS_TCB       *p_tcb,
+                       void         *p_void,
+                       OS_MSG_SIZE   msg_size,
+                       CPU_TS        ts)
+{
+    OS_PEND_DATA  *p_pend_data;
+    OS_OBJ_QTY     i;
+
+
+#if (OS_CFG_TS_EN == 0u)
+    (void)ts;                                                   /* Prevent compiler warning for not using 'ts'          */
+#endif
+
+    if (p_tcb->PendOn != OS_TASK_PEND_ON_MULTI) {               /* Only for tasks waiting in OSPendMulti()              */
+        return;
+    }
+
+    p_pend_data = p_tcb->PendDataTblPtr;
+    for (i = 0u; i < p_tcb->PendDataTblEntries; i++) {
+        if (p_pend_data->PendObjPtr == p_obj) {                 /* Mark the first entry of the object                   */
+            p_pend_data->RdyObjPtr  = p_obj;
+            p_pend_data->RdyMsgPtr  = p_void;
+            p_pend_data->RdyMsgSize = msg_size;
+#if (OS_CFG_TS_EN > 0u)
+            p_pend_data->RdyTS      = ts;
+#endif
+            return;
+        }
+        p_pend_data++;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                     REMOVE A TASK WAITING ON MULTIPLE OBJECTS
+*
+* Description: This function removes the entries of a task waiting in OSPendMulti() from the multi-pend list of every
+*              object it waits on.
+*
+* Arguments  : p_tcb          is a pointer to the TCB of the task
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_PendMultiRemove (OS_TCB  *p_tcb)
+{
+    OS_PEND_DATA  *p_pend_data;
+    OS_OBJ_QTY     i;
+
+
+    p_pend_data = p_tcb->PendDataTblPtr;
+    for (i = 0u; i < p_tcb->PendDataTblEntries; i++) {
+        OS_PendMultiUnlink(p_pend_data);
+        p_pend_data->TCBPtr = (OS_TCB *)0;
+        p_pend_data++;
+    }
+    p_tcb->PendDataTblPtr     = (OS_PEND_DATA *)0;
+    p_tcb->PendDataTblEntries =                 0u;
+}
+
+
+/*
+************************************************************************************************************************
+*                                          OBTAIN THE OBJECTS THAT ARE AVAILABLE
+*
+* Description: This function clears the ready state of each entry and obtains the objects that are available, a unit of
+*              a semaphore or the next message of a queue.
+*
+* Arguments  : p_pend_data_tbl   is a pointer to the table of OS_PEND_DATA
+*              ---------------
+*
+*              tbl_size          is the number of entries in the table
+*
+* Returns    : The number of objects obtained.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function MUST be called within a critical section.
+*
+*              3) A semaphore count is left to the higher priority tasks that already wait on the semaphore.
+************************************************************************************************************************
+*/
+
+static  OS_OBJ_QTY  OS_PendMultiGetRdy (OS_PEND_DATA  *p_pend_data_tbl,
+                                        OS_OBJ_QTY     tbl_size)
+{
+    OS_PEND_DATA  *p_pend_data;
+    OS_OBJ_QTY     i;
+    OS_OBJ_QTY     nbr_rdy;
+#if (OS_CFG_SEM_EN > 0u)
+    OS_SEM        *p_sem;
+    OS_TCB        *p_tcb;
+#endif
+#if (OS_CFG_Q_EN > 0u)
+    OS_Q          *p_q;
+    void          *p_void;
+    OS_MSG_SIZE    msg_size;
+    CPU_TS         ts;
+    OS_ERR         err;
+#endif
+
+
+    nbr_rdy     = 0u;
+    p_pend_data = p_pend_data_tbl;
+    for (i = 0u; i < tbl_size; i++) {
+        p_pend_data->TCBPtr     = (OS_TCB      *)0;
+        p_pend_data->RdyObjPtr  = (OS_PEND_OBJ *)0;
+        p_pend_data->RdyMsgPtr  = (void        *)0;
+        p_pend_data->RdyMsgSize =                0u;
+        p_pend_data->RdyTS      =                0u;
+        switch (p_pend_data->PendObjPtr->Type) {
+#if (OS_CFG_SEM_EN > 0u)
+            case OS_OBJ_TYPE_SEM:
+                 p_sem = (OS_SEM *)((void *)p_pend_data->PendObjPtr);
+                 p_tcb = OS_PEND_LIST_HEAD(&p_sem->PendList);
+                 if ((p_sem->Ctr > 0u) &&                       /* See Note #3                                          */
+                     ((p_tcb       == (OS_TCB *)0) ||
+                      (p_tcb->Prio >  OSTCBCurPtr->Prio))) {
+                     p_sem->Ctr--;
+                     p_pend_data->RdyObjPtr = p_pend_data->PendObjPtr;
+#if (OS_CFG_TS_EN > 0u)
+                     p_pend_data->RdyTS     = p_sem->TS;
+#endif
+                     nbr_rdy++;
+                 }
+                 break;
+#endif
+
+#if (OS_CFG_Q_EN > 0u)
+            case OS_OBJ_TYPE_Q:
+                 p_q    = (OS_Q *)((void *)p_pend_data->PendObjPtr);
+                 p_void = OS_MsgQGet(&p_q->MsgQ,                /* Any message waiting in the message queue?            */
+                                     &msg_size,
+                                     &ts,
+                                     &err);
+                 if (err == OS_ERR_NONE) {
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+                     (void)OS_QSpaceWake(p_q);                  /* Queue the message of a waiting sender                */
+#endif
+                     p_pend_data->RdyObjPtr  = p_pend_data->PendObjPtr;
+                     p_pend_data->RdyMsgPtr  = p_void;
+                     p_pend_data->RdyMsgSize = msg_size;
+#if (OS_CFG_TS_EN > 0u)
+                     p_pend_data->RdyTS      = ts;
+#endif
+                     nbr_rdy++;
+                 }
+                 break;
+#endif
+
+            default:
+                 break;
+        }
+        p_pend_data++;
+    }
+    return (nbr_rdy);
+}
+
+
+/*
+************************************************************************************************************************
+*                                  INSERT AN ENTRY IN THE MULTI-PEND LIST OF ITS OBJECT
+*
+* Description: This function links an entry in the '.MultiHeadPtr' list of its object, in the priority order of the task.
+*              The entry is placed after the entries of the tasks having the same priority.
+*
+* Arguments  : p_pend_data   is a pointer to the entry, '.PendObjPtr' and '.TCBPtr' MUST be set
+*              -----------
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_PendMultiInsert (OS_PEND_DATA  *p_pend_data)
+{
+    OS_PEND_LIST  *p_pend_list;
+    OS_PEND_DATA  *p_prev;
+    OS_PEND_DATA  *p_next;
+    OS_PRIO        prio;
+
+
+    p_pend_list = &p_pend_data->PendObjPtr->PendList;
+    prio        =  p_pend_data->TCBPtr->Prio;
+    p_prev      = (OS_PEND_DATA *)0;
+    p_next      =  p_pend_list->MultiHeadPtr;
+    while ((p_next               != (OS_PEND_DATA *)0) &&       /* Find the first entry of a lower priority task        */
+           (p_next->TCBPtr->Prio <= prio)) {
+        p_prev = p_next;
+        p_next = p_next->NextPtr;
+    }
+
+    p_pend_data->PrevPtr = p_prev;
+    p_pend_data->NextPtr = p_next;
+    if (p_prev == (OS_PEND_DATA *)0) {
+        p_pend_list->MultiHeadPtr = p_pend_data;
+    } else {
+        p_prev->NextPtr           = p_pend_data;
+    }
+    if (p_next != (OS_PEND_DATA *)0) {
+        p_next->PrevPtr           = p_pend_data;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                  REMOVE AN ENTRY FROM THE MULTI-PEND LIST OF ITS OBJECT
+*
+* Description: This function unlinks an entry from the '.MultiHeadPtr' list of its object.
+*
+* Arguments  : p_pend_data   is a pointer to the entry
+*              -----------
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_PendMultiUnlink (OS_PEND_DATA  *p_pend_data)
+{
+    OS_PEND_LIST  *p_pend_list;
+
+
+    p_pend_list = &p_pend_data->PendObjPtr->PendList;
+    if (p_pend_data->PrevPtr == (OS_PEND_DATA *)0) {
+        p_pend_list->MultiHeadPtr     = p_pend_data->NextPtr;
+    } else {
+        p_pend_data->PrevPtr->NextPtr = p_pend_data->NextPtr;
+    }
+    if (p_pend_data->NextPtr != (OS_PEND_DATA *)0) {
+        p_pend_data->NextPtr->PrevPtr = p_pend_data->PrevPtr;
+    }
+    p_pend_data->PrevPtr = (OS_PEND_DATA *)0;
+    p_pend_data->NextPtr = (OS_PEND_DATA *)0;
+}
+#endif
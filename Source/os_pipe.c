@@ -0,0 +1,1106 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                           PIPE MANAGEMENT
+*
+* File    : os_pipe.c
+* Version : V3.08.00
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#define  OS_CRIT_SITE_ID                    OS_CRIT_SITE_PIPE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_pipe__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_PIPE_EN > 0u)
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  OS_MSG_SIZE   OS_PipeCopyIn    (OS_PIPE      *p_pipe,
+                                        CPU_INT08U   *p_src,
+                                        OS_MSG_SIZE   size);
+
+static  OS_MSG_SIZE   OS_PipeCopyOut   (OS_PIPE      *p_pipe,
+                                        CPU_INT08U   *p_dst,
+                                        OS_MSG_SIZE   size);
+
+static  OS_OBJ_QTY    OS_PipeWake      (OS_PIPE      *p_pipe,
+                                        CPU_TS        ts);
+
+static  OS_TCB       *OS_PipeWaiterGet (OS_PIPE      *p_pipe,
+                                        OS_STATE      pending_on);
+
+
+/*
+************************************************************************************************************************
+*                                                    CREATE A PIPE
+*
+* Description: This function is called by your application to create a pipe, a stream of bytes stored in a buffer that
+*              you supply.  Producers copy bytes in with OSPipeWrite() and consumers copy them out with OSPipeRead(),
+*              as many at a time as they like.  No OS_MSG is used.
+*
+*              Pipes MUST be created before they can be used.
+*
+* Arguments  : p_pipe      is a pointer to the pipe
+*
+*              p_name      is a pointer to an ASCII string that will be used to name the pipe
+*
+*              p_buf       is a pointer to the storage for the bytes in transit ('size' bytes)
+*
+*              size        is the capacity of the pipe (in bytes, must be non-zero)
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                    The call was successful
+*                              OS_ERR_CREATE_ISR              Can't create from an ISR
+*                              OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the pipe after you called
+*                                                               OSSafetyCriticalStart()
+*                              OS_ERR_OBJ_PTR_NULL            If you passed a NULL pointer for 'p_pipe'
+*                              OS_ERR_PTR_INVALID             If you passed a NULL pointer for 'p_buf'
+*                              OS_ERR_PIPE_SIZE               If 'size' is 0
+*                              OS_ERR_OBJ_CREATED             If the pipe was already created
+*
+* Returns    : none
+*
+* Note(s)    : 1) The watermarks are initialized so that readers are woken as soon as one byte is written and writers
+*                 as soon as one byte is read (see OSPipeWatermarkSet()).
+************************************************************************************************************************
+*/
+
+void  OSPipeCreate (OS_PIPE      *p_pipe,
+                    CPU_CHAR     *p_name,
+                    void         *p_buf,
+                    OS_MSG_SIZE   size,
+                    OS_ERR       *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_pipe == (OS_PIPE *)0) {                               /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_buf == (void *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    if (size == 0u) {                                           /* Cannot specify a zero size pipe                      */
+       *p_err = OS_ERR_PIPE_SIZE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
+    if (p_pipe->Type == OS_OBJ_TYPE_PIPE) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+    p_pipe->Type        = OS_OBJ_TYPE_PIPE;                     /* Mark the data structure as a pipe                    */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_pipe->NamePtr     = p_name;
+#else
+    (void)p_name;
+#endif
+    p_pipe->BufPtr      = (CPU_INT08U *)p_buf;                  /* Initialize the pipe                                  */
+    p_pipe->BufSize     = size;
+    p_pipe->InIx        = 0u;
+    p_pipe->OutIx       = 0u;
+    p_pipe->NbrUsed     = 0u;
+    p_pipe->WatermarkLo = size - 1u;                            /* See Note #1                                          */
+    p_pipe->WatermarkHi = 1u;
+    OS_PendListInit(&p_pipe->PendList);                         /* Initialize the waiting list                          */
+
+#if (OS_CFG_DBG_EN > 0u)
+    OS_PipeDbgListAdd(p_pipe);
+    OSPipeQty++;                                                /* One more pipe created                                */
+#endif
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                    DELETE A PIPE
+*
+* Description: This function deletes a pipe and readies all tasks pending on it.
+*
+* Arguments  : p_pipe    is a pointer to the pipe you want to delete
+*
+*              opt       determines delete options as follows:
+*
+*                            OS_OPT_DEL_NO_PEND          Delete the pipe ONLY if no task pending
+*                            OS_OPT_DEL_ALWAYS           Deletes the pipe even if tasks are waiting.
+*                                                        In this case, all the tasks pending will be readied.
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                    The call was successful and the pipe was deleted
+*                            OS_ERR_DEL_ISR                 If you tried to delete the pipe from an ISR
+*                            OS_ERR_ILLEGAL_DEL_RUN_TIME    If you are trying to delete the pipe after you called
+*                                                             OSStart()
+*                            OS_ERR_OBJ_PTR_NULL            If you pass a NULL pointer for 'p_pipe'
+*                            OS_ERR_OBJ_TYPE                If the pipe was not created
+*                            OS_ERR_OPT_INVALID             An invalid option was specified
+*                            OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                            OS_ERR_TASK_WAITING            One or more tasks were waiting on the pipe
+*
+* Returns    : == 0          if no tasks were waiting on the pipe, or upon error.
+*              >  0          if one or more tasks waiting on the pipe are now readied and informed.
+*
+* Note(s)    : 1) This function must be used with care.  Tasks that would normally expect the presence of the pipe MUST
+*                 check the return code of OSPipeRead() and OSPipeWrite().
+*
+*              2) The bytes still in the pipe are lost.  The storage supplied to OSPipeCreate() may be reused once this
+*                 function returns.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_PIPE_DEL_EN > 0u)
+OS_OBJ_QTY  OSPipeDel (OS_PIPE  *p_pipe,
+                       OS_OPT    opt,
+                       OS_ERR   *p_err)
+{
+    OS_OBJ_QTY     nbr_tasks;
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't delete a pipe from an ISR                      */
+       *p_err = OS_ERR_DEL_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_pipe == (OS_PIPE *)0) {                               /* Validate 'p_pipe'                                    */
+       *p_err =  OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_pipe->Type != OS_OBJ_TYPE_PIPE) {                     /* Make sure pipe was created                           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_pipe->PendList;
+    nbr_tasks   = 0u;
+    switch (opt) {
+        case OS_OPT_DEL_NO_PEND:                                /* Delete pipe only if no task waiting                  */
+             if (p_pend_list->HeadPtr == (OS_TCB *)0) {
+#if (OS_CFG_DBG_EN > 0u)
+                 OS_PipeDbgListRemove(p_pipe);
+                 OSPipeQty--;
+#endif
+                 OS_PipeClr(p_pipe);
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_NONE;
+             } else {
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_TASK_WAITING;
+             }
+             break;
+
+        case OS_OPT_DEL_ALWAYS:                                 /* Always delete the pipe                               */
+#if (OS_CFG_TS_EN > 0u)
+             ts = OS_TS_GET();                                  /* Get local time stamp so all tasks get the same time  */
+#else
+             ts = 0u;
+#endif
+             while (p_pend_list->HeadPtr != (OS_TCB *)0) {      /* Remove all tasks from the pend list                  */
+                 p_tcb = p_pend_list->HeadPtr;
+                 OS_PendAbort(p_tcb,
+                              ts,
+                              OS_STATUS_PEND_DEL);
+                 nbr_tasks++;
+             }
+#if (OS_CFG_DBG_EN > 0u)
+             OS_PipeDbgListRemove(p_pipe);
+             OSPipeQty--;
+#endif
+             OS_PipeClr(p_pipe);
+             CPU_CRITICAL_EXIT();
+             OSSched();                                         /* Find highest priority task ready to run              */
+            *p_err = OS_ERR_NONE;
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_OPT_INVALID;
+             break;
+    }
+    return (nbr_tasks);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                  READ FROM A PIPE
+*
+* Description: This function copies up to 'size' bytes out of a pipe.  If the pipe holds enough bytes (see Note #1),
+*              they are copied right away.  Otherwise the calling task may block until a writer brings the pipe up to
+*              that level, the bytes then being copied to 'p_buf' by the writer on behalf of the reader.
+*
+* Arguments  : p_pipe        is a pointer to the pipe
+*
+*              p_buf         is a pointer to where the bytes will be copied
+*
+*              size          is the maximum number of bytes to copy
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for
+*                            data up to the amount of time specified by this argument.  If you specify 0, however,
+*                            your task will wait forever or, until enough data is written.
+*
+*              opt           determines whether the user wants to block if the pipe doesn't hold enough data:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*                            Add OS_OPT_PEND_ABS to make 'timeout' the value of OSTickCtr at which to give up.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and bytes were copied
+*                                OS_ERR_OBJ_DEL            If 'p_pipe' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If you pass a NULL pointer for 'p_pipe'
+*                                OS_ERR_OBJ_TYPE           If the pipe was not created
+*                                OS_ERR_OPT_INVALID        You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         The pend was aborted
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR and the pipe would
+*                                                          need to block
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the pipe was empty
+*                                OS_ERR_PIPE_SIZE          If 'size' is 0
+*                                OS_ERR_PTR_INVALID        If you passed a NULL pointer for 'p_buf'
+*                                OS_ERR_SCHED_LOCKED       The scheduler is locked
+*                                OS_ERR_STATUS_INVALID     If the pend status has an invalid value
+*                                OS_ERR_TIMEOUT            Not enough data was written within the specified timeout
+*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*
+* Returns    : The number of bytes copied to 'p_buf'.  Upon OS_ERR_TIMEOUT, this is whatever the pipe held when the
+*              timeout expired.
+*
+* Note(s)    : 1) A blocking read completes once the pipe holds the lesser of 'size' and the high watermark set by
+*                 OSPipeWatermarkSet().  A non-blocking read copies whatever is available.
+*
+*              2) The bytes are copied with interrupts disabled.  Keep 'size' in proportion with the interrupt latency
+*                 that your application can tolerate.
+*
+*              3) This API 'MUST NOT' be called from a timer callback function.
+************************************************************************************************************************
+*/
+
+OS_MSG_SIZE  OSPipeRead (OS_PIPE      *p_pipe,
+                         void         *p_buf,
+                         OS_MSG_SIZE   size,
+                         OS_TICK       timeout,
+                         OS_OPT        opt,
+                         OS_ERR       *p_err)
+{
+    OS_MSG_SIZE  nbr_bytes;
+    OS_MSG_SIZE  nbr_min;
+    OS_OBJ_QTY   nbr_rdy;
+    CPU_TS       ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to block from an ISR                     */
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != OS_OPT_PEND_NON_BLOCKING) {
+           *p_err = OS_ERR_PEND_ISR;
+            return (0u);
+        }
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_pipe == (OS_PIPE *)0) {                               /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    if (p_buf == (void *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    if (size == 0u) {
+       *p_err = OS_ERR_PIPE_SIZE;
+        return (0u);
+    }
+    switch (opt & (OS_OPT)~OS_OPT_PEND_ABS) {
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_pipe->Type != OS_OBJ_TYPE_PIPE) {                     /* Make sure pipe was created                           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    nbr_min = (size < p_pipe->WatermarkHi) ? size : p_pipe->WatermarkHi;
+
+    CPU_CRITICAL_ENTER();
+    if ((p_pipe->NbrUsed >= nbr_min) ||                         /* Enough data in the pipe?                             */
+        ((p_pipe->NbrUsed > 0u) && ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u))) {
+        nbr_bytes = OS_PipeCopyOut(p_pipe, (CPU_INT08U *)p_buf, size);
+        nbr_rdy   = OS_PipeWake(p_pipe, ts);                    /* Yes, room was made for the writers                   */
+        CPU_CRITICAL_EXIT();
+        if (nbr_rdy > 0u) {
+            OSSched();                                          /* Run the scheduler                                    */
+        }
+       *p_err = OS_ERR_NONE;
+        return (nbr_bytes);
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                        /* No                                                   */
+        return (0u);
+    } else {
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return (0u);
+        }
+    }
+
+    OSTCBCurPtr->MsgPtr  = p_buf;                               /* Tell the writers where to copy the data and ...      */
+    OSTCBCurPtr->MsgSize = size;                                /* ... how much of it we want                           */
+    OS_PEND_ABS_SET(OSTCBCurPtr, opt);
+    OS_Pend((OS_PEND_OBJ *)((void *)p_pipe),                    /* Block task until enough data is written              */
+            OSTCBCurPtr,
+            OS_TASK_PEND_ON_PIPE_DATA,
+            timeout);
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    nbr_rdy = 0u;
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* Data was copied for us by OSPipeWrite()              */
+             nbr_bytes = OSTCBCurPtr->MsgSize;
+            *p_err     = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+             nbr_bytes = 0u;
+            *p_err     = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Take whatever was written before the timeout         */
+             nbr_bytes = OS_PipeCopyOut(p_pipe, (CPU_INT08U *)p_buf, size);
+             if (nbr_bytes > 0u) {
+                 nbr_rdy = OS_PipeWake(p_pipe, ts);
+             }
+            *p_err     = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+             nbr_bytes = 0u;
+            *p_err     = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+             nbr_bytes = 0u;
+            *p_err     = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+    if (nbr_rdy > 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+    return (nbr_bytes);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                   WRITE TO A PIPE
+*
+* Description: This function copies up to 'size' bytes into a pipe, as many as fit.  If the pipe is full, the calling
+*              task may block until readers bring the pipe down to its low watermark, the bytes then being copied from
+*              'p_buf' by the reader on behalf of the writer.  Readers waiting for the data are readied.
+*
+* Arguments  : p_pipe        is a pointer to the pipe
+*
+*              p_buf         is a pointer to the bytes to copy
+*
+*              size          is the number of bytes to copy
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for
+*                            room up to the amount of time specified by this argument.  If you specify 0, however,
+*                            your task will wait forever or, until room is made.
+*
+*              opt           determines whether the user wants to block if the pipe is full or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*                            Add OS_OPT_PEND_ABS to make 'timeout' the value of OSTickCtr at which to give up.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and bytes were copied
+*                                OS_ERR_OBJ_DEL            If 'p_pipe' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If you pass a NULL pointer for 'p_pipe'
+*                                OS_ERR_OBJ_TYPE           If the pipe was not created
+*                                OS_ERR_OPT_INVALID        You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         The pend was aborted
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR and the pipe would
+*                                                          need to block
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the pipe was full
+*                                OS_ERR_PIPE_SIZE          If 'size' is 0
+*                                OS_ERR_PTR_INVALID        If you passed a NULL pointer for 'p_buf'
+*                                OS_ERR_SCHED_LOCKED       The scheduler is locked
+*                                OS_ERR_STATUS_INVALID     If the pend status has an invalid value
+*                                OS_ERR_TIMEOUT            No room was made within the specified timeout
+*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*
+* Returns    : The number of bytes copied from 'p_buf', which may be less than 'size'.  Upon OS_ERR_TIMEOUT, this is
+*              whatever fit in the pipe when the timeout expired.
+*
+* Note(s)    : 1) This function may be called from an ISR with OS_OPT_PEND_NON_BLOCKING, e.g. by a receive interrupt.
+*
+*              2) The bytes are copied with interrupts disabled.  Keep 'size' in proportion with the interrupt latency
+*                 that your application can tolerate.
+*
+*              3) This API 'MUST NOT' be called from a timer callback function.
+************************************************************************************************************************
+*/
+
+OS_MSG_SIZE  OSPipeWrite (OS_PIPE      *p_pipe,
+                          void         *p_buf,
+                          OS_MSG_SIZE   size,
+                          OS_TICK       timeout,
+                          OS_OPT        opt,
+                          OS_ERR       *p_err)
+{
+    OS_MSG_SIZE  nbr_bytes;
+    OS_OBJ_QTY   nbr_rdy;
+    CPU_TS       ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to block from an ISR                     */
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != OS_OPT_PEND_NON_BLOCKING) {
+           *p_err = OS_ERR_PEND_ISR;
+            return (0u);
+        }
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_pipe == (OS_PIPE *)0) {                               /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    if (p_buf == (void *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    if (size == 0u) {
+       *p_err = OS_ERR_PIPE_SIZE;
+        return (0u);
+    }
+    switch (opt & (OS_OPT)~OS_OPT_PEND_ABS) {
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_pipe->Type != OS_OBJ_TYPE_PIPE) {                     /* Make sure pipe was created                           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_pipe->NbrUsed < p_pipe->BufSize) {                    /* Any room in the pipe?                                */
+        nbr_bytes = OS_PipeCopyIn(p_pipe, (CPU_INT08U *)p_buf, size);
+        nbr_rdy   = OS_PipeWake(p_pipe, ts);                    /* Yes, hand the data to the readers                    */
+        CPU_CRITICAL_EXIT();
+        if (nbr_rdy > 0u) {
+            OSSched();                                          /* Run the scheduler                                    */
+        }
+       *p_err = OS_ERR_NONE;
+        return (nbr_bytes);
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                        /* No                                                   */
+        return (0u);
+    } else {
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return (0u);
+        }
+    }
+
+    OSTCBCurPtr->MsgPtr  = p_buf;                               /* Tell the readers where to take the data from ...     */
+    OSTCBCurPtr->MsgSize = size;                                /* ... and how much of it there is                      */
+    OS_PEND_ABS_SET(OSTCBCurPtr, opt);
+    OS_Pend((OS_PEND_OBJ *)((void *)p_pipe),                    /* Block task until room is made                        */
+            OSTCBCurPtr,
+            OS_TASK_PEND_ON_PIPE_SPACE,
+            timeout);
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    nbr_rdy = 0u;
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* Data was copied for us by OSPipeRead()               */
+             nbr_bytes = OSTCBCurPtr->MsgSize;
+            *p_err     = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+             nbr_bytes = 0u;
+            *p_err     = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Put in whatever fits after the timeout               */
+             nbr_bytes = OS_PipeCopyIn(p_pipe, (CPU_INT08U *)p_buf, size);
+             if (nbr_bytes > 0u) {
+                 nbr_rdy = OS_PipeWake(p_pipe, ts);
+             }
+            *p_err     = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+             nbr_bytes = 0u;
+            *p_err     = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+             nbr_bytes = 0u;
+            *p_err     = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+    if (nbr_rdy > 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+    return (nbr_bytes);
+}
+
+
+/*
+************************************************************************************************************************
+*                                              SET THE WATERMARKS OF A PIPE
+*
+* Description: This function sets the levels at which the tasks blocked on a pipe are woken:
+*
+*                  readers are woken when the pipe holds at least 'hi' bytes (or what they asked for, if less)
+*                  writers are woken when the pipe holds at most  'lo' bytes
+*
+*              Raising 'hi' lets a consumer process the data in larger chunks, with fewer context switches.
+*              Lowering 'lo' does the same for a producer that blocks when the pipe is full.
+*
+* Arguments  : p_pipe    is a pointer to the pipe
+*
+*              lo        is the low  watermark (0 .. size - 1)
+*
+*              hi        is the high watermark (1 .. size)
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                The call was successful
+*                            OS_ERR_OBJ_PTR_NULL        If you pass a NULL pointer for 'p_pipe'
+*                            OS_ERR_OBJ_TYPE            If the pipe was not created
+*                            OS_ERR_PIPE_WATERMARK      If 'lo' or 'hi' is out of range
+*
+* Returns    : none
+*
+* Note(s)    : 1) Tasks already waiting are woken if the new watermarks are already reached.
+************************************************************************************************************************
+*/
+
+void  OSPipeWatermarkSet (OS_PIPE      *p_pipe,
+                          OS_MSG_SIZE   lo,
+                          OS_MSG_SIZE   hi,
+                          OS_ERR       *p_err)
+{
+    OS_OBJ_QTY  nbr_rdy;
+    CPU_TS      ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_pipe == (OS_PIPE *)0) {                               /* Validate 'p_pipe'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_pipe->Type != OS_OBJ_TYPE_PIPE) {                     /* Make sure pipe was created                           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    if ((lo >= p_pipe->BufSize) ||                              /* Validate the watermarks                              */
+        (hi == 0u)              ||
+        (hi >  p_pipe->BufSize)) {
+       *p_err = OS_ERR_PIPE_WATERMARK;
+        return;
+    }
+
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_pipe->WatermarkLo = lo;
+    p_pipe->WatermarkHi = hi;
+    nbr_rdy             = OS_PipeWake(p_pipe, ts);              /* See Note #1                                          */
+    CPU_CRITICAL_EXIT();
+    if (nbr_rdy > 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 CLEAR THE CONTENTS OF A PIPE
+*
+* Description: This function is called by OSPipeDel() to clear the contents of a pipe
+*
+* Argument(s): p_pipe   is a pointer to the pipe to clear
+*              ------
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_PipeClr (OS_PIPE  *p_pipe)
+{
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_pipe->Type        =  OS_OBJ_TYPE_NONE;                    /* Mark the data structure as a NONE                    */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_pipe->NamePtr     = (CPU_CHAR *)((void *)"?PIPE");
+#endif
+    p_pipe->BufPtr      = (CPU_INT08U *)0;
+    p_pipe->BufSize     =               0u;
+    p_pipe->InIx        =               0u;
+    p_pipe->OutIx       =               0u;
+    p_pipe->NbrUsed     =               0u;
+    p_pipe->WatermarkLo =               0u;
+    p_pipe->WatermarkHi =               0u;
+    OS_PendListInit(&p_pipe->PendList);                         /* Initialize the waiting list                          */
+}
+
+
+/*
+************************************************************************************************************************
+*                                           ADD/REMOVE PIPE TO/FROM DEBUG LIST
+*
+* Description: These functions are called by uC/OS-III to add or remove a pipe to/from the pipe debug list.
+*
+* Arguments  : p_pipe  is a pointer to the pipe to add/remove
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN > 0u)
+void  OS_PipeDbgListAdd (OS_PIPE  *p_pipe)
+{
+    p_pipe->DbgNamePtr               = (CPU_CHAR *)((void *)" ");
+    p_pipe->DbgPrevPtr               = (OS_PIPE *)0;
+    if (OSPipeDbgListPtr == (OS_PIPE *)0) {
+        p_pipe->DbgNextPtr           = (OS_PIPE *)0;
+    } else {
+        p_pipe->DbgNextPtr           =  OSPipeDbgListPtr;
+        OSPipeDbgListPtr->DbgPrevPtr =  p_pipe;
+    }
+    OSPipeDbgListPtr                 =  p_pipe;
+}
+
+
+void  OS_PipeDbgListRemove (OS_PIPE  *p_pipe)
+{
+    OS_PIPE  *p_pipe_next;
+    OS_PIPE  *p_pipe_prev;
+
+
+    p_pipe_prev = p_pipe->DbgPrevPtr;
+    p_pipe_next = p_pipe->DbgNextPtr;
+
+    if (p_pipe_prev == (OS_PIPE *)0) {
+        OSPipeDbgListPtr = p_pipe_next;
+        if (p_pipe_next != (OS_PIPE *)0) {
+            p_pipe_next->DbgPrevPtr = (OS_PIPE *)0;
+        }
+        p_pipe->DbgNextPtr = (OS_PIPE *)0;
+
+    } else if (p_pipe_next == (OS_PIPE *)0) {
+        p_pipe_prev->DbgNextPtr = (OS_PIPE *)0;
+        p_pipe->DbgPrevPtr      = (OS_PIPE *)0;
+
+    } else {
+        p_pipe_prev->DbgNextPtr =  p_pipe_next;
+        p_pipe_next->DbgPrevPtr =  p_pipe_prev;
+        p_pipe->DbgNextPtr      = (OS_PIPE *)0;
+        p_pipe->DbgPrevPtr      = (OS_PIPE *)0;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                              COPY BYTES INTO/OUT OF A PIPE
+*
+* Description: These functions copy as many bytes as possible, up to 'size', into or out of the buffer of a pipe,
+*              wrapping around its end.
+*
+* Arguments  : p_pipe   is a pointer to the pipe
+*
+*              p_src    is a pointer to the bytes to copy into the pipe
+*              p_dst    is a pointer to where the bytes taken out of the pipe are copied
+*
+*              size     is the maximum number of bytes to copy
+*
+* Returns    : The number of bytes copied
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application MUST NOT call them.
+*
+*              2) These functions must be called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+static  OS_MSG_SIZE  OS_PipeCopyIn (OS_PIPE      *p_pipe,
+                                    CPU_INT08U   *p_src,
+                                    OS_MSG_SIZE   size)
+{
+    CPU_INT08U   *p_dst;
+    OS_MSG_SIZE   nbr_bytes;
+    OS_MSG_SIZE   i;
+
+
+    nbr_bytes = p_pipe->BufSize - p_pipe->NbrUsed;              /* Copy as much as fits                                 */
+    if (nbr_bytes > size) {
+        nbr_bytes = size;
+    }
+    p_dst = p_pipe->BufPtr + p_pipe->InIx;
+    for (i = 0u; i < nbr_bytes; i++) {
+       *p_dst++ = *p_src++;
+        p_pipe->InIx++;
+        if (p_pipe->InIx >= p_pipe->BufSize) {                  /* Wrap around the end of the buffer                    */
+            p_pipe->InIx = 0u;
+            p_dst        = p_pipe->BufPtr;
+        }
+    }
+    p_pipe->NbrUsed += nbr_bytes;
+    return (nbr_bytes);
+}
+
+
+static  OS_MSG_SIZE  OS_PipeCopyOut (OS_PIPE      *p_pipe,
+                                     CPU_INT08U   *p_dst,
+                                     OS_MSG_SIZE   size)
+{
+    CPU_INT08U   *p_src;
+    OS_MSG_SIZE   nbr_bytes;
+    OS_MSG_SIZE   i;
+
+
+    nbr_bytes = p_pipe->NbrUsed;                                /* Copy as much as available                            */
+    if (nbr_bytes > size) {
+        nbr_bytes = size;
+    }
+    p_src = p_pipe->BufPtr + p_pipe->OutIx;
+    for (i = 0u; i < nbr_bytes; i++) {
+       *p_dst++ = *p_src++;
+        p_pipe->OutIx++;
+        if (p_pipe->OutIx >= p_pipe->BufSize) {                 /* Wrap around the end of the buffer                    */
+            p_pipe->OutIx = 0u;
+            p_src         = p_pipe->BufPtr;
+        }
+    }
+    p_pipe->NbrUsed -= nbr_bytes;
+    return (nbr_bytes);
+}
+
+
+/*
+************************************************************************************************************************
+*                                            COMPLETE THE WAITERS OF A PIPE
+*
+* Description: This function completes, on their behalf, the reads and writes of the tasks waiting on a pipe that the
+*              level of the pipe now allows:
+*
+*                  readers, highest priority first, while the pipe holds what they need (see OSPipeRead(), Note #1)
+*                  writers, highest priority first, while the pipe is at or below its low watermark and not full
+*
+*              The number of bytes copied is handed to each task through OS_Post().
+*
+* Arguments  : p_pipe   is a pointer to the pipe
+*
+*              ts       is the timestamp to give to the tasks readied
+*
+* Returns    : The number of tasks readied
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) A reader waiting with 'size' bytes wanted is kept in '.MsgPtr' and '.MsgSize' of its OS_TCB, as is a
+*                 writer with its bytes.  Completing a writer may in turn complete a reader and vice-versa, hence the
+*                 loop.
+************************************************************************************************************************
+*/
+
+static  OS_OBJ_QTY  OS_PipeWake (OS_PIPE  *p_pipe,
+                                 CPU_TS    ts)
+{
+    OS_TCB       *p_tcb;
+    OS_MSG_SIZE   nbr_min;
+    OS_MSG_SIZE   nbr_bytes;
+    OS_OBJ_QTY    nbr_rdy;
+    OS_OBJ_QTY    nbr_rdy_prev;
+
+
+    nbr_rdy = 0u;
+    do {
+        nbr_rdy_prev = nbr_rdy;
+
+        p_tcb = OS_PipeWaiterGet(p_pipe, OS_TASK_PEND_ON_PIPE_DATA);
+        while (p_tcb != (OS_TCB *)0) {                          /* Complete the readers                                 */
+            nbr_min = (p_tcb->MsgSize < p_pipe->WatermarkHi) ? p_tcb->MsgSize : p_pipe->WatermarkHi;
+            if (p_pipe->NbrUsed < nbr_min) {
+                break;
+            }
+            nbr_bytes = OS_PipeCopyOut(p_pipe, (CPU_INT08U *)p_tcb->MsgPtr, p_tcb->MsgSize);
+            OS_Post((OS_PEND_OBJ *)((void *)p_pipe),
+                    p_tcb,
+                    p_tcb->MsgPtr,
+                    nbr_bytes,
+                    ts);
+            nbr_rdy++;
+            p_tcb = OS_PipeWaiterGet(p_pipe, OS_TASK_PEND_ON_PIPE_DATA);
+        }
+
+        p_tcb = OS_PipeWaiterGet(p_pipe, OS_TASK_PEND_ON_PIPE_SPACE);
+        while (p_tcb != (OS_TCB *)0) {                          /* Complete the writers                                 */
+            if ((p_pipe->NbrUsed >  p_pipe->WatermarkLo) ||
+                (p_pipe->NbrUsed >= p_pipe->BufSize)) {
+                break;
+            }
+            nbr_bytes = OS_PipeCopyIn(p_pipe, (CPU_INT08U *)p_tcb->MsgPtr, p_tcb->MsgSize);
+            OS_Post((OS_PEND_OBJ *)((void *)p_pipe),
+                    p_tcb,
+                    p_tcb->MsgPtr,
+                    nbr_bytes,
+                    ts);
+            nbr_rdy++;
+            p_tcb = OS_PipeWaiterGet(p_pipe, OS_TASK_PEND_ON_PIPE_SPACE);
+        }
+    } while (nbr_rdy != nbr_rdy_prev);                          /* See Note #2                                          */
+
+    return (nbr_rdy);
+}
+
+
+/*
+************************************************************************************************************************
+*                                         FIND A TASK WAITING ON ONE SIDE OF A PIPE
+*
+* Description: Readers and writers share the pend list of the pipe.  This function returns the highest priority task
+*              waiting for 'pending_on'.
+*
+* Arguments  : p_pipe       is a pointer to the pipe
+*
+*              pending_on   is the side of interest:
+*
+*                               OS_TASK_PEND_ON_PIPE_DATA     readers blocked in OSPipeRead()
+*                               OS_TASK_PEND_ON_PIPE_SPACE    writers blocked in OSPipeWrite()
+*
+* Returns    : A pointer to the OS_TCB of the task found or, a NULL pointer if no such task is waiting
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  OS_TCB  *OS_PipeWaiterGet (OS_PIPE   *p_pipe,
+                                   OS_STATE   pending_on)
+{
+    OS_TCB  *p_tcb;
+
+
+    p_tcb = p_pipe->PendList.HeadPtr;
+    while (p_tcb != (OS_TCB *)0) {
+        if (p_tcb->PendOn == pending_on) {
+            break;
+        }
+        p_tcb = p_tcb->PendNextPtr;
+    }
+    return (p_tcb);
+}
+#endif
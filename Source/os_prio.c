@@ -51,9 +51,12 @@ void  OS_PrioInit (void)
 
 
                                                                 /* Clear the bitmap table ... no task is ready          */
-    for (i = 0u; i < OS_PRIO_TBL_SIZE; i++) {
+    for (i = 0u; i < OS_PRIO_RDY_TBL_SIZE; i++) {
          OSPrioTbl[i] = 0u;
     }
+#if (OS_PRIO_TBL_2LVL_EN > 0u)
+    OSPrioGrp = 0u;                                             /* Clear the summary word ... no bitmap entry in use    */
+#endif
 
 #if (OS_CFG_TASK_IDLE_EN == 0u)
     OS_PrioInsert ((OS_PRIO)(OS_CFG_PRIO_MAX - 1u));            /* Insert what would be the idle task                   */
@@ -72,23 +75,50 @@ void  OS_PrioInit (void)
 * Returns    : The priority of the Highest Priority Task (HPT) waiting for the event
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) With OS_CFG_SCHED_WINDOW_EN, only the priorities of the active scheduling window are considered.  The
+*                 idle task priority is part of every window so the search always ends.
 ************************************************************************************************************************
 */
 
 OS_PRIO  OS_PrioGetHighest (void)
 {
-#if   (OS_CFG_PRIO_MAX <= (CPU_CFG_DATA_SIZE * 8u))             /* Optimize for less than word size nbr of priorities   */
-    return ((OS_PRIO)CPU_CntLeadZeros(OSPrioTbl[0]));
+#if   (OS_CFG_SCHED_WINDOW_EN > 0u)                             /* Mask the ready priorities with the active window     */
+    CPU_DATA  *p_mask;
+    CPU_DATA   ix;
+    CPU_DATA   map;
+
+
+    p_mask = &OSSchedWindowCurPtr->PrioTbl[0];
+    ix     = 0u;
+    map    = OSPrioTbl[0] & p_mask[0];
+    while (map == 0u) {                                         /* See Note #2                                          */
+        ix++;
+        map = OSPrioTbl[ix] & p_mask[ix];
+    }
+    return ((OS_PRIO)((OS_PRIO)(ix * (CPU_CFG_DATA_SIZE * 8u)) + (OS_PRIO)CPU_CntLeadZeros(map)));
 
 
-#elif (OS_CFG_PRIO_MAX <= (2u * (CPU_CFG_DATA_SIZE * 8u)))      /* Optimize for    2x the word size nbr of priorities   */
+#elif (OS_PRIO_RDY_NBR <= (CPU_CFG_DATA_SIZE * 8u))             /* Optimize for less than word size nbr of priorities   */
+    return (OS_PRIO_FROM_IX((OS_PRIO)CPU_CntLeadZeros(OSPrioTbl[0])));
+
+
+#elif (OS_PRIO_RDY_NBR <= (2u * (CPU_CFG_DATA_SIZE * 8u)))      /* Optimize for    2x the word size nbr of priorities   */
     if (OSPrioTbl[0] == 0u) {
-        return ((OS_PRIO)((OS_PRIO)CPU_CntLeadZeros(OSPrioTbl[1]) + (CPU_CFG_DATA_SIZE * 8u)));
+        return (OS_PRIO_FROM_IX((OS_PRIO)((OS_PRIO)CPU_CntLeadZeros(OSPrioTbl[1]) + (CPU_CFG_DATA_SIZE * 8u))));
     } else {
-        return ((OS_PRIO)((OS_PRIO)CPU_CntLeadZeros(OSPrioTbl[0])));
+        return (OS_PRIO_FROM_IX((OS_PRIO)((OS_PRIO)CPU_CntLeadZeros(OSPrioTbl[0]))));
     }
 
 
+#elif (OS_PRIO_TBL_2LVL_EN > 0u)                               /* Two-level bitmap for > 2x the word size nbr of prio  */
+    OS_PRIO  ix;
+
+
+    ix = (OS_PRIO)CPU_CntLeadZeros(OSPrioGrp);                  /* Find the first bitmap entry with a bit set           */
+    return (OS_PRIO_FROM_IX((OS_PRIO)((OS_PRIO)(ix * (CPU_CFG_DATA_SIZE * 8u)) + (OS_PRIO)CPU_CntLeadZeros(OSPrioTbl[ix]))));
+
+
 #else
     CPU_DATA  *p_tbl;
     OS_PRIO    prio;
@@ -102,7 +132,7 @@ OS_PRIO  OS_PrioGetHighest (void)
     }
     prio += (OS_PRIO)CPU_CntLeadZeros(*p_tbl);                  /* Find the position of the first bit set at the entry  */
 
-    return (prio);
+    return (OS_PRIO_FROM_IX(prio));
 #endif
 }
 
@@ -122,15 +152,19 @@ OS_PRIO  OS_PrioGetHighest (void)
 
 void  OS_PrioInsert (OS_PRIO  prio)
 {
-#if   (OS_CFG_PRIO_MAX <= (CPU_CFG_DATA_SIZE * 8u))             /* Optimize for less than word size nbr of priorities   */
-    OSPrioTbl[0] |= (CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - prio);
+#if   (OS_PRIO_RDY_NBR <= (CPU_CFG_DATA_SIZE * 8u))             /* Optimize for less than word size nbr of priorities   */
+    OSPrioTbl[0] |= (CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - OS_PRIO_IX(prio));
 
 
-#elif (OS_CFG_PRIO_MAX <= (2u * (CPU_CFG_DATA_SIZE * 8u)))      /* Optimize for    2x the word size nbr of priorities   */
-    if (prio < (CPU_CFG_DATA_SIZE * 8u)) {
-        OSPrioTbl[0] |= (CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - prio);
+#elif (OS_PRIO_RDY_NBR <= (2u * (CPU_CFG_DATA_SIZE * 8u)))      /* Optimize for    2x the word size nbr of priorities   */
+    OS_PRIO  ix_prio;
+
+
+    ix_prio = OS_PRIO_IX(prio);
+    if (ix_prio < (CPU_CFG_DATA_SIZE * 8u)) {
+        OSPrioTbl[0] |= (CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - ix_prio);
     } else {
-        OSPrioTbl[1] |= (CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - (prio - (CPU_CFG_DATA_SIZE * 8u)));
+        OSPrioTbl[1] |= (CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - (ix_prio - (CPU_CFG_DATA_SIZE * 8u)));
     }
 
 
@@ -138,9 +172,12 @@ void  OS_PrioInsert (OS_PRIO  prio)
     CPU_DATA  bit_nbr;
     OS_PRIO   ix;
 
-    ix             = (OS_PRIO)(prio /  (CPU_CFG_DATA_SIZE * 8u));
-    bit_nbr        = (CPU_DATA)prio & ((CPU_CFG_DATA_SIZE * 8u) - 1u);
+    ix             = (OS_PRIO)(OS_PRIO_IX(prio) /  (CPU_CFG_DATA_SIZE * 8u));
+    bit_nbr        = (CPU_DATA)OS_PRIO_IX(prio) & ((CPU_CFG_DATA_SIZE * 8u) - 1u);
     OSPrioTbl[ix] |= (CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - bit_nbr);
+#if (OS_PRIO_TBL_2LVL_EN > 0u)
+    OSPrioGrp     |= (CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - ix);
+#endif
 #endif
 }
 
@@ -160,15 +197,19 @@ void  OS_PrioInsert (OS_PRIO  prio)
 
 void  OS_PrioRemove (OS_PRIO  prio)
 {
-#if   (OS_CFG_PRIO_MAX <= (CPU_CFG_DATA_SIZE * 8u))             /* Optimize for less than word size nbr of priorities   */
-    OSPrioTbl[0] &= ~((CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - prio));
+#if   (OS_PRIO_RDY_NBR <= (CPU_CFG_DATA_SIZE * 8u))             /* Optimize for less than word size nbr of priorities   */
+    OSPrioTbl[0] &= ~((CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - OS_PRIO_IX(prio)));
 
 
-#elif (OS_CFG_PRIO_MAX <= (2u * (CPU_CFG_DATA_SIZE * 8u)))      /* Optimize for    2x the word size nbr of priorities   */
-    if (prio < (CPU_CFG_DATA_SIZE * 8u)) {
-        OSPrioTbl[0] &= ~((CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - prio));
+#elif (OS_PRIO_RDY_NBR <= (2u * (CPU_CFG_DATA_SIZE * 8u)))      /* Optimize for    2x the word size nbr of priorities   */
+    OS_PRIO  ix_prio;
+
+
+    ix_prio = OS_PRIO_IX(prio);
+    if (ix_prio < (CPU_CFG_DATA_SIZE * 8u)) {
+        OSPrioTbl[0] &= ~((CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - ix_prio));
     } else {
-        OSPrioTbl[1] &= ~((CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - (prio - (CPU_CFG_DATA_SIZE * 8u))));
+        OSPrioTbl[1] &= ~((CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - (ix_prio - (CPU_CFG_DATA_SIZE * 8u))));
     }
 
 
@@ -176,8 +217,86 @@ void  OS_PrioRemove (OS_PRIO  prio)
     CPU_DATA  bit_nbr;
     OS_PRIO   ix;
 
-    ix             =   (OS_PRIO)(prio  /   (CPU_CFG_DATA_SIZE * 8u));
-    bit_nbr        =   (CPU_DATA)prio  &  ((CPU_CFG_DATA_SIZE * 8u) - 1u);
+    ix             =   (OS_PRIO)(OS_PRIO_IX(prio)  /   (CPU_CFG_DATA_SIZE * 8u));
+    bit_nbr        =   (CPU_DATA)OS_PRIO_IX(prio)  &  ((CPU_CFG_DATA_SIZE * 8u) - 1u);
     OSPrioTbl[ix] &= ~((CPU_DATA)  1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - bit_nbr));
+#if (OS_PRIO_TBL_2LVL_EN > 0u)
+    if (OSPrioTbl[ix] == 0u) {                                  /* Clear the summary bit when the entry becomes empty   */
+        OSPrioGrp &= ~((CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - ix));
+    }
+#endif
+#endif
+}
+
+/*
+************************************************************************************************************************
+*                                              INITIALIZE THE PRIORITY MAP
+*
+* Description: This function is called by OSInit() to build OSPrioMapIxTbl[], the dense index of each priority listed in
+*              OSCfg_PrioMapTbl[].  The ready list and OSPrioTbl[] are indexed by that dense index so that their size
+*              follows the number of priorities actually used rather than OS_CFG_PRIO_MAX.
+*
+* Arguments  : p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                           OS_ERR_NONE            The map is valid
+*                           OS_ERR_PRIO_INVALID    OSCfg_PrioMapTbl[] is not in increasing order, doesn't end with the
+*                                                  idle task priority or doesn't list a kernel task priority
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Keeping the table in increasing order preserves the order of the priorities, so the highest priority
+*                 ready task is still the first bit set in OSPrioTbl[].
+*
+*              3) Priorities left out of the map are rejected by OSTaskCreate(), OSTaskChangePrio() and
+*                 OSMutexCeilingSet().
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_PRIO_MAP_EN > 0u)
+void  OS_PrioMapInit (OS_ERR  *p_err)
+{
+    CPU_INT16U  i;
+    OS_PRIO     prio;
+
+
+    for (i = 0u; i < OS_CFG_PRIO_MAX; i++) {                    /* No priority is mapped yet                            */
+        OSPrioMapIxTbl[i] = OS_PRIO_MAP_NONE;
+    }
+
+    for (i = 0u; i < OS_CFG_PRIO_MAP_NBR; i++) {
+        prio = OSCfg_PrioMapTbl[i];
+        if (prio >= OS_CFG_PRIO_MAX) {
+           *p_err = OS_ERR_PRIO_INVALID;
+            return;
+        }
+        if ((i > 0u) && (prio <= OSCfg_PrioMapTbl[i - 1u])) {   /* See Note #2                                          */
+           *p_err = OS_ERR_PRIO_INVALID;
+            return;
+        }
+        OSPrioMapIxTbl[prio] = (OS_PRIO)i;
+    }
+
+    if (OSCfg_PrioMapTbl[OS_CFG_PRIO_MAP_NBR - 1u] != (OS_PRIO)(OS_CFG_PRIO_MAX - 1u)) {
+       *p_err = OS_ERR_PRIO_INVALID;                            /* The idle task priority must be mapped                */
+        return;
+    }
+
+#if (OS_CFG_TASK_EDF_EN > 0u)
+    if (OSPrioMapIxTbl[OS_CFG_TASK_EDF_PRIO] == OS_PRIO_MAP_NONE) {
+       *p_err = OS_ERR_PRIO_INVALID;                            /* The EDF band must be mapped                          */
+        return;
+    }
+#endif
+
+#if (OS_CFG_TASK_FAIR_EN > 0u)
+    if (OSPrioMapIxTbl[OS_CFG_TASK_FAIR_PRIO] == OS_PRIO_MAP_NONE) {
+       *p_err = OS_ERR_PRIO_INVALID;                            /* The fair-share band must be mapped                   */
+        return;
+    }
 #endif
+
+   *p_err = OS_ERR_NONE;
 }
+#endif
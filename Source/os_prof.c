@@ -0,0 +1,220 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          SAMPLING PROFILER
+*
+* File    : os_prof.c
+* Version : V3.08.00
+*********************************************************************************************************
+*/
+
+#define   MICRIUM_SOURCE
+#define   OS_CRIT_SITE_ID                   OS_CRIT_SITE_PROF
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_prof__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_PROF_SAMPLE_EN > 0u)
+/*
+************************************************************************************************************************
+*                                                  READ PROFILER SAMPLES
+*
+* Description: This function takes the oldest samples out of the profiler ring.
+*
+* Arguments  : p_tbl     is a pointer to a table where the samples are copied, oldest first.
+*
+*              nbr_max   is the number of entries in 'p_tbl'.
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE            The samples were read (there may be none)
+*                            OS_ERR_PTR_INVALID     If 'p_tbl' is a NULL pointer
+*
+* Returns    : The number of samples copied to 'p_tbl'.
+*
+* Note(s)    : 1) Samples are copied while interrupts are disabled.  Reading a few samples at a time, often enough for
+*                 the ring not to fill up, keeps the interrupt latency low.
+************************************************************************************************************************
+*/
+
+OS_OBJ_QTY  OSProfSampleRead (OS_PROF_SAMPLE  *p_tbl,
+                              OS_OBJ_QTY       nbr_max,
+                              OS_ERR          *p_err)
+{
+    OS_OBJ_QTY  nbr;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_tbl == (OS_PROF_SAMPLE *)0) {                         /* User must specify a valid destination                */
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+#endif
+
+    nbr = 0u;
+    CPU_CRITICAL_ENTER();
+    while ((nbr < nbr_max) && (OSProfSampleNbr > 0u)) {
+        p_tbl[nbr] = OSProfSampleTbl[OSProfSampleOut];
+        OSProfSampleOut++;
+        if (OSProfSampleOut >= OS_CFG_PROF_SAMPLE_SIZE) {
+            OSProfSampleOut = 0u;
+        }
+        OSProfSampleNbr--;
+        nbr++;
+    }
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+    return (nbr);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  START/STOP SAMPLING
+*
+* Description: OSProfSampleStart() empties the profiler ring, clears OSProfSampleOvfCtr and lets the tick ISR record
+*              samples.  OSProfSampleStop() stops the recording; the samples left in the ring can still be read.
+*
+* Arguments  : p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE            Sampling was started or stopped
+*
+* Returns    : none
+*
+* Note(s)    : 1) The port must call OS_ProfSample() from its tick ISR, otherwise no sample is ever recorded.
+************************************************************************************************************************
+*/
+
+void  OSProfSampleStart (OS_ERR  *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    OS_ProfInit();
+    OSProfSampleEn = OS_TRUE;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+void  OSProfSampleStop (OS_ERR  *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    OSProfSampleEn = OS_FALSE;
+   *p_err          = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                             INITIALIZE THE SAMPLING PROFILER
+*
+* Description: This function is called by OSInit() and by OSProfSampleStart() to empty the ring and stop sampling.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_ProfInit (void)
+{
+    OSProfSampleEn     = OS_FALSE;
+    OSProfSampleIn     = 0u;
+    OSProfSampleOut    = 0u;
+    OSProfSampleNbr    = 0u;
+    OSProfSampleOvfCtr = 0u;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                   RECORD A SAMPLE
+*
+* Description: This function is called by the tick ISR of the port to record the address it interrupted.
+*
+* Arguments  : pc        is the address of the instruction the tick interrupted, or 0 if the port can't find it (the
+*                        Cortex-M port, for instance, doesn't look for it when the tick interrupted another exception).
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The port calls this function after OSIntEnter() and with interrupts disabled.  An OSIntNestingCtr
+*                 greater than 1 means that the tick interrupted another ISR: the sample is then not charged to a task.
+************************************************************************************************************************
+*/
+
+void  OS_ProfSample (CPU_ADDR  pc)
+{
+    OS_PROF_SAMPLE  *p_sample;
+
+
+    if ((OSProfSampleEn == OS_FALSE) ||
+        (OSRunning      != OS_STATE_OS_RUNNING)) {
+        return;
+    }
+
+    if (OSProfSampleNbr >= OS_CFG_PROF_SAMPLE_SIZE) {           /* Ring full, drop the new sample                       */
+        OSProfSampleOvfCtr++;
+        return;
+    }
+
+    p_sample = &OSProfSampleTbl[OSProfSampleIn];
+    if (OSIntNestingCtr > 1u) {                                 /* See Note #2                                          */
+        p_sample->TCBPtr = (OS_TCB *)0;
+    } else {
+        p_sample->TCBPtr = OSTCBCurPtr;
+    }
+    p_sample->PC = pc;
+    OSProfSampleIn++;
+    if (OSProfSampleIn >= OS_CFG_PROF_SAMPLE_SIZE) {
+        OSProfSampleIn = 0u;
+    }
+    OSProfSampleNbr++;
+}
+#endif
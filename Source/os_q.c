@@ -24,6 +24,7 @@
 */
 
 #define  MICRIUM_SOURCE
+#define  OS_CRIT_SITE_ID                    OS_CRIT_SITE_Q
 #include "os.h"
 
 #ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
@@ -32,6 +33,26 @@ const  CPU_CHAR  *os_q__c = "$Id: $";
 
 
 #if (OS_CFG_Q_EN > 0u)
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  void     OS_QPost      (OS_Q         *p_q,
+                                void         *p_void,
+                                OS_MSG_SIZE   msg_size,
+                                OS_OPT        opt,
+                                CPU_TS        ts,
+                                OS_ERR       *p_err);
+
+#if (OS_CFG_Q_PEND_MATCH_EN > 0u)
+static  OS_TCB  *OS_QMatchHead (OS_PEND_LIST *p_pend_list,
+                                void         *p_void,
+                                OS_MSG_SIZE   msg_size);
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                               CREATE A MESSAGE QUEUE
@@ -122,6 +143,139 @@ void  OSQCreate (OS_Q        *p_q,
     OS_MsgQInit(&p_q->MsgQ,                                     /* Initialize the queue                                 */
                 max_qty);
     OS_PendListInit(&p_q->PendList);                            /* Initialize the waiting list                          */
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_q->SpacePendObj.Type    = OS_OBJ_TYPE_Q;
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_q->SpacePendObj.NamePtr = p_name;
+#endif
+    OS_PendListInit(&p_q->SpacePendObj.PendList);               /* Initialize the list of the senders (see os.h)        */
+#endif
+
+#if (OS_CFG_DBG_EN > 0u)
+    OS_QDbgListAdd(p_q);
+    OSQQty++;                                                   /* One more queue created                               */
+#endif
+    OS_TRACE_Q_CREATE(p_q, p_name);
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                    CREATE A MESSAGE QUEUE WITH A PRIVATE OS_MSG POOL
+*
+* Description: This function is called by your application to create a message queue that takes its OS_MSGs from an
+*              array you provide instead of from the pool shared by all the queues.  Posting to this queue can then
+*              never exhaust the OS_MSGs of other queues (and vice-versa).
+*
+* Arguments  : p_q         is a pointer to the message queue
+*
+*              p_name      is a pointer to an ASCII string that will be used to name the message queue
+*
+*              p_msg_tbl   is a pointer to an array of 'max_qty' OS_MSGs that will be dedicated to this queue.  The array
+*                          MUST remain allocated until the queue is deleted.
+*
+*              max_qty     indicates the maximum size of the message queue and the number of entries in 'p_msg_tbl'
+*                          (must be non-zero).
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                    The call was successful
+*                              OS_ERR_CREATE_ISR              Can't create from an ISR
+*                              OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the Queue after you called
+*                                                               OSSafetyCriticalStart()
+*                              OS_ERR_OBJ_PTR_NULL            If you passed a NULL pointer for 'p_q'
+*                              OS_ERR_PTR_INVALID             If you passed a NULL pointer for 'p_msg_tbl'
+*                              OS_ERR_Q_SIZE                  If the size you specified is 0
+*                              OS_ERR_OBJ_CREATED             If the message queue was already created
+*
+* Returns    : none
+*
+* Note(s)    : 1) Once the queue is deleted, it reverts to using the global pool if it is re-created with OSQCreate().
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_PRIV_POOL_EN > 0u)
+void  OSQCreateWithPool (OS_Q        *p_q,
+                         CPU_CHAR    *p_name,
+                         OS_MSG      *p_msg_tbl,
+                         OS_MSG_QTY   max_qty,
+                         OS_ERR      *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_q == (OS_Q *)0) {                                     /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_msg_tbl == (OS_MSG *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    if (max_qty == 0u) {                                        /* Cannot specify a zero size queue                     */
+       *p_err = OS_ERR_Q_SIZE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
+    if (p_q->Type == OS_OBJ_TYPE_Q) {
+        CPU_CRITICAL_EXIT();
+        *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+    p_q->Type    = OS_OBJ_TYPE_Q;                               /* Mark the data structure as a message queue           */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_q->NamePtr = p_name;
+#else
+    (void)p_name;
+#endif
+    OS_MsgQInit(&p_q->MsgQ,                                     /* Initialize the queue                                 */
+                max_qty);
+    OS_MsgPoolCreate(&p_q->MsgPool,                             /* Build the private free list of OS_MSGs               */
+                      p_msg_tbl,
+                      max_qty);
+    p_q->MsgQ.PoolPtr = &p_q->MsgPool;                          /* Draw OS_MSGs from the private pool                   */
+    OS_PendListInit(&p_q->PendList);                            /* Initialize the waiting list                          */
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_q->SpacePendObj.Type    = OS_OBJ_TYPE_Q;
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_q->SpacePendObj.NamePtr = p_name;
+#endif
+    OS_PendListInit(&p_q->SpacePendObj.PendList);               /* Initialize the list of the senders (see os.h)        */
+#endif
 
 #if (OS_CFG_DBG_EN > 0u)
     OS_QDbgListAdd(p_q);
@@ -131,6 +285,7 @@ void  OSQCreate (OS_Q        *p_q,
     CPU_CRITICAL_EXIT();
    *p_err = OS_ERR_NONE;
 }
+#endif
 
 
 /*
@@ -236,7 +391,12 @@ OS_OBJ_QTY  OSQDel (OS_Q    *p_q,
     nbr_tasks   = 0u;
     switch (opt) {
         case OS_OPT_DEL_NO_PEND:                                /* Delete message queue only if no task waiting         */
-             if (p_pend_list->HeadPtr == (OS_TCB *)0) {
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+             if ((OS_PEND_LIST_HEAD(p_pend_list)                  == (OS_TCB *)0) &&
+                 (OS_PEND_LIST_HEAD(&p_q->SpacePendObj.PendList) == (OS_TCB *)0)) {
+#else
+             if (OS_PEND_LIST_HEAD(p_pend_list) == (OS_TCB *)0) {
+#endif
 #if (OS_CFG_DBG_EN > 0u)
                  OS_QDbgListRemove(p_q);
                  OSQQty--;
@@ -257,13 +417,31 @@ OS_OBJ_QTY  OSQDel (OS_Q    *p_q,
 #else
              ts = 0u;
 #endif
-             while (p_pend_list->HeadPtr != (OS_TCB *)0) {      /* Remove all tasks from the pend list                  */
-                 p_tcb = p_pend_list->HeadPtr;
+             p_tcb = OS_PEND_LIST_HEAD(p_pend_list);            /* Remove all tasks from the pend list                  */
+             while (p_tcb != (OS_TCB *)0) {
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+                 OS_PendMultiRdy((OS_PEND_OBJ *)((void *)p_q),
+                                 p_tcb,
+                                 (void *)0,
+                                 0u,
+                                 ts);
+#endif
+                 OS_PendAbort(p_tcb,
+                              ts,
+                              OS_STATUS_PEND_DEL);
+                 nbr_tasks++;
+                 p_tcb = OS_PEND_LIST_HEAD(p_pend_list);
+             }
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+             p_tcb = OS_PEND_LIST_HEAD(&p_q->SpacePendObj.PendList);
+             while (p_tcb != (OS_TCB *)0) {                     /* Also remove the tasks waiting for room               */
                  OS_PendAbort(p_tcb,
                               ts,
                               OS_STATUS_PEND_DEL);
                  nbr_tasks++;
+                 p_tcb = OS_PEND_LIST_HEAD(&p_q->SpacePendObj.PendList);
              }
+#endif
 #if (OS_CFG_DBG_EN > 0u)
              OS_QDbgListRemove(p_q);
              OSQQty--;
@@ -317,6 +495,9 @@ OS_MSG_QTY  OSQFlush (OS_Q    *p_q,
                       OS_ERR  *p_err)
 {
     OS_MSG_QTY  entries;
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+    OS_OBJ_QTY  nbr_rdy;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -358,7 +539,15 @@ OS_MSG_QTY  OSQFlush (OS_Q    *p_q,
 
     CPU_CRITICAL_ENTER();
     entries = OS_MsgQFreeAll(&p_q->MsgQ);                       /* Return all OS_MSGs to the OS_MSG pool                */
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+    nbr_rdy = OS_QSpaceWake(p_q);                               /* Queue the messages of the waiting senders            */
+    CPU_CRITICAL_EXIT();
+    if (nbr_rdy > 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+#else
     CPU_CRITICAL_EXIT();
+#endif
    *p_err   = OS_ERR_NONE;
     return (entries);
 }
@@ -383,6 +572,8 @@ OS_MSG_QTY  OSQFlush (OS_Q    *p_q,
 *                                OS_OPT_PEND_BLOCKING
 *                                OS_OPT_PEND_NON_BLOCKING
 *
+*                            Add OS_OPT_PEND_ABS to make 'timeout' the value of OSTickCtr at which to give up.
+*
 *              p_msg_size    is a pointer to a variable that will receive the size of the message
 *
 *              p_ts          is a pointer to a variable that will receive the timestamp of when the message was
@@ -425,7 +616,10 @@ void  *OSQPend (OS_Q         *p_q,
                 CPU_TS       *p_ts,
                 OS_ERR       *p_err)
 {
-    void  *p_void;
+    void        *p_void;
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+    OS_OBJ_QTY   nbr_rdy;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -479,7 +673,7 @@ void  *OSQPend (OS_Q         *p_q,
        *p_err = OS_ERR_PTR_INVALID;
         return ((void *)0);
     }
-    switch (opt) {
+    switch (opt & (OS_OPT)~OS_OPT_PEND_ABS) {
         case OS_OPT_PEND_BLOCKING:
         case OS_OPT_PEND_NON_BLOCKING:
              break;
@@ -512,7 +706,16 @@ void  *OSQPend (OS_Q         *p_q,
                         p_err);
     if (*p_err == OS_ERR_NONE) {
         OS_TRACE_Q_PEND(p_q);
+        OS_OBJ_STAT_INC(&p_q->PendList, PendCtr);
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+        nbr_rdy = OS_QSpaceWake(p_q);                           /* Queue the message of a waiting sender                */
+        CPU_CRITICAL_EXIT();
+        if (nbr_rdy > 0u) {
+            OSSched();                                          /* Run the scheduler                                    */
+        }
+#else
         CPU_CRITICAL_EXIT();
+#endif
         OS_TRACE_Q_PEND_EXIT(OS_ERR_NONE);
         return (p_void);                                        /* Yes, Return message received                         */
     }
@@ -533,6 +736,7 @@ void  *OSQPend (OS_Q         *p_q,
         }
     }
 
+    OS_PEND_ABS_SET(OSTCBCurPtr, opt);
     OS_Pend((OS_PEND_OBJ *)((void *)p_q),                       /* Block task pending on Message Queue                  */
             OSTCBCurPtr,
             OS_TASK_PEND_ON_Q,
@@ -601,196 +805,1338 @@ void  *OSQPend (OS_Q         *p_q,
 
 /*
 ************************************************************************************************************************
-*                                             ABORT WAITING ON A MESSAGE QUEUE
+*                                    PEND ON A QUEUE WITH A TIMEOUT IN MICROSECONDS
 *
-* Description: This function aborts & readies any tasks currently waiting on a queue.  This function should be used to
-*              fault-abort the wait on the queue, rather than to normally signal the queue via OSQPost().
+* Description: This function is the same as OSQPend() except that the timeout is given in microseconds.
 *
-* Arguments  : p_q       is a pointer to the message queue
+* Arguments  : p_q           is a pointer to the message queue
 *
-*              opt       determines the type of ABORT performed:
+*              timeout_us    is an optional timeout in microseconds.  If non-zero, your task will wait up to this long
+*                            and a timeout is detected with the resolution of OS_TS_GET().  If you specify 0, your
+*                            task will wait forever.
 *
-*                            OS_OPT_PEND_ABORT_1          ABORT wait for a single task (HPT) waiting on the queue
-*                            OS_OPT_PEND_ABORT_ALL        ABORT wait for ALL tasks that are  waiting on the queue
-*                            OS_OPT_POST_NO_SCHED         Do not call the scheduler
+*              ...           are the other arguments of OSQPend().
 *
-*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.  In
+*                            addition to the error codes of OSQPend():
 *
-*                            OS_ERR_NONE                  At least one task waiting on the queue was readied and
-*                                                         informed of the aborted wait; check return value for the
-*                                                         number of tasks whose wait on the queue was aborted
-*                            OS_ERR_OBJ_PTR_NULL          If you pass a NULL pointer for 'p_q'
-*                            OS_ERR_OBJ_TYPE              If the message queue was not created
-*                            OS_ERR_OPT_INVALID           You specified an invalid option
-*                            OS_ERR_OS_NOT_RUNNING        If uC/OS-III is not running yet
-*                            OS_ERR_PEND_ABORT_ISR        If this function was called from an ISR
-*                            OS_ERR_PEND_ABORT_NONE       No task were pending
+*                                OS_ERR_TIME_INVALID_MICROSECONDS   If 'timeout_us' is too long for the timestamp
+*                                                                   or the timestamp frequency is unknown
 *
-* Returns    : == 0      if no tasks were waiting on the queue, or upon error.
-*              >  0      if one or more tasks waiting on the queue are now readied and informed.
+* Returns    : See OSQPend().
 *
-* Note(s)    : none
+* Note(s)    : 1) From an ISR or before the kernel runs, the call is passed to OSQPend() without a timeout so that
+*                 it performs its usual checks.
 ************************************************************************************************************************
 */
 
-#if (OS_CFG_Q_PEND_ABORT_EN > 0u)
-OS_OBJ_QTY  OSQPendAbort (OS_Q    *p_q,
-                          OS_OPT   opt,
-                          OS_ERR  *p_err)
+#if (OS_CFG_TIME_HR_EN > 0u)
+void  *OSQPendUs (OS_Q         *p_q,
+                  CPU_INT32U    timeout_us,
+                  OS_OPT        opt,
+                  OS_MSG_SIZE  *p_msg_size,
+                  CPU_TS       *p_ts,
+                  OS_ERR       *p_err)
 {
-    OS_PEND_LIST  *p_pend_list;
-    OS_TCB        *p_tcb;
-    CPU_TS         ts;
-    OS_OBJ_QTY     nbr_tasks;
-    CPU_SR_ALLOC();
+    void       *p_void;
+    CPU_TS      dly;
 
 
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == (OS_ERR *)0) {
         OS_SAFETY_CRITICAL_EXCEPTION();
-        return (0u);
-    }
-#endif
-
-#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
-    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to Pend Abort from an ISR                */
-       *p_err =  OS_ERR_PEND_ABORT_ISR;
-        return (0u);
-    }
-#endif
-
-#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
-    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
-       *p_err = OS_ERR_OS_NOT_RUNNING;
-        return (0u);
-    }
-#endif
-
-#if (OS_CFG_ARG_CHK_EN > 0u)
-    if (p_q == (OS_Q *)0) {                                     /* Validate 'p_q'                                       */
-       *p_err =  OS_ERR_OBJ_PTR_NULL;
-        return (0u);
-    }
-    switch (opt) {                                              /* Validate 'opt'                                       */
-        case OS_OPT_PEND_ABORT_1:
-        case OS_OPT_PEND_ABORT_ALL:
-        case OS_OPT_PEND_ABORT_1   | OS_OPT_POST_NO_SCHED:
-        case OS_OPT_PEND_ABORT_ALL | OS_OPT_POST_NO_SCHED:
-             break;
-
-        default:
-            *p_err =  OS_ERR_OPT_INVALID;
-             return (0u);
-    }
-#endif
-
-#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
-    if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure queue was created                          */
-       *p_err =  OS_ERR_OBJ_TYPE;
-        return (0u);
+        return ((void *)0);
     }
 #endif
 
-    CPU_CRITICAL_ENTER();
-    p_pend_list = &p_q->PendList;
-    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on queue?                           */
-        CPU_CRITICAL_EXIT();                                    /* No                                                   */
-       *p_err =  OS_ERR_PEND_ABORT_NONE;
-        return (0u);
+    if ((timeout_us      ==                   0u) ||            /* Without a timeout, the regular pend does it all      */
+        (OSIntNestingCtr >                    0u) ||
+        (OSRunning       != OS_STATE_OS_RUNNING)) {
+        return (OSQPend(p_q, 0u, opt, p_msg_size, p_ts, p_err));
     }
 
-    nbr_tasks = 0u;
-#if (OS_CFG_TS_EN > 0u)
-    ts        = OS_TS_GET();                                    /* Get local time stamp so all tasks get the same time  */
-#else
-    ts        = 0u;
-#endif
-    while (p_pend_list->HeadPtr != (OS_TCB *)0) {
-        p_tcb = p_pend_list->HeadPtr;
-        OS_PendAbort(p_tcb,
-                     ts,
-                     OS_STATUS_PEND_ABORT);
-        nbr_tasks++;
-        if (opt != OS_OPT_PEND_ABORT_ALL) {                     /* Pend abort all tasks waiting?                        */
-            break;                                              /* No                                                   */
-        }
+    dly = OS_TickHrUsToTS(timeout_us);
+    if ((dly == 0u) || (dly > OS_TICK_HR_DLY_MAX)) {
+       *p_err = OS_ERR_TIME_INVALID_MICROSECONDS;
+        return ((void *)0);
     }
-    CPU_CRITICAL_EXIT();
 
-    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
-        OSSched();                                              /* Run the scheduler                                    */
-    }
+    OSTCBCurPtr->TickHrDly = dly;                               /* OS_TaskBlock() uses it instead of the tick timeout   */
+    p_void = OSQPend(p_q, 1u, opt, p_msg_size, p_ts, p_err);
+    OSTCBCurPtr->TickHrDly = 0u;                                /* Clear it in case the task did not have to wait       */
 
-   *p_err = OS_ERR_NONE;
-    return (nbr_tasks);
+    return (p_void);
 }
 #endif
 
 
 /*
 ************************************************************************************************************************
-*                                               POST MESSAGE TO A QUEUE
+*                                       PEND ON A QUEUE FOR A BATCH OF MESSAGES
 *
-* Description: This function sends a message to a queue.  With the 'opt' argument, you can specify whether the message
-*              is broadcast to all waiting tasks and/or whether you post the message to the front of the queue (LIFO)
-*              or normally (FIFO) at the end of the queue.
+* Description: This function waits for messages to be sent to a queue and retrieves as many of them as are available,
+*              up to 'nbr_max', in a single call.  The calling task only blocks if the queue is empty.
 *
-* Arguments  : p_q           is a pointer to a message queue that must have been created by OSQCreate().
+* Arguments  : p_q           is a pointer to the message queue
 *
-*              p_void        is a pointer to the message to send.
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for a
+*                            message to arrive at the queue up to the amount of time specified by this argument.  If you
+*                            specify 0, however, your task will wait forever at the specified queue or, until a message
+*                            arrives.
 *
-*              msg_size      specifies the size of the message (in bytes)
+*              opt           determines whether the user wants to block if the queue is empty or not:
 *
-*              opt           determines the type of POST performed:
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
 *
-*                                OS_OPT_POST_ALL          POST to ALL tasks that are waiting on the queue.  This option
-*                                                         can be added to either OS_OPT_POST_FIFO or OS_OPT_POST_LIFO
-*                                OS_OPT_POST_FIFO         POST message to end of queue (FIFO) and wake up a single
-*                                                         waiting task.
-*                                OS_OPT_POST_LIFO         POST message to the front of the queue (LIFO) and wake up
-*                                                         a single waiting task.
-*                                OS_OPT_POST_NO_SCHED     Do not call the scheduler
+*                            Add OS_OPT_PEND_ABS to make 'timeout' the value of OSTickCtr at which to give up.
+*
+*              p_msg_tbl     is a pointer to an array of at least 'nbr_max' entries that will receive the pointer
+*                            ('.MsgPtr') and size ('.MsgSize') of each message received, oldest first.
+*
+*              nbr_max       is the maximum number of messages to receive
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp of when the first message was
+*                            posted, pend aborted or the message queue deleted.  If you pass a NULL pointer (i.e.
+*                            (CPU_TS *)0) then you will not get the timestamp.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and your task received messages
+*                                OS_ERR_OBJ_DEL            If 'p_q' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If you pass a NULL pointer for 'p_q'
+*                                OS_ERR_OBJ_TYPE           If the message queue was not created
+*                                OS_ERR_OPT_INVALID        You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         The pend was aborted
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the queue was empty
+*                                OS_ERR_PTR_INVALID        If you passed a NULL pointer for 'p_msg_tbl'
+*                                OS_ERR_Q_SIZE             If 'nbr_max' is 0
+*                                OS_ERR_SCHED_LOCKED       The scheduler is locked
+*                                OS_ERR_STATUS_INVALID     If the pend status has an invalid value
+*                                OS_ERR_TIMEOUT            A message was not received within the specified timeout
+*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*
+* Returns    : The number of messages placed in 'p_msg_tbl' (0 upon error)
+*
+* Note(s)    : 1) The OS_MSGs of all the messages received are returned to the OS_MSG pool together.
+*
+*              2) This API 'MUST NOT' be called from a timer callback function.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_PEND_N_EN > 0u)
+OS_MSG_QTY  OSQPendN (OS_Q          *p_q,
+                      OS_TICK        timeout,
+                      OS_OPT         opt,
+                      OS_MSG_ENTRY  *p_msg_tbl,
+                      OS_MSG_QTY     nbr_max,
+                      CPU_TS        *p_ts,
+                      OS_ERR        *p_err)
+{
+    OS_MSG_QTY  qty;
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+    OS_OBJ_QTY  nbr_rdy;
+#endif
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+    OS_TRACE_Q_PEND_ENTER(p_q, timeout, opt, (OS_MSG_SIZE *)0, p_ts);
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        OS_TRACE_Q_PEND_FAILED(p_q);
+        OS_TRACE_Q_PEND_EXIT(OS_ERR_TICK_DISABLED);
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != OS_OPT_PEND_NON_BLOCKING) {
+            OS_TRACE_Q_PEND_FAILED(p_q);
+            OS_TRACE_Q_PEND_EXIT(OS_ERR_PEND_ISR);
+           *p_err = OS_ERR_PEND_ISR;
+            return (0u);
+        }
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+        OS_TRACE_Q_PEND_EXIT(OS_ERR_OS_NOT_RUNNING);
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_q == (OS_Q *)0) {                                     /* Validate arguments                                   */
+        OS_TRACE_Q_PEND_FAILED(p_q);
+        OS_TRACE_Q_PEND_EXIT(OS_ERR_OBJ_PTR_NULL);
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    if (p_msg_tbl == (OS_MSG_ENTRY *)0) {
+        OS_TRACE_Q_PEND_FAILED(p_q);
+        OS_TRACE_Q_PEND_EXIT(OS_ERR_PTR_INVALID);
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    if (nbr_max == 0u) {
+        OS_TRACE_Q_PEND_FAILED(p_q);
+        OS_TRACE_Q_PEND_EXIT(OS_ERR_Q_SIZE);
+       *p_err = OS_ERR_Q_SIZE;
+        return (0u);
+    }
+    switch (opt & (OS_OPT)~OS_OPT_PEND_ABS) {
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+             OS_TRACE_Q_PEND_FAILED(p_q);
+             OS_TRACE_Q_PEND_EXIT(OS_ERR_OPT_INVALID);
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure message queue was created                  */
+        OS_TRACE_Q_PEND_FAILED(p_q);
+        OS_TRACE_Q_PEND_EXIT(OS_ERR_OBJ_TYPE);
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts = 0u;                                              /* Initialize the returned timestamp                    */
+    }
+
+    CPU_CRITICAL_ENTER();
+    qty = OS_MsgQGetN(&p_q->MsgQ,                               /* Any messages waiting in the message queue?           */
+                      p_msg_tbl,
+                      nbr_max,
+                      p_ts);
+    if (qty > 0u) {
+        OS_TRACE_Q_PEND(p_q);
+        OS_OBJ_STAT_INC(&p_q->PendList, PendCtr);
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+        nbr_rdy = OS_QSpaceWake(p_q);                           /* Queue the messages of the waiting senders            */
+        CPU_CRITICAL_EXIT();
+        if (nbr_rdy > 0u) {
+            OSSched();                                          /* Run the scheduler                                    */
+        }
+#else
+        CPU_CRITICAL_EXIT();
+#endif
+       *p_err = OS_ERR_NONE;
+        OS_TRACE_Q_PEND_EXIT(OS_ERR_NONE);
+        return (qty);                                           /* Yes, Return messages received                        */
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+        CPU_CRITICAL_EXIT();
+        OS_TRACE_Q_PEND_FAILED(p_q);
+        OS_TRACE_Q_PEND_EXIT(OS_ERR_PEND_WOULD_BLOCK);
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                        /* No                                                   */
+        return (0u);
+    } else {
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+            OS_TRACE_Q_PEND_FAILED(p_q);
+            OS_TRACE_Q_PEND_EXIT(OS_ERR_SCHED_LOCKED);
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return (0u);
+        }
+    }
+
+    OS_PEND_ABS_SET(OSTCBCurPtr, opt);
+    OS_Pend((OS_PEND_OBJ *)((void *)p_q),                       /* Block task pending on Message Queue                  */
+            OSTCBCurPtr,
+            OS_TASK_PEND_ON_Q,
+            timeout);
+    CPU_CRITICAL_EXIT();
+    OS_TRACE_Q_PEND_BLOCK(p_q);
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+    nbr_rdy = 0u;
+#endif
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* Extract message from TCB (Put there by Post)         */
+             p_msg_tbl[0].MsgPtr  = OSTCBCurPtr->MsgPtr;
+             p_msg_tbl[0].MsgSize = OSTCBCurPtr->MsgSize;
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts  != (CPU_TS *)0) {
+                *p_ts  =  OSTCBCurPtr->TS;
+             }
+#endif
+             qty = 1u + OS_MsgQGetN(&p_q->MsgQ,                 /* Also collect what was queued after this message      */
+                                    &p_msg_tbl[1],
+                                    nbr_max - 1u,
+                                    (CPU_TS *)0);
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+             if (qty > 1u) {
+                 nbr_rdy = OS_QSpaceWake(p_q);
+             }
+#endif
+             OS_TRACE_Q_PEND(p_q);
+            *p_err = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts  != (CPU_TS *)0) {
+                *p_ts  =  OSTCBCurPtr->TS;
+             }
+#endif
+             OS_TRACE_Q_PEND_FAILED(p_q);
+            *p_err = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that we didn't get event within TO          */
+             OS_TRACE_Q_PEND_FAILED(p_q);
+            *p_err = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts  != (CPU_TS *)0) {
+                *p_ts  =  OSTCBCurPtr->TS;
+             }
+#endif
+             OS_TRACE_Q_PEND_FAILED(p_q);
+            *p_err = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+             OS_TRACE_Q_PEND_FAILED(p_q);
+            *p_err = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+    if (nbr_rdy > 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+#endif
+    OS_TRACE_Q_PEND_EXIT(*p_err);
+    return (qty);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                             ABORT WAITING ON A MESSAGE QUEUE
+*
+* Description: This function aborts & readies any tasks currently waiting on a queue.  This function should be used to
+*              fault-abort the wait on the queue, rather than to normally signal the queue via OSQPost().
+*
+* Arguments  : p_q       is a pointer to the message queue
+*
+*              opt       determines the type of ABORT performed:
+*
+*                            OS_OPT_PEND_ABORT_1          ABORT wait for a single task (HPT) waiting on the queue
+*                            OS_OPT_PEND_ABORT_ALL        ABORT wait for ALL tasks that are  waiting on the queue
+*                            OS_OPT_POST_NO_SCHED         Do not call the scheduler
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                  At least one task waiting on the queue was readied and
+*                                                         informed of the aborted wait; check return value for the
+*                                                         number of tasks whose wait on the queue was aborted
+*                            OS_ERR_OBJ_PTR_NULL          If you pass a NULL pointer for 'p_q'
+*                            OS_ERR_OBJ_TYPE              If the message queue was not created
+*                            OS_ERR_OPT_INVALID           You specified an invalid option
+*                            OS_ERR_OS_NOT_RUNNING        If uC/OS-III is not running yet
+*                            OS_ERR_PEND_ABORT_ISR        If this function was called from an ISR
+*                            OS_ERR_PEND_ABORT_NONE       No task were pending
+*
+* Returns    : == 0      if no tasks were waiting on the queue, or upon error.
+*              >  0      if one or more tasks waiting on the queue are now readied and informed.
+*
+* Note(s)    : 1) When no task waits for a message, the tasks blocked in OSQPostWait() are aborted instead.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_PEND_ABORT_EN > 0u)
+OS_OBJ_QTY  OSQPendAbort (OS_Q    *p_q,
+                          OS_OPT   opt,
+                          OS_ERR  *p_err)
+{
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    CPU_TS         ts;
+    OS_OBJ_QTY     nbr_tasks;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to Pend Abort from an ISR                */
+       *p_err =  OS_ERR_PEND_ABORT_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_q == (OS_Q *)0) {                                     /* Validate 'p_q'                                       */
+       *p_err =  OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_PEND_ABORT_1:
+        case OS_OPT_PEND_ABORT_ALL:
+        case OS_OPT_PEND_ABORT_1   | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_PEND_ABORT_ALL | OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err =  OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure queue was created                          */
+       *p_err =  OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_q->PendList;
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+    if (OS_PEND_LIST_HEAD(p_pend_list) == (OS_TCB *)0) {        /* No receiver, abort the senders waiting for room      */
+        p_pend_list = &p_q->SpacePendObj.PendList;
+    }
+#endif
+    if (OS_PEND_LIST_HEAD(p_pend_list) == (OS_TCB *)0) {        /* Any task waiting on queue?                           */
+        CPU_CRITICAL_EXIT();                                    /* No                                                   */
+       *p_err =  OS_ERR_PEND_ABORT_NONE;
+        return (0u);
+    }
+
+    nbr_tasks = 0u;
+#if (OS_CFG_TS_EN > 0u)
+    ts        = OS_TS_GET();                                    /* Get local time stamp so all tasks get the same time  */
+#else
+    ts        = 0u;
+#endif
+    p_tcb = OS_PEND_LIST_HEAD(p_pend_list);
+    while (p_tcb != (OS_TCB *)0) {
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+        OS_PendMultiRdy((OS_PEND_OBJ *)((void *)p_q),
+                        p_tcb,
+                        (void *)0,
+                        0u,
+                        ts);
+#endif
+        OS_PendAbort(p_tcb,
+                     ts,
+                     OS_STATUS_PEND_ABORT);
+        nbr_tasks++;
+        if (opt != OS_OPT_PEND_ABORT_ALL) {                     /* Pend abort all tasks waiting?                        */
+            break;                                              /* No                                                   */
+        }
+        p_tcb = OS_PEND_LIST_HEAD(p_pend_list);
+    }
+    CPU_CRITICAL_EXIT();
+
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+
+   *p_err = OS_ERR_NONE;
+    return (nbr_tasks);
+}
+#endif
+
+
+
+/*
+************************************************************************************************************************
+*                                       PEND ON A QUEUE FOR A MATCHING MESSAGE
+*
+* Description: This function waits for a message for which a match function returns OS_TRUE, e.g. the reply carrying a
+*              given transaction ID.  The messages that don't match are left in the queue, in the same order, for the
+*              other receivers.
+*
+* Arguments  : p_q           is a pointer to the message queue
+*
+*              p_fnct        is a pointer to the match function.  It is called with the message, its size and 'p_arg' and
+*                            returns OS_TRUE to accept the message.
+*
+*              p_arg         is the argument passed to 'p_fnct', e.g. a pointer to the key to match
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for a
+*                            matching message up to the amount of time specified by this argument.  If you specify 0,
+*                            however, your task will wait forever or, until a matching message arrives.
+*
+*              opt           determines whether the user wants to block if no message matches:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*                            Add OS_OPT_PEND_ABS to make 'timeout' the value of OSTickCtr at which to give up.
+*
+*              p_msg_size    is a pointer to a variable that will receive the size of the message
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp of when the message was
+*                            received, pend aborted or the message queue deleted.  If you pass a NULL pointer (i.e.
+*                            (CPU_TS *)0) then you will not get the timestamp.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and your task received a message
+*                                OS_ERR_OBJ_DEL            If 'p_q' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If you pass a NULL pointer for 'p_q'
+*                                OS_ERR_OBJ_TYPE           If the message queue was not created
+*                                OS_ERR_OPT_INVALID        You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         The pend was aborted
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but no message matched
+*                                OS_ERR_PTR_INVALID        If you passed a NULL pointer for 'p_fnct' or 'p_msg_size'
+*                                OS_ERR_SCHED_LOCKED       The scheduler is locked
+*                                OS_ERR_STATUS_INVALID     If the pend status has an invalid value
+*                                OS_ERR_TIMEOUT            No matching message was received within the timeout
+*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*
+* Returns    : != (void *)0  is a pointer to the message received
+*              == (void *)0  if you received a NULL pointer message or,
+*                            if no message was received
+*
+* Note(s)    : 1) 'p_fnct' is called with interrupts disabled, by this function for each queued message and by the
+*                 posts for each message sent while the task waits.  It MUST be short and MUST NOT call uC/OS-III.
+*
+*              2) See OS_Q Note #3 in os.h.
+*
+*              3) This API 'MUST NOT' be called from a timer callback function.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_PEND_MATCH_EN > 0u)
+void  *OSQPendMatch (OS_Q             *p_q,
+                     OS_Q_MATCH_FNCT   p_fnct,
+                     void             *p_arg,
+                     OS_TICK           timeout,
+                     OS_OPT            opt,
+                     OS_MSG_SIZE      *p_msg_size,
+                     CPU_TS           *p_ts,
+                     OS_ERR           *p_err)
+{
+    void        *p_void;
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+    OS_OBJ_QTY   nbr_rdy;
+#endif
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((void *)0);
+    }
+#endif
+
+    OS_TRACE_Q_PEND_ENTER(p_q, timeout, opt, p_msg_size, p_ts);
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        OS_TRACE_Q_PEND_FAILED(p_q);
+        OS_TRACE_Q_PEND_EXIT(OS_ERR_TICK_DISABLED);
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != OS_OPT_PEND_NON_BLOCKING) {
+            OS_TRACE_Q_PEND_FAILED(p_q);
+            OS_TRACE_Q_PEND_EXIT(OS_ERR_PEND_ISR);
+           *p_err = OS_ERR_PEND_ISR;
+            return ((void *)0);
+        }
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+        OS_TRACE_Q_PEND_EXIT(OS_ERR_OS_NOT_RUNNING);
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_q == (OS_Q *)0) {                                     /* Validate arguments                                   */
+        OS_TRACE_Q_PEND_FAILED(p_q);
+        OS_TRACE_Q_PEND_EXIT(OS_ERR_OBJ_PTR_NULL);
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return ((void *)0);
+    }
+    if ((p_fnct     == (OS_Q_MATCH_FNCT)0) ||
+        (p_msg_size == (OS_MSG_SIZE   *)0)) {
+        OS_TRACE_Q_PEND_FAILED(p_q);
+        OS_TRACE_Q_PEND_EXIT(OS_ERR_PTR_INVALID);
+       *p_err = OS_ERR_PTR_INVALID;
+        return ((void *)0);
+    }
+    switch (opt & (OS_OPT)~OS_OPT_PEND_ABS) {
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+             OS_TRACE_Q_PEND_FAILED(p_q);
+             OS_TRACE_Q_PEND_EXIT(OS_ERR_OPT_INVALID);
+            *p_err = OS_ERR_OPT_INVALID;
+             return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure message queue was created                  */
+        OS_TRACE_Q_PEND_FAILED(p_q);
+        OS_TRACE_Q_PEND_EXIT(OS_ERR_OBJ_TYPE);
+       *p_err = OS_ERR_OBJ_TYPE;
+        return ((void *)0);
+    }
+#endif
+
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts = 0u;                                              /* Initialize the returned timestamp                    */
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_void = OS_MsgQGetMatch(&p_q->MsgQ,                        /* Any matching message waiting in the queue?           */
+                             p_fnct,
+                             p_arg,
+                             p_msg_size,
+                             p_ts,
+                             p_err);
+    if (*p_err == OS_ERR_NONE) {
+        OS_TRACE_Q_PEND(p_q);
+        OS_OBJ_STAT_INC(&p_q->PendList, PendCtr);
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+        nbr_rdy = OS_QSpaceWake(p_q);                           /* Queue the message of a waiting sender                */
+        CPU_CRITICAL_EXIT();
+        if (nbr_rdy > 0u) {
+            OSSched();                                          /* Run the scheduler                                    */
+        }
+#else
+        CPU_CRITICAL_EXIT();
+#endif
+        OS_TRACE_Q_PEND_EXIT(OS_ERR_NONE);
+        return (p_void);                                        /* Yes, Return message received                         */
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+        CPU_CRITICAL_EXIT();
+        OS_TRACE_Q_PEND_FAILED(p_q);
+        OS_TRACE_Q_PEND_EXIT(OS_ERR_PEND_WOULD_BLOCK);
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                        /* No                                                   */
+        return ((void *)0);
+    } else {
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+            OS_TRACE_Q_PEND_FAILED(p_q);
+            OS_TRACE_Q_PEND_EXIT(OS_ERR_SCHED_LOCKED);
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return ((void *)0);
+        }
+    }
+
+    OSTCBCurPtr->QMatchFnct = p_fnct;                           /* Tell the posts which messages we accept              */
+    OSTCBCurPtr->QMatchArg  = p_arg;
+    OS_PEND_ABS_SET(OSTCBCurPtr, opt);
+    OS_Pend((OS_PEND_OBJ *)((void *)p_q),                       /* Block task pending on Message Queue                  */
+            OSTCBCurPtr,
+            OS_TASK_PEND_ON_Q,
+            timeout);
+    CPU_CRITICAL_EXIT();
+    OS_TRACE_Q_PEND_BLOCK(p_q);
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    OSTCBCurPtr->QMatchFnct = (OS_Q_MATCH_FNCT)0;               /* Accept any message in the next OSQPend()             */
+    OSTCBCurPtr->QMatchArg  = (void *)0;
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* Extract message from TCB (Put there by Post)         */
+             p_void     = OSTCBCurPtr->MsgPtr;
+            *p_msg_size = OSTCBCurPtr->MsgSize;
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts  != (CPU_TS *)0) {
+                *p_ts  =  OSTCBCurPtr->TS;
+             }
+#endif
+             OS_TRACE_Q_PEND(p_q);
+            *p_err      = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+             p_void     = (void *)0;
+            *p_msg_size =         0u;
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts  != (CPU_TS *)0) {
+                *p_ts  =  OSTCBCurPtr->TS;
+             }
+#endif
+             OS_TRACE_Q_PEND_FAILED(p_q);
+            *p_err      = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that we didn't get event within TO          */
+             p_void     = (void *)0;
+            *p_msg_size =         0u;
+             OS_TRACE_Q_PEND_FAILED(p_q);
+            *p_err      = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+             p_void     = (void *)0;
+            *p_msg_size =         0u;
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts  != (CPU_TS *)0) {
+                *p_ts  =  OSTCBCurPtr->TS;
+             }
+#endif
+             OS_TRACE_Q_PEND_FAILED(p_q);
+            *p_err      = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+             p_void     = (void *)0;
+            *p_msg_size =         0u;
+             OS_TRACE_Q_PEND_FAILED(p_q);
+            *p_err      = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+    OS_TRACE_Q_PEND_EXIT(*p_err);
+    return (p_void);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                               POST MESSAGE TO A QUEUE
+*
+* Description: This function sends a message to a queue.  With the 'opt' argument, you can specify whether the message
+*              is broadcast to all waiting tasks and/or whether you post the message to the front of the queue (LIFO)
+*              or normally (FIFO) at the end of the queue.
+*
+* Arguments  : p_q           is a pointer to a message queue that must have been created by OSQCreate().
+*
+*              p_void        is a pointer to the message to send.
+*
+*              msg_size      specifies the size of the message (in bytes)
+*
+*              opt           determines the type of POST performed:
+*
+*                                OS_OPT_POST_ALL          POST to ALL tasks that are waiting on the queue.  This option
+*                                                         can be added to either OS_OPT_POST_FIFO or OS_OPT_POST_LIFO
+*                                OS_OPT_POST_FIFO         POST message to end of queue (FIFO) and wake up a single
+*                                                         waiting task.
+*                                OS_OPT_POST_LIFO         POST message to the front of the queue (LIFO) and wake up
+*                                                         a single waiting task.
+*                                OS_OPT_POST_NO_SCHED     Do not call the scheduler
+*                                OS_OPT_POST_PRIO(lvl)    Queue the message at priority level 'lvl' (see Note #3 below)
+*
+*                            Note(s): 1) OS_OPT_POST_NO_SCHED can be added (or OR'd) with one of the other options.
+*                                     2) OS_OPT_POST_ALL      can be added (or OR'd) with one of the other options.
+*                                     3) Possible combination of options are:
+*
+*                                        OS_OPT_POST_FIFO
+*                                        OS_OPT_POST_LIFO
+*                                        OS_OPT_POST_FIFO + OS_OPT_POST_ALL
+*                                        OS_OPT_POST_LIFO + OS_OPT_POST_ALL
+*                                        OS_OPT_POST_FIFO + OS_OPT_POST_NO_SCHED
+*                                        OS_OPT_POST_LIFO + OS_OPT_POST_NO_SCHED
+*                                        OS_OPT_POST_FIFO + OS_OPT_POST_ALL + OS_OPT_POST_NO_SCHED
+*                                        OS_OPT_POST_LIFO + OS_OPT_POST_ALL + OS_OPT_POST_NO_SCHED
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              The call was successful and the message was sent
+*                                OS_ERR_MSG_POOL_EMPTY    If there are no more OS_MSGs to use to place the message into
+*                                OS_ERR_OBJ_PTR_NULL      If 'p_q' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE          If the message queue was not initialized
+*                                OS_ERR_OPT_INVALID       You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*                                OS_ERR_Q_MAX             If the queue is full
+*                                OS_ERR_INT_Q_FULL        If the post was deferred and the ISR queue is full
+*
+* Returns    : None
+*
+* Note(s)    : 1) When OS_CFG_POST_ALL_INT_EN is enabled, OS_OPT_POST_ALL hands the message to the waiting tasks one at a
+*                 time with the scheduler locked, and interrupts are re-enabled between two tasks (see OS_PostAll()).
+*                 This does not apply when OS_CFG_Q_PEND_MATCH_EN is enabled, the message then only being handed to
+*                 the waiting tasks that accept it (see OSQPendMatch()).
+*
+*              2) When OS_CFG_ISR_POST_DEFERRED_EN is enabled and this function is called from an ISR, the message is
+*                 placed in the queue by the ISR handler task.  OS_ERR_Q_MAX is then not reported to the ISR.
+*
+*              3) When OS_CFG_Q_PRIO_EN is enabled, OS_OPT_POST_PRIO(lvl) can be added to any of the combinations above,
+*                 'lvl' ranging from 0 (the default, least urgent) to OS_CFG_Q_PRIO_LVL_NBR - 1.  OSQPend() returns the
+*                 queued messages of the highest level first; FIFO and LIFO then only apply among messages of the same
+*                 level.
+*
+*              4) When OS_CFG_MEM_BUF_EN is enabled, OS_OPT_POST_MEM_BUF_REF can be added to any of the combinations
+*                 above when 'p_void' was obtained with OSMemBufGet().  A reference to the buffer is added for the
+*                 message queued or for each task readied, and the caller keeps its own reference (see OSMemBufRef()).
+*                 Without this option, the reference of the caller is handed to the receiver.  OS_CFG_POST_ALL_INT_EN
+*                 does not apply to such a post, the waiting tasks being readied in a single critical section.
+************************************************************************************************************************
+*/
+
+void  OSQPost (OS_Q         *p_q,
+               void         *p_void,
+               OS_MSG_SIZE   msg_size,
+               OS_OPT        opt,
+               OS_ERR       *p_err)
+{
+    CPU_TS   ts;
+#if (OS_CFG_MEM_BUF_EN > 0u) && (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    OS_ERR   err;
+#endif
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    OS_TRACE_Q_POST_ENTER(p_q, p_void, msg_size, opt);
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+        OS_TRACE_Q_POST_EXIT(OS_ERR_OS_NOT_RUNNING);
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_q == (OS_Q *)0) {                                     /* Validate 'p_q'                                       */
+        OS_TRACE_Q_POST_FAILED(p_q);
+        OS_TRACE_Q_POST_EXIT(OS_ERR_OBJ_PTR_NULL);
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#if (OS_CFG_Q_PRIO_EN > 0u)
+    if (OS_OPT_POST_PRIO_GET(opt) >= OS_CFG_Q_PRIO_LVL_NBR) {   /* Validate the message priority level                  */
+        OS_TRACE_Q_POST_FAILED(p_q);
+        OS_TRACE_Q_POST_EXIT(OS_ERR_OPT_INVALID);
+       *p_err = OS_ERR_OPT_INVALID;
+        return;
+    }
+#endif
+    switch (opt & (OS_OPT)~(OS_OPT)(OS_OPT_POST_PRIO_MASK | OS_OPT_POST_MEM_BUF_REF)) { /* Validate 'opt'               */
+        case OS_OPT_POST_FIFO:
+        case OS_OPT_POST_LIFO:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_ALL:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_ALL:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_FIFO | (OS_OPT)(OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED):
+        case OS_OPT_POST_LIFO | (OS_OPT)(OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED):
+             break;
+
+        default:
+             OS_TRACE_Q_POST_FAILED(p_q);
+             OS_TRACE_Q_POST_EXIT(OS_ERR_OPT_INVALID);
+            *p_err =  OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure message queue was created                  */
+        OS_TRACE_Q_POST_FAILED(p_q);
+        OS_TRACE_Q_POST_EXIT(OS_ERR_OBJ_TYPE);
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Defer the post when called from an ISR               */
+#if (OS_CFG_MEM_BUF_EN > 0u)
+        if ((opt & OS_OPT_POST_MEM_BUF_REF) != 0u) {            /* Keep the buffer until the post is performed          */
+            (void)OS_MemBufRefAdd(p_void);
+        }
+#endif
+        OS_IntQPost(OS_OBJ_TYPE_Q,
+                    (void *)p_q,
+                    p_void,
+                    msg_size,
+                    0u,
+                    opt,
+                    p_err);
+#if (OS_CFG_MEM_BUF_EN > 0u)
+        if (((opt & OS_OPT_POST_MEM_BUF_REF) != 0u) &&
+            (*p_err != OS_ERR_NONE)) {
+            OSMemBufRelease(p_void, &err);
+        }
+#endif
+        OS_TRACE_Q_POST_EXIT(*p_err);
+        return;
+    }
+#endif
+
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    OS_QPost(p_q, p_void, msg_size, opt, ts, p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                          POST MESSAGE TO A QUEUE FROM AN ISR
+*
+* Description: This function is the same as OSQPost() but is only called from an ISR.  It does not check whether the
+*              kernel is running and never calls the scheduler: the context switch, if any, is left to OSIntExit().
+*
+* Arguments  : p_q           is a pointer to a message queue that must have been created by OSQCreate().
+*
+*              p_void        is a pointer to the message to send.
+*
+*              msg_size      specifies the size of the message (in bytes)
+*
+*              opt           determines the type of POST performed (see OSQPost()).  OS_OPT_POST_NO_SCHED is implied.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function (see
+*                            OSQPost())
+*
+* Returns    : None
+*
+* Note(s)    : 1) This function MUST only be called from an ISR, between OSIntEnter() and OSIntExit().
+*
+*              2) When OS_CFG_ISR_POST_DEFERRED_EN is enabled, the message is placed in the queue by the ISR handler
+*                 task (see OSQPost(), Note #2).
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_POST_FROM_ISR_EN > 0u)
+void  OSQPostFromISR (OS_Q         *p_q,
+                      void         *p_void,
+                      OS_MSG_SIZE   msg_size,
+                      OS_OPT        opt,
+                      OS_ERR       *p_err)
+{
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+#if (OS_CFG_MEM_BUF_EN > 0u)
+    OS_ERR   err;
+#endif
+#else
+    CPU_TS   ts;
+#endif
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    OS_TRACE_Q_POST_ENTER(p_q, p_void, msg_size, opt);
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_q == (OS_Q *)0) {                                     /* Validate 'p_q'                                       */
+        OS_TRACE_Q_POST_FAILED(p_q);
+        OS_TRACE_Q_POST_EXIT(OS_ERR_OBJ_PTR_NULL);
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#if (OS_CFG_Q_PRIO_EN > 0u)
+    if (OS_OPT_POST_PRIO_GET(opt) >= OS_CFG_Q_PRIO_LVL_NBR) {   /* Validate the message priority level                  */
+        OS_TRACE_Q_POST_FAILED(p_q);
+        OS_TRACE_Q_POST_EXIT(OS_ERR_OPT_INVALID);
+       *p_err = OS_ERR_OPT_INVALID;
+        return;
+    }
+#endif
+    switch (opt & (OS_OPT)~(OS_OPT)(OS_OPT_POST_PRIO_MASK | OS_OPT_POST_MEM_BUF_REF | OS_OPT_POST_NO_SCHED)) {
+        case OS_OPT_POST_FIFO:                                  /* Validate 'opt'                                       */
+        case OS_OPT_POST_LIFO:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_ALL:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_ALL:
+             break;
+
+        default:
+             OS_TRACE_Q_POST_FAILED(p_q);
+             OS_TRACE_Q_POST_EXIT(OS_ERR_OPT_INVALID);
+            *p_err =  OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure message queue was created                  */
+        OS_TRACE_Q_POST_FAILED(p_q);
+        OS_TRACE_Q_POST_EXIT(OS_ERR_OBJ_TYPE);
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+#if (OS_CFG_MEM_BUF_EN > 0u)
+    if ((opt & OS_OPT_POST_MEM_BUF_REF) != 0u) {                /* Keep the buffer until the post is performed          */
+        (void)OS_MemBufRefAdd(p_void);
+    }
+#endif
+    OS_IntQPost(OS_OBJ_TYPE_Q,                                  /* See Note #2                                          */
+                (void *)p_q,
+                p_void,
+                msg_size,
+                0u,
+                opt,
+                p_err);
+#if (OS_CFG_MEM_BUF_EN > 0u)
+    if (((opt & OS_OPT_POST_MEM_BUF_REF) != 0u) &&
+        (*p_err != OS_ERR_NONE)) {
+        OSMemBufRelease(p_void, &err);
+    }
+#endif
+    OS_TRACE_Q_POST_EXIT(*p_err);
+#else
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    OS_QPost(p_q, p_void, msg_size, (OS_OPT)(opt | OS_OPT_POST_NO_SCHED), ts, p_err);
+#endif
+}
+#endif
+
+
+
+
+/*
+************************************************************************************************************************
+*                                          POST A BATCH OF MESSAGES TO A QUEUE
+*
+* Description: This function sends 'nbr_msgs' messages to a queue in a single call.  Waiting tasks are each handed one
+*              message, highest priority first, and the messages left over are placed in the queue.  The kernel is
+*              entered only once and the scheduler is run at most once, whatever the number of messages.
+*
+* Arguments  : p_q           is a pointer to a message queue that must have been created by OSQCreate().
+*
+*              p_msg_tbl     is a pointer to an array of 'nbr_msgs' message descriptors.  Each entry holds the pointer
+*                            to a message ('.MsgPtr') and its size in bytes ('.MsgSize').
+*
+*              nbr_msgs      is the number of entries in 'p_msg_tbl'
+*
+*              opt           determines the type of POST performed:
+*
+*                                OS_OPT_POST_FIFO         POST messages to end of queue (FIFO), in table order
+*                                OS_OPT_POST_LIFO         POST messages to the front of the queue (LIFO), as if each
+*                                                         entry had been posted in turn with OSQPost()
+*                                OS_OPT_POST_NO_SCHED     Do not call the scheduler
 *
 *                            Note(s): 1) OS_OPT_POST_NO_SCHED can be added (or OR'd) with one of the other options.
-*                                     2) OS_OPT_POST_ALL      can be added (or OR'd) with one of the other options.
-*                                     3) Possible combination of options are:
+*                                     2) OS_OPT_POST_ALL is not supported since each message is delivered only once.
+*                                     3) OS_OPT_POST_PRIO(lvl) can be added to queue all the messages at priority
+*                                        level 'lvl' (see OSQPost(), Note #3).
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              The call was successful and the messages were sent
+*                                OS_ERR_MSG_POOL_EMPTY    If there are not enough OS_MSGs to hold the messages
+*                                OS_ERR_OBJ_PTR_NULL      If 'p_q' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE          If the message queue was not initialized
+*                                OS_ERR_OPT_INVALID       You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*                                OS_ERR_PTR_INVALID       If 'p_msg_tbl' is a NULL pointer
+*                                OS_ERR_Q_MAX             If the queue cannot hold the messages
+*
+* Returns    : None
+*
+* Note(s)    : 1) Either all the messages are sent or, upon error, none of them are.
+*
+*              2) When OS_CFG_Q_PEND_MATCH_EN is enabled, the messages are all queued first and then handed to the
+*                 waiting tasks that accept them (see OSQPendMatch()).  The queue must then have room for the whole
+*                 batch.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_POST_N_EN > 0u)
+void  OSQPostN (OS_Q          *p_q,
+                OS_MSG_ENTRY  *p_msg_tbl,
+                OS_MSG_QTY     nbr_msgs,
+                OS_OPT         opt,
+                OS_ERR        *p_err)
+{
+    OS_OPT         post_type;
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+#if (OS_CFG_PEND_MULTI_EN > 0u) && (OS_CFG_Q_PEND_MATCH_EN == 0u)
+    OS_PEND_DATA  *p_pend_data;
+#endif
+    OS_MSG_QTY     nbr_waiting;
+    OS_MSG_QTY     i;
+    CPU_TS         ts;
+#if (OS_CFG_REACTOR_EN > 0u)
+    CPU_BOOLEAN    rdy;
+#endif
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    OS_TRACE_Q_POST_ENTER(p_q, (void *)p_msg_tbl, 0u, opt);
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+        OS_TRACE_Q_POST_EXIT(OS_ERR_OS_NOT_RUNNING);
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_q == (OS_Q *)0) {                                     /* Validate 'p_q'                                       */
+        OS_TRACE_Q_POST_FAILED(p_q);
+        OS_TRACE_Q_POST_EXIT(OS_ERR_OBJ_PTR_NULL);
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_msg_tbl == (OS_MSG_ENTRY *)0) {                       /* Validate 'p_msg_tbl'                                 */
+        OS_TRACE_Q_POST_FAILED(p_q);
+        OS_TRACE_Q_POST_EXIT(OS_ERR_PTR_INVALID);
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+#if (OS_CFG_Q_PRIO_EN > 0u)
+    if (OS_OPT_POST_PRIO_GET(opt) >= OS_CFG_Q_PRIO_LVL_NBR) {   /* Validate the message priority level                  */
+        OS_TRACE_Q_POST_FAILED(p_q);
+        OS_TRACE_Q_POST_EXIT(OS_ERR_OPT_INVALID);
+       *p_err = OS_ERR_OPT_INVALID;
+        return;
+    }
+#endif
+    switch (opt & (OS_OPT)~OS_OPT_POST_PRIO_MASK) {             /* Validate 'opt'                                       */
+        case OS_OPT_POST_FIFO:
+        case OS_OPT_POST_LIFO:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+             OS_TRACE_Q_POST_FAILED(p_q);
+             OS_TRACE_Q_POST_EXIT(OS_ERR_OPT_INVALID);
+            *p_err =  OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure message queue was created                  */
+        OS_TRACE_Q_POST_FAILED(p_q);
+        OS_TRACE_Q_POST_EXIT(OS_ERR_OBJ_TYPE);
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    if (nbr_msgs == 0u) {                                       /* Nothing to send                                      */
+        OS_TRACE_Q_POST_EXIT(OS_ERR_NONE);
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    OS_TRACE_Q_POST(p_q);
+
+    if ((opt & OS_OPT_POST_LIFO) == 0u) {                       /* Determine whether we post FIFO or LIFO               */
+        post_type = OS_OPT_POST_FIFO;
+    } else {
+        post_type = OS_OPT_POST_LIFO;
+    }
+#if (OS_CFG_Q_PRIO_EN > 0u)
+    post_type |= (OS_OPT)(opt & OS_OPT_POST_PRIO_MASK);         /* Keep the message priority level                      */
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_q->PendList;
+    OS_OBJ_STAT_INC(p_pend_list, PostCtr);
+    nbr_waiting = 0u;                                           /* Count the tasks that will get a message directly     */
+#if (OS_CFG_Q_PEND_MATCH_EN == 0u)
+    p_tcb       = p_pend_list->HeadPtr;
+    while ((p_tcb != (OS_TCB *)0) && (nbr_waiting < nbr_msgs)) {
+        nbr_waiting++;
+        p_tcb = p_tcb->PendNextPtr;
+    }
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+    p_pend_data = p_pend_list->MultiHeadPtr;                    /* ... including the tasks waiting in OSPendMulti()     */
+    while ((p_pend_data != (OS_PEND_DATA *)0) && (nbr_waiting < nbr_msgs)) {
+        nbr_waiting++;
+        p_pend_data = p_pend_data->NextPtr;
+    }
+#endif
+#endif
+
+#if (OS_CFG_REACTOR_EN > 0u)
+    rdy = OS_FALSE;
+#endif
+    if (nbr_waiting < nbr_msgs) {                               /* Queue the messages that no task is waiting for       */
+        OS_MsgQPutN(&p_q->MsgQ,
+                    &p_msg_tbl[nbr_waiting],
+                    nbr_msgs - nbr_waiting,
+                    post_type,
+                    ts,
+                    p_err);
+        if (*p_err != OS_ERR_NONE) {                            /* Nothing was sent if they don't all fit               */
+            CPU_CRITICAL_EXIT();
+            OS_TRACE_Q_POST_EXIT(*p_err);
+            return;
+        }
+#if (OS_CFG_REACTOR_EN > 0u)
+        rdy = OS_ReactorSrcRdy(p_pend_list->ReactorSrcPtr, ts);
+#endif
+    }
+
+    for (i = 0u; i < nbr_waiting; i++) {                        /* Hand one message to each waiting task                */
+        p_tcb = OS_PEND_LIST_HEAD(p_pend_list);
+        OS_Post((OS_PEND_OBJ *)((void *)p_q),
+                p_tcb,
+                p_msg_tbl[i].MsgPtr,
+                p_msg_tbl[i].MsgSize,
+                ts);
+    }
+#if (OS_CFG_Q_PEND_MATCH_EN > 0u)
+    nbr_waiting = (OS_MSG_QTY)OS_QMatchRdy(p_q);                /* Hand the messages to the tasks accepting them        */
+#endif
+
+    CPU_CRITICAL_EXIT();
+
+#if (OS_CFG_REACTOR_EN > 0u)
+    if (rdy == OS_TRUE) {                                       /* The task of the reactor was readied too              */
+        nbr_waiting++;
+    }
+#endif
+    if ((nbr_waiting > 0u) && ((opt & OS_OPT_POST_NO_SCHED) == 0u)) {
+        OSSched();                                              /* Run the scheduler once for the whole batch           */
+    }
+
+   *p_err = OS_ERR_NONE;
+    OS_TRACE_Q_POST_EXIT(*p_err);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                      POST MESSAGE TO A QUEUE, WAITING FOR ROOM
 *
-*                                        OS_OPT_POST_FIFO
-*                                        OS_OPT_POST_LIFO
-*                                        OS_OPT_POST_FIFO + OS_OPT_POST_ALL
-*                                        OS_OPT_POST_LIFO + OS_OPT_POST_ALL
-*                                        OS_OPT_POST_FIFO + OS_OPT_POST_NO_SCHED
-*                                        OS_OPT_POST_LIFO + OS_OPT_POST_NO_SCHED
-*                                        OS_OPT_POST_FIFO + OS_OPT_POST_ALL + OS_OPT_POST_NO_SCHED
-*                                        OS_OPT_POST_LIFO + OS_OPT_POST_ALL + OS_OPT_POST_NO_SCHED
+* Description: This function is the same as OSQPost() except that, if the queue is full, the calling task blocks until
+*              a receiver makes room.  The task that removes a message from the queue then places the message of the
+*              highest priority sender in the queue on its behalf and readies it, so that a full queue throttles its
+*              producers instead of rejecting their messages.
+*
+* Arguments  : p_q           is a pointer to a message queue that must have been created by OSQCreate().
+*
+*              p_void        is a pointer to the message to send.
+*
+*              msg_size      specifies the size of the message (in bytes)
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for
+*                            room up to the amount of time specified by this argument.  If you specify 0, however,
+*                            your task will wait forever or, until room is made.
+*
+*              opt           determines the type of POST performed:
+*
+*                                OS_OPT_POST_FIFO         POST message to end of queue (FIFO)
+*                                OS_OPT_POST_LIFO         POST message to the front of the queue (LIFO)
+*                                OS_OPT_POST_NO_SCHED     Do not call the scheduler when the message is handed to a
+*                                                         waiting task
+*                                OS_OPT_POST_PRIO(lvl)    Queue the message at priority level 'lvl' (see OSQPost())
 *
 *              p_err         is a pointer to a variable that will contain an error code returned by this function.
 *
 *                                OS_ERR_NONE              The call was successful and the message was sent
 *                                OS_ERR_MSG_POOL_EMPTY    If there are no more OS_MSGs to use to place the message into
+*                                OS_ERR_OBJ_DEL           If 'p_q' was deleted
 *                                OS_ERR_OBJ_PTR_NULL      If 'p_q' is a NULL pointer
 *                                OS_ERR_OBJ_TYPE          If the message queue was not initialized
 *                                OS_ERR_OPT_INVALID       You specified an invalid option
 *                                OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
-*                                OS_ERR_Q_MAX             If the queue is full
+*                                OS_ERR_PEND_ABORT        The wait was aborted
+*                                OS_ERR_PEND_ISR          If you called this function from an ISR
+*                                OS_ERR_SCHED_LOCKED      If the queue is full and the scheduler is locked
+*                                OS_ERR_STATUS_INVALID    If the pend status has an invalid value
+*                                OS_ERR_TIMEOUT           No room was made within the specified timeout
+*                                OS_ERR_TICK_DISABLED     If kernel ticks are disabled and a timeout is specified
 *
 * Returns    : None
 *
-* Note(s)    : none
+* Note(s)    : 1) OS_OPT_POST_ALL and OS_OPT_POST_MEM_BUF_REF are not accepted.
+*
+*              2) Upon OS_ERR_TIMEOUT, OS_ERR_PEND_ABORT and OS_ERR_OBJ_DEL, the message was NOT queued.
+*
+*              3) This API 'MUST NOT' be called from a timer callback function.
 ************************************************************************************************************************
 */
 
-void  OSQPost (OS_Q         *p_q,
-               void         *p_void,
-               OS_MSG_SIZE   msg_size,
-               OS_OPT        opt,
-               OS_ERR       *p_err)
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+void  OSQPostWait (OS_Q         *p_q,
+                   void         *p_void,
+                   OS_MSG_SIZE   msg_size,
+                   OS_TICK       timeout,
+                   OS_OPT        opt,
+                   OS_ERR       *p_err)
 {
-    OS_OPT         post_type;
-    OS_PEND_LIST  *p_pend_list;
-    OS_TCB        *p_tcb;
-    OS_TCB        *p_tcb_next;
-    CPU_TS         ts;
+    CPU_TS   ts;
     CPU_SR_ALLOC();
 
 
@@ -801,11 +2147,22 @@ void  OSQPost (OS_Q         *p_q,
     }
 #endif
 
-    OS_TRACE_Q_POST_ENTER(p_q, p_void, msg_size, opt);
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to block from an ISR                     */
+       *p_err = OS_ERR_PEND_ISR;
+        return;
+    }
+#endif
 
 #if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
     if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
-        OS_TRACE_Q_POST_EXIT(OS_ERR_OS_NOT_RUNNING);
        *p_err = OS_ERR_OS_NOT_RUNNING;
         return;
     }
@@ -813,88 +2170,237 @@ void  OSQPost (OS_Q         *p_q,
 
 #if (OS_CFG_ARG_CHK_EN > 0u)
     if (p_q == (OS_Q *)0) {                                     /* Validate 'p_q'                                       */
-        OS_TRACE_Q_POST_FAILED(p_q);
-        OS_TRACE_Q_POST_EXIT(OS_ERR_OBJ_PTR_NULL);
        *p_err = OS_ERR_OBJ_PTR_NULL;
         return;
     }
-    switch (opt) {                                              /* Validate 'opt'                                       */
-        case OS_OPT_POST_FIFO:
-        case OS_OPT_POST_LIFO:
-        case OS_OPT_POST_FIFO | OS_OPT_POST_ALL:
-        case OS_OPT_POST_LIFO | OS_OPT_POST_ALL:
-        case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
-        case OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED:
-        case OS_OPT_POST_FIFO | (OS_OPT)(OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED):
-        case OS_OPT_POST_LIFO | (OS_OPT)(OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED):
-             break;
-
-        default:
-             OS_TRACE_Q_POST_FAILED(p_q);
-             OS_TRACE_Q_POST_EXIT(OS_ERR_OPT_INVALID);
-            *p_err =  OS_ERR_OPT_INVALID;
-             return;
-    }
+#if (OS_CFG_Q_PRIO_EN > 0u)
+    if (OS_OPT_POST_PRIO_GET(opt) >= OS_CFG_Q_PRIO_LVL_NBR) {   /* Validate the message priority level                  */
+       *p_err = OS_ERR_OPT_INVALID;
+        return;
+    }
+#endif
+    switch (opt & (OS_OPT)~(OS_OPT)OS_OPT_POST_PRIO_MASK) {     /* Validate 'opt'                                       */
+        case OS_OPT_POST_FIFO:
+        case OS_OPT_POST_LIFO:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure message queue was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    for (;;) {
+        OS_TRACE_Q_POST_ENTER(p_q, p_void, msg_size, opt);
+        OS_QPost(p_q, p_void, msg_size, opt, ts, p_err);
+        if (*p_err != OS_ERR_Q_MAX) {                           /* Queued, handed to a receiver or failed               */
+            return;
+        }
+        CPU_CRITICAL_ENTER();
+        if (p_q->MsgQ.NbrEntries >= p_q->MsgQ.NbrEntriesSize) { /* Still full?                                          */
+            break;                                              /* Yes, wait for room                                   */
+        }
+        CPU_CRITICAL_EXIT();                                    /* No, a receiver made room meanwhile                   */
+    }
+
+    if (OSSchedLockNestingCtr > 0u) {                           /* Can't pend when the scheduler is locked              */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_SCHED_LOCKED;
+        return;
+    }
+
+    OSTCBCurPtr->MsgPtr   = p_void;                             /* Tell the receivers what to queue for us ...          */
+    OSTCBCurPtr->MsgSize  = msg_size;
+    OSTCBCurPtr->QPostOpt = opt;                                /* ... and how                                          */
+    OS_Pend(&p_q->SpacePendObj,                                 /* Block task until room is made                        */
+            OSTCBCurPtr,
+            OS_TASK_PEND_ON_Q_SPACE,
+            timeout);
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* Message was queued for us by a receiver              */
+            *p_err = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+            *p_err = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that no room was made within TO             */
+            *p_err = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+            *p_err = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+            *p_err = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                        GET THE STATISTICS OF A MESSAGE QUEUE
+*
+* Description: This function copies the residency and depth statistics of a message queue and optionally clears them.
+*
+* Arguments  : p_q       is a pointer to the message queue
+*
+*              p_stat    is a pointer to where the statistics will be copied
+*
+*              opt       determines whether the statistics are cleared after being copied:
+*
+*                            OS_OPT_MSG_Q_STAT_NONE     Only copy the statistics
+*                            OS_OPT_MSG_Q_STAT_RESET    Copy, then clear the statistics
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                The statistics were copied
+*                            OS_ERR_OBJ_PTR_NULL        If 'p_q' is a NULL pointer
+*                            OS_ERR_OBJ_TYPE            If the message queue was not created
+*                            OS_ERR_OPT_INVALID         You specified an invalid option
+*                            OS_ERR_PTR_INVALID         If 'p_stat' is a NULL pointer
+*
+* Returns    : none
+*
+* Note(s)    : 1) Only the messages that were queued are measured: a message posted to a task already waiting on the
+*                 queue is handed to it directly.  See 'MESSAGE QUEUE STATISTICS' in os.h for the meaning of each
+*                 field.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MSG_Q_STAT_EN > 0u)
+void  OSQStatGet (OS_Q           *p_q,
+                  OS_MSG_Q_STAT  *p_stat,
+                  OS_OPT          opt,
+                  OS_ERR         *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_q == (OS_Q *)0) {                                     /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_stat == (OS_MSG_Q_STAT *)0) {                         /* User must specify a valid destination                */
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_MSG_Q_STAT_NONE:
+        case OS_OPT_MSG_Q_STAT_RESET:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure message queue was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    OS_MsgQStatGet(&p_q->MsgQ, p_stat, opt);
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                   SET THE RESIDENCY THRESHOLD OF A MESSAGE QUEUE
+*
+* Description: This function sets the residency above which the extraction of a message from a message queue is
+*              counted in '.ResOvrNbr' and traced with OS_TRACE_MSG_Q_RES_OVR().
+*
+* Arguments  : p_q         is a pointer to the message queue
+*
+*              threshold   is the residency, in OS_TS_GET() units.  0 disables the check.
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                The threshold was set
+*                              OS_ERR_OBJ_PTR_NULL        If 'p_q' is a NULL pointer
+*                              OS_ERR_OBJ_TYPE            If the message queue was not created
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSQStatThresholdSet (OS_Q    *p_q,
+                           CPU_TS   threshold,
+                           OS_ERR  *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_q == (OS_Q *)0) {                                     /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
 #endif
 
 #if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
     if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure message queue was created                  */
-        OS_TRACE_Q_POST_FAILED(p_q);
-        OS_TRACE_Q_POST_EXIT(OS_ERR_OBJ_TYPE);
        *p_err = OS_ERR_OBJ_TYPE;
         return;
     }
 #endif
-#if (OS_CFG_TS_EN > 0u)
-    ts = OS_TS_GET();                                           /* Get timestamp                                        */
-#else
-    ts = 0u;
-#endif
-
-    OS_TRACE_Q_POST(p_q);
 
     CPU_CRITICAL_ENTER();
-    p_pend_list = &p_q->PendList;
-    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on message queue?                   */
-        if ((opt & OS_OPT_POST_LIFO) == 0u) {                   /* Determine whether we post FIFO or LIFO               */
-            post_type = OS_OPT_POST_FIFO;
-        } else {
-            post_type = OS_OPT_POST_LIFO;
-        }
-        OS_MsgQPut(&p_q->MsgQ,                                  /* Place message in the message queue                   */
-                   p_void,
-                   msg_size,
-                   post_type,
-                   ts,
-                   p_err);
-        CPU_CRITICAL_EXIT();
-        OS_TRACE_Q_POST_EXIT(*p_err);
-        return;
-    }
-
-    p_tcb = p_pend_list->HeadPtr;
-    while (p_tcb != (OS_TCB *)0) {
-        p_tcb_next = p_tcb->PendNextPtr;
-        OS_Post((OS_PEND_OBJ *)((void *)p_q),
-                p_tcb,
-                p_void,
-                msg_size,
-                ts);
-        if ((opt & OS_OPT_POST_ALL) == 0u)  {                   /* Post message to all tasks waiting?                   */
-            break;                                              /* No                                                   */
-        }
-        p_tcb = p_tcb_next;
-    }
-
+    p_q->MsgQ.Stat.ResThreshold = threshold;
     CPU_CRITICAL_EXIT();
-
-    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
-        OSSched();                                              /* Run the scheduler                                    */
-    }
-
    *p_err = OS_ERR_NONE;
-    OS_TRACE_Q_POST_EXIT(*p_err);
 }
+#endif
 
 
 /*
@@ -925,6 +2431,9 @@ void  OS_QClr (OS_Q  *p_q)
     OS_MsgQInit(&p_q->MsgQ,                                     /* Initialize the list of OS_MSGs                       */
                 0u);
     OS_PendListInit(&p_q->PendList);                            /* Initialize the waiting list                          */
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+    OS_PendListInit(&p_q->SpacePendObj.PendList);
+#endif
 }
 
 
@@ -955,6 +2464,10 @@ void  OS_QDbgListAdd (OS_Q  *p_q)
         OSQDbgListPtr->DbgPrevPtr =  p_q;
     }
     OSQDbgListPtr                 =  p_q;
+
+#if (OS_CFG_OBJ_REG_EN > 0u)
+    OS_ObjRegAdd((void *)p_q, OS_OBJ_TYPE_Q, p_q->NamePtr);
+#endif
 }
 
 
@@ -984,6 +2497,364 @@ void  OS_QDbgListRemove (OS_Q  *p_q)
         p_q->DbgNextPtr      = (OS_Q *)0;
         p_q->DbgPrevPtr      = (OS_Q *)0;
     }
+
+#if (OS_CFG_OBJ_REG_EN > 0u)
+    OS_ObjRegRemove((void *)p_q, OS_OBJ_TYPE_Q, p_q->NamePtr);
+#endif
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                   HAND THE QUEUED MESSAGES TO THE TASKS ACCEPTING THEM
+*
+* Description: This function is called once messages were queued without being offered to the waiting tasks.  Each
+*              waiting task, in priority order, is handed the first queued message it accepts.
+*
+* Arguments  : p_q           is a pointer to the message queue
+*
+* Returns    : The number of tasks readied, the caller has to run the scheduler if non-zero.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function MUST be called within a critical section.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_PEND_MATCH_EN > 0u)
+OS_OBJ_QTY  OS_QMatchRdy (OS_Q  *p_q)
+{
+    OS_TCB       *p_tcb;
+    OS_TCB       *p_tcb_next;
+    void         *p_void;
+    OS_MSG_SIZE   msg_size;
+    CPU_TS        ts;
+    OS_OBJ_QTY    nbr_rdy;
+    OS_ERR        err;
+
+
+    nbr_rdy = 0u;
+    p_tcb   = p_q->PendList.HeadPtr;
+    while ((p_tcb                != (OS_TCB *)0) &&
+           (p_q->MsgQ.NbrEntries >           0u)) {
+        p_tcb_next = p_tcb->PendNextPtr;                        /* The task posted to leaves the pend list              */
+        if (p_tcb->QMatchFnct == (OS_Q_MATCH_FNCT)0) {          /* Does the task accept any message?                    */
+            p_void = OS_MsgQGet(&p_q->MsgQ,
+                                &msg_size,
+                                &ts,
+                                &err);
+        } else {
+            p_void = OS_MsgQGetMatch(&p_q->MsgQ,
+                                     p_tcb->QMatchFnct,
+                                     p_tcb->QMatchArg,
+                                     &msg_size,
+                                     &ts,
+                                     &err);
+        }
+        if (err == OS_ERR_NONE) {
+            OS_Post((OS_PEND_OBJ *)((void *)p_q),
+                    p_tcb,
+                    p_void,
+                    msg_size,
+                    ts);
+            nbr_rdy++;
+        }
+        p_tcb = p_tcb_next;
+    }
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+    while ((p_q->PendList.MultiHeadPtr != (OS_PEND_DATA *)0) && /* The tasks in OSPendMulti() accept any message        */
+           (p_q->MsgQ.NbrEntries       >                 0u)) {
+        p_void = OS_MsgQGet(&p_q->MsgQ,
+                            &msg_size,
+                            &ts,
+                            &err);
+        OS_Post((OS_PEND_OBJ *)((void *)p_q),
+                p_q->PendList.MultiHeadPtr->TCBPtr,
+                p_void,
+                msg_size,
+                ts);
+        nbr_rdy++;
+    }
+#endif
+    return (nbr_rdy);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                       QUEUE THE MESSAGES OF THE WAITING SENDERS
+*
+* Description: This function is called when messages were removed from a queue.  While there is room, the message of
+*              the highest priority task blocked in OSQPostWait() is placed in the queue and the task is readied.
+*
+* Arguments  : p_q           is a pointer to the message queue
+*
+* Returns    : The number of tasks readied, the caller has to run the scheduler if non-zero.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function MUST be called within a critical section.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+OS_OBJ_QTY  OS_QSpaceWake (OS_Q  *p_q)
+{
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    OS_OPT         post_type;
+    OS_OBJ_QTY     nbr_rdy;
+    CPU_TS         ts;
+    OS_ERR         err;
+
+
+    p_pend_list = &p_q->SpacePendObj.PendList;
+    p_tcb       =  OS_PEND_LIST_HEAD(p_pend_list);
+    if (p_tcb == (OS_TCB *)0) {                                 /* Any task waiting for room?                           */
+        return (0u);                                            /* No                                                   */
+    }
+
+#if (OS_CFG_TS_EN > 0u)
+    ts      = OS_TS_GET();                                      /* Get local time stamp so all tasks get the same time  */
+#else
+    ts      = 0u;
+#endif
+    nbr_rdy = 0u;
+    while ((p_tcb                != (OS_TCB *)0) &&
+           (p_q->MsgQ.NbrEntries <  p_q->MsgQ.NbrEntriesSize)) {
+        if ((p_tcb->QPostOpt & OS_OPT_POST_LIFO) == 0u) {       /* Post the message the way the sender asked            */
+            post_type = OS_OPT_POST_FIFO;
+        } else {
+            post_type = OS_OPT_POST_LIFO;
+        }
+#if (OS_CFG_Q_PRIO_EN > 0u)
+        post_type |= (OS_OPT)(p_tcb->QPostOpt & OS_OPT_POST_PRIO_MASK);
+#endif
+        OS_MsgQPut(&p_q->MsgQ,
+                   p_tcb->MsgPtr,
+                   p_tcb->MsgSize,
+                   post_type,
+                   ts,
+                   &err);
+        if (err != OS_ERR_NONE) {                               /* Out of OS_MSGs, the sender keeps waiting             */
+            break;
+        }
+        OS_Post(&p_q->SpacePendObj,
+                p_tcb,
+                p_tcb->MsgPtr,
+                p_tcb->MsgSize,
+                ts);
+        nbr_rdy++;
+#if (OS_CFG_Q_PEND_MATCH_EN > 0u)
+        nbr_rdy += OS_QMatchRdy(p_q);                           /* A receiver may take it, making room again            */
+#endif
+        p_tcb = OS_PEND_LIST_HEAD(p_pend_list);                 /* The task posted to left the pend list                */
+    }
+#if (OS_CFG_REACTOR_EN > 0u)
+    if (nbr_rdy > 0u) {
+        if (OS_ReactorSrcRdy(p_q->PendList.ReactorSrcPtr, ts) == OS_TRUE) {
+            nbr_rdy++;                                          /* The task of the reactor was readied too              */
+        }
+    }
+#endif
+    return (nbr_rdy);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                               POST MESSAGE TO A QUEUE
+*
+* Description: This function sends a message to a queue once OSQPost() or OSQPostFromISR() checked the arguments.
+*
+* Arguments  : p_q           is a pointer to a message queue
+*
+*              p_void        is a pointer to the message to send
+*
+*              msg_size      specifies the size of the message (in bytes)
+*
+*              opt           determines the type of POST performed (see OSQPost())
+*
+*              ts            is the timestamp of the post
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function (see
+*                            OSQPost())
+*
+* Returns    : None
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_QPost (OS_Q         *p_q,
+                        void         *p_void,
+                        OS_MSG_SIZE   msg_size,
+                        OS_OPT        opt,
+                        CPU_TS        ts,
+                        OS_ERR       *p_err)
+{
+    OS_OPT         post_type;
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+#if (OS_CFG_REACTOR_EN > 0u)
+    CPU_BOOLEAN    rdy;
+#endif
+    CPU_SR_ALLOC();
+
+    OS_TRACE_Q_POST(p_q);
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_q->PendList;
+    OS_OBJ_STAT_INC(p_pend_list, PostCtr);
+#if (OS_CFG_Q_PEND_MATCH_EN > 0u)
+    p_tcb       = OS_QMatchHead(p_pend_list, p_void, msg_size);         /* Only a task accepting the message gets it            */
+#else
+    p_tcb       = OS_PEND_LIST_HEAD(p_pend_list);
+#endif
+    if (p_tcb == (OS_TCB *)0) {                                 /* Any task waiting on message queue?                   */
+        if ((opt & OS_OPT_POST_LIFO) == 0u) {                   /* Determine whether we post FIFO or LIFO               */
+            post_type = OS_OPT_POST_FIFO;
+        } else {
+            post_type = OS_OPT_POST_LIFO;
+        }
+#if (OS_CFG_Q_PRIO_EN > 0u)
+        post_type |= (OS_OPT)(opt & OS_OPT_POST_PRIO_MASK);     /* Keep the message priority level                      */
+#endif
+        OS_MsgQPut(&p_q->MsgQ,                                  /* Place message in the message queue                   */
+                   p_void,
+                   msg_size,
+                   post_type,
+                   ts,
+                   p_err);
+#if (OS_CFG_MEM_BUF_EN > 0u)
+        if (((opt & OS_OPT_POST_MEM_BUF_REF) != 0u) &&          /* Add a reference for the message queued               */
+            (*p_err == OS_ERR_NONE)) {
+            (void)OS_MemBufRefAdd(p_void);
+        }
+#endif
+#if (OS_CFG_REACTOR_EN > 0u)
+        rdy = OS_FALSE;
+        if (*p_err == OS_ERR_NONE) {
+            rdy = OS_ReactorSrcRdy(p_pend_list->ReactorSrcPtr, ts);
+        }
+#endif
+        CPU_CRITICAL_EXIT();
+#if (OS_CFG_REACTOR_EN > 0u)
+        if ((rdy                          == OS_TRUE) &&        /* Run the task of the reactor watching the queue       */
+            ((opt & OS_OPT_POST_NO_SCHED) ==      0u)) {
+            OSSched();
+        }
+#endif
+        OS_TRACE_Q_POST_EXIT(*p_err);
+        return;
+    }
+
+#if (OS_CFG_POST_ALL_INT_EN > 0u) && (OS_CFG_Q_PEND_MATCH_EN == 0u)
+    if (((opt & OS_OPT_POST_ALL)         != 0u) &&              /* Ready all the waiters with interrupts enabled        */
+        ((opt & OS_OPT_POST_MEM_BUF_REF) == 0u)) {              /* ... unless references are added (OSQPost() Note #4)  */
+        if (OSIntNestingCtr == 0u) {
+            OSSchedLockNestingCtr++;                            /* See OS_PostAll(), Note #2                            */
+        }
+        CPU_CRITICAL_EXIT();
+        OS_PostAll((OS_PEND_OBJ *)((void *)p_q),
+                   p_void,
+                   msg_size,
+                   ts);
+        if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+            OSSched();                                          /* Run the scheduler                                    */
+        }
+       *p_err = OS_ERR_NONE;
+        OS_TRACE_Q_POST_EXIT(*p_err);
+        return;
+    }
+#endif
+
+    while (p_tcb != (OS_TCB *)0) {
+#if (OS_CFG_MEM_BUF_EN > 0u)
+        if ((opt & OS_OPT_POST_MEM_BUF_REF) != 0u) {            /* Add a reference for the task readied                 */
+            (void)OS_MemBufRefAdd(p_void);
+        }
+#endif
+        OS_Post((OS_PEND_OBJ *)((void *)p_q),
+                p_tcb,
+                p_void,
+                msg_size,
+                ts);
+        if ((opt & OS_OPT_POST_ALL) == 0u)  {                   /* Post message to all tasks waiting?                   */
+            break;                                              /* No                                                   */
+        }
+#if (OS_CFG_Q_PEND_MATCH_EN > 0u)
+        p_tcb = OS_QMatchHead(p_pend_list, p_void, msg_size);
+#else
+        p_tcb = OS_PEND_LIST_HEAD(p_pend_list);                 /* The task posted to left the pend list                */
+#endif
+    }
+
+    CPU_CRITICAL_EXIT();
+
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+
+   *p_err = OS_ERR_NONE;
+    OS_TRACE_Q_POST_EXIT(*p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                      FIND THE TASK TO HAND A POSTED MESSAGE TO
+*
+* Description: This function returns the highest priority task waiting on a queue that accepts a message, that is a
+*              task that waits in OSQPend(), OSQPendN() or OSPendMulti(), or a task waiting in OSQPendMatch() whose
+*              match function returns OS_TRUE.
+*
+* Arguments  : p_pend_list   is a pointer to the pend list of the message queue
+*
+*              p_void        is a pointer to the message
+*
+*              msg_size      specifies the size of the message (in bytes)
+*
+* Returns    : A pointer to the TCB of the task, a NULL pointer if no task accepts the message.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) This function MUST be called within a critical section.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_PEND_MATCH_EN > 0u)
+static  OS_TCB  *OS_QMatchHead (OS_PEND_LIST *p_pend_list,
+                                void         *p_void,
+                                OS_MSG_SIZE   msg_size)
+{
+    OS_TCB  *p_tcb;
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+    OS_TCB  *p_tcb_multi;
+#endif
+
+
+    p_tcb = p_pend_list->HeadPtr;                               /* The list is sorted, the first task accepting wins    */
+    while (p_tcb != (OS_TCB *)0) {
+        if ((p_tcb->QMatchFnct == (OS_Q_MATCH_FNCT)0) ||
+            ((*p_tcb->QMatchFnct)(p_void, msg_size, p_tcb->QMatchArg) == OS_TRUE)) {
+            break;
+        }
+        p_tcb = p_tcb->PendNextPtr;
+    }
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+    if (p_pend_list->MultiHeadPtr != (OS_PEND_DATA *)0) {       /* The tasks in OSPendMulti() accept any message        */
+        p_tcb_multi = p_pend_list->MultiHeadPtr->TCBPtr;
+        if ((p_tcb             == (OS_TCB *)0) ||
+            (p_tcb_multi->Prio <  p_tcb->Prio)) {
+            p_tcb = p_tcb_multi;
+        }
+    }
+#endif
+    return (p_tcb);
 }
 #endif
 #endif
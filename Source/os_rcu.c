@@ -0,0 +1,960 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                      READ-COPY-UPDATE MANAGEMENT
+*
+* File    : os_rcu.c
+* Version : V3.08.00
+*********************************************************************************************************
+* Note(s) : (1) Read-Copy-Update lets many tasks read a structure, such as a routing table, through a pointer while a
+*               writer replaces it.  Readers bracket their use of the pointer with OSRcuRdLock() and OSRcuRdUnlock(),
+*               which only increment and decrement a counter.  The writer builds the new version, publishes it by
+*               storing the pointer and then waits for a grace period before freeing the old version:
+*
+*                   p_old    = p_table;
+*                   p_table  = p_new;
+*                   OSRcuSync(&Rcu, 0u, &err);
+*                   free(p_old);
+*
+*               A writer that can't block gets a grace period number from OSRcuGpStart() instead, and frees the old
+*               version once OSRcuGpDone() returns OS_TRUE for it.
+*
+*           (2) A grace period ends when all the readers that were in a read-side section when it started have left
+*               it.  Since tasks are preempted, having been switched out doesn't tell that a task left its section:
+*               each reader is counted in one of the two phases of the domain instead (see os_rcu in os.h).
+*
+*           (3) Writers are not serialized by this module.  Concurrent writers of the same pointer need a mutex.
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#define  OS_CRIT_SITE_ID                    OS_CRIT_SITE_RCU
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_rcu__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_RCU_EN > 0u)
+/*
+************************************************************************************************************************
+*                                                    LOCAL DEFINES
+*
+* Note(s) : (1) OS_RCU_GP_REACHED() compares grace period numbers across a wrap of '.GpSeq', as long as they are less
+*               than half its range apart.
+*
+*           (2) OS_CPU_MEM_BARRIER(), when the port provides it, keeps the processor from moving the reads of the
+*               protected data outside the read-side section.
+************************************************************************************************************************
+*/
+
+#define  OS_RCU_GP_REACHED(p_rcu, gp)    ((OS_RCU_GP)((p_rcu)->GpSeq - (gp)) < (OS_RCU_GP)0x80000000u)
+
+#ifdef   OS_CPU_MEM_BARRIER
+#define  OS_RCU_MEM_BARRIER()           OS_CPU_MEM_BARRIER()
+#else
+#define  OS_RCU_MEM_BARRIER()
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                              LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  OS_RcuGpAdvance (OS_RCU       *p_rcu);
+
+static  CPU_BOOLEAN  OS_RcuGpPost    (OS_RCU       *p_rcu);
+
+static  OS_RCU_GP    OS_RcuGpReq     (OS_RCU       *p_rcu,
+                                      CPU_BOOLEAN  *p_posted);
+
+
+/*
+************************************************************************************************************************
+*                                              CREATE AN RCU DOMAIN
+*
+* Description: This function is called by your application to create a Read-Copy-Update domain.  The readers and the
+*              writers of the same data must use the same domain.
+*
+* Arguments  : p_rcu         is a pointer to the RCU domain to initialize.  Your application is responsible for
+*                            allocating storage for the domain.
+*
+*              p_name        is a pointer to the name you would like to give the RCU domain.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_CREATE_ISR              If you called this function from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the domain after you
+*                                                                 called OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_rcu' is a NULL pointer
+*                                OS_ERR_OBJ_CREATED             If the domain was already created
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSRcuCreate (OS_RCU    *p_rcu,
+                   CPU_CHAR  *p_name,
+                   OS_ERR    *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_rcu == (OS_RCU *)0) {                                 /* Validate 'p_rcu'                                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
+    if (p_rcu->Type == OS_OBJ_TYPE_RCU) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+    p_rcu->Type        = OS_OBJ_TYPE_RCU;                       /* Mark the data structure as an RCU domain             */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_rcu->NamePtr     = p_name;                                /* Save the name of the RCU domain                      */
+#else
+    (void)p_name;
+#endif
+    p_rcu->RdCtrTbl[0] = 0u;                                    /* No reader                                            */
+    p_rcu->RdCtrTbl[1] = 0u;
+    p_rcu->Phase       = 0u;
+    p_rcu->GpSeq       = 0u;                                    /* No grace period in progress                          */
+    p_rcu->GpReq       = OS_FALSE;
+    OS_PendListInit(&p_rcu->PendList);                          /* Initialize the waiting list                          */
+
+#if (OS_CFG_DBG_EN > 0u)
+    OS_RcuDbgListAdd(p_rcu);
+    OSRcuQty++;                                                 /* One more RCU domain created                          */
+#endif
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                               DELETE AN RCU DOMAIN
+*
+* Description: This function deletes an RCU domain and readies all tasks waiting for a grace period of it.
+*
+* Arguments  : p_rcu         is a pointer to the RCU domain to delete
+*
+*              opt           determines delete options as follows:
+*
+*                                OS_OPT_DEL_NO_PEND          Delete the domain ONLY if no task pending
+*                                OS_OPT_DEL_ALWAYS           Deletes the domain even if tasks are waiting.
+*                                                            In this case, all the tasks pending will be readied.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    The call was successful and the domain was deleted
+*                                OS_ERR_DEL_ISR                 If you attempted to delete the domain from an ISR
+*                                OS_ERR_ILLEGAL_DEL_RUN_TIME    If you are trying to delete the domain after you
+*                                                                 called OSStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_rcu' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE                If 'p_rcu' is not pointing at an RCU domain
+*                                OS_ERR_OPT_INVALID             An invalid option was specified
+*                                OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                                OS_ERR_RCU_RD_ACTIVE           If a reader is in a read-side section
+*                                OS_ERR_TASK_WAITING            One or more tasks were waiting on the domain
+*
+* Returns    : == 0          if no tasks were waiting on the domain, or upon error.
+*              >  0          if one or more tasks waiting on the domain are now readied and informed.
+*
+* Note(s)    : 1) This function must be used with care.  Tasks that would normally expect the presence of the domain
+*                 MUST check the return code of OSRcuSync().
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_RCU_DEL_EN > 0u)
+OS_OBJ_QTY  OSRcuDel (OS_RCU  *p_rcu,
+                      OS_OPT   opt,
+                      OS_ERR  *p_err)
+{
+    OS_OBJ_QTY     nbr_tasks;
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't delete an RCU domain from an ISR               */
+       *p_err = OS_ERR_DEL_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_rcu == (OS_RCU *)0) {                                 /* Validate 'p_rcu'                                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_rcu->Type != OS_OBJ_TYPE_RCU) {                       /* Make sure RCU domain was created                     */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if ((p_rcu->RdCtrTbl[0] > 0u) ||                            /* Can't delete the domain while it is read             */
+        (p_rcu->RdCtrTbl[1] > 0u)) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_RCU_RD_ACTIVE;
+        return (0u);
+    }
+    p_pend_list = &p_rcu->PendList;
+    nbr_tasks   = 0u;
+    switch (opt) {
+        case OS_OPT_DEL_NO_PEND:                                /* Delete RCU domain only if no task waiting            */
+             if (OS_PEND_LIST_HEAD(p_pend_list) == (OS_TCB *)0) {
+#if (OS_CFG_DBG_EN > 0u)
+                 OS_RcuDbgListRemove(p_rcu);
+                 OSRcuQty--;
+#endif
+                 OS_RcuClr(p_rcu);
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_NONE;
+             } else {
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_TASK_WAITING;
+             }
+             break;
+
+        case OS_OPT_DEL_ALWAYS:                                 /* Always delete the RCU domain                         */
+#if (OS_CFG_TS_EN > 0u)
+             ts = OS_TS_GET();                                  /* Get local time stamp so all tasks get the same time  */
+#else
+             ts = 0u;
+#endif
+             p_tcb = OS_PEND_LIST_HEAD(p_pend_list);            /* Remove all tasks from the pend list                  */
+             while (p_tcb != (OS_TCB *)0) {
+                 OS_PendAbort(p_tcb,
+                              ts,
+                              OS_STATUS_PEND_DEL);
+                 nbr_tasks++;
+                 p_tcb = OS_PEND_LIST_HEAD(p_pend_list);
+             }
+#if (OS_CFG_DBG_EN > 0u)
+             OS_RcuDbgListRemove(p_rcu);
+             OSRcuQty--;
+#endif
+             OS_RcuClr(p_rcu);
+             CPU_CRITICAL_EXIT();
+             OSSched();                                         /* Find highest priority task ready to run              */
+            *p_err = OS_ERR_NONE;
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_OPT_INVALID;
+             break;
+    }
+    return (nbr_tasks);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                       CHECK WHETHER A GRACE PERIOD IS OVER
+*
+* Description: This function tells whether the grace period returned by OSRcuGpStart() is over, in which case the old
+*              versions of the data unpublished before OSRcuGpStart() was called can be freed.
+*
+* Arguments  : p_rcu         is a pointer to the RCU domain
+*
+*              gp            is the grace period returned by OSRcuGpStart()
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_rcu' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_rcu' is not pointing at an RCU domain
+*
+* Returns    : OS_TRUE           if the grace period is over
+*              OS_FALSE          if it is still in progress, or upon error
+*
+* Note(s)    : 1) This function can be called from a task or an ISR.
+************************************************************************************************************************
+*/
+
+CPU_BOOLEAN  OSRcuGpDone (OS_RCU     *p_rcu,
+                          OS_RCU_GP   gp,
+                          OS_ERR     *p_err)
+{
+    CPU_BOOLEAN  done;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_rcu == (OS_RCU *)0) {                                 /* Validate 'p_rcu'                                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_rcu->Type != OS_OBJ_TYPE_RCU) {                       /* Make sure RCU domain was created                     */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (OS_FALSE);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    done = OS_RCU_GP_REACHED(p_rcu, gp);
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+    return (done);
+}
+
+
+/*
+************************************************************************************************************************
+*                                              REQUEST A GRACE PERIOD
+*
+* Description: This function is called by a writer, after it unpublished the old version of the data, to get a grace
+*              period at the end of which the old version can be freed.  It does not block.
+*
+* Arguments  : p_rcu         is a pointer to the RCU domain
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_rcu' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_rcu' is not pointing at an RCU domain
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*
+* Returns    : The grace period to pass to OSRcuGpDone(), or 0 upon error.
+*
+* Note(s)    : 1) This function can be called from a task or an ISR.  A grace period is started if none is in progress,
+*                 it is over at once if no reader is in a read-side section.
+************************************************************************************************************************
+*/
+
+OS_RCU_GP  OSRcuGpStart (OS_RCU  *p_rcu,
+                         OS_ERR  *p_err)
+{
+    OS_RCU_GP    gp;
+    CPU_BOOLEAN  posted;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_rcu == (OS_RCU *)0) {                                 /* Validate 'p_rcu'                                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_rcu->Type != OS_OBJ_TYPE_RCU) {                       /* Make sure RCU domain was created                     */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    OS_RCU_MEM_BARRIER();                                       /* The old version is unpublished before the request    */
+    CPU_CRITICAL_ENTER();
+    gp = OS_RcuGpReq(p_rcu, &posted);
+    CPU_CRITICAL_EXIT();
+    if (posted == OS_TRUE) {
+        OSSched();                                              /* Run the writers readied, if called from a task       */
+    }
+   *p_err = OS_ERR_NONE;
+    return (gp);
+}
+
+
+/*
+************************************************************************************************************************
+*                                              ENTER A READ-SIDE SECTION
+*
+* Description: This function is called by a task or an ISR before it reads the pointer to the data protected by an RCU
+*              domain.  The data remains valid until the matching call to OSRcuRdUnlock().
+*
+* Arguments  : p_rcu         is a pointer to the RCU domain
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_rcu' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_rcu' is not pointing at an RCU domain
+*
+* Returns    : The index to pass to OSRcuRdUnlock(), 0 upon error.
+*
+* Note(s)    : 1) Read-side sections may be nested, each call returning its own index.
+*
+*              2) A task may block or be preempted in a read-side section, but it delays the end of the grace periods
+*                 for as long as it stays in it.  A task MUST NOT be deleted in a read-side section and MUST NOT call
+*                 OSRcuSync() on the same domain from it.
+************************************************************************************************************************
+*/
+
+CPU_INT08U  OSRcuRdLock (OS_RCU  *p_rcu,
+                         OS_ERR  *p_err)
+{
+    CPU_INT08U  idx;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_rcu == (OS_RCU *)0) {                                 /* Validate 'p_rcu'                                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_rcu->Type != OS_OBJ_TYPE_RCU) {                       /* Make sure RCU domain was created                     */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    idx = p_rcu->Phase;                                         /* Register the reader in the current phase             */
+    p_rcu->RdCtrTbl[idx]++;
+    CPU_CRITICAL_EXIT();
+    OS_RCU_MEM_BARRIER();                                       /* The data is read after the reader is counted         */
+   *p_err = OS_ERR_NONE;
+    return (idx);
+}
+
+
+/*
+************************************************************************************************************************
+*                                              LEAVE A READ-SIDE SECTION
+*
+* Description: This function is called by a task or an ISR when it no longer uses the data it read since the matching
+*              call to OSRcuRdLock().  The last reader of a grace period ends it and readies the writers waiting for it.
+*
+* Arguments  : p_rcu         is a pointer to the RCU domain
+*
+*              idx           is the index returned by the matching call to OSRcuRdLock()
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_rcu' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_rcu' is not pointing at an RCU domain
+*                                OS_ERR_RCU_IDX_INVALID    If 'idx' doesn't match any read-side section
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSRcuRdUnlock (OS_RCU      *p_rcu,
+                     CPU_INT08U   idx,
+                     OS_ERR      *p_err)
+{
+    CPU_BOOLEAN  posted;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_rcu == (OS_RCU *)0) {                                 /* Validate 'p_rcu'                                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (idx > 1u) {                                             /* Validate 'idx'                                       */
+       *p_err = OS_ERR_RCU_IDX_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_rcu->Type != OS_OBJ_TYPE_RCU) {                       /* Make sure RCU domain was created                     */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    OS_RCU_MEM_BARRIER();                                       /* The data was read before the reader leaves           */
+    posted = OS_FALSE;
+    CPU_CRITICAL_ENTER();
+    if (p_rcu->RdCtrTbl[idx] == 0u) {                           /* Is a reader registered in this phase?                */
+        CPU_CRITICAL_EXIT();                                    /* No                                                   */
+       *p_err = OS_ERR_RCU_IDX_INVALID;
+        return;
+    }
+    p_rcu->RdCtrTbl[idx]--;
+    if ((p_rcu->RdCtrTbl[idx] == 0u) &&                         /* Last reader of the phase of a grace period?          */
+        (idx                  != p_rcu->Phase)) {
+        if (OS_RcuGpAdvance(p_rcu) == OS_TRUE) {                /* Yes, end it                                          */
+            posted = OS_RcuGpPost(p_rcu);
+        }
+    }
+    CPU_CRITICAL_EXIT();
+    if (posted == OS_TRUE) {
+        OSSched();                                              /* Run the writers readied, if called from a task       */
+    }
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              WAIT FOR A GRACE PERIOD
+*
+* Description: This function is called by a writer, after it unpublished the old version of the data, to wait until
+*              no reader may still use it.
+*
+* Arguments  : p_rcu         is a pointer to the RCU domain
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for the
+*                            grace period up to the amount of time specified by this argument.  If you specify 0,
+*                            however, your task will wait forever.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The grace period is over, the old version can be freed
+*                                OS_ERR_OBJ_DEL            If 'p_rcu' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_rcu' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_rcu' is not pointing at an RCU domain
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                OS_ERR_SCHED_LOCKED       If the grace period is not over and the scheduler is locked
+*                                OS_ERR_STATUS_INVALID     Pend status is invalid
+*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*                                OS_ERR_TIMEOUT            The grace period was not over within the specified timeout
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function returns at once if no reader is in a read-side section.
+************************************************************************************************************************
+*/
+
+void  OSRcuSync (OS_RCU   *p_rcu,
+                 OS_TICK   timeout,
+                 OS_ERR   *p_err)
+{
+    OS_RCU_GP    gp;
+    CPU_BOOLEAN  posted;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_PEND_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_rcu == (OS_RCU *)0) {                                 /* Validate 'p_rcu'                                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_rcu->Type != OS_OBJ_TYPE_RCU) {                       /* Make sure RCU domain was created                     */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    OS_RCU_MEM_BARRIER();                                       /* The old version is unpublished before the request    */
+    CPU_CRITICAL_ENTER();
+    gp = OS_RcuGpReq(p_rcu, &posted);
+    if (OS_RCU_GP_REACHED(p_rcu, gp) == OS_TRUE) {              /* Is the grace period already over?                    */
+        CPU_CRITICAL_EXIT();                                    /* Yes                                                  */
+        if (posted == OS_TRUE) {
+            OSSched();
+        }
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    if (OSSchedLockNestingCtr > 0u) {                           /* Can't pend when the scheduler is locked              */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_SCHED_LOCKED;
+        return;
+    }
+
+    OSTCBCurPtr->RcuGp = gp;                                    /* Block task until the end of the grace period         */
+    OS_Pend((OS_PEND_OBJ *)((void *)p_rcu),
+            OSTCBCurPtr,
+            OS_TASK_PEND_ON_RCU,
+            timeout);
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* The grace period is over                             */
+            *p_err = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that the readers didn't leave within TO     */
+            *p_err = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+            *p_err = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+            *p_err = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+************************************************************************************************************************
+*                                         CLEAR THE CONTENTS OF AN RCU DOMAIN
+*
+* Description: This function is called by OSRcuDel() to clear the contents of an RCU domain
+*
+* Argument(s): p_rcu         is a pointer to the RCU domain to clear
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_RcuClr (OS_RCU  *p_rcu)
+{
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_rcu->Type        =  OS_OBJ_TYPE_NONE;                     /* Mark the data structure as a NONE                    */
+#endif
+    p_rcu->RdCtrTbl[0] =  0u;
+    p_rcu->RdCtrTbl[1] =  0u;
+    p_rcu->Phase       =  0u;
+    p_rcu->GpSeq       =  0u;
+    p_rcu->GpReq       =  OS_FALSE;
+#if (OS_CFG_DBG_EN > 0u)
+    p_rcu->NamePtr     = (CPU_CHAR *)((void *)"?RCU");
+#endif
+    OS_PendListInit(&p_rcu->PendList);                          /* Initialize the waiting list                          */
+}
+
+
+/*
+************************************************************************************************************************
+*                                        ADD/REMOVE RCU DOMAIN TO/FROM DEBUG LIST
+*
+* Description: These functions are called by uC/OS-III to add or remove an RCU domain to/from the debug list.
+*
+* Arguments  : p_rcu        is a pointer to the RCU domain to add/remove
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN > 0u)
+void  OS_RcuDbgListAdd (OS_RCU  *p_rcu)
+{
+    p_rcu->DbgNamePtr               = (CPU_CHAR *)((void *)" ");
+    p_rcu->DbgPrevPtr               = (OS_RCU *)0;
+    if (OSRcuDbgListPtr == (OS_RCU *)0) {
+        p_rcu->DbgNextPtr           = (OS_RCU *)0;
+    } else {
+        p_rcu->DbgNextPtr           =  OSRcuDbgListPtr;
+        OSRcuDbgListPtr->DbgPrevPtr =  p_rcu;
+    }
+    OSRcuDbgListPtr                 =  p_rcu;
+}
+
+
+void  OS_RcuDbgListRemove (OS_RCU  *p_rcu)
+{
+    OS_RCU  *p_rcu_next;
+    OS_RCU  *p_rcu_prev;
+
+
+    p_rcu_prev = p_rcu->DbgPrevPtr;
+    p_rcu_next = p_rcu->DbgNextPtr;
+
+    if (p_rcu_prev == (OS_RCU *)0) {
+        OSRcuDbgListPtr = p_rcu_next;
+        if (p_rcu_next != (OS_RCU *)0) {
+            p_rcu_next->DbgPrevPtr = (OS_RCU *)0;
+        }
+        p_rcu->DbgNextPtr = (OS_RCU *)0;
+
+    } else if (p_rcu_next == (OS_RCU *)0) {
+        p_rcu_prev->DbgNextPtr = (OS_RCU *)0;
+        p_rcu->DbgPrevPtr      = (OS_RCU *)0;
+
+    } else {
+        p_rcu_prev->DbgNextPtr =  p_rcu_next;
+        p_rcu_next->DbgPrevPtr =  p_rcu_prev;
+        p_rcu->DbgNextPtr      = (OS_RCU *)0;
+        p_rcu->DbgPrevPtr      = (OS_RCU *)0;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                            ADVANCE THE GRACE PERIODS
+*
+* Description: This function ends the grace period in progress if the readers of the previous phase are gone, and starts
+*              the next one if it was requested.
+*
+* Argument(s): p_rcu         is a pointer to the RCU domain
+*
+* Returns    : OS_TRUE           if a grace period ended
+*              OS_FALSE          otherwise
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and must be called with interrupts disabled.
+*
+*              2) A grace period that starts while no reader is in a read-side section ends at once.
+************************************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  OS_RcuGpAdvance (OS_RCU  *p_rcu)
+{
+    CPU_BOOLEAN  ended;
+    CPU_BOOLEAN  done;
+
+
+    ended = OS_FALSE;
+    done  = OS_FALSE;
+    while (done == OS_FALSE) {
+        if ((p_rcu->GpSeq & 1u) != 0u) {                        /* Is a grace period in progress?                       */
+            if (p_rcu->RdCtrTbl[p_rcu->Phase ^ 1u] > 0u) {      /* Yes, are readers of the previous phase left?         */
+                done  = OS_TRUE;                                /* Yes, the grace period goes on                        */
+            } else {
+                p_rcu->GpSeq++;                                 /* No,  end it                                          */
+                ended = OS_TRUE;
+            }
+        } else if (p_rcu->GpReq == OS_TRUE) {                   /* Was a grace period requested?                        */
+            p_rcu->GpReq  = OS_FALSE;                           /* Yes, start it: new readers go to the other phase     */
+            p_rcu->Phase ^= 1u;
+            p_rcu->GpSeq++;
+        } else {
+            done  = OS_TRUE;
+        }
+    }
+    return (ended);
+}
+
+
+/*
+************************************************************************************************************************
+*                                       READY THE TASKS WAITING FOR A GRACE PERIOD
+*
+* Description: This function readies the tasks waiting in OSRcuSync() for a grace period that is now over.
+*
+* Argument(s): p_rcu         is a pointer to the RCU domain
+*
+* Returns    : OS_TRUE           if a task was readied
+*              OS_FALSE          otherwise
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and must be called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  OS_RcuGpPost (OS_RCU  *p_rcu)
+{
+    OS_TCB       *p_tcb;
+    OS_TCB       *p_tcb_next;
+    CPU_BOOLEAN   posted;
+    CPU_TS        ts;
+
+
+#if (OS_CFG_TS_EN > 0u)
+    ts     = OS_TS_GET();                                       /* Get timestamp                                        */
+#else
+    ts     = 0u;
+#endif
+    posted = OS_FALSE;
+    p_tcb  = p_rcu->PendList.HeadPtr;
+    while (p_tcb != (OS_TCB *)0) {                              /* Go through all tasks waiting for a grace period      */
+        p_tcb_next = p_tcb->PendNextPtr;
+        if (OS_RCU_GP_REACHED(p_rcu, p_tcb->RcuGp) == OS_TRUE) {
+            OS_Post((OS_PEND_OBJ *)((void *)p_rcu),
+                    p_tcb,
+                    (void *)0,
+                    0u,
+                    ts);
+            posted = OS_TRUE;
+        }
+        p_tcb = p_tcb_next;
+    }
+    return (posted);
+}
+
+
+/*
+************************************************************************************************************************
+*                                      REQUEST A GRACE PERIOD (INTERNAL)
+*
+* Description: This function returns the grace period covering the readers currently in a read-side section and makes
+*              sure it is started.
+*
+* Argument(s): p_rcu         is a pointer to the RCU domain
+*
+*              p_posted      is a pointer to a variable set to OS_TRUE if tasks were readied, OSSched() must then be
+*                            called once interrupts are enabled again.
+*
+* Returns    : The value '.GpSeq' will have at the end of that grace period.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and must be called with interrupts disabled.
+*
+*              2) The grace period in progress may have started after some of the current readers, so a request made
+*                 while one is in progress is only satisfied at the end of the next one.
+************************************************************************************************************************
+*/
+
+static  OS_RCU_GP  OS_RcuGpReq (OS_RCU       *p_rcu,
+                                CPU_BOOLEAN  *p_posted)
+{
+    OS_RCU_GP  gp;
+
+
+    if ((p_rcu->GpSeq & 1u) != 0u) {                            /* See Note #2                                          */
+        gp = p_rcu->GpSeq + 3u;
+    } else {
+        gp = p_rcu->GpSeq + 2u;
+    }
+    p_rcu->GpReq = OS_TRUE;
+   *p_posted     = OS_FALSE;
+    if (OS_RcuGpAdvance(p_rcu) == OS_TRUE) {
+       *p_posted = OS_RcuGpPost(p_rcu);
+    }
+    return (gp);
+}
+#endif
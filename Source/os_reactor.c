@@ -0,0 +1,962 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                         REACTOR MANAGEMENT
+*
+* File    : os_reactor.c
+* Version : V3.08.00
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#define  OS_CRIT_SITE_ID                    OS_CRIT_SITE_REACTOR
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_reactor__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_REACTOR_EN > 0u)
+/*
+************************************************************************************************************************
+*                                                   LOCAL DEFINES
+************************************************************************************************************************
+*/
+
+#define  OS_REACTOR_BIT(id)        ((CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - (id)))
+
+
+/*
+************************************************************************************************************************
+*                                                  CREATE A REACTOR
+*
+* Description: This function creates a reactor, with no source registered.
+*
+* Arguments  : p_reactor     is a pointer to the reactor to initialize.  Your application is responsible for
+*                            allocating storage for the reactor.
+*
+*              p_name        is a pointer to the name you would like to give the reactor.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_CREATE_ISR              If you called this function from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the reactor after you
+*                                                                 called OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_reactor' is a NULL pointer
+*                                OS_ERR_OBJ_CREATED             If the reactor was already created
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSReactorCreate (OS_REACTOR  *p_reactor,
+                       CPU_CHAR    *p_name,
+                       OS_ERR      *p_err)
+{
+    CPU_INT08U  id;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_reactor == (OS_REACTOR *)0) {                         /* Validate 'p_reactor'                                 */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
+    if (p_reactor->Type == OS_OBJ_TYPE_REACTOR) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+    p_reactor->Type    = OS_OBJ_TYPE_REACTOR;                   /* Mark the data structure as a reactor                 */
+#endif
+    p_reactor->TCBPtr  = (OS_TCB *)0;                           /* No task is waiting and no source is ready            */
+    p_reactor->RdyTbl  =  0u;
+    for (id = 0u; id < OS_REACTOR_SRC_NBR_MAX; id++) {
+        p_reactor->SrcTbl[id] = (OS_REACTOR_SRC *)0;
+    }
+#if (OS_CFG_DBG_EN > 0u)
+    p_reactor->NamePtr =  p_name;                               /* Save the name of the reactor                         */
+#else
+    (void)p_name;
+#endif
+
+#if (OS_CFG_DBG_EN > 0u)
+    OS_ReactorDbgListAdd(p_reactor);
+    OSReactorQty++;
+#endif
+
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  DELETE A REACTOR
+*
+* Description: This function deletes a reactor.  Its sources are removed and stop watching their objects.
+*
+* Arguments  : p_reactor     is a pointer to the reactor to delete
+*
+*              opt           determines delete options as follows:
+*
+*                                OS_OPT_DEL_NO_PEND          Delete the reactor ONLY if no task is waiting
+*                                OS_OPT_DEL_ALWAYS           Deletes the reactor even if a task is waiting.
+*                                                            In this case, the waiting task will be readied.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    The call was successful and the reactor was deleted
+*                                OS_ERR_DEL_ISR                 If you attempted to delete the reactor from an ISR
+*                                OS_ERR_ILLEGAL_DEL_RUN_TIME    If you are trying to delete the reactor after you
+*                                                                 called OSStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_reactor' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE                If 'p_reactor' is not pointing at a reactor
+*                                OS_ERR_OPT_INVALID             An invalid option was specified
+*                                OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                                OS_ERR_TASK_WAITING            A task was waiting in OSReactorRun()
+*
+* Returns    : == 0          if no task was waiting on the reactor, or upon error.
+*              == 1          if the task waiting on the reactor is now readied and informed.
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_REACTOR_DEL_EN > 0u)
+OS_OBJ_QTY  OSReactorDel (OS_REACTOR  *p_reactor,
+                          OS_OPT       opt,
+                          OS_ERR      *p_err)
+{
+    OS_OBJ_QTY       nbr_tasks;
+    OS_REACTOR_SRC  *p_src;
+    CPU_INT08U       id;
+    CPU_TS           ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to delete a reactor from an ISR          */
+       *p_err = OS_ERR_DEL_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_reactor == (OS_REACTOR *)0) {                         /* Validate 'p_reactor'                                 */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_DEL_NO_PEND:
+        case OS_OPT_DEL_ALWAYS:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_reactor->Type != OS_OBJ_TYPE_REACTOR) {               /* Make sure reactor was created                        */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    nbr_tasks = 0u;
+    if (p_reactor->TCBPtr != (OS_TCB *)0) {
+        if (opt == OS_OPT_DEL_NO_PEND) {                        /* Delete reactor only if no task waiting               */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_TASK_WAITING;
+            return (0u);
+        }
+#if (OS_CFG_TS_EN > 0u)
+        ts = OS_TS_GET();
+#else
+        ts = 0u;
+#endif
+        OS_PendAbort(p_reactor->TCBPtr,                         /* Ready the task waiting in OSReactorRun()             */
+                     ts,
+                     OS_STATUS_PEND_DEL);
+        nbr_tasks = 1u;
+    }
+
+    for (id = 0u; id < OS_REACTOR_SRC_NBR_MAX; id++) {          /* Stop watching the objects of the sources             */
+        p_src = p_reactor->SrcTbl[id];
+        if (p_src != (OS_REACTOR_SRC *)0) {
+            if (p_src->ObjPtr != (OS_PEND_OBJ *)0) {
+                p_src->ObjPtr->PendList.ReactorSrcPtr = (OS_REACTOR_SRC *)0;
+            }
+            p_src->ReactorPtr = (OS_REACTOR *)0;
+        }
+    }
+#if (OS_CFG_DBG_EN > 0u)
+    OS_ReactorDbgListRemove(p_reactor);
+    OSReactorQty--;
+#endif
+    OS_ReactorClr(p_reactor);
+    CPU_CRITICAL_EXIT();
+    if (nbr_tasks > 0u) {
+        OSSched();                                              /* Find highest priority task ready to run              */
+    }
+   *p_err = OS_ERR_NONE;
+    return (nbr_tasks);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                           WAIT FOR AND DISPATCH READY SOURCES
+*
+* Description: This function blocks until at least one source of the reactor is ready and then calls the handler of
+*              every ready source, in the order of their IDs.
+*
+* Arguments  : p_reactor     is a pointer to the reactor
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for a
+*                            source to be ready up to the amount of time (in 'ticks') specified by this argument.  If
+*                            you specify 0, however, your task will wait forever or until a source is ready.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               At least one handler was called
+*                                OS_ERR_OBJ_DEL            If 'p_reactor' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_reactor' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_reactor' is not pointing at a reactor
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         If the wait was aborted
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                OS_ERR_REACTOR_WAITER     If another task is already waiting on the reactor
+*                                OS_ERR_SCHED_LOCKED       If you called this function when the scheduler is locked
+*                                OS_ERR_STATUS_INVALID     Pend status is invalid
+*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*                                OS_ERR_TIMEOUT            No source was ready within the specified timeout
+*
+* Returns    : The number of handlers called.
+*
+* Note(s)    : 1) The handler of a source is given the object it watches, the number of events since its last call and
+*                 its argument.  A handler of a semaphore or of a queue obtains the units or the messages with
+*                 non-blocking pends: a task waiting on the object may have been given them first.
+*
+*              2) The ready sources are looked up again after each handler, so a source of lower ID made ready by a
+*                 handler is dispatched next.  The function returns once no source is ready.
+*
+*              3) A single task is meant to run a reactor, typically calling this function in its infinite loop.
+************************************************************************************************************************
+*/
+
+OS_OBJ_QTY  OSReactorRun (OS_REACTOR  *p_reactor,
+                          OS_TICK      timeout,
+                          OS_ERR      *p_err)
+{
+    OS_REACTOR_SRC   *p_src;
+    OS_REACTOR_FNCT   p_fnct;
+    OS_PEND_OBJ      *p_obj;
+    void             *p_arg;
+    OS_OBJ_QTY        nbr_rdy;
+    OS_OBJ_QTY        nbr_calls;
+    CPU_INT08U        id;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_PEND_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_reactor == (OS_REACTOR *)0) {                         /* Validate 'p_reactor'                                 */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_reactor->Type != OS_OBJ_TYPE_REACTOR) {               /* Make sure reactor was created                        */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_reactor->RdyTbl == 0u) {                              /* Wait for a source to be ready                        */
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return (0u);
+        }
+        if (p_reactor->TCBPtr != (OS_TCB *)0) {                 /* See Note #3                                          */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_REACTOR_WAITER;
+            return (0u);
+        }
+
+        OS_Pend((OS_PEND_OBJ *)0,                               /* Block task, there is no pend list to insert it in    */
+                OSTCBCurPtr,
+                OS_TASK_PEND_ON_REACTOR,
+                timeout);
+        OSTCBCurPtr->PendObjPtr = (OS_PEND_OBJ *)((void *)p_reactor);
+        p_reactor->TCBPtr       =  OSTCBCurPtr;
+        CPU_CRITICAL_EXIT();
+        OSSched();                                              /* Find the next highest priority task ready to run     */
+
+        CPU_CRITICAL_ENTER();
+        switch (OSTCBCurPtr->PendStatus) {
+            case OS_STATUS_PEND_OK:                             /* A source is ready                                    */
+                 break;
+
+            case OS_STATUS_PEND_ABORT:                          /* Indicate that we aborted                             */
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_PEND_ABORT;
+                 return (0u);
+
+            case OS_STATUS_PEND_TIMEOUT:                        /* Indicate that no source was ready within timeout     */
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_TIMEOUT;
+                 return (0u);
+
+            case OS_STATUS_PEND_DEL:                            /* Indicate that the reactor has been deleted           */
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_OBJ_DEL;
+                 return (0u);
+
+            default:
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_STATUS_INVALID;
+                 return (0u);
+        }
+    }
+
+    nbr_calls = 0u;
+    while (p_reactor->RdyTbl != 0u) {                           /* Dispatch the ready sources (see Note #2)             */
+        id                 = (CPU_INT08U)CPU_CntLeadZeros(p_reactor->RdyTbl);
+        p_reactor->RdyTbl &= ~OS_REACTOR_BIT(id);
+        p_src              =  p_reactor->SrcTbl[id];
+        p_fnct             =  p_src->FnctPtr;
+        p_obj              =  p_src->ObjPtr;
+        p_arg              =  p_src->FnctArg;
+        nbr_rdy            =  p_src->RdyCtr;
+        p_src->RdyCtr      =  0u;
+        CPU_CRITICAL_EXIT();
+        p_fnct((void *)p_obj, nbr_rdy, p_arg);
+        nbr_calls++;
+        CPU_CRITICAL_ENTER();
+    }
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+    return (nbr_calls);
+}
+
+
+/*
+************************************************************************************************************************
+*                                              REGISTER A REACTOR SOURCE
+*
+* Description: This function adds a source to a reactor.
+*
+* Arguments  : p_reactor     is a pointer to the reactor
+*
+*              p_src         is a pointer to the source.  Your application is responsible for allocating its storage.
+*
+*              id            is the ID of the source, from 0 to OS_REACTOR_SRC_NBR_MAX - 1.  The ready sources of lower
+*                            ID are dispatched first.
+*
+*              p_obj         is a pointer to the semaphore, the message queue or the event flag group to watch, or a
+*                            NULL pointer for a source made ready by OSReactorSrcSignal() (see Note #2).
+*
+*              p_fnct        is a pointer to the handler of the source.
+*
+*              p_arg         is the argument passed to the handler.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_reactor' or 'p_src' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE                If 'p_reactor' is not pointing at a reactor or
+*                                                                 'p_obj' at a semaphore, a queue or a flag group
+*                                OS_ERR_PTR_INVALID             If 'p_fnct' is a NULL pointer
+*                                OS_ERR_REACTOR_ID_INVALID      If 'id' is not a valid source ID
+*                                OS_ERR_REACTOR_ID_USED         If the reactor already has a source with this ID
+*                                OS_ERR_REACTOR_SRC_ATTACHED    If 'p_obj' is already watched by a source
+*
+* Returns    : none
+*
+* Note(s)    : 1) A semaphore with units or a queue with messages makes the source ready at once.
+*
+*              2) For a timer, pass a NULL pointer here and create the timer with OSReactorTmrCallback() as its
+*                 callback and 'p_src' as the argument of the callback.
+*
+*              3) Remove the source before deleting the object it watches.
+************************************************************************************************************************
+*/
+
+void  OSReactorSrcAdd (OS_REACTOR       *p_reactor,
+                       OS_REACTOR_SRC   *p_src,
+                       CPU_INT08U        id,
+                       OS_PEND_OBJ      *p_obj,
+                       OS_REACTOR_FNCT   p_fnct,
+                       void             *p_arg,
+                       OS_ERR           *p_err)
+{
+    CPU_BOOLEAN  rdy;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if ((p_reactor == (OS_REACTOR     *)0) ||                   /* Validate 'p_reactor' and 'p_src'                     */
+        (p_src     == (OS_REACTOR_SRC *)0)) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_fnct == (OS_REACTOR_FNCT)0) {                         /* A source needs a handler                             */
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    if (id >= OS_REACTOR_SRC_NBR_MAX) {                         /* Each source has a bit of '.RdyTbl'                   */
+       *p_err = OS_ERR_REACTOR_ID_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_reactor->Type != OS_OBJ_TYPE_REACTOR) {               /* Make sure reactor was created                        */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+    if (p_obj != (OS_PEND_OBJ *)0) {
+        switch (p_obj->Type) {                                  /* Only these objects notify their source               */
+#if (OS_CFG_SEM_EN > 0u)
+            case OS_OBJ_TYPE_SEM:
+#endif
+#if (OS_CFG_Q_EN > 0u)
+            case OS_OBJ_TYPE_Q:
+#endif
+#if (OS_CFG_FLAG_EN > 0u)
+            case OS_OBJ_TYPE_FLAG:
+#endif
+                 break;
+
+            default:
+                *p_err = OS_ERR_OBJ_TYPE;
+                 return;
+        }
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_reactor->SrcTbl[id] != (OS_REACTOR_SRC *)0) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_REACTOR_ID_USED;
+        return;
+    }
+    if (p_obj != (OS_PEND_OBJ *)0) {
+        if (p_obj->PendList.ReactorSrcPtr != (OS_REACTOR_SRC *)0) {
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_REACTOR_SRC_ATTACHED;
+            return;
+        }
+        p_obj->PendList.ReactorSrcPtr = p_src;
+    }
+    p_src->ReactorPtr     = p_reactor;
+    p_src->ObjPtr         = p_obj;
+    p_src->FnctPtr        = p_fnct;
+    p_src->FnctArg        = p_arg;
+    p_src->RdyCtr         = 0u;
+    p_src->Id             = id;
+#if (OS_CFG_TS_EN > 0u)
+    p_src->TS             = 0u;
+#endif
+    p_reactor->SrcTbl[id] = p_src;
+
+    rdy = OS_FALSE;                                             /* See Note #1                                          */
+    if (p_obj != (OS_PEND_OBJ *)0) {
+        switch (p_obj->Type) {
+#if (OS_CFG_SEM_EN > 0u)
+            case OS_OBJ_TYPE_SEM:
+                 if (((OS_SEM *)((void *)p_obj))->Ctr > 0u) {
+                     rdy = OS_ReactorSrcRdy(p_src, 0u);
+                 }
+                 break;
+#endif
+
+#if (OS_CFG_Q_EN > 0u)
+            case OS_OBJ_TYPE_Q:
+                 if (((OS_Q *)((void *)p_obj))->MsgQ.NbrEntries > 0u) {
+                     rdy = OS_ReactorSrcRdy(p_src, 0u);
+                 }
+                 break;
+#endif
+
+            default:
+                 break;
+        }
+    }
+    CPU_CRITICAL_EXIT();
+    if (rdy == OS_TRUE) {
+        OSSched();                                              /* The task of the reactor was waiting                  */
+    }
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                               REMOVE A REACTOR SOURCE
+*
+* Description: This function removes a source from its reactor.  The object the source watches stops notifying it and
+*              a pending dispatch of the source is cancelled.
+*
+* Arguments  : p_src         is a pointer to the source
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_src' is a NULL pointer
+*                                OS_ERR_REACTOR_SRC_NOT_ADDED   If the source is not registered with a reactor
+*
+* Returns    : none
+*
+* Note(s)    : 1) A timer that still calls OSReactorTmrCallback() with the source gets OS_ERR_REACTOR_SRC_NOT_ADDED,
+*                 stop or delete the timer first.
+************************************************************************************************************************
+*/
+
+void  OSReactorSrcRemove (OS_REACTOR_SRC  *p_src,
+                          OS_ERR          *p_err)
+{
+    OS_REACTOR  *p_reactor;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_src == (OS_REACTOR_SRC *)0) {                         /* Validate 'p_src'                                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_reactor = p_src->ReactorPtr;
+    if (p_reactor == (OS_REACTOR *)0) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_REACTOR_SRC_NOT_ADDED;
+        return;
+    }
+    if (p_src->ObjPtr != (OS_PEND_OBJ *)0) {
+        p_src->ObjPtr->PendList.ReactorSrcPtr = (OS_REACTOR_SRC *)0;
+    }
+    p_reactor->RdyTbl           &= ~OS_REACTOR_BIT(p_src->Id);
+    p_reactor->SrcTbl[p_src->Id] = (OS_REACTOR_SRC *)0;
+    p_src->ReactorPtr            = (OS_REACTOR     *)0;
+    p_src->ObjPtr                = (OS_PEND_OBJ    *)0;
+    p_src->RdyCtr                =  0u;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              MAKE A REACTOR SOURCE READY
+*
+* Description: This function makes a source ready, its handler is called by the next run of its reactor.
+*
+* Arguments  : p_src         is a pointer to the source
+*
+*              opt           determines the type of POST performed:
+*
+*                                OS_OPT_POST_NONE        No option
+*                                OS_OPT_POST_NO_SCHED    Do not call the scheduler
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_src' is a NULL pointer
+*                                OS_ERR_OPT_INVALID             If you specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                                OS_ERR_REACTOR_SRC_NOT_ADDED   If the source is not registered with a reactor
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function can be called from an ISR.  The events signalled before the dispatch are counted in
+*                 the 'nbr_rdy' argument of the handler.
+************************************************************************************************************************
+*/
+
+void  OSReactorSrcSignal (OS_REACTOR_SRC  *p_src,
+                          OS_OPT           opt,
+                          OS_ERR          *p_err)
+{
+    CPU_BOOLEAN  rdy;
+    CPU_TS       ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_src == (OS_REACTOR_SRC *)0) {                         /* Validate 'p_src'                                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_src->ReactorPtr == (OS_REACTOR *)0) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_REACTOR_SRC_NOT_ADDED;
+        return;
+    }
+    rdy = OS_ReactorSrcRdy(p_src, ts);
+    CPU_CRITICAL_EXIT();
+
+    if ((rdy                          == OS_TRUE) &&
+        ((opt & OS_OPT_POST_NO_SCHED) ==      0u)) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              REACTOR TIMER CALLBACK
+*
+* Description: This function is the callback to give to the timers that are sources of a reactor.  It makes the source
+*              passed as the argument of the callback ready.
+*
+* Arguments  : p_tmr         is a pointer to the timer that expired
+*
+*              p_arg         is a pointer to the source registered for the timer
+*
+* Returns    : none
+*
+* Note(s)    : 1) An error of OSReactorSrcSignal() is ignored: the timer has no one to report it to.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TMR_EN > 0u)
+void  OSReactorTmrCallback (void  *p_tmr,
+                            void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_tmr;
+
+    OSReactorSrcSignal((OS_REACTOR_SRC *)p_arg,
+                       OS_OPT_POST_NONE,
+                      &err);
+    (void)err;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                          CLEAR THE CONTENTS OF A REACTOR
+*
+* Description: This function is called by OSReactorDel() to clear the contents of a reactor
+*
+* Argument(s): p_reactor     is a pointer to the reactor to clear
+*              ---------
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_ReactorClr (OS_REACTOR  *p_reactor)
+{
+    CPU_INT08U  id;
+
+
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_reactor->Type    =  OS_OBJ_TYPE_NONE;                     /* Mark the data structure as a NONE                    */
+#endif
+    p_reactor->TCBPtr  = (OS_TCB *)0;
+    p_reactor->RdyTbl  =  0u;
+    for (id = 0u; id < OS_REACTOR_SRC_NBR_MAX; id++) {
+        p_reactor->SrcTbl[id] = (OS_REACTOR_SRC *)0;
+    }
+#if (OS_CFG_DBG_EN > 0u)
+    p_reactor->NamePtr = (CPU_CHAR *)((void *)"?REACTOR");
+#endif
+}
+
+
+/*
+************************************************************************************************************************
+*                                         ADD/REMOVE REACTOR TO/FROM DEBUG LIST
+*
+* Description: These functions are called by uC/OS-III to add or remove a reactor to/from the debug list.
+*
+* Arguments  : p_reactor    is a pointer to the reactor to add/remove
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN > 0u)
+void  OS_ReactorDbgListAdd (OS_REACTOR  *p_reactor)
+{
+    p_reactor->DbgPrevPtr               = (OS_REACTOR *)0;
+    if (OSReactorDbgListPtr == (OS_REACTOR *)0) {
+        p_reactor->DbgNextPtr           = (OS_REACTOR *)0;
+    } else {
+        p_reactor->DbgNextPtr           =  OSReactorDbgListPtr;
+        OSReactorDbgListPtr->DbgPrevPtr =  p_reactor;
+    }
+    OSReactorDbgListPtr                 =  p_reactor;
+}
+
+
+void  OS_ReactorDbgListRemove (OS_REACTOR  *p_reactor)
+{
+    OS_REACTOR  *p_reactor_next;
+    OS_REACTOR  *p_reactor_prev;
+
+
+    p_reactor_prev = p_reactor->DbgPrevPtr;
+    p_reactor_next = p_reactor->DbgNextPtr;
+
+    if (p_reactor_prev == (OS_REACTOR *)0) {
+        OSReactorDbgListPtr = p_reactor_next;
+        if (p_reactor_next != (OS_REACTOR *)0) {
+            p_reactor_next->DbgPrevPtr = (OS_REACTOR *)0;
+        }
+        p_reactor->DbgNextPtr = (OS_REACTOR *)0;
+
+    } else if (p_reactor_next == (OS_REACTOR *)0) {
+        p_reactor_prev->DbgNextPtr = (OS_REACTOR *)0;
+        p_reactor->DbgPrevPtr      = (OS_REACTOR *)0;
+
+    } else {
+        p_reactor_prev->DbgNextPtr =  p_reactor_next;
+        p_reactor_next->DbgPrevPtr =  p_reactor_prev;
+        p_reactor->DbgNextPtr      = (OS_REACTOR *)0;
+        p_reactor->DbgPrevPtr      = (OS_REACTOR *)0;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                      RELEASE THE REACTOR A TASK IS WAITING ON
+*
+* Description: This function is called by OS_PendListRemove() when the task waiting in OSReactorRun() stops waiting
+*              because of a timeout, an abort, the deletion of the reactor or the deletion of the task.
+*
+* Argument(s): p_tcb         is a pointer to the TCB of the task
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_ReactorPendRemove (OS_TCB  *p_tcb)
+{
+    OS_REACTOR  *p_reactor;
+
+
+    p_reactor         = (OS_REACTOR  *)((void *)p_tcb->PendObjPtr);
+    p_reactor->TCBPtr = (OS_TCB      *)0;
+    p_tcb->PendObjPtr = (OS_PEND_OBJ *)0;                       /* There is no pend list to remove the task from        */
+}
+
+
+/*
+************************************************************************************************************************
+*                                            RECORD AN EVENT OF A SOURCE
+*
+* Description: This function marks a source as ready and readies the task waiting in OSReactorRun(), if any.  It is
+*              called by the posts to the object the source watches and by OSReactorSrcSignal().
+*
+* Arguments  : p_src         is a pointer to the source, may be a NULL pointer
+*
+*              ts            is the timestamp of the event
+*
+* Returns    : OS_TRUE       if the task of the reactor was readied, the caller has to run the scheduler
+*              OS_FALSE      otherwise
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function MUST be called within a critical section.
+************************************************************************************************************************
+*/
+
+CPU_BOOLEAN  OS_ReactorSrcRdy (OS_REACTOR_SRC  *p_src,
+                               CPU_TS           ts)
+{
+    OS_REACTOR  *p_reactor;
+    OS_TCB      *p_tcb;
+
+
+    if (p_src == (OS_REACTOR_SRC *)0) {                         /* The object is not watched                            */
+        return (OS_FALSE);
+    }
+
+    if (p_src->RdyCtr < (OS_OBJ_QTY)-1) {                       /* Count the events, saturating                         */
+        p_src->RdyCtr++;
+    }
+#if (OS_CFG_TS_EN > 0u)
+    p_src->TS          = ts;
+#endif
+    p_reactor          = p_src->ReactorPtr;
+    p_reactor->RdyTbl |= OS_REACTOR_BIT(p_src->Id);
+
+    p_tcb = p_reactor->TCBPtr;
+    if (p_tcb == (OS_TCB *)0) {                                 /* Is the task of the reactor waiting?                  */
+        return (OS_FALSE);
+    }
+    p_reactor->TCBPtr = (OS_TCB      *)0;
+    p_tcb->PendObjPtr = (OS_PEND_OBJ *)0;
+    OS_Post((OS_PEND_OBJ *)0,
+            p_tcb,
+            (void *)0,
+            0u,
+            ts);
+    return (OS_TRUE);
+}
+#endif
@@ -0,0 +1,1050 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        RING BUFFER MANAGEMENT
+*
+* File    : os_ring.c
+* Version : V3.08.00
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#define  OS_CRIT_SITE_ID                    OS_CRIT_SITE_RING
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_ring__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_RING_EN > 0u)
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  void    *OS_RingElemGet   (OS_RING     *p_ring,
+                                   OS_MSG_QTY   ix);
+
+static  OS_TCB  *OS_RingWaiterGet (OS_RING     *p_ring,
+                                   OS_STATE     pending_on);
+
+
+/*
+************************************************************************************************************************
+*                                                 CREATE A RING BUFFER
+*
+* Description: This function is called by your application to create a ring buffer over a block of memory that you
+*              supply.  The block is divided in 'nbr_elem' fixed-size elements which are filled and consumed in place:
+*
+*                  producer:  OSRingReserve() -> write the element -> OSRingCommit()
+*                  consumer:  OSRingPeek()    -> read  the element -> OSRingRelease()
+*
+*              Ring buffers MUST be created before they can be used.
+*
+* Arguments  : p_ring      is a pointer to the ring buffer
+*
+*              p_name      is a pointer to an ASCII string that will be used to name the ring buffer
+*
+*              p_buf       is a pointer to the storage for the elements.  It must be at least 'elem_size * nbr_elem'
+*                          bytes and suitably aligned for the type of data placed in the elements.
+*
+*              elem_size   is the size of each element (in bytes)
+*
+*              nbr_elem    is the number of elements in the ring buffer (must be non-zero)
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                    The call was successful
+*                              OS_ERR_CREATE_ISR              Can't create from an ISR
+*                              OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the ring buffer after you
+*                                                               called OSSafetyCriticalStart()
+*                              OS_ERR_OBJ_PTR_NULL            If you passed a NULL pointer for 'p_ring'
+*                              OS_ERR_PTR_INVALID             If you passed a NULL pointer for 'p_buf'
+*                              OS_ERR_RING_SIZE               If 'elem_size' or 'nbr_elem' is 0
+*                              OS_ERR_OBJ_CREATED             If the ring buffer was already created
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSRingCreate (OS_RING      *p_ring,
+                    CPU_CHAR     *p_name,
+                    void         *p_buf,
+                    OS_MSG_SIZE   elem_size,
+                    OS_MSG_QTY    nbr_elem,
+                    OS_ERR       *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_ring == (OS_RING *)0) {                               /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_buf == (void *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    if ((elem_size == 0u) ||                                    /* Cannot specify a zero size ring buffer               */
+        (nbr_elem  == 0u)) {
+       *p_err = OS_ERR_RING_SIZE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
+    if (p_ring->Type == OS_OBJ_TYPE_RING) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+    p_ring->Type        = OS_OBJ_TYPE_RING;                     /* Mark the data structure as a ring buffer             */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_ring->NamePtr     = p_name;
+#else
+    (void)p_name;
+#endif
+    p_ring->BufPtr      = (CPU_INT08U *)p_buf;                  /* Initialize the ring buffer                           */
+    p_ring->ElemSize    = elem_size;
+    p_ring->NbrElem     = nbr_elem;
+    p_ring->InIx        = 0u;
+    p_ring->OutIx       = 0u;
+    p_ring->NbrFree     = nbr_elem;
+    p_ring->NbrReserved = 0u;
+    p_ring->NbrRdy      = 0u;
+    p_ring->NbrPeeked   = 0u;
+    OS_PendListInit(&p_ring->PendList);                         /* Initialize the waiting list                          */
+
+#if (OS_CFG_DBG_EN > 0u)
+    OS_RingDbgListAdd(p_ring);
+    OSRingQty++;                                                /* One more ring buffer created                         */
+#endif
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 DELETE A RING BUFFER
+*
+* Description: This function deletes a ring buffer and readies all tasks pending on it.
+*
+* Arguments  : p_ring    is a pointer to the ring buffer you want to delete
+*
+*              opt       determines delete options as follows:
+*
+*                            OS_OPT_DEL_NO_PEND          Delete the ring buffer ONLY if no task pending
+*                            OS_OPT_DEL_ALWAYS           Deletes the ring buffer even if tasks are waiting.
+*                                                        In this case, all the tasks pending will be readied.
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                    The call was successful and the ring buffer was deleted
+*                            OS_ERR_DEL_ISR                 If you tried to delete the ring buffer from an ISR
+*                            OS_ERR_ILLEGAL_DEL_RUN_TIME    If you are trying to delete the ring buffer after you
+*                                                             called OSStart()
+*                            OS_ERR_OBJ_PTR_NULL            If you pass a NULL pointer for 'p_ring'
+*                            OS_ERR_OBJ_TYPE                If the ring buffer was not created
+*                            OS_ERR_OPT_INVALID             An invalid option was specified
+*                            OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                            OS_ERR_TASK_WAITING            One or more tasks were waiting on the ring buffer
+*
+* Returns    : == 0          if no tasks were waiting on the ring buffer, or upon error.
+*              >  0          if one or more tasks waiting on the ring buffer are now readied and informed.
+*
+* Note(s)    : 1) This function must be used with care.  Tasks that would normally expect the presence of the ring
+*                 buffer MUST check the return code of OSRingReserve() and OSRingPeek().
+*
+*              2) Elements that are still reserved or peeked when the ring buffer is deleted MUST no longer be
+*                 accessed.  The storage supplied to OSRingCreate() may be reused once this function returns.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_RING_DEL_EN > 0u)
+OS_OBJ_QTY  OSRingDel (OS_RING  *p_ring,
+                       OS_OPT    opt,
+                       OS_ERR   *p_err)
+{
+    OS_OBJ_QTY     nbr_tasks;
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't delete a ring buffer from an ISR               */
+       *p_err = OS_ERR_DEL_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_ring == (OS_RING *)0) {                               /* Validate 'p_ring'                                    */
+       *p_err =  OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_ring->Type != OS_OBJ_TYPE_RING) {                     /* Make sure ring buffer was created                    */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_ring->PendList;
+    nbr_tasks   = 0u;
+    switch (opt) {
+        case OS_OPT_DEL_NO_PEND:                                /* Delete ring buffer only if no task waiting           */
+             if (p_pend_list->HeadPtr == (OS_TCB *)0) {
+#if (OS_CFG_DBG_EN > 0u)
+                 OS_RingDbgListRemove(p_ring);
+                 OSRingQty--;
+#endif
+                 OS_RingClr(p_ring);
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_NONE;
+             } else {
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_TASK_WAITING;
+             }
+             break;
+
+        case OS_OPT_DEL_ALWAYS:                                 /* Always delete the ring buffer                        */
+#if (OS_CFG_TS_EN > 0u)
+             ts = OS_TS_GET();                                  /* Get local time stamp so all tasks get the same time  */
+#else
+             ts = 0u;
+#endif
+             while (p_pend_list->HeadPtr != (OS_TCB *)0) {      /* Remove all tasks from the pend list                  */
+                 p_tcb = p_pend_list->HeadPtr;
+                 OS_PendAbort(p_tcb,
+                              ts,
+                              OS_STATUS_PEND_DEL);
+                 nbr_tasks++;
+             }
+#if (OS_CFG_DBG_EN > 0u)
+             OS_RingDbgListRemove(p_ring);
+             OSRingQty--;
+#endif
+             OS_RingClr(p_ring);
+             CPU_CRITICAL_EXIT();
+             OSSched();                                         /* Find highest priority task ready to run              */
+            *p_err = OS_ERR_NONE;
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_OPT_INVALID;
+             break;
+    }
+    return (nbr_tasks);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                        RESERVE AN ELEMENT IN A RING BUFFER
+*
+* Description: This function is called by a producer to obtain the next free element of a ring buffer.  The element
+*              is filled in place and then made available to consumers by calling OSRingCommit().
+*
+* Arguments  : p_ring        is a pointer to the ring buffer
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for an
+*                            element to become free up to the amount of time specified by this argument.  If you
+*                            specify 0, however, your task will wait forever or, until an element is released.
+*
+*              opt           determines whether the user wants to block if the ring buffer is full or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*                            Add OS_OPT_PEND_ABS to make 'timeout' the value of OSTickCtr at which to give up.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and an element was reserved
+*                                OS_ERR_OBJ_DEL            If 'p_ring' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If you pass a NULL pointer for 'p_ring'
+*                                OS_ERR_OBJ_TYPE           If the ring buffer was not created
+*                                OS_ERR_OPT_INVALID        You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         The pend was aborted
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR and the ring buffer
+*                                                          would need to block
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the ring buffer was full
+*                                OS_ERR_SCHED_LOCKED       The scheduler is locked
+*                                OS_ERR_STATUS_INVALID     If the pend status has an invalid value
+*                                OS_ERR_TIMEOUT            No element was freed within the specified timeout
+*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*
+* Returns    : != (void *)0  is a pointer to the element reserved ('elem_size' bytes)
+*              == (void *)0  if no element was reserved
+*
+* Note(s)    : 1) Elements are committed in the order they were reserved.  When more than one task produces into the
+*                 same ring buffer, the application must make sure each reservation is committed before the next
+*                 one is made (e.g. by guarding the reserve/commit pair with a mutex).
+*
+*              2) This API 'MUST NOT' be called from a timer callback function.
+************************************************************************************************************************
+*/
+
+void  *OSRingReserve (OS_RING  *p_ring,
+                      OS_TICK   timeout,
+                      OS_OPT    opt,
+                      OS_ERR   *p_err)
+{
+    void  *p_elem;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to block from an ISR                     */
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != OS_OPT_PEND_NON_BLOCKING) {
+           *p_err = OS_ERR_PEND_ISR;
+            return ((void *)0);
+        }
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_ring == (OS_RING *)0) {                               /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return ((void *)0);
+    }
+    switch (opt & (OS_OPT)~OS_OPT_PEND_ABS) {
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_ring->Type != OS_OBJ_TYPE_RING) {                     /* Make sure ring buffer was created                    */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return ((void *)0);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_ring->NbrFree > 0u) {                                 /* Any free element?                                    */
+        p_elem        = OS_RingElemGet(p_ring, p_ring->InIx);   /* Yes, reserve the next one                            */
+        p_ring->InIx  = (p_ring->InIx < (p_ring->NbrElem - 1u)) ? (p_ring->InIx + 1u) : 0u;
+        p_ring->NbrFree--;
+        p_ring->NbrReserved++;
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return (p_elem);
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                        /* No                                                   */
+        return ((void *)0);
+    } else {
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return ((void *)0);
+        }
+    }
+
+    OS_PEND_ABS_SET(OSTCBCurPtr, opt);
+    OS_Pend((OS_PEND_OBJ *)((void *)p_ring),                    /* Block task until an element is released              */
+            OSTCBCurPtr,
+            OS_TASK_PEND_ON_RING_SPACE,
+            timeout);
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* Element was reserved for us by OSRingRelease()       */
+             p_elem = OSTCBCurPtr->MsgPtr;
+            *p_err  = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+             p_elem = (void *)0;
+            *p_err  = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that we didn't get an element within TO     */
+             p_elem = (void *)0;
+            *p_err  = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+             p_elem = (void *)0;
+            *p_err  = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+             p_elem = (void *)0;
+            *p_err  = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+    return (p_elem);
+}
+
+
+/*
+************************************************************************************************************************
+*                                      COMMIT A RESERVED ELEMENT OF A RING BUFFER
+*
+* Description: This function makes the oldest element reserved with OSRingReserve() available to consumers.  If a task
+*              is waiting in OSRingPeek(), the element is handed directly to the highest priority one.
+*
+* Arguments  : p_ring        is a pointer to the ring buffer
+*
+*              opt           determines the type of POST performed:
+*
+*                                OS_OPT_POST_NONE         No option selected
+*                                OS_OPT_POST_NO_SCHED     Do not call the scheduler
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              The call was successful and the element was committed
+*                                OS_ERR_OBJ_PTR_NULL      If 'p_ring' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE          If the ring buffer was not created
+*                                OS_ERR_OPT_INVALID       You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*                                OS_ERR_RING_COMMIT_NONE  If no element was reserved
+*
+* Returns    : None
+*
+* Note(s)    : 1) This function may be called from an ISR.
+************************************************************************************************************************
+*/
+
+void  OSRingCommit (OS_RING  *p_ring,
+                    OS_OPT    opt,
+                    OS_ERR   *p_err)
+{
+    OS_TCB  *p_tcb;
+    void    *p_elem;
+    CPU_TS   ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_ring == (OS_RING *)0) {                               /* Validate 'p_ring'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_ring->Type != OS_OBJ_TYPE_RING) {                     /* Make sure ring buffer was created                    */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_ring->NbrReserved == 0u) {                            /* Anything to commit?                                  */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_RING_COMMIT_NONE;
+        return;
+    }
+    p_ring->NbrReserved--;
+
+    p_tcb = OS_RingWaiterGet(p_ring, OS_TASK_PEND_ON_RING_DATA);
+    if (p_tcb == (OS_TCB *)0) {                                 /* Any consumer waiting for an element?                 */
+        p_ring->NbrRdy++;                                       /* No, element is ready for the next OSRingPeek()       */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    p_elem        = OS_RingElemGet(p_ring, p_ring->OutIx);      /* Yes, peek the element on behalf of the consumer      */
+    p_ring->OutIx = (p_ring->OutIx < (p_ring->NbrElem - 1u)) ? (p_ring->OutIx + 1u) : 0u;
+    p_ring->NbrPeeked++;
+    OS_Post((OS_PEND_OBJ *)((void *)p_ring),
+            p_tcb,
+            p_elem,
+            p_ring->ElemSize,
+            ts);
+    CPU_CRITICAL_EXIT();
+
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                          PEEK AT THE NEXT ELEMENT OF A RING BUFFER
+*
+* Description: This function is called by a consumer to obtain the oldest committed element of a ring buffer.  The
+*              element is read in place and then returned to the producers by calling OSRingRelease().
+*
+* Arguments  : p_ring        is a pointer to the ring buffer
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for an
+*                            element to be committed up to the amount of time specified by this argument.  If you
+*                            specify 0, however, your task will wait forever or, until an element is committed.
+*
+*              opt           determines whether the user wants to block if the ring buffer is empty or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*                            Add OS_OPT_PEND_ABS to make 'timeout' the value of OSTickCtr at which to give up.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and your task got an element
+*                                OS_ERR_OBJ_DEL            If 'p_ring' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If you pass a NULL pointer for 'p_ring'
+*                                OS_ERR_OBJ_TYPE           If the ring buffer was not created
+*                                OS_ERR_OPT_INVALID        You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         The pend was aborted
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR and the ring buffer
+*                                                          would need to block
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the ring buffer was empty
+*                                OS_ERR_SCHED_LOCKED       The scheduler is locked
+*                                OS_ERR_STATUS_INVALID     If the pend status has an invalid value
+*                                OS_ERR_TIMEOUT            No element was committed within the specified timeout
+*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*
+* Returns    : != (void *)0  is a pointer to the element ('elem_size' bytes)
+*              == (void *)0  if no element was obtained
+*
+* Note(s)    : 1) Elements are released in the order they were peeked.  When more than one task consumes from the
+*                 same ring buffer, the application must make sure each element is released before the next one is
+*                 peeked.
+*
+*              2) This API 'MUST NOT' be called from a timer callback function.
+************************************************************************************************************************
+*/
+
+void  *OSRingPeek (OS_RING  *p_ring,
+                   OS_TICK   timeout,
+                   OS_OPT    opt,
+                   OS_ERR   *p_err)
+{
+    void  *p_elem;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to block from an ISR                     */
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != OS_OPT_PEND_NON_BLOCKING) {
+           *p_err = OS_ERR_PEND_ISR;
+            return ((void *)0);
+        }
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_ring == (OS_RING *)0) {                               /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return ((void *)0);
+    }
+    switch (opt & (OS_OPT)~OS_OPT_PEND_ABS) {
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_ring->Type != OS_OBJ_TYPE_RING) {                     /* Make sure ring buffer was created                    */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return ((void *)0);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_ring->NbrRdy > 0u) {                                  /* Any element committed?                               */
+        p_elem        = OS_RingElemGet(p_ring, p_ring->OutIx);  /* Yes, peek the oldest one                             */
+        p_ring->OutIx = (p_ring->OutIx < (p_ring->NbrElem - 1u)) ? (p_ring->OutIx + 1u) : 0u;
+        p_ring->NbrRdy--;
+        p_ring->NbrPeeked++;
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return (p_elem);
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                        /* No                                                   */
+        return ((void *)0);
+    } else {
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return ((void *)0);
+        }
+    }
+
+    OS_PEND_ABS_SET(OSTCBCurPtr, opt);
+    OS_Pend((OS_PEND_OBJ *)((void *)p_ring),                    /* Block task until an element is committed             */
+            OSTCBCurPtr,
+            OS_TASK_PEND_ON_RING_DATA,
+            timeout);
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* Element was peeked for us by OSRingCommit()          */
+             p_elem = OSTCBCurPtr->MsgPtr;
+            *p_err  = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+             p_elem = (void *)0;
+            *p_err  = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that we didn't get an element within TO     */
+             p_elem = (void *)0;
+            *p_err  = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+             p_elem = (void *)0;
+            *p_err  = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+             p_elem = (void *)0;
+            *p_err  = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+    return (p_elem);
+}
+
+
+/*
+************************************************************************************************************************
+*                                       RELEASE A PEEKED ELEMENT OF A RING BUFFER
+*
+* Description: This function returns the oldest element obtained with OSRingPeek() to the producers.  If a task is
+*              waiting in OSRingReserve(), the element is reserved directly for the highest priority one.
+*
+* Arguments  : p_ring        is a pointer to the ring buffer
+*
+*              opt           determines the type of POST performed:
+*
+*                                OS_OPT_POST_NONE         No option selected
+*                                OS_OPT_POST_NO_SCHED     Do not call the scheduler
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              The call was successful and the element was released
+*                                OS_ERR_OBJ_PTR_NULL      If 'p_ring' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE          If the ring buffer was not created
+*                                OS_ERR_OPT_INVALID       You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*                                OS_ERR_RING_RELEASE_NONE If no element was peeked
+*
+* Returns    : None
+*
+* Note(s)    : 1) This function may be called from an ISR.
+************************************************************************************************************************
+*/
+
+void  OSRingRelease (OS_RING  *p_ring,
+                     OS_OPT    opt,
+                     OS_ERR   *p_err)
+{
+    OS_TCB  *p_tcb;
+    void    *p_elem;
+    CPU_TS   ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_ring == (OS_RING *)0) {                               /* Validate 'p_ring'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_ring->Type != OS_OBJ_TYPE_RING) {                     /* Make sure ring buffer was created                    */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_ring->NbrPeeked == 0u) {                              /* Anything to release?                                 */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_RING_RELEASE_NONE;
+        return;
+    }
+    p_ring->NbrPeeked--;
+
+    p_tcb = OS_RingWaiterGet(p_ring, OS_TASK_PEND_ON_RING_SPACE);
+    if (p_tcb == (OS_TCB *)0) {                                 /* Any producer waiting for an element?                 */
+        p_ring->NbrFree++;                                      /* No, element is free for the next OSRingReserve()     */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    p_elem       = OS_RingElemGet(p_ring, p_ring->InIx);        /* Yes, reserve the element on behalf of the producer   */
+    p_ring->InIx = (p_ring->InIx < (p_ring->NbrElem - 1u)) ? (p_ring->InIx + 1u) : 0u;
+    p_ring->NbrReserved++;
+    OS_Post((OS_PEND_OBJ *)((void *)p_ring),
+            p_tcb,
+            p_elem,
+            p_ring->ElemSize,
+            ts);
+    CPU_CRITICAL_EXIT();
+
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              CLEAR THE CONTENTS OF A RING BUFFER
+*
+* Description: This function is called by OSRingDel() to clear the contents of a ring buffer
+*
+* Argument(s): p_ring   is a pointer to the ring buffer to clear
+*              ------
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_RingClr (OS_RING  *p_ring)
+{
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_ring->Type        =  OS_OBJ_TYPE_NONE;                    /* Mark the data structure as a NONE                    */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_ring->NamePtr     = (CPU_CHAR *)((void *)"?RING");
+#endif
+    p_ring->BufPtr      = (CPU_INT08U *)0;
+    p_ring->ElemSize    =               0u;
+    p_ring->NbrElem     =               0u;
+    p_ring->InIx        =               0u;
+    p_ring->OutIx       =               0u;
+    p_ring->NbrFree     =               0u;
+    p_ring->NbrReserved =               0u;
+    p_ring->NbrRdy      =               0u;
+    p_ring->NbrPeeked   =               0u;
+    OS_PendListInit(&p_ring->PendList);                         /* Initialize the waiting list                          */
+}
+
+
+/*
+************************************************************************************************************************
+*                                       ADD/REMOVE RING BUFFER TO/FROM DEBUG LIST
+*
+* Description: These functions are called by uC/OS-III to add or remove a ring buffer to/from the ring buffer debug
+*              list.
+*
+* Arguments  : p_ring  is a pointer to the ring buffer to add/remove
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN > 0u)
+void  OS_RingDbgListAdd (OS_RING  *p_ring)
+{
+    p_ring->DbgNamePtr               = (CPU_CHAR *)((void *)" ");
+    p_ring->DbgPrevPtr               = (OS_RING *)0;
+    if (OSRingDbgListPtr == (OS_RING *)0) {
+        p_ring->DbgNextPtr           = (OS_RING *)0;
+    } else {
+        p_ring->DbgNextPtr           =  OSRingDbgListPtr;
+        OSRingDbgListPtr->DbgPrevPtr =  p_ring;
+    }
+    OSRingDbgListPtr                 =  p_ring;
+}
+
+
+void  OS_RingDbgListRemove (OS_RING  *p_ring)
+{
+    OS_RING  *p_ring_next;
+    OS_RING  *p_ring_prev;
+
+
+    p_ring_prev = p_ring->DbgPrevPtr;
+    p_ring_next = p_ring->DbgNextPtr;
+
+    if (p_ring_prev == (OS_RING *)0) {
+        OSRingDbgListPtr = p_ring_next;
+        if (p_ring_next != (OS_RING *)0) {
+            p_ring_next->DbgPrevPtr = (OS_RING *)0;
+        }
+        p_ring->DbgNextPtr = (OS_RING *)0;
+
+    } else if (p_ring_next == (OS_RING *)0) {
+        p_ring_prev->DbgNextPtr = (OS_RING *)0;
+        p_ring->DbgPrevPtr      = (OS_RING *)0;
+
+    } else {
+        p_ring_prev->DbgNextPtr =  p_ring_next;
+        p_ring_next->DbgPrevPtr =  p_ring_prev;
+        p_ring->DbgNextPtr      = (OS_RING *)0;
+        p_ring->DbgPrevPtr      = (OS_RING *)0;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                            GET THE ADDRESS OF AN ELEMENT
+*
+* Description: This function returns the address of element 'ix' of a ring buffer.
+*
+* Arguments  : p_ring   is a pointer to the ring buffer
+*
+*              ix       is the index of the element (0 .. NbrElem - 1)
+*
+* Returns    : A pointer to the element
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  void  *OS_RingElemGet (OS_RING     *p_ring,
+                               OS_MSG_QTY   ix)
+{
+    return ((void *)(p_ring->BufPtr + ((CPU_SIZE_T)ix * (CPU_SIZE_T)p_ring->ElemSize)));
+}
+
+
+/*
+************************************************************************************************************************
+*                                       FIND A TASK WAITING ON ONE SIDE OF A RING BUFFER
+*
+* Description: Producers waiting for a free element and consumers waiting for a committed element share the pend
+*              list of the ring buffer.  This function returns the highest priority task waiting for 'pending_on'.
+*
+* Arguments  : p_ring       is a pointer to the ring buffer
+*
+*              pending_on   is the side of interest:
+*
+*                               OS_TASK_PEND_ON_RING_DATA     consumers blocked in OSRingPeek()
+*                               OS_TASK_PEND_ON_RING_SPACE    producers blocked in OSRingReserve()
+*
+* Returns    : A pointer to the OS_TCB of the task found or, a NULL pointer if no such task is waiting
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Both kinds of waiters are only present at the same time when every element is either reserved or
+*                 peeked, so the search normally stops at the head of the list.
+************************************************************************************************************************
+*/
+
+static  OS_TCB  *OS_RingWaiterGet (OS_RING   *p_ring,
+                                   OS_STATE   pending_on)
+{
+    OS_TCB  *p_tcb;
+
+
+    p_tcb = p_ring->PendList.HeadPtr;
+    while (p_tcb != (OS_TCB *)0) {
+        if (p_tcb->PendOn == pending_on) {
+            break;
+        }
+        p_tcb = p_tcb->PendNextPtr;
+    }
+    return (p_tcb);
+}
+#endif
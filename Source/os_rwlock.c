@@ -0,0 +1,1328 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                     READER/WRITER LOCK MANAGEMENT
+*
+* File    : os_rwlock.c
+* Version : V3.08.00
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#define  OS_CRIT_SITE_ID                    OS_CRIT_SITE_RWLOCK
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_rwlock__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_RWLOCK_EN > 0u)
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  void             OS_RwLockPend        (OS_RWLOCK       *p_rwlock,
+                                               OS_TICK          timeout,
+                                               OS_OPT           opt,
+                                               CPU_TS          *p_ts,
+                                               OS_STATE         pending_on,
+                                               OS_ERR          *p_err);
+
+static  void             OS_RwLockGrant       (OS_RWLOCK       *p_rwlock,
+                                               CPU_TS           ts);
+
+static  OS_RWLOCK_HOLD  *OS_RwLockHoldAdd     (OS_RWLOCK       *p_rwlock,
+                                               OS_TCB          *p_tcb,
+                                               OS_STATE         pending_on);
+
+static  OS_RWLOCK_HOLD  *OS_RwLockHoldFind    (OS_RWLOCK       *p_rwlock,
+                                               OS_TCB          *p_tcb);
+
+static  void             OS_RwLockHoldRemove  (OS_RWLOCK_HOLD  *p_hold);
+
+#if (OS_CFG_RWLOCK_DEL_EN > 0u)
+static  void             OS_RwLockHoldRemoveAll(OS_RWLOCK      *p_rwlock);
+#endif
+
+static  void             OS_RwLockTaskPrioSet (OS_TCB          *p_tcb);
+
+
+/*
+************************************************************************************************************************
+*                                            CREATE A READER/WRITER LOCK
+*
+* Description: This function creates a reader/writer lock.  Any number of tasks may own the lock for reading at the
+*              same time, while a task that owns it for writing owns it alone.
+*
+* Arguments  : p_rwlock      is a pointer to the reader/writer lock to initialize.  Your application is responsible
+*                            for allocating storage for the lock.
+*
+*              p_name        is a pointer to the name you would like to give the reader/writer lock.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_CREATE_ISR              If you called this function from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the lock after you called
+*                                                                 OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_rwlock' is a NULL pointer
+*                                OS_ERR_OBJ_CREATED             If the lock was already created
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSRwLockCreate (OS_RWLOCK  *p_rwlock,
+                      CPU_CHAR   *p_name,
+                      OS_ERR     *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_rwlock == (OS_RWLOCK *)0) {                           /* Validate 'p_rwlock'                                  */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
+    if (p_rwlock->Type == OS_OBJ_TYPE_RWLOCK) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+    p_rwlock->Type          =  OS_OBJ_TYPE_RWLOCK;              /* Mark the data structure as a reader/writer lock      */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_rwlock->NamePtr       =  p_name;
+#else
+    (void)p_name;
+#endif
+    p_rwlock->HoldHeadPtr   = (OS_RWLOCK_HOLD *)0;
+    p_rwlock->WrOwnerTCBPtr = (OS_TCB         *)0;
+    p_rwlock->RdCtr         =                   0u;             /* Lock is available                                    */
+#if (OS_CFG_TS_EN > 0u)
+    p_rwlock->TS            =                   0u;
+#endif
+    OS_PendListInit(&p_rwlock->PendList);                       /* Initialize the waiting list                          */
+
+#if (OS_CFG_DBG_EN > 0u)
+    OS_RwLockDbgListAdd(p_rwlock);
+    OSRwLockQty++;
+#endif
+
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                            DELETE A READER/WRITER LOCK
+*
+* Description: This function deletes a reader/writer lock and readies all tasks pending on it.
+*
+* Arguments  : p_rwlock      is a pointer to the reader/writer lock to delete
+*
+*              opt           determines delete options as follows:
+*
+*                                OS_OPT_DEL_NO_PEND          Delete the lock ONLY if no task pending
+*                                OS_OPT_DEL_ALWAYS           Deletes the lock even if tasks are waiting.
+*                                                            In this case, all the tasks pending will be readied.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    The call was successful and the lock was deleted
+*                                OS_ERR_DEL_ISR                 If you attempted to delete the lock from an ISR
+*                                OS_ERR_ILLEGAL_DEL_RUN_TIME    If you are trying to delete the lock after you called
+*                                                                 OSStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_rwlock' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE                If 'p_rwlock' is not pointing to a reader/writer lock
+*                                OS_ERR_OPT_INVALID             An invalid option was specified
+*                                OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                                OS_ERR_TASK_WAITING            One or more tasks were waiting on the lock
+*
+* Returns    : == 0          if no tasks were waiting on the lock, or upon error.
+*              >  0          if one or more tasks waiting on the lock are now readied and informed.
+*
+* Note(s)    : 1) This function must be used with care.  Tasks that would normally expect the presence of the lock
+*                 MUST check the return code of OSRwLockPendRd() and OSRwLockPendWr().
+*
+*              2) The tasks that own the lock when it is deleted no longer own it and lose the priority they inherited
+*                 through it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_RWLOCK_DEL_EN > 0u)
+OS_OBJ_QTY  OSRwLockDel (OS_RWLOCK  *p_rwlock,
+                         OS_OPT      opt,
+                         OS_ERR     *p_err)
+{
+    OS_OBJ_QTY     nbr_tasks;
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to delete a lock from an ISR             */
+       *p_err = OS_ERR_DEL_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_rwlock == (OS_RWLOCK *)0) {                           /* Validate 'p_rwlock'                                  */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_rwlock->Type != OS_OBJ_TYPE_RWLOCK) {                 /* Make sure lock was created                           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_rwlock->PendList;
+    nbr_tasks   = 0u;
+    switch (opt) {
+        case OS_OPT_DEL_NO_PEND:                                /* Delete lock only if no task waiting                  */
+             if (p_pend_list->HeadPtr == (OS_TCB *)0) {
+#if (OS_CFG_DBG_EN > 0u)
+                 OS_RwLockDbgListRemove(p_rwlock);
+                 OSRwLockQty--;
+#endif
+                 OS_RwLockHoldRemoveAll(p_rwlock);              /* See Note #2                                          */
+                 OS_RwLockClr(p_rwlock);
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_NONE;
+             } else {
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_TASK_WAITING;
+             }
+             break;
+
+        case OS_OPT_DEL_ALWAYS:                                 /* Always delete the lock                               */
+#if (OS_CFG_TS_EN > 0u)
+             ts = OS_TS_GET();                                  /* Get timestamp                                        */
+#else
+             ts = 0u;
+#endif
+             while (p_pend_list->HeadPtr != (OS_TCB *)0) {      /* Remove all tasks from the pend list                  */
+                 p_tcb = p_pend_list->HeadPtr;
+                 OS_PendAbort(p_tcb,
+                              ts,
+                              OS_STATUS_PEND_DEL);
+                 nbr_tasks++;
+             }
+#if (OS_CFG_DBG_EN > 0u)
+             OS_RwLockDbgListRemove(p_rwlock);
+             OSRwLockQty--;
+#endif
+             OS_RwLockHoldRemoveAll(p_rwlock);                  /* See Note #2                                          */
+             OS_RwLockClr(p_rwlock);
+             CPU_CRITICAL_EXIT();
+             OSSched();                                         /* Find highest priority task ready to run              */
+            *p_err = OS_ERR_NONE;
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_OPT_INVALID;
+             break;
+    }
+    return (nbr_tasks);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                       ABORT WAITING ON A READER/WRITER LOCK
+*
+* Description: This function aborts & readies any tasks currently waiting on a reader/writer lock.  This function
+*              should be used to fault-abort the wait on the lock, rather than to normally signal the lock via
+*              OSRwLockPost().
+*
+* Arguments  : p_rwlock      is a pointer to the reader/writer lock
+*
+*              opt           determines the type of ABORT performed:
+*
+*                                OS_OPT_PEND_ABORT_1          ABORT wait for a single task (HPT) waiting on the lock
+*                                OS_OPT_PEND_ABORT_ALL        ABORT wait for ALL tasks that are  waiting on the lock
+*                                OS_OPT_POST_NO_SCHED         Do not call the scheduler
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                  At least one task waiting on the lock was readied and
+*                                                             informed of the aborted wait; check return value for the
+*                                                             number of tasks whose wait on the lock was aborted.
+*                                OS_ERR_OBJ_PTR_NULL          If 'p_rwlock' is a NULL pointer.
+*                                OS_ERR_OBJ_TYPE              If 'p_rwlock' is not pointing at a reader/writer lock
+*                                OS_ERR_OPT_INVALID           If you specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING        If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT_ISR        If you attempted to call this function from an ISR
+*                                OS_ERR_PEND_ABORT_NONE       No task were pending
+*
+* Returns    : == 0          if no tasks were waiting on the lock, or upon error.
+*              >  0          if one or more tasks waiting on the lock are now readied and informed.
+*
+* Note(s)    : 1) An aborted writer may have been the only thing keeping the readers behind it from owning a lock read
+*                 by other tasks.  These readers are let in before this function returns.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_RWLOCK_PEND_ABORT_EN > 0u)
+OS_OBJ_QTY  OSRwLockPendAbort (OS_RWLOCK  *p_rwlock,
+                               OS_OPT      opt,
+                               OS_ERR     *p_err)
+{
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    CPU_TS         ts;
+    OS_OBJ_QTY     nbr_tasks;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to Pend Abort from an ISR                */
+       *p_err = OS_ERR_PEND_ABORT_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_rwlock == (OS_RWLOCK *)0) {                           /* Validate 'p_rwlock'                                  */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_PEND_ABORT_1:
+        case OS_OPT_PEND_ABORT_ALL:
+        case OS_OPT_PEND_ABORT_1   | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_PEND_ABORT_ALL | OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_rwlock->Type != OS_OBJ_TYPE_RWLOCK) {                 /* Make sure lock was created                           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_rwlock->PendList;
+    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on the lock?                        */
+        CPU_CRITICAL_EXIT();                                    /* No                                                   */
+       *p_err = OS_ERR_PEND_ABORT_NONE;
+        return (0u);
+    }
+
+    nbr_tasks = 0u;
+#if (OS_CFG_TS_EN > 0u)
+    ts        = OS_TS_GET();                                    /* Get local time stamp so all tasks get the same time  */
+#else
+    ts        = 0u;
+#endif
+    while (p_pend_list->HeadPtr != (OS_TCB *)0) {
+        p_tcb = p_pend_list->HeadPtr;
+        OS_PendAbort(p_tcb,
+                     ts,
+                     OS_STATUS_PEND_ABORT);
+        nbr_tasks++;
+        if ((opt & OS_OPT_PEND_ABORT_ALL) == 0u) {              /* Pend abort all tasks waiting?                        */
+            break;                                              /* No                                                   */
+        }
+    }
+    OS_RwLockGrant(p_rwlock, ts);                               /* See Note #1                                          */
+    OS_RwLockPrioUpdate(p_rwlock);                              /* Owners may no longer need their inherited priority   */
+    CPU_CRITICAL_EXIT();
+
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+
+   *p_err = OS_ERR_NONE;
+    return (nbr_tasks);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                        PEND ON A READER/WRITER LOCK TO READ
+*
+* Description: This function waits until the calling task can own a reader/writer lock for reading, which it shares
+*              with the other readers.
+*
+* Arguments  : p_rwlock      is a pointer to the reader/writer lock
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for the
+*                            lock up to the amount of time (in 'ticks') specified by this argument.  If you specify 0,
+*                            however, your task will wait forever at the specified lock or, until it gets it.
+*
+*              opt           determines whether the user wants to block if the lock is not available or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*                            Add OS_OPT_PEND_ABS to make 'timeout' the value of OSTickCtr at which to give up.
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp of when the lock was last
+*                            released, or the lock was aborted or deleted.  If you pass a NULL pointer (i.e.
+*                            (CPU_TS *)0) then you will not get the timestamp.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and your task owns the lock
+*                                OS_ERR_OBJ_DEL            If 'p_rwlock' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_rwlock' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_rwlock' is not pointing at a reader/writer lock
+*                                OS_ERR_OPT_INVALID        If you didn't specify a valid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         If the pend was aborted by another task
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the lock was not available
+*                                OS_ERR_RWLOCK_HOLD_MAX    If your task already holds OS_CFG_RWLOCK_HOLD_MAX locks
+*                                OS_ERR_RWLOCK_MODE        If your task already owns the lock for writing
+*                                OS_ERR_RWLOCK_OVF         If your task nested the lock too many times
+*                                OS_ERR_RWLOCK_OWNER       If your task already owns the lock for reading
+*                                OS_ERR_SCHED_LOCKED       If you called this function when the scheduler is locked
+*                                OS_ERR_STATUS_INVALID     If the pend status has an invalid value
+*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*                                OS_ERR_TIMEOUT            The lock was not received within the specified timeout.
+*
+* Returns    : none
+*
+* Note(s)    : 1) A task that already reads the lock reads it again without waiting, even when writers are waiting.
+*                 It MUST call OSRwLockPost() once for each successful call.
+************************************************************************************************************************
+*/
+
+void  OSRwLockPendRd (OS_RWLOCK  *p_rwlock,
+                      OS_TICK     timeout,
+                      OS_OPT      opt,
+                      CPU_TS     *p_ts,
+                      OS_ERR     *p_err)
+{
+    OS_RwLockPend(p_rwlock,
+                  timeout,
+                  opt,
+                  p_ts,
+                  OS_TASK_PEND_ON_RWLOCK_RD,
+                  p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                       PEND ON A READER/WRITER LOCK TO WRITE
+*
+* Description: This function waits until the calling task owns a reader/writer lock alone.
+*
+* Arguments  : p_rwlock      is a pointer to the reader/writer lock
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for the
+*                            lock up to the amount of time (in 'ticks') specified by this argument.  If you specify 0,
+*                            however, your task will wait forever at the specified lock or, until it gets it.
+*
+*              opt           determines whether the user wants to block if the lock is not available or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*                            Add OS_OPT_PEND_ABS to make 'timeout' the value of OSTickCtr at which to give up.
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp of when the lock was last
+*                            released, or the lock was aborted or deleted.  If you pass a NULL pointer (i.e.
+*                            (CPU_TS *)0) then you will not get the timestamp.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and your task owns the lock
+*                                OS_ERR_OBJ_DEL            If 'p_rwlock' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_rwlock' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_rwlock' is not pointing at a reader/writer lock
+*                                OS_ERR_OPT_INVALID        If you didn't specify a valid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         If the pend was aborted by another task
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the lock was not available
+*                                OS_ERR_RWLOCK_HOLD_MAX    If your task already holds OS_CFG_RWLOCK_HOLD_MAX locks
+*                                OS_ERR_RWLOCK_MODE        If your task already owns the lock for reading
+*                                OS_ERR_RWLOCK_OVF         If your task nested the lock too many times
+*                                OS_ERR_RWLOCK_OWNER       If your task already owns the lock for writing
+*                                OS_ERR_SCHED_LOCKED       If you called this function when the scheduler is locked
+*                                OS_ERR_STATUS_INVALID     If the pend status has an invalid value
+*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*                                OS_ERR_TIMEOUT            The lock was not received within the specified timeout.
+*
+* Returns    : none
+*
+* Note(s)    : 1) A reader cannot turn its hold into a write hold.  Releasing the read hold first lets the waiting
+*                 writers in, which is what would otherwise deadlock two readers trying to upgrade at the same time.
+************************************************************************************************************************
+*/
+
+void  OSRwLockPendWr (OS_RWLOCK  *p_rwlock,
+                      OS_TICK     timeout,
+                      OS_OPT      opt,
+                      CPU_TS     *p_ts,
+                      OS_ERR     *p_err)
+{
+    OS_RwLockPend(p_rwlock,
+                  timeout,
+                  opt,
+                  p_ts,
+                  OS_TASK_PEND_ON_RWLOCK_WR,
+                  p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                           POST TO A READER/WRITER LOCK
+*
+* Description: This function releases the hold of the calling task, reader or writer, on a reader/writer lock.
+*
+* Arguments  : p_rwlock      is a pointer to the reader/writer lock
+*
+*              opt           is an option you can specify to alter the behavior of the post.  The choices are:
+*
+*                                OS_OPT_POST_NONE        No special option selected
+*                                OS_OPT_POST_NO_SCHED    If you don't want the scheduler to be called after the post.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and the lock was released
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_rwlock' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_rwlock' is not pointing at a reader/writer lock
+*                                OS_ERR_OPT_INVALID        If you specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_POST_ISR           If you attempted to post from an ISR
+*                                OS_ERR_RWLOCK_NESTING     The lock owner nested its use of the lock
+*                                OS_ERR_RWLOCK_NOT_OWNER   If the task posting is not an owner of the lock
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSRwLockPost (OS_RWLOCK  *p_rwlock,
+                    OS_OPT      opt,
+                    OS_ERR     *p_err)
+{
+    OS_RWLOCK_HOLD  *p_hold;
+    CPU_TS           ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_POST_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_rwlock == (OS_RWLOCK *)0) {                           /* Validate 'p_rwlock'                                  */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_rwlock->Type != OS_OBJ_TYPE_RWLOCK) {                 /* Make sure lock was created                           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_hold = OS_RwLockHoldFind(p_rwlock, OSTCBCurPtr);
+    if (p_hold == (OS_RWLOCK_HOLD *)0) {                        /* Make sure an owner is releasing the lock             */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_RWLOCK_NOT_OWNER;
+        return;
+    }
+
+#if (OS_CFG_TS_EN > 0u)
+    ts           = OS_TS_GET();                                 /* Get timestamp                                        */
+    p_rwlock->TS = ts;
+#else
+    ts           = 0u;
+#endif
+    p_hold->NestingCtr--;                                       /* Decrement owner's nesting counter                    */
+    if (p_hold->NestingCtr > 0u) {                              /* Are we done with all nestings?                       */
+        CPU_CRITICAL_EXIT();                                    /* No                                                   */
+       *p_err = OS_ERR_RWLOCK_NESTING;
+        return;
+    }
+
+    OS_RwLockHoldRemove(p_hold);                                /* Release the hold of the caller                       */
+    if (OSTCBCurPtr->Prio != OSTCBCurPtr->BasePrio) {           /* Has the caller inherited a priority?                 */
+        OS_RwLockTaskPrioSet(OSTCBCurPtr);                      /* Yes, drop what it inherited through this lock        */
+    }
+
+    OS_RwLockGrant(p_rwlock, ts);                               /* Hand the lock to the waiters at the head of the list */
+    OS_RwLockPrioUpdate(p_rwlock);
+    CPU_CRITICAL_EXIT();
+
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                     CLEAR THE CONTENTS OF A READER/WRITER LOCK
+*
+* Description: This function is called by OSRwLockDel() to clear the contents of a reader/writer lock
+*
+* Argument(s): p_rwlock     is a pointer to the reader/writer lock to clear
+*              --------
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_RwLockClr (OS_RWLOCK  *p_rwlock)
+{
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_rwlock->Type          =  OS_OBJ_TYPE_NONE;                /* Mark the data structure as a NONE                    */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_rwlock->NamePtr       = (CPU_CHAR *)((void *)"?RWLOCK");
+#endif
+    p_rwlock->HoldHeadPtr   = (OS_RWLOCK_HOLD *)0;
+    p_rwlock->WrOwnerTCBPtr = (OS_TCB         *)0;
+    p_rwlock->RdCtr         =                   0u;
+#if (OS_CFG_TS_EN > 0u)
+    p_rwlock->TS            =                   0u;
+#endif
+    OS_PendListInit(&p_rwlock->PendList);                       /* Initialize the waiting list                          */
+}
+
+
+/*
+************************************************************************************************************************
+*                                   ADD/REMOVE READER/WRITER LOCK TO/FROM DEBUG LIST
+*
+* Description: These functions are called by uC/OS-III to add or remove a reader/writer lock to/from the debug list.
+*
+* Arguments  : p_rwlock    is a pointer to the reader/writer lock to add/remove
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN > 0u)
+void  OS_RwLockDbgListAdd (OS_RWLOCK  *p_rwlock)
+{
+    p_rwlock->DbgNamePtr               = (CPU_CHAR *)((void *)" ");
+    p_rwlock->DbgPrevPtr               = (OS_RWLOCK *)0;
+    if (OSRwLockDbgListPtr == (OS_RWLOCK *)0) {
+        p_rwlock->DbgNextPtr           = (OS_RWLOCK *)0;
+    } else {
+        p_rwlock->DbgNextPtr           =  OSRwLockDbgListPtr;
+        OSRwLockDbgListPtr->DbgPrevPtr =  p_rwlock;
+    }
+    OSRwLockDbgListPtr                 =  p_rwlock;
+}
+
+
+void  OS_RwLockDbgListRemove (OS_RWLOCK  *p_rwlock)
+{
+    OS_RWLOCK  *p_rwlock_next;
+    OS_RWLOCK  *p_rwlock_prev;
+
+
+    p_rwlock_prev = p_rwlock->DbgPrevPtr;
+    p_rwlock_next = p_rwlock->DbgNextPtr;
+
+    if (p_rwlock_prev == (OS_RWLOCK *)0) {
+        OSRwLockDbgListPtr = p_rwlock_next;
+        if (p_rwlock_next != (OS_RWLOCK *)0) {
+            p_rwlock_next->DbgPrevPtr = (OS_RWLOCK *)0;
+        }
+        p_rwlock->DbgNextPtr = (OS_RWLOCK *)0;
+
+    } else if (p_rwlock_next == (OS_RWLOCK *)0) {
+        p_rwlock_prev->DbgNextPtr = (OS_RWLOCK *)0;
+        p_rwlock->DbgPrevPtr      = (OS_RWLOCK *)0;
+
+    } else {
+        p_rwlock_prev->DbgNextPtr =  p_rwlock_next;
+        p_rwlock_next->DbgPrevPtr =  p_rwlock_prev;
+        p_rwlock->DbgNextPtr      = (OS_RWLOCK *)0;
+        p_rwlock->DbgPrevPtr      = (OS_RWLOCK *)0;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                   FIND HIGHEST WAITER OF THE LOCKS HELD BY A TASK
+*
+* Description: This function is called by OS_MutexGrpPrioFindHighest() to find the highest priority task waiting on
+*              any of the reader/writer locks held by a task.
+*
+* Argument(s): p_tcb        is a pointer to the tcb of the task to process.
+*
+* Returns    : Highest priority pending or OS_CFG_PRIO_MAX - 1u if none found.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+OS_PRIO  OS_RwLockPrioFindHighest (OS_TCB  *p_tcb)
+{
+    OS_RWLOCK_HOLD  *p_hold;
+    OS_TCB          *p_head;
+    OS_PRIO          highest_prio;
+    CPU_INT08U       ix;
+
+
+    highest_prio = (OS_PRIO)(OS_CFG_PRIO_MAX - 1u);
+    if (p_tcb->RwLockHoldCtr == 0u) {
+        return (highest_prio);
+    }
+
+    p_hold = &p_tcb->RwLockHoldTbl[0];
+    for (ix = 0u; ix < OS_CFG_RWLOCK_HOLD_MAX; ix++) {
+        if (p_hold->RwLockPtr != (OS_RWLOCK *)0) {
+            p_head = p_hold->RwLockPtr->PendList.HeadPtr;       /* The pend list is sorted, the head is the highest    */
+            if ((p_head       != (OS_TCB *)0) &&
+                (p_head->Prio <  highest_prio)) {
+                highest_prio = p_head->Prio;
+            }
+        }
+        p_hold++;
+    }
+    return (highest_prio);
+}
+
+
+/*
+************************************************************************************************************************
+*                                     UPDATE THE PRIORITY OF THE OWNERS OF A LOCK
+*
+* Description: This function is called by the kernel when the waiters of a reader/writer lock changed.  Each owner of
+*              the lock is raised to the priority of the highest waiter, or lowered back to the highest priority it
+*              still has to run at.
+*
+* Argument(s): p_rwlock     is a pointer to the reader/writer lock.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) An owner that waits itself on another reader/writer lock passes the new priority on to the owners of
+*                 that lock, through OS_TaskChangePrio().
+************************************************************************************************************************
+*/
+
+void  OS_RwLockPrioUpdate (OS_RWLOCK  *p_rwlock)
+{
+    OS_RWLOCK_HOLD  *p_hold;
+
+
+    p_hold = p_rwlock->HoldHeadPtr;
+    while (p_hold != (OS_RWLOCK_HOLD *)0) {
+        OS_RwLockTaskPrioSet(p_hold->TCBPtr);                   /* See Note #2                                          */
+        p_hold = p_hold->NextPtr;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                        RELEASE ALL THE LOCKS HELD BY A TASK
+*
+* Description: This function is called by OSTaskDel() to release all the reader/writer locks held by a task that is
+*              being deleted, whatever their nesting.
+*
+* Argument(s): p_tcb        is a pointer to the tcb of the task to process.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_RwLockPostAll (OS_TCB  *p_tcb)
+{
+    OS_RWLOCK_HOLD  *p_hold;
+    OS_RWLOCK       *p_rwlock;
+    CPU_TS           ts;
+    CPU_INT08U       ix;
+
+
+    p_hold = &p_tcb->RwLockHoldTbl[0];
+    for (ix = 0u; ix < OS_CFG_RWLOCK_HOLD_MAX; ix++) {
+        p_rwlock = p_hold->RwLockPtr;
+        if (p_rwlock != (OS_RWLOCK *)0) {
+#if (OS_CFG_TS_EN > 0u)
+            ts           = OS_TS_GET();                         /* Get timestamp                                        */
+            p_rwlock->TS = ts;
+#else
+            ts           = 0u;
+#endif
+            OS_RwLockHoldRemove(p_hold);
+            OS_RwLockGrant(p_rwlock, ts);
+            OS_RwLockPrioUpdate(p_rwlock);
+        }
+        p_hold++;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                       PEND ON A READER/WRITER LOCK (COMMON CODE)
+*
+* Description: This function contains the code shared by OSRwLockPendRd() and OSRwLockPendWr().
+*
+* Arguments  : p_rwlock      is a pointer to the reader/writer lock
+*
+*              timeout       is the timeout of the wait (see OSRwLockPendRd())
+*
+*              opt           is OS_OPT_PEND_BLOCKING or OS_OPT_PEND_NON_BLOCKING
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp
+*
+*              pending_on    is OS_TASK_PEND_ON_RWLOCK_RD to read the lock or OS_TASK_PEND_ON_RWLOCK_WR to write it
+*
+*              p_err         is a pointer to a variable that will contain an error code (see OSRwLockPendRd())
+*
+* Returns    : none
+*
+* Note(s)    : 1) A reader is let in when no writer owns the lock and no task waits at the same or a higher priority.
+*                 Because the pend list is sorted by priority and readers are let in up to the first writer, the
+*                 head of the list is enough to know (see READER/WRITER LOCKS Note #3 in os.h).
+************************************************************************************************************************
+*/
+
+static  void  OS_RwLockPend (OS_RWLOCK  *p_rwlock,
+                             OS_TICK     timeout,
+                             OS_OPT      opt,
+                             CPU_TS     *p_ts,
+                             OS_STATE    pending_on,
+                             OS_ERR     *p_err)
+{
+    OS_RWLOCK_HOLD  *p_hold;
+    OS_TCB          *p_head;
+    CPU_BOOLEAN      avail;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_PEND_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_rwlock == (OS_RWLOCK *)0) {                           /* Validate arguments                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt & (OS_OPT)~OS_OPT_PEND_ABS) {                   /* Validate 'opt'                                       */
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_rwlock->Type != OS_OBJ_TYPE_RWLOCK) {                 /* Make sure lock was created                           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_hold = OS_RwLockHoldFind(p_rwlock, OSTCBCurPtr);
+    if (p_hold != (OS_RWLOCK_HOLD *)0) {                        /* See if current task already owns the lock            */
+        if ((pending_on == OS_TASK_PEND_ON_RWLOCK_WR) !=        /* ... in the other mode                                */
+            (p_rwlock->WrOwnerTCBPtr == OSTCBCurPtr)) {
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_RWLOCK_MODE;
+            return;
+        }
+        if (p_hold->NestingCtr == (OS_NESTING_CTR)-1) {
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_RWLOCK_OVF;
+            return;
+        }
+        p_hold->NestingCtr++;
+#if (OS_CFG_TS_EN > 0u)
+        if (p_ts != (CPU_TS *)0) {
+           *p_ts = p_rwlock->TS;
+        }
+#endif
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_RWLOCK_OWNER;                            /* Indicate that current task already owns the lock     */
+        return;
+    }
+
+    if (OSTCBCurPtr->RwLockHoldCtr >= OS_CFG_RWLOCK_HOLD_MAX) { /* Does the task have room for one more lock?           */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_RWLOCK_HOLD_MAX;
+        return;
+    }
+
+    p_head = p_rwlock->PendList.HeadPtr;                        /* See Note #1                                          */
+    if ((p_head       != (OS_TCB *)0) &&
+        (p_head->Prio <= OSTCBCurPtr->Prio)) {
+        avail = OS_FALSE;
+    } else if (pending_on == OS_TASK_PEND_ON_RWLOCK_WR) {
+        avail = (p_rwlock->HoldHeadPtr   == (OS_RWLOCK_HOLD *)0) ? OS_TRUE : OS_FALSE;
+    } else {
+        avail = (p_rwlock->WrOwnerTCBPtr == (OS_TCB         *)0) ? OS_TRUE : OS_FALSE;
+    }
+
+    if (avail == OS_TRUE) {                                     /* Resource available?                                  */
+        (void)OS_RwLockHoldAdd(p_rwlock, OSTCBCurPtr, pending_on); /* Yes, caller may proceed                           */
+#if (OS_CFG_TS_EN > 0u)
+        if (p_ts != (CPU_TS *)0) {
+           *p_ts = p_rwlock->TS;
+        }
+#endif
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+        CPU_CRITICAL_EXIT();
+#if (OS_CFG_TS_EN > 0u)
+        if (p_ts != (CPU_TS *)0) {
+           *p_ts = 0u;
+        }
+#endif
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                        /* No                                                   */
+        return;
+    } else {
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+#if (OS_CFG_TS_EN > 0u)
+            if (p_ts != (CPU_TS *)0) {
+               *p_ts = 0u;
+            }
+#endif
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return;
+        }
+    }
+
+    OS_PEND_ABS_SET(OSTCBCurPtr, opt);
+    OS_Pend((OS_PEND_OBJ *)((void *)p_rwlock),                  /* Block task pending on the lock                       */
+             OSTCBCurPtr,
+             pending_on,
+             timeout);
+    OS_RwLockPrioUpdate(p_rwlock);                              /* Owners inherit the priority of the caller            */
+
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* We got the lock                                      */
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+            *p_err = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+            *p_err = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that we didn't get the lock within timeout  */
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = 0u;
+             }
+#endif
+            *p_err = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+            *p_err = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+            *p_err = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+************************************************************************************************************************
+*                                      HAND A READER/WRITER LOCK TO ITS WAITERS
+*
+* Description: This function gives the lock to the tasks at the head of its pend list: the first task if it waits to
+*              write and the lock is free, or all the tasks ahead of the first writer if no writer owns the lock.
+*
+* Argument(s): p_rwlock     is a pointer to the reader/writer lock.
+*
+*              ts           is the timestamp to give to the tasks.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The caller is responsible for updating the priority of the owners afterwards.
+************************************************************************************************************************
+*/
+
+static  void  OS_RwLockGrant (OS_RWLOCK  *p_rwlock,
+                              CPU_TS      ts)
+{
+    OS_TCB  *p_tcb;
+
+
+    while (p_rwlock->WrOwnerTCBPtr == (OS_TCB *)0) {
+        p_tcb = p_rwlock->PendList.HeadPtr;
+        if (p_tcb == (OS_TCB *)0) {                             /* Any task waiting on the lock?                        */
+            break;
+        }
+        if ((p_tcb->PendOn        == OS_TASK_PEND_ON_RWLOCK_WR) &&
+            (p_rwlock->HoldHeadPtr != (OS_RWLOCK_HOLD *)0)) {   /* A writer has to wait for the readers to leave        */
+            break;
+        }
+        (void)OS_RwLockHoldAdd(p_rwlock, p_tcb, p_tcb->PendOn); /* Give the lock to the task                            */
+        OS_Post((OS_PEND_OBJ *)((void *)p_rwlock),
+                               p_tcb,
+                               (void *)0,
+                               0u,
+                               ts);
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                         ADD/FIND/REMOVE A READER/WRITER LOCK HOLD
+*
+* Description: These functions manage the entries of '.RwLockHoldTbl[]' of a task that describe the locks it owns.
+*
+* Argument(s): p_rwlock     is a pointer to the reader/writer lock.
+*
+*              p_tcb        is a pointer to the tcb of the owner.
+*
+*              pending_on   is OS_TASK_PEND_ON_RWLOCK_RD when the lock is owned for reading or OS_TASK_PEND_ON_RWLOCK_WR
+*                           when it is owned for writing.
+*
+*              p_hold       is a pointer to the hold to remove.
+*
+* Returns    : OS_RwLockHoldAdd()  returns the hold used by the new owner.
+*              OS_RwLockHoldFind() returns the hold of the task on the lock or (OS_RWLOCK_HOLD *)0 if it doesn't own it.
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application MUST NOT call them.
+*
+*              2) The caller of OS_RwLockHoldAdd() makes sure that the task has a free entry.  A task waiting on a lock
+*                 cannot acquire other locks in the meantime, so the entry checked by OS_RwLockPend() is still free when
+*                 the lock is handed to it.
+************************************************************************************************************************
+*/
+
+static  OS_RWLOCK_HOLD  *OS_RwLockHoldAdd (OS_RWLOCK  *p_rwlock,
+                                           OS_TCB     *p_tcb,
+                                           OS_STATE    pending_on)
+{
+    OS_RWLOCK_HOLD  *p_hold;
+
+
+    p_hold = &p_tcb->RwLockHoldTbl[0];
+    while (p_hold->RwLockPtr != (OS_RWLOCK *)0) {              /* See Note #2                                          */
+        p_hold++;
+    }
+    p_hold->RwLockPtr     = p_rwlock;
+    p_hold->TCBPtr        = p_tcb;
+    p_hold->NestingCtr    = 1u;
+    p_hold->NextPtr       = p_rwlock->HoldHeadPtr;
+    p_rwlock->HoldHeadPtr = p_hold;
+    p_tcb->RwLockHoldCtr++;
+
+    if (pending_on == OS_TASK_PEND_ON_RWLOCK_WR) {
+        p_rwlock->WrOwnerTCBPtr = p_tcb;
+    } else {
+        p_rwlock->RdCtr++;
+    }
+    return (p_hold);
+}
+
+
+static  OS_RWLOCK_HOLD  *OS_RwLockHoldFind (OS_RWLOCK  *p_rwlock,
+                                            OS_TCB     *p_tcb)
+{
+    OS_RWLOCK_HOLD  *p_hold;
+    CPU_INT08U       ix;
+
+
+    if (p_tcb->RwLockHoldCtr > 0u) {
+        p_hold = &p_tcb->RwLockHoldTbl[0];
+        for (ix = 0u; ix < OS_CFG_RWLOCK_HOLD_MAX; ix++) {
+            if (p_hold->RwLockPtr == p_rwlock) {
+                return (p_hold);
+            }
+            p_hold++;
+        }
+    }
+    return ((OS_RWLOCK_HOLD *)0);
+}
+
+
+static  void  OS_RwLockHoldRemove (OS_RWLOCK_HOLD  *p_hold)
+{
+    OS_RWLOCK        *p_rwlock;
+    OS_RWLOCK_HOLD  **pp_hold;
+
+
+    p_rwlock = p_hold->RwLockPtr;
+    pp_hold  = &p_rwlock->HoldHeadPtr;
+    while (*pp_hold != p_hold) {
+        pp_hold = &(*pp_hold)->NextPtr;
+    }
+   *pp_hold  = p_hold->NextPtr;
+
+    if (p_rwlock->WrOwnerTCBPtr == p_hold->TCBPtr) {
+        p_rwlock->WrOwnerTCBPtr = (OS_TCB *)0;
+    } else {
+        p_rwlock->RdCtr--;
+    }
+    p_hold->TCBPtr->RwLockHoldCtr--;
+    p_hold->RwLockPtr  = (OS_RWLOCK      *)0;
+    p_hold->NextPtr    = (OS_RWLOCK_HOLD *)0;
+    p_hold->NestingCtr =                   0u;
+}
+
+
+/*
+************************************************************************************************************************
+*                                      DROP ALL THE OWNERS OF A READER/WRITER LOCK
+*
+* Description: This function is called by OSRwLockDel() to release the lock on behalf of all its owners.
+*
+* Argument(s): p_rwlock     is a pointer to the reader/writer lock.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_RWLOCK_DEL_EN > 0u)
+static  void  OS_RwLockHoldRemoveAll (OS_RWLOCK  *p_rwlock)
+{
+    OS_RWLOCK_HOLD  *p_hold;
+    OS_TCB          *p_tcb;
+
+
+    while (p_rwlock->HoldHeadPtr != (OS_RWLOCK_HOLD *)0) {
+        p_hold = p_rwlock->HoldHeadPtr;
+        p_tcb  = p_hold->TCBPtr;
+        OS_RwLockHoldRemove(p_hold);
+        if (p_tcb->Prio != p_tcb->BasePrio) {                   /* Drop what the owner inherited through the lock       */
+            OS_RwLockTaskPrioSet(p_tcb);
+        }
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                    SET THE PRIORITY OF AN OWNER OF A READER/WRITER LOCK
+*
+* Description: This function sets the priority of a task to the highest of its base priority and the priority of the
+*              highest task waiting on a mutex or reader/writer lock it holds.
+*
+* Argument(s): p_tcb        is a pointer to the tcb of the task.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_RwLockTaskPrioSet (OS_TCB  *p_tcb)
+{
+    OS_PRIO  prio_new;
+
+
+    prio_new = OS_MutexGrpPrioFindHighest(p_tcb);               /* Also covers the reader/writer locks held             */
+    prio_new = (prio_new > p_tcb->BasePrio) ? p_tcb->BasePrio : prio_new;
+    if (prio_new != p_tcb->Prio) {
+        OS_TaskChangePrio(p_tcb, prio_new);
+        OS_TRACE_TASK_PRIO_CHANGE(p_tcb, prio_new);
+        if (p_tcb == OSTCBCurPtr) {
+            OSPrioCur = prio_new;
+        }
+    }
+}
+
+#endif /* OS_CFG_RWLOCK_EN */
@@ -0,0 +1,449 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        SCHEDULING WINDOWS
+*
+* File    : os_sched_window.c
+* Version : V3.08.00
+*********************************************************************************************************
+*/
+
+#define   MICRIUM_SOURCE
+#define   OS_CRIT_SITE_ID                   OS_CRIT_SITE_SCHED_WINDOW
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_sched_window__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_SCHED_WINDOW_EN > 0u)
+
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  void  OS_SchedWindowPrioSet (OS_SCHED_WINDOW  *p_window,
+                                     OS_PRIO           prio);
+
+
+/*
+************************************************************************************************************************
+*                                           INITIALIZE A SCHEDULING WINDOW
+*
+* Description : Initialize a window of a schedule.  The window starts with only the critical priorities (below
+*               OS_CFG_SCHED_WINDOW_CRIT_PRIO) and the idle task priority; OSSchedWindowPrioAdd() adds the priorities
+*               of the partition that owns the window.
+*
+* Arguments   : p_window   is a pointer to the window
+*
+*               duration   is the length of the window, in microseconds.  It is passed to OS_SchedWindowTmrSet() when
+*                          the window becomes active.
+*
+*               p_err      is a pointer to a variable containing an error message which will be set by this function to
+*                          either:
+*
+*                              OS_ERR_NONE                     If the window was initialized
+*                              OS_ERR_OBJ_PTR_NULL             If you passed a NULL pointer for 'p_window'
+*                              OS_ERR_SCHED_WINDOW_DURATION    If 'duration' is 0
+*                              OS_ERR_SCHED_WINDOW_ISR         If you called this function from an ISR
+*
+* Returns     : none
+*
+* Note(s)     : 1) The window must not be part of the schedule that is running.
+************************************************************************************************************************
+*/
+
+void  OSSchedWindowInit (OS_SCHED_WINDOW  *p_window,
+                         CPU_INT32U        duration,
+                         OS_ERR           *p_err)
+{
+    CPU_DATA  i;
+#if (OS_CFG_SCHED_WINDOW_CRIT_PRIO > 0u)
+    OS_PRIO   prio;
+#endif
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_SCHED_WINDOW_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_window == (OS_SCHED_WINDOW *)0) {                     /* Must point to a valid window                         */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (duration == 0u) {                                       /* The window must last                                 */
+       *p_err = OS_ERR_SCHED_WINDOW_DURATION;
+        return;
+    }
+#endif
+
+    for (i = 0u; i < OS_PRIO_TBL_SIZE; i++) {
+        p_window->PrioTbl[i] = 0u;
+    }
+#if (OS_CFG_SCHED_WINDOW_CRIT_PRIO > 0u)
+    for (prio = 0u; prio < OS_CFG_SCHED_WINDOW_CRIT_PRIO; prio++) {
+        OS_SchedWindowPrioSet(p_window, prio);                  /* The critical band runs in every window               */
+    }
+#endif
+    OS_SchedWindowPrioSet(p_window, (OS_PRIO)(OS_CFG_PRIO_MAX - 1u));
+    p_window->Duration = duration;
+   *p_err              = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                         ADD A PRIORITY TO A SCHEDULING WINDOW
+*
+* Description : Allow the tasks at priority 'prio' to run while the window is active.
+*
+* Arguments   : p_window   is a pointer to the window
+*
+*               prio       is the priority to add
+*
+*               p_err      is a pointer to a variable containing an error message which will be set by this function to
+*                          either:
+*
+*                              OS_ERR_NONE                     If the priority was added
+*                              OS_ERR_OBJ_PTR_NULL             If you passed a NULL pointer for 'p_window'
+*                              OS_ERR_PRIO_INVALID             If 'prio' is the idle task priority or is out of range
+*                              OS_ERR_SCHED_WINDOW_ISR         If you called this function from an ISR
+*
+* Returns     : none
+*
+* Note(s)     : 1) A priority may belong to several windows.  When the window is the active one, a task of the added
+*                  priority can run right away.
+************************************************************************************************************************
+*/
+
+void  OSSchedWindowPrioAdd (OS_SCHED_WINDOW  *p_window,
+                            OS_PRIO           prio,
+                            OS_ERR           *p_err)
+{
+    CPU_BOOLEAN  sched;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_SCHED_WINDOW_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_window == (OS_SCHED_WINDOW *)0) {                     /* Must point to a valid window                         */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (prio >= (OS_CFG_PRIO_MAX - 1u)) {                       /* The idle task priority is always part of the window  */
+       *p_err = OS_ERR_PRIO_INVALID;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    OS_SchedWindowPrioSet(p_window, prio);
+    sched = (p_window == OSSchedWindowCurPtr) ? OS_TRUE : OS_FALSE;
+    CPU_CRITICAL_EXIT();
+
+    if ((sched     == OS_TRUE) &&                               /* See Note #1                                          */
+        (OSRunning == OS_STATE_OS_RUNNING)) {
+        OSSched();
+    }
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              START A SCHEDULE OF WINDOWS
+*
+* Description : Run the windows of 'p_tbl[]' one after the other, going back to the first window after the last one.
+*               The first window is active right away.
+*
+* Arguments   : p_tbl      is a pointer to the table of windows.  The table must stay valid until OSSchedWindowStop()
+*                          or the next OSSchedWindowStart().
+*
+*               nbr        is the number of windows in 'p_tbl[]'
+*
+*               p_err      is a pointer to a variable containing an error message which will be set by this function to
+*                          either:
+*
+*                              OS_ERR_NONE                     If the schedule was started
+*                              OS_ERR_OBJ_PTR_NULL             If you passed a NULL pointer for 'p_tbl'
+*                              OS_ERR_SCHED_WINDOW_DURATION    If a window has a duration of 0 (not initialized)
+*                              OS_ERR_SCHED_WINDOW_ISR         If you called this function from an ISR
+*                              OS_ERR_SCHED_WINDOW_NBR         If 'nbr' is 0
+*
+* Returns     : none
+*
+* Note(s)     : 1) This function may be called before OSStart().  The BSP timer must then not call OSSchedWindowNext()
+*                  before multitasking has started, or the first window is shortened.
+*
+*               2) A new schedule replaces the running one immediately.
+************************************************************************************************************************
+*/
+
+void  OSSchedWindowStart (OS_SCHED_WINDOW  *p_tbl,
+                          OS_OBJ_QTY        nbr,
+                          OS_ERR           *p_err)
+{
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    OS_OBJ_QTY  i;
+#endif
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_SCHED_WINDOW_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_tbl == (OS_SCHED_WINDOW *)0) {                        /* Must point to a valid table                          */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (nbr == 0u) {                                            /* Must have at least one window                        */
+       *p_err = OS_ERR_SCHED_WINDOW_NBR;
+        return;
+    }
+    for (i = 0u; i < nbr; i++) {
+        if (p_tbl[i].Duration == 0u) {                          /* Every window must have been initialized              */
+           *p_err = OS_ERR_SCHED_WINDOW_DURATION;
+            return;
+        }
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    OSSchedWindowTbl    = p_tbl;
+    OSSchedWindowNbr    = nbr;
+    OSSchedWindowIx     = 0u;
+    OSSchedWindowCurPtr = &p_tbl[0];
+    OS_SchedWindowTmrSet(p_tbl[0].Duration);                    /* Program the end of the first window                  */
+    CPU_CRITICAL_EXIT();
+
+    if (OSRunning == OS_STATE_OS_RUNNING) {                     /* Run the highest priority task of the first window    */
+        OSSched();
+    }
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              STOP THE SCHEDULE OF WINDOWS
+*
+* Description : Stop the running schedule.  All priorities are then considered by the scheduler again.
+*
+* Arguments   : p_err      is a pointer to a variable containing an error message which will be set by this function to
+*                          either:
+*
+*                              OS_ERR_NONE                     If the schedule was stopped, or none was running
+*                              OS_ERR_SCHED_WINDOW_ISR         If you called this function from an ISR
+*
+* Returns     : none
+*
+* Note(s)     : none
+************************************************************************************************************************
+*/
+
+void  OSSchedWindowStop (OS_ERR  *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_SCHED_WINDOW_ISR;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (OSSchedWindowNbr > 0u) {
+        OSSchedWindowTbl    = (OS_SCHED_WINDOW *)0;
+        OSSchedWindowNbr    = 0u;
+        OSSchedWindowIx     = 0u;
+        OSSchedWindowCurPtr = &OSSchedWindowAll;
+        OS_SchedWindowTmrSet(0u);                               /* Stop the window timer                                */
+    }
+    CPU_CRITICAL_EXIT();
+
+    if (OSRunning == OS_STATE_OS_RUNNING) {
+        OSSched();
+    }
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                            SWITCH TO THE NEXT SCHEDULING WINDOW
+*
+* Description : This function ends the active window and activates the next one of the schedule.  It must be called by
+*               the ISR of the compare timer programmed by OS_SchedWindowTmrSet(), between OSIntEnter() and
+*               OSIntExit().  The task switch to the new window happens in OSIntExit().
+*
+* Arguments   : none
+*
+* Returns     : none
+*
+* Note(s)     : 1) OS_SchedWindowTmrSet(duration) must be implemented in the BSP.  It programs a one-shot interrupt
+*                  'duration' microseconds after the end of the previous window, or stops the timer when 'duration' is
+*                  0.  Counting from the previous compare match rather than from the current time keeps the major
+*                  frame from drifting by the interrupt latency.
+*
+*               2) The switch only swaps the active priority mask, so it takes the same time whatever the number of
+*                  windows or tasks.
+*
+*               3) A task that holds the scheduler lock keeps the CPU until it calls OSSchedUnlock(), even past the end
+*                  of its window.
+************************************************************************************************************************
+*/
+
+void  OSSchedWindowNext (void)
+{
+    OS_SCHED_WINDOW  *p_window;
+    CPU_SR_ALLOC();
+
+
+
+    CPU_CRITICAL_ENTER();
+    if (OSSchedWindowNbr == 0u) {                               /* No schedule is running                               */
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+    OSSchedWindowIx++;
+    if (OSSchedWindowIx >= OSSchedWindowNbr) {                  /* Start the next major frame                           */
+        OSSchedWindowIx = 0u;
+    }
+    p_window            = &OSSchedWindowTbl[OSSchedWindowIx];
+    OSSchedWindowCurPtr =  p_window;                            /* See Note #2                                          */
+    OS_SchedWindowTmrSet(p_window->Duration);
+    CPU_CRITICAL_EXIT();
+
+    if ((OSIntNestingCtr == 0u) &&                              /* Called from a task, switch right away                */
+        (OSRunning       == OS_STATE_OS_RUNNING)) {
+        OSSched();
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                           INITIALIZE THE SCHEDULING WINDOWS
+*
+* Description : This function is called by OSInit() to run without any schedule: every priority may run.
+*
+* Arguments   : none
+*
+* Returns     : none
+*
+* Note(s)     : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_SchedWindowInit (void)
+{
+    CPU_DATA  i;
+
+
+    for (i = 0u; i < OS_PRIO_TBL_SIZE; i++) {
+        OSSchedWindowAll.PrioTbl[i] = (CPU_DATA)~(CPU_DATA)0u;
+    }
+    OSSchedWindowAll.Duration = 0u;
+    OSSchedWindowCurPtr       = &OSSchedWindowAll;
+    OSSchedWindowTbl          = (OS_SCHED_WINDOW *)0;
+    OSSchedWindowNbr          = 0u;
+    OSSchedWindowIx           = 0u;
+}
+
+
+/*
+************************************************************************************************************************
+*                                          SET A PRIORITY IN A WINDOW'S BITMAP
+*
+* Description : This function sets the bit of 'prio' in the priority bitmap of a window.
+*
+* Arguments   : p_window   is a pointer to the window
+*
+*               prio       is the priority to set
+*
+* Returns     : none
+*
+* Note(s)     : 1) The bitmap has the same layout as OSPrioTbl[] (see OS_PrioInsert()).
+************************************************************************************************************************
+*/
+
+static  void  OS_SchedWindowPrioSet (OS_SCHED_WINDOW  *p_window,
+                                     OS_PRIO           prio)
+{
+    CPU_DATA  bit_nbr;
+    OS_PRIO   ix;
+
+
+    ix                     = (OS_PRIO)(prio /  (CPU_CFG_DATA_SIZE * 8u));
+    bit_nbr                = (CPU_DATA)prio & ((CPU_CFG_DATA_SIZE * 8u) - 1u);
+    p_window->PrioTbl[ix] |= (CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - bit_nbr);
+}
+
+#endif
@@ -24,6 +24,7 @@
 */
 
 #define  MICRIUM_SOURCE
+#define  OS_CRIT_SITE_ID                    OS_CRIT_SITE_SEM
 #include "os.h"
 
 #ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
@@ -32,6 +33,33 @@ const  CPU_CHAR  *os_sem__c = "$Id: $";
 
 
 #if (OS_CFG_SEM_EN > 0u)
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SEM_PEND_N_EN > 0u) || (OS_CFG_SEM_POST_N_EN > 0u)
+static  void  OS_SemGrant (OS_SEM  *p_sem,
+                           CPU_TS   ts);
+#endif
+
+static  OS_SEM_CTR  OS_SemPost (OS_SEM  *p_sem,
+                                OS_OPT   opt,
+                                CPU_TS   ts,
+                                OS_ERR  *p_err);
+
+#if (OS_SEM_FAST_EN > 0u)
+static  CPU_BOOLEAN  OS_SemFastPend (OS_SEM      *p_sem,
+                                     CPU_TS      *p_ts,
+                                     OS_SEM_CTR  *p_ctr);
+
+static  CPU_BOOLEAN  OS_SemFastPost (OS_SEM      *p_sem,
+                                     CPU_TS       ts,
+                                     OS_SEM_CTR  *p_ctr);
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                  CREATE A SEMAPHORE
@@ -235,7 +263,7 @@ OS_OBJ_QTY  OSSemDel (OS_SEM  *p_sem,
     nbr_tasks   = 0u;
     switch (opt) {
         case OS_OPT_DEL_NO_PEND:                                /* Delete semaphore only if no task waiting             */
-             if (p_pend_list->HeadPtr == (OS_TCB *)0) {
+             if (OS_PEND_LIST_HEAD(p_pend_list) == (OS_TCB *)0) {
 #if (OS_CFG_DBG_EN > 0u)
                  OS_SemDbgListRemove(p_sem);
                  OSSemQty--;
@@ -256,12 +284,20 @@ OS_OBJ_QTY  OSSemDel (OS_SEM  *p_sem,
 #else
              ts = 0u;
 #endif
-             while (p_pend_list->HeadPtr != (OS_TCB *)0) {      /* Remove all tasks on the pend list                    */
-                 p_tcb = p_pend_list->HeadPtr;
+             p_tcb = OS_PEND_LIST_HEAD(p_pend_list);            /* Remove all tasks on the pend list                    */
+             while (p_tcb != (OS_TCB *)0) {
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+                 OS_PendMultiRdy((OS_PEND_OBJ *)((void *)p_sem),
+                                 p_tcb,
+                                 (void *)0,
+                                 0u,
+                                 ts);
+#endif
                  OS_PendAbort(p_tcb,
                               ts,
                               OS_STATUS_PEND_DEL);
                  nbr_tasks++;
+                 p_tcb = OS_PEND_LIST_HEAD(p_pend_list);
              }
 #if (OS_CFG_DBG_EN > 0u)
              OS_SemDbgListRemove(p_sem);
@@ -305,6 +341,8 @@ OS_OBJ_QTY  OSSemDel (OS_SEM  *p_sem,
 *                                OS_OPT_PEND_BLOCKING
 *                                OS_OPT_PEND_NON_BLOCKING
 *
+*                            Add OS_OPT_PEND_ABS to make 'timeout' the value of OSTickCtr at which to give up.
+*
 *              p_ts          is a pointer to a variable that will receive the timestamp of when the semaphore was posted
 *                            or pend aborted or the semaphore deleted.  If you pass a NULL pointer (i.e. (CPU_TS*)0)
 *                            then you will not get the timestamp.  In other words, passing a NULL pointer is valid
@@ -333,7 +371,14 @@ OS_OBJ_QTY  OSSemDel (OS_SEM  *p_sem,
 *
 * Returns    : The current value of the semaphore counter or 0 if not available.
 *
-* Note(s)    : This API 'MUST NOT' be called from a timer callback function.
+* Note(s)    : 1) This API 'MUST NOT' be called from a timer callback function.
+*
+*              2) When OS_CFG_SEM_PEND_N_EN is enabled, units can be left in the semaphore while tasks wait for more
+*                 than are available.  The caller then only takes a unit if it has a higher priority than all the
+*                 waiting tasks, which keeps the units going to the waiters in priority order.
+*
+*              3) When OS_SEM_FAST_EN is enabled, a unit is taken without a critical section when no task waits on the
+*                 semaphore (see SEMAPHORES Note #2 in os.h).
 ************************************************************************************************************************
 */
 
@@ -344,6 +389,9 @@ OS_SEM_CTR  OSSemPend (OS_SEM   *p_sem,
                        OS_ERR   *p_err)
 {
     OS_SEM_CTR  ctr;
+#if (OS_CFG_SEM_PEND_N_EN > 0u)
+    OS_TCB     *p_tcb;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -394,7 +442,7 @@ OS_SEM_CTR  OSSemPend (OS_SEM   *p_sem,
        *p_err = OS_ERR_OBJ_PTR_NULL;
         return (0u);
     }
-    switch (opt) {                                              /* Validate 'opt'                                       */
+    switch (opt & (OS_OPT)~OS_OPT_PEND_ABS) {                   /* Validate 'opt'                                       */
         case OS_OPT_PEND_BLOCKING:
         case OS_OPT_PEND_NON_BLOCKING:
              break;
@@ -416,10 +464,26 @@ OS_SEM_CTR  OSSemPend (OS_SEM   *p_sem,
     }
 #endif
 
+#if (OS_SEM_FAST_EN > 0u)
+    if (OS_SemFastPend(p_sem, p_ts, &ctr) == OS_TRUE) {         /* See Note #3                                          */
+        OS_TRACE_SEM_PEND(p_sem);
+        OS_TRACE_SEM_PEND_EXIT(OS_ERR_NONE);
+       *p_err = OS_ERR_NONE;
+        return (ctr);
+    }
+#endif
 
     CPU_CRITICAL_ENTER();
+#if (OS_CFG_SEM_PEND_N_EN > 0u)
+    p_tcb = OS_PEND_LIST_HEAD(&p_sem->PendList);
+    if ((p_sem->Ctr > 0u) &&                                    /* Resource available?                                  */
+        ((p_tcb       == (OS_TCB *)0) ||                        /* See Note #2                                          */
+         (p_tcb->Prio >  OSTCBCurPtr->Prio))) {
+#else
     if (p_sem->Ctr > 0u) {                                      /* Resource available?                                  */
+#endif
         p_sem->Ctr--;                                           /* Yes, caller may proceed                              */
+        OS_OBJ_STAT_INC(&p_sem->PendList, PendCtr);
 #if (OS_CFG_TS_EN > 0u)
         if (p_ts != (CPU_TS *)0) {
            *p_ts = p_sem->TS;                                   /* get timestamp of last post                           */
@@ -460,6 +524,10 @@ OS_SEM_CTR  OSSemPend (OS_SEM   *p_sem,
         }
     }
 
+#if (OS_CFG_SEM_PEND_N_EN > 0u)
+    OSTCBCurPtr->SemPendCnt = 1u;                               /* Wait for a single unit                               */
+#endif
+    OS_PEND_ABS_SET(OSTCBCurPtr, opt);
     OS_Pend((OS_PEND_OBJ *)((void *)p_sem),                     /* Block task pending on Semaphore                      */
             OSTCBCurPtr,
             OS_TASK_PEND_ON_SEM,
@@ -526,48 +594,40 @@ OS_SEM_CTR  OSSemPend (OS_SEM   *p_sem,
 
 /*
 ************************************************************************************************************************
-*                                             ABORT WAITING ON A SEMAPHORE
+*                                   PEND ON SEMAPHORE WITH A TIMEOUT IN MICROSECONDS
 *
-* Description: This function aborts & readies any tasks currently waiting on a semaphore.  This function should be used
-*              to fault-abort the wait on the semaphore, rather than to normally signal the semaphore via OSSemPost().
+* Description: This function is the same as OSSemPend() except that the timeout is given in microseconds.
 *
-* Arguments  : p_sem     is a pointer to the semaphore
+* Arguments  : p_sem         is a pointer to the semaphore
 *
-*              opt       determines the type of ABORT performed:
+*              timeout_us    is an optional timeout in microseconds.  If non-zero, your task will wait up to this long
+*                            and a timeout is detected with the resolution of OS_TS_GET().  If you specify 0, your
+*                            task will wait forever.
 *
-*                            OS_OPT_PEND_ABORT_1          ABORT wait for a single task (HPT) waiting on the semaphore
-*                            OS_OPT_PEND_ABORT_ALL        ABORT wait for ALL tasks that are  waiting on the semaphore
-*                            OS_OPT_POST_NO_SCHED         Do not call the scheduler
+*              ...           are the other arguments of OSSemPend().
 *
-*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.  In
+*                            addition to the error codes of OSSemPend():
 *
-*                            OS_ERR_NONE                  At least one task waiting on the semaphore was readied and
-*                                                         informed of the aborted wait; check return value for the
-*                                                         number of tasks whose wait on the semaphore was aborted.
-*                            OS_ERR_OBJ_PTR_NULL          If 'p_sem' is a NULL pointer.
-*                            OS_ERR_OBJ_TYPE              If 'p_sem' is not pointing at a semaphore
-*                            OS_ERR_OPT_INVALID           If you specified an invalid option
-*                            OS_ERR_OS_NOT_RUNNING        If uC/OS-III is not running yet
-*                            OS_ERR_PEND_ABORT_ISR        If you called this function from an ISR
-*                            OS_ERR_PEND_ABORT_NONE       No task were pending
+*                                OS_ERR_TIME_INVALID_MICROSECONDS   If 'timeout_us' is too long for the timestamp
+*                                                                   or the timestamp frequency is unknown
 *
-* Returns    : == 0          if no tasks were waiting on the semaphore, or upon error.
-*              >  0          if one or more tasks waiting on the semaphore are now readied and informed.
+* Returns    : See OSSemPend().
 *
-* Note(s)    : none
+* Note(s)    : 1) From an ISR or before the kernel runs, the call is passed to OSSemPend() without a timeout so that
+*                 it performs its usual checks.
 ************************************************************************************************************************
 */
 
-#if (OS_CFG_SEM_PEND_ABORT_EN > 0u)
-OS_OBJ_QTY  OSSemPendAbort (OS_SEM  *p_sem,
-                            OS_OPT   opt,
-                            OS_ERR  *p_err)
+#if (OS_CFG_TIME_HR_EN > 0u)
+OS_SEM_CTR  OSSemPendUs (OS_SEM      *p_sem,
+                         CPU_INT32U   timeout_us,
+                         OS_OPT       opt,
+                         CPU_TS      *p_ts,
+                         OS_ERR      *p_err)
 {
-    OS_PEND_LIST  *p_pend_list;
-    OS_TCB        *p_tcb;
-    CPU_TS         ts;
-    OS_OBJ_QTY     nbr_tasks;
-    CPU_SR_ALLOC();
+    OS_SEM_CTR  ctr;
+    CPU_TS      dly;
 
 
 #ifdef OS_SAFETY_CRITICAL
@@ -577,125 +637,100 @@ OS_OBJ_QTY  OSSemPendAbort (OS_SEM  *p_sem,
     }
 #endif
 
-#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
-    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to Pend Abort from an ISR                */
-       *p_err =  OS_ERR_PEND_ABORT_ISR;
-        return (0u);
-    }
-#endif
-
-#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
-    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
-       *p_err = OS_ERR_OS_NOT_RUNNING;
-        return (0u);
-    }
-#endif
-
-#if (OS_CFG_ARG_CHK_EN > 0u)
-    if (p_sem == (OS_SEM *)0) {                                 /* Validate 'p_sem'                                     */
-       *p_err =  OS_ERR_OBJ_PTR_NULL;
-        return (0u);
-    }
-    switch (opt) {                                              /* Validate 'opt'                                       */
-        case OS_OPT_PEND_ABORT_1:
-        case OS_OPT_PEND_ABORT_ALL:
-        case OS_OPT_PEND_ABORT_1   | OS_OPT_POST_NO_SCHED:
-        case OS_OPT_PEND_ABORT_ALL | OS_OPT_POST_NO_SCHED:
-             break;
-
-        default:
-            *p_err =  OS_ERR_OPT_INVALID;
-             return (0u);
-    }
-#endif
-
-#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
-    if (p_sem->Type != OS_OBJ_TYPE_SEM) {                       /* Make sure semaphore was created                      */
-       *p_err =  OS_ERR_OBJ_TYPE;
-        return (0u);
+    if ((timeout_us      ==                   0u) ||            /* Without a timeout, the regular pend does it all      */
+        (OSIntNestingCtr >                    0u) ||
+        (OSRunning       != OS_STATE_OS_RUNNING)) {
+        return (OSSemPend(p_sem, 0u, opt, p_ts, p_err));
     }
-#endif
 
-    CPU_CRITICAL_ENTER();
-    p_pend_list = &p_sem->PendList;
-    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on semaphore?                       */
-        CPU_CRITICAL_EXIT();                                    /* No                                                   */
-       *p_err =  OS_ERR_PEND_ABORT_NONE;
+    dly = OS_TickHrUsToTS(timeout_us);
+    if ((dly == 0u) || (dly > OS_TICK_HR_DLY_MAX)) {
+       *p_err = OS_ERR_TIME_INVALID_MICROSECONDS;
         return (0u);
     }
 
-    nbr_tasks = 0u;
-#if (OS_CFG_TS_EN > 0u)
-    ts        = OS_TS_GET();                                    /* Get local time stamp so all tasks get the same time  */
-#else
-    ts        = 0u;
-#endif
-    while (p_pend_list->HeadPtr != (OS_TCB *)0) {
-        p_tcb = p_pend_list->HeadPtr;
-        OS_PendAbort(p_tcb,
-                     ts,
-                     OS_STATUS_PEND_ABORT);
-        nbr_tasks++;
-        if (opt != OS_OPT_PEND_ABORT_ALL) {                     /* Pend abort all tasks waiting?                        */
-            break;                                              /* No                                                   */
-        }
-    }
-    CPU_CRITICAL_EXIT();
-
-    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
-        OSSched();                                              /* Run the scheduler                                    */
-    }
+    OSTCBCurPtr->TickHrDly = dly;                               /* OS_TaskBlock() uses it instead of the tick timeout   */
+    ctr = OSSemPend(p_sem, 1u, opt, p_ts, p_err);
+    OSTCBCurPtr->TickHrDly = 0u;                                /* Clear it in case the task did not have to wait       */
 
-   *p_err = OS_ERR_NONE;
-    return (nbr_tasks);
+    return (ctr);
 }
 #endif
 
 
 /*
 ************************************************************************************************************************
-*                                                 POST TO A SEMAPHORE
+*                                         PEND ON SEVERAL UNITS OF A SEMAPHORE
 *
-* Description: This function signals a semaphore.
+* Description: This function waits until 'cnt' units of a counting semaphore are available and takes them all at once.
 *
-* Arguments  : p_sem    is a pointer to the semaphore
+* Arguments  : p_sem         is a pointer to the semaphore
 *
-*              opt      determines the type of POST performed:
+*              cnt           is the number of units to take (must be at least 1)
 *
-*                           OS_OPT_POST_1            POST and ready only the highest priority task waiting on semaphore
-*                                                    (if tasks are waiting).
-*                           OS_OPT_POST_ALL          POST to ALL tasks that are waiting on the semaphore
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for the
+*                            units up to the amount of time (in 'ticks') specified by this argument.  If you specify 0,
+*                            however, your task will wait forever at the specified semaphore or, until the units
+*                            become available.
 *
-*                           OS_OPT_POST_NO_SCHED     Do not call the scheduler
+*              opt           determines whether the user wants to block if the units are not available or not:
 *
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
 *
-*              p_err    is a pointer to a variable that will contain an error code returned by this function.
+*                            Add OS_OPT_PEND_ABS to make 'timeout' the value of OSTickCtr at which to give up.
 *
-*                           OS_ERR_NONE              The call was successful and the semaphore was signaled
-*                           OS_ERR_OBJ_PTR_NULL      If 'p_sem' is a NULL pointer
-*                           OS_ERR_OBJ_TYPE          If 'p_sem' is not pointing at a semaphore
-*                           OS_ERR_OPT_INVALID       If you specified an invalid option
-*                           OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
-*                           OS_ERR_SEM_OVF           If the post would cause the semaphore count to overflow
+*              p_ts          is a pointer to a variable that will receive the timestamp of when the semaphore was posted
+*                            or pend aborted or the semaphore deleted.  If you pass a NULL pointer (i.e. (CPU_TS*)0)
+*                            then you will not get the timestamp.
 *
-* Returns    : The current value of the semaphore counter or 0 upon error.
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
 *
-* Note(s)    : 1) OS_OPT_POST_NO_SCHED can be added with one of the other options.
+*                                OS_ERR_NONE               The call was successful and your task got the 'cnt' units
+*                                OS_ERR_OBJ_DEL            If 'p_sem' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_sem' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_sem' is not pointing at a semaphore
+*                                OS_ERR_OPT_INVALID        If you specified an invalid value for 'opt'
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         If the pend was aborted by another task
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR and the result
+*                                                          would lead to a suspension
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the units were not
+*                                                          available
+*                                OS_ERR_SCHED_LOCKED       If you called this function when the scheduler is locked
+*                                OS_ERR_SEM_CNT_INVALID    If 'cnt' is 0
+*                                OS_ERR_STATUS_INVALID     Pend status is invalid
+*                                OS_ERR_TIMEOUT            The units were not received within the specified timeout
+*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*
+* Returns    : The current value of the semaphore counter.
+*
+* Note(s)    : 1) No unit is taken until all 'cnt' are available: the task never holds part of what it asked for.
+*
+*              2) The waiters are served in priority order.  A task waiting for more units than are available holds
+*                 back the lower priority waiters, even those that could be satisfied, until it gets its units.
+*
+*              3) This API 'MUST NOT' be called from a timer callback function.
 ************************************************************************************************************************
 */
 
-OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,
-                       OS_OPT   opt,
-                       OS_ERR  *p_err)
+#if (OS_CFG_SEM_PEND_N_EN > 0u)
+OS_SEM_CTR  OSSemPendN (OS_SEM      *p_sem,
+                        OS_SEM_CTR   cnt,
+                        OS_TICK      timeout,
+                        OS_OPT       opt,
+                        CPU_TS      *p_ts,
+                        OS_ERR      *p_err)
 {
-    OS_SEM_CTR     ctr;
-    OS_PEND_LIST  *p_pend_list;
-    OS_TCB        *p_tcb;
-    OS_TCB        *p_tcb_next;
-    CPU_TS         ts;
+    OS_SEM_CTR  ctr;
+    OS_TCB     *p_tcb;
     CPU_SR_ALLOC();
 
 
+#if (OS_CFG_TS_EN == 0u)
+    (void)p_ts;                                                 /* Prevent compiler warning for not using 'ts'          */
+#endif
+
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == (OS_ERR *)0) {
         OS_SAFETY_CRITICAL_EXCEPTION();
@@ -703,11 +738,31 @@ OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,
     }
 #endif
 
-    OS_TRACE_SEM_POST_ENTER(p_sem, opt);
+    OS_TRACE_SEM_PEND_ENTER(p_sem, timeout, opt, p_ts);
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        OS_TRACE_SEM_PEND_FAILED(p_sem);
+        OS_TRACE_SEM_PEND_EXIT(OS_ERR_TICK_DISABLED);
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != OS_OPT_PEND_NON_BLOCKING) {
+            OS_TRACE_SEM_PEND_FAILED(p_sem);
+            OS_TRACE_SEM_PEND_EXIT(OS_ERR_PEND_ISR);
+           *p_err = OS_ERR_PEND_ISR;
+            return (0u);
+        }
+    }
+#endif
 
 #if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
     if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
-        OS_TRACE_SEM_POST_EXIT(OS_ERR_OS_NOT_RUNNING);
+        OS_TRACE_SEM_PEND_EXIT(OS_ERR_OS_NOT_RUNNING);
        *p_err = OS_ERR_OS_NOT_RUNNING;
         return (0u);
     }
@@ -715,83 +770,661 @@ OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,
 
 #if (OS_CFG_ARG_CHK_EN > 0u)
     if (p_sem == (OS_SEM *)0) {                                 /* Validate 'p_sem'                                     */
-        OS_TRACE_SEM_POST_FAILED(p_sem);
-        OS_TRACE_SEM_POST_EXIT(OS_ERR_OBJ_PTR_NULL);
-       *p_err  = OS_ERR_OBJ_PTR_NULL;
+        OS_TRACE_SEM_PEND_EXIT(OS_ERR_OBJ_PTR_NULL);
+       *p_err = OS_ERR_OBJ_PTR_NULL;
         return (0u);
     }
-    switch (opt) {                                              /* Validate 'opt'                                       */
-        case OS_OPT_POST_1:
-        case OS_OPT_POST_ALL:
-        case OS_OPT_POST_1   | OS_OPT_POST_NO_SCHED:
-        case OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED:
+    if (cnt == 0u) {                                            /* Validate 'cnt'                                       */
+        OS_TRACE_SEM_PEND_FAILED(p_sem);
+        OS_TRACE_SEM_PEND_EXIT(OS_ERR_SEM_CNT_INVALID);
+       *p_err = OS_ERR_SEM_CNT_INVALID;
+        return (0u);
+    }
+    switch (opt & (OS_OPT)~OS_OPT_PEND_ABS) {                   /* Validate 'opt'                                       */
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
              break;
 
         default:
-             OS_TRACE_SEM_POST_FAILED(p_sem);
-             OS_TRACE_SEM_POST_EXIT(OS_ERR_OPT_INVALID);
-            *p_err =  OS_ERR_OPT_INVALID;
+             OS_TRACE_SEM_PEND_FAILED(p_sem);
+             OS_TRACE_SEM_PEND_EXIT(OS_ERR_OPT_INVALID);
+            *p_err = OS_ERR_OPT_INVALID;
              return (0u);
     }
 #endif
 
 #if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
     if (p_sem->Type != OS_OBJ_TYPE_SEM) {                       /* Make sure semaphore was created                      */
-        OS_TRACE_SEM_POST_FAILED(p_sem);
-        OS_TRACE_SEM_POST_EXIT(OS_ERR_OBJ_TYPE);
+        OS_TRACE_SEM_PEND_FAILED(p_sem);
+        OS_TRACE_SEM_PEND_EXIT(OS_ERR_OBJ_TYPE);
        *p_err = OS_ERR_OBJ_TYPE;
         return (0u);
     }
 #endif
-#if (OS_CFG_TS_EN > 0u)
-    ts = OS_TS_GET();                                           /* Get timestamp                                        */
-#else
-    ts = 0u;
-#endif
 
-    OS_TRACE_SEM_POST(p_sem);
+
     CPU_CRITICAL_ENTER();
-    p_pend_list = &p_sem->PendList;
-    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on semaphore?                       */
-        if (p_sem->Ctr == (OS_SEM_CTR)-1) {
-           CPU_CRITICAL_EXIT();
-          *p_err = OS_ERR_SEM_OVF;
-           OS_TRACE_SEM_POST_EXIT(*p_err);
-           return (0u);
-        }
-        p_sem->Ctr++;                                           /* No                                                   */
-        ctr       = p_sem->Ctr;
+    p_tcb = OS_PEND_LIST_HEAD(&p_sem->PendList);
+    if ((p_sem->Ctr >= cnt) &&                                  /* Units available?                                     */
+        ((p_tcb       == (OS_TCB *)0) ||                        /* ... and no waiter ahead of the caller (See Note #2)  */
+         (p_tcb->Prio >  OSTCBCurPtr->Prio))) {
+        p_sem->Ctr -= cnt;                                      /* Yes, caller may proceed                              */
+        OS_OBJ_STAT_INC(&p_sem->PendList, PendCtr);
 #if (OS_CFG_TS_EN > 0u)
-        p_sem->TS = ts;                                         /* Save timestamp in semaphore control block            */
+        if (p_ts != (CPU_TS *)0) {
+           *p_ts = p_sem->TS;                                   /* get timestamp of last post                           */
+        }
 #endif
+        ctr   = p_sem->Ctr;
+        OS_TRACE_SEM_PEND(p_sem);
         CPU_CRITICAL_EXIT();
-       *p_err     = OS_ERR_NONE;
-        OS_TRACE_SEM_POST_EXIT(*p_err);
+        OS_TRACE_SEM_PEND_EXIT(OS_ERR_NONE);
+       *p_err = OS_ERR_NONE;
         return (ctr);
     }
 
-    p_tcb = p_pend_list->HeadPtr;
-    while (p_tcb != (OS_TCB *)0) {
-        p_tcb_next = p_tcb->PendNextPtr;
-        OS_Post((OS_PEND_OBJ *)((void *)p_sem),
-                p_tcb,
-                (void *)0,
-                0u,
-                ts);
-        if ((opt & OS_OPT_POST_ALL) == 0u) {                     /* Post to all tasks waiting?                           */
-            break;                                              /* No                                                   */
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+#if (OS_CFG_TS_EN > 0u)
+        if (p_ts != (CPU_TS *)0) {
+           *p_ts = 0u;
+        }
+#endif
+        ctr   = p_sem->Ctr;                                     /* No                                                   */
+        CPU_CRITICAL_EXIT();
+        OS_TRACE_SEM_PEND_FAILED(p_sem);
+        OS_TRACE_SEM_PEND_EXIT(OS_ERR_PEND_WOULD_BLOCK);
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;
+        return (ctr);
+    } else {                                                    /* Yes                                                  */
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+#if (OS_CFG_TS_EN > 0u)
+            if (p_ts != (CPU_TS *)0) {
+               *p_ts = 0u;
+            }
+#endif
+            CPU_CRITICAL_EXIT();
+            OS_TRACE_SEM_PEND_FAILED(p_sem);
+            OS_TRACE_SEM_PEND_EXIT(OS_ERR_SCHED_LOCKED);
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return (0u);
+        }
+    }
+
+    OSTCBCurPtr->SemPendCnt = cnt;                              /* Units handed over by OS_SemGrant()                   */
+    OS_PEND_ABS_SET(OSTCBCurPtr, opt);
+    OS_Pend((OS_PEND_OBJ *)((void *)p_sem),                     /* Block task pending on Semaphore                      */
+            OSTCBCurPtr,
+            OS_TASK_PEND_ON_SEM,
+            timeout);
+    CPU_CRITICAL_EXIT();
+    OS_TRACE_SEM_PEND_BLOCK(p_sem);
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* We got the units                                     */
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+             OS_TRACE_SEM_PEND(p_sem);
+            *p_err = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+             OS_TRACE_SEM_PEND_FAILED(p_sem);
+            *p_err = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that we didn't get the units within timeout */
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = 0u;
+             }
+#endif
+             OS_TRACE_SEM_PEND_FAILED(p_sem);
+            *p_err = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+             OS_TRACE_SEM_PEND_FAILED(p_sem);
+            *p_err = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+             OS_TRACE_SEM_PEND_FAILED(p_sem);
+            *p_err = OS_ERR_STATUS_INVALID;
+             CPU_CRITICAL_EXIT();
+             OS_TRACE_SEM_PEND_EXIT(*p_err);
+             return (0u);
+    }
+    ctr = p_sem->Ctr;
+    CPU_CRITICAL_EXIT();
+    OS_TRACE_SEM_PEND_EXIT(*p_err);
+    return (ctr);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                             ABORT WAITING ON A SEMAPHORE
+*
+* Description: This function aborts & readies any tasks currently waiting on a semaphore.  This function should be used
+*              to fault-abort the wait on the semaphore, rather than to normally signal the semaphore via OSSemPost().
+*
+* Arguments  : p_sem     is a pointer to the semaphore
+*
+*              opt       determines the type of ABORT performed:
+*
+*                            OS_OPT_PEND_ABORT_1          ABORT wait for a single task (HPT) waiting on the semaphore
+*                            OS_OPT_PEND_ABORT_ALL        ABORT wait for ALL tasks that are  waiting on the semaphore
+*                            OS_OPT_POST_NO_SCHED         Do not call the scheduler
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                  At least one task waiting on the semaphore was readied and
+*                                                         informed of the aborted wait; check return value for the
+*                                                         number of tasks whose wait on the semaphore was aborted.
+*                            OS_ERR_OBJ_PTR_NULL          If 'p_sem' is a NULL pointer.
+*                            OS_ERR_OBJ_TYPE              If 'p_sem' is not pointing at a semaphore
+*                            OS_ERR_OPT_INVALID           If you specified an invalid option
+*                            OS_ERR_OS_NOT_RUNNING        If uC/OS-III is not running yet
+*                            OS_ERR_PEND_ABORT_ISR        If you called this function from an ISR
+*                            OS_ERR_PEND_ABORT_NONE       No task were pending
+*
+* Returns    : == 0          if no tasks were waiting on the semaphore, or upon error.
+*              >  0          if one or more tasks waiting on the semaphore are now readied and informed.
+*
+* Note(s)    : 1) The units an aborted OSSemPendN() was waiting for may be enough for the tasks behind it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SEM_PEND_ABORT_EN > 0u)
+OS_OBJ_QTY  OSSemPendAbort (OS_SEM  *p_sem,
+                            OS_OPT   opt,
+                            OS_ERR  *p_err)
+{
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    CPU_TS         ts;
+    OS_OBJ_QTY     nbr_tasks;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to Pend Abort from an ISR                */
+       *p_err =  OS_ERR_PEND_ABORT_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_sem == (OS_SEM *)0) {                                 /* Validate 'p_sem'                                     */
+       *p_err =  OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_PEND_ABORT_1:
+        case OS_OPT_PEND_ABORT_ALL:
+        case OS_OPT_PEND_ABORT_1   | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_PEND_ABORT_ALL | OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err =  OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_sem->Type != OS_OBJ_TYPE_SEM) {                       /* Make sure semaphore was created                      */
+       *p_err =  OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_sem->PendList;
+    if (OS_PEND_LIST_HEAD(p_pend_list) == (OS_TCB *)0) {        /* Any task waiting on semaphore?                       */
+        CPU_CRITICAL_EXIT();                                    /* No                                                   */
+       *p_err =  OS_ERR_PEND_ABORT_NONE;
+        return (0u);
+    }
+
+    nbr_tasks = 0u;
+#if (OS_CFG_TS_EN > 0u)
+    ts        = OS_TS_GET();                                    /* Get local time stamp so all tasks get the same time  */
+#else
+    ts        = 0u;
+#endif
+    p_tcb = OS_PEND_LIST_HEAD(p_pend_list);
+    while (p_tcb != (OS_TCB *)0) {
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+        OS_PendMultiRdy((OS_PEND_OBJ *)((void *)p_sem),
+                        p_tcb,
+                        (void *)0,
+                        0u,
+                        ts);
+#endif
+        OS_PendAbort(p_tcb,
+                     ts,
+                     OS_STATUS_PEND_ABORT);
+        nbr_tasks++;
+        if (opt != OS_OPT_PEND_ABORT_ALL) {                     /* Pend abort all tasks waiting?                        */
+            break;                                              /* No                                                   */
+        }
+        p_tcb = OS_PEND_LIST_HEAD(p_pend_list);
+    }
+#if (OS_CFG_SEM_PEND_N_EN > 0u)
+    OS_SemGrant(p_sem, ts);                                     /* See Note #1                                          */
+#endif
+    CPU_CRITICAL_EXIT();
+
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+
+   *p_err = OS_ERR_NONE;
+    return (nbr_tasks);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                 POST TO A SEMAPHORE
+*
+* Description: This function signals a semaphore.
+*
+* Arguments  : p_sem    is a pointer to the semaphore
+*
+*              opt      determines the type of POST performed:
+*
+*                           OS_OPT_POST_1            POST and ready only the highest priority task waiting on semaphore
+*                                                    (if tasks are waiting).
+*                           OS_OPT_POST_ALL          POST to ALL tasks that are waiting on the semaphore
+*
+*                           OS_OPT_POST_NO_SCHED     Do not call the scheduler
+*
+*
+*              p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                           OS_ERR_NONE              The call was successful and the semaphore was signaled
+*                           OS_ERR_OBJ_PTR_NULL      If 'p_sem' is a NULL pointer
+*                           OS_ERR_OBJ_TYPE          If 'p_sem' is not pointing at a semaphore
+*                           OS_ERR_OPT_INVALID       If you specified an invalid option
+*                           OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*                           OS_ERR_SEM_OVF           If the post would cause the semaphore count to overflow
+*                           OS_ERR_INT_Q_FULL        If the post was deferred and the ISR queue is full
+*
+* Returns    : The current value of the semaphore counter or 0 upon error.
+*
+* Note(s)    : 1) OS_OPT_POST_NO_SCHED can be added with one of the other options.
+*
+*              2) When OS_CFG_SEM_PEND_N_EN is enabled, the highest priority task waiting may need more than one unit.
+*                 OS_OPT_POST_1 then adds the unit to the semaphore and readies the waiter once it has enough of them.
+*                 OS_OPT_POST_ALL still readies all the waiting tasks, whatever the number of units they wait for.
+*
+*              3) When OS_CFG_POST_ALL_INT_EN is enabled, OS_OPT_POST_ALL readies the waiting tasks one at a time with
+*                 the scheduler locked, so interrupts are not kept disabled for the whole broadcast (see OS_PostAll()).
+*
+*              4) When OS_CFG_ISR_POST_DEFERRED_EN is enabled, a post from an ISR is queued for the ISR handler task
+*                 and 0 is returned.
+*
+*              5) When OS_SEM_FAST_EN is enabled, the unit is added without a critical section when no task waits on
+*                 the semaphore (see SEMAPHORES Note #2 in os.h).
+************************************************************************************************************************
+*/
+
+OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,
+                       OS_OPT   opt,
+                       OS_ERR  *p_err)
+{
+    CPU_TS  ts;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+    OS_TRACE_SEM_POST_ENTER(p_sem, opt);
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+        OS_TRACE_SEM_POST_EXIT(OS_ERR_OS_NOT_RUNNING);
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_sem == (OS_SEM *)0) {                                 /* Validate 'p_sem'                                     */
+        OS_TRACE_SEM_POST_FAILED(p_sem);
+        OS_TRACE_SEM_POST_EXIT(OS_ERR_OBJ_PTR_NULL);
+       *p_err  = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_1:
+        case OS_OPT_POST_ALL:
+        case OS_OPT_POST_1   | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+             OS_TRACE_SEM_POST_FAILED(p_sem);
+             OS_TRACE_SEM_POST_EXIT(OS_ERR_OPT_INVALID);
+            *p_err =  OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_sem->Type != OS_OBJ_TYPE_SEM) {                       /* Make sure semaphore was created                      */
+        OS_TRACE_SEM_POST_FAILED(p_sem);
+        OS_TRACE_SEM_POST_EXIT(OS_ERR_OBJ_TYPE);
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Defer the post when called from an ISR               */
+        OS_IntQPost(OS_OBJ_TYPE_SEM,
+                    (void *)p_sem,
+                    (void *)0,
+                    0u,
+                    0u,
+                    opt,
+                    p_err);
+        OS_TRACE_SEM_POST_EXIT(*p_err);
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    return (OS_SemPost(p_sem, opt, ts, p_err));
+}
+
+
+/*
+************************************************************************************************************************
+*                                           POST TO A SEMAPHORE FROM AN ISR
+*
+* Description: This function is the same as OSSemPost() but is only called from an ISR.  It does not check whether the
+*              kernel is running and never calls the scheduler: the highest priority task ready to run is switched to
+*              once, by OSIntExit().
+*
+* Arguments  : p_sem     is a pointer to the semaphore
+*
+*              opt       determines the type of POST performed (see OSSemPost()).  OS_OPT_POST_NO_SCHED is implied.
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function (see
+*                        OSSemPost())
+*
+* Returns    : The current value of the semaphore counter or 0 upon error.
+*
+* Note(s)    : 1) This function MUST only be called from an ISR, between OSIntEnter() and OSIntExit().
+*
+*              2) When OS_CFG_ISR_POST_DEFERRED_EN is enabled, the post is queued for the ISR handler task and 0 is
+*                 returned.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_POST_FROM_ISR_EN > 0u)
+OS_SEM_CTR  OSSemPostFromISR (OS_SEM  *p_sem,
+                              OS_OPT   opt,
+                              OS_ERR  *p_err)
+{
+#if (OS_CFG_ISR_POST_DEFERRED_EN == 0u)
+    CPU_TS  ts;
+#endif
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+    OS_TRACE_SEM_POST_ENTER(p_sem, opt);
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_sem == (OS_SEM *)0) {                                 /* Validate 'p_sem'                                     */
+        OS_TRACE_SEM_POST_FAILED(p_sem);
+        OS_TRACE_SEM_POST_EXIT(OS_ERR_OBJ_PTR_NULL);
+       *p_err  = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_1:
+        case OS_OPT_POST_ALL:
+        case OS_OPT_POST_1   | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+             OS_TRACE_SEM_POST_FAILED(p_sem);
+             OS_TRACE_SEM_POST_EXIT(OS_ERR_OPT_INVALID);
+            *p_err =  OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_sem->Type != OS_OBJ_TYPE_SEM) {                       /* Make sure semaphore was created                      */
+        OS_TRACE_SEM_POST_FAILED(p_sem);
+        OS_TRACE_SEM_POST_EXIT(OS_ERR_OBJ_TYPE);
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    OS_IntQPost(OS_OBJ_TYPE_SEM,                                /* See Note #2                                          */
+                (void *)p_sem,
+                (void *)0,
+                0u,
+                0u,
+                opt,
+                p_err);
+    OS_TRACE_SEM_POST_EXIT(*p_err);
+    return (0u);
+#else
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    return (OS_SemPost(p_sem, (OS_OPT)(opt | OS_OPT_POST_NO_SCHED), ts, p_err));
+#endif
+}
+#endif
+
+
+
+
+/*
+************************************************************************************************************************
+*                                           POST SEVERAL UNITS TO A SEMAPHORE
+*
+* Description: This function adds 'cnt' units to a counting semaphore and readies as many of the waiting tasks as the
+*              units allow, in priority order.
+*
+* Arguments  : p_sem    is a pointer to the semaphore
+*
+*              cnt      is the number of units to add (must be at least 1)
+*
+*              opt      determines the type of POST performed:
+*
+*                           OS_OPT_POST_NONE         No special option selected
+*                           OS_OPT_POST_NO_SCHED     Do not call the scheduler
+*
+*              p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                           OS_ERR_NONE              The call was successful and the units were added
+*                           OS_ERR_OBJ_PTR_NULL      If 'p_sem' is a NULL pointer
+*                           OS_ERR_OBJ_TYPE          If 'p_sem' is not pointing at a semaphore
+*                           OS_ERR_OPT_INVALID       If you specified an invalid option
+*                           OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*                           OS_ERR_SEM_CNT_INVALID   If 'cnt' is 0
+*                           OS_ERR_SEM_OVF           If the post would cause the semaphore count to overflow
+*
+* Returns    : The current value of the semaphore counter or 0 upon error.
+*
+* Note(s)    : 1) All the tasks readied by the post are readied in the same critical section and the scheduler is only
+*                 called once, after the last of them.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SEM_POST_N_EN > 0u)
+OS_SEM_CTR  OSSemPostN (OS_SEM      *p_sem,
+                        OS_SEM_CTR   cnt,
+                        OS_OPT       opt,
+                        OS_ERR      *p_err)
+{
+    OS_SEM_CTR   ctr;
+    CPU_TS       ts;
+#if (OS_CFG_REACTOR_EN > 0u)
+    CPU_BOOLEAN  rdy;
+#endif
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+    OS_TRACE_SEM_POST_ENTER(p_sem, opt);
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+        OS_TRACE_SEM_POST_EXIT(OS_ERR_OS_NOT_RUNNING);
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_sem == (OS_SEM *)0) {                                 /* Validate 'p_sem'                                     */
+        OS_TRACE_SEM_POST_FAILED(p_sem);
+        OS_TRACE_SEM_POST_EXIT(OS_ERR_OBJ_PTR_NULL);
+       *p_err  = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    if (cnt == 0u) {                                            /* Validate 'cnt'                                       */
+        OS_TRACE_SEM_POST_FAILED(p_sem);
+        OS_TRACE_SEM_POST_EXIT(OS_ERR_SEM_CNT_INVALID);
+       *p_err  = OS_ERR_SEM_CNT_INVALID;
+        return (0u);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+             OS_TRACE_SEM_POST_FAILED(p_sem);
+             OS_TRACE_SEM_POST_EXIT(OS_ERR_OPT_INVALID);
+            *p_err =  OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_sem->Type != OS_OBJ_TYPE_SEM) {                       /* Make sure semaphore was created                      */
+        OS_TRACE_SEM_POST_FAILED(p_sem);
+        OS_TRACE_SEM_POST_EXIT(OS_ERR_OBJ_TYPE);
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    OS_TRACE_SEM_POST(p_sem);
+    CPU_CRITICAL_ENTER();
+    OS_OBJ_STAT_INC(&p_sem->PendList, PostCtr);
+    if (((OS_SEM_CTR)-1 - p_sem->Ctr) < cnt) {                  /* Would the counter overflow?                          */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_SEM_OVF;
+        OS_TRACE_SEM_POST_EXIT(*p_err);
+        return (0u);
+    }
+    p_sem->Ctr += cnt;
+#if (OS_CFG_TS_EN > 0u)
+    p_sem->TS   = ts;                                           /* Save timestamp in semaphore control block            */
+#endif
+    if (OS_PEND_LIST_HEAD(&p_sem->PendList) == (OS_TCB *)0) {   /* Any task waiting on semaphore?                       */
+        ctr = p_sem->Ctr;                                       /* No                                                   */
+#if (OS_CFG_REACTOR_EN > 0u)
+        rdy = OS_ReactorSrcRdy(p_sem->PendList.ReactorSrcPtr, ts);
+#endif
+        CPU_CRITICAL_EXIT();
+#if (OS_CFG_REACTOR_EN > 0u)
+        if ((rdy                          == OS_TRUE) &&        /* Run the task of the reactor watching the semaphore   */
+            ((opt & OS_OPT_POST_NO_SCHED) ==      0u)) {
+            OSSched();
         }
-        p_tcb = p_tcb_next;
+#endif
+       *p_err = OS_ERR_NONE;
+        OS_TRACE_SEM_POST_EXIT(*p_err);
+        return (ctr);
     }
+
+    OS_SemGrant(p_sem, ts);                                     /* Ready the waiters the units are enough for           */
+    ctr = p_sem->Ctr;
     CPU_CRITICAL_EXIT();
     if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
-        OSSched();                                              /* Run the scheduler                                    */
+        OSSched();                                              /* See Note #1                                          */
     }
    *p_err = OS_ERR_NONE;
 
     OS_TRACE_SEM_POST_EXIT(*p_err);
-    return (0u);
+    return (ctr);
 }
+#endif
 
 
 /*
@@ -865,7 +1498,7 @@ void  OSSemSet (OS_SEM      *p_sem,
         p_sem->Ctr = cnt;                                       /* Yes, set it to the new value specified.              */
     } else {
         p_pend_list = &p_sem->PendList;                         /* No                                                   */
-        if (p_pend_list->HeadPtr == (OS_TCB *)0) {              /* See if task(s) waiting?                              */
+        if (OS_PEND_LIST_HEAD(p_pend_list) == (OS_TCB *)0) {    /* See if task(s) waiting?                              */
             p_sem->Ctr = cnt;                                   /* No, OK to set the value                              */
         } else {
            *p_err      = OS_ERR_TASK_WAITING;
@@ -934,6 +1567,10 @@ void  OS_SemDbgListAdd (OS_SEM  *p_sem)
         OSSemDbgListPtr->DbgPrevPtr =  p_sem;
     }
     OSSemDbgListPtr                 =  p_sem;
+
+#if (OS_CFG_OBJ_REG_EN > 0u)
+    OS_ObjRegAdd((void *)p_sem, OS_OBJ_TYPE_SEM, p_sem->NamePtr);
+#endif
 }
 
 
@@ -963,6 +1600,307 @@ void  OS_SemDbgListRemove (OS_SEM  *p_sem)
         p_sem->DbgNextPtr      = (OS_SEM *)0;
         p_sem->DbgPrevPtr      = (OS_SEM *)0;
     }
+
+#if (OS_CFG_OBJ_REG_EN > 0u)
+    OS_ObjRegRemove((void *)p_sem, OS_OBJ_TYPE_SEM, p_sem->NamePtr);
+#endif
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                         HAND THE UNITS OF A SEMAPHORE TO ITS WAITERS
+*
+* Description: This function readies the tasks waiting on a semaphore, in priority order, for as long as the units left
+*              in the semaphore are enough for the task at the head of the pend list.
+*
+* Argument(s): p_sem      is a pointer to the semaphore
+*
+*              ts         is the timestamp to give to the tasks readied
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The function stops at the first task that asked for more units than are left, so a large request is
+*                 never overtaken by lower priority ones.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SEM_PEND_N_EN > 0u) || (OS_CFG_SEM_POST_N_EN > 0u)
+static  void  OS_SemGrant (OS_SEM  *p_sem,
+                           CPU_TS   ts)
+{
+    OS_TCB      *p_tcb;
+    OS_SEM_CTR   cnt;
+
+
+    p_tcb = OS_PEND_LIST_HEAD(&p_sem->PendList);
+    while (p_tcb != (OS_TCB *)0) {
+#if (OS_CFG_SEM_PEND_N_EN > 0u)
+        cnt = p_tcb->SemPendCnt;
+#else
+        cnt = 1u;                                               /* Every waiter comes from OSSemPend()                  */
+#endif
+        if (cnt > p_sem->Ctr) {                                 /* See Note #2                                          */
+            break;
+        }
+        p_sem->Ctr -= cnt;
+        OS_Post((OS_PEND_OBJ *)((void *)p_sem),
+                p_tcb,
+                (void *)0,
+                0u,
+                ts);
+        p_tcb = OS_PEND_LIST_HEAD(&p_sem->PendList);
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                          TAKE A UNIT WITHOUT LOCKING
+*
+* Description: This function is called by OSSemPend() to take a unit from a semaphore that no task waits on, with the
+*              port's exclusive load/store primitives.
+*
+* Argument(s): p_sem        is a pointer to the semaphore.
+*
+*              p_ts         is a pointer to a variable that receives the timestamp of the last post, if not NULL.
+*
+*              p_ctr        is a pointer to a variable that receives the new value of the semaphore counter.
+*
+* Returns    : OS_TRUE      if a unit was taken.
+*              OS_FALSE     if the semaphore is empty or has waiters, and the regular path must be taken.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Anything that runs between the load and the store makes the store fail, so the pend list and the
+*                 counter are read again before each attempt.
+************************************************************************************************************************
+*/
+
+#if (OS_SEM_FAST_EN > 0u)
+static  CPU_BOOLEAN  OS_SemFastPend (OS_SEM      *p_sem,
+                                     CPU_TS      *p_ts,
+                                     OS_SEM_CTR  *p_ctr)
+{
+    CPU_DATA  ctr;
+
+
+    do {                                                    /* See Note #2                                            */
+        ctr = OS_CPU_DataLoadExcl(&p_sem->Ctr);
+        if ((ctr                                == 0u) ||
+            (OS_PEND_LIST_HEAD(&p_sem->PendList) != (OS_TCB *)0)) {
+            return (OS_FALSE);
+        }
+        ctr--;
+    } while (OS_CPU_DataStoreExcl(&p_sem->Ctr, ctr) == OS_FALSE);
+
+#if (OS_CFG_TS_EN > 0u)
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts = p_sem->TS;
+    }
+#else
+    (void)p_ts;
+#endif
+   *p_ctr = (OS_SEM_CTR)ctr;
+    return (OS_TRUE);
+}
+
+
+/*
+************************************************************************************************************************
+*                                           ADD A UNIT WITHOUT LOCKING
+*
+* Description: This function is called by OSSemPost() to add a unit to a semaphore that no task waits on, with the
+*              port's exclusive load/store primitives.
+*
+* Argument(s): p_sem        is a pointer to the semaphore.
+*
+*              ts           is the timestamp of the post.
+*
+*              p_ctr        is a pointer to a variable that receives the new value of the semaphore counter.
+*
+* Returns    : OS_TRUE      if the unit was added.
+*              OS_FALSE     if a task waits on the semaphore, a reactor watches it or the counter would overflow, and
+*                           the regular path must be taken.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) A task that starts waiting, or a reactor that starts watching, after the load makes the store fail,
+*                 and is seen by the next attempt.
+************************************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  OS_SemFastPost (OS_SEM      *p_sem,
+                                     CPU_TS       ts,
+                                     OS_SEM_CTR  *p_ctr)
+{
+    CPU_DATA  ctr;
+
+
+    do {                                                    /* See Note #2                                            */
+        ctr = OS_CPU_DataLoadExcl(&p_sem->Ctr);
+        if ((ctr                                == (OS_SEM_CTR)-1) ||
+            (OS_PEND_LIST_HEAD(&p_sem->PendList) != (OS_TCB *)0)) {
+            return (OS_FALSE);
+        }
+#if (OS_CFG_REACTOR_EN > 0u)
+        if (p_sem->PendList.ReactorSrcPtr != (OS_REACTOR_SRC *)0) {
+            return (OS_FALSE);
+        }
+#endif
+        ctr++;
+    } while (OS_CPU_DataStoreExcl(&p_sem->Ctr, ctr) == OS_FALSE);
+
+#if (OS_CFG_TS_EN > 0u)
+    p_sem->TS = ts;
+#else
+    (void)ts;
+#endif
+   *p_ctr = (OS_SEM_CTR)ctr;
+    return (OS_TRUE);
 }
 #endif
+
+
+/*
+************************************************************************************************************************
+*                                                 POST TO A SEMAPHORE
+*
+* Description: This function posts to a semaphore once OSSemPost() or OSSemPostFromISR() checked the arguments.
+*
+* Arguments  : p_sem     is a pointer to the semaphore
+*
+*              opt       determines the type of POST performed (see OSSemPost())
+*
+*              ts        is the timestamp of the post
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function (see
+*                        OSSemPost())
+*
+* Returns    : The current value of the semaphore counter or 0 upon error.
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+static  OS_SEM_CTR  OS_SemPost (OS_SEM  *p_sem,
+                                OS_OPT   opt,
+                                CPU_TS   ts,
+                                OS_ERR  *p_err)
+{
+    OS_SEM_CTR     ctr;
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+#if (OS_CFG_REACTOR_EN > 0u)
+    CPU_BOOLEAN    rdy;
+#endif
+    CPU_SR_ALLOC();
+
+    OS_TRACE_SEM_POST(p_sem);
+#if (OS_SEM_FAST_EN > 0u)
+    if (OS_SemFastPost(p_sem, ts, &ctr) == OS_TRUE) {           /* See OSSemPost(), Note #5                             */
+       *p_err = OS_ERR_NONE;
+        OS_TRACE_SEM_POST_EXIT(*p_err);
+        return (ctr);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_sem->PendList;
+    OS_OBJ_STAT_INC(p_pend_list, PostCtr);
+    if (OS_PEND_LIST_HEAD(p_pend_list) == (OS_TCB *)0) {        /* Any task waiting on semaphore?                       */
+        if (p_sem->Ctr == (OS_SEM_CTR)-1) {
+           CPU_CRITICAL_EXIT();
+          *p_err = OS_ERR_SEM_OVF;
+           OS_TRACE_SEM_POST_EXIT(*p_err);
+           return (0u);
+        }
+        p_sem->Ctr++;                                           /* No                                                   */
+        ctr       = p_sem->Ctr;
+#if (OS_CFG_TS_EN > 0u)
+        p_sem->TS = ts;                                         /* Save timestamp in semaphore control block            */
+#endif
+#if (OS_CFG_REACTOR_EN > 0u)
+        rdy       = OS_ReactorSrcRdy(p_pend_list->ReactorSrcPtr, ts);
+#endif
+        CPU_CRITICAL_EXIT();
+#if (OS_CFG_REACTOR_EN > 0u)
+        if ((rdy                          == OS_TRUE) &&        /* Run the task of the reactor watching the semaphore   */
+            ((opt & OS_OPT_POST_NO_SCHED) ==      0u)) {
+            OSSched();
+        }
+#endif
+       *p_err     = OS_ERR_NONE;
+        OS_TRACE_SEM_POST_EXIT(*p_err);
+        return (ctr);
+    }
+
+#if (OS_CFG_SEM_PEND_N_EN > 0u)
+    if ((opt & OS_OPT_POST_ALL) == 0u) {                        /* See OSSemPost(), Note #2                             */
+        if (p_sem->Ctr == (OS_SEM_CTR)-1) {
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_SEM_OVF;
+            OS_TRACE_SEM_POST_EXIT(*p_err);
+            return (0u);
+        }
+        p_sem->Ctr++;
+#if (OS_CFG_TS_EN > 0u)
+        p_sem->TS = ts;
+#endif
+        OS_SemGrant(p_sem, ts);
+        ctr       = p_sem->Ctr;
+        CPU_CRITICAL_EXIT();
+        if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+            OSSched();                                          /* Run the scheduler                                    */
+        }
+       *p_err     = OS_ERR_NONE;
+        OS_TRACE_SEM_POST_EXIT(*p_err);
+        return (ctr);
+    }
+#endif
+
+#if (OS_CFG_POST_ALL_INT_EN > 0u)
+    if ((opt & OS_OPT_POST_ALL) != 0u) {                        /* Ready all the waiters with interrupts enabled        */
+        if (OSIntNestingCtr == 0u) {
+            OSSchedLockNestingCtr++;                            /* See OS_PostAll(), Note #2                            */
+        }
+        CPU_CRITICAL_EXIT();
+        OS_PostAll((OS_PEND_OBJ *)((void *)p_sem),
+                   (void *)0,
+                   0u,
+                   ts);
+        if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+            OSSched();                                          /* Run the scheduler                                    */
+        }
+       *p_err = OS_ERR_NONE;
+        OS_TRACE_SEM_POST_EXIT(*p_err);
+        return (0u);
+    }
+#endif
+
+    p_tcb = OS_PEND_LIST_HEAD(p_pend_list);
+    while (p_tcb != (OS_TCB *)0) {
+        OS_Post((OS_PEND_OBJ *)((void *)p_sem),
+                p_tcb,
+                (void *)0,
+                0u,
+                ts);
+        if ((opt & OS_OPT_POST_ALL) == 0u) {                     /* Post to all tasks waiting?                           */
+            break;                                              /* No                                                   */
+        }
+        p_tcb = OS_PEND_LIST_HEAD(p_pend_list);                 /* The task posted to left the pend list                */
+    }
+    CPU_CRITICAL_EXIT();
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+   *p_err = OS_ERR_NONE;
+
+    OS_TRACE_SEM_POST_EXIT(*p_err);
+    return (0u);
+}
 #endif
@@ -0,0 +1,845 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                       SEQUENCE LOCK MANAGEMENT
+*
+* File    : os_seqlock.c
+* Version : V3.08.00
+*********************************************************************************************************
+* Note(s) : (1) A sequence lock lets tasks and ISRs read data, such as a multi-word telemetry structure, while a
+*               task or an ISR updates it, without disabling interrupts for the copy.  The writer brackets the
+*               update with OSSeqLockWrBegin() and OSSeqLockWrEnd().  A reader copies the data between
+*               OSSeqLockRdBegin() and OSSeqLockRdRetry() and starts over when the latter returns OS_TRUE:
+*
+*                   do {
+*                       seq  = OSSeqLockRdBegin(&Lock, &err);
+*                       copy = Data;
+*                   } while (OSSeqLockRdRetry(&Lock, seq, &err) == OS_TRUE);
+*
+*           (2) A task writer locks the scheduler from OSSeqLockWrBegin() to OSSeqLockWrEnd(), so a task reader is
+*               never looping on a write that it preempted.  An ISR that interrupts a task writer is, however, given
+*               an odd count by OSSeqLockRdBegin() and must not loop: it should keep the copy it read last time.
+*
+*           (3) A task can also block with OSSeqLockPend() until the end of the next write.
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#define  OS_CRIT_SITE_ID                    OS_CRIT_SITE_SEQLOCK
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_seqlock__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_SEQLOCK_EN > 0u)
+/*
+************************************************************************************************************************
+*                                                    LOCAL DEFINES
+*
+* Note(s) : (1) The data is accessed by the application between two calls to this module, which the compiler does not
+*               move the accesses across.  OS_CPU_MEM_BARRIER(), when the port provides it, keeps the processor from
+*               reordering them too, which matters when the data is shared with another core.
+************************************************************************************************************************
+*/
+
+#ifdef   OS_CPU_MEM_BARRIER
+#define  OS_SEQLOCK_MEM_BARRIER()           OS_CPU_MEM_BARRIER()
+#else
+#define  OS_SEQLOCK_MEM_BARRIER()
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                               CREATE A SEQUENCE LOCK
+*
+* Description: This function is called by your application to create a sequence lock.
+*
+* Arguments  : p_lock        is a pointer to the sequence lock to initialize.  Your application is responsible for
+*                            allocating storage for the sequence lock.
+*
+*              p_name        is a pointer to the name you would like to give the sequence lock.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_CREATE_ISR              If you called this function from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the sequence lock after
+*                                                                 you called OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_lock' is a NULL pointer
+*                                OS_ERR_OBJ_CREATED             If the sequence lock was already created
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSSeqLockCreate (OS_SEQLOCK  *p_lock,
+                       CPU_CHAR    *p_name,
+                       OS_ERR      *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_lock == (OS_SEQLOCK *)0) {                            /* Validate 'p_lock'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
+    if (p_lock->Type == OS_OBJ_TYPE_SEQLOCK) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+    p_lock->Type    = OS_OBJ_TYPE_SEQLOCK;                      /* Mark the data structure as a sequence lock           */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_lock->NamePtr = p_name;                                   /* Save the name of the sequence lock                   */
+#else
+    (void)p_name;
+#endif
+    p_lock->Seq     = 0u;                                       /* No write in progress                                 */
+    OS_PendListInit(&p_lock->PendList);                         /* Initialize the waiting list                          */
+
+#if (OS_CFG_DBG_EN > 0u)
+    OS_SeqLockDbgListAdd(p_lock);
+    OSSeqLockQty++;                                             /* One more sequence lock created                       */
+#endif
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                               DELETE A SEQUENCE LOCK
+*
+* Description: This function deletes a sequence lock and readies all tasks pending on it.
+*
+* Arguments  : p_lock        is a pointer to the sequence lock to delete
+*
+*              opt           determines delete options as follows:
+*
+*                                OS_OPT_DEL_NO_PEND          Delete the sequence lock ONLY if no task pending
+*                                OS_OPT_DEL_ALWAYS           Deletes the sequence lock even if tasks are waiting.
+*                                                            In this case, all the tasks pending will be readied.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    The call was successful and the lock was deleted
+*                                OS_ERR_DEL_ISR                 If you attempted to delete the lock from an ISR
+*                                OS_ERR_ILLEGAL_DEL_RUN_TIME    If you are trying to delete the lock after you called
+*                                                                 OSStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_lock' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE                If 'p_lock' is not pointing at a sequence lock
+*                                OS_ERR_OPT_INVALID             An invalid option was specified
+*                                OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                                OS_ERR_SEQLOCK_WR_ACTIVE       If a write is in progress
+*                                OS_ERR_TASK_WAITING            One or more tasks were waiting on the lock
+*
+* Returns    : == 0          if no tasks were waiting on the sequence lock, or upon error.
+*              >  0          if one or more tasks waiting on the sequence lock are now readied and informed.
+*
+* Note(s)    : 1) This function must be used with care.  Tasks that would normally expect the presence of the
+*                 sequence lock MUST check the return code of OSSeqLockPend().
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SEQLOCK_DEL_EN > 0u)
+OS_OBJ_QTY  OSSeqLockDel (OS_SEQLOCK  *p_lock,
+                          OS_OPT       opt,
+                          OS_ERR      *p_err)
+{
+    OS_OBJ_QTY     nbr_tasks;
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't delete a sequence lock from an ISR             */
+       *p_err = OS_ERR_DEL_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_lock == (OS_SEQLOCK *)0) {                            /* Validate 'p_lock'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_lock->Type != OS_OBJ_TYPE_SEQLOCK) {                  /* Make sure sequence lock was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if ((p_lock->Seq & 1u) != 0u) {                             /* Can't delete the lock while it is written            */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_SEQLOCK_WR_ACTIVE;
+        return (0u);
+    }
+    p_pend_list = &p_lock->PendList;
+    nbr_tasks   = 0u;
+    switch (opt) {
+        case OS_OPT_DEL_NO_PEND:                                /* Delete sequence lock only if no task waiting         */
+             if (OS_PEND_LIST_HEAD(p_pend_list) == (OS_TCB *)0) {
+#if (OS_CFG_DBG_EN > 0u)
+                 OS_SeqLockDbgListRemove(p_lock);
+                 OSSeqLockQty--;
+#endif
+                 OS_SeqLockClr(p_lock);
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_NONE;
+             } else {
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_TASK_WAITING;
+             }
+             break;
+
+        case OS_OPT_DEL_ALWAYS:                                 /* Always delete the sequence lock                      */
+#if (OS_CFG_TS_EN > 0u)
+             ts = OS_TS_GET();                                  /* Get local time stamp so all tasks get the same time  */
+#else
+             ts = 0u;
+#endif
+             p_tcb = OS_PEND_LIST_HEAD(p_pend_list);            /* Remove all tasks from the pend list                  */
+             while (p_tcb != (OS_TCB *)0) {
+                 OS_PendAbort(p_tcb,
+                              ts,
+                              OS_STATUS_PEND_DEL);
+                 nbr_tasks++;
+                 p_tcb = OS_PEND_LIST_HEAD(p_pend_list);
+             }
+#if (OS_CFG_DBG_EN > 0u)
+             OS_SeqLockDbgListRemove(p_lock);
+             OSSeqLockQty--;
+#endif
+             OS_SeqLockClr(p_lock);
+             CPU_CRITICAL_EXIT();
+             OSSched();                                         /* Find highest priority task ready to run              */
+            *p_err = OS_ERR_NONE;
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_OPT_INVALID;
+             break;
+    }
+    return (nbr_tasks);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                         WAIT FOR THE END OF THE NEXT WRITE
+*
+* Description: This function blocks the calling task until a write to the sequence lock ends after the count 'seq' was
+*              read.  It returns at once if such a write already took place.
+*
+* Arguments  : p_lock        is a pointer to the sequence lock
+*
+*              seq           is a count returned by OSSeqLockRdBegin()
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for the
+*                            end of a write up to the amount of time specified by this argument.  If you specify 0,
+*                            however, your task will wait forever.
+*
+*              opt           determines whether the user wants to block if no write ended yet:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*                            Add OS_OPT_PEND_ABS to make 'timeout' the value of OSTickCtr at which to give up.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               A write ended, the data can be read again
+*                                OS_ERR_OBJ_DEL            If 'p_lock' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_lock' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_lock' is not pointing at a sequence lock
+*                                OS_ERR_OPT_INVALID        If you specified an invalid value for 'opt'
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but no write ended
+*                                OS_ERR_SCHED_LOCKED       If you called this function when the scheduler is locked
+*                                OS_ERR_STATUS_INVALID     Pend status is invalid
+*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*                                OS_ERR_TIMEOUT            No write ended within the specified timeout
+*
+* Returns    : none
+*
+* Note(s)    : 1) The new data is read with OSSeqLockRdBegin() and OSSeqLockRdRetry() as usual, a write may start
+*                 again before the task runs.
+************************************************************************************************************************
+*/
+
+void  OSSeqLockPend (OS_SEQLOCK  *p_lock,
+                     CPU_DATA     seq,
+                     OS_TICK      timeout,
+                     OS_OPT       opt,
+                     OS_ERR      *p_err)
+{
+    CPU_DATA  seq_cur;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != OS_OPT_PEND_NON_BLOCKING) {
+           *p_err = OS_ERR_PEND_ISR;
+            return;
+        }
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_lock == (OS_SEQLOCK *)0) {                            /* Validate 'p_lock'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt & (OS_OPT)~OS_OPT_PEND_ABS) {                   /* Validate 'opt'                                       */
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_lock->Type != OS_OBJ_TYPE_SEQLOCK) {                  /* Make sure sequence lock was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    seq_cur = p_lock->Seq;
+    if (((seq_cur & 1u) == 0u) &&                               /* Did a write end since 'seq' was read?                */
+        (seq_cur        != seq)) {
+        CPU_CRITICAL_EXIT();                                    /* Yes                                                  */
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if no write ended?             */
+        CPU_CRITICAL_EXIT();                                    /* No                                                   */
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;
+        return;
+    } else {                                                    /* Yes                                                  */
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return;
+        }
+    }
+
+    OS_PEND_ABS_SET(OSTCBCurPtr, opt);
+    OS_Pend((OS_PEND_OBJ *)((void *)p_lock),                    /* Block task until the end of the next write           */
+            OSTCBCurPtr,
+            OS_TASK_PEND_ON_SEQLOCK,
+            timeout);
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* A write ended                                        */
+            *p_err = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that no write ended within TO               */
+            *p_err = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+            *p_err = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+            *p_err = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+************************************************************************************************************************
+*                                              START READING PROTECTED DATA
+*
+* Description: This function is called by a task or an ISR before it copies the data protected by a sequence lock.
+*
+* Arguments  : p_lock        is a pointer to the sequence lock
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_lock' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_lock' is not pointing at a sequence lock
+*
+* Returns    : The count to pass to OSSeqLockRdRetry().  An odd count means that a write is in progress and that the
+*              copy will have to be made again (see Note #2 at the top of this file).
+*
+* Note(s)    : 1) This function neither disables interrupts nor blocks.
+************************************************************************************************************************
+*/
+
+CPU_DATA  OSSeqLockRdBegin (OS_SEQLOCK  *p_lock,
+                            OS_ERR      *p_err)
+{
+    CPU_DATA  seq;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_lock == (OS_SEQLOCK *)0) {                            /* Validate 'p_lock'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_lock->Type != OS_OBJ_TYPE_SEQLOCK) {                  /* Make sure sequence lock was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    seq = p_lock->Seq;
+    OS_SEQLOCK_MEM_BARRIER();                                   /* The data is read after the count                     */
+   *p_err = OS_ERR_NONE;
+    return (seq);
+}
+
+
+/*
+************************************************************************************************************************
+*                                         CHECK A COPY OF THE PROTECTED DATA
+*
+* Description: This function is called by a task or an ISR after it copied the data protected by a sequence lock, to
+*              know whether the copy is consistent.
+*
+* Arguments  : p_lock        is a pointer to the sequence lock
+*
+*              seq           is the count returned by OSSeqLockRdBegin() before the copy
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_lock' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_lock' is not pointing at a sequence lock
+*
+* Returns    : OS_TRUE           if a write overlapped the copy, which must be made again
+*              OS_FALSE          if the copy is consistent, or upon error
+*
+* Note(s)    : 1) This function neither disables interrupts nor blocks.
+************************************************************************************************************************
+*/
+
+CPU_BOOLEAN  OSSeqLockRdRetry (OS_SEQLOCK  *p_lock,
+                               CPU_DATA     seq,
+                               OS_ERR      *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_lock == (OS_SEQLOCK *)0) {                            /* Validate 'p_lock'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_lock->Type != OS_OBJ_TYPE_SEQLOCK) {                  /* Make sure sequence lock was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (OS_FALSE);
+    }
+#endif
+
+    OS_SEQLOCK_MEM_BARRIER();                                   /* The data was read before the count                   */
+   *p_err = OS_ERR_NONE;
+    if (((seq & 1u) != 0u) ||                                   /* Was a write in progress or did one take place?       */
+        (seq        != p_lock->Seq)) {
+        return (OS_TRUE);                                       /* Yes, the copy must be made again                     */
+    }
+    return (OS_FALSE);
+}
+
+
+/*
+************************************************************************************************************************
+*                                             START WRITING PROTECTED DATA
+*
+* Description: This function is called by a task or an ISR before it updates the data protected by a sequence lock.
+*              The update must be followed by a call to OSSeqLockWrEnd().
+*
+* Arguments  : p_lock        is a pointer to the sequence lock
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The data can be updated
+*                                OS_ERR_LOCK_NESTING_OVF   If the scheduler lock of a task writer would overflow
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_lock' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_lock' is not pointing at a sequence lock
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_SEQLOCK_WR_ACTIVE  If another write is in progress, the data must not be
+*                                                          updated
+*
+* Returns    : none
+*
+* Note(s)    : 1) Writers are not queued: only one task or ISR may write at a time.  An ISR that interrupts a task
+*                 writer is told with OS_ERR_SEQLOCK_WR_ACTIVE that it cannot update the data.
+*
+*              2) When called from a task, the scheduler is locked until OSSeqLockWrEnd() (see Note #2 at the top of
+*                 this file).  The update should therefore be short and must not block.
+************************************************************************************************************************
+*/
+
+void  OSSeqLockWrBegin (OS_SEQLOCK  *p_lock,
+                        OS_ERR      *p_err)
+{
+    OS_ERR  err;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_lock == (OS_SEQLOCK *)0) {                            /* Validate 'p_lock'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_lock->Type != OS_OBJ_TYPE_SEQLOCK) {                  /* Make sure sequence lock was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    if (OSIntNestingCtr == 0u) {                                /* Keep other tasks from running during the write       */
+        OSSchedLock(p_err);
+        if (*p_err != OS_ERR_NONE) {
+            return;
+        }
+    }
+
+    CPU_CRITICAL_ENTER();
+    if ((p_lock->Seq & 1u) != 0u) {                             /* Is another write in progress?                        */
+        CPU_CRITICAL_EXIT();                                    /* Yes                                                  */
+        if (OSIntNestingCtr == 0u) {
+            OSSchedUnlock(&err);
+        }
+       *p_err = OS_ERR_SEQLOCK_WR_ACTIVE;
+        return;
+    }
+    p_lock->Seq++;                                              /* The count is odd during the write                    */
+    CPU_CRITICAL_EXIT();
+    OS_SEQLOCK_MEM_BARRIER();                                   /* The count is visible before the data                 */
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              END WRITING PROTECTED DATA
+*
+* Description: This function is called by the task or the ISR that called OSSeqLockWrBegin() once the protected data is
+*              updated.  The tasks waiting in OSSeqLockPend() are readied.
+*
+* Arguments  : p_lock        is a pointer to the sequence lock
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The write is over
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_lock' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_lock' is not pointing at a sequence lock
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_SEQLOCK_WR_NONE    If no write is in progress
+*
+* Returns    : none
+*
+* Note(s)    : 1) When called from a task, this function unlocks the scheduler locked by OSSeqLockWrBegin(), which runs
+*                 the readers readied if the scheduler is not locked otherwise.
+************************************************************************************************************************
+*/
+
+void  OSSeqLockWrEnd (OS_SEQLOCK  *p_lock,
+                      OS_ERR      *p_err)
+{
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    CPU_TS         ts;
+    OS_ERR         err;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_lock == (OS_SEQLOCK *)0) {                            /* Validate 'p_lock'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_lock->Type != OS_OBJ_TYPE_SEQLOCK) {                  /* Make sure sequence lock was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    OS_SEQLOCK_MEM_BARRIER();                                   /* The data is visible before the count                 */
+    CPU_CRITICAL_ENTER();
+    if ((p_lock->Seq & 1u) == 0u) {                             /* Is a write in progress?                              */
+        CPU_CRITICAL_EXIT();                                    /* No                                                   */
+       *p_err = OS_ERR_SEQLOCK_WR_NONE;
+        return;
+    }
+    p_lock->Seq++;                                              /* The count is even again                              */
+
+    p_pend_list = &p_lock->PendList;
+    p_tcb       = OS_PEND_LIST_HEAD(p_pend_list);
+    while (p_tcb != (OS_TCB *)0) {                              /* Ready all the tasks waiting for the write            */
+        OS_Post((OS_PEND_OBJ *)((void *)p_lock),
+                p_tcb,
+                (void *)0,
+                0u,
+                ts);
+        p_tcb = OS_PEND_LIST_HEAD(p_pend_list);
+    }
+    CPU_CRITICAL_EXIT();
+
+    if (OSIntNestingCtr == 0u) {
+        OSSchedUnlock(&err);                                    /* See Note #1                                          */
+    }
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                       CLEAR THE CONTENTS OF A SEQUENCE LOCK
+*
+* Description: This function is called by OSSeqLockDel() to clear the contents of a sequence lock
+*
+* Argument(s): p_lock        is a pointer to the sequence lock to clear
+*              ------
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_SeqLockClr (OS_SEQLOCK  *p_lock)
+{
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_lock->Type    =  OS_OBJ_TYPE_NONE;                        /* Mark the data structure as a NONE                    */
+#endif
+    p_lock->Seq     =  0u;
+#if (OS_CFG_DBG_EN > 0u)
+    p_lock->NamePtr = (CPU_CHAR *)((void *)"?SEQLOCK");
+#endif
+    OS_PendListInit(&p_lock->PendList);                         /* Initialize the waiting list                          */
+}
+
+
+/*
+************************************************************************************************************************
+*                                      ADD/REMOVE SEQUENCE LOCK TO/FROM DEBUG LIST
+*
+* Description: These functions are called by uC/OS-III to add or remove a sequence lock to/from the debug list.
+*
+* Arguments  : p_lock       is a pointer to the sequence lock to add/remove
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN > 0u)
+void  OS_SeqLockDbgListAdd (OS_SEQLOCK  *p_lock)
+{
+    p_lock->DbgNamePtr                  = (CPU_CHAR *)((void *)" ");
+    p_lock->DbgPrevPtr                  = (OS_SEQLOCK *)0;
+    if (OSSeqLockDbgListPtr == (OS_SEQLOCK *)0) {
+        p_lock->DbgNextPtr              = (OS_SEQLOCK *)0;
+    } else {
+        p_lock->DbgNextPtr              =  OSSeqLockDbgListPtr;
+        OSSeqLockDbgListPtr->DbgPrevPtr =  p_lock;
+    }
+    OSSeqLockDbgListPtr                 =  p_lock;
+}
+
+
+void  OS_SeqLockDbgListRemove (OS_SEQLOCK  *p_lock)
+{
+    OS_SEQLOCK  *p_lock_next;
+    OS_SEQLOCK  *p_lock_prev;
+
+
+    p_lock_prev = p_lock->DbgPrevPtr;
+    p_lock_next = p_lock->DbgNextPtr;
+
+    if (p_lock_prev == (OS_SEQLOCK *)0) {
+        OSSeqLockDbgListPtr = p_lock_next;
+        if (p_lock_next != (OS_SEQLOCK *)0) {
+            p_lock_next->DbgPrevPtr = (OS_SEQLOCK *)0;
+        }
+        p_lock->DbgNextPtr = (OS_SEQLOCK *)0;
+
+    } else if (p_lock_next == (OS_SEQLOCK *)0) {
+        p_lock_prev->DbgNextPtr = (OS_SEQLOCK *)0;
+        p_lock->DbgPrevPtr      = (OS_SEQLOCK *)0;
+
+    } else {
+        p_lock_prev->DbgNextPtr =  p_lock_next;
+        p_lock_next->DbgPrevPtr =  p_lock_prev;
+        p_lock->DbgNextPtr      = (OS_SEQLOCK *)0;
+        p_lock->DbgPrevPtr      = (OS_SEQLOCK *)0;
+    }
+}
+#endif
+#endif
@@ -0,0 +1,1045 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          SIGNAL MANAGEMENT
+*
+* File    : os_signal.c
+* Version : V3.08.00
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#define  OS_CRIT_SITE_ID                    OS_CRIT_SITE_SIGNAL
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_signal__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_SIGNAL_EN > 0u)
+
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SIGNAL_COALESCE_EN > 0u)
+static  void  OS_SignalWindowArm (OS_TCB  *p_tcb,
+                                  CPU_TS   dly);
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                   CREATE A SIGNAL
+*
+* Description: This function creates a signal, a binary event that at most one task waits on.
+*
+* Arguments  : p_signal      is a pointer to the signal to initialize.  Your application is responsible for allocating
+*                            storage for the signal.
+*
+*              p_name        is a pointer to the name you would like to give the signal.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_CREATE_ISR              If you called this function from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the signal after you
+*                                                                 called OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_signal' is a NULL pointer
+*                                OS_ERR_OBJ_CREATED             If the signal was already created
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSSignalCreate (OS_SIGNAL  *p_signal,
+                      CPU_CHAR   *p_name,
+                      OS_ERR     *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_signal == (OS_SIGNAL *)0) {                           /* Validate 'p_signal'                                  */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
+    if (p_signal->Type == OS_OBJ_TYPE_SIGNAL) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+    p_signal->Type    = OS_OBJ_TYPE_SIGNAL;                     /* Mark the data structure as a signal                  */
+#endif
+    p_signal->TCBPtr  = (OS_TCB *)0;                            /* No task is waiting and no post is pending            */
+    p_signal->Pending =  OS_FALSE;
+#if (OS_CFG_TS_EN > 0u)
+    p_signal->TS      =  0u;
+#endif
+#if (OS_CFG_SIGNAL_COALESCE_EN > 0u)
+    p_signal->PostCtr   = 0u;                                   /* Every post wakes the waiter until                    */
+    p_signal->Threshold = 1u;                                   /* ... OSSignalCoalesceSet() is called                  */
+    p_signal->WindowTs  = 0u;
+    p_signal->PostTs    = 0u;
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_signal->NamePtr =  p_name;                                /* Save the name of the signal                          */
+#else
+    (void)p_name;
+#endif
+
+#if (OS_CFG_DBG_EN > 0u)
+    OS_SignalDbgListAdd(p_signal);
+    OSSignalQty++;
+#endif
+
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                   DELETE A SIGNAL
+*
+* Description: This function deletes a signal.
+*
+* Arguments  : p_signal      is a pointer to the signal to delete
+*
+*              opt           determines delete options as follows:
+*
+*                                OS_OPT_DEL_NO_PEND          Delete the signal ONLY if no task is waiting
+*                                OS_OPT_DEL_ALWAYS           Deletes the signal even if a task is waiting.
+*                                                            In this case, the waiting task will be readied.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    The call was successful and the signal was deleted
+*                                OS_ERR_DEL_ISR                 If you attempted to delete the signal from an ISR
+*                                OS_ERR_ILLEGAL_DEL_RUN_TIME    If you are trying to delete the signal after you called
+*                                                                 OSStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_signal' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE                If 'p_signal' is not pointing at a signal
+*                                OS_ERR_OPT_INVALID             An invalid option was specified
+*                                OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                                OS_ERR_TASK_WAITING            A task was waiting on the signal
+*
+* Returns    : == 0          if no task was waiting on the signal, or upon error.
+*              == 1          if the task waiting on the signal is now readied and informed.
+*
+* Note(s)    : 1) This function must be used with care.  The task that would normally expect the presence of the
+*                 signal MUST check the return code of OSSignalPend().
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SIGNAL_DEL_EN > 0u)
+OS_OBJ_QTY  OSSignalDel (OS_SIGNAL  *p_signal,
+                         OS_OPT      opt,
+                         OS_ERR     *p_err)
+{
+    OS_OBJ_QTY  nbr_tasks;
+    CPU_TS      ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to delete a signal from an ISR           */
+       *p_err = OS_ERR_DEL_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_signal == (OS_SIGNAL *)0) {                           /* Validate 'p_signal'                                  */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_signal->Type != OS_OBJ_TYPE_SIGNAL) {                 /* Make sure signal was created                         */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    nbr_tasks = 0u;
+    switch (opt) {
+        case OS_OPT_DEL_NO_PEND:                                /* Delete signal only if no task waiting                */
+             if (p_signal->TCBPtr == (OS_TCB *)0) {
+#if (OS_CFG_DBG_EN > 0u)
+                 OS_SignalDbgListRemove(p_signal);
+                 OSSignalQty--;
+#endif
+                 OS_SignalClr(p_signal);
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_NONE;
+             } else {
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_TASK_WAITING;
+             }
+             break;
+
+        case OS_OPT_DEL_ALWAYS:                                 /* Always delete the signal                             */
+             if (p_signal->TCBPtr != (OS_TCB *)0) {             /* Ready the task waiting on the signal                 */
+#if (OS_CFG_TS_EN > 0u)
+                 ts = OS_TS_GET();
+#else
+                 ts = 0u;
+#endif
+                 OS_PendAbort(p_signal->TCBPtr,
+                              ts,
+                              OS_STATUS_PEND_DEL);
+                 nbr_tasks = 1u;
+             }
+#if (OS_CFG_DBG_EN > 0u)
+             OS_SignalDbgListRemove(p_signal);
+             OSSignalQty--;
+#endif
+             OS_SignalClr(p_signal);
+             CPU_CRITICAL_EXIT();
+             OSSched();                                         /* Find highest priority task ready to run              */
+            *p_err = OS_ERR_NONE;
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_OPT_INVALID;
+             break;
+    }
+    return (nbr_tasks);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                   PEND ON A SIGNAL
+*
+* Description: This function waits for a signal to be posted.
+*
+* Arguments  : p_signal      is a pointer to the signal
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for the
+*                            signal up to the amount of time (in 'ticks') specified by this argument.  If you specify
+*                            0, however, your task will wait forever at the specified signal or, until it is posted.
+*
+*              opt           determines whether the user wants to block if the signal was not posted or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*                            Add OS_OPT_PEND_ABS to make 'timeout' the value of OSTickCtr at which to give up.
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp of when the signal was posted,
+*                            pend aborted or deleted.  If you pass a NULL pointer (i.e. (CPU_TS *)0) then you will not
+*                            get the timestamp.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and the signal was posted
+*                                OS_ERR_OBJ_DEL            If 'p_signal' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_signal' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_signal' is not pointing at a signal
+*                                OS_ERR_OPT_INVALID        If you specified an invalid value for 'opt'
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         If the pend was aborted by another task
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR and the result
+*                                                          would lead to a suspension
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the signal was not posted
+*                                OS_ERR_SCHED_LOCKED       If you called this function when the scheduler is locked
+*                                OS_ERR_SIGNAL_WAITER      If another task is already waiting on the signal
+*                                OS_ERR_STATUS_INVALID     Pend status is invalid
+*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*                                OS_ERR_TIMEOUT            The signal was not posted within the specified timeout.
+*
+* Returns    : none
+*
+* Note(s)    : 1) The waiting task is not placed in a pend list, the signal refers to it directly.  While the task
+*                 waits, its '.PendObjPtr' points to the OS_SIGNAL, which is not an OS_PEND_OBJ.
+*
+*              2) With OSSignalCoalesceSet(), posts are delivered once 'threshold' of them were made or once the window
+*                 started by the first of them is over, whichever comes first.  While posts are held back, the task
+*                 waits with a high-resolution timeout set to the end of the window instead of 'timeout'.
+************************************************************************************************************************
+*/
+
+void  OSSignalPend (OS_SIGNAL  *p_signal,
+                    OS_TICK     timeout,
+                    OS_OPT      opt,
+                    CPU_TS     *p_ts,
+                    OS_ERR     *p_err)
+{
+#if (OS_CFG_SIGNAL_COALESCE_EN > 0u)
+    CPU_TS  elapsed;
+    CPU_TS  dly;
+#endif
+    CPU_SR_ALLOC();
+
+
+#if (OS_CFG_TS_EN == 0u)
+    (void)p_ts;                                                 /* Prevent compiler warning for not using 'ts'          */
+#endif
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != OS_OPT_PEND_NON_BLOCKING) {
+           *p_err = OS_ERR_PEND_ISR;
+            return;
+        }
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_signal == (OS_SIGNAL *)0) {                           /* Validate 'p_signal'                                  */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt & (OS_OPT)~OS_OPT_PEND_ABS) {                   /* Validate 'opt'                                       */
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_signal->Type != OS_OBJ_TYPE_SIGNAL) {                 /* Make sure signal was created                         */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_CFG_SIGNAL_COALESCE_EN > 0u)
+    dly = 0u;
+    if ((p_signal->Pending  == OS_FALSE) &&                     /* Posts below the threshold, see Note #2               */
+        (p_signal->PostCtr  >        0u) &&
+        (p_signal->WindowTs !=       0u)) {
+        elapsed = OS_TS_GET() - p_signal->PostTs;
+        if (elapsed >= p_signal->WindowTs) {                    /* The window is over, the posts are delivered now      */
+            p_signal->Pending = OS_TRUE;
+            p_signal->TS      = p_signal->PostTs;
+        } else {
+            dly = p_signal->WindowTs - elapsed;                 /* Wait no longer than the rest of the window           */
+        }
+    }
+#endif
+    if (p_signal->Pending == OS_TRUE) {                         /* Was the signal posted?                               */
+        p_signal->Pending = OS_FALSE;                           /* Yes, consume the post                                */
+#if (OS_CFG_SIGNAL_COALESCE_EN > 0u)
+        p_signal->PostCtr = 0u;
+#endif
+#if (OS_CFG_TS_EN > 0u)
+        if (p_ts != (CPU_TS *)0) {
+           *p_ts = p_signal->TS;
+        }
+#endif
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not posted?                 */
+        CPU_CRITICAL_EXIT();                                    /* No                                                   */
+#if (OS_CFG_TS_EN > 0u)
+        if (p_ts != (CPU_TS *)0) {
+           *p_ts = 0u;
+        }
+#endif
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;
+        return;
+    } else {                                                    /* Yes                                                  */
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+#if (OS_CFG_TS_EN > 0u)
+            if (p_ts != (CPU_TS *)0) {
+               *p_ts = 0u;
+            }
+#endif
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return;
+        }
+    }
+
+    if (p_signal->TCBPtr != (OS_TCB *)0) {                      /* Only one task may wait on a signal                   */
+        CPU_CRITICAL_EXIT();
+#if (OS_CFG_TS_EN > 0u)
+        if (p_ts != (CPU_TS *)0) {
+           *p_ts = 0u;
+        }
+#endif
+       *p_err = OS_ERR_SIGNAL_WAITER;
+        return;
+    }
+
+    OS_PEND_ABS_SET(OSTCBCurPtr, opt);
+#if (OS_CFG_SIGNAL_COALESCE_EN > 0u)
+    if (dly != 0u) {                                            /* OS_TaskBlock() uses the window instead of 'timeout'  */
+        OSTCBCurPtr->TickHrDly = dly;
+        timeout                = 1u;
+    }
+#endif
+    OS_Pend((OS_PEND_OBJ *)0,                                   /* Block task, there is no pend list to insert it in    */
+            OSTCBCurPtr,
+            OS_TASK_PEND_ON_SIGNAL,
+            timeout);
+                                                                /* See Note #1                                          */
+    OSTCBCurPtr->PendObjPtr = (OS_PEND_OBJ *)((void *)p_signal);
+    p_signal->TCBPtr        =  OSTCBCurPtr;
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* The signal was posted                                */
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+            *p_err = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+            *p_err = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that the signal was not posted in time      */
+#if (OS_CFG_SIGNAL_COALESCE_EN > 0u)
+             if (p_signal->PostCtr > 0u) {                      /* The window ended, deliver the posts (see Note #2)    */
+                 p_signal->PostCtr = 0u;
+                 p_signal->Pending = OS_FALSE;
+                 if (p_ts != (CPU_TS *)0) {
+                    *p_ts = p_signal->PostTs;
+                 }
+                *p_err = OS_ERR_NONE;
+                 break;
+             }
+#endif
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = 0u;
+             }
+#endif
+            *p_err = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that the signal has been deleted            */
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+            *p_err = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+            *p_err = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+************************************************************************************************************************
+*                                             ABORT WAITING ON A SIGNAL
+*
+* Description: This function aborts and readies the task waiting on a signal.  It should be used to fault-abort the
+*              wait on the signal, rather than to normally signal the signal via OSSignalPost().
+*
+* Arguments  : p_signal      is a pointer to the signal
+*
+*              opt           determines the type of ABORT performed:
+*
+*                                OS_OPT_PEND_ABORT_1     ABORT wait for the task waiting on the signal
+*                                OS_OPT_POST_NO_SCHED    Do not call the scheduler
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                  The task waiting on the signal was readied
+*                                OS_ERR_OBJ_PTR_NULL          If 'p_signal' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE              If 'p_signal' is not pointing at a signal
+*                                OS_ERR_OPT_INVALID           If you specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING        If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT_ISR        If you called this function from an ISR
+*                                OS_ERR_PEND_ABORT_NONE       No task was pending
+*
+* Returns    : == 0          if no task was waiting on the signal, or upon error.
+*              == 1          if the task waiting on the signal is now readied and informed.
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SIGNAL_PEND_ABORT_EN > 0u)
+OS_OBJ_QTY  OSSignalPendAbort (OS_SIGNAL  *p_signal,
+                               OS_OPT      opt,
+                               OS_ERR     *p_err)
+{
+    CPU_TS  ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to Pend Abort from an ISR                */
+       *p_err =  OS_ERR_PEND_ABORT_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_signal == (OS_SIGNAL *)0) {                           /* Validate 'p_signal'                                  */
+       *p_err =  OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_PEND_ABORT_1:
+        case OS_OPT_PEND_ABORT_1 | OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err =  OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_signal->Type != OS_OBJ_TYPE_SIGNAL) {                 /* Make sure signal was created                         */
+       *p_err =  OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_signal->TCBPtr == (OS_TCB *)0) {                      /* Any task waiting on signal?                          */
+        CPU_CRITICAL_EXIT();                                    /* No                                                   */
+       *p_err =  OS_ERR_PEND_ABORT_NONE;
+        return (0u);
+    }
+
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();
+#else
+    ts = 0u;
+#endif
+    OS_PendAbort(p_signal->TCBPtr,
+                 ts,
+                 OS_STATUS_PEND_ABORT);
+    CPU_CRITICAL_EXIT();
+
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+
+   *p_err = OS_ERR_NONE;
+    return (1u);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                    POST TO A SIGNAL
+*
+* Description: This function posts to a signal.  The task waiting on the signal, if any, is readied.  Otherwise the
+*              post is remembered until the next OSSignalPend().
+*
+* Arguments  : p_signal      is a pointer to the signal
+*
+*              opt           determines the type of POST performed:
+*
+*                                OS_OPT_POST_NONE        No option
+*                                OS_OPT_POST_NO_SCHED    Do not call the scheduler
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and the signal was posted
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_signal' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_signal' is not pointing at a signal
+*                                OS_ERR_OPT_INVALID        If you specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*
+* Returns    : none
+*
+* Note(s)    : 1) Posts made while no task waits do not accumulate, the signal is either pending or not.
+*
+*              2) With OSSignalCoalesceSet(), a post that leaves the number of posts below the threshold does not ready
+*                 the waiter.  The first of them starts the window and bounds the wait of the waiter by its end.
+************************************************************************************************************************
+*/
+
+void  OSSignalPost (OS_SIGNAL  *p_signal,
+                    OS_OPT      opt,
+                    OS_ERR     *p_err)
+{
+    OS_TCB  *p_tcb;
+    CPU_TS   ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_signal == (OS_SIGNAL *)0) {                           /* Validate 'p_signal'                                  */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_signal->Type != OS_OBJ_TYPE_SIGNAL) {                 /* Make sure signal was created                         */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_tcb = p_signal->TCBPtr;
+#if (OS_CFG_SIGNAL_COALESCE_EN > 0u)
+    if (p_signal->PostCtr < (OS_CTR)~(OS_CTR)0u) {              /* Count the post                                       */
+        p_signal->PostCtr++;
+    }
+    if (p_signal->PostCtr == 1u) {
+        p_signal->PostTs = ts;                                  /* The first post starts the window                     */
+    }
+    if (p_signal->PostCtr < p_signal->Threshold) {              /* Hold the post back (see Note #2)                     */
+        if ((p_tcb              != (OS_TCB *)0) &&
+            (p_signal->PostCtr  ==           1u) &&
+            (p_signal->WindowTs !=           0u)) {
+            OS_SignalWindowArm(p_tcb, p_signal->WindowTs);
+        }
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+#endif
+    if (p_tcb == (OS_TCB *)0) {                                 /* Any task waiting on signal?                          */
+        p_signal->Pending = OS_TRUE;                            /* No, remember the post                                */
+#if (OS_CFG_TS_EN > 0u)
+        p_signal->TS      = ts;
+#endif
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+#if (OS_CFG_SIGNAL_COALESCE_EN > 0u)
+    p_signal->PostCtr = 0u;                                     /* The waiter takes all the posts                       */
+#endif
+    p_signal->TCBPtr  = (OS_TCB      *)0;                       /* Release the signal ...                               */
+    p_tcb->PendObjPtr = (OS_PEND_OBJ *)0;
+    OS_Post((OS_PEND_OBJ *)0,                                   /* ... and ready the task                               */
+            p_tcb,
+            (void *)0,
+            0u,
+            ts);
+    CPU_CRITICAL_EXIT();
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                               SET UP POST COALESCING
+*
+* Description: This function makes a signal hold its posts back until 'threshold' of them were made or until
+*              'window_us' microseconds went by since the first of them, whichever comes first.  A high-rate ISR can
+*              then post on every event while its handler task is only woken up once per batch.
+*
+* Arguments  : p_signal      is a pointer to the signal
+*
+*              threshold     is the number of posts that readies the waiter.  1 readies it on every post, as a signal
+*                            does when this function is not called.
+*
+*              window_us     is the longest time, in microseconds, that posts are held back.  0 holds them back until
+*                            'threshold' of them were made.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                       The call was successful
+*                                OS_ERR_OBJ_PTR_NULL               If 'p_signal' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE                   If 'p_signal' is not pointing at a signal
+*                                OS_ERR_SIGNAL_THRESHOLD_INVALID   If 'threshold' is 0
+*                                OS_ERR_TIME_INVALID_MICROSECONDS  If 'window_us' can't be represented in OS_TS_GET()
+*                                                                     units
+*
+* Returns    : none
+*
+* Note(s)    : 1) The new settings apply from the next post.
+*
+*              2) The waiter is not told how many posts were coalesced.  It is expected to drain the events of the
+*                 device, e.g. the frames received, each time it is readied.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SIGNAL_COALESCE_EN > 0u)
+void  OSSignalCoalesceSet (OS_SIGNAL   *p_signal,
+                           OS_CTR       threshold,
+                           CPU_INT32U   window_us,
+                           OS_ERR      *p_err)
+{
+    CPU_TS  dly;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_signal == (OS_SIGNAL *)0) {                           /* Validate 'p_signal'                                  */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (threshold == 0u) {                                      /* At least one post must ready the waiter              */
+       *p_err = OS_ERR_SIGNAL_THRESHOLD_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_signal->Type != OS_OBJ_TYPE_SIGNAL) {                 /* Make sure signal was created                         */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    dly = 0u;
+    if (window_us != 0u) {
+        dly = OS_TickHrUsToTS(window_us);
+        if ((dly == 0u) || (dly > OS_TICK_HR_DLY_MAX)) {
+           *p_err = OS_ERR_TIME_INVALID_MICROSECONDS;
+            return;
+        }
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_signal->Threshold = threshold;
+    p_signal->WindowTs  = dly;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                           CLEAR THE CONTENTS OF A SIGNAL
+*
+* Description: This function is called by OSSignalDel() to clear the contents of a signal
+*
+* Argument(s): p_signal      is a pointer to the signal to clear
+*              --------
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_SignalClr (OS_SIGNAL  *p_signal)
+{
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_signal->Type    =  OS_OBJ_TYPE_NONE;                      /* Mark the data structure as a NONE                    */
+#endif
+    p_signal->TCBPtr  = (OS_TCB *)0;
+    p_signal->Pending =  OS_FALSE;
+#if (OS_CFG_TS_EN > 0u)
+    p_signal->TS      =  0u;                                    /* Clear the time stamp                                 */
+#endif
+#if (OS_CFG_SIGNAL_COALESCE_EN > 0u)
+    p_signal->PostCtr   = 0u;
+    p_signal->Threshold = 1u;
+    p_signal->WindowTs  = 0u;
+    p_signal->PostTs    = 0u;
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_signal->NamePtr = (CPU_CHAR *)((void *)"?SIGNAL");
+#endif
+}
+
+
+/*
+************************************************************************************************************************
+*                                          ADD/REMOVE SIGNAL TO/FROM DEBUG LIST
+*
+* Description: These functions are called by uC/OS-III to add or remove a signal to/from the debug list.
+*
+* Arguments  : p_signal     is a pointer to the signal to add/remove
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN > 0u)
+void  OS_SignalDbgListAdd (OS_SIGNAL  *p_signal)
+{
+    p_signal->DbgPrevPtr               = (OS_SIGNAL *)0;
+    if (OSSignalDbgListPtr == (OS_SIGNAL *)0) {
+        p_signal->DbgNextPtr           = (OS_SIGNAL *)0;
+    } else {
+        p_signal->DbgNextPtr           =  OSSignalDbgListPtr;
+        OSSignalDbgListPtr->DbgPrevPtr =  p_signal;
+    }
+    OSSignalDbgListPtr                 =  p_signal;
+}
+
+
+void  OS_SignalDbgListRemove (OS_SIGNAL  *p_signal)
+{
+    OS_SIGNAL  *p_signal_next;
+    OS_SIGNAL  *p_signal_prev;
+
+
+    p_signal_prev = p_signal->DbgPrevPtr;
+    p_signal_next = p_signal->DbgNextPtr;
+
+    if (p_signal_prev == (OS_SIGNAL *)0) {
+        OSSignalDbgListPtr = p_signal_next;
+        if (p_signal_next != (OS_SIGNAL *)0) {
+            p_signal_next->DbgPrevPtr = (OS_SIGNAL *)0;
+        }
+        p_signal->DbgNextPtr = (OS_SIGNAL *)0;
+
+    } else if (p_signal_next == (OS_SIGNAL *)0) {
+        p_signal_prev->DbgNextPtr = (OS_SIGNAL *)0;
+        p_signal->DbgPrevPtr      = (OS_SIGNAL *)0;
+
+    } else {
+        p_signal_prev->DbgNextPtr =  p_signal_next;
+        p_signal_next->DbgPrevPtr =  p_signal_prev;
+        p_signal->DbgNextPtr      = (OS_SIGNAL *)0;
+        p_signal->DbgPrevPtr      = (OS_SIGNAL *)0;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                        RELEASE THE SIGNAL A TASK IS WAITING ON
+*
+* Description: This function is called by OS_PendListRemove() when a task waiting on a signal stops waiting because of
+*              a timeout, an abort, the deletion of the signal or the deletion of the task.
+*
+* Argument(s): p_tcb         is a pointer to the TCB of the task
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_SignalPendRemove (OS_TCB  *p_tcb)
+{
+    OS_SIGNAL  *p_signal;
+
+
+    p_signal          = (OS_SIGNAL *)((void *)p_tcb->PendObjPtr);
+    p_signal->TCBPtr  = (OS_TCB      *)0;
+    p_tcb->PendObjPtr = (OS_PEND_OBJ *)0;                       /* There is no pend list to remove the task from        */
+}
+
+
+/*
+************************************************************************************************************************
+*                                          BOUND THE WAIT BY THE COALESCING WINDOW
+*
+* Description: This function is called by OSSignalPost() when the first post of a batch is held back.  It makes the
+*              waiter time out at the end of the window, which then readies it with the posts held back.
+*
+* Argument(s): p_tcb         is a pointer to the TCB of the task waiting on the signal
+*
+*              dly           is the length of the window, in OS_TS_GET() units
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function must be called with interrupts disabled.
+*
+*              3) A tick timeout given to OSSignalPend() is replaced by the window.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SIGNAL_COALESCE_EN > 0u)
+static  void  OS_SignalWindowArm (OS_TCB  *p_tcb,
+                                  CPU_TS   dly)
+{
+    switch (p_tcb->TaskState) {
+        case OS_TASK_STATE_PEND:
+             p_tcb->TaskState = OS_TASK_STATE_PEND_TIMEOUT;
+             break;
+
+        case OS_TASK_STATE_PEND_SUSPENDED:
+             p_tcb->TaskState = OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED;
+             break;
+
+        case OS_TASK_STATE_PEND_TIMEOUT:
+        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
+             if (p_tcb->TickHrDly != 0u) {                      /* Already waiting for the end of a window              */
+                 return;
+             }
+             OS_TickListRemove(p_tcb);                          /* See Note #3                                          */
+             break;
+
+        default:
+             return;
+    }
+
+    p_tcb->TickHrDly = dly;
+    OS_TickHrListInsert(p_tcb);
+}
+#endif
+#endif
@@ -0,0 +1,421 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                    MULTI-SIZE SLAB ALLOCATOR
+*
+* File    : os_slab.c
+* Version : V3.08.00
+*********************************************************************************************************
+*/
+
+#define   MICRIUM_SOURCE
+#define   OS_CRIT_SITE_ID                   OS_CRIT_SITE_SLAB
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_slab__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_SLAB_EN > 0u)
+/*
+************************************************************************************************************************
+*                                                   CREATE A SLAB
+*
+* Description : Create a slab allocator made of one fixed-sized memory partition per size class.
+*
+* Arguments   : p_slab       is a pointer to the slab control block which is allocated in user memory space.
+*
+*               p_name       is a pointer to an ASCII string to provide a name to the slab (and to its partitions).
+*
+*               p_cfg_tbl    is a pointer to a table (typically 'const') describing each size class: the storage, the
+*                            number of blocks and the block size.  The entries MUST be sorted by increasing block size.
+*
+*               p_class_tbl  is a pointer to an array of 'nbr_classes' OS_SLAB_CLASS that will hold the memory
+*                            partitions and statistics of each size class.
+*
+*               nbr_classes  is the number of entries in 'p_cfg_tbl' and 'p_class_tbl'.
+*
+*               p_err        is a pointer to a variable containing an error message which will be set by this function
+*                            to either:
+*
+*                                OS_ERR_NONE                    If the slab has been created correctly
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the slab after you called
+*                                                                 OSSafetyCriticalStart()
+*                                OS_ERR_MEM_CREATE_ISR          If you called this function from an ISR
+*                                OS_ERR_MEM_INVALID_P_MEM       If you passed a NULL pointer for 'p_slab'
+*                                OS_ERR_MEM_INVALID_P_DATA      If you passed a NULL pointer for 'p_cfg_tbl' or
+*                                                                 'p_class_tbl'
+*                                OS_ERR_MEM_INVALID_PART        If 'nbr_classes' is 0
+*                                OS_ERR_MEM_INVALID_SIZE        If the size classes are not sorted by increasing size
+*                                OS_ERR_OBJ_CREATED             If the slab was already created
+*
+*                            or any of the errors returned by OSMemCreate() for a size class.
+*
+* Returns     : none
+*
+* Note(s)     : 1) The size class table is meant to be defined at compile time, for example:
+*
+*                      static  CPU_INT32U         AppSlab32 [16][ 32u / sizeof(CPU_INT32U)];
+*                      static  CPU_INT32U         AppSlab128[ 8][128u / sizeof(CPU_INT32U)];
+*
+*                      static  const  OS_SLAB_CFG  AppSlabCfg[] = {
+*                          { &AppSlab32[0][0],  16u,  32u },
+*                          { &AppSlab128[0][0],  8u, 128u }
+*                      };
+************************************************************************************************************************
+*/
+
+void  OSSlabCreate (OS_SLAB            *p_slab,
+                    CPU_CHAR           *p_name,
+                    const  OS_SLAB_CFG *p_cfg_tbl,
+                    OS_SLAB_CLASS      *p_class_tbl,
+                    OS_OBJ_QTY          nbr_classes,
+                    OS_ERR             *p_err)
+{
+    OS_OBJ_QTY  i;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_MEM_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_slab == (OS_SLAB *)0) {                               /* Must point to a valid slab                           */
+       *p_err = OS_ERR_MEM_INVALID_P_MEM;
+        return;
+    }
+    if ((p_cfg_tbl   == (const OS_SLAB_CFG *)0) ||              /* Must provide the size classes                        */
+        (p_class_tbl == (OS_SLAB_CLASS     *)0)) {
+       *p_err = OS_ERR_MEM_INVALID_P_DATA;
+        return;
+    }
+    if (nbr_classes == 0u) {                                    /* Must have at least one size class                    */
+       *p_err = OS_ERR_MEM_INVALID_PART;
+        return;
+    }
+    for (i = 1u; i < nbr_classes; i++) {                        /* Classes must be sorted by increasing block size      */
+        if (p_cfg_tbl[i].BlkSize <= p_cfg_tbl[i - 1u].BlkSize) {
+           *p_err = OS_ERR_MEM_INVALID_SIZE;
+            return;
+        }
+    }
+#endif
+
+#if (OS_OBJ_TYPE_REQ > 0u)
+#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
+    if (p_slab->Type == OS_OBJ_TYPE_SLAB) {
+       *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+#endif
+
+    for (i = 0u; i < nbr_classes; i++) {                        /* Create the partition of each size class              */
+        OSMemCreate(&p_class_tbl[i].Mem,
+                     p_name,
+                     p_cfg_tbl[i].AddrPtr,
+                     p_cfg_tbl[i].NbrBlks,
+                     p_cfg_tbl[i].BlkSize,
+                     p_err);
+        if (*p_err != OS_ERR_NONE) {
+            return;
+        }
+        p_class_tbl[i].NbrUsedMax = 0u;
+    }
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_slab->Type       = OS_OBJ_TYPE_SLAB;                      /* Set the type of object                               */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_slab->NamePtr    = p_name;                                /* Save name of slab                                    */
+#else
+    (void)p_name;
+#endif
+    p_slab->ClassTbl   = p_class_tbl;
+    p_slab->NbrClasses = nbr_classes;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              ALLOCATE A BLOCK FROM A SLAB
+*
+* Description : Get a memory block of at least 'size' bytes from the smallest size class that can hold it.
+*
+* Arguments   : p_slab   is a pointer to the slab control block
+*
+*               size     is the number of bytes needed
+*
+*               opt      determines what happens when the size class that fits is exhausted:
+*
+*                            OS_OPT_SLAB_NONE          Fail with OS_ERR_MEM_NO_FREE_BLKS
+*                            OS_OPT_SLAB_FALLBACK      Try the next larger size classes before failing
+*
+*               p_err    is a pointer to a variable containing an error message which will be set by this function to
+*                        either:
+*
+*                            OS_ERR_NONE               If a block was allocated
+*                            OS_ERR_MEM_INVALID_P_MEM  If you passed a NULL pointer for 'p_slab'
+*                            OS_ERR_MEM_INVALID_SIZE   If 'size' is larger than the largest size class
+*                            OS_ERR_MEM_NO_FREE_BLKS   If there are no more free blocks to allocate to the caller
+*                            OS_ERR_OBJ_TYPE           If 'p_slab' is not pointing at a slab
+*                            OS_ERR_OPT_INVALID        If you specified an invalid option
+*
+* Returns     : A pointer to a memory block if no error is detected
+*               A pointer to NULL if an error is detected
+*
+* Note(s)     : none
+************************************************************************************************************************
+*/
+
+void  *OSSlabAlloc (OS_SLAB      *p_slab,
+                    OS_MEM_SIZE   size,
+                    OS_OPT        opt,
+                    OS_ERR       *p_err)
+{
+    OS_SLAB_CLASS  *p_class;
+    OS_SLAB_CLASS  *p_class_end;
+    OS_MEM_QTY      nbr_used;
+    void           *p_blk;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_slab == (OS_SLAB *)0) {                               /* Must point to a valid slab                           */
+       *p_err = OS_ERR_MEM_INVALID_P_MEM;
+        return ((void *)0);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_SLAB_NONE:
+        case OS_OPT_SLAB_FALLBACK:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_slab->Type != OS_OBJ_TYPE_SLAB) {                     /* Make sure the slab was created                       */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return ((void *)0);
+    }
+#endif
+
+    p_class     = p_slab->ClassTbl;                             /* Find the smallest size class that fits               */
+    p_class_end = p_class + p_slab->NbrClasses;
+    while ((p_class < p_class_end) &&
+           (p_class->Mem.BlkSize < size)) {
+        p_class++;
+    }
+    if (p_class == p_class_end) {
+       *p_err = OS_ERR_MEM_INVALID_SIZE;
+        return ((void *)0);
+    }
+
+    p_blk = (void *)0;
+    while (p_class < p_class_end) {
+        p_blk = OSMemGet(&p_class->Mem, p_err);
+        if (*p_err == OS_ERR_NONE) {
+            break;
+        }
+        if ((opt & OS_OPT_SLAB_FALLBACK) == 0u) {               /* Class exhausted, try the next one if allowed         */
+            return ((void *)0);
+        }
+        p_class++;
+    }
+    if (p_blk == (void *)0) {
+        return ((void *)0);                                     /* All the classes that fit are exhausted               */
+    }
+
+    CPU_CRITICAL_ENTER();                                       /* Update the high-water mark of the class              */
+    nbr_used = p_class->Mem.NbrMax - p_class->Mem.NbrFree;
+    if (p_class->NbrUsedMax < nbr_used) {
+        p_class->NbrUsedMax = nbr_used;
+    }
+    CPU_CRITICAL_EXIT();
+    return (p_blk);
+}
+
+
+/*
+************************************************************************************************************************
+*                                              RELEASE A BLOCK TO A SLAB
+*
+* Description : Returns a memory block obtained from OSSlabAlloc() to the size class it belongs to.
+*
+* Arguments   : p_slab   is a pointer to the slab control block
+*
+*               p_blk    is a pointer to the memory block being released.
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               If the memory block was returned to the slab
+*                            OS_ERR_MEM_FULL           If the size class the block belongs to is already full
+*                            OS_ERR_MEM_INVALID_P_BLK  If 'p_blk' is NULL or does not belong to any size class
+*                            OS_ERR_MEM_INVALID_P_MEM  If you passed a NULL pointer for 'p_slab'
+*                            OS_ERR_OBJ_TYPE           If 'p_slab' is not pointing at a slab
+*
+* Returns     : none
+*
+* Note(s)     : 1) The size class is found from the address of the block, so the size requested from OSSlabAlloc()
+*                  does not need to be remembered.
+************************************************************************************************************************
+*/
+
+void  OSSlabFree (OS_SLAB  *p_slab,
+                  void     *p_blk,
+                  OS_ERR   *p_err)
+{
+    OS_SLAB_CLASS  *p_class;
+    OS_SLAB_CLASS  *p_class_end;
+    CPU_ADDR        blk_addr;
+    CPU_ADDR        part_addr;
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_slab == (OS_SLAB *)0) {                               /* Must point to a valid slab                           */
+       *p_err = OS_ERR_MEM_INVALID_P_MEM;
+        return;
+    }
+    if (p_blk == (void *)0) {                                   /* Must release a valid block                           */
+       *p_err = OS_ERR_MEM_INVALID_P_BLK;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_slab->Type != OS_OBJ_TYPE_SLAB) {                     /* Make sure the slab was created                       */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    blk_addr    = (CPU_ADDR)p_blk;
+    p_class     = p_slab->ClassTbl;
+    p_class_end = p_class + p_slab->NbrClasses;
+    while (p_class < p_class_end) {                             /* Find the partition the block was taken from          */
+        part_addr = (CPU_ADDR)p_class->Mem.AddrPtr;
+        if ((blk_addr >= part_addr) &&
+            (blk_addr <  (part_addr + ((CPU_ADDR)p_class->Mem.NbrMax * (CPU_ADDR)p_class->Mem.BlkSize)))) {
+            OSMemPut(&p_class->Mem, p_blk, p_err);
+            return;
+        }
+        p_class++;
+    }
+   *p_err = OS_ERR_MEM_INVALID_P_BLK;                           /* Block does not belong to this slab                   */
+}
+
+
+/*
+************************************************************************************************************************
+*                                        GET THE HIGH-WATER MARK OF A SIZE CLASS
+*
+* Description : Returns the largest number of blocks that were allocated at the same time from a size class.
+*
+* Arguments   : p_slab     is a pointer to the slab control block
+*
+*               class_ix   is the index of the size class in the configuration table given to OSSlabCreate()
+*
+*               p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE               If the call was successful
+*                              OS_ERR_MEM_INVALID_P_MEM  If you passed a NULL pointer for 'p_slab'
+*                              OS_ERR_MEM_INVALID_PART   If 'class_ix' is not a valid size class
+*                              OS_ERR_OBJ_TYPE           If 'p_slab' is not pointing at a slab
+*
+* Returns     : The peak number of blocks used in the size class, 0 if an error is detected
+*
+* Note(s)     : 1) The current number of blocks used is 'NbrMax - NbrFree' of the class' memory partition.
+************************************************************************************************************************
+*/
+
+OS_MEM_QTY  OSSlabUsedMaxGet (OS_SLAB     *p_slab,
+                              OS_OBJ_QTY   class_ix,
+                              OS_ERR      *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_slab == (OS_SLAB *)0) {                               /* Must point to a valid slab                           */
+       *p_err = OS_ERR_MEM_INVALID_P_MEM;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_slab->Type != OS_OBJ_TYPE_SLAB) {                     /* Make sure the slab was created                       */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    if (class_ix >= p_slab->NbrClasses) {                       /* Validate the size class                              */
+       *p_err = OS_ERR_MEM_INVALID_PART;
+        return (0u);
+    }
+
+   *p_err = OS_ERR_NONE;
+    return (p_slab->ClassTbl[class_ix].NbrUsedMax);
+}
+#endif
@@ -24,6 +24,7 @@
 */
 
 #define  MICRIUM_SOURCE
+#define  OS_CRIT_SITE_ID                    OS_CRIT_SITE_STAT
 #include "os.h"
 
 #ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
@@ -33,6 +34,33 @@ const  CPU_CHAR  *os_stat__c = "$Id: $";
 
 #if (OS_CFG_STAT_TASK_EN > 0u)
 
+/*
+************************************************************************************************************************
+*                                                 FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+#if (OS_TASK_PERIOD_EN > 0u) && (OS_CFG_DBG_EN > 0u)
+static  void  OS_StatTaskPeriodUpdate (OS_TCB  *p_tcb);
+#endif
+
+#if (OS_CFG_STAT_SNAP_EN > 0u)
+static  void  OS_StatSnapUpdate       (void);
+#endif
+
+#if (OS_CFG_STAT_GOV_EN > 0u)
+static  void  OS_StatGovUpdate        (OS_CPU_USAGE  usage);
+#endif
+
+#if (OS_CFG_STAT_SCHED_EN > 0u)
+static  void  OS_StatSchedChk         (void);
+#endif
+
+#if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u) && (OS_CFG_ISR_STK_SIZE > 0u)
+static  void  OS_StatISRStkChk        (void);
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                   RESET STATISTICS
@@ -59,6 +87,12 @@ void  OSStatReset (OS_ERR  *p_err)
 #if (OS_CFG_Q_EN > 0u)
     OS_Q        *p_q;
 #endif
+#if (OS_CFG_MUTEX_BLOCK_STAT_EN > 0u)
+    OS_MUTEX    *p_mutex;
+#endif
+#if (OS_CFG_TASK_PERF_CTR_EN > 0u)
+    CPU_INT08U   ix;
+#endif
 #endif
     CPU_SR_ALLOC();
 
@@ -86,8 +120,8 @@ void  OSStatReset (OS_ERR  *p_err)
 
 #if (OS_CFG_TMR_EN > 0u)
 #if (OS_CFG_TS_EN > 0u)
-    OSTmrTaskTime         = 0u;
-    OSTmrTaskTimeMax      = 0u;
+    OSTmrSvc.TaskTime     = 0u;
+    OSTmrSvc.TaskTimeMax  = 0u;
 #endif
 #endif
 
@@ -102,9 +136,27 @@ void  OSStatReset (OS_ERR  *p_err)
     OSSchedLockTimeMax    = 0u;                                 /* Reset the maximum scheduler lock time                */
 #endif
 
+#if (OS_CFG_LOCK_SITE_EN > 0u)
+    OS_LockSiteClr();                                           /* Reset the lock times per call site                   */
+#endif
+
+#if (OS_CFG_CRIT_SECTION_PROFILE_EN > 0u)
+    OS_CritSiteClr();                                           /* Reset the critical section profile                   */
+#endif
+
 #if ((OS_MSG_EN > 0u) && (OS_CFG_DBG_EN > 0u))
     OSMsgPool.NbrUsedMax  = 0u;
 #endif
+
+#if (OS_TASK_PERIOD_EN > 0u) && (OS_CFG_DBG_EN > 0u)
+    OSStatTaskPeriodOvrCtr    = 0u;
+    OSStatTaskPeriodJitterMax = 0u;
+#endif
+
+#if (OS_CFG_MUTEX_BLOCK_STAT_EN > 0u)
+    OSMutexChainWorst.TaskPtr   = (OS_TCB *)0;                  /* Forget the worst blocking chain                      */
+    OSMutexChainWorst.BlockTime =           0u;
+#endif
     CPU_CRITICAL_EXIT();
 
 #if (OS_CFG_DBG_EN > 0u)
@@ -130,11 +182,34 @@ void  OSStatReset (OS_ERR  *p_err)
         p_tcb->CtxSwCtr         = 0u;
         p_tcb->CPUUsage         = 0u;
         p_tcb->CPUUsageMax      = 0u;
+#if (OS_CFG_STAT_SCHED_EN > 0u)
+        p_tcb->SchedJobStart   -= p_tcb->CyclesTotal;           /* Keep the cycles of the current job                   */
+#endif
         p_tcb->CyclesTotal      = 0u;
         p_tcb->CyclesTotalPrev  = 0u;
 #if (OS_CFG_TS_EN > 0u)
         p_tcb->CyclesStart      = OS_TS_GET();
 #endif
+#if (OS_CFG_STAT_TASK_BUDGET > 0u)
+        p_tcb->CyclesStatStart  = OS_TS_GET();
+#endif
+#endif
+
+#if (OS_CFG_TASK_PERF_CTR_EN > 0u)
+        for (ix = 0u; ix < OS_CPU_PERF_CTR_NBR; ix++) {         /* Keep the snapshots, the task might be running        */
+            p_tcb->PerfCtrTotal[ix] = 0u;
+        }
+#endif
+
+#if (OS_TASK_PERIOD_EN > 0u)
+        p_tcb->PeriodOvrCtr     = 0u;
+        p_tcb->PeriodOvrCtrStat = 0u;
+        p_tcb->PeriodJitterMax  = 0u;
+#endif
+
+#if (OS_CFG_STAT_SCHED_EN > 0u)
+        p_tcb->SchedWCET        = 0u;                           /* Measure the execution times again                    */
+        p_tcb->SchedResp        = 0u;
 #endif
 
 #if (OS_CFG_TASK_Q_EN > 0u)
@@ -146,6 +221,13 @@ void  OSStatReset (OS_ERR  *p_err)
     }
 #endif
 
+#if (OS_CFG_STAT_TASK_IDLE_CYCLES_EN > 0u)
+    CPU_CRITICAL_ENTER();                                       /* Start a new CPU usage period                         */
+    OSStatTaskIdleCycles  = OSIdleTaskTCB.CyclesTotal;
+    OSStatTaskCyclesStart = OS_TS_GET();
+    CPU_CRITICAL_EXIT();
+#endif
+
 #if (OS_CFG_Q_EN > 0u) && (OS_CFG_DBG_EN > 0u)
     CPU_CRITICAL_ENTER();
     p_q = OSQDbgListPtr;
@@ -159,6 +241,21 @@ void  OSStatReset (OS_ERR  *p_err)
     }
 #endif
 
+#if (OS_CFG_MUTEX_BLOCK_STAT_EN > 0u) && (OS_CFG_DBG_EN > 0u)
+    CPU_CRITICAL_ENTER();
+    p_mutex = OSMutexDbgListPtr;
+    CPU_CRITICAL_EXIT();
+    while (p_mutex != (OS_MUTEX *)0) {                          /* Reset the blocking statistics of the mutexes         */
+        CPU_CRITICAL_ENTER();
+        p_mutex->BlockCtr       = 0u;
+        p_mutex->BlockTimeTotal = 0u;
+        p_mutex->BlockTimeMax   = 0u;
+        p_mutex->BlockDepthMax  = 0u;
+        p_mutex                 = p_mutex->DbgNextPtr;
+        CPU_CRITICAL_EXIT();
+    }
+#endif
+
 
    *p_err = OS_ERR_NONE;
 }
@@ -184,18 +281,23 @@ void  OSStatReset (OS_ERR  *p_err)
 *
 * Returns    : none
 *
-* Note(s)    : none
+* Note(s)    : 1) With OS_CFG_STAT_TASK_IDLE_CYCLES_EN, the CPU usage is derived from the cycles spent in the idle task
+*                 and no calibration is needed: this function returns immediately.
 ************************************************************************************************************************
 */
 
 void  OSStatTaskCPUUsageInit (OS_ERR  *p_err)
 {
+#if (OS_CFG_STAT_TASK_IDLE_CYCLES_EN == 0u)
     OS_ERR   err;
     OS_TICK  dly;
+#endif
     CPU_SR_ALLOC();
 
 
+#if (OS_CFG_STAT_TASK_IDLE_CYCLES_EN == 0u)
     err = OS_ERR_NONE;                                          /* Initialize err explicitly for static analysis.       */
+#endif
 
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == (OS_ERR *)0) {
@@ -211,6 +313,15 @@ void  OSStatTaskCPUUsageInit (OS_ERR  *p_err)
     }
 #endif
 
+#if (OS_CFG_STAT_TASK_IDLE_CYCLES_EN > 0u)
+    CPU_CRITICAL_ENTER();                                       /* No calibration needed (see Note #1)                  */
+#if (OS_CFG_TS_EN > 0u)
+    OSStatTaskTimeMax = 0u;
+#endif
+    OSStatTaskRdy     = OS_STATE_RDY;
+    CPU_CRITICAL_EXIT();
+   *p_err             = OS_ERR_NONE;
+#else
 #if ((OS_CFG_TMR_EN > 0u) && (OS_CFG_TASK_SUSPEND_EN > 0u))
     OSTaskSuspend(&OSTmrTaskTCB, &err);
     if (err != OS_ERR_NONE) {
@@ -231,11 +342,11 @@ void  OSStatTaskCPUUsageInit (OS_ERR  *p_err)
     CPU_CRITICAL_EXIT();
 
     dly = 0u;
-    if (OSCfg_TickRate_Hz > OSCfg_StatTaskRate_Hz) {
-        dly = (OS_TICK)(OSCfg_TickRate_Hz / OSCfg_StatTaskRate_Hz);
+    if (OS_TICK_RATE_HZ > OSCfg_StatTaskRate_Hz) {
+        dly = (OS_TICK)(OS_TICK_RATE_HZ / OSCfg_StatTaskRate_Hz);
     }
     if (dly == 0u) {
-        dly =  (OSCfg_TickRate_Hz / 10u);
+        dly =  (OS_TICK_RATE_HZ / 10u);
     }
 
     OSTimeDly(dly,                                              /* Determine MAX. idle counter value                    */
@@ -259,7 +370,133 @@ void  OSStatTaskCPUUsageInit (OS_ERR  *p_err)
     OSStatTaskRdy     = OS_STATE_RDY;
     CPU_CRITICAL_EXIT();
    *p_err             = OS_ERR_NONE;
+#endif
+}
+
+
+/*
+************************************************************************************************************************
+*                                          GET THE CURRENT PERFORMANCE LEVEL
+*
+* Description: This function returns the performance level the CPU was last switched to by the frequency governor.
+*
+* Argument(s): p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE            The call succeeded
+*
+* Returns    : The current performance level, from 0 to 'LvlMax' of the governor.
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_STAT_GOV_EN > 0u)
+OS_PERF_LVL  OSStatGovLvlGet (OS_ERR  *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+   *p_err = OS_ERR_NONE;
+    return (OSStatGovLvlCur);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                          INSTALL OR REMOVE THE FREQUENCY GOVERNOR
+*
+* Description: This function is called by your application to let the statistic task scale the CPU frequency with the
+*              CPU usage.  After each computation of OSStatTaskCPUUsage, the level chosen by the governor is moved one
+*              step up or down according to the thresholds of 'p_gov' (see OS_STAT_GOV).  The CPU runs at that level
+*              or at the minimum level requested by the running task through OSTaskPerfLvlSet(), whichever is higher.
+*
+* Argument(s): p_gov      is a pointer to the governor to install, or a NULL pointer to remove the current one.  The
+*                         structure must stay valid while the governor is installed.
+*
+*              p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE              The call succeeded
+*                             OS_ERR_SET_ISR           If you called this function from an ISR
+*                             OS_ERR_STAT_GOV_INVALID  If 'SetFnct' is NULL, 'UpThreshold' is above 10000 or
+*                                                      'DnThreshold' is above 'UpThreshold'
+*
+* Returns    : none
+*
+* Note(s)    : 1) The CPU is assumed to run at 'LvlMax' when the governor is installed.  Removing or replacing a
+*                 governor first moves the CPU back to 'LvlMax' of the previous one.
+*
+*              2) 'SetFnct' is called with interrupts disabled, from the statistic task and from the scheduler when it
+*                 switches between tasks that need different levels.  It must be short and must not call uC/OS-III
+*                 services.  After changing the CPU clock, it is responsible for:
+*
+*                     a) Reloading the tick timer, if it is clocked by the CPU, so that OSCfg_TickRate_Hz is kept
+*                        (e.g. through OS_CPU_SysTickInitFreq() on Cortex-M).
+*
+*                     b) Updating the frequency of the timestamp timer with CPU_TS_TmrFreqSet() if OS_TS_GET() counts
+*                        CPU cycles.  Budgets, time slices and high resolution timeouts already in progress keep the
+*                        cycle counts computed at the previous frequency.
+*
+*              3) The CPU usage of a run is measured at the level(s) used during that run, so the thresholds should
+*                 leave enough room for the usage to rise after a step down without immediately stepping back up.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_STAT_GOV_EN > 0u)
+void  OSStatGovSet (OS_STAT_GOV  *p_gov,
+                    OS_ERR       *p_err)
+{
+    OS_STAT_GOV  *p_gov_prev;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't call this function from an ISR                 */
+       *p_err = OS_ERR_SET_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_gov != (OS_STAT_GOV *)0) {
+        if ((p_gov->SetFnct     == (OS_STAT_GOV_FNCT)0)   ||
+            (p_gov->UpThreshold >  10000u)                ||
+            (p_gov->DnThreshold >  p_gov->UpThreshold)) {
+           *p_err = OS_ERR_STAT_GOV_INVALID;
+            return;
+        }
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_gov_prev = OSStatGovPtr;
+    if ((p_gov_prev      != (OS_STAT_GOV *)0) &&
+        (OSStatGovLvlCur != p_gov_prev->LvlMax)) {
+        p_gov_prev->SetFnct(OSStatGovLvlCur, p_gov_prev->LvlMax);
+    }                                                           /* Back to full speed (see Note #1)                     */
+    OSStatGovPtr   = p_gov;
+    OSStatGovUpCtr = 0u;
+    OSStatGovDnCtr = 0u;
+    if (p_gov != (OS_STAT_GOV *)0) {
+        OSStatGovLvl    = p_gov->LvlMax;
+        OSStatGovLvlCur = p_gov->LvlMax;
+    }
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
 }
+#endif
 
 
 /*
@@ -285,6 +522,26 @@ void  OSStatTaskCPUUsageInit (OS_ERR  *p_err)
 *                 for the idle counter.
 *
 *              4) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              5) With OS_CFG_STAT_TASK_IDLE_CYCLES_EN, the CPU usage is instead computed from the OS_TS_GET() cycles
+*                 credited to the idle task by OSTaskSwHook() ('CyclesTotal'):
+*
+*                                                   idle task cycles since the previous run
+*                 OSStatTaskCPUUsage = 100 * (1 - ------------------------------------------)     (units are in %)
+*                                                      cycles elapsed since the previous run
+*
+*                 It stays accurate when the idle task hook puts the CPU to sleep, as long as the timestamp timer
+*                 keeps counting while the CPU sleeps.
+*
+*              6) When OS_CFG_STAT_TASK_BUDGET is non-zero, each run processes at most that many tasks of the debug
+*                 list, resuming where the previous run stopped.  A task's CPU usage is then computed over the time
+*                 elapsed since it was last processed.  The results of each task are published with interrupts
+*                 disabled and OSStatTaskSeqCtr is incremented every time.  A reader that needs a consistent set of
+*                 values (e.g. 'CPUUsage', 'StkFree' and 'StkUsed' of one or more tasks) reads OSStatTaskSeqCtr,
+*                 reads the values and reads OSStatTaskSeqCtr again, starting over if it changed.
+*
+*              7) When OS_CFG_STAT_SCHED_EN is enabled, each run ends with a response-time analysis of the periodic
+*                 tasks based on their measured execution times (see OS_StatSchedChk()).
 ************************************************************************************************************************
 */
 
@@ -294,24 +551,37 @@ void  OS_StatTask (void  *p_arg)
 #if (OS_CFG_TASK_PROFILE_EN > 0u)
     OS_CPU_USAGE usage;
     OS_CYCLES    cycles_total;
+#if (OS_CFG_STAT_TASK_BUDGET > 0u)
+    OS_CYCLES    cycles;
+    CPU_TS       ts;
+#else
     OS_CYCLES    cycles_div;
     OS_CYCLES    cycles_mult;
     OS_CYCLES    cycles_max;
+#endif
 #endif
     OS_TCB      *p_tcb;
+#if (OS_CFG_STAT_TASK_BUDGET > 0u)
+    OS_OBJ_QTY   nbr_tasks;
+#if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u)
+    CPU_STK_SIZE stk_free;
+    CPU_STK_SIZE stk_used;
+#endif
+#endif
+#endif
+#if (OS_CFG_STAT_TASK_IDLE_CYCLES_EN > 0u)
+    OS_CYCLES    cycles_idle;
+    OS_CYCLES    cycles_elapsed;
+    CPU_TS       ts_now;
+#else
+    OS_IDLE_CTR  ctr_max;
+    OS_IDLE_CTR  ctr_mult;
+    OS_IDLE_CTR  ctr_div;
 #endif
-    OS_TICK      ctr_max;
-    OS_TICK      ctr_mult;
-    OS_TICK      ctr_div;
     OS_ERR       err;
     OS_TICK      dly;
 #if (OS_CFG_TS_EN > 0u)
     CPU_TS       ts_start;
-#endif
-#if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u) && (OS_CFG_ISR_STK_SIZE > 0u)
-    CPU_STK     *p_stk;
-    CPU_INT32U   free_stk;
-    CPU_INT32U   size_stk;
 #endif
     CPU_SR_ALLOC();
 
@@ -325,14 +595,6 @@ void  OS_StatTask (void  *p_arg)
     }
     OSStatReset(&err);                                          /* Reset statistics                                     */
 
-    dly = (OS_TICK)0;                                           /* Compute statistic task sleep delay                   */
-    if (OSCfg_TickRate_Hz > OSCfg_StatTaskRate_Hz) {
-        dly = (OSCfg_TickRate_Hz / OSCfg_StatTaskRate_Hz);
-    }
-    if (dly == 0u) {
-        dly =  (OSCfg_TickRate_Hz / 10u);
-    }
-
     for (;;) {
 #if (OS_CFG_TS_EN > 0u)
         ts_start        = OS_TS_GET();
@@ -341,6 +603,23 @@ void  OS_StatTask (void  *p_arg)
 #endif
 #endif
 
+#if (OS_CFG_STAT_TASK_IDLE_CYCLES_EN > 0u)
+        CPU_CRITICAL_ENTER();                                   /* ---------------- OVERALL CPU USAGE ----------------- */
+        ts_now                = OS_TS_GET();                    /* The idle task is not running, its total is current   */
+        cycles_idle           = OSIdleTaskTCB.CyclesTotal - OSStatTaskIdleCycles;
+        cycles_elapsed        = (OS_CYCLES)(ts_now - OSStatTaskCyclesStart);
+        OSStatTaskCyclesStart = ts_now;
+        CPU_CRITICAL_EXIT();
+
+        if (cycles_elapsed > 0u) {                              /* See Note #5                                          */
+            OSStatTaskCPUUsage = (OS_CPU_USAGE)(10000u - OS_StatTaskCPUUsageCalc(cycles_idle, cycles_elapsed));
+            if (OSStatTaskCPUUsageMax < OSStatTaskCPUUsage) {
+                OSStatTaskCPUUsageMax = OSStatTaskCPUUsage;
+            }
+        } else {
+            OSStatTaskCPUUsage = 0u;
+        }
+#else
         CPU_CRITICAL_ENTER();                                   /* ---------------- OVERALL CPU USAGE ----------------- */
         OSStatTaskCtrRun   = OSStatTaskCtr;                     /* Obtain the of the stat counter for the past .1 second*/
         OSStatTaskCtr      = 0u;                                /* Reset the stat counter for the next .1 second        */
@@ -364,18 +643,86 @@ void  OS_StatTask (void  *p_arg)
                 ctr_div  = 10000u;
             }
             ctr_max            = OSStatTaskCtrMax / ctr_div;
-            OSStatTaskCPUUsage = (OS_CPU_USAGE)((OS_TICK)10000u - ((ctr_mult * OSStatTaskCtrRun) / ctr_max));
+            OSStatTaskCPUUsage = (OS_CPU_USAGE)((OS_IDLE_CTR)10000u - ((ctr_mult * OSStatTaskCtrRun) / ctr_max));
             if (OSStatTaskCPUUsageMax < OSStatTaskCPUUsage) {
                 OSStatTaskCPUUsageMax = OSStatTaskCPUUsage;
             }
         } else {
             OSStatTaskCPUUsage = 0u;
         }
+#endif
+
+#if (OS_CFG_STAT_GOV_EN > 0u)
+        OS_StatGovUpdate(OSStatTaskCPUUsage);                   /* Step the performance level up or down                */
+#endif
 
         OSStatTaskHook();                                       /* Invoke user definable hook                           */
 
 
 #if (OS_CFG_DBG_EN > 0u)
+#if (OS_CFG_STAT_TASK_BUDGET > 0u)
+        nbr_tasks = 0u;                                         /* ---------- PROCESS THE NEXT BATCH OF TASKS --------- */
+        while (nbr_tasks < OS_CFG_STAT_TASK_BUDGET) {
+            CPU_CRITICAL_ENTER();
+            p_tcb = OSStatTaskTCBNextPtr;
+            if (p_tcb == (OS_TCB *)0) {                         /* Reached the end of the list?                         */
+                if (nbr_tasks > 0u) {                           /* Yes, resume from the head on the next run            */
+                    CPU_CRITICAL_EXIT();
+                    break;
+                }
+                p_tcb = OSTaskDbgListPtr;
+            }
+            OSStatTaskTCBNextPtr = p_tcb->DbgNextPtr;
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+            ts                     = OS_TS_GET();
+            cycles                 = p_tcb->CyclesTotal;        /* Cycles used since the task was last processed        */
+            cycles_total           = (OS_CYCLES)(ts - p_tcb->CyclesStatStart);
+            p_tcb->CyclesTotal     = 0u;
+            p_tcb->CyclesStatStart = ts;
+#if (OS_CFG_STAT_SCHED_EN > 0u)
+            p_tcb->SchedJobStart  -= cycles;                    /* '.CyclesTotal' of the job start moved as well        */
+#endif
+#endif
+            CPU_CRITICAL_EXIT();
+
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+            usage = OS_StatTaskCPUUsageCalc(cycles, cycles_total);
+#endif
+#if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u)
+            OSTaskStkChk( p_tcb,                                /* Compute stack usage                                  */
+                         &stk_free,
+                         &stk_used,
+                         &err);
+#endif
+
+            CPU_CRITICAL_ENTER();                               /* Publish the results (see Note #6)                    */
+            OSStatTaskSeqCtr++;
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+            p_tcb->CyclesTotalPrev = cycles;
+            p_tcb->CPUUsage        = usage;
+            if (p_tcb->CPUUsageMax < usage) {                   /* Detect peak CPU usage                                */
+                p_tcb->CPUUsageMax = usage;
+            }
+#endif
+#if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u)
+            if (err == OS_ERR_NONE) {
+                p_tcb->StkFree     = stk_free;
+                p_tcb->StkUsed     = stk_used;
+            }
+#endif
+            CPU_CRITICAL_EXIT();
+#if (OS_CFG_TASK_STK_PROFILE_EN > 0u)
+            if (err == OS_ERR_NONE) {
+                OS_TaskStkProfileUpdate(p_tcb);                 /* Record the peak stack usage of the entry point       */
+            }
+#endif
+#if (OS_TASK_PERIOD_EN > 0u) && (OS_CFG_DBG_EN > 0u)
+            OS_StatTaskPeriodUpdate(p_tcb);                     /* Collect the overruns and the jitter of the task      */
+#endif
+
+            nbr_tasks++;
+        }
+#else
 #if (OS_CFG_TASK_PROFILE_EN > 0u)
         cycles_total = 0u;
 
@@ -386,6 +733,9 @@ void  OS_StatTask (void  *p_arg)
             CPU_CRITICAL_ENTER();
             p_tcb->CyclesTotalPrev = p_tcb->CyclesTotal;        /* Save accumulated # cycles into a temp variable       */
             p_tcb->CyclesTotal     = 0u;                        /* Reset total cycles for task for next run             */
+#if (OS_CFG_STAT_SCHED_EN > 0u)
+            p_tcb->SchedJobStart  -= p_tcb->CyclesTotalPrev;    /* '.CyclesTotal' of the job start moved as well        */
+#endif
             CPU_CRITICAL_EXIT();
 
             cycles_total          += p_tcb->CyclesTotalPrev;    /* Perform sum of all task # cycles                     */
@@ -443,43 +793,32 @@ void  OS_StatTask (void  *p_arg)
                          &p_tcb->StkUsed,
                          &err);
 #endif
+#if (OS_CFG_TASK_STK_PROFILE_EN > 0u)
+            if (err == OS_ERR_NONE) {
+                OS_TaskStkProfileUpdate(p_tcb);                 /* Record the peak stack usage of the entry point       */
+            }
+#endif
+#if (OS_TASK_PERIOD_EN > 0u) && (OS_CFG_DBG_EN > 0u)
+            OS_StatTaskPeriodUpdate(p_tcb);                     /* Collect the overruns and the jitter of the task      */
+#endif
 
             CPU_CRITICAL_ENTER();
             p_tcb = p_tcb->DbgNextPtr;
             CPU_CRITICAL_EXIT();
         }
 #endif
+#endif
 
-                                                                /*------------------ Check ISR Stack -------------------*/
 #if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u) && (OS_CFG_ISR_STK_SIZE > 0u)
-        free_stk  = 0u;
-#if (CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO)
-        p_stk     = OSCfg_ISRStkBasePtr;                        /*   Start at the lowest memory and go up               */
-#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
-        p_stk    += OS_CFG_TASK_STK_REDZONE_DEPTH;
-        size_stk  = OSCfg_ISRStkSize - OS_CFG_TASK_STK_REDZONE_DEPTH;
-#else
-        size_stk  = OSCfg_ISRStkSize;
-#endif
-        while ((*p_stk == 0u) && (free_stk < size_stk)) {       /*   Compute the number of zero entries on the stk      */
-            p_stk++;
-            free_stk++;
-        }
-#else
-        p_stk     = OSCfg_ISRStkBasePtr + OSCfg_ISRStkSize - 1u;/*   Start at the highest memory and go down            */
-#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
-        p_stk    -= OS_CFG_TASK_STK_REDZONE_DEPTH;
-        size_stk  = OSCfg_ISRStkSize - OS_CFG_TASK_STK_REDZONE_DEPTH;
-#else
-        size_stk  = OSCfg_ISRStkSize;
+        OS_StatISRStkChk();                                     /* Check the ISR stack                                  */
 #endif
-        while ((*p_stk == 0u) && (free_stk < size_stk)) {       /*   Compute the number of zero entries on the stk      */
-            free_stk++;
-            p_stk--;
-        }
+
+#if (OS_CFG_STAT_SCHED_EN > 0u)
+        OS_StatSchedChk();                                      /* Check the periodic tasks against the measured load   */
 #endif
-        OSISRStkFree = free_stk;
-        OSISRStkUsed = OSCfg_ISRStkSize - free_stk;
+
+#if (OS_CFG_STAT_SNAP_EN > 0u)
+        OS_StatSnapUpdate();                                    /* Publish the results for debug probes                 */
 #endif
 
         if (OSStatResetFlag == OS_TRUE) {                       /* Check if need to reset statistics                    */
@@ -494,6 +833,19 @@ void  OS_StatTask (void  *p_arg)
         }
 #endif
 
+#if (OS_CFG_STAT_TASK_IDLE_CYCLES_EN > 0u)
+        CPU_CRITICAL_ENTER();                                   /* The idle task can't have run since 'ts_now'          */
+        OSStatTaskIdleCycles = OSIdleTaskTCB.CyclesTotal;
+        CPU_CRITICAL_EXIT();
+#endif
+
+        dly = (OS_TICK)0;                                       /* Compute statistic task sleep delay at the tick rate  */
+        if (OS_TICK_RATE_HZ > OSCfg_StatTaskRate_Hz) {
+            dly = (OS_TICK_RATE_HZ / OSCfg_StatTaskRate_Hz);
+        }
+        if (dly == 0u) {
+            dly =  (OS_TICK_RATE_HZ / 10u);
+        }
         OSTimeDly(dly,
                   OS_OPT_TIME_DLY,
                   &err);
@@ -501,6 +853,64 @@ void  OS_StatTask (void  *p_arg)
 }
 
 
+/*
+************************************************************************************************************************
+*                                              COMPUTE A TASK'S CPU USAGE
+*
+* Description: This function computes the share of 'cycles_total' represented by 'cycles', with the best resolution
+*              that doesn't overflow an OS_CYCLES.
+*
+* Arguments  : cycles        is the number of cycles used by the task
+*
+*              cycles_total  is the number of cycles elapsed over the same period
+*
+* Returns    : The CPU usage of the task, in 1/100th of a percent (0 to 10000)
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if ((OS_CFG_STAT_TASK_BUDGET > 0u) && (OS_CFG_DBG_EN > 0u) && (OS_CFG_TASK_PROFILE_EN > 0u)) || \
+     (OS_CFG_STAT_TASK_IDLE_CYCLES_EN > 0u)
+OS_CPU_USAGE  OS_StatTaskCPUUsageCalc (OS_CYCLES  cycles,
+                                       OS_CYCLES  cycles_total)
+{
+    OS_CYCLES  cycles_div;
+    OS_CYCLES  cycles_mult;
+    OS_CYCLES  usage;
+
+
+    if (cycles_total == 0u) {
+        return (0u);
+    }
+    if (cycles_total < 400000u) {                               /* 1 to       400,000                                   */
+        cycles_mult = 10000u;
+        cycles_div  =     1u;
+    } else if (cycles_total <   4000000u) {                     /* 400,000 to     4,000,000                             */
+        cycles_mult =  1000u;
+        cycles_div  =    10u;
+    } else if (cycles_total <  40000000u) {                     /* 4,000,000 to    40,000,000                           */
+        cycles_mult =   100u;
+        cycles_div  =   100u;
+    } else if (cycles_total < 400000000u) {                     /* 40,000,000 to   400,000,000                          */
+        cycles_mult =    10u;
+        cycles_div  =  1000u;
+    } else {                                                    /* 400,000,000 and up                                   */
+        cycles_mult =     1u;
+        cycles_div  = 10000u;
+    }
+    if (cycles > cycles_total) {                                /* Task can't use more than the elapsed time            */
+        cycles = cycles_total;
+    }
+    usage = (cycles_mult * cycles) / (cycles_total / cycles_div);
+    if (usage > 10000u) {
+        usage = 10000u;
+    }
+    return ((OS_CPU_USAGE)usage);
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                              INITIALIZE THE STATISTICS
@@ -528,10 +938,51 @@ void  OS_StatTaskInit (OS_ERR  *p_err)
     OSStatTaskCtrMax = 0u;
     OSStatTaskRdy    = OS_STATE_NOT_RDY;                        /* Statistic task is not ready                          */
     OSStatResetFlag  = OS_FALSE;
+#if (OS_CFG_STAT_TASK_IDLE_CYCLES_EN > 0u)
+    OSStatTaskIdleCycles  = 0u;
+    OSStatTaskCyclesStart = 0u;
+#endif
+#if (OS_CFG_STAT_TASK_BUDGET > 0u) && (OS_CFG_DBG_EN > 0u)
+    OSStatTaskTCBNextPtr = (OS_TCB *)0;
+    OSStatTaskSeqCtr     = 0u;
+#endif
+#if (OS_TASK_PERIOD_EN > 0u) && (OS_CFG_DBG_EN > 0u)
+    OSStatTaskPeriodOvrCtr    = 0u;
+    OSStatTaskPeriodJitterMax = 0u;
+#endif
+#if (OS_CFG_STAT_GOV_EN > 0u)
+    OSStatGovPtr     = (OS_STAT_GOV *)0;
+    OSStatGovLvl     = 0u;
+    OSStatGovLvlCur  = 0u;
+    OSStatGovUpCtr   = 0u;
+    OSStatGovDnCtr   = 0u;
+#endif
+#if (OS_CFG_STAT_SCHED_EN > 0u)
+    OSStatSchedUtil       = 0u;
+    OSStatSchedFailTCBPtr = (OS_TCB *)0;
+#endif
+#if (OS_CFG_STAT_SNAP_EN > 0u)
+    OSStatSnap.Version = OS_STAT_SNAP_VERSION;
+    OSStatSnap.Size    = (CPU_INT16U)sizeof(OS_STAT_SNAP);
+    OSStatSnap.SeqCtr  = 0u;
+    OSStatSnap.TaskNbr = 0u;
+#if (OS_CFG_Q_EN > 0u)
+    OSStatSnap.QNbr    = 0u;
+#endif
+#endif
 
 #if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u) && (OS_CFG_ISR_STK_SIZE > 0u)
     OSISRStkFree     = 0u;
     OSISRStkUsed     = 0u;
+#if (OS_CFG_STAT_TASK_STK_CHK_INCR_EN > 0u)
+                                                                /* No ISR stack usage has been observed yet             */
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+    OSISRStkChkFree  = OSCfg_ISRStkSize - OS_CFG_TASK_STK_REDZONE_DEPTH;
+#else
+    OSISRStkChkFree  = OSCfg_ISRStkSize;
+#endif
+    OSISRStkChkIx    = 0u;
+#endif
 #endif
                                                                 /* --------------- CREATE THE STAT TASK --------------- */
     if (OSCfg_StatTaskStkBasePtr == (CPU_STK *)0) {
@@ -568,4 +1019,548 @@ void  OS_StatTaskInit (OS_ERR  *p_err)
                   p_err);
 }
 
+
+/*
+************************************************************************************************************************
+*                                           APPLY THE PERFORMANCE LEVEL
+*
+* Description: OS_StatGovSw() is called by the scheduler when it switches to 'p_tcb'.  It moves the CPU to the level
+*              chosen by the governor, raised to the minimum level requested by 'p_tcb', if the CPU is not already
+*              running at that level.
+*
+* Arguments  : p_tcb    is a pointer to the OS_TCB of the task switched in
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_STAT_GOV_EN > 0u)
+void  OS_StatGovSw (OS_TCB  *p_tcb)
+{
+    OS_STAT_GOV  *p_gov;
+    OS_PERF_LVL   lvl;
+    OS_PERF_LVL   lvl_prev;
+
+
+    p_gov = OSStatGovPtr;
+    if (p_gov == (OS_STAT_GOV *)0) {                            /* No governor installed                                */
+        return;
+    }
+    lvl = OSStatGovLvl;
+    if (lvl < p_tcb->PerfLvlMin) {                              /* The task needs more performance                      */
+        lvl = p_tcb->PerfLvlMin;
+        if (lvl > p_gov->LvlMax) {
+            lvl = p_gov->LvlMax;
+        }
+    }
+    if (lvl != OSStatGovLvlCur) {
+        lvl_prev        = OSStatGovLvlCur;
+        OSStatGovLvlCur = lvl;
+        p_gov->SetFnct(lvl_prev, lvl);
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                           STEP THE PERFORMANCE LEVEL
+*
+* Description: This function is called by the statistic task after each computation of the CPU usage.  It moves the
+*              level chosen by the governor one step up or down once the usage has stayed beyond a threshold for the
+*              number of consecutive runs given by 'UpHyst' or 'DnHyst', and applies it to the statistic task.
+*
+* Arguments  : usage    is the CPU usage just computed (0..10000)
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_STAT_GOV_EN > 0u)
+static  void  OS_StatGovUpdate (OS_CPU_USAGE  usage)
+{
+    OS_STAT_GOV  *p_gov;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    p_gov = OSStatGovPtr;
+    if (p_gov == (OS_STAT_GOV *)0) {
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+    if ((usage        > p_gov->UpThreshold) &&                  /* Busy and not yet at full speed?                      */
+        (OSStatGovLvl < p_gov->LvlMax)) {
+        OSStatGovDnCtr = 0u;
+        OSStatGovUpCtr++;
+        if (OSStatGovUpCtr >= p_gov->UpHyst) {
+            OSStatGovUpCtr = 0u;
+            OSStatGovLvl++;
+        }
+    } else if ((usage        < p_gov->DnThreshold) &&           /* Idle and not yet at the lowest level?                */
+               (OSStatGovLvl > 0u)) {
+        OSStatGovUpCtr = 0u;
+        OSStatGovDnCtr++;
+        if (OSStatGovDnCtr >= p_gov->DnHyst) {
+            OSStatGovDnCtr = 0u;
+            OSStatGovLvl--;
+        }
+    } else {
+        OSStatGovUpCtr = 0u;                                    /* Inside the band: start counting over                 */
+        OSStatGovDnCtr = 0u;
+    }
+    OS_StatGovSw(OSTCBCurPtr);
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
+/*
+************************************************************************************************************************
+*                                        COLLECT PERIODIC RELEASE STATISTICS
+*
+* Description: This function accumulates the release overruns of a periodic task into OSStatTaskPeriodOvrCtr and keeps
+*              track of the largest release jitter observed across all tasks in OSStatTaskPeriodJitterMax.
+*
+* Arguments  : p_tcb    is a pointer to the TCB of the task to collect
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Only the overruns counted since the previous pass are added so that the total is not affected by the
+*                 task resetting its own counter through OSTaskPeriodSet().
+************************************************************************************************************************
+*/
+
+#if (OS_TASK_PERIOD_EN > 0u) && (OS_CFG_DBG_EN > 0u)
+static  void  OS_StatTaskPeriodUpdate (OS_TCB  *p_tcb)
+{
+    CPU_SR_ALLOC();
+
+
+    if (p_tcb->Period == 0u) {                                  /* Skip tasks that are not released periodically        */
+        return;
+    }
+    CPU_CRITICAL_ENTER();
+    if (p_tcb->PeriodOvrCtr != p_tcb->PeriodOvrCtrStat) {
+        OSStatTaskPeriodOvrCtr  += (OS_CTR)(p_tcb->PeriodOvrCtr - p_tcb->PeriodOvrCtrStat);
+        p_tcb->PeriodOvrCtrStat  =  p_tcb->PeriodOvrCtr;
+    }
+    if (OSStatTaskPeriodJitterMax < p_tcb->PeriodJitterMax) {
+        OSStatTaskPeriodJitterMax = p_tcb->PeriodJitterMax;
+    }
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
+/*
+************************************************************************************************************************
+*                                            UPDATE THE STATISTICS SNAPSHOT
+*
+* Description: This function copies the statistics computed by the statistic task, and the state and queue depth of
+*              the tasks and message queues, into OSStatSnap.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Only the statistic task writes OSStatSnap, so 'SeqCtr' needs no lock.  Each object is copied with
+*                 interrupts disabled, but the snapshot as a whole is not taken atomically: it never holds a torn
+*                 object, but two objects may have been copied a few instructions apart.
+*
+*              3) The snapshot is cleaned from the data cache, if any, so that a probe reading memory sees it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_STAT_SNAP_EN > 0u)
+static  void  OS_StatSnapUpdate (void)
+{
+    OS_STAT_SNAP_TASK  volatile  *p_snap_task;
+    OS_TCB                       *p_tcb;
+    OS_OBJ_QTY                    nbr;
+#if (OS_CFG_Q_EN > 0u)
+    OS_STAT_SNAP_Q     volatile  *p_snap_q;
+    OS_Q                         *p_q;
+#endif
+    CPU_SR_ALLOC();
+
+
+    OSStatSnap.SeqCtr++;                                        /* Odd: the snapshot is being written                   */
+#if (OS_CFG_TICK_EN > 0u)
+    OSStatSnap.TickCtr     = OSTickCtr;
+#endif
+    OSStatSnap.CPUUsage    = OSStatTaskCPUUsage;
+    OSStatSnap.CPUUsageMax = OSStatTaskCPUUsageMax;
+#if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u) && (OS_CFG_ISR_STK_SIZE > 0u)
+    OSStatSnap.ISRStkFree  = OSISRStkFree;
+#endif
+
+    nbr = 0u;                                                   /* ---------------------- TASKS ----------------------- */
+    CPU_CRITICAL_ENTER();
+    OSStatSnap.TaskQty = OSTaskQty;
+    p_tcb              = OSTaskDbgListPtr;
+    CPU_CRITICAL_EXIT();
+    while ((p_tcb != (OS_TCB *)0) &&
+           (nbr   <  OS_CFG_STAT_SNAP_TASK_NBR)) {
+        p_snap_task = &OSStatSnap.TaskTbl[nbr];
+        CPU_CRITICAL_ENTER();                                   /* See Note #2                                          */
+        p_snap_task->TCBPtr            = p_tcb;
+        p_snap_task->NamePtr           = p_tcb->NamePtr;
+        p_snap_task->Prio              = p_tcb->Prio;
+        p_snap_task->TaskState         = p_tcb->TaskState;
+        p_snap_task->PendOn            = p_tcb->PendOn;
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+        p_snap_task->CPUUsage          = p_tcb->CPUUsage;
+        p_snap_task->CPUUsageMax       = p_tcb->CPUUsageMax;
+        p_snap_task->CtxSwCtr          = p_tcb->CtxSwCtr;
+#endif
+#if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u)
+        p_snap_task->StkFree           = p_tcb->StkFree;
+        p_snap_task->StkUsed           = p_tcb->StkUsed;
+#endif
+#if (OS_CFG_TASK_Q_EN > 0u)
+        p_snap_task->MsgQNbrEntries    = p_tcb->MsgQ.NbrEntries;
+        p_snap_task->MsgQNbrEntriesMax = p_tcb->MsgQ.NbrEntriesMax;
+#endif
+        p_tcb = p_tcb->DbgNextPtr;
+        CPU_CRITICAL_EXIT();
+        nbr++;
+    }
+    OSStatSnap.TaskNbr = nbr;
+
+#if (OS_CFG_Q_EN > 0u)
+    nbr = 0u;                                                   /* ---------------------- QUEUES ---------------------- */
+    CPU_CRITICAL_ENTER();
+    OSStatSnap.QQty = OSQQty;
+    p_q             = OSQDbgListPtr;
+    CPU_CRITICAL_EXIT();
+    while ((p_q != (OS_Q *)0) &&
+           (nbr <  OS_CFG_STAT_SNAP_Q_NBR)) {
+        p_snap_q = &OSStatSnap.QTbl[nbr];
+        CPU_CRITICAL_ENTER();
+        p_snap_q->QPtr           = p_q;
+        p_snap_q->NamePtr        = p_q->NamePtr;
+        p_snap_q->NbrEntriesSize = p_q->MsgQ.NbrEntriesSize;
+        p_snap_q->NbrEntries     = p_q->MsgQ.NbrEntries;
+        p_snap_q->NbrEntriesMax  = p_q->MsgQ.NbrEntriesMax;
+        p_q = p_q->DbgNextPtr;
+        CPU_CRITICAL_EXIT();
+        nbr++;
+    }
+    OSStatSnap.QNbr = nbr;
+#endif
+
+    OSStatSnap.SeqCtr++;                                        /* Even: the snapshot is consistent                     */
+                                                                /* See Note #3                                          */
+    OS_CPU_DCACHE_CLEAN((void *)&OSStatSnap, sizeof(OS_STAT_SNAP));
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                           CYCLES USED BY A PERIODIC TASK
+*
+* Description: This function returns the number of OS_TS_GET() counts a task has used since its '.CyclesTotal' was
+*              last cleared, including the part of the current time slice that the context switch hook has not
+*              credited yet if the task is running.
+*
+* Arguments  : p_tcb    is a pointer to the TCB of the task
+*
+* Returns    : The number of cycles.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is called with interrupts disabled.  OSTaskPeriodWait() takes the difference between
+*                 two calls as the execution time of a job.  The statistic task subtracts from '.SchedJobStart' what it
+*                 clears from '.CyclesTotal', so that the difference stays valid across runs of the statistic task.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_STAT_SCHED_EN > 0u)
+OS_CYCLES  OS_StatSchedCyclesGet (OS_TCB  *p_tcb)
+{
+    OS_CYCLES  cycles;
+
+
+    cycles = p_tcb->CyclesTotal;
+    if (p_tcb == OSTCBCurPtr) {                                 /* The current slice is credited at the next switch     */
+        cycles += (OS_CYCLES)(OS_TS_GET() - p_tcb->CyclesStart);
+    }
+    return (cycles);
+}
+
+
+/*
+************************************************************************************************************************
+*                                           CHECK THE SCHEDULABILITY OF THE TASKS
+*
+* Description: This function is called by the statistic task on every run.  It computes the worst-case response time
+*              of each periodic task from the longest execution time measured for it and for the periodic tasks that
+*              can preempt it:
+*
+*                                            --     |  R(n)  |
+*                 R(n+1) = WCET(i)    +     \       | ------ | * WCET(j)             R(0) = WCET(i)
+*                                           /       |  T(j)  |
+*                                            --
+*                                      j != i, prio(j) <= prio(i)
+*
+*              A task is schedulable if R converges to a value no longer than its period T(i), which is also its
+*              deadline.  The result is stored in '.SchedResp', the sum of WCET/T of all the periodic tasks in
+*              OSStatSchedUtil (0..10000 for 0..100%, more when overloaded) and the first task found unschedulable in
+*              OSStatSchedFailTCBPtr.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Tasks at the same priority are counted as preempting each other, which holds whether they share the
+*                 CPU by round robin or by earliest deadline.  Tasks that are not periodic are not part of the
+*                 analysis, nor is the time spent in ISRs or blocked on resources: the result holds for the periodic
+*                 load only.
+*
+*              3) A task for which R has not converged after OS_CFG_STAT_SCHED_ITER_MAX iterations is reported as
+*                 unschedulable.
+*
+*              4) OS_AppStatSchedHookPtr, if set, is called with the TCB of the failing task, from the statistic task,
+*                 when the task set goes from schedulable to unschedulable.
+*
+*              5) Nothing is checked while the frequency of the timestamp timer is unknown (CPU_TS_TmrFreqGet()
+*                 fails).
+************************************************************************************************************************
+*/
+
+static  void  OS_StatSchedChk (void)
+{
+    OS_TCB           *p_tcb;
+    OS_TCB           *p_tcb_hp;
+    OS_TCB           *p_tcb_fail;
+    CPU_INT64U        period;
+    CPU_INT64U        period_hp;
+    CPU_INT64U        resp;
+    CPU_INT64U        resp_prev;
+    CPU_INT64U        util;
+    CPU_INT32U        iter;
+    CPU_TS_TMR_FREQ   freq;
+    CPU_ERR           err;
+    CPU_SR_ALLOC();
+
+
+    freq = CPU_TS_TmrFreqGet(&err);
+    if ((err  != CPU_ERR_NONE) ||                               /* See Note #5                                          */
+        (freq == 0u)) {
+        return;
+    }
+
+    util       = 0u;
+    p_tcb_fail = (OS_TCB *)0;
+    CPU_CRITICAL_ENTER();
+    p_tcb = OSTaskDbgListPtr;
+    CPU_CRITICAL_EXIT();
+    while (p_tcb != (OS_TCB *)0) {
+        if (p_tcb->Period > 0u) {                               /* Only periodic tasks are analysed                     */
+            period  = ((CPU_INT64U)p_tcb->Period * freq) / OSCfg_TickRate_Hz;
+            if (period == 0u) {
+                period = 1u;
+            }
+            util   += ((CPU_INT64U)p_tcb->SchedWCET * 10000u) / period;
+
+            resp    = p_tcb->SchedWCET;
+            iter    = 0u;
+            do {                                                /* Iterate the response time until it settles           */
+                resp_prev = resp;
+                resp      = p_tcb->SchedWCET;
+                CPU_CRITICAL_ENTER();
+                p_tcb_hp  = OSTaskDbgListPtr;
+                CPU_CRITICAL_EXIT();
+                while (p_tcb_hp != (OS_TCB *)0) {
+                    if ((p_tcb_hp           != p_tcb) &&        /* See Note #2                                          */
+                        (p_tcb_hp->Period   >  0u) &&
+                        (p_tcb_hp->BasePrio <= p_tcb->BasePrio)) {
+                        period_hp = ((CPU_INT64U)p_tcb_hp->Period * freq) / OSCfg_TickRate_Hz;
+                        if (period_hp == 0u) {
+                            period_hp = 1u;
+                        }
+                        resp += ((resp_prev + period_hp - 1u) / period_hp) * p_tcb_hp->SchedWCET;
+                    }
+                    CPU_CRITICAL_ENTER();
+                    p_tcb_hp = p_tcb_hp->DbgNextPtr;
+                    CPU_CRITICAL_EXIT();
+                }
+                iter++;
+            } while ((resp != resp_prev) &&
+                     (resp <= period)    &&
+                     (iter <  OS_CFG_STAT_SCHED_ITER_MAX));
+
+            if (resp > (CPU_INT64U)(OS_CYCLES)~(OS_CYCLES)0u) { /* Saturate the result                                  */
+                resp = (CPU_INT64U)(OS_CYCLES)~(OS_CYCLES)0u;
+            }
+            p_tcb->SchedResp = (OS_CYCLES)resp;
+            if (((resp       >  period) ||                      /* Past the deadline, or not settled (see Note #3)      */
+                 (resp       != resp_prev)) &&
+                (p_tcb_fail  == (OS_TCB *)0)) {
+                p_tcb_fail = p_tcb;
+            }
+        }
+        CPU_CRITICAL_ENTER();
+        p_tcb = p_tcb->DbgNextPtr;
+        CPU_CRITICAL_EXIT();
+    }
+
+    if (util > (CPU_INT64U)(CPU_INT32U)~(CPU_INT32U)0u) {
+        util = (CPU_INT64U)(CPU_INT32U)~(CPU_INT32U)0u;
+    }
+    OSStatSchedUtil = (CPU_INT32U)util;
+
+#if (OS_CFG_APP_HOOKS_EN > 0u)
+    if ((p_tcb_fail             != (OS_TCB        *)0) &&       /* See Note #4                                          */
+        (OSStatSchedFailTCBPtr  == (OS_TCB        *)0) &&
+        (OS_AppStatSchedHookPtr != (OS_APP_HOOK_TCB)0)) {
+        (*OS_AppStatSchedHookPtr)(p_tcb_fail);
+    }
+#endif
+    OSStatSchedFailTCBPtr = p_tcb_fail;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                               CHECK THE ISR STACK
+*
+* Description: This function computes OSISRStkFree and OSISRStkUsed, the number of free and used entries of the ISR
+*              stack.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) With OS_CFG_STAT_TASK_STK_CHK_INCR_EN, the stack is scanned like a task stack by OSTaskStkChk(): at
+*                 most OS_CFG_STAT_TASK_STK_CHK_CHUNK entries per run, only up to the high-water mark of the last
+*                 completed scan since the entries beyond it are known to be used.  OSISRStkFree reports the last
+*                 completed scan.
+*
+*              3) With OS_CFG_ISR_STK_SP_EN, OSIntEnter() records the deepest stack pointer seen on the ISR stack at
+*                 each nesting level.  The entries above it are counted as used even if they hold zeros, so
+*                 OSISRStkUsed is the larger of the two measures.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u) && (OS_CFG_ISR_STK_SIZE > 0u)
+static  void  OS_StatISRStkChk (void)
+{
+    CPU_STK     *p_stk;
+    CPU_INT32U   free_stk;
+#if (OS_CFG_STAT_TASK_STK_CHK_INCR_EN == 0u) || (OS_CFG_ISR_STK_SP_EN > 0u)
+    CPU_INT32U   size_stk;
+#endif
+#if (OS_CFG_STAT_TASK_STK_CHK_INCR_EN > 0u)
+    CPU_INT32U   free_end;
+#endif
+#if (OS_CFG_ISR_STK_SP_EN > 0u)
+    CPU_INT32U   used_sp;
+    CPU_SR_ALLOC();
+#endif
+
+
+#if (CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO)
+    p_stk     = OSCfg_ISRStkBasePtr;                            /* Start at the lowest memory and go up                 */
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+    p_stk    += OS_CFG_TASK_STK_REDZONE_DEPTH;
+#endif
+#else
+    p_stk     = OSCfg_ISRStkBasePtr + OSCfg_ISRStkSize - 1u;    /* Start at the highest memory and go down              */
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+    p_stk    -= OS_CFG_TASK_STK_REDZONE_DEPTH;
+#endif
+#endif
+#if (OS_CFG_STAT_TASK_STK_CHK_INCR_EN == 0u) || (OS_CFG_ISR_STK_SP_EN > 0u)
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+    size_stk  = OSCfg_ISRStkSize - OS_CFG_TASK_STK_REDZONE_DEPTH;
+#else
+    size_stk  = OSCfg_ISRStkSize;
+#endif
+#endif
+
+#if (OS_CFG_STAT_TASK_STK_CHK_INCR_EN > 0u)
+    free_stk = OSISRStkChkIx;                                   /* Resume where the previous run stopped (see Note #2)  */
+    free_end = free_stk + OS_CFG_STAT_TASK_STK_CHK_CHUNK;
+    if ((free_end > OSISRStkChkFree) ||
+        (free_end < free_stk)) {
+        free_end = OSISRStkChkFree;
+    }
+#if (CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO)
+    p_stk += free_stk;
+    while ((free_stk  < free_end) &&
+           (*p_stk   ==       0u)) {
+        p_stk++;
+        free_stk++;
+    }
+#else
+    p_stk -= free_stk;
+    while ((free_stk  < free_end) &&
+           (*p_stk   ==       0u)) {
+        free_stk++;
+        p_stk--;
+    }
+#endif
+    if ((free_stk < free_end) ||                                /* Found a used entry or reached the high-water mark?   */
+        (free_stk == OSISRStkChkFree)) {
+        OSISRStkChkFree = free_stk;                             /* Yes, the scan is complete                            */
+        free_stk        = 0u;
+    }
+    OSISRStkChkIx = free_stk;
+    free_stk      = OSISRStkChkFree;
+#else
+    free_stk = 0u;
+#if (CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO)
+    while ((*p_stk == 0u) && (free_stk < size_stk)) {           /* Compute the number of zero entries on the stk        */
+        p_stk++;
+        free_stk++;
+    }
+#else
+    while ((*p_stk == 0u) && (free_stk < size_stk)) {           /* Compute the number of zero entries on the stk        */
+        free_stk++;
+        p_stk--;
+    }
+#endif
+#endif
+
+#if (OS_CFG_ISR_STK_SP_EN > 0u)
+    CPU_CRITICAL_ENTER();
+    p_stk = OSISRStkSPPtr;                                      /* Deepest SP seen by OSIntEnter() (see Note #3)        */
+    CPU_CRITICAL_EXIT();
+    if (p_stk != (CPU_STK *)0) {
+#if (CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO)
+        used_sp = (CPU_INT32U)((OSCfg_ISRStkBasePtr + OSCfg_ISRStkSize) - p_stk);
+#else
+        used_sp = (CPU_INT32U)((p_stk - OSCfg_ISRStkBasePtr) + 1);
+#endif
+        if (used_sp > size_stk) {
+            used_sp = size_stk;
+        }
+        if (free_stk > (size_stk - used_sp)) {
+            free_stk = size_stk - used_sp;
+        }
+    }
+#endif
+
+    OSISRStkFree = free_stk;
+    OSISRStkUsed = OSCfg_ISRStkSize - free_stk;
+}
+#endif
+
 #endif
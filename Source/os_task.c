@@ -24,6 +24,7 @@
 */
 
 #define  MICRIUM_SOURCE
+#define  OS_CRIT_SITE_ID                    OS_CRIT_SITE_TASK
 #include "os.h"
 
 
@@ -31,6 +32,64 @@
 const  CPU_CHAR  *os_task__c = "$Id: $";
 #endif
 
+
+/*
+************************************************************************************************************************
+*                                                    LOCAL DEFINES
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_BUDGET_EN > 0u)                                /* OSTickCtr reached 'tick' (survives the wrap)         */
+#define  OS_TASK_BUDGET_DUE(tick)      ((OS_TICK)(OSTickCtr - (tick)) <= ((OS_TICK)~(OS_TICK)0u >> 1u))
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+static  void  OS_TaskBudgetExhaust (OS_TCB       *p_tcb);
+
+static  void  OS_TaskBudgetPrioSet (OS_TCB       *p_tcb,
+                                    OS_PRIO       prio_new);
+
+static  void  OS_TaskBudgetRestore (OS_TCB       *p_tcb);
+#endif
+
+#if (OS_CFG_TASK_FAIR_EN > 0u)
+static  void  OS_TaskFairCharge (OS_TCB  *p_tcb,
+                                 CPU_TS   ts);
+#endif
+
+#if (OS_CFG_TASK_HIST_EN > 0u)
+static  void  OS_TaskHistAdd (OS_HIST_CTR  *p_tbl,
+                              CPU_TS        delta);
+#endif
+
+static  OS_SEM_CTR  OS_TaskSemPost (OS_TCB  *p_tcb,
+                                    OS_OPT   opt,
+                                    CPU_TS   ts,
+                                    OS_ERR  *p_err);
+
+#if (OS_CFG_TASK_STK_FIT_EN > 0u)
+static  CPU_STK  *OS_TaskStkFitAlloc (OS_TASK_PTR    p_task,
+                                      CPU_STK_SIZE  *p_stk_limit,
+                                      CPU_STK_SIZE  *p_stk_size,
+                                      OS_ERR        *p_err);
+
+static  void      OS_TaskStkFitFree  (CPU_STK       *p_stk);
+#endif
+
+#if (OS_CFG_TASK_STK_PROFILE_EN > 0u)
+static  CPU_INT32U       OS_TaskStkProfileChksum (OS_STK_PROFILE_TBL  *p_tbl);
+
+static  OS_STK_PROFILE  *OS_TaskStkProfileFind   (OS_TASK_PTR          p_task);
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                CHANGE PRIORITY OF A TASK
@@ -94,6 +153,12 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
        *p_err = OS_ERR_PRIO_INVALID;
         return;
     }
+#if (OS_CFG_PRIO_MAP_EN > 0u)
+    if (OS_PRIO_IX(prio_new) == OS_PRIO_MAP_NONE) {             /* The new priority must be in OSCfg_PrioMapTbl[]       */
+       *p_err = OS_ERR_PRIO_INVALID;
+        return;
+    }
+#endif
 
     CPU_CRITICAL_ENTER();
 
@@ -106,10 +171,17 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
         p_tcb = OSTCBCurPtr;
     }
 
-#if (OS_CFG_MUTEX_EN > 0u)
+#if (OS_CFG_MUTEX_EN > 0u) || (OS_CFG_CALL_EN > 0u)
     p_tcb->BasePrio = prio_new;                                 /* Update base priority                                 */
+#endif
 
+#if (OS_CFG_MUTEX_EN > 0u)
+#if (OS_CFG_RWLOCK_EN > 0u)
+    if ((p_tcb->MutexGrpHeadPtr != (OS_MUTEX *)0) ||            /* Owning a mutex or a reader/writer lock?              */
+        (p_tcb->RwLockHoldCtr   >              0u)) {
+#else
     if (p_tcb->MutexGrpHeadPtr != (OS_MUTEX *)0) {              /* Owning a mutex?                                      */
+#endif
         if (prio_new > p_tcb->Prio) {
             prio_high = OS_MutexGrpPrioFindHighest(p_tcb);
             if (prio_new > prio_high) {
@@ -119,6 +191,12 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
     }
 #endif
 
+#if (OS_CFG_CALL_EN > 0u)
+    if (p_tcb->CallClientPtr != (OS_TCB *)0) {                  /* Serving a call?                                      */
+        prio_new = OS_CallSrvPrioGet(p_tcb);                    /* Yes, keep the priority lent by the client            */
+    }
+#endif
+
     OS_TaskChangePrio(p_tcb, prio_new);
 
     OS_TRACE_TASK_PRIO_CHANGE(p_tcb, prio_new);
@@ -176,7 +254,7 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
 *              q_size         is the maximum number of messages that can be sent to the task
 *
 *              time_quanta    amount of time (in ticks) for time slice when round-robin between tasks.  Specify 0 to use
-*                             the default.
+*                             the default.  The time is in microseconds when OS_CFG_SCHED_ROUND_ROBIN_TS_EN is enabled.
 *
 *              p_ext          is a pointer to a user supplied memory location which is used as a TCB extension.
 *                             For example, this user memory can hold the contents of floating-point registers
@@ -189,11 +267,15 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
 *                                 OS_OPT_TASK_NONE            No option selected
 *                                 OS_OPT_TASK_STK_CHK         Stack checking to be allowed for the task
 *                                 OS_OPT_TASK_STK_CLR         Clear the stack when the task is created
+*                                 OS_OPT_TASK_STK_CLR_DEFER   With OS_OPT_TASK_STK_CLR, let the idle task clear the
+*                                                             stack (see Note #2)
 *                                 OS_OPT_TASK_SAVE_FP         If the CPU has floating-point registers, save them
 *                                                             during a context switch.
 *                                 OS_OPT_TASK_NO_TLS          If the caller doesn't want or need TLS (Thread Local
 *                                                             Storage) support for the task.  If you do not include this
 *                                                             option, TLS will be supported by default.
+*                                 OS_OPT_TASK_STK_FIT         With a NULL 'p_stk_base', allocate the stack from the
+*                                                             heap given to OSTaskStkFitHeapSet() (see Note #3)
 *
 *              p_err          is a pointer to an error code that will be set during this call.  The value pointer
 *                             to by 'p_err' can be:
@@ -201,10 +283,13 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
 *                                 OS_ERR_NONE                    If the function was successful
 *                                 OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the task after you called
 *                                                                   OSSafetyCriticalStart()
+*                                 OS_ERR_MEM_NO_FREE_BLKS        If the heap has no room for the stack (see Note #3)
 *                                 OS_ERR_PRIO_INVALID            If the priority you specify is higher that the maximum
 *                                                                   allowed (i.e. >= OS_CFG_PRIO_MAX-1) or,
 *                                 OS_ERR_STK_OVF                 If the stack was overflowed during stack init
 *                                 OS_ERR_STK_INVALID             If you specified a NULL pointer for 'p_stk_base'
+*                                                                   without OS_OPT_TASK_STK_FIT, or no heap was given to
+*                                                                   OSTaskStkFitHeapSet()
 *                                 OS_ERR_STK_SIZE_INVALID        If you specified zero for the 'stk_size'
 *                                 OS_ERR_STK_LIMIT_INVALID       If you specified a 'stk_limit' greater than or equal
 *                                                                   to 'stk_size'
@@ -217,6 +302,18 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
 * Note(s)    : 1) OSTaskCreate() will return with the error OS_ERR_STK_OVF when a stack overflow is detected
 *                 during stack initialization. In that specific case some memory may have been corrupted. It is
 *                 therefore recommended to treat OS_ERR_STK_OVF as a fatal error.
+*
+*              2) When OS_CFG_TASK_STK_CLR_DEFER_EN is enabled, OS_OPT_TASK_STK_CLR | OS_OPT_TASK_STK_CLR_DEFER leaves
+*                 the stack as is and lets the idle task clear it, OS_CFG_TASK_STK_CLR_CHUNK elements at a time.  The
+*                 idle task only clears the part of the stack past the task's saved stack pointer, so the stack
+*                 usage seen by OSTaskStkChk() starts from the end of the clear.  Until then, OSTaskStkChk() returns
+*                 OS_ERR_TASK_STK_CLR_PEND.
+*
+*              3) When OS_CFG_TASK_STK_FIT_EN is enabled, OS_OPT_TASK_STK_FIT with a NULL 'p_stk_base' has the stack
+*                 allocated from the heap given to OSTaskStkFitHeapSet().  If the stack profile table has an entry for
+*                 'p_task' (see OSTaskStkProfileInit()), the stack is cut down to the recommended size when that is
+*                 smaller than 'stk_size', and 'stk_limit' is scaled by the same ratio.  The stack is given back to
+*                 the heap by OSTaskDel().
 ************************************************************************************************************************
 */
 
@@ -234,7 +331,6 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
                     OS_OPT         opt,
                     OS_ERR        *p_err)
 {
-    CPU_STK_SIZE   i;
 #if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
     OS_REG_ID      reg_nbr;
 #endif
@@ -281,7 +377,12 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
        *p_err = OS_ERR_TASK_INVALID;
         return;
     }
+#if (OS_CFG_TASK_STK_FIT_EN > 0u)
+    if ((p_stk_base == (CPU_STK *)0) &&                         /* User must supply a valid stack base address ...      */
+        ((opt & OS_OPT_TASK_STK_FIT) == 0u)) {                  /* ... unless the stack is allocated (see Note #3)      */
+#else
     if (p_stk_base == (CPU_STK *)0) {                           /* User must supply a valid stack base address          */
+#endif
         OS_TRACE_TASK_CREATE_FAILED(p_tcb);
        *p_err = OS_ERR_STK_INVALID;
         return;
@@ -302,6 +403,13 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
        *p_err = OS_ERR_PRIO_INVALID;
         return;
     }
+#if (OS_CFG_PRIO_MAP_EN > 0u)
+    if (OS_PRIO_IX(prio) == OS_PRIO_MAP_NONE) {                 /* Priority must be in OSCfg_PrioMapTbl[]               */
+        OS_TRACE_TASK_CREATE_FAILED(p_tcb);
+       *p_err = OS_ERR_PRIO_INVALID;
+        return;
+    }
+#endif
 #endif
 
     if (prio == (OS_CFG_PRIO_MAX - 1u)) {
@@ -319,17 +427,34 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
     }
 
     OS_TaskInitTCB(p_tcb);                                      /* Initialize the TCB to default values                 */
+#if (OS_CFG_TASK_POOL_EN > 0u)
+    p_tcb->PoolPtr = (OS_TASK_POOL *)0;                         /* OSTaskPoolRun() sets it for the tasks it runs        */
+#endif
+
+#if (OS_CFG_TASK_STK_FIT_EN > 0u)
+    if ((p_stk_base == (CPU_STK *)0) &&                         /* Allocate the stack (see Note #3)                     */
+        ((opt & OS_OPT_TASK_STK_FIT) != 0u)) {
+        p_stk_base = OS_TaskStkFitAlloc(p_task, &stk_limit, &stk_size, p_err);
+        if (*p_err != OS_ERR_NONE) {
+            OS_TRACE_TASK_CREATE_FAILED(p_tcb);
+            return;
+        }
+        p_tcb->StkFitPtr = p_stk_base;
+    }
+#endif
 
    *p_err = OS_ERR_NONE;
                                                                 /* -------------- CLEAR THE TASK'S STACK -------------- */
     if (((opt & OS_OPT_TASK_STK_CHK) != 0u) ||                  /* See if stack checking has been enabled               */
         ((opt & OS_OPT_TASK_STK_CLR) != 0u)) {                  /* See if stack needs to be cleared                     */
         if ((opt & OS_OPT_TASK_STK_CLR) != 0u) {
-            p_sp = p_stk_base;
-            for (i = 0u; i < stk_size; i++) {                   /* Stack grows from HIGH to LOW memory                  */
-               *p_sp = 0u;                                      /* Clear from bottom of stack and up!                   */
-                p_sp++;
+#if (OS_CFG_TASK_STK_CLR_DEFER_EN > 0u)
+            if ((opt & OS_OPT_TASK_STK_CLR_DEFER) == 0u) {      /* The idle task clears it later (see Note #2)          */
+                OS_CPU_STK_CLR(p_stk_base, stk_size);
             }
+#else
+            OS_CPU_STK_CLR(p_stk_base, stk_size);               /* Port may provide a faster fill                       */
+#endif
         }
     }
                                                                 /* ------ INITIALIZE THE STACK FRAME OF THE TASK ------ */
@@ -349,14 +474,19 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
 #if (CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO)             /* Check if we overflown the stack during init          */
     if (p_sp < p_stk_base) {
        *p_err = OS_ERR_STK_OVF;
-        return;
     }
 #else
     if (p_sp > (p_stk_base + stk_size)) {
        *p_err = OS_ERR_STK_OVF;
-        return;
     }
 #endif
+    if (*p_err == OS_ERR_STK_OVF) {
+#if (OS_CFG_TASK_STK_FIT_EN > 0u)
+        OS_TaskStkFitFree(p_tcb->StkFitPtr);
+        p_tcb->StkFitPtr = (CPU_STK *)0;
+#endif
+        return;
+    }
 
 #if (OS_CFG_TASK_STK_REDZONE_EN > 0u)                           /* Initialize Redzoned stack                            */
     OS_TaskStkRedzoneInit(p_stk_base, stk_size);
@@ -398,6 +528,10 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
 #if ((OS_CFG_DBG_EN > 0u) || (OS_CFG_STAT_TASK_STK_CHK_EN > 0u) || (OS_CFG_TASK_STK_REDZONE_EN > 0u))
     p_tcb->StkBasePtr    = p_stk_base;                          /* Save pointer to the base address of the stack        */
     p_tcb->StkSize       = stk_size;                            /* Save the stack size (in number of CPU_STK elements)  */
+#endif
+#if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u) && (OS_CFG_STAT_TASK_STK_CHK_INCR_EN > 0u)
+    p_tcb->StkChkFree    = stk_size;                            /* No stack usage has been observed yet                 */
+    p_tcb->StkChkIx      = 0u;
 #endif
     p_tcb->Opt           = opt;                                 /* Save task options                                    */
 
@@ -430,6 +564,23 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
 #endif
                                                                 /* -------------- ADD TASK TO READY LIST -------------- */
     CPU_CRITICAL_ENTER();
+#if (OS_CFG_TASK_STK_CLR_DEFER_EN > 0u)
+    if ((opt & (OS_OPT_TASK_STK_CLR | OS_OPT_TASK_STK_CLR_DEFER)) == (OS_OPT_TASK_STK_CLR | OS_OPT_TASK_STK_CLR_DEFER)) {
+#if (CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO)
+        p_tcb->StkClrPtr     = p_stk_base;                      /* Clear from the bottom of the stack up                */
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+        p_tcb->StkClrPtr    += OS_CFG_TASK_STK_REDZONE_DEPTH;   /* ... leaving the red-zone pattern alone               */
+#endif
+#else
+        p_tcb->StkClrPtr     = p_stk_base + stk_size - 1u;      /* Clear from the top of the stack down                 */
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+        p_tcb->StkClrPtr    -= OS_CFG_TASK_STK_REDZONE_DEPTH;
+#endif
+#endif
+        p_tcb->StkClrNextPtr = OSTaskStkClrListPtr;             /* Hand the stack over to the idle task                 */
+        OSTaskStkClrListPtr  = p_tcb;
+    }
+#endif
     OS_PrioInsert(p_tcb->Prio);
     OS_RdyListInsertTail(p_tcb);
 
@@ -450,6 +601,110 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
 }
 
 
+/*
+************************************************************************************************************************
+*                                               CREATE A TABLE OF TASKS
+*
+* Description: This function creates every task described by a configuration table, in table order.  It lets the
+*              application describe its tasks once, in a 'const' table, instead of calling OSTaskCreate() once per task.
+*
+* Arguments  : p_cfg_tbl      is a pointer to the table of task configurations (see OS_TASK_CFG).  Each entry holds the
+*                             arguments of one call to OSTaskCreate().
+*
+*              nbr_tasks      is the number of entries in 'p_cfg_tbl'.
+*
+*              p_err          is a pointer to an error code that will be set during this call.  The value pointer
+*                             to by 'p_err' can be:
+*
+*                                 OS_ERR_NONE                    If all the tasks were created
+*                                 OS_ERR_PTR_INVALID             If you specified a NULL pointer for 'p_cfg_tbl'
+*                                 OS_ERR_TASK_CREATE_ISR         If you tried to create the tasks from an ISR
+*
+*                             or any error returned by OSTaskCreate() for the first entry that could not be created.
+*
+* Returns    : none
+*
+* Note(s)    : 1) Creation stops at the first entry that fails.  The tasks of the previous entries are left created.
+*
+*              2) When multitasking has started, the scheduler is locked while the table is processed so that none of
+*                 the new tasks runs before the last one is created.  The scheduler runs once, at the end.
+*
+*              3) Stacks placed in zero-initialized memory (i.e. .bss) are already cleared by the C startup code.  For
+*                 those, OS_OPT_TASK_STK_CLR can be left out of 'Opt', even with OS_OPT_TASK_STK_CHK, which removes the
+*                 stack fill loop from the creation of the task.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_CREATE_TBL_EN > 0u)
+void  OSTaskCreateTbl (const  OS_TASK_CFG  *p_cfg_tbl,
+                       OS_OBJ_QTY           nbr_tasks,
+                       OS_ERR              *p_err)
+{
+    const  OS_TASK_CFG  *p_cfg;
+    OS_OBJ_QTY           i;
+    OS_ERR               err;
+    CPU_BOOLEAN          sched_locked;
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* --------- CANNOT CREATE A TASK FROM AN ISR --------- */
+       *p_err = OS_ERR_TASK_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_cfg_tbl == (const OS_TASK_CFG *)0) {                  /* User must supply a valid table                       */
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+#endif
+
+    sched_locked = OS_FALSE;
+    if (OSRunning == OS_STATE_OS_RUNNING) {                     /* Start the new tasks together (see Note #2)           */
+        OSSchedLock(&err);
+        if (err == OS_ERR_NONE) {
+            sched_locked = OS_TRUE;
+        }
+    }
+
+   *p_err = OS_ERR_NONE;
+    p_cfg = p_cfg_tbl;
+    for (i = 0u; i < nbr_tasks; i++) {
+        OSTaskCreate(p_cfg->TCBPtr,
+                     p_cfg->NamePtr,
+                     p_cfg->TaskPtr,
+                     p_cfg->ArgPtr,
+                     p_cfg->Prio,
+                     p_cfg->StkBasePtr,
+                     p_cfg->StkLimit,
+                     p_cfg->StkSize,
+                     p_cfg->QSize,
+                     p_cfg->TimeQuanta,
+                     p_cfg->ExtPtr,
+                     p_cfg->Opt,
+                     p_err);
+        if (*p_err != OS_ERR_NONE) {                            /* Stop at the first failure (see Note #1)              */
+            break;
+        }
+        p_cfg++;
+    }
+
+    if (sched_locked == OS_TRUE) {
+        OSSchedUnlock(&err);                                    /* Run the scheduler once for all the new tasks         */
+    }
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                     DELETE A TASK
@@ -476,6 +731,10 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
 * Note(s)    : 1) 'p_err' gets set to OS_ERR_NONE before OSSched() to allow the returned err or code to be monitored even
 *                 for a task that is deleting itself. In this case, 'p_err' MUST point to a global variable that can be
 *                 accessed by another task.
+*
+*              2) A task that deletes itself still runs on its stack until OSSched() switches to another task.  A stack
+*                 allocated with OS_OPT_TASK_STK_FIT is then kept aside and given back to the heap by the next call to
+*                 OSTaskCreate() or OSTaskDel(), since the heap may also be used by ISRs.
 ************************************************************************************************************************
 */
 
@@ -486,6 +745,9 @@ void  OSTaskDel (OS_TCB  *p_tcb,
 #if (OS_CFG_MUTEX_EN > 0u)
     OS_TCB   *p_tcb_owner;
     OS_PRIO   prio_new;
+#endif
+#if (OS_CFG_RWLOCK_EN > 0u)
+    OS_RWLOCK *p_rwlock;
 #endif
     CPU_SR_ALLOC();
 
@@ -553,35 +815,74 @@ void  OSTaskDel (OS_TCB  *p_tcb,
         case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
              switch (p_tcb->PendOn) {                           /* See what we are pending on                           */
                  case OS_TASK_PEND_ON_NOTHING:
-                 case OS_TASK_PEND_ON_TASK_Q:                   /* There is no wait list for these two                  */
+                 case OS_TASK_PEND_ON_TASK_Q:                   /* There is no wait list for these                      */
                  case OS_TASK_PEND_ON_TASK_SEM:
+                 case OS_TASK_PEND_ON_CALL_REPLY:
+#if (OS_CFG_TASK_NOTIFY_EN > 0u)
+                 case OS_TASK_PEND_ON_TASK_NOTIFY:
+#endif
                       break;
 
                  case OS_TASK_PEND_ON_FLAG:                     /* Remove from pend list                                */
+                 case OS_TASK_PEND_ON_MBOX:
+                 case OS_TASK_PEND_ON_MEM:
                  case OS_TASK_PEND_ON_Q:
+                 case OS_TASK_PEND_ON_Q_SPACE:
+                 case OS_TASK_PEND_ON_RING_DATA:
+                 case OS_TASK_PEND_ON_RING_SPACE:
+                 case OS_TASK_PEND_ON_PIPE_DATA:
+                 case OS_TASK_PEND_ON_PIPE_SPACE:
                  case OS_TASK_PEND_ON_SEM:
+                 case OS_TASK_PEND_ON_SEQLOCK:
+                 case OS_TASK_PEND_ON_RCU:
+                 case OS_TASK_PEND_ON_CALL:
+                 case OS_TASK_PEND_ON_CALL_RECV:
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+                 case OS_TASK_PEND_ON_MULTI:
+#endif
+#if (OS_CFG_SIGNAL_EN > 0u)
+                 case OS_TASK_PEND_ON_SIGNAL:
+#endif
+#if (OS_CFG_COMPLETION_EN > 0u)
+                 case OS_TASK_PEND_ON_COMPLETION:
+#endif
+#if (OS_CFG_REACTOR_EN > 0u)
+                 case OS_TASK_PEND_ON_REACTOR:
+#endif
                       OS_PendListRemove(p_tcb);
                       break;
 
 #if (OS_CFG_MUTEX_EN > 0u)
                  case OS_TASK_PEND_ON_MUTEX:
                       p_tcb_owner = ((OS_MUTEX *)((void *)p_tcb->PendObjPtr))->OwnerTCBPtr;
-                      prio_new = p_tcb_owner->Prio;
                       OS_PendListRemove(p_tcb);
-                      if ((p_tcb_owner->Prio != p_tcb_owner->BasePrio) &&
-                          (p_tcb_owner->Prio == p_tcb->Prio)) { /* Has the owner inherited a priority?                  */
-                          prio_new = OS_MutexGrpPrioFindHighest(p_tcb_owner);
-                          prio_new = (prio_new > p_tcb_owner->BasePrio) ? p_tcb_owner->BasePrio : prio_new;
-                      }
                       p_tcb->PendOn = OS_TASK_PEND_ON_NOTHING;
+                      if (p_tcb_owner != (OS_TCB *)0) {         /* A mutex in throughput mode may have no owner         */
+                          prio_new = p_tcb_owner->Prio;
+                          if ((p_tcb_owner->Prio != p_tcb_owner->BasePrio) &&
+                              (p_tcb_owner->Prio == p_tcb->Prio)) { /* Has the owner inherited a priority?              */
+                              prio_new = OS_MutexGrpPrioFindHighest(p_tcb_owner);
+                              prio_new = (prio_new > p_tcb_owner->BasePrio) ? p_tcb_owner->BasePrio : prio_new;
+                          }
 
-                      if (prio_new != p_tcb_owner->Prio) {
-                          OS_TaskChangePrio(p_tcb_owner, prio_new);
-                          OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb_owner, p_tcb_owner->Prio);
+                          if (prio_new != p_tcb_owner->Prio) {
+                              OS_TaskChangePrio(p_tcb_owner, prio_new);
+                              OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb_owner, p_tcb_owner->Prio);
+                          }
                       }
                       break;
 #endif
 
+#if (OS_CFG_RWLOCK_EN > 0u)
+                 case OS_TASK_PEND_ON_RWLOCK_RD:
+                 case OS_TASK_PEND_ON_RWLOCK_WR:
+                      p_rwlock = (OS_RWLOCK *)((void *)p_tcb->PendObjPtr);
+                      OS_PendListRemove(p_tcb);
+                      p_tcb->PendOn = OS_TASK_PEND_ON_NOTHING;
+                      OS_RwLockPrioUpdate(p_rwlock);            /* The owners may lose the priority of the task         */
+                      break;
+#endif
+
                  default:
                                                                 /* Default case.                                        */
                       break;
@@ -606,6 +907,19 @@ void  OSTaskDel (OS_TCB  *p_tcb,
     }
 #endif
 
+#if (OS_CFG_RWLOCK_EN > 0u)
+    if (p_tcb->RwLockHoldCtr > 0u) {                            /* Release the reader/writer locks held by the task     */
+        OS_RwLockPostAll(p_tcb);
+    }
+#endif
+
+#if (OS_CFG_CALL_EN > 0u)
+    if ((p_tcb->CallClientPtr != (OS_TCB *)0) ||                /* Serving a call or waiting for a reply?               */
+        (p_tcb->CallSrvPtr    != (OS_TCB *)0)) {
+        OS_CallTaskDel(p_tcb);
+    }
+#endif
+
 #if (OS_CFG_TASK_Q_EN > 0u)
     (void)OS_MsgQFreeAll(&p_tcb->MsgQ);                         /* Free task's message queue messages                   */
 #endif
@@ -616,10 +930,64 @@ void  OSTaskDel (OS_TCB  *p_tcb,
     OS_TLS_TaskDel(p_tcb);                                      /* Call TLS hook                                        */
 #endif
 
+#if (OS_CFG_HEAP_EN > 0u)
+    if (p_tcb->HeapBlkListPtr != (OS_HEAP_BLK *)0) {            /* Free the heap blocks the task still owns             */
+        OS_HeapTaskDel(p_tcb);
+    }
+#endif
+
+#if (OS_CFG_MEM_QUOTA_EN > 0u)
+    if (p_tcb->MemQuotaListPtr != (OS_MEM_QUOTA *)0) {          /* Detach the task from its memory quotas               */
+        OS_MemQuotaTaskDel(p_tcb);
+    }
+#endif
+
+#if (OS_CFG_TASK_STK_FIT_EN > 0u)
+    if (p_tcb->StkFitPtr != (CPU_STK *)0) {                     /* Give the stack allocated by OSTaskCreate() back      */
+        if (p_tcb == OSTCBCurPtr) {                             /* See Note #2                                          */
+            OS_TaskStkFitFree((CPU_STK *)0);
+            OSTaskStkFitZombiePtr = p_tcb->StkFitPtr;
+        } else {
+            OS_TaskStkFitFree(p_tcb->StkFitPtr);
+        }
+        p_tcb->StkFitPtr = (CPU_STK *)0;
+    }
+#endif
+
 #if (OS_CFG_DBG_EN > 0u)
     OS_TaskDbgListRemove(p_tcb);
 #endif
 
+#if (OS_CFG_TASK_STK_CLR_DEFER_EN > 0u)
+    if (p_tcb->StkClrPtr != (CPU_STK *)0) {                     /* Stop clearing the stack of the task                  */
+        OS_TaskStkClrRemove(p_tcb);
+    }
+#endif
+
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+    if (p_tcb->BudgetCycles > 0u) {                             /* Drop the CPU budget of the task                      */
+        OS_TaskBudgetRemove(p_tcb);
+    }
+#endif
+
+#if (OS_CFG_TASK_GRP_EN > 0u)
+    if (p_tcb->GrpPtr != (OS_TASK_GRP *)0) {                    /* Leave the task group                                 */
+        OS_TaskGrpRemove(p_tcb);
+    }
+#endif
+
+#if (OS_CFG_TASK_POOL_EN > 0u)
+    if (p_tcb->PoolPtr != (OS_TASK_POOL *)0) {                  /* Give the slot back to its task pool                  */
+        OS_TaskPoolSlotFree(p_tcb);
+    }
+#endif
+
+#if (OS_CFG_TASK_STK_GRP_EN > 0u)
+    if (p_tcb->StkGrpPtr != (OS_TASK_STK_GRP *)0) {             /* Leave the task stack group                           */
+        OS_TaskStkGrpRemove(p_tcb);
+    }
+#endif
+
     OSTaskQty--;                                                /* One less task being managed                          */
 
     OS_TRACE_TASK_DEL(p_tcb);
@@ -639,685 +1007,1043 @@ void  OSTaskDel (OS_TCB  *p_tcb,
 
 /*
 ************************************************************************************************************************
-*                                                    FLUSH TASK's QUEUE
+*                                              GET THE LATENCY HISTOGRAMS OF A TASK
 *
-* Description: This function is used to flush the task's internal message queue.
+* Description: This function copies the wake to run latency and pend duration histograms of a task, along with the
+*              longest and total wake to run latency, and optionally clears them.
 *
-* Arguments  : p_tcb       is a pointer to the task's OS_TCB.  Specifying a NULL pointer indicates that you wish to
-*                          flush the message queue of the calling task.
+* Arguments  : p_tcb     is a pointer to the TCB of the task.  A NULL pointer specifies the current task.
 *
-*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*              p_hist    is a pointer to where the histograms will be copied
 *
-*                              OS_ERR_NONE              Upon success
-*                              OS_ERR_FLUSH_ISR         If you called this function from an ISR
-*                              OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*              opt       determines whether the histograms are cleared after being copied:
 *
-* Returns     : The number of entries freed from the queue
+*                            OS_OPT_TASK_HIST_NONE     Only copy the histograms
+*                            OS_OPT_TASK_HIST_RESET    Copy, then clear the histograms
 *
-* Note(s)     : 1) You should use this function with great care because, when to flush the queue, you LOOSE the
-*                  references to what the queue entries are pointing to and thus, you could cause 'memory leaks'.  In
-*                  other words, the data you are pointing to that's being referenced by the queue entries should, most
-*                  likely, need to be de-allocated (i.e. freed).
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               The histograms were copied
+*                            OS_ERR_OPT_INVALID        You specified an invalid option
+*                            OS_ERR_PTR_INVALID        If 'p_hist' is a NULL pointer
+*                            OS_ERR_TASK_NOT_EXIST     If the task doesn't exist
+*
+* Returns    : none
+*
+* Note(s)    : 1) The wake to run latency is measured from the moment the task is inserted in the ready list (after
+*                 a post, a timeout, a resume, ...) to the moment the scheduler switches to it.
+*
+*              2) The pend duration is measured from the moment the task starts pending on any kernel object to the
+*                 moment it is inserted back in the ready list, whether the pend was satisfied, aborted or timed out.
+*                 If the task was suspended while pending, the time spent suspended is included.
+*
+*              3) Interrupts are disabled while the histograms are copied, so that the snapshot is consistent.
+*                 See 'TASK LATENCY HISTOGRAMS' in os.h for the meaning of each entry.
 ************************************************************************************************************************
 */
 
-#if (OS_CFG_TASK_Q_EN > 0u)
-OS_MSG_QTY  OSTaskQFlush (OS_TCB  *p_tcb,
-                          OS_ERR  *p_err)
+#if (OS_CFG_TASK_HIST_EN > 0u)
+void  OSTaskHistGet (OS_TCB        *p_tcb,
+                     OS_TASK_HIST  *p_hist,
+                     OS_OPT         opt,
+                     OS_ERR        *p_err)
 {
-    OS_MSG_QTY  entries;
+    CPU_INT08U  ix;
     CPU_SR_ALLOC();
 
 
+
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == (OS_ERR *)0) {
         OS_SAFETY_CRITICAL_EXCEPTION();
-        return (0u);
+        return;
     }
 #endif
 
-#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
-    if (OSIntNestingCtr > 0u) {                                 /* Can't flush a message queue from an ISR              */
-       *p_err = OS_ERR_FLUSH_ISR;
-        return (0u);
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_hist == (OS_TASK_HIST *)0) {                          /* User must specify a valid destination                */
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
     }
-#endif
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_TASK_HIST_NONE:
+        case OS_OPT_TASK_HIST_RESET:
+             break;
 
-#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
-    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
-       *p_err = OS_ERR_OS_NOT_RUNNING;
-        return (0u);
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
     }
 #endif
 
-    if (p_tcb == (OS_TCB *)0) {                                 /* Flush message queue of calling task?                 */
-        CPU_CRITICAL_ENTER();
-        p_tcb = OSTCBCurPtr;
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {                                 /* Get the histograms of the current task?              */
+        p_tcb = OSTCBCurPtr;                                    /* Yes                                                  */
+    }
+
+    if (p_tcb->TaskState == OS_TASK_STATE_DEL) {                /* Make sure task exist                                 */
         CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_TASK_NOT_EXIST;
+        return;
     }
 
-    CPU_CRITICAL_ENTER();
-    entries = OS_MsgQFreeAll(&p_tcb->MsgQ);                     /* Return all OS_MSGs to the OS_MSG pool                */
+   *p_hist = p_tcb->Hist;
+    if (opt == OS_OPT_TASK_HIST_RESET) {
+        for (ix = 0u; ix < OS_CFG_TASK_HIST_SIZE; ix++) {
+            p_tcb->Hist.WakeTbl[ix] = 0u;
+            p_tcb->Hist.PendTbl[ix] = 0u;
+        }
+        p_tcb->Hist.WakeMax   = 0u;
+        p_tcb->Hist.WakeTotal = 0u;
+        p_tcb->Hist.WakeNbr   = 0u;
+    }
     CPU_CRITICAL_EXIT();
-   *p_err   = OS_ERR_NONE;
-    return (entries);
+   *p_err = OS_ERR_NONE;
 }
 #endif
 
 
 /*
 ************************************************************************************************************************
-*                                                  WAIT FOR A MESSAGE
+*                                       GET THE WAKE TO RUN LATENCY OF A PRIORITY LEVEL
 *
-* Description: This function causes the current task to wait for a message to be posted to it.
+* Description: This function copies the wake to run latency statistics of a priority level and optionally clears them.
 *
-* Arguments  : timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for a
-*                            message to arrive up to the amount of time specified by this argument.
-*                            If you specify 0, however, your task will wait forever or, until a message arrives.
+* Arguments  : prio      is the priority level
 *
-*              opt           determines whether the user wants to block if the task's queue is empty or not:
+*              p_hist    is a pointer to where the statistics will be copied
 *
-*                                OS_OPT_PEND_BLOCKING
-*                                OS_OPT_PEND_NON_BLOCKING
+*              opt       determines whether the statistics are cleared after being copied:
 *
-*              p_msg_size    is a pointer to a variable that will receive the size of the message
+*                            OS_OPT_TASK_HIST_NONE     Only copy the statistics
+*                            OS_OPT_TASK_HIST_RESET    Copy, then clear the statistics
 *
-*              p_ts          is a pointer to a variable that will receive the timestamp of when the message was
-*                            received.  If you pass a NULL pointer (i.e. (CPU_TS *)0) then you will not get the
-*                            timestamp.  In other words, passing a NULL pointer is valid and indicates that you don't
-*                            need the timestamp.
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
 *
-*              p_err         is a pointer to where an error message will be deposited.  Possible error
-*                            messages are:
+*                            OS_ERR_NONE               The statistics were copied
+*                            OS_ERR_OPT_INVALID        You specified an invalid option
+*                            OS_ERR_PRIO_INVALID       If 'prio' is not less than OS_CFG_PRIO_MAX
+*                            OS_ERR_PTR_INVALID        If 'p_hist' is a NULL pointer
 *
-*                                OS_ERR_NONE               The call was successful and your task received a message.
-*                                OS_ERR_OPT_INVALID        If you specified an invalid option
-*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
-*                                OS_ERR_PEND_ABORT         If the pend was aborted
-*                                OS_ERR_PEND_ISR           If you called this function from an ISR and the result
-*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the queue was not empty
-*                                OS_ERR_PTR_INVALID        If 'p_msg_size' is NULL
-*                                OS_ERR_SCHED_LOCKED       If the scheduler is locked
-*                                OS_ERR_TIMEOUT            A message was not received within the specified timeout
-*                                                          would lead to a suspension
-*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
-*
-* Returns    : A pointer to the message received or a NULL pointer upon error.
-*
-* Note(s)    : 1) It is possible to receive NULL pointers when there are no errors.
+* Returns    : none
 *
-*            : 2) This API 'MUST NOT' be called from a timer callback function.
+* Note(s)    : 1) The statistics of a priority level gather the latencies of all the tasks switched in at that priority,
+*                 which shows whether a level is overloaded even when its tasks come and go.
 ************************************************************************************************************************
 */
 
-#if (OS_CFG_TASK_Q_EN > 0u)
-void  *OSTaskQPend (OS_TICK       timeout,
-                    OS_OPT        opt,
-                    OS_MSG_SIZE  *p_msg_size,
-                    CPU_TS       *p_ts,
-                    OS_ERR       *p_err)
+#if (OS_CFG_TASK_HIST_EN > 0u) && (OS_CFG_TASK_HIST_PRIO_EN > 0u)
+void  OSTaskHistPrioGet (OS_PRIO             prio,
+                         OS_TASK_HIST_PRIO  *p_hist,
+                         OS_OPT              opt,
+                         OS_ERR             *p_err)
 {
-    OS_MSG_Q  *p_msg_q;
-    void      *p_void;
+    OS_TASK_HIST_PRIO  *p_prio_hist;
+    CPU_INT08U          ix;
     CPU_SR_ALLOC();
 
 
+
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == (OS_ERR *)0) {
         OS_SAFETY_CRITICAL_EXCEPTION();
-        return ((void *)0);
+        return;
     }
 #endif
 
-    OS_TRACE_TASK_MSG_Q_PEND_ENTER(&OSTCBCurPtr->MsgQ, timeout, opt, p_msg_size, p_ts);
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_hist == (OS_TASK_HIST_PRIO *)0) {                     /* User must specify a valid destination                */
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    if (prio >= OS_CFG_PRIO_MAX) {
+       *p_err = OS_ERR_PRIO_INVALID;
+        return;
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_TASK_HIST_NONE:
+        case OS_OPT_TASK_HIST_RESET:
+             break;
 
-#if (OS_CFG_TICK_EN == 0u)
-    if (timeout != 0u) {
-       *p_err = OS_ERR_TICK_DISABLED;
-        OS_TRACE_TASK_MSG_Q_PEND_EXIT(OS_ERR_TICK_DISABLED);
-        return ((void *)0);
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
     }
 #endif
 
-#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
-    if (OSIntNestingCtr > 0u) {                                 /* Can't Pend from an ISR                               */
-        OS_TRACE_TASK_MSG_Q_PEND_EXIT(OS_ERR_PEND_ISR);
-       *p_err = OS_ERR_PEND_ISR;
-        return ((void *)0);
+    p_prio_hist = &OSTaskHistPrioTbl[prio];
+    CPU_CRITICAL_ENTER();
+   *p_hist = *p_prio_hist;
+    if (opt == OS_OPT_TASK_HIST_RESET) {
+        for (ix = 0u; ix < OS_CFG_TASK_HIST_SIZE; ix++) {
+            p_prio_hist->WakeTbl[ix] = 0u;
+        }
+        p_prio_hist->WakeMax   = 0u;
+        p_prio_hist->WakeTotal = 0u;
+        p_prio_hist->WakeNbr   = 0u;
+    }
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                               NOTIFY A TASK (SLOT VALUE)
+*
+* Description: This function updates one of the notification slots of a task and readies the task if it was waiting on
+*              that slot with OSTaskNotifyWait().
+*
+* Arguments  : p_tcb     is a pointer to the TCB of the task to notify.  A NULL pointer indicates that you are notifying
+*                        the calling task.
+*
+*              id        is the index of the notification slot (0 to OS_CFG_TASK_NOTIFY_SLOTS-1)
+*
+*              val       is the value used to update the slot (ignored by OS_OPT_TASK_NOTIFY_INCR)
+*
+*              opt       determines how the slot value is updated:
+*
+*                            OS_OPT_TASK_NOTIFY_INCR         Add one to the slot value (the slot is a counter)
+*                            OS_OPT_TASK_NOTIFY_SET_BITS     OR 'val' into the slot value (the slot is a bit mask)
+*                            OS_OPT_TASK_NOTIFY_OVERWRITE    Replace the slot value by 'val'
+*
+*                        and can be combined (OR'd) with:
+*
+*                            OS_OPT_POST_NO_SCHED            Do not call the scheduler
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                     The slot was updated
+*                            OS_ERR_OPT_INVALID              You specified an invalid option
+*                            OS_ERR_OS_NOT_RUNNING           If uC/OS-III is not running yet
+*                            OS_ERR_STATE_INVALID            If the task is in an invalid state
+*                            OS_ERR_TASK_NOTIFY_ID_INVALID   If 'id' is not a valid slot
+*                            OS_ERR_TASK_NOTIFY_OVF          If OS_OPT_TASK_NOTIFY_INCR would overflow the counter
+*
+* Returns    : none
+*
+* Note(s)    : 1) Each slot keeps its value until it is consumed by OSTaskNotifyWait(), so a notification sent while
+*                 the task is not waiting is not lost.  Successive OS_OPT_TASK_NOTIFY_OVERWRITE notifications only
+*                 keep the latest value.
+*
+*              2) This function can be called from an ISR.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_NOTIFY_EN > 0u)
+void  OSTaskNotify (OS_TCB        *p_tcb,
+                    OS_NOTIFY_ID   id,
+                    OS_NOTIFY      val,
+                    OS_OPT         opt,
+                    OS_ERR        *p_err)
+{
+    CPU_TS  ts;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
     }
 #endif
 
 #if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
     if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
-        OS_TRACE_TASK_MSG_Q_PEND_EXIT(OS_ERR_OS_NOT_RUNNING);
        *p_err = OS_ERR_OS_NOT_RUNNING;
-        return ((void *)0);
+        return;
     }
 #endif
 
-
-#if (OS_CFG_ARG_CHK_EN > 0u)                                    /* ---------------- VALIDATE ARGUMENTS ---------------- */
-    if (p_msg_size == (OS_MSG_SIZE *)0) {                       /* User must supply a valid destination for msg size    */
-        OS_TRACE_TASK_MSG_Q_PEND_EXIT(OS_ERR_PTR_INVALID);
-       *p_err = OS_ERR_PTR_INVALID;
-        return ((void *)0);
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (id >= OS_CFG_TASK_NOTIFY_SLOTS) {                       /* Validate slot                                        */
+       *p_err = OS_ERR_TASK_NOTIFY_ID_INVALID;
+        return;
     }
-    switch (opt) {                                              /* User must supply a valid option                      */
-        case OS_OPT_PEND_BLOCKING:
-        case OS_OPT_PEND_NON_BLOCKING:
+    switch (opt & (OS_OPT)~OS_OPT_POST_NO_SCHED) {              /* Validate 'opt'                                       */
+        case OS_OPT_TASK_NOTIFY_INCR:
+        case OS_OPT_TASK_NOTIFY_SET_BITS:
+        case OS_OPT_TASK_NOTIFY_OVERWRITE:
              break;
 
         default:
-             OS_TRACE_TASK_MSG_Q_PEND_EXIT(OS_ERR_OPT_INVALID);
             *p_err = OS_ERR_OPT_INVALID;
-             return ((void *)0);
+             return;
     }
 #endif
 
-    if (p_ts != (CPU_TS *)0) {
-       *p_ts = 0u;                                              /* Initialize the returned timestamp                    */
-    }
-
-    CPU_CRITICAL_ENTER();
-    p_msg_q = &OSTCBCurPtr->MsgQ;                               /* Any message waiting in the message queue?            */
-    p_void  = OS_MsgQGet(p_msg_q,
-                         p_msg_size,
-                         p_ts,
-                         p_err);
-    if (*p_err == OS_ERR_NONE) {
-#if (OS_CFG_TASK_PROFILE_EN > 0u)
 #if (OS_CFG_TS_EN > 0u)
-        if (p_ts != (CPU_TS *)0) {
-            OSTCBCurPtr->MsgQPendTime = OS_TS_GET() - *p_ts;
-            if (OSTCBCurPtr->MsgQPendTimeMax < OSTCBCurPtr->MsgQPendTime) {
-                OSTCBCurPtr->MsgQPendTimeMax = OSTCBCurPtr->MsgQPendTime;
-            }
-        }
-#endif
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
 #endif
-        OS_TRACE_TASK_MSG_Q_PEND(p_msg_q);
-        CPU_CRITICAL_EXIT();
-        OS_TRACE_TASK_MSG_Q_PEND_EXIT(OS_ERR_NONE);
-        return (p_void);                                        /* Yes, Return oldest message received                  */
-    }
 
-    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
-       *p_err = OS_ERR_PEND_WOULD_BLOCK;                        /* No                                                   */
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {                                 /* Notify 'self'?                                       */
+        p_tcb = OSTCBCurPtr;
+    }
+    if (p_tcb->TaskState == OS_TASK_STATE_DEL) {
         CPU_CRITICAL_EXIT();
-        OS_TRACE_TASK_MSG_Q_PEND_FAILED(p_msg_q);
-        OS_TRACE_TASK_MSG_Q_PEND_EXIT(OS_ERR_PEND_WOULD_BLOCK);
-        return ((void *)0);
-    } else {                                                    /* Yes                                                  */
-        if (OSSchedLockNestingCtr > 0u) {                       /* Can't block when the scheduler is locked             */
-            CPU_CRITICAL_EXIT();
-            OS_TRACE_TASK_MSG_Q_PEND_FAILED(p_msg_q);
-            OS_TRACE_TASK_MSG_Q_PEND_EXIT(OS_ERR_SCHED_LOCKED);
-           *p_err = OS_ERR_SCHED_LOCKED;
-            return ((void *)0);
-        }
+       *p_err = OS_ERR_STATE_INVALID;
+        return;
     }
 
-    OS_Pend((OS_PEND_OBJ *)0,                                   /* Block task pending on Message                        */
-             OSTCBCurPtr,
-             OS_TASK_PEND_ON_TASK_Q,
-             timeout);
-    CPU_CRITICAL_EXIT();
-    OS_TRACE_TASK_MSG_Q_PEND_BLOCK(p_msg_q);
-    OSSched();                                                  /* Find the next highest priority task ready to run     */
-
-    CPU_CRITICAL_ENTER();
-    switch (OSTCBCurPtr->PendStatus) {
-        case OS_STATUS_PEND_OK:                                 /* Extract message from TCB (Put there by Post)         */
-             p_void      = OSTCBCurPtr->MsgPtr;
-            *p_msg_size  = OSTCBCurPtr->MsgSize;
-#if (OS_CFG_TS_EN > 0u)
-             if (p_ts != (CPU_TS *)0) {
-                *p_ts = OSTCBCurPtr->TS;
-#if (OS_CFG_TASK_PROFILE_EN > 0u)
-                OSTCBCurPtr->MsgQPendTime = OS_TS_GET() - OSTCBCurPtr->TS;
-                if (OSTCBCurPtr->MsgQPendTimeMax < OSTCBCurPtr->MsgQPendTime) {
-                    OSTCBCurPtr->MsgQPendTimeMax = OSTCBCurPtr->MsgQPendTime;
-                }
-#endif
+    switch (opt & (OS_OPT)~OS_OPT_POST_NO_SCHED) {              /* Update the slot value                                */
+        case OS_OPT_TASK_NOTIFY_INCR:
+             if (p_tcb->NotifyValTbl[id] == (OS_NOTIFY)-1) {
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_TASK_NOTIFY_OVF;
+                 return;
              }
-#endif
-             OS_TRACE_TASK_MSG_Q_PEND(p_msg_q);
-            *p_err = OS_ERR_NONE;
+             p_tcb->NotifyValTbl[id]++;
              break;
 
-        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
-             p_void     = (void *)0;
-            *p_msg_size = 0u;
-             if (p_ts != (CPU_TS *)0) {
-                *p_ts = 0u;
-             }
-             OS_TRACE_TASK_MSG_Q_PEND_FAILED(p_msg_q);
-            *p_err      =  OS_ERR_PEND_ABORT;
+        case OS_OPT_TASK_NOTIFY_SET_BITS:
+             p_tcb->NotifyValTbl[id] |= val;
              break;
 
-        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that we didn't get event within TO          */
+        case OS_OPT_TASK_NOTIFY_OVERWRITE:
         default:
-             p_void     = (void *)0;
-            *p_msg_size = 0u;
+             p_tcb->NotifyValTbl[id]  = val;
+             break;
+    }
+    p_tcb->NotifyPendTbl[id] = OS_TRUE;
 #if (OS_CFG_TS_EN > 0u)
-             if (p_ts  != (CPU_TS *)0) {
-                *p_ts = OSTCBCurPtr->TS;
-             }
+    p_tcb->TS                = ts;
 #endif
-             OS_TRACE_TASK_MSG_Q_PEND_FAILED(p_msg_q);
-            *p_err      =  OS_ERR_TIMEOUT;
-             break;
+
+    if (((p_tcb->TaskState & OS_TASK_STATE_PEND) != 0u)    &&   /* Is the task waiting on this slot?                    */
+         (p_tcb->PendOn       == OS_TASK_PEND_ON_TASK_NOTIFY) &&
+         (p_tcb->NotifyWaitId == id)) {
+        OS_Post((OS_PEND_OBJ *)0,                               /* Yes, make it ready to run                            */
+                 p_tcb,
+                 (void *)0,
+                 0u,
+                 ts);
+        CPU_CRITICAL_EXIT();
+        if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+            OSSched();                                          /* Run the scheduler                                    */
+        }
+    } else {
+        CPU_CRITICAL_EXIT();
     }
-    CPU_CRITICAL_EXIT();
-    OS_TRACE_TASK_MSG_Q_PEND_EXIT(*p_err);
-    return (p_void);                                            /* Return received message                              */
+   *p_err = OS_ERR_NONE;
 }
-#endif
 
 
 /*
 ************************************************************************************************************************
-*                                              ABORT WAITING FOR A MESSAGE
+*                                          WAIT FOR A TASK NOTIFICATION (SLOT)
 *
-* Description: This function aborts & readies the task specified.  This function should be used to fault-abort the wait
-*              for a message, rather than to normally post the message to the task via OSTaskQPost().
+* Description: This function is called by a task to wait for one of its notification slots to be updated by
+*              OSTaskNotify().
 *
-* Arguments  : p_tcb     is a pointer to the task to pend abort
+* Arguments  : id        is the index of the notification slot to wait on (0 to OS_CFG_TASK_NOTIFY_SLOTS-1)
 *
-*              opt       provides options for this function:
+*              clr_mask  are the bits cleared in the slot value when the notification is consumed.  Specify
+*                        (OS_NOTIFY)-1 to reset the slot to 0.  This argument is ignored with OS_OPT_TASK_NOTIFY_DECR.
 *
-*                            OS_OPT_POST_NONE         No option specified
-*                            OS_OPT_POST_NO_SCHED     Indicates that the scheduler will not be called.
+*              timeout   is an optional timeout period (in clock ticks).  If non-zero, your task will wait for the
+*                        notification up to the amount of time specified by this argument.  If you specify 0,
+*                        however, your task will wait forever or, until the slot is notified.
 *
-*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*              opt       determines whether the user wants to block if the slot was not notified:
 *
-*                            OS_ERR_NONE               If the task was readied and informed of the aborted wait
-*                            OS_ERR_OPT_INVALID        If you specified an invalid option
-*                            OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
-*                            OS_ERR_PEND_ABORT_ISR     If you called this function from an ISR
-*                            OS_ERR_PEND_ABORT_NONE    If task was not pending on a message and thus there is nothing to
-*                                                      abort
-*                            OS_ERR_PEND_ABORT_SELF    If you passed a NULL pointer for 'p_tcb'
+*                            OS_OPT_PEND_BLOCKING
+*                            OS_OPT_PEND_NON_BLOCKING
 *
-* Returns    : == OS_FALSE   if task was not waiting for a message, or upon error.
-*              == OS_TRUE    if task was waiting for a message and was readied and informed.
+*                        and can be combined (OR'd) with:
 *
-* Note(s)    : none
+*                            OS_OPT_TASK_NOTIFY_DECR         Consume a single count of a counter slot
+*                            OS_OPT_PEND_ABS                 'timeout' is a value of OSTickCtr
+*
+*              p_ts      is a pointer to a variable that will receive the timestamp of when the slot was last notified.
+*                        If you pass a NULL pointer (i.e. (CPU_TS *)0) then you will not get the timestamp.
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                     The slot was notified
+*                            OS_ERR_OPT_INVALID              You specified an invalid option
+*                            OS_ERR_OS_NOT_RUNNING           If uC/OS-III is not running yet
+*                            OS_ERR_PEND_ABORT               If the wait was aborted
+*                            OS_ERR_PEND_ISR                 If you called this function from an ISR
+*                            OS_ERR_PEND_WOULD_BLOCK         If you specified non-blocking but the slot was not notified
+*                            OS_ERR_SCHED_LOCKED             If the scheduler is locked
+*                            OS_ERR_STATUS_INVALID           If the pend status has an invalid value
+*                            OS_ERR_TASK_NOTIFY_ID_INVALID   If 'id' is not a valid slot
+*                            OS_ERR_TICK_DISABLED            If kernel ticks are disabled and a timeout is specified
+*                            OS_ERR_TIMEOUT                  The slot was not notified within the specified timeout
+*
+* Returns    : The value of the slot before it was consumed, or 0 if the slot was not notified.
+*
+* Note(s)    : 1) Without OS_OPT_TASK_NOTIFY_DECR, consuming the notification clears the bits of 'clr_mask' and the
+*                 slot must be notified again before the next wait succeeds.
+*
+*              2) With OS_OPT_TASK_NOTIFY_DECR the slot behaves like a counting semaphore: the value is decremented
+*                 by one and the slot stays notified while the value is non-zero.
 ************************************************************************************************************************
 */
 
-#if (OS_CFG_TASK_Q_EN > 0u) && (OS_CFG_TASK_Q_PEND_ABORT_EN > 0u)
-CPU_BOOLEAN  OSTaskQPendAbort (OS_TCB  *p_tcb,
-                               OS_OPT   opt,
-                               OS_ERR  *p_err)
+OS_NOTIFY  OSTaskNotifyWait (OS_NOTIFY_ID   id,
+                             OS_NOTIFY      clr_mask,
+                             OS_TICK        timeout,
+                             OS_OPT         opt,
+                             CPU_TS        *p_ts,
+                             OS_ERR        *p_err)
 {
-    CPU_TS  ts;
+    OS_NOTIFY  val;
     CPU_SR_ALLOC();
 
 
+#if (OS_CFG_TS_EN == 0u)
+    (void)p_ts;                                                 /* Prevent compiler warning for not using 'ts'          */
+#endif
+
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == (OS_ERR *)0) {
         OS_SAFETY_CRITICAL_EXCEPTION();
-        return (OS_FALSE);
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        return (0u);
     }
 #endif
 
 #if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
-    if (OSIntNestingCtr > 0u) {                                 /* See if called from ISR ...                           */
-       *p_err = OS_ERR_PEND_ABORT_ISR;                          /* ... can't Pend Abort from an ISR                     */
-        return (OS_FALSE);
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_PEND_ISR;
+        return (0u);
     }
 #endif
 
 #if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
     if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
        *p_err = OS_ERR_OS_NOT_RUNNING;
-        return (OS_FALSE);
+        return (0u);
     }
 #endif
 
-#if (OS_CFG_ARG_CHK_EN > 0u)                                    /* ---------------- VALIDATE ARGUMENTS ---------------- */
-    switch (opt) {                                              /* User must supply a valid option                      */
-        case OS_OPT_POST_NONE:
-        case OS_OPT_POST_NO_SCHED:
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (id >= OS_CFG_TASK_NOTIFY_SLOTS) {                       /* Validate slot                                        */
+       *p_err = OS_ERR_TASK_NOTIFY_ID_INVALID;
+        return (0u);
+    }
+    switch (opt & (OS_OPT)~(OS_OPT)(OS_OPT_TASK_NOTIFY_DECR | OS_OPT_PEND_ABS)) { /* Validate 'opt'                     */
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
              break;
 
         default:
             *p_err = OS_ERR_OPT_INVALID;
-             return (OS_FALSE);
+             return (0u);
     }
 #endif
 
     CPU_CRITICAL_ENTER();
-#if (OS_CFG_ARG_CHK_EN > 0u)
-    if ((p_tcb == (OS_TCB *)0) ||                               /* Pend abort self?                                     */
-        (p_tcb == OSTCBCurPtr)) {
+    if (OSTCBCurPtr->NotifyPendTbl[id] == OS_FALSE) {           /* Slot notified since it was last consumed?            */
+        if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {           /* No,  caller wants to block?                          */
+            CPU_CRITICAL_EXIT();
+#if (OS_CFG_TS_EN > 0u)
+            if (p_ts != (CPU_TS *)0) {
+               *p_ts  = 0u;
+            }
+#endif
+           *p_err = OS_ERR_PEND_WOULD_BLOCK;                    /* No                                                   */
+            return (0u);
+        }
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+#if (OS_CFG_TS_EN > 0u)
+            if (p_ts != (CPU_TS *)0) {
+               *p_ts  = 0u;
+            }
+#endif
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return (0u);
+        }
+
+        OSTCBCurPtr->NotifyWaitId = id;
+        OS_PEND_ABS_SET(OSTCBCurPtr, opt);
+        OS_Pend((OS_PEND_OBJ *)0,                               /* Block task pending on the slot                       */
+                 OSTCBCurPtr,
+                 OS_TASK_PEND_ON_TASK_NOTIFY,
+                 timeout);
         CPU_CRITICAL_EXIT();
-       *p_err = OS_ERR_PEND_ABORT_SELF;                         /* ... doesn't make sense                               */
-        return (OS_FALSE);
-    }
+        OSSched();                                              /* Find next highest priority task ready to run         */
+
+        CPU_CRITICAL_ENTER();
+        switch (OSTCBCurPtr->PendStatus) {                      /* See if we timed-out or aborted                       */
+            case OS_STATUS_PEND_OK:
+                 break;
+
+            case OS_STATUS_PEND_ABORT:
+                 CPU_CRITICAL_EXIT();
+#if (OS_CFG_TS_EN > 0u)
+                 if (p_ts != (CPU_TS *)0) {
+                    *p_ts  = OSTCBCurPtr->TS;
+                 }
 #endif
+                *p_err = OS_ERR_PEND_ABORT;                     /* Indicate that we aborted                             */
+                 return (0u);
 
-    if (p_tcb->PendOn != OS_TASK_PEND_ON_TASK_Q) {              /* Is task waiting for a message?                       */
-        CPU_CRITICAL_EXIT();                                    /* No                                                   */
-       *p_err = OS_ERR_PEND_ABORT_NONE;
-        return (OS_FALSE);
+            case OS_STATUS_PEND_TIMEOUT:
+                 CPU_CRITICAL_EXIT();
+#if (OS_CFG_TS_EN > 0u)
+                 if (p_ts != (CPU_TS *)0) {
+                    *p_ts  = 0u;
+                 }
+#endif
+                *p_err = OS_ERR_TIMEOUT;                        /* Indicate that we didn't get notified within TO       */
+                 return (0u);
+
+            default:
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_STATUS_INVALID;
+                 return (0u);
+        }
     }
 
+    val = OSTCBCurPtr->NotifyValTbl[id];                        /* Consume the notification                             */
+    if ((opt & OS_OPT_TASK_NOTIFY_DECR) != 0u) {
+        if (val > 0u) {
+            OSTCBCurPtr->NotifyValTbl[id]  = val - 1u;
+        }
+        OSTCBCurPtr->NotifyPendTbl[id]     = (val > 1u) ? OS_TRUE : OS_FALSE;
+    } else {
+        OSTCBCurPtr->NotifyValTbl[id]     &= ~clr_mask;
+        OSTCBCurPtr->NotifyPendTbl[id]     = OS_FALSE;
+    }
 #if (OS_CFG_TS_EN > 0u)
-    ts = OS_TS_GET();                                           /* Get timestamp of when the abort occurred             */
-#else
-    ts = 0u;
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts  = OSTCBCurPtr->TS;
+    }
 #endif
-    OS_PendAbort(p_tcb,                                         /* Abort the pend                                       */
-                 ts,
-                 OS_STATUS_PEND_ABORT);
     CPU_CRITICAL_EXIT();
-    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
-        OSSched();                                              /* Run the scheduler                                    */
-    }
    *p_err = OS_ERR_NONE;
-    return (OS_TRUE);
+    return (val);
 }
 #endif
 
 
 /*
 ************************************************************************************************************************
-*                                               POST MESSAGE TO A TASK
+*                                                    FLUSH TASK's QUEUE
 *
-* Description: This function sends a message to a task.
+* Description: This function is used to flush the task's internal message queue.
 *
-* Arguments  : p_tcb      is a pointer to the TCB of the task receiving a message.  If you specify a NULL pointer then
-*                         the message will be posted to the task's queue of the calling task.  In other words, you'd be
-*                         posting a message to yourself.
+* Arguments  : p_tcb       is a pointer to the task's OS_TCB.  Specifying a NULL pointer indicates that you wish to
+*                          flush the message queue of the calling task.
 *
-*              p_void     is a pointer to the message to send.
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
 *
-*              msg_size   is the size of the message sent (in bytes)
+*                              OS_ERR_NONE              Upon success
+*                              OS_ERR_FLUSH_ISR         If you called this function from an ISR
+*                              OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
 *
-*              opt        specifies whether the post will be FIFO or LIFO:
+* Returns     : The number of entries freed from the queue
 *
-*                             OS_OPT_POST_FIFO       Post at the end   of the queue
-*                             OS_OPT_POST_LIFO       Post at the front of the queue
+* Note(s)     : 1) You should use this function with great care because, when to flush the queue, you LOOSE the
+*                  references to what the queue entries are pointing to and thus, you could cause 'memory leaks'.  In
+*                  other words, the data you are pointing to that's being referenced by the queue entries should, most
+*                  likely, need to be de-allocated (i.e. freed).
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_Q_EN > 0u)
+OS_MSG_QTY  OSTaskQFlush (OS_TCB  *p_tcb,
+                          OS_ERR  *p_err)
+{
+    OS_MSG_QTY  entries;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't flush a message queue from an ISR              */
+       *p_err = OS_ERR_FLUSH_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+    if (p_tcb == (OS_TCB *)0) {                                 /* Flush message queue of calling task?                 */
+        CPU_CRITICAL_ENTER();
+        p_tcb = OSTCBCurPtr;
+        CPU_CRITICAL_EXIT();
+    }
+
+    CPU_CRITICAL_ENTER();
+    entries = OS_MsgQFreeAll(&p_tcb->MsgQ);                     /* Return all OS_MSGs to the OS_MSG pool                */
+    CPU_CRITICAL_EXIT();
+   *p_err   = OS_ERR_NONE;
+    return (entries);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                  WAIT FOR A MESSAGE
 *
-*                             OS_OPT_POST_NO_SCHED   Do not run the scheduler after the post
+* Description: This function causes the current task to wait for a message to be posted to it.
 *
-*                          Note(s): 1) OS_OPT_POST_NO_SCHED can be added with one of the other options.
+* Arguments  : timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for a
+*                            message to arrive up to the amount of time specified by this argument.
+*                            If you specify 0, however, your task will wait forever or, until a message arrives.
 *
+*              opt           determines whether the user wants to block if the task's queue is empty or not:
 *
-*              p_err      is a pointer to a variable that will hold the error code associated
-*                         with the outcome of this call.  Errors can be:
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
 *
-*                             OS_ERR_NONE              The call was successful and the message was sent
-*                             OS_ERR_MSG_POOL_EMPTY    If there are no more OS_MSGs available from the pool
-*                             OS_ERR_OPT_INVALID       If you specified an invalid option
-*                             OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
-*                             OS_ERR_Q_MAX             If the queue is full
-*                             OS_ERR_STATE_INVALID     If the task is in an invalid state.  This should never happen
-*                                                      and if it does, would be considered a system failure
+*                            Add OS_OPT_PEND_ABS to make 'timeout' the value of OSTickCtr at which to give up.
 *
-* Returns    : none
+*              p_msg_size    is a pointer to a variable that will receive the size of the message
 *
-* Note(s)    : none
+*              p_ts          is a pointer to a variable that will receive the timestamp of when the message was
+*                            received.  If you pass a NULL pointer (i.e. (CPU_TS *)0) then you will not get the
+*                            timestamp.  In other words, passing a NULL pointer is valid and indicates that you don't
+*                            need the timestamp.
+*
+*              p_err         is a pointer to where an error message will be deposited.  Possible error
+*                            messages are:
+*
+*                                OS_ERR_NONE               The call was successful and your task received a message.
+*                                OS_ERR_OPT_INVALID        If you specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         If the pend was aborted
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR and the result
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the queue was not empty
+*                                OS_ERR_PTR_INVALID        If 'p_msg_size' is NULL
+*                                OS_ERR_SCHED_LOCKED       If the scheduler is locked
+*                                OS_ERR_TIMEOUT            A message was not received within the specified timeout
+*                                                          would lead to a suspension
+*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*
+* Returns    : A pointer to the message received or a NULL pointer upon error.
+*
+* Note(s)    : 1) It is possible to receive NULL pointers when there are no errors.
+*
+*            : 2) This API 'MUST NOT' be called from a timer callback function.
 ************************************************************************************************************************
 */
 
 #if (OS_CFG_TASK_Q_EN > 0u)
-void  OSTaskQPost (OS_TCB       *p_tcb,
-                   void         *p_void,
-                   OS_MSG_SIZE   msg_size,
-                   OS_OPT        opt,
-                   OS_ERR       *p_err)
+void  *OSTaskQPend (OS_TICK       timeout,
+                    OS_OPT        opt,
+                    OS_MSG_SIZE  *p_msg_size,
+                    CPU_TS       *p_ts,
+                    OS_ERR       *p_err)
 {
-    CPU_TS  ts;
+    OS_MSG_Q  *p_msg_q;
+    void      *p_void;
     CPU_SR_ALLOC();
 
 
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == (OS_ERR *)0) {
         OS_SAFETY_CRITICAL_EXCEPTION();
-        return;
+        return ((void *)0);
     }
 #endif
 
-    OS_TRACE_TASK_MSG_Q_POST_ENTER(&p_tcb->MsgQ, p_void, msg_size, opt);
+    OS_TRACE_TASK_MSG_Q_PEND_ENTER(&OSTCBCurPtr->MsgQ, timeout, opt, p_msg_size, p_ts);
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        OS_TRACE_TASK_MSG_Q_PEND_EXIT(OS_ERR_TICK_DISABLED);
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't Pend from an ISR                               */
+        OS_TRACE_TASK_MSG_Q_PEND_EXIT(OS_ERR_PEND_ISR);
+       *p_err = OS_ERR_PEND_ISR;
+        return ((void *)0);
+    }
+#endif
 
 #if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
     if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
-        OS_TRACE_TASK_MSG_Q_POST_EXIT(OS_ERR_OS_NOT_RUNNING);
+        OS_TRACE_TASK_MSG_Q_PEND_EXIT(OS_ERR_OS_NOT_RUNNING);
        *p_err = OS_ERR_OS_NOT_RUNNING;
-        return;
+        return ((void *)0);
     }
 #endif
 
+
 #if (OS_CFG_ARG_CHK_EN > 0u)                                    /* ---------------- VALIDATE ARGUMENTS ---------------- */
-    switch (opt) {                                              /* User must supply a valid option                      */
-        case OS_OPT_POST_FIFO:
-        case OS_OPT_POST_LIFO:
-        case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
-        case OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED:
+    if (p_msg_size == (OS_MSG_SIZE *)0) {                       /* User must supply a valid destination for msg size    */
+        OS_TRACE_TASK_MSG_Q_PEND_EXIT(OS_ERR_PTR_INVALID);
+       *p_err = OS_ERR_PTR_INVALID;
+        return ((void *)0);
+    }
+    switch (opt & (OS_OPT)~OS_OPT_PEND_ABS) {                   /* User must supply a valid option                      */
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
              break;
 
         default:
-             OS_TRACE_TASK_MSG_Q_POST_FAILED(&p_tcb->MsgQ);
-             OS_TRACE_TASK_MSG_Q_POST_EXIT(OS_ERR_OPT_INVALID);
+             OS_TRACE_TASK_MSG_Q_PEND_EXIT(OS_ERR_OPT_INVALID);
             *p_err = OS_ERR_OPT_INVALID;
-             return;
+             return ((void *)0);
     }
 #endif
 
-#if (OS_CFG_TS_EN > 0u)
-    ts = OS_TS_GET();                                           /* Get timestamp                                        */
-#else
-    ts = 0u;
-#endif
-
-    OS_TRACE_TASK_MSG_Q_POST(&p_tcb->MsgQ);
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts = 0u;                                              /* Initialize the returned timestamp                    */
+    }
 
-   *p_err = OS_ERR_NONE;                                        /* Assume we won't have any errors                      */
     CPU_CRITICAL_ENTER();
-    if (p_tcb == (OS_TCB *)0) {                                 /* Post msg to 'self'?                                  */
-        p_tcb = OSTCBCurPtr;
+    p_msg_q = &OSTCBCurPtr->MsgQ;                               /* Any message waiting in the message queue?            */
+    p_void  = OS_MsgQGet(p_msg_q,
+                         p_msg_size,
+                         p_ts,
+                         p_err);
+    if (*p_err == OS_ERR_NONE) {
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+#if (OS_CFG_TS_EN > 0u)
+        if (p_ts != (CPU_TS *)0) {
+            OSTCBCurPtr->MsgQPendTime = OS_TS_GET() - *p_ts;
+            if (OSTCBCurPtr->MsgQPendTimeMax < OSTCBCurPtr->MsgQPendTime) {
+                OSTCBCurPtr->MsgQPendTimeMax = OSTCBCurPtr->MsgQPendTime;
+            }
+        }
+#endif
+#endif
+        OS_TRACE_TASK_MSG_Q_PEND(p_msg_q);
+        CPU_CRITICAL_EXIT();
+        OS_TRACE_TASK_MSG_Q_PEND_EXIT(OS_ERR_NONE);
+        return (p_void);                                        /* Yes, Return oldest message received                  */
     }
-    switch (p_tcb->TaskState) {
-        case OS_TASK_STATE_RDY:
-        case OS_TASK_STATE_DLY:
-        case OS_TASK_STATE_SUSPENDED:
-        case OS_TASK_STATE_DLY_SUSPENDED:
-             OS_MsgQPut(&p_tcb->MsgQ,                           /* Deposit the message in the queue                     */
-                        p_void,
-                        msg_size,
-                        opt,
-                        ts,
-                        p_err);
-             CPU_CRITICAL_EXIT();
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                        /* No                                                   */
+        CPU_CRITICAL_EXIT();
+        OS_TRACE_TASK_MSG_Q_PEND_FAILED(p_msg_q);
+        OS_TRACE_TASK_MSG_Q_PEND_EXIT(OS_ERR_PEND_WOULD_BLOCK);
+        return ((void *)0);
+    } else {                                                    /* Yes                                                  */
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't block when the scheduler is locked             */
+            CPU_CRITICAL_EXIT();
+            OS_TRACE_TASK_MSG_Q_PEND_FAILED(p_msg_q);
+            OS_TRACE_TASK_MSG_Q_PEND_EXIT(OS_ERR_SCHED_LOCKED);
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return ((void *)0);
+        }
+    }
+
+    OS_PEND_ABS_SET(OSTCBCurPtr, opt);
+    OS_Pend((OS_PEND_OBJ *)0,                                   /* Block task pending on Message                        */
+             OSTCBCurPtr,
+             OS_TASK_PEND_ON_TASK_Q,
+             timeout);
+    CPU_CRITICAL_EXIT();
+    OS_TRACE_TASK_MSG_Q_PEND_BLOCK(p_msg_q);
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* Extract message from TCB (Put there by Post)         */
+             p_void      = OSTCBCurPtr->MsgPtr;
+            *p_msg_size  = OSTCBCurPtr->MsgSize;
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+                OSTCBCurPtr->MsgQPendTime = OS_TS_GET() - OSTCBCurPtr->TS;
+                if (OSTCBCurPtr->MsgQPendTimeMax < OSTCBCurPtr->MsgQPendTime) {
+                    OSTCBCurPtr->MsgQPendTimeMax = OSTCBCurPtr->MsgQPendTime;
+                }
+#endif
+             }
+#endif
+             OS_TRACE_TASK_MSG_Q_PEND(p_msg_q);
+            *p_err = OS_ERR_NONE;
              break;
 
-        case OS_TASK_STATE_PEND:
-        case OS_TASK_STATE_PEND_TIMEOUT:
-        case OS_TASK_STATE_PEND_SUSPENDED:
-        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
-             if (p_tcb->PendOn == OS_TASK_PEND_ON_TASK_Q) {     /* Is task waiting for a message to be sent to it?      */
-                 OS_Post((OS_PEND_OBJ *)0,
-                          p_tcb,
-                          p_void,
-                          msg_size,
-                          ts);
-                 CPU_CRITICAL_EXIT();
-                 if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
-                     OSSched();                                 /* Run the scheduler                                    */
-                 }
-             } else {
-                 OS_MsgQPut(&p_tcb->MsgQ,                       /* No,  Task is pending on something else ...           */
-                            p_void,                             /* ... Deposit the message in the task's queue          */
-                            msg_size,
-                            opt,
-                            ts,
-                            p_err);
-                 CPU_CRITICAL_EXIT();
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+             p_void     = (void *)0;
+            *p_msg_size = 0u;
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = 0u;
              }
+             OS_TRACE_TASK_MSG_Q_PEND_FAILED(p_msg_q);
+            *p_err      =  OS_ERR_PEND_ABORT;
              break;
 
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that we didn't get event within TO          */
         default:
-             CPU_CRITICAL_EXIT();
-            *p_err = OS_ERR_STATE_INVALID;
+             p_void     = (void *)0;
+            *p_msg_size = 0u;
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts  != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+             OS_TRACE_TASK_MSG_Q_PEND_FAILED(p_msg_q);
+            *p_err      =  OS_ERR_TIMEOUT;
              break;
     }
-
-    OS_TRACE_TASK_MSG_Q_POST_EXIT(*p_err);
+    CPU_CRITICAL_EXIT();
+    OS_TRACE_TASK_MSG_Q_PEND_EXIT(*p_err);
+    return (p_void);                                            /* Return received message                              */
 }
 #endif
 
 
 /*
 ************************************************************************************************************************
-*                                       GET THE CURRENT VALUE OF A TASK REGISTER
+*                                  WAIT FOR A MESSAGE WITH A TIMEOUT IN MICROSECONDS
 *
-* Description: This function is called to obtain the current value of a task register.  Task registers are application
-*              specific and can be used to store task specific values such as 'error numbers' (i.e. errno), statistics,
-*              etc.
+* Description: This function is the same as OSTaskQPend() except that the timeout is given in microseconds.
 *
-* Arguments  : p_tcb     is a pointer to the OS_TCB of the task you want to read the register from.  If 'p_tcb' is a
-*                        NULL pointer then you will get the register of the current task.
+* Arguments  : timeout_us    is an optional timeout in microseconds.  If non-zero, your task will wait up to this long
+*                            and a timeout is detected with the resolution of OS_TS_GET().  If you specify 0, your
+*                            task will wait forever.
 *
-*              id        is the 'id' of the desired task variable.  Note that the 'id' must be less than
-*                        OS_CFG_TASK_REG_TBL_SIZE
+*              ...           are the other arguments of OSTaskQPend().
 *
-*              p_err     is a pointer to a variable that will hold an error code related to this call.
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.  In
+*                            addition to the error codes of OSTaskQPend():
 *
-*                            OS_ERR_NONE               If the call was successful
-*                            OS_ERR_REG_ID_INVALID     If the 'id' is not between 0 and OS_CFG_TASK_REG_TBL_SIZE-1
+*                                OS_ERR_TIME_INVALID_MICROSECONDS   If 'timeout_us' is too long for the timestamp
+*                                                                   or the timestamp frequency is unknown
 *
-* Returns    : The current value of the task's register or 0 if an error is detected.
+* Returns    : See OSTaskQPend().
 *
-* Note(s)    : none
+* Note(s)    : 1) From an ISR or before the kernel runs, the call is passed to OSTaskQPend() without a timeout so that
+*                 it performs its usual checks.
 ************************************************************************************************************************
 */
 
-#if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
-OS_REG  OSTaskRegGet (OS_TCB     *p_tcb,
-                      OS_REG_ID   id,
-                      OS_ERR     *p_err)
+#if (OS_CFG_TASK_Q_EN > 0u) && (OS_CFG_TIME_HR_EN > 0u)
+void  *OSTaskQPendUs (CPU_INT32U    timeout_us,
+                      OS_OPT        opt,
+                      OS_MSG_SIZE  *p_msg_size,
+                      CPU_TS       *p_ts,
+                      OS_ERR       *p_err)
 {
-    OS_REG     value;
-    CPU_SR_ALLOC();
-
+    void       *p_void;
+    CPU_TS      dly;
 
 
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == (OS_ERR *)0) {
         OS_SAFETY_CRITICAL_EXCEPTION();
-        return (0u);
+        return ((void *)0);
     }
 #endif
 
-#if (OS_CFG_ARG_CHK_EN > 0u)
-    if (id >= OS_CFG_TASK_REG_TBL_SIZE) {
-       *p_err = OS_ERR_REG_ID_INVALID;
-        return (0u);
+    if ((timeout_us      ==                   0u) ||            /* Without a timeout, the regular pend does it all      */
+        (OSIntNestingCtr >                    0u) ||
+        (OSRunning       != OS_STATE_OS_RUNNING)) {
+        return (OSTaskQPend(0u, opt, p_msg_size, p_ts, p_err));
     }
-#endif
 
-    CPU_CRITICAL_ENTER();
-    if (p_tcb == (OS_TCB *)0) {
-        p_tcb = OSTCBCurPtr;
+    dly = OS_TickHrUsToTS(timeout_us);
+    if ((dly == 0u) || (dly > OS_TICK_HR_DLY_MAX)) {
+       *p_err = OS_ERR_TIME_INVALID_MICROSECONDS;
+        return ((void *)0);
     }
-    value = p_tcb->RegTbl[id];
-    CPU_CRITICAL_EXIT();
-   *p_err = OS_ERR_NONE;
-    return (value);
+
+    OSTCBCurPtr->TickHrDly = dly;                               /* OS_TaskBlock() uses it instead of the tick timeout   */
+    p_void = OSTaskQPend(1u, opt, p_msg_size, p_ts, p_err);
+    OSTCBCurPtr->TickHrDly = 0u;                                /* Clear it in case the task did not have to wait       */
+
+    return (p_void);
 }
 #endif
 
 
 /*
 ************************************************************************************************************************
-*                                    ALLOCATE THE NEXT AVAILABLE TASK REGISTER ID
+*                                              ABORT WAITING FOR A MESSAGE
 *
-* Description: This function is called to obtain a task register ID.  This function thus allows task registers IDs to be
-*              allocated dynamically instead of statically.
+* Description: This function aborts & readies the task specified.  This function should be used to fault-abort the wait
+*              for a message, rather than to normally post the message to the task via OSTaskQPost().
 *
-* Arguments  : p_err       is a pointer to a variable that will hold an error code related to this call.
+* Arguments  : p_tcb     is a pointer to the task to pend abort
 *
-*                            OS_ERR_NONE               If the call was successful
-*                            OS_ERR_NO_MORE_ID_AVAIL   If you are attempting to assign more task register IDs than you
-*                                                          have available through OS_CFG_TASK_REG_TBL_SIZE
+*              opt       provides options for this function:
 *
-* Returns    : The next available task register 'id' or OS_CFG_TASK_REG_TBL_SIZE if an error is detected.
+*                            OS_OPT_POST_NONE         No option specified
+*                            OS_OPT_POST_NO_SCHED     Indicates that the scheduler will not be called.
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               If the task was readied and informed of the aborted wait
+*                            OS_ERR_OPT_INVALID        If you specified an invalid option
+*                            OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                            OS_ERR_PEND_ABORT_ISR     If you called this function from an ISR
+*                            OS_ERR_PEND_ABORT_NONE    If task was not pending on a message and thus there is nothing to
+*                                                      abort
+*                            OS_ERR_PEND_ABORT_SELF    If you passed a NULL pointer for 'p_tcb'
+*
+* Returns    : == OS_FALSE   if task was not waiting for a message, or upon error.
+*              == OS_TRUE    if task was waiting for a message and was readied and informed.
 *
 * Note(s)    : none
 ************************************************************************************************************************
 */
 
-#if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
-OS_REG_ID  OSTaskRegGetID (OS_ERR  *p_err)
+#if (OS_CFG_TASK_Q_EN > 0u) && (OS_CFG_TASK_Q_PEND_ABORT_EN > 0u)
+CPU_BOOLEAN  OSTaskQPendAbort (OS_TCB  *p_tcb,
+                               OS_OPT   opt,
+                               OS_ERR  *p_err)
 {
-    OS_REG_ID  id;
+    CPU_TS  ts;
     CPU_SR_ALLOC();
 
 
-
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == (OS_ERR *)0) {
         OS_SAFETY_CRITICAL_EXCEPTION();
-        return ((OS_REG_ID)OS_CFG_TASK_REG_TBL_SIZE);
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if called from ISR ...                           */
+       *p_err = OS_ERR_PEND_ABORT_ISR;                          /* ... can't Pend Abort from an ISR                     */
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)                                    /* ---------------- VALIDATE ARGUMENTS ---------------- */
+    switch (opt) {                                              /* User must supply a valid option                      */
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return (OS_FALSE);
     }
 #endif
 
     CPU_CRITICAL_ENTER();
-    if (OSTaskRegNextAvailID >= OS_CFG_TASK_REG_TBL_SIZE) {     /* See if we exceeded the number of IDs available       */
-       *p_err = OS_ERR_NO_MORE_ID_AVAIL;                        /* Yes, cannot allocate more task register IDs          */
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if ((p_tcb == (OS_TCB *)0) ||                               /* Pend abort self?                                     */
+        (p_tcb == OSTCBCurPtr)) {
         CPU_CRITICAL_EXIT();
-        return (OS_CFG_TASK_REG_TBL_SIZE);
+       *p_err = OS_ERR_PEND_ABORT_SELF;                         /* ... doesn't make sense                               */
+        return (OS_FALSE);
     }
+#endif
 
-    id = OSTaskRegNextAvailID;                                  /* Assign the next available ID                         */
-    OSTaskRegNextAvailID++;                                     /* Increment available ID for next request              */
+    if (p_tcb->PendOn != OS_TASK_PEND_ON_TASK_Q) {              /* Is task waiting for a message?                       */
+        CPU_CRITICAL_EXIT();                                    /* No                                                   */
+       *p_err = OS_ERR_PEND_ABORT_NONE;
+        return (OS_FALSE);
+    }
+
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp of when the abort occurred             */
+#else
+    ts = 0u;
+#endif
+    OS_PendAbort(p_tcb,                                         /* Abort the pend                                       */
+                 ts,
+                 OS_STATUS_PEND_ABORT);
     CPU_CRITICAL_EXIT();
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
    *p_err = OS_ERR_NONE;
-    return (id);
+    return (OS_TRUE);
 }
 #endif
 
 
 /*
 ************************************************************************************************************************
-*                                       SET THE CURRENT VALUE OF A TASK REGISTER
+*                                               POST MESSAGE TO A TASK
 *
-* Description: This function is called to change the current value of a task register.  Task registers are application
-*              specific and can be used to store task specific values such as 'error numbers' (i.e. errno), statistics,
-*              etc.
+* Description: This function sends a message to a task.
 *
-* Arguments  : p_tcb     is a pointer to the OS_TCB of the task you want to set the register for.  If 'p_tcb' is a NULL
-*                        pointer then you will change the register of the current task.
+* Arguments  : p_tcb      is a pointer to the TCB of the task receiving a message.  If you specify a NULL pointer then
+*                         the message will be posted to the task's queue of the calling task.  In other words, you'd be
+*                         posting a message to yourself.
 *
-*              id        is the 'id' of the desired task register.  Note that the 'id' must be less than
-*                        OS_CFG_TASK_REG_TBL_SIZE
+*              p_void     is a pointer to the message to send.
 *
-*              value     is the desired value for the task register.
+*              msg_size   is the size of the message sent (in bytes)
 *
-*              p_err     is a pointer to a variable that will hold an error code related to this call.
+*              opt        specifies whether the post will be FIFO or LIFO:
 *
-*                            OS_ERR_NONE               If the call was successful
-*                            OS_ERR_REG_ID_INVALID     If the 'id' is not between 0 and OS_CFG_TASK_REG_TBL_SIZE-1
+*                             OS_OPT_POST_FIFO       Post at the end   of the queue
+*                             OS_OPT_POST_LIFO       Post at the front of the queue
+*
+*                             OS_OPT_POST_NO_SCHED   Do not run the scheduler after the post
+*
+*                          Note(s): 1) OS_OPT_POST_NO_SCHED can be added with one of the other options.
+*                                   2) When OS_CFG_Q_PRIO_EN is enabled, OS_OPT_POST_PRIO(lvl) can also be added to
+*                                      queue the message(s) at priority level 'lvl' (see OSQPost()).
+*                                   3) When OS_CFG_MEM_BUF_EN is enabled, OS_OPT_POST_MEM_BUF_REF can also be added
+*                                      to add a reference to the buffer in 'p_void' for the task (see OSQPost()).
+*
+*
+*              p_err      is a pointer to a variable that will hold the error code associated
+*                         with the outcome of this call.  Errors can be:
+*
+*                             OS_ERR_NONE              The call was successful and the message was sent
+*                             OS_ERR_MSG_POOL_EMPTY    If there are no more OS_MSGs available from the pool
+*                             OS_ERR_OPT_INVALID       If you specified an invalid option
+*                             OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*                             OS_ERR_Q_MAX             If the queue is full
+*                             OS_ERR_INT_Q_FULL        If the post was deferred and the ISR queue is full
+*                             OS_ERR_STATE_INVALID     If the task is in an invalid state.  This should never happen
+*                                                      and if it does, would be considered a system failure
 *
 * Returns    : none
 *
-* Note(s)    : none
+* Note(s)    : 1) When OS_CFG_ISR_POST_DEFERRED_EN is enabled, a post from an ISR is performed by the ISR handler task.
+*                 A NULL 'p_tcb' then designates the task that was interrupted.
 ************************************************************************************************************************
 */
 
-#if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
-void  OSTaskRegSet (OS_TCB     *p_tcb,
-                    OS_REG_ID   id,
-                    OS_REG      value,
-                    OS_ERR     *p_err)
+#if (OS_CFG_TASK_Q_EN > 0u)
+void  OSTaskQPost (OS_TCB       *p_tcb,
+                   void         *p_void,
+                   OS_MSG_SIZE   msg_size,
+                   OS_OPT        opt,
+                   OS_ERR       *p_err)
 {
+    CPU_TS  ts;
+#if (OS_CFG_MEM_BUF_EN > 0u) && (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    OS_ERR  err;
+#endif
     CPU_SR_ALLOC();
 
 
-
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == (OS_ERR *)0) {
         OS_SAFETY_CRITICAL_EXCEPTION();
@@ -1325,57 +2051,207 @@ void  OSTaskRegSet (OS_TCB     *p_tcb,
     }
 #endif
 
-#if (OS_CFG_ARG_CHK_EN > 0u)
-    if (id >= OS_CFG_TASK_REG_TBL_SIZE) {
-       *p_err = OS_ERR_REG_ID_INVALID;
+    OS_TRACE_TASK_MSG_Q_POST_ENTER(&p_tcb->MsgQ, p_void, msg_size, opt);
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+        OS_TRACE_TASK_MSG_Q_POST_EXIT(OS_ERR_OS_NOT_RUNNING);
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)                                    /* ---------------- VALIDATE ARGUMENTS ---------------- */
+#if (OS_CFG_Q_PRIO_EN > 0u)
+    if (OS_OPT_POST_PRIO_GET(opt) >= OS_CFG_Q_PRIO_LVL_NBR) {   /* Validate the message priority level                  */
+        OS_TRACE_TASK_MSG_Q_POST_FAILED(&p_tcb->MsgQ);
+        OS_TRACE_TASK_MSG_Q_POST_EXIT(OS_ERR_OPT_INVALID);
+       *p_err = OS_ERR_OPT_INVALID;
+        return;
+    }
+#endif
+    switch (opt & (OS_OPT)~(OS_OPT)(OS_OPT_POST_PRIO_MASK | OS_OPT_POST_MEM_BUF_REF)) { /* User must supply a valid opt */
+        case OS_OPT_POST_FIFO:
+        case OS_OPT_POST_LIFO:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+             OS_TRACE_TASK_MSG_Q_POST_FAILED(&p_tcb->MsgQ);
+             OS_TRACE_TASK_MSG_Q_POST_EXIT(OS_ERR_OPT_INVALID);
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Defer the post when called from an ISR               */
+        if (p_tcb == (OS_TCB *)0) {                             /* 'self' is the task that was interrupted              */
+            p_tcb = OSTCBCurPtr;
+        }
+#if (OS_CFG_MEM_BUF_EN > 0u)
+        if ((opt & OS_OPT_POST_MEM_BUF_REF) != 0u) {            /* Keep the buffer until the post is performed          */
+            (void)OS_MemBufRefAdd(p_void);
+        }
+#endif
+        OS_IntQPost(OS_OBJ_TYPE_TASK_MSG,
+                    (void *)p_tcb,
+                    p_void,
+                    msg_size,
+                    0u,
+                    opt,
+                    p_err);
+#if (OS_CFG_MEM_BUF_EN > 0u)
+        if (((opt & OS_OPT_POST_MEM_BUF_REF) != 0u) &&
+            (*p_err != OS_ERR_NONE)) {
+            OSMemBufRelease(p_void, &err);
+        }
+#endif
+        OS_TRACE_TASK_MSG_Q_POST_EXIT(*p_err);
         return;
     }
 #endif
 
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    OS_TRACE_TASK_MSG_Q_POST(&p_tcb->MsgQ);
+
+   *p_err = OS_ERR_NONE;                                        /* Assume we won't have any errors                      */
     CPU_CRITICAL_ENTER();
-    if (p_tcb == (OS_TCB *)0) {
+    if (p_tcb == (OS_TCB *)0) {                                 /* Post msg to 'self'?                                  */
         p_tcb = OSTCBCurPtr;
     }
-    p_tcb->RegTbl[id] = value;
-    CPU_CRITICAL_EXIT();
-   *p_err             = OS_ERR_NONE;
+    switch (p_tcb->TaskState) {
+        case OS_TASK_STATE_RDY:
+        case OS_TASK_STATE_DLY:
+        case OS_TASK_STATE_SUSPENDED:
+        case OS_TASK_STATE_DLY_SUSPENDED:
+             OS_MsgQPut(&p_tcb->MsgQ,                           /* Deposit the message in the queue                     */
+                        p_void,
+                        msg_size,
+                        opt,
+                        ts,
+                        p_err);
+#if (OS_CFG_MEM_BUF_EN > 0u)
+             if (((opt & OS_OPT_POST_MEM_BUF_REF) != 0u) &&     /* Add a reference for the message queued               */
+                 (*p_err == OS_ERR_NONE)) {
+                 (void)OS_MemBufRefAdd(p_void);
+             }
+#endif
+             CPU_CRITICAL_EXIT();
+             break;
+
+        case OS_TASK_STATE_PEND:
+        case OS_TASK_STATE_PEND_TIMEOUT:
+        case OS_TASK_STATE_PEND_SUSPENDED:
+        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
+             if (p_tcb->PendOn == OS_TASK_PEND_ON_TASK_Q) {     /* Is task waiting for a message to be sent to it?      */
+#if (OS_CFG_MEM_BUF_EN > 0u)
+                 if ((opt & OS_OPT_POST_MEM_BUF_REF) != 0u) {   /* Add a reference for the task readied                 */
+                     (void)OS_MemBufRefAdd(p_void);
+                 }
+#endif
+                 OS_Post((OS_PEND_OBJ *)0,
+                          p_tcb,
+                          p_void,
+                          msg_size,
+                          ts);
+                 CPU_CRITICAL_EXIT();
+                 if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+                     OSSched();                                 /* Run the scheduler                                    */
+                 }
+             } else {
+                 OS_MsgQPut(&p_tcb->MsgQ,                       /* No,  Task is pending on something else ...           */
+                            p_void,                             /* ... Deposit the message in the task's queue          */
+                            msg_size,
+                            opt,
+                            ts,
+                            p_err);
+#if (OS_CFG_MEM_BUF_EN > 0u)
+                 if (((opt & OS_OPT_POST_MEM_BUF_REF) != 0u) && /* Add a reference for the message queued               */
+                     (*p_err == OS_ERR_NONE)) {
+                     (void)OS_MemBufRefAdd(p_void);
+                 }
+#endif
+                 CPU_CRITICAL_EXIT();
+             }
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_STATE_INVALID;
+             break;
+    }
+
+    OS_TRACE_TASK_MSG_Q_POST_EXIT(*p_err);
 }
 #endif
 
 
 /*
 ************************************************************************************************************************
-*                                               RESUME A SUSPENDED TASK
+*                                          POST A BATCH OF MESSAGES TO A TASK
 *
-* Description: This function is called to resume a previously suspended task.  This is the only call that will remove an
-*              explicit task suspension.
+* Description: This function sends 'nbr_msgs' messages to a task in a single call.  If the task is waiting on its
+*              message queue it is handed the first message and the others are placed in its queue.  The kernel is
+*              entered only once and the scheduler is run at most once, whatever the number of messages.
 *
-* Arguments  : p_tcb      Is a pointer to the task's OS_TCB to resume
+* Arguments  : p_tcb      is a pointer to the TCB of the task receiving the messages.  If you specify a NULL pointer
+*                         then the messages will be posted to the task's queue of the calling task.
 *
-*              p_err      Is a pointer to a variable that will contain an error code returned by this function
+*              p_msg_tbl  is a pointer to an array of 'nbr_msgs' message descriptors.  Each entry holds the pointer to
+*                         a message ('.MsgPtr') and its size in bytes ('.MsgSize').
 *
-*                             OS_ERR_NONE                  If the requested task is resumed
-*                             OS_ERR_OS_NOT_RUNNING        If uC/OS-III is not running yet
-*                             OS_ERR_STATE_INVALID         If the task is in an invalid state
-*                             OS_ERR_TASK_NOT_SUSPENDED    If the task to resume has not been suspended
-*                             OS_ERR_TASK_RESUME_ISR       If you called this function from an ISR
-*                             OS_ERR_TASK_RESUME_SELF      You cannot resume 'self'
+*              nbr_msgs   is the number of entries in 'p_msg_tbl'
+*
+*              opt        specifies whether the post will be FIFO or LIFO:
+*
+*                             OS_OPT_POST_FIFO       Post at the end   of the queue, in table order
+*                             OS_OPT_POST_LIFO       Post at the front of the queue, as if each entry had been posted
+*                                                    in turn with OSTaskQPost()
+*
+*                             OS_OPT_POST_NO_SCHED   Do not run the scheduler after the post
+*
+*                          Note(s): 1) OS_OPT_POST_NO_SCHED can be added with one of the other options.
+*                                   2) When OS_CFG_Q_PRIO_EN is enabled, OS_OPT_POST_PRIO(lvl) can also be added to
+*                                      queue the message(s) at priority level 'lvl' (see OSQPost()).
+*
+*
+*              p_err      is a pointer to a variable that will hold the error code associated
+*                         with the outcome of this call.  Errors can be:
+*
+*                             OS_ERR_NONE              The call was successful and the messages were sent
+*                             OS_ERR_MSG_POOL_EMPTY    If there are not enough OS_MSGs available from the pool
+*                             OS_ERR_OPT_INVALID       If you specified an invalid option
+*                             OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*                             OS_ERR_PTR_INVALID       If 'p_msg_tbl' is a NULL pointer
+*                             OS_ERR_Q_MAX             If the queue cannot hold the messages
+*                             OS_ERR_STATE_INVALID     If the task is in an invalid state.  This should never happen
+*                                                      and if it does, would be considered a system failure
 *
 * Returns    : none
 *
-* Note(s)    : none
+* Note(s)    : 1) Either all the messages are sent or, upon error, none of them are.
 ************************************************************************************************************************
 */
 
-#if (OS_CFG_TASK_SUSPEND_EN > 0u)
-void  OSTaskResume (OS_TCB  *p_tcb,
-                    OS_ERR  *p_err)
+#if (OS_CFG_TASK_Q_EN > 0u) && (OS_CFG_TASK_Q_POST_N_EN > 0u)
+void  OSTaskQPostN (OS_TCB        *p_tcb,
+                    OS_MSG_ENTRY  *p_msg_tbl,
+                    OS_MSG_QTY     nbr_msgs,
+                    OS_OPT         opt,
+                    OS_ERR        *p_err)
 {
+    OS_MSG_QTY   nbr_direct;
+    CPU_TS       ts;
     CPU_SR_ALLOC();
 
 
-    OS_TRACE_TASK_RESUME_ENTER(p_tcb);
-
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == (OS_ERR *)0) {
         OS_SAFETY_CRITICAL_EXCEPTION();
@@ -1383,344 +2259,226 @@ void  OSTaskResume (OS_TCB  *p_tcb,
     }
 #endif
 
-#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
-    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
-       *p_err = OS_ERR_TASK_RESUME_ISR;
-        OS_TRACE_TASK_RESUME_EXIT(OS_ERR_TASK_RESUME_ISR);
-        return;
-    }
-#endif
+    OS_TRACE_TASK_MSG_Q_POST_ENTER(&p_tcb->MsgQ, (void *)p_msg_tbl, 0u, opt);
 
 #if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
     if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+        OS_TRACE_TASK_MSG_Q_POST_EXIT(OS_ERR_OS_NOT_RUNNING);
        *p_err = OS_ERR_OS_NOT_RUNNING;
-        OS_TRACE_TASK_RESUME_EXIT(OS_ERR_OS_NOT_RUNNING);
         return;
     }
 #endif
 
+#if (OS_CFG_ARG_CHK_EN > 0u)                                    /* ---------------- VALIDATE ARGUMENTS ---------------- */
+    if (p_msg_tbl == (OS_MSG_ENTRY *)0) {                       /* Validate 'p_msg_tbl'                                 */
+        OS_TRACE_TASK_MSG_Q_POST_FAILED(&p_tcb->MsgQ);
+        OS_TRACE_TASK_MSG_Q_POST_EXIT(OS_ERR_PTR_INVALID);
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+#if (OS_CFG_Q_PRIO_EN > 0u)
+    if (OS_OPT_POST_PRIO_GET(opt) >= OS_CFG_Q_PRIO_LVL_NBR) {   /* Validate the message priority level                  */
+        OS_TRACE_TASK_MSG_Q_POST_FAILED(&p_tcb->MsgQ);
+        OS_TRACE_TASK_MSG_Q_POST_EXIT(OS_ERR_OPT_INVALID);
+       *p_err = OS_ERR_OPT_INVALID;
+        return;
+    }
+#endif
+    switch (opt & (OS_OPT)~OS_OPT_POST_PRIO_MASK) {             /* User must supply a valid option                      */
+        case OS_OPT_POST_FIFO:
+        case OS_OPT_POST_LIFO:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED:
+             break;
 
-#if (OS_CFG_ARG_CHK_EN > 0u)
-    CPU_CRITICAL_ENTER();
-    if ((p_tcb == (OS_TCB *)0) ||                               /* We cannot resume 'self'                              */
-        (p_tcb == OSTCBCurPtr)) {
-        CPU_CRITICAL_EXIT();
-       *p_err = OS_ERR_TASK_RESUME_SELF;
-        OS_TRACE_TASK_RESUME_EXIT(OS_ERR_TASK_RESUME_SELF);
+        default:
+             OS_TRACE_TASK_MSG_Q_POST_FAILED(&p_tcb->MsgQ);
+             OS_TRACE_TASK_MSG_Q_POST_EXIT(OS_ERR_OPT_INVALID);
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+    if (nbr_msgs == 0u) {                                       /* Nothing to send                                      */
+        OS_TRACE_TASK_MSG_Q_POST_EXIT(OS_ERR_NONE);
+       *p_err = OS_ERR_NONE;
         return;
     }
-    CPU_CRITICAL_EXIT();
+
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
 #endif
 
+    OS_TRACE_TASK_MSG_Q_POST(&p_tcb->MsgQ);
+
     CPU_CRITICAL_ENTER();
-   *p_err = OS_ERR_NONE;
+    if (p_tcb == (OS_TCB *)0) {                                 /* Post msgs to 'self'?                                 */
+        p_tcb = OSTCBCurPtr;
+    }
     switch (p_tcb->TaskState) {
         case OS_TASK_STATE_RDY:
         case OS_TASK_STATE_DLY:
+        case OS_TASK_STATE_SUSPENDED:
+        case OS_TASK_STATE_DLY_SUSPENDED:
+             nbr_direct = 0u;
+             break;
+
         case OS_TASK_STATE_PEND:
         case OS_TASK_STATE_PEND_TIMEOUT:
-             CPU_CRITICAL_EXIT();
-            *p_err = OS_ERR_TASK_NOT_SUSPENDED;
-             OS_TRACE_TASK_RESUME_EXIT(OS_ERR_TASK_NOT_SUSPENDED);
-             break;
-
-        case OS_TASK_STATE_SUSPENDED:
-             p_tcb->SuspendCtr--;
-             if (p_tcb->SuspendCtr == 0u) {
-                 p_tcb->TaskState = OS_TASK_STATE_RDY;
-                 OS_RdyListInsert(p_tcb);                       /* Insert the task in the ready list                    */
-                 OS_TRACE_TASK_RESUME(p_tcb);
-             }
-             CPU_CRITICAL_EXIT();
-             break;
-
-        case OS_TASK_STATE_DLY_SUSPENDED:
-             p_tcb->SuspendCtr--;
-             if (p_tcb->SuspendCtr == 0u) {
-                 p_tcb->TaskState = OS_TASK_STATE_DLY;
-             }
-             CPU_CRITICAL_EXIT();
-             break;
-
-        case OS_TASK_STATE_PEND_SUSPENDED:
-             p_tcb->SuspendCtr--;
-             if (p_tcb->SuspendCtr == 0u) {
-                 p_tcb->TaskState = OS_TASK_STATE_PEND;
-             }
-             CPU_CRITICAL_EXIT();
-             break;
-
-        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
-             p_tcb->SuspendCtr--;
-             if (p_tcb->SuspendCtr == 0u) {
-                 p_tcb->TaskState = OS_TASK_STATE_PEND_TIMEOUT;
-             }
-             CPU_CRITICAL_EXIT();
+        case OS_TASK_STATE_PEND_SUSPENDED:
+        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
+             if (p_tcb->PendOn == OS_TASK_PEND_ON_TASK_Q) {     /* Is task waiting for a message to be sent to it?      */
+                 nbr_direct = 1u;                               /* Yes, the first message is handed to the task         */
+             } else {
+                 nbr_direct = 0u;
+             }
              break;
 
         default:
              CPU_CRITICAL_EXIT();
             *p_err = OS_ERR_STATE_INVALID;
-             OS_TRACE_TASK_RESUME_EXIT(OS_ERR_STATE_INVALID);
-             break;
+             OS_TRACE_TASK_MSG_Q_POST_EXIT(*p_err);
+             return;
     }
 
-    if (*p_err != OS_ERR_NONE) {                                /* Don't schedule if task wasn't in a suspend state.    */
+    OS_MsgQPutN(&p_tcb->MsgQ,                                   /* Deposit the other messages in the task's queue       */
+                &p_msg_tbl[nbr_direct],
+                nbr_msgs - nbr_direct,
+                opt,
+                ts,
+                p_err);
+    if (*p_err != OS_ERR_NONE) {                                /* Nothing was sent if they don't all fit               */
+        CPU_CRITICAL_EXIT();
+        OS_TRACE_TASK_MSG_Q_POST_EXIT(*p_err);
         return;
     }
 
-    OSSched();
-    OS_TRACE_TASK_RESUME_EXIT(OS_ERR_NONE);
+    if (nbr_direct > 0u) {
+        OS_Post((OS_PEND_OBJ *)0,
+                 p_tcb,
+                 p_msg_tbl[0].MsgPtr,
+                 p_msg_tbl[0].MsgSize,
+                 ts);
+        CPU_CRITICAL_EXIT();
+        if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+            OSSched();                                          /* Run the scheduler once for the whole batch           */
+        }
+    } else {
+        CPU_CRITICAL_EXIT();
+    }
+
+    OS_TRACE_TASK_MSG_Q_POST_EXIT(*p_err);
 }
 #endif
 
 
 /*
 ************************************************************************************************************************
-*                                              WAIT FOR A TASK SEMAPHORE
+*                                     GET THE STATISTICS OF A TASK'S MESSAGE QUEUE
 *
-* Description: This function is called to block the current task until a signal is sent by another task or ISR.
+* Description: This function copies the residency and depth statistics of the message queue of a task and optionally
+*              clears them.
 *
-* Arguments  : timeout       is the amount of time you are will to wait for the signal
+* Arguments  : p_tcb     is a pointer to the TCB of the task.  A NULL pointer specifies the current task.
 *
-*              opt           determines whether the user wants to block if a semaphore post was not received:
+*              p_stat    is a pointer to where the statistics will be copied
 *
-*                                OS_OPT_PEND_BLOCKING
-*                                OS_OPT_PEND_NON_BLOCKING
+*              opt       determines whether the statistics are cleared after being copied:
 *
-*              p_ts          is a pointer to a variable that will receive the timestamp of when the semaphore was posted
-*                            or pend aborted.  If you pass a NULL pointer (i.e. (CPU_TS *)0) then you will not get the
-*                            timestamp.  In other words, passing a NULL pointer is valid and indicates that you don't
-*                            need the timestamp.
+*                            OS_OPT_MSG_Q_STAT_NONE     Only copy the statistics
+*                            OS_OPT_MSG_Q_STAT_RESET    Copy, then clear the statistics
 *
-*              p_err         is a pointer to an error code that will be set by this function
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
 *
-*                                OS_ERR_NONE                The call was successful and your task received a message
-*                                OS_ERR_OPT_INVALID         You specified an invalid option
-*                                OS_ERR_OS_NOT_RUNNING      If uC/OS-III is not running yet
-*                                OS_ERR_PEND_ABORT          If the pend was aborted
-*                                OS_ERR_PEND_ISR            If you called this function from an ISR
-*                                OS_ERR_PEND_WOULD_BLOCK    If you specified non-blocking but no signal was received
-*                                OS_ERR_SCHED_LOCKED        If the scheduler is locked
-*                                OS_ERR_STATUS_INVALID      If the pend status is invalid
-*                                OS_ERR_TIMEOUT             A message was not received within the specified timeout
+*                            OS_ERR_NONE                The statistics were copied
+*                            OS_ERR_OPT_INVALID         You specified an invalid option
+*                            OS_ERR_PTR_INVALID         If 'p_stat' is a NULL pointer
+*                            OS_ERR_TASK_NOT_EXIST      If the task doesn't exist
 *
-* Returns    : The current count of signals the task received, 0 if none.
+* Returns    : none
 *
-* Note(s)    : This API 'MUST NOT' be called from a timer callback function.
+* Note(s)    : 1) See OSQStatGet().
 ************************************************************************************************************************
 */
 
-OS_SEM_CTR  OSTaskSemPend (OS_TICK   timeout,
-                           OS_OPT    opt,
-                           CPU_TS   *p_ts,
-                           OS_ERR   *p_err)
+#if (OS_CFG_TASK_Q_EN > 0u) && (OS_CFG_MSG_Q_STAT_EN > 0u)
+void  OSTaskQStatGet (OS_TCB         *p_tcb,
+                      OS_MSG_Q_STAT  *p_stat,
+                      OS_OPT          opt,
+                      OS_ERR         *p_err)
 {
-    OS_SEM_CTR    ctr;
     CPU_SR_ALLOC();
 
 
-#if (OS_CFG_TS_EN == 0u)
-    (void)p_ts;                                                 /* Prevent compiler warning for not using 'ts'          */
-#endif
 
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == (OS_ERR *)0) {
         OS_SAFETY_CRITICAL_EXCEPTION();
-        return (0u);
-    }
-#endif
-
-    OS_TRACE_TASK_SEM_PEND_ENTER(OSTCBCurPtr, timeout, opt, p_ts);
-
-#if (OS_CFG_TICK_EN == 0u)
-    if (timeout != 0u) {
-        OS_TRACE_TASK_SEM_PEND_FAILED(OSTCBCurPtr);
-        OS_TRACE_TASK_SEM_PEND_EXIT(OS_ERR_TICK_DISABLED);
-       *p_err = OS_ERR_TICK_DISABLED;
-        return (0u);
-    }
-#endif
-
-#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
-    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
-        OS_TRACE_TASK_SEM_PEND_FAILED(OSTCBCurPtr);
-        OS_TRACE_TASK_SEM_PEND_EXIT(OS_ERR_PEND_ISR);
-       *p_err = OS_ERR_PEND_ISR;
-        return (0u);
-    }
-#endif
-
-#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
-    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
-        OS_TRACE_TASK_SEM_PEND_EXIT(OS_ERR_OS_NOT_RUNNING);
-       *p_err = OS_ERR_OS_NOT_RUNNING;
-        return (0u);
+        return;
     }
 #endif
 
 #if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_stat == (OS_MSG_Q_STAT *)0) {                         /* User must specify a valid destination                */
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
     switch (opt) {                                              /* Validate 'opt'                                       */
-        case OS_OPT_PEND_BLOCKING:
-        case OS_OPT_PEND_NON_BLOCKING:
+        case OS_OPT_MSG_Q_STAT_NONE:
+        case OS_OPT_MSG_Q_STAT_RESET:
              break;
 
         default:
-             OS_TRACE_TASK_SEM_PEND_FAILED(OSTCBCurPtr);
-             OS_TRACE_TASK_SEM_PEND_EXIT(OS_ERR_OPT_INVALID);
             *p_err = OS_ERR_OPT_INVALID;
-             return (0u);
+             return;
     }
 #endif
 
     CPU_CRITICAL_ENTER();
-    if (OSTCBCurPtr->SemCtr > 0u) {                             /* See if task already been signaled                    */
-        OSTCBCurPtr->SemCtr--;
-        ctr = OSTCBCurPtr->SemCtr;
-#if (OS_CFG_TS_EN > 0u)
-        if (p_ts != (CPU_TS *)0) {
-           *p_ts  = OSTCBCurPtr->TS;
-        }
-#if (OS_CFG_TASK_PROFILE_EN > 0u)
-#if (OS_CFG_TS_EN > 0u)
-        OSTCBCurPtr->SemPendTime = OS_TS_GET() - OSTCBCurPtr->TS;
-        if (OSTCBCurPtr->SemPendTimeMax < OSTCBCurPtr->SemPendTime) {
-            OSTCBCurPtr->SemPendTimeMax = OSTCBCurPtr->SemPendTime;
-        }
-#endif
-#endif
-#endif
-        OS_TRACE_TASK_SEM_PEND(OSTCBCurPtr);
-        CPU_CRITICAL_EXIT();
-        OS_TRACE_TASK_SEM_PEND_EXIT(OS_ERR_NONE);
-       *p_err = OS_ERR_NONE;
-        return (ctr);
+    if (p_tcb == (OS_TCB *)0) {                                 /* Get the statistics of the current task?              */
+        p_tcb = OSTCBCurPtr;                                    /* Yes                                                  */
     }
 
-    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+    if (p_tcb->TaskState == OS_TASK_STATE_DEL) {                /* Make sure task exist                                 */
         CPU_CRITICAL_EXIT();
-#if (OS_CFG_TS_EN > 0u)
-        if (p_ts != (CPU_TS *)0) {
-            *p_ts  = 0u;
-        }
-#endif
-        OS_TRACE_TASK_SEM_PEND_FAILED(OSTCBCurPtr);
-        OS_TRACE_TASK_SEM_PEND_EXIT(OS_ERR_PEND_WOULD_BLOCK);
-       *p_err = OS_ERR_PEND_WOULD_BLOCK;                        /* No                                                   */
-        return (0u);
-    } else {                                                    /* Yes                                                  */
-        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
-#if (OS_CFG_TS_EN > 0u)
-            if (p_ts != (CPU_TS *)0) {
-               *p_ts  = 0u;
-            }
-#endif
-            CPU_CRITICAL_EXIT();
-            OS_TRACE_TASK_SEM_PEND_FAILED(OSTCBCurPtr);
-            OS_TRACE_TASK_SEM_PEND_EXIT(OS_ERR_SCHED_LOCKED);
-           *p_err = OS_ERR_SCHED_LOCKED;
-            return (0u);
-        }
+       *p_err = OS_ERR_TASK_NOT_EXIST;
+        return;
     }
 
-    OS_Pend((OS_PEND_OBJ *)0,                                   /* Block task pending on Signal                         */
-             OSTCBCurPtr,
-             OS_TASK_PEND_ON_TASK_SEM,
-             timeout);
-    CPU_CRITICAL_EXIT();
-    OS_TRACE_TASK_SEM_PEND_BLOCK(OSTCBCurPtr);
-    OSSched();                                                  /* Find next highest priority task ready to run         */
-
-    CPU_CRITICAL_ENTER();
-    switch (OSTCBCurPtr->PendStatus) {                          /* See if we timed-out or aborted                       */
-        case OS_STATUS_PEND_OK:
-#if (OS_CFG_TS_EN > 0u)
-             if (p_ts != (CPU_TS *)0) {
-                *p_ts                    =  OSTCBCurPtr->TS;
-#if (OS_CFG_TASK_PROFILE_EN > 0u)
-#if (OS_CFG_TS_EN > 0u)
-                OSTCBCurPtr->SemPendTime = OS_TS_GET() - OSTCBCurPtr->TS;
-                if (OSTCBCurPtr->SemPendTimeMax < OSTCBCurPtr->SemPendTime) {
-                    OSTCBCurPtr->SemPendTimeMax = OSTCBCurPtr->SemPendTime;
-                }
-#endif
-#endif
-             }
-#endif
-             OS_TRACE_TASK_SEM_PEND(OSTCBCurPtr);
-            *p_err = OS_ERR_NONE;
-             break;
-
-        case OS_STATUS_PEND_ABORT:
-#if (OS_CFG_TS_EN > 0u)
-             if (p_ts != (CPU_TS *)0) {
-                *p_ts = OSTCBCurPtr->TS;
-             }
-#endif
-             OS_TRACE_TASK_SEM_PEND_FAILED(OSTCBCurPtr);
-            *p_err = OS_ERR_PEND_ABORT;                         /* Indicate that we aborted                             */
-             break;
-
-        case OS_STATUS_PEND_TIMEOUT:
-#if (OS_CFG_TS_EN > 0u)
-             if (p_ts != (CPU_TS *)0) {
-                *p_ts = 0u;
-             }
-#endif
-             OS_TRACE_TASK_SEM_PEND_FAILED(OSTCBCurPtr);
-            *p_err = OS_ERR_TIMEOUT;                            /* Indicate that we didn't get event within TO          */
-             break;
-
-        default:
-             OS_TRACE_TASK_SEM_PEND_FAILED(OSTCBCurPtr);
-            *p_err = OS_ERR_STATUS_INVALID;
-             break;
-    }
-    ctr = OSTCBCurPtr->SemCtr;
+    OS_MsgQStatGet(&p_tcb->MsgQ, p_stat, opt);
     CPU_CRITICAL_EXIT();
-    OS_TRACE_TASK_SEM_PEND_EXIT(*p_err);
-    return (ctr);
+   *p_err = OS_ERR_NONE;
 }
 
 
 /*
 ************************************************************************************************************************
-*                                               ABORT WAITING FOR A SIGNAL
-*
-* Description: This function aborts & readies the task specified.  This function should be used to fault-abort the wait
-*              for a signal, rather than to normally post the signal to the task via OSTaskSemPost().
+*                                SET THE RESIDENCY THRESHOLD OF A TASK'S MESSAGE QUEUE
 *
-* Arguments  : p_tcb     is a pointer to the task to pend abort
+* Description: This function sets the residency above which the extraction of a message from the message queue of a
+*              task is counted in '.ResOvrNbr' and traced with OS_TRACE_MSG_Q_RES_OVR().
 *
-*              opt       provides options for this function:
+* Arguments  : p_tcb       is a pointer to the TCB of the task.  A NULL pointer specifies the current task.
 *
-*                            OS_OPT_POST_NONE         No option selected
-*                            OS_OPT_POST_NO_SCHED     Indicates that the scheduler will not be called.
+*              threshold   is the residency, in OS_TS_GET() units.  0 disables the check.
 *
-*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
 *
-*                            OS_ERR_NONE               If the task was readied and informed of the aborted wait
-*                            OS_ERR_OPT_INVALID        You specified an invalid option
-*                            OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
-*                            OS_ERR_PEND_ABORT_ISR     If you tried calling this function from an ISR
-*                            OS_ERR_PEND_ABORT_NONE    If the task was not waiting for a signal
-*                            OS_ERR_PEND_ABORT_SELF    If you attempted to pend abort the calling task.  This is not
-*                                                      possible since the calling task cannot be pending because it's
-*                                                      running
+*                              OS_ERR_NONE                The threshold was set
+*                              OS_ERR_TASK_NOT_EXIST      If the task doesn't exist
 *
-* Returns    : == OS_FALSE   if task was not waiting for a message, or upon error.
-*              == OS_TRUE    if task was waiting for a message and was readied and informed.
+* Returns    : none
 *
-* Note(s)    : none
+* Note(s)    : 1) The threshold is cleared when the task is created.
 ************************************************************************************************************************
 */
 
-#if (OS_CFG_TASK_SEM_PEND_ABORT_EN > 0u)
-CPU_BOOLEAN  OSTaskSemPendAbort (OS_TCB  *p_tcb,
-                                 OS_OPT   opt,
-                                 OS_ERR  *p_err)
+void  OSTaskQStatThresholdSet (OS_TCB  *p_tcb,
+                               CPU_TS   threshold,
+                               OS_ERR  *p_err)
 {
-    CPU_TS  ts;
     CPU_SR_ALLOC();
 
 
@@ -1728,108 +2486,63 @@ CPU_BOOLEAN  OSTaskSemPendAbort (OS_TCB  *p_tcb,
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == (OS_ERR *)0) {
         OS_SAFETY_CRITICAL_EXCEPTION();
-        return (OS_FALSE);
+        return;
     }
 #endif
 
-#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
-    if (OSIntNestingCtr > 0u) {                                 /* See if called from ISR ...                           */
-       *p_err = OS_ERR_PEND_ABORT_ISR;                          /* ... can't Pend Abort from an ISR                     */
-        return (OS_FALSE);
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {
+        p_tcb = OSTCBCurPtr;
     }
-#endif
 
-#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
-    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
-       *p_err = OS_ERR_OS_NOT_RUNNING;
-        return (OS_FALSE);
-    }
-#endif
-
-#if (OS_CFG_ARG_CHK_EN > 0u)
-    switch (opt) {                                              /* Validate 'opt'                                       */
-        case OS_OPT_POST_NONE:
-        case OS_OPT_POST_NO_SCHED:
-             break;
-
-        default:
-            *p_err = OS_ERR_OPT_INVALID;
-             return (OS_FALSE);
-    }
-#endif
-
-    CPU_CRITICAL_ENTER();
-    if ((p_tcb == (OS_TCB *)0) ||                               /* Pend abort self?                                     */
-        (p_tcb == OSTCBCurPtr)) {
-        CPU_CRITICAL_EXIT();                                    /* ... doesn't make sense!                              */
-       *p_err = OS_ERR_PEND_ABORT_SELF;
-        return (OS_FALSE);
-    }
-
-    if (p_tcb->PendOn != OS_TASK_PEND_ON_TASK_SEM) {            /* Is task waiting for a signal?                        */
+    if (p_tcb->TaskState == OS_TASK_STATE_DEL) {                /* Make sure task exist                                 */
         CPU_CRITICAL_EXIT();
-       *p_err = OS_ERR_PEND_ABORT_NONE;
-        return (OS_FALSE);
+       *p_err = OS_ERR_TASK_NOT_EXIST;
+        return;
     }
-    CPU_CRITICAL_EXIT();
 
-    CPU_CRITICAL_ENTER();
-#if (OS_CFG_TS_EN > 0u)
-    ts = OS_TS_GET();
-#else
-    ts = 0u;
-#endif
-    OS_PendAbort(p_tcb,                                         /* Abort the pend                                       */
-                 ts,
-                 OS_STATUS_PEND_ABORT);
+    p_tcb->MsgQ.Stat.ResThreshold = threshold;
     CPU_CRITICAL_EXIT();
-    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
-        OSSched();                                              /* Run the scheduler                                    */
-    }
    *p_err = OS_ERR_NONE;
-    return (OS_TRUE);
 }
 #endif
 
 
 /*
 ************************************************************************************************************************
-*                                                    SIGNAL A TASK
-*
-* Description: This function is called to signal a task waiting for a signal.
+*                                       GET THE CURRENT VALUE OF A TASK REGISTER
 *
-* Arguments  : p_tcb     is the pointer to the TCB of the task to signal.  A NULL pointer indicates that you are sending
-*                        a signal to yourself.
+* Description: This function is called to obtain the current value of a task register.  Task registers are application
+*              specific and can be used to store task specific values such as 'error numbers' (i.e. errno), statistics,
+*              etc.
 *
-*              opt       determines the type of POST performed:
+* Arguments  : p_tcb     is a pointer to the OS_TCB of the task you want to read the register from.  If 'p_tcb' is a
+*                        NULL pointer then you will get the register of the current task.
 *
-*                             OS_OPT_POST_NONE         No option
-*                             OS_OPT_POST_NO_SCHED     Do not call the scheduler
+*              id        is the 'id' of the desired task variable.  Note that the 'id' must be less than
+*                        OS_CFG_TASK_REG_TBL_SIZE
 *
-*              p_err     is a pointer to an error code returned by this function:
+*              p_err     is a pointer to a variable that will hold an error code related to this call.
 *
-*                            OS_ERR_NONE              If the requested task is signaled
-*                            OS_ERR_OPT_INVALID       If you specified an invalid option
-*                            OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
-*                            OS_ERR_SEM_OVF           If the post would cause the semaphore count to overflow
-*                            OS_ERR_STATE_INVALID     If the task is in an invalid state.  This should never happen
-*                                                     and if it does, would be considered a system failure
+*                            OS_ERR_NONE               If the call was successful
+*                            OS_ERR_REG_ID_INVALID     If the 'id' is not between 0 and OS_CFG_TASK_REG_TBL_SIZE-1
 *
-* Returns    : The current value of the task's signal counter or 0 if called from an ISR
+* Returns    : The current value of the task's register or 0 if an error is detected.
 *
 * Note(s)    : none
 ************************************************************************************************************************
 */
 
-OS_SEM_CTR  OSTaskSemPost (OS_TCB  *p_tcb,
-                           OS_OPT   opt,
-                           OS_ERR  *p_err)
+#if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
+OS_REG  OSTaskRegGet (OS_TCB     *p_tcb,
+                      OS_REG_ID   id,
+                      OS_ERR     *p_err)
 {
-    OS_SEM_CTR  ctr;
-    CPU_TS      ts;
+    OS_REG     value;
     CPU_SR_ALLOC();
 
 
+
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == (OS_ERR *)0) {
         OS_SAFETY_CRITICAL_EXCEPTION();
@@ -1837,131 +2550,48 @@ OS_SEM_CTR  OSTaskSemPost (OS_TCB  *p_tcb,
     }
 #endif
 
-    OS_TRACE_TASK_SEM_POST_ENTER(p_tcb, opt);
-
-#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
-    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
-        OS_TRACE_TASK_SEM_POST_EXIT(OS_ERR_OS_NOT_RUNNING);
-       *p_err = OS_ERR_OS_NOT_RUNNING;
-        return (0u);
-    }
-#endif
-
 #if (OS_CFG_ARG_CHK_EN > 0u)
-    switch (opt) {                                              /* Validate 'opt'                                       */
-        case OS_OPT_POST_NONE:
-        case OS_OPT_POST_NO_SCHED:
-             break;
-
-        default:
-             OS_TRACE_TASK_SEM_POST_FAILED(p_tcb);
-             OS_TRACE_TASK_SEM_POST_EXIT(OS_ERR_OPT_INVALID);
-            *p_err =  OS_ERR_OPT_INVALID;
-             return (0u);
+    if (id >= OS_CFG_TASK_REG_TBL_SIZE) {
+       *p_err = OS_ERR_REG_ID_INVALID;
+        return (0u);
     }
 #endif
 
-#if (OS_CFG_TS_EN > 0u)
-    ts = OS_TS_GET();                                           /* Get timestamp                                        */
-#else
-    ts = 0u;
-#endif
-
-    OS_TRACE_TASK_SEM_POST(p_tcb);
-
     CPU_CRITICAL_ENTER();
-    if (p_tcb == (OS_TCB *)0) {                                 /* Post signal to 'self'?                               */
+    if (p_tcb == (OS_TCB *)0) {
         p_tcb = OSTCBCurPtr;
     }
-#if (OS_CFG_TS_EN > 0u)
-    p_tcb->TS = ts;
-#endif
-   *p_err     = OS_ERR_NONE;                                    /* Assume we won't have any errors                      */
-    switch (p_tcb->TaskState) {
-        case OS_TASK_STATE_RDY:
-        case OS_TASK_STATE_DLY:
-        case OS_TASK_STATE_SUSPENDED:
-        case OS_TASK_STATE_DLY_SUSPENDED:
-             if (p_tcb->SemCtr == (OS_SEM_CTR)-1) {
-                 CPU_CRITICAL_EXIT();
-                *p_err = OS_ERR_SEM_OVF;
-                 OS_TRACE_SEM_POST_EXIT(*p_err);
-                 return (0u);
-             }
-             p_tcb->SemCtr++;                                   /* Task signaled is not pending on anything             */
-             ctr = p_tcb->SemCtr;
-             CPU_CRITICAL_EXIT();
-             break;
-
-        case OS_TASK_STATE_PEND:
-        case OS_TASK_STATE_PEND_TIMEOUT:
-        case OS_TASK_STATE_PEND_SUSPENDED:
-        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
-             if (p_tcb->PendOn == OS_TASK_PEND_ON_TASK_SEM) {   /* Is task signaled waiting for a signal?               */
-                 OS_Post((OS_PEND_OBJ *)0,                      /* Task is pending on signal                            */
-                          p_tcb,
-                          (void *)0,
-                          0u,
-                          ts);
-                 ctr = p_tcb->SemCtr;
-                 CPU_CRITICAL_EXIT();
-                 if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
-                     OSSched();                                 /* Run the scheduler                                    */
-                 }
-             } else {
-                 if (p_tcb->SemCtr == (OS_SEM_CTR)-1) {
-                     CPU_CRITICAL_EXIT();
-                    *p_err = OS_ERR_SEM_OVF;
-                     OS_TRACE_SEM_POST_EXIT(*p_err);
-                     return (0u);
-                 }
-                 p_tcb->SemCtr++;                               /* No,  Task signaled is NOT pending on semaphore ...   */
-                 ctr = p_tcb->SemCtr;                           /* ... it must be waiting on something else             */
-                 CPU_CRITICAL_EXIT();
-             }
-             break;
-
-        default:
-             CPU_CRITICAL_EXIT();
-            *p_err = OS_ERR_STATE_INVALID;
-             ctr   = 0u;
-             break;
-    }
-
-    OS_TRACE_TASK_SEM_POST_EXIT(*p_err);
-
-    return (ctr);
+    value = p_tcb->RegTbl[id];
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+    return (value);
 }
+#endif
 
 
 /*
 ************************************************************************************************************************
-*                                            SET THE SIGNAL COUNTER OF A TASK
-*
-* Description: This function is called to clear the signal counter
-*
-* Arguments  : p_tcb      is the pointer to the TCB of the task to clear the counter.  If you specify a NULL pointer
-*                         then the signal counter of the current task will be cleared.
+*                                    ALLOCATE THE NEXT AVAILABLE TASK REGISTER ID
 *
-*              cnt        is the desired value of the semaphore counter
+* Description: This function is called to obtain a task register ID.  This function thus allows task registers IDs to be
+*              allocated dynamically instead of statically.
 *
-*              p_err      is a pointer to an error code returned by this function
+* Arguments  : p_err       is a pointer to a variable that will hold an error code related to this call.
 *
-*                             OS_ERR_NONE             If the signal counter of the requested task is set
-*                             OS_ERR_SET_ISR          If the function was called from an ISR
-*                             OS_ERR_TASK_WAITING     One or more tasks were waiting on the semaphore
+*                            OS_ERR_NONE               If the call was successful
+*                            OS_ERR_NO_MORE_ID_AVAIL   If you are attempting to assign more task register IDs than you
+*                                                          have available through OS_CFG_TASK_REG_TBL_SIZE
 *
-* Returns    : none
+* Returns    : The next available task register 'id' or OS_CFG_TASK_REG_TBL_SIZE if an error is detected.
 *
 * Note(s)    : none
 ************************************************************************************************************************
 */
 
-OS_SEM_CTR  OSTaskSemSet (OS_TCB      *p_tcb,
-                          OS_SEM_CTR   cnt,
-                          OS_ERR      *p_err)
+#if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
+OS_REG_ID  OSTaskRegGetID (OS_ERR  *p_err)
 {
-    OS_SEM_CTR  ctr;
+    OS_REG_ID  id;
     CPU_SR_ALLOC();
 
 
@@ -1969,58 +2599,46 @@ OS_SEM_CTR  OSTaskSemSet (OS_TCB      *p_tcb,
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == (OS_ERR *)0) {
         OS_SAFETY_CRITICAL_EXCEPTION();
-        return (0u);
-    }
-#endif
-
-#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
-    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
-       *p_err = OS_ERR_SET_ISR;
-        return (0u);
+        return ((OS_REG_ID)OS_CFG_TASK_REG_TBL_SIZE);
     }
 #endif
 
     CPU_CRITICAL_ENTER();
-    if (p_tcb == (OS_TCB *)0) {
-        p_tcb = OSTCBCurPtr;
-    }
-
-    if (((p_tcb->TaskState   & OS_TASK_STATE_PEND) != 0u) &&    /* Not allowed when a task is waiting.                  */
-         (p_tcb->PendOn == OS_TASK_PEND_ON_TASK_SEM)) {
+    if (OSTaskRegNextAvailID >= OS_CFG_TASK_REG_TBL_SIZE) {     /* See if we exceeded the number of IDs available       */
+       *p_err = OS_ERR_NO_MORE_ID_AVAIL;                        /* Yes, cannot allocate more task register IDs          */
         CPU_CRITICAL_EXIT();
-       *p_err = OS_ERR_TASK_WAITING;
-        return (0u);
+        return (OS_CFG_TASK_REG_TBL_SIZE);
     }
 
-    ctr           =  p_tcb->SemCtr;
-    p_tcb->SemCtr = (OS_SEM_CTR)cnt;
+    id = OSTaskRegNextAvailID;                                  /* Assign the next available ID                         */
+    OSTaskRegNextAvailID++;                                     /* Increment available ID for next request              */
     CPU_CRITICAL_EXIT();
-   *p_err         =  OS_ERR_NONE;
-    return (ctr);
+   *p_err = OS_ERR_NONE;
+    return (id);
 }
+#endif
 
 
 /*
 ************************************************************************************************************************
-*                                                    STACK CHECKING
+*                                       SET THE CURRENT VALUE OF A TASK REGISTER
 *
-* Description: This function is called to calculate the amount of free memory left on the specified task's stack.
+* Description: This function is called to change the current value of a task register.  Task registers are application
+*              specific and can be used to store task specific values such as 'error numbers' (i.e. errno), statistics,
+*              etc.
 *
-* Arguments  : p_tcb       is a pointer to the TCB of the task to check.  If you specify a NULL pointer then
-*                          you are specifying that you want to check the stack of the current task.
+* Arguments  : p_tcb     is a pointer to the OS_TCB of the task you want to set the register for.  If 'p_tcb' is a NULL
+*                        pointer then you will change the register of the current task.
 *
-*              p_free      is a pointer to a variable that will receive the number of free 'entries' on the task's stack.
+*              id        is the 'id' of the desired task register.  Note that the 'id' must be less than
+*                        OS_CFG_TASK_REG_TBL_SIZE
 *
-*              p_used      is a pointer to a variable that will receive the number of used 'entries' on the task's stack.
+*              value     is the desired value for the task register.
 *
-*              p_err       is a pointer to a variable that will contain an error code.
+*              p_err     is a pointer to a variable that will hold an error code related to this call.
 *
-*                              OS_ERR_NONE               Upon success
-*                              OS_ERR_PTR_INVALID        If either 'p_free' or 'p_used' are NULL pointers
-*                              OS_ERR_TASK_NOT_EXIST     If the stack pointer of the task is a NULL pointer
-*                              OS_ERR_TASK_OPT           If you did NOT specified OS_OPT_TASK_STK_CHK when the task
-*                                                        was created
-*                              OS_ERR_TASK_STK_CHK_ISR   You called this function from an ISR
+*                            OS_ERR_NONE               If the call was successful
+*                            OS_ERR_REG_ID_INVALID     If the 'id' is not between 0 and OS_CFG_TASK_REG_TBL_SIZE-1
 *
 * Returns    : none
 *
@@ -2028,18 +2646,16 @@ OS_SEM_CTR  OSTaskSemSet (OS_TCB      *p_tcb,
 ************************************************************************************************************************
 */
 
-#if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u)
-void  OSTaskStkChk (OS_TCB        *p_tcb,
-                    CPU_STK_SIZE  *p_free,
-                    CPU_STK_SIZE  *p_used,
-                    OS_ERR        *p_err)
+#if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
+void  OSTaskRegSet (OS_TCB     *p_tcb,
+                    OS_REG_ID   id,
+                    OS_REG      value,
+                    OS_ERR     *p_err)
 {
-    CPU_STK_SIZE  free_stk;
-    CPU_STK_SIZE  stk_size;
-    CPU_STK      *p_stk;
     CPU_SR_ALLOC();
 
 
+
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == (OS_ERR *)0) {
         OS_SAFETY_CRITICAL_EXCEPTION();
@@ -2047,797 +2663,3757 @@ void  OSTaskStkChk (OS_TCB        *p_tcb,
     }
 #endif
 
-#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
-    if (OSIntNestingCtr > 0u) {                                 /* See if trying to check stack from ISR                */
-       *p_err = OS_ERR_TASK_STK_CHK_ISR;
-        return;
-    }
-#endif
-
 #if (OS_CFG_ARG_CHK_EN > 0u)
-    if (p_free == (CPU_STK_SIZE *)0) {                          /* User must specify valid destinations for the sizes   */
-       *p_err = OS_ERR_PTR_INVALID;
-        return;
-    }
-
-    if (p_used == (CPU_STK_SIZE *)0) {
-       *p_err = OS_ERR_PTR_INVALID;
+    if (id >= OS_CFG_TASK_REG_TBL_SIZE) {
+       *p_err = OS_ERR_REG_ID_INVALID;
         return;
     }
 #endif
 
     CPU_CRITICAL_ENTER();
-    if (p_tcb == (OS_TCB *)0) {                                 /* Check the stack of the current task?                 */
-        p_tcb = OSTCBCurPtr;                                    /* Yes                                                  */
-    }
-
-    if (p_tcb->StkPtr == (CPU_STK *)0) {                        /* Make sure task exist                                 */
-        CPU_CRITICAL_EXIT();
-       *p_free = 0u;
-       *p_used = 0u;
-       *p_err  = OS_ERR_TASK_NOT_EXIST;
-        return;
-    }
-
-    if ((p_tcb->Opt & OS_OPT_TASK_STK_CHK) == 0u) {             /* Make sure stack checking option is set               */
-        CPU_CRITICAL_EXIT();
-       *p_free = 0u;
-       *p_used = 0u;
-       *p_err  = OS_ERR_TASK_OPT;
-        return;
+    if (p_tcb == (OS_TCB *)0) {
+        p_tcb = OSTCBCurPtr;
     }
-
-#if (CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO)
-    p_stk = p_tcb->StkBasePtr;                                  /* Start at the lowest memory and go up                 */
-#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
-    p_stk += OS_CFG_TASK_STK_REDZONE_DEPTH;
-#endif
-#else
-    p_stk = p_tcb->StkBasePtr + p_tcb->StkSize - 1u;            /* Start at the highest memory and go down              */
-#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
-    p_stk -= OS_CFG_TASK_STK_REDZONE_DEPTH;
-#endif
-#endif
-
-    stk_size = p_tcb->StkSize;
+    p_tcb->RegTbl[id] = value;
     CPU_CRITICAL_EXIT();
-
-    free_stk = 0u;
-                                                                /* Compute the number of zero entries on the stk        */
-#if (CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO)
-    while ((free_stk  < stk_size) &&
-           (*p_stk   ==       0u)) {
-        p_stk++;
-        free_stk++;
-    }
-#else
-    while ((free_stk  < stk_size) &&
-           (*p_stk   ==       0u)) {
-        free_stk++;
-        p_stk--;
-    }
-#endif
-   *p_free = free_stk;
-   *p_used = (stk_size - free_stk);                             /* Compute number of entries used on the stack          */
-   *p_err  = OS_ERR_NONE;
+   *p_err             = OS_ERR_NONE;
 }
 #endif
 
 
 /*
 ************************************************************************************************************************
-*                                            CHECK THE STACK REDZONE OF A TASK
+*                                               RESUME A SUSPENDED TASK
 *
-* Description: Verify a task's stack redzone.
+* Description: This function is called to resume a previously suspended task.  This is the only call that will remove an
+*              explicit task suspension.
 *
-* Arguments  : p_tcb     is a pointer to the TCB of the task to check or null for the current task.
+* Arguments  : p_tcb      Is a pointer to the task's OS_TCB to resume
 *
-* Returns    : If the stack is corrupted (OS_FALSE) or not (OS_TRUE).
+*              p_err      Is a pointer to a variable that will contain an error code returned by this function
 *
-* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+*                             OS_ERR_NONE                  If the requested task is resumed
+*                             OS_ERR_OS_NOT_RUNNING        If uC/OS-III is not running yet
+*                             OS_ERR_STATE_INVALID         If the task is in an invalid state
+*                             OS_ERR_TASK_NOT_SUSPENDED    If the task to resume has not been suspended
+*                             OS_ERR_TASK_RESUME_ISR       If you called this function from an ISR
+*                             OS_ERR_TASK_RESUME_SELF      You cannot resume 'self'
+*                             OS_ERR_TASK_STK_GRP_BUSY     If the task is a dormant member of a task stack group and
+*                                                            another member of the group is not dormant
+*
+* Returns    : none
+*
+* Note(s)    : 1) Resuming a dormant member of a task stack group starts it from its entry point (see
+*                 OSTaskStkGrpTaskCreate()).
 ************************************************************************************************************************
 */
 
-#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
-CPU_BOOLEAN  OSTaskStkRedzoneChk (OS_TCB  *p_tcb)
+#if (OS_CFG_TASK_SUSPEND_EN > 0u)
+void  OSTaskResume (OS_TCB  *p_tcb,
+                    OS_ERR  *p_err)
 {
-    CPU_BOOLEAN  stk_status;
+    CPU_SR_ALLOC();
 
 
-    if (p_tcb == (OS_TCB *)0) {
-        p_tcb = OSTCBCurPtr;
+    OS_TRACE_TASK_RESUME_ENTER(p_tcb);
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
     }
-                                                                /* Check if SP is valid:                                */
-                                                                /*   StkBase <= SP < (StkBase + StkSize)                */
-    if ((p_tcb->StkPtr <   p_tcb->StkBasePtr) ||
-        (p_tcb->StkPtr >= (p_tcb->StkBasePtr + p_tcb->StkSize))) {
-        return (OS_FALSE);
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_TASK_RESUME_ISR;
+        OS_TRACE_TASK_RESUME_EXIT(OS_ERR_TASK_RESUME_ISR);
+        return;
     }
+#endif
 
-    stk_status = OS_TaskStkRedzoneChk(p_tcb->StkBasePtr, p_tcb->StkSize);
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        OS_TRACE_TASK_RESUME_EXIT(OS_ERR_OS_NOT_RUNNING);
+        return;
+    }
+#endif
 
-    return (stk_status);
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    CPU_CRITICAL_ENTER();
+    if ((p_tcb == (OS_TCB *)0) ||                               /* We cannot resume 'self'                              */
+        (p_tcb == OSTCBCurPtr)) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_TASK_RESUME_SELF;
+        OS_TRACE_TASK_RESUME_EXIT(OS_ERR_TASK_RESUME_SELF);
+        return;
+    }
+    CPU_CRITICAL_EXIT();
+#endif
+
+    CPU_CRITICAL_ENTER();
+    OS_TaskResume(p_tcb, p_err);
+    CPU_CRITICAL_EXIT();
+    if (*p_err != OS_ERR_NONE) {                                /* Don't schedule if task wasn't in a suspend state.    */
+        OS_TRACE_TASK_RESUME_EXIT(*p_err);
+        return;
+    }
+
+    OSSched();
+    OS_TRACE_TASK_RESUME_EXIT(OS_ERR_NONE);
 }
 #endif
 
 
 /*
 ************************************************************************************************************************
-*                                                   SUSPEND A TASK
+*                                              WAIT FOR A TASK SEMAPHORE
 *
-* Description: This function is called to suspend a task.  The task can be the calling task if 'p_tcb' is a NULL pointer
-*              or the pointer to the TCB of the calling task.
+* Description: This function is called to block the current task until a signal is sent by another task or ISR.
 *
-* Arguments  : p_tcb    is a pointer to the TCB to suspend.
-*                       If p_tcb is a NULL pointer then, suspend the current task.
+* Arguments  : timeout       is the amount of time you are will to wait for the signal
 *
-*              p_err    is a pointer to a variable that will receive an error code from this function.
+*              opt           determines whether the user wants to block if a semaphore post was not received:
 *
-*                           OS_ERR_NONE                        If the requested task is suspended
-*                           OS_ERR_OS_NOT_RUNNING              If uC/OS-III is not running yet
-*                           OS_ERR_SCHED_LOCKED                You can't suspend the current task is the scheduler is
-*                                                                  locked
-*                           OS_ERR_STATE_INVALID               If the task is in an invalid state
-*                           OS_ERR_TASK_SUSPEND_CTR_OVF        If the nesting counter overflowed.
-*                           OS_ERR_TASK_SUSPEND_ISR            If you called this function from an ISR
-*                           OS_ERR_TASK_SUSPEND_IDLE           If you attempted to suspend the idle task which is not
-*                                                                  allowed
-*                           OS_ERR_TASK_SUSPEND_INT_HANDLER    If you attempted to suspend the idle task which is not
-*                                                                  allowed
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
 *
-* Returns    : none
+*                            Add OS_OPT_PEND_ABS to make 'timeout' the value of OSTickCtr at which to give up.
 *
-* Note(s)    : 1) You should use this function with great care.  If you suspend a task that is waiting for an event
-*                 (i.e. a message, a semaphore, a queue ...) you will prevent this task from running when the event
-*                 arrives.
+*              p_ts          is a pointer to a variable that will receive the timestamp of when the semaphore was posted
+*                            or pend aborted.  If you pass a NULL pointer (i.e. (CPU_TS *)0) then you will not get the
+*                            timestamp.  In other words, passing a NULL pointer is valid and indicates that you don't
+*                            need the timestamp.
+*
+*              p_err         is a pointer to an error code that will be set by this function
+*
+*                                OS_ERR_NONE                The call was successful and your task received a message
+*                                OS_ERR_OPT_INVALID         You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING      If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT          If the pend was aborted
+*                                OS_ERR_PEND_ISR            If you called this function from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK    If you specified non-blocking but no signal was received
+*                                OS_ERR_SCHED_LOCKED        If the scheduler is locked
+*                                OS_ERR_STATUS_INVALID      If the pend status is invalid
+*                                OS_ERR_TIMEOUT             A message was not received within the specified timeout
+*
+* Returns    : The current count of signals the task received, 0 if none.
+*
+* Note(s)    : This API 'MUST NOT' be called from a timer callback function.
 ************************************************************************************************************************
 */
 
-#if (OS_CFG_TASK_SUSPEND_EN > 0u)
-void   OSTaskSuspend (OS_TCB  *p_tcb,
-                      OS_ERR  *p_err)
+OS_SEM_CTR  OSTaskSemPend (OS_TICK   timeout,
+                           OS_OPT    opt,
+                           CPU_TS   *p_ts,
+                           OS_ERR   *p_err)
 {
+    OS_SEM_CTR    ctr;
     CPU_SR_ALLOC();
 
 
-    OS_TRACE_TASK_SUSPEND_ENTER(p_tcb);
+#if (OS_CFG_TS_EN == 0u)
+    (void)p_ts;                                                 /* Prevent compiler warning for not using 'ts'          */
+#endif
 
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == (OS_ERR *)0) {
         OS_SAFETY_CRITICAL_EXCEPTION();
-        return;
+        return (0u);
+    }
+#endif
+
+    OS_TRACE_TASK_SEM_PEND_ENTER(OSTCBCurPtr, timeout, opt, p_ts);
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+        OS_TRACE_TASK_SEM_PEND_FAILED(OSTCBCurPtr);
+        OS_TRACE_TASK_SEM_PEND_EXIT(OS_ERR_TICK_DISABLED);
+       *p_err = OS_ERR_TICK_DISABLED;
+        return (0u);
     }
 #endif
 
 #if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
     if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
-       *p_err = OS_ERR_TASK_SUSPEND_ISR;
-        OS_TRACE_TASK_SUSPEND_EXIT(OS_ERR_TASK_SUSPEND_ISR);
-        return;
+        OS_TRACE_TASK_SEM_PEND_FAILED(OSTCBCurPtr);
+        OS_TRACE_TASK_SEM_PEND_EXIT(OS_ERR_PEND_ISR);
+       *p_err = OS_ERR_PEND_ISR;
+        return (0u);
     }
 #endif
 
-#if (OS_CFG_TASK_IDLE_EN > 0u)
-    if (p_tcb == &OSIdleTaskTCB) {                              /* Make sure not suspending the idle task               */
-       *p_err = OS_ERR_TASK_SUSPEND_IDLE;
-        OS_TRACE_TASK_SUSPEND_EXIT(OS_ERR_TASK_SUSPEND_IDLE);
-        return;
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+        OS_TRACE_TASK_SEM_PEND_EXIT(OS_ERR_OS_NOT_RUNNING);
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
     }
 #endif
 
-    CPU_CRITICAL_ENTER();
-    if (p_tcb == (OS_TCB *)0) {                                 /* See if specified to suspend self                     */
-        if (OSRunning != OS_STATE_OS_RUNNING) {                 /* Can't suspend self when the kernel isn't running     */
-            CPU_CRITICAL_EXIT();
-           *p_err = OS_ERR_OS_NOT_RUNNING;
-            OS_TRACE_TASK_SUSPEND_EXIT(OS_ERR_OS_NOT_RUNNING);
-            return;
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    switch (opt & (OS_OPT)~OS_OPT_PEND_ABS) {                   /* Validate 'opt'                                       */
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+             OS_TRACE_TASK_SEM_PEND_FAILED(OSTCBCurPtr);
+             OS_TRACE_TASK_SEM_PEND_EXIT(OS_ERR_OPT_INVALID);
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (OSTCBCurPtr->SemCtr > 0u) {                             /* See if task already been signaled                    */
+        OSTCBCurPtr->SemCtr--;
+        ctr = OSTCBCurPtr->SemCtr;
+#if (OS_CFG_TS_EN > 0u)
+        if (p_ts != (CPU_TS *)0) {
+           *p_ts  = OSTCBCurPtr->TS;
         }
-        p_tcb = OSTCBCurPtr;
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+#if (OS_CFG_TS_EN > 0u)
+        OSTCBCurPtr->SemPendTime = OS_TS_GET() - OSTCBCurPtr->TS;
+        if (OSTCBCurPtr->SemPendTimeMax < OSTCBCurPtr->SemPendTime) {
+            OSTCBCurPtr->SemPendTimeMax = OSTCBCurPtr->SemPendTime;
+        }
+#endif
+#endif
+#endif
+        OS_TRACE_TASK_SEM_PEND(OSTCBCurPtr);
+        CPU_CRITICAL_EXIT();
+        OS_TRACE_TASK_SEM_PEND_EXIT(OS_ERR_NONE);
+       *p_err = OS_ERR_NONE;
+        return (ctr);
     }
 
-    if (p_tcb == OSTCBCurPtr) {
-        if (OSSchedLockNestingCtr > 0u) {                       /* Can't suspend when the scheduler is locked           */
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+        CPU_CRITICAL_EXIT();
+#if (OS_CFG_TS_EN > 0u)
+        if (p_ts != (CPU_TS *)0) {
+            *p_ts  = 0u;
+        }
+#endif
+        OS_TRACE_TASK_SEM_PEND_FAILED(OSTCBCurPtr);
+        OS_TRACE_TASK_SEM_PEND_EXIT(OS_ERR_PEND_WOULD_BLOCK);
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                        /* No                                                   */
+        return (0u);
+    } else {                                                    /* Yes                                                  */
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+#if (OS_CFG_TS_EN > 0u)
+            if (p_ts != (CPU_TS *)0) {
+               *p_ts  = 0u;
+            }
+#endif
             CPU_CRITICAL_EXIT();
+            OS_TRACE_TASK_SEM_PEND_FAILED(OSTCBCurPtr);
+            OS_TRACE_TASK_SEM_PEND_EXIT(OS_ERR_SCHED_LOCKED);
            *p_err = OS_ERR_SCHED_LOCKED;
-            OS_TRACE_TASK_SUSPEND_EXIT(OS_ERR_SCHED_LOCKED);
-            return;
+            return (0u);
         }
     }
 
-   *p_err = OS_ERR_NONE;
-    switch (p_tcb->TaskState) {
-        case OS_TASK_STATE_RDY:
-             p_tcb->TaskState  =  OS_TASK_STATE_SUSPENDED;
-             p_tcb->SuspendCtr = 1u;
-             OS_RdyListRemove(p_tcb);
-             OS_TRACE_TASK_SUSPEND(p_tcb);
-             CPU_CRITICAL_EXIT();
-             break;
-
-        case OS_TASK_STATE_DLY:
-             p_tcb->TaskState  = OS_TASK_STATE_DLY_SUSPENDED;
-             p_tcb->SuspendCtr = 1u;
-             CPU_CRITICAL_EXIT();
-             break;
+    OS_PEND_ABS_SET(OSTCBCurPtr, opt);
+    OS_Pend((OS_PEND_OBJ *)0,                                   /* Block task pending on Signal                         */
+             OSTCBCurPtr,
+             OS_TASK_PEND_ON_TASK_SEM,
+             timeout);
+    CPU_CRITICAL_EXIT();
+    OS_TRACE_TASK_SEM_PEND_BLOCK(OSTCBCurPtr);
+    OSSched();                                                  /* Find next highest priority task ready to run         */
 
-        case OS_TASK_STATE_PEND:
-             p_tcb->TaskState  = OS_TASK_STATE_PEND_SUSPENDED;
-             p_tcb->SuspendCtr = 1u;
-             CPU_CRITICAL_EXIT();
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {                          /* See if we timed-out or aborted                       */
+        case OS_STATUS_PEND_OK:
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts                    =  OSTCBCurPtr->TS;
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+#if (OS_CFG_TS_EN > 0u)
+                OSTCBCurPtr->SemPendTime = OS_TS_GET() - OSTCBCurPtr->TS;
+                if (OSTCBCurPtr->SemPendTimeMax < OSTCBCurPtr->SemPendTime) {
+                    OSTCBCurPtr->SemPendTimeMax = OSTCBCurPtr->SemPendTime;
+                }
+#endif
+#endif
+             }
+#endif
+             OS_TRACE_TASK_SEM_PEND(OSTCBCurPtr);
+            *p_err = OS_ERR_NONE;
              break;
 
-        case OS_TASK_STATE_PEND_TIMEOUT:
-             p_tcb->TaskState  = OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED;
-             p_tcb->SuspendCtr = 1u;
-             CPU_CRITICAL_EXIT();
+        case OS_STATUS_PEND_ABORT:
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+             OS_TRACE_TASK_SEM_PEND_FAILED(OSTCBCurPtr);
+            *p_err = OS_ERR_PEND_ABORT;                         /* Indicate that we aborted                             */
              break;
 
-        case OS_TASK_STATE_SUSPENDED:
-        case OS_TASK_STATE_DLY_SUSPENDED:
-        case OS_TASK_STATE_PEND_SUSPENDED:
-        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
-             if (p_tcb->SuspendCtr == (OS_NESTING_CTR)-1) {
-                 CPU_CRITICAL_EXIT();
-                *p_err = OS_ERR_TASK_SUSPEND_CTR_OVF;
-                 OS_TRACE_TASK_SUSPEND_EXIT(OS_ERR_TASK_SUSPEND_CTR_OVF);
-                 return;
+        case OS_STATUS_PEND_TIMEOUT:
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = 0u;
              }
-             p_tcb->SuspendCtr++;
-             CPU_CRITICAL_EXIT();
+#endif
+             OS_TRACE_TASK_SEM_PEND_FAILED(OSTCBCurPtr);
+            *p_err = OS_ERR_TIMEOUT;                            /* Indicate that we didn't get event within TO          */
              break;
 
         default:
-             CPU_CRITICAL_EXIT();
-            *p_err = OS_ERR_STATE_INVALID;
-             OS_TRACE_TASK_SUSPEND_EXIT(OS_ERR_STATE_INVALID);
-             return;
-    }
-
-    if (OSRunning == OS_STATE_OS_RUNNING) {                     /* Only schedule when the kernel is running             */
-        OSSched();
-        OS_TRACE_TASK_SUSPEND_EXIT(OS_ERR_NONE);
+             OS_TRACE_TASK_SEM_PEND_FAILED(OSTCBCurPtr);
+            *p_err = OS_ERR_STATUS_INVALID;
+             break;
     }
+    ctr = OSTCBCurPtr->SemCtr;
+    CPU_CRITICAL_EXIT();
+    OS_TRACE_TASK_SEM_PEND_EXIT(*p_err);
+    return (ctr);
 }
-#endif
 
 
 /*
 ************************************************************************************************************************
-*                                                CHANGE A TASK'S TIME SLICE
+*                               WAIT FOR A TASK SEMAPHORE WITH A TIMEOUT IN MICROSECONDS
 *
-* Description: This function is called to change the value of the task's specific time slice.
+* Description: This function is the same as OSTaskSemPend() except that the timeout is given in microseconds.
 *
-* Arguments  : p_tcb        is the pointer to the TCB of the task to change. If you specify an NULL pointer, the current
-*                           task is assumed.
+* Arguments  : timeout_us    is an optional timeout in microseconds.  If non-zero, your task will wait up to this long
+*                            and a timeout is detected with the resolution of OS_TS_GET().  If you specify 0, your
+*                            task will wait forever.
 *
-*              time_quanta  is the number of ticks before the CPU is taken away when round-robin scheduling is enabled.
+*              ...           are the other arguments of OSTaskSemPend().
 *
-*              p_err        is a pointer to an error code returned by this function:
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.  In
+*                            addition to the error codes of OSTaskSemPend():
 *
-*                               OS_ERR_NONE       Upon success
-*                               OS_ERR_SET_ISR    If you called this function from an ISR
+*                                OS_ERR_TIME_INVALID_MICROSECONDS   If 'timeout_us' is too long for the timestamp
+*                                                                   or the timestamp frequency is unknown
 *
-* Returns    : none
+* Returns    : See OSTaskSemPend().
 *
-* Note(s)    : none
+* Note(s)    : 1) From an ISR or before the kernel runs, the call is passed to OSTaskSemPend() without a timeout so that
+*                 it performs its usual checks.
 ************************************************************************************************************************
 */
 
-#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
-void  OSTaskTimeQuantaSet (OS_TCB   *p_tcb,
-                           OS_TICK   time_quanta,
-                           OS_ERR   *p_err)
+#if (OS_CFG_TIME_HR_EN > 0u)
+OS_SEM_CTR  OSTaskSemPendUs (CPU_INT32U   timeout_us,
+                             OS_OPT       opt,
+                             CPU_TS      *p_ts,
+                             OS_ERR      *p_err)
 {
-    CPU_SR_ALLOC();
-
+    OS_SEM_CTR  ctr;
+    CPU_TS      dly;
 
 
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == (OS_ERR *)0) {
         OS_SAFETY_CRITICAL_EXCEPTION();
-        return;
+        return (0u);
     }
 #endif
 
-#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
-    if (OSIntNestingCtr > 0u) {                                 /* Can't call this function from an ISR                 */
-       *p_err = OS_ERR_SET_ISR;
-        return;
+    if ((timeout_us      ==                   0u) ||            /* Without a timeout, the regular pend does it all      */
+        (OSIntNestingCtr >                    0u) ||
+        (OSRunning       != OS_STATE_OS_RUNNING)) {
+        return (OSTaskSemPend(0u, opt, p_ts, p_err));
     }
-#endif
 
-    CPU_CRITICAL_ENTER();
-    if (p_tcb == (OS_TCB *)0) {
-        p_tcb = OSTCBCurPtr;
+    dly = OS_TickHrUsToTS(timeout_us);
+    if ((dly == 0u) || (dly > OS_TICK_HR_DLY_MAX)) {
+       *p_err = OS_ERR_TIME_INVALID_MICROSECONDS;
+        return (0u);
     }
 
-    if (time_quanta == 0u) {
-        p_tcb->TimeQuanta    = OSSchedRoundRobinDfltTimeQuanta;
-    } else {
-        p_tcb->TimeQuanta    = time_quanta;
-    }
-    if (p_tcb->TimeQuanta > p_tcb->TimeQuantaCtr) {
-        p_tcb->TimeQuantaCtr = p_tcb->TimeQuanta;
-    }
-    CPU_CRITICAL_EXIT();
-   *p_err = OS_ERR_NONE;
+    OSTCBCurPtr->TickHrDly = dly;                               /* OS_TaskBlock() uses it instead of the tick timeout   */
+    ctr = OSTaskSemPend(1u, opt, p_ts, p_err);
+    OSTCBCurPtr->TickHrDly = 0u;                                /* Clear it in case the task did not have to wait       */
+
+    return (ctr);
 }
 #endif
 
 
 /*
 ************************************************************************************************************************
-*                                            ADD/REMOVE TASK TO/FROM DEBUG LIST
+*                                               ABORT WAITING FOR A SIGNAL
 *
-* Description: These functions are called by uC/OS-III to add or remove an OS_TCB from the debug list.
+* Description: This function aborts & readies the task specified.  This function should be used to fault-abort the wait
+*              for a signal, rather than to normally post the signal to the task via OSTaskSemPost().
 *
-* Arguments  : p_tcb     is a pointer to the OS_TCB to add/remove
+* Arguments  : p_tcb     is a pointer to the task to pend abort
 *
-* Returns    : none
+*              opt       provides options for this function:
 *
-* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+*                            OS_OPT_POST_NONE         No option selected
+*                            OS_OPT_POST_NO_SCHED     Indicates that the scheduler will not be called.
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               If the task was readied and informed of the aborted wait
+*                            OS_ERR_OPT_INVALID        You specified an invalid option
+*                            OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                            OS_ERR_PEND_ABORT_ISR     If you tried calling this function from an ISR
+*                            OS_ERR_PEND_ABORT_NONE    If the task was not waiting for a signal
+*                            OS_ERR_PEND_ABORT_SELF    If you attempted to pend abort the calling task.  This is not
+*                                                      possible since the calling task cannot be pending because it's
+*                                                      running
+*
+* Returns    : == OS_FALSE   if task was not waiting for a message, or upon error.
+*              == OS_TRUE    if task was waiting for a message and was readied and informed.
+*
+* Note(s)    : none
 ************************************************************************************************************************
 */
 
-#if (OS_CFG_DBG_EN > 0u)
-void  OS_TaskDbgListAdd (OS_TCB  *p_tcb)
+#if (OS_CFG_TASK_SEM_PEND_ABORT_EN > 0u)
+CPU_BOOLEAN  OSTaskSemPendAbort (OS_TCB  *p_tcb,
+                                 OS_OPT   opt,
+                                 OS_ERR  *p_err)
 {
-    p_tcb->DbgPrevPtr                = (OS_TCB *)0;
-    if (OSTaskDbgListPtr == (OS_TCB *)0) {
-        p_tcb->DbgNextPtr            = (OS_TCB *)0;
-    } else {
-        p_tcb->DbgNextPtr            =  OSTaskDbgListPtr;
-        OSTaskDbgListPtr->DbgPrevPtr =  p_tcb;
-    }
-    OSTaskDbgListPtr                 =  p_tcb;
-}
-
+    CPU_TS  ts;
+    CPU_SR_ALLOC();
 
 
-void  OS_TaskDbgListRemove (OS_TCB  *p_tcb)
-{
-    OS_TCB  *p_tcb_next;
-    OS_TCB  *p_tcb_prev;
 
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (OS_FALSE);
+    }
+#endif
 
-    p_tcb_prev = p_tcb->DbgPrevPtr;
-    p_tcb_next = p_tcb->DbgNextPtr;
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if called from ISR ...                           */
+       *p_err = OS_ERR_PEND_ABORT_ISR;                          /* ... can't Pend Abort from an ISR                     */
+        return (OS_FALSE);
+    }
+#endif
 
-    if (p_tcb_prev == (OS_TCB *)0) {
-        OSTaskDbgListPtr = p_tcb_next;
-        if (p_tcb_next != (OS_TCB *)0) {
-            p_tcb_next->DbgPrevPtr = (OS_TCB *)0;
-        }
-        p_tcb->DbgNextPtr = (OS_TCB *)0;
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (OS_FALSE);
+    }
+#endif
 
-    } else if (p_tcb_next == (OS_TCB *)0) {
-        p_tcb_prev->DbgNextPtr = (OS_TCB *)0;
-        p_tcb->DbgPrevPtr      = (OS_TCB *)0;
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
 
-    } else {
-        p_tcb_prev->DbgNextPtr =  p_tcb_next;
-        p_tcb_next->DbgPrevPtr =  p_tcb_prev;
-        p_tcb->DbgNextPtr      = (OS_TCB *)0;
-        p_tcb->DbgPrevPtr      = (OS_TCB *)0;
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return (OS_FALSE);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if ((p_tcb == (OS_TCB *)0) ||                               /* Pend abort self?                                     */
+        (p_tcb == OSTCBCurPtr)) {
+        CPU_CRITICAL_EXIT();                                    /* ... doesn't make sense!                              */
+       *p_err = OS_ERR_PEND_ABORT_SELF;
+        return (OS_FALSE);
+    }
+
+    if (p_tcb->PendOn != OS_TASK_PEND_ON_TASK_SEM) {            /* Is task waiting for a signal?                        */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_PEND_ABORT_NONE;
+        return (OS_FALSE);
+    }
+    CPU_CRITICAL_EXIT();
+
+    CPU_CRITICAL_ENTER();
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();
+#else
+    ts = 0u;
+#endif
+    OS_PendAbort(p_tcb,                                         /* Abort the pend                                       */
+                 ts,
+                 OS_STATUS_PEND_ABORT);
+    CPU_CRITICAL_EXIT();
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
     }
+   *p_err = OS_ERR_NONE;
+    return (OS_TRUE);
 }
 #endif
 
 
 /*
 ************************************************************************************************************************
-*                                             TASK MANAGER INITIALIZATION
+*                                                    SIGNAL A TASK
 *
-* Description: This function is called by OSInit() to initialize the task management.
+* Description: This function is called to signal a task waiting for a signal.
 *
-
-* Argument(s): p_err        is a pointer to a variable that will contain an error code returned by this function.
+* Arguments  : p_tcb     is the pointer to the TCB of the task to signal.  A NULL pointer indicates that you are sending
+*                        a signal to yourself.
 *
-*                                OS_ERR_NONE     the call was successful
+*              opt       determines the type of POST performed:
 *
-* Returns    : none
+*                             OS_OPT_POST_NONE         No option
+*                             OS_OPT_POST_NO_SCHED     Do not call the scheduler
 *
-* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+*              p_err     is a pointer to an error code returned by this function:
+*
+*                            OS_ERR_NONE              If the requested task is signaled
+*                            OS_ERR_OPT_INVALID       If you specified an invalid option
+*                            OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*                            OS_ERR_SEM_OVF           If the post would cause the semaphore count to overflow
+*                            OS_ERR_STATE_INVALID     If the task is in an invalid state.  This should never happen
+*                                                     and if it does, would be considered a system failure
+*                            OS_ERR_INT_Q_FULL        If the post was deferred and the ISR queue is full
+*
+* Returns    : The current value of the task's signal counter or 0 if called from an ISR
+*
+* Note(s)    : 1) When OS_CFG_ISR_POST_DEFERRED_EN is enabled, a signal sent from an ISR is delivered by the ISR
+*                 handler task.
 ************************************************************************************************************************
 */
 
-void  OS_TaskInit (OS_ERR  *p_err)
+OS_SEM_CTR  OSTaskSemPost (OS_TCB  *p_tcb,
+                           OS_OPT   opt,
+                           OS_ERR  *p_err)
 {
-#if (OS_CFG_DBG_EN > 0u)
-    OSTaskDbgListPtr = (OS_TCB *)0;
+    CPU_TS  ts;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
 #endif
 
-    OSTaskQty        = 0u;                                      /* Clear the number of tasks                            */
+    OS_TRACE_TASK_SEM_POST_ENTER(p_tcb, opt);
 
-#if ((OS_CFG_TASK_PROFILE_EN > 0u) || (OS_CFG_DBG_EN > 0u))
-    OSTaskCtxSwCtr   = 0u;                                      /* Clear the context switch counter                     */
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+        OS_TRACE_TASK_SEM_POST_EXIT(OS_ERR_OS_NOT_RUNNING);
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
 #endif
 
-   *p_err            = OS_ERR_NONE;
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+             OS_TRACE_TASK_SEM_POST_FAILED(p_tcb);
+             OS_TRACE_TASK_SEM_POST_EXIT(OS_ERR_OPT_INVALID);
+            *p_err =  OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Defer the post when called from an ISR               */
+        if (p_tcb == (OS_TCB *)0) {                             /* 'self' is the task that was interrupted              */
+            p_tcb = OSTCBCurPtr;
+        }
+        OS_IntQPost(OS_OBJ_TYPE_TASK_SIGNAL,
+                    (void *)p_tcb,
+                    (void *)0,
+                    0u,
+                    0u,
+                    opt,
+                    p_err);
+        OS_TRACE_TASK_SEM_POST_EXIT(*p_err);
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+    return (OS_TaskSemPost(p_tcb, opt, ts, p_err));
 }
 
 
 /*
 ************************************************************************************************************************
-*                                               INITIALIZE TCB FIELDS
+*                                               SIGNAL A TASK FROM AN ISR
 *
-* Description: This function is called to initialize a TCB to default values
+* Description: This function is the same as OSTaskSemPost() but is only called from an ISR.  It does not check whether
+*              the kernel is running and never calls the scheduler: the context switch, if any, is left to OSIntExit().
 *
-* Arguments  : p_tcb    is a pointer to the TCB to initialize
+* Arguments  : p_tcb     is the pointer to the TCB of the task to signal.  A NULL pointer indicates the task that was
+*                        interrupted.
 *
-* Returns    : none
+*              opt       determines the type of POST performed (see OSTaskSemPost()).  OS_OPT_POST_NO_SCHED is implied.
 *
-* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+*              p_err     is a pointer to an error code returned by this function (see OSTaskSemPost())
+*
+* Returns    : The current value of the task's signal counter or 0 if the signal was deferred.
+*
+* Note(s)    : 1) This function MUST only be called from an ISR, between OSIntEnter() and OSIntExit().
+*
+*              2) When OS_CFG_ISR_POST_DEFERRED_EN is enabled, the signal is delivered by the ISR handler task.
 ************************************************************************************************************************
 */
 
-void  OS_TaskInitTCB (OS_TCB  *p_tcb)
+#if (OS_CFG_POST_FROM_ISR_EN > 0u)
+OS_SEM_CTR  OSTaskSemPostFromISR (OS_TCB  *p_tcb,
+                                  OS_OPT   opt,
+                                  OS_ERR  *p_err)
 {
-#if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
-    OS_REG_ID   reg_id;
-#endif
-#if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
-    OS_TLS_ID   id;
+#if (OS_CFG_ISR_POST_DEFERRED_EN == 0u)
+    CPU_TS  ts;
 #endif
 
 
-    p_tcb->StkPtr               = (CPU_STK          *)0;
-    p_tcb->StkLimitPtr          = (CPU_STK          *)0;
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
 
-    p_tcb->ExtPtr               = (void             *)0;
+    OS_TRACE_TASK_SEM_POST_ENTER(p_tcb, opt);
 
-    p_tcb->NextPtr              = (OS_TCB           *)0;
-    p_tcb->PrevPtr              = (OS_TCB           *)0;
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
 
-#if (OS_CFG_TICK_EN > 0u)
-    p_tcb->TickNextPtr          = (OS_TCB           *)0;
-    p_tcb->TickPrevPtr          = (OS_TCB           *)0;
+        default:
+             OS_TRACE_TASK_SEM_POST_FAILED(p_tcb);
+             OS_TRACE_TASK_SEM_POST_EXIT(OS_ERR_OPT_INVALID);
+            *p_err =  OS_ERR_OPT_INVALID;
+             return (0u);
+    }
 #endif
 
-#if (OS_CFG_DBG_EN > 0u)
-    p_tcb->NamePtr              = (CPU_CHAR *)((void *)"?Task");
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+    if (p_tcb == (OS_TCB *)0) {                                 /* 'self' is the task that was interrupted              */
+        p_tcb = OSTCBCurPtr;
+    }
+    OS_IntQPost(OS_OBJ_TYPE_TASK_SIGNAL,                        /* See Note #2                                          */
+                (void *)p_tcb,
+                (void *)0,
+                0u,
+                0u,
+                opt,
+                p_err);
+    OS_TRACE_TASK_SEM_POST_EXIT(*p_err);
+    return (0u);
+#else
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+#else
+    ts = 0u;
 #endif
 
-#if ((OS_CFG_DBG_EN > 0u) || (OS_CFG_STAT_TASK_STK_CHK_EN > 0u))
-    p_tcb->StkBasePtr           = (CPU_STK          *)0;
+    return (OS_TaskSemPost(p_tcb, (OS_OPT)(opt | OS_OPT_POST_NO_SCHED), ts, p_err));
 #endif
-
-#if (OS_CFG_DBG_EN > 0u)
-    p_tcb->TaskEntryAddr        = (OS_TASK_PTR       )0;
-    p_tcb->TaskEntryArg         = (void             *)0;
+}
 #endif
 
-#if (OS_CFG_TS_EN > 0u)
-    p_tcb->TS                   =                     0u;
-#endif
 
-#if (OS_MSG_EN > 0u)
-    p_tcb->MsgPtr               = (void             *)0;
-    p_tcb->MsgSize              =                     0u;
-#endif
 
-#if (OS_CFG_TASK_Q_EN > 0u)
-    OS_MsgQInit(&p_tcb->MsgQ,
-                 0u);
-#if (OS_CFG_TASK_PROFILE_EN > 0u)
-    p_tcb->MsgQPendTime         =                     0u;
-    p_tcb->MsgQPendTimeMax      =                     0u;
-#endif
-#endif
 
-#if (OS_CFG_FLAG_EN > 0u)
-    p_tcb->FlagsPend            =                     0u;
-    p_tcb->FlagsOpt             =                     0u;
-    p_tcb->FlagsRdy             =                     0u;
-#endif
+/*
+************************************************************************************************************************
+*                                            SET THE SIGNAL COUNTER OF A TASK
+*
+* Description: This function is called to clear the signal counter
+*
+* Arguments  : p_tcb      is the pointer to the TCB of the task to clear the counter.  If you specify a NULL pointer
+*                         then the signal counter of the current task will be cleared.
+*
+*              cnt        is the desired value of the semaphore counter
+*
+*              p_err      is a pointer to an error code returned by this function
+*
+*                             OS_ERR_NONE             If the signal counter of the requested task is set
+*                             OS_ERR_SET_ISR          If the function was called from an ISR
+*                             OS_ERR_TASK_WAITING     One or more tasks were waiting on the semaphore
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
 
-#if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
-    for (reg_id = 0u; reg_id < OS_CFG_TASK_REG_TBL_SIZE; reg_id++) {
-        p_tcb->RegTbl[reg_id]   =                     0u;
+OS_SEM_CTR  OSTaskSemSet (OS_TCB      *p_tcb,
+                          OS_SEM_CTR   cnt,
+                          OS_ERR      *p_err)
+{
+    OS_SEM_CTR  ctr;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
     }
 #endif
 
-#if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
-    for (id = 0u; id < OS_CFG_TLS_TBL_SIZE; id++) {
-        p_tcb->TLS_Tbl[id]      =                     0u;
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_SET_ISR;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {
+        p_tcb = OSTCBCurPtr;
+    }
+
+    if (((p_tcb->TaskState   & OS_TASK_STATE_PEND) != 0u) &&    /* Not allowed when a task is waiting.                  */
+         (p_tcb->PendOn == OS_TASK_PEND_ON_TASK_SEM)) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_TASK_WAITING;
+        return (0u);
+    }
+
+    ctr           =  p_tcb->SemCtr;
+    p_tcb->SemCtr = (OS_SEM_CTR)cnt;
+    CPU_CRITICAL_EXIT();
+   *p_err         =  OS_ERR_NONE;
+    return (ctr);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                    STACK CHECKING
+*
+* Description: This function is called to calculate the amount of free memory left on the specified task's stack.
+*
+* Arguments  : p_tcb       is a pointer to the TCB of the task to check.  If you specify a NULL pointer then
+*                          you are specifying that you want to check the stack of the current task.
+*
+*              p_free      is a pointer to a variable that will receive the number of free 'entries' on the task's stack.
+*
+*              p_used      is a pointer to a variable that will receive the number of used 'entries' on the task's stack.
+*
+*              p_err       is a pointer to a variable that will contain an error code.
+*
+*                              OS_ERR_NONE               Upon success
+*                              OS_ERR_PTR_INVALID        If either 'p_free' or 'p_used' are NULL pointers
+*                              OS_ERR_TASK_NOT_EXIST     If the stack pointer of the task is a NULL pointer
+*                              OS_ERR_TASK_OPT           If you did NOT specified OS_OPT_TASK_STK_CHK when the task
+*                                                        was created
+*                              OS_ERR_TASK_STK_CHK_ISR   You called this function from an ISR
+*                              OS_ERR_TASK_STK_CLR_PEND  If the idle task hasn't cleared the stack yet (see
+*                                                        OS_OPT_TASK_STK_CLR_DEFER)
+*
+* Returns    : none
+*
+* Note(s)    : 1) The stack is scanned with interrupts enabled.
+*
+*              2) When OS_CFG_STAT_TASK_STK_CHK_INCR_EN is enabled, the TCB remembers the number of free entries found
+*                 by the last completed scan (the high-water mark).  Since entries beyond that mark have already been
+*                 used, a new scan only has to examine the entries between the stack limit and the mark.  Each call
+*                 examines at most OS_CFG_STAT_TASK_STK_CHK_CHUNK entries and resumes where the previous call
+*                 stopped.  '*p_free' and '*p_used' are therefore the result of the last completed scan and may lag
+*                 behind the actual stack usage by a few calls.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u)
+void  OSTaskStkChk (OS_TCB        *p_tcb,
+                    CPU_STK_SIZE  *p_free,
+                    CPU_STK_SIZE  *p_used,
+                    OS_ERR        *p_err)
+{
+    CPU_STK_SIZE  free_stk;
+    CPU_STK_SIZE  stk_size;
+    CPU_STK      *p_stk;
+#if (OS_CFG_STAT_TASK_STK_CHK_INCR_EN > 0u)
+    CPU_STK_SIZE  free_end;
+    CPU_STK_SIZE  free_max;
+#endif
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if trying to check stack from ISR                */
+       *p_err = OS_ERR_TASK_STK_CHK_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_free == (CPU_STK_SIZE *)0) {                          /* User must specify valid destinations for the sizes   */
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+
+    if (p_used == (CPU_STK_SIZE *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {                                 /* Check the stack of the current task?                 */
+        p_tcb = OSTCBCurPtr;                                    /* Yes                                                  */
+    }
+
+    if (p_tcb->StkPtr == (CPU_STK *)0) {                        /* Make sure task exist                                 */
+        CPU_CRITICAL_EXIT();
+       *p_free = 0u;
+       *p_used = 0u;
+       *p_err  = OS_ERR_TASK_NOT_EXIST;
+        return;
+    }
+
+    if ((p_tcb->Opt & OS_OPT_TASK_STK_CHK) == 0u) {             /* Make sure stack checking option is set               */
+        CPU_CRITICAL_EXIT();
+       *p_free = 0u;
+       *p_used = 0u;
+       *p_err  = OS_ERR_TASK_OPT;
+        return;
+    }
+
+#if (OS_CFG_TASK_STK_CLR_DEFER_EN > 0u)
+    if (p_tcb->StkClrPtr != (CPU_STK *)0) {                     /* Stack not cleared yet by the idle task               */
+        CPU_CRITICAL_EXIT();
+       *p_free = 0u;
+       *p_used = 0u;
+       *p_err  = OS_ERR_TASK_STK_CLR_PEND;
+        return;
+    }
+#endif
+
+#if (CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO)
+    p_stk = p_tcb->StkBasePtr;                                  /* Start at the lowest memory and go up                 */
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+    p_stk += OS_CFG_TASK_STK_REDZONE_DEPTH;
+#endif
+#else
+    p_stk = p_tcb->StkBasePtr + p_tcb->StkSize - 1u;            /* Start at the highest memory and go down              */
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+    p_stk -= OS_CFG_TASK_STK_REDZONE_DEPTH;
+#endif
+#endif
+
+    stk_size = p_tcb->StkSize;
+#if (OS_CFG_STAT_TASK_STK_CHK_INCR_EN > 0u)
+    free_max = p_tcb->StkChkFree;                               /* Entries beyond the high-water mark are known used    */
+    free_stk = p_tcb->StkChkIx;                                 /* Resume where the previous call stopped               */
+#endif
+    CPU_CRITICAL_EXIT();
+
+#if (OS_CFG_STAT_TASK_STK_CHK_INCR_EN > 0u)
+    free_end = free_stk + OS_CFG_STAT_TASK_STK_CHK_CHUNK;       /* Scan at most one chunk (see Note #2)                 */
+    if ((free_end > free_max) ||
+        (free_end < free_stk)) {
+        free_end = free_max;
+    }
+#if (CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO)
+    p_stk += free_stk;
+    while ((free_stk  < free_end) &&
+           (*p_stk   ==       0u)) {
+        p_stk++;
+        free_stk++;
+    }
+#else
+    p_stk -= free_stk;
+    while ((free_stk  < free_end) &&
+           (*p_stk   ==       0u)) {
+        free_stk++;
+        p_stk--;
+    }
+#endif
+
+    if ((free_stk < free_end) ||                                /* Found a used entry or reached the high-water mark?   */
+        (free_stk == free_max)) {
+        free_max = free_stk;                                    /* Yes, the scan is complete                            */
+        free_stk = 0u;
+    }
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb->StkPtr != (CPU_STK *)0) {                        /* Save the scan state if the task still exists         */
+        p_tcb->StkChkFree = free_max;
+        p_tcb->StkChkIx   = free_stk;
+    }
+    CPU_CRITICAL_EXIT();
+
+    free_stk = free_max;                                        /* Report the last completed scan                       */
+#else
+    free_stk = 0u;
+                                                                /* Compute the number of zero entries on the stk        */
+#if (CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO)
+    while ((free_stk  < stk_size) &&
+           (*p_stk   ==       0u)) {
+        p_stk++;
+        free_stk++;
+    }
+#else
+    while ((free_stk  < stk_size) &&
+           (*p_stk   ==       0u)) {
+        free_stk++;
+        p_stk--;
+    }
+#endif
+#endif
+   *p_free = free_stk;
+   *p_used = (stk_size - free_stk);                             /* Compute number of entries used on the stack          */
+   *p_err  = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                            CHECK THE STACK REDZONE OF A TASK
+*
+* Description: Verify a task's stack redzone.
+*
+* Arguments  : p_tcb     is a pointer to the TCB of the task to check or null for the current task.
+*
+* Returns    : If the stack is corrupted (OS_FALSE) or not (OS_TRUE).
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+CPU_BOOLEAN  OSTaskStkRedzoneChk (OS_TCB  *p_tcb)
+{
+    CPU_BOOLEAN  stk_status;
+
+
+    if (p_tcb == (OS_TCB *)0) {
+        p_tcb = OSTCBCurPtr;
+    }
+                                                                /* Check if SP is valid:                                */
+                                                                /*   StkBase <= SP < (StkBase + StkSize)                */
+    if ((p_tcb->StkPtr <   p_tcb->StkBasePtr) ||
+        (p_tcb->StkPtr >= (p_tcb->StkBasePtr + p_tcb->StkSize))) {
+        return (OS_FALSE);
+    }
+
+    stk_status = OS_TaskStkRedzoneChk(p_tcb->StkBasePtr, p_tcb->StkSize);
+
+    return (stk_status);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                       SET THE HEAP OF THE FITTED TASK STACKS
+*
+* Description: This function gives the kernel the heap from which OSTaskCreate() allocates the stacks of the tasks
+*              created with OS_OPT_TASK_STK_FIT and a NULL 'p_stk_base'.
+*
+* Arguments  : p_heap    is a pointer to a heap created by OSHeapCreate().  A NULL pointer stops the allocation of stacks.
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               The heap was set
+*                            OS_ERR_OBJ_TYPE           If 'p_heap' is not pointing at a heap
+*
+* Returns    : none
+*
+* Note(s)    : 1) The stacks are given back to the heap they came from, so the heap must not be changed while a task
+*                 created with OS_OPT_TASK_STK_FIT exists.  Call this function once, at initialization.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_STK_FIT_EN > 0u)
+void  OSTaskStkFitHeapSet (OS_HEAP  *p_heap,
+                           OS_ERR   *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_heap != (OS_HEAP *)0) {
+        if (p_heap->Type != OS_OBJ_TYPE_HEAP) {                 /* Make sure the heap was created                       */
+           *p_err = OS_ERR_OBJ_TYPE;
+            return;
+        }
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    OSTaskStkFitHeapPtr = p_heap;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                          INITIALIZE THE STACK PROFILE TABLE
+*
+* Description: This function gives the kernel the table in which the statistic task records the peak stack usage and
+*              the recommended stack size of each task entry point.  The contents of the table are kept if they are
+*              valid, e.g. if the table is in RAM that was not cleared by the reset, and cleared otherwise.
+*
+* Arguments  : p_tbl     is a pointer to the stack profile table
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               The table is in use
+*                            OS_ERR_PTR_INVALID        If 'p_tbl' is a NULL pointer
+*
+* Returns    : The number of entries kept from before the reset, 0 if the table was cleared.
+*
+* Note(s)    : 1) The table is valid if '.Magic' is OS_STK_PROFILE_MAGIC and '.Chksum' matches the contents.  Changing
+*                 OS_CFG_TASK_STK_PROFILE_SIZE invalidates the table.
+*
+*              2) The entries are keyed by the entry point of the tasks ('p_task' of OSTaskCreate()), so a new build that
+*                 moves the task code leaves stale entries behind.  Place the table where the application can clear
+*                 it, e.g. by changing '.Magic' before calling this function, when a new build is loaded.
+*
+*              3) The tasks must be created with OS_OPT_TASK_STK_CHK for the statistic task to measure their stacks.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_STK_PROFILE_EN > 0u)
+OS_OBJ_QTY  OSTaskStkProfileInit (OS_STK_PROFILE_TBL  *p_tbl,
+                                  OS_ERR              *p_err)
+{
+    CPU_INT08U  *p_byte;
+    CPU_INT08U  *p_end;
+    OS_OBJ_QTY   nbr;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_tbl == (OS_STK_PROFILE_TBL *)0) {                     /* Must point to a valid table                          */
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+#endif
+
+    nbr = 0u;
+    if ((p_tbl->Magic  == OS_STK_PROFILE_MAGIC) &&              /* Did the contents survive? (see Note #1)              */
+        (p_tbl->Nbr    <= OS_CFG_TASK_STK_PROFILE_SIZE) &&
+        (p_tbl->Chksum == OS_TaskStkProfileChksum(p_tbl))) {
+        nbr = p_tbl->Nbr;
+    } else {
+        p_byte = (CPU_INT08U *)&p_tbl->Nbr;                     /* No, clear the entries and the padding between them   */
+        p_end  = (CPU_INT08U *)(p_tbl + 1u);
+        while (p_byte < p_end) {
+           *p_byte = 0u;
+            p_byte++;
+        }
+        p_tbl->Magic  = OS_STK_PROFILE_MAGIC;
+        p_tbl->Chksum = OS_TaskStkProfileChksum(p_tbl);
+    }
+
+    CPU_CRITICAL_ENTER();
+    OSTaskStkProfileTblPtr = p_tbl;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+    return (nbr);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                      GET THE RECOMMENDED STACK SIZE OF A TASK
+*
+* Description: This function returns the stack size recommended by the stack profile table for the tasks running
+*              'p_task': their peak stack usage plus OS_CFG_TASK_STK_PROFILE_MARGIN percent.
+*
+* Arguments  : p_task    is a pointer to the task's code
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                    The recommended size was returned
+*                            OS_ERR_TASK_INVALID            If 'p_task' is a NULL pointer
+*                            OS_ERR_TASK_STK_PROFILE_NONE   If the table has no entry for 'p_task', or there is no table
+*
+* Returns    : The recommended stack size, in CPU_STK elements, or 0 if there is none.
+*
+* Note(s)    : 1) The recommended size includes the red-zone (OS_CFG_TASK_STK_REDZONE_EN) and is never smaller than
+*                 OSCfg_StkSizeMin, so it can be passed to OSTaskCreate() as is.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_STK_PROFILE_EN > 0u)
+CPU_STK_SIZE  OSTaskStkProfileSizeGet (OS_TASK_PTR   p_task,
+                                       OS_ERR       *p_err)
+{
+    OS_STK_PROFILE  *p_entry;
+    CPU_STK_SIZE     size;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_task == (OS_TASK_PTR)0) {                             /* Must specify a task                                  */
+       *p_err = OS_ERR_TASK_INVALID;
+        return (0u);
+    }
+#endif
+
+    size = 0u;
+    CPU_CRITICAL_ENTER();
+    p_entry = OS_TaskStkProfileFind(p_task);
+    if (p_entry != (OS_STK_PROFILE *)0) {
+        size = p_entry->StkSizeRec;
+    }
+    CPU_CRITICAL_EXIT();
+
+    if (size == 0u) {
+       *p_err = OS_ERR_TASK_STK_PROFILE_NONE;
+        return (0u);
+    }
+   *p_err = OS_ERR_NONE;
+    return (size);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                   SUSPEND A TASK
+*
+* Description: This function is called to suspend a task.  The task can be the calling task if 'p_tcb' is a NULL pointer
+*              or the pointer to the TCB of the calling task.
+*
+* Arguments  : p_tcb    is a pointer to the TCB to suspend.
+*                       If p_tcb is a NULL pointer then, suspend the current task.
+*
+*              p_err    is a pointer to a variable that will receive an error code from this function.
+*
+*                           OS_ERR_NONE                        If the requested task is suspended
+*                           OS_ERR_OS_NOT_RUNNING              If uC/OS-III is not running yet
+*                           OS_ERR_SCHED_LOCKED                You can't suspend the current task is the scheduler is
+*                                                                  locked
+*                           OS_ERR_STATE_INVALID               If the task is in an invalid state
+*                           OS_ERR_TASK_SUSPEND_CTR_OVF        If the nesting counter overflowed.
+*                           OS_ERR_TASK_SUSPEND_ISR            If you called this function from an ISR
+*                           OS_ERR_TASK_SUSPEND_IDLE           If you attempted to suspend the idle task which is not
+*                                                                  allowed
+*                           OS_ERR_TASK_SUSPEND_INT_HANDLER    If you attempted to suspend the idle task which is not
+*                                                                  allowed
+*
+* Returns    : none
+*
+* Note(s)    : 1) You should use this function with great care.  If you suspend a task that is waiting for an event
+*                 (i.e. a message, a semaphore, a queue ...) you will prevent this task from running when the event
+*                 arrives.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_SUSPEND_EN > 0u)
+void   OSTaskSuspend (OS_TCB  *p_tcb,
+                      OS_ERR  *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+    OS_TRACE_TASK_SUSPEND_ENTER(p_tcb);
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_TASK_SUSPEND_ISR;
+        OS_TRACE_TASK_SUSPEND_EXIT(OS_ERR_TASK_SUSPEND_ISR);
+        return;
+    }
+#endif
+
+#if (OS_CFG_TASK_IDLE_EN > 0u)
+    if (p_tcb == &OSIdleTaskTCB) {                              /* Make sure not suspending the idle task               */
+       *p_err = OS_ERR_TASK_SUSPEND_IDLE;
+        OS_TRACE_TASK_SUSPEND_EXIT(OS_ERR_TASK_SUSPEND_IDLE);
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {                                 /* See if specified to suspend self                     */
+        if (OSRunning != OS_STATE_OS_RUNNING) {                 /* Can't suspend self when the kernel isn't running     */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_OS_NOT_RUNNING;
+            OS_TRACE_TASK_SUSPEND_EXIT(OS_ERR_OS_NOT_RUNNING);
+            return;
+        }
+        p_tcb = OSTCBCurPtr;
+    }
+
+    if (p_tcb == OSTCBCurPtr) {
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't suspend when the scheduler is locked           */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_SCHED_LOCKED;
+            OS_TRACE_TASK_SUSPEND_EXIT(OS_ERR_SCHED_LOCKED);
+            return;
+        }
+    }
+
+    OS_TaskSuspend(p_tcb, p_err);
+    CPU_CRITICAL_EXIT();
+    if (*p_err != OS_ERR_NONE) {
+        OS_TRACE_TASK_SUSPEND_EXIT(*p_err);
+        return;
+    }
+
+    if (OSRunning == OS_STATE_OS_RUNNING) {                     /* Only schedule when the kernel is running             */
+        OSSched();
+        OS_TRACE_TASK_SUSPEND_EXIT(OS_ERR_NONE);
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                SET A TASK'S DELAY SLACK
+*
+* Description: This function is called to specify by how much the delays and timeouts of a task may be postponed so
+*              that the task wakes up together with another delayed task.
+*
+* Arguments  : p_tcb        is the pointer to the TCB of the task to change. If you specify an NULL pointer, the current
+*                           task is assumed.
+*
+*              slack        is the maximum number of ticks by which the task may become ready late.  A value of 0 makes
+*                           the task wake up exactly on time (the default).
+*
+*              p_err        is a pointer to an error code returned by this function:
+*
+*                               OS_ERR_NONE       Upon success
+*                               OS_ERR_SET_ISR    If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) The slack only applies to delays and timeouts started after the call.
+*
+*              2) Coalescing reduces the number of tick interrupts in Dynamic Tick Mode.  In Periodic Tick Mode, a
+*                 tick interrupt occurs every tick anyway and only the wake-ups of the tasks are grouped.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SLACK_EN > 0u) && (OS_CFG_TICK_EN > 0u)
+void  OSTaskSlackSet (OS_TCB   *p_tcb,
+                      OS_TICK   slack,
+                      OS_ERR   *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't call this function from an ISR                 */
+       *p_err = OS_ERR_SET_ISR;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {
+        p_tcb = OSTCBCurPtr;
+    }
+    p_tcb->TickSlack = slack;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                               SET THE PERIOD OF A TASK
+*
+* Description: This function is called to make a task periodic.  The task then calls OSTaskPeriodWait() at the end of
+*              each job to wait for its next release.  Releases are kept at fixed multiples of 'period' from the
+*              first one, so they don't drift with the time the jobs take.
+*
+*              With OS_CFG_TASK_EDF_EN, the period is also the relative deadline of the task when it runs at the EDF
+*              priority level (OS_CFG_TASK_EDF_PRIO).  The deadline of each job is the start of its next period.
+*
+* Arguments  : p_tcb        is the pointer to the TCB of the task to change. If you specify an NULL pointer, the current
+*                           task is assumed.
+*
+*              period       is the period of the task, in ticks.  0 makes the task aperiodic (and removes its deadline,
+*                           see OS_RdyListInsertEDF()).
+*
+*              opt          specifies what OSTaskPeriodWait() does when the task overran one or more releases:
+*
+*                               OS_OPT_TASK_PERIOD_SKIP      Skip the missed releases and wait for the next one
+*                               OS_OPT_TASK_PERIOD_CATCH_UP  Start the missed releases back to back, without waiting
+*
+*              p_err        is a pointer to an error code returned by this function:
+*
+*                               OS_ERR_NONE         Upon success
+*                               OS_ERR_OPT_INVALID  If you specified an invalid option
+*                               OS_ERR_SET_ISR      If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) The current release is now: the first call to OSTaskPeriodWait() waits until the current tick plus
+*                 'period'.
+*
+*              2) The overrun counter and the jitter statistics of the task are cleared.
+*
+*              3) The period stays with the task if its priority is changed.
+*
+*              4) With OS_CFG_STAT_SCHED_EN, the execution time of the task is measured again from scratch, the first
+*                 job running from this call to the first call to OSTaskPeriodWait().
+************************************************************************************************************************
+*/
+
+#if (OS_TASK_PERIOD_EN > 0u)
+void  OSTaskPeriodSet (OS_TCB   *p_tcb,
+                       OS_TICK   period,
+                       OS_OPT    opt,
+                       OS_ERR   *p_err)
+{
+    OS_TICK  tick_now;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't call this function from an ISR                 */
+       *p_err = OS_ERR_SET_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_TASK_PERIOD_SKIP:
+        case OS_OPT_TASK_PERIOD_CATCH_UP:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {
+        p_tcb = OSTCBCurPtr;
+    }
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    tick_now                = OSTickCtr + OS_DynTickGet();
+#else
+    tick_now                = OSTickCtr;
+#endif
+    p_tcb->Period           = period;
+    p_tcb->PeriodRelease    = tick_now;                         /* See Note #1                                          */
+    p_tcb->PeriodOpt        = opt;
+    p_tcb->PeriodOvrCtr     = 0u;                               /* See Note #2                                          */
+    p_tcb->PeriodJitter     = 0u;
+    p_tcb->PeriodJitterMax  = 0u;
+#if (OS_CFG_STAT_TASK_EN > 0u)
+    p_tcb->PeriodOvrCtrStat = 0u;
+#endif
+#if (OS_CFG_STAT_SCHED_EN > 0u)
+    p_tcb->SchedJobStart    = OS_StatSchedCyclesGet(p_tcb);     /* The first job starts now (see Note #4)               */
+    p_tcb->SchedWCET        = 0u;
+    p_tcb->SchedResp        = 0u;
+#endif
+#if (OS_CFG_TASK_EDF_EN > 0u)
+    p_tcb->EDFDeadline      = tick_now + period;
+    if ((p_tcb->Prio      == OS_CFG_TASK_EDF_PRIO) &&           /* Sort the task again if it is ready                   */
+        (p_tcb->TaskState == OS_TASK_STATE_RDY)) {
+        OS_RdyListRemove(p_tcb);
+        OS_RdyListInsertTail(p_tcb);
+    }
+#endif
+    CPU_CRITICAL_EXIT();
+
+#if (OS_CFG_TASK_EDF_EN > 0u)
+    if (OSRunning == OS_STATE_OS_RUNNING) {
+        OSSched();                                              /* The earliest deadline may have changed               */
+    }
+#endif
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                          WAIT FOR THE NEXT RELEASE OF A TASK
+*
+* Description: This function is called by a periodic task (see OSTaskPeriodSet()) at the end of each job.  It delays
+*              the task until its next release.
+*
+* Arguments  : p_err        is a pointer to an error code returned by this function:
+*
+*                               OS_ERR_NONE            Upon success
+*                               OS_ERR_OS_NOT_RUNNING  If uC/OS-III is not running yet
+*                               OS_ERR_SCHED_LOCKED    If the scheduler is locked
+*                               OS_ERR_TIME_DLY_ISR    If you called this function from an ISR
+*                               OS_ERR_TIME_ZERO_DLY   If the task has no period (see OSTaskPeriodSet())
+*
+* Returns    : The number of releases that were already due when the job ended, 0 if the task kept up with its period.
+*
+* Note(s)    : 1) The next release is the current one plus the period.  When the job ran past it, the task overran and
+*                 the policy given to OSTaskPeriodSet() applies:
+*
+*                     OS_OPT_TASK_PERIOD_SKIP      The missed releases are added to '.PeriodOvrCtr' and the task
+*                                                  waits for the first release still to come, in phase with the
+*                                                  previous ones.
+*
+*                     OS_OPT_TASK_PERIOD_CATCH_UP  The next release is started at once and counted in '.PeriodOvrCtr'.
+*                                                  The task returns without waiting until it is back on schedule.
+*
+*              2) '.PeriodJitter' is the number of ticks between the release and the task returning from this
+*                 function, '.PeriodJitterMax' its peak.  Both are measured with the resolution of the tick.
+*
+*              3) A task made ready before its release (e.g. by OSTimeDlyResume()) is considered on time and its next
+*                 call waits for the release that follows.
+*
+*              4) With OS_CFG_STAT_SCHED_EN, the cycles the task used since its previous call are its execution time
+*                 for the job that just ended.  The longest one is kept in '.SchedWCET' for the statistic task, which
+*                 checks that the periodic tasks can still meet their deadlines (see OS_StatSchedChk()).
+************************************************************************************************************************
+*/
+
+#if (OS_TASK_PERIOD_EN > 0u)
+OS_CTR  OSTaskPeriodWait (OS_ERR  *p_err)
+{
+    OS_TCB   *p_tcb;
+    OS_TICK   tick_now;
+    OS_TICK   elapsed;
+    OS_TICK   jitter;
+    OS_CTR    missed;
+#if (OS_CFG_STAT_SCHED_EN > 0u)
+    OS_CYCLES cycles;
+#endif
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_TIME_DLY_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+    if (OSSchedLockNestingCtr > 0u) {                           /* Can't delay when the scheduler is locked             */
+       *p_err = OS_ERR_SCHED_LOCKED;
+        return (0u);
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_tcb = OSTCBCurPtr;
+    if (p_tcb->Period == 0u) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_TIME_ZERO_DLY;
+        return (0u);
+    }
+
+#if (OS_CFG_STAT_SCHED_EN > 0u)
+    cycles = OS_StatSchedCyclesGet(p_tcb);                      /* Execution time of the job (see Note #4)              */
+    if (p_tcb->SchedWCET < (OS_CYCLES)(cycles - p_tcb->SchedJobStart)) {
+        p_tcb->SchedWCET = (OS_CYCLES)(cycles - p_tcb->SchedJobStart);
+    }
+    p_tcb->SchedJobStart = cycles;                              /* A blocked task uses no cycles: next job starts here  */
+#endif
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    tick_now = OSTickCtr + OS_DynTickGet();
+#else
+    tick_now = OSTickCtr;
+#endif
+    elapsed  = tick_now - p_tcb->PeriodRelease;                 /* Time since the current release                       */
+    if (elapsed > ((OS_TICK)~(OS_TICK)0u >> 1u)) {              /* Made ready before its release (see Note #3)          */
+        elapsed = 0u;
+    }
+    missed   = (OS_CTR)(elapsed / p_tcb->Period);               /* Number of releases already due (see Note #1)         */
+
+    if ((missed           >                           0u) &&
+        (p_tcb->PeriodOpt == OS_OPT_TASK_PERIOD_CATCH_UP)) {
+        p_tcb->PeriodRelease += p_tcb->Period;                  /* Start the next release now                           */
+        p_tcb->PeriodOvrCtr++;
+        jitter                = tick_now - p_tcb->PeriodRelease;
+        p_tcb->PeriodJitter   = jitter;
+        if (p_tcb->PeriodJitterMax < jitter) {
+            p_tcb->PeriodJitterMax = jitter;
+        }
+#if (OS_CFG_TASK_EDF_EN > 0u)
+        p_tcb->EDFDeadline    = p_tcb->PeriodRelease + p_tcb->Period;
+        if (p_tcb->Prio == OS_CFG_TASK_EDF_PRIO) {              /* The deadline moved, sort the task again              */
+            OS_RdyListRemove(p_tcb);
+            OS_RdyListInsertTail(p_tcb);
+        }
+#endif
+        CPU_CRITICAL_EXIT();
+#if (OS_CFG_TASK_EDF_EN > 0u)
+        OSSched();
+#endif
+       *p_err = OS_ERR_NONE;
+        return (missed);
+    }
+
+    p_tcb->PeriodOvrCtr  += missed;                             /* Skip the releases that are due, if any               */
+    p_tcb->PeriodRelease += p_tcb->Period * (OS_TICK)(missed + 1u);
+    OS_TickListInsertDly(p_tcb,                                 /* Delay until the next release                         */
+                         p_tcb->PeriodRelease,
+                         OS_OPT_TIME_MATCH,
+                         p_err);
+    if (*p_err != OS_ERR_NONE) {
+        CPU_CRITICAL_EXIT();
+        return (missed);
+    }
+
+    OS_RdyListRemove(p_tcb);                                    /* Remove current task from ready list                  */
+#if (OS_CFG_TASK_EDF_EN > 0u)
+    p_tcb->EDFDeadline = p_tcb->PeriodRelease                   /* Deadline is the end of the period being waited for   */
+                       + p_tcb->Period;
+#endif
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find next task to run!                               */
+
+    CPU_CRITICAL_ENTER();                                       /* Measure the release jitter (see Note #2)             */
+    jitter = OSTickCtr - p_tcb->PeriodRelease;
+    if (jitter > ((OS_TICK)~(OS_TICK)0u >> 1u)) {               /* Made ready before its release                        */
+        jitter = 0u;
+    }
+    p_tcb->PeriodJitter = jitter;
+    if (p_tcb->PeriodJitterMax < jitter) {
+        p_tcb->PeriodJitterMax = jitter;
+    }
+    CPU_CRITICAL_EXIT();
+    return (missed);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                               SET A TASK'S CPU BUDGET
+*
+* Description: This function is called to limit the CPU time a task can use in each period.  When the task has used
+*              'budget' within the current period, it is demoted to OS_CFG_TASK_BUDGET_PRIO or suspended until the start
+*              of the next period, when its budget is replenished.
+*
+* Arguments  : p_tcb        is the pointer to the TCB of the task to change. If you specify an NULL pointer, the current
+*                           task is assumed.
+*
+*              budget       is the CPU time allowed per period, in OS_TS_GET() units.  0 removes the budget.
+*
+*              period       is the replenishment period, in ticks.  The first period starts now.
+*
+*              opt          specifies what happens when the budget is exhausted:
+*
+*                               OS_OPT_TASK_BUDGET_DEMOTE   The task runs at OS_CFG_TASK_BUDGET_PRIO (background)
+*                               OS_OPT_TASK_BUDGET_SUSPEND  The task is suspended
+*
+*              p_err        is a pointer to an error code returned by this function:
+*
+*                               OS_ERR_NONE                 Upon success
+*                               OS_ERR_OPT_INVALID          If you specified an invalid option
+*                               OS_ERR_SET_ISR              If you called this function from an ISR
+*                               OS_ERR_TASK_BUDGET_PERIOD   If 'period' is 0 with a non-zero 'budget'
+*
+* Returns    : none
+*
+* Note(s)    : 1) The CPU time is charged when the task is switched out and on every tick while it runs.  The budget is
+*                 enforced on the tick, so a task can overrun its budget by up to one tick.
+*
+*              2) OS_AppTaskBudgetHookPtr, if set, is called from the tick ISR when the budget of a task is exhausted.
+*
+*              3) A task demoted to OS_CFG_TASK_BUDGET_PRIO gets its base priority back on replenishment.  A priority set
+*                 by OSTaskChangePrio() while it is demoted is replaced.  A mutex owner keeps its inherited priority.
+*
+*              4) OSTaskResume() of a task suspended for its budget lets it run before the replenishment.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+void  OSTaskBudgetSet (OS_TCB   *p_tcb,
+                       CPU_TS    budget,
+                       OS_TICK   period,
+                       OS_OPT    opt,
+                       OS_ERR   *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't call this function from an ISR                 */
+       *p_err = OS_ERR_SET_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_TASK_BUDGET_DEMOTE:
+#if (OS_CFG_TASK_SUSPEND_EN > 0u)
+        case OS_OPT_TASK_BUDGET_SUSPEND:
+#endif
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+    if ((budget >  0u) &&                                       /* A budget needs a replenishment period                */
+        (period == 0u)) {
+       *p_err = OS_ERR_TASK_BUDGET_PERIOD;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {
+        p_tcb = OSTCBCurPtr;
+    }
+    if (p_tcb->BudgetCycles > 0u) {                             /* Drop the previous budget                             */
+        if (p_tcb->BudgetExhausted == OS_TRUE) {
+            OS_TaskBudgetRestore(p_tcb);
+        }
+        OS_TaskBudgetRemove(p_tcb);
+    }
+
+    if (budget > 0u) {
+        p_tcb->BudgetCycles    = budget;
+        p_tcb->BudgetUsed      = 0u;
+        p_tcb->BudgetStart     = OS_TS_GET();
+        p_tcb->BudgetPeriod    = period;
+        p_tcb->BudgetReplenish = OSTickCtr + period;
+        p_tcb->BudgetOpt       = opt;
+        p_tcb->BudgetExhausted = OS_FALSE;
+        p_tcb->BudgetPrevPtr   = (OS_TCB *)0;                   /* Insert at the head of the budget list                */
+        p_tcb->BudgetNextPtr   = OSTaskBudgetListPtr;
+        if (OSTaskBudgetListPtr == (OS_TCB *)0) {
+            OSTaskBudgetReplenishTick = p_tcb->BudgetReplenish;
+        } else {
+            OSTaskBudgetListPtr->BudgetPrevPtr = p_tcb;
+            if ((OS_TASK_BUDGET_DUE(OSTaskBudgetReplenishTick) == OS_FALSE) &&  /* Replenished before the others?  */
+                ((OS_TICK)(p_tcb->BudgetReplenish - OSTaskBudgetReplenishTick) > ((OS_TICK)~(OS_TICK)0u >> 1u))) {
+                OSTaskBudgetReplenishTick = p_tcb->BudgetReplenish;
+            }
+        }
+        OSTaskBudgetListPtr    = p_tcb;
+    }
+    CPU_CRITICAL_EXIT();
+
+    if (OSRunning == OS_STATE_OS_RUNNING) {
+        OSSched();                                              /* The task may have been given its priority back       */
+    }
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                      SET A TASK'S MINIMUM PERFORMANCE LEVEL
+*
+* Description: This function is called to keep the CPU at or above a performance level while a task runs, whatever the
+*              level chosen by the frequency governor from the CPU usage (see OSStatGovSet()).
+*
+* Arguments  : p_tcb        is the pointer to the TCB of the task to change. If you specify an NULL pointer, the current
+*                           task is assumed.
+*
+*              lvl          is the minimum performance level of the task.  0 lets the governor decide alone; a level
+*                           above 'LvlMax' of the governor is treated as 'LvlMax'.
+*
+*              p_err        is a pointer to an error code returned by this function:
+*
+*                               OS_ERR_NONE       Upon success
+*                               OS_ERR_SET_ISR    If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) The level is applied when the task is switched in and given back when it is switched out, so every
+*                 switch between this task and a task needing a lower level calls the 'SetFnct' of the governor.
+*                 It takes effect at once when the task changes its own level.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_STAT_GOV_EN > 0u)
+void  OSTaskPerfLvlSet (OS_TCB       *p_tcb,
+                        OS_PERF_LVL   lvl,
+                        OS_ERR       *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't call this function from an ISR                 */
+       *p_err = OS_ERR_SET_ISR;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {
+        p_tcb = OSTCBCurPtr;
+    }
+    p_tcb->PerfLvlMin = lvl;
+    if (p_tcb == OSTCBCurPtr) {                                 /* See Note #1                                          */
+        OS_StatGovSw(p_tcb);
+    }
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                      SET A TASK'S WEIGHT AT THE FAIR-SHARE LEVEL
+*
+* Description: This function is called to change the share of the CPU a task gets when it runs at the fair-share
+*              priority level (OS_CFG_TASK_FAIR_PRIO).  The tasks of that level share the CPU time left by the higher
+*              priorities in proportion to their weights.
+*
+* Arguments  : p_tcb        is the pointer to the TCB of the task to change. If you specify an NULL pointer, the current
+*                           task is assumed.
+*
+*              weight       is the weight of the task.  A task created at that level has a weight of
+*                           OS_TASK_FAIR_WEIGHT_DFLT; a task with twice that weight gets twice as much CPU time.
+*
+*              p_err        is a pointer to an error code returned by this function:
+*
+*                               OS_ERR_NONE                 Upon success
+*                               OS_ERR_SET_ISR              If you called this function from an ISR
+*                               OS_ERR_TASK_FAIR_WEIGHT     If 'weight' is 0
+*
+* Returns    : none
+*
+* Note(s)    : 1) The level runs the ready task with the smallest virtual runtime, i.e. CPU time used multiplied by
+*                 OS_TASK_FAIR_WEIGHT_DFLT / weight.  The CPU time is charged when the task is switched out and on every
+*                 tick while it runs, so a task runs at least until the next tick once it got the CPU.
+*
+*              2) The time already used by the task is charged with its previous weight.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_FAIR_EN > 0u)
+void  OSTaskFairSet (OS_TCB      *p_tcb,
+                     CPU_INT16U   weight,
+                     OS_ERR      *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't call this function from an ISR                 */
+       *p_err = OS_ERR_SET_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (weight == 0u) {                                         /* A task needs a share of the level                    */
+       *p_err = OS_ERR_TASK_FAIR_WEIGHT;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {
+        p_tcb = OSTCBCurPtr;
+    }
+    if ((p_tcb       == OSTCBCurPtr) &&                         /* See Note #2                                          */
+        (p_tcb->Prio == OS_CFG_TASK_FAIR_PRIO)) {
+        OS_TaskFairCharge(p_tcb, OS_TS_GET());
+    }
+    p_tcb->FairWeight = weight;
+    CPU_CRITICAL_EXIT();
+
+    if (OSRunning == OS_STATE_OS_RUNNING) {
+        OSSched();                                              /* Another task of the level may be ahead now           */
+    }
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                CHANGE A TASK'S TIME SLICE
+*
+* Description: This function is called to change the value of the task's specific time slice.
+*
+* Arguments  : p_tcb        is the pointer to the TCB of the task to change. If you specify an NULL pointer, the current
+*                           task is assumed.
+*
+*              time_quanta  is the number of ticks before the CPU is taken away when round-robin scheduling is enabled.
+*                           It is a number of microseconds when OS_CFG_SCHED_ROUND_ROBIN_TS_EN is enabled.
+*
+*              p_err        is a pointer to an error code returned by this function:
+*
+*                               OS_ERR_NONE       Upon success
+*                               OS_ERR_SET_ISR    If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
+void  OSTaskTimeQuantaSet (OS_TCB   *p_tcb,
+                           OS_TICK   time_quanta,
+                           OS_ERR   *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't call this function from an ISR                 */
+       *p_err = OS_ERR_SET_ISR;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {
+        p_tcb = OSTCBCurPtr;
+    }
+
+    if (time_quanta == 0u) {
+        p_tcb->TimeQuanta    = OSSchedRoundRobinDfltTimeQuanta;
+    } else {
+        p_tcb->TimeQuanta    = time_quanta;
+    }
+    if (p_tcb->TimeQuanta > p_tcb->TimeQuantaCtr) {
+        p_tcb->TimeQuantaCtr = p_tcb->TimeQuanta;
+    }
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                 CPU BUDGET ACCOUNTING
+*
+* Description: OS_TaskBudgetRemove() is called to remove a task from the list of tasks with a CPU budget.
+*
+*              OS_TaskBudgetSw() is called by the scheduler when it switches to 'p_tcb'.  It charges the CPU time used
+*              by the current task since it was switched in, and starts the accounting of 'p_tcb'.
+*
+*              OS_TaskBudgetTick() is called on every tick.  It charges the running task, enforces its budget and
+*              replenishes the budgets whose period has ended.
+*
+* Arguments  : p_tcb     is a pointer to the OS_TCB of the task
+*
+* Returns    : none
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application MUST NOT call them.
+*
+*              2) OS_TaskBudgetRemove() and OS_TaskBudgetSw() are called with interrupts disabled.
+*
+*              3) The list of budgets is only walked when the earliest replenishment, OSTaskBudgetReplenishTick, is
+*                 due.  A task that missed several periods (e.g. in Dynamic Tick Mode) starts a new period from the
+*                 current tick.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+void  OS_TaskBudgetRemove (OS_TCB  *p_tcb)
+{
+    if (p_tcb->BudgetPrevPtr == (OS_TCB *)0) {
+        OSTaskBudgetListPtr                  = p_tcb->BudgetNextPtr;
+    } else {
+        p_tcb->BudgetPrevPtr->BudgetNextPtr  = p_tcb->BudgetNextPtr;
+    }
+    if (p_tcb->BudgetNextPtr != (OS_TCB *)0) {
+        p_tcb->BudgetNextPtr->BudgetPrevPtr  = p_tcb->BudgetPrevPtr;
+    }
+    p_tcb->BudgetNextPtr   = (OS_TCB *)0;
+    p_tcb->BudgetPrevPtr   = (OS_TCB *)0;
+    p_tcb->BudgetCycles    = 0u;
+    p_tcb->BudgetExhausted = OS_FALSE;
+}
+
+
+void  OS_TaskBudgetSw (OS_TCB  *p_tcb)
+{
+    CPU_TS  ts;
+
+
+    ts = OS_TS_GET();
+    if ((OSTCBCurPtr->BudgetCycles    >        0u) &&
+        (OSTCBCurPtr->BudgetExhausted == OS_FALSE)) {
+        OSTCBCurPtr->BudgetUsed += ts - OSTCBCurPtr->BudgetStart;
+    }
+    p_tcb->BudgetStart = ts;
+}
+
+
+void  OS_TaskBudgetTick (void)
+{
+    OS_TCB   *p_tcb;
+    OS_TCB   *p_tcb_exhausted;
+    OS_TICK   tick_next;
+    CPU_TS    ts;
+    CPU_SR_ALLOC();
+
+
+
+    p_tcb_exhausted = (OS_TCB *)0;
+    CPU_CRITICAL_ENTER();
+    p_tcb = OSTCBCurPtr;                                        /* Charge the running task                              */
+    if ((p_tcb->BudgetCycles    >        0u) &&
+        (p_tcb->BudgetExhausted == OS_FALSE)) {
+        ts                  = OS_TS_GET();
+        p_tcb->BudgetUsed  += ts - p_tcb->BudgetStart;
+        p_tcb->BudgetStart  = ts;
+        if (p_tcb->BudgetUsed >= p_tcb->BudgetCycles) {         /* Budget exhausted?                                    */
+            OS_TaskBudgetExhaust(p_tcb);
+            p_tcb_exhausted = p_tcb;
+        }
+    }
+
+    if ((OSTaskBudgetListPtr != (OS_TCB *)0) &&                 /* Any replenishment due? (See Note #3)                 */
+        (OS_TASK_BUDGET_DUE(OSTaskBudgetReplenishTick) == OS_TRUE)) {
+        p_tcb     = OSTaskBudgetListPtr;
+        tick_next = 0u;
+        while (p_tcb != (OS_TCB *)0) {
+            if (OS_TASK_BUDGET_DUE(p_tcb->BudgetReplenish) == OS_TRUE) {
+                p_tcb->BudgetUsed       = 0u;                   /* Start a new period                                   */
+                p_tcb->BudgetReplenish += p_tcb->BudgetPeriod;
+                if (OS_TASK_BUDGET_DUE(p_tcb->BudgetReplenish) == OS_TRUE) {
+                    p_tcb->BudgetReplenish = OSTickCtr + p_tcb->BudgetPeriod;
+                }
+                if (p_tcb->BudgetExhausted == OS_TRUE) {
+                    OS_TaskBudgetRestore(p_tcb);
+                }
+            }
+            if ((p_tcb == OSTaskBudgetListPtr) ||               /* Earliest replenishment so far                        */
+                ((OS_TICK)(p_tcb->BudgetReplenish - tick_next) > ((OS_TICK)~(OS_TICK)0u >> 1u))) {
+                tick_next = p_tcb->BudgetReplenish;
+            }
+            p_tcb = p_tcb->BudgetNextPtr;
+        }
+        OSTaskBudgetReplenishTick = tick_next;
+    }
+    CPU_CRITICAL_EXIT();
+
+#if (OS_CFG_APP_HOOKS_EN > 0u)
+    if ((p_tcb_exhausted         != (OS_TCB        *)0) &&
+        (OS_AppTaskBudgetHookPtr != (OS_APP_HOOK_TCB)0)) {
+        (*OS_AppTaskBudgetHookPtr)(p_tcb_exhausted);
+    }
+#else
+    (void)p_tcb_exhausted;
+#endif
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                       ACCOUNT THE CPU TIME OF THE FAIR-SHARE LEVEL
+*
+* Description: OS_TaskFairSw() is called by the scheduler when it switches to 'p_tcb'.  It charges the CPU time used by
+*              the current task since it was last charged, and starts the accounting of 'p_tcb'.
+*
+*              OS_TaskFairTick() is called on every tick.  It charges the running task so that a task of the level
+*              whose virtual runtime is now smaller gets the CPU when the tick ISR returns.
+*
+*              OS_TaskFairCharge() adds the CPU time used by a task since 'FairStart', scaled by its weight, to its
+*              virtual runtime.  A ready task is moved behind the tasks of the level that are now ahead of it.
+*
+* Arguments  : p_tcb     is a pointer to the OS_TCB of the task
+*
+*              ts        is the current timestamp
+*
+* Returns    : none
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application MUST NOT call them.
+*
+*              2) OS_TaskFairSw() and OS_TaskFairCharge() are called with interrupts disabled.
+*
+*              3) OSTaskFairVRuntimeMin follows the smallest virtual runtime of the ready tasks of the level and never
+*                 goes back, see OS_RdyListInsertFair().
+*
+*              4) A charge is limited to a quarter of the range of CPU_TS, so that a task with a small weight that ran
+*                 for a long time stays comparable with the other tasks of the level.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_FAIR_EN > 0u)
+void  OS_TaskFairSw (OS_TCB  *p_tcb)
+{
+    CPU_TS  ts;
+
+
+    ts = OS_TS_GET();
+    if (OSTCBCurPtr->Prio == OS_CFG_TASK_FAIR_PRIO) {
+        OS_TaskFairCharge(OSTCBCurPtr, ts);
+    }
+    p_tcb->FairStart = ts;
+}
+
+
+void  OS_TaskFairTick (void)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    if (OSTCBCurPtr->Prio == OS_CFG_TASK_FAIR_PRIO) {           /* Charge the running task                              */
+        OS_TaskFairCharge(OSTCBCurPtr, OS_TS_GET());
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+
+static  void  OS_TaskFairCharge (OS_TCB  *p_tcb,
+                                 CPU_TS   ts)
+{
+    OS_TCB      *p_tcb_head;
+    CPU_INT64U   vdelta;
+
+
+    vdelta           = ((CPU_INT64U)(CPU_TS)(ts - p_tcb->FairStart) * OS_TASK_FAIR_WEIGHT_DFLT) / p_tcb->FairWeight;
+    p_tcb->FairStart = ts;
+    if (vdelta > (CPU_INT64U)((CPU_TS)~(CPU_TS)0u >> 2u)) {     /* See Note #4                                          */
+        vdelta = (CPU_INT64U)((CPU_TS)~(CPU_TS)0u >> 2u);
+    }
+    p_tcb->FairVRuntime += (CPU_TS)vdelta;
+    if (p_tcb->TaskState == OS_TASK_STATE_RDY) {
+        OS_RdyListMoveFair(p_tcb);
+    }
+
+                                                                /* See Note #3                                          */
+    p_tcb_head = OSRdyList[OS_PRIO_IX(OS_CFG_TASK_FAIR_PRIO)].HeadPtr;
+    if ((p_tcb_head != (OS_TCB *)0) &&
+        (OS_TASK_FAIR_BEFORE(OSTaskFairVRuntimeMin, p_tcb_head->FairVRuntime) == OS_TRUE)) {
+        OSTaskFairVRuntimeMin = p_tcb_head->FairVRuntime;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                            ADD/REMOVE TASK TO/FROM DEBUG LIST
+*
+* Description: These functions are called by uC/OS-III to add or remove an OS_TCB from the debug list.
+*
+* Arguments  : p_tcb     is a pointer to the OS_TCB to add/remove
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN > 0u)
+void  OS_TaskDbgListAdd (OS_TCB  *p_tcb)
+{
+    p_tcb->DbgPrevPtr                = (OS_TCB *)0;
+    if (OSTaskDbgListPtr == (OS_TCB *)0) {
+        p_tcb->DbgNextPtr            = (OS_TCB *)0;
+    } else {
+        p_tcb->DbgNextPtr            =  OSTaskDbgListPtr;
+        OSTaskDbgListPtr->DbgPrevPtr =  p_tcb;
+    }
+    OSTaskDbgListPtr                 =  p_tcb;
+
+#if (OS_CFG_OBJ_REG_EN > 0u)
+    OS_ObjRegAdd((void *)p_tcb, OS_OBJ_TYPE_TASK, p_tcb->NamePtr);
+#endif
+}
+
+
+
+void  OS_TaskDbgListRemove (OS_TCB  *p_tcb)
+{
+    OS_TCB  *p_tcb_next;
+    OS_TCB  *p_tcb_prev;
+
+
+    p_tcb_prev = p_tcb->DbgPrevPtr;
+    p_tcb_next = p_tcb->DbgNextPtr;
+
+#if (OS_CFG_STAT_TASK_EN > 0u) && (OS_CFG_STAT_TASK_BUDGET > 0u)
+    if (OSStatTaskTCBNextPtr == p_tcb) {                        /* Don't leave the statistic task on a removed TCB      */
+        OSStatTaskTCBNextPtr = p_tcb_next;
+    }
+#endif
+
+    if (p_tcb_prev == (OS_TCB *)0) {
+        OSTaskDbgListPtr = p_tcb_next;
+        if (p_tcb_next != (OS_TCB *)0) {
+            p_tcb_next->DbgPrevPtr = (OS_TCB *)0;
+        }
+        p_tcb->DbgNextPtr = (OS_TCB *)0;
+
+    } else if (p_tcb_next == (OS_TCB *)0) {
+        p_tcb_prev->DbgNextPtr = (OS_TCB *)0;
+        p_tcb->DbgPrevPtr      = (OS_TCB *)0;
+
+    } else {
+        p_tcb_prev->DbgNextPtr =  p_tcb_next;
+        p_tcb_next->DbgPrevPtr =  p_tcb_prev;
+        p_tcb->DbgNextPtr      = (OS_TCB *)0;
+        p_tcb->DbgPrevPtr      = (OS_TCB *)0;
+    }
+
+#if (OS_CFG_OBJ_REG_EN > 0u)
+    OS_ObjRegRemove((void *)p_tcb, OS_OBJ_TYPE_TASK, p_tcb->NamePtr);
+#endif
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                           UPDATE THE LATENCY HISTOGRAMS
+*
+* Description: OS_TaskHistRdy() is called when a task is inserted in the ready list.  It ends the measurement of the
+*              pend duration, if the task was pending, and starts the measurement of the wake to run latency.
+*
+*              OS_TaskHistSwIn() is called by the scheduler when it decides to switch to a task.  It ends the
+*              measurement of the wake to run latency.
+*
+* Arguments  : p_tcb     is a pointer to the TCB of the task
+*
+* Returns    : none
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application should not call them.
+*
+*              2) These functions are called with interrupts disabled.
+*
+*              3) A task that is inserted in the ready list while running (e.g. when its priority changes) is not
+*                 waiting to run, so no wake to run latency is measured.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_HIST_EN > 0u)
+void  OS_TaskHistRdy (OS_TCB  *p_tcb)
+{
+    CPU_TS  ts;
+
+
+    ts = OS_TS_GET();
+    if ((p_tcb->HistFlags & OS_TASK_HIST_FLAG_PEND) != 0u) {   /* End of a pend?                                       */
+        OS_TaskHistAdd(&p_tcb->Hist.PendTbl[0],
+                        ts - p_tcb->HistPendStart);
+        p_tcb->HistFlags &= (CPU_INT08U)~OS_TASK_HIST_FLAG_PEND;
+    }
+
+    if ((p_tcb != OSTCBCurPtr) &&                               /* See Note #3                                          */
+        ((p_tcb->HistFlags & OS_TASK_HIST_FLAG_RDY) == 0u)) {
+        p_tcb->HistRdyStart  = ts;
+        p_tcb->HistFlags    |= OS_TASK_HIST_FLAG_RDY;
+    }
+}
+
+
+void  OS_TaskHistSwIn (OS_TCB  *p_tcb)
+{
+    CPU_TS              delta;
+#if (OS_CFG_TASK_HIST_PRIO_EN > 0u)
+    OS_TASK_HIST_PRIO  *p_prio_hist;
+#endif
+
+
+    if ((p_tcb->HistFlags & OS_TASK_HIST_FLAG_RDY) == 0u) {
+        return;
+    }
+    p_tcb->HistFlags &= (CPU_INT08U)~OS_TASK_HIST_FLAG_RDY;
+
+    delta = OS_TS_GET() - p_tcb->HistRdyStart;
+    OS_TaskHistAdd(&p_tcb->Hist.WakeTbl[0], delta);
+    if (p_tcb->Hist.WakeMax < delta) {
+        p_tcb->Hist.WakeMax = delta;
+    }
+    p_tcb->Hist.WakeTotal += delta;
+    p_tcb->Hist.WakeNbr++;
+
+#if (OS_CFG_TASK_HIST_PRIO_EN > 0u)
+    p_prio_hist = &OSTaskHistPrioTbl[p_tcb->Prio];              /* Charge the priority the task runs at                 */
+    OS_TaskHistAdd(&p_prio_hist->WakeTbl[0], delta);
+    if (p_prio_hist->WakeMax < delta) {
+        p_prio_hist->WakeMax = delta;
+    }
+    p_prio_hist->WakeTotal += delta;
+    p_prio_hist->WakeNbr++;
+#endif
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                             TASK MANAGER INITIALIZATION
+*
+* Description: This function is called by OSInit() to initialize the task management.
+*
+
+* Argument(s): p_err        is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE     the call was successful
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+void  OS_TaskInit (OS_ERR  *p_err)
+{
+#if (OS_CFG_TASK_HIST_EN > 0u) && (OS_CFG_TASK_HIST_PRIO_EN > 0u)
+    CPU_DATA    prio;
+    CPU_INT08U  ix;
+#endif
+
+
+#if (OS_CFG_DBG_EN > 0u)
+    OSTaskDbgListPtr = (OS_TCB *)0;
+#endif
+
+    OSTaskQty        = 0u;                                      /* Clear the number of tasks                            */
+
+#if (OS_CFG_TASK_STK_CLR_DEFER_EN > 0u)
+    OSTaskStkClrListPtr = (OS_TCB *)0;                          /* No stack to clear yet                                */
+#endif
+
+#if (OS_CFG_TASK_STK_PROFILE_EN > 0u)
+    OSTaskStkProfileTblPtr = (OS_STK_PROFILE_TBL *)0;           /* No stack profile table until OSTaskStkProfileInit()  */
+#endif
+
+#if (OS_CFG_TASK_STK_FIT_EN > 0u)
+    OSTaskStkFitHeapPtr    = (OS_HEAP *)0;                      /* No heap until OSTaskStkFitHeapSet()                  */
+    OSTaskStkFitZombiePtr  = (CPU_STK *)0;
+#endif
+
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+    OSTaskBudgetListPtr       = (OS_TCB *)0;                    /* No task has a CPU budget yet                         */
+    OSTaskBudgetReplenishTick =           0u;
+#endif
+
+#if (OS_CFG_TASK_FAIR_EN > 0u)
+    OSTaskFairVRuntimeMin     =           0u;                   /* No CPU time used at the fair-share level yet         */
+#endif
+
+#if ((OS_CFG_TASK_PROFILE_EN > 0u) || (OS_CFG_DBG_EN > 0u))
+    OSTaskCtxSwCtr   = 0u;                                      /* Clear the context switch counter                     */
+#endif
+
+#if (OS_CFG_TASK_HIST_EN > 0u) && (OS_CFG_TASK_HIST_PRIO_EN > 0u)
+    for (prio = 0u; prio < OS_CFG_PRIO_MAX; prio++) {           /* No latency measured at any priority yet              */
+        for (ix = 0u; ix < OS_CFG_TASK_HIST_SIZE; ix++) {
+            OSTaskHistPrioTbl[prio].WakeTbl[ix] = 0u;
+        }
+        OSTaskHistPrioTbl[prio].WakeMax   = 0u;
+        OSTaskHistPrioTbl[prio].WakeTotal = 0u;
+        OSTaskHistPrioTbl[prio].WakeNbr   = 0u;
+    }
+#endif
+
+   *p_err            = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                               INITIALIZE TCB FIELDS
+*
+* Description: This function is called to initialize a TCB to default values
+*
+* Arguments  : p_tcb    is a pointer to the TCB to initialize
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+void  OS_TaskInitTCB (OS_TCB  *p_tcb)
+{
+#if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
+    OS_REG_ID   reg_id;
+#endif
+#if (OS_CFG_TASK_HIST_EN > 0u) || (OS_CFG_RWLOCK_EN > 0u) || (OS_CFG_TASK_PERF_CTR_EN > 0u)
+    CPU_INT08U  ix;
+#endif
+#if (OS_CFG_TASK_NOTIFY_EN > 0u)
+    OS_NOTIFY_ID  notify_id;
+#endif
+#if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
+    OS_TLS_ID   id;
+#endif
+
+
+    p_tcb->StkPtr               = (CPU_STK          *)0;
+    p_tcb->StkLimitPtr          = (CPU_STK          *)0;
+
+    p_tcb->ExtPtr               = (void             *)0;
+
+    p_tcb->NextPtr              = (OS_TCB           *)0;
+    p_tcb->PrevPtr              = (OS_TCB           *)0;
+
+#if (OS_CFG_TICK_EN > 0u)
+    p_tcb->TickNextPtr          = (OS_TCB           *)0;
+    p_tcb->TickPrevPtr          = (OS_TCB           *)0;
+#endif
+
+#if (OS_CFG_DBG_EN > 0u)
+    p_tcb->NamePtr              = (CPU_CHAR *)((void *)"?Task");
+#endif
+
+#if ((OS_CFG_DBG_EN > 0u) || (OS_CFG_STAT_TASK_STK_CHK_EN > 0u))
+    p_tcb->StkBasePtr           = (CPU_STK          *)0;
+#endif
+
+#if (OS_CFG_DBG_EN > 0u)
+    p_tcb->TaskEntryAddr        = (OS_TASK_PTR       )0;
+    p_tcb->TaskEntryArg         = (void             *)0;
+#endif
+
+#if (OS_CFG_TS_EN > 0u)
+    p_tcb->TS                   =                     0u;
+#endif
+
+#if (OS_TCB_MSG_EN > 0u)
+    p_tcb->MsgPtr               = (void             *)0;
+    p_tcb->MsgSize              =                     0u;
+#endif
+#if (OS_CFG_Q_POST_WAIT_EN > 0u)
+    p_tcb->QPostOpt             =                     0u;
+#endif
+#if (OS_CFG_Q_PEND_MATCH_EN > 0u)
+    p_tcb->QMatchFnct           = (OS_Q_MATCH_FNCT   )0;
+    p_tcb->QMatchArg            = (void             *)0;
+#endif
+
+#if (OS_CFG_TASK_Q_EN > 0u)
+    OS_MsgQInit(&p_tcb->MsgQ,
+                 0u);
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+    p_tcb->MsgQPendTime         =                     0u;
+    p_tcb->MsgQPendTimeMax      =                     0u;
+#endif
+#endif
+
+#if (OS_CFG_FLAG_EN > 0u)
+    p_tcb->FlagsPend            =                     0u;
+    p_tcb->FlagsOpt             =                     0u;
+    p_tcb->FlagsRdy             =                     0u;
+#if (OS_CFG_FLAG_WAIT_IDX_EN > 0u)
+    p_tcb->FlagIdxNextPtr       = (OS_TCB          *)0;
+    p_tcb->FlagIdxPrevPtr       = (OS_TCB          *)0;
+    p_tcb->FlagIdx              =       OS_FLAG_IDX_NONE;
+#endif
+#endif
+
+#if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
+    for (reg_id = 0u; reg_id < OS_CFG_TASK_REG_TBL_SIZE; reg_id++) {
+        p_tcb->RegTbl[reg_id]   =                     0u;
+    }
+#endif
+
+#if (OS_CFG_TASK_NOTIFY_EN > 0u)
+    for (notify_id = 0u; notify_id < OS_CFG_TASK_NOTIFY_SLOTS; notify_id++) {
+        p_tcb->NotifyValTbl[notify_id]  =             0u;
+        p_tcb->NotifyPendTbl[notify_id] =       OS_FALSE;
+    }
+    p_tcb->NotifyWaitId         =                     0u;
+#endif
+
+#if (OS_CFG_RCU_EN > 0u)
+    p_tcb->RcuGp                =                     0u;
+#endif
+
+#if (OS_CFG_CALL_EN > 0u)
+    p_tcb->CallClientPtr        = (OS_TCB           *)0;
+    p_tcb->CallSrvPtr           = (OS_TCB           *)0;
+#endif
+
+#if (OS_CFG_TASK_GRP_EN > 0u)
+    p_tcb->GrpPtr               = (OS_TASK_GRP      *)0;
+    p_tcb->GrpNextPtr           = (OS_TCB           *)0;
+    p_tcb->GrpPrevPtr           = (OS_TCB           *)0;
+#endif
+
+#if (OS_CFG_TASK_STK_GRP_EN > 0u)
+    p_tcb->StkGrpPtr            = (OS_TASK_STK_GRP  *)0;
+    p_tcb->StkGrpNextPtr        = (OS_TCB           *)0;
+    p_tcb->StkGrpTask           = (OS_TASK_PTR       )0;
+    p_tcb->StkGrpArg            = (void             *)0;
+    p_tcb->StkGrpDormant        =                     OS_FALSE;
+#endif
+
+#if (OS_CFG_HEAP_EN > 0u)
+    p_tcb->HeapBlkListPtr       = (OS_HEAP_BLK      *)0;
+    p_tcb->HeapSizeUsed         =                     0u;
+    p_tcb->HeapSizeUsedMax      =                     0u;
+#endif
+
+#if (OS_CFG_MEM_QUOTA_EN > 0u)
+    p_tcb->MemQuotaListPtr      = (OS_MEM_QUOTA     *)0;
+#endif
+
+#if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
+    for (id = 0u; id < OS_CFG_TLS_TBL_SIZE; id++) {
+        p_tcb->TLS_Tbl[id]      =                     0u;
     }
 #endif
 
     p_tcb->SemCtr               =                     0u;
+#if (OS_CFG_SEM_EN > 0u) && (OS_CFG_SEM_PEND_N_EN > 0u)
+    p_tcb->SemPendCnt           =                     0u;
+#endif
 #if (OS_CFG_TASK_PROFILE_EN > 0u)
     p_tcb->SemPendTime          =                     0u;
     p_tcb->SemPendTimeMax       =                     0u;
 #endif
 
-#if ((OS_CFG_DBG_EN > 0u) || (OS_CFG_STAT_TASK_STK_CHK_EN > 0u))
-    p_tcb->StkSize              =                     0u;
+#if ((OS_CFG_DBG_EN > 0u) || (OS_CFG_STAT_TASK_STK_CHK_EN > 0u))
+    p_tcb->StkSize              =                     0u;
+#endif
+
+
+#if (OS_CFG_TASK_SUSPEND_EN > 0u)
+    p_tcb->SuspendCtr           =                     0u;
+#endif
+
+#if (OS_CFG_TASK_STK_CLR_DEFER_EN > 0u)
+    p_tcb->StkClrPtr            = (CPU_STK          *)0;
+    p_tcb->StkClrNextPtr        = (OS_TCB           *)0;
+#endif
+
+#if (OS_CFG_TASK_STK_FIT_EN > 0u)
+    p_tcb->StkFitPtr            = (CPU_STK          *)0;
+#endif
+
+#if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u)
+    p_tcb->StkFree              =                     0u;
+    p_tcb->StkUsed              =                     0u;
+#if (OS_CFG_STAT_TASK_STK_CHK_INCR_EN > 0u)
+    p_tcb->StkChkFree           =                     0u;
+    p_tcb->StkChkIx             =                     0u;
+#endif
+#endif
+
+    p_tcb->Opt                  =                     0u;
+
+#if (OS_CFG_TASK_HIST_EN > 0u)
+    p_tcb->HistPendStart        =                     0u;
+    p_tcb->HistRdyStart         =                     0u;
+    p_tcb->HistFlags            =                     0u;
+    for (ix = 0u; ix < OS_CFG_TASK_HIST_SIZE; ix++) {
+        p_tcb->Hist.WakeTbl[ix] =                     0u;
+        p_tcb->Hist.PendTbl[ix] =                     0u;
+    }
+    p_tcb->Hist.WakeMax         =                     0u;
+    p_tcb->Hist.WakeTotal       =                     0u;
+    p_tcb->Hist.WakeNbr         =                     0u;
+#endif
+
+#if (OS_CFG_TICK_EN > 0u)
+    p_tcb->TickRemain           =                     0u;
+#if (OS_CFG_TIME_PERIODIC_EN > 0u)
+    p_tcb->TickCtrPrev          =                     0u;
+#endif
+    p_tcb->TickMatch            =                     0u;
+#if (OS_CFG_SLACK_EN > 0u)
+    p_tcb->TickSlack            =                     0u;
+#endif
+#if (OS_CFG_TIME_HR_EN > 0u)
+    p_tcb->TickHrDly            =                     0u;
+    p_tcb->TickHrMatch          =                     0u;
+#endif
+#if (OS_CFG_TIME_ABS_EN > 0u)
+    p_tcb->TickAbs              =               OS_FALSE;
+#endif
+#endif
+
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
+    p_tcb->TimeQuanta           =                     0u;
+    p_tcb->TimeQuantaCtr        =                     0u;
+#if (OS_CFG_SCHED_ROUND_ROBIN_TS_EN > 0u)
+    p_tcb->TimeQuantaTS         =                     0u;
+#endif
+#endif
+
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+    p_tcb->BudgetCycles         =                     0u;
+    p_tcb->BudgetUsed           =                     0u;
+    p_tcb->BudgetStart          =                     0u;
+    p_tcb->BudgetPeriod         =                     0u;
+    p_tcb->BudgetReplenish      =                     0u;
+    p_tcb->BudgetOpt            =  OS_OPT_TASK_BUDGET_DEMOTE;
+    p_tcb->BudgetPrio           =                     0u;
+    p_tcb->BudgetExhausted      =  OS_FALSE;
+    p_tcb->BudgetNextPtr        = (OS_TCB           *)0;
+    p_tcb->BudgetPrevPtr        = (OS_TCB           *)0;
+#endif
+
+#if (OS_CFG_STAT_GOV_EN > 0u)
+    p_tcb->PerfLvlMin           =                     0u;
+#endif
+
+#if (OS_TASK_PERIOD_EN > 0u)
+    p_tcb->Period               =                     0u;
+    p_tcb->PeriodRelease        =                     0u;
+    p_tcb->PeriodOpt            =  OS_OPT_TASK_PERIOD_SKIP;
+    p_tcb->PeriodOvrCtr         =                     0u;
+    p_tcb->PeriodJitter         =                     0u;
+    p_tcb->PeriodJitterMax      =                     0u;
+#if (OS_CFG_STAT_TASK_EN > 0u)
+    p_tcb->PeriodOvrCtrStat     =                     0u;
+#endif
+#if (OS_CFG_STAT_SCHED_EN > 0u)
+    p_tcb->SchedJobStart        =                     0u;
+    p_tcb->SchedWCET            =                     0u;
+    p_tcb->SchedResp            =                     0u;
+#endif
+#endif
+
+#if (OS_CFG_TASK_EDF_EN > 0u)
+    p_tcb->EDFDeadline          =                     0u;
+#endif
+
+#if (OS_CFG_TASK_FAIR_EN > 0u)
+    p_tcb->FairVRuntime         =                     0u;
+    p_tcb->FairStart            =                     0u;
+    p_tcb->FairWeight           =  OS_TASK_FAIR_WEIGHT_DFLT;
+#endif
+
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+    p_tcb->CPUUsage             =                     0u;
+    p_tcb->CPUUsageMax          =                     0u;
+    p_tcb->CtxSwCtr             =                     0u;
+    p_tcb->CyclesDelta          =                     0u;
+#if (OS_CFG_TS_EN > 0u)
+    p_tcb->CyclesStart          =  OS_TS_GET();                 /* Read the current timestamp and save                  */
+#else
+    p_tcb->CyclesStart          =                     0u;
+#endif
+#if (OS_CFG_STAT_TASK_BUDGET > 0u)
+    p_tcb->CyclesStatStart      =  p_tcb->CyclesStart;
+#endif
+    p_tcb->CyclesTotal          =                     0u;
+#endif
+
+#if (OS_CFG_TASK_PERF_CTR_EN > 0u)
+    for (ix = 0u; ix < OS_CPU_PERF_CTR_NBR; ix++) {
+        p_tcb->PerfCtrStart[ix] =                     0u;
+        p_tcb->PerfCtrTotal[ix] =                     0u;
+    }
+#endif
+
+#ifdef CPU_CFG_INT_DIS_MEAS_EN
+    p_tcb->IntDisTimeMax        =                     0u;
+#endif
+#if (OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u)
+    p_tcb->SchedLockTimeMax     =                     0u;
+#endif
+
+    p_tcb->PendNextPtr          = (OS_TCB           *)0;
+#if (OS_CFG_SMALL_MEM_EN == 0u)
+    p_tcb->PendPrevPtr          = (OS_TCB           *)0;
+#endif
+    p_tcb->PendObjPtr           = (OS_PEND_OBJ      *)0;
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+    p_tcb->PendDataTblPtr       = (OS_PEND_DATA     *)0;
+    p_tcb->PendDataTblEntries   =                     0u;
+#endif
+#if (OS_CFG_PEND_LIST_BITMAP_EN > 0u)
+    p_tcb->PendPrio             =                     0u;
+#endif
+    p_tcb->PendOn               =  OS_TASK_PEND_ON_NOTHING;
+    p_tcb->PendStatus           =  OS_STATUS_PEND_OK;
+    p_tcb->TaskState            =  OS_TASK_STATE_RDY;
+
+    p_tcb->Prio                 =  OS_PRIO_INIT;
+#if (OS_CFG_MUTEX_EN > 0u)
+    p_tcb->BasePrio             =  OS_PRIO_INIT;
+    p_tcb->MutexGrpHeadPtr      = (OS_MUTEX         *)0;
+#endif
+#if (OS_CFG_RWLOCK_EN > 0u)
+    for (ix = 0u; ix < OS_CFG_RWLOCK_HOLD_MAX; ix++) {
+        p_tcb->RwLockHoldTbl[ix].RwLockPtr  = (OS_RWLOCK      *)0;
+        p_tcb->RwLockHoldTbl[ix].TCBPtr     = (OS_TCB         *)0;
+        p_tcb->RwLockHoldTbl[ix].NextPtr    = (OS_RWLOCK_HOLD *)0;
+        p_tcb->RwLockHoldTbl[ix].NestingCtr =                   0u;
+    }
+    p_tcb->RwLockHoldCtr        =                     0u;
+#endif
+
+#if (OS_CFG_DBG_EN > 0u)
+    p_tcb->DbgPrevPtr           = (OS_TCB           *)0;
+    p_tcb->DbgNextPtr           = (OS_TCB           *)0;
+    p_tcb->DbgNamePtr           = (CPU_CHAR *)((void *)" ");
+#endif
+}
+
+
+/*
+************************************************************************************************************************
+*                                               RESUME A SUSPENDED TASK
+*
+* Description: This function removes one level of explicit suspension from a task.  It is the body of OSTaskResume()
+*              and is also used to resume the members of a task group.
+*
+* Arguments  : p_tcb      is a pointer to the task's OS_TCB to resume
+*
+*              p_err      is a pointer to a variable that will contain an error code returned by this function
+*
+*                             OS_ERR_NONE                  If the suspension counter of the task was decremented
+*                             OS_ERR_STATE_INVALID         If the task is in an invalid state
+*                             OS_ERR_TASK_NOT_SUSPENDED    If the task is not suspended
+*                             OS_ERR_TASK_STK_GRP_BUSY     If the task is a dormant member of a task stack group and
+*                                                            another member of the group is not dormant
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is called with interrupts disabled.  It doesn't run the scheduler.
+*
+*              3) This is the only way out of the suspended state, so it is where the members of a task stack group are
+*                 kept from running together: a dormant member only becomes ready when it can get the stack.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_SUSPEND_EN > 0u)
+void  OS_TaskResume (OS_TCB  *p_tcb,
+                     OS_ERR  *p_err)
+{
+   *p_err = OS_ERR_NONE;
+    switch (p_tcb->TaskState) {
+        case OS_TASK_STATE_RDY:
+        case OS_TASK_STATE_DLY:
+        case OS_TASK_STATE_PEND:
+        case OS_TASK_STATE_PEND_TIMEOUT:
+            *p_err = OS_ERR_TASK_NOT_SUSPENDED;
+             break;
+
+        case OS_TASK_STATE_SUSPENDED:
+#if (OS_CFG_TASK_STK_GRP_EN > 0u)
+             if ((p_tcb->StkGrpDormant == OS_TRUE) &&           /* A dormant member needs the stack (see Note #3)       */
+                 (p_tcb->SuspendCtr    == 1u)) {
+                 OS_TaskStkGrpStart(p_tcb, p_err);
+                 if (*p_err != OS_ERR_NONE) {
+                     break;
+                 }
+             }
+#endif
+             p_tcb->SuspendCtr--;
+             if (p_tcb->SuspendCtr == 0u) {
+                 p_tcb->TaskState = OS_TASK_STATE_RDY;
+                 OS_RdyListInsert(p_tcb);                       /* Insert the task in the ready list                    */
+                 OS_TRACE_TASK_RESUME(p_tcb);
+             }
+             break;
+
+        case OS_TASK_STATE_DLY_SUSPENDED:
+             p_tcb->SuspendCtr--;
+             if (p_tcb->SuspendCtr == 0u) {
+                 p_tcb->TaskState = OS_TASK_STATE_DLY;
+             }
+             break;
+
+        case OS_TASK_STATE_PEND_SUSPENDED:
+             p_tcb->SuspendCtr--;
+             if (p_tcb->SuspendCtr == 0u) {
+                 p_tcb->TaskState = OS_TASK_STATE_PEND;
+             }
+             break;
+
+        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
+             p_tcb->SuspendCtr--;
+             if (p_tcb->SuspendCtr == 0u) {
+                 p_tcb->TaskState = OS_TASK_STATE_PEND_TIMEOUT;
+             }
+             break;
+
+        default:
+            *p_err = OS_ERR_STATE_INVALID;
+             break;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                              CATCH ACCIDENTAL TASK RETURN
+*
+* Description: This function is called if a task accidentally returns without deleting itself.  In other words, a task
+*              should either be an infinite loop or delete itself if it's done.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+void  OS_TaskReturn (void)
+{
+    OS_ERR  err;
+
+
+
+    OSTaskReturnHook(OSTCBCurPtr);                              /* Call hook to let user decide on what to do           */
+#if (OS_CFG_TASK_STK_GRP_EN > 0u)
+    if (OSTCBCurPtr->StkGrpPtr != (OS_TASK_STK_GRP *)0) {       /* A member of a stack group goes back to dormant       */
+        OSTaskStkGrpDormant(&err);
+    }
+#endif
+#if (OS_CFG_TASK_DEL_EN > 0u)
+    OSTaskDel((OS_TCB *)0,                                      /* Delete task if it accidentally returns!              */
+              &err);
+#else
+    for (;;) {
+        OSTimeDly(OS_TICK_RATE_HZ,
+                  OS_OPT_TIME_DLY,
+                  &err);
+    }
+#endif
+}
+
+
+/*
+************************************************************************************************************************
+*                                                   CLEAR A STACK
+*
+* Description: This function zeroes a stack.  It is the default of OS_CPU_STK_CLR(), used when the port doesn't provide
+*              a faster fill.
+*
+* Arguments  : p_stk        is a pointer to the first stack element to clear.
+*
+*              size         is the number of CPU_STK elements to clear.
+*
+* Returns    : none.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) The loop is unrolled so that the loop overhead is paid once every 8 elements.
+************************************************************************************************************************
+*/
+
+void  OS_TaskStkClr (CPU_STK       *p_stk,
+                     CPU_STK_SIZE   size)
+{
+    while (size >= 8u) {                                        /* See Note #2                                          */
+        p_stk[0] = 0u;
+        p_stk[1] = 0u;
+        p_stk[2] = 0u;
+        p_stk[3] = 0u;
+        p_stk[4] = 0u;
+        p_stk[5] = 0u;
+        p_stk[6] = 0u;
+        p_stk[7] = 0u;
+        p_stk   += 8u;
+        size    -= 8u;
+    }
+    while (size > 0u) {
+       *p_stk = 0u;
+        p_stk++;
+        size--;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                            CLEAR THE STACKS OF NEW TASKS
+*
+* Description: This function is called by the idle task to clear the next chunk of a stack created with
+*              OS_OPT_TASK_STK_CLR_DEFER.
+*
+* Arguments  : none.
+*
+* Returns    : none.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) Since the idle task runs, the task owning the stack doesn't: the elements past its saved stack pointer
+*                 are unused.  The chunk is bounded by that pointer and cleared with interrupts disabled, so the task
+*                 can't grow its stack into the chunk meanwhile.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_STK_CLR_DEFER_EN > 0u)
+void  OS_TaskStkClrDefer (void)
+{
+    OS_TCB        *p_tcb;
+    CPU_STK       *p_stk;
+    CPU_STK_SIZE   nbr;
+    CPU_SR_ALLOC();
+
+
+
+    CPU_CRITICAL_ENTER();
+    p_tcb = OSTaskStkClrListPtr;
+    if (p_tcb == (OS_TCB *)0) {                                 /* Nothing left to clear                                */
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+
+    p_stk = p_tcb->StkClrPtr;                                   /* Clear up to the saved stack pointer (see Note #2)    */
+#if (CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO)
+    if (p_tcb->StkPtr > p_stk) {
+        nbr = (CPU_STK_SIZE)(p_tcb->StkPtr - p_stk);
+    } else {
+        nbr = 0u;
+    }
+    if (nbr > OS_CFG_TASK_STK_CLR_CHUNK) {
+        nbr = OS_CFG_TASK_STK_CLR_CHUNK;
+    }
+    OS_CPU_STK_CLR(p_stk, nbr);
+    p_stk += nbr;
+#else
+    if (p_stk > p_tcb->StkPtr) {
+        nbr = (CPU_STK_SIZE)(p_stk - p_tcb->StkPtr);
+    } else {
+        nbr = 0u;
+    }
+    if (nbr > OS_CFG_TASK_STK_CLR_CHUNK) {
+        nbr = OS_CFG_TASK_STK_CLR_CHUNK;
+    }
+    p_stk -= nbr;
+    OS_CPU_STK_CLR(p_stk + 1u, nbr);
+#endif
+
+    if (nbr < OS_CFG_TASK_STK_CLR_CHUNK) {                      /* Reached the stack pointer, the stack is clear        */
+        OSTaskStkClrListPtr  = p_tcb->StkClrNextPtr;
+        p_tcb->StkClrPtr     = (CPU_STK *)0;
+        p_tcb->StkClrNextPtr = (OS_TCB  *)0;
+    } else {
+        p_tcb->StkClrPtr     = p_stk;
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+************************************************************************************************************************
+*                                      REMOVE A TASK FROM THE LIST OF STACKS TO CLEAR
+*
+* Description: This function is called by OSTaskDel() when the stack of the task being deleted is not cleared yet.
+*
+* Arguments  : p_tcb        is a pointer to the TCB of the task.
+*
+* Returns    : none.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) This function is called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+void  OS_TaskStkClrRemove (OS_TCB  *p_tcb)
+{
+    OS_TCB  **p_link;
+
+
+    p_link = &OSTaskStkClrListPtr;
+    while (*p_link != (OS_TCB *)0) {
+        if (*p_link == p_tcb) {
+           *p_link               = p_tcb->StkClrNextPtr;
+            p_tcb->StkClrPtr     = (CPU_STK *)0;
+            p_tcb->StkClrNextPtr = (OS_TCB  *)0;
+            return;
+        }
+        p_link = &(*p_link)->StkClrNextPtr;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                          CHECK THE STACK REDZONE OF A TASK
+*
+* Description: Verify a task's stack redzone.
+*
+* Arguments  : p_tcb        is a pointer to the base of the stack.
+*
+*              stk_size     is the size of the stack.
+*
+* Returns    : If the stack is corrupted (OS_FALSE) or not (OS_TRUE).
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+CPU_BOOLEAN   OS_TaskStkRedzoneChk (CPU_STK       *p_base,
+                                    CPU_STK_SIZE   stk_size)
+{
+    CPU_INT32U  i;
+
+
+#if (CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO)
+   (void)stk_size;                                              /* Prevent compiler warning for not using 'stk_size'    */
+
+    for (i = 0u; i < OS_CFG_TASK_STK_REDZONE_DEPTH; i++) {
+        if (*p_base != (CPU_DATA)OS_STACK_CHECK_VAL) {
+            return (OS_FALSE);
+        }
+        p_base++;
+    }
+#else
+    p_base = p_base + stk_size - 1u;
+    for (i = 0u; i < OS_CFG_TASK_STK_REDZONE_DEPTH; i++) {
+        if (*p_base != (CPU_DATA)OS_STACK_CHECK_VAL) {
+            return (OS_FALSE);
+        }
+        p_base--;
+    }
+#endif
+
+    return (OS_TRUE);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                          INITIALIZE A REDZONE ENABLED STACK
+*
+* Description: This functions is used to initialize a stack with Redzone checking.
+*
+* Arguments  : p_tcb        is a pointer to the base of the stack.
+*
+*              stk_size     is the size of the stack.
+*
+* Returns    : none.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+void  OS_TaskStkRedzoneInit (CPU_STK       *p_base,
+                             CPU_STK_SIZE   stk_size)
+{
+    CPU_STK_SIZE   i;
+
+
+#if (CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO)
+   (void)stk_size;                                              /* Prevent compiler warning for not using 'stk_size'    */
+
+    for (i = 0u; i < OS_CFG_TASK_STK_REDZONE_DEPTH; i++) {
+        *(p_base + i) = (CPU_DATA)OS_STACK_CHECK_VAL;
+    }
+#else
+    for (i = 0u; i < OS_CFG_TASK_STK_REDZONE_DEPTH; i++) {
+        *(p_base + stk_size - 1u - i) = (CPU_DATA)OS_STACK_CHECK_VAL;
+    }
+#endif
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                        RECORD THE STACK USAGE OF A TASK
+*
+* Description: This function is called by the statistic task, after OSTaskStkChk() measured the stack of a task, to
+*              update the entry of the task's entry point in the stack profile table.
+*
+* Arguments  : p_tcb        is a pointer to the TCB of the task measured
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) Only the statistic task changes the table, so the checksum is computed with interrupts enabled.  A
+*                 reset in the middle of an update only loses the table (see OSTaskStkProfileInit()).
+*
+*              3) A task whose entry point is not in the table is not recorded once the table is full.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_STK_PROFILE_EN > 0u)
+void  OS_TaskStkProfileUpdate (OS_TCB  *p_tcb)
+{
+    OS_STK_PROFILE_TBL  *p_tbl;
+    OS_STK_PROFILE      *p_entry;
+    CPU_STK_SIZE         used;
+    CPU_STK_SIZE         rec;
+    CPU_SR_ALLOC();
+
+
+    p_tbl = OSTaskStkProfileTblPtr;
+    if (p_tbl == (OS_STK_PROFILE_TBL *)0) {                     /* No table given to OSTaskStkProfileInit()             */
+        return;
+    }
+
+    used = p_tcb->StkUsed;
+    rec  = used + (CPU_STK_SIZE)((((CPU_INT32U)used * OS_CFG_TASK_STK_PROFILE_MARGIN) + 99u) / 100u);
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+    rec += OS_CFG_TASK_STK_REDZONE_DEPTH;                       /* The red-zone is not seen as used by OSTaskStkChk()   */
+#endif
+    if (rec < OSCfg_StkSizeMin) {
+        rec = OSCfg_StkSizeMin;
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_entry = OS_TaskStkProfileFind(p_tcb->TaskEntryAddr);
+    if (p_entry == (OS_STK_PROFILE *)0) {
+        if (p_tbl->Nbr >= OS_CFG_TASK_STK_PROFILE_SIZE) {       /* See Note #3                                          */
+            CPU_CRITICAL_EXIT();
+            return;
+        }
+        p_entry                = &p_tbl->Tbl[p_tbl->Nbr];       /* First time this entry point is seen                  */
+        p_entry->TaskEntryAddr = p_tcb->TaskEntryAddr;
+        p_entry->StkSize       = 0u;
+        p_entry->StkUsedMax    = 0u;
+        p_entry->StkSizeRec    = 0u;
+        p_tbl->Nbr++;
+    } else if ((p_entry->StkUsedMax >= used) &&                 /* Nothing new about this entry point?                  */
+               (p_entry->StkSize    == p_tcb->StkSize)) {
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+    p_entry->StkSize = p_tcb->StkSize;
+    if (p_entry->StkUsedMax < used) {                           /* Keep the peak                                        */
+        p_entry->StkUsedMax = used;
+        p_entry->StkSizeRec = rec;
+    }
+    CPU_CRITICAL_EXIT();
+
+    p_tbl->Chksum = OS_TaskStkProfileChksum(p_tbl);             /* See Note #2                                          */
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                   SUSPEND A TASK
+*
+* Description: This function adds one level of explicit suspension to a task.  It is the body of OSTaskSuspend() and
+*              is also used to suspend the members of a task group.
+*
+* Arguments  : p_tcb    is a pointer to the TCB to suspend
+*
+*              p_err    is a pointer to a variable that will receive an error code from this function.
+*
+*                           OS_ERR_NONE                        If the task is suspended
+*                           OS_ERR_STATE_INVALID               If the task is in an invalid state
+*                           OS_ERR_TASK_SUSPEND_CTR_OVF        If the nesting counter would overflow
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is called with interrupts disabled.  It doesn't run the scheduler: when 'p_tcb' is the
+*                 current task, the caller must make sure that the scheduler runs before the task goes on.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_SUSPEND_EN > 0u)
+void  OS_TaskSuspend (OS_TCB  *p_tcb,
+                      OS_ERR  *p_err)
+{
+   *p_err = OS_ERR_NONE;
+    switch (p_tcb->TaskState) {
+        case OS_TASK_STATE_RDY:
+             p_tcb->TaskState  =  OS_TASK_STATE_SUSPENDED;
+             p_tcb->SuspendCtr = 1u;
+             OS_RdyListRemove(p_tcb);
+             OS_TRACE_TASK_SUSPEND(p_tcb);
+             break;
+
+        case OS_TASK_STATE_DLY:
+             p_tcb->TaskState  = OS_TASK_STATE_DLY_SUSPENDED;
+             p_tcb->SuspendCtr = 1u;
+             break;
+
+        case OS_TASK_STATE_PEND:
+             p_tcb->TaskState  = OS_TASK_STATE_PEND_SUSPENDED;
+             p_tcb->SuspendCtr = 1u;
+             break;
+
+        case OS_TASK_STATE_PEND_TIMEOUT:
+             p_tcb->TaskState  = OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED;
+             p_tcb->SuspendCtr = 1u;
+             break;
+
+        case OS_TASK_STATE_SUSPENDED:
+        case OS_TASK_STATE_DLY_SUSPENDED:
+        case OS_TASK_STATE_PEND_SUSPENDED:
+        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
+             if (p_tcb->SuspendCtr == (OS_NESTING_CTR)-1) {
+                *p_err = OS_ERR_TASK_SUSPEND_CTR_OVF;
+                 break;
+             }
+             p_tcb->SuspendCtr++;
+             break;
+
+        default:
+            *p_err = OS_ERR_STATE_INVALID;
+             break;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                               CHANGE PRIORITY OF A TASK
+*
+* Description: This function is called by the kernel to perform the actual operation of changing a task's priority.
+*              Priority inheritance is updated if necessary.
+*
+*
+*
+* Argument(s): p_tcb        is a pointer to the tcb of the task to change the priority.
+*
+*              prio_new     is the new priority to give to the task.
+*
+*
+* Returns    : none.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_TaskChangePrio(OS_TCB  *p_tcb,
+                        OS_PRIO  prio_new)
+{
+    OS_TCB  *p_tcb_owner;
+#if (OS_CFG_MUTEX_EN > 0u)
+    OS_PRIO  prio_cur;
 #endif
 
 
-#if (OS_CFG_TASK_SUSPEND_EN > 0u)
-    p_tcb->SuspendCtr           =                     0u;
+    do {
+        p_tcb_owner = (OS_TCB *)0;
+#if (OS_CFG_MUTEX_EN > 0u)
+        prio_cur    =  p_tcb->Prio;
 #endif
+        switch (p_tcb->TaskState) {
+            case OS_TASK_STATE_RDY:
+                 OS_RdyListRemove(p_tcb);                       /* Remove from current priority                         */
+                 p_tcb->Prio = prio_new;                        /* Set new task priority                                */
+                 OS_PrioInsert(p_tcb->Prio);
+                 if (p_tcb == OSTCBCurPtr) {
+                     OS_RdyListInsertHead(p_tcb);
+                 } else {
+                     OS_RdyListInsertTail(p_tcb);
+                 }
+                 break;
 
-#if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u)
-    p_tcb->StkFree              =                     0u;
-    p_tcb->StkUsed              =                     0u;
+            case OS_TASK_STATE_DLY:                             /* Nothing to do except change the priority in the OS_TCB*/
+            case OS_TASK_STATE_SUSPENDED:
+            case OS_TASK_STATE_DLY_SUSPENDED:
+                 p_tcb->Prio = prio_new;                        /* Set new task priority                                */
+                 break;
+
+            case OS_TASK_STATE_PEND:
+            case OS_TASK_STATE_PEND_TIMEOUT:
+            case OS_TASK_STATE_PEND_SUSPENDED:
+            case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
+                 p_tcb->Prio = prio_new;                        /* Set new task priority                                */
+                 switch (p_tcb->PendOn) {                       /* What to do depends on what we are pending on         */
+                     case OS_TASK_PEND_ON_FLAG:
+                     case OS_TASK_PEND_ON_MBOX:
+                     case OS_TASK_PEND_ON_MEM:
+                     case OS_TASK_PEND_ON_Q:
+                     case OS_TASK_PEND_ON_Q_SPACE:
+                     case OS_TASK_PEND_ON_RING_DATA:
+                     case OS_TASK_PEND_ON_RING_SPACE:
+                     case OS_TASK_PEND_ON_PIPE_DATA:
+                     case OS_TASK_PEND_ON_PIPE_SPACE:
+                     case OS_TASK_PEND_ON_SEM:
+                     case OS_TASK_PEND_ON_SEQLOCK:
+                     case OS_TASK_PEND_ON_RCU:
+                     case OS_TASK_PEND_ON_CALL:
+                     case OS_TASK_PEND_ON_CALL_RECV:
+                          OS_PendListChangePrio(p_tcb);
+                          break;
+
+#if (OS_CFG_PEND_MULTI_EN > 0u)
+                     case OS_TASK_PEND_ON_MULTI:
+                          OS_PendMultiChangePrio(p_tcb);
+                          break;
 #endif
 
-    p_tcb->Opt                  =                     0u;
+#if (OS_CFG_CALL_EN > 0u)
+                     case OS_TASK_PEND_ON_CALL_REPLY:           /* Pass the new priority on to the server               */
+                          p_tcb_owner = p_tcb->CallSrvPtr;
+                          if (p_tcb_owner != (OS_TCB *)0) {
+                              prio_new = OS_CallSrvPrioGet(p_tcb_owner);
+                              if (prio_new == p_tcb_owner->Prio) {
+                                  p_tcb_owner = (OS_TCB *)0;
+                              }
+                          }
+                          break;
+#endif
 
-#if (OS_CFG_TICK_EN > 0u)
-    p_tcb->TickRemain           =                     0u;
-    p_tcb->TickCtrPrev          =                     0u;
+                     case OS_TASK_PEND_ON_MUTEX:
+#if (OS_CFG_MUTEX_EN > 0u)
+                          OS_PendListChangePrio(p_tcb);
+                          p_tcb_owner = ((OS_MUTEX *)((void *)p_tcb->PendObjPtr))->OwnerTCBPtr;
+                          if (p_tcb_owner == (OS_TCB *)0) {     /* A mutex in throughput mode may have no owner         */
+                              break;
+                          }
+                          if (prio_cur > prio_new) {            /* Are we increasing the priority?                      */
+                              if (p_tcb_owner->Prio <= prio_new) { /* Yes, do we need to give this prio to the owner?   */
+                                  p_tcb_owner = (OS_TCB *)0;
+                              } else {
+                                                                /* Block is empty when trace is disabled.               */
+                                 OS_TRACE_MUTEX_TASK_PRIO_INHERIT(p_tcb_owner, prio_new);
+                              }
+                          } else {
+                              if (p_tcb_owner->Prio == prio_cur) { /* No, is it required to check for a lower prio?     */
+                                  prio_new = OS_MutexGrpPrioFindHighest(p_tcb_owner);
+                                  prio_new = (prio_new > p_tcb_owner->BasePrio) ? p_tcb_owner->BasePrio : prio_new;
+                                  if (prio_new == p_tcb_owner->Prio) {
+                                      p_tcb_owner = (OS_TCB *)0;
+                                  } else {
+                                                                /* Block is empty when trace is disabled.               */
+                                     OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb_owner, prio_new);
+                                  }
+                              }
+                          }
 #endif
+                          break;
 
-#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
-    p_tcb->TimeQuanta           =                     0u;
-    p_tcb->TimeQuantaCtr        =                     0u;
+#if (OS_CFG_RWLOCK_EN > 0u)
+                     case OS_TASK_PEND_ON_RWLOCK_RD:
+                     case OS_TASK_PEND_ON_RWLOCK_WR:
+                          OS_PendListChangePrio(p_tcb);
+                          OS_RwLockPrioUpdate((OS_RWLOCK *)((void *)p_tcb->PendObjPtr));
+                          break;
 #endif
 
-#if (OS_CFG_TASK_PROFILE_EN > 0u)
-    p_tcb->CPUUsage             =                     0u;
-    p_tcb->CPUUsageMax          =                     0u;
-    p_tcb->CtxSwCtr             =                     0u;
-    p_tcb->CyclesDelta          =                     0u;
-#if (OS_CFG_TS_EN > 0u)
-    p_tcb->CyclesStart          =  OS_TS_GET();                 /* Read the current timestamp and save                  */
-#else
-    p_tcb->CyclesStart          =                     0u;
+                     case OS_TASK_PEND_ON_TASK_Q:
+                     case OS_TASK_PEND_ON_TASK_SEM:
+#if (OS_CFG_TASK_NOTIFY_EN > 0u)
+                     case OS_TASK_PEND_ON_TASK_NOTIFY:
 #endif
-    p_tcb->CyclesTotal          =                     0u;
+                     default:
+                                                                /* Default case.                                        */
+                          break;
+                 }
+                 break;
+
+            default:
+                 return;
+        }
+        p_tcb = p_tcb_owner;
+    } while (p_tcb != (OS_TCB *)0);
+}
+
+
+/*
+************************************************************************************************************************
+*                                            ADD A MEASUREMENT TO A HISTOGRAM
+*
+* Description: This function increments the log2 bucket of a histogram corresponding to a measurement.
+*
+* Arguments  : p_tbl     is a pointer to the first bucket of the histogram
+*
+*              delta     is the measurement
+*
+* Returns    : none
+*
+* Note(s)    : 1) The bucket counters saturate instead of wrapping around.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_HIST_EN > 0u)
+static  void  OS_TaskHistAdd (OS_HIST_CTR  *p_tbl,
+                              CPU_TS        delta)
+{
+    CPU_INT08U  ix;
+
+
+    ix = 0u;
+    while ((delta != 0u) &&                                     /* Find the number of significant bits in 'delta'       */
+           (ix    <  (OS_CFG_TASK_HIST_SIZE - 1u))) {
+        delta >>= 1u;
+        ix++;
+    }
+
+    if (p_tbl[ix] < (OS_HIST_CTR)~(OS_HIST_CTR)0) {             /* See Note #1                                          */
+        p_tbl[ix]++;
+    }
+}
 #endif
 
-#ifdef CPU_CFG_INT_DIS_MEAS_EN
-    p_tcb->IntDisTimeMax        =                     0u;
+
+/*
+************************************************************************************************************************
+*                                           ENFORCE OR RESTORE A TASK'S BUDGET
+*
+* Description: OS_TaskBudgetExhaust() demotes or suspends a task whose budget is exhausted, according to its
+*              'BudgetOpt'.  OS_TaskBudgetRestore() undoes it when the budget is replenished.
+*
+*              OS_TaskBudgetPrioSet() changes the base priority of the task, keeping the priority it inherited from the
+*              mutexes it owns, or from the client it serves, as OSTaskChangePrio() does.
+*
+* Arguments  : p_tcb     is a pointer to the OS_TCB of the task
+*
+*              prio_new  is the new base priority of the task
+*
+* Returns    : none
+*
+* Note(s)    : 1) These functions are called with interrupts disabled.
+*
+*              2) The budget is only enforced while the task runs, so it is ready.  It is only given back its
+*                 suspension if nothing else resumed it in the meantime (see OSTaskBudgetSet(), Note #4).
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+static  void  OS_TaskBudgetExhaust (OS_TCB  *p_tcb)
+{
+    p_tcb->BudgetExhausted = OS_TRUE;
+
+#if (OS_CFG_TASK_SUSPEND_EN > 0u)
+    if (p_tcb->BudgetOpt == OS_OPT_TASK_BUDGET_SUSPEND) {
+        if (p_tcb->TaskState == OS_TASK_STATE_RDY) {            /* See Note #2                                          */
+            p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED;
+            p_tcb->SuspendCtr = 1u;
+            OS_RdyListRemove(p_tcb);
+        }
+        return;
+    }
 #endif
-#if (OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u)
-    p_tcb->SchedLockTimeMax     =                     0u;
+
+#if (OS_CFG_MUTEX_EN > 0u) || (OS_CFG_CALL_EN > 0u)
+    p_tcb->BudgetPrio = p_tcb->BasePrio;                        /* Save the priority to restore                         */
+#else
+    p_tcb->BudgetPrio = p_tcb->Prio;
 #endif
+    if (p_tcb->BudgetPrio < OS_CFG_TASK_BUDGET_PRIO) {          /* Demote to the background priority                    */
+        OS_TaskBudgetPrioSet(p_tcb, OS_CFG_TASK_BUDGET_PRIO);
+    }
+}
 
-    p_tcb->PendNextPtr          = (OS_TCB           *)0;
-    p_tcb->PendPrevPtr          = (OS_TCB           *)0;
-    p_tcb->PendObjPtr           = (OS_PEND_OBJ      *)0;
-    p_tcb->PendOn               =  OS_TASK_PEND_ON_NOTHING;
-    p_tcb->PendStatus           =  OS_STATUS_PEND_OK;
-    p_tcb->TaskState            =  OS_TASK_STATE_RDY;
 
-    p_tcb->Prio                 =  OS_PRIO_INIT;
+static  void  OS_TaskBudgetRestore (OS_TCB  *p_tcb)
+{
+    p_tcb->BudgetExhausted = OS_FALSE;
+    if (p_tcb == OSTCBCurPtr) {                                 /* Start charging the running task again                */
+        p_tcb->BudgetStart = OS_TS_GET();
+    }
+
+#if (OS_CFG_TASK_SUSPEND_EN > 0u)
+    if (p_tcb->BudgetOpt == OS_OPT_TASK_BUDGET_SUSPEND) {
+        if (p_tcb->TaskState == OS_TASK_STATE_SUSPENDED) {      /* See Note #2                                          */
+            p_tcb->SuspendCtr--;
+            if (p_tcb->SuspendCtr == 0u) {
+                p_tcb->TaskState = OS_TASK_STATE_RDY;
+                OS_RdyListInsert(p_tcb);                        /* Insert the task in the ready list                    */
+            }
+        }
+        return;
+    }
+#endif
+
+    if (p_tcb->BudgetPrio < OS_CFG_TASK_BUDGET_PRIO) {          /* Give the task its priority back                      */
+        OS_TaskBudgetPrioSet(p_tcb, p_tcb->BudgetPrio);
+    }
+}
+
+
+static  void  OS_TaskBudgetPrioSet (OS_TCB  *p_tcb,
+                                    OS_PRIO  prio_new)
+{
 #if (OS_CFG_MUTEX_EN > 0u)
-    p_tcb->BasePrio             =  OS_PRIO_INIT;
-    p_tcb->MutexGrpHeadPtr      = (OS_MUTEX         *)0;
+    OS_PRIO  prio_high;
+#endif
+
+
+#if (OS_CFG_MUTEX_EN > 0u) || (OS_CFG_CALL_EN > 0u)
+    p_tcb->BasePrio = prio_new;                                 /* Update base priority                                 */
+#endif
+
+#if (OS_CFG_MUTEX_EN > 0u)
+#if (OS_CFG_RWLOCK_EN > 0u)
+    if ((p_tcb->MutexGrpHeadPtr != (OS_MUTEX *)0) ||            /* Owning a mutex or a reader/writer lock?              */
+        (p_tcb->RwLockHoldCtr   >              0u)) {
+#else
+    if (p_tcb->MutexGrpHeadPtr != (OS_MUTEX *)0) {              /* Owning a mutex?                                      */
+#endif
+        if (prio_new > p_tcb->Prio) {
+            prio_high = OS_MutexGrpPrioFindHighest(p_tcb);
+            if (prio_new > prio_high) {
+                prio_new = prio_high;
+            }
+        }
+    }
 #endif
 
-#if (OS_CFG_DBG_EN > 0u)
-    p_tcb->DbgPrevPtr           = (OS_TCB           *)0;
-    p_tcb->DbgNextPtr           = (OS_TCB           *)0;
-    p_tcb->DbgNamePtr           = (CPU_CHAR *)((void *)" ");
+#if (OS_CFG_CALL_EN > 0u)
+    if (p_tcb->CallClientPtr != (OS_TCB *)0) {                  /* Serving a call?                                      */
+        prio_new = OS_CallSrvPrioGet(p_tcb);                    /* Yes, keep the priority lent by the client            */
+    }
 #endif
+
+    if (prio_new != p_tcb->Prio) {
+        OS_TaskChangePrio(p_tcb, prio_new);
+    }
 }
+#endif
 
 
 /*
 ************************************************************************************************************************
-*                                              CATCH ACCIDENTAL TASK RETURN
+*                                                    SIGNAL A TASK
 *
-* Description: This function is called if a task accidentally returns without deleting itself.  In other words, a task
-*              should either be an infinite loop or delete itself if it's done.
+* Description: This function signals a task once OSTaskSemPost() or OSTaskSemPostFromISR() checked the arguments.
 *
-* Arguments  : none
+* Arguments  : p_tcb     is the pointer to the TCB of the task to signal, or a NULL pointer for the current task.
 *
-* Returns    : none
+*              opt       determines the type of POST performed (see OSTaskSemPost())
+*
+*              ts        is the timestamp of the signal
+*
+*              p_err     is a pointer to an error code returned by this function (see OSTaskSemPost())
+*
+* Returns    : The current value of the task's signal counter.
 *
 * Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
 ************************************************************************************************************************
 */
 
-void  OS_TaskReturn (void)
+static  OS_SEM_CTR  OS_TaskSemPost (OS_TCB  *p_tcb,
+                                    OS_OPT   opt,
+                                    CPU_TS   ts,
+                                    OS_ERR  *p_err)
 {
-    OS_ERR  err;
-
+    OS_SEM_CTR  ctr;
+    CPU_SR_ALLOC();
 
+    OS_TRACE_TASK_SEM_POST(p_tcb);
 
-    OSTaskReturnHook(OSTCBCurPtr);                              /* Call hook to let user decide on what to do           */
-#if (OS_CFG_TASK_DEL_EN > 0u)
-    OSTaskDel((OS_TCB *)0,                                      /* Delete task if it accidentally returns!              */
-              &err);
-#else
-    for (;;) {
-        OSTimeDly(OSCfg_TickRate_Hz,
-                  OS_OPT_TIME_DLY,
-                  &err);
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {                                 /* Post signal to 'self'?                               */
+        p_tcb = OSTCBCurPtr;
     }
+#if (OS_CFG_TS_EN > 0u)
+    p_tcb->TS = ts;
 #endif
+   *p_err     = OS_ERR_NONE;                                    /* Assume we won't have any errors                      */
+    switch (p_tcb->TaskState) {
+        case OS_TASK_STATE_RDY:
+        case OS_TASK_STATE_DLY:
+        case OS_TASK_STATE_SUSPENDED:
+        case OS_TASK_STATE_DLY_SUSPENDED:
+             if (p_tcb->SemCtr == (OS_SEM_CTR)-1) {
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_SEM_OVF;
+                 OS_TRACE_SEM_POST_EXIT(*p_err);
+                 return (0u);
+             }
+             p_tcb->SemCtr++;                                   /* Task signaled is not pending on anything             */
+             ctr = p_tcb->SemCtr;
+             CPU_CRITICAL_EXIT();
+             break;
+
+        case OS_TASK_STATE_PEND:
+        case OS_TASK_STATE_PEND_TIMEOUT:
+        case OS_TASK_STATE_PEND_SUSPENDED:
+        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
+             if (p_tcb->PendOn == OS_TASK_PEND_ON_TASK_SEM) {   /* Is task signaled waiting for a signal?               */
+                 OS_Post((OS_PEND_OBJ *)0,                      /* Task is pending on signal                            */
+                          p_tcb,
+                          (void *)0,
+                          0u,
+                          ts);
+                 ctr = p_tcb->SemCtr;
+                 CPU_CRITICAL_EXIT();
+                 if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+                     OSSched();                                 /* Run the scheduler                                    */
+                 }
+             } else {
+                 if (p_tcb->SemCtr == (OS_SEM_CTR)-1) {
+                     CPU_CRITICAL_EXIT();
+                    *p_err = OS_ERR_SEM_OVF;
+                     OS_TRACE_SEM_POST_EXIT(*p_err);
+                     return (0u);
+                 }
+                 p_tcb->SemCtr++;                               /* No,  Task signaled is NOT pending on semaphore ...   */
+                 ctr = p_tcb->SemCtr;                           /* ... it must be waiting on something else             */
+                 CPU_CRITICAL_EXIT();
+             }
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_STATE_INVALID;
+             ctr   = 0u;
+             break;
+    }
+
+    OS_TRACE_TASK_SEM_POST_EXIT(*p_err);
+
+    return (ctr);
 }
 
 
 /*
 ************************************************************************************************************************
-*                                          CHECK THE STACK REDZONE OF A TASK
+*                                        ALLOCATE/FREE A FITTED TASK STACK
 *
-* Description: Verify a task's stack redzone.
+* Description: OS_TaskStkFitAlloc() allocates the stack of a task created with OS_OPT_TASK_STK_FIT, cut down to the size
+*              recommended by the stack profile table.  OS_TaskStkFitFree() gives a stack back to the heap, along with
+*              the stack of the last task that deleted itself.
 *
-* Arguments  : p_tcb        is a pointer to the base of the stack.
+* Arguments  : p_task        is a pointer to the task's code
 *
-*              stk_size     is the size of the stack.
+*              p_stk_limit   is a pointer to the stack limit of the task, scaled with the stack size
 *
-* Returns    : If the stack is corrupted (OS_FALSE) or not (OS_TRUE).
+*              p_stk_size    is a pointer to the stack size asked for, replaced by the size allocated
 *
-* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*              p_err         is a pointer to a variable that will contain an error code returned by OSHeapAlloc()
+*
+*              p_stk         is a pointer to the stack to free, NULL to only free the stack of the last task that
+*                            deleted itself
+*
+* Returns    : OS_TaskStkFitAlloc() returns a pointer to the stack or a NULL pointer if the allocation failed.
+*
+* Note(s)    : 1) The stack is detached from the task calling OSTaskCreate(), otherwise deleting that task would free
+*                 the stack of the task it created.
 ************************************************************************************************************************
 */
 
-#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
-CPU_BOOLEAN   OS_TaskStkRedzoneChk (CPU_STK       *p_base,
-                                    CPU_STK_SIZE   stk_size)
+#if (OS_CFG_TASK_STK_FIT_EN > 0u)
+static  CPU_STK  *OS_TaskStkFitAlloc (OS_TASK_PTR    p_task,
+                                      CPU_STK_SIZE  *p_stk_limit,
+                                      CPU_STK_SIZE  *p_stk_size,
+                                      OS_ERR        *p_err)
 {
-    CPU_INT32U  i;
+    OS_HEAP         *p_heap;
+    OS_STK_PROFILE  *p_entry;
+    CPU_STK         *p_stk;
+    CPU_STK_SIZE     size;
+    CPU_SR_ALLOC();
 
 
-#if (CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO)
-   (void)stk_size;                                              /* Prevent compiler warning for not using 'stk_size'    */
+    OS_TaskStkFitFree((CPU_STK *)0);                            /* Reclaim the stack of a task that deleted itself      */
 
-    for (i = 0u; i < OS_CFG_TASK_STK_REDZONE_DEPTH; i++) {
-        if (*p_base != (CPU_DATA)OS_STACK_CHECK_VAL) {
-            return (OS_FALSE);
-        }
-        p_base++;
+    size = 0u;
+    CPU_CRITICAL_ENTER();
+    p_heap  = OSTaskStkFitHeapPtr;
+    p_entry = OS_TaskStkProfileFind(p_task);
+    if (p_entry != (OS_STK_PROFILE *)0) {
+        size = p_entry->StkSizeRec;
     }
-#else
-    p_base = p_base + stk_size - 1u;
-    for (i = 0u; i < OS_CFG_TASK_STK_REDZONE_DEPTH; i++) {
-        if (*p_base != (CPU_DATA)OS_STACK_CHECK_VAL) {
-            return (OS_FALSE);
-        }
-        p_base--;
+    CPU_CRITICAL_EXIT();
+
+    if (p_heap == (OS_HEAP *)0) {                               /* No heap given to OSTaskStkFitHeapSet()               */
+       *p_err = OS_ERR_STK_INVALID;
+        return ((CPU_STK *)0);
     }
-#endif
 
-    return (OS_TRUE);
-}
-#endif
+    if ((size >           0u) &&                                /* Cut the stack down to the recommended size           */
+        (size < *p_stk_size)) {
+       *p_stk_limit = (CPU_STK_SIZE)(((CPU_INT64U)*p_stk_limit * size) / *p_stk_size);
+       *p_stk_size  = size;
+    }
 
+    p_stk = (CPU_STK *)OSHeapAlloc(p_heap,
+                                   (CPU_SIZE_T)*p_stk_size * sizeof(CPU_STK),
+                                   p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return ((CPU_STK *)0);
+    }
+    OSHeapOwnerSet(p_heap, (void *)p_stk, (OS_TCB *)0, p_err);  /* See Note #1                                          */
+    return (p_stk);
+}
 
-/*
-************************************************************************************************************************
-*                                          INITIALIZE A REDZONE ENABLED STACK
-*
-* Description: This functions is used to initialize a stack with Redzone checking.
-*
-* Arguments  : p_tcb        is a pointer to the base of the stack.
-*
-*              stk_size     is the size of the stack.
-*
-* Returns    : none.
-*
-* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
-************************************************************************************************************************
-*/
 
-#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
-void  OS_TaskStkRedzoneInit (CPU_STK       *p_base,
-                             CPU_STK_SIZE   stk_size)
+static  void  OS_TaskStkFitFree (CPU_STK  *p_stk)
 {
-    CPU_STK_SIZE   i;
+    CPU_STK  *p_zombie;
+    OS_ERR    err;
+    CPU_SR_ALLOC();
 
 
-#if (CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO)
-   (void)stk_size;                                              /* Prevent compiler warning for not using 'stk_size'    */
+    CPU_CRITICAL_ENTER();
+    p_zombie              = OSTaskStkFitZombiePtr;              /* That task no longer runs on its stack                */
+    OSTaskStkFitZombiePtr = (CPU_STK *)0;
+    CPU_CRITICAL_EXIT();
 
-    for (i = 0u; i < OS_CFG_TASK_STK_REDZONE_DEPTH; i++) {
-        *(p_base + i) = (CPU_DATA)OS_STACK_CHECK_VAL;
+    if (p_zombie != (CPU_STK *)0) {
+        OSHeapFree(OSTaskStkFitHeapPtr, (void *)p_zombie, &err);
     }
-#else
-    for (i = 0u; i < OS_CFG_TASK_STK_REDZONE_DEPTH; i++) {
-        *(p_base + stk_size - 1u - i) = (CPU_DATA)OS_STACK_CHECK_VAL;
+    if (p_stk != (CPU_STK *)0) {
+        OSHeapFree(OSTaskStkFitHeapPtr, (void *)p_stk, &err);
     }
-#endif
+    (void)err;
 }
 #endif
 
 
 /*
 ************************************************************************************************************************
-*                                               CHANGE PRIORITY OF A TASK
-*
-* Description: This function is called by the kernel to perform the actual operation of changing a task's priority.
-*              Priority inheritance is updated if necessary.
+*                                        CHECKSUM/SEARCH THE STACK PROFILE TABLE
 *
+* Description: OS_TaskStkProfileChksum() computes the checksum of a stack profile table, over '.Nbr' and the entries.
+*              OS_TaskStkProfileFind() looks for the entry of a task entry point in the table given to
+*              OSTaskStkProfileInit().
 *
+* Arguments  : p_tbl     is a pointer to the stack profile table
 *
-* Argument(s): p_tcb        is a pointer to the tcb of the task to change the priority.
-*
-*              prio_new     is the new priority to give to the task.
+*              p_task    is a pointer to the task's code
 *
+* Returns    : OS_TaskStkProfileChksum() returns the checksum, OS_TaskStkProfileFind() a pointer to the entry or a NULL
+*              pointer if there is none.
 *
-* Returns    : none.
+* Note(s)    : 1) The checksum is seeded with OS_CFG_TASK_STK_PROFILE_SIZE so that a table of another size is not valid.
 *
-* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*              2) OS_TaskStkProfileFind() must be called with interrupts disabled.
 ************************************************************************************************************************
 */
 
-void  OS_TaskChangePrio(OS_TCB  *p_tcb,
-                        OS_PRIO  prio_new)
+#if (OS_CFG_TASK_STK_PROFILE_EN > 0u)
+static  CPU_INT32U  OS_TaskStkProfileChksum (OS_STK_PROFILE_TBL  *p_tbl)
 {
-    OS_TCB  *p_tcb_owner;
-#if (OS_CFG_MUTEX_EN > 0u)
-    OS_PRIO  prio_cur;
-#endif
-
+    CPU_INT08U  *p_byte;
+    CPU_INT08U  *p_end;
+    CPU_INT32U   chksum;
 
-    do {
-        p_tcb_owner = (OS_TCB *)0;
-#if (OS_CFG_MUTEX_EN > 0u)
-        prio_cur    =  p_tcb->Prio;
-#endif
-        switch (p_tcb->TaskState) {
-            case OS_TASK_STATE_RDY:
-                 OS_RdyListRemove(p_tcb);                       /* Remove from current priority                         */
-                 p_tcb->Prio = prio_new;                        /* Set new task priority                                */
-                 OS_PrioInsert(p_tcb->Prio);
-                 if (p_tcb == OSTCBCurPtr) {
-                     OS_RdyListInsertHead(p_tcb);
-                 } else {
-                     OS_RdyListInsertTail(p_tcb);
-                 }
-                 break;
 
-            case OS_TASK_STATE_DLY:                             /* Nothing to do except change the priority in the OS_TCB*/
-            case OS_TASK_STATE_SUSPENDED:
-            case OS_TASK_STATE_DLY_SUSPENDED:
-                 p_tcb->Prio = prio_new;                        /* Set new task priority                                */
-                 break;
+    chksum = OS_CFG_TASK_STK_PROFILE_SIZE;                      /* See Note #1                                          */
+    p_byte = (CPU_INT08U *)&p_tbl->Nbr;
+    p_end  = (CPU_INT08U *)(p_tbl + 1u);
+    while (p_byte < p_end) {
+        chksum = (chksum * 33u) + *p_byte;
+        p_byte++;
+    }
+    return (chksum);
+}
 
-            case OS_TASK_STATE_PEND:
-            case OS_TASK_STATE_PEND_TIMEOUT:
-            case OS_TASK_STATE_PEND_SUSPENDED:
-            case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
-                 p_tcb->Prio = prio_new;                        /* Set new task priority                                */
-                 switch (p_tcb->PendOn) {                       /* What to do depends on what we are pending on         */
-                     case OS_TASK_PEND_ON_FLAG:
-                     case OS_TASK_PEND_ON_Q:
-                     case OS_TASK_PEND_ON_SEM:
-                          OS_PendListChangePrio(p_tcb);
-                          break;
 
-                     case OS_TASK_PEND_ON_MUTEX:
-#if (OS_CFG_MUTEX_EN > 0u)
-                          OS_PendListChangePrio(p_tcb);
-                          p_tcb_owner = ((OS_MUTEX *)((void *)p_tcb->PendObjPtr))->OwnerTCBPtr;
-                          if (prio_cur > prio_new) {            /* Are we increasing the priority?                      */
-                              if (p_tcb_owner->Prio <= prio_new) { /* Yes, do we need to give this prio to the owner?   */
-                                  p_tcb_owner = (OS_TCB *)0;
-                              } else {
-                                                                /* Block is empty when trace is disabled.               */
-                                 OS_TRACE_MUTEX_TASK_PRIO_INHERIT(p_tcb_owner, prio_new);
-                              }
-                          } else {
-                              if (p_tcb_owner->Prio == prio_cur) { /* No, is it required to check for a lower prio?     */
-                                  prio_new = OS_MutexGrpPrioFindHighest(p_tcb_owner);
-                                  prio_new = (prio_new > p_tcb_owner->BasePrio) ? p_tcb_owner->BasePrio : prio_new;
-                                  if (prio_new == p_tcb_owner->Prio) {
-                                      p_tcb_owner = (OS_TCB *)0;
-                                  } else {
-                                                                /* Block is empty when trace is disabled.               */
-                                     OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb_owner, prio_new);
-                                  }
-                              }
-                          }
-#endif
-                          break;
+static  OS_STK_PROFILE  *OS_TaskStkProfileFind (OS_TASK_PTR  p_task)
+{
+    OS_STK_PROFILE_TBL  *p_tbl;
+    OS_OBJ_QTY           ix;
 
-                     case OS_TASK_PEND_ON_TASK_Q:
-                     case OS_TASK_PEND_ON_TASK_SEM:
-                     default:
-                                                                /* Default case.                                        */
-                          break;
-                 }
-                 break;
 
-            default:
-                 return;
+    p_tbl = OSTaskStkProfileTblPtr;
+    if (p_tbl == (OS_STK_PROFILE_TBL *)0) {
+        return ((OS_STK_PROFILE *)0);
+    }
+    for (ix = 0u; ix < p_tbl->Nbr; ix++) {
+        if (p_tbl->Tbl[ix].TaskEntryAddr == p_task) {
+            return (&p_tbl->Tbl[ix]);
         }
-        p_tcb = p_tcb_owner;
-    } while (p_tcb != (OS_TCB *)0);
+    }
+    return ((OS_STK_PROFILE *)0);
 }
+#endif
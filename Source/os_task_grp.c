@@ -0,0 +1,738 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                             TASK GROUPS
+*
+* File    : os_task_grp.c
+* Version : V3.08.00
+*********************************************************************************************************
+*/
+
+#define   MICRIUM_SOURCE
+#define   OS_CRIT_SITE_ID                   OS_CRIT_SITE_TASK_GRP
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_task_grp__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_TASK_GRP_EN > 0u)
+/*
+************************************************************************************************************************
+*                                                 CREATE A TASK GROUP
+*
+* Description : Create an empty task group.  Tasks are added to it with OSTaskGrpAdd().
+*
+* Arguments   : p_grp        is a pointer to the task group control block which is allocated in user memory space.
+*
+*               p_name       is a pointer to an ASCII string to provide a name to the task group.
+*
+*               p_err        is a pointer to a variable containing an error message which will be set by this function
+*                            to either:
+*
+*                                OS_ERR_NONE                    If the task group has been created correctly
+*                                OS_ERR_CREATE_ISR              If you called this function from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the task group after you
+*                                                                 called OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_CREATED             If the task group was already created
+*                                OS_ERR_OBJ_PTR_NULL            If you passed a NULL pointer for 'p_grp'
+*
+* Returns     : none
+*
+* Note(s)     : none
+************************************************************************************************************************
+*/
+
+void  OSTaskGrpCreate (OS_TASK_GRP  *p_grp,
+                       CPU_CHAR     *p_name,
+                       OS_ERR       *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_grp == (OS_TASK_GRP *)0) {                            /* Must point to a valid task group                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if (OS_OBJ_TYPE_REQ > 0u)
+#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
+    if (p_grp->Type == OS_OBJ_TYPE_TASK_GRP) {
+       *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_grp->Type          = OS_OBJ_TYPE_TASK_GRP;                /* Set the type of object                               */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_grp->NamePtr       = p_name;                              /* Save name of task group                              */
+#else
+    (void)p_name;
+#endif
+    p_grp->MemberListPtr = (OS_TCB *)0;
+    p_grp->NbrMembers    = 0u;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 DELETE A TASK GROUP
+*
+* Description : Delete a task group.  Its members are removed from it; their state is not changed.
+*
+* Arguments   : p_grp        is a pointer to the task group control block
+*
+*               p_err        is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the task group was deleted
+*                                OS_ERR_DEL_ISR                 If you called this function from an ISR
+*                                OS_ERR_ILLEGAL_DEL_RUN_TIME    If you are trying to delete the task group after you
+*                                                                 called OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL            If you passed a NULL pointer for 'p_grp'
+*                                OS_ERR_OBJ_TYPE                If 'p_grp' is not pointing at a task group
+*
+* Returns     : none
+*
+* Note(s)     : none
+************************************************************************************************************************
+*/
+
+void  OSTaskGrpDel (OS_TASK_GRP  *p_grp,
+                    OS_ERR       *p_err)
+{
+    OS_TCB  *p_tcb;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_DEL_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_grp == (OS_TASK_GRP *)0) {                            /* Must point to a valid task group                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_grp->Type != OS_OBJ_TYPE_TASK_GRP) {                  /* Make sure the task group was created                 */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_tcb = p_grp->MemberListPtr;
+    while (p_tcb != (OS_TCB *)0) {                              /* Remove all the members                               */
+        OS_TaskGrpRemove(p_tcb);
+        p_tcb = p_grp->MemberListPtr;
+    }
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_grp->Type          = OS_OBJ_TYPE_NONE;
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_grp->NamePtr       = (CPU_CHAR *)((void *)"?TASK GRP");
+#endif
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              ADD A TASK TO A TASK GROUP
+*
+* Description : Make a task a member of a task group.  A task can only be a member of one group at a time.
+*
+* Arguments   : p_grp        is a pointer to the task group control block
+*
+*               p_tcb        is a pointer to the TCB of the task to add.  A NULL pointer adds the calling task.
+*
+*               p_err        is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the task was added to the group
+*                                OS_ERR_OBJ_PTR_NULL            If you passed a NULL pointer for 'p_grp'
+*                                OS_ERR_OBJ_TYPE                If 'p_grp' is not pointing at a task group
+*                                OS_ERR_TASK_GRP_MEMBER         If the task is already a member of a task group
+*                                OS_ERR_TASK_SUSPEND_IDLE       If you tried to add the idle task
+*                                OS_ERR_TCB_INVALID             If you passed a NULL pointer for 'p_tcb' from an ISR
+*
+* Returns     : none
+*
+* Note(s)     : 1) The idle task can't be a member since it must never be suspended.
+************************************************************************************************************************
+*/
+
+void  OSTaskGrpAdd (OS_TASK_GRP  *p_grp,
+                    OS_TCB       *p_tcb,
+                    OS_ERR       *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_grp == (OS_TASK_GRP *)0) {                            /* Must point to a valid task group                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_grp->Type != OS_OBJ_TYPE_TASK_GRP) {                  /* Make sure the task group was created                 */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+#if (OS_CFG_TASK_IDLE_EN > 0u)
+    if (p_tcb == &OSIdleTaskTCB) {                              /* See Note #1                                          */
+       *p_err = OS_ERR_TASK_SUSPEND_IDLE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {                                 /* Add self?                                            */
+        if (OSIntNestingCtr > 0u) {                             /* There is no 'self' in an ISR                         */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_TCB_INVALID;
+            return;
+        }
+        p_tcb = OSTCBCurPtr;
+    }
+    if (p_tcb->GrpPtr != (OS_TASK_GRP *)0) {                    /* Already in a group                                   */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_TASK_GRP_MEMBER;
+        return;
+    }
+    p_tcb->GrpPtr        = p_grp;                               /* Insert at the head of the member list                */
+    p_tcb->GrpPrevPtr    = (OS_TCB *)0;
+    p_tcb->GrpNextPtr    = p_grp->MemberListPtr;
+    if (p_grp->MemberListPtr != (OS_TCB *)0) {
+        p_grp->MemberListPtr->GrpPrevPtr = p_tcb;
+    }
+    p_grp->MemberListPtr = p_tcb;
+    p_grp->NbrMembers++;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                           REMOVE A TASK FROM A TASK GROUP
+*
+* Description : Remove a task from the task group it is a member of.  A task is also removed from its group when it is
+*               deleted.
+*
+* Arguments   : p_grp        is a pointer to the task group control block
+*
+*               p_tcb        is a pointer to the TCB of the task to remove.  A NULL pointer removes the calling task.
+*
+*               p_err        is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the task was removed from the group
+*                                OS_ERR_OBJ_PTR_NULL            If you passed a NULL pointer for 'p_grp'
+*                                OS_ERR_OBJ_TYPE                If 'p_grp' is not pointing at a task group
+*                                OS_ERR_TASK_GRP_NOT_MEMBER     If the task is not a member of 'p_grp'
+*                                OS_ERR_TCB_INVALID             If you passed a NULL pointer for 'p_tcb' from an ISR
+*
+* Returns     : none
+*
+* Note(s)     : 1) The state of the task is not changed.  A task removed while suspended by OSTaskGrpSuspend() has to be
+*                  resumed with OSTaskResume().
+************************************************************************************************************************
+*/
+
+void  OSTaskGrpRemove (OS_TASK_GRP  *p_grp,
+                       OS_TCB       *p_tcb,
+                       OS_ERR       *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_grp == (OS_TASK_GRP *)0) {                            /* Must point to a valid task group                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_grp->Type != OS_OBJ_TYPE_TASK_GRP) {                  /* Make sure the task group was created                 */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {                                 /* Remove self?                                         */
+        if (OSIntNestingCtr > 0u) {                             /* There is no 'self' in an ISR                         */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_TCB_INVALID;
+            return;
+        }
+        p_tcb = OSTCBCurPtr;
+    }
+    if (p_tcb->GrpPtr != p_grp) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_TASK_GRP_NOT_MEMBER;
+        return;
+    }
+    OS_TaskGrpRemove(p_tcb);
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                             RESUME THE TASKS OF A GROUP
+*
+* Description : Remove one level of suspension from every member of a task group, then run the scheduler once.
+*
+* Arguments   : p_grp        is a pointer to the task group control block
+*
+*               p_err        is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the members were resumed
+*                                OS_ERR_OBJ_PTR_NULL            If you passed a NULL pointer for 'p_grp'
+*                                OS_ERR_OBJ_TYPE                If 'p_grp' is not pointing at a task group
+*                                OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                                OS_ERR_STATE_INVALID           If a member is in an invalid state
+*                                OS_ERR_TASK_RESUME_ISR         If you called this function from an ISR
+*
+*                            or any of the errors returned by OSSchedLock().
+*
+* Returns     : none
+*
+* Note(s)     : 1) The scheduler is locked while the members are visited and each member is resumed in its own short
+*                  critical section.  Interrupts are thus never disabled for longer than with OSTaskResume(), whatever
+*                  the size of the group, and the scheduler runs once, when it is unlocked, instead of once per task.
+*
+*               2) Members that are not suspended are left alone.  A member in an invalid state doesn't stop the
+*                  others from being resumed.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_SUSPEND_EN > 0u)
+void  OSTaskGrpResume (OS_TASK_GRP  *p_grp,
+                       OS_ERR       *p_err)
+{
+    OS_TCB  *p_tcb;
+    OS_ERR   err;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_TASK_RESUME_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_grp == (OS_TASK_GRP *)0) {                            /* Must point to a valid task group                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_grp->Type != OS_OBJ_TYPE_TASK_GRP) {                  /* Make sure the task group was created                 */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    OSSchedLock(p_err);                                         /* See Note #1                                          */
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_tcb = p_grp->MemberListPtr;
+    CPU_CRITICAL_EXIT();
+    while (p_tcb != (OS_TCB *)0) {
+        CPU_CRITICAL_ENTER();
+        OS_TaskResume(p_tcb, &err);
+        p_tcb = p_tcb->GrpNextPtr;
+        CPU_CRITICAL_EXIT();
+        if (err == OS_ERR_STATE_INVALID) {                      /* See Note #2                                          */
+           *p_err = OS_ERR_STATE_INVALID;
+        }
+    }
+
+    OSSchedUnlock(&err);                                        /* Run the scheduler once for all the members           */
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                             SUSPEND THE TASKS OF A GROUP
+*
+* Description : Add one level of suspension to every member of a task group, then run the scheduler once.  The calling
+*               task can be a member of the group.
+*
+* Arguments   : p_grp        is a pointer to the task group control block
+*
+*               p_err        is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the members were suspended
+*                                OS_ERR_OBJ_PTR_NULL            If you passed a NULL pointer for 'p_grp'
+*                                OS_ERR_OBJ_TYPE                If 'p_grp' is not pointing at a task group
+*                                OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                                OS_ERR_SCHED_LOCKED            If the calling task is a member and the scheduler is
+*                                                                 locked
+*                                OS_ERR_STATE_INVALID           If a member is in an invalid state
+*                                OS_ERR_TASK_SUSPEND_CTR_OVF    If the suspension counter of a member overflowed
+*                                OS_ERR_TASK_SUSPEND_ISR        If you called this function from an ISR
+*
+*                            or any of the errors returned by OSSchedLock().
+*
+* Returns     : none
+*
+* Note(s)     : 1) See OSTaskGrpResume(), Note #1.  When the calling task is a member, it leaves the ready list with the
+*                  others and is switched out when the scheduler is unlocked, so the call returns once the group has
+*                  been resumed.
+*
+*               2) A member whose suspension counter would overflow, or in an invalid state, is left unchanged.  This
+*                  doesn't stop the others from being suspended.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_SUSPEND_EN > 0u)
+void  OSTaskGrpSuspend (OS_TASK_GRP  *p_grp,
+                        OS_ERR       *p_err)
+{
+    OS_TCB  *p_tcb;
+    OS_ERR   err;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_TASK_SUSPEND_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_grp == (OS_TASK_GRP *)0) {                            /* Must point to a valid task group                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_grp->Type != OS_OBJ_TYPE_TASK_GRP) {                  /* Make sure the task group was created                 */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if ((OSTCBCurPtr           != (OS_TCB *)0) &&
+        (OSTCBCurPtr->GrpPtr   == p_grp)       &&
+        (OSSchedLockNestingCtr >  0u)) {                        /* Can't suspend self when the scheduler is locked      */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_SCHED_LOCKED;
+        return;
+    }
+    CPU_CRITICAL_EXIT();
+
+    OSSchedLock(p_err);                                         /* See Note #1                                          */
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_tcb = p_grp->MemberListPtr;
+    CPU_CRITICAL_EXIT();
+    while (p_tcb != (OS_TCB *)0) {
+        CPU_CRITICAL_ENTER();
+        OS_TaskSuspend(p_tcb, &err);
+        p_tcb = p_tcb->GrpNextPtr;
+        CPU_CRITICAL_EXIT();
+        if (err != OS_ERR_NONE) {                               /* See Note #2                                          */
+           *p_err = err;
+        }
+    }
+
+    OSSchedUnlock(&err);                                        /* Run the scheduler once for all the members           */
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                        GET THE CPU USAGE OF A TASK GROUP
+*
+* Description : These functions return the CPU time used by the members of a task group:
+*
+*                   OSTaskGrpCPUUsageGet()   returns the sum of the '.CPUUsage' of the members, as computed by the
+*                                            statistic task (0.00-100.00%, in units of 0.01%).
+*
+*                   OSTaskGrpCyclesGet()     returns the sum of the '.CyclesTotal' of the members, i.e. the number of
+*                                            OS_TS_GET() cycles they have been running.
+*
+* Arguments   : p_grp        is a pointer to the task group control block
+*
+*               p_err        is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_OBJ_PTR_NULL            If you passed a NULL pointer for 'p_grp'
+*                                OS_ERR_OBJ_TYPE                If 'p_grp' is not pointing at a task group
+*
+* Returns     : The CPU usage or the number of cycles, 0 if an error is detected.
+*
+* Note(s)     : 1) Only the current members are counted.  The time used by a task before it left the group, or was
+*                  deleted, is not.
+*
+*               2) The members are summed with the scheduler locked, so that the group can't change meanwhile, and each
+*                  member in its own critical section.  The result is not a single snapshot: a member may run between
+*                  two others being read.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_PROFILE_EN > 0u)
+OS_CPU_USAGE  OSTaskGrpCPUUsageGet (OS_TASK_GRP  *p_grp,
+                                    OS_ERR       *p_err)
+{
+    OS_TCB      *p_tcb;
+    CPU_INT32U   usage;
+    OS_ERR       err;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_grp == (OS_TASK_GRP *)0) {                            /* Must point to a valid task group                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_grp->Type != OS_OBJ_TYPE_TASK_GRP) {                  /* Make sure the task group was created                 */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    OSSchedLock(&err);                                          /* See Note #2                                          */
+    usage = 0u;
+    CPU_CRITICAL_ENTER();
+    p_tcb = p_grp->MemberListPtr;
+    CPU_CRITICAL_EXIT();
+    while (p_tcb != (OS_TCB *)0) {
+        CPU_CRITICAL_ENTER();
+        usage += p_tcb->CPUUsage;
+        p_tcb  = p_tcb->GrpNextPtr;
+        CPU_CRITICAL_EXIT();
+    }
+    if (err == OS_ERR_NONE) {
+        OSSchedUnlock(&err);
+    }
+
+    if (usage > 10000u) {                                       /* Rounding of the per-task values may exceed 100.00%   */
+        usage = 10000u;
+    }
+   *p_err = OS_ERR_NONE;
+    return ((OS_CPU_USAGE)usage);
+}
+
+
+OS_CYCLES  OSTaskGrpCyclesGet (OS_TASK_GRP  *p_grp,
+                               OS_ERR       *p_err)
+{
+    OS_TCB     *p_tcb;
+    OS_CYCLES   cycles;
+    OS_ERR      err;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_grp == (OS_TASK_GRP *)0) {                            /* Must point to a valid task group                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_grp->Type != OS_OBJ_TYPE_TASK_GRP) {                  /* Make sure the task group was created                 */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    OSSchedLock(&err);                                          /* See Note #2                                          */
+    cycles = 0u;
+    CPU_CRITICAL_ENTER();
+    p_tcb = p_grp->MemberListPtr;
+    CPU_CRITICAL_EXIT();
+    while (p_tcb != (OS_TCB *)0) {
+        CPU_CRITICAL_ENTER();
+        cycles += p_tcb->CyclesTotal;
+        p_tcb   = p_tcb->GrpNextPtr;
+        CPU_CRITICAL_EXIT();
+    }
+    if (err == OS_ERR_NONE) {
+        OSSchedUnlock(&err);
+    }
+   *p_err = OS_ERR_NONE;
+    return (cycles);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                        REMOVE A TASK FROM ITS TASK GROUP
+*
+* Description : This function unlinks a task from the member list of its task group.  It is called by OSTaskDel(),
+*               OSTaskGrpDel() and OSTaskGrpRemove().
+*
+* Arguments   : p_tcb        is a pointer to the TCB of the member.
+*
+* Returns     : none
+*
+* Note(s)     : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*               2) This function is called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+void  OS_TaskGrpRemove (OS_TCB  *p_tcb)
+{
+    OS_TASK_GRP  *p_grp;
+
+
+    p_grp = p_tcb->GrpPtr;
+    if (p_tcb->GrpPrevPtr == (OS_TCB *)0) {                     /* Head of the member list?                             */
+        p_grp->MemberListPtr          = p_tcb->GrpNextPtr;
+    } else {
+        p_tcb->GrpPrevPtr->GrpNextPtr = p_tcb->GrpNextPtr;
+    }
+    if (p_tcb->GrpNextPtr != (OS_TCB *)0) {
+        p_tcb->GrpNextPtr->GrpPrevPtr = p_tcb->GrpPrevPtr;
+    }
+    p_tcb->GrpPtr     = (OS_TASK_GRP *)0;
+    p_tcb->GrpNextPtr = (OS_TCB      *)0;
+    p_tcb->GrpPrevPtr = (OS_TCB      *)0;
+    p_grp->NbrMembers--;
+}
+#endif
@@ -0,0 +1,421 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                             TASK POOLS
+*
+* File    : os_task_pool.c
+* Version : V3.08.00
+*********************************************************************************************************
+*/
+
+#define   MICRIUM_SOURCE
+#define   OS_CRIT_SITE_ID                   OS_CRIT_SITE_TASK_POOL
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_task_pool__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_TASK_POOL_EN > 0u)
+/*
+************************************************************************************************************************
+*                                                 CREATE A TASK POOL
+*
+* Description : Create a pool of 'nbr_slots' slots on which tasks can be run with OSTaskPoolRun().  Slot 'i' is made of
+*               'p_tcb_tbl[i]' and of the 'stk_size' stack elements starting at 'p_stk_tbl + i * stk_size'.
+*
+* Arguments   : p_pool       is a pointer to the task pool control block which is allocated in user memory space.
+*
+*               p_name       is a pointer to an ASCII string to provide a name to the task pool.
+*
+*               p_tcb_tbl    is a pointer to an array of 'nbr_slots' TCBs.
+*
+*               p_stk_tbl    is a pointer to the base of 'nbr_slots * stk_size' stack elements.
+*
+*               nbr_slots    is the number of slots of the pool.
+*
+*               stk_size     is the size of the stack of each slot, in number of CPU_STK elements.
+*
+*               stk_limit    is the stack limit of the tasks (see OSTaskCreate()).
+*
+*               prio         is the priority of the tasks.
+*
+*               q_size       is the size of the message queue of the tasks.
+*
+*               opt          contains the options of the tasks (see OSTaskCreate()).
+*
+*               p_err        is a pointer to a variable containing an error message which will be set by this function
+*                            to either:
+*
+*                                OS_ERR_NONE                    If the task pool has been created correctly
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the task pool after you
+*                                                                 called OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_CREATED             If the task pool was already created
+*                                OS_ERR_OBJ_PTR_NULL            If you passed a NULL pointer for 'p_pool'
+*                                OS_ERR_STK_INVALID             If you passed a NULL pointer for 'p_stk_tbl'
+*                                OS_ERR_STK_LIMIT_INVALID       If 'stk_limit' is greater than or equal to 'stk_size'
+*                                OS_ERR_STK_SIZE_INVALID        If 'stk_size' is smaller than the minimum stack size
+*                                OS_ERR_TASK_CREATE_ISR         If you called this function from an ISR
+*                                OS_ERR_TCB_INVALID             If you passed a NULL pointer for 'p_tcb_tbl' or 0 for
+*                                                                 'nbr_slots'
+*
+* Returns     : none
+*
+* Note(s)     : 1) With OS_OPT_TASK_STK_CLR, the stacks are cleared once, here.  The tasks run by OSTaskPoolRun() are
+*                  created without it, so the stack usage given by OSTaskStkChk() for a slot is the worst case of all
+*                  the tasks run on it.
+************************************************************************************************************************
+*/
+
+void  OSTaskPoolCreate (OS_TASK_POOL  *p_pool,
+                        CPU_CHAR      *p_name,
+                        OS_TCB        *p_tcb_tbl,
+                        CPU_STK       *p_stk_tbl,
+                        OS_OBJ_QTY     nbr_slots,
+                        CPU_STK_SIZE   stk_size,
+                        CPU_STK_SIZE   stk_limit,
+                        OS_PRIO        prio,
+                        OS_MSG_QTY     q_size,
+                        OS_OPT         opt,
+                        OS_ERR        *p_err)
+{
+    OS_OBJ_QTY   i;
+    OS_TCB      *p_tcb;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_TASK_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_pool == (OS_TASK_POOL *)0) {                          /* Must point to a valid task pool                      */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if ((p_tcb_tbl == (OS_TCB *)0) ||                           /* Must provide at least one TCB                        */
+        (nbr_slots == 0u)) {
+       *p_err = OS_ERR_TCB_INVALID;
+        return;
+    }
+    if (p_stk_tbl == (CPU_STK *)0) {                            /* Must provide the stacks                              */
+       *p_err = OS_ERR_STK_INVALID;
+        return;
+    }
+    if (stk_size < OSCfg_StkSizeMin) {                          /* Must provide a valid minimum stack size              */
+       *p_err = OS_ERR_STK_SIZE_INVALID;
+        return;
+    }
+    if (stk_limit >= stk_size) {                                /* Must provide a valid stack limit                     */
+       *p_err = OS_ERR_STK_LIMIT_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_OBJ_TYPE_REQ > 0u)
+#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
+    if (p_pool->Type == OS_OBJ_TYPE_TASK_POOL) {
+       *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+#endif
+
+    if ((opt & OS_OPT_TASK_STK_CLR) != 0u) {                    /* Clear all the stacks once (see Note #1)              */
+        OS_CPU_STK_CLR(p_stk_tbl, (CPU_STK_SIZE)nbr_slots * stk_size);
+    }
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_pool->Type        = OS_OBJ_TYPE_TASK_POOL;                /* Set the type of object                               */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_pool->NamePtr     = p_name;                               /* Save name of task pool                               */
+#else
+    (void)p_name;
+#endif
+    p_pool->TCBTbl      = p_tcb_tbl;
+    p_pool->StkTbl      = p_stk_tbl;
+    p_pool->StkSize     = stk_size;
+    p_pool->StkLimit    = stk_limit;
+    p_pool->Prio        = prio;
+    p_pool->QSize       = q_size;
+    p_pool->Opt         = opt & (OS_OPT)~(OS_OPT_TASK_STK_CLR | OS_OPT_TASK_STK_CLR_DEFER);
+    p_pool->NbrSlots    = nbr_slots;
+    p_pool->NbrFree     = nbr_slots;
+    p_pool->NbrUsedMax  = 0u;
+
+    p_pool->FreeListPtr = (OS_TCB *)0;                          /* Link all the slots in the free list                  */
+    i                   = nbr_slots;
+    while (i > 0u) {
+        i--;
+        p_tcb               = &p_tcb_tbl[i];
+        p_tcb->PoolPtr      = (OS_TASK_POOL *)0;
+        p_tcb->PoolNextPtr  = p_pool->FreeListPtr;
+        p_pool->FreeListPtr = p_tcb;
+    }
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                             RUN A TASK FROM A TASK POOL
+*
+* Description : Run a task on a free slot of a task pool.  The task is created with the priority, stack and options
+*               given to OSTaskPoolCreate().
+*
+* Arguments   : p_pool   is a pointer to the task pool control block
+*
+*               p_name   is a pointer to an ASCII string to provide a name to the task.
+*
+*               p_task   is a pointer to the task's code.
+*
+*               p_arg    is a pointer to an optional data area which can be used to pass parameters to the task.
+*
+*               p_err    is a pointer to a variable containing an error message which will be set by this function to
+*                        either:
+*
+*                            OS_ERR_NONE               If the task was created
+*                            OS_ERR_OBJ_PTR_NULL       If you passed a NULL pointer for 'p_pool'
+*                            OS_ERR_OBJ_TYPE           If 'p_pool' is not pointing at a task pool
+*                            OS_ERR_TASK_CREATE_ISR    If you called this function from an ISR
+*                            OS_ERR_TASK_NO_MORE_TCB   If all the slots of the pool are used
+*
+*                        or any of the errors returned by OSSchedLock() or OSTaskCreate().
+*
+* Returns     : A pointer to the TCB of the task, NULL if an error is detected.
+*
+* Note(s)     : 1) The slot goes back to the pool when the task is deleted with OSTaskDel() or returns from its code.
+*
+*              2) The scheduler is locked while the task is created, so that the task can't run and be deleted before
+*                 it is marked as belonging to the pool.
+************************************************************************************************************************
+*/
+
+OS_TCB  *OSTaskPoolRun (OS_TASK_POOL  *p_pool,
+                        CPU_CHAR      *p_name,
+                        OS_TASK_PTR    p_task,
+                        void          *p_arg,
+                        OS_ERR        *p_err)
+{
+    OS_TCB       *p_tcb;
+    CPU_STK      *p_stk;
+    CPU_BOOLEAN   sched_locked;
+    OS_ERR        err;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_TCB *)0);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_TASK_CREATE_ISR;
+        return ((OS_TCB *)0);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_pool == (OS_TASK_POOL *)0) {                          /* Must point to a valid task pool                      */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return ((OS_TCB *)0);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_pool->Type != OS_OBJ_TYPE_TASK_POOL) {                /* Make sure the task pool was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return ((OS_TCB *)0);
+    }
+#endif
+
+    sched_locked = OS_FALSE;
+    if (OSRunning == OS_STATE_OS_RUNNING) {                     /* See Note #2                                          */
+        OSSchedLock(p_err);
+        if (*p_err != OS_ERR_NONE) {
+            return ((OS_TCB *)0);
+        }
+        sched_locked = OS_TRUE;
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_tcb = p_pool->FreeListPtr;
+    if (p_tcb == (OS_TCB *)0) {                                 /* All the slots are used                               */
+        CPU_CRITICAL_EXIT();
+        if (sched_locked == OS_TRUE) {
+            OSSchedUnlock(&err);
+        }
+       *p_err = OS_ERR_TASK_NO_MORE_TCB;
+        return ((OS_TCB *)0);
+    }
+    p_pool->FreeListPtr = p_tcb->PoolNextPtr;
+    p_pool->NbrFree--;
+    if (p_pool->NbrUsedMax < (p_pool->NbrSlots - p_pool->NbrFree)) {
+        p_pool->NbrUsedMax = p_pool->NbrSlots - p_pool->NbrFree;
+    }
+    CPU_CRITICAL_EXIT();
+
+    p_stk = p_pool->StkTbl + ((CPU_STK_SIZE)(p_tcb - p_pool->TCBTbl) * p_pool->StkSize);
+    OSTaskCreate(p_tcb,
+                 p_name,
+                 p_task,
+                 p_arg,
+                 p_pool->Prio,
+                 p_stk,
+                 p_pool->StkLimit,
+                 p_pool->StkSize,
+                 p_pool->QSize,
+                 0u,
+                 (void *)0,
+                 p_pool->Opt,
+                 p_err);
+
+    CPU_CRITICAL_ENTER();
+    p_tcb->PoolPtr = p_pool;                                    /* Slot is returned to the pool by OSTaskDel()          */
+    if (*p_err != OS_ERR_NONE) {                                /* Creation failed, give the slot back                  */
+        OS_TaskPoolSlotFree(p_tcb);
+        p_tcb = (OS_TCB *)0;
+    }
+    CPU_CRITICAL_EXIT();
+
+    if (sched_locked == OS_TRUE) {
+        OSSchedUnlock(&err);                                    /* Let the new task run if it has a higher priority     */
+    }
+    return (p_tcb);
+}
+
+
+/*
+************************************************************************************************************************
+*                                          GET THE NUMBER OF SLOTS USED IN A TASK POOL
+*
+* Description : Return the number of slots of a task pool on which a task is running.
+*
+* Arguments   : p_pool       is a pointer to the task pool control block
+*
+*               p_used_max   is a pointer to a variable that will receive the peak number of slots used.  You can pass
+*                            a NULL pointer if you don't need it.
+*
+*               p_err        is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               If the call was successful
+*                                OS_ERR_OBJ_PTR_NULL       If you passed a NULL pointer for 'p_pool'
+*                                OS_ERR_OBJ_TYPE           If 'p_pool' is not pointing at a task pool
+*
+* Returns     : The number of slots used, 0 if an error is detected
+*
+* Note(s)     : none
+************************************************************************************************************************
+*/
+
+OS_OBJ_QTY  OSTaskPoolUsedGet (OS_TASK_POOL  *p_pool,
+                               OS_OBJ_QTY    *p_used_max,
+                               OS_ERR        *p_err)
+{
+    OS_OBJ_QTY  used;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_pool == (OS_TASK_POOL *)0) {                          /* Must point to a valid task pool                      */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_pool->Type != OS_OBJ_TYPE_TASK_POOL) {                /* Make sure the task pool was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    used = p_pool->NbrSlots - p_pool->NbrFree;
+    if (p_used_max != (OS_OBJ_QTY *)0) {
+       *p_used_max = p_pool->NbrUsedMax;
+    }
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+    return (used);
+}
+
+
+/*
+************************************************************************************************************************
+*                                          RETURN A SLOT TO ITS TASK POOL
+*
+* Description : This function is called by OSTaskDel() when the deleted task was run by OSTaskPoolRun().
+*
+* Arguments   : p_tcb        is a pointer to the TCB of the slot.
+*
+* Returns     : none
+*
+* Note(s)     : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*               2) This function is called with interrupts disabled.  The slot can only be reused by a task running
+*                  OSTaskPoolRun(), which means that the deleted task has been switched out.
+************************************************************************************************************************
+*/
+
+void  OS_TaskPoolSlotFree (OS_TCB  *p_tcb)
+{
+    OS_TASK_POOL  *p_pool;
+
+
+    p_pool              = p_tcb->PoolPtr;
+    p_tcb->PoolPtr      = (OS_TASK_POOL *)0;
+    p_tcb->PoolNextPtr  = p_pool->FreeListPtr;
+    p_pool->FreeListPtr = p_tcb;
+    p_pool->NbrFree++;
+}
+#endif
@@ -0,0 +1,477 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          TASK STACK GROUPS
+*
+* File    : os_task_stk_grp.c
+* Version : V3.08.00
+*********************************************************************************************************
+*/
+
+#define   MICRIUM_SOURCE
+#define   OS_CRIT_SITE_ID                   OS_CRIT_SITE_TASK_STK_GRP
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_task_stk_grp__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_TASK_STK_GRP_EN > 0u)
+/*
+************************************************************************************************************************
+*                                              CREATE A TASK STACK GROUP
+*
+* Description : Create an empty task stack group.  Its members are created with OSTaskStkGrpTaskCreate() and all run on
+*               the 'stk_size' stack elements starting at 'p_stk_base', one member at a time.
+*
+* Arguments   : p_grp        is a pointer to the task stack group control block which is allocated in user memory
+*                            space.
+*
+*               p_name       is a pointer to an ASCII string to provide a name to the task stack group.
+*
+*               p_stk_base   is a pointer to the base of the stack shared by the members.
+*
+*               stk_limit    is the stack limit of the members (see OSTaskCreate()).
+*
+*               stk_size     is the size of the stack, in number of CPU_STK elements.
+*
+*               p_err        is a pointer to a variable containing an error message which will be set by this function
+*                            to either:
+*
+*                                OS_ERR_NONE                    If the task stack group has been created correctly
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the task stack group after
+*                                                                 you called OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_CREATED             If the task stack group was already created
+*                                OS_ERR_OBJ_PTR_NULL            If you passed a NULL pointer for 'p_grp'
+*                                OS_ERR_STK_INVALID             If you passed a NULL pointer for 'p_stk_base'
+*                                OS_ERR_STK_LIMIT_INVALID       If 'stk_limit' is greater than or equal to 'stk_size'
+*                                OS_ERR_STK_SIZE_INVALID        If 'stk_size' is smaller than the minimum stack size
+*                                OS_ERR_TASK_CREATE_ISR         If you called this function from an ISR
+*
+* Returns     : none
+*
+* Note(s)     : 1) The stack must be sized for the member that needs the most stack.
+************************************************************************************************************************
+*/
+
+void  OSTaskStkGrpCreate (OS_TASK_STK_GRP  *p_grp,
+                          CPU_CHAR         *p_name,
+                          CPU_STK          *p_stk_base,
+                          CPU_STK_SIZE      stk_limit,
+                          CPU_STK_SIZE      stk_size,
+                          OS_ERR           *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_TASK_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_grp == (OS_TASK_STK_GRP *)0) {                        /* Must point to a valid task stack group               */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_stk_base == (CPU_STK *)0) {                           /* Must provide the stack                               */
+       *p_err = OS_ERR_STK_INVALID;
+        return;
+    }
+    if (stk_size < OSCfg_StkSizeMin) {                          /* Must provide a valid minimum stack size              */
+       *p_err = OS_ERR_STK_SIZE_INVALID;
+        return;
+    }
+    if (stk_limit >= stk_size) {                                /* Must provide a valid stack limit                     */
+       *p_err = OS_ERR_STK_LIMIT_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_OBJ_TYPE_REQ > 0u)
+#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
+    if (p_grp->Type == OS_OBJ_TYPE_TASK_STK_GRP) {
+       *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_grp->Type          = OS_OBJ_TYPE_TASK_STK_GRP;            /* Set the type of object                               */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_grp->NamePtr       = p_name;                              /* Save name of task stack group                        */
+#else
+    (void)p_name;
+#endif
+    p_grp->StkBasePtr    = p_stk_base;
+    p_grp->StkSize       = stk_size;
+    p_grp->StkLimit      = stk_limit;
+    p_grp->ActivePtr     = (OS_TCB *)0;                         /* No member owns the stack yet                         */
+    p_grp->MemberListPtr = (OS_TCB *)0;
+    p_grp->NbrMembers    = 0u;
+    p_grp->NbrStarts     = 0u;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                       MAKE THE CURRENT MEMBER OF A STACK GROUP DORMANT
+*
+* Description : The current task, a member of a task stack group, gives the stack of its group up.  It is suspended and
+*               the next OSTaskResume() on it makes it start again from its entry point.
+*
+* Arguments   : p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                       The task is dormant
+*                            OS_ERR_OS_NOT_RUNNING             If uC/OS-III is not running yet
+*                            OS_ERR_SCHED_LOCKED               If the scheduler is locked
+*                            OS_ERR_TASK_STK_GRP_NOT_MEMBER    If the current task is not a member of a stack group
+*                            OS_ERR_TASK_SUSPEND_ISR           If you called this function from an ISR
+*
+* Returns     : none
+*
+* Note(s)     : 1) This function doesn't return to its caller when successful: the context of the task is left on the
+*                  stack of the group, which another member may then overwrite.
+*
+*               2) The stack is given up and the task suspended in the same critical section, so that no other member
+*                  can be started while the context of the task is still live.
+*
+*               3) A member returning from its code also becomes dormant (see OS_TaskReturn()).
+************************************************************************************************************************
+*/
+
+void  OSTaskStkGrpDormant (OS_ERR  *p_err)
+{
+    OS_TCB  *p_tcb;
+    OS_ERR   err;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_TASK_SUSPEND_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_tcb = OSTCBCurPtr;
+    if (p_tcb->StkGrpPtr == (OS_TASK_STK_GRP *)0) {             /* Only the members of a stack group can be dormant     */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_TASK_STK_GRP_NOT_MEMBER;
+        return;
+    }
+    if (OSSchedLockNestingCtr > 0u) {                           /* Can't give the stack up with the scheduler locked    */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_SCHED_LOCKED;
+        return;
+    }
+    p_tcb->StkGrpPtr->ActivePtr = (OS_TCB *)0;                  /* See Note #2                                          */
+    p_tcb->StkGrpDormant        = OS_TRUE;
+    OS_TaskSuspend(p_tcb, &err);
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+
+    OSSched();                                                  /* See Note #1                                          */
+}
+
+
+/*
+************************************************************************************************************************
+*                                         CREATE A MEMBER OF A TASK STACK GROUP
+*
+* Description : Create a task on the stack of a task stack group.  The task is created dormant: it starts running from
+*               'p_task' when resumed with OSTaskResume(), provided that all the other members of the group are dormant.
+*
+* Arguments   : p_grp          is a pointer to the task stack group control block.
+*
+*               p_tcb          is a pointer to the task's TCB.
+*
+*               p_name         is a pointer to an ASCII string to provide a name to the task.
+*
+*               p_task         is a pointer to the task's code.
+*
+*               p_arg          is a pointer to an optional data area which can be used to pass parameters to the task.
+*
+*               prio           is the task's priority.
+*
+*               q_size         is the size of the task's message queue.
+*
+*               time_quanta    is the amount of time (in ticks) for time slicing when round-robin is enabled.
+*
+*               p_ext          is a pointer to a user supplied memory location which is used as a TCB extension.
+*
+*               opt            contains the options of the task (see OSTaskCreate()).
+*
+*               p_err          is a pointer to a variable containing an error message which will be set by this
+*                              function to either:
+*
+*                                  OS_ERR_NONE                    If the task has been created dormant
+*                                  OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the task after you called
+*                                                                   OSSafetyCriticalStart()
+*                                  OS_ERR_OBJ_PTR_NULL            If you passed a NULL pointer for 'p_grp'
+*                                  OS_ERR_OBJ_TYPE                If 'p_grp' is not pointing at a task stack group
+*                                  OS_ERR_TASK_CREATE_ISR         If you called this function from an ISR
+*                                  OS_ERR_TASK_STK_GRP_BUSY       If a member of the group is not dormant
+*                                  OS_ERR_TCB_INVALID             If you passed a NULL pointer for 'p_tcb'
+*
+*                              or any of the errors returned by OSSchedLock() or OSTaskCreate().
+*
+* Returns     : none
+*
+* Note(s)     : 1) OSTaskCreate() builds the initial frame of the task on the shared stack, so the group must be idle.
+*                  The scheduler is locked so that no member can be started before the task is made dormant.
+*
+*               2) OS_OPT_TASK_STK_CLR_DEFER and OS_OPT_TASK_STK_FIT are ignored: the idle task must not clear a stack
+*                  that another member may be using and the stack belongs to the group.
+************************************************************************************************************************
+*/
+
+void  OSTaskStkGrpTaskCreate (OS_TASK_STK_GRP  *p_grp,
+                              OS_TCB           *p_tcb,
+                              CPU_CHAR         *p_name,
+                              OS_TASK_PTR       p_task,
+                              void             *p_arg,
+                              OS_PRIO           prio,
+                              OS_MSG_QTY        q_size,
+                              OS_TICK           time_quanta,
+                              void             *p_ext,
+                              OS_OPT            opt,
+                              OS_ERR           *p_err)
+{
+    CPU_BOOLEAN  sched_locked;
+    OS_ERR       err;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_TASK_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_grp == (OS_TASK_STK_GRP *)0) {                        /* Must point to a valid task stack group               */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_tcb == (OS_TCB *)0) {                                 /* Must provide a TCB                                   */
+       *p_err = OS_ERR_TCB_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_grp->Type != OS_OBJ_TYPE_TASK_STK_GRP) {              /* Make sure the task stack group was created           */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    sched_locked = OS_FALSE;
+    if (OSRunning == OS_STATE_OS_RUNNING) {                     /* See Note #1                                          */
+        OSSchedLock(p_err);
+        if (*p_err != OS_ERR_NONE) {
+            return;
+        }
+        sched_locked = OS_TRUE;
+    }
+
+    CPU_CRITICAL_ENTER();
+    if (p_grp->ActivePtr != (OS_TCB *)0) {                      /* A member owns the stack                              */
+        CPU_CRITICAL_EXIT();
+        if (sched_locked == OS_TRUE) {
+            OSSchedUnlock(&err);
+        }
+       *p_err = OS_ERR_TASK_STK_GRP_BUSY;
+        return;
+    }
+    CPU_CRITICAL_EXIT();
+
+    OSTaskCreate(p_tcb,
+                 p_name,
+                 p_task,
+                 p_arg,
+                 prio,
+                 p_grp->StkBasePtr,
+                 p_grp->StkLimit,
+                 p_grp->StkSize,
+                 q_size,
+                 time_quanta,
+                 p_ext,
+                 opt & (OS_OPT)~(OS_OPT_TASK_STK_CLR_DEFER | OS_OPT_TASK_STK_FIT),
+                 p_err);
+
+    if (*p_err == OS_ERR_NONE) {
+        CPU_CRITICAL_ENTER();
+        OS_TaskSuspend(p_tcb, &err);                            /* The task is dormant until resumed                    */
+        p_tcb->StkGrpPtr     = p_grp;
+        p_tcb->StkGrpTask    = p_task;
+        p_tcb->StkGrpArg     = p_arg;
+        p_tcb->StkGrpDormant = OS_TRUE;
+        p_tcb->StkGrpNextPtr = p_grp->MemberListPtr;            /* Add the task to the members of the group             */
+        p_grp->MemberListPtr = p_tcb;
+        p_grp->NbrMembers++;
+        CPU_CRITICAL_EXIT();
+    }
+
+    if (sched_locked == OS_TRUE) {
+        OSSchedUnlock(&err);
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                       REMOVE A TASK FROM ITS TASK STACK GROUP
+*
+* Description : This function is called by OSTaskDel() when the deleted task is a member of a task stack group.
+*
+* Arguments   : p_tcb        is a pointer to the TCB of the member.
+*
+* Returns     : none
+*
+* Note(s)     : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*               2) This function is called with interrupts disabled.  When the deleted task owned the stack, the stack
+*                  can only be used again by a task resuming a member, which means that the deleted task has been
+*                  switched out.
+************************************************************************************************************************
+*/
+
+void  OS_TaskStkGrpRemove (OS_TCB  *p_tcb)
+{
+    OS_TASK_STK_GRP  *p_grp;
+    OS_TCB          **p_link;
+
+
+    p_grp  = p_tcb->StkGrpPtr;
+    p_link = &p_grp->MemberListPtr;
+    while (*p_link != p_tcb) {                                  /* Find the link to the task                            */
+        p_link = &(*p_link)->StkGrpNextPtr;
+    }
+   *p_link = p_tcb->StkGrpNextPtr;
+    p_grp->NbrMembers--;
+    if (p_grp->ActivePtr == p_tcb) {                            /* See Note #2                                          */
+        p_grp->ActivePtr = (OS_TCB *)0;
+    }
+    p_tcb->StkGrpPtr     = (OS_TASK_STK_GRP *)0;
+    p_tcb->StkGrpNextPtr = (OS_TCB *)0;
+    p_tcb->StkGrpDormant = OS_FALSE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                      START A DORMANT MEMBER OF A TASK STACK GROUP
+*
+* Description : This function is called by OS_TaskResume() when the last level of suspension of a dormant member is
+*               removed.  The member gets the stack of its group and a new initial frame.
+*
+* Arguments   : p_tcb        is a pointer to the TCB of the member.
+*
+*               p_err        is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                 The member can be made ready
+*                                OS_ERR_TASK_STK_GRP_BUSY    Another member of the group is not dormant
+*
+* Returns     : none
+*
+* Note(s)     : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*               2) This function is called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+void  OS_TaskStkGrpStart (OS_TCB  *p_tcb,
+                          OS_ERR  *p_err)
+{
+    OS_TASK_STK_GRP  *p_grp;
+
+
+    p_grp = p_tcb->StkGrpPtr;
+    if (p_grp->ActivePtr != (OS_TCB *)0) {                      /* Only one member may own the stack                    */
+       *p_err = OS_ERR_TASK_STK_GRP_BUSY;
+        return;
+    }
+    p_tcb->StkPtr = OSTaskStkInit(p_tcb->StkGrpTask,            /* Start again from the entry point                     */
+                                  p_tcb->StkGrpArg,
+                                  p_grp->StkBasePtr,
+                                  p_tcb->StkLimitPtr,
+                                  p_grp->StkSize,
+                                  p_tcb->Opt);
+    p_tcb->StkGrpDormant = OS_FALSE;
+    p_grp->ActivePtr     = p_tcb;
+    p_grp->NbrStarts++;
+   *p_err = OS_ERR_NONE;
+}
+#endif
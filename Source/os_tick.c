@@ -24,6 +24,7 @@
 */
 
 #define  MICRIUM_SOURCE
+#define  OS_CRIT_SITE_ID                    OS_CRIT_SITE_TICK
 #include "os.h"
 
 #ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
@@ -37,7 +38,23 @@ const  CPU_CHAR  *os_tick__c = "$Id: $";
 ************************************************************************************************************************
 */
 
-static  void  OS_TickListUpdate (OS_TICK  ticks);
+static  void     OS_TickListUpdate   (OS_TICK  ticks);
+
+static  void     OS_TickListExpire   (OS_TCB  *p_tcb);
+
+#if (OS_CFG_TICK_TASK_EN > 0u)
+static  void         OS_TickListStep       (void);
+
+static  CPU_BOOLEAN  OS_TickListExpireNext (void);
+#endif
+
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+static  void     OS_TickWheelUnlink  (OS_TCB  *p_tcb);
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+static  OS_TICK  OS_TickWheelNextDly (OS_TICK  tick);
+#endif
+#endif
 
 
 /*
@@ -49,7 +66,11 @@ static  void  OS_TickListUpdate (OS_TICK  ticks);
 *
 * Arguments  : p_err          is a pointer to a variable that will contain an error code returned by this function.
 *              -----
-*                                 OS_ERR_NONE           the tick variables were initialized successfully
+*                                 OS_ERR_NONE                   the tick variables were initialized successfully
+*                                 OS_ERR_TICK_STK_INVALID       if you didn't specify a stack for the tick task
+*                                 OS_ERR_TICK_STK_SIZE_INVALID  if you didn't allocate enough space for its stack
+*                                 OS_ERR_TICK_PRIO_INVALID      if you specified the priority of the idle task
+*                                 OS_ERR_xxx                    any error code returned by OSTaskCreate()
 *
 * Returns    : none
 *
@@ -59,20 +80,94 @@ static  void  OS_TickListUpdate (OS_TICK  ticks);
 
 void  OS_TickInit (OS_ERR  *p_err)
 {
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    CPU_DATA  i;
+#endif
+
+
     *p_err                = OS_ERR_NONE;
 
     OSTickCtr             = 0u;                               /* Clear the tick counter                               */
+#if (OS_CFG_TICK_RATE_SET_EN > 0u)
+    OSTickRateHz          = OSCfg_TickRate_Hz;                /* Start at the configured tick rate                    */
+#endif
 
 #if (OS_CFG_DYN_TICK_EN > 0u)
     OSTickCtrStep         = 0u;
 #endif
 
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    OSTickWheelCtr        = 0u;
+
+    for (i = 0u; i < OS_CFG_TICK_WHEEL_SIZE; i++) {             /* Empty every spoke of the tick wheel                  */
+        OSTickWheel[i].TCB_Ptr    = (OS_TCB *)0;
+#if (OS_CFG_DBG_EN > 0u)
+        OSTickWheel[i].NbrEntries = 0u;
+        OSTickWheel[i].NbrUpdated = 0u;
+#endif
+    }
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    for (i = 0u; i < OS_TICK_WHEEL_MAP_SIZE; i++) {
+        OSTickWheelMap[i] = 0u;
+    }
+#endif
+#else
     OSTickList.TCB_Ptr    = (OS_TCB *)0;
 
 #if (OS_CFG_DBG_EN > 0u)
     OSTickList.NbrEntries = 0u;
     OSTickList.NbrUpdated = 0u;
 #endif
+#endif
+
+#if (OS_CFG_TIME_HR_EN > 0u)
+    OSTickHrList.TCB_Ptr    = (OS_TCB *)0;
+#if (OS_CFG_DBG_EN > 0u)
+    OSTickHrList.NbrEntries = 0u;
+    OSTickHrList.NbrUpdated = 0u;
+#endif
+#endif
+
+#if (OS_CFG_TICK_TASK_EN > 0u)
+    OSTickCtrPend         = 0u;
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    OSTickWheelCursor     = (OS_TCB *)0;
+#endif
+                                                                /* ---------------- CREATE THE TICK TASK -------------- */
+    if (OSCfg_TickTaskStkBasePtr == (CPU_STK *)0) {
+       *p_err = OS_ERR_TICK_STK_INVALID;
+        return;
+    }
+
+    if (OSCfg_TickTaskStkSize < OSCfg_StkSizeMin) {
+       *p_err = OS_ERR_TICK_STK_SIZE_INVALID;
+        return;
+    }
+
+    if (OSCfg_TickTaskPrio >= (OS_CFG_PRIO_MAX - 1u)) {
+       *p_err = OS_ERR_TICK_PRIO_INVALID;
+        return;
+    }
+
+    OSTaskCreate(&OSTickTaskTCB,
+#if  (OS_CFG_DBG_EN == 0u)
+                 (CPU_CHAR *)0,
+#else
+                 (CPU_CHAR *)"uC/OS-III Tick Task",
+#endif
+                  OS_TickTask,
+                 (void     *)0,
+                  OSCfg_TickTaskPrio,
+                  OSCfg_TickTaskStkBasePtr,
+                  OSCfg_TickTaskStkLimit,
+                  OSCfg_TickTaskStkSize,
+                  0u,
+                  0u,
+                 (void     *)0,
+                 (OS_OPT_TASK_STK_CHK | (OS_OPT)(OS_OPT_TASK_STK_CLR | OS_OPT_TASK_NO_TLS)),
+                  p_err);
+#endif
 }
 
 /*
@@ -87,19 +182,55 @@ void  OS_TickInit (OS_ERR  *p_err)
 *
 * Returns    : none
 *
-* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) When OS_CFG_TICK_TASK_EN is set to 1, the tick ISR only adds 'ticks' to OSTickCtrPend and readies
+*                 the tick task when it was idle, so its cost does not depend on the number of expiring delays.
+*                 OSTickCtr and the tick list are then advanced by OS_TickTask().
 ************************************************************************************************************************
 */
 
+#if (OS_CFG_TICK_TASK_EN > 0u)
+void  OS_TickUpdate (OS_TICK  ticks)
+{
+    CPU_TS  ts;
+    CPU_SR_ALLOC();
+
+
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();
+#else
+    ts = 0u;
+#endif
+
+    CPU_CRITICAL_ENTER();
+    OSTickCtrPend += ticks;                                     /* Record the ticks for the tick task                   */
+    if (OSTickCtrPend == ticks) {                               /* Wake up the tick task if it had nothing to process   */
+        if (OSTickTaskTCB.PendOn == OS_TASK_PEND_ON_TASK_SEM) {
+            OS_Post((OS_PEND_OBJ *)0,
+                    &OSTickTaskTCB,
+                    (void *)0,
+                    0u,
+                    ts);
+        } else {
+            OSTickTaskTCB.SemCtr++;
+        }
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+#else
 void  OS_TickUpdate (OS_TICK  ticks)
 {
 #if (OS_CFG_TS_EN > 0u)
     CPU_TS  ts_start;
 #endif
     CPU_SR_ALLOC();
+    OS_LOCK_SITE_ALLOC();
 
 
     CPU_CRITICAL_ENTER();
+    OS_LOCK_SITE_BEGIN();
 
     OSTickCtr += ticks;                                         /* Keep track of the number of ticks                    */
 
@@ -117,16 +248,99 @@ void  OS_TickUpdate (OS_TICK  ticks)
 #endif
 
 #if (OS_CFG_DYN_TICK_EN > 0u)
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    OSTickCtrStep = OS_TickWheelNextDly(OSTickWheelCtr);
+#else
     if (OSTickList.TCB_Ptr != (OS_TCB *)0) {
         OSTickCtrStep = OSTickList.TCB_Ptr->TickRemain;
     } else {
         OSTickCtrStep = 0u;
     }
+#endif
 
     OS_DynTickSet(OSTickCtrStep);
 #endif
+    OS_LOCK_SITE_END(OS_LOCK_SITE_TICK_UPDATE);
     CPU_CRITICAL_EXIT();
 }
+#endif
+
+/*
+************************************************************************************************************************
+*                                                      TICK TASK
+*
+* Description: This task is created by OS_TickInit() when OS_CFG_TICK_TASK_EN is set to 1.  It advances OSTickCtr by
+*              the ticks recorded by OS_TickUpdate() and readies the tasks whose delay or pend timeout expired.
+*
+* Arguments  : p_arg      is an argument passed to the task when the task is created (unused).
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Ticks are processed one at a time and interrupts are re-enabled after each expired task, so the
+*                 longest critical section covers a single task however many delays expire on the same tick.
+*
+*              3) OSTickCtr lags the tick interrupt until this task runs.  It should be given a priority higher than
+*                 that of any task that waits with a timeout (see OS_CFG_TICK_TASK_PRIO).
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TICK_TASK_EN > 0u)
+void  OS_TickTask (void  *p_arg)
+{
+    CPU_BOOLEAN  expired;
+    OS_ERR       err;
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS       ts_start;
+#endif
+    CPU_SR_ALLOC();
+    OS_LOCK_SITE_ALLOC();
+
+
+    (void)p_arg;                                                /* Prevent compiler warning                             */
+
+    for (;;) {
+        (void)OSTaskSemPend(0u,                                 /* Wait for the tick ISR                                */
+                            OS_OPT_PEND_BLOCKING,
+                            (CPU_TS *)0,
+                            &err);
+
+        for (;;) {
+            CPU_CRITICAL_ENTER();
+            if (OSTickCtrPend == 0u) {                          /* Stop when all the ticks have been processed          */
+                CPU_CRITICAL_EXIT();
+                break;
+            }
+            OSTickCtrPend--;
+            OSTickCtr++;                                        /* Keep track of the number of ticks                    */
+            OS_TRACE_TICK_INCREMENT(OSTickCtr);
+#if (OS_CFG_TS_EN > 0u)
+            ts_start = OS_TS_GET();
+#endif
+            OS_TickListStep();
+            CPU_CRITICAL_EXIT();
+
+            do {                                                /* Ready the expired tasks one at a time (see Note #2)  */
+                CPU_CRITICAL_ENTER();
+                OS_LOCK_SITE_BEGIN();
+                expired = OS_TickListExpireNext();
+                OS_LOCK_SITE_END(OS_LOCK_SITE_TICK_UPDATE);
+                CPU_CRITICAL_EXIT();
+            } while (expired == OS_TRUE);
+
+#if (OS_CFG_TS_EN > 0u)
+            OSTickTime = OS_TS_GET() - ts_start;
+            if (OSTickTimeMax < OSTickTime) {
+                OSTickTimeMax = OSTickTime;
+            }
+#endif
+        }
+
+        OSSched();                                              /* Run the scheduler once for the whole batch           */
+    }
+}
+#endif
 
 /*
 ************************************************************************************************************************
@@ -151,9 +365,88 @@ void  OS_TickUpdate (OS_TICK  ticks)
 *              2) This function supports both Periodic Tick Mode (PTM) and Dynamic Tick Mode (DTM).
 *
 *              3) PTM should always call this function with elapsed == 0u.
+*
+*              4) With the tick wheel, the task is pushed at the front of spoke 'TickMatch % OS_CFG_TICK_WHEEL_SIZE'
+*                 and the insertion takes constant time regardless of the number of delayed tasks.
+*
+*              5) When OS_CFG_SLACK_EN is enabled, the delay is extended by up to 'p_tcb->TickSlack' ticks if this lets
+*                 the task wake up with a task that is already in the tick list.  With the tick wheel, this is only
+*                 done in DTM since PTM processes every spoke anyway.
 ************************************************************************************************************************
 */
 
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+CPU_BOOLEAN  OS_TickListInsert (OS_TCB   *p_tcb,
+                                OS_TICK   elapsed,
+                                OS_TICK   tick_base,
+                                OS_TICK   time)
+{
+    OS_TCB        *p_tcb2;
+    OS_TICK_LIST  *p_spoke;
+    OS_TICK        delta;
+    CPU_DATA       spoke;
+#if (OS_CFG_SLACK_EN > 0u) && (OS_CFG_DYN_TICK_EN > 0u)
+    OS_TICK        dly;
+#endif
+
+
+    delta = (time + tick_base) - (OSTickCtr + elapsed);         /* How many ticks until our delay expires?              */
+
+    if (delta == 0u) {
+        p_tcb->TickRemain = 0u;
+        return (OS_FALSE);
+    }
+
+    OS_TRACE_TASK_DLY(delta);
+
+#if (OS_CFG_SLACK_EN > 0u) && (OS_CFG_DYN_TICK_EN > 0u)
+    if (p_tcb->TickSlack > 0u) {                                /* Wake up with the first busy spoke within the slack   */
+        dly = OS_TickWheelNextDly(OSTickWheelCtr + elapsed + delta - 1u);
+        if ((dly != 0u) && ((dly - 1u) <= p_tcb->TickSlack)) {
+            delta += dly - 1u;
+        }
+    }
+#endif
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    if ((OSTickCtrStep == 0u) ||                                /* If our entry expires before the programmed step  ... */
+        (delta < (OSTickCtrStep - elapsed))) {
+        if (elapsed != 0u) {
+            OSTickCtr      += elapsed;                          /* ... update OSTickCtr before we set a new tick step.  */
+            OSTickWheelCtr += elapsed;                          /* No spoke is due within the elapsed ticks.            */
+            OS_TRACE_TICK_INCREMENT(OSTickCtr);
+            elapsed         = 0u;
+        }
+
+        OSTickCtrStep       = delta;
+        OS_DynTickSet(OSTickCtrStep);
+    }
+#endif
+
+    p_tcb->TickRemain   = delta;
+    p_tcb->TickMatch    = OSTickWheelCtr + elapsed + delta;     /* Absolute wheel time at which the delay expires       */
+    spoke               = (CPU_DATA)(p_tcb->TickMatch & (OS_CFG_TICK_WHEEL_SIZE - 1u));
+    p_spoke             = &OSTickWheel[spoke];
+
+    p_tcb2              = p_spoke->TCB_Ptr;                     /* Push the TCB at the front of its spoke               */
+    p_tcb->TickPrevPtr  = (OS_TCB *)0;
+    p_tcb->TickNextPtr  = p_tcb2;
+    if (p_tcb2 != (OS_TCB *)0) {
+        p_tcb2->TickPrevPtr = p_tcb;
+    } else {
+#if (OS_CFG_DYN_TICK_EN > 0u)                                   /* Spoke is no longer empty                             */
+        OSTickWheelMap[spoke / (CPU_CFG_DATA_SIZE * 8u)] |= (CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - (spoke % (CPU_CFG_DATA_SIZE * 8u)));
+#endif
+    }
+    p_spoke->TCB_Ptr    = p_tcb;
+#if (OS_CFG_DBG_EN > 0u)
+    p_spoke->NbrEntries++;
+#endif
+
+    return (OS_TRUE);
+}
+
+#else
 CPU_BOOLEAN  OS_TickListInsert (OS_TCB   *p_tcb,
                                 OS_TICK   elapsed,
                                 OS_TICK   tick_base,
@@ -164,6 +457,10 @@ CPU_BOOLEAN  OS_TickListInsert (OS_TCB   *p_tcb,
     OS_TICK_LIST  *p_list;
     OS_TICK        delta;
     OS_TICK        remain;
+    OS_TICK        match;
+#if (OS_CFG_SLACK_EN > 0u)
+    OS_TICK        slack;
+#endif
 
 
     delta = (time + tick_base) - (OSTickCtr + elapsed);         /* How many ticks until our delay expires?              */
@@ -178,6 +475,7 @@ CPU_BOOLEAN  OS_TickListInsert (OS_TCB   *p_tcb,
     p_list = &OSTickList;
     if (p_list->TCB_Ptr == (OS_TCB *)0) {                       /* Is the list empty?                                   */
         p_tcb->TickRemain   = delta;                            /* Yes, Store time in TCB                               */
+        p_tcb->TickMatch    = OSTickCtr + elapsed + delta;      /* Absolute tick at which the delay expires             */
         p_tcb->TickNextPtr  = (OS_TCB *)0;
         p_tcb->TickPrevPtr  = (OS_TCB *)0;
         p_list->TCB_Ptr     = p_tcb;                            /* Point to TCB of task to place in the list            */
@@ -204,10 +502,20 @@ CPU_BOOLEAN  OS_TickListInsert (OS_TCB   *p_tcb,
     p_tcb2 = p_list->TCB_Ptr;
     remain = p_tcb2->TickRemain - elapsed;                      /* How many ticks until the head's delay expires?       */
 
+#if (OS_CFG_SLACK_EN > 0u)
+    slack  = p_tcb->TickSlack;
+    if ((delta          <  remain) &&                           /* Can we wake up together with the current head?       */
+        ((remain - delta) <= slack)) {
+        delta = remain;                                         /* Yes, no need to reprogram the tick in DTM            */
+        slack = 0u;
+    }
+#endif
+
     if ((delta               <   remain) &&                     /* If our entry is the new head of the tick list    ... */
         (p_tcb2->TickPrevPtr == (OS_TCB *)0)) {
         p_tcb->TickRemain    =  delta;                          /* ... the delta is equivalent to the full delay    ... */
         p_tcb2->TickRemain   =  remain - delta;                 /* ... the previous head's delta is now relative to it. */
+        p_tcb->TickMatch     =  OSTickCtr + elapsed + delta;
 
         p_tcb->TickPrevPtr   = (OS_TCB *)0;
         p_tcb->TickNextPtr   =  p_tcb2;
@@ -228,15 +536,28 @@ CPU_BOOLEAN  OS_TickListInsert (OS_TCB   *p_tcb,
 
                                                                 /* Our entry comes after the current list head.         */
     delta  -= remain;                                           /* Make delta relative to the head.                     */
+    match   = p_tcb2->TickMatch;
     p_tcb1  = p_tcb2;
     p_tcb2  = p_tcb1->TickNextPtr;
 
     while ((p_tcb2 !=        (OS_TCB *)0) &&                    /* Find the appropriate position in the delta list.     */
            (delta  >= p_tcb2->TickRemain)) {
         delta  -= p_tcb2->TickRemain;
+        match   = p_tcb2->TickMatch;
+        p_tcb1  = p_tcb2;
+        p_tcb2  = p_tcb2->TickNextPtr;
+    }
+
+#if (OS_CFG_SLACK_EN > 0u)
+    if ((p_tcb2                       != (OS_TCB *)0) &&        /* Can we wake up together with the next entry?         */
+        ((p_tcb2->TickRemain - delta) <=       slack)) {
+        delta   = 0u;
+        match   = p_tcb2->TickMatch;
         p_tcb1  = p_tcb2;
         p_tcb2  = p_tcb2->TickNextPtr;
     }
+#endif
+    p_tcb->TickMatch = match + delta;                           /* Absolute tick at which the delay expires             */
 
     if (p_tcb2 != (OS_TCB *)0) {                                /* Our entry is not the last element in the list.       */
         p_tcb1               = p_tcb2->TickPrevPtr;
@@ -256,6 +577,7 @@ CPU_BOOLEAN  OS_TickListInsert (OS_TCB   *p_tcb,
 
     return (OS_TRUE);
 }
+#endif
 
 /*
 ************************************************************************************************************************
@@ -285,6 +607,7 @@ CPU_BOOLEAN  OS_TickListInsert (OS_TCB   *p_tcb,
 *              -----
 *                                 OS_ERR_NONE           the call was successful and the time delay was scheduled.
 *                                 OS_ERR_TIME_ZERO_DLY  if the effective delay is zero
+*                                 OS_ERR_OPT_INVALID    if 'opt' is OS_OPT_TIME_PERIODIC and OS_CFG_TIME_PERIODIC_EN is 0
 *
 * Returns    : None
 *
@@ -301,8 +624,11 @@ void  OS_TickListInsertDly (OS_TCB   *p_tcb,
 {
     OS_TICK      elapsed;
     OS_TICK      tick_base;
+#if (OS_CFG_TIME_PERIODIC_EN > 0u)
     OS_TICK      base_offset;
+#endif
     CPU_BOOLEAN  valid_dly;
+    OS_LOCK_SITE_ALLOC();
 
 
 #if (OS_CFG_DYN_TICK_EN > 0u)
@@ -314,6 +640,7 @@ void  OS_TickListInsertDly (OS_TCB   *p_tcb,
     if (opt == OS_OPT_TIME_MATCH) {                             /* MATCH to absolute tick ctr value mode                */
         tick_base = 0u;                                         /* tick_base + time == time                             */
 
+#if (OS_CFG_TIME_PERIODIC_EN > 0u)
     } else if (opt == OS_OPT_TIME_PERIODIC) {                   /* PERIODIC mode.                                       */
         if (time == 0u) {
            *p_err = OS_ERR_TIME_ZERO_DLY;                       /* Infinite frequency is invalid.                       */
@@ -338,6 +665,11 @@ void  OS_TickListInsertDly (OS_TCB   *p_tcb,
         }
 
         p_tcb->TickCtrPrev += time;                             /* Update for the next time we perform a periodic dly.  */
+#else
+    } else if (opt == OS_OPT_TIME_PERIODIC) {                   /* PERIODIC mode not included, no '.TickCtrPrev'        */
+       *p_err = OS_ERR_OPT_INVALID;
+        return;
+#endif
 
     } else {                                                    /* RELATIVE time delay mode                             */
 #if (OS_CFG_DYN_TICK_EN > 0u)                                   /* Our base is always the current system time.          */
@@ -347,7 +679,9 @@ void  OS_TickListInsertDly (OS_TCB   *p_tcb,
 #endif
     }
 
+    OS_LOCK_SITE_BEGIN();
     valid_dly = OS_TickListInsert(p_tcb, elapsed, tick_base, time);
+    OS_LOCK_SITE_END(OS_LOCK_SITE_TICK_LIST_INSERT);
 
     if (valid_dly == OS_TRUE) {
         p_tcb->TaskState = OS_TASK_STATE_DLY;
@@ -371,9 +705,26 @@ void  OS_TickListInsertDly (OS_TCB   *p_tcb,
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
 *
 *              2) This function is assumed to be called with interrupts disabled.
+*
+*              3) With the tick wheel in DTM, the tick step is left as is.  At worst the tick interrupt fires once
+*                 without any task expiring and OS_TickUpdate() then programs the next step.
 ************************************************************************************************************************
 */
 
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+void  OS_TickListRemove (OS_TCB  *p_tcb)
+{
+#if (OS_CFG_TIME_HR_EN > 0u)
+    if (p_tcb->TickHrDly != 0u) {                               /* Is the task waiting for a high-resolution timeout?   */
+        OS_TickHrListRemove(p_tcb);
+        return;
+    }
+#endif
+    OS_TickWheelUnlink(p_tcb);
+    p_tcb->TickRemain = 0u;
+}
+
+#else
 void  OS_TickListRemove (OS_TCB  *p_tcb)
 {
     OS_TCB        *p_tcb1;
@@ -383,6 +734,13 @@ void  OS_TickListRemove (OS_TCB  *p_tcb)
     OS_TICK        elapsed;
 #endif
 
+#if (OS_CFG_TIME_HR_EN > 0u)
+    if (p_tcb->TickHrDly != 0u) {                               /* Is the task waiting for a high-resolution timeout?   */
+        OS_TickHrListRemove(p_tcb);
+        return;
+    }
+#endif
+
 #if (OS_CFG_DYN_TICK_EN > 0u)
     elapsed = OS_DynTickGet();
 #endif
@@ -414,7 +772,7 @@ void  OS_TickListRemove (OS_TCB  *p_tcb)
 #endif
 
 #if (OS_CFG_DYN_TICK_EN > 0u)
-            if (p_tcb2->TickRemain != p_tcb->TickRemain) {      /* Only set a new tick if tcb2 had a longer delay.      */
+            if (p_tcb2->TickMatch != p_tcb->TickMatch) {        /* Only set a new tick if tcb2 had a longer delay.      */
                 if (elapsed != 0u) {
                     OSTickCtr          += elapsed;              /* Keep track of time.                                  */
                     OS_TRACE_TICK_INCREMENT(OSTickCtr);
@@ -441,6 +799,129 @@ void  OS_TickListRemove (OS_TCB  *p_tcb)
         p_tcb->TickRemain        =           0u;
     }
 }
+#endif
+
+/*
+************************************************************************************************************************
+*                                          CONVERT A NUMBER OF TICKS TO A NEW TICK RATE
+*
+* Description: This function converts a number of ticks counted at 'rate_hz_prev' into the number of ticks that span
+*              the same time at 'rate_hz'.
+*
+* Arguments  : ticks          is the number of ticks to convert.
+*
+*              rate_hz_prev   is the tick rate 'ticks' is expressed at.
+*
+*              rate_hz        is the tick rate to convert to.
+*
+* Returns    : The converted number of ticks, rounded up so that a delay is never shortened.  A non-zero number of ticks
+*              is never converted to 0.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TICK_RATE_SET_EN > 0u)
+OS_TICK  OS_TickRescale (OS_TICK     ticks,
+                         OS_RATE_HZ  rate_hz_prev,
+                         OS_RATE_HZ  rate_hz)
+{
+    CPU_INT64U  ticks_new;
+
+
+    ticks_new = (((CPU_INT64U)ticks * rate_hz) + (rate_hz_prev - 1u)) / rate_hz_prev;
+    if (ticks_new > (OS_TICK)~(OS_TICK)0u) {                    /* Saturate instead of wrapping around                  */
+        ticks_new = (OS_TICK)~(OS_TICK)0u;
+    }
+    return ((OS_TICK)ticks_new);
+}
+
+
+/*
+************************************************************************************************************************
+*                                           RESCALE THE DELAYS OF THE TICK LIST
+*
+* Description: This function is called by OSTickRateSet() to convert the time left to every task in the tick list from
+*              'rate_hz_prev' to 'rate_hz' ticks.
+*
+* Arguments  : rate_hz_prev   is the tick rate the tick list is currently expressed at.
+*
+*              rate_hz        is the new tick rate.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled.
+*
+*              3) Every task with time left is taken out of the tick list and inserted again with its converted delay,
+*                 so the cost is that of one OS_TickListInsert() per delayed task.  Tasks that already expired but
+*                 have not been readied by the tick task yet are left in place.
+*
+*              4) The periodic tick base of a task delayed with OS_OPT_TIME_PERIODIC is moved to its new wake-up tick.
+*                 The period the task passes on its next call is used as is.
+************************************************************************************************************************
+*/
+
+void  OS_TickListRescale (OS_RATE_HZ  rate_hz_prev,
+                          OS_RATE_HZ  rate_hz)
+{
+    OS_TCB        *p_tcb;
+    OS_TCB        *p_tcb_next;
+    OS_TCB        *p_tcb_list;
+    OS_TICK        remain;
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    CPU_DATA       spoke;
+#endif
+
+
+    p_tcb_list = (OS_TCB *)0;                                   /* Collect the tasks with time left                     */
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    for (spoke = 0u; spoke < OS_CFG_TICK_WHEEL_SIZE; spoke++) {
+        p_tcb = OSTickWheel[spoke].TCB_Ptr;
+        while (p_tcb != (OS_TCB *)0) {
+            p_tcb_next = p_tcb->TickNextPtr;
+            remain     = p_tcb->TickMatch - OSTickWheelCtr;
+            if ((remain     != 0u) &&                           /* Skip the tasks due on the tick being processed       */
+                ((remain - 1u) < ((OS_TICK)~(OS_TICK)0u / 2u))) {
+                OS_TickListRemove(p_tcb);
+                p_tcb->TickRemain  = remain;
+                p_tcb->TickNextPtr = p_tcb_list;
+                p_tcb_list         = p_tcb;
+            }
+            p_tcb = p_tcb_next;
+        }
+    }
+#else
+    p_tcb = OSTickList.TCB_Ptr;
+    while (p_tcb != (OS_TCB *)0) {
+        p_tcb_next = p_tcb->TickNextPtr;
+        remain     = p_tcb->TickRemain;                         /* Removing a task adds its delta to the next one       */
+        if (remain == 0u) {                                     /* Skip the tasks waiting for the tick task             */
+            p_tcb  = p_tcb_next;
+            continue;
+        }
+        OS_TickListRemove(p_tcb);
+        p_tcb->TickRemain  = remain;
+        p_tcb->TickNextPtr = p_tcb_list;
+        p_tcb_list         = p_tcb;
+        p_tcb              = p_tcb_next;
+    }
+#endif
+
+    while (p_tcb_list != (OS_TCB *)0) {                         /* Insert them again with their converted delay         */
+        p_tcb      = p_tcb_list;
+        p_tcb_list = p_tcb->TickNextPtr;
+        remain     = p_tcb->TickRemain;
+#if (OS_CFG_TIME_PERIODIC_EN > 0u)
+        if (p_tcb->TickCtrPrev == (OSTickCtr + remain)) {       /* Move the periodic tick base along (see Note #4)      */
+            p_tcb->TickCtrPrev = OSTickCtr + OS_TickRescale(remain, rate_hz_prev, rate_hz);
+        }
+#endif
+        (void)OS_TickListInsert(p_tcb, 0u, OSTickCtr, OS_TickRescale(remain, rate_hz_prev, rate_hz));
+    }
+}
+#endif
 
 /*
 ************************************************************************************************************************
@@ -453,19 +934,63 @@ void  OS_TickListRemove (OS_TCB  *p_tcb)
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) With the tick wheel, only the spokes for the elapsed ticks are visited.  A spoke holds the tasks
+*                 expiring on that tick plus the ones that are one or more turns of the wheel away, so the work done
+*                 is proportional to the number of expiring tasks as long as OS_CFG_TICK_WHEEL_SIZE covers the usual
+*                 delays.
 ************************************************************************************************************************
 */
 
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
 static  void  OS_TickListUpdate (OS_TICK  ticks)
 {
     OS_TCB        *p_tcb;
-    OS_TICK_LIST  *p_list;
+    OS_TCB        *p_tcb_next;
+    OS_TICK_LIST  *p_spoke;
+    OS_TICK        tick_first;
+    OS_TICK        nbr_spokes;
 #if (OS_CFG_DBG_EN > 0u)
     OS_OBJ_QTY     nbr_updated;
 #endif
-#if (OS_CFG_MUTEX_EN > 0u)
-    OS_TCB        *p_tcb_owner;
-    OS_PRIO        prio_new;
+
+
+    tick_first      = OSTickWheelCtr + 1u;                      /* First tick that has not been processed yet           */
+    OSTickWheelCtr += ticks;
+    nbr_spokes      = (ticks < OS_CFG_TICK_WHEEL_SIZE) ? ticks : OS_CFG_TICK_WHEEL_SIZE;
+
+    while (nbr_spokes > 0u) {
+        nbr_spokes--;
+        p_spoke = &OSTickWheel[(tick_first + nbr_spokes) & (OS_CFG_TICK_WHEEL_SIZE - 1u)];
+        p_tcb   = p_spoke->TCB_Ptr;
+#if (OS_CFG_DBG_EN > 0u)
+        nbr_updated = 0u;
+#endif
+        while (p_tcb != (OS_TCB *)0) {
+            p_tcb_next = p_tcb->TickNextPtr;
+            if ((OS_TICK)(p_tcb->TickMatch - tick_first) < ticks) { /* Did the delay expire within the elapsed ticks?   */
+#if (OS_CFG_DBG_EN > 0u)
+                nbr_updated++;
+#endif
+                OS_TickWheelUnlink(p_tcb);
+                p_tcb->TickRemain = 0u;
+                OS_TickListExpire(p_tcb);
+            }
+            p_tcb = p_tcb_next;
+        }
+#if (OS_CFG_DBG_EN > 0u)
+        p_spoke->NbrUpdated = nbr_updated;
+#endif
+    }
+}
+
+#else
+static  void  OS_TickListUpdate (OS_TICK  ticks)
+{
+    OS_TCB        *p_tcb;
+    OS_TICK_LIST  *p_list;
+#if (OS_CFG_DBG_EN > 0u)
+    OS_OBJ_QTY     nbr_updated;
 #endif
 
 
@@ -488,90 +1013,617 @@ static  void  OS_TickListUpdate (OS_TICK  ticks)
             nbr_updated++;
 #endif
 
-            switch (p_tcb->TaskState) {
-                case OS_TASK_STATE_DLY:
-                     p_tcb->TaskState = OS_TASK_STATE_RDY;
-                     OS_RdyListInsert(p_tcb);                            /* Insert the task in the ready list                    */
-                     break;
+            OS_TickListExpire(p_tcb);
 
-                case OS_TASK_STATE_DLY_SUSPENDED:
-                     p_tcb->TaskState = OS_TASK_STATE_SUSPENDED;
-                     break;
-
-                default:
-#if (OS_CFG_MUTEX_EN > 0u)
-                     p_tcb_owner = (OS_TCB *)0;
-                     if (p_tcb->PendOn == OS_TASK_PEND_ON_MUTEX) {
-                         p_tcb_owner = (OS_TCB *)((OS_MUTEX *)((void *)p_tcb->PendObjPtr))->OwnerTCBPtr;
-                     }
+            p_list->TCB_Ptr = p_tcb->TickNextPtr;
+            p_tcb           = p_list->TCB_Ptr;                           /* Get 'p_tcb' again for loop                           */
+            if (p_tcb == (OS_TCB *)0) {
+#if (OS_CFG_DBG_EN > 0u)
+                p_list->NbrEntries = 0u;
+#endif
+                break;
+            } else {
+#if (OS_CFG_DBG_EN > 0u)
+                p_list->NbrEntries--;
+#endif
+                p_tcb->TickPrevPtr = (OS_TCB *)0;
+                if (p_tcb->TickRemain <= ticks) {
+                    ticks              = ticks - p_tcb->TickRemain;
+                    p_tcb->TickRemain  = 0u;
+                } else {
+                    p_tcb->TickRemain -= ticks;
+                }
+            }
+        }
+    }
+#if (OS_CFG_DBG_EN > 0u)
+    p_list->NbrUpdated = nbr_updated;
+#endif
+}
 #endif
 
-#if (OS_MSG_EN > 0u)
-                     p_tcb->MsgPtr  = (void *)0;
-                     p_tcb->MsgSize = 0u;
+/*
+************************************************************************************************************************
+*                                       ADVANCE THE LIST OF DELAYED TASKS BY ONE TICK
+*
+* Description: These functions are used by the tick task to process the list of tasks delayed or pending with timeout
+*              one tick at a time.  OS_TickListStep() moves the list to the next tick and OS_TickListExpireNext() then
+*              readies one task whose delay expired on that tick.
+*
+* Arguments  : none
+*
+* Returns    : OS_TickListExpireNext() returns OS_TRUE if a task was readied, OS_FALSE when no expired task is left.
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application MUST NOT call them.
+*
+*              2) They are called with interrupts disabled.  Interrupts are enabled between two calls, so an ISR may
+*                 remove a task from the list in between.  With the tick wheel, OSTickWheelCursor holds the next task
+*                 of the spoke to look at and OS_TickWheelUnlink() moves it past a task being removed.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TICK_TASK_EN > 0u)
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+static  void  OS_TickListStep (void)
+{
+    OS_TICK_LIST  *p_spoke;
+
+
+    OSTickWheelCtr++;
+    p_spoke           = &OSTickWheel[OSTickWheelCtr & (OS_CFG_TICK_WHEEL_SIZE - 1u)];
+    OSTickWheelCursor =  p_spoke->TCB_Ptr;
+#if (OS_CFG_DBG_EN > 0u)
+    p_spoke->NbrUpdated = 0u;
+#endif
+}
+
+
+static  CPU_BOOLEAN  OS_TickListExpireNext (void)
+{
+    OS_TCB  *p_tcb;
+
+
+    while (OSTickWheelCursor != (OS_TCB *)0) {
+        p_tcb             = OSTickWheelCursor;
+        OSTickWheelCursor = p_tcb->TickNextPtr;
+        if (p_tcb->TickMatch == OSTickWheelCtr) {               /* Did the delay expire on this tick?                   */
+            OS_TickWheelUnlink(p_tcb);
+#if (OS_CFG_DBG_EN > 0u)
+            OSTickWheel[OSTickWheelCtr & (OS_CFG_TICK_WHEEL_SIZE - 1u)].NbrUpdated++;
+#endif
+            p_tcb->TickRemain = 0u;
+            OS_TickListExpire(p_tcb);
+            return (OS_TRUE);
+        }
+    }                                                           /* The others wait for a later turn of the wheel        */
+    return (OS_FALSE);
+}
+
+#else
+static  void  OS_TickListStep (void)
+{
+    OS_TCB  *p_tcb;
+
+
+    p_tcb = OSTickList.TCB_Ptr;
+    if ((p_tcb             != (OS_TCB *)0) &&
+        (p_tcb->TickRemain >           0u)) {
+        p_tcb->TickRemain--;
+    }
+#if (OS_CFG_DBG_EN > 0u)
+    OSTickList.NbrUpdated = 0u;
+#endif
+}
+
+
+static  CPU_BOOLEAN  OS_TickListExpireNext (void)
+{
+    OS_TCB        *p_tcb;
+    OS_TICK_LIST  *p_list;
+
+
+    p_list = &OSTickList;
+    p_tcb  =  p_list->TCB_Ptr;
+    if ((p_tcb             == (OS_TCB *)0) ||                   /* Is the task at the head of the list due?             */
+        (p_tcb->TickRemain !=           0u)) {
+        return (OS_FALSE);
+    }
+
+    p_list->TCB_Ptr = p_tcb->TickNextPtr;                       /* Yes, unlink it                                       */
+    if (p_list->TCB_Ptr != (OS_TCB *)0) {
+        p_list->TCB_Ptr->TickPrevPtr = (OS_TCB *)0;
+    }
+    p_tcb->TickNextPtr = (OS_TCB *)0;
+#if (OS_CFG_DBG_EN > 0u)
+    p_list->NbrEntries--;
+    p_list->NbrUpdated++;
+#endif
+
+    OS_TickListExpire(p_tcb);
+    return (OS_TRUE);
+}
+#endif
+#endif
+
+/*
+************************************************************************************************************************
+*                                          READY A TASK WHOSE DELAY HAS EXPIRED
+*
+* Description: This function makes a task ready (or suspended only) once its delay or pend timeout has expired.
+*
+* Arguments  : p_tcb          is a pointer to the OS_TCB of the task which timed out.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The caller is responsible for taking the task out of the tick list.
+************************************************************************************************************************
+*/
+
+static  void  OS_TickListExpire (OS_TCB  *p_tcb)
+{
+#if (OS_CFG_MUTEX_EN > 0u)
+    OS_TCB     *p_tcb_owner;
+    OS_PRIO     prio_new;
+#endif
+#if (OS_CFG_RWLOCK_EN > 0u)
+    OS_RWLOCK  *p_rwlock;
+#endif
+
+
+    switch (p_tcb->TaskState) {
+        case OS_TASK_STATE_DLY:
+             p_tcb->TaskState = OS_TASK_STATE_RDY;
+             OS_RdyListInsert(p_tcb);                                    /* Insert the task in the ready list                    */
+             break;
+
+        case OS_TASK_STATE_DLY_SUSPENDED:
+             p_tcb->TaskState = OS_TASK_STATE_SUSPENDED;
+             break;
+
+        default:
+#if (OS_CFG_MUTEX_EN > 0u)
+             p_tcb_owner = (OS_TCB *)0;
+             if (p_tcb->PendOn == OS_TASK_PEND_ON_MUTEX) {
+                 p_tcb_owner = (OS_TCB *)((OS_MUTEX *)((void *)p_tcb->PendObjPtr))->OwnerTCBPtr;
+             }
+#endif
+#if (OS_CFG_RWLOCK_EN > 0u)
+             p_rwlock = (OS_RWLOCK *)0;
+             if ((p_tcb->PendOn == OS_TASK_PEND_ON_RWLOCK_RD) ||
+                 (p_tcb->PendOn == OS_TASK_PEND_ON_RWLOCK_WR)) {
+                 p_rwlock = (OS_RWLOCK *)((void *)p_tcb->PendObjPtr);
+             }
+#endif
+
+#if (OS_TCB_MSG_EN > 0u)
+             p_tcb->MsgPtr  = (void *)0;
+             p_tcb->MsgSize = 0u;
 #endif
 #if (OS_CFG_TS_EN > 0u)
-                     p_tcb->TS      = OS_TS_GET();
+             p_tcb->TS      = OS_TS_GET();
 #endif
-                     OS_PendListRemove(p_tcb);                           /* Remove task from pend list                           */
+#if (OS_CFG_OBJ_STAT_EN > 0u)
+             if (OS_PEND_OBJ_HAS_LIST(p_tcb) == OS_TRUE) {
+                 p_tcb->PendObjPtr->PendList.Stat.PendTimeoutCtr++;
+             }
+#endif
+             OS_PendListRemove(p_tcb);                                   /* Remove task from pend list                           */
 
-                     switch (p_tcb->TaskState) {
-                         case OS_TASK_STATE_PEND_TIMEOUT:
-                              OS_RdyListInsert(p_tcb);                   /* Insert the task in the ready list                    */
-                              p_tcb->TaskState  = OS_TASK_STATE_RDY;
-                              break;
+             switch (p_tcb->TaskState) {
+                 case OS_TASK_STATE_PEND_TIMEOUT:
+                      OS_RdyListInsert(p_tcb);                           /* Insert the task in the ready list                    */
+                      p_tcb->TaskState  = OS_TASK_STATE_RDY;
+                      break;
 
-                         case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
-                              p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED;
-                              break;
+                 case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
+                      p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED;
+                      break;
 
-                         default:
-                              break;
-                     }
-                     p_tcb->PendStatus = OS_STATUS_PEND_TIMEOUT;         /* Indicate pend timed out                              */
-                     p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;        /* Indicate no longer pending                           */
+                 default:
+                      break;
+             }
+             p_tcb->PendStatus = OS_STATUS_PEND_TIMEOUT;                 /* Indicate pend timed out                              */
+             p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;                /* Indicate no longer pending                           */
 
 #if (OS_CFG_MUTEX_EN > 0u)
-                     if (p_tcb_owner != (OS_TCB *)0) {
-                         if ((p_tcb_owner->Prio != p_tcb_owner->BasePrio) &&
-                             (p_tcb_owner->Prio == p_tcb->Prio)) {       /* Has the owner inherited a priority?                  */
-                             prio_new = OS_MutexGrpPrioFindHighest(p_tcb_owner);
-                             prio_new = (prio_new > p_tcb_owner->BasePrio) ? p_tcb_owner->BasePrio : prio_new;
-                             if (prio_new != p_tcb_owner->Prio) {
-                                 OS_TaskChangePrio(p_tcb_owner, prio_new);
-                                 OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb_owner, p_tcb_owner->Prio);
-                             }
-                         }
+             if (p_tcb_owner != (OS_TCB *)0) {
+                 if ((p_tcb_owner->Prio != p_tcb_owner->BasePrio) &&
+                     (p_tcb_owner->Prio == p_tcb->Prio)) {               /* Has the owner inherited a priority?                  */
+                     prio_new = OS_MutexGrpPrioFindHighest(p_tcb_owner);
+                     prio_new = (prio_new > p_tcb_owner->BasePrio) ? p_tcb_owner->BasePrio : prio_new;
+                     if (prio_new != p_tcb_owner->Prio) {
+                         OS_TaskChangePrio(p_tcb_owner, prio_new);
+                         OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb_owner, p_tcb_owner->Prio);
                      }
+                 }
+             }
 #endif
-                     break;
-            }
+#if (OS_CFG_RWLOCK_EN > 0u)
+             if (p_rwlock != (OS_RWLOCK *)0) {
+                 OS_RwLockPrioUpdate(p_rwlock);                          /* The owners may lose the priority of the task         */
+             }
+#endif
+             break;
+    }
+}
 
-            p_list->TCB_Ptr = p_tcb->TickNextPtr;
-            p_tcb           = p_list->TCB_Ptr;                           /* Get 'p_tcb' again for loop                           */
-            if (p_tcb == (OS_TCB *)0) {
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+/*
+************************************************************************************************************************
+*                                          UNLINK A TASK FROM ITS TICK WHEEL SPOKE
+*
+* Description: This function removes a task from the spoke of the tick wheel it was placed in.
+*
+* Arguments  : p_tcb          is a pointer to the OS_TCB to unlink.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_TickWheelUnlink (OS_TCB  *p_tcb)
+{
+    OS_TCB        *p_tcb1;
+    OS_TCB        *p_tcb2;
+    OS_TICK_LIST  *p_spoke;
+    CPU_DATA       spoke;
+
+
+    spoke   = (CPU_DATA)(p_tcb->TickMatch & (OS_CFG_TICK_WHEEL_SIZE - 1u));
+    p_spoke = &OSTickWheel[spoke];
+    p_tcb1  = p_tcb->TickPrevPtr;
+    p_tcb2  = p_tcb->TickNextPtr;
+
+    if (p_tcb1 == (OS_TCB *)0) {
+        p_spoke->TCB_Ptr    = p_tcb2;
+#if (OS_CFG_DYN_TICK_EN > 0u)
+        if (p_tcb2 == (OS_TCB *)0) {                            /* Spoke is now empty                                   */
+            OSTickWheelMap[spoke / (CPU_CFG_DATA_SIZE * 8u)] &= ~((CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - (spoke % (CPU_CFG_DATA_SIZE * 8u))));
+        }
+#endif
+    } else {
+        p_tcb1->TickNextPtr = p_tcb2;
+    }
+    if (p_tcb2 != (OS_TCB *)0) {
+        p_tcb2->TickPrevPtr = p_tcb1;
+    }
+#if (OS_CFG_TICK_TASK_EN > 0u)
+    if (OSTickWheelCursor == p_tcb) {                           /* Don't leave the tick task on a removed task          */
+        OSTickWheelCursor = p_tcb2;
+    }
+#endif
+    p_tcb->TickPrevPtr = (OS_TCB *)0;
+    p_tcb->TickNextPtr = (OS_TCB *)0;
 #if (OS_CFG_DBG_EN > 0u)
-                p_list->NbrEntries = 0u;
+    p_spoke->NbrEntries--;
 #endif
-                break;
-            } else {
+}
+
+
+/*
+************************************************************************************************************************
+*                                           FIND THE NEXT NON-EMPTY TICK WHEEL SPOKE
+*
+* Description: This function returns the number of ticks from 'tick' until the tick wheel reaches a spoke holding at
+*              least one task.  It is used in DTM to program the next tick step.
+*
+* Arguments  : tick        is the value of OSTickWheelCtr from which the distance is measured.
+*
+* Returns    : The number of ticks (1 to OS_CFG_TICK_WHEEL_SIZE) to the next non-empty spoke, or 0 if the tick wheel is
+*              empty.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) A spoke may only hold tasks for a later turn of the wheel, in which case the tick interrupt fires
+*                 without readying anything.  The tick step is therefore never longer than OS_CFG_TICK_WHEEL_SIZE.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+static  OS_TICK  OS_TickWheelNextDly (OS_TICK  tick)
+{
+    CPU_DATA  spoke_first;
+    CPU_DATA  spoke;
+    CPU_DATA  ix;
+    CPU_DATA  map;
+    CPU_DATA  i;
+
+
+    spoke_first = (CPU_DATA)((tick + 1u) & (OS_CFG_TICK_WHEEL_SIZE - 1u));
+    ix          = spoke_first / (CPU_CFG_DATA_SIZE * 8u);
+    map         = OSTickWheelMap[ix] & ((CPU_DATA)~(CPU_DATA)0u >> (spoke_first % (CPU_CFG_DATA_SIZE * 8u)));
+
+    for (i = 0u; i <= OS_TICK_WHEEL_MAP_SIZE; i++) {            /* Last pass wraps around to the start of the first word*/
+        if (map != 0u) {
+            spoke = (ix * (CPU_CFG_DATA_SIZE * 8u)) + (CPU_DATA)CPU_CntLeadZeros(map);
+            return ((OS_TICK)((spoke - spoke_first) & (OS_CFG_TICK_WHEEL_SIZE - 1u)) + 1u);
+        }
+        ix++;
+        if (ix >= OS_TICK_WHEEL_MAP_SIZE) {
+            ix = 0u;
+        }
+        map = OSTickWheelMap[ix];
+    }
+
+    return (0u);                                                /* Tick wheel is empty                                  */
+}
+#endif
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                      INSERT A TASK IN THE HIGH-RESOLUTION TIMEOUT LIST
+*
+* Description: This function places a task in the list of tasks waiting for a timeout expressed in OS_TS_GET() units.
+*              The list is sorted by deadline and the BSP is asked to interrupt at the earliest one.
+*
+* Arguments  : p_tcb       is a pointer to the TCB to insert.  'p_tcb->TickHrDly' contains the timeout, which must be
+*                          between 1 and OS_TICK_HR_DLY_MAX.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) This function must be called with interrupts disabled.
+*
+*              3) Tasks with the same deadline are kept in FIFO order.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TIME_HR_EN > 0u)
+void  OS_TickHrListInsert (OS_TCB  *p_tcb)
+{
+    OS_TCB        *p_tcb1;
+    OS_TCB        *p_tcb2;
+    OS_TICK_LIST  *p_list;
+    CPU_TS         match;
+
+
+    match              = OS_TS_GET() + p_tcb->TickHrDly;        /* Absolute time at which the timeout expires           */
+    p_tcb->TickHrMatch = match;
+
+    p_list = &OSTickHrList;
+    p_tcb1 = (OS_TCB *)0;
+    p_tcb2 = p_list->TCB_Ptr;
+    while ((p_tcb2 != (OS_TCB *)0) &&                           /* Skip the entries expiring no later than ours         */
+           ((CPU_TS)(match - p_tcb2->TickHrMatch) <= OS_TICK_HR_DLY_MAX)) {
+        p_tcb1 = p_tcb2;
+        p_tcb2 = p_tcb2->TickNextPtr;
+    }
+
+    p_tcb->TickPrevPtr = p_tcb1;
+    p_tcb->TickNextPtr = p_tcb2;
+    if (p_tcb2 != (OS_TCB *)0) {
+        p_tcb2->TickPrevPtr = p_tcb;
+    }
 #if (OS_CFG_DBG_EN > 0u)
-                p_list->NbrEntries--;
+    p_list->NbrEntries++;
 #endif
-                p_tcb->TickPrevPtr = (OS_TCB *)0;
-                if (p_tcb->TickRemain <= ticks) {
-                    ticks              = ticks - p_tcb->TickRemain;
-                    p_tcb->TickRemain  = 0u;
-                } else {
-                    p_tcb->TickRemain -= ticks;
-                }
-            }
+
+    if (p_tcb1 == (OS_TCB *)0) {                                /* A new earliest deadline must be programmed           */
+        p_list->TCB_Ptr = p_tcb;
+        OS_TickHrSetNext();
+    } else {
+        p_tcb1->TickNextPtr = p_tcb;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                     REMOVE A TASK FROM THE HIGH-RESOLUTION TIMEOUT LIST
+*
+* Description: This function takes a task out of the high-resolution timeout list, e.g. because it was posted to.
+*
+* Arguments  : p_tcb       is a pointer to the TCB to remove.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) The BSP timer is not reprogrammed when the earliest deadline is removed.  The resulting early
+*                 interrupt finds nothing to expire and programs the next deadline.
+************************************************************************************************************************
+*/
+
+void  OS_TickHrListRemove (OS_TCB  *p_tcb)
+{
+    OS_TCB  *p_tcb1;
+    OS_TCB  *p_tcb2;
+
+
+    p_tcb1 = p_tcb->TickPrevPtr;
+    p_tcb2 = p_tcb->TickNextPtr;
+    if (p_tcb1 == (OS_TCB *)0) {
+        OSTickHrList.TCB_Ptr = p_tcb2;
+    } else {
+        p_tcb1->TickNextPtr  = p_tcb2;
+    }
+    if (p_tcb2 != (OS_TCB *)0) {
+        p_tcb2->TickPrevPtr  = p_tcb1;
+    }
+#if (OS_CFG_DBG_EN > 0u)
+    OSTickHrList.NbrEntries--;
+#endif
+    p_tcb->TickPrevPtr = (OS_TCB *)0;
+    p_tcb->TickNextPtr = (OS_TCB *)0;
+    p_tcb->TickHrDly   =           0u;                          /* Any further timeout is in ticks again                */
+}
+
+
+/*
+************************************************************************************************************************
+*                                        CONVERT MICROSECONDS TO TIMESTAMP COUNTS
+*
+* Description: This function converts a duration in microseconds to OS_TS_GET() units, rounding up so that a timeout
+*              never expires early.
+*
+* Arguments  : us          is the duration in microseconds.
+*
+* Returns    : The number of timestamp counts, 0 if 'us' is 0 or the timestamp frequency is unknown, or a value larger
+*              than OS_TICK_HR_DLY_MAX if the duration is too long to be represented.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+CPU_TS  OS_TickHrUsToTS (CPU_INT32U  us)
+{
+    CPU_TS_TMR_FREQ  freq;
+    CPU_INT64U       cnts;
+    CPU_ERR          err;
+
+
+    freq = CPU_TS_TmrFreqGet(&err);
+    if (err != CPU_ERR_NONE) {
+        return (0u);
+    }
+
+    cnts = (((CPU_INT64U)us * (CPU_INT64U)freq) + 999999u) / 1000000u;
+    if (cnts > (CPU_INT64U)OS_TICK_HR_DLY_MAX) {
+        return ((CPU_TS)OS_TICK_HR_DLY_MAX + 1u);
+    }
+
+    return ((CPU_TS)cnts);
+}
+
+
+/*
+************************************************************************************************************************
+*                                       PROGRAM THE NEXT HIGH-RESOLUTION DEADLINE
+*
+* Description: OS_TickHrNextGet() finds the earliest of the first timeout of the high-resolution timeout list, the
+*              first ISR timer (OS_CFG_TMR_ISR_EN) and, with OS_CFG_SCHED_ROUND_ROBIN_TS_EN, the end of the current time
+*              slice.  OS_TickHrSetNext() programs the BSP timer for it through OS_TickHrSet().
+*
+* Arguments  : p_match     is a pointer to where OS_TickHrNextGet() stores the OS_TS_GET() value of the deadline.
+*              -------
+*
+* Returns    : OS_TickHrNextGet() returns OS_TRUE if there is a deadline, OS_FALSE otherwise.
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application should not call them.
+*
+*              2) These functions must be called with interrupts disabled.
+*
+*              3) A time slice that is already over (the scheduler was locked when it ended) is left to the tick, so
+*                 that the timer doesn't fire continuously until the scheduler is unlocked.
+************************************************************************************************************************
+*/
+
+CPU_BOOLEAN  OS_TickHrNextGet (CPU_TS  *p_match)
+{
+    OS_TCB       *p_tcb;
+#if (OS_CFG_TMR_EN > 0u) && (OS_CFG_TMR_ISR_EN > 0u)
+    OS_TMR       *p_tmr;
+#endif
+    CPU_TS        match;
+    CPU_BOOLEAN   valid;
+
+
+    match = 0u;
+    valid = OS_FALSE;
+    p_tcb = OSTickHrList.TCB_Ptr;
+    if (p_tcb != (OS_TCB *)0) {                                 /* First high-resolution timeout                        */
+        match = p_tcb->TickHrMatch;
+        valid = OS_TRUE;
+    }
+
+#if (OS_CFG_TMR_EN > 0u) && (OS_CFG_TMR_ISR_EN > 0u)
+    p_tmr = OSTmrIsrListPtr;
+    if (p_tmr != (OS_TMR *)0) {                                 /* First ISR timer, when it expires earlier             */
+        if ((valid == OS_FALSE) ||
+            ((CPU_TS)(p_tmr->TsMatch - match) > OS_TICK_HR_DLY_MAX)) {
+            match = p_tmr->TsMatch;
+            valid = OS_TRUE;
         }
     }
+#endif
+
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u) && (OS_CFG_SCHED_ROUND_ROBIN_TS_EN > 0u)
+    if ((OSSchedRoundRobinSliceArmed == OS_TRUE) &&             /* End of the time slice, when still ahead (Note #3)    */
+        ((CPU_TS)(OS_TS_GET() - OSSchedRoundRobinSliceEnd) > OS_TICK_HR_DLY_MAX)) {
+        if ((valid == OS_FALSE) ||
+            ((CPU_TS)(OSSchedRoundRobinSliceEnd - match) > OS_TICK_HR_DLY_MAX)) {
+            match = OSSchedRoundRobinSliceEnd;
+            valid = OS_TRUE;
+        }
+    }
+#endif
+
+   *p_match = match;
+    return (valid);
+}
+
+
+void  OS_TickHrSetNext (void)
+{
+    CPU_TS  match;
+
+
+    if (OS_TickHrNextGet(&match) == OS_TRUE) {
+        OS_TickHrSet(match);
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                      EXPIRE THE HIGH-RESOLUTION TIMEOUTS THAT ARE DUE
+*
+* Description: This function readies every task of the high-resolution timeout list whose deadline has passed and
+*              programs the BSP timer for the next deadline.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.  It is called by
+*                 OSTimeTickHr().
+************************************************************************************************************************
+*/
+
+void  OS_TickHrUpdate (void)
+{
+    OS_TCB      *p_tcb;
+    CPU_TS       ts;
 #if (OS_CFG_DBG_EN > 0u)
-    p_list->NbrUpdated = nbr_updated;
+    OS_OBJ_QTY   nbr_updated;
+#endif
+    CPU_SR_ALLOC();
+    OS_LOCK_SITE_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    OS_LOCK_SITE_BEGIN();
+
+#if (OS_CFG_DBG_EN > 0u)
+    nbr_updated = 0u;
 #endif
+    ts    = OS_TS_GET();
+    p_tcb = OSTickHrList.TCB_Ptr;
+    while ((p_tcb != (OS_TCB *)0) &&                            /* Expire the entries whose deadline has passed         */
+           ((CPU_TS)(ts - p_tcb->TickHrMatch) <= OS_TICK_HR_DLY_MAX)) {
+#if (OS_CFG_DBG_EN > 0u)
+        nbr_updated++;
+#endif
+        OS_TickHrListRemove(p_tcb);
+        OS_TickListExpire(p_tcb);
+        p_tcb = OSTickHrList.TCB_Ptr;
+    }
+#if (OS_CFG_DBG_EN > 0u)
+    OSTickHrList.NbrUpdated = nbr_updated;
+#endif
+
+    OS_TickHrSetNext();                                         /* Interrupt again at the next deadline                 */
+
+    OS_LOCK_SITE_END(OS_LOCK_SITE_TICK_UPDATE);
+    CPU_CRITICAL_EXIT();
 }
+#endif
 
 #endif                                                                   /* #if OS_CFG_TICK_EN                                   */
 
@@ -24,6 +24,7 @@
 */
 
 #define  MICRIUM_SOURCE
+#define  OS_CRIT_SITE_ID                    OS_CRIT_SITE_TIME
 #include "os.h"
 
 #ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
@@ -308,7 +309,7 @@ void  OSTimeDlyHMSM (CPU_INT16U   hours,
 
                                                                 /* Compute the total number of clock ticks required..   */
                                                                 /* .. (rounded to the nearest tick)                     */
-    tick_rate = OSCfg_TickRate_Hz;
+    tick_rate = OS_TICK_RATE_HZ;
     ticks     = ((((OS_TICK)hours * (OS_TICK)3600u) + ((OS_TICK)minutes * (OS_TICK)60u) + (OS_TICK)seconds) * tick_rate)
               + ((tick_rate * ((OS_TICK)milli + ((OS_TICK)500u / tick_rate))) / (OS_TICK)1000u);
 
@@ -433,6 +434,181 @@ void  OSTimeDlyResume (OS_TCB  *p_tcb,
 }
 #endif
 
+/*
+************************************************************************************************************************
+*                                           DELAY TASK FOR A NUMBER OF MICROSECONDS
+*
+* Description: This function is called to delay execution of the currently running task for a duration that is not
+*              limited to the resolution of the tick.  The delay is measured with OS_TS_GET() and the BSP interrupts
+*              at the deadline through OS_TickHrSet().
+*
+* Arguments  : us        is the delay in microseconds.  It is rounded up to the next timestamp count.
+*
+*              p_err     is a pointer to a variable that will contain an error code from this call.
+*
+*                            OS_ERR_NONE                        The call was successful and the delay occurred
+*                            OS_ERR_OS_NOT_RUNNING              If uC/OS-III is not running yet
+*                            OS_ERR_SCHED_LOCKED                Can't delay when the scheduler is locked
+*                            OS_ERR_TIME_DLY_ISR                If you called this function from an ISR
+*                            OS_ERR_TIME_INVALID_MICROSECONDS   If 'us' does not fit in OS_TICK_HR_DLY_MAX timestamp
+*                                                               counts or the timestamp frequency is unknown
+*                            OS_ERR_TIME_ZERO_DLY               If 'us' is 0
+*
+* Returns    : none
+*
+* Note(s)    : 1) The delay can be resumed with OSTimeDlyResume() like any other delay.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TIME_HR_EN > 0u)
+void  OSTimeDlyUs (CPU_INT32U   us,
+                   OS_ERR      *p_err)
+{
+    CPU_TS  dly;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_TIME_DLY_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+    if (OSSchedLockNestingCtr > 0u) {                           /* Can't delay when the scheduler is locked             */
+       *p_err = OS_ERR_SCHED_LOCKED;
+        return;
+    }
+
+    if (us == 0u) {
+       *p_err = OS_ERR_TIME_ZERO_DLY;
+        return;
+    }
+
+    dly = OS_TickHrUsToTS(us);
+    if ((dly == 0u) || (dly > OS_TICK_HR_DLY_MAX)) {
+       *p_err = OS_ERR_TIME_INVALID_MICROSECONDS;
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    OSTCBCurPtr->TickHrDly = dly;
+    OS_TickHrListInsert(OSTCBCurPtr);
+    OSTCBCurPtr->TaskState = OS_TASK_STATE_DLY;
+    OS_RdyListRemove(OSTCBCurPtr);                              /* Remove current task from ready list                  */
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+    OSSched();                                                  /* Find next task to run!                               */
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                            DELAY TASK UNTIL AN ABSOLUTE TICK
+*
+* Description: This function is called to delay execution of the currently running task until OSTickCtr reaches the
+*              specified value.  Unlike a relative delay, the wake-up tick does not depend on when the call is made, so
+*              a loop that advances 'tick' by its period does not drift.
+*
+* Arguments  : tick      is the value of OSTickCtr at which the task will be resumed.
+*
+*              p_err     is a pointer to a variable that will contain an error code from this call.
+*
+*                            OS_ERR_NONE              The call was successful and the delay occurred
+*                            OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*                            OS_ERR_SCHED_LOCKED      Can't delay when the scheduler is locked
+*                            OS_ERR_TIME_DLY_ISR      If you called this function from an ISR
+*                            OS_ERR_TIME_ZERO_DLY     If OSTickCtr already reached 'tick' (see Note #1)
+*
+* Returns    : none
+*
+* Note(s)    : 1) 'tick' is considered reached or passed when it is not within half the range of OS_TICK ahead of
+*                 OSTickCtr.  The task does not delay in that case.
+*
+*              2) Pend calls accept the same kind of deadline as their 'timeout' when OS_OPT_PEND_ABS is added to
+*                 their 'opt' argument.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TIME_ABS_EN > 0u)
+void  OSTimeDlyUntil (OS_TICK   tick,
+                      OS_ERR   *p_err)
+{
+    OS_TICK  tick_cur;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_TIME_DLY_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+    if (OSSchedLockNestingCtr > 0u) {                           /* Can't delay when the scheduler is locked             */
+       *p_err = OS_ERR_SCHED_LOCKED;
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    tick_cur = OSTickCtr + OS_DynTickGet();
+#else
+    tick_cur = OSTickCtr;
+#endif
+    if ((OS_TICK)(tick - tick_cur - 1u) >= ((OS_TICK)~(OS_TICK)0u >> 1u)) {
+        CPU_CRITICAL_EXIT();                                    /* 'tick' reached or passed (see Note #1)               */
+       *p_err = OS_ERR_TIME_ZERO_DLY;
+        return;
+    }
+
+    OS_TickListInsertDly(OSTCBCurPtr,                           /* tick_base is 0, the task wakes up at 'tick'          */
+                         tick,
+                         OS_OPT_TIME_MATCH,
+                         p_err);
+    if (*p_err != OS_ERR_NONE) {
+         CPU_CRITICAL_EXIT();
+         return;
+    }
+
+    OS_RdyListRemove(OSTCBCurPtr);                              /* Remove current task from ready list                  */
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find next task to run!                               */
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                               GET CURRENT SYSTEM TIME
@@ -538,6 +714,100 @@ void  OSTimeSet (OS_TICK   ticks,
 }
 
 
+/*
+************************************************************************************************************************
+*                                                  CHANGE THE TICK RATE
+*
+* Description: This function changes the rate of the kernel tick at run-time, e.g. to lower it while the application is
+*              in a low-power mode.  The port reprograms its tick source and the time left to every delay, pend timeout
+*              and timer is converted to the new rate so that they still expire after the same amount of time.
+*
+* Arguments  : rate_hz  is the new tick rate, in Hz.
+*
+*              p_err    is a pointer to a variable that will receive an error code
+*
+*                           OS_ERR_NONE               If the call was successful
+*                           OS_ERR_TICK_RATE_INVALID  If 'rate_hz' is 0 or lower than OSCfg_TmrTaskRate_Hz
+*                           OS_ERR_TICK_RATE_SET_ISR  If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) OSTimeDlyHMSM(), the statistic task, the default round-robin time quanta and the timers follow the new
+*                 rate.  Values given to the kernel in ticks (OSTimeDly() delays, pend timeouts, explicit time quanta,
+*                 task budgets) are used as is by the calls made after the change.
+*
+*              2) The timers of every timer service are converted with the service locked, so this function MUST NOT be
+*                 called from a timer callback.
+*
+*              3) 'rate_hz' can't be lower than OSCfg_TmrTaskRate_Hz since a timer tick must last at least one tick.
+*                 Timer delays are kept as multiples of the new OSTmrToTicksMult, which is exact when the tick rates
+*                 used are multiples of OSCfg_TmrTaskRate_Hz.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TICK_RATE_SET_EN > 0u)
+void  OSTickRateSet (OS_RATE_HZ   rate_hz,
+                     OS_ERR      *p_err)
+{
+    OS_RATE_HZ  rate_hz_prev;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_TICK_RATE_SET_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (rate_hz == 0u) {
+       *p_err = OS_ERR_TICK_RATE_INVALID;
+        return;
+    }
+#if (OS_CFG_TMR_EN > 0u)
+    if (rate_hz < OSCfg_TmrTaskRate_Hz) {                       /* OSTmrToTicksMult can't be 0 (see Note #3)            */
+       *p_err = OS_ERR_TICK_RATE_INVALID;
+        return;
+    }
+#endif
+#endif
+
+    if (rate_hz == OSTickRateHz) {
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+#if (OS_CFG_TMR_EN > 0u)
+    OS_TmrLockAll();                                            /* Keep the timer tasks out while the rate changes      */
+#endif
+
+    CPU_CRITICAL_ENTER();
+    rate_hz_prev = OSTickRateHz;
+    OS_TickListRescale(rate_hz_prev, rate_hz);                  /* Convert the delays and timeouts                      */
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u) && (OS_CFG_SCHED_ROUND_ROBIN_TS_EN == 0u)
+    OSSchedRoundRobinDfltTimeQuanta = OS_TickRescale(OSSchedRoundRobinDfltTimeQuanta, rate_hz_prev, rate_hz);
+#endif
+    OSTickRateHz = rate_hz;
+    OS_CPU_TICK_RATE_SET(rate_hz_prev, rate_hz);                /* Reprogram the tick source of the port                */
+    CPU_CRITICAL_EXIT();
+
+#if (OS_CFG_TMR_EN > 0u)
+    OS_TmrRescale(rate_hz_prev, rate_hz);                       /* Convert the timers and unlock the timer services     */
+#endif
+
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                 PROCESS SYSTEM TICK
@@ -562,12 +832,20 @@ void  OSTimeTick (void)
     OSTimeTickHook();                                           /* Call user definable hook                             */
 
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
-    OS_SchedRoundRobin(&OSRdyList[OSPrioCur]);                  /* Update quanta ctr for the task which just ran        */
+    OS_SchedRoundRobin(&OSRdyList[OS_PRIO_IX(OSPrioCur)]);      /* Update quanta ctr for the task which just ran        */
 #endif
 
 #if (OS_CFG_TICK_EN > 0u)
     OS_TickUpdate(1u);                                          /* Update from the ISR                                  */
 #endif
+
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+    OS_TaskBudgetTick();                                        /* Charge the running task, replenish the budgets       */
+#endif
+
+#if (OS_CFG_TASK_FAIR_EN > 0u)
+    OS_TaskFairTick();                                          /* Advance the virtual runtime of the running task      */
+#endif
 }
 
 
@@ -595,6 +873,60 @@ void  OSTimeDynTick (OS_TICK  ticks)
 
     OSTimeTickHook();
 
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u) && (OS_CFG_SCHED_ROUND_ROBIN_TS_EN > 0u)
+    OS_SchedRoundRobin(&OSRdyList[OS_PRIO_IX(OSPrioCur)]);      /* Catch up with a slice that ended while locked        */
+#endif
+
     OS_TickUpdate(ticks);                                       /* Update from the ISR                                  */
+
+#if (OS_CFG_TASK_BUDGET_EN > 0u)
+    OS_TaskBudgetTick();
+#endif
+
+#if (OS_CFG_TASK_FAIR_EN > 0u)
+    OS_TaskFairTick();
+#endif
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                         PROCESS HIGH-RESOLUTION TIMEOUTS
+*
+* Description: This function readies the tasks whose high-resolution delay or timeout has expired, calls back the
+*              timers created with OS_OPT_TMR_ISR that are due, and ends the time slice of the current task with
+*              OS_CFG_SCHED_ROUND_ROBIN_TS_EN.  It must be called by the ISR of the compare timer programmed by
+*              OS_TickHrSet().
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) OS_TickHrSet(ts) must be implemented in the BSP.  It programs a one-shot interrupt for the time at
+*                 which OS_TS_GET() reaches 'ts'.  If that time has already passed, the BSP must trigger the interrupt
+*                 right away.  A new call replaces the previous deadline.
+*
+*              2) The interrupt may occur early or without any expired timeout; the next deadline is then programmed
+*                 again.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TIME_HR_EN > 0u)
+void  OSTimeTickHr (void)
+{
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+        return;
+    }
+
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u) && (OS_CFG_SCHED_ROUND_ROBIN_TS_EN > 0u)
+    OS_SchedRoundRobin(&OSRdyList[OS_PRIO_IX(OSPrioCur)]);      /* End of the time slice of the current task?           */
+#endif
+
+#if (OS_CFG_TMR_EN > 0u) && (OS_CFG_TMR_ISR_EN > 0u)
+    OS_TmrIsrUpdate();                                          /* Call back the ISR timers that are due                */
+#endif
+
+    OS_TickHrUpdate();                                          /* Update from the ISR                                  */
 }
 #endif
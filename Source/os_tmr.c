@@ -24,6 +24,7 @@
 */
 
 #define  MICRIUM_SOURCE
+#define  OS_CRIT_SITE_ID                    OS_CRIT_SITE_TMR
 #include "os.h"
 
 #ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
@@ -32,18 +33,90 @@ const  CPU_CHAR  *os_tmr__c = "$Id: $";
 
 
 #if (OS_CFG_TMR_EN > 0u)
+/*
+************************************************************************************************************************
+*                                                    LOCAL DEFINES
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TMR_SVC_EN > 0u)                                    /* Timer service a timer belongs to                     */
+#define  OS_TMR_SVC_PTR(p_tmr)         ((p_tmr)->SvcPtr)
+#else
+#define  OS_TMR_SVC_PTR(p_tmr)         (&OSTmrSvc)
+#endif
+
+#if (OS_CFG_TMR_CMD_Q_EN > 0u)                                  /* Commands replayed by the timer task                  */
+#define  OS_TMR_CMD_START                       1u
+#define  OS_TMR_CMD_STOP                        2u
+#define  OS_TMR_CMD_SET                         3u
+                                                                /* Calls not made by the service's task are queued      */
+#define  OS_TMR_CMD_Q_REQ(p_svc)       ((OSIntNestingCtr > 0u) || (OSTCBCurPtr != (p_svc)->TaskTCBPtr))
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                               LOCAL FUNCTION PROTOTYPES
 ************************************************************************************************************************
 */
 
-static  void  OS_TmrLock      (void);
-static  void  OS_TmrUnlock    (void);
+static  void  OS_TmrLock      (OS_TMR_SVC  *p_svc);
+static  void  OS_TmrUnlock    (OS_TMR_SVC  *p_svc);
+
+static  void  OS_TmrCondCreate(OS_TMR_SVC  *p_svc);
+static  void  OS_TmrCondSignal(OS_TMR_SVC  *p_svc);
+static  void  OS_TmrCondWait  (OS_TMR_SVC  *p_svc,
+                               OS_TICK      timeout);
+
+static  void  OS_TmrSvcInit   (OS_TMR_SVC  *p_svc,
+                               CPU_CHAR    *p_name,
+                               OS_TCB      *p_tcb,
+                               OS_PRIO      prio,
+                               CPU_STK     *p_stk_base,
+                               CPU_STK_SIZE stk_limit,
+                               CPU_STK_SIZE stk_size,
+                               OS_ERR      *p_err);
+
+#if (OS_CFG_TICK_RATE_SET_EN > 0u)
+static  void  OS_TmrMultSync  (OS_TMR      *p_tmr);
+#endif
+
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+static  OS_TICK  OS_TmrWheelNextDly (OS_TMR_SVC  *p_svc,
+                                     OS_TICK      tick);
+#endif
+
+#if (OS_CFG_TMR_CMD_Q_EN > 0u)
+static  CPU_BOOLEAN  OS_TmrCmdPost      (OS_TMR               *p_tmr,
+                                         CPU_INT08U            cmd,
+                                         OS_OPT                opt,
+                                         OS_TICK               dly,
+                                         OS_TICK               period,
+                                         OS_TMR_CALLBACK_PTR   p_callback,
+                                         void                 *p_callback_arg,
+                                         OS_ERR               *p_err);
+static  void         OS_TmrCmdProcess   (OS_TMR_SVC           *p_svc);
+#endif
+
+#if (OS_CFG_TMR_ISR_EN > 0u)
+static  void         OS_TmrIsrLink      (OS_TMR      *p_tmr);
+static  void         OS_TmrIsrUnlink    (OS_TMR      *p_tmr);
 
-static  void  OS_TmrCondCreate(void);
-static  void  OS_TmrCondSignal(void);
-static  void  OS_TmrCondWait  (OS_TICK  timeout);
+static  OS_TICK      OS_TmrIsrRemainGet (OS_TMR      *p_tmr,
+                                         OS_ERR      *p_err);
+static  CPU_BOOLEAN  OS_TmrIsrStart     (OS_TMR      *p_tmr,
+                                         OS_ERR      *p_err);
+static  CPU_BOOLEAN  OS_TmrIsrStop      (OS_TMR      *p_tmr,
+                                         OS_OPT       opt,
+                                         void        *p_callback_arg,
+                                         OS_ERR      *p_err);
+
+static  void         OS_TmrIsrUsToTS    (OS_TICK      dly,
+                                         OS_TICK      period,
+                                         CPU_TS      *p_dly_ts,
+                                         CPU_TS      *p_period_ts,
+                                         OS_ERR      *p_err);
+#endif
 
 
 /*
@@ -71,6 +144,10 @@ static  void  OS_TmrCondWait  (OS_TICK  timeout);
 *                                  OS_OPT_TMR_ONE_SHOT       The timer counts down only once
 *                                  OS_OPT_TMR_PERIODIC       The timer counts down and then reloads itself
 *
+*                              optionally ORed with:
+*
+*                                  OS_OPT_TMR_ISR            The timer expires in the compare ISR (see Note #3)
+*
 *              p_callback      Is a pointer to a callback function that will be called when the timer expires.  The
 *                              callback function must be declared as follows:
 *
@@ -95,6 +172,18 @@ static  void  OS_TmrCondWait  (OS_TICK  timeout);
 *
 * Note(s)    : 1) This function only creates the timer.  In other words, the timer is not started when created.  To
 *                 start the timer, call OSTmrStart().
+*
+*              2) The timer is serviced by the timer task created by OSInit().  Call OSTmrSvcSet() before starting it
+*                 to have it serviced by a timer service created with OSTmrSvcCreate() instead.
+*
+*              3) With OS_OPT_TMR_ISR, 'dly' and 'period' are in microseconds.  The timer is kept in OSTmrIsrListPtr
+*                 and expires in OSTimeTickHr(), i.e. in the ISR of the compare timer programmed by OS_TickHrSet(),
+*                 without going through the timer task.  Periodic ISR timers are reloaded from their previous
+*                 deadline so that they don't drift.  The callback runs in interrupt context, so it:
+*                   a) MUST be short and MUST NOT block,
+*                   b) may only call the services that are allowed from an ISR (e.g. OSSemPost(), OSTaskSemPost()),
+*                   c) MUST NOT call the timer services, which return OS_ERR_TMR_ISR from an ISR.
+*                 OSTmrSvcSet() and OSTmrSlackSet() have no effect on ISR timers.
 ************************************************************************************************************************
 */
 
@@ -107,6 +196,18 @@ void  OSTmrCreate (OS_TMR               *p_tmr,
                    void                 *p_callback_arg,
                    OS_ERR               *p_err)
 {
+    OS_TMR_SVC  *p_svc;
+    OS_OPT       mode;
+#if (OS_CFG_TMR_ISR_EN > 0u)
+    CPU_TS       dly_ts;
+    CPU_TS       period_ts;
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_SR_ALLOC();
+#endif
+
+
+
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == (OS_ERR *)0) {
         OS_SAFETY_CRITICAL_EXCEPTION();
@@ -128,13 +229,19 @@ void  OSTmrCreate (OS_TMR               *p_tmr,
     }
 #endif
 
+#if (OS_CFG_TMR_ISR_EN > 0u)
+    mode = opt & (OS_OPT)~OS_OPT_TMR_ISR;                       /* ONE-SHOT or PERIODIC, without the ISR option         */
+#else
+    mode = opt;
+#endif
+
 #if (OS_CFG_ARG_CHK_EN > 0u)
     if (p_tmr == (OS_TMR *)0) {                                 /* Validate 'p_tmr'                                     */
        *p_err = OS_ERR_OBJ_PTR_NULL;
         return;
     }
 
-    switch (opt) {
+    switch (mode) {
         case OS_OPT_TMR_PERIODIC:
              if (period == 0u) {
                 *p_err = OS_ERR_TMR_INVALID_PERIOD;
@@ -160,15 +267,27 @@ void  OSTmrCreate (OS_TMR               *p_tmr,
     }
 #endif
 
+#if (OS_CFG_TMR_ISR_EN > 0u)
+    dly_ts    = 0u;
+    period_ts = 0u;
+    if ((opt & OS_OPT_TMR_ISR) != 0u) {                         /* ISR timers count in OS_TS_GET() units (see Note #3)  */
+        OS_TmrIsrUsToTS(dly, period, &dly_ts, &period_ts, p_err);
+        if (*p_err != OS_ERR_NONE) {
+            return;
+        }
+    }
+#endif
+
+    p_svc = &OSTmrSvc;                                          /* New timers belong to the default timer service       */
     if (OSRunning == OS_STATE_OS_RUNNING) {                     /* Only lock when the kernel is running                 */
-        OS_TmrLock();
+        OS_TmrLock(p_svc);
     }
 
 #if (OS_OBJ_TYPE_REQ > 0u)
 #if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
     if (p_tmr->Type == OS_OBJ_TYPE_TMR) {
         if (OSRunning == OS_STATE_OS_RUNNING) {
-            OS_TmrUnlock();
+            OS_TmrUnlock(p_svc);
         }
         *p_err = OS_ERR_OBJ_CREATED;
         return;
@@ -185,22 +304,41 @@ void  OSTmrCreate (OS_TMR               *p_tmr,
 #endif
     p_tmr->Dly            =  dly    * OSTmrToTicksMult;         /* Convert to Timer Start Delay to ticks                */
     p_tmr->Remain         =  0u;
+#if (OS_CFG_SLACK_EN > 0u)
+    p_tmr->Slack          =  0u;                                /* Expire exactly on time until told otherwise          */
+#endif
     p_tmr->Period         =  period * OSTmrToTicksMult;         /* Convert to Timer Period      to ticks                */
-    p_tmr->Opt            =  opt;
+#if (OS_CFG_TICK_RATE_SET_EN > 0u)
+    p_tmr->Mult           =  OSTmrToTicksMult;
+#endif
+    p_tmr->Opt            =  mode;
     p_tmr->CallbackPtr    =  p_callback;
     p_tmr->CallbackPtrArg =  p_callback_arg;
     p_tmr->NextPtr        = (OS_TMR *)0;
     p_tmr->PrevPtr        = (OS_TMR *)0;
+#if (OS_CFG_TMR_SVC_EN > 0u)
+    p_tmr->SvcPtr         =  p_svc;
+#endif
+#if (OS_CFG_TMR_ISR_EN > 0u)
+    if ((opt & OS_OPT_TMR_ISR) != 0u) {
+        p_tmr->IsrMode    =  OS_TRUE;
+    } else {
+        p_tmr->IsrMode    =  OS_FALSE;
+    }
+    p_tmr->TsDly          =  dly_ts;
+    p_tmr->TsPeriod       =  period_ts;
+    p_tmr->TsMatch        =  0u;
+#endif
 
 #if (OS_CFG_DBG_EN > 0u)
+    CPU_CRITICAL_ENTER();                                       /* The debug list is shared by all timer services       */
     OS_TmrDbgListAdd(p_tmr);
-#endif
-#if (OS_CFG_DBG_EN > 0u)
     OSTmrQty++;                                                 /* Keep track of the number of timers created           */
+    CPU_CRITICAL_EXIT();
 #endif
 
     if (OSRunning == OS_STATE_OS_RUNNING) {
-        OS_TmrUnlock();
+        OS_TmrUnlock(p_svc);
     }
 
    *p_err = OS_ERR_NONE;
@@ -238,6 +376,7 @@ void  OSTmrCreate (OS_TMR               *p_tmr,
 CPU_BOOLEAN  OSTmrDel (OS_TMR  *p_tmr,
                        OS_ERR  *p_err)
 {
+    OS_TMR_SVC  *p_svc;
     CPU_BOOLEAN  success;
     OS_TICK      time;
     CPU_SR_ALLOC();
@@ -285,11 +424,23 @@ CPU_BOOLEAN  OSTmrDel (OS_TMR  *p_tmr,
     }
 #endif
 
-    OS_TmrLock();
+#if (OS_CFG_TMR_ISR_EN > 0u)
+    if (p_tmr->IsrMode == OS_TRUE) {                            /* Take an ISR timer out of the ISR's reach first       */
+        CPU_CRITICAL_ENTER();
+        if (p_tmr->State == OS_TMR_STATE_RUNNING) {
+            OS_TmrIsrUnlink(p_tmr);
+            p_tmr->State = OS_TMR_STATE_STOPPED;
+        }
+        CPU_CRITICAL_EXIT();
+    }
+#endif
+
+    p_svc = OS_TMR_SVC_PTR(p_tmr);
+    OS_TmrLock(p_svc);
 
     CPU_CRITICAL_ENTER();
-    if (OSTCBCurPtr == &OSTmrTaskTCB) {                         /* Callbacks operate on the Tmr Task's tick base.       */
-        time = OSTmrTaskTickBase;
+    if (OSTCBCurPtr == p_svc->TaskTCBPtr) {                     /* Callbacks operate on the Tmr Task's tick base.       */
+        time = p_svc->TaskTickBase;
     } else {
 #if (OS_CFG_DYN_TICK_EN > 0u)
         time = OSTickCtr + OS_DynTickGet();
@@ -297,11 +448,10 @@ CPU_BOOLEAN  OSTmrDel (OS_TMR  *p_tmr,
         time = OSTickCtr;
 #endif
     }
-    CPU_CRITICAL_EXIT();
-
 #if (OS_CFG_DBG_EN > 0u)
-    OS_TmrDbgListRemove(p_tmr);
+    OS_TmrDbgListRemove(p_tmr);                                 /* The debug list is shared by all timer services       */
 #endif
+    CPU_CRITICAL_EXIT();
 
     switch (p_tmr->State) {
         case OS_TMR_STATE_RUNNING:
@@ -309,7 +459,9 @@ CPU_BOOLEAN  OSTmrDel (OS_TMR  *p_tmr,
              OS_TmrUnlink(p_tmr, time);                         /* Remove from the list                                 */
              OS_TmrClr(p_tmr);
 #if (OS_CFG_DBG_EN > 0u)
+             CPU_CRITICAL_ENTER();
              OSTmrQty--;                                        /* One less timer                                       */
+             CPU_CRITICAL_EXIT();
 #endif
             *p_err   = OS_ERR_NONE;
              success = OS_TRUE;
@@ -319,7 +471,9 @@ CPU_BOOLEAN  OSTmrDel (OS_TMR  *p_tmr,
         case OS_TMR_STATE_COMPLETED:                            /* ... timer has completed the ONE-SHOT time            */
              OS_TmrClr(p_tmr);                                  /* Clear timer fields                                   */
 #if (OS_CFG_DBG_EN > 0u)
+             CPU_CRITICAL_ENTER();
              OSTmrQty--;                                        /* One less timer                                       */
+             CPU_CRITICAL_EXIT();
 #endif
             *p_err   = OS_ERR_NONE;
              success = OS_TRUE;
@@ -336,7 +490,7 @@ CPU_BOOLEAN  OSTmrDel (OS_TMR  *p_tmr,
              break;
     }
 
-    OS_TmrUnlock();
+    OS_TmrUnlock(p_svc);
 
     return (success);
 }
@@ -363,15 +517,17 @@ CPU_BOOLEAN  OSTmrDel (OS_TMR  *p_tmr,
 *
 * Returns    : The time remaining for the timer to expire.  The time represents 'timer' increments (typically 1/10 sec).
 *
-* Note(s)    : none
+* Note(s)    : 1) Each running timer holds the tick at which it expires in '.Match', so the remaining time is found
+*                 without walking the timer list.  A timer that is overdue but not yet processed by the timer task
+*                 reports 0.
 ************************************************************************************************************************
 */
 
 OS_TICK  OSTmrRemainGet (OS_TMR  *p_tmr,
                          OS_ERR  *p_err)
 {
-    OS_TMR   *p_tmr1;
-    OS_TICK   remain;
+    OS_TMR_SVC  *p_svc;
+    OS_TICK      remain;
 
 
 #ifdef OS_SAFETY_CRITICAL
@@ -409,18 +565,23 @@ OS_TICK  OSTmrRemainGet (OS_TMR  *p_tmr,
     }
 #endif
 
-    OS_TmrLock();
+#if (OS_CFG_TMR_ISR_EN > 0u)
+    if (p_tmr->IsrMode == OS_TRUE) {                            /* ISR timers are read with interrupts disabled         */
+        return (OS_TmrIsrRemainGet(p_tmr, p_err));
+    }
+#endif
+
+    p_svc = OS_TMR_SVC_PTR(p_tmr);
+    OS_TmrLock(p_svc);
+#if (OS_CFG_TICK_RATE_SET_EN > 0u)
+    OS_TmrMultSync(p_tmr);                                      /* A stopped timer may still be at a previous tick rate */
+#endif
 
     switch (p_tmr->State) {
         case OS_TMR_STATE_RUNNING:
-             p_tmr1 = OSTmrListPtr;
-             remain = 0u;
-             while (p_tmr1 != (OS_TMR *)0) {                    /* Add up all the deltas up until the current timer     */
-                 remain += p_tmr1->Remain;
-                 if (p_tmr1 == p_tmr) {
-                     break;
-                 }
-                 p_tmr1 = p_tmr1->NextPtr;
+             remain  = p_tmr->Match - p_svc->TaskTickBase;      /* Time to expiry relative to the timer task tick base  */
+             if (remain > ((OS_TICK)~(OS_TICK)0u / 2u)) {       /* Already overdue (see Note #1)                        */
+                 remain = 0u;
              }
              remain /= OSTmrToTicksMult;
             *p_err   = OS_ERR_NONE;
@@ -456,7 +617,7 @@ OS_TICK  OSTmrRemainGet (OS_TMR  *p_tmr,
              break;
     }
 
-    OS_TmrUnlock();
+    OS_TmrUnlock(p_svc);
 
     return (remain);
 }
@@ -491,6 +652,7 @@ OS_TICK  OSTmrRemainGet (OS_TMR  *p_tmr,
 *                                 OS_ERR_NONE                    The timer was configured as expected
 *                                 OS_ERR_OBJ_TYPE                If the object type is invalid
 *                                 OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                                 OS_ERR_TMR_CMD_Q_FULL          If the command queue of the timer service is full
 *                                 OS_ERR_TMR_INVALID             If 'p_tmr' is a NULL pointer or invalid option
 *                                 OS_ERR_TMR_INVALID_CALLBACK    you specified an invalid callback for a periodic timer
 *                                 OS_ERR_TMR_INVALID_DLY         You specified an invalid delay
@@ -502,6 +664,10 @@ OS_TICK  OSTmrRemainGet (OS_TMR  *p_tmr,
 * Note(s)    : 1) This function can be called on a running timer. The change to the delay and period will only
 *                 take effect after the current period or delay has passed. Change to the callback will take
 *                 effect immediately.
+*
+*              2) With OS_CFG_TMR_CMD_Q_EN, the change is queued to the timer task of the service unless that task is
+*                 the caller, so this function never blocks and may be called from an ISR.  The change is applied
+*                 when the timer task next runs, in the order in which the commands were queued.
 ************************************************************************************************************************
 */
 
@@ -512,6 +678,15 @@ void  OSTmrSet (OS_TMR               *p_tmr,
                 void                 *p_callback_arg,
                 OS_ERR               *p_err)
 {
+    OS_TMR_SVC  *p_svc;
+#if (OS_CFG_TMR_ISR_EN > 0u)
+    CPU_TS       dly_ts;
+    CPU_TS       period_ts;
+    CPU_SR_ALLOC();
+#endif
+
+
+
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == (OS_ERR *)0) {
         OS_SAFETY_CRITICAL_EXCEPTION();
@@ -519,7 +694,7 @@ void  OSTmrSet (OS_TMR               *p_tmr,
     }
 #endif
 
-#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u) && (OS_CFG_TMR_CMD_Q_EN == 0u)
     if (OSIntNestingCtr > 0u) {                                 /* See if trying to call from an ISR                    */
        *p_err = OS_ERR_TMR_ISR;
         return;
@@ -574,8 +749,48 @@ void  OSTmrSet (OS_TMR               *p_tmr,
     }
 #endif
 
-    OS_TmrLock();
+#if (OS_CFG_TMR_ISR_EN > 0u)
+    if (p_tmr->IsrMode == OS_TRUE) {                            /* ISR timers count in OS_TS_GET() units                */
+        OS_TmrIsrUsToTS(dly, period, &dly_ts, &period_ts, p_err);
+        if (*p_err != OS_ERR_NONE) {
+            return;
+        }
+        CPU_CRITICAL_ENTER();                                   /* The compare ISR reloads and calls back ISR timers    */
+#if (OS_CFG_TICK_RATE_SET_EN > 0u)
+        OS_TmrMultSync(p_tmr);
+#endif
+        p_tmr->TsDly          = dly_ts;
+        p_tmr->TsPeriod       = period_ts;
+        p_tmr->Dly            = dly    * OSTmrToTicksMult;
+        p_tmr->Period         = period * OSTmrToTicksMult;
+        p_tmr->CallbackPtr    = p_callback;
+        p_tmr->CallbackPtrArg = p_callback_arg;
+        CPU_CRITICAL_EXIT();
+       *p_err                 = OS_ERR_NONE;
+        return;
+    }
+#endif
+
+    p_svc = OS_TMR_SVC_PTR(p_tmr);
+#if (OS_CFG_TMR_CMD_Q_EN > 0u)
+    if (OS_TMR_CMD_Q_REQ(p_svc)) {                              /* Let the timer task set the timer (see Note #2)       */
+        (void)OS_TmrCmdPost(p_tmr,
+                            OS_TMR_CMD_SET,
+                            OS_OPT_TMR_NONE,
+                            dly,
+                            period,
+                            p_callback,
+                            p_callback_arg,
+                            p_err);
+        return;
+    }
+#endif
+
+    OS_TmrLock(p_svc);
 
+#if (OS_CFG_TICK_RATE_SET_EN > 0u)
+    OS_TmrMultSync(p_tmr);                                      /* Keep '.Slack' at the same rate as the delays         */
+#endif
     p_tmr->Dly            = dly    * OSTmrToTicksMult;             /* Convert Timer Delay  to ticks                     */
     p_tmr->Period         = period * OSTmrToTicksMult;             /* Convert Timer Period to ticks                     */
     p_tmr->CallbackPtr    = p_callback;
@@ -583,8 +798,98 @@ void  OSTmrSet (OS_TMR               *p_tmr,
 
    *p_err                 = OS_ERR_NONE;
 
-    OS_TmrUnlock();
+    OS_TmrUnlock(p_svc);
+}
+
+
+/*
+************************************************************************************************************************
+*                                            SET THE SLACK OF A TIMER
+*
+* Description: This function is called by your application code to specify by how much the expiry of a timer may be
+*              postponed so that it shares a wake-up of the timer task with another timer.
+*
+* Arguments  : p_tmr     Is a pointer to a timer
+*
+*              slack     Is the maximum number of timer ticks by which the timer may expire late.  A value of 0 makes
+*                        the timer expire exactly on time (the default).
+*
+*              p_err     Is a pointer to an error code.  '*p_err' will contain one of the following:
+*
+*                            OS_ERR_NONE                The slack was changed
+*                            OS_ERR_OBJ_TYPE            If 'p_tmr' is not pointing to a timer
+*                            OS_ERR_OS_NOT_RUNNING      If uC/OS-III is not running yet
+*                            OS_ERR_TMR_INVALID         If 'p_tmr' is a NULL pointer
+*                            OS_ERR_TMR_ISR             If the call was made from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) The slack is applied each time the timer is placed in the timer list, i.e. when it is started and
+*                 when a periodic timer is reloaded.  If another timer already expires within 'slack' ticks after
+*                 this timer's deadline, both expire together and the timer task wakes up only once.
+*
+*              2) A periodic timer is reloaded from the tick at which it actually expired, so its period may drift by
+*                 up to 'slack' ticks per period.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SLACK_EN > 0u)
+void  OSTmrSlackSet (OS_TMR   *p_tmr,
+                     OS_TICK   slack,
+                     OS_ERR   *p_err)
+{
+    OS_TMR_SVC  *p_svc;
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if trying to call from an ISR                    */
+       *p_err = OS_ERR_TMR_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_tmr == (OS_TMR *)0) {                                 /* Validate 'p_tmr'                                     */
+       *p_err = OS_ERR_TMR_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_tmr->Type != OS_OBJ_TYPE_TMR) {                       /* Make sure timer was created                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    p_svc = OS_TMR_SVC_PTR(p_tmr);
+    OS_TmrLock(p_svc);
+
+#if (OS_CFG_TICK_RATE_SET_EN > 0u)
+    OS_TmrMultSync(p_tmr);                                      /* Keep the delays at the same rate as '.Slack'         */
+#endif
+    p_tmr->Slack = slack * OSTmrToTicksMult;                    /* Convert slack to ticks                               */
+
+   *p_err        = OS_ERR_NONE;
+
+    OS_TmrUnlock(p_svc);
 }
+#endif
 
 
 /*
@@ -600,6 +905,7 @@ void  OSTmrSet (OS_TMR               *p_tmr,
 *                           OS_ERR_NONE                The timer was started
 *                           OS_ERR_OBJ_TYPE            If 'p_tmr' is not pointing to a timer
 *                           OS_ERR_OS_NOT_RUNNING      If uC/OS-III is not running yet
+*                           OS_ERR_TMR_CMD_Q_FULL      If the command queue of the timer service is full
 *                           OS_ERR_TMR_INACTIVE        If the timer was not created
 *                           OS_ERR_TMR_INVALID         If 'p_tmr' is a NULL pointer
 *                           OS_ERR_TMR_INVALID_STATE   The timer is in an invalid state
@@ -612,12 +918,18 @@ void  OSTmrSet (OS_TMR               *p_tmr,
 *                 linked to the timer list with the OS_OPT_LINK_DLY option. This option sets the initial expiration
 *                 time for the timer. For timers in PERIODIC mode, subsequent expiration times are handled by
 *                 the OS_TmrTask().
+*
+*              2) With OS_CFG_TMR_CMD_Q_EN, a call that is not made by the timer task of the service only queues the
+*                 start and returns OS_TRUE, so it never blocks and may be called from an ISR.  The delay counts from
+*                 when the timer task processes the command, and OS_ERR_TMR_INACTIVE/OS_ERR_TMR_INVALID_STATE are not
+*                 reported to the caller.
 ************************************************************************************************************************
 */
 
 CPU_BOOLEAN  OSTmrStart (OS_TMR  *p_tmr,
                          OS_ERR  *p_err)
 {
+    OS_TMR_SVC  *p_svc;
     CPU_BOOLEAN  success;
     OS_TICK      time;
     CPU_SR_ALLOC();
@@ -630,7 +942,7 @@ CPU_BOOLEAN  OSTmrStart (OS_TMR  *p_tmr,
     }
 #endif
 
-#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u) && (OS_CFG_TMR_CMD_Q_EN == 0u)
     if (OSIntNestingCtr > 0u) {                                 /* See if trying to call from an ISR                    */
        *p_err = OS_ERR_TMR_ISR;
         return (OS_FALSE);
@@ -658,11 +970,30 @@ CPU_BOOLEAN  OSTmrStart (OS_TMR  *p_tmr,
     }
 #endif
 
-    OS_TmrLock();
+#if (OS_CFG_TMR_ISR_EN > 0u)
+    if (p_tmr->IsrMode == OS_TRUE) {                            /* ISR timers are linked with interrupts disabled       */
+        return (OS_TmrIsrStart(p_tmr, p_err));
+    }
+#endif
+
+    p_svc = OS_TMR_SVC_PTR(p_tmr);
+#if (OS_CFG_TMR_CMD_Q_EN > 0u)
+    if (OS_TMR_CMD_Q_REQ(p_svc)) {                              /* Let the timer task start the timer (see Note #2)     */
+        return (OS_TmrCmdPost(p_tmr,
+                              OS_TMR_CMD_START,
+                              OS_OPT_TMR_NONE,
+                              0u,
+                              0u,
+                              (OS_TMR_CALLBACK_PTR)0,
+                              (void *)0,
+                              p_err));
+    }
+#endif
+    OS_TmrLock(p_svc);
 
     CPU_CRITICAL_ENTER();
-    if (OSTCBCurPtr == &OSTmrTaskTCB) {                         /* Callbacks operate on the Tmr Task's tick base.       */
-        time = OSTmrTaskTickBase;
+    if (OSTCBCurPtr == p_svc->TaskTCBPtr) {                     /* Callbacks operate on the Tmr Task's tick base.       */
+        time = p_svc->TaskTickBase;
     } else {
 #if (OS_CFG_DYN_TICK_EN > 0u)
         time = OSTickCtr + OS_DynTickGet();
@@ -712,7 +1043,7 @@ CPU_BOOLEAN  OSTmrStart (OS_TMR  *p_tmr,
              break;
     }
 
-    OS_TmrUnlock();
+    OS_TmrUnlock(p_svc);
 
     return (success);
 }
@@ -749,7 +1080,8 @@ CPU_BOOLEAN  OSTmrStart (OS_TMR  *p_tmr,
 OS_STATE  OSTmrStateGet (OS_TMR  *p_tmr,
                          OS_ERR  *p_err)
 {
-    OS_STATE  state;
+    OS_TMR_SVC  *p_svc;
+    OS_STATE     state;
 
 
 
@@ -788,7 +1120,8 @@ OS_STATE  OSTmrStateGet (OS_TMR  *p_tmr,
     }
 #endif
 
-    OS_TmrLock();
+    p_svc = OS_TMR_SVC_PTR(p_tmr);
+    OS_TmrLock(p_svc);
 
     state = p_tmr->State;
     switch (state) {
@@ -805,7 +1138,7 @@ OS_STATE  OSTmrStateGet (OS_TMR  *p_tmr,
              break;
     }
 
-    OS_TmrUnlock();
+    OS_TmrUnlock(p_svc);
 
     return (state);
 }
@@ -837,6 +1170,7 @@ OS_STATE  OSTmrStateGet (OS_TMR  *p_tmr,
 *                               OS_ERR_OBJ_TYPE            If 'p_tmr' is not pointing to a timer
 *                               OS_ERR_OPT_INVALID         If you specified an invalid option for 'opt'
 *                               OS_ERR_OS_NOT_RUNNING      If uC/OS-III is not running yet
+*                               OS_ERR_TMR_CMD_Q_FULL      If the command queue of the timer service is full
 *                               OS_ERR_TMR_INACTIVE        If the timer was not created
 *                               OS_ERR_TMR_INVALID         If 'p_tmr' is a NULL pointer
 *                               OS_ERR_TMR_INVALID_STATE   The timer is in an invalid state
@@ -847,7 +1181,10 @@ OS_STATE  OSTmrStateGet (OS_TMR  *p_tmr,
 * Returns    : OS_TRUE   If we stopped the timer (if the timer is already stopped, we also return OS_TRUE)
 *              OS_FALSE  If not
 *
-* Note(s)    : none
+* Note(s)    : 1) With OS_CFG_TMR_CMD_Q_EN, a call that is not made by the timer task of the service only queues the
+*                 stop and returns OS_TRUE, so it never blocks and may be called from an ISR.  The callback requested
+*                 by 'opt' is then run by the timer task, and the errors depending on the state of the timer are not
+*                 reported to the caller.
 ************************************************************************************************************************
 */
 
@@ -856,6 +1193,7 @@ CPU_BOOLEAN  OSTmrStop (OS_TMR  *p_tmr,
                         void    *p_callback_arg,
                         OS_ERR  *p_err)
 {
+    OS_TMR_SVC          *p_svc;
     OS_TMR_CALLBACK_PTR  p_fnct;
     CPU_BOOLEAN          success;
     OS_TICK              time;
@@ -869,7 +1207,7 @@ CPU_BOOLEAN  OSTmrStop (OS_TMR  *p_tmr,
     }
 #endif
 
-#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u) && (OS_CFG_TMR_CMD_Q_EN == 0u)
     if (OSIntNestingCtr > 0u) {                                 /* See if trying to call from an ISR                    */
        *p_err = OS_ERR_TMR_ISR;
         return (OS_FALSE);
@@ -897,11 +1235,40 @@ CPU_BOOLEAN  OSTmrStop (OS_TMR  *p_tmr,
     }
 #endif
 
-    OS_TmrLock();
+#if (OS_CFG_TMR_ISR_EN > 0u)
+    if (p_tmr->IsrMode == OS_TRUE) {                            /* ISR timers are unlinked with interrupts disabled     */
+        return (OS_TmrIsrStop(p_tmr, opt, p_callback_arg, p_err));
+    }
+#endif
+
+    p_svc = OS_TMR_SVC_PTR(p_tmr);
+#if (OS_CFG_TMR_CMD_Q_EN > 0u)
+    if (OS_TMR_CMD_Q_REQ(p_svc)) {                              /* Let the timer task stop the timer (see Note #1)      */
+        switch (opt) {
+            case OS_OPT_TMR_NONE:
+            case OS_OPT_TMR_CALLBACK:
+            case OS_OPT_TMR_CALLBACK_ARG:
+                 break;
+
+            default:
+                *p_err = OS_ERR_OPT_INVALID;
+                 return (OS_FALSE);
+        }
+        return (OS_TmrCmdPost(p_tmr,
+                              OS_TMR_CMD_STOP,
+                              opt,
+                              0u,
+                              0u,
+                              (OS_TMR_CALLBACK_PTR)0,
+                              p_callback_arg,
+                              p_err));
+    }
+#endif
+    OS_TmrLock(p_svc);
 
     CPU_CRITICAL_ENTER();
-    if (OSTCBCurPtr == &OSTmrTaskTCB) {                         /* Callbacks operate on the Tmr Task's tick base.       */
-        time = OSTmrTaskTickBase;
+    if (OSTCBCurPtr == p_svc->TaskTCBPtr) {                     /* Callbacks operate on the Tmr Task's tick base.       */
+        time = p_svc->TaskTickBase;
     } else {
 #if (OS_CFG_DYN_TICK_EN > 0u)
         time = OSTickCtr + OS_DynTickGet();
@@ -941,7 +1308,7 @@ CPU_BOOLEAN  OSTmrStop (OS_TMR  *p_tmr,
                       break;
 
                  default:
-                      OS_TmrUnlock();
+                      OS_TmrUnlock(p_svc);
                      *p_err = OS_ERR_OPT_INVALID;
                       return (OS_FALSE);
              }
@@ -967,7 +1334,7 @@ CPU_BOOLEAN  OSTmrStop (OS_TMR  *p_tmr,
              break;
     }
 
-    OS_TmrUnlock();
+    OS_TmrUnlock(p_svc);
 
     return (success);
 }
@@ -975,77 +1342,294 @@ CPU_BOOLEAN  OSTmrStop (OS_TMR  *p_tmr,
 
 /*
 ************************************************************************************************************************
-*                                                 CLEAR TIMER FIELDS
+*                                              CREATE A TIMER SERVICE
 *
-* Description: This function is called to clear all timer fields.
+* Description: This function is called by your application code to create an additional timer service, i.e. a timer
+*              task with its own priority, its own timer list or wheel and its own lock.  Timers moved to the service
+*              with OSTmrSvcSet() have their callbacks run by its task, so they are not delayed by the callbacks of the
+*              timers of other services.
 *
-* Argument(s): p_tmr    Is a pointer to the timer to clear
-*              -----
+* Arguments  : p_svc          Is a pointer to the timer service, allocated in user memory space
+*
+*              p_name         Is a pointer to an ASCII string used to name the timer task
+*
+*              p_tcb          Is a pointer to the TCB of the timer task, allocated in user memory space
+*
+*              prio           Is the priority of the timer task
+*
+*              p_stk_base     Is a pointer to the base of the stack of the timer task
+*
+*              stk_limit      Is the number of stack elements left when the stack is considered full
+*
+*              stk_size       Is the size of the stack in number of elements
+*
+*              p_err          Is a pointer to an error code.  '*p_err' will contain one of the following:
+*
+*                                 OS_ERR_NONE                    The timer service was created
+*                                 OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the service after you
+*                                                                  called OSSafetyCriticalStart()
+*                                 OS_ERR_OBJ_PTR_NULL            If 'p_svc' is a NULL pointer
+*                                 OS_ERR_TCB_INVALID             If 'p_tcb' is a NULL pointer
+*                                 OS_ERR_TMR_ISR                 If the call was made from an ISR
+*                                 OS_ERR_TMR_PRIO_INVALID        If 'prio' is the priority of the idle task
+*                                 OS_ERR_TMR_STK_INVALID         If 'p_stk_base' is a NULL pointer
+*                                 OS_ERR_TMR_STK_SIZE_INVALID    If 'stk_size' is smaller than OSCfg_StkSizeMin
+*
+*                             or any of the errors returned by OSTaskCreate().
 *
 * Returns    : none
 *
-* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+* Note(s)    : 1) Each callback is run with the lock of its own service held.  A callback may use the timer APIs on
+*                 the timers of another service, but two services MUST NOT do so on each other's timers.
 ************************************************************************************************************************
 */
 
-void  OS_TmrClr (OS_TMR  *p_tmr)
+#if (OS_CFG_TMR_SVC_EN > 0u)
+void  OSTmrSvcCreate (OS_TMR_SVC    *p_svc,
+                      CPU_CHAR      *p_name,
+                      OS_TCB        *p_tcb,
+                      OS_PRIO        prio,
+                      CPU_STK       *p_stk_base,
+                      CPU_STK_SIZE   stk_limit,
+                      CPU_STK_SIZE   stk_size,
+                      OS_ERR        *p_err)
 {
-    p_tmr->State          = OS_TMR_STATE_UNUSED;                /* Clear timer fields                                   */
-#if (OS_OBJ_TYPE_REQ > 0u)
-    p_tmr->Type           = OS_OBJ_TYPE_NONE;
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
 #endif
-#if (OS_CFG_DBG_EN > 0u)
-    p_tmr->NamePtr        = (CPU_CHAR *)((void *)"?TMR");
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
 #endif
-    p_tmr->Dly            =                      0u;
-    p_tmr->Remain         =                      0u;
-    p_tmr->Period         =                      0u;
-    p_tmr->Opt            =                      0u;
-    p_tmr->CallbackPtr    = (OS_TMR_CALLBACK_PTR)0;
-    p_tmr->CallbackPtrArg = (void              *)0;
-    p_tmr->NextPtr        = (OS_TMR            *)0;
-    p_tmr->PrevPtr        = (OS_TMR            *)0;
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if trying to call from an ISR                    */
+       *p_err = OS_ERR_TMR_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_svc == (OS_TMR_SVC *)0) {                             /* Validate 'p_svc'                                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_tcb == (OS_TCB *)0) {                                 /* Validate 'p_tcb'                                     */
+       *p_err = OS_ERR_TCB_INVALID;
+        return;
+    }
+#endif
+
+    OS_TmrSvcInit(p_svc,
+                  p_name,
+                  p_tcb,
+                  prio,
+                  p_stk_base,
+                  stk_limit,
+                  stk_size,
+                  p_err);
 }
+#endif
 
 
 /*
 ************************************************************************************************************************
-*                                         ADD/REMOVE TIMER TO/FROM DEBUG TABLE
+*                                       SELECT THE TIMER SERVICE OF A TIMER
 *
-* Description: These functions are called by uC/OS-III to add or remove a timer to/from a timer debug table.
+* Description: This function is called by your application code to choose the timer service that runs the callback of
+*              a timer.  Timers are serviced by the timer task created by OSInit() until this function is called.
 *
-* Arguments  : p_tmr     is a pointer to the timer to add/remove
+* Arguments  : p_tmr          Is a pointer to the timer
+*
+*              p_svc          Is a pointer to the timer service, either &OSTmrSvc or one created with OSTmrSvcCreate()
+*
+*              p_err          Is a pointer to an error code.  '*p_err' will contain one of the following:
+*
+*                                 OS_ERR_NONE                    The timer now belongs to 'p_svc'
+*                                 OS_ERR_OBJ_PTR_NULL            If 'p_svc' is a NULL pointer
+*                                 OS_ERR_OBJ_TYPE                If 'p_tmr' is not pointing to a timer
+*                                 OS_ERR_TMR_INACTIVE            If the timer was not created
+*                                 OS_ERR_TMR_INVALID             If 'p_tmr' is a NULL pointer
+*                                 OS_ERR_TMR_INVALID_STATE       If the timer is running, stop it first
+*                                 OS_ERR_TMR_ISR                 If the call was made from an ISR
 *
 * Returns    : none
 *
-* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+* Note(s)    : 1) This function MUST NOT be called while another task uses the timer.
 ************************************************************************************************************************
 */
 
-
-#if (OS_CFG_DBG_EN > 0u)
-void  OS_TmrDbgListAdd (OS_TMR  *p_tmr)
+#if (OS_CFG_TMR_SVC_EN > 0u)
+void  OSTmrSvcSet (OS_TMR      *p_tmr,
+                   OS_TMR_SVC  *p_svc,
+                   OS_ERR      *p_err)
 {
-    p_tmr->DbgPrevPtr               = (OS_TMR *)0;
-    if (OSTmrDbgListPtr == (OS_TMR *)0) {
-        p_tmr->DbgNextPtr           = (OS_TMR *)0;
-    } else {
-        p_tmr->DbgNextPtr           =  OSTmrDbgListPtr;
-        OSTmrDbgListPtr->DbgPrevPtr =  p_tmr;
-    }
-    OSTmrDbgListPtr                 =  p_tmr;
-}
-
+    OS_TMR_SVC  *p_svc_cur;
 
 
-void  OS_TmrDbgListRemove (OS_TMR  *p_tmr)
-{
-    OS_TMR  *p_tmr_next;
-    OS_TMR  *p_tmr_prev;
 
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
 
-    p_tmr_prev = p_tmr->DbgPrevPtr;
-    p_tmr_next = p_tmr->DbgNextPtr;
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if trying to call from an ISR                    */
+       *p_err = OS_ERR_TMR_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_tmr == (OS_TMR *)0) {                                 /* Validate 'p_tmr'                                     */
+       *p_err = OS_ERR_TMR_INVALID;
+        return;
+    }
+    if (p_svc == (OS_TMR_SVC *)0) {                             /* Validate 'p_svc'                                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_tmr->Type != OS_OBJ_TYPE_TMR) {                       /* Make sure timer was created                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    p_svc_cur = p_tmr->SvcPtr;
+    if (OSRunning == OS_STATE_OS_RUNNING) {                     /* Only lock when the kernel is running                 */
+        OS_TmrLock(p_svc_cur);
+    }
+
+    switch (p_tmr->State) {
+        case OS_TMR_STATE_STOPPED:                              /* Timer is not linked to a list, it can be moved       */
+        case OS_TMR_STATE_COMPLETED:
+             p_tmr->SvcPtr = p_svc;
+            *p_err         = OS_ERR_NONE;
+             break;
+
+        case OS_TMR_STATE_RUNNING:                              /* Timer is linked to the list of its current service   */
+        case OS_TMR_STATE_TIMEOUT:
+            *p_err         = OS_ERR_TMR_INVALID_STATE;
+             break;
+
+        case OS_TMR_STATE_UNUSED:                               /* Timer not created                                    */
+            *p_err         = OS_ERR_TMR_INACTIVE;
+             break;
+
+        default:
+            *p_err         = OS_ERR_TMR_INVALID_STATE;
+             break;
+    }
+
+    if (OSRunning == OS_STATE_OS_RUNNING) {
+        OS_TmrUnlock(p_svc_cur);
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                 CLEAR TIMER FIELDS
+*
+* Description: This function is called to clear all timer fields.
+*
+* Argument(s): p_tmr    Is a pointer to the timer to clear
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_TmrClr (OS_TMR  *p_tmr)
+{
+    p_tmr->State          = OS_TMR_STATE_UNUSED;                /* Clear timer fields                                   */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_tmr->Type           = OS_OBJ_TYPE_NONE;
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_tmr->NamePtr        = (CPU_CHAR *)((void *)"?TMR");
+#endif
+    p_tmr->Dly            =                      0u;
+    p_tmr->Remain         =                      0u;
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+    p_tmr->Match          =                      0u;
+#endif
+#if (OS_CFG_SLACK_EN > 0u)
+    p_tmr->Slack          =                      0u;
+#endif
+    p_tmr->Period         =                      0u;
+#if (OS_CFG_TICK_RATE_SET_EN > 0u)
+    p_tmr->Mult           =        OSTmrToTicksMult;            /* 0 at any tick rate                                   */
+#endif
+    p_tmr->Opt            =                      0u;
+    p_tmr->CallbackPtr    = (OS_TMR_CALLBACK_PTR)0;
+    p_tmr->CallbackPtrArg = (void              *)0;
+    p_tmr->NextPtr        = (OS_TMR            *)0;
+    p_tmr->PrevPtr        = (OS_TMR            *)0;
+#if (OS_CFG_TMR_SVC_EN > 0u)
+    p_tmr->SvcPtr         = &OSTmrSvc;
+#endif
+#if (OS_CFG_TMR_ISR_EN > 0u)
+    p_tmr->IsrMode        =               OS_FALSE;
+    p_tmr->TsDly          =                      0u;
+    p_tmr->TsPeriod       =                      0u;
+    p_tmr->TsMatch        =                      0u;
+#endif
+}
+
+
+/*
+************************************************************************************************************************
+*                                         ADD/REMOVE TIMER TO/FROM DEBUG TABLE
+*
+* Description: These functions are called by uC/OS-III to add or remove a timer to/from a timer debug table.
+*
+* Arguments  : p_tmr     is a pointer to the timer to add/remove
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+
+#if (OS_CFG_DBG_EN > 0u)
+void  OS_TmrDbgListAdd (OS_TMR  *p_tmr)
+{
+    p_tmr->DbgPrevPtr               = (OS_TMR *)0;
+    if (OSTmrDbgListPtr == (OS_TMR *)0) {
+        p_tmr->DbgNextPtr           = (OS_TMR *)0;
+    } else {
+        p_tmr->DbgNextPtr           =  OSTmrDbgListPtr;
+        OSTmrDbgListPtr->DbgPrevPtr =  p_tmr;
+    }
+    OSTmrDbgListPtr                 =  p_tmr;
+}
+
+
+
+void  OS_TmrDbgListRemove (OS_TMR  *p_tmr)
+{
+    OS_TMR  *p_tmr_next;
+    OS_TMR  *p_tmr_prev;
+
+
+    p_tmr_prev = p_tmr->DbgPrevPtr;
+    p_tmr_next = p_tmr->DbgNextPtr;
 
     if (p_tmr_prev == (OS_TMR *)0) {
         OSTmrDbgListPtr = p_tmr_next;
@@ -1072,7 +1656,8 @@ void  OS_TmrDbgListRemove (OS_TMR  *p_tmr)
 ************************************************************************************************************************
 *                                             INITIALIZE THE TIMER MANAGER
 *
-* Description: This function is called by OSInit() to initialize the timer manager module.
+* Description: This function is called by OSInit() to initialize the timer manager module and its default timer
+*              service.
 *
 * Argument(s): p_err    is a pointer to a variable that will contain an error code returned by this function.
 *
@@ -1094,65 +1679,90 @@ void  OS_TmrInit (OS_ERR  *p_err)
     OSTmrQty             =           0u;                        /* Keep track of the number of timers created           */
     OSTmrDbgListPtr      = (OS_TMR *)0;
 #endif
-
-    OSTmrListPtr         = (OS_TMR *)0;                         /* Create an empty timer list                           */
-#if (OS_CFG_DBG_EN > 0u)
-    OSTmrListEntries     =           0u;
+#if (OS_CFG_TMR_ISR_EN > 0u)
+    OSTmrIsrListPtr      = (OS_TMR *)0;                         /* No ISR timer running                                 */
 #endif
                                                                 /* Calculate Timer to Ticks multiplier                  */
     OSTmrToTicksMult = OSCfg_TickRate_Hz / OSCfg_TmrTaskRate_Hz;
-
-#if (OS_CFG_TS_EN > 0u)
-    OSTmrTaskTime        =           0u;
-    OSTmrTaskTimeMax     =           0u;
+#if (OS_CFG_TICK_RATE_SET_EN > 0u)
+    OSTmrSvcListPtr  = (OS_TMR_SVC *)0;
 #endif
 
-    OSMutexCreate(&OSTmrMutex,                                  /* Use a mutex to protect the timers                    */
+    OS_TmrSvcInit(&OSTmrSvc,
 #if  (OS_CFG_DBG_EN == 0u)
                   (CPU_CHAR *)0,
 #else
-                  (CPU_CHAR *)"OS Tmr Mutex",
-#endif
-                  p_err);
-    if (*p_err != OS_ERR_NONE) {
-        return;
-    }
+                  (CPU_CHAR *)"uC/OS-III Timer Task",
+#endif
+                  &OSTmrTaskTCB,
+                   OSCfg_TmrTaskPrio,
+                   OSCfg_TmrTaskStkBasePtr,
+                   OSCfg_TmrTaskStkLimit,
+                   OSCfg_TmrTaskStkSize,
+                   p_err);
+}
 
-    OS_TmrCondCreate();
-                                                                /* -------------- CREATE THE TIMER TASK --------------- */
-    if (OSCfg_TmrTaskStkBasePtr == (CPU_STK *)0) {
-       *p_err = OS_ERR_TMR_STK_INVALID;
-        return;
-    }
 
-    if (OSCfg_TmrTaskStkSize < OSCfg_StkSizeMin) {
-       *p_err = OS_ERR_TMR_STK_SIZE_INVALID;
-        return;
-    }
+/*
+************************************************************************************************************************
+*                                              EXPIRE THE ISR TIMERS THAT ARE DUE
+*
+* Description: This function is called by OSTimeTickHr() to expire the timers created with OS_OPT_TMR_ISR whose
+*              deadline has passed and to invoke their callback.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) Interrupts are enabled around each callback.  The list is only scanned up to the time read on entry,
+*                 so a periodic timer whose period is shorter than the time spent here is not called back twice.
+*
+*              3) A periodic timer that missed deadlines (e.g. because interrupts were disabled for too long) skips
+*                 them instead of being called back once for each of them.
+************************************************************************************************************************
+*/
 
-    if (OSCfg_TmrTaskPrio >= (OS_CFG_PRIO_MAX - 1u)) {
-       *p_err = OS_ERR_TMR_PRIO_INVALID;
-        return;
-    }
+#if (OS_CFG_TMR_ISR_EN > 0u)
+void  OS_TmrIsrUpdate (void)
+{
+    OS_TMR               *p_tmr;
+    OS_TMR_CALLBACK_PTR   p_fnct;
+    void                 *p_arg;
+    CPU_TS                ts;
+    CPU_SR_ALLOC();
 
-    OSTaskCreate(&OSTmrTaskTCB,
-#if  (OS_CFG_DBG_EN == 0u)
-                 (CPU_CHAR *)0,
-#else
-                 (CPU_CHAR *)"uC/OS-III Timer Task",
-#endif
-                  OS_TmrTask,
-                 (void     *)0,
-                  OSCfg_TmrTaskPrio,
-                  OSCfg_TmrTaskStkBasePtr,
-                  OSCfg_TmrTaskStkLimit,
-                  OSCfg_TmrTaskStkSize,
-                  0u,
-                  0u,
-                 (void     *)0,
-                 (OS_OPT_TASK_STK_CHK | (OS_OPT)(OS_OPT_TASK_STK_CLR | OS_OPT_TASK_NO_TLS)),
-                  p_err);
+
+    CPU_CRITICAL_ENTER();
+    ts    = OS_TS_GET();
+    p_tmr = OSTmrIsrListPtr;
+    while ((p_tmr != (OS_TMR *)0) &&                            /* Expire the timers whose deadline has passed          */
+           ((CPU_TS)(ts - p_tmr->TsMatch) <= OS_TICK_HR_DLY_MAX)) {
+        OS_TmrIsrUnlink(p_tmr);
+        if (p_tmr->Opt == OS_OPT_TMR_PERIODIC) {
+            p_tmr->TsMatch += p_tmr->TsPeriod;                  /* Reload from the previous deadline                    */
+            if ((CPU_TS)(ts - p_tmr->TsMatch) <= OS_TICK_HR_DLY_MAX) {
+                p_tmr->TsMatch = ts + p_tmr->TsPeriod;          /* Skip the missed deadlines (see Note #3)              */
+            }
+            OS_TmrIsrLink(p_tmr);
+        } else {
+            p_tmr->State    = OS_TMR_STATE_COMPLETED;           /* Indicate that the timer has completed                */
+        }
+        p_fnct = p_tmr->CallbackPtr;
+        p_arg  = p_tmr->CallbackPtrArg;
+        CPU_CRITICAL_EXIT();
+
+        if (p_fnct != (OS_TMR_CALLBACK_PTR)0) {                 /* Execute callback function if available               */
+            (*p_fnct)(p_tmr, p_arg);
+        }
+
+        CPU_CRITICAL_ENTER();
+        p_tmr = OSTmrIsrListPtr;
+    }
+    CPU_CRITICAL_EXIT();
 }
+#endif
 
 
 /*
@@ -1169,56 +1779,136 @@ void  OS_TmrInit (OS_ERR  *p_err)
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) With the timer wheel, the timer is pushed at the front of spoke 'Match % OS_CFG_TMR_WHEEL_SIZE' in
+*                 constant time.  The timer task is only signaled when the timer expires before its next wake-up.
+*
+*              3) When OS_CFG_SLACK_EN is enabled, the expiry is postponed by up to 'p_tmr->Slack' ticks if this lets the
+*                 timer expire together with a timer that is already linked (see OSTmrSlackSet()).
 ************************************************************************************************************************
 */
 
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+void OS_TmrLink (OS_TMR   *p_tmr,
+                 OS_TICK   time)
+{
+    OS_TMR_SVC  *p_svc;
+    OS_TMR      *p_tmr2;
+    OS_TICK      dly;
+    CPU_DATA     spoke;
+
+
+#if (OS_CFG_TICK_RATE_SET_EN > 0u)
+    if (p_tmr->Mult != OSTmrToTicksMult) {                      /* '.Remain' was loaded at a previous tick rate         */
+        p_tmr->Remain = (p_tmr->Remain / p_tmr->Mult) * OSTmrToTicksMult;
+        OS_TmrMultSync(p_tmr);
+    }
+#endif
+    p_svc          = OS_TMR_SVC_PTR(p_tmr);
+    p_tmr->Match   = time + p_tmr->Remain;                      /* Absolute tick at which the timer expires             */
+#if (OS_CFG_SLACK_EN > 0u)
+    if (p_tmr->Slack > 0u) {                                    /* Expire with the first busy spoke within the slack    */
+        dly = OS_TmrWheelNextDly(p_svc, p_tmr->Match - 1u);
+        if ((dly != 0u) && ((dly - 1u) <= p_tmr->Slack)) {
+            p_tmr->Match += dly - 1u;
+        }
+    }
+#endif
+    spoke          = (CPU_DATA)(p_tmr->Match & (OS_CFG_TMR_WHEEL_SIZE - 1u));
+
+    p_tmr2         = p_svc->Wheel[spoke];                       /* Push the timer at the front of its spoke             */
+    p_tmr->PrevPtr = (OS_TMR *)0;
+    p_tmr->NextPtr = p_tmr2;
+    if (p_tmr2 != (OS_TMR *)0) {
+        p_tmr2->PrevPtr = p_tmr;
+    } else {                                                    /* Spoke is no longer empty                             */
+        p_svc->WheelMap[spoke / (CPU_CFG_DATA_SIZE * 8u)] |= (CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - (spoke % (CPU_CFG_DATA_SIZE * 8u)));
+    }
+    p_svc->Wheel[spoke] = p_tmr;
+#if (OS_CFG_DBG_EN > 0u)
+    p_svc->ListEntries++;
+#endif
+
+    dly = p_tmr->Match - p_svc->TaskTickBase;
+    if ((p_svc->TaskTimeout == 0u) ||                           /* Does the timer expire before the next wake-up?       */
+        (dly < p_svc->TaskTimeout)) {
+        p_svc->TaskTimeout = dly;
+        OS_TmrCondSignal(p_svc);
+    }
+}
+
+#else
 void OS_TmrLink (OS_TMR   *p_tmr,
                  OS_TICK   time)
 {
-    OS_TMR   *p_tmr1;
-    OS_TMR   *p_tmr2;
-    OS_TICK   remain;
-    OS_TICK   delta;
+    OS_TMR_SVC  *p_svc;
+    OS_TMR      *p_tmr1;
+    OS_TMR      *p_tmr2;
+    OS_TICK      remain;
+    OS_TICK      delta;
+    OS_TICK      match;
+#if (OS_CFG_SLACK_EN > 0u)
+    OS_TICK      slack;
+#endif
 
 
-    if (OSTmrListPtr == (OS_TMR *)0) {                          /* Is the list empty?                                   */
+#if (OS_CFG_TICK_RATE_SET_EN > 0u)
+    if (p_tmr->Mult != OSTmrToTicksMult) {                      /* '.Remain' was loaded at a previous tick rate         */
+        p_tmr->Remain = (p_tmr->Remain / p_tmr->Mult) * OSTmrToTicksMult;
+        OS_TmrMultSync(p_tmr);
+    }
+#endif
+    p_svc = OS_TMR_SVC_PTR(p_tmr);
+    if (p_svc->ListPtr == (OS_TMR *)0) {                        /* Is the list empty?                                   */
+        p_tmr->Match      = time + p_tmr->Remain;               /* Absolute tick at which the timer expires             */
         p_tmr->NextPtr    = (OS_TMR *)0;                        /* Yes, this is the first entry                         */
-        p_tmr->PrevPtr    = (OS_TMR *)0;
-        OSTmrListPtr      = p_tmr;
+        p_tmr->PrevPtr      = (OS_TMR *)0;
+        p_svc->ListPtr    = p_tmr;
 #if (OS_CFG_DBG_EN > 0u)
-        OSTmrListEntries  = 1u;
+        p_svc->ListEntries  = 1u;
 #endif
-        OSTmrTaskTickBase = time;
-        OS_TmrCondSignal();
+        p_svc->TaskTickBase = time;
+        OS_TmrCondSignal(p_svc);
 
         return;
     }
 
 #if (OS_CFG_DBG_EN > 0u)
-    OSTmrListEntries++;
+    p_svc->ListEntries++;
 #endif
 
-    delta = (time + p_tmr->Remain) - OSTmrTaskTickBase;
+    delta = (time + p_tmr->Remain) - p_svc->TaskTickBase;
 
-    p_tmr2 = OSTmrListPtr;                                      /* No,  Insert somewhere in the list in delta order     */
+    p_tmr2 = p_svc->ListPtr;                                    /* No,  Insert somewhere in the list in delta order     */
     remain = p_tmr2->Remain;
 
+#if (OS_CFG_SLACK_EN > 0u)
+    slack  = p_tmr->Slack;
+    if ((delta           <     remain) &&                       /* Can we expire together with the current head?        */
+        ((remain - delta) <=    slack)) {
+        delta = remain;
+        slack = 0u;
+    }
+#endif
+
     if ((delta           <     remain) &&
         (p_tmr2->PrevPtr == (OS_TMR *)0)) {                     /* Are we the new head of the list?                     */
+        p_tmr->Match      =  time + p_tmr->Remain;
         p_tmr2->Remain    =  remain - delta;
         p_tmr->PrevPtr    = (OS_TMR *)0;
         p_tmr->NextPtr    =  p_tmr2;
         p_tmr2->PrevPtr   =  p_tmr;
-        OSTmrListPtr      =  p_tmr;
+        p_svc->ListPtr    =  p_tmr;
 
-        OSTmrTaskTickBase = time;
-        OS_TmrCondSignal();
+        p_svc->TaskTickBase = time;
+        OS_TmrCondSignal(p_svc);
 
         return;
     }
 
                                                                 /* No                                                   */
     delta  -= remain;                                           /* Make delta relative to the current head.             */
+    match   = p_tmr2->Match;
     p_tmr1  = p_tmr2;
     p_tmr2  = p_tmr1->NextPtr;
 
@@ -1226,9 +1916,21 @@ void OS_TmrLink (OS_TMR   *p_tmr,
     while ((p_tmr2 !=        (OS_TMR *)0) &&                    /* Find the appropriate position in the delta list.     */
            (delta  >= p_tmr2->Remain)) {
         delta  -= p_tmr2->Remain;                               /* Update our delta as we traverse the list.            */
+        match   = p_tmr2->Match;
+        p_tmr1  = p_tmr2;
+        p_tmr2  = p_tmr2->NextPtr;
+    }
+
+#if (OS_CFG_SLACK_EN > 0u)
+    if ((p_tmr2                   != (OS_TMR *)0) &&            /* Can we expire together with the next entry?          */
+        ((p_tmr2->Remain - delta) <=       slack)) {
+        delta   = 0u;
+        match   = p_tmr2->Match;
         p_tmr1  = p_tmr2;
         p_tmr2  = p_tmr2->NextPtr;
     }
+#endif
+    p_tmr->Match = match + delta;                               /* Absolute tick at which the timer expires             */
 
 
     if (p_tmr2 != (OS_TMR *)0) {                                /* Our entry is not the last element in the list.       */
@@ -1247,6 +1949,7 @@ void OS_TmrLink (OS_TMR   *p_tmr,
         p_tmr1->NextPtr  = p_tmr;
     }
 }
+#endif
 
 
 /*
@@ -1263,58 +1966,101 @@ void OS_TmrLink (OS_TMR   *p_tmr,
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) With the timer wheel, the timer task is not signaled.  If the removed timer was the next one to
+*                 expire, the timer task simply wakes up once without any timer to process.
+*
+*              3) With the delta list, removing the first timer makes the timer task reload its timeout only when the
+*                 new first timer expires later, i.e. has a different '.Match'.  The deltas are then rebased on 'time'.
 ************************************************************************************************************************
 */
 
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+void  OS_TmrUnlink (OS_TMR   *p_tmr,
+                    OS_TICK   time)
+{
+    OS_TMR_SVC  *p_svc;
+    OS_TMR      *p_tmr1;
+    OS_TMR      *p_tmr2;
+    CPU_DATA     spoke;
+
+
+    (void)time;                                                 /* Not using 'time', prevent compiler warning           */
+
+    p_svc  = OS_TMR_SVC_PTR(p_tmr);
+    spoke  = (CPU_DATA)(p_tmr->Match & (OS_CFG_TMR_WHEEL_SIZE - 1u));
+    p_tmr1 = p_tmr->PrevPtr;
+    p_tmr2 = p_tmr->NextPtr;
+    if (p_tmr1 == (OS_TMR *)0) {
+        p_svc->Wheel[spoke] = p_tmr2;
+        if (p_tmr2 == (OS_TMR *)0) {                            /* Spoke is now empty                                   */
+            p_svc->WheelMap[spoke / (CPU_CFG_DATA_SIZE * 8u)] &= ~((CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - (spoke % (CPU_CFG_DATA_SIZE * 8u))));
+        }
+    } else {
+        p_tmr1->NextPtr   = p_tmr2;
+    }
+    if (p_tmr2 != (OS_TMR *)0) {
+        p_tmr2->PrevPtr   = p_tmr1;
+    }
+#if (OS_CFG_DBG_EN > 0u)
+    p_svc->ListEntries--;
+#endif
+    p_tmr->PrevPtr        = (OS_TMR *)0;
+    p_tmr->NextPtr        = (OS_TMR *)0;
+    p_tmr->Remain         =           0u;
+}
+
+#else
 void  OS_TmrUnlink (OS_TMR   *p_tmr,
                     OS_TICK   time)
 {
-    OS_TMR   *p_tmr1;
-    OS_TMR   *p_tmr2;
-    OS_TICK   elapsed;
+    OS_TMR_SVC  *p_svc;
+    OS_TMR      *p_tmr1;
+    OS_TMR      *p_tmr2;
+    OS_TICK      elapsed;
 
 
+    p_svc                           = OS_TMR_SVC_PTR(p_tmr);
     p_tmr1                          = p_tmr->PrevPtr;
     p_tmr2                          = p_tmr->NextPtr;
     if (p_tmr1 == (OS_TMR *)0) {
         if (p_tmr2 == (OS_TMR *)0) {                            /* Remove the ONLY entry in the list?                   */
-            OSTmrListPtr            = (OS_TMR *)0;
+            p_svc->ListPtr          = (OS_TMR *)0;
 #if (OS_CFG_DBG_EN > 0u)
-            OSTmrListEntries        = 0u;
+            p_svc->ListEntries      = 0u;
 #endif
             p_tmr->Remain           = 0u;
 
-            OSTmrTaskTickBase       = time;
-            OS_TmrCondSignal();
+            p_svc->TaskTickBase     = time;
+            OS_TmrCondSignal(p_svc);
         } else {
 #if (OS_CFG_DBG_EN > 0u)
-            OSTmrListEntries--;
+            p_svc->ListEntries--;
 #endif
-            elapsed                 = time - OSTmrTaskTickBase;
             p_tmr2->PrevPtr         = (OS_TMR *)0;
             p_tmr2->Remain         += p_tmr->Remain;            /* Add back the ticks to the delta                      */
-            OSTmrListPtr            = p_tmr2;
+            p_svc->ListPtr          = p_tmr2;
 
-            while ((elapsed >           0u) &&
-                   (p_tmr2  != (OS_TMR *)0)) {
+            if (p_tmr2->Match != p_tmr->Match) {                /* Reload if the new head expires later             ... */
+                elapsed             = time - p_svc->TaskTickBase;
+                while ((elapsed >           0u) &&              /* ... after making the deltas relative to 'time'.      */
+                       (p_tmr2  != (OS_TMR *)0)) {
 
-                if (elapsed > p_tmr2->Remain) {
-                    elapsed        -= p_tmr2->Remain;
-                    p_tmr2->Remain  = 0u;
-                } else {
-                    p_tmr2->Remain -= elapsed;
-                    elapsed         = 0u;
-                }
+                    if (elapsed > p_tmr2->Remain) {
+                        elapsed        -= p_tmr2->Remain;
+                        p_tmr2->Remain  = 0u;
+                    } else {
+                        p_tmr2->Remain -= elapsed;
+                        elapsed         = 0u;
+                    }
 
 
-                p_tmr1              = p_tmr2;
-                p_tmr2              = p_tmr1->NextPtr;
-            }
+                    p_tmr1          = p_tmr2;
+                    p_tmr2          = p_tmr1->NextPtr;
+                }
 
-            if ((OSTmrListPtr->Remain != p_tmr->Remain) ||      /* Reload if new head has a different delay         ... */
-                (OSTmrListPtr->Remain ==            0u)) {      /* ... or has already timed out.                        */
-                OSTmrTaskTickBase   = time;
-                OS_TmrCondSignal();
+                p_svc->TaskTickBase = time;
+                OS_TmrCondSignal(p_svc);
             }
 
             p_tmr->NextPtr          = (OS_TMR *)0;
@@ -1322,7 +2068,7 @@ void  OS_TmrUnlink (OS_TMR   *p_tmr,
         }
     } else {
 #if (OS_CFG_DBG_EN > 0u)
-        OSTmrListEntries--;
+        p_svc->ListEntries--;
 #endif
         p_tmr1->NextPtr             = p_tmr2;
         if (p_tmr2 != (OS_TMR *)0) {
@@ -1334,58 +2080,311 @@ void  OS_TmrUnlink (OS_TMR   *p_tmr,
         p_tmr->Remain               =           0u;
     }
 }
+#endif
 
 
 /*
 ************************************************************************************************************************
-*                                                 TIMER MANAGEMENT TASK
+*                                    LOCK/RESCALE THE TIMER SERVICES ON A TICK RATE CHANGE
 *
-* Description: This task is created by OS_TmrInit().
+* Description: These functions are called by OSTickRateSet().  OS_TmrLockAll() locks every timer service before the
+*              tick rate changes.  OS_TmrRescale() then converts the running timers of each service to the new rate and
+*              unlocks it.
 *
-* Arguments  : none
+* Arguments  : rate_hz_prev   is the tick rate the running timers are expressed at.
 *
-* Returns    : none
+*              rate_hz        is the new tick rate.
 *
-* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+* Returns    : none
 *
-*              2) The timer list is processed in two stages.
-*                   a) Subtract the expired time from the delta list, which leaves expired timers at the head.
-*                   b) Process each of the expired timers by invoking its callback (if any) and removing it.
-*                 This method allows timer callbacks to Link/Unlink timers while maintaining the correct delta values.
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application MUST NOT call them.
 *
-*              3) Timer callbacks are allowed to make calls to the Timer APIs.
+*              2) Each running timer is taken off the list or wheel and linked again with the time left to its '.Match'
+*                 converted to the new rate.  Stopped timers keep '.Dly', '.Period' and '.Slack' at the rate they were
+*                 set at until OS_TmrMultSync() converts them on their next use.
 ************************************************************************************************************************
 */
 
-void  OS_TmrTask (void  *p_arg)
+#if (OS_CFG_TICK_RATE_SET_EN > 0u)
+void  OS_TmrLockAll (void)
 {
-    OS_TMR_CALLBACK_PTR   p_fnct;
-    OS_TMR               *p_tmr;
-    OS_TICK               timeout;
-    OS_TICK               elapsed;
-    OS_TICK               time;
+    OS_TMR_SVC  *p_svc;
+
+
+    p_svc = OSTmrSvcListPtr;
+    while (p_svc != (OS_TMR_SVC *)0) {
+        OS_TmrLock(p_svc);
+        p_svc = p_svc->NextPtr;
+    }
+}
+
+
+void  OS_TmrRescale (OS_RATE_HZ  rate_hz_prev,
+                     OS_RATE_HZ  rate_hz)
+{
+    OS_TMR_SVC  *p_svc;
+    OS_TMR      *p_tmr;
+    OS_TMR      *p_tmr_next;
+    OS_TMR      *p_tmr_list;
+    OS_TICK      remain;
+    OS_TICK      time;
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+    CPU_DATA     i;
+#endif
+    CPU_SR_ALLOC();
+
+
+    OSTmrToTicksMult = rate_hz / OSCfg_TmrTaskRate_Hz;          /* Timer ticks are a fixed amount of time               */
+
+    p_svc = OSTmrSvcListPtr;
+    while (p_svc != (OS_TMR_SVC *)0) {
+        CPU_CRITICAL_ENTER();
+        time = OSTickCtr;
+        CPU_CRITICAL_EXIT();
+
+        p_tmr_list = (OS_TMR *)0;                               /* Take every running timer off the service             */
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+        for (i = 0u; i < OS_CFG_TMR_WHEEL_SIZE; i++) {
+            p_tmr = p_svc->Wheel[i];
+            while (p_tmr != (OS_TMR *)0) {
+                p_tmr_next     = p_tmr->NextPtr;
+                p_tmr->NextPtr = p_tmr_list;
+                p_tmr_list     = p_tmr;
+                p_tmr          = p_tmr_next;
+            }
+            p_svc->Wheel[i]    = (OS_TMR *)0;
+        }
+        for (i = 0u; i < OS_TMR_WHEEL_MAP_SIZE; i++) {
+            p_svc->WheelMap[i] = 0u;
+        }
+        p_svc->TaskTimeout     = 0u;                            /* The first timer linked signals the timer task        */
+#else
+        p_tmr = p_svc->ListPtr;
+        while (p_tmr != (OS_TMR *)0) {
+            p_tmr_next     = p_tmr->NextPtr;
+            p_tmr->NextPtr = p_tmr_list;
+            p_tmr_list     = p_tmr;
+            p_tmr          = p_tmr_next;
+        }
+        p_svc->ListPtr     = (OS_TMR *)0;
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+        p_svc->ListEntries = 0u;
+#endif
+
+        while (p_tmr_list != (OS_TMR *)0) {                     /* Link them again at the new rate                      */
+            p_tmr      = p_tmr_list;
+            p_tmr_list = p_tmr->NextPtr;
+            remain     = p_tmr->Match - time;
+            if ((remain - 1u) >= ((OS_TICK)~(OS_TICK)0u / 2u)) {    /* Due or overdue, expire on the next tick          */
+                remain = 1u;
+            }
+            OS_TmrMultSync(p_tmr);
+            p_tmr->Remain = OS_TickRescale(remain, rate_hz_prev, rate_hz);
+            OS_TmrLink(p_tmr, time);
+        }
+
+        OS_TmrUnlock(p_svc);
+        p_svc = p_svc->NextPtr;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                    CONVERT A TIMER TO THE CURRENT TICKS MULTIPLIER
+*
+* Description: This function converts '.Dly', '.Period' and '.Slack' of a timer to the current OSTmrToTicksMult if the
+*              tick rate changed since they were set.
+*
+* Arguments  : p_tmr          is a pointer to the timer.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The caller must own the lock of the timer's service (or disable interrupts for an ISR timer).
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TICK_RATE_SET_EN > 0u)
+static  void  OS_TmrMultSync (OS_TMR  *p_tmr)
+{
+    if (p_tmr->Mult != OSTmrToTicksMult) {                      /* Values are multiples of the previous multiplier      */
+        p_tmr->Dly    = (p_tmr->Dly    / p_tmr->Mult) * OSTmrToTicksMult;
+        p_tmr->Period = (p_tmr->Period / p_tmr->Mult) * OSTmrToTicksMult;
+#if (OS_CFG_SLACK_EN > 0u)
+        p_tmr->Slack  = (p_tmr->Slack  / p_tmr->Mult) * OSTmrToTicksMult;
+#endif
+        p_tmr->Mult   = OSTmrToTicksMult;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                 TIMER MANAGEMENT TASK
+*
+* Description: This task is created by OS_TmrInit().
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The timer list is processed in two stages.
+*                   a) Subtract the expired time from the delta list, which leaves expired timers at the head.
+*                   b) Process each of the expired timers by invoking its callback (if any) and removing it.
+*                 This method allows timer callbacks to Link/Unlink timers while maintaining the correct delta values.
+*
+*              3) Timer callbacks are allowed to make calls to the Timer APIs.
+*
+*              4) With the timer wheel, only the non-empty spokes for the elapsed ticks are visited.  Since a callback
+*                 may add or remove timers in the spoke being processed, the spoke is scanned again from its head
+*                 after each expired timer.
+*
+*              5) With OS_CFG_TMR_CMD_Q_EN, the queued commands are replayed before the timeout is computed, so a wake-up
+*                 caused by a command is followed by a pass through the timers with no elapsed time.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+void  OS_TmrTask (void  *p_arg)
+{
+    OS_TMR_SVC           *p_svc;
+    OS_TMR_CALLBACK_PTR   p_fnct;
+    OS_TMR               *p_tmr;
+    OS_TICK               timeout;
+    OS_TICK               elapsed;
+    OS_TICK               time;
+    OS_TICK               tick_prev;
+    OS_TICK               tick_first;
+    OS_TICK               nbr_ticks;
+    OS_TICK               dly;
+    CPU_DATA              spoke;
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS                ts_start;
+#endif
+    CPU_SR_ALLOC();
+
+
+    p_svc = (OS_TMR_SVC *)p_arg;                                /* Timer service run by this task                       */
+
+    OS_TmrLock(p_svc);
+
+    for (;;) {
+#if (OS_CFG_TMR_CMD_Q_EN > 0u)
+        OS_TmrCmdProcess(p_svc);                                /* Replay the commands queued by other tasks and ISRs   */
+#endif
+        timeout                    = OS_TmrWheelNextDly(p_svc, p_svc->TaskTickBase);
+        p_svc->TaskTimeout         = timeout;
+
+        OS_TmrCondWait(p_svc, timeout);                         /* Suspend the timer task until it needs to process ... */
+                                                                /* ... the timer wheel again. Also release the mutex... */
+                                                                /* ... so that application tasks can add/remove timers. */
+
+#if (OS_CFG_TS_EN > 0u)
+        ts_start = OS_TS_GET();
+#endif
+
+        CPU_CRITICAL_ENTER();
+#if (OS_CFG_DYN_TICK_EN > 0u)
+        time                       = OSTickCtr + OS_DynTickGet();
+#else
+        time                       = OSTickCtr;
+#endif
+        CPU_CRITICAL_EXIT();
+        tick_prev                  = p_svc->TaskTickBase;
+        tick_first                 = tick_prev + 1u;            /* Ticks tick_first to time are now being processed     */
+        elapsed                    = time - tick_prev;
+        p_svc->TaskTickBase        = time;
+        nbr_ticks                  = (elapsed < OS_CFG_TMR_WHEEL_SIZE) ? elapsed : OS_CFG_TMR_WHEEL_SIZE;
+
+        while (nbr_ticks > 0u) {                                /* Visit each non-empty spoke for the elapsed ticks     */
+            dly = OS_TmrWheelNextDly(p_svc, tick_prev);
+            if ((dly == 0u) || (dly > nbr_ticks)) {
+                break;
+            }
+            tick_prev += dly;
+            nbr_ticks -= dly;
+            spoke      = (CPU_DATA)(tick_prev & (OS_CFG_TMR_WHEEL_SIZE - 1u));
+
+            p_tmr      = p_svc->Wheel[spoke];
+            while (p_tmr != (OS_TMR *)0) {
+                if ((OS_TICK)(p_tmr->Match - tick_first) >= elapsed) {
+                    p_tmr          = p_tmr->NextPtr;            /* Timer expires on a later turn of the wheel           */
+                    continue;
+                }
+
+                p_tmr->State       = OS_TMR_STATE_TIMEOUT;
+                                                                /* Execute callback function if available               */
+                p_fnct             = p_tmr->CallbackPtr;
+                if (p_fnct != (OS_TMR_CALLBACK_PTR)0u) {
+                    (*p_fnct)(p_tmr, p_tmr->CallbackPtrArg);
+                }
+
+                if (p_tmr->State == OS_TMR_STATE_TIMEOUT) {
+                    OS_TmrUnlink(p_tmr, p_svc->TaskTickBase);
+
+                    if (p_tmr->Opt == OS_OPT_TMR_PERIODIC) {
+                        p_tmr->State   = OS_TMR_STATE_RUNNING;
+                        p_tmr->Remain  = p_tmr->Period;
+                        OS_TmrLink(p_tmr, p_svc->TaskTickBase);
+                    } else {
+                        p_tmr->State   = OS_TMR_STATE_COMPLETED;
+                    }
+                }
+
+                p_tmr              = p_svc->Wheel[spoke];       /* Callbacks may have changed the spoke, start over.    */
+            }
+        }
+
+#if (OS_CFG_TS_EN > 0u)
+        p_svc->TaskTime = OS_TS_GET() - ts_start;               /* Measure execution time of timer task                 */
+        if (p_svc->TaskTimeMax < p_svc->TaskTime) {
+            p_svc->TaskTimeMax     = p_svc->TaskTime;
+        }
+#endif
+    }
+}
+
+#else
+void  OS_TmrTask (void  *p_arg)
+{
+    OS_TMR_SVC           *p_svc;
+    OS_TMR_CALLBACK_PTR   p_fnct;
+    OS_TMR               *p_tmr;
+    OS_TICK               timeout;
+    OS_TICK               elapsed;
+    OS_TICK               time;
 #if (OS_CFG_TS_EN > 0u)
     CPU_TS                ts_start;
 #endif
     CPU_SR_ALLOC();
 
 
-    (void)p_arg;                                                /* Not using 'p_arg', prevent compiler warning          */
+    p_svc = (OS_TMR_SVC *)p_arg;                                /* Timer service run by this task                       */
 
-    OS_TmrLock();
+    OS_TmrLock(p_svc);
 
     for (;;) {
-        if (OSTmrListPtr == (OS_TMR *)0) {
+#if (OS_CFG_TMR_CMD_Q_EN > 0u)
+        OS_TmrCmdProcess(p_svc);                                /* Replay the commands queued by other tasks and ISRs   */
+#endif
+        if (p_svc->ListPtr == (OS_TMR *)0) {
             timeout                = 0u;
         } else {
-            timeout                = OSTmrListPtr->Remain;
+            timeout                = p_svc->ListPtr->Remain;
         }
 
-        OS_TmrCondWait(timeout);                                /* Suspend the timer task until it needs to process ... */
+        OS_TmrCondWait(p_svc, timeout);                         /* Suspend the timer task until it needs to process ... */
                                                                 /* ... the timer list again. Also release the mutex ... */
                                                                 /* ... so that application tasks can add/remove timers. */
 
-        if (OSTmrListPtr == (OS_TMR *)0) {                      /* Suppresses static analyzer warnings.                 */
+        if (p_svc->ListPtr == (OS_TMR *)0) {                    /* Suppresses static analyzer warnings.                 */
             continue;
         }
 
@@ -1400,11 +2399,11 @@ void  OS_TmrTask (void  *p_arg)
         time                       = OSTickCtr;
 #endif
         CPU_CRITICAL_EXIT();
-        elapsed                    = time - OSTmrTaskTickBase;
-        OSTmrTaskTickBase          = time;
+        elapsed                    = time - p_svc->TaskTickBase;
+        p_svc->TaskTickBase        = time;
 
                                                                 /* Update the delta values.                             */
-        p_tmr = OSTmrListPtr;
+        p_tmr = p_svc->ListPtr;
         while ((elapsed !=          0u) &&
                (p_tmr   != (OS_TMR *)0)) {
 
@@ -1420,7 +2419,7 @@ void  OS_TmrTask (void  *p_arg)
         }
 
                                                                 /* Process timers that have expired.                    */
-        p_tmr                      = OSTmrListPtr;
+        p_tmr                      = p_svc->ListPtr;
 
         while ((p_tmr         != (OS_TMR *)0) &&
                (p_tmr->Remain ==          0u)) {
@@ -1432,12 +2431,12 @@ void  OS_TmrTask (void  *p_arg)
             }
 
             if (p_tmr->State == OS_TMR_STATE_TIMEOUT) {
-                OS_TmrUnlink(p_tmr, OSTmrTaskTickBase);
+                OS_TmrUnlink(p_tmr, p_svc->TaskTickBase);
 
                 if (p_tmr->Opt == OS_OPT_TMR_PERIODIC) {
                     p_tmr->State   = OS_TMR_STATE_RUNNING;
                     p_tmr->Remain  = p_tmr->Period;
-                    OS_TmrLink(p_tmr, OSTmrTaskTickBase);
+                    OS_TmrLink(p_tmr, p_svc->TaskTickBase);
                 } else {
                     p_tmr->PrevPtr = (OS_TMR *)0;
                     p_tmr->NextPtr = (OS_TMR *)0;
@@ -1446,17 +2445,160 @@ void  OS_TmrTask (void  *p_arg)
                 }
             }
 
-            p_tmr                  = OSTmrListPtr;
+            p_tmr                  = p_svc->ListPtr;
         }
 
 #if (OS_CFG_TS_EN > 0u)
-        OSTmrTaskTime = OS_TS_GET() - ts_start;                 /* Measure execution time of timer task                 */
-        if (OSTmrTaskTimeMax < OSTmrTaskTime) {
-            OSTmrTaskTimeMax       = OSTmrTaskTime;
+        p_svc->TaskTime = OS_TS_GET() - ts_start;               /* Measure execution time of timer task                 */
+        if (p_svc->TaskTimeMax < p_svc->TaskTime) {
+            p_svc->TaskTimeMax     = p_svc->TaskTime;
         }
 #endif
     }
 }
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                            INITIALIZE A TIMER SERVICE
+*
+* Description: This function initializes the timer list or wheel, the lock and the condition variable of a timer
+*              service and creates the task that runs it.
+*
+* Arguments  : p_svc          is a pointer to the timer service to initialize.
+*
+*              p_name         is the name of the timer task.
+*
+*              p_tcb          is a pointer to the TCB of the timer task.
+*
+*              prio           is the priority of the timer task.
+*
+*              p_stk_base     is a pointer to the base of the stack of the timer task.
+*
+*              stk_limit      is the stack limit of the timer task.
+*
+*              stk_size       is the size of the stack of the timer task.
+*
+*              p_err          is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                 OS_ERR_NONE                  The timer service was initialized
+*                                 OS_ERR_TMR_STK_INVALID       If 'p_stk_base' is a NULL pointer
+*                                 OS_ERR_TMR_STK_SIZE_INVALID  If the stack is smaller than OSCfg_StkSizeMin
+*                                 OS_ERR_TMR_PRIO_INVALID      If 'prio' is the priority of the idle task
+*                                 OS_ERR_xxx                   Any error code returned by OSTaskCreate()
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_TmrSvcInit (OS_TMR_SVC    *p_svc,
+                             CPU_CHAR      *p_name,
+                             OS_TCB        *p_tcb,
+                             OS_PRIO        prio,
+                             CPU_STK       *p_stk_base,
+                             CPU_STK_SIZE   stk_limit,
+                             CPU_STK_SIZE   stk_size,
+                             OS_ERR        *p_err)
+{
+#if (OS_CFG_TMR_WHEEL_EN > 0u) || (OS_CFG_TMR_CMD_Q_EN > 0u)
+    CPU_DATA  i;
+#endif
+    CPU_SR_ALLOC();
+
+
+
+    if (p_stk_base == (CPU_STK *)0) {
+       *p_err = OS_ERR_TMR_STK_INVALID;
+        return;
+    }
+
+    if (stk_size < OSCfg_StkSizeMin) {
+       *p_err = OS_ERR_TMR_STK_SIZE_INVALID;
+        return;
+    }
+
+    if (prio >= (OS_CFG_PRIO_MAX - 1u)) {
+       *p_err = OS_ERR_TMR_PRIO_INVALID;
+        return;
+    }
+
+    p_svc->TaskTCBPtr      = p_tcb;
+#if (OS_CFG_DBG_EN > 0u)
+    p_svc->NamePtr         = p_name;
+#endif
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+    for (i = 0u; i < OS_CFG_TMR_WHEEL_SIZE; i++) {              /* Create an empty timer wheel                          */
+        p_svc->Wheel[i]    = (OS_TMR *)0;
+    }
+    for (i = 0u; i < OS_TMR_WHEEL_MAP_SIZE; i++) {
+        p_svc->WheelMap[i] =           0u;
+    }
+    p_svc->TaskTimeout     =           0u;
+#else
+    p_svc->ListPtr         = (OS_TMR *)0;                       /* Create an empty timer list                           */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_svc->ListEntries     =           0u;
+#endif
+#if (OS_CFG_TMR_CMD_Q_EN > 0u)
+    for (i = 0u; i < OS_CFG_TMR_CMD_Q_SIZE; i++) {              /* Every slot is free for the first round               */
+        p_svc->CmdQ[i].Seq =           i;
+    }
+    p_svc->CmdQInIx        =           0u;
+    p_svc->CmdQOutIx       =           0u;
+#endif
+#if (OS_CFG_TS_EN > 0u)
+    p_svc->TaskTime        =           0u;
+    p_svc->TaskTimeMax     =           0u;
+#endif
+
+    CPU_CRITICAL_ENTER();                                       /* Services created at run-time start at current tick   */
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    p_svc->TaskTickBase    = OSTickCtr + OS_DynTickGet();
+#else
+    p_svc->TaskTickBase    = OSTickCtr;
+#endif
+    CPU_CRITICAL_EXIT();
+
+    OSMutexCreate(&p_svc->Mutex,                                /* Use a mutex to protect the timers                    */
+#if  (OS_CFG_DBG_EN == 0u)
+                  (CPU_CHAR *)0,
+#else
+                  (CPU_CHAR *)"OS Tmr Mutex",
+#endif
+                  p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+    OS_TmrCondCreate(p_svc);
+                                                                /* -------------- CREATE THE TIMER TASK --------------- */
+    OSTaskCreate(p_tcb,
+                 p_name,
+                 OS_TmrTask,
+                (void *)p_svc,
+                 prio,
+                 p_stk_base,
+                 stk_limit,
+                 stk_size,
+                 0u,
+                 0u,
+                (void *)0,
+                (OS_OPT_TASK_STK_CHK | (OS_OPT)(OS_OPT_TASK_STK_CLR | OS_OPT_TASK_NO_TLS)),
+                 p_err);
+
+#if (OS_CFG_TICK_RATE_SET_EN > 0u)
+    if (*p_err == OS_ERR_NONE) {
+        CPU_CRITICAL_ENTER();                                   /* Let OSTickRateSet() find the service                 */
+        p_svc->NextPtr  = OSTmrSvcListPtr;
+        OSTmrSvcListPtr = p_svc;
+        CPU_CRITICAL_EXIT();
+    }
+#endif
+}
 
 
 /*
@@ -1464,9 +2606,9 @@ void  OS_TmrTask (void  *p_arg)
 *                                          TIMER MANAGEMENT LOCKING MECHANISM
 *
 * Description: These functions are used to handle timer critical sections.  The method uses a mutex
-*              to protect access to the global timer list.
+*              to protect access to the timer list of a timer service.
 *
-* Arguments  : none
+* Arguments  : p_svc          is a pointer to the timer service.
 *
 * Returns    : none
 *
@@ -1474,21 +2616,21 @@ void  OS_TmrTask (void  *p_arg)
 ************************************************************************************************************************
 */
 
-static  void  OS_TmrLock (void)
+static  void  OS_TmrLock (OS_TMR_SVC  *p_svc)
 {
     OS_ERR  err;
 
 
-    OSMutexPend(&OSTmrMutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+    OSMutexPend(&p_svc->Mutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
 }
 
 
-static  void  OS_TmrUnlock (void)
+static  void  OS_TmrUnlock (OS_TMR_SVC  *p_svc)
 {
     OS_ERR  err;
 
 
-    OSMutexPost(&OSTmrMutex, OS_OPT_POST_NONE, &err);
+    OSMutexPost(&p_svc->Mutex, OS_OPT_POST_NONE, &err);
 }
 
 
@@ -1498,7 +2640,7 @@ static  void  OS_TmrUnlock (void)
 *
 * Description: Initializes a condition variable for INTERNAL use ONLY.
 *
-* Arguments  : none
+* Arguments  : p_svc                     The timer service owning the condition variable.
 *
 * Returns    : none
 *
@@ -1506,17 +2648,17 @@ static  void  OS_TmrUnlock (void)
 ************************************************************************************************************************
 */
 
-static  void  OS_TmrCondCreate (void)
+static  void  OS_TmrCondCreate (OS_TMR_SVC  *p_svc)
 {
     CPU_SR_ALLOC();
 
 
     CPU_CRITICAL_ENTER();
 #if (OS_OBJ_TYPE_REQ > 0u)
-    OSTmrCond.Type  = OS_OBJ_TYPE_COND;                         /* Mark the data structure as a condition variable.     */
+    p_svc->Cond.Type  = OS_OBJ_TYPE_COND;                       /* Mark the data structure as a condition variable.     */
 #endif
-    OSTmrCond.Mutex = &OSTmrMutex;                              /* Bind the timer mutex to the condition variable.      */
-    OS_PendListInit(&OSTmrCond.PendList);                       /* Initialize the waiting list                          */
+    p_svc->Cond.Mutex = &p_svc->Mutex;                          /* Bind the timer mutex to the condition variable.      */
+    OS_PendListInit(&p_svc->Cond.PendList);                     /* Initialize the waiting list                          */
     CPU_CRITICAL_EXIT();
 }
 
@@ -1529,7 +2671,9 @@ static  void  OS_TmrCondCreate (void)
 *              timers are only added/removed after the timer task has processed the current list and pended
 *              for the next timeout. The timer task will always acquire the mutex before returning from this function.
 *
-* Arguments  : timeout                   The number of ticks before the timer task will wake up.
+* Arguments  : p_svc                     The timer service of the calling timer task.
+*
+*              timeout                   The number of ticks before the timer task will wake up.
 *                                        A value of zero signifies an indefinite pend.
 *
 * Returns    : none
@@ -1538,7 +2682,8 @@ static  void  OS_TmrCondCreate (void)
 ************************************************************************************************************************
 */
 
-static  void  OS_TmrCondWait (OS_TICK  timeout)
+static  void  OS_TmrCondWait (OS_TMR_SVC  *p_svc,
+                              OS_TICK      timeout)
 {
     OS_TCB        *p_tcb;
     OS_PEND_LIST  *p_pend_list;
@@ -1547,40 +2692,49 @@ static  void  OS_TmrCondWait (OS_TICK  timeout)
 
 
     CPU_CRITICAL_ENTER();
+#if (OS_CFG_TMR_CMD_Q_EN > 0u)                                  /* Commands published since the queue was drained?      */
+    if (p_svc->CmdQ[p_svc->CmdQOutIx & (OS_CFG_TMR_CMD_Q_SIZE - 1u)].Seq == (p_svc->CmdQOutIx + 1u)) {
+        CPU_CRITICAL_EXIT();
+        return;                                                 /* Yes, don't wait for a signal that was already sent   */
+    }
+#endif
 #if (OS_CFG_TS_EN > 0u)
-    ts             = OS_TS_GET();                               /* Get timestamp                                        */
-    OSTmrMutex.TS  = ts;
+    ts              = OS_TS_GET();                              /* Get timestamp                                        */
+    p_svc->Mutex.TS = ts;
 #else
-    ts             = 0u;
+    ts              = 0u;
 #endif
                                                                 /* Release mutex to other tasks.                        */
-    OS_MutexGrpRemove(&OSTmrTaskTCB, &OSTmrMutex);
-    p_pend_list                    = &OSTmrMutex.PendList;
+    OS_MutexGrpRemove(p_svc->TaskTCBPtr, &p_svc->Mutex);
+    p_pend_list = &p_svc->Mutex.PendList;
 
-    if (OSTmrTaskTCB.Prio != OSTmrTaskTCB.BasePrio) {           /* Restore our original prio.                           */
-        OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(&OSTmrTaskTCB, OSTmrTaskTCB.Prio);
-        OSTmrTaskTCB.Prio          = OSTmrTaskTCB.BasePrio;
-        OSPrioCur                  = OSTmrTaskTCB.BasePrio;
+    if (p_svc->TaskTCBPtr->Prio != p_svc->TaskTCBPtr->BasePrio) { /* Restore our original prio.                         */
+        OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_svc->TaskTCBPtr, p_svc->TaskTCBPtr->Prio);
+        p_svc->TaskTCBPtr->Prio = p_svc->TaskTCBPtr->BasePrio;
+        OSPrioCur               = p_svc->TaskTCBPtr->BasePrio;
     }
 
     if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on mutex?                           */
-        OSTmrMutex.OwnerTCBPtr     = (OS_TCB *)0;               /* No                                                   */
-        OSTmrMutex.OwnerNestingCtr =           0u;
+        p_svc->Mutex.OwnerTCBPtr     = (OS_TCB *)0;             /* No                                                   */
+        p_svc->Mutex.OwnerNestingCtr =           0u;
     } else {
-        p_tcb                      = p_pend_list->HeadPtr;      /* Yes, give mutex to new owner                         */
-        OSTmrMutex.OwnerTCBPtr     = p_tcb;
-        OSTmrMutex.OwnerNestingCtr =           1u;
-        OS_MutexGrpAdd(p_tcb, &OSTmrMutex);
+        p_tcb                        = p_pend_list->HeadPtr;    /* Yes, give mutex to new owner                         */
+        p_svc->Mutex.OwnerTCBPtr     = p_tcb;
+        p_svc->Mutex.OwnerNestingCtr =           1u;
+#if (OS_CFG_MUTEX_BLOCK_STAT_EN > 0u)
+        p_svc->Mutex.OwnerTS         = ts;
+#endif
+        OS_MutexGrpAdd(p_tcb, &p_svc->Mutex);
                                                                 /* Post to mutex                                        */
-        OS_Post((OS_PEND_OBJ *)((void *)&OSTmrMutex),
+        OS_Post((OS_PEND_OBJ *)((void *)&p_svc->Mutex),
                                          p_tcb,
                                 (void *) 0,
                                          0u,
                                          ts);
     }
 
-    OS_Pend((OS_PEND_OBJ *)((void *)&OSTmrCond),                /* Pend on the condition variable.                      */
-                                   &OSTmrTaskTCB,
+    OS_Pend((OS_PEND_OBJ *)((void *)&p_svc->Cond),              /* Pend on the condition variable.                      */
+                                   p_svc->TaskTCBPtr,
                                     OS_TASK_PEND_ON_COND,
                                     timeout);
     CPU_CRITICAL_EXIT();
@@ -1589,19 +2743,27 @@ static  void  OS_TmrCondWait (OS_TICK  timeout)
 
     CPU_CRITICAL_ENTER();                                       /* Either we timed out, or were signaled.               */
 
-    if (OSTmrMutex.OwnerTCBPtr == (OS_TCB *)0) {                /* Can we grab the mutex?                               */
-        OS_MutexGrpAdd(&OSTmrTaskTCB, &OSTmrMutex);             /* Yes, no-one else pending.                            */
-        OSTmrMutex.OwnerTCBPtr     = &OSTmrTaskTCB;
-        OSTmrMutex.OwnerNestingCtr = 1u;
+    if (p_svc->Mutex.OwnerTCBPtr == (OS_TCB *)0) {              /* Can we grab the mutex?                               */
+        OS_MutexGrpAdd(p_svc->TaskTCBPtr, &p_svc->Mutex);       /* Yes, no-one else pending.                            */
+        p_svc->Mutex.OwnerTCBPtr     = p_svc->TaskTCBPtr;
+        p_svc->Mutex.OwnerNestingCtr = 1u;
+#if (OS_CFG_MUTEX_BLOCK_STAT_EN > 0u)
+        p_svc->Mutex.OwnerTS         = OS_TS_GET();
+#endif
         CPU_CRITICAL_EXIT();
     } else {
-        p_tcb = OSTmrMutex.OwnerTCBPtr;                         /* No, we need to wait for it.                          */
-        if (p_tcb->Prio > OSTmrTaskTCB.Prio) {                  /* See if mutex owner has a lower priority than TmrTask.*/
-            OS_TaskChangePrio(p_tcb, OSTmrTaskTCB.Prio);
+        p_tcb = p_svc->Mutex.OwnerTCBPtr;                       /* No, we need to wait for it.                          */
+#if (OS_MUTEX_FAST_EN > 0u)
+        if (p_svc->Mutex.GrpLinked == OS_FALSE) {               /* Owner claimed it with the fast path?                 */
+            OS_MutexGrpAdd(p_tcb, &p_svc->Mutex);
+        }
+#endif
+        if (p_tcb->Prio > p_svc->TaskTCBPtr->Prio) {            /* See if mutex owner has a lower priority than TmrTask.*/
+            OS_TaskChangePrio(p_tcb, p_svc->TaskTCBPtr->Prio);
         }
 
-        OS_Pend((OS_PEND_OBJ *)((void *)&OSTmrMutex),           /* Block TmrTask until it gets the Mutex.               */
-                                        &OSTmrTaskTCB,
+        OS_Pend((OS_PEND_OBJ *)((void *)&p_svc->Mutex),         /* Block TmrTask until it gets the Mutex.               */
+                                        p_svc->TaskTCBPtr,
                                          OS_TASK_PEND_ON_MUTEX,
                                          0u);
         CPU_CRITICAL_EXIT();
@@ -1618,7 +2780,7 @@ static  void  OS_TmrCondWait (OS_TICK  timeout)
 * Description: Used to signal the timer task when a timer is added/removed which requires the task to reload
 *              its timeout. We ensure that this function is always called with the timer mutex locked.
 *
-* Arguments  : none.
+* Arguments  : p_svc                     The timer service whose task is signaled.
 *
 * Returns    : none
 *
@@ -1626,7 +2788,7 @@ static  void  OS_TmrCondWait (OS_TICK  timeout)
 ************************************************************************************************************************
 */
 
-static  void  OS_TmrCondSignal (void)
+static  void  OS_TmrCondSignal (OS_TMR_SVC  *p_svc)
 {
     OS_PEND_LIST  *p_pend_list;
     CPU_TS         ts;
@@ -1635,21 +2797,21 @@ static  void  OS_TmrCondSignal (void)
 
     CPU_CRITICAL_ENTER();
 #if (OS_CFG_TS_EN > 0u)
-    ts             = OS_TS_GET();                               /* Get timestamp                                        */
-    OSTmrMutex.TS  = ts;
+    ts              = OS_TS_GET();                              /* Get timestamp                                        */
+    p_svc->Mutex.TS = ts;
 #else
     ts             = 0u;
 #endif
 
-    p_pend_list    = &OSTmrCond.PendList;
+    p_pend_list    = &p_svc->Cond.PendList;
 
     if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Timer task waiting on cond?                          */
         CPU_CRITICAL_EXIT();
         return;                                                 /* No, nothing to signal.                               */
     } else {
                                                                 /* Yes, signal the timer task.                          */
-        OS_Post((OS_PEND_OBJ *)((void *)&OSTmrCond),
-                                        &OSTmrTaskTCB,
+        OS_Post((OS_PEND_OBJ *)((void *)&p_svc->Cond),
+                                        p_svc->TaskTCBPtr,
                                 (void *) 0,
                                          0u,
                                          ts);
@@ -1657,4 +2819,574 @@ static  void  OS_TmrCondSignal (void)
 
     CPU_CRITICAL_EXIT();
 }
+
+
+/*
+************************************************************************************************************************
+*                                          FIND THE NEXT NON-EMPTY TIMER WHEEL SPOKE
+*
+* Description: This function returns the number of ticks from 'tick' until the timer wheel reaches a spoke holding at
+*              least one timer.
+*
+* Arguments  : p_svc          is a pointer to the timer service owning the wheel.
+*
+*              tick           is the tick from which the distance is measured.
+*
+* Returns    : The number of ticks (1 to OS_CFG_TMR_WHEEL_SIZE) to the next non-empty spoke, or 0 if the timer wheel is
+*              empty.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TMR_WHEEL_EN > 0u)
+static  OS_TICK  OS_TmrWheelNextDly (OS_TMR_SVC  *p_svc,
+                                     OS_TICK      tick)
+{
+    CPU_DATA  spoke_first;
+    CPU_DATA  spoke;
+    CPU_DATA  ix;
+    CPU_DATA  map;
+    CPU_DATA  i;
+
+
+    spoke_first = (CPU_DATA)((tick + 1u) & (OS_CFG_TMR_WHEEL_SIZE - 1u));
+    ix          = spoke_first / (CPU_CFG_DATA_SIZE * 8u);
+    map         = p_svc->WheelMap[ix] & ((CPU_DATA)~(CPU_DATA)0u >> (spoke_first % (CPU_CFG_DATA_SIZE * 8u)));
+
+    for (i = 0u; i <= OS_TMR_WHEEL_MAP_SIZE; i++) {             /* Last pass wraps around to the start of the first word*/
+        if (map != 0u) {
+            spoke = (ix * (CPU_CFG_DATA_SIZE * 8u)) + (CPU_DATA)CPU_CntLeadZeros(map);
+            return ((OS_TICK)((spoke - spoke_first) & (OS_CFG_TMR_WHEEL_SIZE - 1u)) + 1u);
+        }
+        ix++;
+        if (ix >= OS_TMR_WHEEL_MAP_SIZE) {
+            ix = 0u;
+        }
+        map = p_svc->WheelMap[ix];
+    }
+
+    return (0u);                                                /* Timer wheel is empty                                 */
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                          QUEUE A COMMAND TO THE TIMER TASK
+*
+* Description: This function records a start, stop or set of a timer in the command queue of its timer service and
+*              signals the timer task of the service, which replays the command with OS_TmrCmdProcess().
+*
+* Arguments  : p_tmr           is a pointer to the timer.
+*
+*              cmd             is the command (OS_TMR_CMD_START, OS_TMR_CMD_STOP or OS_TMR_CMD_SET).
+*
+*              opt             is the option given to OSTmrStop().
+*
+*              dly             are the delay and the period given to OSTmrSet().
+*              period
+*
+*              p_callback      is the callback given to OSTmrSet().
+*
+*              p_callback_arg  is the callback argument given to OSTmrSet() or OSTmrStop().
+*
+*              p_err           is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                  OS_ERR_NONE                The command was queued
+*                                  OS_ERR_TMR_CMD_Q_FULL      If the timer task has not yet replayed the queued commands
+*
+* Returns    : OS_TRUE   if the command was queued
+*              OS_FALSE  if not
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) A slot is reserved by advancing 'CmdQInIx' and only published, by writing its '.Seq', once it has been
+*                 filled (see  TIMER DATA TYPES  Note #2).  Interrupts are thus never disabled while the slot is
+*                 written, and not at all to reserve it when OS_TMR_CMD_LOCK_FREE_EN is enabled.
+*
+*              3) In the lock-free path, a '.Seq' ahead of the index that was read means that another producer has
+*                 published that slot in the meantime, so the reservation is retried with the new index.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TMR_CMD_Q_EN > 0u)
+static  CPU_BOOLEAN  OS_TmrCmdPost (OS_TMR               *p_tmr,
+                                    CPU_INT08U            cmd,
+                                    OS_OPT                opt,
+                                    OS_TICK               dly,
+                                    OS_TICK               period,
+                                    OS_TMR_CALLBACK_PTR   p_callback,
+                                    void                 *p_callback_arg,
+                                    OS_ERR               *p_err)
+{
+    OS_TMR_SVC            *p_svc;
+    OS_TMR_CMD   volatile *p_cmd;
+    CPU_DATA               ix;
+#if (OS_TMR_CMD_LOCK_FREE_EN == 0u)
+    CPU_SR_ALLOC();
+#endif
+
+
+    p_svc = OS_TMR_SVC_PTR(p_tmr);
+#if (OS_TMR_CMD_LOCK_FREE_EN > 0u)
+    for (;;) {                                                  /* Reserve a slot (see Note #2)                         */
+        ix    = OS_CPU_DataLoadExcl(&p_svc->CmdQInIx);
+        p_cmd = &p_svc->CmdQ[ix & (OS_CFG_TMR_CMD_Q_SIZE - 1u)];
+        if (p_cmd->Seq == ix) {                                 /* Slot was handed back by the timer task?              */
+            if (OS_CPU_DataStoreExcl(&p_svc->CmdQInIx, ix + 1u) == OS_TRUE) {
+                break;
+            }
+        } else if (p_cmd->Seq != (ix + 1u)) {                   /* Not yet replayed, the queue is full (see Note #3)    */
+           *p_err = OS_ERR_TMR_CMD_Q_FULL;
+            return (OS_FALSE);
+        }
+    }
+#else
+    CPU_CRITICAL_ENTER();                                       /* Reserve a slot (see Note #2)                         */
+    ix    = p_svc->CmdQInIx;
+    p_cmd = &p_svc->CmdQ[ix & (OS_CFG_TMR_CMD_Q_SIZE - 1u)];
+    if (p_cmd->Seq != ix) {                                     /* Not yet replayed, the queue is full                  */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_TMR_CMD_Q_FULL;
+        return (OS_FALSE);
+    }
+    p_svc->CmdQInIx = ix + 1u;
+    CPU_CRITICAL_EXIT();
+#endif
+
+    p_cmd->TmrPtr         = p_tmr;                              /* Fill the slot ...                                    */
+    p_cmd->Cmd            = cmd;
+    p_cmd->Opt            = opt;
+    p_cmd->Dly            = dly;
+    p_cmd->Period         = period;
+    p_cmd->CallbackPtr    = p_callback;
+    p_cmd->CallbackPtrArg = p_callback_arg;
+    p_cmd->Seq            = ix + 1u;                            /* ... and publish it                                   */
+
+    OS_TmrCondSignal(p_svc);                                    /* Wake up the timer task if it is waiting              */
+    if (OSIntNestingCtr == 0u) {                                /* ISRs leave rescheduling to OSIntExit()               */
+        OSSched();
+    }
+
+   *p_err = OS_ERR_NONE;
+    return (OS_TRUE);
+}
+
+
+/*
+************************************************************************************************************************
+*                                      REPLAY THE COMMANDS QUEUED TO THE TIMER TASK
+*
+* Description: This function is called by the timer task to perform, in order, the commands queued by
+*              OS_TmrCmdPost().
+*
+* Arguments  : p_svc          is a pointer to the timer service of the calling timer task.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The commands are performed by calling OSTmrStart(), OSTmrStop() or OSTmrSet() from the timer task,
+*                 which still owns the timer mutex, so the usual validation applies.  Errors are ignored since the
+*                 caller that queued the command has already returned.  A command for a timer deleted in the meantime
+*                 is rejected because the timer is no longer in use.
+*
+*              3) The slot is handed back before the command is performed, so that a callback run by OSTmrStop() may
+*                 itself queue commands.
+************************************************************************************************************************
+*/
+
+static  void  OS_TmrCmdProcess (OS_TMR_SVC  *p_svc)
+{
+    OS_TMR_CMD   volatile *p_cmd;
+    OS_TMR_CMD             cmd;
+    CPU_DATA               ix;
+    OS_ERR                 err;
+
+
+    for (;;) {
+        ix    = p_svc->CmdQOutIx;
+        p_cmd = &p_svc->CmdQ[ix & (OS_CFG_TMR_CMD_Q_SIZE - 1u)];
+        if (p_cmd->Seq != (ix + 1u)) {                          /* Stop at the first slot that is not published         */
+            break;
+        }
+        cmd              = *p_cmd;
+        p_cmd->Seq       = ix + OS_CFG_TMR_CMD_Q_SIZE;          /* Hand the slot back to the producers (see Note #3)    */
+        p_svc->CmdQOutIx = ix + 1u;
+
+        switch (cmd.Cmd) {
+            case OS_TMR_CMD_START:
+                 (void)OSTmrStart(cmd.TmrPtr, &err);
+                 break;
+
+            case OS_TMR_CMD_STOP:
+                 (void)OSTmrStop(cmd.TmrPtr, cmd.Opt, cmd.CallbackPtrArg, &err);
+                 break;
+
+            case OS_TMR_CMD_SET:
+                 OSTmrSet(cmd.TmrPtr, cmd.Dly, cmd.Period, cmd.CallbackPtr, cmd.CallbackPtrArg, &err);
+                 break;
+
+            default:
+                 break;
+        }
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                          ADD/REMOVE AN ISR TIMER TO/FROM THE LIST
+*
+* Description: These functions insert an ISR timer in OSTmrIsrListPtr, sorted by 'TsMatch', or remove it.
+*
+* Arguments  : p_tmr          is a pointer to the timer.
+*
+* Returns    : none
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application MUST NOT call them.
+*
+*              2) These functions must be called with interrupts disabled.
+*
+*              3) The compare timer is reprogrammed when the timer becomes the first of the list.  It is not when the
+*                 first timer is removed; the resulting early interrupt finds nothing to expire.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TMR_ISR_EN > 0u)
+static  void  OS_TmrIsrLink (OS_TMR  *p_tmr)
+{
+    OS_TMR  *p_tmr1;
+    OS_TMR  *p_tmr2;
+
+
+    p_tmr1 = (OS_TMR *)0;
+    p_tmr2 = OSTmrIsrListPtr;
+    while ((p_tmr2 != (OS_TMR *)0) &&                           /* Skip the timers expiring no later than this one      */
+           ((CPU_TS)(p_tmr->TsMatch - p_tmr2->TsMatch) <= OS_TICK_HR_DLY_MAX)) {
+        p_tmr1 = p_tmr2;
+        p_tmr2 = p_tmr2->NextPtr;
+    }
+
+    p_tmr->PrevPtr = p_tmr1;
+    p_tmr->NextPtr = p_tmr2;
+    if (p_tmr2 != (OS_TMR *)0) {
+        p_tmr2->PrevPtr = p_tmr;
+    }
+
+    if (p_tmr1 == (OS_TMR *)0) {                                /* A new earliest deadline must be programmed           */
+        OSTmrIsrListPtr = p_tmr;
+        OS_TickHrSetNext();
+    } else {
+        p_tmr1->NextPtr = p_tmr;
+    }
+}
+
+
+static  void  OS_TmrIsrUnlink (OS_TMR  *p_tmr)
+{
+    OS_TMR  *p_tmr1;
+    OS_TMR  *p_tmr2;
+
+
+    p_tmr1 = p_tmr->PrevPtr;
+    p_tmr2 = p_tmr->NextPtr;
+    if (p_tmr1 == (OS_TMR *)0) {
+        OSTmrIsrListPtr = p_tmr2;
+    } else {
+        p_tmr1->NextPtr = p_tmr2;
+    }
+    if (p_tmr2 != (OS_TMR *)0) {
+        p_tmr2->PrevPtr = p_tmr1;
+    }
+    p_tmr->PrevPtr = (OS_TMR *)0;
+    p_tmr->NextPtr = (OS_TMR *)0;
+}
+
+
+/*
+************************************************************************************************************************
+*                                       GET THE TIME LEFT BEFORE AN ISR TIMER EXPIRES
+*
+* Description: This function is called by OSTmrRemainGet() for the timers created with OS_OPT_TMR_ISR.
+*
+* Arguments  : p_tmr          is a pointer to the timer.
+*
+*              p_err          is a pointer to an error code (see OSTmrRemainGet()).
+*
+* Returns    : The time remaining before the timer expires, in microseconds.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  OS_TICK  OS_TmrIsrRemainGet (OS_TMR  *p_tmr,
+                                     OS_ERR  *p_err)
+{
+    CPU_TS_TMR_FREQ  freq;
+    CPU_ERR          err;
+    CPU_TS           remain;
+    CPU_SR_ALLOC();
+
+
+    remain = 0u;
+    CPU_CRITICAL_ENTER();
+    switch (p_tmr->State) {
+        case OS_TMR_STATE_RUNNING:
+             remain = p_tmr->TsMatch - OS_TS_GET();
+             if (remain > OS_TICK_HR_DLY_MAX) {                 /* Deadline passed, the ISR is about to run             */
+                 remain = 0u;
+             }
+            *p_err  = OS_ERR_NONE;
+             break;
+
+        case OS_TMR_STATE_STOPPED:                              /* It's assumed that the timer has not started yet      */
+             if (p_tmr->TsDly == 0u) {
+                 remain = p_tmr->TsPeriod;
+             } else {
+                 remain = p_tmr->TsDly;
+             }
+            *p_err  = OS_ERR_NONE;
+             break;
+
+        case OS_TMR_STATE_COMPLETED:
+            *p_err  = OS_ERR_NONE;
+             break;
+
+        case OS_TMR_STATE_UNUSED:
+            *p_err  = OS_ERR_TMR_INACTIVE;
+             break;
+
+        default:
+            *p_err  = OS_ERR_TMR_INVALID_STATE;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+
+    freq = CPU_TS_TmrFreqGet(&err);                             /* Convert back to microseconds                         */
+    if ((err != CPU_ERR_NONE) || (freq == 0u)) {
+        return (0u);
+    }
+
+    return ((OS_TICK)(((CPU_INT64U)remain * 1000000u) / (CPU_INT64U)freq));
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 START AN ISR TIMER
+*
+* Description: This function is called by OSTmrStart() for the timers created with OS_OPT_TMR_ISR.  The delay is
+*              measured from the time of the call.
+*
+* Arguments  : p_tmr          is a pointer to the timer.
+*
+*              p_err          is a pointer to an error code (see OSTmrStart()).
+*
+* Returns    : OS_TRUE   if the timer was started
+*              OS_FALSE  if not
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  OS_TmrIsrStart (OS_TMR  *p_tmr,
+                                     OS_ERR  *p_err)
+{
+    CPU_BOOLEAN  success;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    switch (p_tmr->State) {
+        case OS_TMR_STATE_RUNNING:                              /* Restart the timer or ...                             */
+        case OS_TMR_STATE_STOPPED:                              /* ... start it                                         */
+        case OS_TMR_STATE_COMPLETED:
+             if (p_tmr->State == OS_TMR_STATE_RUNNING) {
+                 OS_TmrIsrUnlink(p_tmr);                        /* Remove from current position in the list             */
+             }
+             if (p_tmr->TsDly == 0u) {
+                 p_tmr->TsMatch = OS_TS_GET() + p_tmr->TsPeriod;
+             } else {
+                 p_tmr->TsMatch = OS_TS_GET() + p_tmr->TsDly;
+             }
+             p_tmr->State = OS_TMR_STATE_RUNNING;
+             OS_TmrIsrLink(p_tmr);
+            *p_err   = OS_ERR_NONE;
+             success = OS_TRUE;
+             break;
+
+        case OS_TMR_STATE_UNUSED:                               /* Timer not created                                    */
+            *p_err   = OS_ERR_TMR_INACTIVE;
+             success = OS_FALSE;
+             break;
+
+        default:
+            *p_err   = OS_ERR_TMR_INVALID_STATE;
+             success = OS_FALSE;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+
+    return (success);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  STOP AN ISR TIMER
+*
+* Description: This function is called by OSTmrStop() for the timers created with OS_OPT_TMR_ISR.
+*
+* Arguments  : p_tmr           is a pointer to the timer.
+*
+*              opt             is the option of OSTmrStop().
+*
+*              p_callback_arg  is the callback argument used with OS_OPT_TMR_CALLBACK_ARG.
+*
+*              p_err           is a pointer to an error code (see OSTmrStop()).
+*
+* Returns    : OS_TRUE   if the timer was stopped or was already stopped
+*              OS_FALSE  if not
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The callback requested by 'opt' is called from the calling task, not from the ISR.
+************************************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  OS_TmrIsrStop (OS_TMR  *p_tmr,
+                                    OS_OPT   opt,
+                                    void    *p_callback_arg,
+                                    OS_ERR  *p_err)
+{
+    OS_TMR_CALLBACK_PTR  p_fnct;
+    OS_STATE             state;
+    CPU_SR_ALLOC();
+
+
+    switch (opt) {
+        case OS_OPT_TMR_CALLBACK:
+             p_callback_arg = p_tmr->CallbackPtrArg;            /* Use callback arg when timer was created              */
+             break;
+
+        case OS_OPT_TMR_CALLBACK_ARG:
+        case OS_OPT_TMR_NONE:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return (OS_FALSE);
+    }
+
+    CPU_CRITICAL_ENTER();
+    state = p_tmr->State;
+    switch (state) {
+        case OS_TMR_STATE_RUNNING:
+             OS_TmrIsrUnlink(p_tmr);                            /* Remove from the ISR timer list                       */
+             p_tmr->State = OS_TMR_STATE_STOPPED;
+            *p_err        = OS_ERR_NONE;
+             break;
+
+        case OS_TMR_STATE_COMPLETED:                            /* Timer has already completed the ONE-SHOT or          */
+        case OS_TMR_STATE_STOPPED:                              /* ... timer has not started yet.                       */
+             p_tmr->State = OS_TMR_STATE_STOPPED;
+            *p_err        = OS_ERR_TMR_STOPPED;
+             break;
+
+        case OS_TMR_STATE_UNUSED:                               /* Timer was not created                                */
+            *p_err        = OS_ERR_TMR_INACTIVE;
+             break;
+
+        default:
+            *p_err        = OS_ERR_TMR_INVALID_STATE;
+             break;
+    }
+    p_fnct = p_tmr->CallbackPtr;
+    CPU_CRITICAL_EXIT();
+
+    switch (state) {
+        case OS_TMR_STATE_RUNNING:
+             if (opt != OS_OPT_TMR_NONE) {
+                 if (p_fnct != (OS_TMR_CALLBACK_PTR)0) {        /* Execute callback function if available (Note #2)     */
+                     (*p_fnct)(p_tmr, p_callback_arg);
+                 } else {
+                    *p_err = OS_ERR_TMR_NO_CALLBACK;
+                 }
+             }
+             return (OS_TRUE);
+
+        case OS_TMR_STATE_COMPLETED:
+        case OS_TMR_STATE_STOPPED:
+             return (OS_TRUE);
+
+        default:
+             return (OS_FALSE);
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                   CONVERT THE DELAY AND PERIOD OF AN ISR TIMER
+*
+* Description: This function converts the delay and the period of an ISR timer from microseconds to OS_TS_GET()
+*              units.
+*
+* Arguments  : dly            is the delay in microseconds, or 0.
+*
+*              period         is the period in microseconds, or 0.
+*
+*              p_dly_ts       is where the converted delay is stored.
+*
+*              p_period_ts    is where the converted period is stored.
+*
+*              p_err          is a pointer to an error code:
+*
+*                                 OS_ERR_NONE                  Both values were converted
+*                                 OS_ERR_TMR_INVALID_DLY       'dly' is too long or the timestamp frequency is unknown
+*                                 OS_ERR_TMR_INVALID_PERIOD    'period' is too long or the timestamp frequency is
+*                                                              unknown
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_TmrIsrUsToTS (OS_TICK   dly,
+                               OS_TICK   period,
+                               CPU_TS   *p_dly_ts,
+                               CPU_TS   *p_period_ts,
+                               OS_ERR   *p_err)
+{
+    CPU_TS  ts;
+
+
+   *p_dly_ts    = 0u;
+   *p_period_ts = 0u;
+
+    if (dly != 0u) {
+        ts = OS_TickHrUsToTS((CPU_INT32U)dly);
+        if ((ts == 0u) || (ts > OS_TICK_HR_DLY_MAX)) {
+           *p_err = OS_ERR_TMR_INVALID_DLY;
+            return;
+        }
+       *p_dly_ts = ts;
+    }
+
+    if (period != 0u) {
+        ts = OS_TickHrUsToTS((CPU_INT32U)period);
+        if ((ts == 0u) || (ts > OS_TICK_HR_DLY_MAX)) {
+           *p_err = OS_ERR_TMR_INVALID_PERIOD;
+            return;
+        }
+       *p_period_ts = ts;
+    }
+
+   *p_err = OS_ERR_NONE;
+}
+#endif
 #endif
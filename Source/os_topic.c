@@ -0,0 +1,650 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                      PUBLISH/SUBSCRIBE TOPICS
+*
+* File    : os_topic.c
+* Version : V3.08.00
+*********************************************************************************************************
+* Note(s) : (1) A topic delivers each message published on it to the message queue of every subscriber, either
+*               the queue of a task (OSTaskQPost()) or a message queue (OSQPost()).  Only the pointer is posted:
+*               the subscribers all receive the same message.
+*
+*           (2) Published with OS_OPT_POST_MEM_BUF_REF, a buffer obtained with OSMemBufGet() gets one reference
+*               per subscriber it was delivered to, and goes back to its partition once the publisher and all
+*               the subscribers have called OSMemBufRelease().  Without this option, the message must stay
+*               valid until every subscriber is done with it.
+*
+*           (3) A subscriber is described by an OS_TOPIC_SUB that the application allocates, one per topic it
+*               subscribes to.  A task must be unsubscribed before it is deleted.
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#define  OS_CRIT_SITE_ID                    OS_CRIT_SITE_TOPIC
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_topic__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_TOPIC_EN > 0u)
+/*
+************************************************************************************************************************
+*                                                   CREATE A TOPIC
+*
+* Description: This function is called by your application to create a publish/subscribe topic.
+*
+* Arguments  : p_topic       is a pointer to the topic to initialize.  Your application is responsible for allocating
+*                            storage for the topic.
+*
+*              p_name        is a pointer to the name you would like to give the topic.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_CREATE_ISR              If you called this function from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the topic after you called
+*                                                                 OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_topic' is a NULL pointer
+*                                OS_ERR_OBJ_CREATED             If the topic was already created
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSTopicCreate (OS_TOPIC  *p_topic,
+                     CPU_CHAR  *p_name,
+                     OS_ERR    *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_topic == (OS_TOPIC *)0) {                             /* Validate 'p_topic'                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
+    if (p_topic->Type == OS_OBJ_TYPE_TOPIC) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+    p_topic->Type       = OS_OBJ_TYPE_TOPIC;                    /* Mark the data structure as a topic                   */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_topic->NamePtr    = p_name;                               /* Save the name of the topic                           */
+#else
+    (void)p_name;
+#endif
+    p_topic->SubListPtr = (OS_TOPIC_SUB *)0;                    /* No subscriber yet                                    */
+    p_topic->NbrSubs    = 0u;
+
+#if (OS_CFG_DBG_EN > 0u)
+    OS_TopicDbgListAdd(p_topic);
+    OSTopicQty++;                                               /* One more topic created                               */
+#endif
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                   DELETE A TOPIC
+*
+* Description: This function deletes a topic.  Its subscribers are unsubscribed.
+*
+* Arguments  : p_topic       is a pointer to the topic
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    The call was successful and the topic was deleted
+*                                OS_ERR_DEL_ISR                 If you attempted to delete the topic from an ISR
+*                                OS_ERR_ILLEGAL_DEL_RUN_TIME    If you are trying to delete the topic after you called
+*                                                                 OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_topic' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE                If 'p_topic' is not pointing to a topic
+*
+* Returns    : The number of subscribers the topic had, 0 if an error is detected.
+*
+* Note(s)    : 1) Messages already delivered stay in the queues of the subscribers.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TOPIC_DEL_EN > 0u)
+OS_OBJ_QTY  OSTopicDel (OS_TOPIC  *p_topic,
+                        OS_ERR    *p_err)
+{
+    OS_TOPIC_SUB  *p_sub;
+    OS_OBJ_QTY     nbr_subs;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to delete a topic from an ISR            */
+       *p_err = OS_ERR_DEL_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_topic == (OS_TOPIC *)0) {                             /* Validate 'p_topic'                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_topic->Type != OS_OBJ_TYPE_TOPIC) {                   /* Make sure topic was created                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    nbr_subs = p_topic->NbrSubs;
+    p_sub    = p_topic->SubListPtr;
+    while (p_sub != (OS_TOPIC_SUB *)0) {                        /* Unsubscribe all the subscribers                      */
+        p_topic->SubListPtr = p_sub->NextPtr;
+        p_sub->TopicPtr     = (OS_TOPIC     *)0;
+        p_sub->NextPtr      = (OS_TOPIC_SUB *)0;
+        p_sub               = p_topic->SubListPtr;
+    }
+#if (OS_CFG_DBG_EN > 0u)
+    OS_TopicDbgListRemove(p_topic);
+    OSTopicQty--;
+#endif
+    OS_TopicClr(p_topic);
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+    return (nbr_subs);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                              PUBLISH A MESSAGE ON A TOPIC
+*
+* Description: This function posts a message to the queues of all the subscribers of a topic, then runs the scheduler
+*              once.
+*
+* Arguments  : p_topic       is a pointer to the topic
+*
+*              p_void        is a pointer to the message to publish
+*
+*              msg_size      specifies the size of the message (in bytes)
+*
+*              opt           determines the type of POST performed:
+*
+*                                OS_OPT_POST_FIFO         POST message to the end of the queues
+*                                OS_OPT_POST_LIFO         POST message to the front of the queues
+*                                OS_OPT_POST_NO_SCHED     Do not call the scheduler
+*
+*                            Note(s): 1) OS_OPT_POST_NO_SCHED can be added with one of the other options.
+*                                     2) OS_OPT_POST_PRIO(lvl) and OS_OPT_POST_MEM_BUF_REF can also be added, with
+*                                        the same meaning as for OSQPost().
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              If the message was delivered to all the subscribers
+*                                OS_ERR_OBJ_PTR_NULL      If 'p_topic' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE          If 'p_topic' is not pointing to a topic
+*                                OS_ERR_OPT_INVALID       If you specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*
+*                            or the error returned by OSQPost() or OSTaskQPost() for the last subscriber the message
+*                            could not be delivered to (e.g. OS_ERR_Q_MAX).
+*
+* Returns    : The number of subscribers the message was delivered to.
+*
+* Note(s)    : 1) The scheduler is locked while the message is posted, and each post is made with OS_OPT_POST_NO_SCHED.
+*                 None of the subscribers runs before the message is delivered to all of them, and there is a single
+*                 pass through the scheduler at the end instead of one per subscriber.  Interrupts are only disabled
+*                 for the duration of one post at a time.
+*
+*              2) A subscriber whose queue is full misses the message.  Its '.DropCtr' is incremented and the others
+*                 still get it.
+*
+*              3) This function may be called from an ISR.  The scheduler then runs when the ISR returns.
+************************************************************************************************************************
+*/
+
+OS_OBJ_QTY  OSTopicPublish (OS_TOPIC     *p_topic,
+                            void         *p_void,
+                            OS_MSG_SIZE   msg_size,
+                            OS_OPT        opt,
+                            OS_ERR       *p_err)
+{
+    OS_TOPIC_SUB  *p_sub;
+    OS_OBJ_QTY     nbr_posted;
+    OS_OPT         opt_post;
+    OS_ERR         err;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_topic == (OS_TOPIC *)0) {                             /* Validate 'p_topic'                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    switch (opt & (OS_OPT)~(OS_OPT)(OS_OPT_POST_PRIO_MASK | OS_OPT_POST_MEM_BUF_REF)) { /* Validate 'opt'               */
+        case OS_OPT_POST_FIFO:
+        case OS_OPT_POST_LIFO:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_topic->Type != OS_OBJ_TYPE_TOPIC) {                   /* Make sure topic was created                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    opt_post   = opt | OS_OPT_POST_NO_SCHED;                    /* The scheduler runs once, at the end (see Note #1)    */
+    nbr_posted = 0u;
+   *p_err      = OS_ERR_NONE;
+
+    CPU_CRITICAL_ENTER();
+    if (OSIntNestingCtr == 0u) {
+        OSSchedLockNestingCtr++;                                /* No subscriber runs before all got the message        */
+    }
+    p_sub = p_topic->SubListPtr;
+    CPU_CRITICAL_EXIT();
+
+    while (p_sub != (OS_TOPIC_SUB *)0) {
+#if   (OS_CFG_TASK_Q_EN > 0u) && (OS_CFG_Q_EN > 0u)
+        if (p_sub->TCBPtr != (OS_TCB *)0) {
+            OSTaskQPost(p_sub->TCBPtr, p_void, msg_size, opt_post, &err);
+        } else {
+            OSQPost(p_sub->QPtr, p_void, msg_size, opt_post, &err);
+        }
+#elif (OS_CFG_TASK_Q_EN > 0u)
+        OSTaskQPost(p_sub->TCBPtr, p_void, msg_size, opt_post, &err);
+#else
+        OSQPost(p_sub->QPtr, p_void, msg_size, opt_post, &err);
+#endif
+        CPU_CRITICAL_ENTER();
+        if (err == OS_ERR_NONE) {
+            nbr_posted++;
+        } else {
+            p_sub->DropCtr++;                                   /* See Note #2                                          */
+           *p_err = err;
+        }
+        p_sub = p_sub->NextPtr;
+        CPU_CRITICAL_EXIT();
+    }
+
+    CPU_CRITICAL_ENTER();
+    if (OSIntNestingCtr == 0u) {
+        OSSchedLockNestingCtr--;
+    }
+    CPU_CRITICAL_EXIT();
+
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+    return (nbr_posted);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                SUBSCRIBE TO A TOPIC
+*
+* Description: This function registers a message queue to receive the messages published on a topic.
+*
+* Arguments  : p_topic       is a pointer to the topic
+*
+*              p_sub         is a pointer to the subscriber to register.  Your application is responsible for
+*                            allocating storage for it and must not change it while it is subscribed.
+*
+*              p_tcb         is a pointer to the TCB of the task whose queue receives the messages, or a NULL pointer
+*                            if 'p_q' is used.
+*
+*              p_q           is a pointer to the message queue that receives the messages, or a NULL pointer if
+*                            'p_tcb' is used.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the subscriber was registered
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_topic' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE                If 'p_topic' is not pointing to a topic
+*                                OS_ERR_TOPIC_SUB_INVALID       If 'p_sub' is a NULL pointer or is already subscribed,
+*                                                                 or if not exactly one of 'p_tcb' and 'p_q' is given,
+*                                                                 or if the kind of queue given is not enabled
+*                                OS_ERR_TOPIC_SUB_ISR           If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) The subscriber receives the messages published after this call.
+************************************************************************************************************************
+*/
+
+void  OSTopicSubscribe (OS_TOPIC      *p_topic,
+                        OS_TOPIC_SUB  *p_sub,
+                        OS_TCB        *p_tcb,
+                        OS_Q          *p_q,
+                        OS_ERR        *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_TOPIC_SUB_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_topic == (OS_TOPIC *)0) {                             /* Validate 'p_topic'                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_sub == (OS_TOPIC_SUB *)0) {                           /* Validate 'p_sub'                                     */
+       *p_err = OS_ERR_TOPIC_SUB_INVALID;
+        return;
+    }
+    if ((p_tcb == (OS_TCB *)0) == (p_q == (OS_Q *)0)) {         /* Exactly one destination is needed                    */
+       *p_err = OS_ERR_TOPIC_SUB_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_CFG_TASK_Q_EN == 0u)
+    if (p_tcb != (OS_TCB *)0) {                                 /* Task queues are not available                        */
+       *p_err = OS_ERR_TOPIC_SUB_INVALID;
+        return;
+    }
+#endif
+#if (OS_CFG_Q_EN == 0u)
+    if (p_q != (OS_Q *)0) {                                     /* Message queues are not available                     */
+       *p_err = OS_ERR_TOPIC_SUB_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_topic->Type != OS_OBJ_TYPE_TOPIC) {                   /* Make sure topic was created                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_sub->TopicPtr != (OS_TOPIC *)0) {                     /* Already subscribed to a topic                        */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_TOPIC_SUB_INVALID;
+        return;
+    }
+    p_sub->TopicPtr     = p_topic;
+    p_sub->TCBPtr       = p_tcb;
+    p_sub->QPtr         = p_q;
+    p_sub->DropCtr      = 0u;
+    p_sub->NextPtr      = p_topic->SubListPtr;                  /* Insert at the head of the subscriber list            */
+    p_topic->SubListPtr = p_sub;
+    p_topic->NbrSubs++;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              UNSUBSCRIBE FROM A TOPIC
+*
+* Description: This function removes a subscriber from a topic.
+*
+* Arguments  : p_topic       is a pointer to the topic
+*
+*              p_sub         is a pointer to the subscriber to remove
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the subscriber was removed
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_topic' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE                If 'p_topic' is not pointing to a topic
+*                                OS_ERR_TOPIC_NOT_SUB           If 'p_sub' is not subscribed to 'p_topic'
+*                                OS_ERR_TOPIC_SUB_INVALID       If 'p_sub' is a NULL pointer
+*                                OS_ERR_TOPIC_SUB_ISR           If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) Messages already delivered stay in the queue of the subscriber.
+************************************************************************************************************************
+*/
+
+void  OSTopicUnsubscribe (OS_TOPIC      *p_topic,
+                          OS_TOPIC_SUB  *p_sub,
+                          OS_ERR        *p_err)
+{
+    OS_TOPIC_SUB  **pp_link;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_TOPIC_SUB_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_topic == (OS_TOPIC *)0) {                             /* Validate 'p_topic'                                   */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_sub == (OS_TOPIC_SUB *)0) {                           /* Validate 'p_sub'                                     */
+       *p_err = OS_ERR_TOPIC_SUB_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_topic->Type != OS_OBJ_TYPE_TOPIC) {                   /* Make sure topic was created                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_sub->TopicPtr != p_topic) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_TOPIC_NOT_SUB;
+        return;
+    }
+    pp_link = &p_topic->SubListPtr;                             /* Find the link that points to the subscriber          */
+    while (*pp_link != p_sub) {
+        pp_link = &(*pp_link)->NextPtr;
+    }
+   *pp_link         =  p_sub->NextPtr;
+    p_sub->TopicPtr = (OS_TOPIC     *)0;
+    p_sub->NextPtr  = (OS_TOPIC_SUB *)0;
+    p_topic->NbrSubs--;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                   CLEAR A TOPIC
+*
+* Description: This function is called by OSTopicDel() to clear the contents of a topic
+*
+* Argument(s): p_topic       is a pointer to the topic to clear
+*              -------
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_TopicClr (OS_TOPIC  *p_topic)
+{
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_topic->Type       =  OS_OBJ_TYPE_NONE;                    /* Mark the data structure as a NONE                    */
+#endif
+    p_topic->SubListPtr = (OS_TOPIC_SUB *)0;
+    p_topic->NbrSubs    =  0u;
+#if (OS_CFG_DBG_EN > 0u)
+    p_topic->NamePtr    = (CPU_CHAR *)((void *)"?TOPIC");
+#endif
+}
+
+
+/*
+************************************************************************************************************************
+*                                          ADD/REMOVE TOPIC TO/FROM DEBUG LIST
+*
+* Description: These functions are called by uC/OS-III to add or remove a topic to/from the debug list.
+*
+* Arguments  : p_topic      is a pointer to the topic to add/remove
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN > 0u)
+void  OS_TopicDbgListAdd (OS_TOPIC  *p_topic)
+{
+    p_topic->DbgNamePtr               = (CPU_CHAR *)((void *)" ");
+    p_topic->DbgPrevPtr               = (OS_TOPIC *)0;
+    if (OSTopicDbgListPtr == (OS_TOPIC *)0) {
+        p_topic->DbgNextPtr           = (OS_TOPIC *)0;
+    } else {
+        p_topic->DbgNextPtr           =  OSTopicDbgListPtr;
+        OSTopicDbgListPtr->DbgPrevPtr =  p_topic;
+    }
+    OSTopicDbgListPtr                 =  p_topic;
+}
+
+
+void  OS_TopicDbgListRemove (OS_TOPIC  *p_topic)
+{
+    OS_TOPIC  *p_topic_next;
+    OS_TOPIC  *p_topic_prev;
+
+
+    p_topic_prev = p_topic->DbgPrevPtr;
+    p_topic_next = p_topic->DbgNextPtr;
+
+    if (p_topic_prev == (OS_TOPIC *)0) {
+        OSTopicDbgListPtr = p_topic_next;
+        if (p_topic_next != (OS_TOPIC *)0) {
+            p_topic_next->DbgPrevPtr = (OS_TOPIC *)0;
+        }
+        p_topic->DbgNextPtr = (OS_TOPIC *)0;
+
+    } else if (p_topic_next == (OS_TOPIC *)0) {
+        p_topic_prev->DbgNextPtr = (OS_TOPIC *)0;
+        p_topic->DbgPrevPtr      = (OS_TOPIC *)0;
+
+    } else {
+        p_topic_prev->DbgNextPtr =  p_topic_next;
+        p_topic_next->DbgPrevPtr =  p_topic_prev;
+        p_topic->DbgNextPtr      = (OS_TOPIC *)0;
+        p_topic->DbgPrevPtr      = (OS_TOPIC *)0;
+    }
+}
+#endif
+#endif
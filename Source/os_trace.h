@@ -265,6 +265,10 @@
 #define  OS_TRACE_Q_PEND_BLOCK(p_q)
 #endif
 
+#ifndef  OS_TRACE_MSG_Q_RES_OVR
+#define  OS_TRACE_MSG_Q_RES_OVR(p_msg_q)
+#endif
+
 #ifndef  OS_TRACE_FLAG_CREATE
 #define  OS_TRACE_FLAG_CREATE(p_grp, p_name)
 #endif
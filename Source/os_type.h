@@ -46,7 +46,17 @@ typedef   CPU_INT32U      OS_CTX_SW_CTR;               /* Counter of context swi
 
 typedef   CPU_INT32U      OS_CYCLES;                   /* CPU clock cycles,                                   <32>/64 */
 
-typedef   CPU_INT32U      OS_FLAGS;                    /* Event flags,                                      8/16/<32> */
+#if   (OS_CFG_FLAG_WIDTH ==  8u)                       /* Event flags,                                   8/16/<32>/64 */
+typedef   CPU_INT08U      OS_FLAGS;
+#elif (OS_CFG_FLAG_WIDTH == 16u)
+typedef   CPU_INT16U      OS_FLAGS;
+#elif (OS_CFG_FLAG_WIDTH == 64u)
+typedef   CPU_INT64U      OS_FLAGS;
+#else
+typedef   CPU_INT32U      OS_FLAGS;
+#endif
+
+typedef   CPU_INT32U      OS_HIST_CTR;                 /* Histogram bucket counter,                            16/<32> */
 
 typedef   CPU_INT32U      OS_IDLE_CTR;                 /* Holds the number of times the idle task runs,       <32>/64 */
 
@@ -58,17 +68,24 @@ typedef   CPU_INT16U      OS_MSG_SIZE;                 /* Size of messages in nu
 
 typedef   CPU_INT08U      OS_NESTING_CTR;              /* Interrupt and scheduler nesting,                  <8>/16/32 */
 
+typedef   CPU_INT32U      OS_NOTIFY;                   /* Task notification value,                                 32 */
+typedef   CPU_INT08U      OS_NOTIFY_ID;                /* Index to task notification slot                   <8>/16/32 */
+
 typedef   CPU_INT16U      OS_OBJ_QTY;                  /* Number of kernel objects counter,                   <16>/32 */
 typedef   CPU_INT32U      OS_OBJ_TYPE;                 /* Special flag to determine object type,                   32 */
 
 typedef   CPU_INT16U      OS_OPT;                      /* Holds function options,                             <16>/32 */
 
+typedef   CPU_INT08U      OS_PERF_LVL;                 /* CPU performance level,                            <8>/16/32 */
+
 typedef   CPU_INT08U      OS_PRIO;                     /* Priority of a task,                               <8>/16/32 */
 
 typedef   CPU_INT16U      OS_QTY;                      /* Quantity                                            <16>/32 */
 
 typedef   CPU_INT32U      OS_RATE_HZ;                  /* Rate in Hertz                                            32 */
 
+typedef   CPU_INT32U      OS_RCU_GP;                   /* Grace period sequence count of an RCU domain             32 */
+
 #if (CPU_CFG_ADDR_SIZE == CPU_WORD_SIZE_64)            /* Task register                                  8/16/<32/64> */
 typedef   CPU_INT64U      OS_REG;
 #else
@@ -82,6 +99,10 @@ typedef   CPU_INT08U      OS_STATE;                    /* State variable
 
 typedef   CPU_INT08U      OS_STATUS;                   /* Status                                            <8>/16/32 */
 
-typedef   CPU_INT32U      OS_TICK;                     /* Clock tick counter                                  <32>/64 */
+#if (OS_CFG_SMALL_MEM_EN > 0u)                         /* Clock tick counter                               16/<32>/64 */
+typedef   CPU_INT16U      OS_TICK;
+#else
+typedef   CPU_INT32U      OS_TICK;
+#endif
 
 #endif
@@ -0,0 +1,410 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          SOFTWARE WATCHDOG
+*
+* File    : os_wdog.c
+* Version : V3.08.00
+*********************************************************************************************************
+* Note(s) : (1) A task that must prove it is alive registers with OSWdogReg() and calls OSWdogCheckIn() at least
+*               once per deadline.  The check-in is one atomic OR on OSWdogMap[], a single instruction on the
+*               ports that provide OS_CPU_ATOMIC_FETCH_OR().
+*
+*           (2) The supervision runs from a periodic timer, in the context of OS_TmrTask().  A missed deadline
+*               is reported between 'deadline' and 'deadline + period' timer ticks after the last check-in.
+*********************************************************************************************************
+*/
+
+#define   MICRIUM_SOURCE
+#define   OS_CRIT_SITE_ID                   OS_CRIT_SITE_WDOG
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_wdog__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_WDOG_EN > 0u)
+/*
+************************************************************************************************************************
+*                                                   LOCAL CONSTANTS
+************************************************************************************************************************
+*/
+
+#define  OS_WDOG_MAP_BITS                   (CPU_CFG_DATA_SIZE * 8u)
+
+
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  void  OS_WdogCheck (void  *p_tmr,
+                            void  *p_arg);
+
+
+/*
+************************************************************************************************************************
+*                                                       CHECK IN
+*
+* Description: This function tells the watchdog that the task registered under 'id' is alive.
+*
+* Arguments  : id        is the ID returned by OSWdogReg()
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function can be called from a task or an ISR.  It only sets a bit, the deadline is checked by
+*                 the supervision (see OS_WdogCheck()).
+************************************************************************************************************************
+*/
+
+void  OSWdogCheckIn (OS_OBJ_QTY  id)
+{
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if ((id == 0u) ||                                           /* Ignore an ID that OSWdogReg() can't return           */
+        (id >  OS_CFG_WDOG_NBR_MAX)) {
+        return;
+    }
+#endif
+
+    id--;
+    (void)OSAtomicFetchOr(&OSWdogMap[id / OS_WDOG_MAP_BITS], (CPU_DATA)1u << (id % OS_WDOG_MAP_BITS));
+}
+
+
+/*
+************************************************************************************************************************
+*                                                   REGISTER A TASK
+*
+* Description: This function places a task under the supervision of the watchdog.
+*
+* Arguments  : p_tcb     is a pointer to the OS_TCB of the task, a NULL pointer for the calling task
+*
+*              deadline  is the longest time allowed between two check-ins, in timer ticks (see OS_CFG_TMR_TASK_RATE_HZ)
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                    The task is supervised
+*                            OS_ERR_WDOG_DEADLINE_INVALID   If 'deadline' is 0
+*                            OS_ERR_WDOG_FULL               If OS_CFG_WDOG_NBR_MAX tasks are already registered
+*                            OS_ERR_TASK_CREATE_ISR         If called from an ISR
+*
+* Returns    : The ID to pass to OSWdogCheckIn() and OSWdogUnreg(), 0 upon error.
+*
+* Note(s)    : 1) Registering counts as the first check-in.
+*
+*              2) A task may register more than once, for instance once per loop it runs, each with its own deadline.
+*
+*              3) The task MUST be unregistered before it is deleted.
+************************************************************************************************************************
+*/
+
+OS_OBJ_QTY  OSWdogReg (OS_TCB   *p_tcb,
+                       OS_TICK   deadline,
+                       OS_ERR   *p_err)
+{
+    OS_OBJ_QTY   ix;
+    OS_WDOG     *p_wdog;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to register from an ISR                  */
+       *p_err = OS_ERR_TASK_CREATE_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (deadline == 0u) {                                       /* The task must be given some time                     */
+       *p_err = OS_ERR_WDOG_DEADLINE_INVALID;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {                                 /* Register the calling task                            */
+        p_tcb = OSTCBCurPtr;
+    }
+    for (ix = 0u; ix < OS_CFG_WDOG_NBR_MAX; ix++) {             /* Find a free entry                                    */
+        if (OSWdogTbl[ix].TCBPtr == (OS_TCB *)0) {
+            break;
+        }
+    }
+    if (ix >= OS_CFG_WDOG_NBR_MAX) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_WDOG_FULL;
+        return (0u);
+    }
+    p_wdog           = &OSWdogTbl[ix];
+    p_wdog->TCBPtr   =  p_tcb;
+    p_wdog->Deadline =  deadline;
+    p_wdog->Elapsed  =  0u;
+    p_wdog->Expired  =  OS_FALSE;
+    OSWdogQty++;
+    CPU_CRITICAL_EXIT();
+
+    OSWdogCheckIn(ix + 1u);                                     /* A left-over bit of a previous owner is harmless      */
+   *p_err = OS_ERR_NONE;
+    return (ix + 1u);
+}
+
+
+/*
+************************************************************************************************************************
+*                                               START THE SUPERVISION
+*
+* Description: This function creates and starts the periodic timer that checks the deadlines.
+*
+* Arguments  : p_hook    is the function called, from OS_TmrTask(), with the OS_TCB and the ID of each task that missed
+*                        its deadline
+*
+*              period    is the interval between two checks, in timer ticks
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                    The supervision is running
+*                            OS_ERR_PTR_INVALID             If 'p_hook' is a NULL pointer
+*                            OS_ERR_TMR_INVALID_PERIOD      If 'period' is 0
+*                            OS_ERR_TMR_ISR                 If called from an ISR
+*                            Other errors from OSTmrCreate() and OSTmrStart()
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function MUST be called once, from a task since the timer can only be started after OSStart().
+*                 Tasks can register before or after.
+*
+*              2) The hook runs with the priority of the timer task and MUST NOT block.  It typically logs the task
+*                 and stops feeding the hardware watchdog, or restarts the task.
+************************************************************************************************************************
+*/
+
+void  OSWdogStart (OS_WDOG_HOOK   p_hook,
+                   OS_TICK        period,
+                   OS_ERR        *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Timers can't be created from an ISR                  */
+       *p_err = OS_ERR_TMR_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_hook == (OS_WDOG_HOOK)0) {                            /* A missed deadline must be reported to someone        */
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    if (period == 0u) {
+       *p_err = OS_ERR_TMR_INVALID_PERIOD;
+        return;
+    }
+#endif
+
+    OSWdogHookPtr = p_hook;
+    OSWdogPeriod  = period;
+
+    OSTmrCreate(&OSWdogTmr,
+                (CPU_CHAR *)((void *)"uC/OS-III Watchdog"),
+                 period,
+                 period,
+                 OS_OPT_TMR_PERIODIC,
+                 OS_WdogCheck,
+                (void     *)0,
+                 p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+    (void)OSTmrStart(&OSWdogTmr, p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  UNREGISTER A TASK
+*
+* Description: This function ends the supervision of a task.
+*
+* Arguments  : id        is the ID returned by OSWdogReg()
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                    The task is no longer supervised
+*                            OS_ERR_WDOG_ID_INVALID         If 'id' is not registered
+*                            OS_ERR_TASK_DEL_ISR            If called from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSWdogUnreg (OS_OBJ_QTY   id,
+                   OS_ERR      *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to unregister from an ISR                */
+       *p_err = OS_ERR_TASK_DEL_ISR;
+        return;
+    }
+#endif
+
+    if ((id == 0u) ||
+        (id >  OS_CFG_WDOG_NBR_MAX)) {
+       *p_err = OS_ERR_WDOG_ID_INVALID;
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    if (OSWdogTbl[id - 1u].TCBPtr == (OS_TCB *)0) {             /* Not registered                                       */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_WDOG_ID_INVALID;
+        return;
+    }
+    OSWdogTbl[id - 1u].TCBPtr = (OS_TCB *)0;
+    OSWdogQty--;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                             INITIALIZE THE WATCHDOG
+*
+* Description: This function is called by OSInit() to free all the entries.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_WdogInit (void)
+{
+    OS_OBJ_QTY  ix;
+
+
+    for (ix = 0u; ix < OS_CFG_WDOG_NBR_MAX; ix++) {
+        OSWdogTbl[ix].TCBPtr   = (OS_TCB *)0;
+        OSWdogTbl[ix].Deadline = 0u;
+        OSWdogTbl[ix].Elapsed  = 0u;
+        OSWdogTbl[ix].Expired  = OS_FALSE;
+    }
+    for (ix = 0u; ix < OS_WDOG_MAP_SIZE; ix++) {
+        OSWdogMap[ix] = 0u;
+    }
+    OSWdogQty     = 0u;
+    OSWdogHookPtr = (OS_WDOG_HOOK)0;
+    OSWdogPeriod  = 0u;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                CHECK THE DEADLINES
+*
+* Description: This function is the callback of the watchdog timer.  It takes the check-ins of the last period, one
+*              CPU_DATA at a time, and calls the hook for the tasks that have gone 'Deadline' ticks without one.
+*
+* Arguments  : p_tmr     is a pointer to OSWdogTmr
+*
+*              p_arg     is not used
+*
+* Returns    : none
+*
+* Note(s)    : 1) Taking and clearing a CPU_DATA in one exchange doesn't lose a check-in made meanwhile, it counts for
+*                 the next period.
+*
+*              2) The hook is called outside of the critical section.
+************************************************************************************************************************
+*/
+
+static  void  OS_WdogCheck (void  *p_tmr,
+                            void  *p_arg)
+{
+    OS_OBJ_QTY   ix;
+    OS_OBJ_QTY   bit;
+    CPU_DATA     map;
+    OS_WDOG     *p_wdog;
+    OS_TCB      *p_tcb;
+    CPU_SR_ALLOC();
+
+
+    (void)p_tmr;                                                /* Prevent compiler warning for not using 'p_tmr'       */
+    (void)p_arg;
+
+    map = 0u;
+    for (ix = 0u; ix < OS_CFG_WDOG_NBR_MAX; ix++) {
+        bit = ix % OS_WDOG_MAP_BITS;
+        if (bit == 0u) {                                        /* Take the check-ins of the next CPU_DATA (Note #1)    */
+            map = OSAtomicXchg(&OSWdogMap[ix / OS_WDOG_MAP_BITS], 0u);
+        }
+
+        p_tcb  = (OS_TCB *)0;
+        p_wdog = &OSWdogTbl[ix];
+        CPU_CRITICAL_ENTER();
+        if (p_wdog->TCBPtr != (OS_TCB *)0) {
+            if ((map & ((CPU_DATA)1u << bit)) != 0u) {          /* Checked in, start a new interval                     */
+                p_wdog->Elapsed = 0u;
+                p_wdog->Expired = OS_FALSE;
+            } else if (p_wdog->Expired == OS_FALSE) {           /* No check-in this period, count the time              */
+                p_wdog->Elapsed += OSWdogPeriod;
+                if (p_wdog->Elapsed >= p_wdog->Deadline) {      /* Deadline missed, report it once                      */
+                    p_wdog->Expired = OS_TRUE;
+                    p_tcb           = p_wdog->TCBPtr;
+                }
+            }
+        }
+        CPU_CRITICAL_EXIT();
+
+        if (p_tcb != (OS_TCB *)0) {                             /* See Note #2                                          */
+            OSWdogHookPtr(p_tcb, ix + 1u);
+        }
+    }
+}
+#endif
@@ -0,0 +1,860 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                             WORK QUEUES
+*
+* File    : os_workq.c
+* Version : V3.08.00
+*********************************************************************************************************
+*/
+
+#define   MICRIUM_SOURCE
+#define   OS_CRIT_SITE_ID                   OS_CRIT_SITE_WORKQ
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_workq__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_WORKQ_EN > 0u)
+
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  void  OS_WorkLink        (OS_WORKQ  *p_workq,
+                                  OS_WORK   *p_work);
+
+static  void  OS_WorkUnlink      (OS_WORK   *p_work);
+
+#if (OS_CFG_TMR_EN > 0u)
+static  void  OS_WorkTmrCallback (void      *p_tmr,
+                                  void      *p_arg);
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                 CREATE A WORK QUEUE
+*
+* Description : Create a work queue and its 'nbr_workers' worker tasks.  Worker 'i' uses 'p_tcb_tbl[i]' and the
+*               'stk_size' stack elements starting at 'p_stk_tbl + i * stk_size'.
+*
+* Arguments   : p_workq      is a pointer to the work queue control block which is allocated in user memory space.
+*
+*               p_name       is a pointer to an ASCII string to provide a name to the work queue and its workers.
+*
+*               p_tcb_tbl    is a pointer to an array of 'nbr_workers' TCBs.
+*
+*               p_stk_tbl    is a pointer to the base of 'nbr_workers * stk_size' stack elements.
+*
+*               nbr_workers  is the number of worker tasks.
+*
+*               stk_size     is the size of the stack of each worker, in number of CPU_STK elements.
+*
+*               stk_limit    is the stack limit of the workers (see OSTaskCreate()).
+*
+*               prio         is the priority of the workers.
+*
+*               opt          contains the options of the workers (see OSTaskCreate()).
+*
+*               p_err        is a pointer to a variable containing an error message which will be set by this function
+*                            to either:
+*
+*                                OS_ERR_NONE                    If the work queue has been created correctly
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the work queue after you
+*                                                                 called OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_CREATED             If the work queue was already created
+*                                OS_ERR_OBJ_PTR_NULL            If you passed a NULL pointer for 'p_workq'
+*                                OS_ERR_STK_INVALID             If you passed a NULL pointer for 'p_stk_tbl'
+*                                OS_ERR_TASK_CREATE_ISR         If you called this function from an ISR
+*                                OS_ERR_TCB_INVALID             If you passed a NULL pointer for 'p_tcb_tbl' or 0 for
+*                                                                 'nbr_workers'
+*
+*                            or any of the errors returned by OSSemCreate() or OSTaskCreate().
+*
+* Returns     : none
+*
+* Note(s)     : 1) Work queues can't be deleted.
+************************************************************************************************************************
+*/
+
+void  OSWorkQCreate (OS_WORKQ      *p_workq,
+                     CPU_CHAR      *p_name,
+                     OS_TCB        *p_tcb_tbl,
+                     CPU_STK       *p_stk_tbl,
+                     OS_OBJ_QTY     nbr_workers,
+                     CPU_STK_SIZE   stk_size,
+                     CPU_STK_SIZE   stk_limit,
+                     OS_PRIO        prio,
+                     OS_OPT         opt,
+                     OS_ERR        *p_err)
+{
+    OS_OBJ_QTY  i;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_TASK_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_workq == (OS_WORKQ *)0) {                             /* Must point to a valid work queue                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if ((p_tcb_tbl   == (OS_TCB *)0) ||                         /* Must provide at least one worker                     */
+        (nbr_workers == 0u)) {
+       *p_err = OS_ERR_TCB_INVALID;
+        return;
+    }
+    if (p_stk_tbl == (CPU_STK *)0) {                            /* Must provide the stacks                              */
+       *p_err = OS_ERR_STK_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_OBJ_TYPE_REQ > 0u)
+#if (OS_CFG_OBJ_CREATED_CHK_EN > 0u)
+    if (p_workq->Type == OS_OBJ_TYPE_WORKQ) {
+       *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+#endif
+
+    OSSemCreate(&p_workq->Sem,                                  /* Workers pend on it, one post per submitted job       */
+                 p_name,
+                 0u,
+                 p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_workq->Type       = OS_OBJ_TYPE_WORKQ;                    /* Set the type of object                               */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_workq->NamePtr    = p_name;                               /* Save name of work queue                              */
+#endif
+    for (i = 0u; i < OS_CFG_WORKQ_PRIO_NBR; i++) {
+        p_workq->HeadPtr[i] = (OS_WORK *)0;
+        p_workq->TailPtr[i] = (OS_WORK *)0;
+    }
+    p_workq->TCBTbl     = p_tcb_tbl;
+    p_workq->NbrWorkers = nbr_workers;
+    p_workq->NbrPend    = 0u;
+    p_workq->NbrPendMax = 0u;
+    CPU_CRITICAL_EXIT();
+
+    for (i = 0u; i < nbr_workers; i++) {                        /* Start the workers                                    */
+        OSTaskCreate(&p_tcb_tbl[i],
+                      p_name,
+                      OS_WorkQTask,
+                      p_workq,
+                      prio,
+                     &p_stk_tbl[(CPU_STK_SIZE)i * stk_size],
+                      stk_limit,
+                      stk_size,
+                      0u,
+                      0u,
+                      (void *)0,
+                      opt,
+                      p_err);
+        if (*p_err != OS_ERR_NONE) {
+            return;
+        }
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                                   CREATE A JOB
+*
+* Description : Initialize a job so that it can be submitted to a work queue.
+*
+* Arguments   : p_work   is a pointer to the job, typically embedded in a structure of the caller.
+*
+*               p_name   is a pointer to an ASCII string to provide a name to the timer of the job.
+*
+*               p_fnct   is the function run by the worker.
+*
+*               p_arg    is the argument passed to 'p_fnct'.
+*
+*               p_err    is a pointer to a variable containing an error message which will be set by this function to
+*                        either:
+*
+*                            OS_ERR_NONE               If the job was initialized
+*                            OS_ERR_OBJ_PTR_NULL       If you passed a NULL pointer for 'p_work'
+*                            OS_ERR_PTR_INVALID        If you passed a NULL pointer for 'p_fnct'
+*
+*                        or any of the errors returned by OSTmrCreate().
+*
+* Returns     : none
+*
+* Note(s)     : 1) When timers are enabled, this function creates the timer of the job used by OSWorkSubmitDly().  It
+*                  must therefore be called from a task, once per job.
+************************************************************************************************************************
+*/
+
+void  OSWorkCreate (OS_WORK       *p_work,
+                    CPU_CHAR      *p_name,
+                    OS_WORK_FNCT   p_fnct,
+                    void          *p_arg,
+                    OS_ERR        *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_work == (OS_WORK *)0) {                               /* Must point to a valid job                            */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (p_fnct == (OS_WORK_FNCT)0) {                            /* Must provide the function to run                     */
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+#endif
+
+    p_work->NextPtr  = (OS_WORK  *)0;
+    p_work->PrevPtr  = (OS_WORK  *)0;
+    p_work->WorkQPtr = (OS_WORKQ *)0;
+    p_work->FnctPtr  = p_fnct;
+    p_work->ArgPtr   = p_arg;
+    p_work->Prio     = 0u;
+    p_work->State    = OS_WORK_STATE_IDLE;
+    p_work->ActCtr   = 0u;
+
+#if (OS_CFG_TMR_EN > 0u)
+    OSTmrCreate(&p_work->Tmr,                                   /* Delay is set by OSWorkSubmitDly() (see Note #1)      */
+                 p_name,
+                 1u,
+                 0u,
+                 OS_OPT_TMR_ONE_SHOT,
+                 OS_WorkTmrCallback,
+                 p_work,
+                 p_err);
+#else
+    (void)p_name;
+   *p_err = OS_ERR_NONE;
+#endif
+}
+
+
+/*
+************************************************************************************************************************
+*                                                   SUBMIT A JOB
+*
+* Description : Add a job to the list of its priority in a work queue and wake up a worker.
+*
+* Arguments   : p_workq  is a pointer to the work queue control block
+*
+*               p_work   is a pointer to the job
+*
+*               prio     is the priority of the job, from 0 (highest) to OS_CFG_WORKQ_PRIO_NBR - 1.
+*
+*               p_err    is a pointer to a variable containing an error message which will be set by this function to
+*                        either:
+*
+*                            OS_ERR_NONE               If the job was submitted
+*                            OS_ERR_OBJ_PTR_NULL       If you passed a NULL pointer for 'p_workq' or 'p_work'
+*                            OS_ERR_OBJ_TYPE           If 'p_workq' is not pointing at a work queue
+*                            OS_ERR_WORK_PEND          If the job is already waiting to run
+*                            OS_ERR_WORK_PRIO_INVALID  If 'prio' is not a valid job priority
+*
+*                        or any of the errors returned by OSSemPost().
+*
+* Returns     : none
+*
+* Note(s)     : 1) This function can be called from an ISR.
+*
+*               2) A job can be submitted again once a worker has taken it, including from the job function itself.
+************************************************************************************************************************
+*/
+
+void  OSWorkSubmit (OS_WORKQ    *p_workq,
+                    OS_WORK     *p_work,
+                    CPU_INT08U   prio,
+                    OS_ERR      *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if ((p_workq == (OS_WORKQ *)0) ||                           /* Must point to a valid work queue and job             */
+        (p_work  == (OS_WORK  *)0)) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (prio >= OS_CFG_WORKQ_PRIO_NBR) {                        /* Must be a valid job priority                         */
+       *p_err = OS_ERR_WORK_PRIO_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_workq->Type != OS_OBJ_TYPE_WORKQ) {                   /* Make sure the work queue was created                 */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_work->State != OS_WORK_STATE_IDLE) {                  /* Job already waiting                                  */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_WORK_PEND;
+        return;
+    }
+    p_work->Prio   = prio;
+    p_work->ActCtr = 1u;
+    OS_WorkLink(p_workq, p_work);
+    CPU_CRITICAL_EXIT();
+
+    (void)OSSemPost(&p_workq->Sem,                              /* Wake up a worker                                     */
+                     OS_OPT_POST_1,
+                     p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                    POST TO A JOB
+*
+* Description : Ask for one more run of a job.  A job that is not waiting is submitted like OSWorkSubmit() does, while
+*               a job that is already waiting in the same work queue is owed one more run.
+*
+* Arguments   : p_workq  is a pointer to the work queue control block
+*
+*               p_work   is a pointer to the job
+*
+*               prio     is the priority of the job, from 0 (highest) to OS_CFG_WORKQ_PRIO_NBR - 1.  It is ignored
+*                        when the job is already waiting.
+*
+*               p_err    is a pointer to a variable containing an error message which will be set by this function to
+*                        either:
+*
+*                            OS_ERR_NONE               If the job was submitted or is owed one more run
+*                            OS_ERR_OBJ_PTR_NULL       If you passed a NULL pointer for 'p_workq' or 'p_work'
+*                            OS_ERR_OBJ_TYPE           If 'p_workq' is not pointing at a work queue
+*                            OS_ERR_WORK_OVF           If the job is owed too many runs already
+*                            OS_ERR_WORK_PEND          If the job is waiting for its delay or in another work queue
+*                            OS_ERR_WORK_PRIO_INVALID  If 'prio' is not a valid job priority
+*
+*                        or any of the errors returned by OSSemPost().
+*
+* Returns     : none
+*
+* Note(s)     : 1) This function can be called from an ISR.
+*
+*               2) Each post results in one call of the job function.  The runs owed to a job are made one at a time,
+*                  the job going back to the end of the list of its priority after each of them.
+************************************************************************************************************************
+*/
+
+void  OSWorkPost (OS_WORKQ    *p_workq,
+                  OS_WORK     *p_work,
+                  CPU_INT08U   prio,
+                  OS_ERR      *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if ((p_workq == (OS_WORKQ *)0) ||                           /* Must point to a valid work queue and job             */
+        (p_work  == (OS_WORK  *)0)) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (prio >= OS_CFG_WORKQ_PRIO_NBR) {                        /* Must be a valid job priority                         */
+       *p_err = OS_ERR_WORK_PRIO_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_workq->Type != OS_OBJ_TYPE_WORKQ) {                   /* Make sure the work queue was created                 */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if ((p_work->State    == OS_WORK_STATE_PEND) &&             /* Already waiting, owe it one more run (see Note #2)   */
+        (p_work->WorkQPtr == p_workq)) {
+        if (p_work->ActCtr == (OS_OBJ_QTY)-1) {
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_WORK_OVF;
+            return;
+        }
+        p_work->ActCtr++;
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+    if (p_work->State != OS_WORK_STATE_IDLE) {                  /* Waiting for its delay or in another work queue       */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_WORK_PEND;
+        return;
+    }
+    p_work->Prio   = prio;
+    p_work->ActCtr = 1u;
+    OS_WorkLink(p_workq, p_work);
+    CPU_CRITICAL_EXIT();
+
+    (void)OSSemPost(&p_workq->Sem,                              /* Wake up a worker                                     */
+                     OS_OPT_POST_1,
+                     p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                              SUBMIT A JOB AFTER A DELAY
+*
+* Description : Submit a job to a work queue once 'dly' ticks of the timer task have elapsed.
+*
+* Arguments   : p_workq  is a pointer to the work queue control block
+*
+*               p_work   is a pointer to the job
+*
+*               prio     is the priority of the job, from 0 (highest) to OS_CFG_WORKQ_PRIO_NBR - 1.
+*
+*               dly      is the delay, in timer ticks (see OS_CFG_TMR_TASK_RATE_HZ).  0 submits the job at once.
+*
+*               p_err    is a pointer to a variable containing an error message which will be set by this function to
+*                        either:
+*
+*                            OS_ERR_NONE               If the job was submitted
+*                            OS_ERR_OBJ_PTR_NULL       If you passed a NULL pointer for 'p_workq' or 'p_work'
+*                            OS_ERR_OBJ_TYPE           If 'p_workq' is not pointing at a work queue
+*                            OS_ERR_TMR_ISR            If you called this function from an ISR
+*                            OS_ERR_WORK_PEND          If the job is already waiting to run
+*                            OS_ERR_WORK_PRIO_INVALID  If 'prio' is not a valid job priority
+*
+*                        or any of the errors returned by OSTmrSet() or OSTmrStart().
+*
+* Returns     : none
+*
+* Note(s)     : 1) The delay runs on the timer of the job, created by OSWorkCreate().  When it expires, the timer task
+*                  submits the job.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TMR_EN > 0u)
+void  OSWorkSubmitDly (OS_WORKQ    *p_workq,
+                       OS_WORK     *p_work,
+                       CPU_INT08U   prio,
+                       OS_TICK      dly,
+                       OS_ERR      *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    if (dly == 0u) {                                            /* No delay, submit the job now                         */
+        OSWorkSubmit(p_workq, p_work, prio, p_err);
+        return;
+    }
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Timers can't be started from an ISR                  */
+       *p_err = OS_ERR_TMR_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if ((p_workq == (OS_WORKQ *)0) ||                           /* Must point to a valid work queue and job             */
+        (p_work  == (OS_WORK  *)0)) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if (prio >= OS_CFG_WORKQ_PRIO_NBR) {                        /* Must be a valid job priority                         */
+       *p_err = OS_ERR_WORK_PRIO_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_workq->Type != OS_OBJ_TYPE_WORKQ) {                   /* Make sure the work queue was created                 */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_work->State != OS_WORK_STATE_IDLE) {                  /* Job already waiting                                  */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_WORK_PEND;
+        return;
+    }
+    p_work->WorkQPtr = p_workq;
+    p_work->Prio     = prio;
+    p_work->State    = OS_WORK_STATE_DLY;
+    CPU_CRITICAL_EXIT();
+
+    OSTmrSet(&p_work->Tmr,                                      /* See Note #1                                          */
+              dly,
+              0u,
+              OS_WorkTmrCallback,
+              p_work,
+              p_err);
+    if (*p_err == OS_ERR_NONE) {
+        (void)OSTmrStart(&p_work->Tmr, p_err);
+    }
+    if (*p_err != OS_ERR_NONE) {
+        CPU_CRITICAL_ENTER();
+        if (p_work->State == OS_WORK_STATE_DLY) {               /* The delay couldn't be started, back to idle          */
+            p_work->State = OS_WORK_STATE_IDLE;
+        }
+        CPU_CRITICAL_EXIT();
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                   CANCEL A JOB
+*
+* Description : Remove a job that is waiting to run or waiting for its delay to expire.
+*
+* Arguments   : p_work   is a pointer to the job
+*
+*               p_err    is a pointer to a variable containing an error message which will be set by this function to
+*                        either:
+*
+*                            OS_ERR_NONE               If the job was cancelled
+*                            OS_ERR_OBJ_PTR_NULL       If you passed a NULL pointer for 'p_work'
+*                            OS_ERR_WORK_NOT_PEND      If the job was not submitted or a worker already took it
+*
+* Returns     : none
+*
+* Note(s)     : 1) This function can be called from an ISR.  A delay cancelled from an ISR keeps its timer running, but
+*                  the job is not submitted when it expires.
+*
+*               2) A worker that was woken up for a cancelled job finds no job to run and pends again.
+************************************************************************************************************************
+*/
+
+void  OSWorkCancel (OS_WORK  *p_work,
+                    OS_ERR   *p_err)
+{
+    OS_STATE  state;
+#if (OS_CFG_TMR_EN > 0u)
+    OS_ERR    err;
+#endif
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_work == (OS_WORK *)0) {                               /* Must point to a valid job                            */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    state = p_work->State;
+    if (state == OS_WORK_STATE_PEND) {                          /* Remove the job from its list (see Note #2)           */
+        OS_WorkUnlink(p_work);
+    }
+    p_work->State  = OS_WORK_STATE_IDLE;
+    p_work->ActCtr = 0u;                                        /* Runs still owed by OSWorkPost() are dropped          */
+    CPU_CRITICAL_EXIT();
+
+    if (state == OS_WORK_STATE_IDLE) {
+       *p_err = OS_ERR_WORK_NOT_PEND;
+        return;
+    }
+
+#if (OS_CFG_TMR_EN > 0u)
+    if ((state          == OS_WORK_STATE_DLY) &&                /* Stop the delay when possible (see Note #1)           */
+        (OSIntNestingCtr == 0u)) {
+        (void)OSTmrStop(&p_work->Tmr,
+                         OS_OPT_TMR_NONE,
+                         (void *)0,
+                        &err);
+    }
+#endif
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                    WORKER TASK
+*
+* Description : Code of the worker tasks of a work queue.  A worker runs the highest priority job waiting in the work
+*               queue, then pends for the next one.
+*
+* Arguments   : p_arg    is a pointer to the work queue.
+*
+* Returns     : none
+*
+* Note(s)     : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*               2) The job is back to OS_WORK_STATE_IDLE before its function runs, so that the function can submit it
+*                  again.
+*
+*               3) A job still owed runs by OSWorkPost() goes back to the end of the list of its priority instead, and
+*                  a worker is woken up for it once the function returned.
+************************************************************************************************************************
+*/
+
+void  OS_WorkQTask (void  *p_arg)
+{
+    OS_WORKQ      *p_workq;
+    OS_WORK       *p_work;
+    OS_WORK_FNCT   p_fnct;
+    void          *p_fnct_arg;
+    CPU_INT08U     prio;
+    CPU_BOOLEAN    again;
+    OS_ERR         err;
+    CPU_SR_ALLOC();
+
+
+
+    p_workq = (OS_WORKQ *)p_arg;
+    for (;;) {
+        (void)OSSemPend(&p_workq->Sem,                          /* Wait for a job                                       */
+                         0u,
+                         OS_OPT_PEND_BLOCKING,
+                         (CPU_TS *)0,
+                        &err);
+        if (err != OS_ERR_NONE) {
+            continue;
+        }
+
+        p_fnct     = (OS_WORK_FNCT)0;
+        p_fnct_arg = (void *)0;
+        again      = OS_FALSE;
+        CPU_CRITICAL_ENTER();
+        for (prio = 0u; prio < OS_CFG_WORKQ_PRIO_NBR; prio++) { /* Take the highest priority job                        */
+            p_work = p_workq->HeadPtr[prio];
+            if (p_work != (OS_WORK *)0) {
+                OS_WorkUnlink(p_work);
+                if (p_work->ActCtr > 1u) {                      /* See Note #3                                          */
+                    p_work->ActCtr--;
+                    OS_WorkLink(p_workq, p_work);
+                    again          = OS_TRUE;
+                } else {
+                    p_work->ActCtr = 0u;
+                    p_work->State  = OS_WORK_STATE_IDLE;        /* See Note #2                                          */
+                }
+                p_fnct     = p_work->FnctPtr;
+                p_fnct_arg = p_work->ArgPtr;
+                break;
+            }
+        }
+        CPU_CRITICAL_EXIT();
+
+        if (p_fnct != (OS_WORK_FNCT)0) {                        /* No job if it was cancelled                           */
+            p_fnct(p_fnct_arg);
+        }
+        if (again == OS_TRUE) {                                 /* Wake up a worker for the next run of the job         */
+            (void)OSSemPost(&p_workq->Sem,
+                             OS_OPT_POST_1,
+                            &err);
+        }
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                           ADD A JOB TO ITS PRIORITY LIST
+*
+* Description : Append a job at the end of the list of its priority.
+*
+* Arguments   : p_workq  is a pointer to the work queue.
+*
+*               p_work   is a pointer to the job, whose 'Prio' is set.
+*
+* Returns     : none
+*
+* Note(s)     : 1) This function is called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+static  void  OS_WorkLink (OS_WORKQ  *p_workq,
+                           OS_WORK   *p_work)
+{
+    OS_WORK  *p_tail;
+
+
+    p_tail           = p_workq->TailPtr[p_work->Prio];
+    p_work->NextPtr  = (OS_WORK *)0;
+    p_work->PrevPtr  = p_tail;
+    if (p_tail == (OS_WORK *)0) {                               /* First job of this priority                           */
+        p_workq->HeadPtr[p_work->Prio] = p_work;
+    } else {
+        p_tail->NextPtr                = p_work;
+    }
+    p_workq->TailPtr[p_work->Prio] = p_work;
+    p_work->WorkQPtr = p_workq;
+    p_work->State    = OS_WORK_STATE_PEND;
+
+    p_workq->NbrPend++;
+    if (p_workq->NbrPendMax < p_workq->NbrPend) {
+        p_workq->NbrPendMax = p_workq->NbrPend;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                         REMOVE A JOB FROM ITS PRIORITY LIST
+*
+* Description : Unlink a waiting job from the list of its priority.
+*
+* Arguments   : p_work   is a pointer to the job.
+*
+* Returns     : none
+*
+* Note(s)     : 1) This function is called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+static  void  OS_WorkUnlink (OS_WORK  *p_work)
+{
+    OS_WORKQ  *p_workq;
+
+
+    p_workq = p_work->WorkQPtr;
+    if (p_work->PrevPtr == (OS_WORK *)0) {
+        p_workq->HeadPtr[p_work->Prio] = p_work->NextPtr;
+    } else {
+        p_work->PrevPtr->NextPtr       = p_work->NextPtr;
+    }
+    if (p_work->NextPtr == (OS_WORK *)0) {
+        p_workq->TailPtr[p_work->Prio] = p_work->PrevPtr;
+    } else {
+        p_work->NextPtr->PrevPtr       = p_work->PrevPtr;
+    }
+    p_work->NextPtr = (OS_WORK *)0;
+    p_work->PrevPtr = (OS_WORK *)0;
+    p_workq->NbrPend--;
+}
+
+
+/*
+************************************************************************************************************************
+*                                           END OF THE DELAY OF A JOB
+*
+* Description : Callback of the timer of a job, submits the job once its delay has expired.
+*
+* Arguments   : p_tmr    is a pointer to the timer of the job.
+*
+*               p_arg    is a pointer to the job.
+*
+* Returns     : none
+*
+* Note(s)     : 1) This function is called by the timer task.  A job cancelled in the meantime is left alone.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TMR_EN > 0u)
+static  void  OS_WorkTmrCallback (void  *p_tmr,
+                                  void  *p_arg)
+{
+    OS_WORK      *p_work;
+    CPU_BOOLEAN   post;
+    OS_ERR        err;
+    CPU_SR_ALLOC();
+
+
+    (void)p_tmr;
+
+    p_work = (OS_WORK *)p_arg;
+    post   = OS_FALSE;
+    CPU_CRITICAL_ENTER();
+    if (p_work->State == OS_WORK_STATE_DLY) {                   /* See Note #1                                          */
+        p_work->ActCtr = 1u;
+        OS_WorkLink(p_work->WorkQPtr, p_work);
+        post = OS_TRUE;
+    }
+    CPU_CRITICAL_EXIT();
+
+    if (post == OS_TRUE) {
+        (void)OSSemPost(&p_work->WorkQPtr->Sem,
+                         OS_OPT_POST_1,
+                        &err);
+    }
+}
+#endif
+#endif
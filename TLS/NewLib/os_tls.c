@@ -46,6 +46,16 @@ const  CPU_CHAR  *os_tls__c = "$Id: $";
 
 typedef  struct  _reent  REENT;
 
+/*
+************************************************************************************************************************
+*                                                  LOCAL DEFINES
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TLS_MALLOC_ARENA_EN > 0u)
+#define  OS_TLS_ARENA_CLASS_NONE   ((OS_OBJ_QTY)~(OS_OBJ_QTY)0)                /* Block not allocated from the slab   */
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                   LOCAL VARIABLES
@@ -59,6 +69,11 @@ static  CPU_DATA             OS_TLS_NewLibID;                             /* ID
 static  OS_MUTEX             OS_TLS_NewLib_MallocMutex;                   /* NewLib malloc() Mutex                    */
 static  OS_MUTEX             OS_TLS_NewLib_EnvMutex;                      /* NewLib env()    Mutex                    */
 
+#if (OS_CFG_TLS_MALLOC_ARENA_EN > 0u)
+static  CPU_DATA             OS_TLS_ArenaID;                              /* ID used to store the task's arena        */
+static  OS_SLAB             *OS_TLS_ArenaSlabPtr;                         /* Slab shared by all the arenas            */
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                   LOCAL FUNCTIONS
@@ -70,6 +85,15 @@ static  void  OS_TLS_NewLib_MallocUnlock(void);
 static  void  OS_TLS_NewLib_EnvLock     (void);
 static  void  OS_TLS_NewLib_EnvUnlock   (void);
 
+#if (OS_CFG_TLS_MALLOC_ARENA_EN > 0u)
+static  OS_OBJ_QTY  OS_TLS_ArenaClassFind(void  *p_blk);
+
+void   *__real_malloc (size_t   size);
+void    __real_free   (void    *p_blk);
+void   *__real_realloc(void    *p_blk,
+                       size_t   size);
+#endif
+
 
 /*
 ************************************************************************************************************************
@@ -308,6 +332,173 @@ void  OS_TLS_SetValue (OS_TCB     *p_tcb,
 }
 
 
+/*
+************************************************************************************************************************
+*                                        SELECT THE SLAB USED BY THE MALLOC ARENAS
+*
+* Description: This function is called by the application to select the slab that small 'malloc()' requests are served
+*              from.  Until it is called, or if the request doesn't fit in the slab's largest class, 'malloc()' goes to
+*              the NewLib heap.
+*
+* Arguments  : p_slab    is a pointer to a slab created with OSSlabCreate().
+*
+*              p_err     is a pointer to a variable that will hold an error code related to this call.
+*
+*                            OS_ERR_NONE               if the call was successful
+*                            OS_ERR_MEM_INVALID_P_MEM  if 'p_slab' is a NULL pointer
+*                            OS_ERR_OBJ_TYPE           if 'p_slab' is not pointing at a slab
+*                            OS_ERR_TLS_ISR            if you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function must be called once, before any task is given an arena with OS_TLS_ArenaSet().
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TLS_MALLOC_ARENA_EN > 0u)
+void  OS_TLS_ArenaCfg (OS_SLAB  *p_slab,
+                       OS_ERR   *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't be called from an ISR                        */
+       *p_err = OS_ERR_TLS_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_slab == (OS_SLAB *)0) {                               /* Must point to a valid slab                         */
+       *p_err = OS_ERR_MEM_INVALID_P_MEM;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_slab->Type != OS_OBJ_TYPE_SLAB) {                     /* Make sure the slab was created                     */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    OS_TLS_ArenaSlabPtr = p_slab;
+   *p_err               = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              GIVE A TASK A MALLOC ARENA
+*
+* Description: This function is called to give a task a private arena: one memory magazine per size class of the slab
+*              selected by OS_TLS_ArenaCfg().  Small 'malloc()' and 'free()' calls made by the task are then served from
+*              its magazines, without taking the NewLib malloc mutex and, most of the time, without disabling
+*              interrupts.
+*
+* Arguments  : p_tcb      is a pointer to the OS_TCB of the task.  If 'p_tcb' is a NULL pointer then the arena is given
+*                         to the current task.
+*
+*              p_mag_tbl  is a pointer to a table of OS_MEM_MAG with one entry per size class of the slab.  The table
+*                         must remain valid until the task is deleted.
+*
+*              mag_size   is the maximum number of blocks each magazine can hold (see OSMemMagInit()).
+*
+*              p_err      is a pointer to a variable that will hold an error code related to this call.
+*
+*                            OS_ERR_NONE                if the call was successful
+*                            OS_ERR_MEM_INVALID_BLKS    if 'mag_size' is less than 2
+*                            OS_ERR_MEM_INVALID_P_DATA  if 'p_mag_tbl' is a NULL pointer
+*                            OS_ERR_MEM_INVALID_P_MEM   if OS_TLS_ArenaCfg() was not called
+*                            OS_ERR_OS_NOT_RUNNING      if the kernel has not started yet and 'p_tcb' is NULL
+*                            OS_ERR_TLS_ISR             if you called this function from an ISR
+*                            OS_ERR_TLS_NOT_EN          if the task was created by specifying that TLS support was
+*                                                         not needed for the task
+*
+* Returns    : none
+*
+* Note(s)    : 1) A magazine must only be used by one task, so an arena can't be shared by a group of tasks.  Blocks
+*                 freed by a task other than the one that allocated them simply go to the freeing task's magazine:
+*                 all the arenas cache blocks from the same slab partitions so no return list is needed.
+*
+*              2) Tasks without an arena still use the slab, directly through OSMemGet() and OSMemPut().
+*
+*              3) This function must be called once per task, by the task itself or before the task starts to
+*                 allocate memory.  The magazines are flushed back to the slab when the task is deleted.
+************************************************************************************************************************
+*/
+
+void  OS_TLS_ArenaSet (OS_TCB      *p_tcb,
+                       OS_MEM_MAG  *p_mag_tbl,
+                       OS_MEM_QTY   mag_size,
+                       OS_ERR      *p_err)
+{
+    OS_OBJ_QTY  i;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't be called from an ISR                        */
+       *p_err = OS_ERR_TLS_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_mag_tbl == (OS_MEM_MAG *)0) {                         /* Caller must provide the magazines                  */
+       *p_err = OS_ERR_MEM_INVALID_P_DATA;
+        return;
+    }
+#endif
+
+    if (OS_TLS_ArenaSlabPtr == (OS_SLAB *)0) {                  /* The slab must have been selected                   */
+       *p_err = OS_ERR_MEM_INVALID_P_MEM;
+        return;
+    }
+
+    if (p_tcb == (OS_TCB *)0) {                                 /* Does caller want to use current task's TCB?        */
+        p_tcb = OSTCBCurPtr;                                    /* Yes                                                */
+        if (p_tcb == (OS_TCB *)0) {                             /* Is the kernel running?                             */
+           *p_err = OS_ERR_OS_NOT_RUNNING;                      /* No, then caller cannot specify NULL                */
+            return;
+        }
+    }
+    if ((p_tcb->Opt & OS_OPT_TASK_NO_TLS) != OS_OPT_NONE) {     /* See if TLS is available for this task              */
+       *p_err = OS_ERR_TLS_NOT_EN;                              /* No                                                 */
+        return;
+    }
+
+    for (i = 0u; i < OS_TLS_ArenaSlabPtr->NbrClasses; i++) {    /* One magazine per size class                        */
+        OSMemMagInit(&p_mag_tbl[i],
+                     &OS_TLS_ArenaSlabPtr->ClassTbl[i].Mem,
+                      mag_size,
+                      p_err);
+        if (*p_err != OS_ERR_NONE) {
+            return;
+        }
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_tcb->TLS_Tbl[OS_TLS_ArenaID] = (OS_TLS)p_mag_tbl;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 ************************************************************************************************************************
@@ -348,6 +539,14 @@ void  OS_TLS_Init (OS_ERR *p_err)
         return;
     }
 
+#if (OS_CFG_TLS_MALLOC_ARENA_EN > 0u)
+    OS_TLS_ArenaSlabPtr = (OS_SLAB *)0;
+    OS_TLS_ArenaID      = OS_TLS_GetID(p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+#endif
+
     OSMutexCreate(&OS_TLS_NewLib_MallocMutex,
                   "TLS Malloc Mtx",
                    p_err);
@@ -395,6 +594,9 @@ void  OS_TLS_TaskCreate (OS_TCB  *p_tcb)
 * Arguments  : p_tcb     is a pointer to the OS_TCB of the task being deleted.
 *
 * Returns    : none
+*
+* Note(s)    : 1) With OS_CFG_TLS_MALLOC_ARENA_EN, the magazines of the task's arena are flushed after its reentrancy
+*                 structure is freed.  The task can't be using them since it is being deleted.
 ************************************************************************************************************************
 */
 
@@ -403,6 +605,11 @@ void  OS_TLS_TaskDel (OS_TCB  *p_tcb)
     OS_TLS      p_tls;
     FILE       *fp;
     CPU_INT08U  i;
+#if (OS_CFG_TLS_MALLOC_ARENA_EN > 0u)
+    OS_MEM_MAG *p_mag_tbl;
+    OS_OBJ_QTY  ix;
+    OS_ERR      err;
+#endif
 
 
     p_tls = p_tcb->TLS_Tbl[OS_TLS_NewLibID];
@@ -416,6 +623,15 @@ void  OS_TLS_TaskDel (OS_TCB  *p_tcb)
             free((struct _reent *)p_tls);                      /* Free all the heap memory in the reent structure.    */
         }
         p_tcb->TLS_Tbl[OS_TLS_NewLibID] = (OS_TLS)0;           /* Put null pointer indicating no longer valid pointer */
+#if (OS_CFG_TLS_MALLOC_ARENA_EN > 0u)
+        p_mag_tbl = (OS_MEM_MAG *)p_tcb->TLS_Tbl[OS_TLS_ArenaID];
+        if (p_mag_tbl != (OS_MEM_MAG *)0) {                    /* Return the blocks cached by the task's arena        */
+            for (ix = 0u; ix < OS_TLS_ArenaSlabPtr->NbrClasses; ix++) {
+                OSMemMagFlush(&p_mag_tbl[ix], &err);
+            }
+            p_tcb->TLS_Tbl[OS_TLS_ArenaID] = (OS_TLS)0;
+        }
+#endif
     }
 }
 
@@ -432,6 +648,10 @@ void  OS_TLS_TaskDel (OS_TCB  *p_tcb)
 *
 * Note       : 1) It's assumed that OSTCBCurPtr points to the task being switched out and OSTCBHighRdyPtr points to the
 *                 task being switched in.
+*
+*              2) With OS_CFG_TLS_LAZY_SW_EN, this function is only called for tasks created without OS_OPT_TASK_NO_TLS.
+*                 '_impure_ptr' keeps pointing to the reentrancy structure of the last of them while the other tasks
+*                 run, so those tasks must not call the C library.
 ************************************************************************************************************************
 */
 
@@ -617,4 +837,169 @@ void  __env_unlock (struct _reent * reent)
     (void)reent;
     OS_TLS_NewLib_EnvUnlock();
 }
+
+
+/*
+************************************************************************************************************************
+*                                          ARENA 'malloc()', 'free()' AND 'realloc()'
+*
+* Description : Replacements for the NewLib allocation functions, used when the application is linked with:
+*
+*                   -Wl,--wrap=malloc,--wrap=free,--wrap=realloc
+*
+*               A request that fits in a class of the slab selected by OS_TLS_ArenaCfg() is served from the current
+*               task's arena, or from the class partition if the task has no arena or if called from an ISR.  Anything
+*               else, including requests made before OSStart() or when the class is exhausted, goes to the NewLib heap
+*               through '__real_malloc()' and its mutex.
+*
+*               'free()' and 'realloc()' find out where a block came from by its address, so blocks may be freed by
+*               any task.
+*
+* Arguments   : size      is the number of bytes requested.
+*
+*               p_blk     is a pointer to a block returned by 'malloc()' or 'realloc()'.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TLS_MALLOC_ARENA_EN > 0u)
+void  *__wrap_malloc (size_t  size)
+{
+    OS_SLAB_CLASS  *p_class;
+    OS_MEM_MAG     *p_mag_tbl;
+    void           *p_blk;
+    OS_OBJ_QTY      ix;
+    OS_ERR          err;
+
+
+    if ((OSRunning           != OS_STATE_OS_RUNNING) ||
+        (OS_TLS_ArenaSlabPtr == (OS_SLAB *)0)) {
+        return (__real_malloc(size));
+    }
+
+    p_class = OS_TLS_ArenaSlabPtr->ClassTbl;
+    for (ix = 0u; ix < OS_TLS_ArenaSlabPtr->NbrClasses; ix++) { /* Find the smallest class the request fits in         */
+        if (size <= (size_t)p_class->Mem.BlkSize) {
+            break;
+        }
+        p_class++;
+    }
+    if (ix >= OS_TLS_ArenaSlabPtr->NbrClasses) {                /* Too large for the slab                             */
+        return (__real_malloc(size));
+    }
+
+    p_mag_tbl = (OS_MEM_MAG *)0;
+    if (OSIntNestingCtr == 0u) {                                /* Magazines can't be used from an ISR                */
+        p_mag_tbl = (OS_MEM_MAG *)OSTCBCurPtr->TLS_Tbl[OS_TLS_ArenaID];
+    }
+    if (p_mag_tbl != (OS_MEM_MAG *)0) {
+        p_blk = OSMemMagGet(&p_mag_tbl[ix], &err);
+    } else {
+        p_blk = OSMemGet(&p_class->Mem, &err);
+    }
+    if (err != OS_ERR_NONE) {                                   /* Class exhausted, fall back to the heap             */
+        p_blk = __real_malloc(size);
+    }
+    return (p_blk);
+}
+
+
+
+void  __wrap_free (void  *p_blk)
+{
+    OS_MEM_MAG  *p_mag_tbl;
+    OS_OBJ_QTY   ix;
+    OS_ERR       err;
+
+
+    if (p_blk == (void *)0) {
+        return;
+    }
+
+    ix = OS_TLS_ArenaClassFind(p_blk);
+    if (ix == OS_TLS_ARENA_CLASS_NONE) {                        /* Block comes from the heap                          */
+        __real_free(p_blk);
+        return;
+    }
+
+    p_mag_tbl = (OS_MEM_MAG *)0;
+    if ((OSRunning       == OS_STATE_OS_RUNNING) &&
+        (OSIntNestingCtr == 0u)) {
+        p_mag_tbl = (OS_MEM_MAG *)OSTCBCurPtr->TLS_Tbl[OS_TLS_ArenaID];
+    }
+    if (p_mag_tbl != (OS_MEM_MAG *)0) {
+        OSMemMagPut(&p_mag_tbl[ix], p_blk, &err);
+    } else {
+        OSMemPut(&OS_TLS_ArenaSlabPtr->ClassTbl[ix].Mem, p_blk, &err);
+    }
+}
+
+
+
+void  *__wrap_realloc (void    *p_blk,
+                       size_t   size)
+{
+    void        *p_new;
+    OS_OBJ_QTY   ix;
+    size_t       len;
+
+
+    if (p_blk == (void *)0) {
+        return (__wrap_malloc(size));
+    }
+
+    ix = OS_TLS_ArenaClassFind(p_blk);
+    if (ix == OS_TLS_ARENA_CLASS_NONE) {                        /* Block comes from the heap                          */
+        return (__real_realloc(p_blk, size));
+    }
+
+    len = (size_t)OS_TLS_ArenaSlabPtr->ClassTbl[ix].Mem.BlkSize;
+    if (size <= len) {                                          /* Still fits in the same block                       */
+        return (p_blk);
+    }
+    p_new = __wrap_malloc(size);
+    if (p_new != (void *)0) {
+        memcpy(p_new, p_blk, len);
+        __wrap_free(p_blk);
+    }
+    return (p_new);
+}
+
+
+/*
+************************************************************************************************************************
+*                                          FIND THE SLAB CLASS OF A BLOCK
+*
+* Description : Returns the index of the slab class a block was allocated from.
+*
+* Arguments   : p_blk     is a pointer to the block.
+*
+* Returns     : The index of the class, or OS_TLS_ARENA_CLASS_NONE if the block was not allocated from the slab.
+************************************************************************************************************************
+*/
+
+static  OS_OBJ_QTY  OS_TLS_ArenaClassFind (void  *p_blk)
+{
+    OS_SLAB_CLASS  *p_class;
+    OS_OBJ_QTY      ix;
+    CPU_ADDR        blk_addr;
+    CPU_ADDR        part_addr;
+
+
+    if (OS_TLS_ArenaSlabPtr == (OS_SLAB *)0) {
+        return (OS_TLS_ARENA_CLASS_NONE);
+    }
+
+    blk_addr = (CPU_ADDR)p_blk;
+    p_class  = OS_TLS_ArenaSlabPtr->ClassTbl;
+    for (ix = 0u; ix < OS_TLS_ArenaSlabPtr->NbrClasses; ix++) {
+        part_addr = (CPU_ADDR)p_class->Mem.AddrPtr;
+        if ((blk_addr >= part_addr) &&
+            (blk_addr <  (part_addr + ((CPU_ADDR)p_class->Mem.NbrMax * (CPU_ADDR)p_class->Mem.BlkSize)))) {
+            return (ix);
+        }
+        p_class++;
+    }
+    return (OS_TLS_ARENA_CLASS_NONE);
+}
+#endif
 #endif
@@ -0,0 +1,125 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                         KERNEL SELF-TESTS
+*
+* File    : os_test.c
+* Version : V3.08.00
+************************************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "../Source/os.h"
+#include "os_test.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_test__c = "$Id: $";
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                    LOCAL VARIABLES
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MUTEX_EN > 0u)
+static  OS_MUTEX_DEFINE(OS_TestMutex, "Test Mutex");
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                           CHECK THE OBJECTS DEFINED AT COMPILE TIME
+*
+* Description: This function checks every member of the objects defined with the OS_xxx_DEFINE() macros against the
+*              value OSxxxCreate() would have given it.
+*
+* Arguments  : none
+*
+* Returns    : The number of members with a wrong value, 0 if all the objects are correct.
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+CPU_INT16U  OSTestObjDefine (void)
+{
+    CPU_INT16U  fail;
+
+
+    fail = 0u;
+
+#if (OS_CFG_MUTEX_EN > 0u)
+#if (OS_OBJ_TYPE_REQ > 0u)
+    if (OS_TestMutex.Type != OS_OBJ_TYPE_MUTEX) {
+        fail++;
+    }
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    if (OS_TestMutex.NamePtr == (CPU_CHAR *)0) {
+        fail++;
+    }
+#endif
+    if (OS_TestMutex.PendList.HeadPtr != (OS_TCB *)0) {
+        fail++;
+    }
+    if (OS_TestMutex.MutexGrpNextPtr != (OS_MUTEX *)0) {
+        fail++;
+    }
+    if (OS_TestMutex.OwnerTCBPtr != (OS_TCB *)0) {
+        fail++;
+    }
+#if (OS_MUTEX_FAST_EN > 0u)
+    if (OS_TestMutex.GrpLinked != OS_FALSE) {
+        fail++;
+    }
+#endif
+    if (OS_TestMutex.OwnerNestingCtr != 0u) {                   /* A non-zero counter makes the mutex look owned        */
+        fail++;
+    }
+#if (OS_CFG_MUTEX_CEILING_EN > 0u)
+    if (OS_TestMutex.CeilingPrio != OS_PRIO_INIT) {             /* Any other value boosts the first owner               */
+        fail++;
+    }
+#endif
+#if (OS_CFG_MUTEX_THROUGHPUT_EN > 0u)
+    if (OS_TestMutex.Throughput != OS_FALSE) {
+        fail++;
+    }
+#endif
+#if (OS_CFG_TS_EN > 0u)
+    if (OS_TestMutex.TS != 0u) {
+        fail++;
+    }
+#endif
+#if (OS_CFG_MUTEX_BLOCK_STAT_EN > 0u)
+    if ((OS_TestMutex.BlockCtr      != 0u) ||
+        (OS_TestMutex.BlockDepthMax != 0u)) {
+        fail++;
+    }
+#endif
+#if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN > 0u))
+    if (OS_TestMutex.MutexID != 0u) {
+        fail++;
+    }
+#endif
+#endif
+
+    return (fail);
+}
@@ -0,0 +1,60 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                         KERNEL SELF-TESTS
+*
+* File    : os_test.h
+* Version : V3.08.00
+*********************************************************************************************************
+* Note(s) : (1) This module checks kernel behaviour that depends on the configuration and that the
+*               compiler can't check.  To use it, add this folder to the include path, add os_test.c
+*               to the build and call the tests from the application.  Each test returns the number
+*               of failed checks, 0 when it passed.
+*
+*           (2) OSTestObjDefine() checks that the objects defined at compile time (OS_SEM_DEFINE(),
+*               OS_MUTEX_DEFINE(), ...) start in the same state as the objects created at run time.
+*               The static initializers are positional, so a member added to an object without its
+*               OS_OBJ_INIT_xxx() entry shifts every member that follows it.  The test can run
+*               before OSInit().
+*********************************************************************************************************
+*/
+
+#ifndef  OS_TEST_H
+#define  OS_TEST_H
+
+
+#include  <os.h>
+
+
+/*
+*********************************************************************************************************
+*                                          FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+#ifdef __cplusplus
+extern  "C" {
+#endif
+
+CPU_INT16U  OSTestObjDefine  (void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,582 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                      NATIVE BINARY TRACE RECORDER
+*
+* File    : os_trace_events.h
+* Version : V3.08.00
+*********************************************************************************************************
+* Note(s) : (1) This recorder maps every OS_TRACE_xxx() hook of os_trace.h to a fixed-size binary
+*               record (see OS_TRACE_REC) written in a ring buffer in RAM.  To use it, add this
+*               folder to the include path, add os_trace_rec.c to the build, set OS_CFG_TRACE_EN
+*               to 1 in os_cfg.h and call OS_TRACE_INIT() and OS_TRACE_START() after OSInit().
+*
+*           (2) The records are read back with OSTraceRecRead() and can be sent to a host over
+*               any transport (UART, USB, network, debugger, ...).  The host decodes them using
+*               the OS_TRACE_REC_EVT_xxx identifiers below.  os_trace_stream.c provides a task
+*               that drains the buffer continuously through a transport function (see
+*               os_trace_stream.h).
+*
+*           (3) Events can be filtered at run-time by class and by object, see OSTraceRecFilterSet().
+*
+*           (4) The recorder can be configured by defining the following in os_cfg.h:
+*
+*                   OS_TRACE_REC_BUF_SIZE   Number of records in the ring buffer.  MUST be a power of
+*                                           2.
+*
+*                   OS_TRACE_REC_MODE       OS_TRACE_REC_MODE_OVERWRITE  The oldest records are
+*                                                                        overwritten when the
+*                                                                        buffer is full.
+*                                           OS_TRACE_REC_MODE_STOP       New records are discarded
+*                                                                        when the buffer is full.
+*
+*                   OS_TRACE_REC_SHED_LVL   Default number of unread records above which the classes
+*                                           selected with OSTraceRecShedSet() are dropped.
+*
+*                   OS_TRACE_REC_NOINIT_EN  1 to keep the records of the previous run across a reset
+*                                           (see Note #6).
+*
+*                   OS_TRACE_REC_NOINIT     Attribute placing a variable in RAM that the startup code
+*                                           doesn't clear, e.g. __attribute__((section(".noinit"))).
+*
+*           (5) When the transport can't keep up, the events of the classes selected with
+*               OSTraceRecShedSet() are dropped before the buffer is full, so that the buffer
+*               keeps room for the other classes.  A dropped event costs a test and a counter
+*               increment (see OSTraceRecDropGet()), the kernel never waits for the transport.
+*
+*           (6) With OS_TRACE_REC_NOINIT_EN, the ring buffer and its write index are placed in
+*               no-init RAM next to a validity header.  After a reset that kept the RAM content
+*               (fault, watchdog, ...), OS_TRACE_INIT() finds the header valid and keeps the last
+*               records of the previous run in the buffer, where they are the first ones returned
+*               by OSTraceRecRead().  OSTraceRecPmNbrGet() gives their number.  Read them before
+*               OS_TRACE_START(), the new records may otherwise overwrite them.  Nothing is added
+*               to the recording of an event.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_TRACE_EVENTS_H
+#define  OS_TRACE_EVENTS_H
+
+
+#include  <cpu.h>
+#include  <os_cfg.h>
+
+
+/*
+*********************************************************************************************************
+*                                            CONFIGURATION
+*********************************************************************************************************
+*/
+
+#define  OS_TRACE_REC_MODE_OVERWRITE                               0u
+#define  OS_TRACE_REC_MODE_STOP                                    1u
+
+#ifndef  OS_TRACE_REC_BUF_SIZE
+#define  OS_TRACE_REC_BUF_SIZE                                   256u
+#endif
+
+#ifndef  OS_TRACE_REC_MODE
+#define  OS_TRACE_REC_MODE                       OS_TRACE_REC_MODE_OVERWRITE
+#endif
+
+#ifndef  OS_TRACE_REC_SHED_LVL
+#define  OS_TRACE_REC_SHED_LVL                   ((OS_TRACE_REC_BUF_SIZE / 4u) * 3u)
+#endif
+
+#ifndef  OS_TRACE_REC_NOINIT_EN
+#define  OS_TRACE_REC_NOINIT_EN                                    0u
+#endif
+
+#ifndef  OS_TRACE_REC_NOINIT
+#define  OS_TRACE_REC_NOINIT
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                              DATA TYPES
+*
+* Note(s) : (1) '.Ts' is the value of OS_TS_GET() relative to the moment the recorder was initialized
+*               or cleared.
+*
+*           (2) '.ObjId' is the address of the kernel object (task, semaphore, queue, ...) involved in
+*               the event, truncated to 32 bits, or the value of the event (tick counter, delay, ISR
+*               id, ...) when there is no object.
+*
+*           (3) '.Arg' holds the option, priority, or error code of the event when it has one.
+*********************************************************************************************************
+*/
+
+typedef  struct  os_trace_rec {
+    CPU_INT32U  Ts;                                             /* Timestamp (see Note #1)                              */
+    CPU_INT16U  EvtId;                                          /* OS_TRACE_REC_EVT_xxx                                 */
+    CPU_INT16U  Arg;                                            /* Event argument (see Note #3)                         */
+    CPU_INT32U  ObjId;                                          /* Object or value (see Note #2)                        */
+} OS_TRACE_REC;
+
+
+/*
+*********************************************************************************************************
+*                                          EVENT IDENTIFIERS
+*
+* Note(s) : (1) Identifier 0 is never written.  You MUST NOT reorder the identifiers, the host side
+*               decoder relies on their values.
+*********************************************************************************************************
+*/
+
+#define  OS_TRACE_REC_EVT_ISR_ENTER                               1u
+#define  OS_TRACE_REC_EVT_ISR_EXIT                                2u
+#define  OS_TRACE_REC_EVT_ISR_EXIT_TO_SCHEDULER                   3u
+#define  OS_TRACE_REC_EVT_TICK_INCREMENT                          4u
+#define  OS_TRACE_REC_EVT_TASK_CREATE                             5u
+#define  OS_TRACE_REC_EVT_TASK_CREATE_FAILED                      6u
+#define  OS_TRACE_REC_EVT_TASK_DEL                                7u
+#define  OS_TRACE_REC_EVT_TASK_READY                              8u
+#define  OS_TRACE_REC_EVT_TASK_SWITCHED_IN                        9u
+#define  OS_TRACE_REC_EVT_TASK_DLY                               10u
+#define  OS_TRACE_REC_EVT_TASK_SUSPEND                           11u
+#define  OS_TRACE_REC_EVT_TASK_SUSPENDED                         12u
+#define  OS_TRACE_REC_EVT_TASK_RESUME                            13u
+#define  OS_TRACE_REC_EVT_TASK_PREEMPT                           14u
+#define  OS_TRACE_REC_EVT_TASK_PRIO_CHANGE                       15u
+#define  OS_TRACE_REC_EVT_ISR_REGISTER                           16u
+#define  OS_TRACE_REC_EVT_ISR_BEGIN                              17u
+#define  OS_TRACE_REC_EVT_ISR_END                                18u
+#define  OS_TRACE_REC_EVT_TASK_MSG_Q_CREATE                      19u
+#define  OS_TRACE_REC_EVT_TASK_MSG_Q_POST                        20u
+#define  OS_TRACE_REC_EVT_TASK_MSG_Q_POST_FAILED                 21u
+#define  OS_TRACE_REC_EVT_TASK_MSG_Q_PEND                        22u
+#define  OS_TRACE_REC_EVT_TASK_MSG_Q_PEND_FAILED                 23u
+#define  OS_TRACE_REC_EVT_TASK_MSG_Q_PEND_BLOCK                  24u
+#define  OS_TRACE_REC_EVT_TASK_SEM_CREATE                        25u
+#define  OS_TRACE_REC_EVT_TASK_SEM_POST                          26u
+#define  OS_TRACE_REC_EVT_TASK_SEM_POST_FAILED                   27u
+#define  OS_TRACE_REC_EVT_TASK_SEM_PEND                          28u
+#define  OS_TRACE_REC_EVT_TASK_SEM_PEND_FAILED                   29u
+#define  OS_TRACE_REC_EVT_TASK_SEM_PEND_BLOCK                    30u
+#define  OS_TRACE_REC_EVT_MUTEX_CREATE                           31u
+#define  OS_TRACE_REC_EVT_MUTEX_DEL                              32u
+#define  OS_TRACE_REC_EVT_MUTEX_POST                             33u
+#define  OS_TRACE_REC_EVT_MUTEX_POST_FAILED                      34u
+#define  OS_TRACE_REC_EVT_MUTEX_PEND                             35u
+#define  OS_TRACE_REC_EVT_MUTEX_PEND_FAILED                      36u
+#define  OS_TRACE_REC_EVT_MUTEX_PEND_BLOCK                       37u
+#define  OS_TRACE_REC_EVT_MUTEX_TASK_PRIO_INHERIT                38u
+#define  OS_TRACE_REC_EVT_MUTEX_TASK_PRIO_DISINHERIT             39u
+#define  OS_TRACE_REC_EVT_SEM_CREATE                             40u
+#define  OS_TRACE_REC_EVT_SEM_DEL                                41u
+#define  OS_TRACE_REC_EVT_SEM_POST                               42u
+#define  OS_TRACE_REC_EVT_SEM_POST_FAILED                        43u
+#define  OS_TRACE_REC_EVT_SEM_PEND                               44u
+#define  OS_TRACE_REC_EVT_SEM_PEND_FAILED                        45u
+#define  OS_TRACE_REC_EVT_SEM_PEND_BLOCK                         46u
+#define  OS_TRACE_REC_EVT_Q_CREATE                               47u
+#define  OS_TRACE_REC_EVT_Q_DEL                                  48u
+#define  OS_TRACE_REC_EVT_Q_POST                                 49u
+#define  OS_TRACE_REC_EVT_Q_POST_FAILED                          50u
+#define  OS_TRACE_REC_EVT_Q_PEND                                 51u
+#define  OS_TRACE_REC_EVT_Q_PEND_FAILED                          52u
+#define  OS_TRACE_REC_EVT_Q_PEND_BLOCK                           53u
+#define  OS_TRACE_REC_EVT_FLAG_CREATE                            54u
+#define  OS_TRACE_REC_EVT_FLAG_DEL                               55u
+#define  OS_TRACE_REC_EVT_FLAG_POST                              56u
+#define  OS_TRACE_REC_EVT_FLAG_POST_FAILED                       57u
+#define  OS_TRACE_REC_EVT_FLAG_PEND                              58u
+#define  OS_TRACE_REC_EVT_FLAG_PEND_FAILED                       59u
+#define  OS_TRACE_REC_EVT_FLAG_PEND_BLOCK                        60u
+#define  OS_TRACE_REC_EVT_MEM_CREATE                             61u
+#define  OS_TRACE_REC_EVT_MEM_PUT                                62u
+#define  OS_TRACE_REC_EVT_MEM_PUT_FAILED                         63u
+#define  OS_TRACE_REC_EVT_MEM_GET                                64u
+#define  OS_TRACE_REC_EVT_MEM_GET_FAILED                         65u
+#define  OS_TRACE_REC_EVT_MUTEX_DEL_ENTER                        66u
+#define  OS_TRACE_REC_EVT_MUTEX_POST_ENTER                       67u
+#define  OS_TRACE_REC_EVT_MUTEX_PEND_ENTER                       68u
+#define  OS_TRACE_REC_EVT_TASK_MSG_Q_POST_ENTER                  69u
+#define  OS_TRACE_REC_EVT_TASK_MSG_Q_PEND_ENTER                  70u
+#define  OS_TRACE_REC_EVT_TASK_SEM_POST_ENTER                    71u
+#define  OS_TRACE_REC_EVT_TASK_SEM_PEND_ENTER                    72u
+#define  OS_TRACE_REC_EVT_TASK_RESUME_ENTER                      73u
+#define  OS_TRACE_REC_EVT_TASK_SUSPEND_ENTER                     74u
+#define  OS_TRACE_REC_EVT_SEM_DEL_ENTER                          75u
+#define  OS_TRACE_REC_EVT_SEM_POST_ENTER                         76u
+#define  OS_TRACE_REC_EVT_SEM_PEND_ENTER                         77u
+#define  OS_TRACE_REC_EVT_Q_DEL_ENTER                            78u
+#define  OS_TRACE_REC_EVT_Q_POST_ENTER                           79u
+#define  OS_TRACE_REC_EVT_Q_PEND_ENTER                           80u
+#define  OS_TRACE_REC_EVT_FLAG_DEL_ENTER                         81u
+#define  OS_TRACE_REC_EVT_FLAG_POST_ENTER                        82u
+#define  OS_TRACE_REC_EVT_FLAG_PEND_ENTER                        83u
+#define  OS_TRACE_REC_EVT_MEM_PUT_ENTER                          84u
+#define  OS_TRACE_REC_EVT_MEM_GET_ENTER                          85u
+#define  OS_TRACE_REC_EVT_MUTEX_DEL_EXIT                         86u
+#define  OS_TRACE_REC_EVT_MUTEX_POST_EXIT                        87u
+#define  OS_TRACE_REC_EVT_MUTEX_PEND_EXIT                        88u
+#define  OS_TRACE_REC_EVT_TASK_MSG_Q_POST_EXIT                   89u
+#define  OS_TRACE_REC_EVT_TASK_MSG_Q_PEND_EXIT                   90u
+#define  OS_TRACE_REC_EVT_TASK_SEM_POST_EXIT                     91u
+#define  OS_TRACE_REC_EVT_TASK_SEM_PEND_EXIT                     92u
+#define  OS_TRACE_REC_EVT_TASK_RESUME_EXIT                       93u
+#define  OS_TRACE_REC_EVT_TASK_SUSPEND_EXIT                      94u
+#define  OS_TRACE_REC_EVT_SEM_DEL_EXIT                           95u
+#define  OS_TRACE_REC_EVT_SEM_POST_EXIT                          96u
+#define  OS_TRACE_REC_EVT_SEM_PEND_EXIT                          97u
+#define  OS_TRACE_REC_EVT_Q_DEL_EXIT                             98u
+#define  OS_TRACE_REC_EVT_Q_POST_EXIT                            99u
+#define  OS_TRACE_REC_EVT_Q_PEND_EXIT                           100u
+#define  OS_TRACE_REC_EVT_FLAG_DEL_EXIT                         101u
+#define  OS_TRACE_REC_EVT_FLAG_POST_EXIT                        102u
+#define  OS_TRACE_REC_EVT_FLAG_PEND_EXIT                        103u
+#define  OS_TRACE_REC_EVT_MEM_PUT_EXIT                          104u
+#define  OS_TRACE_REC_EVT_MEM_GET_EXIT                          105u
+#define  OS_TRACE_REC_EVT_MSG_Q_RES_OVR                         106u
+
+
+/*
+*********************************************************************************************************
+*                                             EVENT FILTER
+*
+* Note(s) : (1) Each event belongs to one of the classes below.  The filter (see OSTraceRecFilterSet())
+*               is a combination of:
+*
+*                   OS_TRACE_REC_CLASS_xxx                  Record the events of all the objects of
+*                                                           the class.
+*
+*                   OS_TRACE_REC_SEL(OS_TRACE_REC_CLASS_xxx)  Record the events of the objects of the
+*                                                           class that were selected with
+*                                                           OS_TRACE_REC_xxx_SEL().
+*
+*               For example, to record the interrupts and a single mutex:
+*
+*                   OS_TRACE_REC_MUTEX_SEL(&MyMutex, 1u);
+*                   OSTraceRecFilterSet(OS_TRACE_REC_CLASS_ISR |
+*                                       OS_TRACE_REC_SEL(OS_TRACE_REC_CLASS_MUTEX));
+*
+*           (2) The recorder keeps the class and select bits of each kernel object in the object's
+*               identifier field reserved for tracers ('.SemID', '.MutexID', '.MsgQID', '.FlagID',
+*               '.MemID' and '.TaskID').  These bits are set when the object is created, so an
+*               event is kept or discarded with a single test, before the record is built.
+*
+*           (3) Events that can be generated with an invalid object (the xxx_FAILED events, the API
+*               enter events, OSTaskSemPost() and OSTaskQPost() on 'self') and events that don't
+*               refer to a kernel object are filtered by class only.
+*********************************************************************************************************
+*/
+
+#define  OS_TRACE_REC_CLASS_TASK                              0x0001u
+#define  OS_TRACE_REC_CLASS_ISR                               0x0002u
+#define  OS_TRACE_REC_CLASS_SEM                               0x0004u
+#define  OS_TRACE_REC_CLASS_MUTEX                             0x0008u
+#define  OS_TRACE_REC_CLASS_Q                                 0x0010u
+#define  OS_TRACE_REC_CLASS_FLAG                              0x0020u
+#define  OS_TRACE_REC_CLASS_MEM                               0x0040u
+#define  OS_TRACE_REC_CLASS_TICK                              0x0080u
+#define  OS_TRACE_REC_CLASS_ALL                               0x00FFu
+
+#define  OS_TRACE_REC_SEL(cls)                            ((CPU_INT16U)((CPU_INT16U)(cls) << 8u))
+
+#define  OS_TRACE_REC_ID_SEL(id, cls, sel)                                                                             \
+         ((id) = ((sel) != 0u) ? (CPU_INT16U)((id) |  OS_TRACE_REC_SEL(cls))                                           \
+                               : (CPU_INT16U)((id) & ~OS_TRACE_REC_SEL(cls)))
+
+#if (OS_CFG_TASK_Q_EN > 0u)
+#define  OS_TRACE_REC_TASK_SEL(p_tcb, sel)                                                                             \
+         do {                                                                                                          \
+             OS_TRACE_REC_ID_SEL((p_tcb)->TaskID,      OS_TRACE_REC_CLASS_TASK, sel);                                  \
+             OS_TRACE_REC_ID_SEL((p_tcb)->SemID,       OS_TRACE_REC_CLASS_SEM,  sel);                                  \
+             OS_TRACE_REC_ID_SEL((p_tcb)->MsgQ.MsgQID, OS_TRACE_REC_CLASS_Q,    sel);                                  \
+         } while (0)
+#else
+#define  OS_TRACE_REC_TASK_SEL(p_tcb, sel)                                                                             \
+         do {                                                                                                          \
+             OS_TRACE_REC_ID_SEL((p_tcb)->TaskID,      OS_TRACE_REC_CLASS_TASK, sel);                                  \
+             OS_TRACE_REC_ID_SEL((p_tcb)->SemID,       OS_TRACE_REC_CLASS_SEM,  sel);                                  \
+         } while (0)
+#endif
+#define  OS_TRACE_REC_SEM_SEL(p_sem, sel)      OS_TRACE_REC_ID_SEL((p_sem)->SemID, OS_TRACE_REC_CLASS_SEM, sel)
+#define  OS_TRACE_REC_MUTEX_SEL(p_mutex, sel)  OS_TRACE_REC_ID_SEL((p_mutex)->MutexID, OS_TRACE_REC_CLASS_MUTEX, sel)
+#define  OS_TRACE_REC_Q_SEL(p_q, sel)          OS_TRACE_REC_ID_SEL((p_q)->MsgQ.MsgQID, OS_TRACE_REC_CLASS_Q, sel)
+#define  OS_TRACE_REC_FLAG_SEL(p_grp, sel)     OS_TRACE_REC_ID_SEL((p_grp)->FlagID, OS_TRACE_REC_CLASS_FLAG, sel)
+#define  OS_TRACE_REC_MEM_SEL(p_mem, sel)      OS_TRACE_REC_ID_SEL((p_mem)->MemID, OS_TRACE_REC_CLASS_MEM, sel)
+
+
+/*
+*********************************************************************************************************
+*                                           GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+extern  CPU_INT16U  volatile  OSTraceRecFilter;                 /* Active filter, 0 when the recording is stopped       */
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void        OSTraceRecInit      (void);
+
+void        OSTraceRecStart     (void);
+
+void        OSTraceRecStop      (void);
+
+void        OSTraceRecClear     (void);
+
+void        OSTraceRecFilterSet (CPU_INT16U     filter);
+
+CPU_INT16U  OSTraceRecFilterGet (void);
+
+CPU_INT16U  OSTraceRecRead      (OS_TRACE_REC  *p_dest,
+                                 CPU_INT16U     nbr_max);
+
+CPU_INT32U  OSTraceRecLostGet   (void);
+
+void        OSTraceRecShedSet   (CPU_INT16U     cls,
+                                 CPU_INT16U     lvl);
+
+CPU_INT32U  OSTraceRecDropGet   (CPU_INT16U     cls);
+
+CPU_INT16U  OSTraceRecPmNbrGet  (void);
+
+void        OS_TraceRecEvt      (CPU_INT16U     evt_id,
+                                 CPU_INT16U     cls,
+                                 CPU_INT32U     obj_id,
+                                 CPU_INT16U     arg);
+
+
+/*
+*********************************************************************************************************
+*                                          RECORDING MACROS
+*
+* Note(s) : (1) OS_TRACE_REC_OBJ() filters on the bits kept in the object, OS_TRACE_REC_CLASS() and
+*               OS_TRACE_REC_VAL() on the class only.  OS_TRACE_REC_CREATE() initializes the bits of
+*               a new object (the object is not selected) before recording the event.
+*********************************************************************************************************
+*/
+
+#define  OS_TRACE_REC_EVT(evt, cls)                                                                                    \
+         do {                                                                                                          \
+             if ((OSTraceRecFilter & OS_TRACE_REC_CLASS_##cls) != 0u) {                                                \
+                 OS_TraceRecEvt(OS_TRACE_REC_EVT_##evt, OS_TRACE_REC_CLASS_##cls, 0u, 0u);                             \
+             }                                                                                                         \
+         } while (0)
+
+#define  OS_TRACE_REC_VAL(evt, cls, val, arg)                                                                          \
+         do {                                                                                                          \
+             if ((OSTraceRecFilter & OS_TRACE_REC_CLASS_##cls) != 0u) {                                                \
+                 OS_TraceRecEvt(OS_TRACE_REC_EVT_##evt,                                                                \
+                                OS_TRACE_REC_CLASS_##cls,                                                              \
+                                (CPU_INT32U)(val),                                                                     \
+                                (CPU_INT16U)(arg));                                                                    \
+             }                                                                                                         \
+         } while (0)
+
+#define  OS_TRACE_REC_CLASS(evt, cls, p_obj, arg)                                                                      \
+         do {                                                                                                          \
+             if ((OSTraceRecFilter & OS_TRACE_REC_CLASS_##cls) != 0u) {                                                \
+                 OS_TraceRecEvt(OS_TRACE_REC_EVT_##evt,                                                                \
+                                OS_TRACE_REC_CLASS_##cls,                                                              \
+                                (CPU_INT32U)(CPU_ADDR)(p_obj),                                                         \
+                                (CPU_INT16U)(arg));                                                                    \
+             }                                                                                                         \
+         } while (0)
+
+#define  OS_TRACE_REC_OBJ(evt, p_obj, id, arg)                                                                         \
+         do {                                                                                                          \
+             if ((OSTraceRecFilter & (p_obj)->id) != 0u) {                                                             \
+                 OS_TraceRecEvt(OS_TRACE_REC_EVT_##evt,                                                                \
+                                (p_obj)->id,                                                                           \
+                                (CPU_INT32U)(CPU_ADDR)(p_obj),                                                         \
+                                (CPU_INT16U)(arg));                                                                    \
+             }                                                                                                         \
+         } while (0)
+
+#define  OS_TRACE_REC_CREATE(evt, cls, p_obj, id)                                                                      \
+         do {                                                                                                          \
+             (p_obj)->id = OS_TRACE_REC_CLASS_##cls;                                                                   \
+             OS_TRACE_REC_OBJ(evt, p_obj, id, 0u);                                                                     \
+         } while (0)
+
+
+/*
+*********************************************************************************************************
+*                                         uC/OS-III TRACE HOOKS
+*********************************************************************************************************
+*/
+
+#define  OS_TRACE_INIT()                                        OSTraceRecInit()
+#define  OS_TRACE_START()                                       OSTraceRecStart()
+#define  OS_TRACE_STOP()                                        OSTraceRecStop()
+#define  OS_TRACE_CLEAR()                                       OSTraceRecClear()
+#define  OS_TRACE_ISR_ENTER()                                   OS_TRACE_REC_EVT(ISR_ENTER, ISR)
+#define  OS_TRACE_ISR_EXIT()                                    OS_TRACE_REC_EVT(ISR_EXIT, ISR)
+#define  OS_TRACE_ISR_EXIT_TO_SCHEDULER()                       OS_TRACE_REC_EVT(ISR_EXIT_TO_SCHEDULER, ISR)
+#define  OS_TRACE_TICK_INCREMENT(OSTickCtr)                     OS_TRACE_REC_VAL(TICK_INCREMENT, TICK, OSTickCtr, 0u)
+#define  OS_TRACE_TASK_CREATE(p_tcb)                            OS_TRACE_REC_CREATE(TASK_CREATE, TASK, p_tcb, TaskID)
+#define  OS_TRACE_TASK_CREATE_FAILED(p_tcb)                     OS_TRACE_REC_CLASS(TASK_CREATE_FAILED, TASK, p_tcb, 0u)
+#define  OS_TRACE_TASK_DEL(p_tcb)                               OS_TRACE_REC_OBJ(TASK_DEL, p_tcb, TaskID, 0u)
+#define  OS_TRACE_TASK_READY(p_tcb)                             OS_TRACE_REC_OBJ(TASK_READY, p_tcb, TaskID, 0u)
+#define  OS_TRACE_TASK_SWITCHED_IN(p_tcb)                       OS_TRACE_REC_OBJ(TASK_SWITCHED_IN, p_tcb, TaskID, 0u)
+#define  OS_TRACE_TASK_DLY(dly_ticks)                           OS_TRACE_REC_VAL(TASK_DLY, TASK, dly_ticks, 0u)
+#define  OS_TRACE_TASK_SUSPEND(p_tcb)                           OS_TRACE_REC_OBJ(TASK_SUSPEND, p_tcb, TaskID, 0u)
+#define  OS_TRACE_TASK_SUSPENDED(p_tcb)                         OS_TRACE_REC_OBJ(TASK_SUSPENDED, p_tcb, TaskID, 0u)
+#define  OS_TRACE_TASK_RESUME(p_tcb)                            OS_TRACE_REC_OBJ(TASK_RESUME, p_tcb, TaskID, 0u)
+#define  OS_TRACE_TASK_PREEMPT(p_tcb)                           OS_TRACE_REC_OBJ(TASK_PREEMPT, p_tcb, TaskID, 0u)
+#define  OS_TRACE_TASK_PRIO_CHANGE(p_tcb, prio)                 OS_TRACE_REC_OBJ(TASK_PRIO_CHANGE, p_tcb, TaskID, prio)
+#define  OS_TRACE_ISR_REGISTER(isr_id, isr_name, isr_prio)      OS_TRACE_REC_VAL(ISR_REGISTER, ISR, isr_id, isr_prio)
+#define  OS_TRACE_ISR_BEGIN(isr_id)                             OS_TRACE_REC_VAL(ISR_BEGIN, ISR, isr_id, 0u)
+#define  OS_TRACE_ISR_END()                                     OS_TRACE_REC_EVT(ISR_END, ISR)
+#define  OS_TRACE_TASK_MSG_Q_CREATE(p_msg_q, p_name)                                                                   \
+                                                      OS_TRACE_REC_CREATE(TASK_MSG_Q_CREATE, Q, p_msg_q, MsgQID)
+#define  OS_TRACE_TASK_MSG_Q_POST(p_msg_q)                      OS_TRACE_REC_CLASS(TASK_MSG_Q_POST, Q, p_msg_q, 0u)
+#define  OS_TRACE_TASK_MSG_Q_POST_FAILED(p_msg_q)                                                                      \
+                                                      OS_TRACE_REC_CLASS(TASK_MSG_Q_POST_FAILED, Q, p_msg_q, 0u)
+#define  OS_TRACE_TASK_MSG_Q_PEND(p_msg_q)                      OS_TRACE_REC_OBJ(TASK_MSG_Q_PEND, p_msg_q, MsgQID, 0u)
+#define  OS_TRACE_TASK_MSG_Q_PEND_FAILED(p_msg_q)                                                                      \
+                                                      OS_TRACE_REC_CLASS(TASK_MSG_Q_PEND_FAILED, Q, p_msg_q, 0u)
+#define  OS_TRACE_TASK_MSG_Q_PEND_BLOCK(p_msg_q)                                                                       \
+                                                      OS_TRACE_REC_OBJ(TASK_MSG_Q_PEND_BLOCK, p_msg_q, MsgQID, 0u)
+#define  OS_TRACE_TASK_SEM_CREATE(p_tcb, p_name)                OS_TRACE_REC_CREATE(TASK_SEM_CREATE, SEM, p_tcb, SemID)
+#define  OS_TRACE_TASK_SEM_POST(p_tcb)                          OS_TRACE_REC_CLASS(TASK_SEM_POST, SEM, p_tcb, 0u)
+#define  OS_TRACE_TASK_SEM_POST_FAILED(p_tcb)                   OS_TRACE_REC_CLASS(TASK_SEM_POST_FAILED, SEM, p_tcb, 0u)
+#define  OS_TRACE_TASK_SEM_PEND(p_tcb)                          OS_TRACE_REC_OBJ(TASK_SEM_PEND, p_tcb, SemID, 0u)
+#define  OS_TRACE_TASK_SEM_PEND_FAILED(p_tcb)                   OS_TRACE_REC_CLASS(TASK_SEM_PEND_FAILED, SEM, p_tcb, 0u)
+#define  OS_TRACE_TASK_SEM_PEND_BLOCK(p_tcb)                    OS_TRACE_REC_OBJ(TASK_SEM_PEND_BLOCK, p_tcb, SemID, 0u)
+#define  OS_TRACE_MUTEX_CREATE(p_mutex, p_name)                                                                        \
+                                                      OS_TRACE_REC_CREATE(MUTEX_CREATE, MUTEX, p_mutex, MutexID)
+#define  OS_TRACE_MUTEX_DEL(p_mutex)                            OS_TRACE_REC_OBJ(MUTEX_DEL, p_mutex, MutexID, 0u)
+#define  OS_TRACE_MUTEX_POST(p_mutex)                           OS_TRACE_REC_OBJ(MUTEX_POST, p_mutex, MutexID, 0u)
+#define  OS_TRACE_MUTEX_POST_FAILED(p_mutex)                                                                           \
+                                                      OS_TRACE_REC_CLASS(MUTEX_POST_FAILED, MUTEX, p_mutex, 0u)
+#define  OS_TRACE_MUTEX_PEND(p_mutex)                           OS_TRACE_REC_OBJ(MUTEX_PEND, p_mutex, MutexID, 0u)
+#define  OS_TRACE_MUTEX_PEND_FAILED(p_mutex)                                                                           \
+                                                      OS_TRACE_REC_CLASS(MUTEX_PEND_FAILED, MUTEX, p_mutex, 0u)
+#define  OS_TRACE_MUTEX_PEND_BLOCK(p_mutex)                     OS_TRACE_REC_OBJ(MUTEX_PEND_BLOCK, p_mutex, MutexID, 0u)
+#define  OS_TRACE_MUTEX_TASK_PRIO_INHERIT(p_tcb, prio)                                                                 \
+                                                      OS_TRACE_REC_CLASS(MUTEX_TASK_PRIO_INHERIT, MUTEX, p_tcb, prio)
+#define  OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb, prio)                                                              \
+                                                      OS_TRACE_REC_CLASS(MUTEX_TASK_PRIO_DISINHERIT, MUTEX, p_tcb, prio)
+#define  OS_TRACE_SEM_CREATE(p_sem, p_name)                     OS_TRACE_REC_CREATE(SEM_CREATE, SEM, p_sem, SemID)
+#define  OS_TRACE_SEM_DEL(p_sem)                                OS_TRACE_REC_OBJ(SEM_DEL, p_sem, SemID, 0u)
+#define  OS_TRACE_SEM_POST(p_sem)                               OS_TRACE_REC_OBJ(SEM_POST, p_sem, SemID, 0u)
+#define  OS_TRACE_SEM_POST_FAILED(p_sem)                        OS_TRACE_REC_CLASS(SEM_POST_FAILED, SEM, p_sem, 0u)
+#define  OS_TRACE_SEM_PEND(p_sem)                               OS_TRACE_REC_OBJ(SEM_PEND, p_sem, SemID, 0u)
+#define  OS_TRACE_SEM_PEND_FAILED(p_sem)                        OS_TRACE_REC_CLASS(SEM_PEND_FAILED, SEM, p_sem, 0u)
+#define  OS_TRACE_SEM_PEND_BLOCK(p_sem)                         OS_TRACE_REC_OBJ(SEM_PEND_BLOCK, p_sem, SemID, 0u)
+#define  OS_TRACE_Q_CREATE(p_q, p_name)                         OS_TRACE_REC_CREATE(Q_CREATE, Q, p_q, MsgQ.MsgQID)
+#define  OS_TRACE_Q_DEL(p_q)                                    OS_TRACE_REC_OBJ(Q_DEL, p_q, MsgQ.MsgQID, 0u)
+#define  OS_TRACE_Q_POST(p_q)                                   OS_TRACE_REC_OBJ(Q_POST, p_q, MsgQ.MsgQID, 0u)
+#define  OS_TRACE_Q_POST_FAILED(p_q)                            OS_TRACE_REC_CLASS(Q_POST_FAILED, Q, p_q, 0u)
+#define  OS_TRACE_Q_PEND(p_q)                                   OS_TRACE_REC_OBJ(Q_PEND, p_q, MsgQ.MsgQID, 0u)
+#define  OS_TRACE_Q_PEND_FAILED(p_q)                            OS_TRACE_REC_CLASS(Q_PEND_FAILED, Q, p_q, 0u)
+#define  OS_TRACE_Q_PEND_BLOCK(p_q)                             OS_TRACE_REC_OBJ(Q_PEND_BLOCK, p_q, MsgQ.MsgQID, 0u)
+#define  OS_TRACE_MSG_Q_RES_OVR(p_msg_q)                        OS_TRACE_REC_OBJ(MSG_Q_RES_OVR, p_msg_q, MsgQID, 0u)
+#define  OS_TRACE_FLAG_CREATE(p_grp, p_name)                    OS_TRACE_REC_CREATE(FLAG_CREATE, FLAG, p_grp, FlagID)
+#define  OS_TRACE_FLAG_DEL(p_grp)                               OS_TRACE_REC_OBJ(FLAG_DEL, p_grp, FlagID, 0u)
+#define  OS_TRACE_FLAG_POST(p_grp)                              OS_TRACE_REC_OBJ(FLAG_POST, p_grp, FlagID, 0u)
+#define  OS_TRACE_FLAG_POST_FAILED(p_grp)                       OS_TRACE_REC_CLASS(FLAG_POST_FAILED, FLAG, p_grp, 0u)
+#define  OS_TRACE_FLAG_PEND(p_grp)                              OS_TRACE_REC_OBJ(FLAG_PEND, p_grp, FlagID, 0u)
+#define  OS_TRACE_FLAG_PEND_FAILED(p_grp)                       OS_TRACE_REC_CLASS(FLAG_PEND_FAILED, FLAG, p_grp, 0u)
+#define  OS_TRACE_FLAG_PEND_BLOCK(p_grp)                        OS_TRACE_REC_OBJ(FLAG_PEND_BLOCK, p_grp, FlagID, 0u)
+#define  OS_TRACE_MEM_CREATE(p_mem, p_name)                     OS_TRACE_REC_CREATE(MEM_CREATE, MEM, p_mem, MemID)
+#define  OS_TRACE_MEM_PUT(p_mem)                                OS_TRACE_REC_OBJ(MEM_PUT, p_mem, MemID, 0u)
+#define  OS_TRACE_MEM_PUT_FAILED(p_mem)                         OS_TRACE_REC_CLASS(MEM_PUT_FAILED, MEM, p_mem, 0u)
+#define  OS_TRACE_MEM_GET(p_mem)                                OS_TRACE_REC_OBJ(MEM_GET, p_mem, MemID, 0u)
+#define  OS_TRACE_MEM_GET_FAILED(p_mem)                         OS_TRACE_REC_CLASS(MEM_GET_FAILED, MEM, p_mem, 0u)
+
+
+#if (defined(OS_CFG_TRACE_API_ENTER_EN) && (OS_CFG_TRACE_API_ENTER_EN > 0u))
+#define  OS_TRACE_MUTEX_DEL_ENTER(p_mutex, opt)                 OS_TRACE_REC_CLASS(MUTEX_DEL_ENTER, MUTEX, p_mutex, opt)
+#define  OS_TRACE_MUTEX_POST_ENTER(p_mutex, opt)                                                                       \
+                                                      OS_TRACE_REC_CLASS(MUTEX_POST_ENTER, MUTEX, p_mutex, opt)
+#define  OS_TRACE_MUTEX_PEND_ENTER(p_mutex, timeout, opt, p_ts)                                                        \
+                                                      OS_TRACE_REC_CLASS(MUTEX_PEND_ENTER, MUTEX, p_mutex, opt)
+#define  OS_TRACE_TASK_MSG_Q_POST_ENTER(p_msg_q, p_void, msg_size, opt)                                                \
+                                                      OS_TRACE_REC_CLASS(TASK_MSG_Q_POST_ENTER, Q, p_msg_q, opt)
+#define  OS_TRACE_TASK_MSG_Q_PEND_ENTER(p_msg_q, timeout, opt, p_msg_size, p_ts)                                       \
+                                                      OS_TRACE_REC_CLASS(TASK_MSG_Q_PEND_ENTER, Q, p_msg_q, opt)
+#define  OS_TRACE_TASK_SEM_POST_ENTER(p_tcb, opt)               OS_TRACE_REC_CLASS(TASK_SEM_POST_ENTER, SEM, p_tcb, opt)
+#define  OS_TRACE_TASK_SEM_PEND_ENTER(p_tcb, timeout, opt, p_ts)                                                       \
+                                                      OS_TRACE_REC_CLASS(TASK_SEM_PEND_ENTER, SEM, p_tcb, opt)
+#define  OS_TRACE_TASK_RESUME_ENTER(p_tcb)                      OS_TRACE_REC_CLASS(TASK_RESUME_ENTER, TASK, p_tcb, 0u)
+#define  OS_TRACE_TASK_SUSPEND_ENTER(p_tcb)                     OS_TRACE_REC_CLASS(TASK_SUSPEND_ENTER, TASK, p_tcb, 0u)
+#define  OS_TRACE_SEM_DEL_ENTER(p_sem, opt)                     OS_TRACE_REC_CLASS(SEM_DEL_ENTER, SEM, p_sem, opt)
+#define  OS_TRACE_SEM_POST_ENTER(p_sem, opt)                    OS_TRACE_REC_CLASS(SEM_POST_ENTER, SEM, p_sem, opt)
+#define  OS_TRACE_SEM_PEND_ENTER(p_sem, timeout, opt, p_ts)     OS_TRACE_REC_CLASS(SEM_PEND_ENTER, SEM, p_sem, opt)
+#define  OS_TRACE_Q_DEL_ENTER(p_q, opt)                         OS_TRACE_REC_CLASS(Q_DEL_ENTER, Q, p_q, opt)
+#define  OS_TRACE_Q_POST_ENTER(p_q, p_void, msg_size, opt)      OS_TRACE_REC_CLASS(Q_POST_ENTER, Q, p_q, opt)
+#define  OS_TRACE_Q_PEND_ENTER(p_q, timeout, opt, p_msg_size, p_ts)                                                    \
+                                                      OS_TRACE_REC_CLASS(Q_PEND_ENTER, Q, p_q, opt)
+#define  OS_TRACE_FLAG_DEL_ENTER(p_grp, opt)                    OS_TRACE_REC_CLASS(FLAG_DEL_ENTER, FLAG, p_grp, opt)
+#define  OS_TRACE_FLAG_POST_ENTER(p_grp, flags, opt)            OS_TRACE_REC_CLASS(FLAG_POST_ENTER, FLAG, p_grp, opt)
+#define  OS_TRACE_FLAG_PEND_ENTER(p_grp, flags, timeout, opt, p_ts)                                                    \
+                                                      OS_TRACE_REC_CLASS(FLAG_PEND_ENTER, FLAG, p_grp, opt)
+#define  OS_TRACE_MEM_PUT_ENTER(p_mem, p_blk)                   OS_TRACE_REC_CLASS(MEM_PUT_ENTER, MEM, p_mem, 0u)
+#define  OS_TRACE_MEM_GET_ENTER(p_mem)                          OS_TRACE_REC_CLASS(MEM_GET_ENTER, MEM, p_mem, 0u)
+#endif
+
+
+#if (defined(OS_CFG_TRACE_API_EXIT_EN) && (OS_CFG_TRACE_API_EXIT_EN > 0u))
+#define  OS_TRACE_MUTEX_DEL_EXIT(RetVal)                        OS_TRACE_REC_VAL(MUTEX_DEL_EXIT, MUTEX, 0u, RetVal)
+#define  OS_TRACE_MUTEX_POST_EXIT(RetVal)                       OS_TRACE_REC_VAL(MUTEX_POST_EXIT, MUTEX, 0u, RetVal)
+#define  OS_TRACE_MUTEX_PEND_EXIT(RetVal)                       OS_TRACE_REC_VAL(MUTEX_PEND_EXIT, MUTEX, 0u, RetVal)
+#define  OS_TRACE_TASK_MSG_Q_POST_EXIT(RetVal)                  OS_TRACE_REC_VAL(TASK_MSG_Q_POST_EXIT, Q, 0u, RetVal)
+#define  OS_TRACE_TASK_MSG_Q_PEND_EXIT(RetVal)                  OS_TRACE_REC_VAL(TASK_MSG_Q_PEND_EXIT, Q, 0u, RetVal)
+#define  OS_TRACE_TASK_SEM_POST_EXIT(RetVal)                    OS_TRACE_REC_VAL(TASK_SEM_POST_EXIT, SEM, 0u, RetVal)
+#define  OS_TRACE_TASK_SEM_PEND_EXIT(RetVal)                    OS_TRACE_REC_VAL(TASK_SEM_PEND_EXIT, SEM, 0u, RetVal)
+#define  OS_TRACE_TASK_RESUME_EXIT(RetVal)                      OS_TRACE_REC_VAL(TASK_RESUME_EXIT, TASK, 0u, RetVal)
+#define  OS_TRACE_TASK_SUSPEND_EXIT(RetVal)                     OS_TRACE_REC_VAL(TASK_SUSPEND_EXIT, TASK, 0u, RetVal)
+#define  OS_TRACE_SEM_DEL_EXIT(RetVal)                          OS_TRACE_REC_VAL(SEM_DEL_EXIT, SEM, 0u, RetVal)
+#define  OS_TRACE_SEM_POST_EXIT(RetVal)                         OS_TRACE_REC_VAL(SEM_POST_EXIT, SEM, 0u, RetVal)
+#define  OS_TRACE_SEM_PEND_EXIT(RetVal)                         OS_TRACE_REC_VAL(SEM_PEND_EXIT, SEM, 0u, RetVal)
+#define  OS_TRACE_Q_DEL_EXIT(RetVal)                            OS_TRACE_REC_VAL(Q_DEL_EXIT, Q, 0u, RetVal)
+#define  OS_TRACE_Q_POST_EXIT(RetVal)                           OS_TRACE_REC_VAL(Q_POST_EXIT, Q, 0u, RetVal)
+#define  OS_TRACE_Q_PEND_EXIT(RetVal)                           OS_TRACE_REC_VAL(Q_PEND_EXIT, Q, 0u, RetVal)
+#define  OS_TRACE_FLAG_DEL_EXIT(RetVal)                         OS_TRACE_REC_VAL(FLAG_DEL_EXIT, FLAG, 0u, RetVal)
+#define  OS_TRACE_FLAG_POST_EXIT(RetVal)                        OS_TRACE_REC_VAL(FLAG_POST_EXIT, FLAG, 0u, RetVal)
+#define  OS_TRACE_FLAG_PEND_EXIT(RetVal)                        OS_TRACE_REC_VAL(FLAG_PEND_EXIT, FLAG, 0u, RetVal)
+#define  OS_TRACE_MEM_PUT_EXIT(RetVal)                          OS_TRACE_REC_VAL(MEM_PUT_EXIT, MEM, 0u, RetVal)
+#define  OS_TRACE_MEM_GET_EXIT(RetVal)                          OS_TRACE_REC_VAL(MEM_GET_EXIT, MEM, 0u, RetVal)
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          CONFIGURATION ERRORS
+*********************************************************************************************************
+*/
+
+#if ((OS_TRACE_REC_BUF_SIZE & (OS_TRACE_REC_BUF_SIZE - 1u)) != 0u) || (OS_TRACE_REC_BUF_SIZE == 0u)
+#error  "os_trace_events.h, OS_TRACE_REC_BUF_SIZE MUST be a power of 2"
+#endif
+
+#if (OS_TRACE_REC_BUF_SIZE > 32768u)
+#error  "os_trace_events.h, OS_TRACE_REC_BUF_SIZE MUST be <= 32768"
+#endif
+
+#if (OS_TRACE_REC_MODE != OS_TRACE_REC_MODE_OVERWRITE) && \
+    (OS_TRACE_REC_MODE != OS_TRACE_REC_MODE_STOP)
+#error  "os_trace_events.h, OS_TRACE_REC_MODE is illegal"
+#endif
+
+#if (OS_TRACE_REC_SHED_LVL == 0u) || (OS_TRACE_REC_SHED_LVL > OS_TRACE_REC_BUF_SIZE)
+#error  "os_trace_events.h, OS_TRACE_REC_SHED_LVL MUST be >= 1 and <= OS_TRACE_REC_BUF_SIZE"
+#endif
+
+#endif
@@ -0,0 +1,572 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                      NATIVE BINARY TRACE RECORDER
+*
+* File    : os_trace_rec.c
+* Version : V3.08.00
+************************************************************************************************************************
+* Note(s) : (1) uC/OS-III runs on a single core, so a single ring buffer is used.
+*
+*           (2) On ports that provide exclusive access (OS_CPU_ATOMIC_EN, see os_cpu.h), a record is
+*               reserved without disabling interrupts.  On other ports, interrupts are disabled for
+*               the few instructions needed to reserve the record.  In both cases, the record itself
+*               is filled with interrupts enabled.
+*
+*           (3) The events of the classes selected with OSTraceRecShedSet() are dropped while the
+*               number of unread records is at or above the shed level, and counted per class.
+*
+*           (4) With OS_TRACE_REC_NOINIT_EN, the ring buffer, the write index and the validity header are the only
+*               variables placed in no-init RAM.  The header is written once by OSTraceRecInit(), the recording of
+*               an event is unchanged.
+************************************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "../../Source/os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_trace_rec__c = "$Id: $";
+#endif
+
+#if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN > 0u))
+/*
+************************************************************************************************************************
+*                                                    LOCAL DEFINES
+************************************************************************************************************************
+*/
+
+#if (defined(OS_CPU_ATOMIC_EN) && (OS_CPU_ATOMIC_EN > 0u))
+#define  OS_TRACE_REC_ATOMIC_EN             1u
+#else
+#define  OS_TRACE_REC_ATOMIC_EN             0u
+#endif
+
+#define  OS_TRACE_REC_IX_MASK               ((CPU_DATA)OS_TRACE_REC_BUF_SIZE - 1u)
+
+#define  OS_TRACE_REC_CLASS_NBR             8u                  /* One drop counter per OS_TRACE_REC_CLASS_xxx bit      */
+
+#if (OS_TRACE_REC_NOINIT_EN > 0u)                               /* Validity header of the no-init RAM (see Note #4)     */
+#define  OS_TRACE_REC_PM_MAGIC              ((CPU_INT32U)0x4D505452u)
+#define  OS_TRACE_REC_PM_CHK                (~(OS_TRACE_REC_PM_MAGIC ^ ((CPU_INT32U)OS_TRACE_REC_BUF_SIZE << 8u) ^ \
+                                               (CPU_INT32U)sizeof(OS_TRACE_REC)))
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                  GLOBAL VARIABLES
+************************************************************************************************************************
+*/
+
+CPU_INT16U  volatile  OSTraceRecFilter;                         /* Active filter, 0 when the recording is stopped       */
+
+
+/*
+************************************************************************************************************************
+*                                                   LOCAL VARIABLES
+************************************************************************************************************************
+*/
+
+#if (OS_TRACE_REC_NOINIT_EN > 0u)                                           /* Kept across a reset (see Note #4)        */
+static  OS_TRACE_REC            OS_TraceRecBuf[OS_TRACE_REC_BUF_SIZE] OS_TRACE_REC_NOINIT;
+static  CPU_DATA      volatile  OS_TraceRecWrIx                       OS_TRACE_REC_NOINIT;
+static  CPU_INT32U              OS_TraceRecPmHdr[2]                   OS_TRACE_REC_NOINIT;
+#else
+static  OS_TRACE_REC            OS_TraceRecBuf[OS_TRACE_REC_BUF_SIZE];      /* Ring buffer of records                   */
+
+static  CPU_DATA      volatile  OS_TraceRecWrIx;                            /* Number of records reserved by writers    */
+#endif
+static  CPU_DATA      volatile  OS_TraceRecRdIx;                            /* Number of records consumed by the reader */
+static  CPU_DATA      volatile  OS_TraceRecLostCtr;                         /* Number of records lost                   */
+static  CPU_INT16U              OS_TraceRecPmNbr;                           /* Records kept from the previous run       */
+
+static  CPU_TS                  OS_TraceRecTsStart;                         /* Time at which the buffer was cleared     */
+static  CPU_BOOLEAN   volatile  OS_TraceRecEn;                              /* Recording is enabled                     */
+static  CPU_INT16U    volatile  OS_TraceRecFilterSel;                       /* Filter selected by the application       */
+
+static  CPU_INT16U    volatile  OS_TraceRecShedCls;                         /* Classes dropped above the shed level     */
+static  CPU_DATA      volatile  OS_TraceRecShedLvl;                         /* Unread records above which to drop       */
+static  CPU_DATA      volatile  OS_TraceRecDropCtr[OS_TRACE_REC_CLASS_NBR]; /* Events dropped, per class                */
+
+
+/*
+************************************************************************************************************************
+*                                               INITIALIZE THE RECORDER
+*
+* Description: This function is called by OS_TRACE_INIT() to initialize the recorder.  Recording is stopped until
+*              OS_TRACE_START() is called.  The filter is set to record all the events.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) With OS_TRACE_REC_NOINIT_EN, the records found in the buffer are kept when the validity header
+*                 matches, i.e. when the RAM wasn't lost and was written by a build with the same buffer layout.  The
+*                 last record of the previous run may be incomplete if the reset hit while it was being written.
+************************************************************************************************************************
+*/
+
+void  OSTraceRecInit (void)
+{
+#if (OS_TRACE_REC_NOINIT_EN > 0u)
+    CPU_DATA     wr_ix;
+    CPU_DATA     nbr;
+    CPU_BOOLEAN  valid;
+
+
+    valid = ((OS_TraceRecPmHdr[0] == OS_TRACE_REC_PM_MAGIC) &&  /* Did the previous run leave valid records?            */
+             (OS_TraceRecPmHdr[1] == OS_TRACE_REC_PM_CHK)) ? OS_TRUE : OS_FALSE;
+    wr_ix = OS_TraceRecWrIx;
+#endif
+
+    OS_TraceRecEn        = OS_FALSE;
+    OS_TraceRecFilterSel = OS_TRACE_REC_CLASS_ALL;
+    OSTraceRecFilter     = 0u;
+    OS_TraceRecShedCls   = 0u;
+    OS_TraceRecShedLvl   = OS_TRACE_REC_SHED_LVL;
+    OSTraceRecClear();
+
+#if (OS_TRACE_REC_NOINIT_EN > 0u)
+    if (valid == OS_TRUE) {                                     /* Yes, keep the last ones (see Note #1)                */
+        nbr = wr_ix;
+        if (nbr > OS_TRACE_REC_BUF_SIZE) {
+            nbr = OS_TRACE_REC_BUF_SIZE;
+        }
+        OS_TraceRecWrIx  =  wr_ix;
+        OS_TraceRecRdIx  =  wr_ix - nbr;
+        OS_TraceRecPmNbr = (CPU_INT16U)nbr;
+    }
+    OS_TraceRecPmHdr[0] = OS_TRACE_REC_PM_MAGIC;
+    OS_TraceRecPmHdr[1] = OS_TRACE_REC_PM_CHK;
+#endif
+}
+
+
+/*
+************************************************************************************************************************
+*                                              START/STOP THE RECORDING
+*
+* Description: These functions are called by OS_TRACE_START() and OS_TRACE_STOP() to start or stop recording events.
+*              Stopping the recording doesn't discard the records that are in the buffer.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) The trace hooks only test OSTraceRecFilter, which is cleared while the recording is stopped.
+************************************************************************************************************************
+*/
+
+void  OSTraceRecStart (void)
+{
+    OS_TraceRecEn    = OS_TRUE;
+    OSTraceRecFilter = OS_TraceRecFilterSel;
+}
+
+
+
+void  OSTraceRecStop (void)
+{
+    OS_TraceRecEn    = OS_FALSE;
+    OSTraceRecFilter = 0u;
+}
+
+
+/*
+************************************************************************************************************************
+*                                              SET/GET THE EVENT FILTER
+*
+* Description: OSTraceRecFilterSet() selects the events that are recorded.  OSTraceRecFilterGet() returns the
+*              current selection.
+*
+* Arguments  : filter      is a combination of OS_TRACE_REC_CLASS_xxx and OS_TRACE_REC_SEL(OS_TRACE_REC_CLASS_xxx)
+*                          (see 'EVENT FILTER' in os_trace_events.h)
+*
+* Returns    : OSTraceRecFilterGet() returns the filter selected by the application, even if the recording is
+*              stopped.
+*
+* Note(s)    : 1) The filter can be changed while recording.  It takes effect on the next event.
+************************************************************************************************************************
+*/
+
+void  OSTraceRecFilterSet (CPU_INT16U  filter)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    OS_TraceRecFilterSel = filter;
+    if (OS_TraceRecEn == OS_TRUE) {
+        OSTraceRecFilter = filter;
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+
+
+CPU_INT16U  OSTraceRecFilterGet (void)
+{
+    return (OS_TraceRecFilterSel);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  CLEAR THE RECORDER
+*
+* Description: This function is called by OS_TRACE_CLEAR() to discard all the records, the lost record counter and
+*              the drop counters.
+*              The timestamps of the following records are relative to the moment this function is called.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSTraceRecClear (void)
+{
+    CPU_INT08U  ix;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    OS_TraceRecWrIx    = 0u;
+    OS_TraceRecRdIx    = 0u;
+    OS_TraceRecLostCtr = 0u;
+    OS_TraceRecPmNbr   = 0u;
+    for (ix = 0u; ix < OS_TRACE_REC_CLASS_NBR; ix++) {
+        OS_TraceRecDropCtr[ix] = 0u;
+    }
+    OS_TraceRecTsStart = OS_TS_GET();
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+************************************************************************************************************************
+*                                                   READ THE RECORDS
+*
+* Description: This function copies the oldest records of the buffer to 'p_dest' and removes them from the buffer.
+*              The application then sends them to the host over the transport of its choice.
+*
+* Arguments  : p_dest      is a pointer to where the records will be copied
+*
+*              nbr_max     is the maximum number of records to copy
+*
+* Returns    : The number of records copied to 'p_dest'.
+*
+* Note(s)    : 1) This function MUST be called from a single task.  It can be called while recording.
+*
+*              2) In OS_TRACE_REC_MODE_OVERWRITE, the records that the writers overwrote before they could be read
+*                 are skipped and added to the lost record counter (see OSTraceRecLostGet()).
+*
+*              3) A record that is being written by a task preempted by the reader may be returned before it is
+*                 complete.  Stop the recording before reading if this matters.
+************************************************************************************************************************
+*/
+
+CPU_INT16U  OSTraceRecRead (OS_TRACE_REC  *p_dest,
+                            CPU_INT16U     nbr_max)
+{
+    OS_TRACE_REC  *p_rec;
+    CPU_DATA       rd_ix;
+    CPU_DATA       wr_ix;
+    CPU_INT16U     nbr_rd;
+
+
+    if (p_dest == (OS_TRACE_REC *)0) {
+        return (0u);
+    }
+
+    nbr_rd = 0u;
+    rd_ix  = OS_TraceRecRdIx;
+    while (nbr_rd < nbr_max) {
+        wr_ix = OS_TraceRecWrIx;
+        if (rd_ix == wr_ix) {                                   /* Buffer is empty                                      */
+            break;
+        }
+#if (OS_TRACE_REC_MODE == OS_TRACE_REC_MODE_OVERWRITE)
+        if ((wr_ix - rd_ix) > OS_TRACE_REC_BUF_SIZE) {          /* Skip the records that were overwritten (See Note #2) */
+            OS_TraceRecLostCtr += (wr_ix - OS_TRACE_REC_BUF_SIZE) - rd_ix;
+            rd_ix               =  wr_ix - OS_TRACE_REC_BUF_SIZE;
+        }
+#endif
+        p_rec                 = &OS_TraceRecBuf[rd_ix & OS_TRACE_REC_IX_MASK];
+        p_dest[nbr_rd].Ts     =  p_rec->Ts;
+        p_dest[nbr_rd].EvtId  =  p_rec->EvtId;
+        p_dest[nbr_rd].Arg    =  p_rec->Arg;
+        p_dest[nbr_rd].ObjId  =  p_rec->ObjId;
+#if (OS_TRACE_REC_MODE == OS_TRACE_REC_MODE_OVERWRITE)
+        if ((OS_TraceRecWrIx - rd_ix) > OS_TRACE_REC_BUF_SIZE) {/* Was the record overwritten while we copied it?       */
+            continue;                                           /* Yes, discard the copy                                */
+        }
+#endif
+        rd_ix++;
+        nbr_rd++;
+    }
+    OS_TraceRecRdIx = rd_ix;                                    /* Free the records that were read                      */
+
+    return (nbr_rd);
+}
+
+
+/*
+************************************************************************************************************************
+*                                            GET THE NUMBER OF LOST RECORDS
+*
+* Description: This function returns the number of records that were lost since the recorder was last cleared,
+*              either because the buffer was full (OS_TRACE_REC_MODE_STOP) or because they were overwritten before
+*              being read (OS_TRACE_REC_MODE_OVERWRITE).
+*
+* Arguments  : none
+*
+* Returns    : The number of lost records.
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+CPU_INT32U  OSTraceRecLostGet (void)
+{
+    return ((CPU_INT32U)OS_TraceRecLostCtr);
+}
+
+
+/*
+************************************************************************************************************************
+*                                  GET THE NUMBER OF RECORDS KEPT FROM THE PREVIOUS RUN
+*
+* Description: This function returns the number of records that OSTraceRecInit() kept from before the last reset.
+*              They are the oldest records of the buffer, the next OSTraceRecRead() calls return them first.
+*
+* Arguments  : none
+*
+* Returns    : The number of records kept, 0 if there were none, if OS_TRACE_REC_NOINIT_EN is 0 or if the recorder was
+*              cleared since.
+*
+* Note(s)    : 1) The timestamps of these records are relative to the start of the previous run.
+************************************************************************************************************************
+*/
+
+CPU_INT16U  OSTraceRecPmNbrGet (void)
+{
+    return (OS_TraceRecPmNbr);
+}
+
+
+/*
+************************************************************************************************************************
+*                                             SET THE EVENTS TO SHED FIRST
+*
+* Description: This function selects the classes of events that are dropped when the reader falls behind, before the
+*              buffer is full.  This keeps room in the buffer for the other classes, e.g. the tick and ISR events can
+*              be shed so that the task switches still reach the host when the transport is saturated.
+*
+* Arguments  : cls         is a combination of OS_TRACE_REC_CLASS_xxx, 0 to never drop events before the buffer is full
+*
+*              lvl         is the number of unread records at and above which the events of 'cls' are dropped.  0
+*                          selects OS_TRACE_REC_SHED_LVL.
+*
+* Returns    : none
+*
+* Note(s)    : 1) The class of an object event is the class of the object, whether it was recorded because its
+*                 class or the object itself was selected by the filter.
+************************************************************************************************************************
+*/
+
+void  OSTraceRecShedSet (CPU_INT16U  cls,
+                         CPU_INT16U  lvl)
+{
+    CPU_SR_ALLOC();
+
+
+    if ((lvl == 0u) || (lvl > OS_TRACE_REC_BUF_SIZE)) {
+        lvl = OS_TRACE_REC_SHED_LVL;
+    }
+
+    CPU_CRITICAL_ENTER();
+    OS_TraceRecShedCls = cls & OS_TRACE_REC_CLASS_ALL;
+    OS_TraceRecShedLvl = lvl;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+************************************************************************************************************************
+*                                           GET THE NUMBER OF DROPPED EVENTS
+*
+* Description: This function returns the number of events of the given classes that were dropped because the reader
+*              was behind (see OSTraceRecShedSet()) since the recorder was last cleared.
+*
+* Arguments  : cls         is a combination of OS_TRACE_REC_CLASS_xxx, OS_TRACE_REC_CLASS_ALL for the total
+*
+* Returns    : The number of dropped events.
+*
+* Note(s)    : 1) The dropped events are not included in OSTraceRecLostGet().
+************************************************************************************************************************
+*/
+
+CPU_INT32U  OSTraceRecDropGet (CPU_INT16U  cls)
+{
+    CPU_INT32U  nbr;
+    CPU_INT08U  ix;
+
+
+    nbr = 0u;
+    for (ix = 0u; ix < OS_TRACE_REC_CLASS_NBR; ix++) {
+        if ((cls & (CPU_INT16U)(1u << ix)) != 0u) {
+            nbr += (CPU_INT32U)OS_TraceRecDropCtr[ix];
+        }
+    }
+    return (nbr);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 COUNT A DROPPED EVENT
+*
+* Description: This function adds a dropped event to the counter of its class.
+*
+* Arguments  : cls         is the class of the event, a single OS_TRACE_REC_CLASS_xxx bit
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to the recorder.
+************************************************************************************************************************
+*/
+
+static  void  OS_TraceRecDrop (CPU_INT16U  cls)
+{
+    CPU_DATA  volatile  *p_ctr;
+#if (OS_TRACE_REC_ATOMIC_EN > 0u)
+    CPU_DATA             ctr;
+#else
+    CPU_SR_ALLOC();
+#endif
+
+
+    p_ctr = &OS_TraceRecDropCtr[0];
+    while ((cls & 1u) == 0u) {                                  /* Find the counter of the class                        */
+        cls >>= 1u;
+        p_ctr++;
+    }
+#if (OS_TRACE_REC_ATOMIC_EN > 0u)
+    do {
+        ctr = OS_CPU_DataLoadExcl(p_ctr);
+    } while (OS_CPU_DataStoreExcl(p_ctr, ctr + 1u) == OS_FALSE);
+#else
+    CPU_CRITICAL_ENTER();
+   *p_ctr += 1u;
+    CPU_CRITICAL_EXIT();
+#endif
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  RECORD AN EVENT
+*
+* Description: This function is called by the OS_TRACE_xxx() macros to write a record in the buffer.
+*
+* Arguments  : evt_id      is the identifier of the event (OS_TRACE_REC_EVT_xxx)
+*
+*              cls         is the class of the event (OS_TRACE_REC_CLASS_xxx).  The trace id of an object is accepted,
+*                          its selection bits are ignored.
+*
+*              obj_id      is the object or value associated with the event
+*
+*              arg         is the argument of the event
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to the recorder and your application should not call it.  The event
+*                 has already been accepted by the filter.
+*
+*              2) The timestamp is read while the record is reserved so that the timestamps of consecutive records
+*                 never go backwards.
+*
+*              3) The shed test reads the indexes without reserving a record, so that a dropped event costs as little
+*                 as possible.  An event may be kept or dropped one record early or late.
+************************************************************************************************************************
+*/
+
+void  OS_TraceRecEvt (CPU_INT16U  evt_id,
+                      CPU_INT16U  cls,
+                      CPU_INT32U  obj_id,
+                      CPU_INT16U  arg)
+{
+    OS_TRACE_REC  *p_rec;
+    CPU_DATA       wr_ix;
+    CPU_TS         ts;
+#if (OS_TRACE_REC_ATOMIC_EN > 0u)
+#if (OS_TRACE_REC_MODE == OS_TRACE_REC_MODE_STOP)
+    CPU_DATA       lost_ctr;
+#endif
+#else
+    CPU_SR_ALLOC();
+#endif
+
+
+    cls &= OS_TRACE_REC_CLASS_ALL;
+    if ((cls & OS_TraceRecShedCls) != 0u) {                     /* Reader behind, shed this class? (see Note #3)        */
+        if ((OS_TraceRecWrIx - OS_TraceRecRdIx) >= OS_TraceRecShedLvl) {
+            OS_TraceRecDrop(cls);
+            return;
+        }
+    }
+
+#if (OS_TRACE_REC_ATOMIC_EN > 0u)
+    do {                                                        /* Reserve a record (see Note #2)                       */
+        wr_ix = OS_CPU_DataLoadExcl(&OS_TraceRecWrIx);
+#if (OS_TRACE_REC_MODE == OS_TRACE_REC_MODE_STOP)
+        if ((wr_ix - OS_TraceRecRdIx) >= OS_TRACE_REC_BUF_SIZE) {
+            do {                                                /* Buffer is full, count the lost record                */
+                lost_ctr = OS_CPU_DataLoadExcl(&OS_TraceRecLostCtr);
+            } while (OS_CPU_DataStoreExcl(&OS_TraceRecLostCtr, lost_ctr + 1u) == OS_FALSE);
+            return;
+        }
+#endif
+        ts    = OS_TS_GET();
+    } while (OS_CPU_DataStoreExcl(&OS_TraceRecWrIx, wr_ix + 1u) == OS_FALSE);
+#else
+    CPU_CRITICAL_ENTER();                                       /* Reserve a record (see Note #2)                       */
+    wr_ix = OS_TraceRecWrIx;
+#if (OS_TRACE_REC_MODE == OS_TRACE_REC_MODE_STOP)
+    if ((wr_ix - OS_TraceRecRdIx) >= OS_TRACE_REC_BUF_SIZE) {
+        OS_TraceRecLostCtr++;                                   /* Buffer is full, count the lost record                */
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+#endif
+    ts              = OS_TS_GET();
+    OS_TraceRecWrIx = wr_ix + 1u;
+    CPU_CRITICAL_EXIT();
+#endif
+
+    p_rec        = &OS_TraceRecBuf[wr_ix & OS_TRACE_REC_IX_MASK];
+    p_rec->Ts    = (CPU_INT32U)(ts - OS_TraceRecTsStart);
+    p_rec->EvtId =  evt_id;
+    p_rec->Arg   =  arg;
+    p_rec->ObjId =  obj_id;
+}
+#endif
@@ -0,0 +1,246 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                  NATIVE BINARY TRACE RECORDER - STREAMING
+*
+* File    : os_trace_stream.c
+* Version : V3.08.00
+************************************************************************************************************************
+* Note(s) : (1) The streaming task is the single reader of the ring buffer required by OSTraceRecRead().  The
+*               application MUST NOT call OSTraceRecRead() once the streaming task is started.
+*
+*           (2) The task only runs when no other task is ready (give it a low priority), and it is the only code
+*               that waits for the transport.  While the ring buffer is empty, it sleeps for 'period' ticks so
+*               that the records are sent in batches instead of one call per event.
+************************************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "../../Source/os.h"
+#include "os_trace_stream.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_trace_stream__c = "$Id: $";
+#endif
+
+#if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN > 0u))
+/*
+************************************************************************************************************************
+*                                                   LOCAL VARIABLES
+************************************************************************************************************************
+*/
+
+static  OS_TCB                  OS_TraceStreamTCB;
+static  OS_TRACE_REC            OS_TraceStreamBuf[OS_TRACE_STREAM_BATCH];   /* Records being sent                       */
+
+static  OS_TRACE_STREAM_FNCT    OS_TraceStreamFnct;                         /* Transport function                       */
+static  void                   *OS_TraceStreamArg;                          /* Argument of the transport function       */
+static  OS_TICK                 OS_TraceStreamPeriod;                       /* Ticks to sleep when the buffer is empty  */
+
+static  OS_TRACE_STREAM_STAT    OS_TraceStreamStat;
+
+
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  void  OS_TraceStreamTask (void  *p_arg);
+
+
+/*
+************************************************************************************************************************
+*                                              START STREAMING THE RECORDS
+*
+* Description: This function creates the task that sends the records to the host through 'p_fnct'.
+*
+* Arguments  : p_fnct      is the transport function (see Note #2 in os_trace_stream.h)
+*
+*              p_arg       is passed to 'p_fnct' unchanged (channel, port, device, ...)
+*
+*              prio        is the priority of the streaming task.  It should be just above the idle task.
+*
+*              p_stk_base  is the base address of the stack of the streaming task
+*
+*              stk_size    is the size of the stack, in number of CPU_STK elements
+*
+*              period      is the number of ticks the task sleeps when the buffer is empty, 1 or more
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE              The streaming task was created
+*                              OS_ERR_PTR_INVALID       If 'p_fnct' is a NULL pointer
+*                              OS_ERR_TIME_ZERO_DLY     If 'period' is 0
+*                              OS_ERR_TASK_CREATE_ISR   If called from an ISR
+*                              Other errors from OSTaskCreate()
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function MUST be called once, after OSInit().
+************************************************************************************************************************
+*/
+
+void  OSTraceStreamStart (OS_TRACE_STREAM_FNCT   p_fnct,
+                          void                  *p_arg,
+                          OS_PRIO                prio,
+                          CPU_STK               *p_stk_base,
+                          CPU_STK_SIZE           stk_size,
+                          OS_TICK                period,
+                          OS_ERR                *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    if (p_fnct == (OS_TRACE_STREAM_FNCT)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    if (period == 0u) {
+       *p_err = OS_ERR_TIME_ZERO_DLY;
+        return;
+    }
+
+    OS_TraceStreamFnct           = p_fnct;
+    OS_TraceStreamArg            = p_arg;
+    OS_TraceStreamPeriod         = period;
+    OS_TraceStreamStat.BytesSent = 0u;
+    OS_TraceStreamStat.BatchNbr  = 0u;
+    OS_TraceStreamStat.BusyNbr   = 0u;
+
+    OSTaskCreate(&OS_TraceStreamTCB,
+                 (CPU_CHAR *)((void *)"uC/OS-III Trace Stream Task"),
+                  OS_TraceStreamTask,
+                 (void     *)0,
+                  prio,
+                  p_stk_base,
+                  stk_size / 10u,
+                  stk_size,
+                  0u,
+                  0u,
+                 (void     *)0,
+                 (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_NO_TLS),
+                  p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                            GET THE STREAMING STATISTICS
+*
+* Description: This function copies the counters of the streaming task.
+*
+* Arguments  : p_stat      is a pointer to where the counters will be copied
+*
+* Returns    : none
+*
+* Note(s)    : 1) 'BusyNbr' growing faster than 'BatchNbr' means the link is the bottleneck, compare with
+*                 OSTraceRecDropGet() and OSTraceRecLostGet() to see what it cost.
+************************************************************************************************************************
+*/
+
+void  OSTraceStreamStatGet (OS_TRACE_STREAM_STAT  *p_stat)
+{
+    CPU_SR_ALLOC();
+
+
+    if (p_stat == (OS_TRACE_STREAM_STAT *)0) {
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+   *p_stat = OS_TraceStreamStat;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  STREAMING TASK
+*
+* Description: This task reads up to OS_TRACE_STREAM_BATCH records from the ring buffer and hands them to the
+*              transport until all their bytes are taken, then reads the next batch.
+*
+* Arguments  : p_arg       is not used
+*
+* Returns    : none
+*
+* Note(s)    : 1) When the link is busy, the task retries on the next tick.  The ring buffer keeps filling meanwhile
+*                 and sheds or loses events according to its configuration, the kernel is never held up.
+*
+*              2) When the last batch was not full, the buffer was drained.  The task sleeps for the period so that
+*                 the next batch is bigger.
+************************************************************************************************************************
+*/
+
+static  void  OS_TraceStreamTask (void  *p_arg)
+{
+    CPU_INT16U  nbr_rec;
+    CPU_INT16U  nbr_bytes;
+    CPU_INT16U  ix;
+    CPU_INT16U  nbr_sent;
+    OS_ERR      err;
+    CPU_SR_ALLOC();
+
+
+    (void)p_arg;                                                /* Prevent compiler warning for not using 'p_arg'       */
+
+    nbr_rec   = 0u;
+    nbr_bytes = 0u;
+    ix        = 0u;
+    for (;;) {
+        if (ix >= nbr_bytes) {                                  /* Batch sent, read the next one                        */
+            if (nbr_rec < OS_TRACE_STREAM_BATCH) {              /* Buffer drained, let the records build up (Note #2)   */
+                OSTimeDly(OS_TraceStreamPeriod, OS_OPT_TIME_DLY, &err);
+            }
+            nbr_rec = OSTraceRecRead(&OS_TraceStreamBuf[0], OS_TRACE_STREAM_BATCH);
+            if (nbr_rec == 0u) {
+                continue;
+            }
+            nbr_bytes = (CPU_INT16U)(nbr_rec * sizeof(OS_TRACE_REC));
+            ix        = 0u;
+            CPU_CRITICAL_ENTER();
+            OS_TraceStreamStat.BatchNbr++;
+            CPU_CRITICAL_EXIT();
+        }
+
+        nbr_sent = OS_TraceStreamFnct(OS_TraceStreamArg,
+                                      (const void *)((CPU_INT08U *)&OS_TraceStreamBuf[0] + ix),
+                                      nbr_bytes - ix);
+        if (nbr_sent > (nbr_bytes - ix)) {                      /* Don't trust the transport beyond what it was given   */
+            nbr_sent = nbr_bytes - ix;
+        }
+        ix += nbr_sent;
+
+        CPU_CRITICAL_ENTER();
+        OS_TraceStreamStat.BytesSent += nbr_sent;
+        if (nbr_sent == 0u) {
+            OS_TraceStreamStat.BusyNbr++;
+        }
+        CPU_CRITICAL_EXIT();
+
+        if (nbr_sent == 0u) {                                   /* Link busy, retry on the next tick (See Note #1)      */
+            OSTimeDly(1u, OS_OPT_TIME_DLY, &err);
+        }
+    }
+}
+#endif
@@ -0,0 +1,110 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                  NATIVE BINARY TRACE RECORDER - STREAMING
+*
+* File    : os_trace_stream.h
+* Version : V3.08.00
+*********************************************************************************************************
+* Note(s) : (1) os_trace_stream.c creates a low priority task that moves the records from the ring
+*               buffer to the host while the application runs.  The records are handed, in batches of
+*               up to OS_TRACE_STREAM_BATCH records, to a transport function supplied by the
+*               application.
+*
+*           (2) The transport function MUST NOT block.  It takes as many bytes as the link can accept
+*               right now and returns that number, 0 if the link is busy.  It no longer refers to
+*               'p_data' once it returns, so a transport using DMA copies the bytes to its own
+*               buffer first.  For example:
+*
+*                   SEGGER RTT      return SEGGER_RTT_WriteNoLock(channel, p_data, nbr_bytes);
+*                   Cortex-M ITM    write the bytes to a stimulus port while it is ready
+*                   UART with DMA   copy to the free part of the DMA buffer, start the transfer
+*
+*           (3) The streaming task never holds up the kernel.  When the link can't keep up, the buffer
+*               fills and the records are dropped (see OSTraceRecShedSet()) or lost (see
+*               OSTraceRecLostGet()), the host sees the gap in the records.
+*
+*           (4) Configuration, in os_cfg.h or on the compiler command line:
+*
+*                   OS_TRACE_STREAM_BATCH   Maximum number of records handed to the transport at once.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_TRACE_STREAM_H
+#define  OS_TRACE_STREAM_H
+
+
+#include  <os.h>
+
+
+/*
+*********************************************************************************************************
+*                                            CONFIGURATION
+*********************************************************************************************************
+*/
+
+#ifndef  OS_TRACE_STREAM_BATCH
+#define  OS_TRACE_STREAM_BATCH                                    32u
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                              DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  CPU_INT16U  (*OS_TRACE_STREAM_FNCT)(void        *p_arg,    /* Transport function (see Note #2)         */
+                                             const void  *p_data,
+                                             CPU_INT16U   nbr_bytes);
+
+typedef  struct  os_trace_stream_stat {
+    CPU_INT32U  BytesSent;                                      /* Bytes taken by the transport                         */
+    CPU_INT32U  BatchNbr;                                       /* Batches read from the ring buffer                    */
+    CPU_INT32U  BusyNbr;                                        /* Calls that found the link busy                       */
+} OS_TRACE_STREAM_STAT;
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void        OSTraceStreamStart  (OS_TRACE_STREAM_FNCT   p_fnct,
+                                 void                  *p_arg,
+                                 OS_PRIO                prio,
+                                 CPU_STK               *p_stk_base,
+                                 CPU_STK_SIZE           stk_size,
+                                 OS_TICK                period,
+                                 OS_ERR                *p_err);
+
+void        OSTraceStreamStatGet(OS_TRACE_STREAM_STAT  *p_stat);
+
+
+/*
+*********************************************************************************************************
+*                                         CONFIGURATION ERRORS
+*********************************************************************************************************
+*/
+
+#if (OS_TRACE_STREAM_BATCH == 0u) || (OS_TRACE_STREAM_BATCH > 5461u)
+#error  "os_trace_stream.h, OS_TRACE_STREAM_BATCH MUST be >= 1 and <= 5461 (65535 bytes)"
+#endif
+
+#endif